@@ -22,6 +22,9 @@
 
 #include <string>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 using namespace chip;
 using namespace chip::app::Clusters::DiagnosticLogs;
 
@@ -64,6 +67,21 @@ LogProvider::~LogProvider()
         }
     }
     mFiles.clear();
+
+    for (auto & log : mMappedLogs)
+    {
+        UnmapLog(log.second);
+    }
+    mMappedLogs.clear();
+}
+
+void LogProvider::UnmapLog(MappedLog & log)
+{
+    if (log.mData != nullptr && munmap(const_cast<uint8_t *>(log.mData), log.mSize) != 0)
+    {
+        ChipLogError(NotSpecified, "Error when unmapping log: %p (%d)", log.mData, errno);
+    }
+    log = MappedLog();
 }
 
 CHIP_ERROR LogProvider::GetLogForIntent(IntentEnum intent, MutableByteSpan & outBuffer, Optional<uint64_t> & outTimeStamp,
@@ -114,6 +132,13 @@ CHIP_ERROR LogProvider::EndLogCollection(LogSessionHandle sessionHandle)
     auto fp = mFiles[sessionHandle];
     mFiles.erase(sessionHandle);
 
+    auto mappedLog = mMappedLogs.find(sessionHandle);
+    if (mappedLog != mMappedLogs.end())
+    {
+        UnmapLog(mappedLog->second);
+        mMappedLogs.erase(mappedLog);
+    }
+
     auto rv = fclose(fp);
     VerifyOrReturnError(rv == 0, CHIP_ERROR_POSIX(errno));
 
@@ -139,6 +164,42 @@ CHIP_ERROR LogProvider::CollectLog(LogSessionHandle sessionHandle, MutableByteSp
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR LogProvider::GetNextLogChunk(LogSessionHandle sessionHandle, size_t maxLength, ByteSpan & outChunk, bool & outIsEndOfLog)
+{
+    VerifyOrReturnValue(sessionHandle != kInvalidLogSessionHandle, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnValue(mFiles.count(sessionHandle), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Map the whole file on the first chunk, so that the following chunks are read in place rather than copied. The
+    // transfer covers the size of the file at that point.
+    auto mappedLog = mMappedLogs.find(sessionHandle);
+    if (mappedLog == mMappedLogs.end())
+    {
+        MappedLog log;
+        struct stat fileStat;
+        int fd = fileno(mFiles[sessionHandle]);
+        VerifyOrReturnError(fd >= 0 && fstat(fd, &fileStat) == 0, CHIP_ERROR_POSIX(errno));
+        VerifyOrReturnError(CanCastTo<size_t>(fileStat.st_size), CHIP_ERROR_INTERNAL);
+
+        log.mSize = static_cast<size_t>(fileStat.st_size);
+        if (log.mSize > 0)
+        {
+            void * data = mmap(nullptr, log.mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            VerifyOrReturnError(data != MAP_FAILED, CHIP_ERROR_POSIX(errno));
+            // The chunks are read sequentially.
+            madvise(data, log.mSize, MADV_SEQUENTIAL);
+            log.mData = static_cast<const uint8_t *>(data);
+        }
+        mappedLog = mMappedLogs.emplace(sessionHandle, log).first;
+    }
+
+    MappedLog & log = mappedLog->second;
+    size_t count    = std::min(log.mSize - log.mOffset, maxLength);
+    outChunk        = ByteSpan(log.mData + log.mOffset, count);
+    log.mOffset += count;
+    outIsEndOfLog = (log.mOffset == log.mSize);
+    return CHIP_NO_ERROR;
+}
+
 size_t LogProvider::GetSizeForIntent(IntentEnum intent)
 {
     VerifyOrReturnValue(IsValidIntent(intent), 0);
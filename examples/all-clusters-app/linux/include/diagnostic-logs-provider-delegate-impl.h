@@ -50,6 +50,8 @@ public:
                                   Optional<uint64_t> & outTimeSinceBoot) override;
     CHIP_ERROR EndLogCollection(LogSessionHandle sessionHandle) override;
     CHIP_ERROR CollectLog(LogSessionHandle sessionHandle, MutableByteSpan & outBuffer, bool & outIsEndOfLog) override;
+    CHIP_ERROR GetNextLogChunk(LogSessionHandle sessionHandle, size_t maxLength, ByteSpan & outChunk,
+                               bool & outIsEndOfLog) override;
     size_t GetSizeForIntent(IntentEnum intent) override;
     CHIP_ERROR GetLogForIntent(IntentEnum intent, MutableByteSpan & outBuffer, Optional<uint64_t> & outTimeStamp,
                                Optional<uint64_t> & outTimeSinceBoot) override;
@@ -68,7 +70,18 @@ private:
     Optional<std::string> mNetworkDiagnosticsLogFilePath;
     Optional<std::string> mCrashLogFilePath;
 
+    // Log file mapped in memory for the chunks of a session, and the offset of the next chunk.
+    struct MappedLog
+    {
+        const uint8_t * mData = nullptr;
+        size_t mSize          = 0;
+        size_t mOffset        = 0;
+    };
+
+    static void UnmapLog(MappedLog & log);
+
     std::map<LogSessionHandle, FILE *> mFiles;
+    std::map<LogSessionHandle, MappedLog> mMappedLogs;
 
     LogSessionHandle mLogSessionHandle = kInvalidLogSessionHandle;
 };
@@ -476,72 +476,6 @@ void HandleDeviceTempSensorStatusChanged(DeviceTempSensor * dev, DeviceTempSenso
     }
 }
 
-Protocols::InteractionModel::Status HandleReadBridgedDeviceBasicAttribute(Device * dev, chip::AttributeId attributeId,
-                                                                          uint8_t * buffer, uint16_t maxReadLength)
-{
-    using namespace BridgedDeviceBasicInformation::Attributes;
-
-    ChipLogProgress(DeviceLayer, "HandleReadBridgedDeviceBasicAttribute: attrId=%d, maxReadLength=%d", attributeId, maxReadLength);
-
-    if ((attributeId == Reachable::Id) && (maxReadLength == 1))
-    {
-        *buffer = dev->IsReachable() ? 1 : 0;
-    }
-    else if ((attributeId == NodeLabel::Id) && (maxReadLength == 32))
-    {
-        MutableByteSpan zclNameSpan(buffer, maxReadLength);
-        TEMPORARY_RETURN_IGNORED MakeZclCharString(zclNameSpan, dev->GetName());
-    }
-    else if ((attributeId == UniqueID::Id) && (maxReadLength == 32))
-    {
-        MutableByteSpan zclUniqueIdSpan(buffer, maxReadLength);
-        TEMPORARY_RETURN_IGNORED MakeZclCharString(zclUniqueIdSpan, dev->GetUniqueId());
-    }
-    else if ((attributeId == ConfigurationVersion::Id) && (maxReadLength == 4))
-    {
-        uint32_t configVersion = dev->GetConfigurationVersion();
-        memcpy(buffer, &configVersion, sizeof(configVersion));
-    }
-    else if ((attributeId == ClusterRevision::Id) && (maxReadLength == 2))
-    {
-        uint16_t rev = ZCL_BRIDGED_DEVICE_BASIC_INFORMATION_CLUSTER_REVISION;
-        memcpy(buffer, &rev, sizeof(rev));
-    }
-    else if ((attributeId == FeatureMap::Id) && (maxReadLength == 4))
-    {
-        uint32_t featureMap = ZCL_BRIDGED_DEVICE_BASIC_INFORMATION_FEATURE_MAP;
-        memcpy(buffer, &featureMap, sizeof(featureMap));
-    }
-    else
-    {
-        return Protocols::InteractionModel::Status::Failure;
-    }
-
-    return Protocols::InteractionModel::Status::Success;
-}
-
-Protocols::InteractionModel::Status HandleReadOnOffAttribute(DeviceOnOff * dev, chip::AttributeId attributeId, uint8_t * buffer,
-                                                             uint16_t maxReadLength)
-{
-    ChipLogProgress(DeviceLayer, "HandleReadOnOffAttribute: attrId=%d, maxReadLength=%d", attributeId, maxReadLength);
-
-    if ((attributeId == OnOff::Attributes::OnOff::Id) && (maxReadLength == 1))
-    {
-        *buffer = dev->IsOn() ? 1 : 0;
-    }
-    else if ((attributeId == OnOff::Attributes::ClusterRevision::Id) && (maxReadLength == 2))
-    {
-        uint16_t rev = ZCL_ON_OFF_CLUSTER_REVISION;
-        memcpy(buffer, &rev, sizeof(rev));
-    }
-    else
-    {
-        return Protocols::InteractionModel::Status::Failure;
-    }
-
-    return Protocols::InteractionModel::Status::Success;
-}
-
 Protocols::InteractionModel::Status HandleWriteOnOffAttribute(DeviceOnOff * dev, chip::AttributeId attributeId, uint8_t * buffer)
 {
     ChipLogProgress(DeviceLayer, "HandleWriteOnOffAttribute: attrId=%d", attributeId);
@@ -589,72 +523,101 @@ Protocols::InteractionModel::Status HandleWriteBridgedDeviceBasicAttribute(Devic
     return Protocols::InteractionModel::Status::Success;
 }
 
-Protocols::InteractionModel::Status HandleReadTempMeasurementAttribute(DeviceTempSensor * dev, chip::AttributeId attributeId,
-                                                                       uint8_t * buffer, uint16_t maxReadLength)
-{
-    using namespace TemperatureMeasurement::Attributes;
+namespace {
 
-    if ((attributeId == MeasuredValue::Id) && (maxReadLength == 2))
-    {
-        int16_t measuredValue = dev->GetMeasuredValue();
-        memcpy(buffer, &measuredValue, sizeof(measuredValue));
-    }
-    else if ((attributeId == MinMeasuredValue::Id) && (maxReadLength == 2))
-    {
-        int16_t minValue = dev->mMin;
-        memcpy(buffer, &minValue, sizeof(minValue));
-    }
-    else if ((attributeId == MaxMeasuredValue::Id) && (maxReadLength == 2))
-    {
-        int16_t maxValue = dev->mMax;
-        memcpy(buffer, &maxValue, sizeof(maxValue));
-    }
-    else if ((attributeId == FeatureMap::Id) && (maxReadLength == 4))
-    {
-        uint32_t featureMap = ZCL_TEMPERATURE_SENSOR_FEATURE_MAP;
-        memcpy(buffer, &featureMap, sizeof(featureMap));
-    }
-    else if ((attributeId == ClusterRevision::Id) && (maxReadLength == 2))
-    {
-        uint16_t clusterRevision = ZCL_TEMPERATURE_SENSOR_CLUSTER_REVISION;
-        memcpy(buffer, &clusterRevision, sizeof(clusterRevision));
-    }
-    else
-    {
-        return Protocols::InteractionModel::Status::Failure;
-    }
+// Attributes served from the bridged devices are read through flat tables holding one reader per attribute, in the
+// order of the cluster's attribute list, so that a read is dispatched by the position of its metadata in the list
+// instead of comparing attribute ids. This keeps wildcard reads cheap on bridges with many bridged endpoints.
+using AttributeReader = void (*)(Device * dev, uint8_t * buffer, uint16_t maxReadLength);
 
-    return Protocols::InteractionModel::Status::Success;
+template <typename T>
+void CopyValue(uint8_t * buffer, T value)
+{
+    memcpy(buffer, &value, sizeof(value));
 }
 
+const AttributeReader kOnOffReaders[] = {
+    [](Device * dev, uint8_t * buffer, uint16_t) { *buffer = static_cast<DeviceOnOff *>(dev)->IsOn() ? 1 : 0; },
+    [](Device *, uint8_t * buffer, uint16_t) { CopyValue<uint16_t>(buffer, ZCL_ON_OFF_CLUSTER_REVISION); },
+};
+static_assert(MATTER_ARRAY_SIZE(kOnOffReaders) == MATTER_ARRAY_SIZE(onOffAttrs));
+
+const AttributeReader kBridgedDeviceBasicReaders[] = {
+    [](Device * dev, uint8_t * buffer, uint16_t maxReadLength) {
+        MutableByteSpan zclNameSpan(buffer, maxReadLength);
+        TEMPORARY_RETURN_IGNORED MakeZclCharString(zclNameSpan, dev->GetName());
+    },
+    [](Device * dev, uint8_t * buffer, uint16_t) { *buffer = dev->IsReachable() ? 1 : 0; },
+    [](Device * dev, uint8_t * buffer, uint16_t maxReadLength) {
+        MutableByteSpan zclUniqueIdSpan(buffer, maxReadLength);
+        TEMPORARY_RETURN_IGNORED MakeZclCharString(zclUniqueIdSpan, dev->GetUniqueId());
+    },
+    [](Device * dev, uint8_t * buffer, uint16_t) { CopyValue<uint32_t>(buffer, dev->GetConfigurationVersion()); },
+    [](Device *, uint8_t * buffer, uint16_t) { CopyValue<uint32_t>(buffer, ZCL_BRIDGED_DEVICE_BASIC_INFORMATION_FEATURE_MAP); },
+    [](Device *, uint8_t * buffer, uint16_t) {
+        CopyValue<uint16_t>(buffer, ZCL_BRIDGED_DEVICE_BASIC_INFORMATION_CLUSTER_REVISION);
+    },
+};
+static_assert(MATTER_ARRAY_SIZE(kBridgedDeviceBasicReaders) == MATTER_ARRAY_SIZE(bridgedDeviceBasicAttrs));
+
+const AttributeReader kTempMeasurementReaders[] = {
+    [](Device * dev, uint8_t * buffer, uint16_t) {
+        CopyValue<int16_t>(buffer, static_cast<DeviceTempSensor *>(dev)->GetMeasuredValue());
+    },
+    [](Device * dev, uint8_t * buffer, uint16_t) { CopyValue<int16_t>(buffer, static_cast<DeviceTempSensor *>(dev)->mMin); },
+    [](Device * dev, uint8_t * buffer, uint16_t) { CopyValue<int16_t>(buffer, static_cast<DeviceTempSensor *>(dev)->mMax); },
+    [](Device *, uint8_t * buffer, uint16_t) { CopyValue<uint32_t>(buffer, ZCL_TEMPERATURE_SENSOR_FEATURE_MAP); },
+    [](Device *, uint8_t * buffer, uint16_t) { CopyValue<uint16_t>(buffer, ZCL_TEMPERATURE_SENSOR_CLUSTER_REVISION); },
+};
+static_assert(MATTER_ARRAY_SIZE(kTempMeasurementReaders) == MATTER_ARRAY_SIZE(tempSensorAttrs));
+
+struct ExternalAttributeTable
+{
+    ClusterId clusterId;
+    const EmberAfAttributeMetadata * attributes;
+    const AttributeReader * readers;
+    size_t count;
+};
+
+// Each of these clusters uses a single attribute list on all the bridged endpoints.
+const ExternalAttributeTable kExternalAttributeTables[] = {
+    { OnOff::Id, onOffAttrs, kOnOffReaders, MATTER_ARRAY_SIZE(kOnOffReaders) },
+    { BridgedDeviceBasicInformation::Id, bridgedDeviceBasicAttrs, kBridgedDeviceBasicReaders,
+      MATTER_ARRAY_SIZE(kBridgedDeviceBasicReaders) },
+    { TemperatureMeasurement::Id, tempSensorAttrs, kTempMeasurementReaders, MATTER_ARRAY_SIZE(kTempMeasurementReaders) },
+};
+
+} // anonymous namespace
+
 Protocols::InteractionModel::Status emberAfExternalAttributeReadCallback(EndpointId endpoint, ClusterId clusterId,
                                                                          const EmberAfAttributeMetadata * attributeMetadata,
                                                                          uint8_t * buffer, uint16_t maxReadLength)
 {
     uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(endpoint);
 
-    Protocols::InteractionModel::Status ret = Protocols::InteractionModel::Status::Failure;
-
-    if ((endpointIndex < CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT) && (gDevices[endpointIndex] != nullptr))
+    if ((endpointIndex >= CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT) || (gDevices[endpointIndex] == nullptr))
     {
-        Device * dev = gDevices[endpointIndex];
+        return Protocols::InteractionModel::Status::Failure;
+    }
 
-        if (clusterId == BridgedDeviceBasicInformation::Id)
-        {
-            ret = HandleReadBridgedDeviceBasicAttribute(dev, attributeMetadata->attributeId, buffer, maxReadLength);
-        }
-        else if (clusterId == OnOff::Id)
+    for (const auto & table : kExternalAttributeTables)
+    {
+        if (table.clusterId != clusterId)
         {
-            ret = HandleReadOnOffAttribute(static_cast<DeviceOnOff *>(dev), attributeMetadata->attributeId, buffer, maxReadLength);
+            continue;
         }
-        else if (clusterId == TemperatureMeasurement::Id)
+
+        size_t index = static_cast<size_t>(attributeMetadata - table.attributes);
+        if ((index >= table.count) || (maxReadLength != attributeMetadata->size))
         {
-            ret = HandleReadTempMeasurementAttribute(static_cast<DeviceTempSensor *>(dev), attributeMetadata->attributeId, buffer,
-                                                     maxReadLength);
+            break;
         }
+
+        table.readers[index](gDevices[endpointIndex], buffer, maxReadLength);
+        return Protocols::InteractionModel::Status::Success;
     }
 
-    return ret;
+    return Protocols::InteractionModel::Status::Failure;
 }
 
 class BridgedPowerSourceAttrAccess : public AttributeAccessInterface
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <transport.h>
 #include <vector>
@@ -51,4 +52,8 @@ public:
     virtual void DistributeVideo(const uint8_t * data, size_t size, uint16_t videoStreamID) = 0;
     virtual void DistributeAudio(const uint8_t * data, size_t size, uint16_t audioStreamID) = 0;
     virtual void SetPreRollLength(Transport * transport, uint16_t PreRollBufferLength)      = 0;
+    // Same as DistributeVideo and DistributeAudio for frames whose buffer can be shared with the transports, which
+    // avoids copying them.
+    virtual void DistributeVideoFrame(std::shared_ptr<MediaFrame> frame, uint16_t videoStreamID) = 0;
+    virtual void DistributeAudioFrame(std::shared_ptr<MediaFrame> frame, uint16_t audioStreamID) = 0;
 };
@@ -0,0 +1,65 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/Span.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+
+// Encoded media frame, shared by reference between the stream producers, the pre-roll buffer and the transports so
+// that a frame is not copied on its way out of the device.
+// The frame does not own its data: the release callback is called when the last reference is dropped, e.g. to unmap
+// the pipeline buffer holding the frame.
+class MediaFrame
+{
+public:
+    MediaFrame(const uint8_t * data, size_t size, std::function<void()> release) :
+        mData(data), mSize(size), mRelease(std::move(release))
+    {}
+    ~MediaFrame()
+    {
+        if (mRelease)
+        {
+            mRelease();
+        }
+    }
+
+    MediaFrame(const MediaFrame &)             = delete;
+    MediaFrame & operator=(const MediaFrame &) = delete;
+
+    // Creates a frame holding a copy of data, for producers whose buffers cannot outlive the call.
+    static std::shared_ptr<MediaFrame> Copy(const uint8_t * data, size_t size)
+    {
+        uint8_t * copy = new uint8_t[size];
+        memcpy(copy, data, size);
+        return std::make_shared<MediaFrame>(copy, size, [copy]() { delete[] copy; });
+    }
+
+    chip::ByteSpan Data() const { return chip::ByteSpan(mData, mSize); }
+    size_t Size() const { return mSize; }
+
+private:
+    const uint8_t * mData;
+    size_t mSize;
+    std::function<void()> mRelease;
+};
@@ -16,12 +16,14 @@
  *    limitations under the License.
  */
 
+#include "media-frame.h"
 #include <app-common/zap-generated/cluster-objects.h>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <lib/core/Optional.h>
 #include <lib/support/Span.h>
+#include <memory>
 #pragma once
 // Base class for media transports(WebRTC, PushAV)
 // Media Transports would implement this interface for the Media controller to
@@ -38,6 +40,19 @@ public:
     // Send audio data for a given stream ID
     virtual void SendAudio(const chip::ByteSpan & data, int64_t timestamp, uint16_t audioStreamID) = 0;
 
+    // Send a video frame shared with the media controller. Transports that keep the data past the call, e.g. to
+    // queue it for an uploader, override this to hold a reference to the frame instead of copying it.
+    virtual void SendVideoFrame(const std::shared_ptr<MediaFrame> & frame, int64_t timestamp, uint16_t videoStreamID)
+    {
+        SendVideo(frame->Data(), timestamp, videoStreamID);
+    }
+
+    // Send an audio frame shared with the media controller, see SendVideoFrame
+    virtual void SendAudioFrame(const std::shared_ptr<MediaFrame> & frame, int64_t timestamp, uint16_t audioStreamID)
+    {
+        SendAudio(frame->Data(), timestamp, audioStreamID);
+    }
+
     // Send synchronixed audio/video data for given audio and video stream IDs
     virtual void SendAudioVideo(const chip::ByteSpan & data, uint16_t videoStreamID, uint16_t audioStreamID) = 0;
 
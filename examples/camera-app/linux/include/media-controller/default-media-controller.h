@@ -41,6 +41,8 @@ public:
     // DistributeVideo and DistributeAudio are called when data is ready to be sent out
     void DistributeVideo(const uint8_t * data, size_t size, uint16_t videoStreamID) override;
     void DistributeAudio(const uint8_t * data, size_t size, uint16_t audioStreamID) override;
+    void DistributeVideoFrame(std::shared_ptr<MediaFrame> frame, uint16_t videoStreamID) override;
+    void DistributeAudioFrame(std::shared_ptr<MediaFrame> frame, uint16_t audioStreamID) override;
     // Sets the desired preroll buffer length in milliseconds for the given transport
     void SetPreRollLength(Transport * transport, uint16_t preRollBufferLength) override;
     void SetCameraDevice(Camera::CameraDevice * device);
@@ -17,6 +17,7 @@
  */
 #pragma once
 
+#include "media-frame.h"
 #include "pushav-uploader.h"
 #include <app/clusters/push-av-stream-transport-server/PushAVStreamTransportCluster.h>
 
@@ -152,6 +153,13 @@ public:
      */
     void PushPacket(const uint8_t * data, size_t size, bool isVideo);
 
+    /**
+     * @brief Enqueues a shared media frame for processing, without copying it
+     * @param frame Encoded frame, referenced until the packet is written out
+     * @param isVideo True for video data, false for audio
+     */
+    void PushPacket(std::shared_ptr<MediaFrame> frame, bool isVideo);
+
     void SetOnStopCallback(std::function<void()> cb) { mOnStopCallback = std::move(cb); }
 
     // Set the cluster server reference for direct API calls
@@ -234,7 +242,7 @@ private:
 
     bool IsH264IFrame(const uint8_t * data, unsigned int length);
 
-    AVPacket * CreatePacket(const uint8_t * data, int size, bool isVideo);
+    AVPacket * CreatePacket(std::shared_ptr<MediaFrame> frame, bool isVideo);
 
     /**
      * @brief Processes queued packets and writes them to the output file.
@@ -37,7 +37,7 @@ struct BufferSink
 struct PreRollFrame
 {
     std::string streamKey;                        // e.g., "a123" or "v456"
-    std::unique_ptr<uint8_t[]> data;              // raw frame data
+    std::shared_ptr<MediaFrame> media;            // encoded frame, shared with the transports
     size_t size;                                  // bytes size
     int64_t ptsMs;                                // receive time
     std::unordered_set<BufferSink *> deliveredTo; // to prevent duplicate sends
@@ -47,7 +47,7 @@ class PreRollBuffer
 {
 public:
     PreRollBuffer();
-    void PushFrameToBuffer(const std::string & streamKey, const uint8_t * data, size_t size);
+    void PushFrameToBuffer(const std::string & streamKey, std::shared_ptr<MediaFrame> media);
     void RegisterTransportToBuffer(BufferSink * sink, const std::unordered_set<std::string> & streamKeys);
     void DeregisterTransportFromBuffer(BufferSink * sink);
     void SetMaxTotalBytes(size_t size);
@@ -63,6 +63,10 @@ public:
     // Send audio data for a given stream ID
     void SendAudio(const chip::ByteSpan & data, int64_t timestamp, uint16_t audioStreamID) override;
 
+    // Queue video and audio frames for the recorder without copying them
+    void SendVideoFrame(const std::shared_ptr<MediaFrame> & frame, int64_t timestamp, uint16_t videoStreamID) override;
+    void SendAudioFrame(const std::shared_ptr<MediaFrame> & frame, int64_t timestamp, uint16_t audioStreamID) override;
+
     // Send synchronized audio/video data for given audio and video stream IDs
     void SendAudioVideo(const chip::ByteSpan & data, uint16_t videoStreamID, uint16_t audioStreamID) override;
 
@@ -64,6 +64,23 @@ struct AudioAppSinkContext
     uint16_t audioStreamID;
 };
 
+// Wraps the encoded data of a sample in a MediaFrame, which keeps the sample mapped until the pre-roll buffer and the
+// transports are done with it, instead of copying the frame.
+std::shared_ptr<MediaFrame> MapSampleToMediaFrame(GstSample * sample, GstBuffer * buffer)
+{
+    GstMapInfo map;
+    if (!gst_buffer_map(buffer, &map, GST_MAP_READ))
+    {
+        return nullptr;
+    }
+
+    gst_sample_ref(sample);
+    return std::make_shared<MediaFrame>(reinterpret_cast<const uint8_t *>(map.data), map.size, [sample, buffer, map]() mutable {
+        gst_buffer_unmap(buffer, &map);
+        gst_sample_unref(sample);
+    });
+}
+
 // Using Gstreamer video test source's ball animation pattern for the live streaming visual verification.
 // Refer https://gstreamer.freedesktop.org/documentation/videotestsrc/index.html?gi-language=c#GstVideoTestSrcPattern
 
@@ -87,8 +104,8 @@ GstFlowReturn OnNewVideoSampleFromAppSink(GstAppSink * appsink, gpointer user_da
         return GST_FLOW_ERROR;
     }
 
-    GstMapInfo map;
-    if (gst_buffer_map(buffer, &map, GST_MAP_READ))
+    std::shared_ptr<MediaFrame> frame = MapSampleToMediaFrame(sample, buffer);
+    if (frame)
     {
         // Check if SFrame encryption is enabled for this stream
         auto & mediaController = self->GetMediaController();
@@ -101,10 +118,10 @@ GstFlowReturn OnNewVideoSampleFromAppSink(GstAppSink * appsink, gpointer user_da
                             sframeConfig.cipherSuite, static_cast<unsigned int>(sframeConfig.baseKey.size()));
 
             // TODO: Implement SFrame encryption (occurs AFTER H.264 encoding, BEFORE RTP packetization)
-            // Current state: map.data contains H.264 encoded frames from GStreamer
+            // Current state: frame contains H.264 encoded frames from GStreamer
             //
             // SFrame encryption steps:
-            // 1. Take the H.264 compressed payload (map.data, map.size)
+            // 1. Take the H.264 compressed payload (frame->Data())
             // 2. Select encryption algorithm based on cipherSuite:
             //    - 0x0001: AES-128-GCM-SHA256 (16 byte key)
             //    - 0x0002: AES-256-GCM-SHA512 (32 byte key)
@@ -123,8 +140,7 @@ GstFlowReturn OnNewVideoSampleFromAppSink(GstAppSink * appsink, gpointer user_da
         // If SFrame is disabled, this is raw H.264 encoded frames
 
         // Forward H.264 RTP data to media controller with the correct videoStreamID
-        self->GetMediaController().DistributeVideo(reinterpret_cast<const uint8_t *>(map.data), map.size, videoStreamID);
-        gst_buffer_unmap(buffer, &map);
+        self->GetMediaController().DistributeVideoFrame(std::move(frame), videoStreamID);
     }
 
     gst_sample_unref(sample);
@@ -161,8 +177,8 @@ static GstFlowReturn OnNewAudioSampleFromAppSink(GstAppSink * appsink, gpointer
         return GST_FLOW_OK;
     }
 
-    GstMapInfo map;
-    if (gst_buffer_map(buffer, &map, GST_MAP_READ))
+    std::shared_ptr<MediaFrame> frame = MapSampleToMediaFrame(sample, buffer);
+    if (frame)
     {
         // Check if SFrame encryption is enabled for this stream
         auto & mediaController = self->GetMediaController();
@@ -175,10 +191,10 @@ static GstFlowReturn OnNewAudioSampleFromAppSink(GstAppSink * appsink, gpointer
                             sframeConfig.cipherSuite, static_cast<unsigned int>(sframeConfig.baseKey.size()));
 
             // TODO: Implement SFrame encryption (occurs AFTER Opus encoding, BEFORE RTP packetization)
-            // Current state: map.data contains Opus encoded frames from GStreamer
+            // Current state: frame contains Opus encoded frames from GStreamer
             //
             // SFrame encryption steps:
-            // 1. Take the Opus compressed payload (map.data, map.size)
+            // 1. Take the Opus compressed payload (frame->Data())
             // 2. Select encryption algorithm based on cipherSuite:
             //    - 0x0001: AES-128-GCM-SHA256 (16 byte key)
             //    - 0x0002: AES-256-GCM-SHA512 (32 byte key)
@@ -197,8 +213,7 @@ static GstFlowReturn OnNewAudioSampleFromAppSink(GstAppSink * appsink, gpointer
         // If SFrame is disabled, this is raw Opus encoded frames
 
         // Send raw Opus frames to the media controller
-        self->GetMediaController().DistributeAudio(reinterpret_cast<const uint8_t *>(map.data), map.size, audioStreamID);
-        gst_buffer_unmap(buffer, &map);
+        self->GetMediaController().DistributeAudioFrame(std::move(frame), audioStreamID);
     }
 
     gst_sample_unref(sample);
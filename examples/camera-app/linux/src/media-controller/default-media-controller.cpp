@@ -91,14 +91,24 @@ void DefaultMediaController::UnregisterTransport(Transport * transport)
 
 void DefaultMediaController::DistributeVideo(const uint8_t * data, size_t size, uint16_t videoStreamID)
 {
-    std::string streamKey = "v" + std::to_string(videoStreamID);
-    mPreRollBuffer.PushFrameToBuffer(streamKey, data, size);
+    DistributeVideoFrame(MediaFrame::Copy(data, size), videoStreamID);
 }
 
 void DefaultMediaController::DistributeAudio(const uint8_t * data, size_t size, uint16_t audioStreamID)
+{
+    DistributeAudioFrame(MediaFrame::Copy(data, size), audioStreamID);
+}
+
+void DefaultMediaController::DistributeVideoFrame(std::shared_ptr<MediaFrame> frame, uint16_t videoStreamID)
+{
+    std::string streamKey = "v" + std::to_string(videoStreamID);
+    mPreRollBuffer.PushFrameToBuffer(streamKey, std::move(frame));
+}
+
+void DefaultMediaController::DistributeAudioFrame(std::shared_ptr<MediaFrame> frame, uint16_t audioStreamID)
 {
     std::string streamKey = "a" + std::to_string(audioStreamID);
-    mPreRollBuffer.PushFrameToBuffer(streamKey, data, size);
+    mPreRollBuffer.PushFrameToBuffer(streamKey, std::move(frame));
 }
 
 void DefaultMediaController::SetPreRollLength(Transport * transport, uint16_t preRollBufferLength)
@@ -189,6 +189,12 @@ bool PushAVClipRecorder::EnsureDirectoryExists(const std::string & path)
 }
 
 namespace {
+// Releases the reference to the media frame held by the buffer of a packet
+void ReleaseMediaFrame(void * opaque, uint8_t * /* data */)
+{
+    delete static_cast<std::shared_ptr<MediaFrame> *>(opaque);
+}
+
 int ReadPacket(void * opaque, uint8_t * buf, int bufSize)
 {
     struct BufferData * bd = (struct BufferData *) opaque;
@@ -256,7 +262,7 @@ bool PushAVClipRecorder::IsH264IFrame(const uint8_t * data, unsigned int length)
     return ret;
 }
 
-AVPacket * PushAVClipRecorder::CreatePacket(const uint8_t * data, int size, bool isVideo)
+AVPacket * PushAVClipRecorder::CreatePacket(std::shared_ptr<MediaFrame> frame, bool isVideo)
 {
     AVPacket * packet = av_packet_alloc();
     if (!packet)
@@ -265,15 +271,23 @@ AVPacket * PushAVClipRecorder::CreatePacket(const uint8_t * data, int size, bool
         return nullptr;
     }
 
-    packet->data = static_cast<uint8_t *>(av_malloc(static_cast<size_t>(size)));
-    if (!packet->data)
+    // The packet buffer references the frame instead of copying it, so the muxer writes the data of the camera pipeline
+    // and releases the frame once the packet is freed.
+    const uint8_t * data = frame->Data().data();
+    int size             = static_cast<int>(frame->Size());
+    auto * reference     = new std::shared_ptr<MediaFrame>(std::move(frame));
+
+    packet->buf = av_buffer_create(const_cast<uint8_t *>(data), static_cast<size_t>(size), ReleaseMediaFrame, reference,
+                                   AV_BUFFER_FLAG_READONLY);
+    if (!packet->buf)
     {
-        ChipLogError(Camera, "ERROR: AVPacket data allocation failed!");
+        ChipLogError(Camera, "ERROR: AVPacket buffer allocation failed!");
+        delete reference;
         av_packet_free(&packet);
         return nullptr;
     }
 
-    memcpy(packet->data, data, static_cast<size_t>(size));
+    packet->data = packet->buf->data;
     packet->size = size;
 
     if (isVideo)
@@ -390,6 +404,11 @@ void PushAVClipRecorder::Stop()
 }
 
 void PushAVClipRecorder::PushPacket(const uint8_t * data, size_t size, bool isVideo)
+{
+    PushPacket(MediaFrame::Copy(data, size), isVideo);
+}
+
+void PushAVClipRecorder::PushPacket(std::shared_ptr<MediaFrame> frame, bool isVideo)
 {
     if (!GetRecorderStatus())
     {
@@ -397,7 +416,7 @@ void PushAVClipRecorder::PushPacket(const uint8_t * data, size_t size, bool isVi
         return;
     }
 
-    AVPacket * packet = CreatePacket(data, static_cast<int>(size), isVideo);
+    AVPacket * packet = CreatePacket(std::move(frame), isVideo);
     if (!packet)
     {
         ChipLogError(Camera, "ERROR: PACKET DROPPED!");
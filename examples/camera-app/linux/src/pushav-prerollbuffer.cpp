@@ -29,26 +29,27 @@ void PreRollBuffer::SetMaxTotalBytes(size_t size)
     mMaxTotalBytes = size;
     TrimBuffer();
 }
-void PreRollBuffer::PushFrameToBuffer(const std::string & streamKey, const uint8_t * data, size_t size)
+void PreRollBuffer::PushFrameToBuffer(const std::string & streamKey, std::shared_ptr<MediaFrame> media)
 {
     TrimBuffer();
-    std::lock_guard<std::mutex> lock(mBufferMutex);
-    auto frame       = std::make_shared<PreRollFrame>();
-    frame->streamKey = streamKey;
-    frame->data      = std::make_unique<uint8_t[]>(size);
-    memcpy(frame->data.get(), data, size);
-    frame->size  = size;
-    frame->ptsMs = NowMs();
-    auto & queue = mBuffers[streamKey]; // Get or create the queue for this stream key
-    queue.push_back(frame);
-    mContentBufferSize += size; // Track total bytes in buffer for all streams
-    mBufferMutex.unlock();
+    {
+        std::lock_guard<std::mutex> lock(mBufferMutex);
+        // The frame data is shared with the transports, not copied
+        auto frame       = std::make_shared<PreRollFrame>();
+        frame->streamKey = streamKey;
+        frame->size      = media->Size();
+        frame->media     = std::move(media);
+        frame->ptsMs     = NowMs();
+        auto & queue     = mBuffers[streamKey]; // Get or create the queue for this stream key
+        queue.push_back(std::move(frame));
+        mContentBufferSize += queue.back()->size; // Track total bytes in buffer for all streams
+    }
     PushBufferToTransport(); // Automatically flush after each frame push
 }
 
 void PreRollBuffer::PushBufferToTransport()
 {
-    std::lock_guard<std::mutex> lock(mBufferMutex);
+    std::unique_lock<std::mutex> lock(mBufferMutex);
     int64_t currentTime = NowMs();
     std::vector<BufferSink *> sinksToRemove;
 
@@ -88,14 +89,15 @@ void PreRollBuffer::PushBufferToTransport()
                 else
                 {
                     //  Frame is not older than the requested prebuffer length and hasn't been delivered to this sink yet
-                    chip::ByteSpan data(frame->data.get(), frame->size);
                     if (streamKey[0] == 'a' && sink->transport->CanSendAudio())
                     {
-                        sink->transport->SendAudio(data, frame->ptsMs, static_cast<uint16_t>(std::stoi(streamKey.substr(1))));
+                        sink->transport->SendAudioFrame(frame->media, frame->ptsMs,
+                                                        static_cast<uint16_t>(std::stoi(streamKey.substr(1))));
                     }
                     else if (streamKey[0] == 'v' && sink->transport->CanSendVideo())
                     {
-                        sink->transport->SendVideo(data, frame->ptsMs, static_cast<uint16_t>(std::stoi(streamKey.substr(1))));
+                        sink->transport->SendVideoFrame(frame->media, frame->ptsMs,
+                                                        static_cast<uint16_t>(std::stoi(streamKey.substr(1))));
                     }
                     else
                     {
@@ -107,7 +109,7 @@ void PreRollBuffer::PushBufferToTransport()
             }
         }
     }
-    mBufferMutex.unlock();
+    lock.unlock();
     // Remove sinks with no valid senders
     for (BufferSink * sink : sinksToRemove)
     {
@@ -589,6 +589,22 @@ void PushAVTransport::SendAudio(const chip::ByteSpan & data, int64_t timestamp,
     }
 }
 
+void PushAVTransport::SendVideoFrame(const std::shared_ptr<MediaFrame> & frame, int64_t timestamp, uint16_t videoStreamID)
+{
+    if (CanSendPacketsToRecorder())
+    {
+        mRecorder->PushPacket(frame, true);
+    }
+}
+
+void PushAVTransport::SendAudioFrame(const std::shared_ptr<MediaFrame> & frame, int64_t timestamp, uint16_t audioStreamID)
+{
+    if (CanSendPacketsToRecorder())
+    {
+        mRecorder->PushPacket(frame, false);
+    }
+}
+
 void PushAVTransport::SendAudioVideo(const chip::ByteSpan & data, uint16_t videoStreamID, uint16_t audioStreamID) {}
 
 // Utility API for Test purpose
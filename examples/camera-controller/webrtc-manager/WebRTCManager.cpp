@@ -25,6 +25,7 @@
 #include <lib/support/StringBuilder.h>
 
 #include <arpa/inet.h>
+#include <cinttypes>
 #include <cstdio>
 #include <netinet/in.h>
 #include <string>
@@ -139,7 +140,10 @@ CHIP_ERROR WebRTCManager::HandleOffer(const WebRTCSessionStruct & session, const
         chip::System::Clock::Milliseconds32(300),
         [](chip::System::Layer * systemLayer, void * appState) {
             auto * self = static_cast<WebRTCManager *>(appState);
-            TEMPORARY_RETURN_IGNORED self->ProvideAnswer(self->mPendingSessionId, self->mLocalDescription);
+            if (self->ProvideAnswer(self->mPendingSessionId, self->mLocalDescription) == CHIP_NO_ERROR)
+            {
+                self->StartICECandidatesTrickle(kICECandidatesCoalescingWindow);
+            }
         },
         this);
 
@@ -164,14 +168,8 @@ CHIP_ERROR WebRTCManager::HandleAnswer(const WebRTCSessionStruct & session, cons
     // Store sessionId for the delayed callback
     mPendingSessionId = session.id;
 
-    // Schedule the ProvideICECandidates() call to run with a small delay to ensure the response is sent first
-    TEMPORARY_RETURN_IGNORED DeviceLayer::SystemLayer().StartTimer(
-        chip::System::Clock::Milliseconds32(300),
-        [](chip::System::Layer * systemLayer, void * appState) {
-            auto * self = static_cast<WebRTCManager *>(appState);
-            TEMPORARY_RETURN_IGNORED self->ProvideICECandidates(self->mPendingSessionId);
-        },
-        this);
+    // Send the ICE candidates with a small delay to ensure the response is sent first
+    StartICECandidatesTrickle(chip::System::Clock::Milliseconds32(300));
 
     return CHIP_NO_ERROR;
 }
@@ -234,6 +232,10 @@ void WebRTCManager::Disconnect()
         mPeerConnection.reset();
     }
 
+    // Stop trickling ICE candidates
+    DeviceLayer::SystemLayer().CancelTimer(OnICECandidatesCoalescingTimer, this);
+    mTrickleICECandidates = false;
+
     // Close the RTP socket
     CloseRTPSocket();
 
@@ -245,6 +247,8 @@ void WebRTCManager::Disconnect()
     mCurrentVideoStreamId = 0;
     mPendingSessionId     = 0;
     mLocalDescription.clear();
+
+    std::lock_guard<std::mutex> lock(mLocalCandidatesMutex);
     mLocalCandidates.clear();
 }
 
@@ -269,6 +273,9 @@ CHIP_ERROR WebRTCManager::Connnect(Controller::DeviceCommissioner & commissioner
 
     rtc::InitLogger(rtc::LogLevel::Warning);
 
+    mSessionSetupStart       = System::SystemClock().GetMonotonicTimestamp();
+    mFirstVideoFrameReceived = false;
+
     // Create the peer connection
     rtc::Configuration config;
     config.iceServers.emplace_back("stun:stun.l.google.com:19302");
@@ -293,6 +300,7 @@ CHIP_ERROR WebRTCManager::Connnect(Controller::DeviceCommissioner & commissioner
             ChipLogProgress(Camera, "[From SDP] Candidate: %s, mid: %s", candidateInfo.candidate.c_str(),
                             candidateInfo.mid.c_str());
 
+            std::lock_guard<std::mutex> lock(mLocalCandidatesMutex);
             mLocalCandidates.push_back(candidateInfo);
         }
     });
@@ -309,7 +317,14 @@ CHIP_ERROR WebRTCManager::Connnect(Controller::DeviceCommissioner & commissioner
         ChipLogProgress(Camera, "%s", candidateInfo.candidate.c_str());
         ChipLogProgress(Camera, "  mid: %s, mlineIndex: %d", candidateInfo.mid.c_str(), candidateInfo.mlineIndex);
 
-        mLocalCandidates.push_back(candidateInfo);
+        {
+            std::lock_guard<std::mutex> lock(mLocalCandidatesMutex);
+            mLocalCandidates.push_back(candidateInfo);
+        }
+
+        // Candidates are sent from the Matter thread
+        TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().ScheduleWork(HandleLocalCandidateGathered,
+                                                                         reinterpret_cast<intptr_t>(this));
     });
 
     mPeerConnection->onStateChange([this](rtc::PeerConnection::State state) {
@@ -365,6 +380,12 @@ CHIP_ERROR WebRTCManager::Connnect(Controller::DeviceCommissioner & commissioner
 
     mTrack->onMessage(
         [this, addr](rtc::binary message) {
+            if (!mFirstVideoFrameReceived.exchange(true))
+            {
+                System::Clock::Timestamp elapsed = System::SystemClock().GetMonotonicTimestamp() - mSessionSetupStart;
+                ChipLogProgress(Camera, "Time to first video frame: %" PRIu64 " ms", static_cast<uint64_t>(elapsed.count()));
+            }
+
             // This is an RTP packet
             sendto(mRTPSocket, reinterpret_cast<const char *>(message.data()), size_t(message.size()), 0,
                    reinterpret_cast<const struct sockaddr *>(&addr), sizeof(addr));
@@ -477,44 +498,79 @@ CHIP_ERROR WebRTCManager::ProvideICECandidates(uint16_t sessionId)
 {
     ChipLogProgress(Camera, "Sending ProvideICECandidates command to the peer device");
 
-    if (mLocalCandidates.empty())
+    // Take the candidates gathered so far. New candidates may be added by the onLocalCandidate callback while we're
+    // sending, they are kept for the next batch.
+    std::vector<ICECandidateInfo> candidatesToSend;
+    {
+        std::lock_guard<std::mutex> lock(mLocalCandidatesMutex);
+        candidatesToSend.swap(mLocalCandidates);
+    }
+
+    if (candidatesToSend.empty())
     {
         ChipLogError(Camera, "No local ICE candidates to send");
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    // Make a copy of candidates to send to avoid race condition with onLocalCandidate callback
-    // which can asynchronously add new candidates while we're sending
-    std::vector<ICECandidateInfo> candidatesToSend = mLocalCandidates;
-    size_t candidateCount                          = candidatesToSend.size();
-
     CHIP_ERROR err = mWebRTCProviderClient.ProvideICECandidates(sessionId, candidatesToSend);
 
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Camera, "Failed to send ICE candidates: %" CHIP_ERROR_FORMAT, err.Format());
+
+        // Keep the candidates that were not sent ahead of the ones that arrived meanwhile
+        std::lock_guard<std::mutex> lock(mLocalCandidatesMutex);
+        mLocalCandidates.insert(mLocalCandidates.begin(), candidatesToSend.begin(), candidatesToSend.end());
     }
     else
     {
-        ChipLogProgress(Camera, "Sent %lu ICE candidate(s)", candidateCount);
-
-        // Remove only the candidates that were successfully sent
-        // New candidates may have arrived during transmission, so we remove from the front
-        if (mLocalCandidates.size() > candidateCount)
-        {
-            mLocalCandidates.erase(mLocalCandidates.begin(), mLocalCandidates.begin() + candidateCount);
-            if (!mLocalCandidates.empty())
-            {
-                ChipLogProgress(Camera, "%lu new candidate(s) arrived during transmission, keeping for next batch",
-                                mLocalCandidates.size());
-            }
-        }
-        else
-        {
-            ChipLogProgress(Camera, "Sent %lu ICE candidate(s), clearing list", mLocalCandidates.size());
-            mLocalCandidates.clear();
-        }
+        ChipLogProgress(Camera, "Sent %lu ICE candidate(s)", candidatesToSend.size());
     }
 
     return err;
 }
+
+void WebRTCManager::StartICECandidatesTrickle(System::Clock::Timeout delay)
+{
+    mTrickleICECandidates = true;
+
+    DeviceLayer::SystemLayer().CancelTimer(OnICECandidatesCoalescingTimer, this);
+    TEMPORARY_RETURN_IGNORED DeviceLayer::SystemLayer().StartTimer(delay, OnICECandidatesCoalescingTimer, this);
+}
+
+void WebRTCManager::HandleLocalCandidateGathered(intptr_t context)
+{
+    auto * self = reinterpret_cast<WebRTCManager *>(context);
+    VerifyOrReturn(self->mTrickleICECandidates);
+
+    // Candidates gathered within the coalescing window are sent together when the timer fires
+    if (!DeviceLayer::SystemLayer().IsTimerActive(OnICECandidatesCoalescingTimer, self))
+    {
+        TEMPORARY_RETURN_IGNORED DeviceLayer::SystemLayer().StartTimer(kICECandidatesCoalescingWindow,
+                                                                       OnICECandidatesCoalescingTimer, self);
+    }
+}
+
+void WebRTCManager::OnICECandidatesCoalescingTimer(System::Layer * systemLayer, void * appState)
+{
+    auto * self = static_cast<WebRTCManager *>(appState);
+    VerifyOrReturn(self->mTrickleICECandidates);
+
+    // Only one command is sent at a time, wait for the previous one to complete
+    if (!self->mWebRTCProviderClient.IsIdle())
+    {
+        TEMPORARY_RETURN_IGNORED systemLayer->StartTimer(kICECandidatesCoalescingWindow, OnICECandidatesCoalescingTimer, self);
+        return;
+    }
+
+    bool hasCandidates;
+    {
+        std::lock_guard<std::mutex> lock(self->mLocalCandidatesMutex);
+        hasCandidates = !self->mLocalCandidates.empty();
+    }
+
+    if (hasCandidates)
+    {
+        TEMPORARY_RETURN_IGNORED self->ProvideICECandidates(self->mPendingSessionId);
+    }
+}
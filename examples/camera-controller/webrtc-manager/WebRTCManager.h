@@ -20,7 +20,9 @@
 
 #include <app-common/zap-generated/cluster-objects.h>
 #include <data-model-providers/codegen/CodegenDataModelProvider.h>
+#include <atomic>
 #include <functional>
+#include <mutex>
 #include <platform/CHIPDeviceLayer.h>
 #include <rtc/rtc.hpp>
 #include <webrtc-manager/WebRTCProviderClient.h>
@@ -72,6 +74,9 @@ public:
                             chip::Optional<chip::app::DataModel::Nullable<uint16_t>> audioStreamId);
     CHIP_ERROR ProvideAnswer(uint16_t sessionId, const std::string & sdp);
 
+    /**
+     * @brief Send all the gathered local ICE candidates in a single ProvideICECandidates command.
+     */
     CHIP_ERROR ProvideICECandidates(uint16_t sessionId);
 
     /**
@@ -95,9 +100,22 @@ private:
     uint16_t mPendingSessionId = 0;
     std::string mLocalDescription;
 
-    // Local vector to store the ICE Candidate info coming from the WebRTC stack
+    // Local ICE candidates gathered after the offer/answer exchange are trickled to the peer. Candidates gathered
+    // within the coalescing window are sent in a single ProvideICECandidates command, instead of one command each.
+    static constexpr chip::System::Clock::Milliseconds32 kICECandidatesCoalescingWindow{ 50 };
+
+    // Local vector to store the ICE Candidate info coming from the WebRTC stack, which adds candidates from its own
+    // thread, protected by mLocalCandidatesMutex.
+    std::mutex mLocalCandidatesMutex;
     std::vector<ICECandidateInfo> mLocalCandidates;
 
+    // Whether the offer/answer exchange is done, so that new local candidates can be sent to the peer
+    bool mTrickleICECandidates = false;
+
+    // Time at which the session setup started, to measure the time to the first video frame
+    chip::System::Clock::Timestamp mSessionSetupStart;
+    std::atomic<bool> mFirstVideoFrameReceived{ false };
+
     std::shared_ptr<rtc::Track> mTrack;
     std::shared_ptr<rtc::Track> mAudioTrack;
 
@@ -113,4 +131,9 @@ private:
 
     // Close and reset the RTP socket
     void CloseRTPSocket();
+
+    // Start trickling the local ICE candidates, sending the ones gathered so far after delay
+    void StartICECandidatesTrickle(chip::System::Clock::Timeout delay);
+    static void HandleLocalCandidateGathered(intptr_t context);
+    static void OnICECandidatesCoalescingTimer(chip::System::Layer * systemLayer, void * appState);
 };
@@ -146,6 +146,11 @@ public:
      */
     void HandleAnswerReceived(uint16_t webRTCSessionId);
 
+    /**
+     * @brief Whether no command is being sent and no Offer or Answer is awaited, so that a new command can be sent.
+     */
+    bool IsIdle() const { return mState == State::Idle; }
+
     /////////// CommandSender Callback Interface /////////
     virtual void OnResponse(chip::app::CommandSender * client, const chip::app::ConcreteCommandPath & path,
                             const chip::app::StatusIB & status, chip::TLV::TLVReader * data) override;
@@ -0,0 +1,401 @@
+/*
+ *   Copyright (c) 2026 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "LoadGeneratorCommand.h"
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/InteractionModelEngine.h>
+#include <controller/InvokeInteraction.h>
+#include <controller/ReadInteraction.h>
+#include <controller/WriteInteraction.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+using namespace chip;
+using namespace chip::app::Clusters;
+
+namespace {
+
+constexpr System::Clock::Milliseconds32 kTickInterval(10);
+constexpr uint16_t kSubscriptionMaxIntervalCeilingSeconds = 60;
+
+const char * const kOperationNames[] = { "read", "write", "invoke", "subscribe" };
+
+Messaging::ReliableMessageMgr * GetReliableMessageMgr()
+{
+    auto * exchangeMgr = app::InteractionModelEngine::GetInstance()->GetExchangeManager();
+    return exchangeMgr == nullptr ? nullptr : exchangeMgr->GetReliableMessageMgr();
+}
+
+} // namespace
+
+CHIP_ERROR LoadGeneratorCommand::RunCommand()
+{
+    ReturnErrorOnFailure(ParseNodeIds());
+
+    mWeights[kRead]      = mReadWeight.ValueOr(70);
+    mWeights[kWrite]     = mWriteWeight.ValueOr(10);
+    mWeights[kInvoke]    = mInvokeWeight.ValueOr(20);
+    mWeights[kSubscribe] = mSubscribeWeight.ValueOr(0);
+    VerifyOrReturnError(mWeights[kRead] + mWeights[kWrite] + mWeights[kInvoke] + mWeights[kSubscribe] > 0,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (auto & stats : mStats)
+    {
+        stats = OperationStats();
+    }
+    for (auto & selection : mSelection)
+    {
+        selection = 0;
+    }
+    mResolvedNodeCount   = 0;
+    mNextNode            = 0;
+    mTotalIssued         = 0;
+    mSkipped             = 0;
+    mInFlight            = 0;
+    mRetransmissions     = 0;
+    mFailedTransmissions = 0;
+
+    // The sessions are set up first, so that their setup does not count in the latencies.
+    for (auto & node : mNodes)
+    {
+        ReturnErrorOnFailure(
+            CurrentCommissioner().GetConnectedDevice(node->nodeId, &node->onConnected, &node->onConnectionFailure));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LoadGeneratorCommand::ParseNodeIds()
+{
+    mNodes.clear();
+    VerifyOrReturnError(mNodeIdsArgument != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const char * cursor = mNodeIdsArgument;
+    while (*cursor != '\0')
+    {
+        char * end       = nullptr;
+        uint64_t nodeId  = strtoull(cursor, &end, 0);
+        bool validEnding = (*end == ',' || *end == '\0');
+        VerifyOrReturnError(end != cursor && validEnding && IsOperationalNodeId(nodeId), CHIP_ERROR_INVALID_ARGUMENT,
+                            ChipLogError(chipTool, "Invalid node id list: %s", mNodeIdsArgument));
+        mNodes.push_back(std::make_unique<Node>(this, nodeId));
+        cursor = (*end == ',') ? end + 1 : end;
+    }
+
+    VerifyOrReturnError(!mNodes.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
+}
+
+void LoadGeneratorCommand::OnDeviceConnectedFn(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                               const SessionHandle & sessionHandle)
+{
+    auto * node = static_cast<Node *>(context);
+    node->session.Grab(sessionHandle);
+    node->exchangeMgr = &exchangeMgr;
+    node->command->OnNodeResolved();
+}
+
+void LoadGeneratorCommand::OnDeviceConnectionFailureFn(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+{
+    auto * node = static_cast<Node *>(context);
+    ChipLogError(chipTool, "Unable to connect to node 0x" ChipLogFormatX64 ", leaving it out: %" CHIP_ERROR_FORMAT,
+                 ChipLogValueX64(peerId.GetNodeId()), error.Format());
+    node->command->OnNodeResolved();
+}
+
+void LoadGeneratorCommand::OnNodeResolved()
+{
+    VerifyOrReturn(++mResolvedNodeCount == mNodes.size());
+
+    mNodes.erase(std::remove_if(mNodes.begin(), mNodes.end(), [](const auto & node) { return !node->session; }), mNodes.end());
+    if (mNodes.empty())
+    {
+        SetCommandExitStatus(CHIP_ERROR_NOT_CONNECTED);
+        return;
+    }
+
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+    if (auto * rm = GetReliableMessageMgr())
+    {
+        rm->RegisterAnalyticsDelegate(this);
+    }
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+
+    ChipLogProgress(chipTool, "Generating %" PRIu32 " operations per second against %u nodes for %u seconds", mRate.ValueOr(10),
+                    static_cast<unsigned>(mNodes.size()), mDurationSecs.ValueOr(10));
+
+    mRunning      = true;
+    mStartTime    = System::SystemClock().GetMonotonicTimestamp();
+    mEndTime      = mStartTime + System::Clock::Seconds32(mDurationSecs.ValueOr(10));
+    mDrainEndTime = mEndTime + System::Clock::Seconds32(mTimeoutSecs.ValueOr(10));
+    OnTick();
+}
+
+void LoadGeneratorCommand::OnTick(System::Layer * layer, void * context)
+{
+    static_cast<LoadGeneratorCommand *>(context)->OnTick();
+}
+
+void LoadGeneratorCommand::OnTick()
+{
+    VerifyOrReturn(mRunning);
+
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    if (now >= mEndTime)
+    {
+        // Only the operations in flight are left to wait for.
+        if (mInFlight == 0 || now >= mDrainEndTime)
+        {
+            Finish();
+            return;
+        }
+    }
+    else
+    {
+        // Catch up with the target rate, whatever the actual tick interval was.
+        auto elapsedMs  = std::chrono::duration_cast<System::Clock::Milliseconds64>(now - mStartTime).count();
+        uint64_t target = static_cast<uint64_t>(elapsedMs) * mRate.ValueOr(10) / 1000;
+        while (mTotalIssued < target)
+        {
+            mTotalIssued++;
+            if (mInFlight >= mMaxInFlight.ValueOr(16))
+            {
+                mSkipped++;
+                continue;
+            }
+
+            Operation operation = NextOperation();
+            Node & node         = *mNodes[mNextNode];
+            mNextNode           = (mNextNode + 1) % mNodes.size();
+
+            mStats[operation].issued++;
+            CHIP_ERROR err = IssueOperation(operation, node);
+            if (err != CHIP_NO_ERROR)
+            {
+                mStats[operation].failed++;
+                continue;
+            }
+            mInFlight++;
+        }
+    }
+
+    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(kTickInterval, OnTick, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipTool, "Unable to schedule the load generator: %" CHIP_ERROR_FORMAT, err.Format());
+        Finish();
+    }
+}
+
+LoadGeneratorCommand::Operation LoadGeneratorCommand::NextOperation()
+{
+    // Smooth weighted round-robin: the mix is followed closely even over short runs, without randomness.
+    int64_t total = 0;
+    size_t chosen = 0;
+    for (size_t i = 0; i < kOperationCount; i++)
+    {
+        mSelection[i] += mWeights[i];
+        total += mWeights[i];
+        if (mSelection[i] > mSelection[chosen])
+        {
+            chosen = i;
+        }
+    }
+    mSelection[chosen] -= total;
+    return static_cast<Operation>(chosen);
+}
+
+CHIP_ERROR LoadGeneratorCommand::IssueOperation(Operation operation, Node & node)
+{
+    VerifyOrReturnError(node.session, CHIP_ERROR_NOT_CONNECTED);
+    const SessionHandle session = node.session.Get().Value();
+
+    System::Clock::Timestamp startTime = System::SystemClock().GetMonotonicTimestamp();
+    // Shared by the success and error callbacks, so that an operation is only counted once.
+    auto done   = std::make_shared<bool>(false);
+    auto finish = [this, operation, startTime, done](CHIP_ERROR error) {
+        VerifyOrReturn(!*done);
+        *done = true;
+        OnOperationDone(operation, startTime, error);
+    };
+
+    switch (operation)
+    {
+    case kRead: {
+        using TypeInfo = BasicInformation::Attributes::NodeLabel::TypeInfo;
+        return Controller::ReadAttribute<TypeInfo>(
+            node.exchangeMgr, session, kRootEndpointId,
+            [finish](const app::ConcreteDataAttributePath &, const TypeInfo::DecodableType &) { finish(CHIP_NO_ERROR); },
+            [finish](const app::ConcreteDataAttributePath *, CHIP_ERROR error) { finish(error); });
+    }
+    case kWrite: {
+        char label[16];
+        snprintf(label, sizeof(label), "load-%u", static_cast<unsigned>(mWriteCounter++));
+        return Controller::WriteAttribute<BasicInformation::Attributes::NodeLabel::TypeInfo>(
+            session, kRootEndpointId, CharSpan::fromCharString(label),
+            [finish](const app::ConcreteAttributePath &) { finish(CHIP_NO_ERROR); },
+            [finish](const app::ConcreteAttributePath *, CHIP_ERROR error) { finish(error); });
+    }
+    case kInvoke: {
+        using Request = GeneralDiagnostics::Commands::TimeSnapshot::Type;
+        return Controller::InvokeCommandRequest(
+            node.exchangeMgr, session, kRootEndpointId, Request(),
+            [finish](const app::ConcreteCommandPath &, const app::StatusIB &, const Request::ResponseType::DecodableType &) {
+                finish(CHIP_NO_ERROR);
+            },
+            [finish](CHIP_ERROR error) { finish(error); });
+    }
+    case kSubscribe: {
+        // Reports are not measured: only the time to establish the subscription is.
+        using TypeInfo = BasicInformation::Attributes::NodeLabel::TypeInfo;
+        return Controller::SubscribeAttribute<TypeInfo>(
+            node.exchangeMgr, session, kRootEndpointId,
+            [](const app::ConcreteDataAttributePath &, const TypeInfo::DecodableType &) {},
+            [finish](const app::ConcreteDataAttributePath *, CHIP_ERROR error) { finish(error); }, 0,
+            kSubscriptionMaxIntervalCeilingSeconds, [finish](const app::ReadClient &, SubscriptionId) { finish(CHIP_NO_ERROR); },
+            nullptr, /* fabricFiltered = */ true, /* keepPreviousSubscriptions = */ true);
+    }
+    default:
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+}
+
+void LoadGeneratorCommand::OnOperationDone(Operation operation, System::Clock::Timestamp startTime, CHIP_ERROR error)
+{
+    VerifyOrReturn(mInFlight > 0);
+    mInFlight--;
+
+    OperationStats & stats = mStats[operation];
+    if (error != CHIP_NO_ERROR)
+    {
+        stats.failed++;
+        return;
+    }
+
+    auto latency       = System::SystemClock().GetMonotonicTimestamp() - startTime;
+    uint32_t latencyMs = static_cast<uint32_t>(std::chrono::duration_cast<System::Clock::Milliseconds32>(latency).count());
+    size_t bucket      = 0;
+    while (bucket + 1 < kLatencyBucketCount && latencyMs >= (1u << bucket))
+    {
+        bucket++;
+    }
+
+    stats.succeeded++;
+    stats.latencyBuckets[bucket]++;
+    stats.totalLatencyMs += latencyMs;
+    stats.maxLatencyMs = std::max(stats.maxLatencyMs, latencyMs);
+}
+
+void LoadGeneratorCommand::OnTransmitEvent(const TransmitEvent & event)
+{
+    if (event.eventType == TransmitEvent::EventType::kRetransmission)
+    {
+        mRetransmissions++;
+    }
+    else if (event.eventType == TransmitEvent::EventType::kFailed)
+    {
+        mFailedTransmissions++;
+    }
+}
+
+void LoadGeneratorCommand::Finish()
+{
+    VerifyOrReturn(mRunning);
+    mRunning = false;
+
+    DeviceLayer::SystemLayer().CancelTimer(OnTick, this);
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+    if (auto * rm = GetReliableMessageMgr())
+    {
+        rm->RegisterAnalyticsDelegate(nullptr);
+    }
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+
+    LogReport();
+
+    for (auto & node : mNodes)
+    {
+        app::InteractionModelEngine::GetInstance()->ShutdownSubscriptions(CurrentCommissioner().GetFabricIndex(), node->nodeId);
+    }
+    SetCommandExitStatus(CHIP_NO_ERROR);
+}
+
+void LoadGeneratorCommand::LogReport()
+{
+    auto now         = System::SystemClock().GetMonotonicTimestamp();
+    uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<System::Clock::Milliseconds64>(now - mStartTime).count());
+    uint64_t completed = 0;
+    for (const auto & stats : mStats)
+    {
+        completed += stats.succeeded;
+    }
+
+    ChipLogProgress(chipTool, "Load generator: %" PRIu64 " operations completed in %" PRIu64 " ms (%" PRIu64 " per second)",
+                    completed, elapsed, elapsed > 0 ? completed * 1000 / elapsed : 0);
+    ChipLogProgress(chipTool, "  %" PRIu64 " skipped over the in-flight limit, %" PRIu32 " still in flight at the end", mSkipped,
+                    mInFlight);
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+    ChipLogProgress(chipTool, "  MRP: %" PRIu64 " retransmissions, %" PRIu64 " messages never acknowledged", mRetransmissions,
+                    mFailedTransmissions);
+#else
+    ChipLogProgress(chipTool, "  MRP retransmissions are not counted: build with CHIP_CONFIG_MRP_ANALYTICS_ENABLED");
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+
+    for (size_t operation = 0; operation < kOperationCount; operation++)
+    {
+        const OperationStats & stats = mStats[operation];
+        if (stats.issued == 0)
+        {
+            continue;
+        }
+
+        ChipLogProgress(chipTool,
+                        "  %s: %" PRIu64 " issued, %" PRIu64 " succeeded, %" PRIu64 " failed, "
+                        "avg %" PRIu64 " ms, max %" PRIu32 " ms",
+                        kOperationNames[operation], stats.issued, stats.succeeded, stats.failed,
+                        stats.succeeded > 0 ? stats.totalLatencyMs / stats.succeeded : 0, stats.maxLatencyMs);
+        for (size_t bucket = 0; bucket < kLatencyBucketCount; bucket++)
+        {
+            if (stats.latencyBuckets[bucket] > 0)
+            {
+                ChipLogProgress(chipTool, "    < %lu ms: %" PRIu64, static_cast<unsigned long>(1ul << bucket),
+                                stats.latencyBuckets[bucket]);
+            }
+        }
+    }
+}
+
+void LoadGeneratorCommand::Shutdown()
+{
+    if (mRunning)
+    {
+        mRunning = false;
+        DeviceLayer::SystemLayer().CancelTimer(OnTick, this);
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+        if (auto * rm = GetReliableMessageMgr())
+        {
+            rm->RegisterAnalyticsDelegate(nullptr);
+        }
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+    }
+    mNodes.clear();
+    CHIPCommand::Shutdown();
+}
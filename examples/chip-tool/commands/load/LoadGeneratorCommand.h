@@ -0,0 +1,154 @@
+/*
+ *   Copyright (c) 2026 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../common/CHIPCommand.h"
+#include <app/OperationalSessionSetup.h>
+#include <lib/core/CHIPCallback.h>
+#include <messaging/ReliableMessageAnalyticsDelegate.h>
+#include <transport/SessionHolder.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+/**
+ * Issues a mix of reads, writes, invokes and subscriptions at a target rate against one or more nodes, for capacity
+ * testing, and reports the throughput, a latency histogram per operation, the errors and the MRP retransmissions.
+ *
+ * The operations only touch the root endpoint: reads and subscriptions of the Basic Information NodeLabel attribute,
+ * writes of the same attribute, and invokes of the General Diagnostics TimeSnapshot command.
+ */
+class LoadGeneratorCommand : public CHIPCommand, public chip::Messaging::ReliableMessageAnalyticsDelegate
+{
+public:
+    LoadGeneratorCommand(CredentialIssuerCommands * credIssuerCommands) :
+        CHIPCommand("generate", credIssuerCommands, "Generate a load of interactions against one or more nodes.")
+    {
+        AddArgument("node-ids", &mNodeIdsArgument, "Comma-separated list of the node ids to load.");
+        AddArgument("duration", 1, UINT16_MAX, &mDurationSecs, "Time, in seconds, during which operations are issued. Default 10.");
+        AddArgument("rate", 1, UINT32_MAX, &mRate, "Number of operations issued per second over all the nodes. Default 10.");
+        AddArgument("max-in-flight", 1, UINT16_MAX, &mMaxInFlight,
+                    "Number of operations waiting for their response above which operations are skipped. Default 16.");
+        AddArgument("read-weight", 0, UINT8_MAX, &mReadWeight, "Relative share of reads in the mix. Default 70.");
+        AddArgument("write-weight", 0, UINT8_MAX, &mWriteWeight, "Relative share of writes in the mix. Default 10.");
+        AddArgument("invoke-weight", 0, UINT8_MAX, &mInvokeWeight, "Relative share of invokes in the mix. Default 20.");
+        AddArgument("subscribe-weight", 0, UINT8_MAX, &mSubscribeWeight,
+                    "Relative share of subscriptions in the mix. Subscriptions are kept until the end of the run. Default 0.");
+        AddArgument("timeout", 0, UINT16_MAX, &mTimeoutSecs,
+                    "Time, in seconds, given to the operations still in flight at the end of the run. Default 10.");
+    }
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override
+    {
+        // Session setup, the run itself and draining the operations in flight.
+        return chip::System::Clock::Seconds16(static_cast<uint16_t>(
+            std::min<uint32_t>(UINT16_MAX, 30u + mDurationSecs.ValueOr(10) + mTimeoutSecs.ValueOr(10))));
+    }
+    void Shutdown() override;
+
+    /////////// ReliableMessageAnalyticsDelegate Interface /////////
+    // Only registered when the stack is built with CHIP_CONFIG_MRP_ANALYTICS_ENABLED.
+    void OnTransmitEvent(const TransmitEvent & event) override;
+
+private:
+    enum Operation : uint8_t
+    {
+        kRead,
+        kWrite,
+        kInvoke,
+        kSubscribe,
+        kOperationCount,
+    };
+
+    // Latencies are counted in power-of-two buckets of milliseconds: bucket i holds [2^(i-1), 2^i) ms, bucket 0 is < 1 ms.
+    static constexpr size_t kLatencyBucketCount = 18;
+
+    struct OperationStats
+    {
+        uint64_t issued                              = 0;
+        uint64_t succeeded                           = 0;
+        uint64_t failed                              = 0;
+        uint64_t latencyBuckets[kLatencyBucketCount] = {};
+        uint64_t totalLatencyMs                      = 0;
+        uint32_t maxLatencyMs                        = 0;
+    };
+
+    struct Node
+    {
+        Node(LoadGeneratorCommand * command, chip::NodeId id) :
+            command(command), nodeId(id), onConnected(OnDeviceConnectedFn, this),
+            onConnectionFailure(OnDeviceConnectionFailureFn, this)
+        {}
+
+        LoadGeneratorCommand * command;
+        chip::NodeId nodeId;
+        chip::SessionHolder session;
+        chip::Messaging::ExchangeManager * exchangeMgr = nullptr;
+        chip::Callback::Callback<chip::OnDeviceConnected> onConnected;
+        chip::Callback::Callback<chip::OnDeviceConnectionFailure> onConnectionFailure;
+    };
+
+    static void OnDeviceConnectedFn(void * context, chip::Messaging::ExchangeManager & exchangeMgr,
+                                    const chip::SessionHandle & sessionHandle);
+    static void OnDeviceConnectionFailureFn(void * context, const chip::ScopedNodeId & peerId, CHIP_ERROR error);
+    static void OnTick(chip::System::Layer * layer, void * context);
+
+    CHIP_ERROR ParseNodeIds();
+    void OnNodeResolved();
+    void OnTick();
+    Operation NextOperation();
+    CHIP_ERROR IssueOperation(Operation operation, Node & node);
+    void OnOperationDone(Operation operation, chip::System::Clock::Timestamp startTime, CHIP_ERROR error);
+    void Finish();
+    void LogReport();
+
+    char * mNodeIdsArgument = nullptr;
+    chip::Optional<uint16_t> mDurationSecs;
+    chip::Optional<uint32_t> mRate;
+    chip::Optional<uint16_t> mMaxInFlight;
+    chip::Optional<uint8_t> mReadWeight;
+    chip::Optional<uint8_t> mWriteWeight;
+    chip::Optional<uint8_t> mInvokeWeight;
+    chip::Optional<uint8_t> mSubscribeWeight;
+    chip::Optional<uint16_t> mTimeoutSecs;
+
+    std::vector<std::unique_ptr<Node>> mNodes;
+    size_t mResolvedNodeCount = 0;
+    size_t mNextNode          = 0;
+
+    uint32_t mWeights[kOperationCount]  = {};
+    int64_t mSelection[kOperationCount] = {};
+
+    // Run state: operations are issued until mEndTime, then the ones in flight are given until mDrainEndTime.
+    bool mRunning = false;
+    chip::System::Clock::Timestamp mStartTime;
+    chip::System::Clock::Timestamp mEndTime;
+    chip::System::Clock::Timestamp mDrainEndTime;
+    uint64_t mTotalIssued  = 0;
+    uint64_t mSkipped      = 0;
+    uint32_t mInFlight     = 0;
+    uint16_t mWriteCounter = 0;
+    OperationStats mStats[kOperationCount];
+
+    uint64_t mRetransmissions     = 0;
+    uint64_t mFailedTransmissions = 0;
+};
@@ -26,6 +26,7 @@
 #include "commands/group/Commands.h"
 #include "commands/icd/ICDCommand.h"
 #include "commands/interactive/Commands.h"
+#include "commands/load/Commands.h"
 #include "commands/pairing/Commands.h"
 #include "commands/payload/Commands.h"
 #include "commands/session-management/Commands.h"
@@ -45,6 +46,7 @@ int main(int argc, char * argv[])
     registerCommandsDiscover(commands, &credIssuerCommands);
     registerCommandsICD(commands, &credIssuerCommands);
     registerCommandsInteractive(commands, &credIssuerCommands);
+    registerCommandsLoad(commands, &credIssuerCommands);
     registerCommandsPayload(commands);
     registerCommandsPairing(commands, &credIssuerCommands);
     registerCommandsGroup(commands, &credIssuerCommands);
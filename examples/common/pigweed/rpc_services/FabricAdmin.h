@@ -49,6 +49,11 @@ public:
     {
         return pw::Status::Unimplemented();
     }
+
+    virtual pw::Status GetLatencyMetrics(const pw_protobuf_Empty & request, chip_rpc_LatencyMetrics & response)
+    {
+        return pw::Status::Unimplemented();
+    }
 };
 
 } // namespace rpc
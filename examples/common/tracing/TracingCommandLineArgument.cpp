@@ -74,6 +74,15 @@ void TracingSetup::EnableTracingFor(const char * cliArg)
             }
             chip::Tracing::Register(mJsonBackend);
         }
+        else if (StartsWith(value, "binary:"))
+        {
+            if (!mBinaryBackend)
+            {
+                mBinaryBackend = std::make_unique<chip::Tracing::Binary::BinaryBackend>();
+            }
+            mBinaryTracePath.assign(value.data() + 7, value.size() - 7);
+            chip::Tracing::Register(*mBinaryBackend);
+        }
 #if ENABLE_PERFETTO_TRACING
         else if (value.data_equal(CharSpan::fromCharString("perfetto")))
         {
@@ -113,6 +122,24 @@ void TracingSetup::StopTracing()
 #endif
 
     chip::Tracing::Unregister(mJsonBackend);
+
+    if (mBinaryBackend)
+    {
+        chip::Tracing::Unregister(*mBinaryBackend);
+        DumpBinaryTrace();
+        mBinaryBackend.reset();
+    }
+}
+
+void TracingSetup::DumpBinaryTrace()
+{
+    VerifyOrReturn(mBinaryBackend);
+
+    CHIP_ERROR err = mBinaryBackend->Dump(mBinaryTracePath.c_str());
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Failed to write binary trace output: %" CHIP_ERROR_FORMAT, err.Format());
+    }
 }
 
 } // namespace CommandLineApp
@@ -19,8 +19,12 @@
 
 #include "tracing/enabled_features.h"
 
+#include <tracing/binary/binary_tracing.h>
 #include <tracing/json/json_tracing.h>
 
+#include <memory>
+#include <string>
+
 #if ENABLE_PERFETTO_TRACING
 #include <tracing/perfetto/file_output.h>      // nogncheck
 #include <tracing/perfetto/perfetto_tracing.h> // nogncheck
@@ -29,9 +33,9 @@
 /// A string with supported command line tracing targets
 /// to be pretty-printed in help strings if needed
 #if ENABLE_PERFETTO_TRACING
-#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, perfetto, perfetto:<path>"
+#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, binary:<path>, perfetto, perfetto:<path>"
 #else
-#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>"
+#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, binary:<path>"
 #endif
 
 namespace chip {
@@ -56,9 +60,16 @@ public:
     /// to unregister tracing backends
     void StopTracing();
 
+    /// Write out the events recorded so far for a "binary:<path>" target.
+    /// Also done by StopTracing.
+    void DumpBinaryTrace();
+
 private:
     ::chip::Tracing::Json::JsonBackend mJsonBackend;
 
+    std::unique_ptr<::chip::Tracing::Binary::BinaryBackend> mBinaryBackend;
+    std::string mBinaryTracePath;
+
 #if ENABLE_PERFETTO_TRACING
     chip::Tracing::Perfetto::FileTraceOutput mPerfettoFileOutput;
     chip::Tracing::Perfetto::PerfettoBackend mPerfettoBackend;
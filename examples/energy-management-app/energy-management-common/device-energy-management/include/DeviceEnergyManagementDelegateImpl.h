@@ -227,6 +227,17 @@ public:
     // DEMManufacturerDelegate::HandleModifyForecastRequest cannot be interrupted by any other CHIP task activity.
     CHIP_ERROR SetForecast(const DataModel::Nullable<Structs::ForecastStruct::Type> &);
 
+    // Slot-level updates of the current forecast, for the regular progress of the appliance through its forecast. Unlike
+    // SetForecast() they keep the rest of the forecast (and its ForecastID) as is, and only report the Forecast attribute
+    // when something actually changed. The Forecast attribute is a single struct, so it is still reported as a whole.
+
+    // Moves the forecast to another slot (or to none when null). The slot number must index the current slots.
+    CHIP_ERROR SetForecastActiveSlotNumber(DataModel::Nullable<uint16_t> activeSlotNumber);
+
+    // To be called after the owner of the slots memory modified slotCount slots in place, starting at firstSlotIndex,
+    // e.g. to update their ElapsedSlotTime and RemainingSlotTime.
+    CHIP_ERROR ForecastSlotsUpdated(uint16_t firstSlotIndex, uint16_t slotCount);
+
     CHIP_ERROR SetOptOutState(OptOutStateEnum);
 
     // Returns whether the DeviceEnergyManagement is supported
@@ -227,11 +227,8 @@ void SetTestEventTrigger_Pausable()
 
 void SetTestEventTrigger_PausableNextSlot()
 {
-    // Get the current forecast ad update the active slot number
-    sForecastStruct = GetDEMDelegate()->GetForecast().Value();
-    sForecastStruct.activeSlotNumber.SetNonNull(1);
-
-    TEMPORARY_RETURN_IGNORED GetDEMDelegate()->SetForecast(DataModel::MakeNullable(sForecastStruct));
+    // Move the current forecast to the next slot
+    TEMPORARY_RETURN_IGNORED GetDEMDelegate()->SetForecastActiveSlotNumber(DataModel::MakeNullable(static_cast<uint16_t>(1)));
 }
 
 void SetTestEventTrigger_Forecast()
@@ -270,10 +267,11 @@ void SetTestEventTrigger_ForecastAdjustment()
 
 void SetTestEventTrigger_ForecastAdjustmentNextSlot()
 {
-    sForecastStruct = GetDEMDelegate()->GetForecast().Value();
-    sForecastStruct.activeSlotNumber.SetNonNull(sForecastStruct.activeSlotNumber.Value() + 1);
+    const auto & forecast = GetDEMDelegate()->GetForecast();
+    VerifyOrReturn(!forecast.IsNull() && !forecast.Value().activeSlotNumber.IsNull());
 
-    TEMPORARY_RETURN_IGNORED GetDEMDelegate()->SetForecast(DataModel::MakeNullable(sForecastStruct));
+    uint16_t nextSlot = static_cast<uint16_t>(forecast.Value().activeSlotNumber.Value() + 1);
+    TEMPORARY_RETURN_IGNORED GetDEMDelegate()->SetForecastActiveSlotNumber(DataModel::MakeNullable(nextSlot));
 }
 
 void SetTestEventTrigger_ConstraintBasedAdjustment()
@@ -952,6 +952,52 @@ CHIP_ERROR DeviceEnergyManagementDelegate::SetForecast(const DataModel::Nullable
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR DeviceEnergyManagementDelegate::SetForecastActiveSlotNumber(DataModel::Nullable<uint16_t> activeSlotNumber)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(!mForecast.IsNull(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(activeSlotNumber.IsNull() || activeSlotNumber.Value() < mForecast.Value().slots.size(),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mForecast.Value().activeSlotNumber == activeSlotNumber)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    mForecast.Value().activeSlotNumber = activeSlotNumber;
+    if (activeSlotNumber.IsNull())
+    {
+        ChipLogDetail(AppServer, "Forecast activeSlotNumber updated to Null");
+    }
+    else
+    {
+        ChipLogDetail(AppServer, "Forecast activeSlotNumber updated to %u", static_cast<unsigned>(activeSlotNumber.Value()));
+    }
+
+    MatterReportingAttributeChangeCallback(mEndpointId, DeviceEnergyManagement::Id, Forecast::Id);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DeviceEnergyManagementDelegate::ForecastSlotsUpdated(uint16_t firstSlotIndex, uint16_t slotCount)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(!mForecast.IsNull(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(static_cast<size_t>(firstSlotIndex) + slotCount <= mForecast.Value().slots.size(),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (slotCount == 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    MatterReportingAttributeChangeCallback(mEndpointId, DeviceEnergyManagement::Id, Forecast::Id);
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR DeviceEnergyManagementDelegate::SetOptOutState(OptOutStateEnum newValue)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -29,8 +29,11 @@
 #include <commands/fabric-sync/FabricSyncCommand.h>
 #include <commands/interactive/InteractiveCommands.h>
 #include <device_manager/DeviceManager.h>
+#include <lib/support/CHIPMemString.h>
 #include <setup_payload/QRCodeSetupPayloadGenerator.h>
 #include <system/SystemClock.h>
+#include <tracing/histogram/histogram_tracing.h>
+#include <tracing/registry.h>
 
 #if defined(PW_RPC_FABRIC_ADMIN_SERVICE) && PW_RPC_FABRIC_ADMIN_SERVICE
 #include "pigweed/rpc_services/FabricAdmin.h"
@@ -210,6 +213,27 @@ public:
         return pw::OkStatus();
     }
 
+    pw::Status GetLatencyMetrics(const pw_protobuf_Empty & request, chip_rpc_LatencyMetrics & response) override
+    {
+        constexpr size_t kMaxMetrics = MATTER_ARRAY_SIZE(response.metrics);
+
+        response.metrics_count = 0;
+        mLatencyMetrics.ForEachMetric([&response](const Tracing::Histogram::HistogramBackend::Metric & metric) {
+            VerifyOrReturn(response.metrics_count < kMaxMetrics);
+            chip_rpc_LatencyMetric & out = response.metrics[response.metrics_count++];
+            Platform::CopyString(out.key, metric.key);
+            out.count  = metric.latencyUs.Count() + metric.errors;
+            out.errors = metric.errors;
+            out.p50_us = metric.latencyUs.ValueAtPercentile(50);
+            out.p99_us = metric.latencyUs.ValueAtPercentile(99);
+            out.max_us = metric.latencyUs.Max();
+        });
+        return pw::OkStatus();
+    }
+
+    // Must be called with the Matter stack lock held.
+    void RegisterLatencyMetrics() { Tracing::Register(mLatencyMetrics); }
+
     void ScheduleSendingKeepActiveOnCheckIn(ScopedNodeId scopedNodeId, uint32_t stayActiveDurationMs, uint32_t timeoutMs)
     {
         // Accessing mPendingCheckIn should only be done while holding ChipStackLock
@@ -260,6 +284,9 @@ private:
 
     NodeId mNodeId = chip::kUndefinedNodeId;
 
+    // Aggregates the IM and CASE latency metrics reported by GetLatencyMetrics.
+    Tracing::Histogram::HistogramBackend mLatencyMetrics;
+
     // Modifications to mPendingCheckIn should be done on the MatterEventLoop thread
     // otherwise we would need a mutex protecting this data to prevent race as this
     // data is accessible by both RPC thread and Matter eventloop.
@@ -277,6 +304,13 @@ void RegisterServices(pw::rpc::Server & server)
 #endif
 }
 
+void RegisterLatencyMetricsWork(intptr_t)
+{
+#if defined(PW_RPC_FABRIC_ADMIN_SERVICE) && PW_RPC_FABRIC_ADMIN_SERVICE
+    fabric_admin_service.RegisterLatencyMetrics();
+#endif
+}
+
 } // namespace
 
 void RunRpcService()
@@ -289,6 +323,7 @@ void RunRpcService()
 void InitRpcServer(uint16_t rpcServerPort)
 {
     pw::rpc::system_server::set_socket_port(rpcServerPort);
+    TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().ScheduleWork(RegisterLatencyMetricsWork);
     std::thread rpc_service(RunRpcService);
     rpc_service.detach();
 }
@@ -23,6 +23,7 @@
 #include <app-common/zap-generated/ids/Clusters.h>
 #include <app/InteractionModelEngine.h>
 #include <app/server/Server.h>
+#include <crypto/RandUtils.h>
 
 using namespace ::chip;
 using namespace ::chip::app;
@@ -35,6 +36,9 @@ namespace {
 constexpr uint16_t kSubscribeMinInterval = 0;
 constexpr uint16_t kSubscribeMaxInterval = 10;
 
+// Upper bound of the random delay added to each resubscription attempt.
+constexpr uint32_t kResubscribeJitterMs = 5000;
+
 void OnDeviceConnectedWrapper(void * context, Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle)
 {
     reinterpret_cast<DeviceSubscription *>(context)->OnDeviceConnected(exchangeMgr, sessionHandle);
@@ -131,18 +135,67 @@ void DeviceSubscription::OnError(CHIP_ERROR error)
 {
     if (error == CHIP_ERROR_TIMEOUT && mState == State::SubscriptionStarted)
     {
-        if (bridge::FabricBridge::Instance().DeviceReachableChanged(mCurrentAdministratorCommissioningAttributes.id, false) !=
-            CHIP_NO_ERROR)
-        {
-            ChipLogError(NotSpecified, "Failed to update the device reachability state");
-        }
+        SetReachable(false);
     }
 
     ChipLogProgress(NotSpecified, "Error subscribing: %" CHIP_ERROR_FORMAT, error.Format());
 }
 
+void DeviceSubscription::OnSubscriptionEstablished(SubscriptionId aSubscriptionId)
+{
+    SetReachable(true);
+}
+
+CHIP_ERROR DeviceSubscription::OnResubscriptionNeeded(ReadClient * apReadClient, CHIP_ERROR aTerminationCause)
+{
+    if (aTerminationCause == CHIP_ERROR_TIMEOUT)
+    {
+        SetReachable(false);
+    }
+
+    // Spread out the resubscriptions of devices lost at the same time, e.g. on a network outage, as
+    // the back-off starts with an immediate retry.
+    uint32_t timeTillNextResubscription =
+        apReadClient->ComputeTimeTillNextSubscription() + Crypto::GetRandU32() % kResubscribeJitterMs;
+    ChipLogProgress(NotSpecified, "Resubscribing to " ChipLogFormatX64 " in %" PRIu32 "ms",
+                    ChipLogValueX64(mScopedNodeId.GetNodeId()), timeTillNextResubscription);
+    return apReadClient->ScheduleResubscription(timeTillNextResubscription, NullOptional, aTerminationCause == CHIP_ERROR_TIMEOUT);
+}
+
+void DeviceSubscription::OnDeallocatePaths(ReadPrepareParams && aReadPrepareParams)
+{
+    delete[] aReadPrepareParams.mpAttributePathParamsList;
+    aReadPrepareParams.mpAttributePathParamsList    = nullptr;
+    aReadPrepareParams.mAttributePathParamsListSize = 0;
+}
+
+void DeviceSubscription::SetReachable(bool reachable)
+{
+    VerifyOrReturn(mReachable != reachable);
+    mReachable = reachable;
+
+    if (bridge::FabricBridge::Instance().DeviceReachableChanged(mCurrentAdministratorCommissioningAttributes.id, reachable) !=
+        CHIP_NO_ERROR)
+    {
+        ChipLogError(NotSpecified, "Failed to update the device reachability state");
+    }
+}
+
+void DeviceSubscription::SetupDone()
+{
+    if (mOnSetupDoneCallback)
+    {
+        // Only called once per subscription, resubscriptions set up their own sessions.
+        OnDoneCallback onSetupDoneCallback = std::move(mOnSetupDoneCallback);
+        mOnSetupDoneCallback               = nullptr;
+        onSetupDoneCallback(mScopedNodeId);
+    }
+}
+
 void DeviceSubscription::OnDeviceConnected(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle)
 {
+    SetupDone();
+
     if (mState == State::Stopping)
     {
         // After calling mOnDoneCallback we are indicating that `this` is deleted and we shouldn't do anything else with
@@ -156,8 +209,9 @@ void DeviceSubscription::OnDeviceConnected(Messaging::ExchangeManager & exchange
                                            *this /* callback */, ReadClient::InteractionType::Subscribe);
     VerifyOrDie(mClient);
 
-    AttributePathParams readPaths[1];
-    readPaths[0] = AttributePathParams(kRootEndpointId, Clusters::AdministratorCommissioning::Id);
+    // The paths are owned by the ReadClient for resubscriptions and freed in OnDeallocatePaths.
+    auto * readPaths = new AttributePathParams[1];
+    readPaths[0]     = AttributePathParams(kRootEndpointId, Clusters::AdministratorCommissioning::Id);
 
     ReadPrepareParams readParams(sessionHandle);
 
@@ -167,7 +221,7 @@ void DeviceSubscription::OnDeviceConnected(Messaging::ExchangeManager & exchange
     readParams.mMaxIntervalCeilingSeconds   = kSubscribeMaxInterval;
     readParams.mKeepSubscriptions           = true;
 
-    CHIP_ERROR err = mClient->SendRequest(readParams);
+    CHIP_ERROR err = mClient->SendAutoResubscribeRequest(std::move(readParams));
 
     if (err != CHIP_NO_ERROR)
     {
@@ -214,13 +268,11 @@ void DeviceSubscription::OnDeviceConnectionFailure(const ScopedNodeId & peerId,
     VerifyOrDie(mState == State::Connecting || mState == State::Stopping);
     ChipLogError(NotSpecified, "DeviceSubscription failed to connect to " ChipLogFormatX64, ChipLogValueX64(peerId.GetNodeId()));
 
+    SetupDone();
+
     if (mState == State::Connecting)
     {
-        if (bridge::FabricBridge::Instance().DeviceReachableChanged(mCurrentAdministratorCommissioningAttributes.id, false) !=
-            CHIP_NO_ERROR)
-        {
-            ChipLogError(NotSpecified, "Failed to update the device reachability state");
-        }
+        SetReachable(false);
     }
 
     // After calling mOnDoneCallback we are indicating that `this` is deleted and we shouldn't do anything else with
@@ -229,8 +281,8 @@ void DeviceSubscription::OnDeviceConnectionFailure(const ScopedNodeId & peerId,
     mOnDoneCallback(mScopedNodeId);
 }
 
-CHIP_ERROR DeviceSubscription::StartSubscription(OnDoneCallback onDoneCallback, Controller::DeviceController & controller,
-                                                 ScopedNodeId scopedNodeId)
+CHIP_ERROR DeviceSubscription::StartSubscription(OnDoneCallback onDoneCallback, OnDoneCallback onSetupDoneCallback,
+                                                 Controller::DeviceController & controller, ScopedNodeId scopedNodeId)
 {
     assertChipStackLockedByCurrentThread();
     VerifyOrDie(mState == State::Idle);
@@ -243,7 +295,8 @@ CHIP_ERROR DeviceSubscription::StartSubscription(OnDoneCallback onDoneCallback,
     mCurrentAdministratorCommissioningAttributes.windowStatus =
         Clusters::AdministratorCommissioning::CommissioningWindowStatusEnum::kWindowNotOpen;
 
-    mOnDoneCallback = onDoneCallback;
+    mOnDoneCallback      = onDoneCallback;
+    mOnSetupDoneCallback = onSetupDoneCallback;
     MoveToState(State::Connecting);
     CHIP_ERROR err =
         controller.GetConnectedDevice(scopedNodeId.GetNodeId(), &mOnDeviceConnectedCallback, &mOnDeviceConnectionFailureCallback);
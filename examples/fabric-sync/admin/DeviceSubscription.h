@@ -33,6 +33,10 @@ class DeviceSubscriptionManager;
 /// An instance of DeviceSubscription is intended to be used only once. Once a DeviceSubscription is
 /// terminated, either from an error or from subscriptions getting shut down, we expect the instance
 /// to be deleted. Any new subscription should instantiate another instance of DeviceSubscription.
+///
+/// Once established, the subscription is automatically re-established when it drops, with a random
+/// delay added to the ReadClient back-off so that devices lost at the same time do not all resubscribe
+/// at once.
 class DeviceSubscription : public chip::app::ReadClient::Callback
 {
 public:
@@ -40,8 +44,10 @@ public:
 
     DeviceSubscription();
 
-    CHIP_ERROR StartSubscription(OnDoneCallback onDoneCallback, chip::Controller::DeviceController & controller,
-                                 chip::ScopedNodeId nodeId);
+    /// onSetupDoneCallback is called once the CASE session setup for the subscription has completed,
+    /// successfully or not, before onDoneCallback if the subscription is terminated at that point.
+    CHIP_ERROR StartSubscription(OnDoneCallback onDoneCallback, OnDoneCallback onSetupDoneCallback,
+                                 chip::Controller::DeviceController & controller, chip::ScopedNodeId nodeId);
 
     /// This will trigger stopping the subscription. Once subscription is stopped the OnDoneCallback
     /// provided in StartSubscription will be called to indicate that subscription have been terminated.
@@ -57,6 +63,9 @@ public:
     void OnReportEnd() override;
     void OnError(CHIP_ERROR error) override;
     void OnDone(chip::app::ReadClient * apReadClient) override;
+    void OnSubscriptionEstablished(chip::SubscriptionId aSubscriptionId) override;
+    CHIP_ERROR OnResubscriptionNeeded(chip::app::ReadClient * apReadClient, CHIP_ERROR aTerminationCause) override;
+    void OnDeallocatePaths(chip::app::ReadPrepareParams && aReadPrepareParams) override;
 
     ///////////////////////////////////////////////////////////////
     // callbacks for CASE session establishment
@@ -76,10 +85,13 @@ private:
 
     void MoveToState(const State aTargetState);
     const char * GetStateStr() const;
+    void SetupDone();
+    void SetReachable(bool reachable);
 
     chip::ScopedNodeId mScopedNodeId;
 
     OnDoneCallback mOnDoneCallback;
+    OnDoneCallback mOnSetupDoneCallback;
     std::unique_ptr<chip::app::ReadClient> mClient;
 
     chip::Callback::Callback<chip::OnDeviceConnected> mOnDeviceConnectedCallback;
@@ -88,6 +100,7 @@ private:
     bridge::AdministratorCommissioningChanged mCurrentAdministratorCommissioningAttributes;
 
     bool mChangeDetected = false;
+    bool mReachable      = true;
     State mState         = State::Idle;
 };
 
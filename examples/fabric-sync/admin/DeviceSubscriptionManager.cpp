@@ -24,6 +24,8 @@
 #include <app/InteractionModelEngine.h>
 #include <app/server/Server.h>
 
+#include <algorithm>
+
 using namespace ::chip;
 using namespace ::chip::app;
 
@@ -43,11 +45,23 @@ CHIP_ERROR DeviceSubscriptionManager::StartSubscription(Controller::DeviceContro
 
     auto deviceSubscription = std::make_unique<DeviceSubscription>();
     VerifyOrReturnError(deviceSubscription, CHIP_ERROR_NO_MEMORY);
-    ReturnErrorOnFailure(deviceSubscription->StartSubscription(
-        [this](ScopedNodeId aNodeId) { this->DeviceSubscriptionTerminated(aNodeId); }, controller, scopedNodeId));
-
+    DeviceSubscription & subscription    = *deviceSubscription;
     mDeviceSubscriptionMap[scopedNodeId] = std::move(deviceSubscription);
-    return CHIP_NO_ERROR;
+
+    if (mSetupsInProgress >= kMaxConcurrentSetups)
+    {
+        ChipLogProgress(NotSpecified, "Deferring subscription to NodeId:" ChipLogFormatX64,
+                        ChipLogValueX64(scopedNodeId.GetNodeId()));
+        mPendingSetups.push_back({ &controller, scopedNodeId });
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR err = StartDeviceSubscription(subscription, controller, scopedNodeId);
+    if (err != CHIP_NO_ERROR)
+    {
+        mDeviceSubscriptionMap.erase(scopedNodeId);
+    }
+    return err;
 }
 
 CHIP_ERROR DeviceSubscriptionManager::RemoveSubscription(ScopedNodeId scopedNodeId)
@@ -55,6 +69,17 @@ CHIP_ERROR DeviceSubscriptionManager::RemoveSubscription(ScopedNodeId scopedNode
     assertChipStackLockedByCurrentThread();
     auto it = mDeviceSubscriptionMap.find(scopedNodeId);
     VerifyOrReturnError((it != mDeviceSubscriptionMap.end()), CHIP_ERROR_NOT_FOUND);
+
+    // A subscription that has not been started yet can be dropped right away.
+    auto pending = std::find_if(mPendingSetups.begin(), mPendingSetups.end(),
+                                [&](const PendingSetup & setup) { return setup.scopedNodeId == scopedNodeId; });
+    if (pending != mPendingSetups.end())
+    {
+        mPendingSetups.erase(pending);
+        mDeviceSubscriptionMap.erase(it);
+        return CHIP_NO_ERROR;
+    }
+
     // We cannot safely erase the DeviceSubscription from mDeviceSubscriptionMap.
     // After calling StopSubscription we expect DeviceSubscription to eventually
     // call the OnDoneCallback we provided in StartSubscription which will call
@@ -64,6 +89,49 @@ CHIP_ERROR DeviceSubscriptionManager::RemoveSubscription(ScopedNodeId scopedNode
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR DeviceSubscriptionManager::StartDeviceSubscription(DeviceSubscription & deviceSubscription,
+                                                              Controller::DeviceController & controller, ScopedNodeId scopedNodeId)
+{
+    mSetupsInProgress++;
+    CHIP_ERROR err = deviceSubscription.StartSubscription(
+        [this](ScopedNodeId aNodeId) { this->DeviceSubscriptionTerminated(aNodeId); },
+        [this](ScopedNodeId aNodeId) { this->DeviceSubscriptionSetupDone(aNodeId); }, controller, scopedNodeId);
+    if (err != CHIP_NO_ERROR)
+    {
+        mSetupsInProgress--;
+    }
+    return err;
+}
+
+void DeviceSubscriptionManager::DeviceSubscriptionSetupDone(ScopedNodeId scopedNodeId)
+{
+    assertChipStackLockedByCurrentThread();
+    VerifyOrDie(mSetupsInProgress > 0);
+    mSetupsInProgress--;
+    StartPendingSubscriptions();
+}
+
+void DeviceSubscriptionManager::StartPendingSubscriptions()
+{
+    while (mSetupsInProgress < kMaxConcurrentSetups && !mPendingSetups.empty())
+    {
+        PendingSetup setup = mPendingSetups.front();
+        mPendingSetups.pop_front();
+
+        auto it = mDeviceSubscriptionMap.find(setup.scopedNodeId);
+        VerifyOrDie(it != mDeviceSubscriptionMap.end());
+
+        CHIP_ERROR err = StartDeviceSubscription(*it->second, *setup.controller, setup.scopedNodeId);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(NotSpecified, "Failed start subscription to NodeId:" ChipLogFormatX64,
+                         ChipLogValueX64(setup.scopedNodeId.GetNodeId()));
+            mDeviceSubscriptionMap.erase(setup.scopedNodeId);
+            TEMPORARY_RETURN_IGNORED bridge::FabricBridge::Instance().DeviceReachableChanged(setup.scopedNodeId, false);
+        }
+    }
+}
+
 void DeviceSubscriptionManager::DeviceSubscriptionTerminated(ScopedNodeId scopedNodeId)
 {
     assertChipStackLockedByCurrentThread();
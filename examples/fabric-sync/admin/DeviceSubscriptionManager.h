@@ -23,10 +23,16 @@
 #include <controller/CHIPDeviceController.h>
 #include <lib/core/DataModelTypes.h>
 
+#include <deque>
 #include <memory>
 
 namespace admin {
 
+/// Keeps a subscription to each synchronized device.
+///
+/// At most kMaxConcurrentSetups subscriptions set up their CASE session at a time, the others wait
+/// for their turn, so that synchronizing hundreds of devices at once does not flood the network and
+/// the session tables.
 class DeviceSubscriptionManager
 {
 public:
@@ -39,6 +45,14 @@ public:
     CHIP_ERROR RemoveSubscription(chip::ScopedNodeId scopedNodeId);
 
 private:
+    static constexpr size_t kMaxConcurrentSetups = 8;
+
+    struct PendingSetup
+    {
+        chip::Controller::DeviceController * controller;
+        chip::ScopedNodeId scopedNodeId;
+    };
+
     struct ScopedNodeIdHasher
     {
         std::size_t operator()(const chip::ScopedNodeId & scopedNodeId) const
@@ -50,9 +64,15 @@ private:
         }
     };
 
+    CHIP_ERROR StartDeviceSubscription(DeviceSubscription & deviceSubscription, chip::Controller::DeviceController & controller,
+                                       chip::ScopedNodeId scopedNodeId);
+    void DeviceSubscriptionSetupDone(chip::ScopedNodeId scopedNodeId);
     void DeviceSubscriptionTerminated(chip::ScopedNodeId scopedNodeId);
+    void StartPendingSubscriptions();
 
     std::unordered_map<chip::ScopedNodeId, std::unique_ptr<DeviceSubscription>, ScopedNodeIdHasher> mDeviceSubscriptionMap;
+    std::deque<PendingSetup> mPendingSetups;
+    size_t mSetupsInProgress = 0;
 };
 
 } // namespace admin
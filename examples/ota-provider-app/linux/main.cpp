@@ -57,6 +57,7 @@ constexpr uint16_t kOptionUserConsentState          = 'u';
 constexpr uint16_t kOptionIgnoreQueryImage          = 'x';
 constexpr uint16_t kOptionIgnoreApplyUpdate         = 'y';
 constexpr uint16_t kOptionPollInterval              = 'P';
+constexpr uint16_t kOptionMaxTransfers              = 'T';
 
 OTAProviderExample gOtaProvider;
 chip::ota::DefaultOTAProviderUserConsent gUserConsentProvider;
@@ -75,6 +76,7 @@ static uint32_t gIgnoreQueryImageCount               = 0;
 static uint32_t gIgnoreApplyUpdateCount              = 0;
 static uint32_t gPollInterval                        = 0;
 static std::optional<uint16_t> gMaxBDXBlockSize      = std::nullopt;
+static size_t gMaxTransfers                          = BdxOtaSender::kMaxTransfers;
 
 // Parses the JSON filepath and extracts DeviceSoftwareVersionModel parameters
 static bool ParseJsonFileAndPopulateCandidates(const char * filepath,
@@ -248,6 +250,19 @@ bool HandleOptions(const char * aProgram, OptionSet * aOptions, int aIdentifier,
     case kOptionPollInterval:
         gPollInterval = static_cast<uint32_t>(strtoul(aValue, nullptr, 0));
         break;
+    case kOptionMaxTransfers: {
+        auto maxTransfers = strtoul(aValue, nullptr, 0);
+        if (maxTransfers == 0 || maxTransfers > BdxOtaSender::kMaxTransfers)
+        {
+            PrintArgError("%s: ERROR: Invalid maxTransfers parameter: %s\n", aProgram, aValue);
+            retval = false;
+        }
+        else
+        {
+            gMaxTransfers = static_cast<size_t>(maxTransfers);
+        }
+        break;
+    }
     case kOptionMaxBDXBlockSize: {
         auto blockSize = static_cast<uint16_t>(strtoul(aValue, nullptr, 0));
         if (blockSize == 0)
@@ -285,6 +300,7 @@ OptionDef cmdLineOptionsDef[] = {
     { "ignoreApplyUpdate", chip::ArgParser::kArgumentRequired, kOptionIgnoreApplyUpdate },
     { "pollInterval", chip::ArgParser::kArgumentRequired, kOptionPollInterval },
     { "maxBDXBlockSize", chip::ArgParser::kArgumentRequired, kOptionMaxBDXBlockSize },
+    { "maxTransfers", chip::ArgParser::kArgumentRequired, kOptionMaxTransfers },
     {},
 };
 
@@ -328,7 +344,9 @@ OptionSet cmdLineOptions = { HandleOptions, cmdLineOptionsDef, "PROGRAM OPTIONS"
                              "  -y, --ignoreApplyUpdate <ignore count>\n"
                              "        The number of times to ignore the ApplyUpdateRequest Command and not send a response.\n"
                              "  -P, --pollInterval <time in milliseconds>\n"
-                             "        Poll interval for the BDX transfer \n" };
+                             "        Poll interval for the BDX transfer \n"
+                             "  -T, --maxTransfers <count>\n"
+                             "        Maximum number of BDX transfers served at once (1 to 16, default is 16).\n" };
 
 OptionSet * allOptions[] = { &cmdLineOptions, nullptr };
 
@@ -386,6 +404,8 @@ void ApplicationInit()
         gOtaProvider.SetMaxBDXBlockSize(*gMaxBDXBlockSize);
     }
 
+    bdxOtaSender->SetMaxConcurrentTransfers(gMaxTransfers);
+
     ChipLogDetail(SoftwareUpdate, "Using ImageList file: %s", gOtaImageListFilepath ? gOtaImageListFilepath : "(none)");
 
     if (gOtaImageListFilepath != nullptr)
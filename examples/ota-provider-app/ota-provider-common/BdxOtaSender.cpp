@@ -23,45 +23,39 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
 #include <protocols/bdx/BdxTransferSession.h>
+#include <transport/Session.h>
 
-#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 
 using chip::bdx::StatusCode;
 using chip::bdx::TransferControlFlags;
 using chip::bdx::TransferSession;
 
-BdxOtaSender::BdxOtaSender()
+BdxOtaTransfer::BdxOtaTransfer()
 {
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
 }
 
-CHIP_ERROR BdxOtaSender::InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId)
+void BdxOtaTransfer::Initialize(const chip::ScopedNodeId & node)
 {
     if (mInitialized)
     {
         // Reset stale connection from the Same Node if exists
-        if ((mFabricIndex.HasValue() && mFabricIndex.Value() == fabricIndex) && (mNodeId.HasValue() && mNodeId.Value() == nodeId))
-        {
-            Reset();
-        }
-        // Prevent a new node connection since another is active
-        else if ((mFabricIndex.HasValue() && mFabricIndex.Value() != fabricIndex) ||
-                 (mNodeId.HasValue() && mNodeId.Value() != nodeId))
-        {
-            return CHIP_ERROR_BUSY;
-        }
-        else
-        {
-            return CHIP_ERROR_INTERNAL;
-        }
+        Reset();
     }
-    mFabricIndex.SetValue(fabricIndex);
-    mNodeId.SetValue(nodeId);
+    mNode        = node;
     mInitialized = true;
-    return CHIP_NO_ERROR;
+
+    // Images with a lot of padding or repeated data shrink on the wire if the requestor can decompress them.
+    mTransfer.EnableCompression(true);
 }
 
-void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & event)
+void BdxOtaTransfer::HandleTransferSessionOutput(TransferSession::OutputEvent & event)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
@@ -103,17 +97,6 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         break;
     }
     case TransferSession::OutputEventType::kInitReceived: {
-        // TransferSession will automatically reject a transfer if there are no
-        // common supported control modes. It will also default to the smaller
-        // block size.
-        TransferSession::TransferAcceptData acceptData;
-        acceptData.ControlMode  = TransferControlFlags::kReceiverDrive; // OTA must use receiver drive
-        acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
-        acceptData.StartOffset  = mTransfer.GetStartOffset();
-        acceptData.Length       = mTransfer.GetTransferLength();
-        VerifyOrReturn(mTransfer.AcceptTransfer(acceptData) == CHIP_NO_ERROR,
-                       ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format()));
-
         // Store the file designator used during block query
         uint16_t fdl       = 0;
         const uint8_t * fd = mTransfer.GetFileDesignator(fdl);
@@ -122,74 +105,32 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         memcpy(mFileDesignator, fd, fdl);
         mFileDesignator[fdl] = 0;
 
-        break;
-    }
-    case TransferSession::OutputEventType::kQueryReceived:
-    case TransferSession::OutputEventType::kQueryWithSkipReceived: {
-        TransferSession::BlockData blockData;
-        uint16_t blockSize   = mTransfer.GetTransferBlockSize();
-        uint16_t bytesToRead = blockSize;
-        uint64_t bytesToSkip = 0;
-
-        if (event.EventType == TransferSession::OutputEventType::kQueryWithSkipReceived)
-        {
-            bytesToSkip = event.bytesToSkip.BytesToSkip;
-        }
-        uint64_t seekOffset = mNumBytesSent + bytesToSkip;
-
-        // TODO: This should be a utility function in TransferSession
-        if ((mTransfer.GetTransferLength() > 0) && ((seekOffset + blockSize) > mTransfer.GetTransferLength()))
-        {
-            // cast should be safe because of condition above
-            bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - seekOffset);
-        }
-
-        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
-        if (blockBuf.IsNull())
-        {
-            // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
-            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kUnknown);
-            return;
-        }
-
-        std::ifstream otaFile(mFileDesignator, std::ifstream::in);
-        if (!otaFile.good())
+        mImage = mOwner->AcquireImage(mFileDesignator);
+        if (mImage.empty())
         {
             ChipLogError(BDX, "OTA file open failed");
-            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+            TEMPORARY_RETURN_IGNORED mTransfer.RejectTransfer(StatusCode::kFileDesignatorUnknown);
             return;
         }
 
-        if (seekOffset > static_cast<uint64_t>(std::numeric_limits<std::streamoff>::max()))
-        {
-            ChipLogError(BDX, "Seek offset too large");
-            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kLengthTooLarge);
-            return;
-        }
-        otaFile.seekg(static_cast<std::streamoff>(seekOffset));
-        otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
-        if (!(otaFile.good() || otaFile.eof()))
-        {
-            ChipLogError(BDX, "OTA file read failed");
-            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
-        }
-
-        blockData.Data   = blockBuf->Start();
-        blockData.Length = static_cast<size_t>(otaFile.gcount());
-        blockData.IsEof  = (blockData.Length < blockSize) ||
-            (seekOffset + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
-        mNumBytesSent = static_cast<uint32_t>(seekOffset + blockData.Length);
-        otaFile.close();
-
-        err = mTransfer.PrepareBlock(blockData);
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
-            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kUnknown);
-        }
+        // TransferSession will automatically reject a transfer if there are no
+        // common supported control modes. It will also default to the smaller
+        // block size.
+        TransferSession::TransferAcceptData acceptData;
+        acceptData.ControlMode  = TransferControlFlags::kReceiverDrive; // OTA must use receiver drive
+        acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
+        acceptData.StartOffset  = mTransfer.GetStartOffset();
+        acceptData.Length       = mTransfer.GetTransferLength();
+        err                     = mTransfer.AcceptTransfer(acceptData);
+        VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format()));
         break;
     }
+    case TransferSession::OutputEventType::kQueryReceived:
+        HandleQuery(0);
+        break;
+    case TransferSession::OutputEventType::kQueryWithSkipReceived:
+        HandleQuery(event.bytesToSkip.BytesToSkip);
+        break;
     case TransferSession::OutputEventType::kAckReceived:
         break;
     case TransferSession::OutputEventType::kAckEOFReceived:
@@ -216,15 +157,47 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
     }
 }
 
+void BdxOtaTransfer::HandleQuery(uint64_t bytesToSkip)
+{
+    TransferSession::BlockData blockData;
+    uint16_t blockSize  = mTransfer.GetBlockDataSize();
+    uint64_t seekOffset = mNumBytesSent + bytesToSkip;
+
+    if (seekOffset > mImage.size())
+    {
+        ChipLogError(BDX, "Seek offset too large");
+        TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kLengthTooLarge);
+        return;
+    }
+
+    uint64_t endOffset = mImage.size();
+    if (mTransfer.GetTransferLength() > 0)
+    {
+        endOffset = std::min<uint64_t>(endOffset, mTransfer.GetTransferLength());
+    }
+
+    // The block is copied out of the shared mapping by PrepareBlock, so no intermediate buffer is needed.
+    blockData.Data   = mImage.data() + seekOffset;
+    blockData.Length = static_cast<size_t>(std::min<uint64_t>(blockSize, endOffset > seekOffset ? endOffset - seekOffset : 0));
+    blockData.IsEof  = (blockData.Length < blockSize) || (seekOffset + blockData.Length == endOffset);
+    mNumBytesSent    = static_cast<uint32_t>(seekOffset + blockData.Length);
+
+    CHIP_ERROR err = mTransfer.PrepareBlock(blockData);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
+        TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kUnknown);
+    }
+}
+
 /* Reset() calls bdx::TransferSession::Reset() which sets the output event type to
  * TransferSession::OutputEventType::kNone. So, bdx::TransferFacilitator::PollForOutput()
  * will call HandleTransferSessionOutput() with event TransferSession::OutputEventType::kNone.
  * Since we are ignoring kNone events so, it is okay HandleTransferSessionOutput() being called with event kNone
  */
-void BdxOtaSender::Reset()
+void BdxOtaTransfer::Reset()
 {
-    mFabricIndex.ClearValue();
-    mNodeId.ClearValue();
+    mNode = chip::ScopedNodeId();
     ResetTransfer();
     if (mExchangeCtx != nullptr)
     {
@@ -232,12 +205,18 @@ void BdxOtaSender::Reset()
         mExchangeCtx = nullptr;
     }
 
+    if (!mImage.empty())
+    {
+        mOwner->ReleaseImage(mImage);
+        mImage = chip::ByteSpan();
+    }
+
     mInitialized  = false;
     mNumBytesSent = 0;
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
 }
 
-void BdxOtaSender::AbortTransfer()
+void BdxOtaTransfer::AbortTransfer()
 {
     if (mInitialized)
     {
@@ -245,3 +224,151 @@ void BdxOtaSender::AbortTransfer()
         PollForOutput();
     }
 }
+
+BdxOtaSender::BdxOtaSender()
+{
+    for (auto & transfer : mTransfers)
+    {
+        transfer.SetOwner(this);
+    }
+}
+
+BdxOtaSender::~BdxOtaSender()
+{
+    for (auto & image : mImages)
+    {
+        if (!image.mData.empty())
+        {
+            munmap(const_cast<uint8_t *>(image.mData.data()), image.mData.size());
+        }
+    }
+}
+
+CHIP_ERROR BdxOtaSender::InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId)
+{
+    chip::ScopedNodeId node(nodeId, fabricIndex);
+    BdxOtaTransfer * freeTransfer = nullptr;
+    size_t activeTransfers        = 0;
+
+    for (auto & transfer : mTransfers)
+    {
+        if (transfer.IsForNode(node))
+        {
+            transfer.Initialize(node);
+            mPreparingTransfer = &transfer;
+            return CHIP_NO_ERROR;
+        }
+        if (transfer.IsInitialized())
+        {
+            activeTransfers++;
+        }
+        else if (freeTransfer == nullptr)
+        {
+            freeTransfer = &transfer;
+        }
+    }
+
+    // Prevent a new node connection when the maximum number of transfers is active
+    VerifyOrReturnError(freeTransfer != nullptr && activeTransfers < mMaxConcurrentTransfers, CHIP_ERROR_BUSY);
+
+    freeTransfer->Initialize(node);
+    mPreparingTransfer = freeTransfer;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BdxOtaSender::PrepareForTransfer(chip::System::Layer * layer, chip::bdx::TransferRole role,
+                                            chip::BitFlags<TransferControlFlags> xferControlOpts, uint16_t maxBlockSize,
+                                            chip::System::Clock::Timeout timeout, chip::System::Clock::Timeout pollFreq)
+{
+    VerifyOrReturnError(mPreparingTransfer != nullptr && mPreparingTransfer->IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    BdxOtaTransfer * transfer = mPreparingTransfer;
+    mPreparingTransfer        = nullptr;
+    return transfer->PrepareForTransfer(layer, role, xferControlOpts, maxBlockSize, timeout, pollFreq);
+}
+
+void BdxOtaSender::SetMaxConcurrentTransfers(size_t count)
+{
+    mMaxConcurrentTransfers = std::clamp<size_t>(count, 1, kMaxTransfers);
+}
+
+void BdxOtaSender::AbortTransfer()
+{
+    for (auto & transfer : mTransfers)
+    {
+        transfer.AbortTransfer();
+    }
+}
+
+CHIP_ERROR BdxOtaSender::OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                                      const chip::SessionHandle & session,
+                                                      chip::Messaging::ExchangeDelegate *& newDelegate)
+{
+    VerifyOrReturnError(session->IsSecureSession(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Requestors start their transfer after a QueryImage, which reserved a transfer for them.
+    const chip::ScopedNodeId peer = session->GetPeer();
+    for (auto & transfer : mTransfers)
+    {
+        if (transfer.IsForNode(peer) && !transfer.HasExchange())
+        {
+            newDelegate = &transfer;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    ChipLogError(BDX, "No OTA transfer reserved for node " ChipLogFormatScopedNodeId, ChipLogValueScopedNodeId(peer));
+    return CHIP_ERROR_NOT_FOUND;
+}
+
+chip::ByteSpan BdxOtaSender::AcquireImage(const char * path)
+{
+    MappedImage * freeImage = nullptr;
+    for (auto & image : mImages)
+    {
+        if (!image.mData.empty() && strcmp(image.mPath, path) == 0)
+        {
+            image.mUsers++;
+            return image.mData;
+        }
+        if (image.mData.empty() && freeImage == nullptr)
+        {
+            freeImage = &image;
+        }
+    }
+    VerifyOrReturnValue(freeImage != nullptr, chip::ByteSpan());
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnValue(fd >= 0, chip::ByteSpan());
+
+    struct stat fileStat;
+    void * data = MAP_FAILED;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    VerifyOrReturnValue(data != MAP_FAILED, chip::ByteSpan());
+
+    // Transfers read the image front to back.
+    madvise(data, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+
+    chip::Platform::CopyString(freeImage->mPath, path);
+    freeImage->mData  = chip::ByteSpan(static_cast<const uint8_t *>(data), static_cast<size_t>(fileStat.st_size));
+    freeImage->mUsers = 1;
+    return freeImage->mData;
+}
+
+void BdxOtaSender::ReleaseImage(chip::ByteSpan data)
+{
+    for (auto & image : mImages)
+    {
+        if (image.mData.data() == data.data() && !image.mData.empty())
+        {
+            VerifyOrReturn(--image.mUsers == 0);
+            munmap(const_cast<uint8_t *>(image.mData.data()), image.mData.size());
+            image.mData = chip::ByteSpan();
+            return;
+        }
+    }
+}
@@ -15,18 +15,29 @@
  *    limitations under the License.
  */
 
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/Span.h>
+#include <messaging/ExchangeDelegate.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <protocols/bdx/TransferFacilitator.h>
 
 #pragma once
 
-class BdxOtaSender : public chip::bdx::Responder
+class BdxOtaSender;
+
+// A single BDX transfer of an OTA image to one requestor.
+class BdxOtaTransfer : public chip::bdx::Responder
 {
 public:
-    BdxOtaSender();
+    BdxOtaTransfer();
 
-    // Initializes BDX transfer-related metadata. Should always be called first.
-    CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
+    void SetOwner(BdxOtaSender * owner) { mOwner = owner; }
+
+    bool IsInitialized() const { return mInitialized; }
+    bool IsForNode(const chip::ScopedNodeId & node) const { return mInitialized && mNode == node; }
+    bool HasExchange() const { return mExchangeCtx != nullptr; }
+
+    void Initialize(const chip::ScopedNodeId & node);
 
     void AbortTransfer();
 
@@ -34,16 +45,68 @@ private:
     // Inherited from bdx::TransferFacilitator
     void HandleTransferSessionOutput(chip::bdx::TransferSession::OutputEvent & event) override;
 
+    void HandleQuery(uint64_t bytesToSkip);
+
     void Reset();
 
+    BdxOtaSender * mOwner = nullptr;
+
     // Null-terminated string representing file designator
     char mFileDesignator[chip::bdx::kMaxFileDesignatorLen];
 
+    // Contents of the image file, shared with the other transfers of the same file
+    chip::ByteSpan mImage;
+
     uint32_t mNumBytesSent = 0;
 
     bool mInitialized = false;
 
-    chip::Optional<chip::FabricIndex> mFabricIndex;
+    chip::ScopedNodeId mNode;
+};
+
+// Serves OTA images to several requestors at once, each over its own BDX transfer. Image files are mapped
+// into memory once and shared by all the transfers reading them.
+class BdxOtaSender : public chip::Messaging::UnsolicitedMessageHandler
+{
+public:
+    static constexpr size_t kMaxTransfers = 16;
+
+    BdxOtaSender();
+    ~BdxOtaSender();
+
+    // Reserves a transfer for the given node, replacing a stale transfer of the same node if one exists.
+    // Should always be called first. Returns CHIP_ERROR_BUSY if the maximum number of concurrent transfers is reached.
+    CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
+
+    // Prepares the transfer reserved by the last successful InitializeTransfer for the incoming BDX request.
+    CHIP_ERROR PrepareForTransfer(chip::System::Layer * layer, chip::bdx::TransferRole role,
+                                  chip::BitFlags<chip::bdx::TransferControlFlags> xferControlOpts, uint16_t maxBlockSize,
+                                  chip::System::Clock::Timeout timeout, chip::System::Clock::Timeout pollFreq);
+
+    // Limits the number of transfers served at once, up to kMaxTransfers.
+    void SetMaxConcurrentTransfers(size_t count);
+
+    // Aborts all the transfers in progress.
+    void AbortTransfer();
+
+    // Used by BdxOtaTransfer to share a read-only mapping of an image file.
+    chip::ByteSpan AcquireImage(const char * path);
+    void ReleaseImage(chip::ByteSpan image);
+
+private:
+    struct MappedImage
+    {
+        char mPath[chip::bdx::kMaxFileDesignatorLen];
+        chip::ByteSpan mData;
+        size_t mUsers = 0;
+    };
+
+    // Inherited from Messaging::UnsolicitedMessageHandler
+    CHIP_ERROR OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader, const chip::SessionHandle & session,
+                                            chip::Messaging::ExchangeDelegate *& newDelegate) override;
 
-    chip::Optional<chip::NodeId> mNodeId;
+    BdxOtaTransfer mTransfers[kMaxTransfers];
+    MappedImage mImages[kMaxTransfers];
+    BdxOtaTransfer * mPreparingTransfer = nullptr;
+    size_t mMaxConcurrentTransfers      = kMaxTransfers;
 };
@@ -937,6 +937,7 @@ void ChipLinuxAppMainLoop(chip::ServerInitParams & initParams, AppMainLoopImplem
     {
         initParams.advertiseCommissionableIfNoFabrics = false;
     }
+    initParams.deferNonCriticalInit = LinuxDeviceOptions::GetInstance().deferNonCriticalInit;
 
     // Init ZCL Data Model and CHIP App Server
     CHIP_ERROR err = Server::GetInstance().Init(initParams);
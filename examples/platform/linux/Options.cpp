@@ -114,6 +114,7 @@ enum
     kDeviceOption_TestEventTriggerEnableKey,
     kTraceTo,
     kOptionSimulateNoInternalTime,
+    kDeviceOption_DeferNonCriticalInit,
 #if defined(PW_RPC_ENABLED)
     kOptionRpcServerPort,
 #endif
@@ -224,6 +225,7 @@ OptionDef sDeviceOptionDefs[] = {
     { "trace-to", kArgumentRequired, kTraceTo },
 #endif
     { "simulate-no-internal-time", kNoArgument, kOptionSimulateNoInternalTime },
+    { "defer-non-critical-init", kNoArgument, kDeviceOption_DeferNonCriticalInit },
 #if defined(PW_RPC_ENABLED)
     { "rpc-server-port", kArgumentRequired, kOptionRpcServerPort },
 #endif
@@ -407,6 +409,8 @@ const char * sDeviceOptionHelp =
 #endif
     "  --simulate-no-internal-time\n"
     "       Time cluster does not use internal platform time\n"
+    "  --defer-non-critical-init\n"
+    "       Run the server initialization work that is not needed to answer the first requests from the event loop.\n"
 #if defined(PW_RPC_ENABLED)
     "  --rpc-server-port\n"
     "       Start RPC server on specified port\n"
@@ -807,6 +811,9 @@ bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier,
     case kOptionSimulateNoInternalTime:
         LinuxDeviceOptions::GetInstance().mSimulateNoInternalTime = true;
         break;
+    case kDeviceOption_DeferNonCriticalInit:
+        LinuxDeviceOptions::GetInstance().deferNonCriticalInit = true;
+        break;
 #if defined(PW_RPC_ENABLED)
     case kOptionRpcServerPort:
         LinuxDeviceOptions::GetInstance().rpcServerPort = static_cast<uint16_t>(strtoul(aValue, nullptr, 0));
@@ -91,6 +91,7 @@ struct LinuxDeviceOptions
     uint8_t testEventTriggerEnableKey[16] = { 0 };
     std::vector<std::string> traceTo;
     bool mSimulateNoInternalTime = false;
+    bool deferNonCriticalInit    = false;
 #if defined(PW_RPC_ENABLED)
     uint16_t rpcServerPort = 33000;
 #endif
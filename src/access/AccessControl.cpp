@@ -209,6 +209,7 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+        OnEntriesChanged(nullptr);
     }
 
     return retval;
@@ -220,6 +221,7 @@ void AccessControl::Finish()
     ChipLogProgress(DataManagement, "AccessControl: finishing");
     mDelegate->Finish();
     mDelegate = nullptr;
+    OnEntriesChanged(nullptr);
 }
 
 CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t * index,
@@ -238,6 +240,7 @@ CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescripto
 
     size_t i = 0;
     ReturnErrorOnFailure(mDelegate->CreateEntry(&i, entry, &fabric));
+    OnEntriesChanged(&fabric);
 
     if (index)
     {
@@ -254,6 +257,7 @@ CHIP_ERROR AccessControl::UpdateEntry(const SubjectDescriptor * subjectDescripto
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
     ReturnErrorOnFailure(mDelegate->UpdateEntry(index, entry, &fabric));
+    OnEntriesChanged(&fabric);
     NotifyEntryChanged(subjectDescriptor, fabric, index, &entry, EntryListener::ChangeType::kUpdated);
     return CHIP_NO_ERROR;
 }
@@ -268,6 +272,7 @@ CHIP_ERROR AccessControl::DeleteEntry(const SubjectDescriptor * subjectDescripto
         p = &entry;
     }
     ReturnErrorOnFailure(mDelegate->DeleteEntry(index, &fabric));
+    OnEntriesChanged(&fabric);
     if (p && p->HasDefaultDelegate())
     {
         // The entry was read prior to deletion so its latest value could be provided
@@ -352,8 +357,51 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
     return result;
 }
 
+CHIP_ERROR AccessControl::CheckCluster(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                       Privilege requestPrivilege, bool & reusable)
+{
+    reusable = false;
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(IsValidPrivilege(requestPrivilege), CHIP_ERROR_INVALID_ARGUMENT);
+
+    RequestPath clusterPath = requestPath;
+    clusterPath.entityId    = std::nullopt;
+
+    // A delegate policy sees the entity, it may decide differently for each one.
+    VerifyOrReturnError(mDelegate->Check(subjectDescriptor, clusterPath, requestPrivilege) == CHIP_ERROR_NOT_IMPLEMENTED,
+                        CHIP_ERROR_NOT_IMPLEMENTED);
+
+    // Entries only target endpoints, clusters and device types: the ACL result is the same for all entities.
+    bool usedDeviceType = false;
+    CHIP_ERROR result   = CheckACL(subjectDescriptor, clusterPath, requestPrivilege, &usedDeviceType);
+
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    if (result == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(requestPath.requestType != RequestType::kRequestTypeUnknown, CHIP_ERROR_INVALID_ARGUMENT);
+        // Restrictions are per entity
+        VerifyOrReturnError(!IsAccessRestrictionListSupported(), CHIP_ERROR_NOT_IMPLEMENTED);
+    }
+#endif
+
+    reusable = !usedDeviceType;
+    return result;
+}
+
+uint32_t AccessControl::GetGeneration() const
+{
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    // Both counters only go up, so their sum changes whenever either does.
+    if (mAccessRestrictionProvider != nullptr)
+    {
+        return mGeneration + mAccessRestrictionProvider->GetGeneration();
+    }
+#endif
+    return mGeneration;
+}
+
 CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
-                                   Privilege requestPrivilege)
+                                   Privilege requestPrivilege, bool * usedDeviceType)
 {
 #if CHIP_PROGRESS_LOGGING && CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 1
     {
@@ -401,6 +449,27 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         return CHIP_NO_ERROR;
     }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+    {
+        CHIP_ERROR result = CheckCompiledACL(subjectDescriptor, requestPath, requestPrivilege, usedDeviceType);
+        if (result != CHIP_ERROR_NOT_IMPLEMENTED)
+        {
+            if (result == CHIP_ERROR_ACCESS_DENIED)
+            {
+                ChipLogProgress(DataManagement, "AccessControl: denied");
+            }
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            else if (result == CHIP_NO_ERROR)
+            {
+                ChipLogProgress(DataManagement, "AccessControl: allowed");
+            }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            return result;
+        }
+        // Entries could not be compiled, check them one by one below.
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -488,10 +557,16 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
                 {
                     continue;
                 }
-                if (target.flags & Entry::Target::kDeviceType &&
-                    !mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+                if (target.flags & Entry::Target::kDeviceType)
                 {
-                    continue;
+                    if (usedDeviceType != nullptr)
+                    {
+                        *usedDeviceType = true;
+                    }
+                    if (!mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+                    {
+                        continue;
+                    }
                 }
                 targetMatched = true;
                 break;
@@ -515,6 +590,267 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
     return CHIP_ERROR_ACCESS_DENIED;
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+CHIP_ERROR AccessControl::CheckCompiledACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                           Privilege requestPrivilege, bool * outUsedDeviceType)
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+    for (const auto & cached : mCheckCache)
+    {
+        if (cached.fabricIndex == subjectDescriptor.fabricIndex && cached.fabricIndex != kUndefinedFabricIndex &&
+            cached.authMode == subjectDescriptor.authMode && cached.subject == subjectDescriptor.subject &&
+            cached.cluster == requestPath.cluster && cached.endpoint == requestPath.endpoint &&
+            cached.privilege == requestPrivilege && cached.cats == subjectDescriptor.cats)
+        {
+            return cached.allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        }
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+
+    const CompiledFabric * compiled = GetCompiledFabric(subjectDescriptor.fabricIndex);
+    VerifyOrReturnError(compiled != nullptr, CHIP_ERROR_NOT_IMPLEMENTED);
+
+    const uint8_t requestBit = to_underlying(requestPrivilege);
+    bool allowed             = false;
+    bool usedDeviceType      = false;
+
+    for (size_t e = 0; (e < compiled->entryCount) && !allowed; e++)
+    {
+        const CompiledEntry & entry = compiled->entries[e];
+        VerifyOrReturnError(entry.valid, CHIP_ERROR_INCORRECT_STATE);
+
+        if ((entry.authMode != subjectDescriptor.authMode) || ((entry.grantedPrivileges & requestBit) == 0))
+        {
+            continue;
+        }
+
+        bool subjectMatched = (entry.subjectCount == 0);
+        for (size_t i = 0; (i < entry.subjectCount) && !subjectMatched; i++)
+        {
+            const NodeId subject = compiled->subjects[entry.firstSubject + i];
+            // Subjects were validated against the auth mode when compiling.
+            subjectMatched = IsCASEAuthTag(subject) ? subjectDescriptor.cats.CheckSubjectAgainstCATs(subject)
+                                                    : (subject == subjectDescriptor.subject);
+        }
+        if (!subjectMatched)
+        {
+            continue;
+        }
+
+        bool targetMatched = (entry.targetCount == 0);
+        for (size_t i = 0; (i < entry.targetCount) && !targetMatched; i++)
+        {
+            const Entry::Target & target = compiled->targets[entry.firstTarget + i];
+            if ((target.flags & Entry::Target::kCluster) && target.cluster != requestPath.cluster)
+            {
+                continue;
+            }
+            if ((target.flags & Entry::Target::kEndpoint) && target.endpoint != requestPath.endpoint)
+            {
+                continue;
+            }
+            if (target.flags & Entry::Target::kDeviceType)
+            {
+                usedDeviceType = true;
+                if (!mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+                {
+                    continue;
+                }
+            }
+            targetMatched = true;
+        }
+
+        allowed = targetMatched;
+    }
+
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+    // Device types on an endpoint can change without the ACL changing, so those results cannot be reused.
+    if (!usedDeviceType)
+    {
+        CheckCacheEntry & cached = mCheckCache[mNextCheckCacheEntry];
+        mNextCheckCacheEntry     = (mNextCheckCacheEntry + 1) % MATTER_ARRAY_SIZE(mCheckCache);
+
+        cached.subject     = subjectDescriptor.subject;
+        cached.cats        = subjectDescriptor.cats;
+        cached.cluster     = requestPath.cluster;
+        cached.endpoint    = requestPath.endpoint;
+        cached.fabricIndex = subjectDescriptor.fabricIndex;
+        cached.authMode    = subjectDescriptor.authMode;
+        cached.privilege   = requestPrivilege;
+        cached.allowed     = allowed;
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+
+    if (outUsedDeviceType != nullptr && usedDeviceType)
+    {
+        *outUsedDeviceType = true;
+    }
+    return allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+}
+
+AccessControl::CompiledFabric * AccessControl::GetCompiledFabric(FabricIndex fabricIndex)
+{
+    for (auto & compiled : mCompiledFabrics)
+    {
+        if (compiled.fabricIndex == fabricIndex && compiled.fabricIndex != kUndefinedFabricIndex)
+        {
+            return &compiled;
+        }
+    }
+
+    // Subjects without a fabric cannot match any entry: a compiled fabric is not needed for that.
+    VerifyOrReturnValue(fabricIndex != kUndefinedFabricIndex, nullptr);
+
+    CompiledFabric * slot = nullptr;
+    for (auto & compiled : mCompiledFabrics)
+    {
+        if (compiled.fabricIndex == kUndefinedFabricIndex)
+        {
+            slot = &compiled;
+            break;
+        }
+    }
+    if (slot == nullptr)
+    {
+        slot                = &mCompiledFabrics[mNextCompiledFabric];
+        mNextCompiledFabric = (mNextCompiledFabric + 1) % MATTER_ARRAY_SIZE(mCompiledFabrics);
+    }
+
+    if (CompileFabric(fabricIndex, *slot) != CHIP_NO_ERROR)
+    {
+        *slot = CompiledFabric();
+        return nullptr;
+    }
+    slot->fabricIndex = fabricIndex;
+    return slot;
+}
+
+CHIP_ERROR AccessControl::CompileFabric(FabricIndex fabricIndex, CompiledFabric & compiled) const
+{
+    size_t entryCount  = 0;
+    size_t maxSubjects = 0;
+    size_t maxTargets  = 0;
+    ReturnErrorOnFailure(GetEntryCount(fabricIndex, entryCount));
+    ReturnErrorOnFailure(GetMaxSubjectsPerEntry(maxSubjects));
+    ReturnErrorOnFailure(GetMaxTargetsPerEntry(maxTargets));
+
+    // Room for the largest possible entries, so a single pass over the delegate is enough.
+    VerifyOrReturnError(maxSubjects <= UINT8_MAX && maxTargets <= UINT8_MAX, CHIP_ERROR_NOT_IMPLEMENTED);
+    VerifyOrReturnError(entryCount * maxSubjects <= UINT16_MAX && entryCount * maxTargets <= UINT16_MAX,
+                        CHIP_ERROR_NOT_IMPLEMENTED);
+
+    compiled.entryCount = 0;
+    if (entryCount > 0)
+    {
+        VerifyOrReturnError(compiled.entries.Calloc(entryCount), CHIP_ERROR_NO_MEMORY);
+    }
+    if (entryCount * maxSubjects > 0)
+    {
+        VerifyOrReturnError(compiled.subjects.Calloc(entryCount * maxSubjects), CHIP_ERROR_NO_MEMORY);
+    }
+    if (entryCount * maxTargets > 0)
+    {
+        VerifyOrReturnError(compiled.targets.Calloc(entryCount * maxTargets), CHIP_ERROR_NO_MEMORY);
+    }
+
+    size_t subjectsUsed = 0;
+    size_t targetsUsed  = 0;
+
+    EntryIterator iterator;
+    ReturnErrorOnFailure(Entries(iterator, &fabricIndex));
+
+    Entry entry;
+    CHIP_ERROR err;
+    while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+    {
+        // The entry count and the iteration disagree: do not guess.
+        VerifyOrReturnError(compiled.entryCount < entryCount, CHIP_ERROR_INCORRECT_STATE);
+        CompiledEntry & out = compiled.entries[compiled.entryCount++];
+
+        out.firstSubject = static_cast<uint16_t>(subjectsUsed);
+        out.firstTarget  = static_cast<uint16_t>(targetsUsed);
+        out.valid        = false;
+
+        Privilege privilege = Privilege::kView;
+        ReturnErrorOnFailure(entry.GetAuthMode(out.authMode));
+        ReturnErrorOnFailure(entry.GetPrivilege(privilege));
+
+        out.grantedPrivileges = 0;
+        for (auto requestPrivilege : { Privilege::kView, Privilege::kProxyView, Privilege::kOperate, Privilege::kManage,
+                                       Privilege::kAdminister })
+        {
+            if (CheckRequestPrivilegeAgainstEntryPrivilege(requestPrivilege, privilege))
+            {
+                out.grantedPrivileges = static_cast<uint8_t>(out.grantedPrivileges | to_underlying(requestPrivilege));
+            }
+        }
+
+        // Operational PASE not supported for v1.0.
+        bool valid = (out.authMode == AuthMode::kCase || out.authMode == AuthMode::kGroup);
+
+        size_t subjectCount = 0;
+        ReturnErrorOnFailure(entry.GetSubjectCount(subjectCount));
+        VerifyOrReturnError(subjectCount <= maxSubjects, CHIP_ERROR_INCORRECT_STATE);
+        for (size_t i = 0; i < subjectCount; ++i)
+        {
+            NodeId subject = kUndefinedNodeId;
+            ReturnErrorOnFailure(entry.GetSubject(i, subject));
+            if (IsOperationalNodeId(subject) || IsCASEAuthTag(subject))
+            {
+                valid = valid && (out.authMode == AuthMode::kCase);
+            }
+            else if (IsGroupId(subject))
+            {
+                valid = valid && (out.authMode == AuthMode::kGroup);
+            }
+            else
+            {
+                valid = false;
+            }
+            compiled.subjects[subjectsUsed++] = subject;
+        }
+        out.subjectCount = static_cast<uint8_t>(subjectCount);
+
+        size_t targetCount = 0;
+        ReturnErrorOnFailure(entry.GetTargetCount(targetCount));
+        VerifyOrReturnError(targetCount <= maxTargets, CHIP_ERROR_INCORRECT_STATE);
+        for (size_t i = 0; i < targetCount; ++i)
+        {
+            ReturnErrorOnFailure(entry.GetTarget(i, compiled.targets[targetsUsed++]));
+        }
+        out.targetCount = static_cast<uint8_t>(targetCount);
+
+        out.valid = valid;
+    }
+    VerifyOrReturnError(err == CHIP_ERROR_SENTINEL, err);
+
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+
+void AccessControl::OnEntriesChanged(const FabricIndex * fabricIndex)
+{
+    mGeneration++;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+    for (auto & compiled : mCompiledFabrics)
+    {
+        if (fabricIndex == nullptr || compiled.fabricIndex == *fabricIndex)
+        {
+            compiled = CompiledFabric();
+        }
+    }
+
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+    // Results are not bound to a single entry, drop all of them.
+    for (auto & cached : mCheckCache)
+    {
+        cached.fabricIndex = kUndefinedFabricIndex;
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+}
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
 CHIP_ERROR AccessControl::CheckARL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                                    Privilege requestPrivilege)
@@ -31,6 +31,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/core/Global.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
 
 // Dump function for use during development only (0 for disabled, non-zero for enabled).
 #define CHIP_ACCESS_CONTROL_DUMP_ENABLED 0
@@ -510,7 +511,9 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
-        return mDelegate->CreateEntry(index, entry, fabricIndex);
+        ReturnErrorOnFailure(mDelegate->CreateEntry(index, entry, fabricIndex));
+        OnEntriesChanged(fabricIndex);
+        return CHIP_NO_ERROR;
     }
 
     /**
@@ -560,7 +563,9 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
-        return mDelegate->UpdateEntry(index, entry, fabricIndex);
+        ReturnErrorOnFailure(mDelegate->UpdateEntry(index, entry, fabricIndex));
+        OnEntriesChanged(fabricIndex);
+        return CHIP_NO_ERROR;
     }
 
     /**
@@ -581,7 +586,9 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
-        return mDelegate->DeleteEntry(index, fabricIndex);
+        ReturnErrorOnFailure(mDelegate->DeleteEntry(index, fabricIndex));
+        OnEntriesChanged(fabricIndex);
+        return CHIP_NO_ERROR;
     }
 
     /**
@@ -645,6 +652,7 @@ public:
     void SetAccessRestrictionProvider(AccessRestrictionProvider * accessRestrictionProvider)
     {
         mAccessRestrictionProvider = accessRestrictionProvider;
+        mGeneration++;
     }
 
     AccessRestrictionProvider * GetAccessRestrictionProvider() { return mAccessRestrictionProvider; }
@@ -669,6 +677,41 @@ public:
      */
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+    /**
+     * Check whether access (by a subject descriptor, to every entity of the request
+     * path's cluster, requiring a privilege) would be allowed or denied by Check,
+     * whatever the entity. `requestPath.entityId` is ignored.
+     *
+     * This lets callers that check many entities of the same cluster with the same
+     * privilege (e.g. wildcard reads) evaluate the ACL once for all of them.
+     *
+     * @retval #CHIP_NO_ERROR if Check would allow access to every entity.
+     * @retval #CHIP_ERROR_ACCESS_DENIED if Check would deny access to every entity.
+     * @retval #CHIP_ERROR_NOT_IMPLEMENTED if the result may depend on the entity (a delegate
+     *         policy or access restrictions apply): Check must be used for each entity.
+     * @retval other errors should be treated as if Check failed with them for every entity.
+     */
+    CHIP_ERROR CheckCluster(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                            Privilege requestPrivilege)
+    {
+        bool reusable;
+        return CheckCluster(subjectDescriptor, requestPath, requestPrivilege, reusable);
+    }
+
+    /**
+     * Same as CheckCluster above. On success or CHIP_ERROR_ACCESS_DENIED, `reusable` tells whether
+     * the result holds for the same subject, cluster and privilege for as long as GetGeneration()
+     * does not change. Results that depended on the device types of the endpoint are not.
+     */
+    CHIP_ERROR CheckCluster(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                            Privilege requestPrivilege, bool & reusable);
+
+    /**
+     * Get a counter that changes whenever the ACL entries, or the access restrictions, change.
+     * Results of CheckCluster that are reusable may be kept while it keeps its value.
+     */
+    uint32_t GetGeneration() const;
+
 #if CHIP_ACCESS_CONTROL_DUMP_ENABLED
     CHIP_ERROR Dump(const Entry & entry);
 #endif
@@ -679,11 +722,18 @@ private:
     void NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
                             EntryListener::ChangeType changeType);
 
+    /**
+     * Drops anything derived from the entries of the given fabric (or of all
+     * fabrics, if null) after they changed.
+     */
+    void OnEntriesChanged(const FabricIndex * fabricIndex);
+
     /**
      * Check ACL for whether access (by a subject descriptor, to a request path,
      * requiring a privilege) should be allowed or denied.
      */
-    CHIP_ERROR CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
+    CHIP_ERROR CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                        bool * usedDeviceType = nullptr);
 
     /**
      * Check CommissioningARL or ARL (as appropriate) for whether access (by a
@@ -692,6 +742,65 @@ private:
      */
     CHIP_ERROR CheckARL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+    /**
+     * Flattened copy of a fabric's entry, in the same order as the delegate
+     * iterates them. Subjects and targets live in the arrays of the owning
+     * CompiledFabric.
+     */
+    struct CompiledEntry
+    {
+        uint16_t firstSubject;
+        uint16_t firstTarget;
+        uint8_t subjectCount;
+        uint8_t targetCount;
+        uint8_t grantedPrivileges; // bits of every request privilege that the entry privilege grants
+        AuthMode authMode;
+        bool valid; // false if the entry cannot be evaluated: checks reaching it fail
+    };
+
+    struct CompiledFabric
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        size_t entryCount       = 0;
+        Platform::ScopedMemoryBufferWithSize<CompiledEntry> entries;
+        Platform::ScopedMemoryBufferWithSize<NodeId> subjects;
+        Platform::ScopedMemoryBufferWithSize<Entry::Target> targets;
+    };
+
+    struct CheckCacheEntry
+    {
+        NodeId subject;
+        CATValues cats;
+        ClusterId cluster;
+        EndpointId endpoint;
+        FabricIndex fabricIndex = kUndefinedFabricIndex; // kUndefinedFabricIndex marks an unused entry
+        AuthMode authMode;
+        Privilege privilege;
+        bool allowed;
+    };
+
+    /**
+     * Check against the compiled entries of the subject's fabric, compiling them first if needed.
+     *
+     * @retval #CHIP_ERROR_NOT_IMPLEMENTED if the entries could not be compiled; the caller must
+     *         check against the delegate's entries instead.
+     */
+    CHIP_ERROR CheckCompiledACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                Privilege requestPrivilege, bool * outUsedDeviceType);
+
+    CompiledFabric * GetCompiledFabric(FabricIndex fabricIndex);
+    CHIP_ERROR CompileFabric(FabricIndex fabricIndex, CompiledFabric & compiled) const;
+
+    CompiledFabric mCompiledFabrics[CHIP_CONFIG_MAX_FABRICS];
+    size_t mNextCompiledFabric = 0; // round-robin replacement once all slots are in use
+
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE > 0
+    CheckCacheEntry mCheckCache[CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE];
+    size_t mNextCheckCacheEntry = 0;
+#endif
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+
 private:
     Delegate * mDelegate = nullptr;
 
@@ -699,6 +808,8 @@ private:
 
     EntryListener * mEntryListener = nullptr;
 
+    uint32_t mGeneration = 0;
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     AccessRestrictionProvider * mAccessRestrictionProvider;
 #endif
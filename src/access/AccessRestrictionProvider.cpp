@@ -26,6 +26,15 @@ using namespace chip::Platform;
 namespace chip {
 namespace Access {
 
+namespace {
+
+bool IdLess(const std::pair<uint32_t, uint8_t> & item, uint32_t id)
+{
+    return item.first < id;
+}
+
+} // namespace
+
 void AccessRestrictionProvider::AddListener(Listener & listener)
 {
     if (mListeners == nullptr)
@@ -83,6 +92,8 @@ CHIP_ERROR AccessRestrictionProvider::SetCommissioningEntries(const std::vector<
     }
 
     mCommissioningEntries = entries;
+    BuildIndex(mCommissioningEntries, mCommissioningIndex);
+    mGeneration++;
 
     for (Listener * listener = mListeners; listener != nullptr; listener = listener->mNext)
     {
@@ -109,7 +120,9 @@ CHIP_ERROR AccessRestrictionProvider::SetEntries(const FabricIndex fabricIndex,
         updatedEntries.push_back(updatedEntry);
     }
 
+    BuildIndex(updatedEntries, mFabricIndexes[fabricIndex]);
     mFabricEntries[fabricIndex] = std::move(updatedEntries);
+    mGeneration++;
 
     for (Listener * listener = mListeners; listener != nullptr; listener = listener->mNext)
     {
@@ -132,18 +145,49 @@ bool AccessRestrictionProvider::StandardAccessRestrictionExceptionChecker::AreRe
     return false;
 }
 
+void AccessRestrictionProvider::BuildIndex(const std::vector<Entry> & entries, RestrictionIndex & index)
+{
+    index.clear();
+
+    for (const auto & entry : entries)
+    {
+        ClusterRestrictions & cluster = index[IndexKey(entry.endpointNumber, entry.clusterId)];
+
+        for (const auto & restriction : entry.restrictions)
+        {
+            uint8_t typeBit = static_cast<uint8_t>(1u << to_underlying(restriction.restrictionType));
+            if (!restriction.id.HasValue())
+            {
+                cluster.anyId |= typeBit;
+                continue;
+            }
+
+            auto it = std::lower_bound(cluster.byId.begin(), cluster.byId.end(), restriction.id.Value(), IdLess);
+            if (it != cluster.byId.end() && it->first == restriction.id.Value())
+            {
+                it->second |= typeBit;
+            }
+            else
+            {
+                cluster.byId.insert(it, std::make_pair(restriction.id.Value(), typeBit));
+            }
+        }
+    }
+}
+
 CHIP_ERROR AccessRestrictionProvider::CheckForCommissioning(const SubjectDescriptor & subjectDescriptor,
                                                             const RequestPath & requestPath)
 {
-    return DoCheck(mCommissioningEntries, subjectDescriptor, requestPath);
+    return DoCheck(&mCommissioningIndex, subjectDescriptor, requestPath);
 }
 
 CHIP_ERROR AccessRestrictionProvider::Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath)
 {
-    return DoCheck(mFabricEntries[subjectDescriptor.fabricIndex], subjectDescriptor, requestPath);
+    auto it = mFabricIndexes.find(subjectDescriptor.fabricIndex);
+    return DoCheck(it != mFabricIndexes.end() ? &it->second : nullptr, subjectDescriptor, requestPath);
 }
 
-CHIP_ERROR AccessRestrictionProvider::DoCheck(const std::vector<Entry> & entries, const SubjectDescriptor & subjectDescriptor,
+CHIP_ERROR AccessRestrictionProvider::DoCheck(const RestrictionIndex * index, const SubjectDescriptor & subjectDescriptor,
                                               const RequestPath & requestPath)
 {
     if (!mExceptionChecker.AreRestrictionsAllowed(requestPath.endpoint, requestPath.cluster))
@@ -175,57 +219,50 @@ CHIP_ERROR AccessRestrictionProvider::DoCheck(const std::vector<Entry> & entries
         }
     }
 
-    for (auto & entry : entries)
+    VerifyOrReturnError(index != nullptr, CHIP_NO_ERROR);
+    auto cluster = index->find(IndexKey(requestPath.endpoint, requestPath.cluster));
+    VerifyOrReturnError(cluster != index->end(), CHIP_NO_ERROR);
+
+    // Restrictions without an id apply to every id
+    uint32_t entityId = requestPath.entityId.value();
+    uint8_t types     = cluster->second.anyId;
+    auto byId         = std::lower_bound(cluster->second.byId.begin(), cluster->second.byId.end(), entityId, IdLess);
+    if (byId != cluster->second.byId.end() && byId->first == entityId)
+    {
+        types |= byId->second;
+    }
+
+    auto restricted = [types](Type type) { return (types & (1u << to_underlying(type))) != 0; };
+
+    switch (requestPath.requestType)
     {
-        if (entry.endpointNumber != requestPath.endpoint || entry.clusterId != requestPath.cluster)
+    case RequestType::kAttributeReadRequest:
+        if (restricted(Type::kAttributeAccessForbidden) && !IsGlobalAttribute(entityId))
         {
-            continue;
+            return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
         }
-
-        for (auto & restriction : entry.restrictions)
+        break;
+    case RequestType::kAttributeWriteRequest:
+        if ((restricted(Type::kAttributeAccessForbidden) || restricted(Type::kAttributeWriteForbidden)) &&
+            !IsGlobalAttribute(entityId))
         {
-            // A missing id is a wildcard
-            bool idMatch = !restriction.id.HasValue() || restriction.id.Value() == requestPath.entityId.value();
-            if (!idMatch)
-            {
-                continue;
-            }
-
-            switch (restriction.restrictionType)
-            {
-            case Type::kAttributeAccessForbidden:
-                if (requestPath.requestType == RequestType::kAttributeReadRequest ||
-                    requestPath.requestType == RequestType::kAttributeWriteRequest)
-                {
-                    if (!IsGlobalAttribute(requestPath.entityId.value()))
-                    {
-                        return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
-                    }
-                }
-                break;
-            case Type::kAttributeWriteForbidden:
-                if (requestPath.requestType == RequestType::kAttributeWriteRequest)
-                {
-                    if (!IsGlobalAttribute(requestPath.entityId.value()))
-                    {
-                        return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
-                    }
-                }
-                break;
-            case Type::kCommandForbidden:
-                if (requestPath.requestType == RequestType::kCommandInvokeRequest)
-                {
-                    return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
-                }
-                break;
-            case Type::kEventForbidden:
-                if (requestPath.requestType == RequestType::kEventReadRequest)
-                {
-                    return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
-                }
-                break;
-            }
+            return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
+        }
+        break;
+    case RequestType::kCommandInvokeRequest:
+        if (restricted(Type::kCommandForbidden))
+        {
+            return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
+        }
+        break;
+    case RequestType::kEventReadRequest:
+        if (restricted(Type::kEventForbidden))
+        {
+            return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
         }
+        break;
+    default:
+        break;
     }
 
     return CHIP_NO_ERROR;
@@ -31,6 +31,8 @@
 #include <map>
 #include <memory>
 #include <protocols/interaction_model/Constants.h>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace chip {
@@ -225,6 +227,11 @@ public:
      */
     const std::vector<Entry> & GetCommissioningEntries() const { return mCommissioningEntries; }
 
+    /**
+     * Get a counter incremented whenever the commissioning or a fabric restriction list is set.
+     */
+    uint32_t GetGeneration() const { return mGeneration; }
+
     /**
      * Get the restriction entries for a fabric.
      *
@@ -259,16 +266,40 @@ protected:
 
 private:
     /**
-     * Perform the access restriction check using the given entries.
+     * The restrictions of a list that apply to one cluster on one endpoint, merged over all its entries, as bitmaps of
+     * (1 << Type).
+     */
+    struct ClusterRestrictions
+    {
+        // Restrictions without an id, which apply to every id.
+        uint8_t anyId = 0;
+        // Restrictions on a single id, sorted by id.
+        std::vector<std::pair<uint32_t, uint8_t>> byId;
+    };
+
+    /**
+     * Index of a restriction list by endpoint and cluster, rebuilt whenever the list is set, so that a check does not
+     * walk the list.
+     */
+    using RestrictionIndex = std::unordered_map<uint64_t, ClusterRestrictions>;
+
+    static uint64_t IndexKey(EndpointId endpoint, ClusterId cluster) { return (static_cast<uint64_t>(endpoint) << 32) | cluster; }
+    static void BuildIndex(const std::vector<Entry> & entries, RestrictionIndex & index);
+
+    /**
+     * Perform the access restriction check using the given index, which may be null when there is no list.
      */
-    CHIP_ERROR DoCheck(const std::vector<Entry> & entries, const SubjectDescriptor & subjectDescriptor,
+    CHIP_ERROR DoCheck(const RestrictionIndex * index, const SubjectDescriptor & subjectDescriptor,
                        const RequestPath & requestPath);
 
     uint64_t mNextToken   = 1;
+    uint32_t mGeneration  = 0;
     Listener * mListeners = nullptr;
     StandardAccessRestrictionExceptionChecker mExceptionChecker;
     std::vector<Entry> mCommissioningEntries;
     std::map<FabricIndex, std::vector<Entry>> mFabricEntries;
+    RestrictionIndex mCommissioningIndex;
+    std::map<FabricIndex, RestrictionIndex> mFabricIndexes;
 };
 
 } // namespace Access
@@ -23,6 +23,7 @@
 
 #include <lib/core/CHIPCore.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 
 namespace chip {
@@ -423,7 +424,9 @@ constexpr DeviceTypeId invalidDeviceTypes[] = {
 class DeviceTypeResolver : public AccessControl::DeviceTypeResolver
 {
 public:
-    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return deviceTypeOnEndpoint; }
+
+    bool deviceTypeOnEndpoint = false;
 } testDeviceTypeResolver;
 
 // For testing, supports one subject and target, allows any value (valid or invalid)
@@ -1085,6 +1088,7 @@ public: // protected
     void SetUp() override { ASSERT_EQ(ClearAccessControl(accessControl), CHIP_NO_ERROR); }
     static void SetUpTestSuite()
     {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
         AccessControl::Delegate * delegate = Examples::GetAccessControlDelegate();
         SetAccessControl(accessControl);
         SuccessOrDie(GetAccessControl().Init(delegate, testDeviceTypeResolver));
@@ -1093,6 +1097,7 @@ public: // protected
     {
         GetAccessControl().Finish();
         ResetAccessControlToDefault();
+        Platform::MemoryShutdown();
     }
 };
 
@@ -1761,6 +1766,107 @@ TEST_F(TestAccessControl, TestCheck)
     }
 }
 
+TEST_F(TestAccessControl, TestCheckAfterEntryChanges)
+{
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    RequestPath requestPath                   = { .cluster = kOnOffCluster, .endpoint = 1 };
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+
+    EntryData data = { .fabricIndex = 1, .privilege = Privilege::kOperate, .authMode = AuthMode::kCase };
+    data.AddSubject(nullptr, kOperationalNodeId1);
+    data.AddTarget(nullptr, { .flags = Target::kCluster, .cluster = kOnOffCluster });
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, &data, 1));
+
+    // Repeated checks must keep giving the same answer
+    for (int i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+        EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_NO_ERROR);
+        EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kManage), CHIP_ERROR_ACCESS_DENIED);
+    }
+
+    // Changing the entry must be seen by the next check
+    {
+        Entry entry;
+        EXPECT_SUCCESS(accessControl.PrepareEntry(entry));
+        EXPECT_SUCCESS(LoadEntry(entry, data));
+        EXPECT_SUCCESS(entry.SetPrivilege(Privilege::kView));
+        EXPECT_SUCCESS(accessControl.UpdateEntry(0, entry));
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_NO_ERROR);
+
+    // Entries on another fabric do not apply
+    const SubjectDescriptor otherFabric = { .fabricIndex = 2, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    EXPECT_EQ(accessControl.Check(otherFabric, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    EXPECT_SUCCESS(accessControl.DeleteEntry(0));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    // Device types on an endpoint can change without the ACL changing
+    data.targets[0] = { .flags = Target::kDeviceType, .deviceType = 0x0000'0100 };
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, &data, 1));
+
+    testDeviceTypeResolver.deviceTypeOnEndpoint = true;
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+    testDeviceTypeResolver.deviceTypeOnEndpoint = false;
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+}
+
+TEST_F(TestAccessControl, TestCheckCluster)
+{
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, entryData1, entryData1Count));
+    for (const auto & checkData : checkData1)
+    {
+        auto requestPath = checkData.requestPath;
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+        requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+        CHIP_ERROR expectedResult = accessControl.Check(checkData.subjectDescriptor, requestPath, checkData.privilege);
+
+        // Entries do not target entities: the cluster-wide result is the one of every entity
+        for (auto entityId : { std::optional<uint32_t>(), std::optional<uint32_t>(0), std::optional<uint32_t>(0xFFFD) })
+        {
+            requestPath.entityId = entityId;
+            EXPECT_EQ(accessControl.CheckCluster(checkData.subjectDescriptor, requestPath, checkData.privilege), expectedResult);
+        }
+    }
+}
+
+TEST_F(TestAccessControl, TestCheckClusterReusableAcrossGeneration)
+{
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    RequestPath requestPath                   = { .cluster = kOnOffCluster, .endpoint = 1 };
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+
+    EntryData data = { .fabricIndex = 1, .privilege = Privilege::kOperate, .authMode = AuthMode::kCase };
+    data.AddSubject(nullptr, kOperationalNodeId1);
+    data.AddTarget(nullptr, { .flags = Target::kCluster, .cluster = kOnOffCluster });
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, &data, 1));
+
+    bool reusable             = false;
+    const uint32_t generation = accessControl.GetGeneration();
+    EXPECT_EQ(accessControl.CheckCluster(subjectDescriptor, requestPath, Privilege::kOperate, reusable), CHIP_NO_ERROR);
+    EXPECT_TRUE(reusable);
+    EXPECT_EQ(accessControl.GetGeneration(), generation);
+
+    // Any change of the entries changes the generation
+    EXPECT_SUCCESS(accessControl.DeleteEntry(0));
+    EXPECT_NE(accessControl.GetGeneration(), generation);
+
+    // Results that depend on the device types of the endpoint cannot be kept
+    data.targets[0] = { .flags = Target::kDeviceType, .deviceType = 0x0000'0100 };
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, &data, 1));
+    testDeviceTypeResolver.deviceTypeOnEndpoint = true;
+    EXPECT_EQ(accessControl.CheckCluster(subjectDescriptor, requestPath, Privilege::kOperate, reusable), CHIP_NO_ERROR);
+    EXPECT_FALSE(reusable);
+    testDeviceTypeResolver.deviceTypeOnEndpoint = false;
+}
+
 TEST_F(TestAccessControl, TestCreateReadEntry)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
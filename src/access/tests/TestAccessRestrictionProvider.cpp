@@ -647,6 +647,50 @@ TEST_F(TestAccessRestriction, AttributeStorageSeperationTest)
     EXPECT_FALSE(commissioningEntriesFetched[0] == arlEntriesFetched[0]);
 }
 
+TEST_F(TestAccessRestriction, EntriesForSameClusterAreMergedTest)
+{
+    SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    RequestPath invoke1 = { .cluster     = kWiFiNetworkManagementCluster,
+                            .endpoint    = 1,
+                            .requestType = RequestType::kCommandInvokeRequest,
+                            .entityId    = 1 };
+    RequestPath invoke2 = { .cluster     = kWiFiNetworkManagementCluster,
+                            .endpoint    = 1,
+                            .requestType = RequestType::kCommandInvokeRequest,
+                            .entityId    = 2 };
+    RequestPath read3   = { .cluster     = kWiFiNetworkManagementCluster,
+                            .endpoint    = 1,
+                            .requestType = RequestType::kAttributeReadRequest,
+                            .entityId    = 3 };
+
+    // two entries for the same cluster, the second one restricting the same command for another type as well
+    std::vector<AccessRestrictionProvider::Entry> entries;
+    AccessRestrictionProvider::Entry entry;
+    entry.fabricIndex    = 1;
+    entry.endpointNumber = 1;
+    entry.clusterId      = kWiFiNetworkManagementCluster;
+    entry.restrictions.push_back({ .restrictionType = AccessRestrictionProvider::Type::kCommandForbidden });
+    entry.restrictions[0].id.SetValue(1);
+    entries.push_back(entry);
+    entry.restrictions[0].id.SetValue(2);
+    entry.restrictions.push_back({ .restrictionType = AccessRestrictionProvider::Type::kAttributeAccessForbidden });
+    entry.restrictions[1].id.SetValue(3);
+    entries.push_back(entry);
+    EXPECT_EQ(accessRestrictionProvider.SetEntries(1, entries), CHIP_NO_ERROR);
+
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, invoke1, Privilege::kAdminister), CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, invoke2, Privilege::kAdminister), CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, read3, Privilege::kAdminister), CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL);
+
+    // setting the list again replaces the previous restrictions
+    entries.pop_back();
+    EXPECT_EQ(accessRestrictionProvider.SetEntries(1, entries), CHIP_NO_ERROR);
+
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, invoke1, Privilege::kAdminister), CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, invoke2, Privilege::kAdminister), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, read3, Privilege::kAdminister), CHIP_NO_ERROR);
+}
+
 constexpr CheckData listSelectionDuringCommissioningData[] = {
     { .subjectDescriptor = { .fabricIndex     = 1,
                              .authMode        = AuthMode::kCase,
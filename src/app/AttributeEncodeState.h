@@ -31,6 +31,9 @@ namespace app {
 ///   - CurrentEncodingListIndex representing the list index that is next
 ///     to be encoded in the output. kInvalidListIndex means that a new list
 ///     encoding has been started.
+///
+/// Lists encoded with AttributeValueEncoder::EncodeResumableList also keep the
+/// cluster-defined ListResumePosition of the next item to encode.
 class AttributeEncodeState
 {
 public:
@@ -49,12 +52,14 @@ public:
         else
         {
             mCurrentEncodingListIndex = kInvalidListIndex;
+            mListResumePosition       = 0;
             mAllowPartialData         = false;
         }
     }
 
     bool AllowPartialData() const { return mAllowPartialData; }
     ListIndex CurrentEncodingListIndex() const { return mCurrentEncodingListIndex; }
+    uint32_t ListResumePosition() const { return mListResumePosition; }
 
     AttributeEncodeState & SetAllowPartialData(bool allow)
     {
@@ -68,9 +73,16 @@ public:
         return *this;
     }
 
+    AttributeEncodeState & SetListResumePosition(uint32_t position)
+    {
+        mListResumePosition = position;
+        return *this;
+    }
+
     void Reset()
     {
         mCurrentEncodingListIndex = kInvalidListIndex;
+        mListResumePosition       = 0;
         mAllowPartialData         = false;
     }
 
@@ -84,6 +96,12 @@ private:
      */
     ListIndex mCurrentEncodingListIndex = kInvalidListIndex;
 
+    /**
+     * Position, as defined by the cluster, of the next list item to encode with EncodeResumableList.  Only meaningful
+     * while mCurrentEncodingListIndex is a valid ListIndex.
+     */
+    uint32_t mListResumePosition = 0;
+
     /**
      * When an attempt to encode an attribute returns an error, the buffer may contain tailing dirty data
      * (since the put was aborted).  The report engine normally rolls back the buffer to right before encoding
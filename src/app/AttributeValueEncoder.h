@@ -134,6 +134,18 @@ public:
             return Encode(BaseEncodableValue(aArg));
         }
 
+        /**
+         * Encode a list item for EncodeResumableList. aNextPosition is the position of the item that follows aArg, where
+         * encoding continues from if the list gets chunked after aArg.
+         */
+        template <typename T>
+        CHIP_ERROR Encode(const T & aArg, uint32_t aNextPosition) const
+        {
+            ReturnErrorOnFailure(Encode(aArg));
+            mAttributeValueEncoder.mEncodeState.SetListResumePosition(aNextPosition);
+            return CHIP_NO_ERROR;
+        }
+
     private:
         AttributeValueEncoder & mAttributeValueEncoder;
         // Avoid calling the TLVWriter constructor for every instantiation of
@@ -236,6 +248,37 @@ public:
         return err;
     }
 
+    /**
+     * Resumable form of EncodeList, for long lists where enumerating again the items that were already encoded in
+     * previous chunks would be costly.
+     *
+     * aCallback is called as aCallback(aStartPosition, encoder), with encoder behaving as for EncodeList. It must encode
+     * the list items starting from aStartPosition, and encode each item with encoder.Encode(item, nextPosition), where
+     * nextPosition is the position of the following item. Positions are defined by the cluster (e.g. an index into its
+     * storage) and the first item is at position 0. When the list is chunked, the next call starts from the position
+     * following the last item that was encoded or skipped by fabric filtering, instead of from the beginning of the
+     * list.
+     *
+     * Positions must remain valid as long as the data version of the attribute does not change.
+     */
+    template <typename ListGenerator>
+    CHIP_ERROR EncodeResumableList(ListGenerator aCallback)
+    {
+        mTriedEncode = true;
+        ReturnErrorOnFailure(EnsureListStarted());
+
+        // The items before the resume position are not enumerated again, so there are no items to skip.
+        mCurrentEncodingListIndex = mEncodeState.CurrentEncodingListIndex();
+        CHIP_ERROR err            = aCallback(mEncodeState.ListResumePosition(), ListEncodeHelper(*this));
+
+        EnsureListEnded();
+        if (err == CHIP_NO_ERROR)
+        {
+            mEncodeState.Reset();
+        }
+        return err;
+    }
+
     bool TriedEncode() const { return mTriedEncode; }
 
     const Access::SubjectDescriptor & GetSubjectDescriptor() const { return mSubjectDescriptor; }
@@ -24,11 +24,20 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app/BufferedReadCallback.h>
 #include <app/InteractionModelEngine.h>
-#include <lib/support/ScopedBuffer.h>
 
 namespace chip {
 namespace app {
 
+namespace {
+
+// Control octet starting the anonymous TLV array the buffered list items are delivered in.
+constexpr uint8_t kListStart =
+    static_cast<uint8_t>(TLV::TLVTagControl::Anonymous) | static_cast<uint8_t>(TLV::TLVElementType::Array);
+// Control octet ending that array.
+constexpr uint8_t kListEnd = static_cast<uint8_t>(TLV::TLVElementType::EndOfContainer);
+
+} // namespace
+
 void BufferedReadCallback::OnReportBegin()
 {
     mCallback.OnReportBegin();
@@ -46,94 +55,45 @@ void BufferedReadCallback::OnReportEnd()
     mCallback.OnReportEnd();
 }
 
-CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aReader)
-{
-    TLV::TLVType outerType;
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
-
-    //
-    // To generate the final reconstituted list, we need to allocate a contiguous
-    // buffer than can hold the entirety of its contents. To do so, we need to figure out
-    // how big a buffer to allocate. This requires walking the buffered list items and computing their TLV sizes,
-    // summing them all up and adding a bit of slop to account for the TLV array the list elements will go into.
-    //
-    // The alternative was to use a PacketBufferTLVWriter backed by chained packet buffers to
-    // write out the list - this would have removed the need for this first pass. However,
-    // we cannot actually back a TLVReader with a chained buffer since that violates the ability
-    // for us to create readers off-of readers. Each reader would assume exclusive ownership of the chained
-    // buffer and mutate the state within TLVPacketBufferBackingStore, preventing shared use.
-    //
-    // To avoid that, a single contiguous buffer is the best likely approach for now.
-    //
-    size_t totalBufSize = 0;
-    for (const auto & packetBuffer : mBufferedList)
-    {
-        totalBufSize += packetBuffer->TotalLength();
-    }
-
-    //
-    // Size of the start container and end container are just 1 byte each, but, let's just be safe.
-    //
-    totalBufSize += 4;
-
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
-    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerType));
-
-    for (auto & bufHandle : mBufferedList)
-    {
-        System::PacketBufferTLVReader reader;
-
-        reader.Init(std::move(bufHandle));
-
-        ReturnErrorOnFailure(reader.Next());
-        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    }
-
-    ReturnErrorOnFailure(writer.EndContainer(outerType));
-
-    TEMPORARY_RETURN_IGNORED writer.Finalize(backingBuffer);
-
-    aReader.Init(std::move(backingBuffer), totalBufSize);
-
-    return CHIP_NO_ERROR;
-}
-
 CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
 {
-    System::PacketBufferTLVWriter writer;
-    System::PacketBufferHandle handle;
-
     //
-    // We conservatively allocate a packet buffer as big as an IPv6 MTU (since we're buffering
-    // data received over the wire, which should always fit within that).
+    // The list items are encoded one after the other right into mBufferedList, behind the start of the TLV array they will be
+    // delivered in. Dispatching the list then only needs to close the array, instead of allocating a second buffer as big as
+    // the whole list and re-encoding every item into it.
+    //
+    // We conservatively reserve as much space as an IPv6 MTU for the item (since we're buffering data received over the wire,
+    // which should always fit within that), and give back what it did not use.
     //
     // We could have snapshotted the reader at its current position, advanced it past the current element
-    // and computed the delta in its read point to figure out the size of the element before allocating
-    // our target buffer. However, the reader's current position is already set past the control octet
+    // and computed the delta in its read point to figure out the size of the element before reserving
+    // that space. However, the reader's current position is already set past the control octet
     // and the tag. Consequently, the computed size is always going to omit the sizes of these two parts of the
     // TLV element. Since the tag can vary in size, for now, let's just do the safe thing. In the future, if this is a problem,
     // we can improve this.
     //
     const size_t bufSize = mAllowLargePayload ? chip::app::kMaxLargeSecureSduLengthBytes : chip::app::kMaxSecureSduLengthBytes;
-    handle               = System::PacketBufferHandle::New(bufSize);
-    VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
 
-    writer.Init(std::move(handle), false);
+    if (mBufferedList.empty())
+    {
+        mBufferedList.push_back(kListStart);
+    }
 
-    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    ReturnErrorOnFailure(writer.Finalize(&handle));
+    const size_t offset = mBufferedList.size();
+    mBufferedList.resize(offset + bufSize);
 
-    // Compact the buffer down to a more reasonably sized packet buffer
-    // if we can.
-    //
-    handle.RightSize();
+    TLV::TLVWriter writer;
+    writer.Init(mBufferedList.data() + offset, bufSize);
+    CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), reader);
+    mBufferedList.resize(offset + ((err == CHIP_NO_ERROR) ? writer.GetLengthWritten() : 0));
 
-    mBufferedList.push_back(std::move(handle));
+    return err;
+}
 
-    return CHIP_NO_ERROR;
+void BufferedReadCallback::ClearBufferedList()
+{
+    // Release the memory of the list rather than keeping it around until the next one.
+    std::vector<uint8_t>().swap(mBufferedList);
 }
 
 CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData)
@@ -144,7 +104,7 @@ CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aP
         TLV::TLVType outerContainer;
 
         VerifyOrReturnError(apData->GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
-        mBufferedList.clear();
+        ClearBufferedList();
 
         ReturnErrorOnFailure(apData->EnterContainer(outerContainer));
 
@@ -203,9 +163,17 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     }
 
     StatusIB statusIB;
-    TLV::ScopedBufferTLVReader reader;
+    TLV::TLVReader reader;
 
-    ReturnErrorOnFailure(GenerateListTLV(reader));
+    //
+    // Close the TLV array the list items were buffered in.
+    //
+    if (mBufferedList.empty())
+    {
+        mBufferedList.push_back(kListStart);
+    }
+    mBufferedList.push_back(kListEnd);
+    reader.Init(mBufferedList.data(), mBufferedList.size());
 
     //
     // Update the list operation to now reflect the delivery of the entire list
@@ -223,7 +191,7 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     //
     // Clear out our buffered contents to free up allocated buffers, and reset the buffered path.
     //
-    mBufferedList.clear();
+    ClearBufferedList();
     mBufferedPath = ConcreteDataAttributePath();
     return CHIP_NO_ERROR;
 }
@@ -45,11 +45,6 @@ public:
     {}
 
 private:
-    /*
-     * Generates the reconsistuted TLV array from the stored individual list elements
-     */
-    CHIP_ERROR GenerateListTLV(TLV::ScopedBufferTLVReader & reader);
-
     /*
      * Dispatch any buffered list data if we need to. Buffered data will only be dispatched if:
      *  1. The path provided in aPath is different from the buffered path being tracked internally AND the type of data
@@ -75,7 +70,7 @@ private:
     void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
     void OnError(CHIP_ERROR aError) override
     {
-        mBufferedList.clear();
+        ClearBufferedList();
         return mCallback.OnError(aError);
     }
 
@@ -123,15 +118,18 @@ private:
     }
 
     /*
-     * Given a reader positioned at a list element, allocate a packet buffer, copy the list item where
-     * the reader is positioned into that buffer and add it to our buffered list for tracking.
+     * Given a reader positioned at a list element, copy the list item where the reader is positioned
+     * to the end of our buffered list.
      *
      * This should be called in list index order starting from the lowest index that needs to be buffered.
      *
      */
     CHIP_ERROR BufferListItem(TLV::TLVReader & reader);
+    void ClearBufferedList();
+
     ConcreteDataAttributePath mBufferedPath;
-    std::vector<System::PacketBufferHandle> mBufferedList;
+    // The buffered list items as contiguous TLV, following the start of the array they are delivered in.
+    std::vector<uint8_t> mBufferedList;
     bool mAllowLargePayload = false;
     Callback & mCallback;
 };
@@ -21,16 +21,54 @@
 
 namespace chip {
 
+CASESessionManager::CASESessionManager()
+{
+#if CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+    for (auto & warmSession : mWarmSessions)
+    {
+        warmSession.mOnConnected.mContext = this;
+        warmSession.mOnFailure.mContext   = this;
+    }
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+}
+
 CHIP_ERROR CASESessionManager::Init(chip::System::Layer * systemLayer, const CASESessionManagerConfig & params)
 {
     ReturnErrorOnFailure(params.sessionInitParams.Validate());
     mConfig = params;
     params.sessionInitParams.exchangeMgr->GetReliableMessageMgr()->RegisterSessionUpdateDelegate(this);
-    return AddressResolve::Resolver::Instance().Init(systemLayer);
+    ReturnErrorOnFailure(AddressResolve::Resolver::Instance().Init(systemLayer));
+
+#if CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+    mSystemLayer = systemLayer;
+    ScheduleWarmSessionRefresh();
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+
+    return CHIP_NO_ERROR;
 }
 
 void CASESessionManager::Shutdown()
 {
+#if CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(OnWarmSessionRefreshTimer, this);
+        mSystemLayer = nullptr;
+    }
+
+    for (auto & warmSession : mWarmSessions)
+    {
+        ReleaseWarmSession(warmSession);
+    }
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES && CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT > 0
+    for (auto & backoff : mPeerBackoffs)
+    {
+        backoff = PeerBackoff();
+    }
+#endif
+
     AddressResolve::Resolver::Instance().Shutdown();
 }
 
@@ -99,8 +137,33 @@ void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerI
     ChipLogDetail(CASESessionManager, "FindOrEstablishSession: PeerId = [%d:" ChipLogFormatX64 "]", peerId.GetFabricIndex(),
                   ChipLogValueX64(peerId.GetNodeId()));
 
+    bool countRequest = true;
+#if CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+    countRequest = !mRefreshingWarmSessions;
+    if (countRequest)
+    {
+        MarkRecentlyUsed(peerId);
+    }
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+
+    if (countRequest)
+    {
+        if (FindExistingSession(peerId, transportPayloadCapability).HasValue())
+        {
+            mSessionStats.mWarmRequests++;
+        }
+        else
+        {
+            mSessionStats.mColdRequests++;
+        }
+    }
+
     bool forAddressUpdate             = false;
     OperationalSessionSetup * session = FindExistingSessionSetup(peerId, forAddressUpdate);
+    if (session != nullptr && countRequest && !session->EstablishedNewSession())
+    {
+        mSessionStats.mJoinedSetups++;
+    }
     if (session == nullptr)
     {
         ChipLogDetail(CASESessionManager, "FindOrEstablishSession: No existing OperationalSessionSetup instance found");
@@ -121,6 +184,10 @@ void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerI
             }
             return;
         }
+
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES && CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT > 0
+        ResumePeerBackoff(*session);
+#endif
     }
 
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
@@ -144,7 +211,51 @@ void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerI
 
 void CASESessionManager::ReleaseSessionsForFabric(FabricIndex fabricIndex)
 {
+#if CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+    for (auto & warmSession : mWarmSessions)
+    {
+        if (warmSession.IsInUse() && warmSession.mPeerId.GetFabricIndex() == fabricIndex)
+        {
+            ReleaseWarmSession(warmSession);
+        }
+    }
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+
     mConfig.sessionSetupPool->ReleaseAllSessionSetupsForFabric(fabricIndex);
+
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES && CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT > 0
+    for (auto & backoff : mPeerBackoffs)
+    {
+        if (backoff.IsInUse() && backoff.mPeerId.GetFabricIndex() == fabricIndex)
+        {
+            backoff = PeerBackoff();
+        }
+    }
+#endif
+}
+
+TransportPayloadCapability CASESessionManager::TransportPayloadCapabilityFor(size_t expectedResponseSize)
+{
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    if (expectedResponseSize > kMaxAppMessageLen)
+    {
+        return TransportPayloadCapability::kLargePayloadIfSupported;
+    }
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+    return TransportPayloadCapability::kMRPPayload;
+}
+
+TransportPayloadCapability CASESessionManager::TransportPayloadCapabilityForRead(Span<const app::AttributePathParams> paths,
+                                                                                 size_t expectedResponseSize)
+{
+    for (const auto & path : paths)
+    {
+        if (path.HasWildcardEndpointId() && path.HasWildcardClusterId() && path.HasWildcardAttributeId())
+        {
+            return TransportPayloadCapabilityFor(SIZE_MAX);
+        }
+    }
+    return TransportPayloadCapabilityFor(expectedResponseSize);
 }
 
 void CASESessionManager::ReleaseAllSessions()
@@ -209,8 +320,242 @@ void CASESessionManager::ReleaseSession(OperationalSessionSetup * session)
 {
     if (session != nullptr)
     {
+        if (session->EstablishedNewSession())
+        {
+            mSessionStats.mColdSetups++;
+            mSessionStats.mColdSetupTime += System::SystemClock().GetMonotonicTimestamp() - session->GetCreationTime();
+        }
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES && CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT > 0
+        RecordSessionSetupOutcome(*session);
+#endif
         mConfig.sessionSetupPool->Release(session);
     }
 }
 
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES && CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT > 0
+namespace {
+// After the longest retry delay has passed since a failure, a new session setup starts the backoff over.
+constexpr System::Clock::Seconds32 kPeerBackoffLifetime(CHIP_DEVICE_CONFIG_AUTOMATIC_CASE_RETRY_INITIAL_DELAY_SECONDS
+                                                        << CHIP_DEVICE_CONFIG_AUTOMATIC_CASE_RETRY_MAX_BACKOFF);
+} // namespace
+
+CASESessionManager::PeerBackoff * CASESessionManager::FindPeerBackoff(const ScopedNodeId & peerId, System::Clock::Timestamp now)
+{
+    for (auto & backoff : mPeerBackoffs)
+    {
+        if (backoff.IsInUse() && now - backoff.mFailureTime >= kPeerBackoffLifetime)
+        {
+            backoff = PeerBackoff();
+        }
+        if (backoff.IsInUse() && backoff.mPeerId == peerId)
+        {
+            return &backoff;
+        }
+    }
+    return nullptr;
+}
+
+void CASESessionManager::RecordSessionSetupOutcome(const OperationalSessionSetup & session)
+{
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    PeerBackoff * backoff              = FindPeerBackoff(session.GetPeerId(), now);
+
+    if (session.EstablishedNewSession() || session.GetAttemptsDone() == 0)
+    {
+        // Succeeded, or did not even try: the next session setup starts from the initial delay.
+        if (backoff != nullptr)
+        {
+            *backoff = PeerBackoff();
+        }
+        return;
+    }
+
+    if (backoff == nullptr)
+    {
+        // Take a free slot, or else the one of the oldest failure.
+        backoff = &mPeerBackoffs[0];
+        for (auto & entry : mPeerBackoffs)
+        {
+            if (!entry.IsInUse())
+            {
+                backoff = &entry;
+                break;
+            }
+            if (entry.mFailureTime < backoff->mFailureTime)
+            {
+                backoff = &entry;
+            }
+        }
+    }
+
+    backoff->mPeerId       = session.GetPeerId();
+    backoff->mAttemptsDone = session.GetAttemptsDone();
+    backoff->mFailureTime  = now;
+}
+
+void CASESessionManager::ResumePeerBackoff(OperationalSessionSetup & session)
+{
+    PeerBackoff * backoff = FindPeerBackoff(session.GetPeerId(), System::SystemClock().GetMonotonicTimestamp());
+    VerifyOrReturn(backoff != nullptr);
+
+    // The first attempt is still made right away, only its retries are delayed further.
+    session.SetPreviousAttempts(backoff->mAttemptsDone);
+    mSessionStats.mResumedBackoffs++;
+    ChipLogDetail(CASESessionManager, "Resuming CASE retry backoff with PeerId = [%d:" ChipLogFormatX64 "] after %u attempts",
+                  session.GetPeerId().GetFabricIndex(), ChipLogValueX64(session.GetPeerId().GetNodeId()),
+                  static_cast<unsigned>(backoff->mAttemptsDone));
+}
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES && CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT > 0
+
+#if CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+CHIP_ERROR CASESessionManager::AddWarmPeer(const ScopedNodeId & peerId)
+{
+    VerifyOrReturnError(peerId.IsOperational(), CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(mConfig.sessionInitParams.Validate());
+
+    WarmSession * warmSession = FindWarmSession(peerId);
+    if (warmSession == nullptr)
+    {
+        warmSession = AllocateWarmSession(peerId);
+        VerifyOrReturnError(warmSession != nullptr, CHIP_ERROR_NO_MEMORY);
+    }
+
+    warmSession->mPinned = true;
+    RefreshWarmSession(*warmSession);
+    return CHIP_NO_ERROR;
+}
+
+void CASESessionManager::RemoveWarmPeer(const ScopedNodeId & peerId)
+{
+    WarmSession * warmSession = FindWarmSession(peerId);
+    if (warmSession != nullptr)
+    {
+        ReleaseWarmSession(*warmSession);
+    }
+}
+
+bool CASESessionManager::IsWarmPeer(const ScopedNodeId & peerId) const
+{
+    return FindWarmSession(peerId) != nullptr;
+}
+
+CASESessionManager::WarmSession * CASESessionManager::FindWarmSession(const ScopedNodeId & peerId)
+{
+    for (auto & warmSession : mWarmSessions)
+    {
+        if (warmSession.IsInUse() && warmSession.mPeerId == peerId)
+        {
+            return &warmSession;
+        }
+    }
+    return nullptr;
+}
+
+const CASESessionManager::WarmSession * CASESessionManager::FindWarmSession(const ScopedNodeId & peerId) const
+{
+    return const_cast<CASESessionManager *>(this)->FindWarmSession(peerId);
+}
+
+void CASESessionManager::MarkRecentlyUsed(const ScopedNodeId & peerId)
+{
+    WarmSession * warmSession = FindWarmSession(peerId);
+    if (warmSession != nullptr)
+    {
+        warmSession->mLastUsed = System::SystemClock().GetMonotonicTimestamp();
+    }
+    else if (mConfig.keepRecentPeersWarm && peerId.IsOperational())
+    {
+        // The request being made establishes the session if needed.
+        AllocateWarmSession(peerId);
+    }
+}
+
+CASESessionManager::WarmSession * CASESessionManager::AllocateWarmSession(const ScopedNodeId & peerId)
+{
+    // Take a free slot, or the one of the least recently used peer that was
+    // not added explicitly.
+    WarmSession * warmSession = nullptr;
+    for (auto & candidate : mWarmSessions)
+    {
+        if (candidate.mPinned)
+        {
+            continue;
+        }
+        if (!candidate.IsInUse())
+        {
+            warmSession = &candidate;
+            break;
+        }
+        if (warmSession == nullptr || candidate.mLastUsed < warmSession->mLastUsed)
+        {
+            warmSession = &candidate;
+        }
+    }
+    VerifyOrReturnValue(warmSession != nullptr, nullptr);
+
+    ReleaseWarmSession(*warmSession);
+    warmSession->mPeerId   = peerId;
+    warmSession->mLastUsed = System::SystemClock().GetMonotonicTimestamp();
+    return warmSession;
+}
+
+void CASESessionManager::ReleaseWarmSession(WarmSession & warmSession)
+{
+    // Cancels both callbacks, which are registered as a group.
+    warmSession.mOnConnected.Cancel();
+    warmSession.mPeerId = ScopedNodeId();
+    warmSession.mPinned = false;
+}
+
+void CASESessionManager::RefreshWarmSession(WarmSession & warmSession)
+{
+    VerifyOrReturn(warmSession.IsInUse() && !warmSession.mOnConnected.IsRegistered());
+    VerifyOrReturn(!FindExistingSession(warmSession.mPeerId).HasValue());
+
+    ChipLogProgress(CASESessionManager, "Establishing warm session with [%u:" ChipLogFormatX64 "]",
+                    warmSession.mPeerId.GetFabricIndex(), ChipLogValueX64(warmSession.mPeerId.GetNodeId()));
+
+    mSessionStats.mRefreshes++;
+    mRefreshingWarmSessions = true;
+    FindOrEstablishSessionHelper(warmSession.mPeerId, &warmSession.mOnConnected, &warmSession.mOnFailure, nullptr,
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+                                 1 /* attemptCount */, nullptr /* onRetry */,
+#endif
+                                 TransportPayloadCapability::kMRPPayload);
+    mRefreshingWarmSessions = false;
+}
+
+void CASESessionManager::ScheduleWarmSessionRefresh()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+    CHIP_ERROR err = mSystemLayer->StartTimer(System::Clock::Milliseconds32(CHIP_CONFIG_CASE_WARM_SESSION_REFRESH_INTERVAL_MS),
+                                              OnWarmSessionRefreshTimer, this);
+    LogErrorOnFailure(err);
+}
+
+void CASESessionManager::OnWarmSessionRefreshTimer(System::Layer * systemLayer, void * context)
+{
+    auto * self = static_cast<CASESessionManager *>(context);
+    for (auto & warmSession : self->mWarmSessions)
+    {
+        self->RefreshWarmSession(warmSession);
+    }
+    self->ScheduleWarmSessionRefresh();
+}
+
+void CASESessionManager::OnWarmSessionConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                                const SessionHandle & sessionHandle)
+{
+    ChipLogDetail(CASESessionManager, "Warm session established with [%u:" ChipLogFormatX64 "]",
+                  sessionHandle->GetFabricIndex(), ChipLogValueX64(sessionHandle->GetPeer().GetNodeId()));
+}
+
+void CASESessionManager::OnWarmSessionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+{
+    // Tried again at the next refresh.
+    ChipLogError(CASESessionManager, "Failed to establish warm session with [%u:" ChipLogFormatX64 "]: %" CHIP_ERROR_FORMAT,
+                 peerId.GetFabricIndex(), ChipLogValueX64(peerId.GetNodeId()), error.Format());
+}
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+
 } // namespace chip
@@ -18,12 +18,14 @@
 
 #pragma once
 
+#include <app/AttributePathParams.h>
 #include <app/CASEClientPool.h>
 #include <app/OperationalSessionSetup.h>
 #include <app/OperationalSessionSetupPool.h>
 #include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/Pool.h>
+#include <lib/support/Span.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <transport/SessionDelegate.h>
 #include <transport/SessionManager.h>
@@ -36,6 +38,10 @@ struct CASESessionManagerConfig
     CASEClientInitParams sessionInitParams;
     CASEClientPoolDelegate * clientPool                    = nullptr;
     OperationalSessionSetupPoolDelegate * sessionSetupPool = nullptr;
+
+    // Whether the peers with the most recent FindOrEstablishSession calls get
+    // the warm session slots not used by CASESessionManager::AddWarmPeer.
+    bool keepRecentPeersWarm = false;
 };
 
 /**
@@ -45,11 +51,26 @@ struct CASESessionManagerConfig
  * 3. API to lookup an existing proxy object, or allocate a new one by triggering session establishment with the peer node.
  * 4. During session establishment, trigger node ID resolution (if needed), and update the DNS-SD cache (if resolution is
  * successful)
+ * 5. Keep sessions with up to CHIP_CONFIG_CASE_WARM_SESSION_COUNT "warm" peers established, so that requests to them do
+ * not wait for a CASE handshake. Warm sessions that get evicted are re-established every
+ * CHIP_CONFIG_CASE_WARM_SESSION_REFRESH_INTERVAL_MS.
  */
 class CASESessionManager : public OperationalSessionReleaseDelegate, public SessionUpdateDelegate
 {
 public:
-    CASESessionManager() = default;
+    struct SessionStats
+    {
+        uint32_t mWarmRequests    = 0; ///< Requests answered with an existing session
+        uint32_t mColdRequests    = 0; ///< Requests that needed a CASE handshake
+        uint32_t mColdSetups      = 0; ///< CASE handshakes completed
+        uint32_t mRefreshes       = 0; ///< CASE handshakes started to re-establish the session of a warm peer
+        uint32_t mJoinedSetups    = 0; ///< Cold requests that joined a session setup already in progress with the peer
+        uint32_t mResumedBackoffs = 0; ///< Session setups that continued the retry backoff of an earlier failed one
+
+        System::Clock::Milliseconds64 mColdSetupTime{ 0 }; ///< Total time taken by the mColdSetups handshakes
+    };
+
+    CASESessionManager();
     virtual ~CASESessionManager()
     {
         if (mConfig.sessionInitParams.Validate() == CHIP_NO_ERROR)
@@ -167,11 +188,42 @@ public:
                                 Callback::Callback<OnDeviceConnectionFailure> * onFailure,
                                 TransportPayloadCapability transportPayloadCapability);
 
+    /**
+     * Returns the transport payload capability to pass to FindOrEstablishSession for an interaction whose response is
+     * expected to be about expectedResponseSize bytes.  A response that does not fit in a single IPv6 packet would have to
+     * be chunked over MRP, so a large payload transport is preferred for it when the peer supports one.
+     */
+    static TransportPayloadCapability TransportPayloadCapabilityFor(size_t expectedResponseSize);
+
+    /**
+     * Same as TransportPayloadCapabilityFor, for a read or subscription of the given attribute paths.  A path that is a
+     * wildcard for the endpoint, cluster and attribute reads the whole data model of the peer, and prefers a large payload
+     * transport whatever expectedResponseSize is.
+     */
+    static TransportPayloadCapability TransportPayloadCapabilityForRead(Span<const app::AttributePathParams> paths,
+                                                                        size_t expectedResponseSize = 0);
+
     void ReleaseSession(const ScopedNodeId & peerId);
     void ReleaseSessionsForFabric(FabricIndex fabricIndex);
 
     void ReleaseAllSessions();
 
+#if CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+    /**
+     * Keep a session with the given peer established until RemoveWarmPeer is
+     * called. Establishes the session right away if there is none.
+     *
+     * Returns CHIP_ERROR_NO_MEMORY if CHIP_CONFIG_CASE_WARM_SESSION_COUNT peers
+     * are already added.
+     */
+    CHIP_ERROR AddWarmPeer(const ScopedNodeId & peerId);
+    void RemoveWarmPeer(const ScopedNodeId & peerId);
+    bool IsWarmPeer(const ScopedNodeId & peerId) const;
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+
+    const SessionStats & GetSessionStats() const { return mSessionStats; }
+    void ResetSessionStats() { mSessionStats = SessionStats(); }
+
     /**
      * This API returns the address for the given node ID.
      * If the CASESessionManager is configured with a DNS-SD cache, the cache is looked up
@@ -204,6 +256,55 @@ private:
 #endif
                                       TransportPayloadCapability transportPayloadCapability);
 
+#if CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+    struct WarmSession
+    {
+        ScopedNodeId mPeerId; // not operational if the slot is unused
+        bool mPinned = false; // added with AddWarmPeer, as opposed to recently used
+        System::Clock::Timestamp mLastUsed;
+
+        // Registered while the session is being (re-)established.
+        Callback::Callback<OnDeviceConnected> mOnConnected{ OnWarmSessionConnected, nullptr };
+        Callback::Callback<OnDeviceConnectionFailure> mOnFailure{ OnWarmSessionFailure, nullptr };
+
+        bool IsInUse() const { return mPeerId.IsOperational(); }
+    };
+
+    WarmSession * FindWarmSession(const ScopedNodeId & peerId);
+    const WarmSession * FindWarmSession(const ScopedNodeId & peerId) const;
+    void MarkRecentlyUsed(const ScopedNodeId & peerId);
+    WarmSession * AllocateWarmSession(const ScopedNodeId & peerId);
+    void ReleaseWarmSession(WarmSession & warmSession);
+    void RefreshWarmSession(WarmSession & warmSession);
+    void ScheduleWarmSessionRefresh();
+    static void OnWarmSessionRefreshTimer(System::Layer * systemLayer, void * context);
+    static void OnWarmSessionConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                       const SessionHandle & sessionHandle);
+    static void OnWarmSessionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error);
+
+    WarmSession mWarmSessions[CHIP_CONFIG_CASE_WARM_SESSION_COUNT];
+    System::Layer * mSystemLayer = nullptr;
+    bool mRefreshingWarmSessions = false; // requests made by RefreshWarmSession are not counted in mSessionStats
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_COUNT > 0
+
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES && CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT > 0
+    struct PeerBackoff
+    {
+        ScopedNodeId mPeerId; // not operational if the slot is unused
+        uint8_t mAttemptsDone = 0;
+        System::Clock::Timestamp mFailureTime;
+
+        bool IsInUse() const { return mPeerId.IsOperational(); }
+    };
+
+    PeerBackoff * FindPeerBackoff(const ScopedNodeId & peerId, System::Clock::Timestamp now);
+    void RecordSessionSetupOutcome(const OperationalSessionSetup & session);
+    void ResumePeerBackoff(OperationalSessionSetup & session);
+
+    PeerBackoff mPeerBackoffs[CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT];
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES && CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT > 0
+
+    SessionStats mSessionStats;
     CASESessionManagerConfig mConfig;
 };
 
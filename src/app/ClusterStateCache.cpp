@@ -19,6 +19,8 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
+#include <lib/support/MemoryTags.h>
+#include <string.h>
 #include <tuple>
 
 namespace chip {
@@ -47,6 +49,33 @@ uint32_t SizeOfStatusIB(const StatusIB & aStatus)
     return size;
 }
 
+//
+// Snapshot layout:
+//
+//   { version, highest event number (optional),
+//     endpoints: [ { id, clusters: [ { id, committed data version (optional),
+//                                      attributes: [ { id, data | status (+ cluster status) | size } ] } ] } ] }
+//
+// Unknown tags are skipped, so fields may be added without bumping the version.
+//
+constexpr uint8_t kSnapshotVersion = 1;
+
+constexpr TLV::Tag kSnapshotVersionTag            = TLV::ContextTag(0);
+constexpr TLV::Tag kSnapshotHighestEventNumberTag = TLV::ContextTag(1);
+constexpr TLV::Tag kSnapshotEndpointsTag          = TLV::ContextTag(2);
+
+constexpr TLV::Tag kSnapshotIdTag       = TLV::ContextTag(0); // endpoint, cluster and attribute id
+constexpr TLV::Tag kSnapshotChildrenTag = TLV::ContextTag(1); // clusters of an endpoint, attributes of a cluster
+
+// Cluster fields
+constexpr TLV::Tag kSnapshotDataVersionTag = TLV::ContextTag(2);
+
+// Attribute fields
+constexpr TLV::Tag kSnapshotDataTag          = TLV::ContextTag(2);
+constexpr TLV::Tag kSnapshotStatusTag        = TLV::ContextTag(3);
+constexpr TLV::Tag kSnapshotClusterStatusTag = TLV::ContextTag(4);
+constexpr TLV::Tag kSnapshotSizeTag          = TLV::ContextTag(5);
+
 } // anonymous namespace
 
 template <bool CanEnableDataCaching>
@@ -65,6 +94,67 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVR
     return CHIP_NO_ERROR;
 }
 
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::SetDataState(TLV::TLVReader & aData, AttributeState & aState)
+{
+    uint32_t elementSize = 0;
+    ReturnErrorOnFailure(GetElementTLVSize(&aData, elementSize));
+
+    if constexpr (CanEnableDataCaching)
+    {
+        if (mCacheData)
+        {
+#if CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA
+            AttributeData backingBuffer;
+            ReturnErrorOnFailure(mAttributeDataArena.Allocate(elementSize, backingBuffer));
+            TLV::TLVWriter writer;
+            writer.Init(backingBuffer.Get(), elementSize);
+            ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), aData));
+            ReturnErrorOnFailure(writer.Finalize());
+#else
+            Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
+            backingBuffer.Calloc(elementSize);
+            VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+            TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
+            ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), aData));
+            ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+#endif
+
+            aState.template Set<AttributeData>(std::move(backingBuffer));
+        }
+        else
+        {
+            aState.template Set<uint32_t>(elementSize);
+        }
+    }
+    else
+    {
+        aState = elementSize;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::SetStatusState(const StatusIB & aStatus, AttributeState & aState)
+{
+    if constexpr (CanEnableDataCaching)
+    {
+        if (mCacheData)
+        {
+            aState.template Set<StatusIB>(aStatus);
+        }
+        else
+        {
+            aState.template Set<uint32_t>(SizeOfStatusIB(aStatus));
+        }
+    }
+    else
+    {
+        aState = SizeOfStatusIB(aStatus);
+    }
+}
+
 template <bool CanEnableDataCaching>
 CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
                                                                  const StatusIB & aStatus)
@@ -84,31 +174,7 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
 
     if (apData)
     {
-        uint32_t elementSize = 0;
-        ReturnErrorOnFailure(GetElementTLVSize(apData, elementSize));
-
-        if constexpr (CanEnableDataCaching)
-        {
-            if (mCacheData)
-            {
-                Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-                backingBuffer.Calloc(elementSize);
-                VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-                TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
-                ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
-                ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-
-                state.template Set<AttributeData>(std::move(backingBuffer));
-            }
-            else
-            {
-                state.template Set<uint32_t>(elementSize);
-            }
-        }
-        else
-        {
-            state = elementSize;
-        }
+        ReturnErrorOnFailure(SetDataState(*apData, state));
 
         //
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
@@ -142,21 +208,7 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
     }
     else
     {
-        if constexpr (CanEnableDataCaching)
-        {
-            if (mCacheData)
-            {
-                state.template Set<StatusIB>(aStatus);
-            }
-            else
-            {
-                state.template Set<uint32_t>(SizeOfStatusIB(aStatus));
-            }
-        }
-        else
-        {
-            state = SizeOfStatusIB(aStatus);
-        }
+        SetStatusState(aStatus, state);
     }
 
     //
@@ -168,7 +220,14 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
+    auto & cachedState = mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId];
+    if (mSuppressUnchangedAttributeNotifications && mCacheData && IsSameAttributeState(cachedState, state))
+    {
+        // Keep what we have; nothing to tell our callback about.
+        return CHIP_NO_ERROR;
+    }
+
+    cachedState = std::move(state);
 
     if (mCacheData)
     {
@@ -178,6 +237,29 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
     return CHIP_NO_ERROR;
 }
 
+template <bool CanEnableDataCaching>
+bool ClusterStateCacheT<CanEnableDataCaching>::IsSameAttributeState(const AttributeState & lhs, const AttributeState & rhs)
+{
+    if constexpr (CanEnableDataCaching)
+    {
+        if (lhs.template Is<StatusIB>() && rhs.template Is<StatusIB>())
+        {
+            return lhs.template Get<StatusIB>() == rhs.template Get<StatusIB>();
+        }
+
+        if (lhs.template Is<AttributeData>() && rhs.template Is<AttributeData>())
+        {
+            const auto & lhsData = lhs.template Get<AttributeData>();
+            const auto & rhsData = rhs.template Get<AttributeData>();
+            return lhsData.AllocatedSize() == rhsData.AllocatedSize() &&
+                memcmp(lhsData.Get(), rhsData.Get(), lhsData.AllocatedSize()) == 0;
+        }
+    }
+
+    // Sizes alone say nothing about whether the value changed.
+    return false;
+}
+
 template <bool CanEnableDataCaching>
 CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const EventHeader & aEventHeader, TLV::TLVReader * apData,
                                                                       const StatusIB * apStatus)
@@ -230,12 +312,44 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
 {
+#if CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA
+    CompactAttributeData();
+#endif
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     mChangedAttributeSet.clear();
     mAddedEndpoints.clear();
     mCallback.OnReportBegin();
 }
 
+#if CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::CompactAttributeData()
+{
+    if constexpr (CanEnableDataCaching)
+    {
+        VerifyOrReturn(mAttributeDataArena.ShouldCompact());
+        // Not being able to compact only costs memory; keep using the current blocks.
+        VerifyOrReturn(mAttributeDataArena.BeginCompaction() == CHIP_NO_ERROR);
+
+        for (auto & endpointIter : mCache)
+        {
+            for (auto & clusterIter : endpointIter.second)
+            {
+                for (auto & attributeIter : clusterIter.second.mAttributes)
+                {
+                    if (attributeIter.second.template Is<AttributeData>())
+                    {
+                        mAttributeDataArena.Relocate(attributeIter.second.template Get<AttributeData>());
+                    }
+                }
+            }
+        }
+
+        mAttributeDataArena.EndCompaction();
+    }
+}
+#endif
+
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
 {
@@ -426,7 +540,10 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDat
         dataSnapshot.Init(*apData);
     }
 
-    TEMPORARY_RETURN_IGNORED UpdateCache(aPath, apData, aStatus);
+    {
+        Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kCache);
+        TEMPORARY_RETURN_IGNORED UpdateCache(aPath, apData, aStatus);
+    }
 
     //
     // Forward the call through.
@@ -458,7 +575,10 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & a
         dataSnapshot.Init(*apData);
     }
 
-    TEMPORARY_RETURN_IGNORED UpdateEventCache(aEventHeader, apData, apStatus);
+    {
+        Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kCache);
+        TEMPORARY_RETURN_IGNORED UpdateEventCache(aEventHeader, apData, apStatus);
+    }
     mCallback.OnEventData(aEventHeader, apData ? &dataSnapshot : nullptr, apStatus);
 }
 
@@ -606,11 +726,16 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterLi
     std::vector<std::pair<DataVersionFilter, size_t>> filterVector;
     GetSortedFilters(filterVector);
 
+    // Greedy packing: the filters come by decreasing amount of data they can save, and one that does not fit in the
+    // request does not keep the smaller ones after it from being tried.
+    size_t encodedFilterCount    = 0;
+    size_t skippedFilterCount    = 0;
+    mDataVersionFilterSavedBytes = 0;
+
     aEncodedDataVersionList = false;
     for (auto & filter : filterVector)
     {
         bool intersected = false;
-        aDataVersionFilterIBsBuilder.Checkpoint(backup);
 
         // if the particular cached cluster does not intersect with user provided attribute paths, skip the cached one
         for (const auto & attributePath : aAttributePaths)
@@ -626,18 +751,29 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterLi
             continue;
         }
 
-        SuccessOrExit(err = aDataVersionFilterIBsBuilder.EncodeDataVersionFilterIB(filter.first));
+        aDataVersionFilterIBsBuilder.Checkpoint(backup);
+        err = aDataVersionFilterIBsBuilder.EncodeDataVersionFilterIB(filter.first);
+        if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            aDataVersionFilterIBsBuilder.Rollback(backup);
+            ++skippedFilterCount;
+            continue;
+        }
+        ReturnErrorOnFailure(err);
+
         aEncodedDataVersionList = true;
+        ++encodedFilterCount;
+        mDataVersionFilterSavedBytes += filter.second;
     }
 
-exit:
-    if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    if (skippedFilterCount > 0)
     {
-        ChipLogProgress(DataManagement, "OnUpdateDataVersionFilterList out of space; rolling back");
-        aDataVersionFilterIBsBuilder.Rollback(backup);
-        err = CHIP_NO_ERROR;
+        ChipLogProgress(DataManagement, "OnUpdateDataVersionFilterList out of space; %lu filters left out",
+                        static_cast<unsigned long>(skippedFilterCount));
     }
-    return err;
+    ChipLogProgress(DataManagement, "%lu data version filters encoded, covering %lu bytes of cached attribute data",
+                    static_cast<unsigned long>(encodedFilterCount), static_cast<unsigned long>(mDataVersionFilterSavedBytes));
+    return CHIP_NO_ERROR;
 }
 
 template <bool CanEnableDataCaching>
@@ -681,6 +817,282 @@ void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttr
     clusterState.mAttributes.erase(attribute.mAttributeId);
 }
 
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::SaveSnapshot(TLV::TLVWriter & writer) const
+{
+    TLV::TLVType snapshotContainer, endpointsContainer;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, snapshotContainer));
+    ReturnErrorOnFailure(writer.Put(kSnapshotVersionTag, kSnapshotVersion));
+    if (mHighestReceivedEventNumber.HasValue())
+    {
+        ReturnErrorOnFailure(writer.Put(kSnapshotHighestEventNumberTag, mHighestReceivedEventNumber.Value()));
+    }
+
+    ReturnErrorOnFailure(writer.StartContainer(kSnapshotEndpointsTag, TLV::kTLVType_Array, endpointsContainer));
+    for (const auto & [endpointId, endpointState] : mCache)
+    {
+        TLV::TLVType endpointContainer, clustersContainer;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, endpointContainer));
+        ReturnErrorOnFailure(writer.Put(kSnapshotIdTag, endpointId));
+        ReturnErrorOnFailure(writer.StartContainer(kSnapshotChildrenTag, TLV::kTLVType_Array, clustersContainer));
+        for (const auto & [clusterId, clusterState] : endpointState)
+        {
+            TLV::TLVType clusterContainer, attributesContainer;
+            ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, clusterContainer));
+            ReturnErrorOnFailure(writer.Put(kSnapshotIdTag, clusterId));
+            if (clusterState.mCommittedDataVersion.HasValue())
+            {
+                ReturnErrorOnFailure(writer.Put(kSnapshotDataVersionTag, clusterState.mCommittedDataVersion.Value()));
+            }
+            ReturnErrorOnFailure(writer.StartContainer(kSnapshotChildrenTag, TLV::kTLVType_Array, attributesContainer));
+            for (const auto & [attributeId, attributeState] : clusterState.mAttributes)
+            {
+                ReturnErrorOnFailure(SaveAttributeSnapshot(writer, attributeId, attributeState));
+            }
+            ReturnErrorOnFailure(writer.EndContainer(attributesContainer));
+            ReturnErrorOnFailure(writer.EndContainer(clusterContainer));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(clustersContainer));
+        ReturnErrorOnFailure(writer.EndContainer(endpointContainer));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(endpointsContainer));
+
+    return writer.EndContainer(snapshotContainer);
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::SaveAttributeSnapshot(TLV::TLVWriter & writer, AttributeId attributeId,
+                                                                           const AttributeState & state)
+{
+    TLV::TLVType attributeContainer;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, attributeContainer));
+    ReturnErrorOnFailure(writer.Put(kSnapshotIdTag, attributeId));
+
+    if constexpr (CanEnableDataCaching)
+    {
+        if (state.template Is<AttributeData>())
+        {
+            const auto & data = state.template Get<AttributeData>();
+            TLV::TLVReader reader;
+            reader.Init(data.Get(), data.AllocatedSize());
+            ReturnErrorOnFailure(reader.Next());
+            ReturnErrorOnFailure(writer.CopyElement(kSnapshotDataTag, reader));
+        }
+        else if (state.template Is<StatusIB>())
+        {
+            const auto & status = state.template Get<StatusIB>();
+            ReturnErrorOnFailure(writer.Put(kSnapshotStatusTag, to_underlying(status.mStatus)));
+            if (status.mClusterStatus.has_value())
+            {
+                ReturnErrorOnFailure(writer.Put(kSnapshotClusterStatusTag, *status.mClusterStatus));
+            }
+        }
+        else if (state.template Is<uint32_t>())
+        {
+            ReturnErrorOnFailure(writer.Put(kSnapshotSizeTag, state.template Get<uint32_t>()));
+        }
+    }
+    else
+    {
+        ReturnErrorOnFailure(writer.Put(kSnapshotSizeTag, state));
+    }
+
+    return writer.EndContainer(attributeContainer);
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::RestoreSnapshot(TLV::TLVReader & reader)
+{
+    VerifyOrReturnError(!mLastReportDataPath.IsValidConcreteClusterPath(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+
+    NodeState restored;
+    Optional<EventNumber> highestReceivedEventNumber;
+    bool versionFound = false;
+    CHIP_ERROR err;
+
+    TLV::TLVType snapshotContainer;
+    ReturnErrorOnFailure(reader.EnterContainer(snapshotContainer));
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (reader.GetTag() == kSnapshotVersionTag)
+        {
+            uint8_t version;
+            ReturnErrorOnFailure(reader.Get(version));
+            VerifyOrReturnError(version == kSnapshotVersion, CHIP_ERROR_VERSION_MISMATCH);
+            versionFound = true;
+        }
+        else if (reader.GetTag() == kSnapshotHighestEventNumberTag)
+        {
+            EventNumber eventNumber;
+            ReturnErrorOnFailure(reader.Get(eventNumber));
+            highestReceivedEventNumber.SetValue(eventNumber);
+        }
+        else if (reader.GetTag() == kSnapshotEndpointsTag)
+        {
+            // The version comes first, so don't try to make sense of a layout we may not know.
+            VerifyOrReturnError(versionFound, CHIP_ERROR_VERSION_MISMATCH);
+
+            TLV::TLVType endpointsContainer;
+            ReturnErrorOnFailure(reader.EnterContainer(endpointsContainer));
+            while ((err = reader.Next()) == CHIP_NO_ERROR)
+            {
+                Optional<EndpointId> endpointId;
+                EndpointState endpointState;
+
+                TLV::TLVType endpointContainer;
+                ReturnErrorOnFailure(reader.EnterContainer(endpointContainer));
+                while ((err = reader.Next()) == CHIP_NO_ERROR)
+                {
+                    if (reader.GetTag() == kSnapshotIdTag)
+                    {
+                        EndpointId id;
+                        ReturnErrorOnFailure(reader.Get(id));
+                        endpointId.SetValue(id);
+                    }
+                    else if (reader.GetTag() == kSnapshotChildrenTag)
+                    {
+                        ReturnErrorOnFailure(RestoreClusterSnapshot(reader, endpointState));
+                    }
+                }
+                VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+                ReturnErrorOnFailure(reader.ExitContainer(endpointContainer));
+
+                VerifyOrReturnError(endpointId.HasValue(), CHIP_ERROR_INVALID_TLV_ELEMENT);
+                restored[endpointId.Value()] = std::move(endpointState);
+            }
+            VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+            ReturnErrorOnFailure(reader.ExitContainer(endpointsContainer));
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(snapshotContainer));
+    VerifyOrReturnError(versionFound, CHIP_ERROR_VERSION_MISMATCH);
+
+    mCache = std::move(restored);
+    if (highestReceivedEventNumber.HasValue())
+    {
+        mHighestReceivedEventNumber = highestReceivedEventNumber;
+    }
+    return CHIP_NO_ERROR;
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::RestoreClusterSnapshot(TLV::TLVReader & reader, EndpointState & endpointState)
+{
+    CHIP_ERROR err;
+    TLV::TLVType clustersContainer;
+    ReturnErrorOnFailure(reader.EnterContainer(clustersContainer));
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        Optional<ClusterId> clusterId;
+        ClusterState clusterState;
+
+        TLV::TLVType clusterContainer;
+        ReturnErrorOnFailure(reader.EnterContainer(clusterContainer));
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            if (reader.GetTag() == kSnapshotIdTag)
+            {
+                ClusterId id;
+                ReturnErrorOnFailure(reader.Get(id));
+                clusterId.SetValue(id);
+            }
+            else if (reader.GetTag() == kSnapshotDataVersionTag)
+            {
+                DataVersion dataVersion;
+                ReturnErrorOnFailure(reader.Get(dataVersion));
+                clusterState.mCommittedDataVersion.SetValue(dataVersion);
+            }
+            else if (reader.GetTag() == kSnapshotChildrenTag)
+            {
+                TLV::TLVType attributesContainer;
+                ReturnErrorOnFailure(reader.EnterContainer(attributesContainer));
+                while ((err = reader.Next()) == CHIP_NO_ERROR)
+                {
+                    ReturnErrorOnFailure(RestoreAttributeSnapshot(reader, clusterState));
+                }
+                VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+                ReturnErrorOnFailure(reader.ExitContainer(attributesContainer));
+            }
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        ReturnErrorOnFailure(reader.ExitContainer(clusterContainer));
+
+        VerifyOrReturnError(clusterId.HasValue(), CHIP_ERROR_INVALID_TLV_ELEMENT);
+        endpointState[clusterId.Value()] = std::move(clusterState);
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return reader.ExitContainer(clustersContainer);
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::RestoreAttributeSnapshot(TLV::TLVReader & reader, ClusterState & clusterState)
+{
+    CHIP_ERROR err;
+    Optional<AttributeId> attributeId;
+    AttributeState state;
+    bool hasState = false;
+    StatusIB status;
+    bool hasStatus = false;
+
+    TLV::TLVType attributeContainer;
+    ReturnErrorOnFailure(reader.EnterContainer(attributeContainer));
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (reader.GetTag() == kSnapshotIdTag)
+        {
+            AttributeId id;
+            ReturnErrorOnFailure(reader.Get(id));
+            attributeId.SetValue(id);
+        }
+        else if (reader.GetTag() == kSnapshotDataTag)
+        {
+            ReturnErrorOnFailure(SetDataState(reader, state));
+            hasState = true;
+        }
+        else if (reader.GetTag() == kSnapshotStatusTag)
+        {
+            std::underlying_type_t<Protocols::InteractionModel::Status> statusValue;
+            ReturnErrorOnFailure(reader.Get(statusValue));
+            status.mStatus = static_cast<Protocols::InteractionModel::Status>(statusValue);
+            hasStatus      = true;
+        }
+        else if (reader.GetTag() == kSnapshotClusterStatusTag)
+        {
+            ClusterStatus clusterStatus;
+            ReturnErrorOnFailure(reader.Get(clusterStatus));
+            status.mClusterStatus = clusterStatus;
+        }
+        else if (reader.GetTag() == kSnapshotSizeTag)
+        {
+            uint32_t size;
+            ReturnErrorOnFailure(reader.Get(size));
+            if constexpr (CanEnableDataCaching)
+            {
+                state.template Set<uint32_t>(size);
+            }
+            else
+            {
+                state = size;
+            }
+            hasState = true;
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(attributeContainer));
+
+    if (hasStatus)
+    {
+        SetStatusState(status, state);
+        hasState = true;
+    }
+
+    VerifyOrReturnError(attributeId.HasValue() && hasState, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    clusterState.mAttributes[attributeId.Value()] = std::move(state);
+    return CHIP_NO_ERROR;
+}
+
 template <bool CanEnableDataCaching>
 CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(ConcreteClusterPath & aPath)
 {
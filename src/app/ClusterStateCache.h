@@ -24,6 +24,10 @@
 #include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
 #include <app/BufferedReadCallback.h>
+#if CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA
+#include <app/ClusterStateCacheArena.h>
+#endif
+#include <app/ClusterStateCacheFlatMap.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
@@ -129,6 +133,15 @@ public:
         mHighestReceivedEventNumber.SetValue(highestReceivedEventNumber);
     }
 
+    /*
+     * If enabled, an incoming attribute value (or status) that is identical to the one already cached does not
+     * produce OnAttributeChanged (or OnClusterChanged) notifications. This is mostly useful to avoid redoing
+     * application work for the priming report after a resubscription.
+     *
+     * Only has an effect when attribute data is being cached, since otherwise there is nothing to compare against.
+     */
+    void SetSuppressUnchangedAttributeNotifications(bool suppress) { mSuppressUnchangedAttributeNotifications = suppress; }
+
     /*
      * When registering as a callback to the ReadClient, the ClusterStateCache cannot not be passed as a callback
      * directly. Instead, utilize this method below to correctly set up the callback chain such that
@@ -261,8 +274,9 @@ public:
      * Retrieve the value of an attribute by updating a in-out TLVReader to be positioned
      * right at the attribute value.
      *
-     * The underlying TLV buffer only remains valid until the cached value for that path is updated, so it must
-     * not be held across any async call boundaries.
+     * The underlying TLV buffer only remains valid until the cached value for that path is updated (or, with
+     * CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA, until the next report begins), so it must not be held across any
+     * async call boundaries.
      *
      * Notable return values:
      *      - If neither data nor status for the specified path exist in the cache, CHIP_ERROR_KEY_NOT_FOUND
@@ -405,16 +419,15 @@ public:
     {
         for (auto & endpointIter : mCache)
         {
-            for (auto & clusterIter : endpointIter.second)
+            auto clusterIter = endpointIter.second.find(clusterId);
+            if (clusterIter == endpointIter.second.end())
             {
-                if (clusterIter.first == clusterId)
-                {
-                    for (auto & attributeIter : clusterIter.second.mAttributes)
-                    {
-                        const ConcreteAttributePath path(endpointIter.first, clusterId, attributeIter.first);
-                        ReturnErrorOnFailure(func(path));
-                    }
-                }
+                continue;
+            }
+            for (auto & attributeIter : clusterIter->second.mAttributes)
+            {
+                const ConcreteAttributePath path(endpointIter.first, clusterId, attributeIter.first);
+                ReturnErrorOnFailure(func(path));
             }
         }
         return CHIP_NO_ERROR;
@@ -466,7 +479,7 @@ public:
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
         auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
+        if (endpointIter != mCache.end())
         {
             for (auto & clusterIter : endpointIter->second)
             {
@@ -550,6 +563,28 @@ public:
      */
     void ClearAttribute(const ConcreteAttributePath & attribute);
 
+    /*
+     * Write the cached attribute state (data, status or size for every attribute), the committed DataVersion of
+     * every cluster and the highest received event number to `writer` as a single anonymous TLV structure.
+     *
+     * Restoring such a snapshot into a fresh cache after a restart lets the next subscription send DataVersion
+     * filters right away, so that only clusters that changed in the meantime are reported again.
+     *
+     * Events are not part of the snapshot.
+     */
+    CHIP_ERROR SaveSnapshot(TLV::TLVWriter & writer) const;
+
+    /*
+     * Replace all cached attribute state with that of a snapshot written by SaveSnapshot. `reader` must be
+     * positioned on the snapshot structure. No callbacks are invoked for the restored state.
+     *
+     * Must not be called while a report is being processed. On failure the cache is left unchanged.
+     *
+     * Notable return values:
+     *      - CHIP_ERROR_VERSION_MISMATCH if the snapshot was written in a format this code does not understand.
+     */
+    CHIP_ERROR RestoreSnapshot(TLV::TLVReader & reader);
+
     /*
      * Clear out the event data and status caches.
      *
@@ -577,6 +612,13 @@ public:
      */
     CHIP_ERROR GetLastReportDataPath(ConcreteClusterPath & aPath);
 
+    /*
+     *  Get the amount of cached attribute data covered by the data version filters encoded in the last read or subscribe
+     *  request: the data the publisher does not need to send again if those clusters did not change.
+     *
+     */
+    size_t GetDataVersionFilterSavedBytes() const { return mDataVersionFilterSavedBytes; }
+
 private:
     // An attribute state can be one of three things:
     // * If we got a path-specific error for the attribute, the corresponding
@@ -590,21 +632,37 @@ private:
     // The data for a single attribute is not going to be gigabytes in size, so
     // using uint32_t for the size is fine; on 64-bit systems this can save
     // quite a bit of space.
-    using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
+#if CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA
+    using AttributeData = detail::TLVArena::Buffer;
+#else
+    using AttributeData = Platform::ScopedMemoryBufferWithSize<uint8_t>;
+#endif
     using AttributeState = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
     // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
     //
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
     // value the cluster must be included in a path in mRequestPathSet that has a wildcard attribute
     // and we must not be in the middle of receiving reports for that cluster.
+    //
+    // With CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE the per-node, per-endpoint and per-cluster maps are sorted vectors
+    // instead of trees. This is a lot more compact when many nodes are cached, but pointers to ClusterState and
+    // AttributeState do not survive insertions, so they must not be held across calls to UpdateCache.
+    //
+#if CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE
+    template <typename Key, typename Value>
+    using StateMap = detail::SortedVectorMap<Key, Value>;
+#else
+    template <typename Key, typename Value>
+    using StateMap = std::map<Key, Value>;
+#endif
     struct ClusterState
     {
-        std::map<AttributeId, AttributeState> mAttributes;
+        StateMap<AttributeId, AttributeState> mAttributes;
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
     };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
+    using EndpointState = StateMap<ClusterId, ClusterState>;
+    using NodeState     = StateMap<EndpointId, EndpointState>;
 
     struct Comparator
     {
@@ -717,11 +775,32 @@ private:
 
     CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize);
 
+    // Fill in aState as UpdateCache does for received data (aData positioned on the element) or a received status.
+    CHIP_ERROR SetDataState(TLV::TLVReader & aData, AttributeState & aState);
+    void SetStatusState(const StatusIB & aStatus, AttributeState & aState);
+
+    static CHIP_ERROR SaveAttributeSnapshot(TLV::TLVWriter & writer, AttributeId attributeId, const AttributeState & state);
+    CHIP_ERROR RestoreClusterSnapshot(TLV::TLVReader & reader, EndpointState & endpointState);
+    CHIP_ERROR RestoreAttributeSnapshot(TLV::TLVReader & reader, ClusterState & clusterState);
+
+    // Whether two attribute states hold the same status or byte-identical data.
+    static bool IsSameAttributeState(const AttributeState & lhs, const AttributeState & rhs);
+
+#if CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA
+    // Move all cached attribute data into one arena block if enough of the arena holds stale values.
+    void CompactAttributeData();
+#endif
+
     Callback & mCallback;
+#if CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA
+    // Must be declared before mCache, since the attribute data in mCache refers to it.
+    detail::TLVArena mAttributeDataArena;
+#endif
     NodeState mCache;
     std::set<ConcreteAttributePath> mChangedAttributeSet;
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
+    size_t mDataVersionFilterSavedBytes = 0;
 
     std::set<EventData, EventDataCompare> mEventDataCache;
     Optional<EventNumber> mHighestReceivedEventNumber;
@@ -729,6 +808,8 @@ private:
     BufferedReadCallback mBufferedReader;
     ConcreteClusterPath mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     const bool mCacheData                   = CanEnableDataCaching;
+
+    bool mSuppressUnchangedAttributeNotifications = false;
 };
 
 using ClusterStateCache       = ClusterStateCacheT<true>;
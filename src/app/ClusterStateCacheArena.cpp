@@ -0,0 +1,186 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClusterStateCacheArena.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace detail {
+
+TLVArena::Buffer & TLVArena::Buffer::operator=(Buffer && other)
+{
+    if (this != &other)
+    {
+        Release();
+        mArena       = other.mArena;
+        mData        = other.mData;
+        mSize        = other.mSize;
+        other.mArena = nullptr;
+        other.mData  = nullptr;
+        other.mSize  = 0;
+    }
+    return *this;
+}
+
+void TLVArena::Buffer::Release()
+{
+    if (mArena != nullptr)
+    {
+        mArena->OnRelease(mSize);
+    }
+    mArena = nullptr;
+    mData  = nullptr;
+    mSize  = 0;
+}
+
+TLVArena::~TLVArena()
+{
+    FreeBlocks(mBlocks);
+    FreeBlocks(mCompactedBlock);
+}
+
+TLVArena::Block * TLVArena::NewBlock(size_t capacity)
+{
+    Block * block = static_cast<Block *>(Platform::MemoryAlloc(sizeof(Block) + capacity));
+    VerifyOrReturnValue(block != nullptr, nullptr);
+    block->mNext     = nullptr;
+    block->mCapacity = capacity;
+    block->mUsed     = 0;
+    return block;
+}
+
+void TLVArena::FreeBlocks(Block * blocks)
+{
+    while (blocks != nullptr)
+    {
+        Block * next = blocks->mNext;
+        Platform::MemoryFree(blocks);
+        blocks = next;
+    }
+}
+
+CHIP_ERROR TLVArena::Allocate(uint32_t size, Buffer & buffer)
+{
+    // Release first: if that was the last live buffer, all blocks go away and we start afresh.
+    buffer.Release();
+    VerifyOrReturnError(size > 0, CHIP_NO_ERROR);
+
+    Block * block = nullptr;
+    if (size > kBlockSize / 2)
+    {
+        // Keep the current block as the head so its remaining space is still used for small payloads.
+        block = NewBlock(size);
+        VerifyOrReturnError(block != nullptr, CHIP_ERROR_NO_MEMORY);
+        if (mBlocks != nullptr)
+        {
+            block->mNext   = mBlocks->mNext;
+            mBlocks->mNext = block;
+        }
+        else
+        {
+            mBlocks = block;
+        }
+    }
+    else if (mBlocks == nullptr || (mBlocks->mCapacity - mBlocks->mUsed) < size)
+    {
+        block = NewBlock(kBlockSize);
+        VerifyOrReturnError(block != nullptr, CHIP_ERROR_NO_MEMORY);
+        block->mNext = mBlocks;
+        mBlocks      = block;
+    }
+    else
+    {
+        block = mBlocks;
+    }
+
+    buffer.mArena = this;
+    buffer.mData  = block->Data() + block->mUsed;
+    buffer.mSize  = size;
+    block->mUsed += size;
+    mLiveBytes += size;
+    mAllocatedBytes += size;
+    return CHIP_NO_ERROR;
+}
+
+void TLVArena::OnRelease(uint32_t size)
+{
+    VerifyOrDie(mLiveBytes >= size);
+    mLiveBytes -= size;
+    if (mLiveBytes == 0 && mCompactedBlock == nullptr)
+    {
+        FreeBlocks(mBlocks);
+        mBlocks         = nullptr;
+        mAllocatedBytes = 0;
+    }
+}
+
+bool TLVArena::ShouldCompact() const
+{
+    const size_t deadBytes = mAllocatedBytes - mLiveBytes;
+    return deadBytes > kBlockSize && deadBytes > mLiveBytes;
+}
+
+CHIP_ERROR TLVArena::BeginCompaction()
+{
+    VerifyOrReturnError(mCompactedBlock == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mLiveBytes > 0, CHIP_NO_ERROR);
+
+    mCompactedBlock = NewBlock(mLiveBytes);
+    VerifyOrReturnError(mCompactedBlock != nullptr, CHIP_ERROR_NO_MEMORY);
+    return CHIP_NO_ERROR;
+}
+
+void TLVArena::Relocate(Buffer & buffer)
+{
+    VerifyOrReturn(buffer.mArena == this);
+    VerifyOrDie(mCompactedBlock != nullptr && mCompactedBlock->mCapacity - mCompactedBlock->mUsed >= buffer.mSize);
+
+    uint8_t * data = mCompactedBlock->Data() + mCompactedBlock->mUsed;
+    memcpy(data, buffer.mData, buffer.mSize);
+    mCompactedBlock->mUsed += buffer.mSize;
+    buffer.mData = data;
+}
+
+void TLVArena::EndCompaction()
+{
+    VerifyOrDie(mCompactedBlock == nullptr || mCompactedBlock->mUsed == mLiveBytes);
+
+    FreeBlocks(mBlocks);
+    mBlocks         = mCompactedBlock;
+    mCompactedBlock = nullptr;
+    mAllocatedBytes = mLiveBytes;
+}
+
+size_t TLVArena::BlockCount() const
+{
+    size_t count = 0;
+    for (const Block * block = mBlocks; block != nullptr; block = block->mNext)
+    {
+        count++;
+    }
+    return count;
+}
+
+} // namespace detail
+} // namespace app
+} // namespace chip
@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace chip {
+namespace app {
+namespace detail {
+
+/*
+ * Bump allocator for the TLV payloads kept by a ClusterStateCache.
+ *
+ * Small payloads are carved out of blocks of CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA_BLOCK_SIZE bytes, payloads
+ * bigger than half a block get a block of their own. Space is never reused in place: releasing a buffer only
+ * accounts for it, and once enough of the arena is dead (see ShouldCompact) the owner moves every live buffer
+ * into a single new block:
+ *
+ *      if (arena.ShouldCompact() && arena.BeginCompaction() == CHIP_NO_ERROR)
+ *      {
+ *          for (each live buffer) arena.Relocate(buffer);
+ *          arena.EndCompaction();
+ *      }
+ *
+ * Every live buffer MUST be relocated between BeginCompaction and EndCompaction, since the latter frees the
+ * blocks they used to live in.
+ */
+class TLVArena
+{
+public:
+    /*
+     * A span of arena memory. Move-only; destroying it returns its bytes to the arena's accounting.
+     */
+    class Buffer
+    {
+    public:
+        Buffer() = default;
+        ~Buffer() { Release(); }
+
+        Buffer(Buffer && other) { *this = std::move(other); }
+        Buffer & operator=(Buffer && other);
+
+        Buffer(const Buffer &)             = delete;
+        Buffer & operator=(const Buffer &) = delete;
+
+        uint8_t * Get() { return mData; }
+        const uint8_t * Get() const { return mData; }
+        size_t AllocatedSize() const { return mSize; }
+
+    private:
+        friend class TLVArena;
+
+        void Release();
+
+        TLVArena * mArena = nullptr;
+        uint8_t * mData   = nullptr;
+        uint32_t mSize    = 0;
+    };
+
+    TLVArena() = default;
+    ~TLVArena();
+
+    TLVArena(const TLVArena &)             = delete;
+    TLVArena & operator=(const TLVArena &) = delete;
+
+    /*
+     * Replace the contents of `buffer` with `size` bytes (not zeroed) of arena memory.
+     */
+    CHIP_ERROR Allocate(uint32_t size, Buffer & buffer);
+
+    /*
+     * Whether dead payloads take up more than a block and more than the live ones do.
+     */
+    bool ShouldCompact() const;
+
+    /*
+     * Allocate a block big enough for all live buffers. On failure nothing changes and compaction must not proceed.
+     */
+    CHIP_ERROR BeginCompaction();
+    void Relocate(Buffer & buffer);
+    void EndCompaction();
+
+    size_t LiveBytes() const { return mLiveBytes; }
+    size_t AllocatedBytes() const { return mAllocatedBytes; }
+    size_t BlockCount() const;
+
+private:
+    struct Block
+    {
+        Block * mNext;
+        size_t mCapacity;
+        size_t mUsed;
+
+        uint8_t * Data() { return reinterpret_cast<uint8_t *>(this + 1); }
+    };
+
+    static constexpr size_t kBlockSize = CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA_BLOCK_SIZE;
+
+    static Block * NewBlock(size_t capacity);
+    static void FreeBlocks(Block * blocks);
+
+    void OnRelease(uint32_t size);
+
+    // mBlocks is the block that new small payloads go to, followed by all older ones.
+    Block * mBlocks         = nullptr;
+    Block * mCompactedBlock = nullptr; // only set between BeginCompaction and EndCompaction
+    size_t mLiveBytes       = 0;
+    size_t mAllocatedBytes  = 0;
+};
+
+} // namespace detail
+} // namespace app
+} // namespace chip
@@ -0,0 +1,121 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace chip {
+namespace app {
+namespace detail {
+
+/*
+ * A map kept as a vector of (key, value) pairs sorted by key.
+ *
+ * This provides the subset of the std::map interface that ClusterStateCache
+ * uses. Lookups are a binary search over contiguous storage, and each entry
+ * costs sizeof(value_type) instead of a separately allocated tree node.
+ * Insertions and removals move the entries that follow, which is cheap for the
+ * few endpoints, clusters and attributes a node has.
+ *
+ * Unlike std::map, inserting or erasing an entry invalidates iterators and
+ * references to all of the other entries.
+ */
+template <typename Key, typename Value>
+class SortedVectorMap
+{
+public:
+    //
+    // Values such as ClusterStateCache's AttributeState are move-only but do not declare their
+    // move constructor noexcept, which would make std::vector try to copy them when it grows.
+    // We build without exceptions, so a move cannot throw and it is safe to promise that here.
+    //
+    struct Entry : public std::pair<Key, Value>
+    {
+        explicit Entry(const Key & key) : std::pair<Key, Value>(key, Value()) {}
+        Entry(Entry && other) noexcept : std::pair<Key, Value>(std::move(other)) {}
+        Entry & operator=(Entry && other) noexcept
+        {
+            std::pair<Key, Value>::operator=(std::move(other));
+            return *this;
+        }
+    };
+
+    using key_type       = Key;
+    using mapped_type    = Value;
+    using value_type     = Entry;
+    using iterator       = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    iterator begin() { return mEntries.begin(); }
+    iterator end() { return mEntries.end(); }
+    const_iterator begin() const { return mEntries.begin(); }
+    const_iterator end() const { return mEntries.end(); }
+
+    size_t size() const { return mEntries.size(); }
+    bool empty() const { return mEntries.empty(); }
+    void clear() { mEntries.clear(); }
+
+    iterator find(const Key & key)
+    {
+        auto it = LowerBound(key);
+        return (it != mEntries.end() && it->first == key) ? it : mEntries.end();
+    }
+
+    const_iterator find(const Key & key) const
+    {
+        auto it = LowerBound(key);
+        return (it != mEntries.end() && it->first == key) ? it : mEntries.end();
+    }
+
+    Value & operator[](const Key & key)
+    {
+        auto it = LowerBound(key);
+        if (it == mEntries.end() || it->first != key)
+        {
+            it = mEntries.emplace(it, key);
+        }
+        return it->second;
+    }
+
+    size_t erase(const Key & key)
+    {
+        auto it = find(key);
+        if (it == mEntries.end())
+        {
+            return 0;
+        }
+        mEntries.erase(it);
+        return 1;
+    }
+
+private:
+    static bool KeyLess(const value_type & entry, const Key & key) { return entry.first < key; }
+
+    iterator LowerBound(const Key & key) { return std::lower_bound(mEntries.begin(), mEntries.end(), key, KeyLess); }
+    const_iterator LowerBound(const Key & key) const { return std::lower_bound(mEntries.begin(), mEntries.end(), key, KeyLess); }
+
+    std::vector<value_type> mEntries;
+};
+
+} // namespace detail
+} // namespace app
+} // namespace chip
@@ -96,6 +96,14 @@ public:
      */
     virtual void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) = 0;
 
+    /**
+     * @brief Called after AddInvokeResponseToSend when the message just added is not the last
+     * one, i.e. more InvokeResponseMessages will follow.
+     *
+     * Lets the responder start sending the chunks before all commands have completed.
+     */
+    virtual void InvokeResponseChunkReady() {}
+
     /**
      * @brief Called to indicate that an InvokeResponse was dropped.
      *
@@ -39,6 +39,8 @@ namespace chip {
 namespace app {
 using Status = Protocols::InteractionModel::Status;
 
+CommandHandlerImpl::InvokeResponseStats CommandHandlerImpl::sInvokeResponseStats;
+
 CommandHandlerImpl::CommandHandlerImpl(Callback * apCallback) : mpCallback(apCallback), mSuppressResponse(false) {}
 
 CommandHandlerImpl::CommandHandlerImpl(TestOnlyOverrides & aTestOverride, Callback * apCallback) : CommandHandlerImpl(apCallback)
@@ -106,7 +108,8 @@ CHIP_ERROR CommandHandlerImpl::AllocateBuffer()
         mInvokeResponseBuilder.CreateInvokeResponses(/* aReserveEndBuffer = */ true);
         ReturnErrorOnFailure(mInvokeResponseBuilder.GetError());
 
-        mBufferAllocated = true;
+        mBufferAllocated    = true;
+        mResponsesInMessage = 0;
         MoveToState(State::NewResponseMessage);
     }
 
@@ -511,17 +514,13 @@ Status CommandHandlerImpl::ProcessGroupCommandDataIB(CommandDataIB::Parser & aCo
     // No check for `CommandIsFabricScoped` unlike in `ProcessCommandDataIB()` since group commands
     // always have an accessing fabric, by definition.
 
-    // Find which endpoints can process the command, and dispatch to them.
-    iterator = groupDataProvider->IterateEndpoints(fabric);
+    // Find which endpoints can process the command, and dispatch to them.  Only the endpoints of the group are visited, rather
+    // than the endpoints of every group of the fabric.
+    iterator = groupDataProvider->IterateEndpoints(fabric, std::make_optional(groupId));
     VerifyOrReturnError(iterator != nullptr, Status::Failure);
 
     while (iterator->Next(mapping))
     {
-        if (groupId != mapping.group_id)
-        {
-            continue;
-        }
-
         ChipLogDetail(DataManagement,
                       "Processing group command for Endpoint=%u Cluster=" ChipLogFormatMEI " Command=" ChipLogFormatMEI,
                       mapping.endpoint_id, ChipLogValueMEI(clusterId), ChipLogValueMEI(commandId));
@@ -708,6 +707,7 @@ CHIP_ERROR CommandHandlerImpl::FinishCommand(bool aStartDataStruct)
 
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB());
+    mResponsesInMessage++;
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -753,6 +753,7 @@ CHIP_ERROR CommandHandlerImpl::FinishStatus()
 
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus().EndOfCommandStatusIB());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB());
+    mResponsesInMessage++;
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -836,6 +837,23 @@ CHIP_ERROR CommandHandlerImpl::FinalizeInvokeResponseMessage(bool aHasMoreChunks
     mpResponder->AddInvokeResponseToSend(std::move(packet));
     mBufferAllocated     = false;
     mRollbackBackupValid = false;
+
+    sInvokeResponseStats.responseMessages++;
+    sInvokeResponseStats.responses += mResponsesInMessage;
+    if (mResponsesInMessage > sInvokeResponseStats.maxResponsesPerMessage)
+    {
+        sInvokeResponseStats.maxResponsesPerMessage = mResponsesInMessage;
+    }
+    if (aHasMoreChunks && !mFinalizedResponseMessage)
+    {
+        sInvokeResponseStats.chunkedInvokes++;
+    }
+    mFinalizedResponseMessage = true;
+
+    if (aHasMoreChunks)
+    {
+        mpResponder->InvokeResponseChunkReady();
+    }
     return CHIP_NO_ERROR;
 }
 
@@ -96,6 +96,22 @@ public:
         bool mStartOrEndDataStruct = true;
     };
 
+    /**
+     * Counters describing how InvokeResponses were packed into InvokeResponseMessages, summed over
+     * all CommandHandlerImpl instances.  The average number of commands per message is
+     * responses / responseMessages.
+     */
+    struct InvokeResponseStats
+    {
+        uint32_t responseMessages       = 0; ///< InvokeResponseMessages finalized for sending.
+        uint32_t responses              = 0; ///< InvokeResponseIBs (command data or status) in those messages.
+        uint32_t chunkedInvokes         = 0; ///< Invoke interactions whose responses needed more than one message.
+        uint16_t maxResponsesPerMessage = 0;
+    };
+
+    static const InvokeResponseStats & GetInvokeResponseStats() { return sInvokeResponseStats; }
+    static void ResetInvokeResponseStats() { sInvokeResponseStats = InvokeResponseStats(); }
+
     struct TestOnlyOverrides
     {
     public:
@@ -473,6 +489,10 @@ private:
 
     CommandHandlerExchangeInterface * mpResponder = nullptr;
 
+    static InvokeResponseStats sInvokeResponseStats;
+    uint16_t mResponsesInMessage   = 0;
+    bool mFinalizedResponseMessage = false;
+
     State mState = State::Idle;
     State mBackupState;
     ScopedChangeOnly<bool> mInternalCallToAddResponseData{ false };
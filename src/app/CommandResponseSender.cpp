@@ -38,13 +38,23 @@ CHIP_ERROR CommandResponseSender::OnMessageReceived(Messaging::ExchangeContext *
         err = statusError;
         VerifyOrExit(err == CHIP_NO_ERROR, failureStatusToSend.SetValue(Status::InvalidAction));
 
+#if CHIP_CONFIG_IM_STREAM_INVOKE_RESPONSE_CHUNKS
+        if (!mCommandHandlerDone && mChunks.IsNull())
+        {
+            // The next chunk is sent as soon as the CommandHandler has filled it.
+            mExchangeCtx->WillSendMessage();
+            MoveToState(State::AwaitingInvokeResponses);
+            return CHIP_NO_ERROR;
+        }
+#endif // CHIP_CONFIG_IM_STREAM_INVOKE_RESPONSE_CHUNKS
+
         err = SendCommandResponse();
         // If SendCommandResponse() fails, we must close the exchange. We signal the failure to the
         // requester with a StatusResponse ('Failure'). Since we're in the middle of processing an
         // incoming message, we close the exchange by indicating that we don't expect a further response.
         VerifyOrExit(err == CHIP_NO_ERROR, failureStatusToSend.SetValue(Status::Failure));
 
-        bool moreToSend = !mChunks.IsNull();
+        bool moreToSend = !mChunks.IsNull() || !mCommandHandlerDone;
         if (!moreToSend)
         {
             // We are sending the final message and do not anticipate any further responses. We are
@@ -68,7 +78,7 @@ exit:
     {
         TEMPORARY_RETURN_IGNORED StatusResponse::Send(failureStatusToSend.Value(), mExchangeCtx.Get(), false /*aExpectResponse*/);
     }
-    Close();
+    CloseOrWaitForCommandHandler();
     return err;
 }
 
@@ -76,12 +86,12 @@ void CommandResponseSender::OnResponseTimeout(Messaging::ExchangeContext * apExc
 {
     ChipLogDetail(DataManagement, "CommandResponseSender: Timed out waiting for response from requester mState=[%10.10s]",
                   GetStateStr());
-    Close();
+    CloseOrWaitForCommandHandler();
 }
 
 void CommandResponseSender::StartSendingCommandResponses()
 {
-    VerifyOrDie(mState == State::ReadyForInvokeResponses);
+    VerifyOrDie(mState == State::ReadyForInvokeResponses || mState == State::AwaitingInvokeResponses);
     CHIP_ERROR err = SendCommandResponse();
     if (err != CHIP_NO_ERROR)
     {
@@ -98,11 +108,11 @@ void CommandResponseSender::StartSendingCommandResponses()
         //       SendStatusResponse(Status::Failure);
         //   }
         //   ```
-        Close();
+        CloseOrWaitForCommandHandler();
         return;
     }
 
-    if (HasMoreToSend())
+    if (HasMoreToSend() || !mCommandHandlerDone)
     {
         MoveToState(State::AwaitingStatusResponse);
         mExchangeCtx->SetDelegate(this);
@@ -115,6 +125,7 @@ void CommandResponseSender::StartSendingCommandResponses()
 
 void CommandResponseSender::OnDone(CommandHandlerImpl & apCommandObj)
 {
+    mCommandHandlerDone = true;
     if (mState == State::ErrorSentDelayCloseUntilOnDone || apCommandObj.IsGroupRequest())
     {
         // We either have already sent a message to the client indicating that we are not expecting
@@ -122,9 +133,37 @@ void CommandResponseSender::OnDone(CommandHandlerImpl & apCommandObj)
         Close();
         return;
     }
+    if (mState == State::AwaitingStatusResponse)
+    {
+        // Some chunks were streamed already; the rest goes out as the requester acknowledges them.
+        return;
+    }
     StartSendingCommandResponses();
 }
 
+void CommandResponseSender::AddInvokeResponseToSend(System::PacketBufferHandle && aPacket)
+{
+#if CHIP_CONFIG_IM_STREAM_INVOKE_RESPONSE_CHUNKS
+    // The exchange failed while commands were still in progress, there is nobody to send to.
+    VerifyOrReturn(mState != State::ErrorSentDelayCloseUntilOnDone);
+    VerifyOrDie(mState == State::ReadyForInvokeResponses || mState == State::AwaitingStatusResponse ||
+                mState == State::AwaitingInvokeResponses);
+#else
+    VerifyOrDie(mState == State::ReadyForInvokeResponses);
+#endif // CHIP_CONFIG_IM_STREAM_INVOKE_RESPONSE_CHUNKS
+    mChunks.AddToEnd(std::move(aPacket));
+}
+
+void CommandResponseSender::InvokeResponseChunkReady()
+{
+#if CHIP_CONFIG_IM_STREAM_INVOKE_RESPONSE_CHUNKS
+    // While the request is still being processed (ReadyForInvokeResponses) chunks are held back,
+    // as processing may yet fail and be answered with a StatusResponse instead.
+    VerifyOrReturn(mState == State::AwaitingInvokeResponses);
+    StartSendingCommandResponses();
+#endif // CHIP_CONFIG_IM_STREAM_INVOKE_RESPONSE_CHUNKS
+}
+
 void CommandResponseSender::DispatchCommand(CommandHandlerImpl & apCommandObj, const ConcreteCommandPath & aCommandPath,
                                             TLV::TLVReader & apPayload)
 {
@@ -141,6 +180,7 @@ Protocols::InteractionModel::Status CommandResponseSender::ValidateCommandCanBeD
 CHIP_ERROR CommandResponseSender::SendCommandResponse()
 {
     VerifyOrReturnError(HasMoreToSend(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mExchangeCtx, CHIP_ERROR_INCORRECT_STATE);
     if (mChunks.IsNull())
     {
         VerifyOrReturnError(mReportResponseDropped, CHIP_ERROR_INCORRECT_STATE);
@@ -151,7 +191,7 @@ CHIP_ERROR CommandResponseSender::SendCommandResponse()
     System::PacketBufferHandle commandResponsePayload = mChunks.PopHead();
 
     Messaging::SendFlags sendFlag = Messaging::SendMessageFlags::kNone;
-    if (HasMoreToSend())
+    if (HasMoreToSend() || !mCommandHandlerDone)
     {
         sendFlag = Messaging::SendMessageFlags::kExpectResponse;
         mExchangeCtx->UseSuggestedResponseTimeout(app::kExpectedIMProcessingTime);
@@ -174,6 +214,9 @@ const char * CommandResponseSender::GetStateStr() const
     case State::AwaitingStatusResponse:
         return "AwaitingStatusResponse";
 
+    case State::AwaitingInvokeResponses:
+        return "AwaitingInvokeResponses";
+
     case State::AllInvokeResponsesSent:
         return "AllInvokeResponsesSent";
 
@@ -200,6 +243,16 @@ void CommandResponseSender::Close()
     mpCallback->OnDone(*this);
 }
 
+void CommandResponseSender::CloseOrWaitForCommandHandler()
+{
+    if (!mCommandHandlerDone)
+    {
+        MoveToState(State::ErrorSentDelayCloseUntilOnDone);
+        return;
+    }
+    Close();
+}
+
 void CommandResponseSender::OnInvokeCommandRequest(Messaging::ExchangeContext * ec, System::PacketBufferHandle && payload,
                                                    bool isTimedInvoke)
 {
@@ -224,6 +277,14 @@ void CommandResponseSender::OnInvokeCommandRequest(Messaging::ExchangeContext *
         // finished sending data. Closing must be deferred until the CommandHandler::OnDone callback.
         MoveToState(State::ErrorSentDelayCloseUntilOnDone);
     }
+#if CHIP_CONFIG_IM_STREAM_INVOKE_RESPONSE_CHUNKS
+    else if (!mChunks.IsNull())
+    {
+        // Every chunk queued so far has more chunks after it, since the last one is only finalized
+        // once the CommandHandler is done, which cannot happen while workHandle is held.
+        StartSendingCommandResponses();
+    }
+#endif // CHIP_CONFIG_IM_STREAM_INVOKE_RESPONSE_CHUNKS
 }
 
 size_t CommandResponseSender::GetCommandResponseMaxBufferSize()
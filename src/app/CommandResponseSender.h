@@ -116,11 +116,9 @@ public:
         TEMPORARY_RETURN_IGNORED msgContext->FlushAcks();
     }
 
-    void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) override
-    {
-        VerifyOrDie(mState == State::ReadyForInvokeResponses);
-        mChunks.AddToEnd(std::move(aPacket));
-    }
+    void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) override;
+
+    void InvokeResponseChunkReady() override;
 
     void ResponseDropped() override { mReportResponseDropped = true; }
 
@@ -159,6 +157,7 @@ private:
     {
         ReadyForInvokeResponses,       ///< Accepting InvokeResponses to send back to requester.
         AwaitingStatusResponse,        ///< Awaiting status response from requester, after sending InvokeResponse.
+        AwaitingInvokeResponses,       ///< All InvokeResponses so far were sent, awaiting more from the CommandHandler.
         AllInvokeResponsesSent,        ///< All InvokeResponses have been sent out.
         ErrorSentDelayCloseUntilOnDone ///< We have sent an early error response, but still need to clean up.
     };
@@ -180,6 +179,12 @@ private:
     bool HasMoreToSend() { return !mChunks.IsNull() || mReportResponseDropped; }
     void Close();
 
+    /**
+     * Close, unless the CommandHandler still has commands in progress: the CommandHandler must not
+     * outlive this object, so closing then waits for its OnDone.
+     */
+    void CloseOrWaitForCommandHandler();
+
     // A list of InvokeResponseMessages to be sent out by CommandResponseSender.
     System::PacketBufferHandle mChunks;
 
@@ -190,6 +195,7 @@ private:
     State mState = State::ReadyForInvokeResponses;
 
     bool mReportResponseDropped = false;
+    bool mCommandHandlerDone    = false;
 };
 
 } // namespace app
@@ -126,6 +126,9 @@ CHIP_ERROR CommandSender::SendCommandRequestInternal(const SessionHandle & sessi
 {
     VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
 
+    // If sending fails, the metric ends when this object is destroyed.
+    mInvokeMetric.Begin();
+
     ReturnErrorOnFailure(Finalize(mPendingInvokeData));
 
     // Create a new exchange context.
@@ -271,6 +274,7 @@ CHIP_ERROR CommandSender::OnMessageReceived(Messaging::ExchangeContext * apExcha
 exit:
     if (err != CHIP_NO_ERROR)
     {
+        mInvokeMetric.End(err);
         OnErrorCallback(err);
     }
 
@@ -351,6 +355,7 @@ void CommandSender::OnResponseTimeout(Messaging::ExchangeContext * apExchangeCon
     ChipLogProgress(DataManagement, "Time out! failed to receive invoke command response from Exchange: " ChipLogFormatExchange,
                     ChipLogValueExchange(apExchangeContext));
 
+    mInvokeMetric.End(CHIP_ERROR_TIMEOUT);
     OnErrorCallback(CHIP_ERROR_TIMEOUT);
     Close();
 }
@@ -371,6 +376,7 @@ void CommandSender::FlushNoCommandResponse()
 
 void CommandSender::Close()
 {
+    mInvokeMetric.End(CHIP_NO_ERROR);
     mSuppressResponse = false;
     mTimedRequest     = false;
     MoveToState(State::AwaitingDestruction);
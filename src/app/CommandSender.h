@@ -48,6 +48,7 @@
 #include <protocols/Protocols.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
+#include <tracing/metric_event.h>
 
 #define COMMON_STATUS_SUCCESS 0
 
@@ -668,6 +669,8 @@ private:
     uint16_t mFinishedCommandCount       = 0;
     uint16_t mRemoteMaxPathsPerInvoke    = 1;
 
+    Tracing::PendingMetricEvent mInvokeMetric{ Tracing::kMetricIMInvoke };
+
     State mState                = State::Idle;
     bool mSuppressResponse      = false;
     bool mTimedRequest          = false;
@@ -0,0 +1,191 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/DeferredReportCallback.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR RecordedReport::RecordPayload(TLV::TLVReader & aData, Item & item)
+{
+    // Work on a copy so the caller's reader stays where it is.
+    TLV::TLVReader reader;
+    reader.Init(aData);
+
+    // The element re-encoded with an anonymous tag can't be bigger than the buffer it came from.
+    const size_t offset  = mPayloads.size();
+    const size_t maxSize = reader.GetTotalLength();
+    mPayloads.resize(offset + maxSize);
+
+    TLV::TLVWriter writer;
+    writer.Init(mPayloads.data() + offset, maxSize);
+    CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), reader);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = writer.Finalize();
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        mPayloads.resize(offset);
+        return err;
+    }
+
+    mPayloads.resize(offset + writer.GetLengthWritten());
+    item.mHasData = true;
+    item.mOffset  = offset;
+    item.mLength  = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RecordedReport::RecordAttribute(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                           const StatusIB & aStatus)
+{
+    Item item = {};
+
+    item.mIsEvent       = false;
+    item.mAttributePath = aPath;
+    item.mStatus        = aStatus;
+    if (apData != nullptr)
+    {
+        ReturnErrorOnFailure(RecordPayload(*apData, item));
+    }
+    mItems.push_back(item);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RecordedReport::RecordEvent(const EventHeader & aEventHeader, TLV::TLVReader * apData, const StatusIB * apStatus)
+{
+    Item item = {};
+
+    item.mIsEvent     = true;
+    item.mEventHeader = aEventHeader;
+    if (apStatus != nullptr)
+    {
+        item.mHasStatus = true;
+        item.mStatus    = *apStatus;
+    }
+    if (apData != nullptr)
+    {
+        ReturnErrorOnFailure(RecordPayload(*apData, item));
+    }
+    mItems.push_back(item);
+    return CHIP_NO_ERROR;
+}
+
+void RecordedReport::Replay(ReadClient::Callback & callback, bool endReport) const
+{
+    callback.OnReportBegin();
+
+    for (const auto & item : mItems)
+    {
+        TLV::TLVReader reader;
+        if (item.mHasData)
+        {
+            reader.Init(mPayloads.data() + item.mOffset, item.mLength);
+            // We wrote this element ourselves, so it is there.
+            VerifyOrDie(reader.Next() == CHIP_NO_ERROR);
+        }
+
+        if (item.mIsEvent)
+        {
+            callback.OnEventData(item.mEventHeader, item.mHasData ? &reader : nullptr, item.mHasStatus ? &item.mStatus : nullptr);
+        }
+        else
+        {
+            callback.OnAttributeData(item.mAttributePath, item.mHasData ? &reader : nullptr, item.mStatus);
+        }
+    }
+
+    if (endReport)
+    {
+        callback.OnReportEnd();
+    }
+}
+
+void RecordedReport::Clear()
+{
+    mItems.clear();
+    mPayloads.clear();
+}
+
+void DeferredReportCallback::FallBackToPassThrough()
+{
+    ChipLogError(DataManagement, "Unable to defer report, delivering it synchronously");
+    mDispatcher.WaitUntilIdle(*this);
+    mReport.Replay(mCallback, /* endReport = */ false);
+    mReport.Clear();
+    mPassThrough = true;
+}
+
+void DeferredReportCallback::OnReportBegin()
+{
+    mReport.Clear();
+    mPassThrough = false;
+}
+
+void DeferredReportCallback::OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                             const StatusIB & aStatus)
+{
+    if (!mPassThrough && mReport.RecordAttribute(aPath, apData, aStatus) != CHIP_NO_ERROR)
+    {
+        FallBackToPassThrough();
+    }
+
+    if (mPassThrough)
+    {
+        mCallback.OnAttributeData(aPath, apData, aStatus);
+    }
+}
+
+void DeferredReportCallback::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData, const StatusIB * apStatus)
+{
+    if (!mPassThrough && mReport.RecordEvent(aEventHeader, apData, apStatus) != CHIP_NO_ERROR)
+    {
+        FallBackToPassThrough();
+    }
+
+    if (mPassThrough)
+    {
+        mCallback.OnEventData(aEventHeader, apData, apStatus);
+    }
+}
+
+void DeferredReportCallback::OnReportEnd()
+{
+    if (mPassThrough)
+    {
+        mPassThrough = false;
+        mCallback.OnReportEnd();
+        return;
+    }
+
+    CHIP_ERROR err = mDispatcher.Dispatch(*this, std::move(mReport));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Unable to dispatch report: %" CHIP_ERROR_FORMAT, err.Format());
+        mDispatcher.WaitUntilIdle(*this);
+        Deliver(mReport);
+    }
+    mReport.Clear();
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,208 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AppConfig.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/EventHeader.h>
+#include <app/MessageDef/StatusIB.h>
+#include <app/ReadClient.h>
+#include <lib/core/TLV.h>
+
+#include <cstdint>
+#include <vector>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+namespace chip {
+namespace app {
+
+/*
+ * An owned copy of everything that was delivered between one OnReportBegin and OnReportEnd: attribute data and
+ * statuses, event data and statuses, with their TLV payloads.
+ *
+ * It does not refer to any stack state, so it can be replayed into a ReadClient::Callback on any thread.
+ */
+class RecordedReport
+{
+public:
+    RecordedReport() = default;
+
+    RecordedReport(RecordedReport &&)             = default;
+    RecordedReport & operator=(RecordedReport &&) = default;
+
+    RecordedReport(const RecordedReport &)             = delete;
+    RecordedReport & operator=(const RecordedReport &) = delete;
+
+    CHIP_ERROR RecordAttribute(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus);
+    CHIP_ERROR RecordEvent(const EventHeader & aEventHeader, TLV::TLVReader * apData, const StatusIB * apStatus);
+
+    /*
+     * Deliver OnReportBegin, every recorded item in order and then (if endReport) OnReportEnd to `callback`.
+     */
+    void Replay(ReadClient::Callback & callback, bool endReport = true) const;
+
+    bool IsEmpty() const { return mItems.empty(); }
+    void Clear();
+
+private:
+    struct Item
+    {
+        bool mIsEvent;
+        bool mHasData;
+        bool mHasStatus;
+        ConcreteDataAttributePath mAttributePath;
+        EventHeader mEventHeader;
+        StatusIB mStatus;
+        // Where the item's TLV element lives in mPayloads.
+        size_t mOffset;
+        uint32_t mLength;
+    };
+
+    CHIP_ERROR RecordPayload(TLV::TLVReader & aData, Item & item);
+
+    std::vector<Item> mItems;
+    std::vector<uint8_t> mPayloads;
+};
+
+class DeferredReportCallback;
+
+/*
+ * Decides where the reports collected by DeferredReportCallback instances get delivered.
+ *
+ * Implementations must deliver the reports of a given DeferredReportCallback one at a time and in the order they
+ * were dispatched, by calling DeferredReportCallback::Deliver.
+ */
+class ReportDispatcher
+{
+public:
+    virtual ~ReportDispatcher() = default;
+
+    /*
+     * Arrange for `target.Deliver(report)` to be called. Returns an error if that is not possible, in which case
+     * `report` must be left untouched: it is then delivered right away on the calling thread.
+     */
+    virtual CHIP_ERROR Dispatch(DeferredReportCallback & target, RecordedReport && report) = 0;
+
+    /*
+     * Block until every report dispatched for `target` so far has been delivered.
+     */
+    virtual void WaitUntilIdle(DeferredReportCallback & target) = 0;
+};
+
+/*
+ * An adapter that collects each report from a ReadClient into a RecordedReport and hands it to a ReportDispatcher,
+ * so that the work of consuming reports (e.g. updating a ClusterStateCache and the application's reaction to it)
+ * can happen off the Matter thread, without holding the stack lock, and in parallel for different nodes.
+ *
+ * Only OnReportBegin/OnAttributeData/OnEventData/OnReportEnd are deferred. All other callbacks are forwarded on the
+ * calling thread, after waiting for the reports dispatched so far to be delivered. Since reports are only ever
+ * dispatched from the Matter thread, the wrapped callback is therefore never called from two threads at once.
+ *
+ * If a report cannot be recorded (out of memory) or dispatched, it is delivered on the calling thread instead.
+ *
+ * The wrapped callback must not use the stack (e.g. ReadClient, sessions) from its report callbacks.
+ */
+class DeferredReportCallback : public ReadClient::Callback
+{
+public:
+    DeferredReportCallback(Callback & callback, ReportDispatcher & dispatcher) : mCallback(callback), mDispatcher(dispatcher) {}
+    ~DeferredReportCallback() override { mDispatcher.WaitUntilIdle(*this); }
+
+    /*
+     * Called by the ReportDispatcher to deliver a report to the wrapped callback.
+     */
+    void Deliver(const RecordedReport & report) { report.Replay(mCallback); }
+
+private:
+    // Deliver what has been recorded of the current report right away and stop recording until the report ends.
+    void FallBackToPassThrough();
+
+    //
+    // ReadClient::Callback
+    //
+    void OnReportBegin() override;
+    void OnReportEnd() override;
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
+    void OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData, const StatusIB * apStatus) override;
+
+    void OnError(CHIP_ERROR aError) override
+    {
+        mDispatcher.WaitUntilIdle(*this);
+        mCallback.OnError(aError);
+    }
+
+    void OnDone(ReadClient * apReadClient) override
+    {
+        mDispatcher.WaitUntilIdle(*this);
+        mCallback.OnDone(apReadClient);
+    }
+
+    void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override
+    {
+        mDispatcher.WaitUntilIdle(*this);
+        mCallback.OnSubscriptionEstablished(aSubscriptionId);
+    }
+
+    CHIP_ERROR OnResubscriptionNeeded(ReadClient * apReadClient, CHIP_ERROR aTerminationCause) override
+    {
+        mDispatcher.WaitUntilIdle(*this);
+        return mCallback.OnResubscriptionNeeded(apReadClient, aTerminationCause);
+    }
+
+    void OnDeallocatePaths(chip::app::ReadPrepareParams && aReadPrepareParams) override
+    {
+        mDispatcher.WaitUntilIdle(*this);
+        mCallback.OnDeallocatePaths(std::move(aReadPrepareParams));
+    }
+
+    CHIP_ERROR OnUpdateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                             const Span<AttributePathParams> & aAttributePaths,
+                                             bool & aEncodedDataVersionList) override
+    {
+        mDispatcher.WaitUntilIdle(*this);
+        return mCallback.OnUpdateDataVersionFilterList(aDataVersionFilterIBsBuilder, aAttributePaths, aEncodedDataVersionList);
+    }
+
+    CHIP_ERROR GetHighestReceivedEventNumber(Optional<EventNumber> & aEventNumber) override
+    {
+        mDispatcher.WaitUntilIdle(*this);
+        return mCallback.GetHighestReceivedEventNumber(aEventNumber);
+    }
+
+    void OnUnsolicitedMessageFromPublisher(ReadClient * apReadClient) override
+    {
+        mDispatcher.WaitUntilIdle(*this);
+        mCallback.OnUnsolicitedMessageFromPublisher(apReadClient);
+    }
+
+    void OnCASESessionEstablished(const SessionHandle & aSession, ReadPrepareParams & aSubscriptionParams) override
+    {
+        mDispatcher.WaitUntilIdle(*this);
+        mCallback.OnCASESessionEstablished(aSession, aSubscriptionParams);
+    }
+
+    Callback & mCallback;
+    ReportDispatcher & mDispatcher;
+    RecordedReport mReport;
+    bool mPassThrough = false;
+};
+
+} // namespace app
+} // namespace chip
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
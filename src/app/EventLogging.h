@@ -25,6 +25,11 @@
 #include <app/data-model/FabricScoped.h>
 #include <app/data-model/List.h> // So we can encode lists
 #include <lib/core/DataModelTypes.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <tuple>
+#include <utility>
 
 namespace chip {
 namespace app {
@@ -85,5 +90,46 @@ CHIP_ERROR LogEvent(const T & aEventData, EndpointId aEndpoint, EventNumber & aE
     return EventManagement::GetInstance().LogEvent(&eventData, eventOptions, aEventNumber);
 }
 
+namespace detail {
+
+template <typename... T, size_t... I>
+CHIP_ERROR LogEvents(EndpointId aEndpoint, EventNumber * aEventNumbers, std::index_sequence<I...>, const T &... aEventData)
+{
+    std::tuple<EventLogger<T>...> eventData(aEventData...);
+    BatchedEvent events[] = { { &std::get<I>(eventData), EventOptions(aEndpoint, aEventData) }... };
+
+    ((aEventNumbers[I] = 0), ...);
+    // A fabric-sensitive event must be associated with a fabric to make sense.
+    VerifyOrReturnError(((!DataModel::IsFabricScoped<T>::value || events[I].mOptions.mFabricIndex != kUndefinedFabricIndex) && ...),
+                        CHIP_ERROR_INVALID_FABRIC_INDEX);
+
+    CHIP_ERROR err = EventManagement::GetInstance().LogEvents(Span<BatchedEvent>(events));
+    ((aEventNumbers[I] = events[I].mEventNumber), ...);
+    return err;
+}
+
+} // namespace detail
+
+/**
+ * @brief
+ *   Log several events produced together on the same endpoint, in the order given.
+ *
+ * See EventManagement::LogEvents.  This function is not safe to call outside of
+ * the Matter processing context either.
+ *
+ * @param[in] aEndpoint     The current cluster's Endpoint Id
+ * @param[out] aEventNumbers The event Number of each event if it was written to the
+ *                          log, 0 otherwise.
+ * @param[in] aEventData    The event cluster objects
+ *
+ * @return CHIP_ERROR  CHIP Error Code
+ */
+template <typename... T>
+CHIP_ERROR LogEvents(EndpointId aEndpoint, EventNumber (&aEventNumbers)[sizeof...(T)], const T &... aEventData)
+{
+    static_assert(sizeof...(T) > 0, "At least one event is expected");
+    return detail::LogEvents(aEndpoint, aEventNumbers, std::index_sequence_for<T...>(), aEventData...);
+}
+
 } // namespace app
 } // namespace chip
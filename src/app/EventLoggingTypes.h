@@ -165,6 +165,7 @@ struct EventLoadOutContext
     Timestamp mCurrentTime;
     EventNumber mCurrentEventNumber                                      = 0;
     size_t mEventCount                                                   = 0;
+    size_t mScannedEventCount                                            = 0;
     const SingleLinkedListNode<EventPathParams> * mpInterestedEventPaths = nullptr;
     bool mFirst                                                          = true;
     Access::SubjectDescriptor mSubjectDescriptor;
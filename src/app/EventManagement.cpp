@@ -23,6 +23,7 @@
 #include <app/InteractionModelEngine.h>
 #include <lib/core/TLVUtilities.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 #include <cassert>
@@ -84,7 +85,8 @@ CHIP_ERROR EventManagement::Init(Messaging::ExchangeManager * apExchangeManager,
                                  CircularEventBuffer * apCircularEventBuffer,
                                  const LogStorageResources * const apLogStorageResources,
                                  MonotonicallyIncreasingCounter<EventNumber> * apEventNumberCounter,
-                                 System::Clock::Milliseconds64 aMonotonicStartupTime, EventReporter * apEventReporter)
+                                 System::Clock::Milliseconds64 aMonotonicStartupTime, EventReporter * apEventReporter,
+                                 PersistentEventStore * apPersistentEventStore)
 {
     VerifyOrReturnError(apEventReporter != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(aNumBuffers != 0, CHIP_ERROR_INVALID_ARGUMENT);
@@ -117,13 +119,131 @@ CHIP_ERROR EventManagement::Init(Messaging::ExchangeManager * apExchangeManager,
     mState        = EventManagementStates::Idle;
     mBytesWritten = 0;
 
+    mScannedEventCount   = 0;
+    mDeliveredEventCount = 0;
+
     mMonotonicStartupTime = aMonotonicStartupTime;
 
     mpEventReporter = apEventReporter;
 
+    mpPersistentEventStore = apPersistentEventStore;
+    if (mpPersistentEventStore != nullptr)
+    {
+        CHIP_ERROR err = LoadPersistedEvents();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(EventLogging, "Failed to load persisted events: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR EventManagement::LoadPersistedEvents()
+{
+    struct PersistedEvents
+    {
+        PersistentEventStore::Cursor mCursor;
+        ByteSpan mEvent;
+        EventNumber mEventNumber = 0;
+        bool mHasEvent           = false;
+    };
+    PersistedEvents persisted[kNumPriorityLevel];
+    size_t loaded = 0;
+
+    // Read the next stored event of the priority, skipping any that cannot be parsed.
+    auto readNext = [this](PriorityLevel priority, PersistedEvents & events) -> CHIP_ERROR {
+        events.mHasEvent = false;
+        while (true)
+        {
+            PersistentEventStore::Cursor at;
+            CHIP_ERROR err = mpPersistentEventStore->ReadNext(priority, events.mCursor, at, events.mEvent);
+            VerifyOrReturnError(err != CHIP_ERROR_NOT_FOUND, CHIP_NO_ERROR);
+            ReturnErrorOnFailure(err);
+
+            TLVReader reader;
+            EventReportIB::Parser report;
+            EventDataIB::Parser data;
+            reader.Init(events.mEvent);
+            if (reader.Next() == CHIP_NO_ERROR && report.Init(reader) == CHIP_NO_ERROR &&
+                report.GetEventData(&data) == CHIP_NO_ERROR && data.GetEventNumber(&events.mEventNumber) == CHIP_NO_ERROR)
+            {
+                events.mHasEvent = true;
+                return CHIP_NO_ERROR;
+            }
+            ChipLogError(EventLogging, "Skipping unreadable persisted event");
+        }
+    };
+
+    for (size_t i = 0; i < kNumPriorityLevel; i++)
+    {
+        if (mpPersistentEventStore->Accepts(static_cast<PriorityLevel>(i)))
+        {
+            ReturnErrorOnFailure(readNext(static_cast<PriorityLevel>(i), persisted[i]));
+        }
+    }
+
+    // The events of each priority are stored in event number order; merge them to log them in the order they
+    // were first logged.
+    while (true)
+    {
+        size_t next = kNumPriorityLevel;
+        for (size_t i = 0; i < kNumPriorityLevel; i++)
+        {
+            if (persisted[i].mHasEvent && (next == kNumPriorityLevel || persisted[i].mEventNumber < persisted[next].mEventNumber))
+            {
+                next = i;
+            }
+        }
+        if (next == kNumPriorityLevel)
+        {
+            break;
+        }
+
+        PersistedEvents & events = persisted[next];
+        // Event numbers at or past the current one will be vended again; keep them from being reported twice.
+        if (events.mEventNumber < mLastEventNumber)
+        {
+            ReturnErrorOnFailure(LoadPersistedEvent(static_cast<PriorityLevel>(next), events.mEventNumber, events.mEvent));
+            loaded++;
+        }
+        ReturnErrorOnFailure(readNext(static_cast<PriorityLevel>(next), events));
+    }
+
+    ChipLogProgress(EventLogging, "Loaded %u persisted events", static_cast<unsigned>(loaded));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::LoadPersistedEvent(PriorityLevel aPriority, EventNumber aEventNumber, ByteSpan aEvent)
+{
+    const uint8_t * eventStart;
+
+    // Anything logged before has its room made in the same way, so the buffers keep the most recent events.
+    ReturnErrorOnFailure(WriteEncodedEvent(aPriority, aEvent, eventStart));
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    if (aEventNumber % CHIP_CONFIG_EVENT_NUMBER_INDEX_INTERVAL == 0)
+    {
+        mpEventBuffer->AddIndexEntry(aEventNumber, eventStart);
+    }
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::WriteEncodedEvent(PriorityLevel aPriority, const ByteSpan & aEvent, const uint8_t *& aEventStart)
+{
+    CircularTLVWriter writer;
+    TLVReader reader;
+    reader.Init(aEvent);
+    ReturnErrorOnFailure(reader.Next());
+
+    ReturnErrorOnFailure(EnsureSpaceInCircularBuffer(aEvent.size(), aPriority));
+
+    aEventStart = mpEventBuffer->QueueTail();
+    writer.Init(*mpEventBuffer);
+    ReturnErrorOnFailure(writer.CopyElement(reader));
+    return writer.Finalize();
+}
+
 CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
 {
     CircularTLVWriter writer;
@@ -135,6 +255,10 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
     CircularEventBuffer backup = *nextBuffer;
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    const uint8_t * destination = nextBuffer->QueueTail();
+    EventNumber eventNumber;
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
 
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
@@ -153,6 +277,14 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = writer.Finalize();
     SuccessOrExit(err);
 
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    // The event keeps its index entry, if it has one, in the next buffer.
+    if (apEventBuffer->GetIndexedHeadEvent(eventNumber))
+    {
+        nextBuffer->AddIndexEntry(eventNumber, destination);
+    }
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
@@ -197,7 +329,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
 
             eventBuffer->mProcessEvictedElement = EvictEvent;
             eventBuffer->mAppData               = &ctx;
-            err                                 = eventBuffer->EvictHead();
+            err                                 = eventBuffer->EvictHeadEvent();
 
             // one of two things happened: either the element was evicted immediately if the head's priority is same as current
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
@@ -219,7 +351,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     SuccessOrExit(err);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
-                    err                                 = eventBuffer->EvictHead();
+                    err                                 = eventBuffer->EvictHeadEvent();
                     // if unconditional eviction failed, this
                     // means that we have no way of further
                     // clearing the buffer.  fail out and let the
@@ -262,26 +394,27 @@ exit:
     return err;
 }
 
-CHIP_ERROR EventManagement::CalculateEventSize(EventLoggingDelegate * apDelegate, const InternalEventOptions * apOptions,
-                                               uint32_t & requiredSize)
+CHIP_ERROR EventManagement::EncodeEvent(EventLoggingDelegate * apDelegate, const InternalEventOptions * apOptions,
+                                        System::PacketBufferHandle & aEncodedEvent)
 {
     System::PacketBufferTLVWriter writer;
-    EventLoadOutContext ctxt       = EventLoadOutContext(writer, apOptions->mPriority, GetLastEventNumber());
-    System::PacketBufferHandle buf = System::PacketBufferHandle::New(kMaxEventSizeReserve);
-    if (buf.IsNull())
+    EventLoadOutContext ctxt = EventLoadOutContext(writer, apOptions->mPriority, GetLastEventNumber());
+    if (aEncodedEvent.IsNull())
+    {
+        aEncodedEvent = System::PacketBufferHandle::New(kMaxEventSizeReserve);
+        VerifyOrReturnError(!aEncodedEvent.IsNull(), CHIP_ERROR_NO_MEMORY);
+    }
+    else
     {
-        return CHIP_ERROR_NO_MEMORY;
+        // Reuse the buffer the previous event of a batch was encoded in.
+        aEncodedEvent->SetDataLength(0);
     }
-    writer.Init(std::move(buf));
+    writer.Init(std::move(aEncodedEvent));
 
     ctxt.mCurrentEventNumber = mLastEventNumber;
     ctxt.mCurrentTime        = mLastEventTimestamp;
-    CHIP_ERROR err           = ConstructEvent(&ctxt, apDelegate, apOptions);
-    if (err == CHIP_NO_ERROR)
-    {
-        requiredSize = writer.GetLengthWritten();
-    }
-    return err;
+    ReturnErrorOnFailure(ConstructEvent(&ctxt, apDelegate, apOptions));
+    return writer.Finalize(&aEncodedEvent);
 }
 
 CHIP_ERROR EventManagement::ConstructEvent(EventLoadOutContext * apContext, EventLoggingDelegate * apDelegate,
@@ -356,6 +489,8 @@ void EventManagement::DestroyEventManagement()
     sInstance.mState        = EventManagementStates::Shutdown;
     sInstance.mpEventBuffer = nullptr;
     sInstance.mpExchangeMgr = nullptr;
+
+    sInstance.mpPersistentEventStore = nullptr;
 }
 
 CircularEventBuffer * EventManagement::GetPriorityBuffer(PriorityLevel aPriority) const
@@ -415,72 +550,94 @@ CHIP_ERROR EventManagement::LogEvent(EventLoggingDelegate * apDelegate, const Ev
 {
     assertChipStackLockedByCurrentThread();
     VerifyOrReturnError(mState != EventManagementStates::Shutdown, CHIP_ERROR_INCORRECT_STATE);
-    return LogEventPrivate(apDelegate, aEventOptions, aEventNumber);
+
+    System::PacketBufferHandle encodedEvent;
+    return LogEventPrivate(apDelegate, aEventOptions, GetCurrentTimestamp(), encodedEvent, aEventNumber);
 }
 
-CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions,
-                                            EventNumber & aEventNumber)
+CHIP_ERROR EventManagement::LogEvents(Span<BatchedEvent> aEvents)
+{
+    assertChipStackLockedByCurrentThread();
+    for (auto & event : aEvents)
+    {
+        event.mEventNumber = 0;
+    }
+    VerifyOrReturnError(mState != EventManagementStates::Shutdown, CHIP_ERROR_INCORRECT_STATE);
+
+    const Timestamp timestamp = GetCurrentTimestamp();
+    System::PacketBufferHandle encodedEvent;
+    for (auto & event : aEvents)
+    {
+        ReturnErrorOnFailure(LogEventPrivate(event.mpDelegate, event.mOptions, timestamp, encodedEvent, event.mEventNumber));
+    }
+    return CHIP_NO_ERROR;
+}
+
+Timestamp EventManagement::GetCurrentTimestamp() const
 {
-    CircularTLVWriter writer;
-    CHIP_ERROR err               = CHIP_NO_ERROR;
-    uint32_t requestSize         = 0;
-    aEventNumber                 = 0;
-    CircularTLVWriter checkpoint = writer;
-    EventLoadOutContext ctxt     = EventLoadOutContext(writer, aEventOptions.mPriority, mLastEventNumber);
-    InternalEventOptions opts;
-
-    Timestamp timestamp;
 #if CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
     System::Clock::Milliseconds64 utc_time;
-    err = System::SystemClock().GetClock_RealTimeMS(utc_time);
-    if (err == CHIP_NO_ERROR)
+    if (System::SystemClock().GetClock_RealTimeMS(utc_time) == CHIP_NO_ERROR)
     {
-        timestamp = Timestamp::Epoch(utc_time);
+        return Timestamp::Epoch(utc_time);
     }
-    else
 #endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
-    {
-        auto systemTimeMs = System::SystemClock().GetMonotonicMilliseconds64() - mMonotonicStartupTime;
-        timestamp         = Timestamp::System(systemTimeMs);
-    }
 
-    opts = InternalEventOptions(timestamp);
-    // Start the event container (anonymous structure) in the circular buffer
-    writer.Init(*mpEventBuffer);
+    auto systemTimeMs = System::SystemClock().GetMonotonicMilliseconds64() - mMonotonicStartupTime;
+    return Timestamp::System(systemTimeMs);
+}
 
-    opts.mPriority = aEventOptions.mPriority;
-    // Create all event specific data
-    // Timestamp; encoded as a delta time
+CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions,
+                                            Timestamp aTimestamp, System::PacketBufferHandle & aEncodedEvent,
+                                            EventNumber & aEventNumber)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    InternalEventOptions opts(aTimestamp);
+    ByteSpan encodedEvent;
+    const uint8_t * eventStart = nullptr;
+    aEventNumber               = 0;
 
+    opts.mPriority    = aEventOptions.mPriority;
     opts.mPath        = aEventOptions.mPath;
     opts.mFabricIndex = aEventOptions.mFabricIndex;
 
-    ctxt.mCurrentEventNumber = mLastEventNumber;
-    ctxt.mCurrentTime.mValue = mLastEventTimestamp.mValue;
-
-    err = CalculateEventSize(apDelegate, &opts, requestSize);
-    SuccessOrExit(err);
-
-    // Ensure we have space in the in-memory logging queues
-    err = EnsureSpaceInCircularBuffer(requestSize, aEventOptions.mPriority);
+    // The event is encoded once, which also gives the space it needs, and the encoding is then copied to the buffers
+    // (and to the persistent event store, if it keeps the event).
+    err = EncodeEvent(apDelegate, &opts, aEncodedEvent);
     SuccessOrExit(err);
+    encodedEvent = ByteSpan(aEncodedEvent->Start(), aEncodedEvent->DataLength());
 
-    err = ConstructEvent(&ctxt, apDelegate, &opts);
+    err = WriteEncodedEvent(opts.mPriority, encodedEvent, eventStart);
     SuccessOrExit(err);
 
-    mBytesWritten += writer.GetLengthWritten();
+    mBytesWritten += static_cast<uint32_t>(encodedEvent.size());
 
 exit:
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(EventLogging, "Log event with error %" CHIP_ERROR_FORMAT, err.Format());
-        writer = checkpoint;
     }
     else if (opts.mPriority >= CHIP_CONFIG_EVENT_GLOBAL_PRIORITY)
     {
         aEventNumber = mLastEventNumber;
         VendEventNumber();
-        mLastEventTimestamp = timestamp;
+        mLastEventTimestamp = aTimestamp;
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+        if (aEventNumber % CHIP_CONFIG_EVENT_NUMBER_INDEX_INTERVAL == 0)
+        {
+            mpEventBuffer->AddIndexEntry(aEventNumber, eventStart);
+        }
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+        // A system timestamp means nothing after a restart, so only events with an epoch timestamp are persisted.
+        if (mpPersistentEventStore != nullptr && aTimestamp.IsEpoch() && mpPersistentEventStore->Accepts(opts.mPriority))
+        {
+            CHIP_ERROR persistErr = mpPersistentEventStore->Append(opts.mPriority, encodedEvent);
+            if (persistErr != CHIP_NO_ERROR)
+            {
+                ChipLogError(EventLogging, "Failed to persist event 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                             ChipLogValueX64(aEventNumber), persistErr.Format());
+            }
+        }
 #if CHIP_CONFIG_EVENT_LOGGING_VERBOSE_DEBUG_LOGS
         ChipLogDetail(EventLogging,
                       "LogEvent event number: 0x" ChipLogFormatX64 " priority: %u, endpoint id:  0x%x"
@@ -524,22 +681,14 @@ CHIP_ERROR EventManagement::CopyEvent(const TLVReader & aReader, TLVWriter & aWr
     return CHIP_NO_ERROR;
 }
 
-bool EventManagement::IncludeEventInReport(EventLoadOutContext * eventLoadOutContext,
-                                           const EventManagement::EventEnvelopeContext & event)
+bool EventManagement::IsEventHeaderOfInterest(EventLoadOutContext * eventLoadOutContext,
+                                              const EventManagement::EventEnvelopeContext & event)
 {
     if (eventLoadOutContext->mCurrentEventNumber < eventLoadOutContext->mStartingEventNumber)
     {
         return false;
     }
 
-    if (event.mFabricIndex.HasValue() &&
-        (event.mFabricIndex.Value() == kUndefinedFabricIndex ||
-         eventLoadOutContext->mSubjectDescriptor.fabricIndex != event.mFabricIndex.Value()))
-    {
-        return false;
-    }
-
-    bool isPathInterested = false;
     ConcreteEventPath path(event.mEndpointId, event.mClusterId, event.mEventId);
     // Check whether the event path is in the interested paths
     for (auto * interestedPath = eventLoadOutContext->mpInterestedEventPaths; interestedPath != nullptr;
@@ -547,15 +696,28 @@ bool EventManagement::IncludeEventInReport(EventLoadOutContext * eventLoadOutCon
     {
         if (interestedPath->mValue.IsEventPathSupersetOf(path))
         {
-            isPathInterested = true;
-            break;
+            return true;
         }
     }
-    if (!isPathInterested)
+    return false;
+}
+
+bool EventManagement::IncludeEventInReport(EventLoadOutContext * eventLoadOutContext,
+                                           const EventManagement::EventEnvelopeContext & event)
+{
+    if (!IsEventHeaderOfInterest(eventLoadOutContext, event))
+    {
+        return false;
+    }
+
+    if (event.mFabricIndex.HasValue() &&
+        (event.mFabricIndex.Value() == kUndefinedFabricIndex ||
+         eventLoadOutContext->mSubjectDescriptor.fabricIndex != event.mFabricIndex.Value()))
     {
         return false;
     }
 
+    ConcreteEventPath path(event.mEndpointId, event.mClusterId, event.mEventId);
     DataModel::EventEntry eventInfo;
     if (InteractionModelEngine::GetInstance()->GetDataModelProvider()->EventInfo(path, eventInfo) != CHIP_NO_ERROR)
     {
@@ -603,7 +765,22 @@ CHIP_ERROR EventManagement::EventIterator(const TLVReader & aReader, size_t aDep
     ReturnErrorOnFailure(innerReader.Next());
 
     ReturnErrorOnFailure(innerReader.EnterContainer(tlvType1));
-    err = TLV::Utilities::Iterate(innerReader, FetchEventParameters, event, false /*recurse*/);
+    while ((err = innerReader.Next()) == CHIP_NO_ERROR)
+    {
+        // The path, the event number and the timestamp are written ahead of the event data, so an event that is not
+        // going to be reported can be skipped before going through its data.
+        if ((innerReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kData)) && (event->mFieldsToRead == kRequiredEventField))
+        {
+            apEventLoadOutContext->mCurrentTime        = event->mCurrentTime;
+            apEventLoadOutContext->mCurrentEventNumber = event->mEventNumber;
+            if (!IsEventHeaderOfInterest(apEventLoadOutContext, *event))
+            {
+                encodeEvent = false;
+                return CHIP_NO_ERROR;
+            }
+        }
+        ReturnErrorOnFailure(FetchEventParameters(innerReader, aDepth, event));
+    }
 
     if (event->mFieldsToRead != kRequiredEventField)
     {
@@ -628,7 +805,8 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
     EventLoadOutContext * const loadOutContext = static_cast<EventLoadOutContext *>(apContext);
     EventEnvelopeContext event;
     bool encodeEvent = false;
-    CHIP_ERROR err   = EventIterator(aReader, aDepth, loadOutContext, &event, encodeEvent);
+    loadOutContext->mScannedEventCount++;
+    CHIP_ERROR err = EventIterator(aReader, aDepth, loadOutContext, &event, encodeEvent);
     if ((err == CHIP_NO_ERROR) && encodeEvent)
     {
         // checkpoint the writer
@@ -666,7 +844,7 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
+    err                            = GetEventReaderSince(reader, aEventMin, &bufWrapper);
     SuccessOrExit(err);
 
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
@@ -687,6 +865,8 @@ exit:
         aEventMin = context.mCurrentEventNumber + 1;
     }
     aEventCount += context.mEventCount;
+    mScannedEventCount += context.mScannedEventCount;
+    mDeliveredEventCount += context.mEventCount;
     return err;
 }
 
@@ -746,9 +926,66 @@ CHIP_ERROR EventManagement::FabricRemoved(FabricIndex aFabricIndex)
     {
         err = CHIP_NO_ERROR;
     }
+    ReturnErrorOnFailure(err);
+
+    if (mpPersistentEventStore != nullptr)
+    {
+        err = FabricRemovedFromPersistentEventStore(aFabricIndex);
+    }
     return err;
 }
 
+CHIP_ERROR EventManagement::FabricRemovedFromPersistentEventStore(FabricIndex aFabricIndex)
+{
+    for (auto priority : { PriorityLevel::Debug, PriorityLevel::Info, PriorityLevel::Critical })
+    {
+        if (!mpPersistentEventStore->Accepts(priority))
+        {
+            continue;
+        }
+
+        PersistentEventStore::Cursor cursor;
+        PersistentEventStore::Cursor at;
+        ByteSpan event;
+        CHIP_ERROR err;
+        while ((err = mpPersistentEventStore->ReadNext(priority, cursor, at, event)) == CHIP_NO_ERROR)
+        {
+            TLVReader reader;
+            TLVType tlvType;
+            TLVType tlvType1;
+            reader.Init(event);
+            VerifyOrReturnError(reader.Next() == CHIP_NO_ERROR, CHIP_ERROR_INTERNAL);
+            VerifyOrReturnError(reader.EnterContainer(tlvType) == CHIP_NO_ERROR, CHIP_ERROR_INTERNAL);
+            VerifyOrReturnError(reader.Next(TLV::ContextTag(EventReportIB::Tag::kEventData)) == CHIP_NO_ERROR,
+                                CHIP_ERROR_INTERNAL);
+            VerifyOrReturnError(reader.EnterContainer(tlvType1) == CHIP_NO_ERROR, CHIP_ERROR_INTERNAL);
+
+            uint8_t fabricIndex = kUndefinedFabricIndex;
+            while (reader.Next() == CHIP_NO_ERROR)
+            {
+                if (reader.GetTag() == TLV::ProfileTag(kEventManagementProfile, kFabricIndexTag))
+                {
+                    TEMPORARY_RETURN_IGNORED reader.Get(fabricIndex);
+                    break;
+                }
+            }
+            if (fabricIndex != aFabricIndex)
+            {
+                continue;
+            }
+
+            // As in FabricRemovedCB, the fabric index is assumed to be the one byte right before the read point.
+            Platform::ScopedMemoryBuffer<uint8_t> scrubbed;
+            VerifyOrReturnError(scrubbed.Alloc(event.size()), CHIP_ERROR_NO_MEMORY);
+            memcpy(scrubbed.Get(), event.data(), event.size());
+            scrubbed[static_cast<size_t>(reader.GetReadPoint() - event.data()) - 1] = kUndefinedFabricIndex;
+            ReturnErrorOnFailure(mpPersistentEventStore->Overwrite(priority, at, ByteSpan(scrubbed.Get(), event.size())));
+        }
+        VerifyOrReturnError(err == CHIP_ERROR_NOT_FOUND, err);
+    }
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR EventManagement::GetEventReader(TLVReader & aReader, PriorityLevel aPriority, CircularEventBufferWrapper * apBufWrapper)
 {
     CircularEventBuffer * buffer = GetPriorityBuffer(aPriority);
@@ -762,6 +999,30 @@ CHIP_ERROR EventManagement::GetEventReader(TLVReader & aReader, PriorityLevel aP
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR EventManagement::GetEventReaderSince(TLVReader & aReader, EventNumber aEventNumber,
+                                                CircularEventBufferWrapper * apBufWrapper)
+{
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    // Events only get older along the buffer chain, so the first buffer with a usable index entry has the closest one.
+    for (CircularEventBuffer * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        const uint8_t * startPoint = buffer->FindIndexedEvent(aEventNumber);
+        if (startPoint != nullptr)
+        {
+            apBufWrapper->mpCurrent    = buffer;
+            apBufWrapper->mpStartPoint = startPoint;
+
+            CircularEventReader reader;
+            reader.Init(apBufWrapper);
+            aReader.Init(reader);
+            return CHIP_NO_ERROR;
+        }
+    }
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+
+    return GetEventReader(aReader, PriorityLevel::Critical, apBufWrapper);
+}
+
 CHIP_ERROR EventManagement::FetchEventParameters(const TLVReader & aReader, size_t, void * apContext)
 {
     EventEnvelopeContext * const envelope = static_cast<EventEnvelopeContext *>(apContext);
@@ -882,8 +1143,73 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mpPrev    = apPrev;
     mpNext    = apNext;
     mPriority = aPriorityLevel;
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    mIndexFirst = 0;
+    mIndexCount = 0;
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+}
+
+CHIP_ERROR CircularEventBuffer::EvictHeadEvent()
+{
+    ReturnErrorOnFailure(EvictHead());
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    TrimIndex();
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    return CHIP_NO_ERROR;
+}
+
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+void CircularEventBuffer::AddIndexEntry(EventNumber aEventNumber, const uint8_t * aPosition)
+{
+    if (mIndexCount == CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE)
+    {
+        mIndexFirst = (mIndexFirst + 1) % CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE;
+        mIndexCount--;
+    }
+
+    IndexEntry & entry = mIndex[(mIndexFirst + mIndexCount) % CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE];
+    entry.mEventNumber = aEventNumber;
+    entry.mOffset      = static_cast<uint32_t>(aPosition - GetQueue());
+    mIndexCount++;
+}
+
+bool CircularEventBuffer::IsInBuffer(const IndexEntry & aEntry) const
+{
+    // The buffer holds the DataLength() bytes following the head, wrapping around the end of the storage.
+    const uint32_t distance = (aEntry.mOffset + GetTotalDataLength() - HeadOffset()) % GetTotalDataLength();
+    return distance < DataLength();
 }
 
+void CircularEventBuffer::TrimIndex()
+{
+    while (mIndexCount > 0 && !IsInBuffer(GetIndexEntry(0)))
+    {
+        mIndexFirst = (mIndexFirst + 1) % CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE;
+        mIndexCount--;
+    }
+}
+
+bool CircularEventBuffer::GetIndexedHeadEvent(EventNumber & aEventNumber) const
+{
+    VerifyOrReturnValue(mIndexCount > 0 && GetIndexEntry(0).mOffset == HeadOffset(), false);
+    aEventNumber = GetIndexEntry(0).mEventNumber;
+    return true;
+}
+
+const uint8_t * CircularEventBuffer::FindIndexedEvent(EventNumber aEventNumber) const
+{
+    for (size_t i = mIndexCount; i > 0; i--)
+    {
+        const IndexEntry & entry = GetIndexEntry(i - 1);
+        if (entry.mEventNumber <= aEventNumber)
+        {
+            return GetQueue() + entry.mOffset;
+        }
+    }
+    return nullptr;
+}
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
 {
     return !((mpNext != nullptr) && (mpNext->mPriority <= aPriority));
@@ -907,20 +1233,38 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
     if (apBufWrapper->mpCurrent == nullptr)
         return;
 
-    TEMPORARY_RETURN_IGNORED TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLength());
-    mMaxLen = apBufWrapper->mpCurrent->DataLength();
+    uint32_t maxLen = apBufWrapper->mpCurrent->DataLength();
+    if (apBufWrapper->mpStartPoint != nullptr)
+    {
+        // Leave out the events between the head and the start point, accounting for wraparound.
+        const uint32_t size = apBufWrapper->mpCurrent->GetTotalDataLength();
+        maxLen -= static_cast<uint32_t>(apBufWrapper->mpStartPoint - apBufWrapper->mpCurrent->QueueHead() + size) % size;
+    }
+
+    // Add up the lengths before initializing the reader, which moves mpCurrent past any empty buffer.
     for (prev = apBufWrapper->mpCurrent->GetPreviousCircularEventBuffer(); prev != nullptr;
          prev = prev->GetPreviousCircularEventBuffer())
     {
-        CircularEventBufferWrapper bufWrapper;
-        bufWrapper.mpCurrent = prev;
-        mMaxLen += prev->DataLength();
+        maxLen += prev->DataLength();
     }
+
+    TEMPORARY_RETURN_IGNORED TLVReader::Init(*apBufWrapper, maxLen);
 }
 
 CHIP_ERROR CircularEventBufferWrapper::GetNextBuffer(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
+    if ((aBufStart == nullptr) && (mpStartPoint != nullptr))
+    {
+        // Start in the middle of the buffer: read up to the tail, or to the end of the storage if the data wraps around.
+        const uint8_t * tail = mpCurrent->QueueTail();
+        const uint8_t * end  = mpCurrent->GetQueue() + mpCurrent->GetTotalDataLength();
+        aBufStart            = mpStartPoint;
+        aBufLen              = static_cast<uint32_t>(((aBufStart < tail) ? tail : end) - aBufStart);
+        mpStartPoint         = nullptr;
+        return CHIP_NO_ERROR;
+    }
+
     TEMPORARY_RETURN_IGNORED mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
     SuccessOrExit(err);
 
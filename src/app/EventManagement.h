@@ -32,11 +32,13 @@
 #include <app/EventReporter.h>
 #include <app/MessageDef/EventDataIB.h>
 #include <app/MessageDef/StatusIB.h>
+#include <app/PersistentEventStore.h>
 #include <app/data-model-provider/EventsGenerator.h>
 #include <app/util/basic-types.h>
 #include <lib/core/TLVCircularBuffer.h>
 #include <lib/support/CHIPCounter.h>
 #include <lib/support/LinkedList.h>
+#include <lib/support/Span.h>
 #include <messaging/ExchangeMgr.h>
 #include <platform/CHIPDeviceConfig.h>
 #include <system/SystemClock.h>
@@ -130,9 +132,60 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Evict the event at the head of the buffer, as TLVCircularBuffer::EvictHead does, and drop its event number index
+     *   entry if it has one.
+     */
+    CHIP_ERROR EvictHeadEvent();
+
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    /**
+     * @brief
+     *   Record in the event number index that the event with number aEventNumber starts at aPosition in this buffer.
+     *   Entries must be added in increasing event number order.  If the index is full, its oldest entry is dropped.
+     */
+    void AddIndexEntry(EventNumber aEventNumber, const uint8_t * aPosition);
+
+    /**
+     * @brief
+     *   Get the event number of the event at the head of the buffer, if that event is indexed.
+     */
+    bool GetIndexedHeadEvent(EventNumber & aEventNumber) const;
+
+    /**
+     * @brief
+     *   Find the indexed event with the largest event number that is not greater than aEventNumber.
+     *
+     * @return The position of that event in the buffer, or nullptr if there is none.
+     */
+    const uint8_t * FindIndexedEvent(EventNumber aEventNumber) const;
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+
     ~CircularEventBuffer() override = default;
 
 private:
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    struct IndexEntry
+    {
+        EventNumber mEventNumber;
+        uint32_t mOffset; ///< Offset of the event from the start of the storage, not from the head
+    };
+
+    const IndexEntry & GetIndexEntry(size_t aIndex) const
+    {
+        return mIndex[(mIndexFirst + aIndex) % CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE];
+    }
+    uint32_t HeadOffset() const { return static_cast<uint32_t>(QueueHead() - GetQueue()) % GetTotalDataLength(); }
+    bool IsInBuffer(const IndexEntry & aEntry) const;
+    // Drop the index entries of the events that are no longer in the buffer.
+    void TrimIndex();
+
+    IndexEntry mIndex[CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE] = {};
+    size_t mIndexFirst                                     = 0;
+    size_t mIndexCount                                     = 0;
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+
     CircularEventBuffer * mpPrev = nullptr; ///< A pointer CircularEventBuffer storing events less important events
     CircularEventBuffer * mpNext = nullptr; ///< A pointer CircularEventBuffer storing events more important events
 
@@ -157,6 +210,8 @@ class CircularEventBufferWrapper : public TLV::TLVCircularBuffer
 public:
     CircularEventBufferWrapper() : TLVCircularBuffer(nullptr, 0), mpCurrent(nullptr){};
     CircularEventBuffer * mpCurrent;
+    // If not null, where in mpCurrent to start reading instead of its head.  Must be the start of an event.
+    const uint8_t * mpStartPoint = nullptr;
 
 private:
     CHIP_ERROR GetNextBuffer(chip::TLV::TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override;
@@ -191,6 +246,17 @@ struct LogStorageResources
         PriorityLevel::Invalid; // Log priority level associated with the resources provided in this structure.
 };
 
+/**
+ * @brief
+ *   An event to log with EventManagement::LogEvents.
+ */
+struct BatchedEvent
+{
+    EventLoggingDelegate * mpDelegate = nullptr;
+    EventOptions mOptions;
+    EventNumber mEventNumber = 0; ///< The event number once the event is logged, 0 if it is not.
+};
+
 /**
  * @brief
  *   A class for managing the in memory event logs.  See documentation at the
@@ -235,13 +301,19 @@ public:
      *
      * @param[in] apEventReporter       Event reporter to be notified when events are generated.
      *
+     * @param[in] apPersistentEventStore Optional store for the events to outlive a restart.  The
+     *                                   events it holds are loaded into the buffers (as many of the
+     *                                   most recent ones as fit), and the epoch-timestamped events
+     *                                   logged from now on with a priority it accepts are added to it.
+     *
      * @return CHIP_ERROR               CHIP Error Code
      *
      */
     CHIP_ERROR Init(Messaging::ExchangeManager * apExchangeManager, uint32_t aNumBuffers,
                     CircularEventBuffer * apCircularEventBuffer, const LogStorageResources * const apLogStorageResources,
                     MonotonicallyIncreasingCounter<EventNumber> * apEventNumberCounter,
-                    System::Clock::Milliseconds64 aMonotonicStartupTime, EventReporter * apEventReporter);
+                    System::Clock::Milliseconds64 aMonotonicStartupTime, EventReporter * apEventReporter,
+                    PersistentEventStore * apPersistentEventStore = nullptr);
 
     static EventManagement & GetInstance();
 
@@ -309,6 +381,21 @@ public:
      */
     CHIP_ERROR LogEvent(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions, EventNumber & aEventNumber);
 
+    /**
+     * @brief
+     *   Log several events produced together, as LogEvent does for each of them in turn.
+     *
+     * The events of a batch share one timestamp, and the buffer their encodings are staged in,
+     * so that logging them together costs less than logging them one by one.  Logging stops at
+     * the first event that fails to be logged; the events before it stay logged.
+     *
+     * @param[in,out] aEvents The events to log.  The mEventNumber of each is set to its event
+     *                        Number if it was written to the log, 0 otherwise.
+     *
+     * @return CHIP_ERROR  CHIP Error Code
+     */
+    CHIP_ERROR LogEvents(Span<BatchedEvent> aEvents);
+
     /**
      * @brief
      *   A helper method to get tlv reader along with buffer has data from particular priority
@@ -332,6 +419,24 @@ public:
     CHIP_ERROR GetEventReader(chip::TLV::TLVReader & aReader, PriorityLevel aPriority,
                               app::CircularEventBufferWrapper * apBufWrapper);
 
+    /**
+     * @brief
+     *   A helper method to get a tlv reader over all the buffers that skips the events known, from the event number index,
+     *   to have an event number lower than aEventNumber.  Without an index entry to start from, this reads all the events,
+     *   like GetEventReader with PriorityLevel::Critical.
+     *
+     * @param[in,out] aReader A reference to the reader that will be
+     *                        initialized with the backing storage from
+     *                        the event log
+     *
+     * @param[in] aEventNumber The lowest event number the caller is interested in.
+     *
+     * @param[in] apBufWrapper CircularEventBufferWrapper
+     * @return                 #CHIP_NO_ERROR Unconditionally.
+     */
+    CHIP_ERROR GetEventReaderSince(chip::TLV::TLVReader & aReader, EventNumber aEventNumber,
+                                   app::CircularEventBufferWrapper * apBufWrapper);
+
     /**
      * @brief
      *   A function to retrieve events of specified priority since a specified event ID.
@@ -381,6 +486,14 @@ public:
      */
     EventNumber GetLastEventNumber() const { return mLastEventNumber; }
 
+    /**
+     * @brief
+     *   The number of events FetchEventsSince has looked at since Init, and how many of those it put in reports.  Events
+     *   that are scanned but not delivered are older than what was asked for, not on an interested path, or not accessible.
+     */
+    uint64_t GetScannedEventCount() const { return mScannedEventCount; }
+    uint64_t GetDeliveredEventCount() const { return mDeliveredEventCount; }
+
     /**
      * @brief
      *   IsValid returns whether the EventManagement instance is valid
@@ -432,8 +545,20 @@ private:
     };
 
     void VendEventNumber();
-    CHIP_ERROR CalculateEventSize(EventLoggingDelegate * apDelegate, const InternalEventOptions * apOptions,
-                                  uint32_t & requiredSize);
+    Timestamp GetCurrentTimestamp() const;
+    /**
+     * @brief Encode the next event into aEncodedEvent.  If aEncodedEvent holds a buffer, it is
+     *   reused; otherwise one of kMaxEventSizeReserve bytes is allocated.
+     */
+    CHIP_ERROR EncodeEvent(EventLoggingDelegate * apDelegate, const InternalEventOptions * apOptions,
+                           System::PacketBufferHandle & aEncodedEvent);
+    /**
+     * @brief Make room for an encoded event in the buffers, evicting or moving older events as
+     *   needed, and copy it there.
+     *
+     * @param[out] aEventStart Where the event starts in mpEventBuffer.
+     */
+    CHIP_ERROR WriteEncodedEvent(PriorityLevel aPriority, const ByteSpan & aEvent, const uint8_t *& aEventStart);
     /**
      * @brief Helper function for writing event header and data according to event
      *   logging protocol.
@@ -451,8 +576,9 @@ private:
     CHIP_ERROR ConstructEvent(EventLoadOutContext * apContext, EventLoggingDelegate * apDelegate,
                               const InternalEventOptions * apOptions);
 
-    // Internal function to log event
-    CHIP_ERROR LogEventPrivate(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions, EventNumber & aEventNumber);
+    // Internal function to log event, encoding it into aEncodedEvent
+    CHIP_ERROR LogEventPrivate(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions, Timestamp aTimestamp,
+                               System::PacketBufferHandle & aEncodedEvent, EventNumber & aEventNumber);
 
     /**
      * @brief copy the event outright to next buffer with higher priority
@@ -478,6 +604,22 @@ private:
      */
     CHIP_ERROR EnsureSpaceInCircularBuffer(size_t aRequiredSpace, PriorityLevel aPriority);
 
+    /**
+     * @brief Load the events of mpPersistentEventStore into the buffers, in event number order.
+     */
+    CHIP_ERROR LoadPersistedEvents();
+
+    /**
+     * @brief Add an event loaded from mpPersistentEventStore to the buffers, without storing it again.
+     */
+    CHIP_ERROR LoadPersistedEvent(PriorityLevel aPriority, EventNumber aEventNumber, ByteSpan aEvent);
+
+    /**
+     * @brief Mark the fabric index of the events of mpPersistentEventStore as kUndefinedFabricIndex if it is
+     * aFabricIndex, as FabricRemovedCB does for the buffers.
+     */
+    CHIP_ERROR FabricRemovedFromPersistentEventStore(FabricIndex aFabricIndex);
+
     /**
      * @brief Iterate the event elements inside event tlv and mark the fabric index as kUndefinedFabricIndex if
      * it matches the FabricIndex apFabricIndex points to.
@@ -541,6 +683,13 @@ private:
         return CHIP_ERROR_NO_MEMORY;
     };
 
+    /**
+     * @brief Check, from the fields stored ahead of the event data (the path and the event number), whether the event
+     * instance represented by the EventEnvelopeContext could be included in the report.  This lets events that will not be
+     * reported be skipped without going through their data.
+     */
+    static bool IsEventHeaderOfInterest(EventLoadOutContext * eventLoadOutContext, const EventEnvelopeContext & event);
+
     /**
      * @brief Check whether the event instance represented by the EventEnvelopeContext should be included in the report.
      *
@@ -573,12 +722,16 @@ private:
     // The counter we're going to use for event numbers.
     MonotonicallyIncreasingCounter<EventNumber> * mpEventNumberCounter = nullptr;
 
-    EventNumber mLastEventNumber = 0; ///< Last event Number vended
-    Timestamp mLastEventTimestamp{};  ///< The timestamp of the last event in this buffer
+    EventNumber mLastEventNumber  = 0; ///< Last event Number vended
+    uint64_t mScannedEventCount   = 0; ///< Events looked at by FetchEventsSince
+    uint64_t mDeliveredEventCount = 0; ///< Events put in reports by FetchEventsSince
+    Timestamp mLastEventTimestamp{};   ///< The timestamp of the last event in this buffer
 
     System::Clock::Milliseconds64 mMonotonicStartupTime{};
 
     EventReporter * mpEventReporter = nullptr;
+
+    PersistentEventStore * mpPersistentEventStore = nullptr;
 };
 
 } // namespace app
@@ -0,0 +1,413 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/FileEventStore.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+constexpr char kSegmentPrefix[] = "events-";
+
+CHIP_ERROR LastPosixError()
+{
+    return CHIP_ERROR_POSIX(errno);
+}
+
+} // namespace
+
+CHIP_ERROR FileEventStore::Init(const char * aDirectory, PriorityLevel aLowestPriority, uint32_t aSegmentSize,
+                                uint32_t aSegmentCount)
+{
+    VerifyOrReturnError(mLowestPriority == PriorityLevel::Invalid, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aDirectory != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aLowestPriority <= PriorityLevel::Last, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aSegmentSize > 0 && aSegmentCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    int written = snprintf(mDirectory, sizeof(mDirectory), "%s", aDirectory);
+    VerifyOrReturnError(written > 0 && static_cast<size_t>(written) < sizeof(mDirectory), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mLowestPriority = aLowestPriority;
+    mSegmentSize    = aSegmentSize;
+    mSegmentCount   = aSegmentCount;
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    for (uint8_t priority = to_underlying(aLowestPriority); priority <= to_underlying(PriorityLevel::Last); priority++)
+    {
+        Segments & segments = mSegments[priority];
+        err                 = FindSegments(static_cast<PriorityLevel>(priority), segments);
+        SuccessOrExit(err);
+        err = OpenLastSegment(static_cast<PriorityLevel>(priority), segments);
+        SuccessOrExit(err);
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        Shutdown();
+    }
+    return err;
+}
+
+void FileEventStore::Shutdown()
+{
+    for (auto & segments : mSegments)
+    {
+        Unmap(segments);
+        if (segments.mFd >= 0)
+        {
+            close(segments.mFd);
+        }
+        segments = Segments();
+    }
+    mLowestPriority = PriorityLevel::Invalid;
+}
+
+bool FileEventStore::Accepts(PriorityLevel aPriority) const
+{
+    return mLowestPriority != PriorityLevel::Invalid && aPriority >= mLowestPriority && aPriority <= PriorityLevel::Last;
+}
+
+CHIP_ERROR FileEventStore::Append(PriorityLevel aPriority, ByteSpan aEvent)
+{
+    VerifyOrReturnError(Accepts(aPriority), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!aEvent.empty() && aEvent.size() <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Segments & segments = SegmentsFor(aPriority);
+    if (segments.mSize > 0 && segments.mSize + kRecordHeaderSize + aEvent.size() > mSegmentSize)
+    {
+        ReturnErrorOnFailure(StartSegment(aPriority, segments));
+    }
+
+    uint8_t header[kRecordHeaderSize];
+    Encoding::LittleEndian::Put16(header, static_cast<uint16_t>(aEvent.size()));
+
+    struct iovec record[] = {
+        { header, sizeof(header) },
+        { const_cast<uint8_t *>(aEvent.data()), aEvent.size() },
+    };
+    const size_t recordSize = sizeof(header) + aEvent.size();
+
+    ssize_t written = writev(segments.mFd, record, MATTER_ARRAY_SIZE(record));
+    if (written < 0 || static_cast<size_t>(written) != recordSize || fdatasync(segments.mFd) != 0)
+    {
+        bool shortWrite = written >= 0 && static_cast<size_t>(written) != recordSize;
+        CHIP_ERROR err  = shortWrite ? CHIP_ERROR_PERSISTED_STORAGE_FAILED : LastPosixError();
+        // Leave the segment ending on a whole record.
+        if (ftruncate(segments.mFd, segments.mSize) != 0)
+        {
+            ChipLogError(EventLogging, "Failed to truncate event segment: %s", strerror(errno));
+        }
+        return err;
+    }
+
+    segments.mSize += static_cast<uint32_t>(recordSize);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FileEventStore::ReadNext(PriorityLevel aPriority, Cursor & aCursor, Cursor & aAt, ByteSpan & aEvent)
+{
+    VerifyOrReturnError(Accepts(aPriority), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Segments & segments = SegmentsFor(aPriority);
+    if (aCursor.mSegment < segments.mFirst)
+    {
+        aCursor = { segments.mFirst, 0 };
+    }
+
+    for (; aCursor.mSegment <= segments.mLast; aCursor = { aCursor.mSegment + 1, 0 })
+    {
+        ReturnErrorOnFailure(Map(aPriority, segments, aCursor.mSegment));
+
+        size_t recordLength;
+        if (aCursor.mOffset < segments.mMapLength &&
+            IsValidRecord(segments.mpMap + aCursor.mOffset, segments.mMapLength - aCursor.mOffset, recordLength))
+        {
+            aAt    = aCursor;
+            aEvent = ByteSpan(segments.mpMap + aCursor.mOffset + kRecordHeaderSize, recordLength - kRecordHeaderSize);
+            aCursor.mOffset += static_cast<uint32_t>(recordLength);
+            return CHIP_NO_ERROR;
+        }
+        // Anything past the last whole record of a segment is ignored.
+    }
+
+    return CHIP_ERROR_NOT_FOUND;
+}
+
+CHIP_ERROR FileEventStore::Overwrite(PriorityLevel aPriority, const Cursor & aAt, ByteSpan aEvent)
+{
+    VerifyOrReturnError(Accepts(aPriority), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Segments & segments = SegmentsFor(aPriority);
+    VerifyOrReturnError(aAt.mSegment >= segments.mFirst && aAt.mSegment <= segments.mLast, CHIP_ERROR_NOT_FOUND);
+
+    char path[kMaxPathLength];
+    ReturnErrorOnFailure(SegmentPath(aPriority, aAt.mSegment, path));
+
+    // Not through mFd: it is opened with O_APPEND, which makes pwrite ignore the offset.
+    int fd = open(path, O_RDWR | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, LastPosixError());
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    uint8_t header[kRecordHeaderSize];
+    if (pread(fd, header, sizeof(header), aAt.mOffset) != static_cast<ssize_t>(sizeof(header)))
+    {
+        err = CHIP_ERROR_NOT_FOUND;
+    }
+    else if (Encoding::LittleEndian::Get16(header) != aEvent.size())
+    {
+        err = CHIP_ERROR_INVALID_ARGUMENT;
+    }
+    else if (pwrite(fd, aEvent.data(), aEvent.size(), aAt.mOffset + kRecordHeaderSize) != static_cast<ssize_t>(aEvent.size()) ||
+             fdatasync(fd) != 0)
+    {
+        err = LastPosixError();
+    }
+
+    close(fd);
+    return err;
+}
+
+CHIP_ERROR FileEventStore::SegmentPath(PriorityLevel aPriority, uint32_t aSequence, char (&aPath)[kMaxPathLength]) const
+{
+    int written = snprintf(aPath, sizeof(aPath), "%s/%s%u-%" PRIu32, mDirectory, kSegmentPrefix,
+                           static_cast<unsigned>(aPriority), aSequence);
+    VerifyOrReturnError(written > 0 && static_cast<size_t>(written) < sizeof(aPath), CHIP_ERROR_BUFFER_TOO_SMALL);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FileEventStore::FindSegments(PriorityLevel aPriority, Segments & aSegments)
+{
+    DIR * dir = opendir(mDirectory);
+    VerifyOrReturnError(dir != nullptr, LastPosixError());
+
+    bool found = false;
+    while (struct dirent * entry = readdir(dir))
+    {
+        unsigned priority;
+        uint32_t sequence;
+        int length = 0;
+        if (strncmp(entry->d_name, kSegmentPrefix, sizeof(kSegmentPrefix) - 1) != 0 ||
+            sscanf(entry->d_name + sizeof(kSegmentPrefix) - 1, "%u-%" SCNu32 "%n", &priority, &sequence, &length) != 2 ||
+            entry->d_name[sizeof(kSegmentPrefix) - 1 + static_cast<size_t>(length)] != '\0' ||
+            priority != to_underlying(aPriority) || sequence == 0)
+        {
+            continue;
+        }
+
+        if (!found || sequence < aSegments.mFirst)
+        {
+            aSegments.mFirst = sequence;
+        }
+        if (!found || sequence > aSegments.mLast)
+        {
+            aSegments.mLast = sequence;
+        }
+        found = true;
+    }
+    closedir(dir);
+
+    if (!found)
+    {
+        aSegments.mFirst = 1;
+        aSegments.mLast  = 1;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FileEventStore::OpenLastSegment(PriorityLevel aPriority, Segments & aSegments)
+{
+    char path[kMaxPathLength];
+    ReturnErrorOnFailure(SegmentPath(aPriority, aSegments.mLast, path));
+
+    aSegments.mFd = open(path, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+    VerifyOrReturnError(aSegments.mFd >= 0, LastPosixError());
+
+    struct stat info;
+    VerifyOrReturnError(fstat(aSegments.mFd, &info) == 0, LastPosixError());
+    VerifyOrReturnError(static_cast<uint64_t>(info.st_size) <= UINT32_MAX, CHIP_ERROR_INTERNAL);
+    aSegments.mSize = static_cast<uint32_t>(info.st_size);
+
+    // Drop what is left of an event that was being appended when the system went down.
+    ReturnErrorOnFailure(Map(aPriority, aSegments, aSegments.mLast));
+    size_t validLength = ValidLength(aSegments.mpMap, aSegments.mMapLength);
+    if (validLength != aSegments.mSize)
+    {
+        ChipLogProgress(EventLogging, "Discarding %u bytes at the end of %s", static_cast<unsigned>(aSegments.mSize - validLength),
+                        path);
+        Unmap(aSegments);
+        VerifyOrReturnError(ftruncate(aSegments.mFd, static_cast<off_t>(validLength)) == 0, LastPosixError());
+        aSegments.mSize = static_cast<uint32_t>(validLength);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FileEventStore::StartSegment(PriorityLevel aPriority, Segments & aSegments)
+{
+    VerifyOrReturnError(aSegments.mLast < UINT32_MAX, CHIP_ERROR_NO_MEMORY);
+
+    char path[kMaxPathLength];
+    ReturnErrorOnFailure(SegmentPath(aPriority, aSegments.mLast + 1, path));
+
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0600);
+    VerifyOrReturnError(fd >= 0, LastPosixError());
+
+    close(aSegments.mFd);
+    aSegments.mFd = fd;
+    aSegments.mLast++;
+    aSegments.mSize = 0;
+
+    while (aSegments.mLast - aSegments.mFirst + 1 > mSegmentCount)
+    {
+        if (aSegments.mHasMapping && aSegments.mMapped == aSegments.mFirst)
+        {
+            Unmap(aSegments);
+        }
+        ReturnErrorOnFailure(SegmentPath(aPriority, aSegments.mFirst, path));
+        if (unlink(path) != 0 && errno != ENOENT)
+        {
+            ChipLogError(EventLogging, "Failed to delete %s: %s", path, strerror(errno));
+        }
+        aSegments.mFirst++;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FileEventStore::Map(PriorityLevel aPriority, Segments & aSegments, uint32_t aSequence)
+{
+    // The segment being appended to needs mapping again once it has grown.
+    if (aSegments.mHasMapping && aSegments.mMapped == aSequence &&
+        (aSequence != aSegments.mLast || aSegments.mMapLength == aSegments.mSize))
+    {
+        return CHIP_NO_ERROR;
+    }
+    Unmap(aSegments);
+
+    int fd = -1;
+    if (aSequence == aSegments.mLast)
+    {
+        fd = aSegments.mFd;
+    }
+    else
+    {
+        char path[kMaxPathLength];
+        ReturnErrorOnFailure(SegmentPath(aPriority, aSequence, path));
+        fd = open(path, O_RDONLY | O_CLOEXEC);
+        // A missing segment reads as an empty one.
+        VerifyOrReturnError(fd >= 0 || errno == ENOENT, LastPosixError());
+    }
+
+    size_t length = 0;
+    if (fd >= 0)
+    {
+        struct stat info;
+        if (fstat(fd, &info) == 0)
+        {
+            length = static_cast<size_t>(info.st_size);
+        }
+        if (aSequence == aSegments.mLast)
+        {
+            length = std::min<size_t>(length, aSegments.mSize);
+        }
+    }
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    if (length > 0)
+    {
+        void * map = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        if (map == MAP_FAILED)
+        {
+            err = LastPosixError();
+        }
+        else
+        {
+            aSegments.mpMap      = static_cast<const uint8_t *>(map);
+            aSegments.mMapLength = length;
+        }
+    }
+    if (fd >= 0 && fd != aSegments.mFd)
+    {
+        close(fd);
+    }
+    ReturnErrorOnFailure(err);
+
+    aSegments.mMapped     = aSequence;
+    aSegments.mHasMapping = true;
+    return CHIP_NO_ERROR;
+}
+
+void FileEventStore::Unmap(Segments & aSegments)
+{
+    if (aSegments.mpMap != nullptr)
+    {
+        munmap(const_cast<uint8_t *>(aSegments.mpMap), aSegments.mMapLength);
+    }
+    aSegments.mpMap       = nullptr;
+    aSegments.mMapLength  = 0;
+    aSegments.mHasMapping = false;
+}
+
+size_t FileEventStore::ValidLength(const uint8_t * aData, size_t aLength)
+{
+    size_t offset = 0;
+    size_t recordLength;
+    while (offset < aLength && IsValidRecord(aData + offset, aLength - offset, recordLength))
+    {
+        offset += recordLength;
+    }
+    return offset;
+}
+
+bool FileEventStore::IsValidRecord(const uint8_t * aData, size_t aLength, size_t & aRecordLength)
+{
+    VerifyOrReturnValue(aLength >= kRecordHeaderSize, false);
+    size_t eventLength = Encoding::LittleEndian::Get16(aData);
+    VerifyOrReturnValue(eventLength > 0 && eventLength <= aLength - kRecordHeaderSize, false);
+
+    // The event must be exactly one whole anonymous structure.
+    TLV::TLVReader reader;
+    reader.Init(aData + kRecordHeaderSize, eventLength);
+    VerifyOrReturnValue(reader.Next() == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(reader.GetType() == TLV::kTLVType_Structure && reader.GetTag() == TLV::AnonymousTag(), false);
+    VerifyOrReturnValue(reader.Skip() == CHIP_NO_ERROR && reader.GetLengthRead() == eventLength, false);
+
+    aRecordLength = kRecordHeaderSize + eventLength;
+    return true;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,105 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/PersistentEventStore.h>
+#include <lib/core/CHIPConfig.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * A PersistentEventStore keeping events in files of a directory, for POSIX systems.
+ *
+ * The events of each priority level go in a sequence of append-only segment files named events-<priority>-<sequence>.
+ * Each event is stored as its 16-bit little-endian length followed by its encoding.  Once the newest segment of a priority
+ * holds aSegmentSize bytes, the next event starts a new segment, and the oldest segment is deleted if there are more than
+ * aSegmentCount of them.  Every event is thus written once, and only rewritten in place (one byte) when its fabric is
+ * removed.
+ *
+ * Events are synced to storage as they are appended.  An event that was only partly written when the system went down is
+ * discarded on Init.  Segments are memory-mapped for reading.
+ */
+class FileEventStore : public PersistentEventStore
+{
+public:
+    FileEventStore() = default;
+    ~FileEventStore() override { Shutdown(); }
+
+    FileEventStore(const FileEventStore &)             = delete;
+    FileEventStore & operator=(const FileEventStore &) = delete;
+
+    /**
+     * Keep the events of priority aLowestPriority and above in aDirectory, which must exist, picking up the events
+     * stored there before.
+     */
+    CHIP_ERROR Init(const char * aDirectory, PriorityLevel aLowestPriority = PriorityLevel::Critical,
+                    uint32_t aSegmentSize = CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_SIZE,
+                    uint32_t aSegmentCount = CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_COUNT);
+    void Shutdown();
+
+    bool Accepts(PriorityLevel aPriority) const override;
+    CHIP_ERROR Append(PriorityLevel aPriority, ByteSpan aEvent) override;
+    CHIP_ERROR ReadNext(PriorityLevel aPriority, Cursor & aCursor, Cursor & aAt, ByteSpan & aEvent) override;
+    CHIP_ERROR Overwrite(PriorityLevel aPriority, const Cursor & aAt, ByteSpan aEvent) override;
+
+private:
+    static constexpr size_t kMaxPathLength    = 256;
+    static constexpr size_t kRecordHeaderSize = 2;
+
+    // The segment files of one priority level.
+    struct Segments
+    {
+        uint32_t mFirst = 0; ///< Sequence number of the oldest segment
+        uint32_t mLast  = 0; ///< Sequence number of the segment being appended to
+        int mFd         = -1;
+        uint32_t mSize  = 0; ///< Bytes in the segment being appended to
+
+        // The segment mapped for reading.
+        uint32_t mMapped      = 0;
+        const uint8_t * mpMap = nullptr;
+        size_t mMapLength     = 0;
+        bool mHasMapping      = false;
+    };
+
+    Segments & SegmentsFor(PriorityLevel aPriority) { return mSegments[static_cast<size_t>(aPriority)]; }
+
+    CHIP_ERROR SegmentPath(PriorityLevel aPriority, uint32_t aSequence, char (&aPath)[kMaxPathLength]) const;
+    CHIP_ERROR FindSegments(PriorityLevel aPriority, Segments & aSegments);
+    CHIP_ERROR OpenLastSegment(PriorityLevel aPriority, Segments & aSegments);
+    CHIP_ERROR StartSegment(PriorityLevel aPriority, Segments & aSegments);
+    CHIP_ERROR Map(PriorityLevel aPriority, Segments & aSegments, uint32_t aSequence);
+    static void Unmap(Segments & aSegments);
+
+    // The length of the longest run of whole, well-formed records at the start of aData.
+    static size_t ValidLength(const uint8_t * aData, size_t aLength);
+    static bool IsValidRecord(const uint8_t * aData, size_t aLength, size_t & aRecordLength);
+
+    char mDirectory[kMaxPathLength] = {};
+    PriorityLevel mLowestPriority   = PriorityLevel::Invalid;
+    uint32_t mSegmentSize           = 0;
+    uint32_t mSegmentCount          = 0;
+    Segments mSegments[kNumPriorityLevel];
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,87 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/InteractionArena.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+uint8_t * InteractionArena::Align(uint8_t * pointer, size_t alignment)
+{
+    uintptr_t value = reinterpret_cast<uintptr_t>(pointer);
+    return pointer + ((alignment - value % alignment) % alignment);
+}
+
+void * InteractionArena::Allocate(size_t size, size_t alignment)
+{
+    VerifyOrReturnValue(alignment != 0 && alignment <= alignof(std::max_align_t), nullptr);
+
+    uint8_t * start = Align(mCursor, alignment);
+    if (start <= mEnd && size <= static_cast<size_t>(mEnd - start))
+    {
+        mCursor = start + size;
+        return start;
+    }
+
+    // Block data is max-aligned, so a new block needs no padding.
+    size_t capacity = (size > kBlockSize) ? size : kBlockSize;
+    VerifyOrReturnValue(capacity <= SIZE_MAX - kHeaderSize, nullptr);
+    Block * block = static_cast<Block *>(Platform::MemoryAlloc(kHeaderSize + capacity));
+    VerifyOrReturnValue(block != nullptr, nullptr);
+    block->mCapacity = capacity;
+    block->mNext     = mBlocks;
+    mBlocks          = block;
+
+    if (size > kBlockSize)
+    {
+        // A block of its own: keep carving the current space, which is likely to have more room left.
+        return block->Data();
+    }
+
+    mCursor = block->Data() + size;
+    mEnd    = block->Data() + capacity;
+    return block->Data();
+}
+
+void InteractionArena::Release()
+{
+    while (mBlocks != nullptr)
+    {
+        Block * next = mBlocks->mNext;
+        Platform::MemoryFree(mBlocks);
+        mBlocks = next;
+    }
+    mCursor = mInline;
+    mEnd    = mInline + kInlineSize;
+}
+
+size_t InteractionArena::BlockCount() const
+{
+    size_t count = 0;
+    for (const Block * block = mBlocks; block != nullptr; block = block->mNext)
+    {
+        count++;
+    }
+    return count;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,95 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace chip {
+namespace app {
+
+/*
+ * Bump allocator for the state of a single interaction, e.g. the paths of a read request.
+ *
+ * The first CHIP_CONFIG_IM_INTERACTION_ARENA_INLINE_SIZE bytes live inside the arena itself, so that typical requests
+ * cost no allocation beyond the one of their handler. Further objects are carved out of blocks of
+ * CHIP_CONFIG_IM_INTERACTION_ARENA_BLOCK_SIZE bytes from the Platform heap; objects bigger than a block get a block of
+ * their own. Nothing is freed individually: all memory goes back at once when the arena is released or destroyed, which
+ * is why objects are never destroyed and must be trivially destructible.
+ */
+class InteractionArena
+{
+public:
+    static constexpr size_t kInlineSize = CHIP_CONFIG_IM_INTERACTION_ARENA_INLINE_SIZE;
+    static constexpr size_t kBlockSize  = CHIP_CONFIG_IM_INTERACTION_ARENA_BLOCK_SIZE;
+
+    static_assert(kInlineSize > 0 && kBlockSize > 0, "InteractionArena sizes must be positive");
+
+    InteractionArena() = default;
+    ~InteractionArena() { Release(); }
+
+    InteractionArena(const InteractionArena &)             = delete;
+    InteractionArena & operator=(const InteractionArena &) = delete;
+
+    /*
+     * Returns nullptr if the Platform heap is exhausted.
+     */
+    void * Allocate(size_t size, size_t alignment);
+
+    template <typename T>
+    T * New()
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "InteractionArena never runs destructors");
+        void * memory = Allocate(sizeof(T), alignof(T));
+        return (memory == nullptr) ? nullptr : new (memory) T();
+    }
+
+    /*
+     * Invalidate every object allocated so far and free the heap blocks.
+     */
+    void Release();
+
+    size_t BlockCount() const;
+
+private:
+    struct Block
+    {
+        Block * mNext;
+        size_t mCapacity;
+
+        uint8_t * Data() { return reinterpret_cast<uint8_t *>(this) + kHeaderSize; }
+    };
+
+    static constexpr size_t kHeaderSize = (sizeof(Block) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) *
+        alignof(std::max_align_t);
+
+    static uint8_t * Align(uint8_t * pointer, size_t alignment);
+
+    alignas(std::max_align_t) uint8_t mInline[kInlineSize];
+    uint8_t * mCursor = mInline;
+    uint8_t * mEnd    = mInline + kInlineSize;
+    Block * mBlocks   = nullptr; // most recent first
+};
+
+} // namespace app
+} // namespace chip
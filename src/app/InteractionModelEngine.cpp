@@ -49,8 +49,10 @@
 #include <lib/support/CHIPFaultInjection.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/FibonacciUtils.h>
+#include <lib/support/MemoryTags.h>
 #include <lib/support/ReadOnlyBuffer.h>
 #include <protocols/interaction_model/StatusCode.h>
+#include <tracing/metric_event.h>
 
 #include <cinttypes>
 
@@ -162,6 +164,84 @@ bool IsAccessibleAttributeEntry(const ConcreteAttributePath & path, const Access
     return (Access::GetAccessControl().Check(subjectDescriptor, requestPath, privilege) == CHIP_NO_ERROR);
 }
 
+#if CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+
+/// Order used by CompactAttributePathList. Wildcard ids are all ones, so wildcards sort after concrete ids.
+bool AttributePathLess(const AttributePathParams & a, const AttributePathParams & b)
+{
+    if (a.mEndpointId != b.mEndpointId)
+    {
+        return a.mEndpointId < b.mEndpointId;
+    }
+    if (a.mClusterId != b.mClusterId)
+    {
+        return a.mClusterId < b.mClusterId;
+    }
+    if (a.mAttributeId != b.mAttributeId)
+    {
+        return a.mAttributeId < b.mAttributeId;
+    }
+    return a.mListIndex < b.mListIndex;
+}
+
+/// Bottom-up merge sort, so that no recursion or extra memory is needed.
+void SortAttributePathList(SingleLinkedListNode<AttributePathParams> *& aList)
+{
+    using Node = SingleLinkedListNode<AttributePathParams>;
+
+    for (size_t runLength = 1;; runLength *= 2)
+    {
+        Node * remaining = aList;
+        Node * head      = nullptr;
+        Node ** tail     = &head;
+        size_t merges    = 0;
+
+        while (remaining != nullptr)
+        {
+            merges++;
+
+            Node * left       = remaining;
+            Node * right      = remaining;
+            size_t leftLength = 0;
+            while (right != nullptr && leftLength < runLength)
+            {
+                right = right->mpNext;
+                leftLength++;
+            }
+            size_t rightLength = runLength;
+
+            while (leftLength > 0 || (rightLength > 0 && right != nullptr))
+            {
+                Node * next;
+                if (leftLength == 0 || (rightLength > 0 && right != nullptr && AttributePathLess(right->mValue, left->mValue)))
+                {
+                    next  = right;
+                    right = right->mpNext;
+                    rightLength--;
+                }
+                else
+                {
+                    next = left;
+                    left = left->mpNext;
+                    leftLength--;
+                }
+                *tail = next;
+                tail  = &next->mpNext;
+            }
+            remaining = right;
+        }
+
+        *tail = nullptr;
+        aList = head;
+        if (merges <= 1)
+        {
+            return;
+        }
+    }
+}
+
+#endif // CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+
 } // namespace
 
 class AutoReleaseSubscriptionInfoIterator
@@ -209,6 +289,11 @@ CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeM
     TEMPORARY_RETURN_IGNORED mReportingEngine.Init((eventManagement != nullptr) ? eventManagement
                                                                                 : &EventManagement::GetInstance());
 
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+    mSubscriptionLivenessWheel.Init(mpExchangeMgr->GetSessionManager()->SystemLayer());
+    mResubscriptionScheduler.Init(mpExchangeMgr->GetSessionManager()->SystemLayer());
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
+
     StatusIB::RegisterErrorFormatter();
 
     mState = State::kInitialized;
@@ -220,6 +305,14 @@ void InteractionModelEngine::Shutdown()
     VerifyOrReturn(State::kUninitialized != mState);
 
     mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(ResumeSubscriptionsTimerCallback, this);
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    // Establishers still waiting for a session delete themselves when it completes
+    mSubscriptionResumptionsInProgress.Clear();
+    mSubscriptionsToResume.Free();
+    mNumQueuedSubscriptionsToResume   = 0;
+    mNextSubscriptionToResume         = 0;
+    mSubscriptionResumptionInProgress = false;
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
     // TODO: individual object clears the entire command handler interface registry.
     //       This may not be expected as IME does NOT own the command handler interface registry.
@@ -237,6 +330,9 @@ void InteractionModelEngine::Shutdown()
     mTimedHandlers.ReleaseAll();
 
     mReadHandlers.ReleaseAll();
+#if CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX
+    mReadHandlerInterestIndex.Clear();
+#endif
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
     // Shut down any subscription clients that are still around.  They won't be
@@ -265,6 +361,8 @@ void InteractionModelEngine::Shutdown()
     // After that, we just null out our tracker.
     //
     mpActiveReadClientList = nullptr;
+    mSubscriptionLivenessWheel.Shutdown();
+    mResubscriptionScheduler.Shutdown();
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
 
     for (auto & writeHandler : mWriteHandlers)
@@ -1048,6 +1146,7 @@ CHIP_ERROR InteractionModelEngine::OnMessageReceived(Messaging::ExchangeContext
 {
     using namespace Protocols::InteractionModel;
 
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kInteractionModel);
     Protocols::InteractionModel::Status status = Status::Failure;
 
     // Ensure that DataModel::Provider has access to the exchange the message was received on.
@@ -1649,7 +1748,8 @@ std::optional<DataModel::AttributeEntry> InteractionModelEngine::FindAttributeEn
     return finder.Find(path);
 }
 
-void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths)
+void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths,
+                                                                  bool aNodesFromPool)
 {
     SingleLinkedListNode<AttributePathParams> * prev = nullptr;
     auto * path1                                     = aAttributePaths;
@@ -1692,21 +1792,127 @@ void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedLi
             continue;
         }
 
+        auto * duplicatePath = path1;
         if (path1 == aAttributePaths)
         {
             aAttributePaths = path1->mpNext;
-            mAttributePathPool.ReleaseObject(path1);
-            path1 = aAttributePaths;
+            path1           = aAttributePaths;
         }
         else
         {
             prev->mpNext = path1->mpNext;
-            mAttributePathPool.ReleaseObject(path1);
-            path1 = prev->mpNext;
+            path1        = prev->mpNext;
+        }
+        if (aNodesFromPool)
+        {
+            mAttributePathPool.ReleaseObject(duplicatePath);
         }
     }
 }
 
+#if CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+void InteractionModelEngine::CompactAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePaths,
+                                                      const Access::SubjectDescriptor & aSubjectDescriptor, bool aNodesFromPool)
+{
+    using Node = SingleLinkedListNode<AttributePathParams>;
+
+    auto releaseNode = [this, aNodesFromPool](Node * node) {
+        if (aNodesFromPool)
+        {
+            mAttributePathPool.ReleaseObject(node);
+        }
+    };
+
+    SortAttributePathList(aAttributePaths);
+
+    for (Node * current = aAttributePaths; current != nullptr; current = current->mpNext)
+    {
+        while (current->mpNext != nullptr && current->mpNext->mValue == current->mValue)
+        {
+            Node * duplicate = current->mpNext;
+            current->mpNext  = duplicate->mpNext;
+            releaseNode(duplicate);
+        }
+
+        const AttributePathParams & first = current->mValue;
+        if (first.HasWildcardEndpointId() || first.HasWildcardClusterId())
+        {
+            continue;
+        }
+
+        // The paths on this cluster are now next to each other. Merge them if they are exactly its readable attributes.
+        size_t runLength     = 0;
+        bool allFullConcrete = true;
+        for (Node * node = current; node != nullptr && node->mValue.mEndpointId == first.mEndpointId &&
+             node->mValue.mClusterId == first.mClusterId;
+             node = node->mpNext)
+        {
+            allFullConcrete = allFullConcrete && !node->mValue.HasWildcardAttributeId() && node->mValue.HasWildcardListIndex();
+            runLength++;
+        }
+        if (!allFullConcrete || runLength < 2)
+        {
+            continue;
+        }
+
+        const ConcreteClusterPath clusterPath(first.mEndpointId, first.mClusterId);
+        ReadOnlyBuffer<DataModel::AttributeEntry> attributes = mDataModelProvider->AttributesIgnoreError(clusterPath);
+        if (attributes.size() != runLength)
+        {
+            continue;
+        }
+
+        // The run has no duplicates, so it names every attribute if each of its attributes exists.
+        bool mergeable = true;
+        Node * node    = current;
+        for (size_t i = 0; i < runLength && mergeable; i++, node = node->mpNext)
+        {
+            mergeable = false;
+            for (const auto & entry : attributes)
+            {
+                if (entry.attributeId == node->mValue.mAttributeId)
+                {
+                    const ConcreteAttributePath attributePath(first.mEndpointId, first.mClusterId, entry.attributeId);
+                    mergeable = IsAccessibleAttributeEntry(attributePath, aSubjectDescriptor, std::make_optional(entry));
+                    break;
+                }
+            }
+        }
+        if (!mergeable)
+        {
+            continue;
+        }
+
+        for (size_t i = 1; i < runLength; i++)
+        {
+            Node * merged   = current->mpNext;
+            current->mpNext = merged->mpNext;
+            releaseNode(merged);
+        }
+        current->mValue.SetWildcardAttributeId();
+    }
+}
+#endif // CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+
+void InteractionModelEngine::RegisterReadHandlerInterest(ReadHandler & aReadHandler,
+                                                         const SingleLinkedListNode<AttributePathParams> * aAttributePaths)
+{
+#if CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX
+    mReadHandlerInterestIndex.Register(aReadHandler, aAttributePaths);
+    if (mReadHandlerInterestIndex.HasOverflowed())
+    {
+        ChipLogError(InteractionModel, "ReadHandler interest index full, falling back to visiting all handlers");
+    }
+#endif // CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX
+}
+
+void InteractionModelEngine::UnregisterReadHandlerInterest(ReadHandler & aReadHandler)
+{
+#if CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX
+    mReadHandlerInterestIndex.Unregister(aReadHandler);
+#endif // CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX
+}
+
 void InteractionModelEngine::ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList)
 {
     ReleasePool(aEventPathList, mEventPathPool);
@@ -1781,7 +1987,11 @@ void InteractionModelEngine::DispatchCommand(CommandHandlerImpl & apCommandObj,
     request.invokeFlags.Set(DataModel::InvokeFlags::kTimed, apCommandObj.IsTimedInvoke());
     request.subjectDescriptor = &subjectDescriptor;
 
-    std::optional<DataModel::ActionReturnStatus> status = GetDataModelProvider()->InvokeCommand(request, apPayload, &apCommandObj);
+    std::optional<DataModel::ActionReturnStatus> status;
+    {
+        Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kApp);
+        status = GetDataModelProvider()->InvokeCommand(request, apPayload, &apCommandObj);
+    }
 
     // Provider indicates that handler status or data was already set (or will be set asynchronously) by
     // returning std::nullopt. If any other value is returned, it is requesting that a status is set. This
@@ -2142,57 +2352,192 @@ void InteractionModelEngine::ResumeSubscriptionsTimerCallback(System::Layer * ap
     InteractionModelEngine * imEngine = static_cast<InteractionModelEngine *>(apAppState);
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     imEngine->mSubscriptionResumptionScheduled = false;
-    bool resumedSubscriptions                  = false;
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    imEngine->StartSubscriptionResumption();
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+}
+
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+void InteractionModelEngine::StartSubscriptionResumption()
+{
+    VerifyOrReturn(mpSubscriptionResumptionStorage != nullptr);
+
     SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo;
-    AutoReleaseSubscriptionInfoIterator iterator(imEngine->mpSubscriptionResumptionStorage->IterateSubscriptions());
-    while (iterator->Next(subscriptionInfo))
+    AutoReleaseSubscriptionInfoIterator iterator(mpSubscriptionResumptionStorage->IterateSubscriptions());
+
+    // Subscriptions still queued from an earlier attempt are queued again below, if they still need resumption
+    mSubscriptionsToResume.Free();
+    mNumQueuedSubscriptionsToResume = 0;
+    mNextSubscriptionToResume       = 0;
+
+    const size_t count = iterator->Count();
+    if (count > 0)
+    {
+        mSubscriptionsToResume.Calloc(count);
+        if (mSubscriptionsToResume.Get() == nullptr)
+        {
+            ChipLogError(InteractionModel, "Failed to queue %u subscriptions for resumption", static_cast<unsigned>(count));
+            return;
+        }
+    }
+
+    while (mNumQueuedSubscriptionsToResume < count && iterator->Next(subscriptionInfo))
     {
         // If subscription happens between reboot and this timer callback, it's already live and should skip resumption
-        if (Loop::Break == imEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
-                SubscriptionId subscriptionId;
-                handler->GetSubscriptionId(subscriptionId);
-                if (subscriptionId == subscriptionInfo.mSubscriptionId)
-                {
-                    return Loop::Break;
-                }
-                return Loop::Continue;
-            }))
+        if (HasReadHandlerForSubscription(subscriptionInfo.mSubscriptionId))
         {
             ChipLogProgress(InteractionModel, "Skip resuming live subscriptionId %" PRIu32, subscriptionInfo.mSubscriptionId);
             continue;
         }
+        if (IsSubscriptionResumptionInProgress(subscriptionInfo))
+        {
+            continue;
+        }
+
+        SubscriptionToResume subscriptionToResume = { subscriptionInfo.mNodeId, subscriptionInfo.mFabricIndex,
+                                                      subscriptionInfo.mSubscriptionId, 0 };
+        for (size_t i = 0; i < mNumQueuedSubscriptionsToResume; i++)
+        {
+            if (mSubscriptionsToResume[i].mFabricIndex == subscriptionToResume.mFabricIndex)
+            {
+                subscriptionToResume.mTurn++;
+            }
+        }
+
+        // Keep the queue ordered by turn, and by storage order within a turn
+        size_t position = mNumQueuedSubscriptionsToResume++;
+        for (; position > 0 && mSubscriptionsToResume[position - 1].mTurn > subscriptionToResume.mTurn; position--)
+        {
+            mSubscriptionsToResume[position] = mSubscriptionsToResume[position - 1];
+        }
+        mSubscriptionsToResume[position] = subscriptionToResume;
+    }
+
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    // If no persisted subscriptions needed resumption then all resumption retries are done
+    if (mNumQueuedSubscriptionsToResume == 0)
+    {
+        mNumSubscriptionResumptionRetries = 0;
+    }
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+
+    if (!mSubscriptionResumptionInProgress && mNumQueuedSubscriptionsToResume > 0)
+    {
+        mSubscriptionResumptionInProgress = true;
+        mSubscriptionResumptionStartTime  = System::SystemClock().GetMonotonicTimestamp();
+        MATTER_LOG_METRIC_BEGIN(Tracing::kMetricDeviceSubscriptionResumption);
+        MATTER_LOG_METRIC(Tracing::kMetricDeviceSubscriptionResumptionCount,
+                          static_cast<uint32_t>(mNumQueuedSubscriptionsToResume));
+    }
+
+    ResumeNextSubscriptions();
+}
+
+void InteractionModelEngine::ResumeNextSubscriptions()
+{
+    while (mNextSubscriptionToResume < mNumQueuedSubscriptionsToResume)
+    {
+#if CHIP_CONFIG_MAX_CONCURRENT_SUBSCRIPTION_RESUMPTIONS > 0
+        size_t numInProgress = 0;
+        for (auto it = mSubscriptionResumptionsInProgress.begin(); it != mSubscriptionResumptionsInProgress.end(); ++it)
+        {
+            numInProgress++;
+        }
+        if (numInProgress >= CHIP_CONFIG_MAX_CONCURRENT_SUBSCRIPTION_RESUMPTIONS)
+        {
+            break;
+        }
+#endif // CHIP_CONFIG_MAX_CONCURRENT_SUBSCRIPTION_RESUMPTIONS > 0
+
+        const SubscriptionToResume subscriptionToResume = mSubscriptionsToResume[mNextSubscriptionToResume++];
+        if (HasReadHandlerForSubscription(subscriptionToResume.mSubscriptionId))
+        {
+            ChipLogProgress(InteractionModel, "Skip resuming live subscriptionId %" PRIu32, subscriptionToResume.mSubscriptionId);
+            continue;
+        }
+
+        // The subscription may have been deleted while it was queued
+        SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo;
+        bool found = false;
+        {
+            AutoReleaseSubscriptionInfoIterator iterator(mpSubscriptionResumptionStorage->IterateSubscriptions());
+            while (!found && iterator->Next(subscriptionInfo))
+            {
+                found = (subscriptionInfo.mNodeId == subscriptionToResume.mNodeId) &&
+                    (subscriptionInfo.mFabricIndex == subscriptionToResume.mFabricIndex) &&
+                    (subscriptionInfo.mSubscriptionId == subscriptionToResume.mSubscriptionId);
+            }
+        }
+        if (!found)
+        {
+            continue;
+        }
 
         auto subscriptionResumptionSessionEstablisher = Platform::MakeUnique<SubscriptionResumptionSessionEstablisher>();
         if (subscriptionResumptionSessionEstablisher == nullptr)
         {
             ChipLogProgress(InteractionModel, "Failed to create SubscriptionResumptionSessionEstablisher");
-            return;
+            mNextSubscriptionToResume = mNumQueuedSubscriptionsToResume;
+            break;
         }
 
-        if (subscriptionResumptionSessionEstablisher->ResumeSubscription(*imEngine->mpCASESessionMgr, subscriptionInfo) !=
-            CHIP_NO_ERROR)
+        // The attempt may complete, and resume the next subscription, before ResumeSubscription returns
+        mSubscriptionResumptionsInProgress.PushBack(subscriptionResumptionSessionEstablisher.get());
+        if (subscriptionResumptionSessionEstablisher->ResumeSubscription(*mpCASESessionMgr, subscriptionInfo) != CHIP_NO_ERROR)
         {
             ChipLogProgress(InteractionModel, "Failed to ResumeSubscription 0x%" PRIx32, subscriptionInfo.mSubscriptionId);
-            return;
+            mNextSubscriptionToResume = mNumQueuedSubscriptionsToResume;
+            break;
         }
         subscriptionResumptionSessionEstablisher.release();
-#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
-        resumedSubscriptions = true;
-#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     }
 
-#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
-    // If no persisted subscriptions needed resumption then all resumption retries are done
-    if (!resumedSubscriptions)
+    if (mSubscriptionResumptionInProgress && (mNextSubscriptionToResume >= mNumQueuedSubscriptionsToResume) &&
+        mSubscriptionResumptionsInProgress.Empty())
     {
-        imEngine->mNumSubscriptionResumptionRetries = 0;
+        const System::Clock::Milliseconds64 duration =
+            System::SystemClock().GetMonotonicTimestamp() - mSubscriptionResumptionStartTime;
+
+        mSubscriptionResumptionInProgress = false;
+        mSubscriptionsToResume.Free();
+        mNumQueuedSubscriptionsToResume = 0;
+        mNextSubscriptionToResume       = 0;
+
+        MATTER_LOG_METRIC_END(Tracing::kMetricDeviceSubscriptionResumption);
+        ChipLogProgress(InteractionModel, "Subscription resumption attempts completed in %" PRIu32 " ms",
+                        static_cast<uint32_t>(duration.count()));
     }
-#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+}
 
-#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+bool InteractionModelEngine::HasReadHandlerForSubscription(SubscriptionId subscriptionId)
+{
+    return Loop::Break == mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        SubscriptionId handlerSubscriptionId;
+        handler->GetSubscriptionId(handlerSubscriptionId);
+        if (handlerSubscriptionId == subscriptionId)
+        {
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
 }
 
+bool InteractionModelEngine::IsSubscriptionResumptionInProgress(
+    const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo)
+{
+    for (auto & establisher : mSubscriptionResumptionsInProgress)
+    {
+        if ((establisher.mSubscriptionInfo.mNodeId == subscriptionInfo.mNodeId) &&
+            (establisher.mSubscriptionInfo.mFabricIndex == subscriptionInfo.mFabricIndex) &&
+            (establisher.mSubscriptionInfo.mSubscriptionId == subscriptionInfo.mSubscriptionId))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 uint32_t InteractionModelEngine::ComputeTimeSecondsTillNextSubscriptionResumption()
 {
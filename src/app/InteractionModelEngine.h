@@ -41,7 +41,10 @@
 #include <app/MessageDef/AttributeReportIBs.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadClient.h>
+#include <app/ResubscriptionScheduler.h>
+#include <app/SubscriptionLivenessWheel.h>
 #include <app/ReadHandler.h>
+#include <app/ReadHandlerInterestIndex.h>
 #include <app/StatusResponse.h>
 #include <app/SubscriptionResumptionSessionEstablisher.h>
 #include <app/SubscriptionStats.h>
@@ -60,8 +63,11 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/LinkedList.h>
+#include <lib/support/ObjectPoolRegistry.h>
 #include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
@@ -210,8 +216,37 @@ public:
                                           AttributePathParams & aAttributePath);
 
     // If a concrete path indicates an attribute that is also referenced by a wildcard path in the request,
-    // the path SHALL be removed from the list.
-    void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths);
+    // the path SHALL be removed from the list. Removed nodes are returned to the attribute path pool unless
+    // aNodesFromPool is false, in which case their owner (e.g. a read handler's arena) reclaims them.
+    void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths,
+                                              bool aNodesFromPool = true);
+
+#if CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+    /**
+     * Shrink the attribute paths of a subscription without changing what it reports:
+     *  - sort them by endpoint, cluster, attribute and list index, wildcards last (see ReadHandler::IsInterestedIn),
+     *  - drop exact duplicates,
+     *  - replace concrete paths that together name every attribute of a cluster, all of them readable by
+     *    aSubjectDescriptor, with a single wildcard path for that cluster.
+     *
+     * Dropped nodes are returned to the attribute path pool unless aNodesFromPool is false.
+     */
+    void CompactAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePaths,
+                                  const Access::SubjectDescriptor & aSubjectDescriptor, bool aNodesFromPool = true);
+#endif // CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+
+    /**
+     * Records which clusters the attribute paths of the given read handler may intersect, so that SetDirty only visits
+     * interested handlers. Must be called again whenever the attribute path list of the handler changes.
+     *
+     * No-op unless CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX is enabled.
+     */
+    void RegisterReadHandlerInterest(ReadHandler & aReadHandler, const SingleLinkedListNode<AttributePathParams> * aAttributePaths);
+
+    /**
+     * Forgets the interest previously registered by a read handler. Must be called before the handler is destroyed.
+     */
+    void UnregisterReadHandlerInterest(ReadHandler & aReadHandler);
 
     void ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList);
 
@@ -278,6 +313,16 @@ public:
      * Return the number of active read clients being tracked by the engine.
      */
     size_t GetNumActiveReadClients();
+
+    /**
+     * The liveness timer shared by the subscriptions of all read clients.
+     */
+    SubscriptionLivenessWheel & GetSubscriptionLivenessWheel() { return mSubscriptionLivenessWheel; }
+
+    /**
+     * The rate limiter of the resubscriptions of all read clients.
+     */
+    ResubscriptionScheduler & GetResubscriptionScheduler() { return mResubscriptionScheduler; }
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
 
     /**
@@ -333,6 +378,13 @@ public:
      *        was successful or not.
      */
     void DecrementNumSubscriptionsToResume();
+
+    /**
+     * @brief Start resuming queued persisted subscriptions, keeping at most CHIP_CONFIG_MAX_CONCURRENT_SUBSCRIPTION_RESUMPTIONS
+     *        of them in progress.  This should be called after a resumption attempt has completed and its
+     *        SubscriptionResumptionSessionEstablisher has been deleted.
+     */
+    void ResumeNextSubscriptions();
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     /**
      * @brief Function resets the number of retries of subscriptions resumption - mNumSubscriptionResumptionRetries.
@@ -660,7 +712,10 @@ private:
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
 
     ObjectPool<CommandResponseSender, CHIP_IM_MAX_NUM_COMMAND_HANDLER> mCommandResponderObjs;
+    ObjectPoolRegistration mCommandResponderObjsRegistration{ CHIP_OBJECT_POOL_NAMES("core_pool_im_command_responders"),
+                                                              mCommandResponderObjs };
     ObjectPool<TimedHandler, CHIP_IM_MAX_NUM_TIMED_HANDLER> mTimedHandlers;
+    ObjectPoolRegistration mTimedHandlersRegistration{ CHIP_OBJECT_POOL_NAMES("core_pool_im_timed_handlers"), mTimedHandlers };
     WriteHandler mWriteHandlers[CHIP_IM_MAX_NUM_WRITE_HANDLER];
     reporting::Engine mReportingEngine;
     reporting::ReportScheduler * mReportScheduler = nullptr;
@@ -684,17 +739,32 @@ private:
     ObjectPool<SingleLinkedListNode<AttributePathParams>,
                CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS>
         mAttributePathPool;
+    ObjectPoolRegistration mAttributePathPoolRegistration{ CHIP_OBJECT_POOL_NAMES("core_pool_im_attribute_paths"),
+                                                           mAttributePathPool };
     ObjectPool<SingleLinkedListNode<EventPathParams>,
                CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS>
         mEventPathPool;
+    ObjectPoolRegistration mEventPathPoolRegistration{ CHIP_OBJECT_POOL_NAMES("core_pool_im_event_paths"), mEventPathPool };
     ObjectPool<SingleLinkedListNode<DataVersionFilter>,
                CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS>
         mDataVersionFilterPool;
+    ObjectPoolRegistration mDataVersionFilterPoolRegistration{ CHIP_OBJECT_POOL_NAMES("core_pool_im_data_version_filters"),
+                                                               mDataVersionFilterPool };
 
     ObjectPool<ReadHandler, CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS> mReadHandlers;
+    ObjectPoolRegistration mReadHandlersRegistration{ CHIP_OBJECT_POOL_NAMES("core_pool_im_read_handlers"), mReadHandlers };
+
+#if CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX
+    // Every handler needs at most one index entry per attribute path, so match the capacity of mAttributePathPool.
+    ReadHandlerInterestIndex<ReadHandler,
+                             CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS>
+        mReadHandlerInterestIndex;
+#endif
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
     ReadClient * mpActiveReadClientList = nullptr;
+    SubscriptionLivenessWheel mSubscriptionLivenessWheel;
+    ResubscriptionScheduler mResubscriptionScheduler;
 #endif
 
     ReadHandler::ApplicationCallback * mpReadHandlerApplicationCallback = nullptr;
@@ -725,6 +795,31 @@ private:
      * by ComputeTimeSecondsTillNextSubscriptionResumption.
      */
     int8_t mNumOfSubscriptionsToResume = 0;
+
+    // A persisted subscription waiting to be resumed.
+    struct SubscriptionToResume
+    {
+        NodeId mNodeId;
+        FabricIndex mFabricIndex;
+        SubscriptionId mSubscriptionId;
+        uint16_t mTurn; ///< How many subscriptions of the same fabric are resumed before this one
+    };
+
+    /**
+     * Queue the persisted subscriptions that are neither live nor being resumed, interleaving fabrics so that a fabric
+     * with many subscriptions does not hold back the others, and start resuming them.
+     */
+    void StartSubscriptionResumption();
+
+    bool HasReadHandlerForSubscription(SubscriptionId subscriptionId);
+    bool IsSubscriptionResumptionInProgress(const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo);
+
+    Platform::ScopedMemoryBufferWithSize<SubscriptionToResume> mSubscriptionsToResume;
+    size_t mNumQueuedSubscriptionsToResume = 0;
+    size_t mNextSubscriptionToResume       = 0;
+    IntrusiveList<SubscriptionResumptionSessionEstablisher, IntrusiveMode::AutoUnlink> mSubscriptionResumptionsInProgress;
+    bool mSubscriptionResumptionInProgress = false;
+    System::Clock::Timestamp mSubscriptionResumptionStartTime;
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     bool HasSubscriptionsToResume();
     uint32_t ComputeTimeSecondsTillNextSubscriptionResumption();
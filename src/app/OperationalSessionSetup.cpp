@@ -68,6 +68,9 @@ void OperationalSessionSetup::MoveToState(State aTargetState)
         if (aTargetState != State::Connecting)
         {
             CleanupCASEClient();
+#if CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+            CancelParallelAttempts();
+#endif // CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
         }
     }
 }
@@ -250,6 +253,20 @@ void OperationalSessionSetup::UpdateDeviceData(const ResolveResult & result)
         return;
     }
 
+    if (mTransportPayloadCapability == TransportPayloadCapability::kLargePayloadIfSupported && !result.supportsTcpServer)
+    {
+        // The peer has no large payload transport, so any session over MRP will do, including one that already exists.
+        mTransportPayloadCapability = TransportPayloadCapability::kMRPPayload;
+        if (AttachToExistingSecureSession())
+        {
+            MATTER_LOG_METRIC_END(kMetricDeviceOperationalDiscovery, CHIP_NO_ERROR);
+            MoveToState(State::SecureConnected);
+            DequeueConnectionCallbacks(CHIP_NO_ERROR);
+            // Do not touch `this` instance anymore; it has been destroyed in DequeueConnectionCallbacks.
+            return;
+        }
+    }
+
     CHIP_ERROR err = EstablishConnection(result);
     LogErrorOnFailure(err);
     if (err == CHIP_NO_ERROR)
@@ -294,7 +311,7 @@ void OperationalSessionSetup::UpdateDeviceData(const ResolveResult & result)
     // Do not touch `this` instance anymore; it has been destroyed in DequeueConnectionCallbacks.
 }
 
-CHIP_ERROR OperationalSessionSetup::EstablishConnection(const ResolveResult & result)
+ReliableMessageProtocolConfig OperationalSessionSetup::GetRemoteMRPConfig(const ResolveResult & result) const
 {
     auto config = result.mrpRemoteConfig;
 
@@ -311,8 +328,17 @@ CHIP_ERROR OperationalSessionSetup::EstablishConnection(const ResolveResult & re
         config.mIdleRetransTimeout =
             std::max(config.mActiveRetransTimeout, System::Clock::Milliseconds32(mInitParams.minimumLITBackoffInterval.ValueOr(0)));
     }
+
+    return config;
+}
+
+CHIP_ERROR OperationalSessionSetup::EstablishConnection(const ResolveResult & result)
+{
+    auto config = GetRemoteMRPConfig(result);
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
-    if (mTransportPayloadCapability == TransportPayloadCapability::kLargePayload)
+    if (mTransportPayloadCapability == TransportPayloadCapability::kLargePayload ||
+        mTransportPayloadCapability == TransportPayloadCapability::kLargePayloadIfSupported)
     {
         if (result.supportsTcpServer)
         {
@@ -345,9 +371,150 @@ CHIP_ERROR OperationalSessionSetup::EstablishConnection(const ResolveResult & re
 
     MoveToState(State::Connecting);
 
+#if CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+    ScheduleParallelAttempt();
+#endif // CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+
     return CHIP_NO_ERROR;
 }
 
+#if CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+void OperationalSessionSetup::ScheduleParallelAttempt()
+{
+    // Sessions over TCP only try one address at a time.
+    VerifyOrReturn(mTransportPayloadCapability == TransportPayloadCapability::kMRPPayload);
+    VerifyOrReturn(FindFreeParallelAttempt() != nullptr);
+
+    auto * sessionManager = mInitParams.exchangeMgr->GetSessionManager();
+    VerifyOrReturn(sessionManager != nullptr && sessionManager->SystemLayer() != nullptr);
+
+    CHIP_ERROR err = sessionManager->SystemLayer()->StartTimer(
+        System::Clock::Milliseconds32(CHIP_CONFIG_CASE_PARALLEL_ATTEMPT_DELAY_MS), OnParallelAttemptTimer, this);
+    LogErrorOnFailure(err);
+}
+
+void OperationalSessionSetup::OnParallelAttemptTimer(System::Layer * systemLayer, void * state)
+{
+    auto * self = static_cast<OperationalSessionSetup *>(state);
+    VerifyOrReturn(self->mState == State::Connecting);
+
+    // On success, this synchronously calls OnNodeAddressResolved, which starts
+    // the attempt.
+    self->mStartingParallelAttempt = true;
+    CHIP_ERROR err                 = Resolver::Instance().TryNextResult(self->mAddressLookupHandle);
+    self->mStartingParallelAttempt = false;
+
+    if (err == CHIP_NO_ERROR)
+    {
+        self->ScheduleParallelAttempt();
+    }
+}
+
+void OperationalSessionSetup::EstablishParallelConnection(const ResolveResult & result)
+{
+    ParallelAttempt * attempt = FindFreeParallelAttempt();
+    VerifyOrReturn(attempt != nullptr);
+
+    // If no CASE client is left, just keep going with the attempts in progress.
+    attempt->mClient = mClientPool->Allocate();
+    VerifyOrReturn(attempt->mClient != nullptr);
+    attempt->mAddress = result.address;
+
+#if CHIP_PROGRESS_LOGGING
+    char peerAddrBuff[Transport::PeerAddress::kMaxToStringSize];
+    attempt->mAddress.ToString(peerAddrBuff);
+    ChipLogProgress(Discovery, "OperationalSessionSetup[%u:" ChipLogFormatX64 "]: Also trying to establish a session at %s",
+                    mPeerId.GetFabricIndex(), ChipLogValueX64(mPeerId.GetNodeId()), peerAddrBuff);
+#endif // CHIP_PROGRESS_LOGGING
+
+    CHIP_ERROR err =
+        attempt->mClient->EstablishSession(mInitParams, mPeerId, attempt->mAddress, GetRemoteMRPConfig(result), attempt);
+    if (err != CHIP_NO_ERROR)
+    {
+        LogErrorOnFailure(err);
+        mClientPool->Release(attempt->mClient);
+        attempt->mClient = nullptr;
+    }
+}
+
+void OperationalSessionSetup::OnParallelAttemptEstablished(ParallelAttempt & attempt, const SessionHandle & session)
+{
+    VerifyOrReturn(mState == State::Connecting,
+                   ChipLogError(Discovery, "OnSessionEstablished was called while we were not connecting"));
+
+    // This address won the race: have the other sessions with the peer use it too.
+    mDeviceAddress = attempt.mAddress;
+    mInitParams.sessionManager->UpdateAllSessionsPeerAddress(mPeerId, mDeviceAddress);
+
+    // Cancels all the other attempts.
+    OnSessionEstablished(session);
+}
+
+void OperationalSessionSetup::OnParallelAttemptError(ParallelAttempt & attempt, CHIP_ERROR error, SessionEstablishmentStage stage)
+{
+    VerifyOrReturn(mState == State::Connecting,
+                   ChipLogError(Discovery, "OnSessionEstablishmentError was called while we were not connecting"));
+
+    CASEClient * client = attempt.mClient;
+    attempt.mClient     = nullptr;
+
+    if (mCASEClient != nullptr || HasParallelAttemptInProgress())
+    {
+        ChipLogProgress(Discovery, "OperationalSessionSetup[%u:" ChipLogFormatX64 "]: Parallel attempt failed: %" CHIP_ERROR_FORMAT,
+                        mPeerId.GetFabricIndex(), ChipLogValueX64(mPeerId.GetNodeId()), error.Format());
+        mClientPool->Release(client);
+        return;
+    }
+
+    // This was the last handshake in progress, so its failure is the failure
+    // of the session setup.
+    mCASEClient = client;
+    OnSessionEstablishmentError(error, stage);
+}
+
+OperationalSessionSetup::ParallelAttempt * OperationalSessionSetup::FindFreeParallelAttempt()
+{
+    for (auto & attempt : mParallelAttempts)
+    {
+        if (attempt.mClient == nullptr)
+        {
+            return &attempt;
+        }
+    }
+    return nullptr;
+}
+
+bool OperationalSessionSetup::HasParallelAttemptInProgress() const
+{
+    for (const auto & attempt : mParallelAttempts)
+    {
+        if (attempt.mClient != nullptr)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void OperationalSessionSetup::CancelParallelAttempts()
+{
+    auto * sessionManager = mInitParams.exchangeMgr != nullptr ? mInitParams.exchangeMgr->GetSessionManager() : nullptr;
+    if (sessionManager != nullptr && sessionManager->SystemLayer() != nullptr)
+    {
+        sessionManager->SystemLayer()->CancelTimer(OnParallelAttemptTimer, this);
+    }
+
+    for (auto & attempt : mParallelAttempts)
+    {
+        if (attempt.mClient != nullptr)
+        {
+            mClientPool->Release(attempt.mClient);
+            attempt.mClient = nullptr;
+        }
+    }
+}
+#endif // CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+
 void OperationalSessionSetup::EnqueueConnectionCallbacks(Callback::Callback<OnDeviceConnected> * onConnection,
                                                          Callback::Callback<OnDeviceConnectionFailure> * onFailure,
                                                          Callback::Callback<OnSetupFailure> * onSetupFailure)
@@ -450,6 +617,30 @@ void OperationalSessionSetup::OnSessionEstablishmentError(CHIP_ERROR error, Sess
     VerifyOrReturn(mState == State::Connecting,
                    ChipLogError(Discovery, "OnSessionEstablishmentError was called while we were not connecting"));
 
+    if (CHIP_ERROR_BUSY != error)
+    {
+        // We did not get a session at the address we resolved, so make sure
+        // the next lookup does not hand it out again.
+        auto const * fabricInfo = mInitParams.fabricTable->FindFabricWithIndex(mPeerId.GetFabricIndex());
+        if (fabricInfo != nullptr)
+        {
+            Resolver::Instance().InvalidateCachedResult(PeerId(fabricInfo->GetCompressedFabricId(), mPeerId.GetNodeId()));
+        }
+    }
+
+#if CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+    if (HasParallelAttemptInProgress())
+    {
+        // Keep waiting for the handshakes with the other addresses.
+        ChipLogProgress(Discovery,
+                        "OperationalSessionSetup[%u:" ChipLogFormatX64 "]: Session establishment failed: %" CHIP_ERROR_FORMAT
+                        ", waiting for the parallel attempts",
+                        mPeerId.GetFabricIndex(), ChipLogValueX64(mPeerId.GetNodeId()), error.Format());
+        CleanupCASEClient();
+        return;
+    }
+#endif // CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+
     // If this condition ever changes, we may need to store the error in a
     // member instead of having a boolean
     // mTryingNextResultDueToSessionEstablishmentError, so we can recover the
@@ -537,6 +728,7 @@ void OperationalSessionSetup::OnSessionEstablished(const SessionHandle & session
         return;
     }
 
+    mEstablishedNewSession = true;
     MoveToState(State::SecureConnected);
 
     DequeueConnectionCallbacks(CHIP_NO_ERROR);
@@ -575,6 +767,10 @@ OperationalSessionSetup::~OperationalSessionSetup()
         mClientPool->Release(mCASEClient);
     }
 
+#if CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+    CancelParallelAttempts();
+#endif // CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
     CancelSessionSetupReattempt();
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
@@ -654,6 +850,14 @@ void OperationalSessionSetup::PerformAddressUpdate()
 
 void OperationalSessionSetup::OnNodeAddressResolved(const PeerId & peerId, const ResolveResult & result)
 {
+#if CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+    if (mStartingParallelAttempt)
+    {
+        EstablishParallelConnection(result);
+        return;
+    }
+#endif // CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+
     UpdateDeviceData(result);
 }
 
@@ -737,6 +941,14 @@ void OperationalSessionSetup::UpdateAttemptCount(uint8_t attemptCount)
     }
 }
 
+void OperationalSessionSetup::SetPreviousAttempts(uint8_t attemptsDone)
+{
+    if (attemptsDone > mAttemptsDone)
+    {
+        mAttemptsDone = attemptsDone;
+    }
+}
+
 CHIP_ERROR OperationalSessionSetup::ScheduleSessionSetupReattempt(System::Clock::Seconds16 & timerDelay)
 {
     VerifyOrDie(mRemainingAttempts > 0);
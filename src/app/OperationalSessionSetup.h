@@ -182,6 +182,13 @@ public:
     OperationalSessionSetup(const CASEClientInitParams & params, CASEClientPoolDelegate * clientPool, ScopedNodeId peerId,
                             OperationalSessionReleaseDelegate * releaseDelegate)
     {
+#if CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+        for (auto & attempt : mParallelAttempts)
+        {
+            attempt.mOwner = this;
+        }
+#endif // CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+
         mInitParams = params;
         if (params.Validate() != CHIP_NO_ERROR || clientPool == nullptr || releaseDelegate == nullptr)
         {
@@ -193,6 +200,7 @@ public:
         mPeerId          = peerId;
         mReleaseDelegate = releaseDelegate;
         mState           = State::NeedsAddress;
+        mCreationTime    = System::SystemClock().GetMonotonicTimestamp();
         mAddressLookupHandle.SetListener(this);
     }
 
@@ -213,7 +221,8 @@ public:
      * lookup).
      *
      * `transportPayloadCapability` is set to kLargePayload when the session needs to be established
-     * over a transport that allows large payloads to be transferred, e.g., TCP.
+     * over a transport that allows large payloads to be transferred, e.g., TCP, or to
+     * kLargePayloadIfSupported when such a transport should be used only if the peer supports it.
      */
     void Connect(Callback::Callback<OnDeviceConnected> * onConnection, Callback::Callback<OnDeviceConnectionFailure> * onFailure,
                  TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload);
@@ -234,13 +243,21 @@ public:
      * (e.g. inability to start an address lookup).
      *
      * `transportPayloadCapability` is set to kLargePayload when the session needs to be established
-     * over a transport that allows large payloads to be transferred, e.g., TCP.
+     * over a transport that allows large payloads to be transferred, e.g., TCP, or to
+     * kLargePayloadIfSupported when such a transport should be used only if the peer supports it.
      */
     void Connect(Callback::Callback<OnDeviceConnected> * onConnection, Callback::Callback<OnSetupFailure> * onSetupFailure,
                  TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload);
 
     bool IsForAddressUpdate() const { return mPerformingAddressUpdate; }
 
+    /// Whether this session setup established a new CASE session with the
+    /// peer, as opposed to finding an existing one.
+    bool EstablishedNewSession() const { return mEstablishedNewSession; }
+
+    /// When the session setup was started.
+    System::Clock::Timestamp GetCreationTime() const { return mCreationTime; }
+
     //////////// SessionEstablishmentDelegate Implementation ///////////////
     void OnSessionEstablished(const SessionHandle & session) override;
     void OnSessionEstablishmentError(CHIP_ERROR error, SessionEstablishmentStage stage) override;
@@ -282,6 +299,13 @@ public:
 
     // Add a retry handler for this session setup.
     void AddRetryHandler(Callback::Callback<OnDeviceConnectionRetry> * onRetry);
+
+    // Number of attempts made so far, including the ones carried over with SetPreviousAttempts.
+    uint8_t GetAttemptsDone() const { return mAttemptsDone; }
+
+    // Continue the retry backoff of an earlier session setup with the same peer that failed after the given number of
+    // attempts.  Must be called before the first attempt.  Does not change the number of attempts remaining.
+    void SetPreviousAttempts(uint8_t attemptsDone);
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
 
 private:
@@ -304,6 +328,33 @@ private:
     // allocated it as part of an attempt to enter State::Connecting.
     CASEClient * mCASEClient = nullptr;
 
+    System::Clock::Timestamp mCreationTime;
+
+#if CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+    /// A CASE handshake with another resolved address of the peer, started
+    /// while the one in mCASEClient is in progress.
+    class ParallelAttempt : public SessionEstablishmentDelegate
+    {
+    public:
+        void OnSessionEstablished(const SessionHandle & session) override { mOwner->OnParallelAttemptEstablished(*this, session); }
+        void OnSessionEstablishmentError(CHIP_ERROR error, SessionEstablishmentStage stage) override
+        {
+            mOwner->OnParallelAttemptError(*this, error, stage);
+        }
+        void OnResponderBusy(System::Clock::Milliseconds16 requestedDelay) override { mOwner->OnResponderBusy(requestedDelay); }
+
+        OperationalSessionSetup * mOwner = nullptr;
+        CASEClient * mClient             = nullptr; // only non-null while the handshake is in progress
+        Transport::PeerAddress mAddress;
+    };
+
+    ParallelAttempt mParallelAttempts[CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS - 1];
+
+    // Set while TryNextResult is called to get the address of a parallel
+    // attempt, so that OnNodeAddressResolved starts that attempt.
+    bool mStartingParallelAttempt = false;
+#endif // CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+
     ScopedNodeId mPeerId;
 
     Transport::PeerAddress mDeviceAddress = Transport::PeerAddress::UDP(Inet::IPAddress::Any);
@@ -321,6 +372,7 @@ private:
     State mState = State::Uninitialized;
 
     bool mPerformingAddressUpdate = false;
+    bool mEstablishedNewSession   = false;
 
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES || CHIP_CONFIG_ENABLE_BUSY_HANDLING_FOR_OPERATIONAL_SESSION_SETUP
     System::Clock::Milliseconds16 mRequestedBusyDelay = System::Clock::kZero;
@@ -349,6 +401,32 @@ private:
 
     CHIP_ERROR EstablishConnection(const AddressResolve::ResolveResult & result);
 
+    /**
+     * The MRP parameters to start a CASE handshake with, for the given resolve result.
+     */
+    ReliableMessageProtocolConfig GetRemoteMRPConfig(const AddressResolve::ResolveResult & result) const;
+
+#if CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+    /**
+     * Start a timer to try the next resolved address in parallel with the
+     * handshakes in progress, if there is room for another attempt.
+     */
+    void ScheduleParallelAttempt();
+    static void OnParallelAttemptTimer(System::Layer * systemLayer, void * state);
+
+    void EstablishParallelConnection(const AddressResolve::ResolveResult & result);
+    void OnParallelAttemptEstablished(ParallelAttempt & attempt, const SessionHandle & session);
+    void OnParallelAttemptError(ParallelAttempt & attempt, CHIP_ERROR error, SessionEstablishmentStage stage);
+
+    ParallelAttempt * FindFreeParallelAttempt();
+    bool HasParallelAttemptInProgress() const;
+
+    /**
+     * Stop the parallel attempts in progress and any pending one.
+     */
+    void CancelParallelAttempts();
+#endif // CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS > 1
+
     /*
      * This checks to see if an existing CASE session exists to the peer within the SessionManager
      * and if one exists, to load that into mSecureSession.
@@ -0,0 +1,81 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/EventLoggingTypes.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * Non-volatile storage for logged events, so that they can still be delivered after a restart.
+ *
+ * EventManagement appends every event of a priority the store accepts as it is logged, encoded exactly as it is kept in the
+ * in-memory event buffers (an anonymous EventReportIB structure).  When EventManagement is initialized with a store, it
+ * reads the stored events back into its buffers, keeping the most recent ones that fit.
+ *
+ * Events of one priority are appended in increasing event number order and read back in that same order.  A store is
+ * expected to keep a bounded amount of data per priority, dropping its oldest events to make room for new ones.
+ */
+class PersistentEventStore
+{
+public:
+    /**
+     * A position in the events of one priority level.  A default-constructed cursor is before the oldest stored event.
+     */
+    struct Cursor
+    {
+        uint32_t mSegment = 0;
+        uint32_t mOffset  = 0;
+    };
+
+    virtual ~PersistentEventStore() = default;
+
+    /**
+     * Whether events of the given priority are kept by this store.
+     */
+    virtual bool Accepts(PriorityLevel aPriority) const = 0;
+
+    /**
+     * Store an event of the given priority, after all stored events of that priority.
+     */
+    virtual CHIP_ERROR Append(PriorityLevel aPriority, ByteSpan aEvent) = 0;
+
+    /**
+     * Read the first stored event of the given priority at or after aCursor, and move aCursor past it.  On success, aAt
+     * is set to the position of the event, for use with Overwrite, and aEvent refers to its encoding.  aEvent is only
+     * valid until the next call to the store.
+     *
+     * @retval CHIP_ERROR_NOT_FOUND if there is no stored event at or after aCursor.
+     */
+    virtual CHIP_ERROR ReadNext(PriorityLevel aPriority, Cursor & aCursor, Cursor & aAt, ByteSpan & aEvent) = 0;
+
+    /**
+     * Replace the stored event at aAt, as returned by ReadNext, with an encoding of the same length.  This is used to
+     * scrub the fabric index of events when a fabric is removed.
+     */
+    virtual CHIP_ERROR Overwrite(PriorityLevel aPriority, const Cursor & aAt, ByteSpan aEvent) = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -168,6 +168,8 @@ CHIP_ERROR ReadClient::ScheduleResubscription(uint32_t aTimeTillNextResubscripti
         mReadPrepareParams.mSessionHolder->AsSecureSession()->MarkAsDefunct();
     }
 
+    // A resubscription still waiting for the scheduler is superseded by this one.
+    ResubscriptionScheduler::CancelResubscription(*this);
     ReturnErrorOnFailure(
         InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
             System::Clock::Milliseconds32(aTimeTillNextResubscriptionMs), OnResubscribeTimerCallback, this));
@@ -180,6 +182,7 @@ void ReadClient::Close(CHIP_ERROR aError, bool allowResubscription)
 {
     if (IsReadType())
     {
+        mReadMetric.End(aError);
         if (aError != CHIP_NO_ERROR)
         {
             mpCallback.OnError(aError);
@@ -284,6 +287,9 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
 
     VerifyOrReturnError(ClientState::Idle == mState, err = CHIP_ERROR_INCORRECT_STATE);
 
+    // If sending fails, the metric ends when this object is destroyed.
+    mReadMetric.Begin();
+
     Span<AttributePathParams> attributePaths(aReadPrepareParams.mpAttributePathParamsList,
                                              aReadPrepareParams.mAttributePathParamsListSize);
     Span<EventPathParams> eventPaths(aReadPrepareParams.mpEventPathParamsList, aReadPrepareParams.mEventPathParamsListSize);
@@ -491,7 +497,7 @@ void ReadClient::OnActiveModeNotification()
     VerifyOrReturn(mReadPrepareParams.mEventPathParamsListSize != 0 || mReadPrepareParams.mAttributePathParamsListSize != 0);
 
     // When we reach here, the subscription definitely exceeded the liveness timeout. Just continue the unfinished resubscription
-    // logic in `OnLivenessTimeoutCallback`.
+    // logic in `OnLivenessTimeout`.
     if (IsInactiveICDSubscription())
     {
         TriggerResubscriptionForLivenessTimeout(CHIP_ERROR_TIMEOUT);
@@ -621,6 +627,14 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle && aPayload,
     EventReportIBs::Parser eventReportIBs;
     AttributeReportIBs::Parser attributeReportIBs;
     System::PacketBufferTLVReader reader;
+
+    // Primed reports are part of the subscription setup metric.
+    Tracing::PendingMetricEvent reportMetric(Tracing::kMetricIMSubscriptionReport);
+    if (IsSubscriptionActive())
+    {
+        reportMetric.Begin();
+    }
+
     reader.Init(std::move(aPayload));
     err = report.Init(reader);
     SuccessOrExit(err);
@@ -733,6 +747,7 @@ exit:
         err                     = StatusResponse::Send(Status::Success, mExchange.Get(), !noResponseExpected);
     }
 
+    reportMetric.End(err);
     mWaitingForFirstPrimingReport = false;
     return err;
 }
@@ -968,6 +983,8 @@ CHIP_ERROR ReadClient::RefreshLivenessCheckTimer()
 
     VerifyOrReturnError(IsSubscriptionActive(), CHIP_ERROR_INCORRECT_STATE);
 
+    VerifyOrReturnError(mpImEngine != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
     CancelLivenessCheckTimer();
 
     System::Clock::Timeout timeout;
@@ -978,8 +995,9 @@ CHIP_ERROR ReadClient::RefreshLivenessCheckTimer()
         DataManagement,
         "Refresh LivenessCheckTime for %lu milliseconds with SubscriptionId = 0x%08" PRIx32 " Peer = %02x:" ChipLogFormatX64,
         static_cast<long unsigned>(timeout.count()), mSubscriptionId, GetFabricIndex(), ChipLogValueX64(GetPeerNodeId()));
-    err = InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
-        timeout, OnLivenessTimeoutCallback, this);
+    // Subscriptions share the liveness wheel of the engine, so that refreshing the deadline on every report does not
+    // restart a system timer.
+    err = mpImEngine->GetSubscriptionLivenessWheel().Arm(*this, timeout);
 
     return err;
 }
@@ -1024,21 +1042,19 @@ CHIP_ERROR ReadClient::ComputeLivenessCheckTimerTimeout(System::Clock::Timeout *
 
 void ReadClient::CancelLivenessCheckTimer()
 {
-    InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
-        OnLivenessTimeoutCallback, this);
+    SubscriptionLivenessWheel::Disarm(*this);
 }
 
 void ReadClient::CancelResubscribeTimer()
 {
     InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
         OnResubscribeTimerCallback, this);
+    ResubscriptionScheduler::CancelResubscription(*this);
     mIsResubscriptionScheduled = false;
 }
 
-void ReadClient::OnLivenessTimeoutCallback(System::Layer * apSystemLayer, void * apAppState)
+void ReadClient::OnLivenessTimeout()
 {
-    ReadClient * const _this = reinterpret_cast<ReadClient *>(apAppState);
-
     // TODO: add a more specific error here for liveness timeout failure to distinguish between other classes of timeouts (i.e
     // response timeouts).
     CHIP_ERROR subscriptionTerminationCause = CHIP_ERROR_TIMEOUT;
@@ -1048,22 +1064,22 @@ void ReadClient::OnLivenessTimeoutCallback(System::Layer * apSystemLayer, void *
     // This might blow-up if either the client has since been free'ed (use-after-free), or if the engine has since
     // been shutdown at which point the client wouldn't exist in the active read client list.
     //
-    VerifyOrDie(_this->mpImEngine->InActiveReadClientList(_this));
+    VerifyOrDie(mpImEngine->InActiveReadClientList(this));
 
     ChipLogError(DataManagement,
                  "Subscription Liveness timeout with SubscriptionID = 0x%08" PRIx32 ", Peer = %02x:" ChipLogFormatX64,
-                 _this->mSubscriptionId, _this->GetFabricIndex(), ChipLogValueX64(_this->GetPeerNodeId()));
+                 mSubscriptionId, GetFabricIndex(), ChipLogValueX64(GetPeerNodeId()));
 
     // If subscription client is able to handle check-in messages and peer operation mode is LIT,
     // use CHIP_ERROR_LIT_SUBSCRIBE_INACTIVE_TIMEOUT as subscriptionTerminationCause.
     // This will cause us to wait for a check-in message before trying to re-subscribe, instead of trying
     // (and probably failing, because we are dealing with a LIT ICD) off a timer.
-    if (_this->mIsPeerLIT && _this->mReadPrepareParams.mRegisteredCheckInToken)
+    if (mIsPeerLIT && mReadPrepareParams.mRegisteredCheckInToken)
     {
         subscriptionTerminationCause = CHIP_ERROR_LIT_SUBSCRIBE_INACTIVE_TIMEOUT;
     }
 
-    _this->TriggerResubscriptionForLivenessTimeout(subscriptionTerminationCause);
+    TriggerResubscriptionForLivenessTimeout(subscriptionTerminationCause);
 }
 
 void ReadClient::TriggerResubscriptionForLivenessTimeout(CHIP_ERROR aReason)
@@ -1368,25 +1384,43 @@ void ReadClient::OnResubscribeTimerCallback(System::Layer * /* If this starts be
     ReadClient * const _this = static_cast<ReadClient *>(apAppState);
     VerifyOrDie(_this != nullptr);
 
-    _this->mIsResubscriptionScheduled = false;
+    // The resubscription timers of all the read clients fire at about the same time after a network outage, so let the
+    // engine pace the resubscriptions that need a new session.  The resubscription stays scheduled while it waits.
+    InteractionModelEngine * const engine = _this->mpImEngine;
+    const ResubscriptionPriority priority = _this->mReadPrepareParams.mResubscriptionPriority;
+    if (engine != nullptr && !engine->GetResubscriptionScheduler().RequestResubscription(*_this, priority))
+    {
+        return;
+    }
+
+    _this->Resubscribe();
+}
+
+bool ReadClient::CanResubscribeOverActiveSession() const
+{
+    return mReadPrepareParams.mSessionHolder && mReadPrepareParams.mSessionHolder->AsSecureSession()->IsActiveSession();
+}
+
+void ReadClient::Resubscribe()
+{
+    mIsResubscriptionScheduled = false;
 
     CHIP_ERROR err;
 
-    ChipLogProgress(DataManagement, "OnResubscribeTimerCallback: ForceCASE = %d", _this->mForceCaseOnNextResub);
-    _this->mNumRetries++;
+    ChipLogProgress(DataManagement, "OnResubscribeTimerCallback: ForceCASE = %d", mForceCaseOnNextResub);
+    mNumRetries++;
 
     bool allowResubscribeOnError = true;
-    if (!_this->mReadPrepareParams.mSessionHolder ||
-        !_this->mReadPrepareParams.mSessionHolder->AsSecureSession()->IsActiveSession())
+    if (!mReadPrepareParams.mSessionHolder || !mReadPrepareParams.mSessionHolder->AsSecureSession()->IsActiveSession())
     {
         // We don't have an active CASE session.  We need to go ahead and set
         // one up, if we can.
-        if (_this->EstablishSessionToPeer() == CHIP_NO_ERROR)
+        if (EstablishSessionToPeer() == CHIP_NO_ERROR)
         {
             return;
         }
 
-        if (_this->mForceCaseOnNextResub)
+        if (mForceCaseOnNextResub)
         {
             // Caller asked us to force CASE but we have no way to do CASE.
             // Just stop trying.
@@ -1398,7 +1432,7 @@ void ReadClient::OnResubscribeTimerCallback(System::Layer * /* If this starts be
         ExitNow();
     }
 
-    err = _this->SendSubscribeRequest(_this->mReadPrepareParams);
+    err = SendSubscribeRequest(mReadPrepareParams);
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -1409,7 +1443,7 @@ exit:
         //
         // In that case, don't permit re-subscription to occur.
         //
-        _this->Close(err, allowResubscribeOnError);
+        Close(err, allowResubscribeOnError);
     }
 }
 
@@ -1453,7 +1487,8 @@ bool ReadClient::TriggerResubscribeIfScheduled(const char * reason)
 
     ChipLogDetail(DataManagement, "ReadClient[%p] triggering resubscribe, reason: %s", this, reason);
     CancelResubscribeTimer();
-    OnResubscribeTimerCallback(nullptr, this);
+    // The peer is known to be listening, so do not wait for the resubscription scheduler.
+    Resubscribe();
 
     return true;
 }
@@ -36,6 +36,8 @@
 #include <app/MessageDef/SubscribeResponseMessage.h>
 #include <app/OperationalSessionSetup.h>
 #include <app/ReadPrepareParams.h>
+#include <app/ResubscriptionScheduler.h>
+#include <app/SubscriptionLivenessWheel.h>
 #include <app/data-model/Decode.h>
 #include <lib/core/CHIPCallback.h>
 #include <lib/core/CHIPCore.h>
@@ -49,6 +51,7 @@
 #include <messaging/Flags.h>
 #include <protocols/Protocols.h>
 #include <system/SystemPacketBuffer.h>
+#include <tracing/metric_event.h>
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
 namespace chip {
@@ -67,7 +70,9 @@ class InteractionModelEngine;
  *         Callback::OnResubscriptionNeeded and providing an alternative implementation.
  *
  */
-class ReadClient : public Messaging::ExchangeDelegate
+class ReadClient : public Messaging::ExchangeDelegate,
+                   private SubscriptionLivenessWheel::Entry,
+                   private ResubscriptionScheduler::Entry
 {
 public:
     class Callback
@@ -576,7 +581,9 @@ private:
     CHIP_ERROR ProcessAttributeReportIBs(TLV::TLVReader & aAttributeDataIBsReader);
     CHIP_ERROR ProcessEventReportIBs(TLV::TLVReader & aEventReportIBsReader);
 
-    static void OnLivenessTimeoutCallback(System::Layer * apSystemLayer, void * apAppState);
+    // SubscriptionLivenessWheel::Entry implementation
+    void OnLivenessTimeout() override;
+
     CHIP_ERROR ProcessSubscribeResponse(System::PacketBufferHandle && aPayload);
     CHIP_ERROR RefreshLivenessCheckTimer();
     CHIP_ERROR ComputeLivenessCheckTimerTimeout(System::Clock::Timeout * aTimeout);
@@ -606,6 +613,13 @@ private:
     CHIP_ERROR SendSubscribeRequestImpl(const ReadPrepareParams & aSubscribePrepareParams);
     void UpdateDataVersionFilters(const ConcreteDataAttributePath & aPath);
     static void OnResubscribeTimerCallback(System::Layer * apSystemLayer, void * apAppState);
+    // Send the subscribe request again, setting up a session first if needed.
+    void Resubscribe();
+
+    // ResubscriptionScheduler::Entry implementation
+    ScopedNodeId GetResubscriptionPeer() const override { return mPeer; }
+    bool CanResubscribeOverActiveSession() const override;
+    void OnResubscriptionAdmitted() override { Resubscribe(); }
     // Called to ensure OnReportBegin is called before calling OnEventData or OnAttributeData
     void NoteReportingData();
 
@@ -642,6 +656,7 @@ private:
     ClientState mState    = ClientState::Idle;
     bool mIsReporting     = false;
     bool mIsInitialReport = true;
+    Tracing::PendingMetricEvent mReadMetric{ Tracing::kMetricIMRead };
     // boolean to check if client is waiting for the first priming report
     bool mWaitingForFirstPrimingReport = true;
     bool mPendingMoreChunks            = false;
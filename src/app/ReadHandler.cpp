@@ -25,6 +25,7 @@
 #include <app/data-model-provider/Provider.h>
 #include <app/icd/server/ICDServerConfig.h>
 #include <lib/core/TLVUtilities.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <messaging/ExchangeContext.h>
 
@@ -35,6 +36,8 @@
 #include <app/icd/server/ICDConfigurationData.h> //nogncheck
 #endif
 
+#include <algorithm>
+
 namespace chip {
 namespace app {
 using Status = Protocols::InteractionModel::Status;
@@ -101,7 +104,7 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
     for (size_t i = 0; i < resumptionSessionEstablisher.mSubscriptionInfo.mAttributePaths.AllocatedSize(); i++)
     {
         AttributePathParams params = resumptionSessionEstablisher.mSubscriptionInfo.mAttributePaths[i].GetParams();
-        CHIP_ERROR err = mManagementCallback.GetInteractionModelEngine()->PushFrontAttributePathList(mpAttributePathList, params);
+        CHIP_ERROR err             = PushFrontAttributePath(params);
         if (err != CHIP_NO_ERROR)
         {
             Close();
@@ -119,6 +122,11 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
         }
     }
 
+#if CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+    CompactAttributePaths(sessionHandle->GetSubjectDescriptor());
+#endif // CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+    mManagementCallback.GetInteractionModelEngine()->RegisterReadHandlerInterest(*this, mpAttributePathList);
+
     mSessionHandle.Grab(sessionHandle);
 
     SetStateFlag(ReadHandlerFlags::ActiveSubscription);
@@ -159,9 +167,15 @@ ReadHandler::~ReadHandler()
     {
         mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReportConfirm();
     }
+    mManagementCallback.GetInteractionModelEngine()->UnregisterReadHandlerInterest(*this);
+#if CHIP_CONFIG_IM_READ_HANDLER_ARENA
+    // The nodes go away with mArena.
+    mpAttributePathList = nullptr;
+#else
     mManagementCallback.GetInteractionModelEngine()->ReleaseAttributePathList(mpAttributePathList);
+#endif // CHIP_CONFIG_IM_READ_HANDLER_ARENA
     mManagementCallback.GetInteractionModelEngine()->ReleaseEventPathList(mpEventPathList);
-    mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
+    ReleaseDataVersionFilterList();
 }
 
 void ReadHandler::Close(CloseOptions options)
@@ -367,7 +381,7 @@ CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload, b
     {
         mPreviousReportsBeginGeneration = mCurrentReportsBeginGeneration;
         ClearForceDirtyFlag();
-        mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
+        ReleaseDataVersionFilterList();
     }
 
     return err;
@@ -528,13 +542,20 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
         AttributePathIB::Parser path;
         ReturnErrorOnFailure(path.Init(reader));
         ReturnErrorOnFailure(path.ParsePath(attribute));
-        ReturnErrorOnFailure(
-            mManagementCallback.GetInteractionModelEngine()->PushFrontAttributePathList(mpAttributePathList, attribute));
+        ReturnErrorOnFailure(PushFrontAttributePath(attribute));
     }
     // if we have exhausted this container
     if (CHIP_END_OF_TLV == err)
     {
-        mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
+        mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(
+            mpAttributePathList, /* aNodesFromPool = */ !CHIP_CONFIG_IM_READ_HANDLER_ARENA);
+#if CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+        if (IsType(InteractionType::Subscribe))
+        {
+            CompactAttributePaths(GetSubjectDescriptor());
+        }
+#endif // CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+        mManagementCallback.GetInteractionModelEngine()->RegisterReadHandlerInterest(*this, mpAttributePathList);
         mAttributePathExpandPosition = AttributePathExpandIterator::Position::StartIterating(mpAttributePathList);
         err                          = CHIP_NO_ERROR;
     }
@@ -561,17 +582,195 @@ CHIP_ERROR ReadHandler::ProcessDataVersionFilterList(DataVersionFilterIBs::Parse
         ReturnErrorOnFailure(path.GetEndpoint(&(versionFilter.mEndpointId)));
         ReturnErrorOnFailure(path.GetCluster(&(versionFilter.mClusterId)));
         VerifyOrReturnError(versionFilter.IsValidDataVersionFilter(), CHIP_ERROR_IM_MALFORMED_DATA_VERSION_FILTER_IB);
-        ReturnErrorOnFailure(mManagementCallback.GetInteractionModelEngine()->PushFrontDataVersionFilterList(
-            mpDataVersionFilterList, versionFilter));
+        ReturnErrorOnFailure(PushFrontDataVersionFilter(versionFilter));
     }
 
     if (CHIP_END_OF_TLV == err)
     {
+        IndexDataVersionFilters();
         err = CHIP_NO_ERROR;
     }
     return err;
 }
 
+void ReadHandler::IndexDataVersionFilters()
+{
+    VerifyOrReturn(mpSortedDataVersionFilters == nullptr);
+
+    size_t count = GetDataVersionFilterCount();
+    VerifyOrReturn(count > 0);
+
+    auto * filters = static_cast<DataVersionFilter *>(Platform::MemoryCalloc(count, sizeof(DataVersionFilter)));
+    if (filters == nullptr)
+    {
+        ChipLogError(InteractionModel, "Unable to index %u data version filters", static_cast<unsigned>(count));
+        return;
+    }
+
+    size_t index = 0;
+    for (auto * filter = mpDataVersionFilterList; filter != nullptr; filter = filter->mpNext)
+    {
+        filters[index++] = filter->mValue;
+    }
+    std::sort(filters, filters + count, [](const DataVersionFilter & a, const DataVersionFilter & b) {
+        return a.mEndpointId < b.mEndpointId || (a.mEndpointId == b.mEndpointId && a.mClusterId < b.mClusterId);
+    });
+
+    mpSortedDataVersionFilters    = filters;
+    mSortedDataVersionFilterCount = count;
+}
+
+#if CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+void ReadHandler::CompactAttributePaths(const Access::SubjectDescriptor & aSubjectDescriptor)
+{
+    mManagementCallback.GetInteractionModelEngine()->CompactAttributePathList(
+        mpAttributePathList, aSubjectDescriptor, /* aNodesFromPool = */ !CHIP_CONFIG_IM_READ_HANDLER_ARENA);
+
+    mpWildcardEndpointPathList = mpAttributePathList;
+    while (mpWildcardEndpointPathList != nullptr && !mpWildcardEndpointPathList->mValue.HasWildcardEndpointId())
+    {
+        mpWildcardEndpointPathList = mpWildcardEndpointPathList->mpNext;
+    }
+    SetStateFlag(ReadHandlerFlags::SortedAttributePaths);
+}
+#endif // CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+
+bool ReadHandler::IsInterestedIn(const AttributePathParams & aAttributePath) const
+{
+    for (auto * path = mpAttributePathList; path != nullptr; path = path->mpNext)
+    {
+#if CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+        // The sorted paths on concrete endpoints come first, by endpoint: none of those past the changed endpoint match.
+        if (mFlags.Has(ReadHandlerFlags::SortedAttributePaths) && !aAttributePath.HasWildcardEndpointId() &&
+            !path->mValue.HasWildcardEndpointId() && path->mValue.mEndpointId > aAttributePath.mEndpointId)
+        {
+            path = mpWildcardEndpointPathList;
+            if (path == nullptr)
+            {
+                break;
+            }
+        }
+#endif // CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+        if (path->mValue.Intersects(aAttributePath))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR ReadHandler::PushFrontAttributePath(AttributePathParams & aAttributePath)
+{
+#if CHIP_CONFIG_IM_READ_HANDLER_ARENA
+    auto * node = mArena.New<SingleLinkedListNode<AttributePathParams>>();
+    if (node == nullptr)
+    {
+        ChipLogError(InteractionModel, "AttributePath arena allocation failed");
+        return CHIP_IM_GLOBAL_STATUS(PathsExhausted);
+    }
+    node->mValue        = aAttributePath;
+    node->mpNext        = mpAttributePathList;
+    mpAttributePathList = node;
+    return CHIP_NO_ERROR;
+#else
+    return mManagementCallback.GetInteractionModelEngine()->PushFrontAttributePathList(mpAttributePathList, aAttributePath);
+#endif // CHIP_CONFIG_IM_READ_HANDLER_ARENA
+}
+
+CHIP_ERROR ReadHandler::PushFrontDataVersionFilter(DataVersionFilter & aDataVersionFilter)
+{
+#if CHIP_CONFIG_IM_READ_HANDLER_ARENA
+    auto * node = mArena.New<SingleLinkedListNode<DataVersionFilter>>();
+    if (node == nullptr)
+    {
+        // Like a full pool: the filter is only an optimization.
+        ChipLogError(InteractionModel, "DataVersionFilter arena allocation failed, ignore this filter");
+        return CHIP_NO_ERROR;
+    }
+    node->mValue            = aDataVersionFilter;
+    node->mpNext            = mpDataVersionFilterList;
+    mpDataVersionFilterList = node;
+    return CHIP_NO_ERROR;
+#else
+    return mManagementCallback.GetInteractionModelEngine()->PushFrontDataVersionFilterList(mpDataVersionFilterList,
+                                                                                          aDataVersionFilter);
+#endif // CHIP_CONFIG_IM_READ_HANDLER_ARENA
+}
+
+void ReadHandler::ReleaseDataVersionFilterList()
+{
+    Platform::MemoryFree(mpSortedDataVersionFilters);
+    mpSortedDataVersionFilters    = nullptr;
+    mSortedDataVersionFilterCount = 0;
+#if CHIP_CONFIG_IM_READ_HANDLER_ARENA
+    // The filters only matter for the first report; their nodes are reclaimed with the rest of mArena.
+    mpDataVersionFilterList = nullptr;
+#else
+    mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
+#endif // CHIP_CONFIG_IM_READ_HANDLER_ARENA
+}
+
+#if CHIP_CONFIG_IM_READ_HANDLER_ACCESS_CACHE_SIZE > 0
+void ReadHandler::GetCachedClusterAccess(const ConcreteClusterPath & aCluster, uint8_t & aAllowed, uint8_t & aDenied)
+{
+    aAllowed = 0;
+    aDenied  = 0;
+
+    const uint32_t generation = Access::GetAccessControl().GetGeneration();
+    if (mAccessCacheGeneration != generation)
+    {
+        for (auto & cached : mAccessCache)
+        {
+            cached = CachedClusterAccess();
+        }
+        mAccessCacheGeneration = generation;
+        return;
+    }
+
+    for (const auto & cached : mAccessCache)
+    {
+        if ((cached.allowed | cached.denied) != 0 && cached.cluster == aCluster)
+        {
+            aAllowed = cached.allowed;
+            aDenied  = cached.denied;
+            return;
+        }
+    }
+}
+
+void ReadHandler::CacheClusterAccess(const ConcreteClusterPath & aCluster, uint8_t aPrivilegeBit, bool aAllowed)
+{
+    // Results computed before a change of the ACL must not be kept for the new generation.
+    VerifyOrReturn(mAccessCacheGeneration == Access::GetAccessControl().GetGeneration());
+
+    CachedClusterAccess * entry = nullptr;
+    for (auto & cached : mAccessCache)
+    {
+        if ((cached.allowed | cached.denied) != 0 && cached.cluster == aCluster)
+        {
+            entry = &cached;
+            break;
+        }
+    }
+    if (entry == nullptr)
+    {
+        entry                 = &mAccessCache[mNextAccessCacheEntry];
+        mNextAccessCacheEntry = static_cast<uint8_t>((mNextAccessCacheEntry + 1) % MATTER_ARRAY_SIZE(mAccessCache));
+        *entry                = CachedClusterAccess();
+        entry->cluster        = aCluster;
+    }
+
+    if (aAllowed)
+    {
+        entry->allowed = static_cast<uint8_t>(entry->allowed | aPrivilegeBit);
+    }
+    else
+    {
+        entry->denied = static_cast<uint8_t>(entry->denied | aPrivilegeBit);
+    }
+}
+#endif // CHIP_CONFIG_IM_READ_HANDLER_ACCESS_CACHE_SIZE > 0
+
 CHIP_ERROR ReadHandler::ProcessEventPaths(EventPathIBs::Parser & aEventPathsParser)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
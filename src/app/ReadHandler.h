@@ -29,9 +29,11 @@
 #include <app/AttributePathParams.h>
 #include <app/AttributeValueEncoder.h>
 #include <app/CASESessionManager.h>
+#include <app/ConcreteClusterPath.h>
 #include <app/DataVersionFilter.h>
 #include <app/EventManagement.h>
 #include <app/EventPathParams.h>
+#include <app/InteractionArena.h>
 #include <app/MessageDef/AttributePathIBs.h>
 #include <app/MessageDef/DataVersionFilterIBs.h>
 #include <app/MessageDef/EventFilterIBs.h>
@@ -45,6 +47,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/LinkedList.h>
+#include <lib/support/Span.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeHolder.h>
 #include <messaging/ExchangeMgr.h>
@@ -228,6 +231,12 @@ public:
     const SingleLinkedListNode<AttributePathParams> * GetAttributePathList() const { return mpAttributePathList; }
     const SingleLinkedListNode<EventPathParams> * GetEventPathList() const { return mpEventPathList; }
     const SingleLinkedListNode<DataVersionFilter> * GetDataVersionFilterList() const { return mpDataVersionFilterList; }
+    /// The data version filters sorted by endpoint and cluster, or an empty span if they could not be indexed (or there are
+    /// none), in which case GetDataVersionFilterList() has to be walked instead.
+    Span<const DataVersionFilter> GetSortedDataVersionFilters() const
+    {
+        return Span<const DataVersionFilter>(mpSortedDataVersionFilters, mSortedDataVersionFilterCount);
+    }
 
     /**
      * @brief Returns the reporting intervals that will used by the ReadHandler for the subscription being requested.
@@ -337,6 +346,9 @@ private:
 
         // Don't need the response for report data if true
         SuppressResponse = (1 << 5),
+
+        // The attribute paths were sorted by CompactAttributePaths.
+        SortedAttributePaths = (1 << 6),
     };
 
     /**
@@ -425,6 +437,9 @@ private:
     /// run if the change to the attribute path makes the ReadHandler reportable.
     /// @param aAttributeChanged Path to the attribute that was changed.
     void AttributePathIsDirty(DataModel::Provider * apDataModel, const AttributePathParams & aAttributeChanged);
+
+    /// Whether any of the attribute paths of this handler intersects aAttributePath.
+    bool IsInterestedIn(const AttributePathParams & aAttributePath) const;
     bool IsDirty() const
     {
         return (mDirtyGeneration > mPreviousReportsBeginGeneration) || mFlags.Has(ReadHandlerFlags::ForceDirty);
@@ -464,6 +479,21 @@ private:
 
     CHIP_ERROR SendStatusReport(Protocols::InteractionModel::Status aStatus);
 
+    /// Cluster-wide ACL results (see Access::AccessControl::CheckCluster) of the subject of this handler, which cannot change
+    /// during the interaction, kept by the reporting engine across reports until the ACL or the access restrictions change.
+    /// The results are bitmaps of the privileges allowed and denied on the cluster; both are 0 if nothing is cached.
+#if CHIP_CONFIG_IM_READ_HANDLER_ACCESS_CACHE_SIZE > 0
+    void GetCachedClusterAccess(const ConcreteClusterPath & aCluster, uint8_t & aAllowed, uint8_t & aDenied);
+    void CacheClusterAccess(const ConcreteClusterPath & aCluster, uint8_t aPrivilegeBit, bool aAllowed);
+#else
+    void GetCachedClusterAccess(const ConcreteClusterPath & aCluster, uint8_t & aAllowed, uint8_t & aDenied)
+    {
+        aAllowed = 0;
+        aDenied  = 0;
+    }
+    void CacheClusterAccess(const ConcreteClusterPath & aCluster, uint8_t aPrivilegeBit, bool aAllowed) {}
+#endif // CHIP_CONFIG_IM_READ_HANDLER_ACCESS_CACHE_SIZE > 0
+
     friend class TestReadInteraction;
     friend class chip::app::reporting::TestReportingEngine;
     friend class chip::app::reporting::TestReportScheduler;
@@ -508,6 +538,15 @@ private:
     CHIP_ERROR ProcessSubscribeRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessReadRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessAttributePaths(AttributePathIBs::Parser & aAttributePathListParser);
+    CHIP_ERROR PushFrontAttributePath(AttributePathParams & aAttributePath);
+    CHIP_ERROR PushFrontDataVersionFilter(DataVersionFilter & aDataVersionFilter);
+    /// Builds the sorted copy of mpDataVersionFilterList that lets the priming report find the filters of a cluster without
+    /// walking the whole list. Best effort: on allocation failure the list is walked instead.
+    void IndexDataVersionFilters();
+    void ReleaseDataVersionFilterList();
+#if CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+    void CompactAttributePaths(const Access::SubjectDescriptor & aSubjectDescriptor);
+#endif // CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
     CHIP_ERROR ProcessEventPaths(EventPathIBs::Parser & aEventPathsParser);
     CHIP_ERROR ProcessEventFilters(EventFilterIBs::Parser & aEventFiltersParser);
     CHIP_ERROR OnStatusResponse(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload,
@@ -592,6 +631,31 @@ private:
     SingleLinkedListNode<AttributePathParams> * mpAttributePathList   = nullptr;
     SingleLinkedListNode<EventPathParams> * mpEventPathList           = nullptr;
     SingleLinkedListNode<DataVersionFilter> * mpDataVersionFilterList = nullptr;
+    DataVersionFilter * mpSortedDataVersionFilters                    = nullptr;
+    size_t mSortedDataVersionFilterCount                              = 0;
+
+#if CHIP_CONFIG_IM_READ_HANDLER_ARENA
+    // Holds the nodes of mpAttributePathList and mpDataVersionFilterList.
+    InteractionArena mArena;
+#endif // CHIP_CONFIG_IM_READ_HANDLER_ARENA
+
+#if CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+    // Once the paths are sorted, the first one with a wildcard endpoint: everything before it has a concrete endpoint.
+    SingleLinkedListNode<AttributePathParams> * mpWildcardEndpointPathList = nullptr;
+#endif // CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+
+#if CHIP_CONFIG_IM_READ_HANDLER_ACCESS_CACHE_SIZE > 0
+    // Valid while the access control generation is mAccessCacheGeneration. Unused entries have no bits set.
+    struct CachedClusterAccess
+    {
+        ConcreteClusterPath cluster;
+        uint8_t allowed = 0; // bits of the privileges allowed on the cluster
+        uint8_t denied  = 0; // bits of the privileges denied on the cluster
+    };
+    CachedClusterAccess mAccessCache[CHIP_CONFIG_IM_READ_HANDLER_ACCESS_CACHE_SIZE];
+    uint32_t mAccessCacheGeneration = 0;
+    uint8_t mNextAccessCacheEntry   = 0;
+#endif // CHIP_CONFIG_IM_READ_HANDLER_ACCESS_CACHE_SIZE > 0
 
     ManagementCallback & mManagementCallback;
 
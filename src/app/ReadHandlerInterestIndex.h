@@ -0,0 +1,243 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Iterators.h>
+#include <lib/support/LinkedList.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * @class ReadHandlerInterestIndex
+ *
+ * @brief Inverted index from (endpoint, cluster) to the read handlers whose attribute path lists may intersect it.
+ *
+ * Each registered handler gets one entry per distinct (endpoint, cluster) pair in its attribute path list. A handler with any
+ * path that has a wildcard endpoint or a wildcard cluster is instead registered once as "always interested", since it may
+ * intersect any concrete cluster.
+ *
+ * Every handler needs at most one entry per attribute path it holds, so sizing the index with the capacity of the attribute path
+ * pool guarantees it never runs out of entries. Should it run out anyway, the index reports itself as incomplete until it is
+ * emptied, and callers are expected to fall back to visiting every handler.
+ */
+template <class Handler, size_t kCapacity>
+class ReadHandlerInterestIndex
+{
+public:
+    static_assert(kCapacity > 0 && kCapacity < UINT16_MAX, "ReadHandlerInterestIndex capacity must fit a 16-bit index");
+
+    ReadHandlerInterestIndex() { Clear(); }
+
+    ReadHandlerInterestIndex(const ReadHandlerInterestIndex &)             = delete;
+    ReadHandlerInterestIndex & operator=(const ReadHandlerInterestIndex &) = delete;
+
+    /**
+     * (Re)registers the interest of a handler, replacing any previous registration for that handler.
+     */
+    void Register(Handler & aHandler, const SingleLinkedListNode<AttributePathParams> * aAttributePaths)
+    {
+        Unregister(aHandler);
+
+        bool hasNonIndexablePath = false;
+        for (auto * path = aAttributePaths; path != nullptr; path = path->mpNext)
+        {
+            hasNonIndexablePath = hasNonIndexablePath || !IsIndexable(path->mValue);
+        }
+
+        if (hasNonIndexablePath)
+        {
+            Insert(aHandler, mAlwaysHead, kInvalidEndpointId, kInvalidClusterId);
+            return;
+        }
+
+        for (auto * path = aAttributePaths; path != nullptr; path = path->mpNext)
+        {
+            Insert(aHandler, mBuckets[BucketFor(path->mValue.mEndpointId, path->mValue.mClusterId)], path->mValue.mEndpointId,
+                   path->mValue.mClusterId);
+        }
+    }
+
+    /**
+     * Removes every entry of the given handler. This is a no-op for handlers that are not registered.
+     */
+    void Unregister(Handler & aHandler)
+    {
+        for (auto & head : mBuckets)
+        {
+            RemoveFromChain(head, aHandler);
+        }
+        RemoveFromChain(mAlwaysHead, aHandler);
+
+        if (mAllocated == 0)
+        {
+            mOverflowed = false;
+        }
+    }
+
+    void Clear()
+    {
+        for (uint16_t i = 0; i < kCapacity; i++)
+        {
+            mEntries[i].mpHandler = nullptr;
+            mEntries[i].mNext     = static_cast<uint16_t>(i + 1u < kCapacity ? i + 1u : kInvalidIndex);
+        }
+        for (auto & head : mBuckets)
+        {
+            head = kInvalidIndex;
+        }
+        mAlwaysHead = kInvalidIndex;
+        mFreeHead   = 0;
+        mAllocated  = 0;
+        mOverflowed = false;
+    }
+
+    /**
+     * Returns whether ForEachInterestedHandler can be used for the given changed path: the path must have a concrete endpoint
+     * and a concrete cluster, and the index must not have overflowed.
+     */
+    bool CanLookup(const AttributePathParams & aChangedPath) const { return !mOverflowed && IsIndexable(aChangedPath); }
+
+    /**
+     * Calls the function once for every handler that may be interested in the given changed path (see CanLookup). Handlers
+     * still need to check their own path list for an actual intersection.
+     *
+     * The function must not register or unregister handlers.
+     */
+    template <typename Function>
+    Loop ForEachInterestedHandler(const AttributePathParams & aChangedPath, Function && function)
+    {
+        for (uint16_t i = mAlwaysHead; i != kInvalidIndex; i = mEntries[i].mNext)
+        {
+            VerifyOrReturnValue(function(mEntries[i].mpHandler) != Loop::Break, Loop::Break);
+        }
+
+        uint16_t head = mBuckets[BucketFor(aChangedPath.mEndpointId, aChangedPath.mClusterId)];
+        for (uint16_t i = head; i != kInvalidIndex; i = mEntries[i].mNext)
+        {
+            const Entry & entry = mEntries[i];
+            if (entry.mEndpointId == aChangedPath.mEndpointId && entry.mClusterId == aChangedPath.mClusterId)
+            {
+                VerifyOrReturnValue(function(entry.mpHandler) != Loop::Break, Loop::Break);
+            }
+        }
+        return Loop::Finish;
+    }
+
+    size_t Allocated() const { return mAllocated; }
+    bool HasOverflowed() const { return mOverflowed; }
+
+private:
+    static constexpr uint16_t kInvalidIndex = UINT16_MAX;
+
+    static constexpr size_t BucketCountFor(size_t capacity)
+    {
+        size_t count = 4;
+        while (count < capacity)
+        {
+            count <<= 1;
+        }
+        return count;
+    }
+
+    static constexpr size_t kBucketCount = BucketCountFor(kCapacity);
+
+    struct Entry
+    {
+        Handler * mpHandler    = nullptr;
+        ClusterId mClusterId   = kInvalidClusterId;
+        EndpointId mEndpointId = kInvalidEndpointId;
+        uint16_t mNext         = kInvalidIndex;
+    };
+
+    static bool IsIndexable(const AttributePathParams & aPath)
+    {
+        return !aPath.HasWildcardEndpointId() && !aPath.HasWildcardClusterId();
+    }
+
+    static size_t BucketFor(EndpointId aEndpoint, ClusterId aCluster)
+    {
+        uint32_t hash = (aCluster * 0x85EBCA6Bu) ^ (static_cast<uint32_t>(aEndpoint) * 0x9E3779B1u);
+        return (hash ^ (hash >> 15)) & (kBucketCount - 1);
+    }
+
+    void Insert(Handler & aHandler, uint16_t & aHead, EndpointId aEndpoint, ClusterId aCluster)
+    {
+        for (uint16_t i = aHead; i != kInvalidIndex; i = mEntries[i].mNext)
+        {
+            const Entry & entry = mEntries[i];
+            if (entry.mpHandler == &aHandler && entry.mEndpointId == aEndpoint && entry.mClusterId == aCluster)
+            {
+                return;
+            }
+        }
+
+        if (mFreeHead == kInvalidIndex)
+        {
+            mOverflowed = true;
+            return;
+        }
+
+        uint16_t index    = mFreeHead;
+        Entry & entry     = mEntries[index];
+        mFreeHead         = entry.mNext;
+        entry.mpHandler   = &aHandler;
+        entry.mEndpointId = aEndpoint;
+        entry.mClusterId  = aCluster;
+        entry.mNext       = aHead;
+        aHead             = index;
+        mAllocated++;
+    }
+
+    void RemoveFromChain(uint16_t & aHead, Handler & aHandler)
+    {
+        uint16_t * link = &aHead;
+        while (*link != kInvalidIndex)
+        {
+            uint16_t index = *link;
+            Entry & entry  = mEntries[index];
+            if (entry.mpHandler != &aHandler)
+            {
+                link = &entry.mNext;
+                continue;
+            }
+
+            *link           = entry.mNext;
+            entry.mpHandler = nullptr;
+            entry.mNext     = mFreeHead;
+            mFreeHead       = index;
+            mAllocated--;
+        }
+    }
+
+    Entry mEntries[kCapacity];
+    uint16_t mBuckets[kBucketCount];
+    uint16_t mAlwaysHead = kInvalidIndex;
+    uint16_t mFreeHead   = kInvalidIndex;
+    size_t mAllocated    = 0;
+    bool mOverflowed     = false;
+};
+
+} // namespace app
+} // namespace chip
@@ -30,6 +30,17 @@
 namespace chip {
 namespace app {
 
+/**
+ * Order in which subscriptions that need to resubscribe are let through when resubscriptions are rate limited, see
+ * ResubscriptionScheduler.
+ */
+enum class ResubscriptionPriority : uint8_t
+{
+    kLow,
+    kNormal,
+    kHigh,
+};
+
 struct ReadPrepareParams
 {
     SessionHolder mSessionHolder;
@@ -60,6 +71,10 @@ struct ReadPrepareParams
     // to resubscribe. This field is ignored for read operations.
     bool mRegisteredCheckInToken = false;
 
+    // Priority of the resubscriptions of this subscription over the ones of other subscriptions, when many of them need to
+    // resubscribe at once. This field is ignored for read operations.
+    ResubscriptionPriority mResubscriptionPriority = ResubscriptionPriority::kNormal;
+
     ReadPrepareParams() {}
     ReadPrepareParams(const SessionHandle & sessionHandle) { mSessionHolder.Grab(sessionHandle); }
     ReadPrepareParams(ReadPrepareParams && other) : mSessionHolder(other.mSessionHolder)
@@ -78,6 +93,7 @@ struct ReadPrepareParams
         mIsFabricFiltered                  = other.mIsFabricFiltered;
         mIsPeerLIT                         = other.mIsPeerLIT;
         mRegisteredCheckInToken            = other.mRegisteredCheckInToken;
+        mResubscriptionPriority            = other.mResubscriptionPriority;
         other.mpEventPathParamsList        = nullptr;
         other.mEventPathParamsListSize     = 0;
         other.mpAttributePathParamsList    = nullptr;
@@ -104,6 +120,7 @@ struct ReadPrepareParams
         mIsFabricFiltered                  = other.mIsFabricFiltered;
         mIsPeerLIT                         = other.mIsPeerLIT;
         mRegisteredCheckInToken            = other.mRegisteredCheckInToken;
+        mResubscriptionPriority            = other.mResubscriptionPriority;
         other.mpEventPathParamsList        = nullptr;
         other.mEventPathParamsListSize     = 0;
         other.mpAttributePathParamsList    = nullptr;
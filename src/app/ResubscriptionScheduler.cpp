@@ -0,0 +1,184 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ResubscriptionScheduler.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+
+using namespace System::Clock;
+
+void ResubscriptionScheduler::Init(System::Layer * aSystemLayer)
+{
+    Shutdown();
+    mpSystemLayer = aSystemLayer;
+    mTokens       = kBurst;
+    mLastRefill   = SystemClock().GetMonotonicTimestamp();
+}
+
+void ResubscriptionScheduler::Shutdown()
+{
+    if (mTimerArmed)
+    {
+        mpSystemLayer->CancelTimer(OnTimerExpired, this);
+        mTimerArmed = false;
+    }
+
+    for (auto & waiting : mWaiting)
+    {
+        waiting.Clear();
+    }
+    mpSystemLayer = nullptr;
+}
+
+bool ResubscriptionScheduler::RequestResubscription(Entry & aEntry, ResubscriptionPriority aPriority)
+{
+    CancelResubscription(aEntry);
+
+    // Nothing to rate limit without a timer to let waiting resubscriptions through later.
+    VerifyOrReturnValue(mpSystemLayer != nullptr, true);
+    VerifyOrReturnValue(!aEntry.CanResubscribeOverActiveSession(), true);
+
+    RefillTokens();
+    if (mTokens > 0)
+    {
+        mTokens--;
+        return true;
+    }
+
+    auto priority = static_cast<size_t>(aPriority);
+    mWaiting[priority < kPriorityCount ? priority : kPriorityCount - 1].PushBack(&aEntry.mNode);
+    ChipLogProgress(DataManagement, "Resubscription to %02x:" ChipLogFormatX64 " is rate limited",
+                    aEntry.GetResubscriptionPeer().GetFabricIndex(), ChipLogValueX64(aEntry.GetResubscriptionPeer().GetNodeId()));
+
+    CHIP_ERROR err = ScheduleTimer();
+    if (err != CHIP_NO_ERROR)
+    {
+        // Better an unthrottled resubscription than none at all.
+        ChipLogError(DataManagement, "Failed to schedule the resubscription timer: %" CHIP_ERROR_FORMAT, err.Format());
+        CancelResubscription(aEntry);
+        return true;
+    }
+    return false;
+}
+
+size_t ResubscriptionScheduler::GetNumWaitingResubscriptions() const
+{
+    size_t count = 0;
+    for (const auto & waiting : mWaiting)
+    {
+        for (auto it = waiting.begin(); it != waiting.end(); ++it)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+void ResubscriptionScheduler::RefillTokens()
+{
+    const Timestamp now = SystemClock().GetMonotonicTimestamp();
+    if (mTokens >= kBurst)
+    {
+        mLastRefill = now;
+        return;
+    }
+
+    const uint64_t refills = (now - mLastRefill) / kInterval;
+    if (refills > 0)
+    {
+        mTokens = (refills >= kBurst - mTokens) ? kBurst : mTokens + static_cast<uint32_t>(refills);
+        mLastRefill += refills * kInterval;
+    }
+}
+
+void ResubscriptionScheduler::OnTimerExpired(System::Layer * aSystemLayer, void * aAppState)
+{
+    static_cast<ResubscriptionScheduler *>(aAppState)->AdmitWaitingResubscriptions();
+}
+
+void ResubscriptionScheduler::AdmitWaitingResubscriptions()
+{
+    mTimerArmed = false;
+    RefillTokens();
+
+    // Collect the admitted entries first: going ahead may cancel or queue other resubscriptions.
+    EntryList admitted;
+    for (size_t priority = kPriorityCount; priority-- > 0 && mTokens > 0;)
+    {
+        while (!mWaiting[priority].Empty() && mTokens > 0)
+        {
+            Entry & entry = (*mWaiting[priority].begin()).mEntry;
+            mTokens--;
+
+            const ScopedNodeId peer = entry.GetResubscriptionPeer();
+            for (auto & waiting : mWaiting)
+            {
+                for (auto it = waiting.begin(); it != waiting.end();)
+                {
+                    Entry::Node & node = *it;
+                    ++it;
+                    if (node.mEntry.GetResubscriptionPeer() == peer)
+                    {
+                        waiting.Remove(&node);
+                        admitted.PushBack(&node);
+                    }
+                }
+            }
+        }
+    }
+
+    while (!admitted.Empty())
+    {
+        Entry & entry = (*admitted.begin()).mEntry;
+        admitted.Remove(&entry.mNode);
+        entry.OnResubscriptionAdmitted();
+    }
+
+    CHIP_ERROR err = ScheduleTimer();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to schedule the resubscription timer: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+CHIP_ERROR ResubscriptionScheduler::ScheduleTimer()
+{
+    // The scheduler may have been shut down by an admitted resubscription.
+    VerifyOrReturnError(mpSystemLayer != nullptr && !mTimerArmed, CHIP_NO_ERROR);
+
+    bool anyWaiting = false;
+    for (const auto & waiting : mWaiting)
+    {
+        anyWaiting = anyWaiting || !waiting.Empty();
+    }
+    VerifyOrReturnError(anyWaiting, CHIP_NO_ERROR);
+
+    // Wake up when the next token comes back.
+    const Timestamp elapsed = SystemClock().GetMonotonicTimestamp() - mLastRefill;
+    const Timeout delay     = elapsed < kInterval ? std::chrono::duration_cast<Timeout>(kInterval - elapsed) : Timeout(0);
+    ReturnErrorOnFailure(mpSystemLayer->StartTimer(delay, OnTimerExpired, this));
+    mTimerArmed = true;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,127 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ReadPrepareParams.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/IntrusiveList.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * @class ResubscriptionScheduler
+ *
+ * @brief Rate limits the resubscriptions of all the subscriptions of a client.
+ *
+ * When the network of a controller blips, its subscriptions all drop at about the same time, and their resubscription timers
+ * fire in correlated waves, each resubscription setting up a CASE session after resolving its peer with DNS-SD.  Once the
+ * resubscription timer of a subscription fires, it asks the scheduler for the go-ahead instead:
+ *
+ *   - Resubscriptions over a session that is still active cost neither CASE nor DNS-SD, and go ahead right away.
+ *   - Other resubscriptions go ahead as long as one of CHIP_RESUBSCRIBE_SCHEDULER_BURST tokens is available.  A token is
+ *     given back every CHIP_RESUBSCRIBE_SCHEDULER_INTERVAL_MS.
+ *   - Otherwise, resubscriptions wait in a queue per ResubscriptionPriority, and go ahead in priority order, first come first
+ *     served within a priority, as tokens come back.
+ *   - Whenever a waiting resubscription goes ahead, the other ones waiting for the same peer go ahead with it for the same
+ *     token, since CASESessionManager sets up a single session for all of them.
+ */
+class ResubscriptionScheduler
+{
+public:
+    static constexpr uint32_t kBurst = CHIP_RESUBSCRIBE_SCHEDULER_BURST;
+    static constexpr System::Clock::Milliseconds32 kInterval{ CHIP_RESUBSCRIBE_SCHEDULER_INTERVAL_MS };
+
+    static_assert(kBurst > 0, "CHIP_RESUBSCRIBE_SCHEDULER_BURST must let resubscriptions through");
+
+    class Entry
+    {
+    public:
+        Entry() : mNode(*this) {}
+        virtual ~Entry() = default;
+
+        bool IsWaitingForResubscription() const { return mNode.IsInList(); }
+
+    protected:
+        virtual ScopedNodeId GetResubscriptionPeer() const = 0;
+        /// Whether the resubscription can go over a session that is already active.
+        virtual bool CanResubscribeOverActiveSession() const = 0;
+        /// Called once a resubscription that had to wait may go ahead.
+        virtual void OnResubscriptionAdmitted() = 0;
+
+    private:
+        friend class ResubscriptionScheduler;
+
+        struct Node : public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
+        {
+            explicit Node(Entry & entry) : mEntry(entry) {}
+            Entry & mEntry;
+        };
+
+        Node mNode;
+    };
+
+    ResubscriptionScheduler() = default;
+    ~ResubscriptionScheduler() { Shutdown(); }
+
+    ResubscriptionScheduler(const ResubscriptionScheduler &)             = delete;
+    ResubscriptionScheduler & operator=(const ResubscriptionScheduler &) = delete;
+
+    void Init(System::Layer * aSystemLayer);
+
+    /// Drop every waiting resubscription and cancel the timer.
+    void Shutdown();
+
+    /**
+     * Ask for the go-ahead of the resubscription of `aEntry`.
+     *
+     * @return true if the resubscription may go ahead right away.  Otherwise, it waits until OnResubscriptionAdmitted is
+     *         called on `aEntry`, or until it is cancelled.
+     */
+    bool RequestResubscription(Entry & aEntry, ResubscriptionPriority aPriority);
+    static void CancelResubscription(Entry & aEntry) { aEntry.mNode.Unlink(); }
+
+    size_t GetNumWaitingResubscriptions() const;
+
+private:
+    using EntryList = IntrusiveList<Entry::Node, IntrusiveMode::AutoUnlink>;
+
+    static constexpr size_t kPriorityCount = static_cast<size_t>(ResubscriptionPriority::kHigh) + 1;
+
+    static void OnTimerExpired(System::Layer * aSystemLayer, void * aAppState);
+
+    void RefillTokens();
+    void AdmitWaitingResubscriptions();
+    CHIP_ERROR ScheduleTimer();
+
+    System::Layer * mpSystemLayer = nullptr;
+    EntryList mWaiting[kPriorityCount];
+    uint32_t mTokens = kBurst;
+    System::Clock::Timestamp mLastRefill;
+    bool mTimerArmed = false;
+};
+
+} // namespace app
+} // namespace chip
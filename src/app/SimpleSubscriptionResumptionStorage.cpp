@@ -136,9 +136,69 @@ uint16_t SimpleSubscriptionResumptionStorage::Count()
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(uint16_t subscriptionIndex)
 {
-    return mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName());
+    // The retries counter is usually absent, so failing to delete it is expected
+    TEMPORARY_RETURN_IGNORED mStorage->AsyncDeleteKeyValue(
+        DefaultStorageKeyAllocator::SubscriptionResumptionRetries(subscriptionIndex).KeyName(), nullptr, nullptr);
+    return mStorage->AsyncDeleteKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName(),
+                                         PersistentStorageDelegate::LogAsyncFailure, nullptr);
 }
 
+CHIP_ERROR SimpleSubscriptionResumptionStorage::LoadEntry(uint16_t subscriptionIndex, MutableByteSpan & entry,
+                                                          SubscriptionIdentity & identity)
+{
+    VerifyOrReturnError(CanCastTo<uint16_t>(entry.size()), CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint16_t len = static_cast<uint16_t>(entry.size());
+    ReturnErrorOnFailure(mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName(),
+                                                   entry.data(), len));
+    entry.reduce_size(len);
+
+    TLV::TLVReader reader;
+    reader.Init(entry);
+
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+
+    TLV::TLVType subscriptionContainerType;
+    ReturnErrorOnFailure(reader.EnterContainer(subscriptionContainerType));
+
+    ReturnErrorOnFailure(reader.Next(kPeerNodeIdTag));
+    ReturnErrorOnFailure(reader.Get(identity.mNodeId));
+
+    ReturnErrorOnFailure(reader.Next(kFabricIndexTag));
+    ReturnErrorOnFailure(reader.Get(identity.mFabricIndex));
+
+    ReturnErrorOnFailure(reader.Next(kSubscriptionIdTag));
+    ReturnErrorOnFailure(reader.Get(identity.mSubscriptionId));
+
+    return CHIP_NO_ERROR;
+}
+
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+CHIP_ERROR SimpleSubscriptionResumptionStorage::SaveResumptionRetries(uint16_t subscriptionIndex, uint32_t resumptionRetries)
+{
+    const auto key = DefaultStorageKeyAllocator::SubscriptionResumptionRetries(subscriptionIndex);
+
+    uint32_t storedRetries = 0;
+    uint16_t len           = sizeof(storedRetries);
+    CHIP_ERROR err         = mStorage->SyncGetKeyValue(key.KeyName(), &storedRetries, len);
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        VerifyOrReturnError(resumptionRetries != 0, CHIP_NO_ERROR);
+    }
+    else if ((err == CHIP_NO_ERROR) && (len == sizeof(storedRetries)) && (storedRetries == resumptionRetries))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    if (resumptionRetries == 0)
+    {
+        return mStorage->AsyncDeleteKeyValue(key.KeyName(), PersistentStorageDelegate::LogAsyncFailure, nullptr);
+    }
+    return mStorage->AsyncSetKeyValue(key.KeyName(), &resumptionRetries, sizeof(resumptionRetries),
+                                      PersistentStorageDelegate::LogAsyncFailure, nullptr);
+}
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo)
 {
     Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
@@ -267,6 +327,18 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Load(uint16_t subscriptionIndex,
 
     ReturnErrorOnFailure(reader.ExitContainer(subscriptionContainerType));
 
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    // The separately stored counter, if any, supersedes one in an entry written by an older version
+    uint32_t resumptionRetries;
+    uint16_t retriesLen = sizeof(resumptionRetries);
+    if ((mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionRetries(subscriptionIndex).KeyName(),
+                                   &resumptionRetries, retriesLen) == CHIP_NO_ERROR) &&
+        (retriesLen == sizeof(resumptionRetries)))
+    {
+        subscriptionInfo.mResumptionRetries = resumptionRetries;
+    }
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+
     return CHIP_NO_ERROR;
 }
 
@@ -320,9 +392,6 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(TLV::TLVWriter & writer, Su
         ReturnErrorOnFailure(writer.EndContainer(eventContainerType));
     }
     ReturnErrorOnFailure(writer.EndContainer(eventsListType));
-#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
-    ReturnErrorOnFailure(writer.Put(kResumptionRetriesTag, subscriptionInfo.mResumptionRetries));
-#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 
     ReturnErrorOnFailure(writer.EndContainer(subscriptionContainerType));
 
@@ -331,60 +400,82 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(TLV::TLVWriter & writer, Su
 
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscriptionInfo)
 {
-    // Find empty index or duplicate if exists
-    uint16_t subscriptionIndex;
-    uint16_t firstEmptySubscriptionIndex = CHIP_IM_MAX_NUM_SUBSCRIPTIONS; // initialize to out of bounds as "not set"
-    for (subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
+    // Construct the subscription state first, so that an unchanged entry need not be written again
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Calloc(MaxSubscriptionSize());
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), MaxSubscriptionSize());
+
+    ReturnErrorOnFailure(Save(writer, subscriptionInfo));
+
+    const auto len = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    TEMPORARY_RETURN_IGNORED writer.Finalize(backingBuffer);
+
+    Platform::ScopedMemoryBuffer<uint8_t> entryBuffer;
+    entryBuffer.Calloc(MaxSubscriptionSize());
+    VerifyOrReturnError(entryBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    // Find the existing entry of the subscription, or else the first empty index
+    uint16_t subscriptionIndex           = CHIP_IM_MAX_NUM_SUBSCRIPTIONS; // initialize to out of bounds as "not set"
+    uint16_t firstEmptySubscriptionIndex = CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
+    bool entryUnchanged                  = false;
+    for (uint16_t index = 0; index < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; index++)
     {
-        SubscriptionInfo currentSubscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, currentSubscriptionInfo);
+        MutableByteSpan entry(entryBuffer.Get(), MaxSubscriptionSize());
+        SubscriptionIdentity identity;
+        CHIP_ERROR err = LoadEntry(index, entry, identity);
 
         // if empty and firstEmptySubscriptionIndex isn't set yet, then mark empty spot
         if ((firstEmptySubscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS) && (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND))
         {
-            firstEmptySubscriptionIndex = subscriptionIndex;
+            firstEmptySubscriptionIndex = index;
         }
 
-        // delete duplicate
-        if (err == CHIP_NO_ERROR)
+        if ((err != CHIP_NO_ERROR) || (subscriptionInfo.mNodeId != identity.mNodeId) ||
+            (subscriptionInfo.mFabricIndex != identity.mFabricIndex) ||
+            (subscriptionInfo.mSubscriptionId != identity.mSubscriptionId))
         {
-            if ((subscriptionInfo.mNodeId == currentSubscriptionInfo.mNodeId) &&
-                (subscriptionInfo.mFabricIndex == currentSubscriptionInfo.mFabricIndex) &&
-                (subscriptionInfo.mSubscriptionId == currentSubscriptionInfo.mSubscriptionId))
-            {
-                TEMPORARY_RETURN_IGNORED Delete(subscriptionIndex);
-                // if duplicate is the first empty spot, then also set it
-                if (firstEmptySubscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
-                {
-                    firstEmptySubscriptionIndex = subscriptionIndex;
-                }
-            }
+            continue;
+        }
+
+        if (subscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
+        {
+            subscriptionIndex = index;
+            entryUnchanged    = entry.data_equal(ByteSpan(backingBuffer.Get(), len));
+        }
+        else
+        {
+            // delete duplicate
+            TEMPORARY_RETURN_IGNORED Delete(index);
         }
     }
 
+    if (subscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
+    {
+        subscriptionIndex = firstEmptySubscriptionIndex;
+    }
+
     // Fail if no empty space
-    if (firstEmptySubscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
+    if (subscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
     {
         return CHIP_ERROR_NO_MEMORY;
     }
 
-    // Now construct subscription state and save
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
-    backingBuffer.Calloc(MaxSubscriptionSize());
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), MaxSubscriptionSize());
-
-    ReturnErrorOnFailure(Save(writer, subscriptionInfo));
-
-    const auto len = writer.GetLengthWritten();
-    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
-
-    TEMPORARY_RETURN_IGNORED writer.Finalize(backingBuffer);
+    if (!entryUnchanged)
+    {
+        // Subscriptions are saved as they are established, so slow storage must not hold the event loop up.
+        ReturnErrorOnFailure(
+            mStorage->AsyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName(),
+                                       backingBuffer.Get(), static_cast<uint16_t>(len), PersistentStorageDelegate::LogAsyncFailure,
+                                       nullptr));
+    }
 
-    ReturnErrorOnFailure(
-        mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(firstEmptySubscriptionIndex).KeyName(),
-                                  backingBuffer.Get(), static_cast<uint16_t>(len)));
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    ReturnErrorOnFailure(SaveResumptionRetries(subscriptionIndex, subscriptionInfo.mResumptionRetries));
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 
     return CHIP_NO_ERROR;
 }
@@ -394,17 +485,22 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(NodeId nodeId, FabricInde
     bool subscriptionFound   = false;
     CHIP_ERROR lastDeleteErr = CHIP_NO_ERROR;
 
+    Platform::ScopedMemoryBuffer<uint8_t> entryBuffer;
+    entryBuffer.Calloc(MaxSubscriptionSize());
+    VerifyOrReturnError(entryBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
     uint16_t remainingSubscriptionsCount = 0;
     for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
     {
-        SubscriptionInfo subscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, subscriptionInfo);
+        MutableByteSpan entry(entryBuffer.Get(), MaxSubscriptionSize());
+        SubscriptionIdentity identity;
+        CHIP_ERROR err = LoadEntry(subscriptionIndex, entry, identity);
 
         // delete match
         if (err == CHIP_NO_ERROR)
         {
-            if ((nodeId == subscriptionInfo.mNodeId) && (fabricIndex == subscriptionInfo.mFabricIndex) &&
-                (subscriptionId == subscriptionInfo.mSubscriptionId))
+            if ((nodeId == identity.mNodeId) && (fabricIndex == identity.mFabricIndex) &&
+                (subscriptionId == identity.mSubscriptionId))
             {
                 subscriptionFound    = true;
                 CHIP_ERROR deleteErr = Delete(subscriptionIndex);
@@ -443,15 +539,20 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteAll(FabricIndex fabricInde
 {
     CHIP_ERROR deleteErr = CHIP_NO_ERROR;
 
+    Platform::ScopedMemoryBuffer<uint8_t> entryBuffer;
+    entryBuffer.Calloc(MaxSubscriptionSize());
+    VerifyOrReturnError(entryBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
     uint16_t count = 0;
     for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
     {
-        SubscriptionInfo subscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, subscriptionInfo);
+        MutableByteSpan entry(entryBuffer.Get(), MaxSubscriptionSize());
+        SubscriptionIdentity identity;
+        CHIP_ERROR err = LoadEntry(subscriptionIndex, entry, identity);
 
         if (err == CHIP_NO_ERROR)
         {
-            if (fabricIndex == subscriptionInfo.mFabricIndex)
+            if (fabricIndex == identity.mFabricIndex)
             {
                 err = Delete(subscriptionIndex);
                 if ((err != CHIP_NO_ERROR) && (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND))
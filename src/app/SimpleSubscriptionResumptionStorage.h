@@ -54,6 +54,24 @@ protected:
     CHIP_ERROR Save(TLV::TLVWriter & writer, SubscriptionInfo & subscriptionInfo);
     CHIP_ERROR Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo);
     CHIP_ERROR Delete(uint16_t subscriptionIndex);
+
+    // The fields that identify a subscription, which come first in its entry.
+    struct SubscriptionIdentity
+    {
+        NodeId mNodeId;
+        FabricIndex mFabricIndex;
+        SubscriptionId mSubscriptionId;
+    };
+
+    // Read the raw entry at subscriptionIndex into entry, shrinking it to the length of the entry, and decode only its
+    // identity, which is much cheaper than a full Load when scanning for a subscription.
+    CHIP_ERROR LoadEntry(uint16_t subscriptionIndex, MutableByteSpan & entry, SubscriptionIdentity & identity);
+
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    // The resumption retries counter changes on every resumption attempt, so it is kept under its own small key rather
+    // than in the subscription entry, and only written when it changes.  A count of 0 is stored as no key at all.
+    CHIP_ERROR SaveResumptionRetries(uint16_t subscriptionIndex, uint32_t resumptionRetries);
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     uint16_t Count();
     CHIP_ERROR DeleteMaxCount();
 
@@ -116,6 +134,10 @@ protected:
     //         Endpoint ID
     //         Cluster ID
     //         Event ID
+    //
+    // The resumption retries counter of each subscription is stored separately, as a uint32_t under
+    // SubscriptionResumptionRetries(index).  Entries written by older versions may still hold it as a trailing
+    // Resumption retries field, which is only used if there is no separate counter.
 
     static constexpr TLV::Tag kPeerNodeIdTag         = TLV::ContextTag(1);
     static constexpr TLV::Tag kFabricIndexTag        = TLV::ContextTag(2);
@@ -0,0 +1,155 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/SubscriptionLivenessWheel.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+
+using namespace System::Clock;
+
+void SubscriptionLivenessWheel::Init(System::Layer * aSystemLayer)
+{
+    Shutdown();
+    mpSystemLayer = aSystemLayer;
+}
+
+void SubscriptionLivenessWheel::Shutdown()
+{
+    if (mTimerArmed)
+    {
+        mpSystemLayer->CancelTimer(OnTimerExpired, this);
+        mTimerArmed = false;
+    }
+
+    for (auto & slot : mSlots)
+    {
+        slot.mEntries.Clear();
+        slot.mEarliestDeadline = Timestamp::max();
+    }
+    mpSystemLayer = nullptr;
+}
+
+CHIP_ERROR SubscriptionLivenessWheel::Arm(Entry & aEntry, Timeout aTimeout)
+{
+    VerifyOrReturnError(mpSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    const Timestamp deadline     = SystemClock().GetMonotonicTimestamp() + aTimeout;
+    const uint64_t deadlineTicks = (deadline.count() + kTick.count() - 1) / kTick.count();
+    Slot & slot                  = mSlots[deadlineTicks % kSlotCount];
+
+    aEntry.Unlink();
+    aEntry.mLivenessDeadline = Timestamp(deadlineTicks * kTick.count());
+    slot.mEntries.PushBack(&aEntry);
+    if (aEntry.mLivenessDeadline < slot.mEarliestDeadline)
+    {
+        slot.mEarliestDeadline = aEntry.mLivenessDeadline;
+    }
+
+    // Pushing a deadline back, which is what every report does, leaves the timer alone.
+    VerifyOrReturnError(!mTimerArmed || aEntry.mLivenessDeadline < mTimerDeadline, CHIP_NO_ERROR);
+    return ScheduleTimer();
+}
+
+void SubscriptionLivenessWheel::OnTimerExpired(System::Layer * aSystemLayer, void * aAppState)
+{
+    static_cast<SubscriptionLivenessWheel *>(aAppState)->ExpireEntries();
+}
+
+void SubscriptionLivenessWheel::ExpireEntries()
+{
+    mTimerArmed = false;
+
+    // Collect every expired entry first: the callbacks may arm and disarm any entry, including the other expired ones.
+    const Timestamp now = SystemClock().GetMonotonicTimestamp();
+    EntryList expired;
+    for (auto & slot : mSlots)
+    {
+        if (slot.mEarliestDeadline > now)
+        {
+            continue;
+        }
+
+        slot.mEarliestDeadline = Timestamp::max();
+        for (auto it = slot.mEntries.begin(); it != slot.mEntries.end();)
+        {
+            Entry & entry = *it;
+            ++it;
+            if (entry.mLivenessDeadline <= now)
+            {
+                slot.mEntries.Remove(&entry);
+                expired.PushBack(&entry);
+            }
+            else if (entry.mLivenessDeadline < slot.mEarliestDeadline)
+            {
+                slot.mEarliestDeadline = entry.mLivenessDeadline;
+            }
+        }
+    }
+
+    while (!expired.Empty())
+    {
+        Entry & entry = *expired.begin();
+        expired.Remove(&entry);
+        entry.OnLivenessTimeout();
+    }
+
+    CHIP_ERROR err = ScheduleTimer();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to schedule the subscription liveness timer: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+CHIP_ERROR SubscriptionLivenessWheel::ScheduleTimer()
+{
+    // The wheel may have been shut down by an expired entry.
+    VerifyOrReturnError(mpSystemLayer != nullptr, CHIP_NO_ERROR);
+
+    Timestamp earliestDeadline = Timestamp::max();
+    for (const auto & slot : mSlots)
+    {
+        if (slot.mEarliestDeadline < earliestDeadline)
+        {
+            earliestDeadline = slot.mEarliestDeadline;
+        }
+    }
+
+    if (earliestDeadline == Timestamp::max())
+    {
+        if (mTimerArmed)
+        {
+            mpSystemLayer->CancelTimer(OnTimerExpired, this);
+            mTimerArmed = false;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    const Timestamp now = SystemClock().GetMonotonicTimestamp();
+    const Timeout delay = earliestDeadline > now ? std::chrono::duration_cast<Timeout>(earliestDeadline - now) : kZero;
+    ReturnErrorOnFailure(mpSystemLayer->StartTimer(delay, OnTimerExpired, this));
+    mTimerArmed    = true;
+    mTimerDeadline = earliestDeadline;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,111 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/IntrusiveList.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * @class SubscriptionLivenessWheel
+ *
+ * @brief Shared liveness timer for the subscriptions of a client, as a hashed timing wheel.
+ *
+ * Every subscription pushes its liveness deadline back on each report it receives.  With one system timer per subscription,
+ * a controller with thousands of subscriptions keeps cancelling and restarting timers.  Instead, entries are hashed by their
+ * deadline, rounded up to a multiple of kTick, into one of kSlotCount intrusive lists, and a single system timer is armed for
+ * the earliest slot.  Arming or disarming an entry is O(1), and pushing a deadline back does not touch the system timer.
+ *
+ * When the timer fires, every entry whose deadline has passed expires in the same tick.  Deadlines are rounded up to kTick,
+ * so an entry expires at most kTick after its deadline, never before.
+ *
+ * Each slot keeps a lower bound of the deadlines it holds, which is only recomputed when the slot is visited, so disarming an
+ * entry costs at most one spurious visit of its slot.  The timer is armed for the lowest bound, so entries with deadlines
+ * further than a revolution of the wheel do not cause periodic wakeups.
+ */
+class SubscriptionLivenessWheel
+{
+public:
+    /// Granularity of the deadlines: entries expiring within the same tick expire together.
+    static constexpr System::Clock::Milliseconds32 kTick{ 50 };
+    static constexpr size_t kSlotCount = 64;
+
+    class Entry : public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
+    {
+    public:
+        virtual ~Entry() = default;
+
+        bool IsLivenessCheckArmed() const { return IsInList(); }
+
+    protected:
+        /// Called once the deadline of the entry has passed.  The entry is disarmed by then and may be armed again.
+        virtual void OnLivenessTimeout() = 0;
+
+    private:
+        friend class SubscriptionLivenessWheel;
+
+        // Deadline rounded up to kTick.
+        System::Clock::Timestamp mLivenessDeadline = System::Clock::kZero;
+    };
+
+    SubscriptionLivenessWheel() = default;
+    ~SubscriptionLivenessWheel() { Shutdown(); }
+
+    SubscriptionLivenessWheel(const SubscriptionLivenessWheel &)             = delete;
+    SubscriptionLivenessWheel & operator=(const SubscriptionLivenessWheel &) = delete;
+
+    void Init(System::Layer * aSystemLayer);
+
+    /// Disarm every entry and cancel the timer.
+    void Shutdown();
+
+    /// (Re)arm `aEntry` to expire `aTimeout` from now.
+    CHIP_ERROR Arm(Entry & aEntry, System::Clock::Timeout aTimeout);
+    static void Disarm(Entry & aEntry) { aEntry.Unlink(); }
+
+private:
+    using EntryList = IntrusiveList<Entry, IntrusiveMode::AutoUnlink>;
+
+    struct Slot
+    {
+        EntryList mEntries;
+        // Lower bound of the deadlines of mEntries, Timestamp::max() if it is known to be empty.
+        System::Clock::Timestamp mEarliestDeadline = System::Clock::Timestamp::max();
+    };
+
+    static void OnTimerExpired(System::Layer * aSystemLayer, void * aAppState);
+
+    void ExpireEntries();
+    CHIP_ERROR ScheduleTimer();
+
+    System::Layer * mpSystemLayer = nullptr;
+    Slot mSlots[kSlotCount];
+    bool mTimerArmed                        = false;
+    System::Clock::Timestamp mTimerDeadline = System::Clock::kZero;
+};
+
+} // namespace app
+} // namespace chip
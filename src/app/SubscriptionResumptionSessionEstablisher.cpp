@@ -26,7 +26,12 @@ class AutoDeleteEstablisher
 public:
     AutoDeleteEstablisher(SubscriptionResumptionSessionEstablisher * sessionEstablisher) : mSessionEstablisher(sessionEstablisher)
     {}
-    ~AutoDeleteEstablisher() { chip::Platform::Delete(mSessionEstablisher); }
+    ~AutoDeleteEstablisher()
+    {
+        chip::Platform::Delete(mSessionEstablisher);
+        // Our attempt is done, so another subscription can be resumed
+        InteractionModelEngine::GetInstance()->ResumeNextSubscriptions();
+    }
 
     SubscriptionResumptionSessionEstablisher * operator->() const { return mSessionEstablisher; }
 
@@ -20,6 +20,7 @@
 #include <app/AttributePathParams.h>
 #include <app/CASESessionManager.h>
 #include <app/SubscriptionResumptionStorage.h>
+#include <lib/support/IntrusiveList.h>
 
 namespace chip {
 namespace app {
@@ -31,7 +32,7 @@ namespace app {
  *  receives a new subscription request, it will crash as there is no evictable ReadHandler.
  */
 
-class SubscriptionResumptionSessionEstablisher
+class SubscriptionResumptionSessionEstablisher : public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
 {
 public:
     SubscriptionResumptionSessionEstablisher();
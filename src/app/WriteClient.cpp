@@ -33,6 +33,7 @@ namespace app {
 
 void WriteClient::Close()
 {
+    mWriteMetric.End(CHIP_NO_ERROR);
     MoveToState(State::AwaitingDestruction);
 
     if (mpCallback)
@@ -174,13 +175,14 @@ CHIP_ERROR WriteClient::StartNewMessage()
     // Per Matter specification: a Write Request that is part of a Timed Write Interaction SHALL NOT be chunked.
     VerifyOrReturnError(!(mTimedWriteTimeoutMs.HasValue() && !mChunks.IsNull()), CHIP_ERROR_NO_MEMORY);
 
-    System::PacketBufferHandle packet = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+    const size_t maxChunkSize         = mAllowLargePayload ? kMaxLargeSecureSduLengthBytes : kMaxSecureSduLengthBytes;
+    System::PacketBufferHandle packet = System::PacketBufferHandle::New(maxChunkSize);
     VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
 
-    // Always limit the size of the packet to fit within kMaxSecureSduLengthBytes regardless of the available buffer capacity.
-    if (packet->AvailableDataLength() > kMaxSecureSduLengthBytes)
+    // Always limit the size of the packet to fit within maxChunkSize regardless of the available buffer capacity.
+    if (packet->AvailableDataLength() > maxChunkSize)
     {
-        reservedSize = static_cast<uint16_t>(packet->AvailableDataLength() - kMaxSecureSduLengthBytes);
+        reservedSize = static_cast<uint16_t>(packet->AvailableDataLength() - maxChunkSize);
     }
 
     // ... and we need to reserve some extra space for the MIC field.
@@ -456,6 +458,8 @@ CHIP_ERROR WriteClient::SendWriteRequest(const SessionHandle & session, System::
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     VerifyOrExit(mState == State::AddAttribute, err = CHIP_ERROR_INCORRECT_STATE);
+    // Chunks sized for large payloads can only be sent over a session that supports them.
+    VerifyOrExit(!mAllowLargePayload || session->AllowsLargePayload(), err = CHIP_ERROR_INCORRECT_STATE);
 
     err = FinalizeMessage(false /* hasMoreChunks */);
     SuccessOrExit(err);
@@ -470,6 +474,12 @@ CHIP_ERROR WriteClient::SendWriteRequest(const SessionHandle & session, System::
 
     VerifyOrReturnError(!(mExchangeCtx->IsGroupExchangeContext() && mHasDataVersion), CHIP_ERROR_INVALID_MESSAGE_TYPE);
 
+    // Group writes get no response, so there is no latency to measure.
+    if (!mExchangeCtx->IsGroupExchangeContext())
+    {
+        mWriteMetric.Begin();
+    }
+
     if (timeout == System::Clock::kZero)
     {
         mExchangeCtx->UseSuggestedResponseTimeout(app::kExpectedIMProcessingTime);
@@ -494,6 +504,7 @@ CHIP_ERROR WriteClient::SendWriteRequest(const SessionHandle & session, System::
 exit:
     if (err != CHIP_NO_ERROR)
     {
+        mWriteMetric.End(err);
         ChipLogError(DataManagement, "Write client failed to SendWriteRequest: %" CHIP_ERROR_FORMAT, err.Format());
     }
     else
@@ -605,6 +616,11 @@ CHIP_ERROR WriteClient::OnMessageReceived(Messaging::ExchangeContext * apExchang
     }
 
 exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        mWriteMetric.End(err);
+    }
+
     if (mpCallback != nullptr)
     {
         if (err != CHIP_NO_ERROR)
@@ -632,6 +648,7 @@ void WriteClient::OnResponseTimeout(Messaging::ExchangeContext * apExchangeConte
     ChipLogError(DataManagement, "Time out! failed to receive write response from Exchange: " ChipLogFormatExchange,
                  ChipLogValueExchange(apExchangeContext));
 
+    mWriteMetric.End(CHIP_ERROR_TIMEOUT);
     if (mpCallback != nullptr)
     {
         mpCallback->OnError(this, CHIP_ERROR_TIMEOUT);
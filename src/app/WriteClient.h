@@ -42,6 +42,7 @@
 #include <protocols/Protocols.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
+#include <tracing/metric_event.h>
 
 namespace chip {
 namespace app {
@@ -124,12 +125,16 @@ public:
      *  @param[in]    apCallback       Callback set by application.
      *  @param[in]    aTimedWriteTimeoutMs If provided, do a timed write using this timeout.
      *  @param[in]    aSuppressResponse If provided, set SuppressResponse field to the provided value
+     *  @param[in]    aAllowLargePayload If true, each chunk of the write request is filled up to the size of a large payload
+     *                                   message instead of an IPv6 MTU, so that large writes need fewer round trips.  The
+     *                                   request can then only be sent over a session that allows large payloads (e.g. TCP).
      */
     WriteClient(Messaging::ExchangeManager * apExchangeMgr, Callback * apCallback, const Optional<uint16_t> & aTimedWriteTimeoutMs,
-                bool aSuppressResponse = false) :
+                bool aSuppressResponse = false, bool aAllowLargePayload = false) :
         mpExchangeMgr(apExchangeMgr),
         mExchangeCtx(*this), mpCallback(apCallback), mTimedWriteTimeoutMs(aTimedWriteTimeoutMs),
-        mSuppressResponse(aSuppressResponse), mTimedRequestFieldValue(aTimedWriteTimeoutMs.HasValue())
+        mSuppressResponse(aSuppressResponse), mAllowLargePayload(aAllowLargePayload),
+        mTimedRequestFieldValue(aTimedWriteTimeoutMs.HasValue())
     {
         assertChipStackLockedByCurrentThread();
     }
@@ -559,7 +564,10 @@ private:
     // If mTimedWriteTimeoutMs has a value, we are expected to do a timed
     // write.
     Optional<uint16_t> mTimedWriteTimeoutMs;
-    bool mSuppressResponse = false;
+    bool mSuppressResponse  = false;
+    bool mAllowLargePayload = false;
+
+    Tracing::PendingMetricEvent mWriteMetric{ Tracing::kMetricIMWrite };
 
     // A list of buffers, one buffer for each chunk.
     System::PacketBufferHandle mChunks;
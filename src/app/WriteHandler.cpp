@@ -101,6 +101,7 @@ void WriteHandler::Close()
     // wasSuccessful here is safe: if it does anything, we were in fact not
     // successful.
     DeliverFinalListWriteEnd(false /* wasSuccessful */);
+    EndClusterWrites();
     mExchangeCtx.Release();
     mStateFlags.Clear(StateBits::kSuppressResponse);
     mDataModelProvider = nullptr;
@@ -128,10 +129,19 @@ std::optional<bool> WriteHandler::IsListAttributePath(const ConcreteAttributePat
     return info->HasFlags(DataModel::AttributeQualityFlags::kListAttribute);
 }
 
+size_t WriteHandler::GetWriteResponseBufferMaxSize(const Messaging::ExchangeContext * apExchangeContext)
+{
+    if (apExchangeContext->HasSessionHandle() && apExchangeContext->GetSessionHandle()->AllowsLargePayload())
+    {
+        return kMaxLargeSecureSduLengthBytes;
+    }
+    return kMaxSecureSduLengthBytes;
+}
+
 Status WriteHandler::HandleWriteRequestMessage(Messaging::ExchangeContext * apExchangeContext,
                                                System::PacketBufferHandle && aPayload, bool aIsTimedWrite)
 {
-    System::PacketBufferHandle packet = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    System::PacketBufferHandle packet = System::PacketBufferHandle::New(GetWriteResponseBufferMaxSize(apExchangeContext));
     VerifyOrReturnError(!packet.IsNull(), Status::Failure);
 
     System::PacketBufferTLVWriter messageWriter;
@@ -300,16 +310,11 @@ CHIP_ERROR WriteHandler::DeliverFinalListWriteEndForGroupWrite(bool writeWasSucc
     auto processingConcreteAttributePath = mProcessingAttributePath.Value();
     mProcessingAttributePath.ClearValue();
 
-    iterator = groupDataProvider->IterateEndpoints(fabricIndex);
+    iterator = groupDataProvider->IterateEndpoints(fabricIndex, std::make_optional(groupId));
     VerifyOrReturnError(iterator != nullptr, CHIP_ERROR_NO_MEMORY);
 
     while (iterator->Next(mapping))
     {
-        if (groupId != mapping.group_id)
-        {
-            continue;
-        }
-
         processingConcreteAttributePath.mEndpointId = mapping.endpoint_id;
 
         VerifyOrReturnError(mDelegate, CHIP_ERROR_INCORRECT_STATE);
@@ -442,6 +447,7 @@ CHIP_ERROR WriteHandler::ProcessAttributeDataIBs(TLV::TLVReader & aAttributeData
     }
 
 exit:
+    EndClusterWrites();
     return err;
 }
 
@@ -485,7 +491,8 @@ CHIP_ERROR WriteHandler::ProcessGroupAttributeDataIBs(TLV::TLVReader & aAttribut
                       "Received group attribute write for Group=%u Cluster=" ChipLogFormatMEI " attribute=" ChipLogFormatMEI,
                       groupId, ChipLogValueMEI(dataAttributePath.mClusterId), ChipLogValueMEI(dataAttributePath.mAttributeId));
 
-        AutoReleaseGroupEndpointIterator iterator(Credentials::GetGroupDataProvider()->IterateEndpoints(fabric));
+        AutoReleaseGroupEndpointIterator iterator(
+            Credentials::GetGroupDataProvider()->IterateEndpoints(fabric, std::make_optional(groupId)));
         VerifyOrExit(!iterator.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
         bool shouldReportListWriteEnd = ShouldReportListWriteEnd(
@@ -497,11 +504,6 @@ CHIP_ERROR WriteHandler::ProcessGroupAttributeDataIBs(TLV::TLVReader & aAttribut
         Credentials::GroupDataProvider::GroupEndpoint mapping;
         while (iterator.Next(mapping))
         {
-            if (groupId != mapping.group_id)
-            {
-                continue;
-            }
-
             dataAttributePath.mEndpointId = mapping.endpoint_id;
 
             // Try to get the metadata from for the attribute from one of the expanded endpoints (it doesn't really matter which
@@ -591,6 +593,7 @@ exit:
     // mProcessingAttributePath making the following call no-op. So we call it again after the exit label to deliver a failure state
     // to the clusters. Ignore the error code since we need to deliver other more important failures.
     TEMPORARY_RETURN_IGNORED DeliverFinalListWriteEndForGroupWrite(false);
+    EndClusterWrites();
     return err;
 }
 
@@ -878,6 +881,24 @@ Status WriteHandler::CheckWriteAccess(const Access::SubjectDescriptor & aSubject
     return Status::Success;
 }
 
+void WriteHandler::BeginClusterWrites(const ConcreteClusterPath & aPath)
+{
+    VerifyOrReturn(mWritingClusterPath != aPath);
+    EndClusterWrites();
+    mDataModelProvider->BeginClusterWrites(aPath);
+    mWritingClusterPath = aPath;
+}
+
+void WriteHandler::EndClusterWrites()
+{
+    VerifyOrReturn(mWritingClusterPath.has_value());
+    if (mDataModelProvider != nullptr)
+    {
+        mDataModelProvider->EndClusterWrites(*mWritingClusterPath);
+    }
+    mWritingClusterPath.reset();
+}
+
 CHIP_ERROR WriteHandler::WriteClusterData(const Access::SubjectDescriptor & aSubject, const ConcreteDataAttributePath & aPath,
                                           TLV::TLVReader & aData)
 {
@@ -897,6 +918,7 @@ CHIP_ERROR WriteHandler::WriteClusterData(const Access::SubjectDescriptor & aSub
         request.subjectDescriptor = &aSubject;
         request.writeFlags.Set(DataModel::WriteFlags::kTimed, IsTimedWrite());
 
+        BeginClusterWrites(aPath);
         AttributeValueDecoder decoder(aData, aSubject);
         status = mDataModelProvider->WriteAttribute(request, decoder);
     }
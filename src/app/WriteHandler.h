@@ -157,6 +157,10 @@ private:
     Status HandleWriteRequestMessage(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload,
                                      bool aIsTimedWrite);
 
+    // Write responses carry a status for every attribute of the request, so they get a large buffer on sessions that allow
+    // large payloads, like the requests such sessions can carry.
+    static size_t GetWriteResponseBufferMaxSize(const Messaging::ExchangeContext * apExchangeContext);
+
     CHIP_ERROR FinalizeMessage(System::PacketBufferTLVWriter && aMessageWriter, System::PacketBufferHandle & packet);
     CHIP_ERROR SendWriteResponse(System::PacketBufferTLVWriter && aMessageWriter);
 
@@ -200,6 +204,11 @@ private:
     Status CheckWriteAccess(const Access::SubjectDescriptor & aSubject, const ConcreteAttributePath & aPath,
                             const Access::Privilege aRequiredPrivilege);
 
+    /// Lets the provider batch the writes to the cluster of aPath, ending the batch of the previously written cluster first.
+    void BeginClusterWrites(const ConcreteClusterPath & aPath);
+    /// Ends the open batch of cluster writes, if any.
+    void EndClusterWrites();
+
     // Write the given data to the given path
     CHIP_ERROR WriteClusterData(const Access::SubjectDescriptor & aSubject, const ConcreteDataAttributePath & aPath,
                                 TLV::TLVReader & aData);
@@ -217,6 +226,7 @@ private:
 
     DataModel::Provider * mDataModelProvider = nullptr;
     std::optional<ConcreteAttributePath> mLastSuccessfullyWrittenPath;
+    std::optional<ConcreteClusterPath> mWritingClusterPath;
 
     // This may be a "fake" pointer or a real delegate pointer, depending
     // on CHIP_CONFIG_STATIC_GLOBAL_INTERACTION_MODEL_ENGINE setting.
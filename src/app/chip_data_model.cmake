@@ -100,6 +100,7 @@ function(chip_configure_data_model APP_TARGET)
     target_sources(${APP_TARGET} ${SCOPE}
         ${CHIP_APP_BASE_DIR}/SafeAttributePersistenceProvider.cpp
         ${CHIP_APP_BASE_DIR}/StorageDelegateWrapper.cpp
+        ${CHIP_APP_BASE_DIR}/cluster-building-blocks/TransitionTicker.cpp
         ${CHIP_APP_BASE_DIR}/server/AclStorage.cpp
         ${CHIP_APP_BASE_DIR}/server/CommissioningWindowManager.cpp
         ${CHIP_APP_BASE_DIR}/server/DefaultAclStorage.cpp
@@ -166,6 +167,7 @@ function(chip_configure_data_model APP_TARGET)
         ${CHIP_APP_BASE_DIR}/util/DataModelHandler.cpp
         ${CHIP_APP_BASE_DIR}/util/ember-io-storage.cpp
         ${CHIP_APP_BASE_DIR}/util/generic-callback-stubs.cpp
+        ${CHIP_APP_BASE_DIR}/util/pending-attribute-updates.cpp
         ${CHIP_APP_BASE_DIR}/util/privilege-storage.cpp
         ${CHIP_APP_BASE_DIR}/util/util.cpp
         ${CHIP_APP_BASE_DIR}/persistence/AttributePersistenceProviderInstance.cpp
@@ -0,0 +1,196 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/cluster-building-blocks/TransitionTicker.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+
+using namespace System::Clock;
+
+TransitionTicker & TransitionTicker::Instance()
+{
+    static TransitionTicker sInstance;
+    return sInstance;
+}
+
+CHIP_ERROR TransitionTicker::Schedule(System::Layer & layer, Milliseconds32 delay, System::TimerCompleteCallback callback,
+                                      void * context)
+{
+    Milliseconds64 deadline = Now() + delay;
+    if (delay.count() > 0)
+    {
+        deadline = Milliseconds64(((deadline.count() + mTickPeriod.count() - 1) / mTickPeriod.count()) * mTickPeriod.count());
+    }
+
+    if (mUsedOwnTimers)
+    {
+        layer.CancelTimer(callback, context);
+    }
+
+    Entry * entry = Find(callback, context);
+    if (entry == nullptr)
+    {
+        if (mCount == kMaxEntries)
+        {
+            mUsedOwnTimers = true;
+            return layer.StartTimer(delay, callback, context);
+        }
+        entry           = &mEntries[mCount++];
+        entry->callback = callback;
+        entry->context  = context;
+    }
+    entry->deadline = deadline;
+    entry->due      = false;
+
+    mLayer = &layer;
+    Rearm();
+    return CHIP_NO_ERROR;
+}
+
+TransitionTicker::Batch::Batch(TransitionTicker & ticker) : mTicker(ticker)
+{
+    if (mTicker.mBatchDepth++ == 0)
+    {
+        mTicker.mBatchStart = System::SystemClock().GetMonotonicMilliseconds64();
+    }
+}
+
+TransitionTicker::Batch::~Batch()
+{
+    if (--mTicker.mBatchDepth == 0)
+    {
+        mTicker.Rearm();
+    }
+}
+
+Milliseconds64 TransitionTicker::Now() const
+{
+    return (mBatchDepth > 0) ? mBatchStart : System::SystemClock().GetMonotonicMilliseconds64();
+}
+
+void TransitionTicker::Cancel(System::Layer & layer, System::TimerCompleteCallback callback, void * context)
+{
+    if (mUsedOwnTimers)
+    {
+        layer.CancelTimer(callback, context);
+    }
+
+    Entry * entry = Find(callback, context);
+    VerifyOrReturn(entry != nullptr);
+    Remove(*entry);
+    Rearm();
+}
+
+TransitionTicker::Entry * TransitionTicker::Find(System::TimerCompleteCallback callback, void * context)
+{
+    for (size_t i = 0; i < mCount; i++)
+    {
+        if (mEntries[i].callback == callback && mEntries[i].context == context)
+        {
+            return &mEntries[i];
+        }
+    }
+    return nullptr;
+}
+
+void TransitionTicker::Remove(Entry & entry)
+{
+    entry = mEntries[--mCount];
+}
+
+void TransitionTicker::HandleTimer(System::Layer * layer, void * context)
+{
+    auto * self  = static_cast<TransitionTicker *>(context);
+    self->mArmed = false;
+    self->RunDueEntries();
+}
+
+void TransitionTicker::RunDueEntries()
+{
+    const Milliseconds64 now = System::SystemClock().GetMonotonicMilliseconds64();
+    for (size_t i = 0; i < mCount; i++)
+    {
+        mEntries[i].due = (mEntries[i].deadline <= now);
+    }
+
+    // Callbacks usually schedule their next step, and may cancel other entries, so look for the
+    // next due entry from the start each time.  Entries added meanwhile wait for the next tick.
+    mRunning      = true;
+    bool ranEntry = true;
+    while (ranEntry)
+    {
+        ranEntry = false;
+        for (size_t i = 0; i < mCount; i++)
+        {
+            if (mEntries[i].due)
+            {
+                System::TimerCompleteCallback callback = mEntries[i].callback;
+                void * context                         = mEntries[i].context;
+                Remove(mEntries[i]);
+                callback(mLayer, context);
+                ranEntry = true;
+                break;
+            }
+        }
+    }
+    mRunning = false;
+
+    Rearm();
+}
+
+void TransitionTicker::Rearm()
+{
+    // While running a tick or a batch, the timer is armed once all due entries have run or the batch is closed.
+    VerifyOrReturn(mLayer != nullptr && !mRunning && mBatchDepth == 0);
+
+    if (mCount == 0)
+    {
+        if (mArmed)
+        {
+            mLayer->CancelTimer(HandleTimer, this);
+            mArmed = false;
+        }
+        return;
+    }
+
+    Milliseconds64 earliest = mEntries[0].deadline;
+    for (size_t i = 1; i < mCount; i++)
+    {
+        earliest = (mEntries[i].deadline < earliest) ? mEntries[i].deadline : earliest;
+    }
+    VerifyOrReturn(!mArmed || earliest != mArmedDeadline);
+
+    const Milliseconds64 now = System::SystemClock().GetMonotonicMilliseconds64();
+    Milliseconds64 delay     = (earliest > now) ? earliest - now : Milliseconds64(0);
+    CHIP_ERROR err           = mLayer->StartTimer(std::chrono::duration_cast<Timeout>(delay), HandleTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Transition ticker failed to schedule its timer: %" CHIP_ERROR_FORMAT, err.Format());
+        mArmed = false;
+        return;
+    }
+    mArmed         = true;
+    mArmedDeadline = earliest;
+}
+
+} // namespace app
+} // namespace chip
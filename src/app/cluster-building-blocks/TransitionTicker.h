@@ -0,0 +1,116 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <stddef.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Runs the steps of many cluster transitions (level, color, ...) from a single System::Layer timer.
+ *
+ * Each transition schedules its next step like it would with System::Layer::StartTimer, but the
+ * deadlines are rounded up to a multiple of the tick period.  Transitions started together, e.g.
+ * by a group command to the lights of a bridge, therefore stay due at the same ticks: they are
+ * stepped back to back from one timer callback, and their attribute changes are picked up by a
+ * single reporting run.
+ *
+ * Runs scheduled with no delay are not rounded.  Once all kMaxEntries are in use, further runs
+ * get a timer of their own.
+ *
+ * An entry is identified by its callback and context: scheduling it again replaces the pending
+ * run, as with System::Layer::StartTimer.
+ */
+class TransitionTicker
+{
+public:
+    static constexpr size_t kMaxEntries = CHIP_CONFIG_TRANSITION_TICKER_MAX_ENTRIES;
+
+    /**
+     * Starts transitions together, e.g. those of the clusters of a recalled scene.  While a batch is open, deadlines are
+     * computed from the time the batch was opened, so runs scheduled for the same delay are due at the same tick however long
+     * the callers take, and the timer is armed only once, when the batch is closed.  Batches may be nested.
+     */
+    class Batch
+    {
+    public:
+        explicit Batch(TransitionTicker & ticker = TransitionTicker::Instance());
+        ~Batch();
+
+        Batch(const Batch &)             = delete;
+        Batch & operator=(const Batch &) = delete;
+
+    private:
+        TransitionTicker & mTicker;
+    };
+
+    explicit TransitionTicker(
+        System::Clock::Milliseconds32 tickPeriod = System::Clock::Milliseconds32(CHIP_CONFIG_TRANSITION_TICKER_PERIOD_MS)) :
+        mTickPeriod(tickPeriod.count() > 0 ? tickPeriod : System::Clock::Milliseconds32(1))
+    {}
+
+    /// The ticker shared by the cluster servers.
+    static TransitionTicker & Instance();
+
+    CHIP_ERROR Schedule(System::Layer & layer, System::Clock::Milliseconds32 delay, System::TimerCompleteCallback callback,
+                        void * context);
+
+    void Cancel(System::Layer & layer, System::TimerCompleteCallback callback, void * context);
+
+    /// Number of runs waiting for a tick, not counting the ones that got their own timer.
+    size_t ScheduledCount() const { return mCount; }
+
+private:
+    struct Entry
+    {
+        System::TimerCompleteCallback callback;
+        void * context;
+        System::Clock::Milliseconds64 deadline;
+        bool due; // deadline was reached when the current tick started
+    };
+
+    static void HandleTimer(System::Layer * layer, void * context);
+
+    Entry * Find(System::TimerCompleteCallback callback, void * context);
+    void Remove(Entry & entry);
+    void RunDueEntries();
+    void Rearm();
+    System::Clock::Milliseconds64 Now() const;
+
+    const System::Clock::Milliseconds64 mTickPeriod;
+    Entry mEntries[kMaxEntries];
+    size_t mCount          = 0;
+    System::Layer * mLayer = nullptr;
+    System::Clock::Milliseconds64 mArmedDeadline{ 0 };
+    System::Clock::Milliseconds64 mBatchStart{ 0 };
+    uint8_t mBatchDepth = 0;
+    bool mArmed         = false;
+    bool mRunning       = false;
+    // Whether some run had to get its own timer, which must then be cancelled on replacement.
+    bool mUsedOwnTimers = false;
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,240 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/cluster-building-blocks/TransitionTicker.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+// A System::Layer whose timers fire when its mock clock is advanced.
+class TimerAndMockClock : public System::Clock::Internal::MockClock, public System::Layer
+{
+public:
+    CriticalFailure Init() override { return CHIP_NO_ERROR; }
+    void Shutdown() override { Clear(); }
+    void Clear()
+    {
+        mTimerList.Clear();
+        mTimerNodes.ReleaseAll();
+    }
+    bool IsInitialized() const override { return true; }
+
+    CriticalFailure StartTimer(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        CancelTimer(aComplete, aAppState);
+        System::Clock::Timestamp awakenTime =
+            GetMonotonicMilliseconds64() + std::chrono::duration_cast<System::Clock::Milliseconds64>(aDelay);
+        mTimerList.Add(mTimerNodes.Create(*this, awakenTime, aComplete, aAppState));
+        mTimersStarted++;
+        return CHIP_NO_ERROR;
+    }
+    void CancelTimer(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        System::TimerList::Node * cancelled = mTimerList.Remove(aComplete, aAppState);
+        if (cancelled != nullptr)
+        {
+            mTimerNodes.Release(cancelled);
+        }
+    }
+    CHIP_ERROR ExtendTimerTo(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState) != System::Clock::Timeout(0);
+    }
+    System::Clock::Timeout GetRemainingTime(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState);
+    }
+    CriticalFailure ScheduleWork(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    // NOLINTNEXTLINE(bugprone-derived-method-shadowing-base-method)
+    void AdvanceMonotonic(System::Clock::Milliseconds64 increment)
+    {
+        System::Clock::Milliseconds64 now = GetMonotonicMilliseconds64() + increment;
+        MockClock::SetMonotonic(now);
+        System::TimerList::Node * node;
+        while ((node = mTimerList.Earliest()) != nullptr && node->AwakenTime() <= now)
+        {
+            mTimerList.PopEarliest();
+            mTimerNodes.Invoke(node);
+        }
+    }
+
+    unsigned mTimersStarted = 0;
+
+private:
+    System::TimerPool<> mTimerNodes;
+    System::TimerList mTimerList;
+};
+
+struct Step
+{
+    uintptr_t id;
+    uint64_t atMs;
+};
+
+std::vector<Step> gSteps;
+TimerAndMockClock * gLayer = nullptr;
+
+void RecordStep(System::Layer * layer, void * context)
+{
+    gSteps.push_back({ reinterpret_cast<uintptr_t>(context), gLayer->GetMonotonicMilliseconds64().count() });
+}
+
+void * Context(uintptr_t id)
+{
+    return reinterpret_cast<void *>(id);
+}
+
+class TestTransitionTicker : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        mRealClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mLayer);
+        mLayer.SetMonotonic(1005_ms64);
+        gLayer = &mLayer;
+        gSteps.clear();
+    }
+
+    void TearDown() override
+    {
+        mLayer.Clear();
+        System::Clock::Internal::SetSystemClockForTesting(mRealClock);
+        gLayer = nullptr;
+    }
+
+protected:
+    TimerAndMockClock mLayer;
+    System::Clock::ClockBase * mRealClock = nullptr;
+};
+
+TEST_F(TestTransitionTicker, TestStepsShareTicks)
+{
+    TransitionTicker ticker(System::Clock::Milliseconds32(10));
+
+    // Steps scheduled at slightly different times for about the same delay land on the same tick.
+    EXPECT_EQ(ticker.Schedule(mLayer, System::Clock::Milliseconds32(100), RecordStep, Context(1)), CHIP_NO_ERROR);
+    mLayer.AdvanceMonotonic(3_ms64);
+    EXPECT_EQ(ticker.Schedule(mLayer, System::Clock::Milliseconds32(100), RecordStep, Context(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(ticker.Schedule(mLayer, System::Clock::Milliseconds32(250), RecordStep, Context(3)), CHIP_NO_ERROR);
+    EXPECT_EQ(ticker.ScheduledCount(), 3u);
+
+    mLayer.AdvanceMonotonic(99_ms64);
+    EXPECT_TRUE(gSteps.empty());
+
+    mLayer.AdvanceMonotonic(3_ms64);
+    ASSERT_EQ(gSteps.size(), 2u);
+    EXPECT_EQ(gSteps[0].atMs, 1110u);
+    EXPECT_EQ(gSteps[1].atMs, 1110u);
+    EXPECT_EQ(gSteps[0].id + gSteps[1].id, 3u);
+
+    mLayer.AdvanceMonotonic(200_ms64);
+    ASSERT_EQ(gSteps.size(), 3u);
+    EXPECT_EQ(gSteps[2].id, 3u);
+    EXPECT_EQ(ticker.ScheduledCount(), 0u);
+
+    // Only the ticker's own timer was used.
+    EXPECT_FALSE(mLayer.IsTimerActive(RecordStep, Context(1)));
+}
+
+TEST_F(TestTransitionTicker, TestRescheduleAndCancel)
+{
+    TransitionTicker ticker(System::Clock::Milliseconds32(10));
+
+    EXPECT_EQ(ticker.Schedule(mLayer, System::Clock::Milliseconds32(50), RecordStep, Context(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(ticker.Schedule(mLayer, System::Clock::Milliseconds32(50), RecordStep, Context(2)), CHIP_NO_ERROR);
+
+    // Scheduling again replaces the pending run.
+    EXPECT_EQ(ticker.Schedule(mLayer, System::Clock::Milliseconds32(200), RecordStep, Context(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(ticker.ScheduledCount(), 2u);
+    ticker.Cancel(mLayer, RecordStep, Context(2));
+    EXPECT_EQ(ticker.ScheduledCount(), 1u);
+
+    mLayer.AdvanceMonotonic(100_ms64);
+    EXPECT_TRUE(gSteps.empty());
+    mLayer.AdvanceMonotonic(110_ms64);
+    ASSERT_EQ(gSteps.size(), 1u);
+    EXPECT_EQ(gSteps[0].id, 1u);
+
+    // Runs without a delay are not rounded to the tick.
+    EXPECT_EQ(ticker.Schedule(mLayer, System::Clock::Milliseconds32(0), RecordStep, Context(4)), CHIP_NO_ERROR);
+    mLayer.AdvanceMonotonic(0_ms64);
+    ASSERT_EQ(gSteps.size(), 2u);
+    EXPECT_EQ(gSteps[1].id, 4u);
+}
+
+TEST_F(TestTransitionTicker, TestBatchStartsTogether)
+{
+    TransitionTicker ticker(System::Clock::Milliseconds32(10));
+
+    {
+        TransitionTicker::Batch batch(ticker);
+        EXPECT_EQ(ticker.Schedule(mLayer, System::Clock::Milliseconds32(100), RecordStep, Context(1)), CHIP_NO_ERROR);
+        // Going past a tick while the batch is open does not move the deadline of the next run.
+        mLayer.AdvanceMonotonic(8_ms64);
+        EXPECT_EQ(ticker.Schedule(mLayer, System::Clock::Milliseconds32(100), RecordStep, Context(2)), CHIP_NO_ERROR);
+        EXPECT_EQ(mLayer.mTimersStarted, 0u);
+    }
+    EXPECT_EQ(mLayer.mTimersStarted, 1u);
+
+    mLayer.AdvanceMonotonic(97_ms64);
+    ASSERT_EQ(gSteps.size(), 2u);
+    EXPECT_EQ(gSteps[0].atMs, 1110u);
+    EXPECT_EQ(gSteps[1].atMs, 1110u);
+}
+
+TEST_F(TestTransitionTicker, TestOverflowUsesOwnTimers)
+{
+    TransitionTicker ticker(System::Clock::Milliseconds32(10));
+
+    for (uintptr_t id = 1; id <= TransitionTicker::kMaxEntries + 1; id++)
+    {
+        EXPECT_EQ(ticker.Schedule(mLayer, System::Clock::Milliseconds32(100), RecordStep, Context(id)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(ticker.ScheduledCount(), TransitionTicker::kMaxEntries);
+    EXPECT_TRUE(mLayer.IsTimerActive(RecordStep, Context(TransitionTicker::kMaxEntries + 1)));
+
+    ticker.Cancel(mLayer, RecordStep, Context(TransitionTicker::kMaxEntries + 1));
+    EXPECT_FALSE(mLayer.IsTimerActive(RecordStep, Context(TransitionTicker::kMaxEntries + 1)));
+
+    mLayer.AdvanceMonotonic(110_ms64);
+    EXPECT_EQ(gSteps.size(), TransitionTicker::kMaxEntries);
+}
+
+} // namespace
@@ -65,20 +65,43 @@ using ArlReviewEvent = Events::FabricRestrictionReviewUpdate::Type;
 namespace {
 CHIP_ERROR ReadAcl(AttributeValueEncoder & aEncoder)
 {
+    // List positions are the position of the fabric in the fabric table in the upper 16 bits, and the index of the entry
+    // within that fabric in the lower 16 bits, so that a chunked read only skips entries of the fabric it resumes in.
+    constexpr unsigned kFabricPositionShift = 16;
+    constexpr uint32_t kEntryPositionMask   = 0xFFFF;
+
     AccessControl::EntryIterator iterator;
     AccessControl::Entry entry;
     AclStorage::EncodableEntry encodableEntry(entry);
-    return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
+    return aEncoder.EncodeResumableList([&](uint32_t startPosition, const auto & encoder) -> CHIP_ERROR {
+        const uint32_t startFabricPosition = startPosition >> kFabricPositionShift;
+        uint32_t fabricPosition            = 0;
         for (auto & info : Server::GetInstance().GetFabricTable())
         {
+            if (fabricPosition < startFabricPosition)
+            {
+                fabricPosition++;
+                continue;
+            }
+
             auto fabric = info.GetFabricIndex();
             ReturnErrorOnFailure(GetAccessControl().Entries(fabric, iterator));
-            CHIP_ERROR err = CHIP_NO_ERROR;
+            // Entries of the fabric the read resumes in that were encoded in previous chunks are skipped.
+            const uint32_t skipCount = (fabricPosition == startFabricPosition) ? (startPosition & kEntryPositionMask) : 0;
+            uint32_t entryPosition   = 0;
+            CHIP_ERROR err           = CHIP_NO_ERROR;
             while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
             {
-                ReturnErrorOnFailure(encoder.Encode(encodableEntry));
+                entryPosition++;
+                if (entryPosition <= skipCount)
+                {
+                    continue;
+                }
+                VerifyOrReturnError(entryPosition <= kEntryPositionMask, CHIP_ERROR_INTERNAL);
+                ReturnErrorOnFailure(encoder.Encode(encodableEntry, (fabricPosition << kFabricPositionShift) | entryPosition));
             }
             VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_SENTINEL, err);
+            fabricPosition++;
         }
         return CHIP_NO_ERROR;
     });
@@ -289,44 +289,46 @@ CHIP_ERROR CameraAVStreamManagementCluster::SetStreamUsagePriorities(const std::
 
 std::optional<uint16_t> CameraAVStreamManagementCluster::GetReusableVideoStreamId(const VideoStreamStruct & requestedArgs) const
 {
+    std::optional<uint16_t> overlappingStreamId;
+
     for (const auto & stream : mAllocatedVideoStreams)
     {
-        // 1. Codec must match exactly (Allocated stream already has the codec)
-        if (requestedArgs.videoCodec != stream.videoCodec)
+        // 1. Codec and KeyFrameInterval must match exactly, as they cannot be changed without affecting the current users of
+        // the stream.
+        if (requestedArgs.videoCodec != stream.videoCodec || requestedArgs.keyFrameInterval != stream.keyFrameInterval)
         {
             continue;
         }
 
-        // 2. Framerate check (request must be within allocated stream's current range)
-        if (requestedArgs.minFrameRate < stream.minFrameRate || requestedArgs.maxFrameRate > stream.maxFrameRate)
+        // 2. Framerate, resolution and bitrate ranges must overlap, so that the intersection of the ranges can be
+        // used for all the users of the stream.
+        if (requestedArgs.minFrameRate > stream.maxFrameRate || requestedArgs.maxFrameRate < stream.minFrameRate ||
+            requestedArgs.minResolution.width > stream.maxResolution.width ||
+            requestedArgs.minResolution.height > stream.maxResolution.height ||
+            requestedArgs.maxResolution.width < stream.minResolution.width ||
+            requestedArgs.maxResolution.height < stream.minResolution.height || requestedArgs.minBitRate > stream.maxBitRate ||
+            requestedArgs.maxBitRate < stream.minBitRate)
         {
             continue;
         }
 
-        // 3. Resolution check
-        if (requestedArgs.minResolution.width < stream.minResolution.width ||
-            requestedArgs.minResolution.height < stream.minResolution.height ||
-            requestedArgs.maxResolution.width > stream.maxResolution.width ||
-            requestedArgs.maxResolution.height > stream.maxResolution.height)
+        // 3. A stream whose ranges all fall within the requested ones is reused as is, without restarting its encoder.
+        if (requestedArgs.minFrameRate <= stream.minFrameRate && requestedArgs.maxFrameRate >= stream.maxFrameRate &&
+            requestedArgs.minResolution.width <= stream.minResolution.width &&
+            requestedArgs.minResolution.height <= stream.minResolution.height &&
+            requestedArgs.maxResolution.width >= stream.maxResolution.width &&
+            requestedArgs.maxResolution.height >= stream.maxResolution.height && requestedArgs.minBitRate <= stream.minBitRate &&
+            requestedArgs.maxBitRate >= stream.maxBitRate)
         {
-            continue;
+            return stream.videoStreamID;
         }
 
-        // 4. Bitrate check
-        if (requestedArgs.minBitRate < stream.minBitRate || requestedArgs.maxBitRate > stream.maxBitRate)
+        if (!overlappingStreamId.has_value())
         {
-            continue;
+            overlappingStreamId = stream.videoStreamID;
         }
-
-        // 5. KeyFrameInterval check
-        if (requestedArgs.keyFrameInterval != stream.keyFrameInterval)
-        {
-            continue;
-        }
-
-        return stream.videoStreamID;
     }
-    return std::nullopt;
+    return overlappingStreamId;
 }
 
 CHIP_ERROR CameraAVStreamManagementCluster::AddVideoStream(const VideoStreamStruct & videoStream)
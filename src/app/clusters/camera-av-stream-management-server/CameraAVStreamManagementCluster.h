@@ -611,8 +611,11 @@ public:
     /**
      * Called during the processing of an AllocateVideoStream request. The
      * handler of the request iterates through the currently allocated video
-     * streams to check if the allocation request parameters fall within the
-     * ranges of an allocated stream so that the latter can be reused.
+     * streams to check if an allocated stream with the same codec and key
+     * frame interval has ranges overlapping with the allocation request
+     * parameters, so that the latter can be reused and its encoder shared
+     * by all the transports using it. A stream whose ranges all fall within
+     * the requested ones is preferred, as it is reused without modification.
      * If a match is found, the function returns the StreamID of the reusable
      * stream.
      *
@@ -21,6 +21,7 @@
 #include <app-common/zap-generated/attributes/Accessors.h>
 #include <app/CommandHandler.h>
 #include <app/ConcreteCommandPath.h>
+#include <app/cluster-building-blocks/TransitionTicker.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/config.h>
 #include <lib/core/Optional.h>
@@ -384,7 +385,12 @@ void ColorControlServer::timerCallback(System::Layer *, void * callbackContext)
 
 void ColorControlServer::scheduleTimerCallbackMs(EmberEventControl * control, uint32_t delayMs)
 {
+#if CHIP_CONFIG_TRANSITION_TICKER
+    CHIP_ERROR err = TransitionTicker::Instance().Schedule(DeviceLayer::SystemLayer(), chip::System::Clock::Milliseconds32(delayMs),
+                                                           timerCallback, control);
+#else
     CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback, control);
+#endif // CHIP_CONFIG_TRANSITION_TICKER
 
     if (err != CHIP_NO_ERROR)
     {
@@ -394,7 +400,11 @@ void ColorControlServer::scheduleTimerCallbackMs(EmberEventControl * control, ui
 
 void ColorControlServer::cancelEndpointTimerCallback(EmberEventControl * control)
 {
+#if CHIP_CONFIG_TRANSITION_TICKER
+    TransitionTicker::Instance().Cancel(DeviceLayer::SystemLayer(), timerCallback, control);
+#else
     DeviceLayer::SystemLayer().CancelTimer(timerCallback, control);
+#endif // CHIP_CONFIG_TRANSITION_TICKER
 }
 
 void ColorControlServer::cancelEndpointTimerCallback(EndpointId endpoint)
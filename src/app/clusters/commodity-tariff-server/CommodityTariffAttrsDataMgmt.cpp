@@ -18,6 +18,9 @@
 
 #include "CommodityTariffAttrsDataMgmt.h"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace chip;
 using namespace chip::app;
 using namespace chip::Platform;
@@ -50,6 +53,7 @@ static bool HasFeatureInCtx(TariffUpdateCtx * aCtx, Feature aFeature)
  * @brief Releases memory allocated for a list of IDs and resets the list
  * @param IDs List containing allocated IDs buffer to free. After this call,
  *            the list will be empty and the buffer pointer nulled.
+ * @param arena Arena of the value holding the list, whose buffers are not freed individually
  *
  * @note The const_cast is safe because:
  *       1. We own the memory allocation (allocated via MemoryAlloc in non-const context)
@@ -57,15 +61,15 @@ static bool HasFeatureInCtx(TariffUpdateCtx * aCtx, Feature aFeature)
  *       3. The const-ness was only added for interface safety
  *       4. This matches the symmetric Alloc/Free pattern we established
  */
-static void CleanUpIDs(DataModel::List<const uint32_t> & IDs)
+static void CleanUpIDs(DataModel::List<const uint32_t> & IDs, const TariffArena * arena)
 {
     if (!IDs.empty() && IDs.data())
     {
-        // Safe const_cast because:
+        // Safe const_cast (in FreeBuffer) because:
         // - We allocated this memory ourselves via non-const allocation
         // - MemoryFree won't actually modify the contents
         // - The original allocation wasn't truly const (just interface const)
-        MemoryFree(const_cast<uint32_t *>(IDs.data()));
+        TariffArena::FreeBuffer(arena, IDs.data());
         IDs = DataModel::List<const uint32_t>();
     }
 }
@@ -89,6 +93,91 @@ namespace CommodityTariffAttrsDataMgmt {
 using namespace CommodityTariffConsts;
 using namespace chip::app::Clusters::CommodityTariff::Structs;
 
+void * TariffArena::Allocate(size_t count, size_t size, size_t alignment)
+{
+    VerifyOrReturnValue(count > 0 && size > 0 && alignment > 0 && alignment <= alignof(std::max_align_t), nullptr);
+    VerifyOrReturnValue(count <= std::numeric_limits<size_t>::max() / size, nullptr);
+
+    const size_t bytes = count * size;
+    VerifyOrReturnValue(bytes <= std::numeric_limits<size_t>::max() - kChunkHeaderSize - alignment, nullptr);
+
+    size_t offset = 0;
+    if (mChunks != nullptr)
+    {
+        offset = (mChunks->used + alignment - 1) & ~(alignment - 1);
+    }
+
+    if (mChunks == nullptr || offset > mChunks->capacity || bytes > mChunks->capacity - offset)
+    {
+        const size_t capacity = std::max({ kMinChunkSize, bytes, mCapacityHint });
+        auto * chunk          = static_cast<Chunk *>(Platform::MemoryAlloc(kChunkHeaderSize + capacity));
+        VerifyOrReturnValue(chunk != nullptr, nullptr);
+
+        chunk->next     = mChunks;
+        chunk->capacity = capacity;
+        chunk->used     = 0;
+        mChunks         = chunk;
+        mCapacityHint   = 0;
+        offset          = 0;
+    }
+
+    uint8_t * buffer = GetData(mChunks) + offset;
+    mChunks->used    = offset + bytes;
+    memset(buffer, 0, bytes);
+    return buffer;
+}
+
+void TariffArena::Reset()
+{
+    VerifyOrReturn(mChunks != nullptr);
+
+    if (mChunks->next == nullptr)
+    {
+        mChunks->used = 0;
+        return;
+    }
+
+    // Replace the chunks by a single one large enough for all of them on the next allocation.
+    const size_t capacity = GetCapacity();
+    Release();
+    mCapacityHint = capacity;
+}
+
+void TariffArena::Release()
+{
+    while (mChunks != nullptr)
+    {
+        Chunk * next = mChunks->next;
+        Platform::MemoryFree(mChunks);
+        mChunks = next;
+    }
+    mCapacityHint = 0;
+}
+
+bool TariffArena::Contains(const void * buffer) const
+{
+    const auto * address = static_cast<const uint8_t *>(buffer);
+    for (Chunk * chunk = mChunks; chunk != nullptr; chunk = chunk->next)
+    {
+        const uint8_t * data = GetData(chunk);
+        if (address >= data && address < data + chunk->capacity)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t TariffArena::GetCapacity() const
+{
+    size_t capacity = 0;
+    for (Chunk * chunk = mChunks; chunk != nullptr; chunk = chunk->next)
+    {
+        capacity += chunk->capacity;
+    }
+    return capacity;
+}
+
 template <typename T>
 CHIP_ERROR CTC_BaseDataClass<T>::CopyData(const StructType & input, StructType & output)
 {
@@ -111,13 +200,13 @@ CHIP_ERROR CTC_BaseDataClass<DataModel::Nullable<TariffInformationStruct::Type>>
     if (!input.tariffLabel.IsNull())
     {
         ReturnErrorOnFailure(
-            SpanCopier<char>::Copy(input.tariffLabel.Value(), output.tariffLabel, input.tariffLabel.Value().size()));
+            SpanCopier<char>::Copy(input.tariffLabel.Value(), output.tariffLabel, input.tariffLabel.Value().size(), mCurrentArena));
     }
 
     if (!input.providerName.IsNull())
     {
-        ReturnErrorOnFailure(
-            SpanCopier<char>::Copy(input.providerName.Value(), output.providerName, input.providerName.Value().size()));
+        ReturnErrorOnFailure(SpanCopier<char>::Copy(input.providerName.Value(), output.providerName,
+                                                    input.providerName.Value().size(), mCurrentArena));
     }
 
     if (input.currency.HasValue())
@@ -243,8 +332,8 @@ CHIP_ERROR CTC_BaseDataClass<DataModel::Nullable<DataModel::List<TariffComponent
         output.label.Value().SetNull();
         if (!input.label.Value().IsNull())
         {
-            ReturnErrorOnFailure(
-                SpanCopier<char>::Copy(input.label.Value().Value(), output.label.Value(), input.label.Value().Value().size()));
+            ReturnErrorOnFailure(SpanCopier<char>::Copy(input.label.Value().Value(), output.label.Value(),
+                                                        input.label.Value().Value().size(), mCurrentArena));
         }
     }
 
@@ -264,15 +353,15 @@ CHIP_ERROR CTC_BaseDataClass<DataModel::Nullable<DataModel::List<TariffPeriodStr
     output.label.SetNull();
     if (!input.label.IsNull())
     {
-        ReturnErrorOnFailure(SpanCopier<char>::Copy(input.label.Value(), output.label, input.label.Value().size()));
+        ReturnErrorOnFailure(SpanCopier<char>::Copy(input.label.Value(), output.label, input.label.Value().size(), mCurrentArena));
     }
 
     ReturnErrorOnFailure(SpanCopier<uint32_t>::Copy(chip::Span<const uint32_t>(input.dayEntryIDs.data(), input.dayEntryIDs.size()),
-                                                    output.dayEntryIDs, input.dayEntryIDs.size()));
+                                                    output.dayEntryIDs, input.dayEntryIDs.size(), mCurrentArena));
 
     ReturnErrorOnFailure(
         SpanCopier<uint32_t>::Copy(chip::Span<const uint32_t>(input.tariffComponentIDs.data(), input.tariffComponentIDs.size()),
-                                   output.tariffComponentIDs, input.tariffComponentIDs.size()));
+                                   output.tariffComponentIDs, input.tariffComponentIDs.size(), mCurrentArena));
 
     return CHIP_NO_ERROR;
 }
@@ -285,7 +374,7 @@ CHIP_ERROR CTC_BaseDataClass<DataModel::Nullable<DataModel::List<DayPatternStruc
     output.daysOfWeek   = input.daysOfWeek;
 
     ReturnErrorOnFailure(SpanCopier<uint32_t>::Copy(chip::Span<const uint32_t>(input.dayEntryIDs.data(), input.dayEntryIDs.size()),
-                                                    output.dayEntryIDs, input.dayEntryIDs.size()));
+                                                    output.dayEntryIDs, input.dayEntryIDs.size(), mCurrentArena));
     return CHIP_NO_ERROR;
 }
 
@@ -297,7 +386,7 @@ CHIP_ERROR CTC_BaseDataClass<DataModel::Nullable<DataModel::List<DayStruct::Type
     output.dayType = input.dayType;
 
     ReturnErrorOnFailure(SpanCopier<uint32_t>::Copy(chip::Span<const uint32_t>(input.dayEntryIDs.data(), input.dayEntryIDs.size()),
-                                                    output.dayEntryIDs, input.dayEntryIDs.size()));
+                                                    output.dayEntryIDs, input.dayEntryIDs.size(), mCurrentArena));
 
     return CHIP_NO_ERROR;
 }
@@ -314,7 +403,7 @@ CHIP_ERROR CTC_BaseDataClass<DataModel::Nullable<DataModel::List<CalendarPeriodS
 
     ReturnErrorOnFailure(
         SpanCopier<uint32_t>::Copy(chip::Span<const uint32_t>(input.dayPatternIDs.data(), input.dayPatternIDs.size()),
-                                   output.dayPatternIDs, input.dayPatternIDs.size()));
+                                   output.dayPatternIDs, input.dayPatternIDs.size(), mCurrentArena));
 
     return CHIP_NO_ERROR;
 }
@@ -946,13 +1035,13 @@ void CTC_BaseDataClass<DataModel::Nullable<TariffInformationStruct::Type>>::Clea
 {
     if (!aValue.tariffLabel.IsNull() && aValue.tariffLabel.Value().data())
     {
-        Platform::MemoryFree(const_cast<char *>(aValue.tariffLabel.Value().data()));
+        FreeBuffer(aValue.tariffLabel.Value().data());
         aValue.tariffLabel.SetNull();
     }
 
     if (!aValue.providerName.IsNull() && aValue.providerName.Value().data())
     {
-        Platform::MemoryFree(const_cast<char *>(aValue.providerName.Value().data()));
+        FreeBuffer(aValue.providerName.Value().data());
         aValue.providerName.SetNull();
     }
 
@@ -970,7 +1059,7 @@ void CTC_BaseDataClass<DataModel::Nullable<DataModel::List<DayEntryStruct::Type>
 template <>
 void CTC_BaseDataClass<DataModel::Nullable<DataModel::List<DayPatternStruct::Type>>>::CleanupStruct(StructType & aValue)
 {
-    CommonUtilities::CleanUpIDs(aValue.dayEntryIDs);
+    CommonUtilities::CleanUpIDs(aValue.dayEntryIDs, mCurrentArena);
 }
 
 template <>
@@ -978,7 +1067,7 @@ void CTC_BaseDataClass<DataModel::Nullable<DataModel::List<TariffComponentStruct
 {
     if (aValue.label.HasValue() && !aValue.label.Value().IsNull())
     {
-        MemoryFree(const_cast<char *>(aValue.label.Value().Value().data()));
+        FreeBuffer(aValue.label.Value().Value().data());
         aValue.label.ClearValue();
     }
 
@@ -994,23 +1083,23 @@ void CTC_BaseDataClass<DataModel::Nullable<DataModel::List<TariffPeriodStruct::T
 {
     if (!aValue.label.IsNull() && aValue.label.Value().data())
     {
-        Platform::MemoryFree(const_cast<char *>(aValue.label.Value().data()));
+        FreeBuffer(aValue.label.Value().data());
         aValue.label.SetNull();
     }
-    CommonUtilities::CleanUpIDs(aValue.dayEntryIDs);
-    CommonUtilities::CleanUpIDs(aValue.tariffComponentIDs);
+    CommonUtilities::CleanUpIDs(aValue.dayEntryIDs, mCurrentArena);
+    CommonUtilities::CleanUpIDs(aValue.tariffComponentIDs, mCurrentArena);
 }
 
 template <>
 void CTC_BaseDataClass<DataModel::Nullable<DataModel::List<DayStruct::Type>>>::CleanupStruct(StructType & aValue)
 {
-    CommonUtilities::CleanUpIDs(aValue.dayEntryIDs);
+    CommonUtilities::CleanUpIDs(aValue.dayEntryIDs, mCurrentArena);
 }
 
 template <>
 void CTC_BaseDataClass<DataModel::Nullable<DataModel::List<CalendarPeriodStruct::Type>>>::CleanupStruct(StructType & aValue)
 {
-    CommonUtilities::CleanUpIDs(aValue.dayPatternIDs);
+    CommonUtilities::CleanUpIDs(aValue.dayPatternIDs, mCurrentArena);
 }
 
 } // namespace CommodityTariffAttrsDataMgmt
@@ -25,6 +25,8 @@
 
 #include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <limits>
 #include <map>
 #include <set>
 #include <string>
@@ -198,6 +200,75 @@ inline bool operator!=(const Type & lhs, const Type & rhs)
 
 namespace CommodityTariffAttrsDataMgmt {
 
+/**
+ * @class TariffArena
+ * @brief Bump allocator holding the buffers of one attribute value
+ *
+ * @details A tariff value is a list of structs which hold their own strings and ID lists. Building it
+ *          from a few large zeroed chunks instead of one heap allocation per buffer makes an update
+ *          cheap, and dropping the value releases all of its buffers at once. After a Reset() the
+ *          arena keeps a single chunk large enough for a value of the same size, so that repeated
+ *          updates of a tariff do not go back to the heap.
+ */
+class TariffArena
+{
+public:
+    TariffArena() = default;
+    ~TariffArena() { Release(); }
+
+    TariffArena(const TariffArena &)             = delete;
+    TariffArena & operator=(const TariffArena &) = delete;
+
+    /// @brief Allocates a zeroed buffer of count elements of the given size
+    /// @return The buffer, or nullptr if out of memory
+    void * Allocate(size_t count, size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /// @brief Drops all the buffers, keeping the memory for the next value
+    void Reset();
+
+    /// @brief Drops all the buffers and returns the memory to the heap
+    void Release();
+
+    /// @brief Whether the buffer was allocated from this arena
+    bool Contains(const void * buffer) const;
+
+    /// @brief Total size of the chunks currently held, in bytes
+    size_t GetCapacity() const;
+
+    /// @brief Frees a heap buffer, unless it was allocated from the arena (which may be null)
+    static void FreeBuffer(const TariffArena * arena, const void * buffer)
+    {
+        if (buffer != nullptr && (arena == nullptr || !arena->Contains(buffer)))
+        {
+            Platform::MemoryFree(const_cast<void *>(buffer));
+        }
+    }
+
+private:
+    struct Chunk
+    {
+        Chunk * next;
+        size_t capacity; ///< Bytes available after the header
+        size_t used;
+    };
+
+    /// Size of the chunk header, rounded up so that the data keeps the alignment of the heap
+    static constexpr size_t kChunkHeaderSize =
+        (sizeof(Chunk) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    static constexpr size_t kMinChunkSize = 256;
+
+    static uint8_t * GetData(Chunk * chunk) { return reinterpret_cast<uint8_t *>(chunk) + kChunkHeaderSize; }
+
+    Chunk * mChunks      = nullptr; ///< Most recent chunk first
+    size_t mCapacityHint = 0;       ///< Size of the next chunk after a Reset() of several chunks
+};
+
+/// @brief Allocates count zeroed elements from the arena, or from the heap when it is null
+inline void * AllocateBuffer(TariffArena * arena, size_t count, size_t size, size_t alignment)
+{
+    return (arena != nullptr) ? arena->Allocate(count, size, alignment) : Platform::MemoryCalloc(count, size);
+}
+
 /// @brief Helper for copying spans to Matter data model lists
 /// @tparam T Type of elements to copy
 template <typename T>
@@ -207,9 +278,10 @@ struct SpanCopier
     /// @param source Input span to copy from
     /// @param destination Output list to populate
     /// @param maxCount Maximum number of elements to copy (default: unlimited)
+    /// @param arena Arena to allocate the list from (default: the heap)
     /// @return CHIP_NO_ERROR if copy succeeded, error code on failure
     static CHIP_ERROR Copy(const Span<const T> & source, DataModel::List<const T> & destination,
-                           size_t maxCount = std::numeric_limits<size_t>::max())
+                           size_t maxCount = std::numeric_limits<size_t>::max(), TariffArena * arena = nullptr)
     {
         if (source.empty())
         {
@@ -218,7 +290,7 @@ struct SpanCopier
         }
 
         const size_t elementsToCopy = std::min(source.size(), maxCount);
-        auto * buffer               = static_cast<T *>(Platform::MemoryCalloc(elementsToCopy, sizeof(T)));
+        auto * buffer               = static_cast<T *>(AllocateBuffer(arena, elementsToCopy, sizeof(T), alignof(T)));
 
         if (!buffer)
             return CHIP_ERROR_NO_MEMORY;
@@ -237,9 +309,10 @@ struct SpanCopier<char>
     /// @param source Input span to copy from
     /// @param destination Output span to populate
     /// @param maxCount Maximum number of characters to copy (default: unlimited)
+    /// @param arena Arena to allocate the characters from (default: the heap)
     /// @return CHIP_NO_ERROR if copy succeeded, error code on failure
     static CHIP_ERROR Copy(const CharSpan & source, DataModel::Nullable<CharSpan> & destination,
-                           size_t maxCount = std::numeric_limits<size_t>::max())
+                           size_t maxCount = std::numeric_limits<size_t>::max(), TariffArena * arena = nullptr)
     {
         if (source.size() > maxCount)
         {
@@ -252,7 +325,7 @@ struct SpanCopier<char>
             return CHIP_NO_ERROR;
         }
 
-        char * buffer = static_cast<char *>(Platform::MemoryCalloc(1, source.size()));
+        char * buffer = static_cast<char *>(AllocateBuffer(arena, 1, source.size(), 1));
         if (!buffer)
             return CHIP_ERROR_NO_MEMORY;
 
@@ -524,6 +597,8 @@ class CTC_BaseDataClass : public CTC_BaseDataClassBase
     StorageState mHoldState[2] = { StorageState::kEmpty };       ///< Storage state tracking
     std::atomic<UpdateState> mUpdateState{ UpdateState::kIdle }; ///< Current update state
     std::atomic<uint8_t> mActiveValueIdx{ 0 };                   ///< Index of active value storage
+    TariffArena mArena[2];                                       ///< Buffers of the values built by SetNewValue()
+    TariffArena * mCurrentArena = nullptr;                       ///< Arena of the value being copied or cleaned up
 public:
     /// The exposed attribute value type
     using ValueType = T;
@@ -612,7 +687,14 @@ public:
      *
      * @note For zero size, creates an empty list or null value
      */
-    CHIP_ERROR CreateNewListValue(size_t size)
+    CHIP_ERROR CreateNewListValue(size_t size) { return CreateNewListValue(size, nullptr); }
+
+    /**
+     * @brief Prepares a new list value for modification, allocating it from the given arena
+     * @param[in] size Number of elements to allocate
+     * @param[in] arena Arena to allocate the elements from, or nullptr for the heap
+     */
+    CHIP_ERROR CreateNewListValue(size_t size, TariffArena * arena)
     {
         if (mUpdateState.load() != UpdateState::kIdle)
         {
@@ -623,7 +705,8 @@ public:
         {
             if (size >= 1)
             {
-                auto * buffer = static_cast<ListEntryType *>(Platform::MemoryCalloc(size, sizeof(ListEntryType)));
+                auto * buffer =
+                    static_cast<ListEntryType *>(AllocateBuffer(arena, size, sizeof(ListEntryType), alignof(ListEntryType)));
                 if (!buffer)
                 {
                     return CHIP_ERROR_NO_MEMORY;
@@ -743,15 +826,19 @@ public:
             }
         };
 
+        // The whole new value, nested buffers included, is built in the arena of its storage slot.
+        [[maybe_unused]] TariffArena & arena = mArena[1 - mActiveValueIdx.load()];
+
         if constexpr (TypeIsList<DataType>())
         {
             assertChipStackLockedByCurrentThread();
 
-            err = CreateNewListValue(actualValue.size());
+            err = CreateNewListValue(actualValue.size(), &arena);
 
             if (CHIP_NO_ERROR == err)
             {
-                auto buffer = getStorageRef().data();
+                mCurrentArena = &arena;
+                auto buffer   = getStorageRef().data();
                 for (size_t idx = 0; idx < actualValue.size(); idx++)
                 {
                     if constexpr (TypeIsStruct<ListEntryType>())
@@ -767,6 +854,7 @@ public:
                         buffer[idx] = actualValue[idx];
                     }
                 }
+                mCurrentArena = nullptr;
             }
         }
         else if constexpr (TypeIsStruct<DataType>())
@@ -776,7 +864,9 @@ public:
             if (CHIP_NO_ERROR == err)
             {
                 assignStorageVal(DataType()); // Default construct in place
-                err = CopyData(actualValue, getStorageRef());
+                mCurrentArena = &arena;
+                err           = CopyData(actualValue, getStorageRef());
+                mCurrentArena = nullptr;
             }
         }
         else if constexpr (TypeIsScalar<DataType>())
@@ -899,10 +989,18 @@ public:
 
         CleanupByIdx(1 - mActiveValueIdx.load());
         CleanupByIdx(mActiveValueIdx.load());
+        mArena[0].Release();
+        mArena[1].Release();
 
         return ret;
     }
 
+    /**
+     * @brief Gets the memory held for the values built by SetNewValue()
+     * @return Total size of the arenas of both storage slots, in bytes
+     */
+    size_t GetArenaCapacity() const { return mArena[0].GetCapacity() + mArena[1].GetCapacity(); }
+
     /**
      * @brief Cleans up an external list entry
      * @param[in,out] entry The list entry to clean up
@@ -1086,6 +1184,8 @@ private:
      */
     void CleanupByIdx(uint8_t aIdx)
     {
+        // Buffers allocated from the arena of the slot are skipped by FreeBuffer() and dropped at once by the reset.
+        mCurrentArena = &mArena[aIdx];
         if (mActiveValueIdx == aIdx)
         {
             CleanupValueByRef(mValueStorage[mActiveValueIdx.load()]);
@@ -1096,8 +1196,16 @@ private:
             CleanupValueByRef(mValueStorage[1 - mActiveValueIdx.load()]);
             mHoldState[1 - mActiveValueIdx.load()] = StorageState::kEmpty;
         }
+        mCurrentArena = nullptr;
+        mArena[aIdx].Reset();
     }
 
+    /**
+     * @brief Frees a buffer of the value being cleaned up, unless it belongs to the arena of its slot
+     * @param buffer Buffer to free, may be nullptr
+     */
+    void FreeBuffer(const void * buffer) { TariffArena::FreeBuffer(mCurrentArena, buffer); }
+
     /**
      * @brief Cleans up a value reference
      * @param aValue Reference to value to clean up
@@ -1144,7 +1252,7 @@ private:
 
         if (list.data())
         {
-            Platform::MemoryFree(list.data());
+            FreeBuffer(list.data());
             list = DataModel::List<ListEntryType>();
         }
     }
@@ -685,6 +685,97 @@ TEST_F(TestCommodityTariffBaseDataClass, NullableListOfResourceStructs_ZeroSizeL
     EXPECT_TRUE(data.GetValue().IsNull());
 }
 
+TEST_F(TestCommodityTariffBaseDataClass, TariffArenaAllocateAndReset)
+{
+    TariffArena arena;
+    EXPECT_EQ(arena.GetCapacity(), 0u);
+
+    auto * ids = static_cast<uint32_t *>(arena.Allocate(16, sizeof(uint32_t), alignof(uint32_t)));
+    ASSERT_NE(ids, nullptr);
+    for (size_t i = 0; i < 16; i++)
+    {
+        EXPECT_EQ(ids[i], 0u);
+    }
+    EXPECT_TRUE(arena.Contains(ids));
+
+    // Buffers keep the requested alignment after an odd-sized allocation
+    EXPECT_NE(arena.Allocate(1, 3, 1), nullptr);
+    auto * aligned = arena.Allocate(1, sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_NE(aligned, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % alignof(uint64_t), 0u);
+
+    // Buffers from the heap are not part of the arena and are still freed
+    void * heapBuffer = Platform::MemoryCalloc(1, 8);
+    EXPECT_FALSE(arena.Contains(heapBuffer));
+    TariffArena::FreeBuffer(&arena, heapBuffer);
+    TariffArena::FreeBuffer(&arena, ids); // No-op
+
+    // Outgrowing the first chunk adds a second one, coalesced into one by the reset
+    EXPECT_NE(arena.Allocate(1024, sizeof(uint32_t), alignof(uint32_t)), nullptr);
+    const size_t capacity = arena.GetCapacity();
+    arena.Reset();
+    EXPECT_EQ(arena.GetCapacity(), 0u);
+
+    auto * reused = arena.Allocate(1, sizeof(uint32_t), alignof(uint32_t));
+    ASSERT_NE(reused, nullptr);
+    EXPECT_EQ(arena.GetCapacity(), capacity);
+
+    // With a single chunk, the reset keeps it
+    arena.Reset();
+    EXPECT_EQ(arena.GetCapacity(), capacity);
+    EXPECT_EQ(arena.Allocate(1, sizeof(uint32_t), alignof(uint32_t)), reused);
+
+    arena.Release();
+    EXPECT_EQ(arena.GetCapacity(), 0u);
+    EXPECT_FALSE(arena.Contains(reused));
+}
+
+TEST_F(TestCommodityTariffBaseDataClass, LargeListUpdatesReuseArenas)
+{
+    constexpr size_t kEntryCount  = 1000;
+    constexpr size_t kUpdateCount = 10;
+
+    CTC_BaseDataClass<DataModel::List<uint32_t>> data(1);
+    uint32_t * source = static_cast<uint32_t *>(Platform::MemoryCalloc(kEntryCount, sizeof(uint32_t)));
+    ASSERT_NE(source, nullptr);
+
+    size_t settledCapacity = 0;
+    for (uint32_t update = 0; update < kUpdateCount; update++)
+    {
+        for (size_t i = 0; i < kEntryCount; i++)
+        {
+            source[i] = update * static_cast<uint32_t>(kEntryCount) + static_cast<uint32_t>(i);
+        }
+
+        EXPECT_EQ(data.SetNewValue(DataModel::List<uint32_t>(source, kEntryCount)), CHIP_NO_ERROR);
+        data.UpdateBegin(nullptr);
+        EXPECT_TRUE(data.UpdateFinish(true));
+
+        ASSERT_EQ(data.GetValue().size(), kEntryCount);
+        EXPECT_EQ(data.GetValue()[0], update * kEntryCount);
+        EXPECT_EQ(data.GetValue()[kEntryCount - 1], update * kEntryCount + kEntryCount - 1);
+
+        // Once both storage slots have held a value, updates no longer grow the arenas
+        if (update == 1)
+        {
+            settledCapacity = data.GetArenaCapacity();
+        }
+        else if (update > 1)
+        {
+            EXPECT_EQ(data.GetArenaCapacity(), settledCapacity);
+        }
+    }
+
+    // An aborted update leaves the arenas in place for the next one
+    EXPECT_EQ(data.SetNewValue(DataModel::List<uint32_t>(source, kEntryCount)), CHIP_NO_ERROR);
+    EXPECT_FALSE(data.UpdateFinish(false));
+    EXPECT_EQ(data.GetArenaCapacity(), settledCapacity);
+
+    data.Cleanup();
+    EXPECT_EQ(data.GetArenaCapacity(), 0u);
+    Platform::MemoryFree(source);
+}
+
 TEST_F(TestCommodityTariffBaseDataClass, ConcurrentReadAccess)
 {
     CTC_BaseDataClass<DataModel::Nullable<uint32_t>> data(2);
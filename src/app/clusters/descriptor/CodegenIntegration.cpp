@@ -40,6 +40,9 @@ namespace {
  * and init them in emberAfInit() with back to back calls in InitDataModelHandler(). For dynamic endpoints, we init endpoints in
  * emberAfSetDynamicEndpointWithEpUniqueId() by calling emberAfEndpointEnableDisable(), which calls initializeEndpoint(). The tag
  * list is a fixed attribute, but to maintain backwards compatiblility we get that information within the functions here.
+ *
+ * Ember reports endpoint changes straight to the reporting engine, so the PartsList kept by DescriptorCluster is dropped
+ * whenever the ember metadata structure generation (bumped on every endpoint enable/disable) moves on.
  */
 class EmberDescriptorCluster : public DescriptorCluster
 {
@@ -67,11 +70,17 @@ public:
             GetSemanticTagsForEndpoint(request.path.mEndpointId, mSemanticTags);
             mFetchedSemanticTags = true;
         }
+        if (const unsigned generation = emberAfMetadataStructureGeneration(); generation != mPartsListGeneration)
+        {
+            InvalidatePartsList();
+            mPartsListGeneration = generation;
+        }
         return DescriptorCluster::ReadAttribute(request, encoder);
     }
 
 private:
-    bool mFetchedSemanticTags = false;
+    bool mFetchedSemanticTags     = false;
+    unsigned mPartsListGeneration = emberAfMetadataStructureGeneration();
 };
 
 #if CHIP_CONFIG_SKIP_APP_SPECIFIC_GENERATED_HEADER_INCLUDES
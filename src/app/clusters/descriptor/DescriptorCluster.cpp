@@ -96,80 +96,103 @@ CHIP_ERROR ReadDeviceAttribute(DataModel::Provider & provider, EndpointId endpoi
     return err;
 }
 
-CHIP_ERROR ReadPartsAttribute(DataModel::Provider & provider, EndpointId endpoint, AttributeValueEncoder & aEncoder)
+/// Whether `ep` is in the PartsList of `endpointInfo`.
+bool IsPartOf(const DataModel::EndpointEntry & ep, const DataModel::EndpointEntry & endpointInfo,
+              Span<const DataModel::EndpointEntry> allEndpoints)
+{
+    if (endpointInfo.id == kRootEndpointId)
+    {
+        return ep.id != kRootEndpointId;
+    }
+
+    switch (endpointInfo.compositionPattern)
+    {
+    case DataModel::EndpointCompositionPattern::kFullFamily:
+        // ALL endpoints that have the specified endpoint as a descendant.
+        return IsDescendantOf(&ep, endpointInfo.id, allEndpoints);
+    case DataModel::EndpointCompositionPattern::kTree:
+        return ep.parentId == endpointInfo.id;
+    }
+    // not actually reachable and compiler will validate we
+    // handle all switch cases above
+    return false;
+}
+
+CHIP_ERROR ComputePartsList(DataModel::Provider & provider, EndpointId endpoint,
+                            Platform::ScopedMemoryBufferWithSize<EndpointId> & partsList)
 {
     ReadOnlyBufferBuilder<DataModel::EndpointEntry> endpointsList;
     ReturnErrorOnFailure(provider.Endpoints(endpointsList));
     auto endpoints = endpointsList.TakeBuffer();
-    if (endpoint == kRootEndpointId)
-    {
-        return aEncoder.EncodeList([&endpoints](const auto & encoder) -> CHIP_ERROR {
-            for (const auto & ep : endpoints)
-            {
-                if (ep.id == 0)
-                {
-                    continue;
-                }
-                ReturnErrorOnFailure(encoder.Encode(ep.id));
-            }
-            return CHIP_NO_ERROR;
-        });
-    }
 
     // find the given endpoint
-    unsigned idx = 0;
-    while (idx < endpoints.size())
+    const DataModel::EndpointEntry * endpointInfo = nullptr;
+    for (const auto & ep : endpoints)
     {
-        if (endpoints[idx].id == endpoint)
+        if (ep.id == endpoint)
         {
+            endpointInfo = &ep;
             break;
         }
-        idx++;
     }
-    if (idx >= endpoints.size())
+    // The root endpoint lists all others, even if the provider does not report it
+    const DataModel::EndpointEntry rootInfo{ .id                 = kRootEndpointId,
+                                             .parentId           = kInvalidEndpointId,
+                                             .compositionPattern = DataModel::EndpointCompositionPattern::kFullFamily };
+    if ((endpointInfo == nullptr) && (endpoint == kRootEndpointId))
     {
-        // not found
-        return CHIP_ERROR_NOT_FOUND;
+        endpointInfo = &rootInfo;
     }
+    VerifyOrReturnError(endpointInfo != nullptr, CHIP_ERROR_NOT_FOUND);
 
-    auto & endpointInfo = endpoints[idx];
-
-    switch (endpointInfo.compositionPattern)
+    size_t count = 0;
+    for (const auto & ep : endpoints)
     {
-    case DataModel::EndpointCompositionPattern::kFullFamily:
-        // encodes ALL endpoints that have the specified endpoint as a descendant.
-        return aEncoder.EncodeList([&endpoints, endpoint](const auto & encoder) -> CHIP_ERROR {
-            for (const auto & ep : endpoints)
-            {
-                if (IsDescendantOf(&ep, endpoint, endpoints))
-                {
-                    ReturnErrorOnFailure(encoder.Encode(ep.id));
-                }
-            }
-            return CHIP_NO_ERROR;
-        });
+        count += IsPartOf(ep, *endpointInfo, endpoints) ? 1 : 0;
+    }
 
-    case DataModel::EndpointCompositionPattern::kTree:
-        return aEncoder.EncodeList([&endpoints, endpoint](const auto & encoder) -> CHIP_ERROR {
-            for (const auto & ep : endpoints)
-            {
-                if (ep.parentId != endpoint)
-                {
-                    continue;
-                }
-                ReturnErrorOnFailure(encoder.Encode(ep.id));
-            }
-            return CHIP_NO_ERROR;
-        });
+    partsList.Free();
+    VerifyOrReturnError(count > 0, CHIP_NO_ERROR);
+    VerifyOrReturnError(partsList.Alloc(count).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    size_t idx = 0;
+    for (const auto & ep : endpoints)
+    {
+        if (IsPartOf(ep, *endpointInfo, endpoints))
+        {
+            partsList[idx++] = ep.id;
+        }
     }
-    // not actually reachable and compiler will validate we
-    // handle all switch cases above
     return CHIP_NO_ERROR;
 }
 
 } // namespace
 
 namespace chip::app::Clusters {
+void DescriptorCluster::Shutdown()
+{
+    InvalidatePartsList();
+    DefaultServerCluster::Shutdown();
+}
+
+CHIP_ERROR DescriptorCluster::GetPartsList(Span<const EndpointId> & partsList)
+{
+    if (!mPartsListValid)
+    {
+        VerifyOrReturnError(mContext != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        ReturnErrorOnFailure(ComputePartsList(mContext->provider, mPath.mEndpointId, mPartsList));
+        mPartsListValid = true;
+    }
+    partsList = mPartsList.Span();
+    return CHIP_NO_ERROR;
+}
+
+void DescriptorCluster::InvalidatePartsList()
+{
+    mPartsList.Free();
+    mPartsListValid = false;
+}
+
 CHIP_ERROR DescriptorCluster::Attributes(const ConcreteClusterPath & path,
                                          ReadOnlyBufferBuilder<DataModel::AttributeEntry> & builder)
 {
@@ -226,8 +249,17 @@ DataModel::ActionReturnStatus DescriptorCluster::ReadAttribute(const DataModel::
             return CHIP_NO_ERROR;
         });
     }
-    case PartsList::Id:
-        return ReadPartsAttribute(mContext->provider, request.path.mEndpointId, encoder);
+    case PartsList::Id: {
+        Span<const EndpointId> partsList;
+        ReturnErrorOnFailure(GetPartsList(partsList));
+        return encoder.EncodeList([&partsList](const auto & itemEncoder) -> CHIP_ERROR {
+            for (const auto & endpointId : partsList)
+            {
+                ReturnErrorOnFailure(itemEncoder.Encode(endpointId));
+            }
+            return CHIP_NO_ERROR;
+        });
+    }
     case TagList::Id:
         return ReadTagListAttribute(mSemanticTags, request.path.mEndpointId, encoder);
 #if CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
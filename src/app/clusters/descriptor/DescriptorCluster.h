@@ -23,6 +23,7 @@
 #include <clusters/Descriptor/ClusterId.h>
 #include <clusters/shared/Structs.h>
 #include <lib/support/BitFlags.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/Span.h>
 
 namespace chip::app::Clusters {
@@ -43,13 +44,31 @@ public:
         mSemanticTags(semanticTags)
     {}
 
+    void Shutdown() override;
+
     CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<DataModel::AttributeEntry> & builder) override;
     DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
                                                 AttributeValueEncoder & encoder) override;
 
+    /*
+     * The PartsList of the endpoint. It is computed from the endpoints of the provider on first use and kept until
+     * InvalidatePartsList is called. The span stays valid until then.
+     */
+    CHIP_ERROR GetPartsList(Span<const EndpointId> & partsList);
+
+    /*
+     * Drops the PartsList computed by GetPartsList. MUST be called whenever endpoints are added to or removed from the
+     * provider, so that the next read picks the change up.
+     */
+    void InvalidatePartsList();
+
 protected:
     OptionalAttributesSet mEnabledOptionalAttributes;
     Span<const SemanticTag> mSemanticTags;
+
+private:
+    Platform::ScopedMemoryBufferWithSize<EndpointId> mPartsList;
+    bool mPartsListValid = false;
 };
 
 } // namespace chip::app::Clusters
@@ -37,6 +37,17 @@ using namespace chip::app::Clusters;
 using namespace chip::app::Clusters::Descriptor::Attributes;
 using namespace chip::app::DataModel;
 
+class EndpointsProvider : public Testing::EmptyProvider
+{
+public:
+    CHIP_ERROR Endpoints(ReadOnlyBufferBuilder<EndpointEntry> & builder) override
+    {
+        return builder.ReferenceExisting(mEndpoints);
+    }
+
+    Span<const EndpointEntry> mEndpoints;
+};
+
 struct TestDescriptorCluster : public ::testing::Test
 {
     static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
@@ -68,4 +79,61 @@ TEST_F(TestDescriptorCluster, AttributesTest)
     ASSERT_TRUE(Testing::EqualAttributeSets(attributesBuilder.TakeBuffer(), expectedBuilder.TakeBuffer()));
 }
 
+TEST_F(TestDescriptorCluster, PartsListTest)
+{
+    const EndpointEntry endpoints[] = {
+        { .id = 0, .parentId = kInvalidEndpointId, .compositionPattern = EndpointCompositionPattern::kFullFamily },
+        { .id = 1, .parentId = kInvalidEndpointId, .compositionPattern = EndpointCompositionPattern::kTree },
+        { .id = 2, .parentId = 1, .compositionPattern = EndpointCompositionPattern::kFullFamily },
+        { .id = 3, .parentId = 2, .compositionPattern = EndpointCompositionPattern::kFullFamily },
+    };
+
+    chip::Testing::TestServerClusterContext testContext;
+    EndpointsProvider provider;
+    provider.mEndpoints = Span<const EndpointEntry>(endpoints);
+    ServerClusterContext context{ .provider           = provider,
+                                  .storage            = testContext.StorageDelegate(),
+                                  .attributeStorage   = testContext.AttributePersistenceProvider(),
+                                  .interactionContext = testContext.ImContext() };
+
+    DescriptorCluster root(0, DescriptorCluster::OptionalAttributesSet(0), {});
+    DescriptorCluster tree(1, DescriptorCluster::OptionalAttributesSet(0), {});
+    DescriptorCluster family(2, DescriptorCluster::OptionalAttributesSet(0), {});
+    ASSERT_EQ(root.Startup(context), CHIP_NO_ERROR);
+    ASSERT_EQ(tree.Startup(context), CHIP_NO_ERROR);
+    ASSERT_EQ(family.Startup(context), CHIP_NO_ERROR);
+
+    const EndpointId expectedRoot[]   = { 1, 2, 3 };
+    const EndpointId expectedTree[]   = { 2 };
+    const EndpointId expectedFamily[] = { 3 };
+
+    Span<const EndpointId> partsList;
+    ASSERT_EQ(root.GetPartsList(partsList), CHIP_NO_ERROR);
+    EXPECT_TRUE(partsList.data_equal(Span<const EndpointId>(expectedRoot)));
+    ASSERT_EQ(tree.GetPartsList(partsList), CHIP_NO_ERROR);
+    EXPECT_TRUE(partsList.data_equal(Span<const EndpointId>(expectedTree)));
+    ASSERT_EQ(family.GetPartsList(partsList), CHIP_NO_ERROR);
+    EXPECT_TRUE(partsList.data_equal(Span<const EndpointId>(expectedFamily)));
+
+    // The computed list is kept until invalidated.
+    provider.mEndpoints = Span<const EndpointEntry>(endpoints).SubSpan(0, 2);
+    ASSERT_EQ(root.GetPartsList(partsList), CHIP_NO_ERROR);
+    EXPECT_TRUE(partsList.data_equal(Span<const EndpointId>(expectedRoot)));
+
+    root.InvalidatePartsList();
+    ASSERT_EQ(root.GetPartsList(partsList), CHIP_NO_ERROR);
+    EXPECT_TRUE(partsList.data_equal(Span<const EndpointId>(expectedRoot).SubSpan(0, 1)));
+
+    tree.InvalidatePartsList();
+    ASSERT_EQ(tree.GetPartsList(partsList), CHIP_NO_ERROR);
+    EXPECT_TRUE(partsList.empty());
+
+    family.InvalidatePartsList();
+    EXPECT_EQ(family.GetPartsList(partsList), CHIP_ERROR_NOT_FOUND);
+
+    root.Shutdown();
+    tree.Shutdown();
+    family.Shutdown();
+}
+
 } // namespace
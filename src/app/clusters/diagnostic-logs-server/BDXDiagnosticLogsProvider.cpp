@@ -69,12 +69,21 @@ CHIP_ERROR BDXDiagnosticLogsProvider::InitializeTransfer(CommandHandler * comman
     auto transferExchangeCtx = exchangeMgr->NewContext(sessionHandle, this);
     VerifyOrReturnError(nullptr != transferExchangeCtx, CHIP_ERROR_NO_MEMORY);
 
+    // Several blocks can only be in flight on a session without MRP, so the windowed asynchronous mode is only offered
+    // over TCP. The requestor picks the mode.
     TransferSession::TransferInitData initOptions;
     initOptions.TransferCtlFlags = TransferControlFlags::kSenderDrive;
+    if (sessionHandle->AllowsLargePayload())
+    {
+        initOptions.TransferCtlFlags.Set(TransferControlFlags::kAsync);
+    }
     initOptions.MaxBlockSize     = kBdxMaxBlockSize;
     initOptions.FileDesLength    = static_cast<uint16_t>(fileDesignator.size());
     initOptions.FileDesignator   = Uint8::from_const_char(fileDesignator.data());
 
+    // Compression is only used if the requestor accepts it, and then fits more of the log in each block.
+    mTransfer.EnableCompression(true);
+
     CHIP_ERROR err = Initiator::InitiateTransfer(&DeviceLayer::SystemLayer(), TransferRole::kSender, initOptions, kBdxTimeout,
                                                  kBdxPollIntervalMs);
     if (CHIP_NO_ERROR != err)
@@ -89,6 +98,8 @@ CHIP_ERROR BDXDiagnosticLogsProvider::InitializeTransfer(CommandHandler * comman
     mFabricIndex.SetValue(fabricIndex);
     mPeerNodeId.SetValue(peerNodeId);
     mIsAcceptReceived   = false;
+    mIsEndOfLogSent     = false;
+    mUseLogChunks       = true;
     mLogSessionHandle   = logSessionHandle;
     mTimeStamp          = timeStamp;
     mTimeSinceBoot      = timeSinceBoot;
@@ -175,38 +186,77 @@ void BDXDiagnosticLogsProvider::OnAcceptReceived()
 
 void BDXDiagnosticLogsProvider::OnAckReceived()
 {
-    uint16_t blockSize = mTransfer.GetTransferBlockSize();
+    // In the asynchronous mode, the blocks sent before the BlockEOF may be acknowledged after it.
+    VerifyOrReturn(!mIsEndOfLogSent);
+
+    // Each block is sent as soon as it is prepared, so that no message received in between can replace the pending
+    // output of the transfer session. In the asynchronous mode, blocks are sent until the window is full.
+    do
+    {
+        VerifyOrReturn(PrepareNextBlock());
 
-    auto blockBuf = System::PacketBufferHandle::New(blockSize);
-    VerifyOrReturn(!blockBuf.IsNull(),
-                   TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(GetBdxStatusCodeFromChipError(CHIP_ERROR_NO_MEMORY)));
+        TransferSession::OutputEvent event;
+        mTransfer.PollOutput(event, System::SystemClock().GetMonotonicTimestamp());
+        HandleTransferSessionOutput(event);
+    } while (mInitialized && !mIsEndOfLogSent && mTransfer.GetControlMode() == TransferControlFlags::kAsync &&
+             mTransfer.CanPrepareBlock());
+}
 
-    auto buffer     = MutableByteSpan(blockBuf->Start(), blockSize);
+bool BDXDiagnosticLogsProvider::PrepareNextBlock()
+{
+    uint16_t blockSize = mTransfer.GetBlockDataSize();
+    ByteSpan block;
     bool isEndOfLog = false;
+    CHIP_ERROR err  = CHIP_ERROR_NOT_IMPLEMENTED;
 
     // Get the log next chunk and see if it fits i.e. if is end of log is reported
-    auto err = mDelegate->CollectLog(mLogSessionHandle, buffer, isEndOfLog);
-    VerifyOrReturn(CHIP_NO_ERROR == err, TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(GetBdxStatusCodeFromChipError(err)));
+    if (mUseLogChunks)
+    {
+        err           = mDelegate->GetNextLogChunk(mLogSessionHandle, blockSize, block, isEndOfLog);
+        mUseLogChunks = (err != CHIP_ERROR_NOT_IMPLEMENTED);
+    }
+    if (!mUseLogChunks)
+    {
+        if (mBlockBuffer.IsNull())
+        {
+            mBlockBuffer = System::PacketBufferHandle::New(blockSize);
+        }
+        VerifyOrReturnValue(!mBlockBuffer.IsNull(), false,
+                            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(GetBdxStatusCodeFromChipError(CHIP_ERROR_NO_MEMORY)));
+
+        auto buffer = MutableByteSpan(mBlockBuffer->Start(), blockSize);
+        err         = mDelegate->CollectLog(mLogSessionHandle, buffer, isEndOfLog);
+        block       = buffer;
+    }
+    VerifyOrReturnValue(CHIP_NO_ERROR == err, false,
+                        TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(GetBdxStatusCodeFromChipError(err)));
+    VerifyOrReturnValue(block.size() <= blockSize, false,
+                        TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(GetBdxStatusCodeFromChipError(CHIP_ERROR_INTERNAL)));
+
+    // Prepare the BDX block to send to the requestor. A chunk of the delegate must be copied before the log collection ends.
+    TransferSession::BlockData blockData;
+    blockData.Data   = block.data();
+    blockData.Length = block.size();
+    blockData.IsEof  = isEndOfLog;
+
+    err = mTransfer.PrepareBlock(blockData);
 
     // If the buffer has empty space, end the log collection session.
     if (isEndOfLog)
     {
         TEMPORARY_RETURN_IGNORED mDelegate->EndLogCollection(mLogSessionHandle, CHIP_ERROR_INTERNAL);
         mLogSessionHandle = kInvalidLogSessionHandle;
+        mIsEndOfLogSent   = true;
+        mBlockBuffer      = nullptr;
     }
 
-    // Prepare the BDX block to send to the requestor
-    TransferSession::BlockData blockData;
-    blockData.Data   = blockBuf->Start();
-    blockData.Length = static_cast<size_t>(buffer.size());
-    blockData.IsEof  = isEndOfLog;
-
-    err = mTransfer.PrepareBlock(blockData);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
         TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(GetBdxStatusCodeFromChipError(err));
+        return false;
     }
+    return true;
 }
 
 void BDXDiagnosticLogsProvider::OnAckEOFReceived()
@@ -286,7 +336,9 @@ void BDXDiagnosticLogsProvider::Reset(CHIP_ERROR error)
     mFabricIndex.ClearValue();
     mPeerNodeId.ClearValue();
     mIsAcceptReceived = false;
+    mIsEndOfLogSent   = false;
     mLogSessionHandle = kInvalidLogSessionHandle;
+    mBlockBuffer      = nullptr;
     mTimeStamp.ClearValue();
     mTimeSinceBoot.ClearValue();
     mAsyncCommandHandle = nullptr;
@@ -294,6 +346,19 @@ void BDXDiagnosticLogsProvider::Reset(CHIP_ERROR error)
     mInitialized        = false;
 }
 
+CHIP_ERROR BDXDiagnosticLogsProvider::OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                                        System::PacketBufferHandle && payload)
+{
+    CHIP_ERROR err = Initiator::OnMessageReceived(ec, payloadHeader, std::move(payload));
+
+    // Handle the resulting output right away instead of at the next poll, which would add up to a poll interval per block.
+    if (mSystemLayer != nullptr)
+    {
+        ScheduleImmediatePoll();
+    }
+    return err;
+}
+
 void BDXDiagnosticLogsProvider::OnExchangeClosing(Messaging::ExchangeContext * ec)
 {
     mBDXTransferExchangeCtx = nullptr;
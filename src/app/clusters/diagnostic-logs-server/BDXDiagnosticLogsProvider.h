@@ -63,9 +63,13 @@ public:
     void OnExchangeClosing(Messaging::ExchangeContext * ec) override;
 
 private:
+    CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && payload) override;
+
     void OnMsgToSend(bdx::TransferSession::OutputEvent & event);
     void OnAcceptReceived();
     void OnAckReceived();
+    bool PrepareNextBlock();
     void OnAckEOFReceived();
     void OnStatusReceived(bdx::TransferSession::OutputEvent & event);
     void OnInternalError();
@@ -86,7 +90,11 @@ private:
     Optional<FabricIndex> mFabricIndex;
     Optional<NodeId> mPeerNodeId;
     bool mIsAcceptReceived             = false;
+    bool mIsEndOfLogSent               = false;
+    bool mUseLogChunks                 = true;
     LogSessionHandle mLogSessionHandle = kInvalidLogSessionHandle;
+    // Block buffer reused for the whole transfer when the delegate only implements CollectLog().
+    System::PacketBufferHandle mBlockBuffer;
     Optional<uint64_t> mTimeStamp;
     Optional<uint64_t> mTimeSinceBoot;
     CommandHandler::Handle mAsyncCommandHandle;
@@ -99,6 +99,24 @@ public:
      */
     virtual CHIP_ERROR CollectLog(LogSessionHandle sessionHandle, MutableByteSpan & outBuffer, bool & outIsEndOfLog) = 0;
 
+    /**
+     * Called to get the next chunk for the log session identified by sessionHandle without copying it, for delegates
+     * that can expose their logs in place (e.g. ring buffers or memory-mapped files). The chunk must remain valid until
+     * the next call for the same session or until the log collection ends.
+     *
+     * BDX transfers use this method rather than CollectLog() when it is implemented, which saves a copy of every block.
+     *
+     * @param[in] sessionHandle   The unique handle for this log session returned from a call to StartLogCollection.
+     * @param[in] maxLength       The largest chunk the caller can take.
+     * @param[out] outChunk       Set to the next chunk of the log, of at most maxLength bytes.
+     * @param[out] outIsEndOfLog  Set to true if there is no more log data after outChunk otherwise set to false.
+     * @return CHIP_ERROR_NOT_IMPLEMENTED by default unless overridden, in which case CollectLog() is used.
+     */
+    virtual CHIP_ERROR GetNextLogChunk(LogSessionHandle sessionHandle, size_t maxLength, ByteSpan & outChunk, bool & outIsEndOfLog)
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
     /**
      * Called to get the file size for the log type passed in.
      *
@@ -47,6 +47,7 @@ public:
     CHIP_ERROR Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder) override;
 
     void MarkNodeListChanged() override;
+    void MarkListChanged(AttributeId attributeId) override;
 
 private:
     CHIP_ERROR ReadAnchorRootCA(AttributeValueEncoder & aEncoder);
@@ -153,9 +154,9 @@ CHIP_ERROR JointFabricDatastoreAttrAccess::ReadFriendlyName(AttributeValueEncode
 CHIP_ERROR JointFabricDatastoreAttrAccess::ReadGroupKeySetList(AttributeValueEncoder & aEncoder)
 {
     return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
-        auto entries = Server::GetInstance().GetJointFabricDatastore().GetGroupKeySetList();
+        const auto & entries = Server::GetInstance().GetJointFabricDatastore().GetGroupKeySetList();
 
-        for (auto & entry : entries)
+        for (const auto & entry : entries)
         {
             ReturnErrorOnFailure(encoder.Encode(entry));
         }
@@ -166,9 +167,9 @@ CHIP_ERROR JointFabricDatastoreAttrAccess::ReadGroupKeySetList(AttributeValueEnc
 CHIP_ERROR JointFabricDatastoreAttrAccess::ReadGroupList(AttributeValueEncoder & aEncoder)
 {
     return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
-        auto entries = Server::GetInstance().GetJointFabricDatastore().GetGroupEntries();
+        const auto & entries = Server::GetInstance().GetJointFabricDatastore().GetGroupEntries();
 
-        for (auto & entry : entries)
+        for (const auto & entry : entries)
         {
             ReturnErrorOnFailure(encoder.Encode(entry));
         }
@@ -179,9 +180,9 @@ CHIP_ERROR JointFabricDatastoreAttrAccess::ReadGroupList(AttributeValueEncoder &
 CHIP_ERROR JointFabricDatastoreAttrAccess::ReadNodeList(AttributeValueEncoder & aEncoder)
 {
     return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
-        auto entries = Server::GetInstance().GetJointFabricDatastore().GetNodeInformationEntries();
+        const auto & entries = Server::GetInstance().GetJointFabricDatastore().GetNodeInformationEntries();
 
-        for (auto & entry : entries)
+        for (const auto & entry : entries)
         {
             ReturnErrorOnFailure(encoder.Encode(entry));
         }
@@ -192,9 +193,9 @@ CHIP_ERROR JointFabricDatastoreAttrAccess::ReadNodeList(AttributeValueEncoder &
 CHIP_ERROR JointFabricDatastoreAttrAccess::ReadAdminList(AttributeValueEncoder & aEncoder)
 {
     return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
-        auto entries = Server::GetInstance().GetJointFabricDatastore().GetAdminEntries();
+        const auto & entries = Server::GetInstance().GetJointFabricDatastore().GetAdminEntries();
 
-        for (auto & entry : entries)
+        for (const auto & entry : entries)
         {
             ReturnErrorOnFailure(encoder.Encode(entry));
         }
@@ -211,9 +212,9 @@ CHIP_ERROR JointFabricDatastoreAttrAccess::ReadStatus(AttributeValueEncoder & aE
 CHIP_ERROR JointFabricDatastoreAttrAccess::ReadEndpointGroupIDList(AttributeValueEncoder & aEncoder)
 {
     return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
-        auto entries = Server::GetInstance().GetJointFabricDatastore().GetEndpointGroupIDList();
+        const auto & entries = Server::GetInstance().GetJointFabricDatastore().GetEndpointGroupIDList();
 
-        for (auto & entry : entries)
+        for (const auto & entry : entries)
         {
             ReturnErrorOnFailure(encoder.Encode(entry));
         }
@@ -224,9 +225,9 @@ CHIP_ERROR JointFabricDatastoreAttrAccess::ReadEndpointGroupIDList(AttributeValu
 CHIP_ERROR JointFabricDatastoreAttrAccess::ReadEndpointBindingList(AttributeValueEncoder & aEncoder)
 {
     return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
-        auto entries = Server::GetInstance().GetJointFabricDatastore().GetEndpointBindingList();
+        const auto & entries = Server::GetInstance().GetJointFabricDatastore().GetEndpointBindingList();
 
-        for (auto & entry : entries)
+        for (const auto & entry : entries)
         {
             ReturnErrorOnFailure(encoder.Encode(entry));
         }
@@ -237,9 +238,9 @@ CHIP_ERROR JointFabricDatastoreAttrAccess::ReadEndpointBindingList(AttributeValu
 CHIP_ERROR JointFabricDatastoreAttrAccess::ReadNodeKeySetList(AttributeValueEncoder & aEncoder)
 {
     return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
-        auto entries = Server::GetInstance().GetJointFabricDatastore().GetNodeKeySetList();
+        const auto & entries = Server::GetInstance().GetJointFabricDatastore().GetNodeKeySetList();
 
-        for (auto & entry : entries)
+        for (const auto & entry : entries)
         {
             ReturnErrorOnFailure(encoder.Encode(entry));
         }
@@ -250,9 +251,9 @@ CHIP_ERROR JointFabricDatastoreAttrAccess::ReadNodeKeySetList(AttributeValueEnco
 CHIP_ERROR JointFabricDatastoreAttrAccess::ReadNodeACLList(AttributeValueEncoder & aEncoder)
 {
     return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
-        auto entries = Server::GetInstance().GetJointFabricDatastore().GetNodeACLList();
+        const auto & entries = Server::GetInstance().GetJointFabricDatastore().GetNodeACLList();
 
-        for (auto & entry : entries)
+        for (const auto & entry : entries)
         {
             Clusters::JointFabricDatastore::Structs::DatastoreACLEntryStruct::Type entryToEncode;
             entryToEncode.nodeID             = entry.nodeID;
@@ -274,9 +275,9 @@ CHIP_ERROR JointFabricDatastoreAttrAccess::ReadNodeACLList(AttributeValueEncoder
 CHIP_ERROR JointFabricDatastoreAttrAccess::ReadNodeEndpointList(AttributeValueEncoder & aEncoder)
 {
     return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
-        auto entries = Server::GetInstance().GetJointFabricDatastore().GetNodeEndpointList();
+        const auto & entries = Server::GetInstance().GetJointFabricDatastore().GetNodeEndpointList();
 
-        for (auto & entry : entries)
+        for (const auto & entry : entries)
         {
             ReturnErrorOnFailure(encoder.Encode(entry));
         }
@@ -290,6 +291,11 @@ void JointFabricDatastoreAttrAccess::MarkNodeListChanged()
                                            JointFabricDatastoreCluster::Attributes::NodeList::Id);
 }
 
+void JointFabricDatastoreAttrAccess::MarkListChanged(AttributeId attributeId)
+{
+    MatterReportingAttributeChangeCallback(kRootEndpointId, JointFabricDatastoreCluster::Id, attributeId);
+}
+
 bool emberAfJointFabricDatastoreClusterAddKeySetCallback(
     CommandHandler * commandObj, const ConcreteCommandPath & commandPath,
     const JointFabricDatastoreCluster::Commands::AddKeySet::DecodableType & commandData)
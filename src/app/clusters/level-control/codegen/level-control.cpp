@@ -26,6 +26,7 @@
 #include <app/CommandHandler.h>
 #include <app/ConcreteCommandPath.h>
 #include <app/cluster-building-blocks/QuieterReporting.h>
+#include <app/cluster-building-blocks/TransitionTicker.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/config.h>
 #include <app/util/util.h>
@@ -310,8 +311,14 @@ static uint32_t computeCallbackWaitTimeMs(CallbackScheduleState & callbackSchedu
 
 static void scheduleTimerCallbackMs(EndpointId endpoint, uint32_t delayMs)
 {
+#if CHIP_CONFIG_TRANSITION_TICKER
+    CHIP_ERROR err = TransitionTicker::Instance().Schedule(DeviceLayer::SystemLayer(), chip::System::Clock::Milliseconds32(delayMs),
+                                                           timerCallback,
+                                                           reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+#else
     CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback,
                                                            reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+#endif // CHIP_CONFIG_TRANSITION_TICKER
 
     if (err != CHIP_NO_ERROR)
     {
@@ -321,7 +328,12 @@ static void scheduleTimerCallbackMs(EndpointId endpoint, uint32_t delayMs)
 
 static void cancelEndpointTimerCallback(EndpointId endpoint)
 {
+#if CHIP_CONFIG_TRANSITION_TICKER
+    TransitionTicker::Instance().Cancel(DeviceLayer::SystemLayer(), timerCallback,
+                                        reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+#else
     DeviceLayer::SystemLayer().CancelTimer(timerCallback, reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+#endif // CHIP_CONFIG_TRANSITION_TICKER
 }
 
 static EmberAfLevelControlState * getState(EndpointId endpoint)
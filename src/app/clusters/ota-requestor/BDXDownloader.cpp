@@ -99,6 +99,8 @@ CHIP_ERROR BDXDownloader::SetBDXParams(const chip::bdx::TransferSession::Transfe
     mTimeout = timeout;
     mState   = State::kIdle;
     mBdxTransfer.Reset();
+    // Only used if the provider accepts to compress the image.
+    mBdxTransfer.EnableCompression(true);
 
     VerifyOrReturnError(mState == State::kIdle, CHIP_ERROR_INCORRECT_STATE);
 
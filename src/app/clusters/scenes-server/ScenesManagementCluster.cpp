@@ -24,6 +24,7 @@
 #include <app/CommandHandlerInterface.h>
 #include <app/CommandHandlerInterfaceRegistry.h>
 #include <app/InteractionModelEngine.h>
+#include <app/cluster-building-blocks/TransitionTicker.h>
 #include <app/clusters/scenes-server/SceneTableImpl.h>
 #include <app/reporting/reporting.h>
 #include <app/server/Server.h>
@@ -627,7 +628,13 @@ CHIP_ERROR RecallSceneParse(const FabricIndex & fabricIdx, const EndpointId & en
         }
     }
 
-    ReturnErrorOnFailure(sceneTable->SceneApplyEFS(scene));
+    {
+#if CHIP_CONFIG_TRANSITION_TICKER
+        // The transitions of all the clusters of the scene start at the same tick
+        TransitionTicker::Batch transitionBatch;
+#endif // CHIP_CONFIG_TRANSITION_TICKER
+        ReturnErrorOnFailure(sceneTable->SceneApplyEFS(scene));
+    }
 
     // Update FabricSceneInfo, at this point the scene is considered valid
     ReturnErrorOnFailure(
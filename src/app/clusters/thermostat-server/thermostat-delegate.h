@@ -64,7 +64,8 @@ public:
     virtual uint8_t GetNumberOfPresets() = 0;
 
     /**
-     * @brief Get the preset at a given index in the Presets attribute.
+     * @brief Get the preset at a given index in the Presets attribute. The server caches the presets it got: when they change
+     *        other than by CommitPendingPresets, PresetsChanged must be called for the endpoint.
      *
      * @param[in] index The index of the preset in the list.
      * @param[out] preset The PresetStructWithOwnedMembers struct that has the data from the preset
@@ -544,6 +544,8 @@ void ThermostatAttrAccess::CommitAtomicWrite(CommandHandler * commandObj, const
             {
             case Presets::Id:
                 err = delegate->CommitPendingPresets();
+                // A failed commit may still have updated some of the presets.
+                InvalidatePresetsCache(endpoint);
                 if (err != CHIP_NO_ERROR)
                 {
                     statusCode = Status::InvalidInState;
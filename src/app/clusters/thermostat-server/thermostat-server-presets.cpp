@@ -18,8 +18,15 @@
 #include "thermostat-server-presets.h"
 #include "thermostat-server.h"
 
+#include <app/data-model/Encode.h>
+#include <app/reporting/reporting.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/ScopedBuffer.h>
 #include <platform/internal/CHIPDeviceLayerInternal.h>
 
+#include <algorithm>
+#include <cstring>
+
 using namespace chip;
 using namespace chip::app;
 using namespace chip::app::Clusters;
@@ -63,56 +70,102 @@ bool IsBuiltIn(const PresetStructWithOwnedMembers & preset)
     return preset.GetBuiltIn().ValueOr(false);
 }
 
+// Control bytes, tags, lengths and fixed-size fields of an encoded PresetStruct, plus its handle and name.
+constexpr size_t kMaxEncodedPresetSize = 32 + kPresetHandleSize + kPresetNameSize;
+
 /**
- * @brief Checks if the presets are matching i.e the presetHandles are the same.
- *
- * @param[in] preset The preset to check.
- * @param[in] presetToMatch The preset to match with.
- *
- * @return true If the presets match, false otherwise. If both preset handles are null, returns false
+ * @brief FNV-1a hash of a preset handle.
  */
-bool PresetHandlesExistAndMatch(const PresetStructWithOwnedMembers & preset, const PresetStructWithOwnedMembers & presetToMatch)
+uint32_t HashPresetHandle(const ByteSpan & presetHandle)
 {
-    return !preset.GetPresetHandle().IsNull() && !presetToMatch.GetPresetHandle().IsNull() &&
-        preset.GetPresetHandle().Value().data_equal(presetToMatch.GetPresetHandle().Value());
+    uint32_t hash = 2166136261u;
+    for (uint8_t byte : presetHandle)
+    {
+        hash = (hash ^ byte) * 16777619u;
+    }
+    return hash;
 }
 
 /**
- * @brief Finds an entry in the pending presets list that matches a preset.
- *        The presetHandle of the two presets must match.
- *
- * @param[in] delegate The delegate to use.
- * @param[in] presetToMatch The preset to match with.
- *
- * @return true if a matching entry was found in the pending presets list, false otherwise.
+ * @brief The preset handles in the pending presets list, indexed by hash. Built once when committing the pending presets, so
+ *        that the presets checked against the pending presets list are looked up instead of walking it for each of them.
  */
-bool MatchingPendingPresetExists(Delegate * delegate, const PresetStructWithOwnedMembers & presetToMatch)
+class PendingPresetHandleIndex
 {
-    VerifyOrReturnValue(delegate != nullptr, false);
-
-    for (uint8_t i = 0; true; i++)
+public:
+    /**
+     * @brief Indexes the preset handles in the pending presets list of the delegate.
+     *
+     * @param[in] delegate The delegate to use.
+     * @return CHIP_NO_ERROR if all the pending presets were indexed, an error otherwise.
+     */
+    CHIP_ERROR Init(Delegate * delegate)
     {
         PresetStructWithOwnedMembers preset;
-        CHIP_ERROR err = delegate->GetPendingPresetAtIndex(i, preset);
-
-        if (err == CHIP_ERROR_PROVIDER_LIST_EXHAUSTED)
+        size_t count = 0;
+        for (;; count++)
         {
-            break;
+            CHIP_ERROR err = delegate->GetPendingPresetAtIndex(count, preset);
+            if (err == CHIP_ERROR_PROVIDER_LIST_EXHAUSTED)
+            {
+                break;
+            }
+            ReturnErrorOnFailure(err);
         }
-        if (err != CHIP_NO_ERROR)
+        VerifyOrReturnError(mEntries.Calloc(std::max<size_t>(count, 1)), CHIP_ERROR_NO_MEMORY);
+
+        mCount = 0;
+        for (size_t i = 0; i < count; i++)
         {
-            ChipLogError(Zcl, "MatchingPendingPresetExists: GetPendingPresetAtIndex failed with error %" CHIP_ERROR_FORMAT,
-                         err.Format());
-            return false;
+            ReturnErrorOnFailure(delegate->GetPendingPresetAtIndex(i, preset));
+            if (preset.GetPresetHandle().IsNull())
+            {
+                continue;
+            }
+
+            // SetPresetHandle keeps handles within kPresetHandleSize.
+            const ByteSpan presetHandle = preset.GetPresetHandle().Value();
+            Entry & entry               = mEntries[mCount++];
+            entry.hash                  = HashPresetHandle(presetHandle);
+            entry.length                = static_cast<uint8_t>(presetHandle.size());
+            memcpy(entry.handle, presetHandle.data(), presetHandle.size());
         }
 
-        if (PresetHandlesExistAndMatch(preset, presetToMatch))
+        std::sort(mEntries.Get(), mEntries.Get() + mCount, [](const Entry & a, const Entry & b) { return a.hash < b.hash; });
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * @brief Returns the count of preset entries in the pending presets list that have the matching presetHandle.
+     */
+    size_t Count(const ByteSpan & presetHandle) const
+    {
+        const uint32_t hash = HashPresetHandle(presetHandle);
+        const Entry * entry = std::lower_bound(mEntries.Get(), mEntries.Get() + mCount, hash,
+                                               [](const Entry & e, uint32_t h) { return e.hash < h; });
+
+        size_t count = 0;
+        for (; entry != mEntries.Get() + mCount && entry->hash == hash; entry++)
         {
-            return true;
+            if (ByteSpan(entry->handle, entry->length).data_equal(presetHandle))
+            {
+                count++;
+            }
         }
+        return count;
     }
-    return false;
-}
+
+private:
+    struct Entry
+    {
+        uint32_t hash;
+        uint8_t length;
+        uint8_t handle[kPresetHandleSize];
+    };
+
+    Platform::ScopedMemoryBuffer<Entry> mEntries;
+    size_t mCount = 0;
+};
 
 /**
  * @brief Finds and returns an entry in the Presets attribute list that matches
@@ -449,7 +502,13 @@ Status ThermostatAttrAccess::PrecommitPresets(EndpointId endpoint)
         return Status::InvalidInState;
     }
 
-    CHIP_ERROR err = CHIP_NO_ERROR;
+    PendingPresetHandleIndex pendingPresetHandles;
+    CHIP_ERROR err = pendingPresetHandles.Init(delegate);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "PrecommitPresets: failed to index the pending presets with error %" CHIP_ERROR_FORMAT, err.Format());
+        return Status::InvalidInState;
+    }
 
     // For each preset in the presets attribute, check that the matching preset in the pending presets list does not
     // violate any spec constraints.
@@ -471,7 +530,7 @@ Status ThermostatAttrAccess::PrecommitPresets(EndpointId endpoint)
             return Status::InvalidInState;
         }
 
-        bool found = MatchingPendingPresetExists(delegate, preset);
+        bool found = !preset.GetPresetHandle().IsNull() && pendingPresetHandles.Count(preset.GetPresetHandle().Value()) > 0;
 
         // If a built in preset in the Presets attribute list is removed and not found in the pending presets list, return
         // CONSTRAINT_ERROR.
@@ -497,8 +556,7 @@ Status ThermostatAttrAccess::PrecommitPresets(EndpointId endpoint)
 
     if (!activePresetHandle.IsNull())
     {
-        uint8_t count = CountPresetsInPendingListWithPresetHandle(delegate, activePresetHandle.Value());
-        if (count == 0)
+        if (pendingPresetHandles.Count(activePresetHandle.Value()) == 0)
         {
             return Status::InvalidInState;
         }
@@ -541,6 +599,71 @@ Status ThermostatAttrAccess::PrecommitPresets(EndpointId endpoint)
     return Status::Success;
 }
 
+const ThermostatAttrAccess::PresetsCache * ThermostatAttrAccess::GetPresetsCache(EndpointId endpoint, Delegate * delegate)
+{
+    uint16_t ep =
+        emberAfGetClusterServerEndpointIndex(endpoint, Thermostat::Id, MATTER_DM_THERMOSTAT_CLUSTER_SERVER_ENDPOINT_COUNT);
+    VerifyOrReturnValue(ep < MATTER_ARRAY_SIZE(mPresetsCaches), nullptr);
+
+    PresetsCache & cache = mPresetsCaches[ep];
+    if (cache.delegate == delegate && cache.encodedPresets.Get() != nullptr)
+    {
+        return &cache;
+    }
+    InvalidatePresetsCache(endpoint);
+
+    // The Presets attribute never holds more than NumberOfPresets presets; more are left uncached.
+    const size_t maxCount = delegate->GetNumberOfPresets();
+    Platform::ScopedMemoryBufferWithSize<uint8_t> buffer;
+    Platform::ScopedMemoryBufferWithSize<uint16_t> presetOffsets;
+    VerifyOrReturnValue(buffer.Alloc(std::max<size_t>(maxCount, 1) * kMaxEncodedPresetSize), nullptr);
+    VerifyOrReturnValue(presetOffsets.Calloc(std::max<size_t>(maxCount, 1)), nullptr);
+
+    TLV::TLVWriter writer;
+    writer.Init(buffer.Get(), buffer.AllocatedSize());
+    size_t count = 0;
+    for (size_t i = 0; true; i++)
+    {
+        PresetStructWithOwnedMembers preset;
+        CHIP_ERROR err = delegate->GetPresetAtIndex(i, preset);
+        if (err == CHIP_ERROR_PROVIDER_LIST_EXHAUSTED)
+        {
+            break;
+        }
+        VerifyOrReturnValue(err == CHIP_NO_ERROR && count < maxCount, nullptr);
+
+        presetOffsets[count++] = static_cast<uint16_t>(writer.GetLengthWritten());
+        VerifyOrReturnValue(DataModel::Encode(writer, TLV::AnonymousTag(), preset) == CHIP_NO_ERROR, nullptr);
+    }
+    VerifyOrReturnValue(writer.Finalize() == CHIP_NO_ERROR, nullptr);
+
+    // Keep only what was written.
+    VerifyOrReturnValue(cache.encodedPresets.Alloc(std::max<size_t>(writer.GetLengthWritten(), 1)), nullptr);
+    VerifyOrReturnValue(cache.presetOffsets.Alloc(count), nullptr, cache.encodedPresets.Free());
+    memcpy(cache.encodedPresets.Get(), buffer.Get(), writer.GetLengthWritten());
+    memcpy(cache.presetOffsets.Get(), presetOffsets.Get(), count * sizeof(uint16_t));
+    cache.delegate = delegate;
+    return &cache;
+}
+
+void ThermostatAttrAccess::InvalidatePresetsCache(EndpointId endpoint)
+{
+    uint16_t ep =
+        emberAfGetClusterServerEndpointIndex(endpoint, Thermostat::Id, MATTER_DM_THERMOSTAT_CLUSTER_SERVER_ENDPOINT_COUNT);
+    VerifyOrReturn(ep < MATTER_ARRAY_SIZE(mPresetsCaches));
+
+    PresetsCache & cache = mPresetsCaches[ep];
+    cache.delegate       = nullptr;
+    cache.encodedPresets.Free();
+    cache.presetOffsets.Free();
+}
+
+void PresetsChanged(EndpointId endpoint)
+{
+    gThermostatAttrAccess.InvalidatePresetsCache(endpoint);
+    MatterReportingAttributeChangeCallback(endpoint, Thermostat::Id, Presets::Id);
+}
+
 bool emberAfThermostatClusterSetActivePresetRequestCallback(CommandHandler * commandObj, const ConcreteCommandPath & commandPath,
                                                             const Commands::SetActivePresetRequest::DecodableType & commandData)
 {
@@ -27,6 +27,7 @@
 #include <app/CommandHandler.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/ConcreteCommandPath.h>
+#include <app/data-model/PreEncodedValue.h>
 #include <app/server/Server.h>
 #include <app/util/endpoint-config-api.h>
 #include <clusters/Thermostat/Metadata.h>
@@ -603,6 +604,20 @@ CHIP_ERROR ThermostatAttrAccess::Read(const ConcreteReadAttributePath & aPath, A
                 }
             });
         }
+
+        const PresetsCache * presetsCache = GetPresetsCache(aPath.mEndpointId, delegate);
+        if (presetsCache != nullptr)
+        {
+            return aEncoder.EncodeList([presetsCache](const auto & encoder) -> CHIP_ERROR {
+                const ByteSpan encodedPresets(presetsCache->encodedPresets.Get(), presetsCache->encodedPresets.AllocatedSize());
+                for (size_t i = 0; i < presetsCache->presetOffsets.AllocatedSize(); i++)
+                {
+                    DataModel::PreEncodedValue preset(encodedPresets.SubSpan(presetsCache->presetOffsets[i]));
+                    ReturnErrorOnFailure(encoder.Encode(preset));
+                }
+                return CHIP_NO_ERROR;
+            });
+        }
         return aEncoder.EncodeList([delegate](const auto & encoder) -> CHIP_ERROR {
             for (uint8_t i = 0; true; i++)
             {
@@ -83,6 +83,34 @@ private:
      */
     Protocols::InteractionModel::Status PrecommitPresets(EndpointId endpoint);
 
+    /**
+     * @brief The Presets attribute of an endpoint as last read from its delegate, encoded as one anonymous TLV structure per
+     *        preset so that reads copy the encoded presets instead of getting and encoding each of them again
+     */
+    struct PresetsCache
+    {
+        Delegate * delegate = nullptr;
+        Platform::ScopedMemoryBufferWithSize<uint8_t> encodedPresets;
+        // Start of each preset in encodedPresets.
+        Platform::ScopedMemoryBufferWithSize<uint16_t> presetOffsets;
+    };
+
+    /**
+     * @brief Gets the presets cache of the endpoint, filled from the delegate if it is empty or was filled by another delegate
+     *
+     * @param endpoint The endpoint
+     * @param delegate The current ThermostatDelegate
+     * @return The presets cache, or nullptr if the presets could not be cached
+     */
+    const PresetsCache * GetPresetsCache(EndpointId endpoint, Delegate * delegate);
+
+    /**
+     * @brief Drops the presets cache of the endpoint, for the Presets attribute to be read from the delegate again
+     *
+     * @param endpoint The endpoint
+     */
+    void InvalidatePresetsCache(EndpointId endpoint);
+
     /**
      * @brief Callback for when the server is removed from a given fabric; all associated atomic writes are reset
      *
@@ -206,6 +234,8 @@ private:
 
     friend void TimerExpiredCallback(System::Layer * systemLayer, void * callbackContext);
 
+    friend void PresetsChanged(EndpointId endpoint);
+
     friend void MatterThermostatClusterServerShutdownCallback(EndpointId endpoint);
     friend void MatterThermostatClusterServerAttributeChangedCallback(const chip::app::ConcreteAttributePath & attributePath);
 
@@ -234,6 +264,7 @@ private:
     };
 
     AtomicWriteSession mAtomicWriteSessions[kThermostatEndpointCount];
+    PresetsCache mPresetsCaches[kThermostatEndpointCount];
 };
 
 /**
@@ -246,6 +277,15 @@ void SetDefaultDelegate(EndpointId endpoint, Delegate * delegate);
 
 Delegate * GetDelegate(EndpointId endpoint);
 
+/**
+ * @brief Signals that the presets of the delegate on the endpoint changed outside of an atomic write (e.g. on a factory
+ *        reset). The Presets attribute is read from a cache of the presets last got from the delegate, which this drops,
+ *        and is reported as changed.
+ *
+ * @param[in] endpoint The endpoint whose presets changed.
+ */
+void PresetsChanged(EndpointId endpoint);
+
 } // namespace Thermostat
 } // namespace Clusters
 } // namespace app
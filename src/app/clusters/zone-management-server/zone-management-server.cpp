@@ -30,6 +30,7 @@
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <protocols/interaction_model/StatusCode.h>
 
+#include <cinttypes>
 #include <cmath>
 #include <cstring>
 
@@ -418,6 +419,9 @@ Status ZoneMgmtServer::RemoveTrigger(uint16_t zoneId)
         mTriggers.erase(std::remove_if(mTriggers.begin(), mTriggers.end(),
                                        [&](const ZoneTriggerControlStruct & trigger) { return trigger.zoneID == zoneId; }),
                         mTriggers.end());
+        mZoneTriggerStates.erase(std::remove_if(mZoneTriggerStates.begin(), mZoneTriggerStates.end(),
+                                                [&](const ZoneTriggerState & zoneState) { return zoneState.zoneID == zoneId; }),
+                                 mZoneTriggerStates.end());
         auto path = ConcreteAttributePath(mEndpointId, ZoneManagement::Id, Attributes::Triggers::Id);
         mDelegate.OnAttributeChanged(Attributes::Triggers::Id);
         MatterReportingAttributeChangeCallback(path);
@@ -773,6 +777,17 @@ bool ZoneMgmtServer::ZoneAlreadyExists(ZoneUseEnum zoneUse, const std::vector<Tw
 
 Status ZoneMgmtServer::GenerateZoneTriggeredEvent(uint16_t zoneID, ZoneEventTriggeredReasonEnum triggerReason)
 {
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    const auto trigger                 = GetTriggerForZone(zoneID);
+
+    auto state = std::find_if(mZoneTriggerStates.begin(), mZoneTriggerStates.end(),
+                              [&](const ZoneTriggerState & zoneState) { return zoneState.zoneID == zoneID; });
+    if (trigger.HasValue() && state != mZoneTriggerStates.end() && (now < state->triggeredUntil || now < state->blindUntil))
+    {
+        state->coalescedTriggers++;
+        return Status::Success;
+    }
+
     Events::ZoneTriggered::Type event;
     EventNumber eventNumber;
 
@@ -787,11 +802,36 @@ Status ZoneMgmtServer::GenerateZoneTriggeredEvent(uint16_t zoneID, ZoneEventTrig
                      err.Format());
         return Status::Failure;
     }
+
+    if (trigger.HasValue())
+    {
+        if (state == mZoneTriggerStates.end())
+        {
+            state = mZoneTriggerStates.emplace(mZoneTriggerStates.end());
+        }
+        state->zoneID            = zoneID;
+        state->triggeredUntil    = now + System::Clock::Seconds32(trigger.Value().maxDuration);
+        state->blindUntil        = System::Clock::kZero;
+        state->coalescedTriggers = 0;
+    }
     return Status::Success;
 }
 
 Status ZoneMgmtServer::GenerateZoneStoppedEvent(uint16_t zoneID, ZoneEventStoppedReasonEnum stopReason)
 {
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    const auto trigger                 = GetTriggerForZone(zoneID);
+
+    auto state = std::find_if(mZoneTriggerStates.begin(), mZoneTriggerStates.end(),
+                              [&](const ZoneTriggerState & zoneState) { return zoneState.zoneID == zoneID; });
+    if (state != mZoneTriggerStates.end() && now < state->triggeredUntil)
+    {
+        ChipLogDetail(Zcl, "ZoneManagement[ep=%d]: Zone %u stopped after %" PRIu32 " coalesced triggers", mEndpointId, zoneID,
+                      state->coalescedTriggers);
+        state->triggeredUntil = System::Clock::kZero;
+        state->blindUntil     = now + System::Clock::Seconds32(trigger.HasValue() ? trigger.Value().blindDuration : 0);
+    }
+
     Events::ZoneStopped::Type event;
     EventNumber eventNumber;
 
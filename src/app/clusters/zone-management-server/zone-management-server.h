@@ -27,6 +27,7 @@
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/TypeTraits.h>
 #include <protocols/interaction_model/StatusCode.h>
+#include <system/SystemClock.h>
 #include <vector>
 
 namespace chip {
@@ -295,6 +296,12 @@ public:
     Protocols::InteractionModel::Status RemoveTrigger(uint16_t zoneId);
 
     // Generate Zone events
+
+    /**
+     * @brief Generates a ZoneTriggered event. For a zone with a ZoneTriggerControl, triggers are coalesced into the last
+     * ZoneTriggered event until the zone is stopped or its maxDuration elapses, and ignored for the blindDuration after it
+     * is stopped, so that a detector reporting at a high rate does not flood subscribers with events.
+     */
     Protocols::InteractionModel::Status GenerateZoneTriggeredEvent(uint16_t zoneID, ZoneEventTriggeredReasonEnum triggerReason);
     Protocols::InteractionModel::Status GenerateZoneStoppedEvent(uint16_t zoneID, ZoneEventStoppedReasonEnum stopReason);
 
@@ -314,6 +321,18 @@ private:
     std::vector<ZoneTriggerControlStruct> mTriggers;
     uint8_t mSensitivity = 0;
 
+    // Trigger state of the zones with a ZoneTriggerControl that generated a ZoneTriggered event.
+    struct ZoneTriggerState
+    {
+        uint16_t zoneID = 0;
+        // Triggers until then are coalesced into the last ZoneTriggered event, bounded by the maxDuration of the trigger.
+        System::Clock::Timestamp triggeredUntil = System::Clock::kZero;
+        // Triggers until then are ignored, from the ZoneStopped event for the blindDuration of the trigger.
+        System::Clock::Timestamp blindUntil = System::Clock::kZero;
+        uint32_t coalescedTriggers          = 0;
+    };
+    std::vector<ZoneTriggerState> mZoneTriggerStates;
+
     /**
      * IM-level implementation of read
      * @return appropriately mapped CHIP_ERROR if applicable
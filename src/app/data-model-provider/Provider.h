@@ -29,6 +29,9 @@
 #include <app/data-model-provider/OperationTypes.h>
 #include <app/data-model-provider/ProviderMetadataTree.h>
 
+#include <cstddef>
+#include <optional>
+
 namespace chip {
 namespace app {
 namespace DataModel {
@@ -68,6 +71,16 @@ public:
     ///        data allowed) or further encoding can be retried (AllowPartialData true for list encoding)
     virtual ActionReturnStatus ReadAttribute(const ReadAttributeRequest & request, AttributeValueEncoder & encoder) = 0;
 
+    /// Returns a lower bound of the size, in bytes, of the TLV encoding of the value that ReadAttribute would encode for
+    /// `request`, when it is known without encoding the value (e.g. fixed size values, or lists of known length).
+    ///
+    /// The reporting engine uses it to start the attribute in the next chunk of a report, rather than attempt to encode it
+    /// into a chunk it cannot fit in and roll the attempt back.  Lists report the size of their whole encoding: they then
+    /// start in the next chunk instead of being split across the end of the current one.
+    ///
+    /// Same preconditions as ReadAttribute.  std::nullopt (the default) means that the attribute is always attempted.
+    virtual std::optional<size_t> EstimateAttributeEncodedSize(const ReadAttributeRequest & request) { return std::nullopt; }
+
     /// Requests a write of an attribute.
     ///
     /// When this is invoked, caller is expected to have already done some validations:
@@ -88,6 +101,15 @@ public:
     virtual void ListAttributeWriteNotification(const ConcreteAttributePath & aPath, ListWriteOperation opType,
                                                 FabricIndex accessingFabric) = 0;
 
+    /// Indicates the start and the end of a run of consecutive writes to the same cluster while processing
+    /// a single write request message (e.g. a bulk write of many attributes of one cluster).
+    ///
+    /// Providers MAY defer work shared by these writes, like data version increments, persistence and change
+    /// notifications, until EndClusterWrites. EndClusterWrites is always called for the cluster before any
+    /// other cluster is written and before the write request message processing completes.
+    virtual void BeginClusterWrites(const ConcreteClusterPath & path) {}
+    virtual void EndClusterWrites(const ConcreteClusterPath & path) {}
+
     /// `handler` is used to send back the reply.
     ///    - returning `std::nullopt` means that return value was placed in handler directly.
     ///      This includes cases where command handling and value return will be done asynchronously.
@@ -0,0 +1,229 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/data-model/Encode.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLV.h>
+#include <lib/support/BitFlags.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+namespace detail {
+
+inline uint8_t FixedFieldControlByte(TLV::TLVElementType type)
+{
+    return static_cast<uint8_t>(to_underlying(TLV::TLVTagControl::ContextSpecific) | static_cast<uint8_t>(type));
+}
+
+template <typename T>
+constexpr size_t FixedFieldMaxLength()
+{
+    // Control byte and context tag, then the value.
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        return 2;
+    }
+    else if constexpr (std::is_integral<T>::value || std::is_enum<T>::value)
+    {
+        return 2 + sizeof(T);
+    }
+    else
+    {
+        return 2 + sizeof(std::declval<const T &>().Raw());
+    }
+}
+
+// Writes the head of an unsigned integer of the smallest width holding v, like TLVWriter::Put(Tag, uint64_t).
+template <typename U>
+void EncodeFixedUnsigned(uint8_t *& p, uint8_t contextTag, U v)
+{
+    static_assert(std::is_unsigned<U>::value, "Unsigned integer expected");
+
+    uint8_t widthIndex = 0;
+    if constexpr (sizeof(U) > 1)
+    {
+        widthIndex = static_cast<uint8_t>(widthIndex + (v > UINT8_MAX));
+    }
+    if constexpr (sizeof(U) > 2)
+    {
+        widthIndex = static_cast<uint8_t>(widthIndex + (v > UINT16_MAX));
+    }
+    if constexpr (sizeof(U) > 4)
+    {
+        widthIndex = static_cast<uint8_t>(widthIndex + (v > UINT32_MAX));
+    }
+
+    p[0] = static_cast<uint8_t>(FixedFieldControlByte(TLV::TLVElementType::UInt8) + widthIndex);
+    p[1] = contextTag;
+    // The buffer has room for all of U, so write it whole and keep only the bytes the width needs.
+    if constexpr (sizeof(U) == 1)
+    {
+        p[2] = v;
+    }
+    else if constexpr (sizeof(U) == 2)
+    {
+        Encoding::LittleEndian::Put16(p + 2, v);
+    }
+    else if constexpr (sizeof(U) == 4)
+    {
+        Encoding::LittleEndian::Put32(p + 2, v);
+    }
+    else
+    {
+        Encoding::LittleEndian::Put64(p + 2, v);
+    }
+    p += 2 + (1u << widthIndex);
+}
+
+// Signed counterpart, like TLVWriter::Put(Tag, int64_t).
+template <typename S>
+void EncodeFixedSigned(uint8_t *& p, uint8_t contextTag, S v)
+{
+    static_assert(std::is_signed<S>::value, "Signed integer expected");
+
+    uint8_t widthIndex = 0;
+    if constexpr (sizeof(S) > 1)
+    {
+        widthIndex = static_cast<uint8_t>(widthIndex + (v < INT8_MIN || v > INT8_MAX));
+    }
+    if constexpr (sizeof(S) > 2)
+    {
+        widthIndex = static_cast<uint8_t>(widthIndex + (v < INT16_MIN || v > INT16_MAX));
+    }
+    if constexpr (sizeof(S) > 4)
+    {
+        widthIndex = static_cast<uint8_t>(widthIndex + (v < INT32_MIN || v > INT32_MAX));
+    }
+
+    using U = std::make_unsigned_t<S>;
+    p[0]    = static_cast<uint8_t>(FixedFieldControlByte(TLV::TLVElementType::Int8) + widthIndex);
+    p[1]    = contextTag;
+    if constexpr (sizeof(S) == 1)
+    {
+        p[2] = static_cast<U>(v);
+    }
+    else if constexpr (sizeof(S) == 2)
+    {
+        Encoding::LittleEndian::Put16(p + 2, static_cast<U>(v));
+    }
+    else if constexpr (sizeof(S) == 4)
+    {
+        Encoding::LittleEndian::Put32(p + 2, static_cast<U>(v));
+    }
+    else
+    {
+        Encoding::LittleEndian::Put64(p + 2, static_cast<U>(v));
+    }
+    p += 2 + (1u << widthIndex);
+}
+
+template <typename T>
+CHIP_ERROR EncodeFixedValue(uint8_t *& p, uint8_t contextTag, T value)
+{
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        p[0] = FixedFieldControlByte(value ? TLV::TLVElementType::BooleanTrue : TLV::TLVElementType::BooleanFalse);
+        p[1] = contextTag;
+        p += 2;
+    }
+    else if constexpr (std::is_enum<T>::value)
+    {
+        if constexpr (detail::HasUnknownValue<T>)
+        {
+            CHIP_DM_ENCODING_MAYBE_FAIL_UNKNOWN_ENUM_VALUE(value);
+        }
+        return EncodeFixedValue(p, contextTag, to_underlying(value));
+    }
+    else if constexpr (std::is_unsigned<T>::value)
+    {
+        EncodeFixedUnsigned(p, contextTag, value);
+    }
+    else if constexpr (std::is_signed<T>::value)
+    {
+        EncodeFixedSigned(p, contextTag, value);
+    }
+    else
+    {
+        // Bitmaps, for which TLVWriter::Put encodes the raw value.
+        return EncodeFixedValue(p, contextTag, value.Raw());
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace detail
+
+template <uint8_t kContextTag, typename T>
+struct FixedStructField
+{
+    static constexpr size_t kMaxLength = detail::FixedFieldMaxLength<T>();
+
+    CHIP_ERROR Encode(uint8_t *& p) const { return detail::EncodeFixedValue(p, kContextTag, value); }
+
+    T value;
+};
+
+template <uint8_t kContextTag, typename T>
+FixedStructField<kContextTag, T> FixedField(const T & value)
+{
+    return FixedStructField<kContextTag, T>{ value };
+}
+
+/**
+ * Encoder for cluster structs of a fixed shape: every member is a bool, an integer, an enum or a bitmap, is always
+ * present, and has a context tag known at compile time.
+ *
+ * WrappedStructEncoder goes through TLVWriter::Put for every member, which checks the writer state and the tag and
+ * may have to ask the backing store for room each time.  For a fixed-shape struct, the largest encoding is known at
+ * compile time, so EncodeFixedStruct writes the members straight into a buffer on the stack, leaving only the
+ * integer width to be picked at runtime, and hands the result to the writer in one PutPreEncodedContainer.  The
+ * encoding is the same as WrappedStructEncoder's, down to the byte.
+ *
+ * Usage, from a struct's Encode:
+ *
+ *     return DataModel::EncodeFixedStruct(aWriter, aTag, DataModel::FixedField<to_underlying(Fields::kX1)>(x1),
+ *                                         DataModel::FixedField<to_underlying(Fields::kY1)>(y1));
+ *
+ * The fields are encoded in the order given.
+ */
+template <typename... Fields>
+CHIP_ERROR EncodeFixedStruct(TLV::TLVWriter & writer, TLV::Tag tag, const Fields &... fields)
+{
+    // The members, then the end of the container.
+    uint8_t buffer[(Fields::kMaxLength + ... + 0) + 1];
+    uint8_t * p    = buffer;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    ((err = (err == CHIP_NO_ERROR) ? fields.Encode(p) : err), ...);
+    ReturnErrorOnFailure(err);
+
+    *p++ = static_cast<uint8_t>(TLV::TLVElementType::EndOfContainer);
+    return writer.PutPreEncodedContainer(tag, TLV::kTLVType_Structure, buffer, static_cast<uint32_t>(p - buffer));
+}
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
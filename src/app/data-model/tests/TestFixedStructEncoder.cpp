@@ -0,0 +1,139 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <app/data-model/Encode.h>
+#include <app/data-model/FixedStructEncoder.h>
+#include <lib/core/TLV.h>
+#include <lib/support/BitMask.h>
+#include <lib/support/Span.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+enum class ModeEnum : uint8_t
+{
+    kOff  = 0,
+    kHeat = 4,
+};
+
+enum class FeatureBits : uint16_t
+{
+    kA = 0x1,
+    kB = 0x400,
+};
+
+struct TestStruct
+{
+    uint8_t a;
+    uint16_t b;
+    uint32_t c;
+    uint64_t d;
+    int16_t e;
+    int64_t f;
+    bool g;
+    ModeEnum h;
+    BitMask<FeatureBits> i;
+};
+
+// The encoding WrappedStructEncoder produces.
+CHIP_ERROR EncodeGeneric(TLV::TLVWriter & writer, const TestStruct & s)
+{
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(0), s.a));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(1), s.b));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(2), s.c));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(3), s.d));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(4), s.e));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(5), s.f));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(6), s.g));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(200), s.h));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(255), s.i));
+    return writer.EndContainer(outer);
+}
+
+CHIP_ERROR EncodeFixed(TLV::TLVWriter & writer, const TestStruct & s)
+{
+    return DataModel::EncodeFixedStruct(writer, TLV::AnonymousTag(), DataModel::FixedField<0>(s.a), DataModel::FixedField<1>(s.b),
+                                        DataModel::FixedField<2>(s.c), DataModel::FixedField<3>(s.d),
+                                        DataModel::FixedField<4>(s.e), DataModel::FixedField<5>(s.f),
+                                        DataModel::FixedField<6>(s.g), DataModel::FixedField<200>(s.h),
+                                        DataModel::FixedField<255>(s.i));
+}
+
+void CheckSameEncoding(const TestStruct & s)
+{
+    uint8_t generic[128];
+    uint8_t fixed[128];
+    TLV::TLVWriter writer;
+
+    writer.Init(generic);
+    ASSERT_EQ(EncodeGeneric(writer, s), CHIP_NO_ERROR);
+    const uint32_t genericLength = writer.GetLengthWritten();
+
+    writer.Init(fixed);
+    ASSERT_EQ(EncodeFixed(writer, s), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.GetLengthWritten(), genericLength);
+    EXPECT_EQ(memcmp(generic, fixed, genericLength), 0);
+}
+
+} // namespace
+
+TEST(TestFixedStructEncoder, MatchesGenericEncoding)
+{
+    CheckSameEncoding(TestStruct{ 0, 0, 0, 0, 0, 0, false, ModeEnum::kOff, BitMask<FeatureBits>() });
+    CheckSameEncoding(TestStruct{ UINT8_MAX, UINT8_MAX, UINT8_MAX, UINT8_MAX, INT8_MAX, INT8_MIN, true, ModeEnum::kHeat,
+                                  BitMask<FeatureBits>(FeatureBits::kA) });
+    CheckSameEncoding(TestStruct{ 1, UINT8_MAX + 1, UINT16_MAX, UINT16_MAX + 1, INT8_MIN - 1, INT16_MAX + 1, false,
+                                  ModeEnum::kHeat, BitMask<FeatureBits>(FeatureBits::kB) });
+    CheckSameEncoding(TestStruct{ 2, UINT16_MAX, UINT32_MAX, UINT32_MAX, INT16_MIN, static_cast<int64_t>(INT32_MIN) - 1, true,
+                                  ModeEnum::kOff, BitMask<FeatureBits>(FeatureBits::kA, FeatureBits::kB) });
+    CheckSameEncoding(TestStruct{ 3, 1, static_cast<uint32_t>(UINT16_MAX) + 1, UINT64_MAX, INT16_MAX, INT64_MAX, false,
+                                  ModeEnum::kOff, BitMask<FeatureBits>() });
+    CheckSameEncoding(
+        TestStruct{ 4, 2, 3, static_cast<uint64_t>(UINT32_MAX) + 1, -1, INT64_MIN, true, ModeEnum::kHeat, BitMask<FeatureBits>() });
+}
+
+TEST(TestFixedStructEncoder, EncodesExpectedBytes)
+{
+    uint8_t buffer[16];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    ASSERT_EQ(DataModel::EncodeFixedStruct(writer, TLV::AnonymousTag(), DataModel::FixedField<1>(static_cast<uint16_t>(0x1234))),
+              CHIP_NO_ERROR);
+
+    const uint8_t expected[] = { 0x15, 0x25, 0x01, 0x34, 0x12, 0x18 };
+    ASSERT_EQ(writer.GetLengthWritten(), sizeof(expected));
+    EXPECT_EQ(memcmp(buffer, expected, sizeof(expected)), 0);
+}
+
+TEST(TestFixedStructEncoder, FailsWhenOutOfSpace)
+{
+    const TestStruct s{ 1, 2, 3, 4, 5, 6, true, ModeEnum::kHeat, BitMask<FeatureBits>() };
+    uint8_t buffer[8];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    EXPECT_EQ(EncodeFixed(writer, s), CHIP_ERROR_BUFFER_TOO_SMALL);
+}
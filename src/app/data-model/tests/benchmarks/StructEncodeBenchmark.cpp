@@ -0,0 +1,229 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Throughput benchmarks for encoding fixed-shape cluster structs, through the generated Encode (which uses
+ *      WrappedStructEncoder) and through DataModel::EncodeFixedStruct.
+ *
+ *      Each payload is a list attribute value made of such structs, like a Descriptor DeviceTypeList.
+ *
+ *      Usage: struct-encode-benchmark [--min-time-ms=<ms>] [<name filter>]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/Encode.h>
+#include <app/data-model/FixedStructEncoder.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+using namespace chip::TLV;
+
+namespace {
+
+constexpr size_t kBufferSize         = 4096;
+constexpr uint32_t kDefaultMinTimeMs = 500;
+constexpr size_t kListLength         = 64;
+
+using DeviceTypeStruct = Descriptor::Structs::DeviceTypeStruct::Type;
+using ViewportStruct   = Globals::Structs::ViewportStruct::Type;
+
+uint8_t gScratch[kBufferSize];
+
+DeviceTypeStruct gDeviceTypes[kListLength];
+ViewportStruct gViewports[kListLength];
+
+void InitPayloads()
+{
+    for (size_t i = 0; i < kListLength; i++)
+    {
+        gDeviceTypes[i].deviceType = static_cast<DeviceTypeId>(0x0100 + i * 0x101);
+        gDeviceTypes[i].revision   = static_cast<uint16_t>(1 + i % 4);
+
+        gViewports[i].x1 = static_cast<uint16_t>(i);
+        gViewports[i].y1 = static_cast<uint16_t>(i * 8);
+        gViewports[i].x2 = static_cast<uint16_t>(1920 - i);
+        gViewports[i].y2 = static_cast<uint16_t>(1080 - i);
+    }
+}
+
+CHIP_ERROR EncodeFixed(TLVWriter & writer, Tag tag, const DeviceTypeStruct & s)
+{
+    using Fields = Descriptor::Structs::DeviceTypeStruct::Fields;
+    return DataModel::EncodeFixedStruct(writer, tag, DataModel::FixedField<to_underlying(Fields::kDeviceType)>(s.deviceType),
+                                        DataModel::FixedField<to_underlying(Fields::kRevision)>(s.revision));
+}
+
+CHIP_ERROR EncodeFixed(TLVWriter & writer, Tag tag, const ViewportStruct & s)
+{
+    using Fields = Globals::Structs::ViewportStruct::Fields;
+    return DataModel::EncodeFixedStruct(writer, tag, DataModel::FixedField<to_underlying(Fields::kX1)>(s.x1),
+                                        DataModel::FixedField<to_underlying(Fields::kY1)>(s.y1),
+                                        DataModel::FixedField<to_underlying(Fields::kX2)>(s.x2),
+                                        DataModel::FixedField<to_underlying(Fields::kY2)>(s.y2));
+}
+
+template <typename T, bool kFixed>
+size_t EncodeList(const T (&items)[kListLength])
+{
+    TLVWriter writer;
+    TLVType list;
+
+    writer.Init(gScratch, sizeof(gScratch));
+    SuccessOrDie(writer.StartContainer(AnonymousTag(), kTLVType_Array, list));
+    for (const auto & item : items)
+    {
+        if constexpr (kFixed)
+        {
+            SuccessOrDie(EncodeFixed(writer, AnonymousTag(), item));
+        }
+        else
+        {
+            SuccessOrDie(DataModel::Encode(writer, AnonymousTag(), item));
+        }
+    }
+    SuccessOrDie(writer.EndContainer(list));
+    SuccessOrDie(writer.Finalize());
+
+    return writer.GetLengthWritten();
+}
+
+size_t BenchGeneratedDeviceTypes()
+{
+    return EncodeList<DeviceTypeStruct, false>(gDeviceTypes);
+}
+
+size_t BenchFixedDeviceTypes()
+{
+    return EncodeList<DeviceTypeStruct, true>(gDeviceTypes);
+}
+
+size_t BenchGeneratedViewports()
+{
+    return EncodeList<ViewportStruct, false>(gViewports);
+}
+
+size_t BenchFixedViewports()
+{
+    return EncodeList<ViewportStruct, true>(gViewports);
+}
+
+struct Benchmark
+{
+    const char * name;
+    // Runs one iteration and returns the number of TLV bytes it encoded.
+    size_t (*run)();
+};
+
+const Benchmark sBenchmarks[] = {
+    { "Generated/DeviceTypeStruct", BenchGeneratedDeviceTypes },
+    { "Fixed/DeviceTypeStruct", BenchFixedDeviceTypes },
+    { "Generated/ViewportStruct", BenchGeneratedViewports },
+    { "Fixed/ViewportStruct", BenchFixedViewports },
+};
+
+// Both encoders must produce the same bytes, or the comparison means nothing.
+void VerifyEncodingsMatch(size_t (*generated)(), size_t (*fixed)())
+{
+    static uint8_t sGenerated[kBufferSize];
+
+    size_t length = generated();
+    memcpy(sGenerated, gScratch, length);
+    VerifyOrDie(fixed() == length);
+    VerifyOrDie(memcmp(sGenerated, gScratch, length) == 0);
+}
+
+void RunBenchmark(const Benchmark & benchmark, std::chrono::nanoseconds minTime)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Warm up, and learn the payload size.
+    size_t bytesPerIteration = benchmark.run();
+
+    uint64_t iterations = 1;
+    for (;;)
+    {
+        auto start = Clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            benchmark.run();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+
+        if (elapsed >= minTime || iterations >= (UINT64_MAX / 10))
+        {
+            double nsPerIteration = static_cast<double>(elapsed.count()) / static_cast<double>(iterations);
+            double mbPerSecond    = static_cast<double>(bytesPerIteration) * 1e3 / nsPerIteration;
+            printf("%-28s %12" PRIu64 " iterations %10.1f ns/op %8.1f MB/s %6u bytes\n", benchmark.name, iterations,
+                   nsPerIteration, mbPerSecond, static_cast<unsigned>(bytesPerIteration));
+            return;
+        }
+
+        // Aim slightly past the minimum time, growing by at most 10x per round.
+        uint64_t next = elapsed.count() > 0
+            ? static_cast<uint64_t>(static_cast<double>(iterations) * 1.2 * static_cast<double>(minTime.count()) /
+                                    static_cast<double>(elapsed.count()))
+            : iterations * 10;
+        iterations = std::max(iterations + 1, std::min(next, iterations * 10));
+    }
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    uint32_t minTimeMs  = kDefaultMinTimeMs;
+    const char * filter = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--min-time-ms=", strlen("--min-time-ms=")) == 0)
+        {
+            minTimeMs = static_cast<uint32_t>(strtoul(argv[i] + strlen("--min-time-ms="), nullptr, 10));
+        }
+        else
+        {
+            filter = argv[i];
+        }
+    }
+
+    InitPayloads();
+    VerifyEncodingsMatch(BenchGeneratedDeviceTypes, BenchFixedDeviceTypes);
+    VerifyEncodingsMatch(BenchGeneratedViewports, BenchFixedViewports);
+
+    for (const auto & benchmark : sBenchmarks)
+    {
+        if (filter == nullptr || strstr(benchmark.name, filter) != nullptr)
+        {
+            RunBenchmark(benchmark, std::chrono::milliseconds(minTimeMs));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,158 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/icd/server/ICDNotifier.h>
+#include <lib/support/TypeTraits.h>
+#include <system/SystemClock.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief Attributes the time an ICD spends in Active Mode to the causes keeping it there.
+ *
+ *        While a keep active requirement (ICDListener::KeepActiveFlag) is set, the time is counted for that requirement;
+ *        requirements set together are all counted.  While none is set, the device only stays active until the Active Mode
+ *        timer expires, and the time is counted for whatever last started or extended that timer.
+ */
+class ICDActiveModeProfiler
+{
+public:
+    enum class Cause : uint8_t
+    {
+        // Keep active requirements, in the order of their ICDListener::KeepActiveFlag bit.
+        kCommissioningWindowOpen = 0,
+        kFailSafeArmed,
+        kExchangeContextOpen,
+        kCheckInInProgress,
+        kTestEventTriggerActiveMode,
+        // Starts or extensions of the Active Mode timer.
+        kIdleModeDone, ///< Idle Mode duration expired
+        kNetworkActivity,
+        kSubscriptionReport,
+        kStayActiveRequest,
+        kCount,
+    };
+
+    static constexpr uint8_t kCauseCount = to_underlying(Cause::kCount);
+
+    struct Stats
+    {
+        System::Clock::Milliseconds64 activeTime{ 0 };
+        System::Clock::Milliseconds64 timeByCause[kCauseCount] = {};
+        uint32_t activeModeCount                               = 0;
+
+        System::Clock::Milliseconds64 TimeFor(Cause cause) const { return timeByCause[to_underlying(cause)]; }
+    };
+
+    /**
+     * @brief Records what started or extended the Active Mode timer.  Must be called before the state change it causes.
+     */
+    void OnActiveModeTimerCause(Cause cause, System::Clock::Milliseconds64 now)
+    {
+        Accumulate(now);
+        mTimerCause = cause;
+    }
+
+    void OnKeepActiveFlagsChanged(ICDListener::KeepActiveFlags flags, System::Clock::Milliseconds64 now)
+    {
+        Accumulate(now);
+        mFlags = flags;
+    }
+
+    void OnEnterActiveMode(System::Clock::Milliseconds64 now)
+    {
+        Accumulate(now);
+        mActive = true;
+        mStats.activeModeCount++;
+
+        // A requirement that brings the device to Active Mode also starts the Active Mode timer.
+        for (uint8_t i = 0; i < kFlagCount; i++)
+        {
+            if (HasFlag(i))
+            {
+                mTimerCause = static_cast<Cause>(i);
+                break;
+            }
+        }
+    }
+
+    void OnEnterIdleMode(System::Clock::Milliseconds64 now)
+    {
+        Accumulate(now);
+        mActive = false;
+    }
+
+    /**
+     * @brief Returns the statistics accumulated since the last reset, including the current Active Mode.
+     */
+    const Stats & GetStats(System::Clock::Milliseconds64 now)
+    {
+        Accumulate(now);
+        return mStats;
+    }
+
+    void ResetStats(System::Clock::Milliseconds64 now)
+    {
+        mStats      = Stats();
+        mLastUpdate = now;
+    }
+
+private:
+    static constexpr uint8_t kFlagCount = to_underlying(Cause::kIdleModeDone);
+    static_assert(to_underlying(ICDListener::KeepActiveFlag::kInvalidFlag) == (1u << kFlagCount),
+                  "Every keep active requirement needs a Cause");
+
+    bool HasFlag(uint8_t index) const { return (mFlags.Raw() & (1u << index)) != 0; }
+
+    void Accumulate(System::Clock::Milliseconds64 now)
+    {
+        if (mActive && now > mLastUpdate)
+        {
+            const System::Clock::Milliseconds64 elapsed = now - mLastUpdate;
+            mStats.activeTime += elapsed;
+
+            bool requirementSet = false;
+            for (uint8_t i = 0; i < kFlagCount; i++)
+            {
+                if (HasFlag(i))
+                {
+                    mStats.timeByCause[i] += elapsed;
+                    requirementSet = true;
+                }
+            }
+            if (!requirementSet)
+            {
+                mStats.timeByCause[to_underlying(mTimerCause)] += elapsed;
+            }
+        }
+        mLastUpdate = now;
+    }
+
+    Stats mStats;
+    System::Clock::Milliseconds64 mLastUpdate{ 0 };
+    ICDListener::KeepActiveFlags mFlags{ 0 };
+    Cause mTimerCause = Cause::kIdleModeDone;
+    bool mActive      = false;
+};
+
+} // namespace app
+} // namespace chip
@@ -51,30 +51,41 @@ void ICDCheckInSender::OnNodeAddressResolutionFailed(const PeerId & peerId, CHIP
                     ChipLogValueX64(peerId.GetNodeId()));
 }
 
-CHIP_ERROR ICDCheckInSender::SendCheckInMsg(const Transport::PeerAddress & addr)
+CHIP_ERROR ICDCheckInSender::GeneratePayload(const ICDMonitoringEntry & entry, uint32_t counter)
 {
-    System::PacketBufferHandle buffer = MessagePacketBuffer::New(CheckinMessage::kMinPayloadSize);
+    Crypto::Aes128KeyHandle aes128KeyHandle;
+    Crypto::Hmac128KeyHandle hmac128KeyHandle;
 
-    VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
-    MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
+    memcpy(aes128KeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
+           entry.aesKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
+
+    memcpy(hmac128KeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
+           entry.hmacKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
 
     // Encoded ActiveModeThreshold in littleEndian for Check-In message application data
-    {
-        uint8_t activeModeThresholdBuffer[kApplicationDataSize] = { 0 };
-        size_t writtenBytes                                     = 0;
-        Encoding::LittleEndian::BufferWriter writer(activeModeThresholdBuffer, sizeof(activeModeThresholdBuffer));
+    uint8_t activeModeThresholdBuffer[kApplicationDataSize] = { 0 };
+    size_t writtenBytes                                     = 0;
+    Encoding::LittleEndian::BufferWriter writer(activeModeThresholdBuffer, sizeof(activeModeThresholdBuffer));
 
-        uint16_t activeModeThreshold_ms = ICDConfigurationData::GetInstance().GetActiveModeThreshold().count();
-        writer.Put16(activeModeThreshold_ms);
-        VerifyOrReturnError(writer.Fit(writtenBytes), CHIP_ERROR_INTERNAL);
+    uint16_t activeModeThreshold_ms = ICDConfigurationData::GetInstance().GetActiveModeThreshold().count();
+    writer.Put16(activeModeThreshold_ms);
+    VerifyOrReturnError(writer.Fit(writtenBytes), CHIP_ERROR_INTERNAL);
 
-        ByteSpan activeModeThresholdByteSpan(writer.Buffer(), writtenBytes);
+    ByteSpan activeModeThresholdByteSpan(writer.Buffer(), writtenBytes);
+    MutableByteSpan output(mPayload);
 
-        ReturnErrorOnFailure(CheckinMessage::GenerateCheckinMessagePayload(mAes128KeyHandle, mHmac128KeyHandle, mICDCounter,
-                                                                           activeModeThresholdByteSpan, output));
-    }
+    ReturnErrorOnFailure(CheckinMessage::GenerateCheckinMessagePayload(aes128KeyHandle, hmac128KeyHandle, counter,
+                                                                       activeModeThresholdByteSpan, output));
+    mPayloadSize = output.size();
+    return CHIP_NO_ERROR;
+}
 
-    buffer->SetDataLength(static_cast<uint16_t>(output.size()));
+CHIP_ERROR ICDCheckInSender::SendCheckInMsg(const Transport::PeerAddress & addr)
+{
+    VerifyOrReturnError(mPayloadSize > 0, CHIP_ERROR_INCORRECT_STATE);
+
+    System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(mPayload, mPayloadSize);
+    VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
 
     VerifyOrReturnError(mExchangeManager->GetSessionManager() != nullptr, CHIP_ERROR_INTERNAL);
 
@@ -97,21 +108,16 @@ CHIP_ERROR ICDCheckInSender::RequestResolve(ICDMonitoringEntry & entry, FabricTa
     const FabricInfo * fabricInfo = fabricTable->FindFabricWithIndex(entry.fabricIndex);
     PeerId peerId(fabricInfo->GetCompressedFabricId(), entry.checkInNodeID);
 
-    mICDCounter = counter;
+    ReturnErrorOnFailure(GeneratePayload(entry, counter));
 
     AddressResolve::NodeLookupRequest request(peerId);
 
-    memcpy(mAes128KeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
-           entry.aesKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
-
-    memcpy(mHmac128KeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(),
-           entry.hmacKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray));
-
+    // Request to stay active before the lookup, since a cached address may be resolved, and the request withdrawn, right away.
+    ICDNotifier::GetInstance().NotifyActiveRequestNotification(ICDListener::KeepActiveFlag::kCheckInInProgress);
     CHIP_ERROR err = AddressResolve::Resolver::Instance().LookupNode(request, mAddressLookupHandle);
-
-    if (err == CHIP_NO_ERROR)
+    if (err != CHIP_NO_ERROR)
     {
-        ICDNotifier::GetInstance().NotifyActiveRequestNotification(ICDListener::KeepActiveFlag::kCheckInInProgress);
+        ICDNotifier::GetInstance().NotifyActiveRequestWithdrawal(ICDListener::KeepActiveFlag::kCheckInInProgress);
     }
 
     return err;
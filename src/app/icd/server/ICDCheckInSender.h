@@ -19,6 +19,7 @@
 #include <app/icd/server/ICDMonitoringTable.h>
 #include <credentials/FabricTable.h>
 #include <lib/address_resolve/AddressResolve.h>
+#include <protocols/secure_channel/CheckinMessage.h>
 
 #include <messaging/ExchangeMgr.h>
 
@@ -27,6 +28,9 @@ namespace app {
 
 /**
  * @brief ICD Check-In Sender is responsible for resolving the NodeId and sending the check-in message
+ *
+ * The Check-In payload is generated when the resolution is requested, so that the senders of all the registered clients do
+ * their crypto up front, while the lookups run concurrently, and then only have to send the precomputed bytes once resolved.
  */
 class ICDCheckInSender : public AddressResolve::NodeListener
 {
@@ -45,6 +49,7 @@ public:
 private:
     static constexpr uint8_t kApplicationDataSize = 2; // ActiveModeThreshold is 2 bytes
 
+    CHIP_ERROR GeneratePayload(const ICDMonitoringEntry & entry, uint32_t counter);
     CHIP_ERROR SendCheckInMsg(const Transport::PeerAddress & addr);
 
     // This is used when a node address is required.
@@ -52,10 +57,8 @@ private:
 
     Messaging::ExchangeManager * mExchangeManager = nullptr;
 
-    Crypto::Aes128KeyHandle mAes128KeyHandle   = Crypto::Aes128KeyHandle();
-    Crypto::Hmac128KeyHandle mHmac128KeyHandle = Crypto::Hmac128KeyHandle();
-
-    uint32_t mICDCounter = 0;
+    uint8_t mPayload[Protocols::SecureChannel::CheckinMessage::kMinPayloadSize + kApplicationDataSize];
+    size_t mPayloadSize = 0;
 };
 
 } // namespace app
@@ -123,6 +123,7 @@ uint32_t ICDManager::StayActiveRequest(uint32_t stayActiveDuration)
 {
     // This should only be called when the device is in ActiveMode
     VerifyOrReturnValue(mOperationalState == OperationalState::ActiveMode, 0);
+    RecordActiveModeCause(ICDActiveModeProfiler::Cause::kStayActiveRequest);
 
     uint32_t promisedActiveDuration =
         std::min(ICDConfigurationData::GetInstance().GetGuaranteedStayActiveDuration().count(), stayActiveDuration);
@@ -146,6 +147,10 @@ void ICDManager::SendCheckInMsgs(Optional<Access::SubjectDescriptor> specificSub
     uint32_t counterValue   = ICDConfigurationData::GetInstance().GetICDCounter().GetNextCheckInCounterValue();
     bool counterIncremented = false;
 
+    // Keep the Check-In window open until every sender has requested its resolution, so that messages to clients resolved
+    // right away do not end it early.
+    ICDNotifier::GetInstance().NotifyActiveRequestNotification(KeepActiveFlag::kCheckInInProgress);
+
     for (const auto & fabricInfo : *mFabricTable)
     {
         uint16_t supported_clients = ICDConfigurationData::GetInstance().GetClientsSupportedPerFabric();
@@ -205,7 +210,12 @@ void ICDManager::SendCheckInMsgs(Optional<Access::SubjectDescriptor> specificSub
             // SenderPool will be released upon transition from active to idle state
             // This will happen when all ICD Check-In messages are sent on the network
             ICDCheckInSender * sender = mICDSenderPool.CreateObject(mExchangeManager);
-            VerifyOrReturn(sender != nullptr, ChipLogError(AppServer, "Failed to allocate ICDCheckinSender"));
+            if (sender == nullptr)
+            {
+                ChipLogError(AppServer, "Failed to allocate ICDCheckinSender");
+                ICDNotifier::GetInstance().NotifyActiveRequestWithdrawal(KeepActiveFlag::kCheckInInProgress);
+                return;
+            }
 
             if (CHIP_NO_ERROR != sender->RequestResolve(entry, mFabricTable, counterValue))
             {
@@ -213,6 +223,8 @@ void ICDManager::SendCheckInMsgs(Optional<Access::SubjectDescriptor> specificSub
             }
         }
     }
+
+    ICDNotifier::GetInstance().NotifyActiveRequestWithdrawal(KeepActiveFlag::kCheckInInProgress);
 #endif // !(CONFIG_BUILD_FOR_HOST_UNIT_TEST)
 }
 
@@ -434,6 +446,9 @@ void ICDManager::UpdateOperationState(OperationalState state)
     if (state == OperationalState::IdleMode)
     {
         mOperationalState = OperationalState::IdleMode;
+#if CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+        mActiveModeProfiler.OnEnterIdleMode(System::SystemClock().GetMonotonicMilliseconds64());
+#endif // CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
 
 #if CHIP_CONFIG_ENABLE_ICD_CIP
         std::function<ShouldCheckInMsgsBeSentFunction> sendCheckInMessagesOnActiveMode =
@@ -479,6 +494,9 @@ void ICDManager::UpdateOperationState(OperationalState state)
 
             mOperationalState                 = OperationalState::ActiveMode;
             Milliseconds32 activeModeDuration = configData.GetActiveModeDuration();
+#if CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+            mActiveModeProfiler.OnEnterActiveMode(System::SystemClock().GetMonotonicMilliseconds64());
+#endif // CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
 
             if (activeModeDuration == kZero && !mKeepActiveFlags.HasAny())
             {
@@ -524,6 +542,9 @@ void ICDManager::SetKeepActiveModeRequirements(KeepActiveFlags flag, bool state)
     assertChipStackLockedByCurrentThread();
 
     mKeepActiveFlags.Set(flag, state);
+#if CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+    mActiveModeProfiler.OnKeepActiveFlagsChanged(mKeepActiveFlags, System::SystemClock().GetMonotonicMilliseconds64());
+#endif // CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
     if (mOperationalState == OperationalState::IdleMode && mKeepActiveFlags.HasAny())
     {
         UpdateOperationState(OperationalState::ActiveMode);
@@ -539,6 +560,7 @@ void ICDManager::SetKeepActiveModeRequirements(KeepActiveFlags flag, bool state)
 void ICDManager::OnIdleModeDone(System::Layer * aLayer, void * appState)
 {
     ICDManager * pICDManager = reinterpret_cast<ICDManager *>(appState);
+    pICDManager->RecordActiveModeCause(ICDActiveModeProfiler::Cause::kIdleModeDone);
     pICDManager->UpdateOperationState(OperationalState::ActiveMode);
 }
 
@@ -582,7 +604,10 @@ void ICDManager::OnKeepActiveRequest(KeepActiveFlags request)
     {
         // There can be multiple check-in at the same time.
         // Keep track of the requests count.
-        this->mCheckInRequestCount++;
+        if (this->mCheckInRequestCount++ == 0)
+        {
+            mCheckInWindowStart = System::SystemClock().GetMonotonicTimestamp();
+        }
     }
 #endif // CHIP_CONFIG_ENABLE_ICD_CIP
 
@@ -629,6 +654,9 @@ void ICDManager::OnActiveRequestWithdrawal(KeepActiveFlags request)
 
         if (this->mCheckInRequestCount == 0)
         {
+            mLastCheckInWindowDuration = std::chrono::duration_cast<System::Clock::Milliseconds32>(
+                System::SystemClock().GetMonotonicTimestamp() - mCheckInWindowStart);
+            ChipLogProgress(AppServer, "Check-In messages sent in %" PRIu32 "ms", mLastCheckInWindowDuration.count());
             this->SetKeepActiveModeRequirements(KeepActiveFlag::kCheckInInProgress, false /* state */);
         }
     }
@@ -662,6 +690,7 @@ void ICDManager::OnSITModeRequestWithdrawal()
 
 void ICDManager::OnNetworkActivity()
 {
+    this->RecordActiveModeCause(ICDActiveModeProfiler::Cause::kNetworkActivity);
     this->UpdateOperationState(OperationalState::ActiveMode);
 }
 
@@ -683,6 +712,7 @@ void ICDManager::OnSubscriptionReport()
     // Since we only mark them dirty when we enter ActiveMode, it is not necessary to update the operational state a second time.
     // Doing so will only add an ActiveModeThreshold to the active time which we don't want to do here.
     VerifyOrReturn(mOperationalState == OperationalState::IdleMode);
+    this->RecordActiveModeCause(ICDActiveModeProfiler::Cause::kSubscriptionReport);
     this->UpdateOperationState(OperationalState::ActiveMode);
 }
 
@@ -694,6 +724,25 @@ void ICDManager::OnSendCheckIn(const Access::SubjectDescriptor & subject)
 }
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER && CHIP_CONFIG_ENABLE_ICD_CIP && CHIP_CONFIG_ENABLE_ICD_CHECK_IN_ON_REPORT_TIMEOUT
 
+void ICDManager::RecordActiveModeCause(ICDActiveModeProfiler::Cause cause)
+{
+#if CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+    mActiveModeProfiler.OnActiveModeTimerCause(cause, System::SystemClock().GetMonotonicMilliseconds64());
+#endif // CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+}
+
+#if CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+const ICDActiveModeProfiler::Stats & ICDManager::GetActiveModeStats()
+{
+    return mActiveModeProfiler.GetStats(System::SystemClock().GetMonotonicMilliseconds64());
+}
+
+void ICDManager::ResetActiveModeStats()
+{
+    mActiveModeProfiler.ResetStats(System::SystemClock().GetMonotonicMilliseconds64());
+}
+#endif // CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+
 void ICDManager::ExtendActiveMode(Milliseconds16 extendDuration)
 {
     TEMPORARY_RETURN_IGNORED DeviceLayer::SystemLayer().ExtendTimerTo(extendDuration, OnActiveModeDone, this);
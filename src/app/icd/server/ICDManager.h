@@ -21,6 +21,7 @@
 #include <app/AppConfig.h>
 #include <app/SubscriptionsInfoProvider.h>
 #include <app/TestEventTriggerDelegate.h>
+#include <app/icd/server/ICDActiveModeProfiler.h>
 #include <app/icd/server/ICDConfigurationData.h>
 #include <app/icd/server/ICDNotifier.h>
 #include <app/icd/server/ICDStateObserver.h>
@@ -224,6 +225,15 @@ public:
      */
     CHIP_ERROR HandleEventTrigger(uint64_t eventTrigger) override;
 
+#if CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+    /**
+     * @brief Time spent in Active Mode, in total and per cause, since Init or the last call to ResetActiveModeStats.
+     *        See ICDActiveModeProfiler for how the time is attributed.
+     */
+    const ICDActiveModeProfiler::Stats & GetActiveModeStats();
+    void ResetActiveModeStats();
+#endif // CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+
 #if CHIP_CONFIG_ENABLE_ICD_CIP
     /**
      * @brief Trigger the ICDManager to send Check-In message if necessary
@@ -232,6 +242,12 @@ public:
      */
     void TriggerCheckInMessages(const std::function<ShouldCheckInMsgsBeSentFunction> & function);
 
+    /**
+     * @brief Time spent in Active Mode for the last round of Check-In messages, from the first request to stay active for a
+     *        Check-In message to the last message sent or resolution failure.
+     */
+    System::Clock::Milliseconds32 GetLastCheckInWindowDuration() const { return mLastCheckInWindowDuration; }
+
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && !CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     /**
      * @brief Set mSubCheckInBootCheckExecuted to true
@@ -314,6 +330,11 @@ private:
      */
     void postObserverEvent(ObserverEventType event);
 
+    /**
+     * @brief Records, when CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING is enabled, what is about to start or extend Active Mode.
+     */
+    void RecordActiveModeCause(ICDActiveModeProfiler::Cause cause);
+
     /**
      * @brief Hepler function that extends the ActiveMode timer as well as the Active Mode Jitter timer for the transition to
      *        idle mode event.
@@ -385,9 +406,17 @@ private:
     bool mSITModeRequested = false;
 #endif
 
+#if CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+    ICDActiveModeProfiler mActiveModeProfiler;
+#endif // CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+
 #if CHIP_CONFIG_ENABLE_ICD_CIP
     uint8_t mCheckInRequestCount = 0;
 
+    // Active Mode duration stats for Check-In messages
+    System::Clock::Timestamp mCheckInWindowStart             = System::Clock::kZero;
+    System::Clock::Milliseconds32 mLastCheckInWindowDuration = System::Clock::kZero;
+
 #if !CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION && CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
     bool mIsBootUpResumeSubscriptionExecuted = false;
 #endif // !CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION && CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
@@ -0,0 +1,83 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/icd/server/ICDActiveModeProfiler.h>
+#include <system/SystemClock.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+using Cause          = ICDActiveModeProfiler::Cause;
+using KeepActiveFlag = ICDListener::KeepActiveFlag;
+
+namespace {
+
+TEST(TestICDActiveModeProfiler, TestTimerCauses)
+{
+    ICDActiveModeProfiler profiler;
+
+    // Time spent in Idle Mode is not counted.
+    profiler.OnActiveModeTimerCause(Cause::kIdleModeDone, 1000_ms64);
+    profiler.OnEnterActiveMode(1000_ms64);
+    profiler.OnActiveModeTimerCause(Cause::kNetworkActivity, 1300_ms64);
+    profiler.OnEnterIdleMode(1800_ms64);
+
+    profiler.OnActiveModeTimerCause(Cause::kSubscriptionReport, 5000_ms64);
+    profiler.OnEnterActiveMode(5000_ms64);
+
+    // The current Active Mode is included.
+    const ICDActiveModeProfiler::Stats & stats = profiler.GetStats(5200_ms64);
+    EXPECT_EQ(stats.activeModeCount, 2u);
+    EXPECT_EQ(stats.activeTime, 1000_ms64);
+    EXPECT_EQ(stats.TimeFor(Cause::kIdleModeDone), 300_ms64);
+    EXPECT_EQ(stats.TimeFor(Cause::kNetworkActivity), 500_ms64);
+    EXPECT_EQ(stats.TimeFor(Cause::kSubscriptionReport), 200_ms64);
+
+    profiler.ResetStats(5200_ms64);
+    EXPECT_EQ(profiler.GetStats(5300_ms64).activeTime, 100_ms64);
+    EXPECT_EQ(profiler.GetStats(5300_ms64).activeModeCount, 0u);
+}
+
+TEST(TestICDActiveModeProfiler, TestKeepActiveRequirements)
+{
+    ICDActiveModeProfiler profiler;
+    ICDListener::KeepActiveFlags flags(KeepActiveFlag::kFailSafeArmed);
+
+    // A requirement brings the device to Active Mode, and is counted for the rest of the Active Mode timer once withdrawn.
+    profiler.OnKeepActiveFlagsChanged(flags, 0_ms64);
+    profiler.OnEnterActiveMode(0_ms64);
+
+    flags.Set(KeepActiveFlag::kExchangeContextOpen);
+    profiler.OnKeepActiveFlagsChanged(flags, 100_ms64);
+    flags.Clear(KeepActiveFlag::kFailSafeArmed);
+    profiler.OnKeepActiveFlagsChanged(flags, 400_ms64);
+    flags.Clear(KeepActiveFlag::kExchangeContextOpen);
+    profiler.OnKeepActiveFlagsChanged(flags, 500_ms64);
+    profiler.OnEnterIdleMode(600_ms64);
+
+    const ICDActiveModeProfiler::Stats & stats = profiler.GetStats(1000_ms64);
+    EXPECT_EQ(stats.activeTime, 600_ms64);
+    // Requirements set together are both counted.
+    EXPECT_EQ(stats.TimeFor(Cause::kFailSafeArmed), 500_ms64);
+    EXPECT_EQ(stats.TimeFor(Cause::kExchangeContextOpen), 400_ms64);
+    EXPECT_EQ(stats.TimeFor(Cause::kIdleModeDone), 0_ms64);
+}
+
+} // namespace
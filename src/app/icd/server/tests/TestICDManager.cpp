@@ -478,6 +478,32 @@ TEST_F(TestICDManager, TestKeepActivemodeRequests)
 }
 
 #if CHIP_CONFIG_ENABLE_ICD_CIP
+/**
+ * @brief Test that the Check-In window lasts from the first sender's request to the last sender's withdrawal
+ */
+TEST_F(TestICDManager, TestCheckInWindowDuration)
+{
+    typedef ICDListener::KeepActiveFlag ActiveFlag;
+    ICDNotifier notifier = ICDNotifier::GetInstance();
+
+    // Two senders waiting for their client's address
+    notifier.NotifyActiveRequestNotification(ActiveFlag::kCheckInInProgress);
+    AdvanceClockAndRunEventLoop(10_ms64);
+    notifier.NotifyActiveRequestNotification(ActiveFlag::kCheckInInProgress);
+    EXPECT_EQ(mICDManager.GetOperaionalState(), ICDManager::OperationalState::ActiveMode);
+
+    AdvanceClockAndRunEventLoop(20_ms64);
+    notifier.NotifyActiveRequestWithdrawal(ActiveFlag::kCheckInInProgress);
+    EXPECT_EQ(mICDManager.GetLastCheckInWindowDuration(), 0_ms32);
+
+    AdvanceClockAndRunEventLoop(30_ms64);
+    notifier.NotifyActiveRequestWithdrawal(ActiveFlag::kCheckInInProgress);
+    EXPECT_EQ(mICDManager.GetLastCheckInWindowDuration(), 60_ms32);
+
+    AdvanceClockAndRunEventLoop(ICDConfigurationData::GetInstance().GetActiveModeDuration() + 1_ms32);
+    EXPECT_EQ(mICDManager.GetOperaionalState(), ICDManager::OperationalState::IdleMode);
+}
+
 /**
  * @brief Test that verifies that the ICDManager is in the correct operating mode based on entries
  *        in the ICDMonitoringTable
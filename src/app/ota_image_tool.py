@@ -25,6 +25,9 @@ Usage examples:
 Creating OTA image file:
 ./ota_image_tool.py create -v 0xDEAD -p 0xBEEF -vn 1 -vs "1.0" -da sha256 my-firmware.bin my-firmware.ota
 
+Creating delta OTA image file, applied to the image of software version 1:
+./ota_image_tool.py create -v 0xDEAD -p 0xBEEF -vn 2 -vs "2.0" -da sha256 -db my-firmware-1.bin -dbv 1 my-firmware-2.bin my-firmware.ota
+
 Showing OTA image file info:
 ./ota_image_tool.py show my-firmware.ota
 """
@@ -77,6 +80,22 @@ class HeaderTag(IntEnum):
     RELEASE_NOTES_URL = 7
     DIGEST_TYPE = 8
     DIGEST = 9
+    DELTA_BASE_VERSION = 10
+    DELTA_BASE_DIGEST = 11
+    DELTA_TARGET_SIZE = 12
+    DELTA_TARGET_DIGEST = 13
+
+
+DELTA_HEADER_TAGS = (HeaderTag.DELTA_BASE_VERSION, HeaderTag.DELTA_BASE_DIGEST,
+                     HeaderTag.DELTA_TARGET_SIZE, HeaderTag.DELTA_TARGET_DIGEST)
+
+# Commands of the delta payload, each followed by two little-endian 32-bit arguments
+DELTA_COMMAND_FORMAT = '<BII'
+DELTA_COPY = 1
+DELTA_INSERT = 2
+
+# Size of the blocks of the base image looked up in the target image
+DELTA_BLOCK_SIZE = 64
 
 
 def warn(message: str):
@@ -111,6 +130,12 @@ def validate_header_attributes(args: object):
     if args.min_version is not None and args.max_version is not None and args.max_version < args.min_version:
         error('Minimum applicable version is greater than maximum applicable version')
 
+    if (args.delta_base is None) != (args.delta_base_version is None):
+        error('Delta base image and version must be given together')
+
+    if args.delta_base_version is not None and args.delta_base_version >= args.version:
+        error('Delta base version is greater or equal to software version')
+
     if args.release_notes is not None:
         if not 1 <= len(args.release_notes) <= 256:
             error('Release notes URL must be of length 1-256')
@@ -142,7 +167,7 @@ def generate_payload_summary(args: object):
     return total_size, digest.digest()
 
 
-def generate_header_tlv(args: object, payload_size: int, payload_digest: bytes):
+def generate_header_tlv(args: object, payload_size: int, payload_digest: bytes, delta_fields: dict = None):
     """
     Generate anonymous TLV structure with fields describing the OTA image contents
     """
@@ -166,6 +191,9 @@ def generate_header_tlv(args: object, payload_size: int, payload_digest: bytes):
     if args.release_notes is not None:
         fields.update({HeaderTag.RELEASE_NOTES_URL: args.release_notes})
 
+    if delta_fields is not None:
+        fields.update(delta_fields)
+
     writer = TLVWriter()
     writer.put(None, fields)
 
@@ -213,6 +241,82 @@ def generate_image(args: object):
     write_image(args, header)
 
 
+def append_delta_insert(delta: bytearray, data: bytes):
+    if data:
+        delta += struct.pack(DELTA_COMMAND_FORMAT, DELTA_INSERT, len(data), 0)
+        delta += data
+
+
+def generate_delta(base: bytes, target: bytes) -> bytes:
+    """
+    Generate the payload of a delta image, which copies the parts of the target image found in the base image
+    and inserts the rest
+    """
+
+    blocks = {}
+    for offset in range(0, len(base) - DELTA_BLOCK_SIZE + 1, DELTA_BLOCK_SIZE):
+        blocks.setdefault(base[offset:offset + DELTA_BLOCK_SIZE], offset)
+
+    delta = bytearray()
+    inserted = 0
+    pos = 0
+    while pos + DELTA_BLOCK_SIZE <= len(target):
+        base_offset = blocks.get(target[pos:pos + DELTA_BLOCK_SIZE])
+        if base_offset is None:
+            pos += 1
+            continue
+
+        # Extend the match over the data not copied yet, in both directions
+        length = DELTA_BLOCK_SIZE
+        while base_offset > 0 and pos > inserted and base[base_offset - 1] == target[pos - 1]:
+            base_offset -= 1
+            pos -= 1
+            length += 1
+        while (base_offset + length < len(base) and pos + length < len(target) and
+               base[base_offset + length] == target[pos + length]):
+            length += 1
+
+        append_delta_insert(delta, target[inserted:pos])
+        delta += struct.pack(DELTA_COMMAND_FORMAT, DELTA_COPY, base_offset, length)
+        pos += length
+        inserted = pos
+
+    append_delta_insert(delta, target[inserted:])
+    return bytes(delta)
+
+
+def generate_delta_image(args: object):
+    """
+    Generate delta OTA image from the base image and the concatenated payload files
+    """
+
+    target = bytearray()
+    for path in args.input_files:
+        with open(path, 'rb') as file:
+            target += file.read()
+
+    with open(args.delta_base, 'rb') as file:
+        base = file.read()
+
+    if len(base) >= 2**32:
+        error('Delta base image is larger than 4 GiB')
+
+    payload = generate_delta(base, bytes(target))
+    delta_fields = {
+        HeaderTag.DELTA_BASE_VERSION: uint(args.delta_base_version),
+        HeaderTag.DELTA_BASE_DIGEST: hashlib.sha256(base).digest(),
+        HeaderTag.DELTA_TARGET_SIZE: uint(len(target)),
+        HeaderTag.DELTA_TARGET_DIGEST: hashlib.sha256(target).digest(),
+    }
+
+    header_tlv = generate_header_tlv(args, len(payload), hashlib.new(args.digest_algorithm, payload).digest(), delta_fields)
+    header = generate_header(header_tlv, len(payload))
+
+    with open(args.output_file, 'wb') as out_file:
+        out_file.write(header)
+        out_file.write(payload)
+
+
 def parse_header(args: object):
     """
     Parse OTA image header
@@ -305,7 +409,9 @@ def update_header_args(args: object) -> None:
     if args.release_notes is None and HeaderTag.RELEASE_NOTES_URL in header_tlv:
         args.release_notes = header_tlv[HeaderTag.RELEASE_NOTES_URL]
 
-    new_header_tlv = generate_header_tlv(args, payload_size, payload_digest)
+    delta_fields = {tag: header_tlv[tag] for tag in DELTA_HEADER_TAGS if tag in header_tlv}
+
+    new_header_tlv = generate_header_tlv(args, payload_size, payload_digest, delta_fields)
     header = generate_header(new_header_tlv, payload_size)
 
     with open(args.image_file, 'rb') as infile, open(args.output_file, 'wb') as outfile:
@@ -340,6 +446,10 @@ def main():
                                help='Maximum software version that can be updated to this image')
     create_parser.add_argument(
         '-rn', '--release-notes', help='Release note URL')
+    create_parser.add_argument('-db', '--delta-base',
+                               help='Path to the image the created delta image applies to')
+    create_parser.add_argument('-dbv', '--delta-base-version', type=any_base_int,
+                               help='Software version of the image the created delta image applies to')
     create_parser.add_argument('input_files', nargs='+',
                                help='Path to input image payload file')
     create_parser.add_argument('output_file', help='Path to output image file')
@@ -376,7 +486,10 @@ def main():
 
     if args.subcommand == 'create':
         validate_header_attributes(args)
-        generate_image(args)
+        if args.delta_base is not None:
+            generate_delta_image(args)
+        else:
+            generate_image(args)
     elif args.subcommand == 'show':
         show_header(args)
     elif args.subcommand == 'extract':
@@ -17,6 +17,7 @@
 #include "app/persistence/AttributePersistenceProvider.h"
 #include <app/persistence/DeferredAttributePersistenceProvider.h>
 
+#include <lib/support/CHIPMem.h>
 #include <platform/CHIPDeviceLayer.h>
 
 namespace chip {
@@ -55,14 +56,139 @@ CHIP_ERROR DeferredAttributePersistenceProvider::WriteValue(const ConcreteAttrib
         }
     }
 
+    if (mWriteBackBudget > 0)
+    {
+        return WriteBack(aPath, aValue);
+    }
+
     return mPersister.WriteValue(aPath, aValue);
 }
 
 CHIP_ERROR DeferredAttributePersistenceProvider::ReadValue(const ConcreteAttributePath & aPath, MutableByteSpan & aValue)
 {
+    const WriteBackEntry * entry = FindWriteBackEntry(aPath);
+    if (entry != nullptr)
+    {
+        return CopySpanToMutableSpan(ByteSpan(entry->mValue.Get(), entry->mValue.AllocatedSize()), aValue);
+    }
+
     return mPersister.ReadValue(aPath, aValue);
 }
 
+void DeferredAttributePersistenceProvider::Flush()
+{
+    for (DeferredAttribute & da : mDeferredAttributes)
+    {
+        da.Flush(mPersister);
+    }
+
+    FlushWriteBackEntries();
+    DeviceLayer::SystemLayer().CancelTimer(OnFlushTimer, this);
+}
+
+DeferredAttributePersistenceProvider::WriteBackEntry *
+DeferredAttributePersistenceProvider::FindWriteBackEntry(const ConcreteAttributePath & aPath) const
+{
+    for (WriteBackEntry * entry = mpWriteBackEntries; entry != nullptr; entry = entry->mpNext)
+    {
+        if (entry->mPath == aPath)
+        {
+            return entry;
+        }
+    }
+
+    return nullptr;
+}
+
+CHIP_ERROR DeferredAttributePersistenceProvider::WriteBack(const ConcreteAttributePath & aPath, const ByteSpan & aValue)
+{
+    WriteBackEntry * entry = FindWriteBackEntry(aPath);
+
+    if (aValue.empty() || Cost(aValue.size()) > mWriteBackBudget)
+    {
+        // A value cached for this attribute must not overwrite this one later.
+        if (entry != nullptr)
+        {
+            FlushWriteBackEntries();
+        }
+        return mPersister.WriteValue(aPath, aValue);
+    }
+
+    size_t used = mWriteBackUsed - ((entry != nullptr) ? Cost(entry->mValue.AllocatedSize()) : 0);
+    if (used + Cost(aValue.size()) > mWriteBackBudget)
+    {
+        FlushWriteBackEntries();
+        entry = nullptr;
+        used  = 0;
+    }
+
+    const bool wasEmpty = (mpWriteBackEntries == nullptr);
+    if (entry == nullptr)
+    {
+        entry = Platform::New<WriteBackEntry>(aPath);
+        VerifyOrReturnValue(entry != nullptr, mPersister.WriteValue(aPath, aValue));
+        entry->mpNext      = mpWriteBackEntries;
+        mpWriteBackEntries = entry;
+    }
+
+    if (entry->mValue.AllocatedSize() != aValue.size())
+    {
+        entry->mValue.Alloc(aValue.size());
+        if (!entry->mValue)
+        {
+            FlushWriteBackEntries();
+            return mPersister.WriteValue(aPath, aValue);
+        }
+    }
+
+    memcpy(entry->mValue.Get(), aValue.data(), aValue.size());
+    mWriteBackUsed = used + Cost(aValue.size());
+
+    // Cached values are written once the oldest of them is writeDelay old, however often they change since.
+    if (wasEmpty)
+    {
+        mWriteBackFlushTime = System::SystemClock().GetMonotonicTimestamp() + mWriteDelay;
+        FlushAndScheduleNext();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void DeferredAttributePersistenceProvider::FlushWriteBackEntries()
+{
+    while (mpWriteBackEntries != nullptr)
+    {
+        WriteBackEntry * entry = mpWriteBackEntries;
+        mpWriteBackEntries     = entry->mpNext;
+
+        if (entry->mValue)
+        {
+            const ByteSpan value(entry->mValue.Get(), entry->mValue.AllocatedSize());
+            TEMPORARY_RETURN_IGNORED mPersister.WriteValue(entry->mPath, value);
+        }
+        Platform::Delete(entry);
+    }
+
+    mWriteBackUsed = 0;
+}
+
+void DeferredAttributePersistenceProvider::FreeWriteBackEntries()
+{
+    while (mpWriteBackEntries != nullptr)
+    {
+        WriteBackEntry * entry = mpWriteBackEntries;
+        mpWriteBackEntries     = entry->mpNext;
+        Platform::Delete(entry);
+    }
+
+    mWriteBackUsed = 0;
+}
+
+void DeferredAttributePersistenceProvider::OnFlushTimer(System::Layer *, void * me)
+{
+    static_cast<DeferredAttributePersistenceProvider *>(me)->FlushAndScheduleNext();
+}
+
 void DeferredAttributePersistenceProvider::FlushAndScheduleNext()
 {
     const System::Clock::Timestamp now     = System::SystemClock().GetMonotonicTimestamp();
@@ -85,12 +211,21 @@ void DeferredAttributePersistenceProvider::FlushAndScheduleNext()
         }
     }
 
+    if (mpWriteBackEntries != nullptr)
+    {
+        if (mWriteBackFlushTime <= now)
+        {
+            FlushWriteBackEntries();
+        }
+        else
+        {
+            nextFlushTime = std::min(nextFlushTime, mWriteBackFlushTime);
+        }
+    }
+
     if (nextFlushTime != System::Clock::Timestamp::max())
     {
-        TEMPORARY_RETURN_IGNORED DeviceLayer::SystemLayer().StartTimer(
-            nextFlushTime - now,
-            [](System::Layer *, void * me) { static_cast<DeferredAttributePersistenceProvider *>(me)->FlushAndScheduleNext(); },
-            this);
+        TEMPORARY_RETURN_IGNORED DeviceLayer::SystemLayer().StartTimer(nextFlushTime - now, OnFlushTimer, this);
     }
 }
 
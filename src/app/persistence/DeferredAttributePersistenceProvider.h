@@ -19,6 +19,9 @@
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/Span.h>
 #include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <cstddef>
 
 namespace chip {
 namespace app {
@@ -48,16 +51,27 @@ private:
  * This class is useful to increase the flash lifetime by reducing the number
  * of writes of fast-changing attributes, such as CurrentLevel attribute of the
  * LevelControl cluster.
+ *
+ * Optionally, the writes of all other attributes can be cached as well, up to a
+ * memory budget: the latest value written to each attribute is kept in memory,
+ * and all cached values are written to the decorated persister together, once
+ * the write delay has elapsed since the first of them was cached.  Call Flush()
+ * before shutting down to write out the values still cached.
  */
 class DeferredAttributePersistenceProvider : public AttributePersistenceProvider
 {
 public:
+    /*
+     * writeBackBudget is the number of bytes of memory the values of other attributes
+     * may be cached in (see WriteValue).  0 disables caching them.
+     */
     DeferredAttributePersistenceProvider(AttributePersistenceProvider & persister,
                                          const Span<DeferredAttribute> & deferredAttributes,
-                                         System::Clock::Milliseconds32 writeDelay) :
+                                         System::Clock::Milliseconds32 writeDelay, size_t writeBackBudget = 0) :
         mPersister(persister),
-        mDeferredAttributes(deferredAttributes), mWriteDelay(writeDelay)
+        mDeferredAttributes(deferredAttributes), mWriteDelay(writeDelay), mWriteBackBudget(writeBackBudget)
     {}
+    ~DeferredAttributePersistenceProvider() override { FreeWriteBackEntries(); }
 
     /*
      * If the written attribute is one of the deferred attributes specified in the constructor,
@@ -65,17 +79,53 @@ public:
      * delay period, further postpone the operation so that the actual write happens once the
      * attribute has remained constant for the write delay period.
      *
-     * For other attributes, immediately pass the write operation to the decorated persister.
+     * For other attributes, if a write-back budget was given, cache the value, replacing any value
+     * cached for the same attribute, and write all cached values once the write delay has elapsed
+     * since the oldest of them was cached.  When the value does not fit in the budget, the cached
+     * values are written right away to make room; a value larger than the whole budget is passed
+     * through.  Without a write-back budget, immediately pass the write operation to the decorated
+     * persister.
      */
     CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override;
+
+    /*
+     * Read the value cached for the attribute, if any, and otherwise read it from the decorated persister.
+     */
     CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, MutableByteSpan & aValue) override;
 
+    /*
+     * Immediately write all pending values, of deferred attributes and of the write-back cache.
+     */
+    void Flush();
+
 private:
+    // The latest value written to an attribute that is not a deferred attribute, with its path.
+    struct WriteBackEntry
+    {
+        explicit WriteBackEntry(const ConcreteAttributePath & path) : mPath(path) {}
+
+        const ConcreteAttributePath mPath;
+        Platform::ScopedMemoryBufferWithSize<uint8_t> mValue;
+        WriteBackEntry * mpNext = nullptr;
+    };
+
+    static size_t Cost(size_t valueSize) { return sizeof(WriteBackEntry) + valueSize; }
+    static void OnFlushTimer(System::Layer *, void * me);
+
+    WriteBackEntry * FindWriteBackEntry(const ConcreteAttributePath & aPath) const;
+    CHIP_ERROR WriteBack(const ConcreteAttributePath & aPath, const ByteSpan & aValue);
+    void FlushWriteBackEntries();
+    void FreeWriteBackEntries();
     void FlushAndScheduleNext();
 
     AttributePersistenceProvider & mPersister;
     const Span<DeferredAttribute> mDeferredAttributes;
     const System::Clock::Milliseconds32 mWriteDelay;
+    const size_t mWriteBackBudget;
+
+    WriteBackEntry * mpWriteBackEntries = nullptr;
+    size_t mWriteBackUsed               = 0;
+    System::Clock::Timestamp mWriteBackFlushTime;
 };
 
 } // namespace app
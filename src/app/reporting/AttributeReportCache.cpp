@@ -0,0 +1,96 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/AttributeReportCache.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+
+#include <cstring>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+CHIP_ERROR AttributeReportCache::Init(size_t capacity)
+{
+    Release();
+    VerifyOrReturnError(capacity > sizeof(EntryHeader), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mBuffer.Alloc(capacity), CHIP_ERROR_NO_MEMORY);
+    mCapacity = capacity;
+    return CHIP_NO_ERROR;
+}
+
+void AttributeReportCache::Release()
+{
+    mBuffer.Free();
+    mCapacity = 0;
+    mUsed     = 0;
+}
+
+bool AttributeReportCache::Find(const Key & aKey, ByteSpan & aEncoding) const
+{
+    for (size_t offset = 0; offset < mUsed;)
+    {
+        EntryHeader header;
+        memcpy(&header, mBuffer.Get() + offset, sizeof(header));
+        offset += sizeof(header);
+
+        if (header.mKey == aKey)
+        {
+            aEncoding = ByteSpan(mBuffer.Get() + offset, header.mLength);
+            return true;
+        }
+        offset += header.mLength;
+    }
+    return false;
+}
+
+bool AttributeReportCache::HasEntryIn(const AttributePathParams & aPath) const
+{
+    for (size_t offset = 0; offset < mUsed;)
+    {
+        EntryHeader header;
+        memcpy(&header, mBuffer.Get() + offset, sizeof(header));
+        offset += sizeof(header) + header.mLength;
+
+        if (aPath.IsAttributePathSupersetOf(header.mKey.mPath))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+MutableByteSpan AttributeReportCache::GetFreeSpace()
+{
+    VerifyOrReturnValue(mCapacity > mUsed + sizeof(EntryHeader), MutableByteSpan());
+    return MutableByteSpan(mBuffer.Get() + mUsed + sizeof(EntryHeader), mCapacity - mUsed - sizeof(EntryHeader));
+}
+
+void AttributeReportCache::Add(const Key & aKey, size_t aLength)
+{
+    VerifyOrReturn(CanCastTo<uint16_t>(aLength) && (aLength <= GetFreeSpace().size()));
+
+    const EntryHeader header{ aKey, static_cast<uint16_t>(aLength) };
+    memcpy(mBuffer.Get() + mUsed, &header, sizeof(header));
+    mUsed += sizeof(header) + aLength;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,115 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/data-model-provider/OperationTypes.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * Attribute data encoded by the reporting engine for one read handler, kept for the rest of an Engine::Run so that other read
+ * handlers reporting the same data can copy the encoding instead of reading and encoding the attribute again.
+ *
+ * An encoding is keyed by everything besides the attribute value that it depends on: the path, the data version, the
+ * accessing fabric and the read flags (which decide what fabric-scoped and fabric-sensitive data is included).  Access
+ * checks are not cached; they are still made for every read handler before its data is looked up.
+ *
+ * Entries are packed into one buffer allocated by Init and freed by Release.  Once it is full, no more entries are added until
+ * it is cleared.
+ */
+class AttributeReportCache
+{
+public:
+    struct Key
+    {
+        ConcreteAttributePath mPath;
+        DataVersion mDataVersion;
+        FabricIndex mAccessingFabricIndex;
+        BitFlags<DataModel::ReadFlags> mReadFlags;
+
+        bool operator==(const Key & other) const
+        {
+            return (mPath == other.mPath) && (mDataVersion == other.mDataVersion) &&
+                (mAccessingFabricIndex == other.mAccessingFabricIndex) && (mReadFlags == other.mReadFlags);
+        }
+    };
+
+    AttributeReportCache() = default;
+    ~AttributeReportCache() { Release(); }
+
+    AttributeReportCache(const AttributeReportCache &)             = delete;
+    AttributeReportCache & operator=(const AttributeReportCache &) = delete;
+
+    CHIP_ERROR Init(size_t capacity);
+    void Release();
+    bool IsInitialized() const { return mBuffer.Get() != nullptr; }
+
+    /**
+     * Drop all entries, keeping the buffer.
+     */
+    void Clear() { mUsed = 0; }
+    bool IsEmpty() const { return mUsed == 0; }
+
+    /**
+     * Whether an entry is stored for an attribute included in aPath.
+     */
+    bool HasEntryIn(const AttributePathParams & aPath) const;
+
+    /**
+     * The encoding stored for aKey, if any.  It stays valid until Release.
+     */
+    bool Find(const Key & aKey, ByteSpan & aEncoding) const;
+
+    /**
+     * Where the encoding of the next entry can be written before it is added with Add.  Empty if the cache is full or not
+     * initialized.
+     */
+    MutableByteSpan GetFreeSpace();
+
+    /**
+     * Add an entry for aKey, whose encoding of aLength bytes was written at the start of GetFreeSpace().
+     */
+    void Add(const Key & aKey, size_t aLength);
+
+private:
+    // Entries are stored as a header followed by the encoding.  Headers are copied in and out since they are not aligned.
+    struct EntryHeader
+    {
+        Key mKey;
+        uint16_t mLength;
+    };
+
+    Platform::ScopedMemoryBuffer<uint8_t> mBuffer;
+    size_t mCapacity = 0;
+    size_t mUsed     = 0;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
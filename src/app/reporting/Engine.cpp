@@ -32,11 +32,16 @@
 #include <app/reporting/Engine.h>
 #include <app/reporting/reporting.h>
 #include <app/util/MatterCallbacks.h>
+#include <clusters/BasicInformation/Ids.h>
+#include <clusters/Descriptor/Ids.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/Defer.h>
+#include <lib/support/MemoryTags.h>
 #include <protocols/interaction_model/StatusCode.h>
 
+#include <algorithm>
 #include <optional>
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -53,6 +58,77 @@ namespace {
 using DataModel::ReadFlags;
 using Protocols::InteractionModel::Status;
 
+/// Remembers cluster-wide ACL results (see AccessControl::CheckCluster) while a report walks
+/// the attributes of a cluster, so the ACL is evaluated once per cluster and privilege rather
+/// than once per attribute. Only the results for the last cluster checked are kept, which is
+/// enough since path expansion visits the attributes of a cluster consecutively.
+///
+/// Reusable results are also kept in the read handler, whose subject never changes, so that the
+/// following reports of a subscription do not evaluate the ACL again until it changes.
+class ClusterAccessCache
+{
+public:
+    explicit ClusterAccessCache(ReadHandler & readHandler) :
+        mSubjectDescriptor(readHandler.GetSubjectDescriptor()), mReadHandler(readHandler)
+    {}
+
+    const SubjectDescriptor & GetSubjectDescriptor() const { return mSubjectDescriptor; }
+
+    /// Same result as `GetAccessControl().Check` for the given request.
+    CHIP_ERROR Check(const RequestPath & requestPath, Privilege requiredPrivilege)
+    {
+        const ConcreteClusterPath cluster(requestPath.endpoint, requestPath.cluster);
+        if (!(cluster == mCluster))
+        {
+            mCluster = cluster;
+            mReadHandler.GetCachedClusterAccess(mCluster, mAllowed, mDenied);
+            mChecked = static_cast<uint8_t>(mAllowed | mDenied);
+        }
+
+        const uint8_t bit = to_underlying(requiredPrivilege);
+        if ((mChecked & bit) == 0)
+        {
+            mChecked = static_cast<uint8_t>(mChecked | bit);
+
+            bool reusable  = false;
+            CHIP_ERROR err = GetAccessControl().CheckCluster(mSubjectDescriptor, requestPath, requiredPrivilege, reusable);
+            if (err == CHIP_NO_ERROR)
+            {
+                mAllowed = static_cast<uint8_t>(mAllowed | bit);
+            }
+            else if (err == CHIP_ERROR_ACCESS_DENIED)
+            {
+                mDenied = static_cast<uint8_t>(mDenied | bit);
+            }
+            if (reusable && (err == CHIP_NO_ERROR || err == CHIP_ERROR_ACCESS_DENIED))
+            {
+                mReadHandler.CacheClusterAccess(mCluster, bit, err == CHIP_NO_ERROR);
+            }
+        }
+
+        if (mAllowed & bit)
+        {
+            return CHIP_NO_ERROR;
+        }
+        if (mDenied & bit)
+        {
+            return CHIP_ERROR_ACCESS_DENIED;
+        }
+        // Depends on the attribute (or the cluster-wide check failed): check each one
+        return GetAccessControl().Check(mSubjectDescriptor, requestPath, requiredPrivilege);
+    }
+
+private:
+    const SubjectDescriptor mSubjectDescriptor;
+    ReadHandler & mReadHandler;
+    ConcreteClusterPath mCluster;
+
+    // Bits of the privileges that were checked for mCluster, and their results
+    uint8_t mChecked = 0;
+    uint8_t mAllowed = 0;
+    uint8_t mDenied  = 0;
+};
+
 /// Returns the status of ACL validation.
 ///   If the return value has a status set, that means the ACL check failed,
 ///   the read must not be performed, and the returned status (which may
@@ -61,8 +137,8 @@ using Protocols::InteractionModel::Status;
 ///
 ///   If the returned value is std::nullopt, that means the ACL check passed and the
 ///   read should proceed.
-std::optional<CHIP_ERROR> ValidateReadAttributeACL(const SubjectDescriptor & subjectDescriptor,
-                                                   const ConcreteReadAttributePath & path, Privilege requiredPrivilege)
+std::optional<CHIP_ERROR> ValidateReadAttributeACL(ClusterAccessCache & accessCache, const ConcreteReadAttributePath & path,
+                                                   Privilege requiredPrivilege)
 {
 
     RequestPath requestPath{ .cluster     = path.mClusterId,
@@ -70,7 +146,7 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(const SubjectDescriptor & sub
                              .requestType = RequestType::kAttributeReadRequest,
                              .entityId    = path.mAttributeId };
 
-    CHIP_ERROR err = GetAccessControl().Check(subjectDescriptor, requestPath, requiredPrivilege);
+    CHIP_ERROR err = accessCache.Check(requestPath, requiredPrivilege);
     if (err == CHIP_NO_ERROR)
     {
         return std::nullopt;
@@ -105,10 +181,201 @@ std::optional<Status> ValidateAttributeIsReadable(DataModel::Provider * dataMode
     return std::nullopt;
 }
 
-DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
-                                                  BitFlags<ReadFlags> flags, AttributeReportIBs::Builder & reportBuilder,
-                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
+/// Reads an attribute that passed the access and existence checks.  Global lists go through `listCache` when it is not null.
+DataModel::ActionReturnStatus ReadAttributeData(DataModel::Provider * dataModel, GlobalAttributeListCache * listCache,
+                                                const DataModel::ReadAttributeRequest & readRequest,
+                                                AttributeValueEncoder & attributeValueEncoder)
+{
+    if (IsSupportedGlobalAttributeNotInMetadata(readRequest.path.mAttributeId))
+    {
+        // Global attributes are NOT directly handled by data model providers, instead
+        // they are routed through metadata.
+        if (listCache != nullptr)
+        {
+            return listCache->Read(dataModel, readRequest.path, attributeValueEncoder);
+        }
+        return ReadGlobalAttributeFromMetadata(dataModel, readRequest.path, attributeValueEncoder);
+    }
+    return dataModel->ReadAttribute(readRequest, attributeValueEncoder);
+}
+
+/// Copies the AttributeReportIBs in the given encoding of an AttributeReportIBs array to `writer`.
+CHIP_ERROR CopyAttributeReportIBs(const ByteSpan & encoding, TLV::TLVWriter & writer)
+{
+    TLV::TLVReader reader;
+    reader.Init(encoding);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+
+    TLV::TLVType containerType;
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(writer.CopyElement(reader));
+    }
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+/// Reads the attribute of `readRequest` and adds its encoding to `cache` as the entry for `key`.
+bool EncodeIntoCache(DataModel::Provider * dataModel, GlobalAttributeListCache * listCache, AttributeReportCache & cache,
+                     const AttributeReportCache::Key & key, const DataModel::ReadAttributeRequest & readRequest,
+                     ByteSpan & encoding)
+{
+    MutableByteSpan space = cache.GetFreeSpace();
+    VerifyOrReturnValue(!space.empty(), false);
+
+    TLV::TLVWriter writer;
+    writer.Init(space);
+    AttributeReportIBs::Builder builder;
+    VerifyOrReturnValue(builder.Init(&writer) == CHIP_NO_ERROR, false);
+
+    AttributeValueEncoder attributeValueEncoder(builder, *readRequest.subjectDescriptor, readRequest.path, key.mDataVersion,
+                                                readRequest.readFlags.Has(ReadFlags::kFabricFiltered));
+    VerifyOrReturnValue(ReadAttributeData(dataModel, listCache, readRequest, attributeValueEncoder).IsSuccess(), false);
+    VerifyOrReturnValue(builder.EndOfAttributeReportIBs() == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(writer.Finalize() == CHIP_NO_ERROR, false);
+
+    cache.Add(key, writer.GetLengthWritten());
+    encoding = ByteSpan(space.data(), writer.GetLengthWritten());
+    return true;
+}
+
+#if CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE > 0
+/// Whether the value of an attribute only changes along with the data version of its cluster or when the attribute is marked
+/// dirty, so that its encoding can be kept across reporting runs.
+bool IsStaticAttribute(const ConcreteAttributePath & path)
+{
+    if (IsSupportedGlobalAttributeNotInMetadata(path.mAttributeId))
+    {
+        return true;
+    }
+
+    switch (path.mClusterId)
+    {
+    case Clusters::Descriptor::Id:
+        switch (path.mAttributeId)
+        {
+        case Clusters::Descriptor::Attributes::DeviceTypeList::Id:
+        case Clusters::Descriptor::Attributes::ServerList::Id:
+        case Clusters::Descriptor::Attributes::ClientList::Id:
+        case Clusters::Descriptor::Attributes::PartsList::Id:
+        case Clusters::Descriptor::Attributes::TagList::Id:
+            return true;
+        default:
+            return false;
+        }
+    case Clusters::BasicInformation::Id:
+        switch (path.mAttributeId)
+        {
+        case Clusters::BasicInformation::Attributes::VendorName::Id:
+        case Clusters::BasicInformation::Attributes::VendorID::Id:
+        case Clusters::BasicInformation::Attributes::ProductName::Id:
+        case Clusters::BasicInformation::Attributes::ProductID::Id:
+        case Clusters::BasicInformation::Attributes::HardwareVersion::Id:
+        case Clusters::BasicInformation::Attributes::HardwareVersionString::Id:
+        case Clusters::BasicInformation::Attributes::SoftwareVersion::Id:
+        case Clusters::BasicInformation::Attributes::SoftwareVersionString::Id:
+        case Clusters::BasicInformation::Attributes::ManufacturingDate::Id:
+        case Clusters::BasicInformation::Attributes::PartNumber::Id:
+        case Clusters::BasicInformation::Attributes::ProductURL::Id:
+        case Clusters::BasicInformation::Attributes::ProductLabel::Id:
+        case Clusters::BasicInformation::Attributes::SerialNumber::Id:
+        case Clusters::BasicInformation::Attributes::UniqueID::Id:
+        case Clusters::BasicInformation::Attributes::CapabilityMinima::Id:
+        case Clusters::BasicInformation::Attributes::ProductAppearance::Id:
+        case Clusters::BasicInformation::Attributes::SpecificationVersion::Id:
+        case Clusters::BasicInformation::Attributes::MaxPathsPerInvoke::Id:
+            return true;
+        default:
+            return false;
+        }
+    default:
+        return false;
+    }
+}
+#endif // CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE > 0
+
+/// Reports an attribute that passed the access and existence checks from `reportCache`, reading and encoding it into the
+/// cache first if no other read handler did in this run.  Static attributes (see IsStaticAttribute) go through `staticCache`
+/// instead, which keeps their encoding across runs.
+///
+/// Returns std::nullopt if the cache cannot be used for this read: the attribute is then to be read directly into the report,
+/// which also takes care of chunking lists and of reporting errors.
+std::optional<DataModel::ActionReturnStatus>
+ReadAttributeThroughCache(DataModel::Provider * dataModel, AttributeReportCache * reportCache, AttributeReportCache * staticCache,
+                          GlobalAttributeListCache * listCache, const DataModel::ReadAttributeRequest & readRequest,
+                          DataVersion version, AttributeReportIBs::Builder & reportBuilder,
+                          const AttributeEncodeState * encoderState)
+{
+#if CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE > 0
+    const bool isStatic = (staticCache != nullptr) && staticCache->IsInitialized() && IsStaticAttribute(readRequest.path);
+    if (isStatic)
+    {
+        reportCache = staticCache;
+    }
+#endif
+    VerifyOrReturnValue((reportCache != nullptr) && reportCache->IsInitialized(), std::nullopt);
+    // Only whole attributes are cached: continuing a chunked list depends on the state of the read handler
+    VerifyOrReturnValue((encoderState == nullptr) || (encoderState->CurrentEncodingListIndex() == kInvalidListIndex), std::nullopt);
+
+    const AttributeReportCache::Key key{ readRequest.path, version, readRequest.subjectDescriptor->fabricIndex,
+                                         readRequest.readFlags };
+
+    ByteSpan encoding;
+    if (!reportCache->Find(key, encoding))
+    {
+        bool encoded = EncodeIntoCache(dataModel, listCache, *reportCache, key, readRequest, encoding);
+#if CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE > 0
+        // Entries of older data versions are never found again: start over rather than stop caching once the cache is full.
+        if (!encoded && isStatic && !reportCache->IsEmpty())
+        {
+            reportCache->Clear();
+            encoded = EncodeIntoCache(dataModel, listCache, *reportCache, key, readRequest, encoding);
+        }
+#endif
+        VerifyOrReturnValue(encoded, std::nullopt);
+    }
+
+    TLV::TLVWriter checkpoint;
+    reportBuilder.Checkpoint(checkpoint);
+    if (CopyAttributeReportIBs(encoding, *reportBuilder.GetWriter()) != CHIP_NO_ERROR)
+    {
+        reportBuilder.Rollback(checkpoint);
+        return std::nullopt;
+    }
+    return DataModel::ActionReturnStatus(CHIP_NO_ERROR);
+}
+
+/// Lower bound of what an AttributeReportIB adds around the value of an attribute: its AttributeDataIB and AttributePathIB
+/// containers, the data version, and the endpoint, cluster and attribute ids in their shortest encodings.
+constexpr size_t kMinAttributeReportIBOverhead = 20;
+
+/// Whether the provider estimates that the attribute of `readRequest` does not fit in what is left of the current chunk.  Only
+/// whole attributes are estimated: a list that was already chunked continues where it stopped.
+bool IsEstimatedLargerThanChunk(DataModel::Provider * dataModel, const DataModel::ReadAttributeRequest & readRequest,
+                                AttributeReportIBs::Builder & reportBuilder, const AttributeEncodeState * encoderState)
+{
+    VerifyOrReturnValue((encoderState == nullptr) || (encoderState->CurrentEncodingListIndex() == kInvalidListIndex), false);
+
+    std::optional<size_t> estimate = dataModel->EstimateAttributeEncodedSize(readRequest);
+    VerifyOrReturnValue(estimate.has_value(), false);
+
+    const size_t freeLength = reportBuilder.GetWriter()->GetRemainingFreeLength();
+    return (*estimate >= freeLength) || (freeLength - *estimate < kMinAttributeReportIBOverhead);
+}
+
+/// `deferredToNextChunk` is null when the attribute is to be attempted regardless of its estimated size (nothing else was
+/// written to the chunk yet).  Otherwise it is set when the attribute is left for the next chunk without being encoded.
+DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, ClusterAccessCache & accessCache,
+                                                  AttributeReportCache * reportCache, AttributeReportCache * staticCache,
+                                                  GlobalAttributeListCache * listCache, BitFlags<ReadFlags> flags,
+                                                  AttributeReportIBs::Builder & reportBuilder,
+                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState,
+                                                  bool * deferredToNextChunk)
 {
+    const SubjectDescriptor & subjectDescriptor = accessCache.GetSubjectDescriptor();
+
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", path.mClusterId,
                   path.mAttributeId);
     DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
@@ -152,7 +419,7 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     DataModel::AttributeFinder finder(dataModel);
     std::optional<DataModel::AttributeEntry> entry = finder.Find(path);
 
-    if (auto access_status = ValidateReadAttributeACL(subjectDescriptor, path, Privilege::kView); access_status.has_value())
+    if (auto access_status = ValidateReadAttributeACL(accessCache, path, Privilege::kView); access_status.has_value())
     {
         status = *access_status;
     }
@@ -164,20 +431,26 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     // entry->GetReadPrivilege() is guaranteed to have a value, since that condition is checked in the previous condition (inside
     // ValidateAttributeIsReadable()).
     // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
-    else if (auto required_privilege_status = ValidateReadAttributeACL(subjectDescriptor, path, entry->GetReadPrivilege().value());
+    else if (auto required_privilege_status = ValidateReadAttributeACL(accessCache, path, entry->GetReadPrivilege().value());
              required_privilege_status.has_value())
     {
         status = *required_privilege_status;
     }
-    else if (IsSupportedGlobalAttributeNotInMetadata(readRequest.path.mAttributeId))
+    else if ((deferredToNextChunk != nullptr) && IsEstimatedLargerThanChunk(dataModel, readRequest, reportBuilder, encoderState))
     {
-        // Global attributes are NOT directly handled by data model providers, instead
-        // they are routed through metadata.
-        status = ReadGlobalAttributeFromMetadata(dataModel, readRequest.path, attributeValueEncoder);
+        *deferredToNextChunk = true;
+        status               = CHIP_ERROR_BUFFER_TOO_SMALL;
+    }
+    else if (auto cached_status =
+                 ReadAttributeThroughCache(dataModel, reportCache, staticCache, listCache, readRequest, version, reportBuilder,
+                                           encoderState);
+             cached_status.has_value())
+    {
+        status = *cached_status;
     }
     else
     {
-        status = dataModel->ReadAttribute(readRequest, attributeValueEncoder);
+        status = ReadAttributeData(dataModel, listCache, readRequest, attributeValueEncoder);
     }
 
     if (status.IsSuccess())
@@ -310,6 +583,19 @@ CHIP_ERROR Engine::Init(EventManagement * apEventManagement)
     mCurReadHandlerIdx  = 0;
     mpEventManagement   = apEventManagement;
 
+#if CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE > 0
+    if (mStaticAttributeCache.Init(CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE) != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "No memory for the static attribute cache");
+    }
+#endif
+#if CHIP_CONFIG_IM_GLOBAL_ATTRIBUTE_LIST_CACHE_SIZE > 0
+    if (mGlobalAttributeListCache.Init(CHIP_CONFIG_IM_GLOBAL_ATTRIBUTE_LIST_CACHE_SIZE) != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "No memory for the global attribute list cache");
+    }
+#endif
+
     return CHIP_NO_ERROR;
 }
 
@@ -321,25 +607,57 @@ void Engine::Shutdown()
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
     mGlobalDirtySet.ReleaseAll();
+#if CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE > 0
+    mStaticAttributeCache.Release();
+#endif
+#if CHIP_CONFIG_IM_GLOBAL_ATTRIBUTE_LIST_CACHE_SIZE > 0
+    mGlobalAttributeListCache.Release();
+#endif
+#if CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES > 0
+    mReportThrottle.Clear();
+    Messaging::ExchangeManager * exchangeManager = mpImEngine->GetExchangeManager();
+    if (exchangeManager != nullptr && exchangeManager->GetSessionManager() != nullptr &&
+        exchangeManager->GetSessionManager()->SystemLayer() != nullptr)
+    {
+        exchangeManager->GetSessionManager()->SystemLayer()->CancelTimer(HandleReportThrottleTimer, this);
+    }
+#endif
 }
 
-bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
-                                       const ConcreteReadAttributePath & aPath)
+bool Engine::IsClusterDataVersionMatch(const ReadHandler & aReadHandler, const ConcreteClusterPath & aPath)
 {
     bool existPathMatch       = false;
     bool existVersionMismatch = false;
-    for (auto filter = aDataVersionFilterList; filter != nullptr; filter = filter->mpNext)
+
+    auto checkFilter = [&](const DataVersionFilter & filter) {
+        existPathMatch = true;
+        if (!IsClusterDataVersionEqualTo(mpImEngine->GetDataModelProvider(), aPath, filter.mDataVersion.Value()))
+        {
+            existVersionMismatch = true;
+        }
+    };
+
+    Span<const DataVersionFilter> sortedFilters = aReadHandler.GetSortedDataVersionFilters();
+    if (!sortedFilters.empty())
     {
-        if (aPath.mEndpointId == filter->mValue.mEndpointId && aPath.mClusterId == filter->mValue.mClusterId)
+        auto filter = std::lower_bound(sortedFilters.begin(), sortedFilters.end(), aPath,
+                                       [](const DataVersionFilter & a, const ConcreteClusterPath & b) {
+                                           return a.mEndpointId < b.mEndpointId ||
+                                               (a.mEndpointId == b.mEndpointId && a.mClusterId < b.mClusterId);
+                                       });
+        for (; filter != sortedFilters.end() && filter->mEndpointId == aPath.mEndpointId && filter->mClusterId == aPath.mClusterId;
+             ++filter)
         {
-            existPathMatch = true;
+            checkFilter(*filter);
+        }
+        return existPathMatch && !existVersionMismatch;
+    }
 
-            if (!IsClusterDataVersionEqualTo(mpImEngine->GetDataModelProvider(),
-                                             ConcreteClusterPath(filter->mValue.mEndpointId, filter->mValue.mClusterId),
-                                             filter->mValue.mDataVersion.Value()))
-            {
-                existVersionMismatch = true;
-            }
+    for (auto filter = aReadHandler.GetDataVersionFilterList(); filter != nullptr; filter = filter->mpNext)
+    {
+        if (aPath.mEndpointId == filter->mValue.mEndpointId && aPath.mClusterId == filter->mValue.mClusterId)
+        {
+            checkFilter(filter->mValue);
         }
     }
     return existPathMatch && !existVersionMismatch;
@@ -361,6 +679,9 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
     const uint32_t kReservedSizeEndOfReportIBs = 1;
     bool reservedEndOfReportIBs                = false;
 
+    mNumEncodeRollbacksInReport    = 0;
+    mNumEstimatedDeferralsInReport = 0;
+
     aReportDataBuilder.Checkpoint(backup);
 
     AttributeReportIBs::Builder & attributeReportIBs = aReportDataBuilder.CreateAttributeReportIBs();
@@ -396,6 +717,27 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         uint32_t attributesRead = 0;
 #endif
 
+        ClusterAccessCache accessCache(*apReadHandler);
+#if CHIP_CONFIG_IM_REPORT_ENCODE_CACHE_SIZE > 0
+        AttributeReportCache * reportCache = &mAttributeReportCache;
+#else
+        AttributeReportCache * reportCache = nullptr;
+#endif
+#if CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE > 0
+        AttributeReportCache * staticCache = &mStaticAttributeCache;
+#else
+        AttributeReportCache * staticCache = nullptr;
+#endif
+#if CHIP_CONFIG_IM_GLOBAL_ATTRIBUTE_LIST_CACHE_SIZE > 0
+        GlobalAttributeListCache * listCache = mGlobalAttributeListCache.IsInitialized() ? &mGlobalAttributeListCache : nullptr;
+#else
+        GlobalAttributeListCache * listCache = nullptr;
+#endif
+
+        // Data version filter result of the last cluster the priming report went through.
+        std::optional<ConcreteClusterPath> primingClusterPath;
+        bool primingClusterMatches = false;
+
         // For each path included in the interested path of the read handler...
         for (RollbackAttributePathExpandIterator iterator(mpImEngine->GetDataModelProvider(),
                                                           apReadHandler->AttributeIterationPosition());
@@ -403,23 +745,10 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         {
             if (!apReadHandler->IsPriming())
             {
-                bool concretePathDirty = false;
+                // We don't need to worry about paths that were already marked dirty before the last time this read handler
+                // started a report that it completed: those paths already got reported.
                 // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration > apReadHandler->mPreviousReportsBeginGeneration)
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
-
-                if (!concretePathDirty)
+                if (!IsPathDirtySince(readPath, apReadHandler->mPreviousReportsBeginGeneration))
                 {
                     // This attribute is not dirty, we just skip this one.
                     continue;
@@ -427,7 +756,14 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             }
             else
             {
-                if (IsClusterDataVersionMatch(apReadHandler->GetDataVersionFilterList(), readPath))
+                // The paths of a cluster come one after the other, so the filters are only looked up once per cluster: the
+                // other attributes of a cluster whose version matches are skipped on the path comparison alone.
+                if (!primingClusterPath.has_value() || *primingClusterPath != ConcreteClusterPath(readPath))
+                {
+                    primingClusterPath.emplace(readPath);
+                    primingClusterMatches = IsClusterDataVersionMatch(*apReadHandler, readPath);
+                }
+                if (primingClusterMatches)
                 {
                     continue;
                 }
@@ -451,9 +787,12 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             BitFlags<ReadFlags> flags;
             flags.Set(ReadFlags::kFabricFiltered, apReadHandler->IsFabricFiltered());
             flags.Set(ReadFlags::kAllowsLargePayload, apReadHandler->AllowsLargePayload());
+            // The first attribute of a chunk is always attempted, so that attributes larger than their estimate still go out.
+            bool deferredToNextChunk = false;
+            const bool mayDefer      = attributeReportIBs.GetWriter()->GetLengthWritten() != emptyReportDataLength;
             DataModel::ActionReturnStatus status =
-                RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(), flags,
-                                    attributeReportIBs, pathForRetrieval, &encodeState);
+                RetrieveClusterData(mpImEngine->GetDataModelProvider(), accessCache, reportCache, staticCache, listCache, flags,
+                                    attributeReportIBs, pathForRetrieval, &encodeState, mayDefer ? &deferredToNextChunk : nullptr);
             if (status.IsError())
             {
                 // Operation error set, since this will affect early return or override on status encoding
@@ -500,8 +839,17 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
                             attributeReportIBs.Rollback(attributeBackup);
                         }
                     }
+                    else if (deferredToNextChunk)
+                    {
+                        mNumEstimatedDeferralsInReport++;
+                        ChipLogDetail(DataManagement,
+                                      "Next attribute value is estimated not to fit in packet, leave it for next chunk on "
+                                      "clusterId: " ChipLogFormatMEI ", attributeId: " ChipLogFormatMEI,
+                                      ChipLogValueMEI(pathForRetrieval.mClusterId), ChipLogValueMEI(pathForRetrieval.mAttributeId));
+                    }
                     else
                     {
+                        mNumEncodeRollbacksInReport++;
                         ChipLogDetail(DataManagement,
                                       "Next attribute value does not fit in packet, roll back on clusterId: " ChipLogFormatMEI
                                       ", attributeId: " ChipLogFormatMEI ", err = %" CHIP_ERROR_FORMAT,
@@ -846,7 +1194,10 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     err = reportDataWriter.Finalize(&bufHandle);
     SuccessOrExit(err);
 
-    ChipLogDetail(DataManagement, "<RE> Sending report (payload has %" PRIu32 " bytes)...", reportDataWriter.GetLengthWritten());
+    ChipLogDetail(DataManagement,
+                  "<RE> Sending report (payload has %" PRIu32 " bytes, %" PRIu32 " encode rollbacks, %" PRIu32
+                  " attributes left for next chunk on estimate)...",
+                  reportDataWriter.GetLengthWritten(), mNumEncodeRollbacksInReport, mNumEstimatedDeferralsInReport);
     err = SendReport(apReadHandler, std::move(bufHandle), hasMoreChunks);
     SuccessOrExitAction(
         err, ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
@@ -905,11 +1256,22 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kInteractionModel);
     uint32_t numReadHandled = 0;
 
     // We may be deallocating read handlers as we go.  Track how many we had
     // initially, so we make sure to go through all of them.
     size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
+
+#if CHIP_CONFIG_IM_REPORT_ENCODE_CACHE_SIZE > 0
+    // Read handlers reporting the same attribute data in this run share its encoding
+    if (initialAllocated > 1 && mAttributeReportCache.Init(CHIP_CONFIG_IM_REPORT_ENCODE_CACHE_SIZE) != CHIP_NO_ERROR)
+    {
+        ChipLogDetail(DataManagement, "<RE:Run> No memory for the report encode cache");
+    }
+    auto releaseReportCache = MakeDefer([this] { mAttributeReportCache.Release(); });
+#endif
+
     while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < initialAllocated))
     {
         ReadHandler * readHandler =
@@ -965,9 +1327,28 @@ void Engine::Run()
     }
 }
 
+bool Engine::IsPathDirtySince(const ConcreteReadAttributePath & aPath, uint64_t aGeneration)
+{
+    auto isDirtySince = [&](auto * dirtyPath) {
+        if (dirtyPath->IsAttributePathSupersetOf(aPath) && dirtyPath->mGeneration > aGeneration)
+        {
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    };
+
+#if CHIP_CONFIG_IM_INDEXED_DIRTY_SET
+    return Loop::Break ==
+        mGlobalDirtySet.ForEachCandidateOverlapping(AttributePathParams(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId),
+                                                    std::move(isDirtySince));
+#else
+    return Loop::Break == mGlobalDirtySet.ForEachActiveObject(std::move(isDirtySince));
+#endif
+}
+
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
 {
-    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
+    auto mergeOverlapped = [&](auto * path) {
         if (path->IsAttributePathSupersetOf(aAttributePath))
         {
             path->mGeneration = GetDirtySetGeneration();
@@ -979,15 +1360,25 @@ bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttribute
             // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
             // want.
             // It is better to eliminate the duplicate wildcard paths in follow-up
-            path->mGeneration  = GetDirtySetGeneration();
+            path->mGeneration = GetDirtySetGeneration();
+#if CHIP_CONFIG_IM_INDEXED_DIRTY_SET
+            mGlobalDirtySet.UpdatePath(path, aAttributePath);
+#else
             path->mEndpointId  = aAttributePath.mEndpointId;
             path->mClusterId   = aAttributePath.mClusterId;
             path->mListIndex   = aAttributePath.mListIndex;
             path->mAttributeId = aAttributePath.mAttributeId;
+#endif
             return Loop::Break;
         }
         return Loop::Continue;
-    });
+    };
+
+#if CHIP_CONFIG_IM_INDEXED_DIRTY_SET
+    return Loop::Break == mGlobalDirtySet.ForEachCandidateOverlapping(aAttributePath, std::move(mergeOverlapped));
+#else
+    return Loop::Break == mGlobalDirtySet.ForEachActiveObject(std::move(mergeOverlapped));
+#endif
 }
 
 bool Engine::ClearTombPaths()
@@ -1006,6 +1397,9 @@ bool Engine::ClearTombPaths()
 
 bool Engine::MergeDirtyPathsUnderSameCluster()
 {
+#if CHIP_CONFIG_IM_INDEXED_DIRTY_SET
+    return mGlobalDirtySet.MergePathsUnderSameCluster();
+#else
     mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
         if (outerPath->HasWildcardClusterId() || outerPath->mGeneration == 0)
         {
@@ -1037,10 +1431,14 @@ bool Engine::MergeDirtyPathsUnderSameCluster()
     });
 
     return ClearTombPaths();
+#endif // CHIP_CONFIG_IM_INDEXED_DIRTY_SET
 }
 
 bool Engine::MergeDirtyPathsUnderSameEndpoint()
 {
+#if CHIP_CONFIG_IM_INDEXED_DIRTY_SET
+    return mGlobalDirtySet.MergePathsUnderSameEndpoint();
+#else
     mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
         if (outerPath->HasWildcardEndpointId() || outerPath->mGeneration == 0)
         {
@@ -1070,6 +1468,7 @@ bool Engine::MergeDirtyPathsUnderSameEndpoint()
         return Loop::Continue;
     });
     return ClearTombPaths();
+#endif // CHIP_CONFIG_IM_INDEXED_DIRTY_SET
 }
 
 CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
@@ -1087,14 +1486,13 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
     VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
     ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
 
-    auto object = mGlobalDirtySet.CreateObject();
+    auto object = mGlobalDirtySet.CreateObject(aAttributePath);
     if (object == nullptr)
     {
         // This should not happen, this path should be merged into the wildcard endpoint at least.
         ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
         return CHIP_ERROR_NO_MEMORY;
     }
-    *object             = aAttributePath;
     object->mGeneration = GetDirtySetGeneration();
 
     return CHIP_NO_ERROR;
@@ -1102,29 +1500,64 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
 
 CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
+#if CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES > 0
+    if (mReportThrottle.PolicyCount() > 0)
+    {
+        Messaging::ExchangeManager * exchangeManager = mpImEngine->GetExchangeManager();
+        SessionManager * sessionManager = (exchangeManager != nullptr) ? exchangeManager->GetSessionManager() : nullptr;
+        System::Layer * systemLayer     = (sessionManager != nullptr) ? sessionManager->SystemLayer() : nullptr;
+        // Without a system layer the held back change could not be reported later, so report it now.
+        if (systemLayer != nullptr &&
+            mReportThrottle.OnDirty(aAttributePath, System::SystemClock().GetMonotonicMilliseconds64()) ==
+                decltype(mReportThrottle)::Decision::kDefer)
+        {
+            ScheduleReportThrottleTimer(*systemLayer);
+            return CHIP_NO_ERROR;
+        }
+    }
+#endif
+
     BumpDirtySetGeneration();
 
+#if CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE > 0
+    // Static attributes can change without a data version bump (e.g. the parts list when endpoints are added), so drop what
+    // was cached for them.
+    if (mStaticAttributeCache.HasEntryIn(aAttributePath))
+    {
+        mStaticAttributeCache.Clear();
+    }
+#endif
+#if CHIP_CONFIG_IM_GLOBAL_ATTRIBUTE_LIST_CACHE_SIZE > 0
+    // Metadata changes are reported by marking the paths of the global lists dirty.
+    mGlobalAttributeListCache.Invalidate(aAttributePath);
+#endif
+
     bool intersectsInterestPath     = false;
     DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
-    mpImEngine->mReadHandlers.ForEachActiveObject([&dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
+    auto markHandlerDirty           = [&dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
         // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
         // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
         // waiting for a response to the last message chunk for read interactions.
-        if (handler->CanStartReporting() || handler->IsAwaitingReportResponse())
+        if ((handler->CanStartReporting() || handler->IsAwaitingReportResponse()) && handler->IsInterestedIn(aAttributePath))
         {
-            for (auto object = handler->GetAttributePathList(); object != nullptr; object = object->mpNext)
-            {
-                if (object->mValue.Intersects(aAttributePath))
-                {
-                    handler->AttributePathIsDirty(dataModel, aAttributePath);
-                    intersectsInterestPath = true;
-                    break;
-                }
-            }
+            handler->AttributePathIsDirty(dataModel, aAttributePath);
+            intersectsInterestPath = true;
         }
 
         return Loop::Continue;
-    });
+    };
+
+#if CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX
+    // Only visit the handlers that subscribed to something on this cluster, rather than every active handler.
+    if (mpImEngine->mReadHandlerInterestIndex.CanLookup(aAttributePath))
+    {
+        mpImEngine->mReadHandlerInterestIndex.ForEachInterestedHandler(aAttributePath, markHandlerDirty);
+    }
+    else
+#endif // CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX
+    {
+        mpImEngine->mReadHandlers.ForEachActiveObject(std::move(markHandlerDirty));
+    }
 
     if (!intersectsInterestPath)
     {
@@ -1265,6 +1698,42 @@ void Engine::MarkDirty(const AttributePathParams & path)
     }
 }
 
+#if CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES > 0
+void Engine::ScheduleReportThrottleTimer(System::Layer & aSystemLayer)
+{
+    System::Clock::Milliseconds64 deadline;
+    if (!mReportThrottle.NextDeadline(deadline))
+    {
+        aSystemLayer.CancelTimer(HandleReportThrottleTimer, this);
+        return;
+    }
+
+    const System::Clock::Milliseconds64 now   = System::SystemClock().GetMonotonicMilliseconds64();
+    const System::Clock::Milliseconds64 delay = (deadline > now) ? deadline - now : System::Clock::Milliseconds64(0);
+    CHIP_ERROR err =
+        aSystemLayer.StartTimer(std::chrono::duration_cast<System::Clock::Timeout>(delay), HandleReportThrottleTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Report the held back changes now rather than losing them.
+        ChipLogError(DataManagement, "Failed to start the report throttle timer: %" CHIP_ERROR_FORMAT, err.Format());
+        mReportThrottle.Flush([this](const ConcreteAttributePath & path) {
+            MarkDirty(AttributePathParams(path.mEndpointId, path.mClusterId, path.mAttributeId));
+        });
+    }
+}
+
+void Engine::HandleReportThrottleTimer(System::Layer * aSystemLayer, void * apAppState)
+{
+    auto * const engine                     = static_cast<Engine *>(apAppState);
+    const System::Clock::Milliseconds64 now = System::SystemClock().GetMonotonicMilliseconds64();
+    engine->mReportThrottle.ForEachDue(now, [engine](const ConcreteAttributePath & path) {
+        // The window of the path has ended, so this marks it dirty and opens a new window.
+        engine->MarkDirty(AttributePathParams(path.mEndpointId, path.mClusterId, path.mAttributeId));
+    });
+    engine->ScheduleReportThrottleTimer(*aSystemLayer);
+}
+#endif // CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES > 0
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -29,6 +29,10 @@
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
 #include <app/data-model-provider/ProviderChangeListener.h>
+#include <app/reporting/AttributeReportCache.h>
+#include <app/reporting/GlobalAttributeListCache.h>
+#include <app/reporting/IndexedDirtySet.h>
+#include <app/reporting/ReportThrottle.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -123,8 +127,29 @@ public:
 
     uint32_t GetNumReportsInFlight() const { return mNumReportsInFlight; }
 
+    /**
+     * Number of attributes that did not fit in the last report message built, and whose encoding was rolled back to be
+     * attempted again in the next chunk.  Attributes the data model provider estimated not to fit (see
+     * DataModel::Provider::EstimateAttributeEncodedSize) are left for the next chunk without an attempt, and are counted by
+     * GetNumEstimatedDeferralsInLastReport instead.
+     */
+    uint32_t GetNumEncodeRollbacksInLastReport() const { return mNumEncodeRollbacksInReport; }
+    uint32_t GetNumEstimatedDeferralsInLastReport() const { return mNumEstimatedDeferralsInReport; }
+
     uint64_t GetDirtySetGeneration() const { return mDirtyGeneration; }
 
+#if CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES > 0
+    /**
+     * Sets the minimum interval between reported changes of an attribute, on any endpoint (quieter reporting).  SetDirty holds
+     * back changes made during the interval and marks the path dirty again when it ends, so that its last value is reported.
+     * Meant for attributes updated on every step of a transition.  An interval of 0 removes the throttling.
+     */
+    CHIP_ERROR SetReportThrottleInterval(ClusterId aClusterId, AttributeId aAttributeId, System::Clock::Milliseconds32 aInterval)
+    {
+        return mReportThrottle.SetInterval(aClusterId, aAttributeId, aInterval);
+    }
+#endif
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     size_t GetGlobalDirtySetSize() { return mGlobalDirtySet.Allocated(); }
 #endif
@@ -176,8 +201,9 @@ private:
     // of those will fail to match.  This function should return false if either nothing in the list matches the given
     // endpoint+cluster in the path or there is an entry in the list that matches the endpoint+cluster in the path but does not
     // match the current data version of that cluster.
-    bool IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
-                                   const ConcreteReadAttributePath & aPath);
+    //
+    // The sorted filters of the handler are binary searched when available, otherwise its filter list is walked.
+    bool IsClusterDataVersionMatch(const ReadHandler & aReadHandler, const ConcreteClusterPath & aPath);
 
     /**
      *  EventReporter implementation.
@@ -197,6 +223,11 @@ private:
      */
     static void Run(System::Layer * aSystemLayer, void * apAppState);
 
+#if CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES > 0
+    static void HandleReportThrottleTimer(System::Layer * aSystemLayer, void * apAppState);
+    void ScheduleReportThrottleTimer(System::Layer & aSystemLayer);
+#endif
+
     CHIP_ERROR ScheduleBufferPressureEventDelivery(uint32_t aBytesWritten);
     void GetMinEventLogPosition(uint32_t & aMinLogPosition);
 
@@ -233,6 +264,11 @@ private:
 
     CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
 
+    /**
+     * Returns whether the global dirty set holds a superset of the given path that was marked dirty after the given generation.
+     */
+    bool IsPathDirtySince(const ConcreteReadAttributePath & aPath, uint64_t aGeneration);
+
     inline void BumpDirtySetGeneration() { mDirtyGeneration++; }
 
     /**
@@ -248,6 +284,13 @@ private:
      */
     uint32_t mNumReportsInFlight = 0;
 
+    /**
+     * Attributes rolled back for lack of space, and attributes left for the next chunk on their estimated size, in the report
+     * message being built.
+     */
+    uint32_t mNumEncodeRollbacksInReport    = 0;
+    uint32_t mNumEstimatedDeferralsInReport = 0;
+
     /**
      *  Current read handler index
      *
@@ -263,7 +306,9 @@ private:
      *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
      *
      */
-#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+#if CHIP_CONFIG_IM_INDEXED_DIRTY_SET
+    IndexedDirtySet<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
+#elif CONFIG_BUILD_FOR_HOST_UNIT_TEST
     // For unit tests, always use inline allocation for code coverage.
     ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mGlobalDirtySet;
 #else
@@ -284,6 +329,33 @@ private:
      */
     uint64_t mDirtyGeneration = 1;
 
+#if CHIP_CONFIG_IM_REPORT_ENCODE_CACHE_SIZE > 0
+    /**
+     * The attribute data encoded during the current Run, shared by the read handlers it reports to.
+     */
+    AttributeReportCache mAttributeReportCache;
+#endif
+
+#if CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE > 0
+    /**
+     * The encodings of attributes that rarely change (descriptor lists, basic information strings, global lists), kept across
+     * runs.  Entries are keyed by data version and the cache is cleared when one of its attributes is marked dirty.
+     */
+    AttributeReportCache mStaticAttributeCache;
+#endif
+
+#if CHIP_CONFIG_IM_GLOBAL_ATTRIBUTE_LIST_CACHE_SIZE > 0
+    /**
+     * The AttributeList, AcceptedCommandList and GeneratedCommandList of the reported clusters, kept across runs and shared by
+     * clusters with identical lists.
+     */
+    GlobalAttributeListCache mGlobalAttributeListCache;
+#endif
+
+#if CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES > 0
+    ReportThrottle<CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES, CHIP_CONFIG_IM_REPORT_THROTTLE_PATHS> mReportThrottle;
+#endif
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     uint32_t mReservedSize          = 0;
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
@@ -0,0 +1,207 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/GlobalAttributeListCache.h>
+
+#include <app/GlobalAttributes.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ReadOnlyBuffer.h>
+#include <lib/support/SafeInt.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+CHIP_ERROR GlobalAttributeListCache::Init(size_t capacity)
+{
+    Release();
+    VerifyOrReturnError(capacity > sizeof(EntryHeader) && CanCastTo<uint16_t>(capacity), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mBuffer.Alloc(capacity), CHIP_ERROR_NO_MEMORY);
+    mCapacity = capacity;
+    Clear();
+    return CHIP_NO_ERROR;
+}
+
+void GlobalAttributeListCache::Release()
+{
+    mBuffer.Free();
+    mCapacity = 0;
+    Clear();
+}
+
+void GlobalAttributeListCache::Clear()
+{
+    mProvider   = nullptr;
+    mEntriesEnd = 0;
+    mListsStart = mCapacity;
+}
+
+void GlobalAttributeListCache::Invalidate(const AttributePathParams & aPath)
+{
+    for (size_t offset = 0; offset < mEntriesEnd; offset += sizeof(EntryHeader))
+    {
+        EntryHeader header;
+        memcpy(&header, mBuffer.Get() + offset, sizeof(header));
+
+        for (AttributeId attributeId : GlobalAttributesNotInMetadata)
+        {
+            const ConcreteAttributePath listPath(header.mPath.mEndpointId, header.mPath.mClusterId, attributeId);
+            if (aPath.IsAttributePathSupersetOf(listPath))
+            {
+                // Lists are shared between clusters, so they are not dropped one by one.
+                Clear();
+                return;
+            }
+        }
+    }
+}
+
+DataModel::ActionReturnStatus GlobalAttributeListCache::Read(DataModel::Provider * aProvider, const ConcreteAttributePath & aPath,
+                                                             AttributeValueEncoder & aEncoder)
+{
+    const auto * list =
+        std::find(std::begin(GlobalAttributesNotInMetadata), std::end(GlobalAttributesNotInMetadata), aPath.mAttributeId);
+    VerifyOrReturnValue(IsInitialized() && (list != std::end(GlobalAttributesNotInMetadata)),
+                        ReadGlobalAttributeFromMetadata(aProvider, aPath, aEncoder));
+
+    if (aProvider != mProvider)
+    {
+        Clear();
+        mProvider = aProvider;
+    }
+
+    uint16_t listOffsets[kListCount];
+    if (!Find(aPath, listOffsets) && !Fill(aProvider, aPath, listOffsets))
+    {
+        return ReadGlobalAttributeFromMetadata(aProvider, aPath, aEncoder);
+    }
+
+    const uint8_t * listData = mBuffer.Get() + listOffsets[list - std::begin(GlobalAttributesNotInMetadata)];
+    ListHeader header;
+    memcpy(&header, listData, sizeof(header));
+    listData += sizeof(header);
+
+    return aEncoder.EncodeList([&header, listData](const auto & listEncodeHelper) {
+        for (size_t i = 0; i < header.mCount; i++)
+        {
+            uint32_t id;
+            memcpy(&id, listData + i * sizeof(id), sizeof(id));
+            // NOTE: cast to u64 like ReadGlobalAttributeFromMetadata, to share its Encode template variant.
+            ReturnErrorOnFailure(listEncodeHelper.Encode(static_cast<uint64_t>(id)));
+        }
+        return CHIP_NO_ERROR;
+    });
+}
+
+bool GlobalAttributeListCache::Find(const ConcreteClusterPath & aPath, uint16_t (&aListOffsets)[kListCount]) const
+{
+    for (size_t offset = 0; offset < mEntriesEnd; offset += sizeof(EntryHeader))
+    {
+        EntryHeader header;
+        memcpy(&header, mBuffer.Get() + offset, sizeof(header));
+
+        if (header.mPath == aPath)
+        {
+            memcpy(aListOffsets, header.mListOffsets, sizeof(aListOffsets));
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GlobalAttributeListCache::Fill(DataModel::Provider * aProvider, const ConcreteClusterPath & aPath,
+                                    uint16_t (&aListOffsets)[kListCount])
+{
+    // Errors (e.g. an unknown cluster) are left for ReadGlobalAttributeFromMetadata to report.
+    ReadOnlyBufferBuilder<DataModel::AttributeEntry> attributesBuilder;
+    ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> acceptedCommandsBuilder;
+    ReadOnlyBufferBuilder<CommandId> generatedCommandsBuilder;
+    VerifyOrReturnValue(aProvider->Attributes(aPath, attributesBuilder) == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(aProvider->AcceptedCommands(aPath, acceptedCommandsBuilder) == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(aProvider->GeneratedCommands(aPath, generatedCommandsBuilder) == CHIP_NO_ERROR, false);
+
+    auto attributes        = attributesBuilder.TakeBuffer();
+    auto acceptedCommands  = acceptedCommandsBuilder.TakeBuffer();
+    auto generatedCommands = generatedCommandsBuilder.TakeBuffer();
+
+    Platform::ScopedMemoryBuffer<uint32_t> ids;
+    const size_t maxCount = std::max({ attributes.size(), acceptedCommands.size(), generatedCommands.size() });
+    VerifyOrReturnValue(ids.Calloc(std::max<size_t>(maxCount, 1)), false);
+
+    // Lists stored before a failure are dropped, lists shared with other clusters stay.
+    const size_t listsStart = mListsStart;
+    bool stored             = true;
+
+    // In the order of GlobalAttributesNotInMetadata.
+    std::copy(generatedCommands.begin(), generatedCommands.end(), ids.Get());
+    stored = stored && StoreList(Span<const uint32_t>(ids.Get(), generatedCommands.size()), aListOffsets[0]);
+
+    std::transform(acceptedCommands.begin(), acceptedCommands.end(), ids.Get(), [](const auto & entry) { return entry.commandId; });
+    stored = stored && StoreList(Span<const uint32_t>(ids.Get(), acceptedCommands.size()), aListOffsets[1]);
+
+    std::transform(attributes.begin(), attributes.end(), ids.Get(), [](const auto & entry) { return entry.attributeId; });
+    stored = stored && StoreList(Span<const uint32_t>(ids.Get(), attributes.size()), aListOffsets[2]);
+
+    if (!stored || (mListsStart - mEntriesEnd < sizeof(EntryHeader)))
+    {
+        mListsStart = listsStart;
+        return false;
+    }
+
+    EntryHeader header{ aPath, {} };
+    memcpy(header.mListOffsets, aListOffsets, sizeof(header.mListOffsets));
+    memcpy(mBuffer.Get() + mEntriesEnd, &header, sizeof(header));
+    mEntriesEnd += sizeof(header);
+    return true;
+}
+
+bool GlobalAttributeListCache::StoreList(Span<const uint32_t> aIds, uint16_t & aOffset)
+{
+    VerifyOrReturnValue(CanCastTo<uint16_t>(aIds.size()), false);
+    const size_t idsSize = aIds.size() * sizeof(uint32_t);
+
+    for (size_t offset = mListsStart; offset < mCapacity;)
+    {
+        ListHeader header;
+        memcpy(&header, mBuffer.Get() + offset, sizeof(header));
+
+        if ((header.mCount == aIds.size()) && (memcmp(mBuffer.Get() + offset + sizeof(header), aIds.data(), idsSize) == 0))
+        {
+            aOffset = static_cast<uint16_t>(offset);
+            return true;
+        }
+        offset += sizeof(header) + header.mCount * sizeof(uint32_t);
+    }
+
+    const size_t listSize = sizeof(ListHeader) + idsSize;
+    VerifyOrReturnValue(mListsStart - mEntriesEnd >= listSize, false);
+
+    mListsStart -= listSize;
+    const ListHeader header{ static_cast<uint16_t>(aIds.size()) };
+    memcpy(mBuffer.Get() + mListsStart, &header, sizeof(header));
+    memcpy(mBuffer.Get() + mListsStart + sizeof(header), aIds.data(), idsSize);
+    aOffset = static_cast<uint16_t>(mListsStart);
+    return true;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
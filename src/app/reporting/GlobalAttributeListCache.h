@@ -0,0 +1,115 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/AttributeValueEncoder.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/ConcreteClusterPath.h>
+#include <app/GlobalAttributes.h>
+#include <app/data-model-provider/ActionReturnStatus.h>
+#include <app/data-model-provider/Provider.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * The AttributeList, AcceptedCommandList and GeneratedCommandList of the clusters the reporting engine reported, kept across
+ * reports so that they are encoded from a list of ids instead of being rebuilt from the metadata of the data model provider on
+ * every read.  Wildcard priming reads otherwise iterate the attributes and commands of every cluster on every endpoint.
+ *
+ * The three lists of a cluster are built together on its first read.  Identical lists are stored once: endpoints with the same
+ * cluster configuration (e.g. the endpoints of a bridge) share them.
+ *
+ * The lists change with the metadata of the provider, which marks the changed paths dirty (e.g. a whole endpoint when it is
+ * added or removed): Invalidate drops the cache when one of its lists is marked dirty.  The cache also starts over when the
+ * data model provider changes.
+ *
+ * Cluster entries and lists are packed into one buffer allocated by Init and freed by Release: entries from the start, lists
+ * from the end.  Once it is full, lists of other clusters are read from metadata until the cache is cleared.
+ */
+class GlobalAttributeListCache
+{
+public:
+    GlobalAttributeListCache() = default;
+    ~GlobalAttributeListCache() { Release(); }
+
+    GlobalAttributeListCache(const GlobalAttributeListCache &)             = delete;
+    GlobalAttributeListCache & operator=(const GlobalAttributeListCache &) = delete;
+
+    /// `capacity` is at most UINT16_MAX bytes.
+    CHIP_ERROR Init(size_t capacity);
+    void Release();
+    bool IsInitialized() const { return mBuffer.Get() != nullptr; }
+
+    void Clear();
+
+    /**
+     * Drop the cache if it holds a list included in aPath.
+     */
+    void Invalidate(const AttributePathParams & aPath);
+
+    /**
+     * Encodes the global list attribute `aPath` (see IsSupportedGlobalAttributeNotInMetadata) of `aProvider`, from the cache if
+     * it holds the lists of its cluster.  Same contract as ReadGlobalAttributeFromMetadata.
+     */
+    DataModel::ActionReturnStatus Read(DataModel::Provider * aProvider, const ConcreteAttributePath & aPath,
+                                       AttributeValueEncoder & aEncoder);
+
+    size_t GetNumClusters() const { return mEntriesEnd / sizeof(EntryHeader); }
+    /// Bytes used by the lists, shared lists counted once.
+    size_t GetListsSize() const { return mCapacity - mListsStart; }
+
+private:
+    static constexpr size_t kListCount = MATTER_ARRAY_SIZE(GlobalAttributesNotInMetadata);
+
+    // Entries and lists are copied in and out since they are not aligned.  A list is stored as a ListHeader followed by its ids.
+    struct EntryHeader
+    {
+        ConcreteClusterPath mPath;
+        // In the order of GlobalAttributesNotInMetadata.
+        uint16_t mListOffsets[kListCount];
+    };
+
+    struct ListHeader
+    {
+        uint16_t mCount;
+    };
+
+    bool Find(const ConcreteClusterPath & aPath, uint16_t (&aListOffsets)[kListCount]) const;
+    bool Fill(DataModel::Provider * aProvider, const ConcreteClusterPath & aPath, uint16_t (&aListOffsets)[kListCount]);
+    bool StoreList(Span<const uint32_t> aIds, uint16_t & aOffset);
+
+    Platform::ScopedMemoryBuffer<uint8_t> mBuffer;
+    DataModel::Provider * mProvider = nullptr;
+    size_t mCapacity                = 0;
+    size_t mEntriesEnd              = 0;
+    size_t mListsStart              = 0;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,361 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Iterators.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @class IndexedDirtySet
+ *
+ * @brief A fixed capacity set of dirty attribute paths, indexed by (endpoint, cluster).
+ *
+ * This is an alternative to a plain ObjectPool for the reporting engine global dirty set. Paths with a concrete endpoint and a
+ * concrete cluster are chained into hash buckets keyed by that (endpoint, cluster) pair, while paths with a wildcard endpoint or
+ * cluster are kept on a separate (usually very short) wildcard chain. Looking up the dirty paths that may overlap a concrete
+ * cluster only has to walk one bucket plus the wildcard chain, instead of the whole set.
+ *
+ * T must derive from AttributePathParams and have a `uint64_t mGeneration` member. A generation of 0 marks a "tomb" entry that
+ * will be released by the merge operations, matching the semantics used by the reporting engine.
+ *
+ * The endpoint and cluster of an entry are part of its index key: they must only be changed through UpdatePath(). The
+ * attribute id, list index and generation may be modified directly.
+ */
+template <typename T, size_t kCapacity>
+class IndexedDirtySet
+{
+public:
+    static_assert(kCapacity > 0 && kCapacity < UINT16_MAX, "IndexedDirtySet capacity must fit a 16-bit index");
+
+    IndexedDirtySet() { ReleaseAll(); }
+
+    IndexedDirtySet(const IndexedDirtySet &)             = delete;
+    IndexedDirtySet & operator=(const IndexedDirtySet &) = delete;
+
+    /**
+     * Allocates a new entry for the given path. Returns nullptr if the set is exhausted.
+     */
+    T * CreateObject(const AttributePathParams & aPath = AttributePathParams())
+    {
+        VerifyOrReturnValue(mFreeHead != kInvalidIndex, nullptr);
+
+        uint16_t index = mFreeHead;
+        mFreeHead      = mNext[index];
+        mUsed[index]   = true;
+        mAllocated++;
+
+        mEntries[index] = T(aPath);
+        Link(index);
+        return &mEntries[index];
+    }
+
+    void ReleaseObject(T * aObject)
+    {
+        uint16_t index = IndexOf(aObject);
+        VerifyOrReturn(index != kInvalidIndex && mUsed[index]);
+
+        Unlink(index);
+        mUsed[index] = false;
+        mNext[index] = mFreeHead;
+        mFreeHead    = index;
+        mAllocated--;
+    }
+
+    void ReleaseAll()
+    {
+        for (uint16_t i = 0; i < kCapacity; i++)
+        {
+            mUsed[i] = false;
+            mNext[i] = static_cast<uint16_t>(i + 1u < kCapacity ? i + 1u : kInvalidIndex);
+        }
+        for (auto & head : mBuckets)
+        {
+            head = kInvalidIndex;
+        }
+        mWildcardHead = kInvalidIndex;
+        mFreeHead     = 0;
+        mAllocated    = 0;
+    }
+
+    size_t Allocated() const { return mAllocated; }
+    bool Exhausted() const { return mFreeHead == kInvalidIndex; }
+
+    /**
+     * Replaces the endpoint, cluster, attribute and list index of an existing entry, moving it to the right index chain. The
+     * generation of the entry is left untouched.
+     */
+    void UpdatePath(T * aObject, const AttributePathParams & aPath)
+    {
+        uint16_t index = IndexOf(aObject);
+        VerifyOrReturn(index != kInvalidIndex && mUsed[index]);
+
+        Unlink(index);
+        aObject->mEndpointId  = aPath.mEndpointId;
+        aObject->mClusterId   = aPath.mClusterId;
+        aObject->mAttributeId = aPath.mAttributeId;
+        aObject->mListIndex   = aPath.mListIndex;
+        Link(index);
+    }
+
+    /**
+     * Calls the function for every entry in the set. The function may release the entry it is called with.
+     */
+    template <typename Function>
+    Loop ForEachActiveObject(Function && function)
+    {
+        for (uint16_t i = 0; i < kCapacity; i++)
+        {
+            if (mUsed[i] && function(&mEntries[i]) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+    /**
+     * Calls the function for every entry that may be a superset or a subset of the given path, which is a superset of the
+     * entries that could intersect it. When the path has both a concrete endpoint and a concrete cluster, only the matching
+     * bucket and the wildcard chain are visited.
+     *
+     * The function must not release entries or change their endpoint / cluster, unless it returns Loop::Break right after.
+     */
+    template <typename Function>
+    Loop ForEachCandidateOverlapping(const AttributePathParams & aPath, Function && function)
+    {
+        if (!IsIndexable(aPath))
+        {
+            return ForEachActiveObject(function);
+        }
+
+        VerifyOrReturnValue(ForEachInChain(mWildcardHead, function) == Loop::Finish, Loop::Break);
+
+        for (uint16_t i = mBuckets[BucketFor(aPath.mEndpointId, aPath.mClusterId)]; i != kInvalidIndex;)
+        {
+            uint16_t next = mNext[i];
+            if (mEntries[i].mEndpointId == aPath.mEndpointId && mEntries[i].mClusterId == aPath.mClusterId &&
+                function(&mEntries[i]) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+            i = next;
+        }
+        return Loop::Finish;
+    }
+
+    /**
+     * Merges entries sharing the same endpoint and cluster into a single wildcard attribute entry, keeping the newest generation.
+     *
+     * Returns whether any entry has been released.
+     */
+    bool MergePathsUnderSameCluster()
+    {
+        for (auto head : mBuckets)
+        {
+            MergeChainByCluster(head);
+        }
+        MergeChainByCluster(mWildcardHead);
+        return ClearTombs();
+    }
+
+    /**
+     * Merges entries sharing the same endpoint into a single wildcard cluster entry, keeping the newest generation.
+     *
+     * Returns whether any entry has been released.
+     */
+    bool MergePathsUnderSameEndpoint()
+    {
+        // Open addressing table from endpoint to the entry that represents it, sized so it can never fill up.
+        uint16_t representatives[kBucketCount * 2];
+        for (auto & rep : representatives)
+        {
+            rep = kInvalidIndex;
+        }
+
+        for (uint16_t i = 0; i < kCapacity; i++)
+        {
+            T & path = mEntries[i];
+            if (!mUsed[i] || path.HasWildcardEndpointId() || path.mGeneration == 0)
+            {
+                continue;
+            }
+
+            size_t slot = HashEndpoint(path.mEndpointId) & (MATTER_ARRAY_SIZE(representatives) - 1);
+            while (representatives[slot] != kInvalidIndex && mEntries[representatives[slot]].mEndpointId != path.mEndpointId)
+            {
+                slot = (slot + 1) & (MATTER_ARRAY_SIZE(representatives) - 1);
+            }
+
+            if (representatives[slot] == kInvalidIndex)
+            {
+                representatives[slot] = i;
+                continue;
+            }
+
+            T & rep = mEntries[representatives[slot]];
+            if (path.mGeneration > rep.mGeneration)
+            {
+                rep.mGeneration = path.mGeneration;
+            }
+            if (!rep.HasWildcardClusterId() || !rep.HasWildcardAttributeId())
+            {
+                UpdatePath(&rep, AttributePathParams(rep.mEndpointId));
+            }
+            path.mGeneration = 0;
+        }
+
+        return ClearTombs();
+    }
+
+private:
+    static constexpr uint16_t kInvalidIndex = UINT16_MAX;
+
+    static constexpr size_t BucketCountFor(size_t capacity)
+    {
+        size_t count = 4;
+        while (count < capacity)
+        {
+            count <<= 1;
+        }
+        return count;
+    }
+
+    static constexpr size_t kBucketCount = BucketCountFor(kCapacity);
+
+    static bool IsIndexable(const AttributePathParams & aPath)
+    {
+        return !aPath.HasWildcardEndpointId() && !aPath.HasWildcardClusterId();
+    }
+
+    static uint32_t HashEndpoint(EndpointId aEndpoint)
+    {
+        uint32_t hash = static_cast<uint32_t>(aEndpoint) * 0x9E3779B1u;
+        return hash ^ (hash >> 16);
+    }
+
+    static size_t BucketFor(EndpointId aEndpoint, ClusterId aCluster)
+    {
+        uint32_t hash = (aCluster * 0x85EBCA6Bu) ^ HashEndpoint(aEndpoint);
+        return (hash ^ (hash >> 13)) & (kBucketCount - 1);
+    }
+
+    uint16_t IndexOf(const T * aObject) const
+    {
+        VerifyOrReturnValue(aObject >= &mEntries[0] && aObject < &mEntries[kCapacity], kInvalidIndex);
+        return static_cast<uint16_t>(aObject - &mEntries[0]);
+    }
+
+    uint16_t & HeadFor(const T & aPath)
+    {
+        return IsIndexable(aPath) ? mBuckets[BucketFor(aPath.mEndpointId, aPath.mClusterId)] : mWildcardHead;
+    }
+
+    void Link(uint16_t aIndex)
+    {
+        uint16_t & head = HeadFor(mEntries[aIndex]);
+        mNext[aIndex]   = head;
+        head            = aIndex;
+    }
+
+    void Unlink(uint16_t aIndex)
+    {
+        for (uint16_t * link = &HeadFor(mEntries[aIndex]); *link != kInvalidIndex; link = &mNext[*link])
+        {
+            if (*link == aIndex)
+            {
+                *link = mNext[aIndex];
+                return;
+            }
+        }
+    }
+
+    template <typename Function>
+    Loop ForEachInChain(uint16_t aHead, Function && function)
+    {
+        for (uint16_t i = aHead; i != kInvalidIndex;)
+        {
+            uint16_t next = mNext[i];
+            VerifyOrReturnValue(function(&mEntries[i]) != Loop::Break, Loop::Break);
+            i = next;
+        }
+        return Loop::Finish;
+    }
+
+    void MergeChainByCluster(uint16_t aHead)
+    {
+        for (uint16_t outer = aHead; outer != kInvalidIndex; outer = mNext[outer])
+        {
+            T & outerPath = mEntries[outer];
+            if (outerPath.HasWildcardClusterId() || outerPath.mGeneration == 0)
+            {
+                continue;
+            }
+            for (uint16_t inner = mNext[outer]; inner != kInvalidIndex; inner = mNext[inner])
+            {
+                T & innerPath = mEntries[inner];
+                if (innerPath.mGeneration == 0 || innerPath.mEndpointId != outerPath.mEndpointId ||
+                    innerPath.mClusterId != outerPath.mClusterId)
+                {
+                    continue;
+                }
+                if (innerPath.mGeneration > outerPath.mGeneration)
+                {
+                    outerPath.mGeneration = innerPath.mGeneration;
+                }
+                // Endpoint and cluster are unchanged, so the entry stays on the same chain.
+                outerPath.SetWildcardAttributeId();
+                innerPath.mGeneration = 0;
+            }
+        }
+    }
+
+    bool ClearTombs()
+    {
+        bool released = false;
+        ForEachActiveObject([&](T * path) {
+            if (path->mGeneration == 0)
+            {
+                ReleaseObject(path);
+                released = true;
+            }
+            return Loop::Continue;
+        });
+        return released;
+    }
+
+    T mEntries[kCapacity];
+    uint16_t mNext[kCapacity];
+    bool mUsed[kCapacity];
+    uint16_t mBuckets[kBucketCount];
+    uint16_t mWildcardHead = kInvalidIndex;
+    uint16_t mFreeHead     = kInvalidIndex;
+    size_t mAllocated      = 0;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
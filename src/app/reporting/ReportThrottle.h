@@ -0,0 +1,212 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemClock.h>
+
+#include <cstddef>
+#include <utility>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * Quieter reporting (the Q quality) enforced by the reporting engine for attributes that change on every step of a transition,
+ * such as CurrentLevel or CurrentHue.
+ *
+ * A policy gives the minimum interval between two changes of an attribute that are reported, on any endpoint.  The first change
+ * of an attribute path is reported immediately and opens a window of that interval; further changes during the window are held
+ * back, and the last of them is reported when the window ends.  Subscribers therefore get at most one report per interval for
+ * the path, and always see its final value.
+ *
+ * Wildcard paths are never held back.  When all path entries are in use by windows with held back changes, changes to other
+ * paths are reported immediately.
+ */
+template <size_t kMaxPolicies, size_t kMaxPaths>
+class ReportThrottle
+{
+public:
+    enum class Decision : uint8_t
+    {
+        kReport, ///< mark the path dirty now
+        kDefer,  ///< the change will be returned by ForEachDue once the window of the path ends
+    };
+
+    /**
+     * Sets the minimum interval between reported changes of the given attribute.  An interval of 0 removes the policy.
+     */
+    CHIP_ERROR SetInterval(ClusterId cluster, AttributeId attribute, System::Clock::Milliseconds32 interval)
+    {
+        for (size_t i = 0; i < mPolicyCount; i++)
+        {
+            if (mPolicies[i].cluster == cluster && mPolicies[i].attribute == attribute)
+            {
+                if (interval.count() == 0)
+                {
+                    mPolicies[i] = mPolicies[--mPolicyCount];
+                }
+                else
+                {
+                    mPolicies[i].interval = interval;
+                }
+                return CHIP_NO_ERROR;
+            }
+        }
+        VerifyOrReturnError(interval.count() != 0, CHIP_NO_ERROR);
+        VerifyOrReturnError(mPolicyCount < kMaxPolicies, CHIP_ERROR_NO_MEMORY);
+        mPolicies[mPolicyCount++] = { cluster, attribute, interval };
+        return CHIP_NO_ERROR;
+    }
+
+    Decision OnDirty(const AttributePathParams & path, System::Clock::Milliseconds64 now)
+    {
+        VerifyOrReturnValue(mPolicyCount > 0 && !path.IsWildcardPath(), Decision::kReport);
+        const Policy * policy = FindPolicy(path.mClusterId, path.mAttributeId);
+        VerifyOrReturnValue(policy != nullptr, Decision::kReport);
+
+        const ConcreteAttributePath concretePath(path.mEndpointId, path.mClusterId, path.mAttributeId);
+        PathState * state = FindOrAllocatePath(concretePath, now);
+        VerifyOrReturnValue(state != nullptr, Decision::kReport);
+
+        if (now < state->windowEnd)
+        {
+            state->pending = true;
+            return Decision::kDefer;
+        }
+        state->windowEnd = now + policy->interval;
+        state->pending   = false;
+        return Decision::kReport;
+    }
+
+    /**
+     * Returns whether a change is held back, and if so sets aDeadline to the earliest end of a window with a held back change.
+     */
+    bool NextDeadline(System::Clock::Milliseconds64 & aDeadline) const
+    {
+        bool found = false;
+        for (size_t i = 0; i < mPathCount; i++)
+        {
+            if (mPaths[i].pending && (!found || mPaths[i].windowEnd < aDeadline))
+            {
+                aDeadline = mPaths[i].windowEnd;
+                found     = true;
+            }
+        }
+        return found;
+    }
+
+    /**
+     * Calls fn(const ConcreteAttributePath &) for every held back change whose window has ended by now.  The change is no longer
+     * held back when fn is called, so fn may mark the path dirty again, which is then reported and opens a new window.
+     */
+    template <typename F>
+    void ForEachDue(System::Clock::Milliseconds64 now, F && fn)
+    {
+        for (size_t i = 0; i < mPathCount; i++)
+        {
+            if (mPaths[i].pending && mPaths[i].windowEnd <= now)
+            {
+                mPaths[i].pending = false;
+                fn(mPaths[i].path);
+            }
+        }
+    }
+
+    /**
+     * Ends all windows and calls fn(const ConcreteAttributePath &) for every held back change.
+     */
+    template <typename F>
+    void Flush(F && fn)
+    {
+        for (size_t i = 0; i < mPathCount; i++)
+        {
+            mPaths[i].windowEnd = System::Clock::Milliseconds64(0);
+        }
+        ForEachDue(System::Clock::Milliseconds64(0), std::forward<F>(fn));
+    }
+
+    void Clear() { mPathCount = 0; }
+
+    size_t PolicyCount() const { return mPolicyCount; }
+
+private:
+    struct Policy
+    {
+        ClusterId cluster;
+        AttributeId attribute;
+        System::Clock::Milliseconds32 interval;
+    };
+
+    struct PathState
+    {
+        ConcreteAttributePath path;
+        System::Clock::Milliseconds64 windowEnd;
+        bool pending;
+    };
+
+    const Policy * FindPolicy(ClusterId cluster, AttributeId attribute) const
+    {
+        for (size_t i = 0; i < mPolicyCount; i++)
+        {
+            if (mPolicies[i].cluster == cluster && mPolicies[i].attribute == attribute)
+            {
+                return &mPolicies[i];
+            }
+        }
+        return nullptr;
+    }
+
+    PathState * FindOrAllocatePath(const ConcreteAttributePath & path, System::Clock::Milliseconds64 now)
+    {
+        PathState * reusable = nullptr;
+        for (size_t i = 0; i < mPathCount; i++)
+        {
+            if (mPaths[i].path == path)
+            {
+                return &mPaths[i];
+            }
+            if (reusable == nullptr && !mPaths[i].pending && mPaths[i].windowEnd <= now)
+            {
+                reusable = &mPaths[i];
+            }
+        }
+        if (reusable == nullptr)
+        {
+            VerifyOrReturnValue(mPathCount < kMaxPaths, nullptr);
+            reusable = &mPaths[mPathCount++];
+        }
+        *reusable = { path, System::Clock::Milliseconds64(0), false };
+        return reusable;
+    }
+
+    Policy mPolicies[kMaxPolicies];
+    PathState mPaths[kMaxPaths];
+    size_t mPolicyCount = 0;
+    size_t mPathCount   = 0;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -134,9 +134,10 @@ CHIP_ERROR SynchronizedReportSchedulerImpl::CalculateNextReportTimeout(Timeout &
     ReturnErrorOnFailure(FindNextMinInterval(now));
     bool reportableNow   = false;
     bool reportableAtMin = false;
+    bool mustReportNow   = false;
 
     // Find out if any handler is reportable now or at the next min interval
-    mNodesPool.ForEachActiveObject([&reportableNow, &reportableAtMin, this, now](ReadHandlerNode * node) {
+    mNodesPool.ForEachActiveObject([&reportableNow, &reportableAtMin, &mustReportNow, this, now](ReadHandlerNode * node) {
         // If a node is already scheduled, we don't need to check if it is reportable now unless a chunked report is in progress.
         // In this case, the node will be Reportable, as it is impossible to have node->IsChunkedReport() == true without being
         // reportable, therefore we need to keep scheduling engine runs until the report is complete
@@ -145,7 +146,13 @@ CHIP_ERROR SynchronizedReportSchedulerImpl::CalculateNextReportTimeout(Timeout &
             if (node->IsReportableNow(now))
             {
                 reportableNow = true;
-                return Loop::Break;
+                // Reports owed because of the max interval, or the rest of a chunked report, cannot wait for the next wake.
+                if (now >= node->GetMaxTimestamp() || node->IsChunkedReport() || this->mReportSlack == Milliseconds32(0))
+                {
+                    mustReportNow = true;
+                    return Loop::Break;
+                }
+                return Loop::Continue;
             }
 
             if (this->IsReadHandlerReportable(node->GetReadHandler()) && node->GetMinTimestamp() <= this->mNextMaxTimestamp)
@@ -157,13 +164,19 @@ CHIP_ERROR SynchronizedReportSchedulerImpl::CalculateNextReportTimeout(Timeout &
         return Loop::Continue;
     });
 
-    if (reportableNow)
+    if (mustReportNow)
     {
         timeout = Milliseconds32(0);
     }
-    else if (reportableAtMin)
+    else if (reportableNow || reportableAtMin)
     {
-        timeout = mNextMinTimestamp - now;
+        // Send the report with the next one due to a max interval if it is within the slack, saving a wake.
+        Timestamp reportTimestamp = reportableNow ? now : mNextMinTimestamp;
+        if (mNextMaxTimestamp - reportTimestamp <= mReportSlack)
+        {
+            reportTimestamp = mNextMaxTimestamp;
+        }
+        timeout = reportTimestamp - now;
     }
     else
     {
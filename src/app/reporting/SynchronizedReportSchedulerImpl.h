@@ -19,6 +19,7 @@
 #pragma once
 
 #include <app/reporting/ReportSchedulerImpl.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/support/TimerDelegate.h>
 
 namespace chip {
@@ -69,6 +70,10 @@ using ReadHandlerNode = ReportScheduler::ReadHandlerNode;
  * - The next report timeout is calculated in CalculatedNextReportTimeout based on the next min and max interval timestamps, as well
  * as the status of each ReadHandlerNode in the pool.
  *
+ * - With a report slack, a report that becomes due (dirty handler past its min interval) is delayed to the next max interval
+ *   timestamp if that is no more than the slack away, so that both are sent in the same wake.  Handlers past their max interval
+ *   and chunked reports in progress are never delayed.
+ *
  * @note Unlike the non-synchronized implementation, the Synchronized Scheduler will reschedule itself in the event that a timer
  * fires before a reportable timestamp is reached.
  *
@@ -86,6 +91,12 @@ public:
 
     bool IsReportScheduled(ReadHandler * ReadHandler) override;
 
+    /**
+     * @brief Sets the report slack, i.e. how long a report that became due may wait for the next report due to a max interval.
+     *        Takes effect the next time the report timeout is calculated.
+     */
+    void SetReportSlack(System::Clock::Milliseconds32 slack) { mReportSlack = slack; }
+
     /** @brief Callback called when the report timer expires to schedule an engine run regardless of the state of the ReadHandlers,
      *
      * It loops through all handlers and sets their CanBeSynced flag to true if the current timestamp is greater than
@@ -179,6 +190,8 @@ private:
     // Timestamp of the next report to be scheduled, used by OnTransitionToIdle to determine whether we should emit a report before
     // the device goes to idle mode
     Timestamp mNextReportTimestamp = Milliseconds64(0);
+
+    System::Clock::Milliseconds32 mReportSlack = System::Clock::Milliseconds32(CHIP_CONFIG_SYNCHRONOUS_REPORTS_SLACK_MS);
 };
 
 } // namespace reporting
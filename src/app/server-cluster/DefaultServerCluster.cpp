@@ -98,12 +98,36 @@ void DefaultServerCluster::Shutdown()
 
 void DefaultServerCluster::NotifyAttributeChanged(AttributeId attributeId)
 {
+    if (mWritesInProgress)
+    {
+        if (mHasPendingChange && (mPendingChangedAttribute != attributeId))
+        {
+            attributeId = kInvalidAttributeId;
+        }
+        mPendingChangedAttribute = attributeId;
+        mHasPendingChange        = true;
+        return;
+    }
+
     IncreaseDataVersion();
 
     VerifyOrReturn(mContext != nullptr);
     mContext->interactionContext.dataModelChangeListener.MarkDirty({ mPath.mEndpointId, mPath.mClusterId, attributeId });
 }
 
+void DefaultServerCluster::EndWrites(const ConcreteClusterPath & path)
+{
+    mWritesInProgress = false;
+    VerifyOrReturn(mHasPendingChange);
+    mHasPendingChange = false;
+
+    // kInvalidAttributeId is the wildcard attribute: all the attributes of the cluster are reported as changed.
+    IncreaseDataVersion();
+    VerifyOrReturn(mContext != nullptr);
+    mContext->interactionContext.dataModelChangeListener.MarkDirty(
+        { mPath.mEndpointId, mPath.mClusterId, mPendingChangedAttribute });
+}
+
 BitFlags<ClusterQualityFlags> DefaultServerCluster::GetClusterFlags(const ConcreteClusterPath &) const
 {
     return {};
@@ -67,6 +67,12 @@ public:
     DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest & request,
                                                  AttributeValueDecoder & decoder) override;
 
+    /// Attribute changes notified between BeginWrites and EndWrites increase the data version and are
+    /// reported once, at EndWrites: as a change of the attribute if a single one changed, of the whole
+    /// cluster otherwise.
+    void BeginWrites(const ConcreteClusterPath & path) override { mWritesInProgress = true; }
+    void EndWrites(const ConcreteClusterPath & path) override;
+
     /// Must only be implemented if support for any non-global attributes
     /// is required.
     ///
@@ -122,6 +128,11 @@ protected:
 
 private:
     DataVersion mDataVersion; // will be random-initialized as per spec
+
+    // Changes notified by the open batch of writes, kInvalidAttributeId meaning more than one attribute changed.
+    AttributeId mPendingChangedAttribute = kInvalidAttributeId;
+    bool mHasPendingChange               = false;
+    bool mWritesInProgress               = false;
 };
 
 } // namespace app
@@ -0,0 +1,182 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/server-cluster/ServerClusterIndex.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <new>
+
+namespace chip {
+namespace app {
+
+ServerClusterIndex::~ServerClusterIndex()
+{
+    Clear();
+}
+
+size_t ServerClusterIndex::Hash(const ConcreteClusterPath & path)
+{
+    // Cluster ids are small or manufacturer-prefixed and endpoint ids are small,
+    // so mix the bits around before they get masked down to a slot number.
+    uint32_t hash = (static_cast<uint32_t>(path.mEndpointId) * 0x9E3779B1u) ^ path.mClusterId;
+    hash ^= hash >> 16;
+    hash *= 0x45D9F3Bu;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+bool ServerClusterIndex::HasRoomForOneMore() const
+{
+    return (mUsed + mRemoved + 1) * 4 <= Capacity() * 3;
+}
+
+bool ServerClusterIndex::Insert(const ConcreteClusterPath & path, ServerClusterInterface * interface)
+{
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_DYNAMIC_INDEX
+    if (!HasRoomForOneMore())
+    {
+        VerifyOrReturnValue(Grow(), false);
+    }
+#else
+    VerifyOrReturnValue(HasRoomForOneMore(), false);
+#endif
+
+    const size_t mask = Capacity() - 1;
+    Slot * slots      = Slots();
+
+    // The load factor guarantees that a free slot exists
+    for (size_t idx = Hash(path) & mask;; idx = (idx + 1) & mask)
+    {
+        if (slots[idx].state != SlotState::kUsed)
+        {
+            if (slots[idx].state == SlotState::kRemoved)
+            {
+                mRemoved--;
+            }
+            slots[idx].path      = path;
+            slots[idx].interface = interface;
+            slots[idx].state     = SlotState::kUsed;
+            mUsed++;
+            return true;
+        }
+    }
+}
+
+void ServerClusterIndex::Remove(const ServerClusterInterface * interface)
+{
+    Slot * slots = Slots();
+    for (size_t idx = 0; idx < Capacity(); idx++)
+    {
+        if ((slots[idx].state == SlotState::kUsed) && (slots[idx].interface == interface))
+        {
+            slots[idx].interface = nullptr;
+            slots[idx].state     = SlotState::kRemoved;
+            mUsed--;
+            mRemoved++;
+        }
+    }
+
+    if (mUsed == 0)
+    {
+        // Nothing left to probe past, so the tombstones can go
+        for (size_t idx = 0; idx < Capacity(); idx++)
+        {
+            slots[idx].state = SlotState::kEmpty;
+        }
+        mRemoved = 0;
+    }
+}
+
+ServerClusterInterface * ServerClusterIndex::Find(const ConcreteClusterPath & path) const
+{
+    VerifyOrReturnValue(mUsed > 0, nullptr);
+
+    const size_t mask  = Capacity() - 1;
+    const Slot * slots = Slots();
+    size_t idx         = Hash(path) & mask;
+
+    // Empty slots always exist (the load factor is bounded), so this terminates
+    while (slots[idx].state != SlotState::kEmpty)
+    {
+        if ((slots[idx].state == SlotState::kUsed) && (slots[idx].path == path))
+        {
+            return slots[idx].interface;
+        }
+        idx = (idx + 1) & mask;
+    }
+
+    return nullptr;
+}
+
+void ServerClusterIndex::Clear()
+{
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_DYNAMIC_INDEX
+    Platform::MemoryFree(mSlots);
+    mSlots    = nullptr;
+    mCapacity = 0;
+#else
+    for (auto & slot : mSlots)
+    {
+        slot = Slot();
+    }
+#endif
+    mUsed    = 0;
+    mRemoved = 0;
+}
+
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_DYNAMIC_INDEX
+bool ServerClusterIndex::Grow()
+{
+    size_t newCapacity = kInitialCapacity;
+    if (mCapacity > 0)
+    {
+        // If tombstones are what filled the table up, rehashing at the same size is enough
+        newCapacity = ((mUsed + 1) * 8 <= mCapacity * 3) ? mCapacity : mCapacity * 2;
+    }
+
+    Slot * newSlots = static_cast<Slot *>(Platform::MemoryCalloc(newCapacity, sizeof(Slot)));
+    VerifyOrReturnValue(newSlots != nullptr, false);
+    for (size_t idx = 0; idx < newCapacity; idx++)
+    {
+        new (&newSlots[idx]) Slot();
+    }
+
+    Slot * oldSlots          = mSlots;
+    const size_t oldCapacity = mCapacity;
+
+    mSlots    = newSlots;
+    mCapacity = newCapacity;
+    mUsed     = 0;
+    mRemoved  = 0;
+
+    for (size_t idx = 0; idx < oldCapacity; idx++)
+    {
+        if (oldSlots[idx].state == SlotState::kUsed)
+        {
+            // cannot fail: the new table is at most 3/8 full and has no tombstones
+            Insert(oldSlots[idx].path, oldSlots[idx].interface);
+        }
+    }
+    Platform::MemoryFree(oldSlots);
+
+    return true;
+}
+#endif
+
+} // namespace app
+} // namespace chip
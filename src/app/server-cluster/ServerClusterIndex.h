@@ -0,0 +1,118 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteClusterPath.h>
+#include <lib/core/CHIPConfig.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#if !CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_DYNAMIC_INDEX
+#include <array>
+#endif
+
+namespace chip {
+namespace app {
+
+class ServerClusterInterface;
+
+/// An open-addressed (linear probing) hash index of cluster paths to the
+/// ServerClusterInterface that serves them.
+///
+/// The index does not own anything and is only an accelerator: it may run out of
+/// room, in which case `Insert` fails and the caller has to keep finding the paths
+/// that did not fit some other way.
+///
+/// Storage is either static (CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE slots) or,
+/// if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_DYNAMIC_INDEX is set, heap allocated and grown
+/// on demand.
+class ServerClusterIndex
+{
+public:
+    ServerClusterIndex() = default;
+    ~ServerClusterIndex();
+
+    ServerClusterIndex(const ServerClusterIndex &)             = delete;
+    ServerClusterIndex & operator=(const ServerClusterIndex &) = delete;
+
+    /// Add an entry for `path`. The path MUST NOT already be in the index.
+    ///
+    /// Returns false if there is no room for the entry, in which case the index is unchanged.
+    bool Insert(const ConcreteClusterPath & path, ServerClusterInterface * interface);
+
+    /// Remove all entries that point to `interface`.
+    void Remove(const ServerClusterInterface * interface);
+
+    /// Returns the interface indexed for `path` or nullptr if `path` is not in the index.
+    ServerClusterInterface * Find(const ConcreteClusterPath & path) const;
+
+    /// Remove all entries (and release dynamic storage, if any).
+    void Clear();
+
+private:
+    enum class SlotState : uint8_t
+    {
+        kEmpty,
+        kUsed,
+        kRemoved, // tombstone: keeps probe sequences going through this slot
+    };
+
+    struct Slot
+    {
+        ConcreteClusterPath path;
+        ServerClusterInterface * interface = nullptr;
+        SlotState state                    = SlotState::kEmpty;
+    };
+
+    static size_t Hash(const ConcreteClusterPath & path);
+
+    /// Whether one more entry can be added while keeping the load factor at or below 3/4.
+    bool HasRoomForOneMore() const;
+
+    static_assert((CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE & (CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE - 1)) == 0,
+                  "CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE must be 0 or a power of two");
+
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_DYNAMIC_INDEX
+    static constexpr size_t kInitialCapacity =
+        (CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE > 0) ? CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE : 16;
+
+    /// Moves all entries into a freshly allocated table, dropping tombstones and doubling the
+    /// capacity if needed. Returns false on allocation failure.
+    bool Grow();
+
+    size_t Capacity() const { return mCapacity; }
+    Slot * Slots() { return mSlots; }
+    const Slot * Slots() const { return mSlots; }
+
+    Slot * mSlots    = nullptr;
+    size_t mCapacity = 0;
+#else
+    size_t Capacity() const { return mSlots.size(); }
+    Slot * Slots() { return mSlots.data(); }
+    const Slot * Slots() const { return mSlots.data(); }
+
+    std::array<Slot, CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE> mSlots;
+#endif
+
+    // Number of kUsed and kRemoved slots respectively
+    size_t mUsed    = 0;
+    size_t mRemoved = 0;
+};
+
+} // namespace app
+} // namespace chip
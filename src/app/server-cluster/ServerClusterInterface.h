@@ -29,6 +29,9 @@
 #include <lib/support/BitFlags.h>
 #include <lib/support/ReadOnlyBuffer.h>
 
+#include <cstddef>
+#include <optional>
+
 namespace chip {
 namespace app {
 
@@ -101,6 +104,16 @@ public:
                                                 FabricIndex accessingFabric)
     {}
 
+    ///   Indicates the start/end of a run of consecutive WriteAttribute calls on `path` made while processing a
+    ///   single write request (see DataModel::Provider::BeginClusterWrites).
+    ///
+    ///   Clusters MAY defer work shared by these writes, like persistence or change notifications, until EndWrites.
+    ///
+    /// Precondition:
+    ///   - `path` MUST match one of the paths returned by GetPaths.
+    virtual void BeginWrites(const ConcreteClusterPath & path) {}
+    virtual void EndWrites(const ConcreteClusterPath & path) {}
+
     /// Reads the value of an existing attribute.
     ///
     /// ReadAttribute MUST be done on an "existent" attribute path: only on attributes that are
@@ -126,6 +139,17 @@ public:
     virtual DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
                                                         AttributeValueEncoder & encoder) = 0;
 
+    /// Returns a lower bound of the size of the value that ReadAttribute would encode for `request`, if it is cheap to know.
+    ///
+    /// See DataModel::Provider::EstimateAttributeEncodedSize.
+    ///
+    /// Precondition:
+    ///   - `request.path` endpoint+cluster part MUST match one of the paths returned by GetPaths.
+    virtual std::optional<size_t> EstimateAttributeEncodedSize(const DataModel::ReadAttributeRequest & request)
+    {
+        return std::nullopt;
+    }
+
     /// Writes a value to an existing attribute.
     ///
     /// WriteAttribute MUST be done on an "existent" attribute path: only on attributes that are
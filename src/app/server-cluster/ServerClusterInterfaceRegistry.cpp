@@ -69,6 +69,14 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Register(ServerClusterRegistration &
 
     entry.next     = mRegistrations;
     mRegistrations = &entry;
+    mGeneration++;
+
+    if (!IndexRegistration(entry) && mIndexComplete)
+    {
+        // Either the index is full or removed entries are taking up its room. An incomplete index
+        // is rebuilt on every removal so it has no removed entries: it is just full and stays as-is.
+        RebuildIndex();
+    }
 
     return CHIP_NO_ERROR;
 }
@@ -94,16 +102,8 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Unregister(ServerClusterInterface * w
                 prev->next = next;
             }
 
-            if (mCachedInterface == current->serverClusterInterface)
-            {
-                mCachedInterface = nullptr;
-            }
-
             current->next = nullptr; // Make sure current does not look like part of a list.
-            if (mContext.has_value())
-            {
-                current->serverClusterInterface->Shutdown();
-            }
+            OnRegistrationRemoved(*current);
 
             return CHIP_NO_ERROR;
         }
@@ -115,6 +115,51 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Unregister(ServerClusterInterface * w
     return CHIP_ERROR_NOT_FOUND;
 }
 
+void ServerClusterInterfaceRegistry::OnRegistrationRemoved(ServerClusterRegistration & entry)
+{
+    if (mCachedInterface == entry.serverClusterInterface)
+    {
+        mCachedInterface = nullptr;
+    }
+
+    mIndex.Remove(entry.serverClusterInterface);
+    if (!mIndexComplete)
+    {
+        // some registrations that did not fit before may fit now
+        RebuildIndex();
+    }
+
+    mGeneration++;
+    if (mContext.has_value())
+    {
+        entry.serverClusterInterface->Shutdown();
+    }
+}
+
+bool ServerClusterInterfaceRegistry::IndexRegistration(ServerClusterRegistration & entry)
+{
+    for (const ConcreteClusterPath & path : entry.serverClusterInterface->GetPaths())
+    {
+        VerifyOrReturnValue(mIndex.Insert(path, entry.serverClusterInterface), false);
+    }
+    return true;
+}
+
+void ServerClusterInterfaceRegistry::RebuildIndex()
+{
+    mIndex.Clear();
+    mIndexComplete = true;
+
+    for (ServerClusterRegistration * current = mRegistrations; current != nullptr; current = current->next)
+    {
+        if (!IndexRegistration(*current))
+        {
+            mIndexComplete = false;
+            return;
+        }
+    }
+}
+
 ServerClusterInterface * ServerClusterInterfaceRegistry::Get(const ConcreteClusterPath & clusterPath)
 {
     // Check the cache to speed things up
@@ -123,7 +168,16 @@ ServerClusterInterface * ServerClusterInterfaceRegistry::Get(const ConcreteClust
         return mCachedInterface;
     }
 
-    // The cluster searched for is not cached, do a linear search for it
+    if (ServerClusterInterface * interface = mIndex.Find(clusterPath); interface != nullptr)
+    {
+        mCachedInterface = interface;
+        return mCachedInterface;
+    }
+
+    // Everything registered is indexed, so there is no need to search any further
+    VerifyOrReturnValue(!mIndexComplete, nullptr);
+
+    // Some registrations did not fit in the index, do a linear search for it
     ServerClusterRegistration * current = mRegistrations;
 
     while (current != nullptr)
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <app/ConcreteClusterPath.h>
+#include <app/server-cluster/ServerClusterIndex.h>
 #include <app/server-cluster/ServerClusterInterface.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/DataModelTypes.h>
@@ -155,6 +156,12 @@ public:
     /// Return the interface registered for the given cluster path or nullptr if one does not exist
     ServerClusterInterface * Get(const ConcreteClusterPath & path);
 
+    /// Returns a value that changes every time a registration is added or removed.
+    ///
+    /// Callers that cache the result of `Get` can compare generations to know
+    /// when their cached values have to be discarded.
+    unsigned Generation() const { return mGeneration; }
+
     // Set up the underlying context for all clusters that are managed by this registry.
     //
     // The values within context will be moved and used as-is.
@@ -206,12 +213,30 @@ public:
     ServerClusterInstances AllServerClusterInstances();
 
 protected:
+    /// Bookkeeping for a registration that was just taken out of `mRegistrations`.
+    void OnRegistrationRemoved(ServerClusterRegistration & entry);
+
     ServerClusterRegistration * mRegistrations = nullptr;
 
     // A one-element cache to speed up finding a cluster within an endpoint.
     // The endpointId specifies which endpoint the cache belongs to.
     ServerClusterInterface * mCachedInterface = nullptr;
 
+    // Incremented on every registration change, see `Generation()`
+    unsigned mGeneration = 0;
+
+private:
+    /// Re-creates mIndex from mRegistrations.
+    void RebuildIndex();
+
+    /// Adds all paths of the given registration to mIndex, returns false if some did not fit.
+    bool IndexRegistration(ServerClusterRegistration & entry);
+
+    // Hash index of registered paths. If mIndexComplete is false, some paths
+    // did not fit and lookups that miss the index fall back to a linear search.
+    ServerClusterIndex mIndex;
+    bool mIndexComplete = true;
+
     // Managing context for this registry
     std::optional<ServerClusterContext> mContext;
 };
@@ -60,10 +60,6 @@ void SingleEndpointServerClusterRegistry::UnregisterAllFromEndpoint(EndpointId e
         auto paths = current->serverClusterInterface->GetPaths();
         if (paths.empty() || paths.front().mEndpointId == endpointId)
         {
-            if (mCachedInterface == current->serverClusterInterface)
-            {
-                mCachedInterface = nullptr;
-            }
             if (prev == nullptr)
             {
                 mRegistrations = current->next;
@@ -75,10 +71,7 @@ void SingleEndpointServerClusterRegistry::UnregisterAllFromEndpoint(EndpointId e
             ServerClusterRegistration * actual_next = current->next;
 
             current->next = nullptr; // Make sure current does not look like part of a list.
-            if (mContext.has_value())
-            {
-                current->serverClusterInterface->Shutdown();
-            }
+            OnRegistrationRemoved(*current);
 
             current = actual_next;
         }
@@ -198,6 +198,46 @@ TEST(TestDefaultServerCluster, NotifyAttributeChanged)
     ASSERT_EQ(context.ChangeListener().DirtyList()[0], AttributePathParams(kEndpointId, kClusterId, 234));
 }
 
+TEST(TestDefaultServerCluster, NotifyAttributeChangedDuringWrites)
+{
+    constexpr ClusterId kEndpointId = 321;
+    constexpr ClusterId kClusterId  = 1122;
+    FakeDefaultServerCluster cluster({ kEndpointId, kClusterId });
+
+    TestServerClusterContext context;
+    ASSERT_EQ(cluster.Startup(context.Get()), CHIP_NO_ERROR);
+
+    // Repeated changes of a single attribute are reported once, when the writes end.
+    DataVersion oldVersion = cluster.GetDataVersion({ kEndpointId, kClusterId });
+    cluster.BeginWrites({ kEndpointId, kClusterId });
+    cluster.TestNotifyAttributeChanged(234);
+    cluster.TestNotifyAttributeChanged(234);
+    ASSERT_EQ(cluster.GetDataVersion({ kEndpointId, kClusterId }), oldVersion);
+    ASSERT_TRUE(context.ChangeListener().DirtyList().empty());
+
+    cluster.EndWrites({ kEndpointId, kClusterId });
+    ASSERT_EQ(cluster.GetDataVersion({ kEndpointId, kClusterId }), oldVersion + 1);
+    ASSERT_EQ(context.ChangeListener().DirtyList().size(), 1u);
+    ASSERT_EQ(context.ChangeListener().DirtyList()[0], AttributePathParams(kEndpointId, kClusterId, 234));
+
+    // Changes of several attributes are reported as a change of the cluster.
+    context.ChangeListener().DirtyList().clear();
+    cluster.BeginWrites({ kEndpointId, kClusterId });
+    cluster.TestNotifyAttributeChanged(234);
+    cluster.TestNotifyAttributeChanged(345);
+    cluster.EndWrites({ kEndpointId, kClusterId });
+    ASSERT_EQ(cluster.GetDataVersion({ kEndpointId, kClusterId }), oldVersion + 2);
+    ASSERT_EQ(context.ChangeListener().DirtyList().size(), 1u);
+    ASSERT_EQ(context.ChangeListener().DirtyList()[0], AttributePathParams(kEndpointId, kClusterId));
+
+    // Writes that change nothing report nothing.
+    context.ChangeListener().DirtyList().clear();
+    cluster.BeginWrites({ kEndpointId, kClusterId });
+    cluster.EndWrites({ kEndpointId, kClusterId });
+    ASSERT_EQ(cluster.GetDataVersion({ kEndpointId, kClusterId }), oldVersion + 2);
+    ASSERT_TRUE(context.ChangeListener().DirtyList().empty());
+}
+
 TEST(TestDefaultServerCluster, NotifyAttributeChangedIfSuccess)
 {
     constexpr ClusterId kEndpointId = 321;
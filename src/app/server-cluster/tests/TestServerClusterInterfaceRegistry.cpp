@@ -30,6 +30,8 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <memory>
+#include <vector>
 
 using namespace chip;
 using namespace chip::Testing;
@@ -314,6 +316,94 @@ TEST_F(TestServerClusterInterfaceRegistry, GetWithCache)
     EXPECT_EQ(registry.Get({ kEp1, kCluster1 }), &cluster1);
 }
 
+TEST_F(TestServerClusterInterfaceRegistry, GenerationChangesOnRegistrationChanges)
+{
+    FakeServerClusterInterface cluster1(kEp1, kCluster1);
+    ServerClusterRegistration registration1(cluster1);
+    FakeServerClusterInterface cluster2(kEp1, kCluster2);
+
+    ServerClusterInterfaceRegistry registry;
+    const unsigned initial = registry.Generation();
+
+    EXPECT_EQ(registry.Register(registration1), CHIP_NO_ERROR);
+    const unsigned registered = registry.Generation();
+    EXPECT_NE(registered, initial);
+
+    // Lookups and failed changes leave the generation alone
+    EXPECT_EQ(registry.Get({ kEp1, kCluster1 }), &cluster1);
+    EXPECT_EQ(registry.Register(registration1), CHIP_ERROR_DUPLICATE_KEY_ID);
+    EXPECT_EQ(registry.Unregister(&cluster2), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(registry.Generation(), registered);
+
+    EXPECT_EQ(registry.Unregister(&cluster1), CHIP_NO_ERROR);
+    EXPECT_NE(registry.Generation(), registered);
+}
+
+TEST_F(TestServerClusterInterfaceRegistry, ManyRegistrations)
+{
+    // More clusters than the index holds with default settings, so lookups have to work
+    // both through the index and the fallback search.
+    constexpr size_t kClusterCount = 100;
+
+    std::vector<std::unique_ptr<FakeServerClusterInterface>> clusters;
+    std::vector<std::unique_ptr<ServerClusterRegistration>> registrations;
+    for (size_t i = 0; i < kClusterCount; i++)
+    {
+        auto endpoint = static_cast<EndpointId>(1 + i % 7);
+        auto cluster  = static_cast<ClusterId>(1 + i);
+        clusters.push_back(std::make_unique<FakeServerClusterInterface>(endpoint, cluster));
+        registrations.push_back(std::make_unique<ServerClusterRegistration>(*clusters.back()));
+    }
+
+    ServerClusterInterfaceRegistry registry;
+    for (size_t i = 0; i < kClusterCount; i++)
+    {
+        ASSERT_EQ(registry.Register(*registrations[i]), CHIP_NO_ERROR);
+        EXPECT_NE(registry.Register(*registrations[i]), CHIP_NO_ERROR);
+    }
+
+    for (size_t i = 0; i < kClusterCount; i++)
+    {
+        EXPECT_EQ(registry.Get(clusters[i]->GetPath()), clusters[i].get());
+        // same cluster id on a different endpoint is not registered
+        EXPECT_EQ(registry.Get({ static_cast<EndpointId>(kInvalidEndpointId - 1), clusters[i]->GetPath().mClusterId }), nullptr);
+    }
+
+    // Remove every other cluster
+    for (size_t i = 0; i < kClusterCount; i += 2)
+    {
+        EXPECT_EQ(registry.Unregister(clusters[i].get()), CHIP_NO_ERROR);
+    }
+    for (size_t i = 0; i < kClusterCount; i++)
+    {
+        EXPECT_EQ(registry.Get(clusters[i]->GetPath()), (i % 2 == 0) ? nullptr : clusters[i].get());
+    }
+
+    // and bring them back
+    for (size_t i = 0; i < kClusterCount; i += 2)
+    {
+        ASSERT_EQ(registry.Register(*registrations[i]), CHIP_NO_ERROR);
+    }
+    for (size_t i = 0; i < kClusterCount; i++)
+    {
+        EXPECT_EQ(registry.Get(clusters[i]->GetPath()), clusters[i].get());
+    }
+
+    size_t registered = 0;
+    for (auto * cluster : registry.AllServerClusterInstances())
+    {
+        (void) cluster;
+        registered++;
+    }
+    EXPECT_EQ(registered, kClusterCount);
+
+    for (size_t i = 0; i < kClusterCount; i++)
+    {
+        EXPECT_EQ(registry.Unregister(clusters[i].get()), CHIP_NO_ERROR);
+        EXPECT_EQ(registry.Get(clusters[i]->GetPath()), nullptr);
+    }
+}
+
 TEST_F(TestServerClusterInterfaceRegistry, RegisterErrors)
 {
     FakeServerClusterInterface cluster1(kEp1, kCluster1);
@@ -115,6 +115,8 @@ void CommissioningWindowManager::Shutdown()
     TEMPORARY_RETURN_IGNORED StopAdvertisement(/* aShuttingDown = */ true);
 
     ResetState();
+
+    mDerivedVerifier = DerivedVerifier();
 }
 
 void CommissioningWindowManager::ResetState()
@@ -290,11 +292,21 @@ CHIP_ERROR CommissioningWindowManager::AdvertiseAndListenForPASE()
         auto * commissionableDataProvider = DeviceLayer::GetCommissionableDataProvider();
         ReturnErrorOnFailure(commissionableDataProvider->GetSpake2pIterationCount(iterationCount));
         ReturnErrorOnFailure(commissionableDataProvider->GetSpake2pSalt(saltSpan));
-        ReturnErrorOnFailure(commissionableDataProvider->GetSpake2pVerifier(verifierSpan, serializedVerifierLen));
-        VerifyOrReturnError(Crypto::kSpake2p_VerifierSerialized_Length == serializedVerifierLen, CHIP_ERROR_INVALID_ARGUMENT);
-        VerifyOrReturnError(verifierSpan.size() == serializedVerifierLen, CHIP_ERROR_INTERNAL);
+        CHIP_ERROR err = commissionableDataProvider->GetSpake2pVerifier(verifierSpan, serializedVerifierLen);
+        if (err == CHIP_NO_ERROR)
+        {
+            VerifyOrReturnError(Crypto::kSpake2p_VerifierSerialized_Length == serializedVerifierLen, CHIP_ERROR_INVALID_ARGUMENT);
+            VerifyOrReturnError(verifierSpan.size() == serializedVerifierLen, CHIP_ERROR_INTERNAL);
 
-        ReturnErrorOnFailure(verifier.Deserialize(ByteSpan(serializedVerifier)));
+            ReturnErrorOnFailure(verifier.Deserialize(ByteSpan(serializedVerifier)));
+        }
+        else
+        {
+            // No verifier provisioned; derive one from the setup passcode, if the provider has one.
+            uint32_t setupPasscode = 0;
+            VerifyOrReturnError(commissionableDataProvider->GetSetupPasscode(setupPasscode) == CHIP_NO_ERROR, err);
+            ReturnErrorOnFailure(GetDerivedPASEVerifier(setupPasscode, iterationCount, saltSpan, verifier));
+        }
 
         ReturnErrorOnFailure(mPairingSession.WaitForPairing(mServer->GetSecureSessionManager(), verifier, iterationCount, saltSpan,
                                                             GetLocalMRPConfig(), this));
@@ -305,6 +317,32 @@ CHIP_ERROR CommissioningWindowManager::AdvertiseAndListenForPASE()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CommissioningWindowManager::GetDerivedPASEVerifier(uint32_t setupPasscode, uint32_t iterations, ByteSpan salt,
+                                                              Spake2pVerifier & verifier)
+{
+    VerifyOrReturnError(salt.size() <= sizeof(mDerivedVerifier.mSalt), CHIP_ERROR_INVALID_ARGUMENT);
+
+    ByteSpan derivedSalt(mDerivedVerifier.mSalt, mDerivedVerifier.mSaltLength);
+    bool reusable = mDerivedVerifier.mValid && mDerivedVerifier.mSetupPasscode == setupPasscode &&
+        mDerivedVerifier.mIterations == iterations && salt.data_equal(derivedSalt);
+    if (!reusable)
+    {
+        // PBKDF2 with the iteration counts used in practice takes a long time on constrained devices, so only do it
+        // when the inputs change, not every time a window opens or a PASE attempt fails.
+        mDerivedVerifier.mValid = false;
+        ReturnErrorOnFailure(PASESession::GeneratePASEVerifier(mDerivedVerifier.mVerifier, iterations, salt,
+                                                               /* useRandomPIN = */ false, setupPasscode));
+        memcpy(mDerivedVerifier.mSalt, salt.data(), salt.size());
+        mDerivedVerifier.mSaltLength    = salt.size();
+        mDerivedVerifier.mSetupPasscode = setupPasscode;
+        mDerivedVerifier.mIterations    = iterations;
+        mDerivedVerifier.mValid         = true;
+    }
+
+    verifier = mDerivedVerifier.mVerifier;
+    return CHIP_NO_ERROR;
+}
+
 System::Clock::Seconds32 CommissioningWindowManager::MaxCommissioningTimeout() const
 {
 #if CHIP_DEVICE_CONFIG_EXT_ADVERTISING
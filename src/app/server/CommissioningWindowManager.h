@@ -166,6 +166,10 @@ private:
 
     void Cleanup();
 
+    // Get the verifier for setupPasscode, reusing the last one derived if the inputs have not changed.
+    CHIP_ERROR GetDerivedPASEVerifier(uint32_t setupPasscode, uint32_t iterations, ByteSpan salt,
+                                      Crypto::Spake2pVerifier & verifier);
+
     /**
      * Function that gets called when our commissioning window timeout timer
      * fires.
@@ -224,6 +228,18 @@ private:
     uint32_t mECMSaltLength              = 0;
     uint8_t mECMSalt[Crypto::kSpake2p_Max_PBKDF_Salt_Length];
 
+    // Verifier derived from the setup passcode for basic commissioning windows, when the commissionable data
+    // provider has no verifier.  Kept in memory only, until Shutdown.
+    struct DerivedVerifier
+    {
+        bool mValid             = false;
+        uint32_t mSetupPasscode = 0;
+        uint32_t mIterations    = 0;
+        size_t mSaltLength      = 0;
+        uint8_t mSalt[Crypto::kSpake2p_Max_PBKDF_Salt_Length];
+        Crypto::Spake2pVerifier mVerifier;
+    } mDerivedVerifier;
+
     // For tests only, so that we can test the commissioning window timeout
     // without having to wait 3 minutes.
     Optional<System::Clock::Seconds32> mMinCommissioningTimeoutOverride;
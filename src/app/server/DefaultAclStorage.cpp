@@ -81,7 +81,8 @@ public:
 
         if (changeType == ChangeType::kRemoved)
         {
-            // Shuffle down entries past index, then delete entry at last index.
+            // Shuffle down entries past index, then delete entry at last index, all in one storage batch.
+            PersistentStorageBatch batch(*mPersistentStorage);
             while (true)
             {
                 uint16_t size = static_cast<uint16_t>(sizeof(buffer));
@@ -98,6 +99,7 @@ public:
             }
             SuccessOrExit(err = mPersistentStorage->SyncDeleteKeyValue(
                               DefaultStorageKeyAllocator::AccessControlAclEntry(fabric, index).KeyName()));
+            SuccessOrExit(err = batch.Commit());
         }
         else
         {
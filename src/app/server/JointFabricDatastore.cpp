@@ -22,6 +22,8 @@
 namespace chip {
 namespace app {
 
+namespace Attributes = Clusters::JointFabricDatastore::Attributes;
+
 void JointFabricDatastore::AddListener(Listener & listener)
 {
     if (mListeners == nullptr)
@@ -67,64 +69,92 @@ void JointFabricDatastore::RemoveListener(Listener & listener)
     }
 }
 
+void JointFabricDatastore::NotifyNodeListChanged()
+{
+    for (Listener * listener = mListeners; listener != nullptr; listener = listener->mNext)
+    {
+        listener->MarkNodeListChanged();
+    }
+}
+
+void JointFabricDatastore::NotifyListChanged(AttributeId attributeId)
+{
+    for (Listener * listener = mListeners; listener != nullptr; listener = listener->mNext)
+    {
+        listener->MarkListChanged(attributeId);
+    }
+}
+
+void JointFabricDatastore::RebuildNodeIndex()
+{
+    mNodeIndex.clear();
+    for (size_t i = 0; i < mNodeInformationEntries.size(); i++)
+    {
+        mNodeIndex.emplace(mNodeInformationEntries[i].nodeID, i);
+    }
+}
+
+void JointFabricDatastore::RebuildGroupIndex()
+{
+    mGroupIndex.clear();
+    for (size_t i = 0; i < mGroupInformationEntries.size(); i++)
+    {
+        mGroupIndex.emplace(mGroupInformationEntries[i].groupID, i);
+    }
+}
+
+void JointFabricDatastore::RebuildEndpointIndex()
+{
+    mEndpointIndex.clear();
+    for (size_t i = 0; i < mEndpointEntries.size(); i++)
+    {
+        mEndpointIndex.emplace(std::make_pair(mEndpointEntries[i].nodeID, mEndpointEntries[i].endpointID), i);
+    }
+}
+
 CHIP_ERROR JointFabricDatastore::AddPendingNode(NodeId nodeId, const CharSpan & friendlyName)
 {
     VerifyOrReturnError(mNodeInformationEntries.size() < kMaxNodes, CHIP_ERROR_NO_MEMORY);
     // check that nodeId does not already exist
-    VerifyOrReturnError(
-        std::none_of(mNodeInformationEntries.begin(), mNodeInformationEntries.end(),
-                     [nodeId](const GenericDatastoreNodeInformationEntry & entry) { return entry.nodeID == nodeId; }),
-        CHIP_IM_GLOBAL_STATUS(ConstraintError));
+    VerifyOrReturnError(mNodeIndex.find(nodeId) == mNodeIndex.end(), CHIP_IM_GLOBAL_STATUS(ConstraintError));
 
     mNodeInformationEntries.push_back(GenericDatastoreNodeInformationEntry(
         nodeId, Clusters::JointFabricDatastore::DatastoreStateEnum::kPending, MakeOptional(friendlyName)));
+    mNodeIndex.emplace(nodeId, mNodeInformationEntries.size() - 1);
 
-    for (Listener * listener = mListeners; listener != nullptr; listener = listener->mNext)
-    {
-        listener->MarkNodeListChanged();
-    }
+    NotifyNodeListChanged();
 
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR JointFabricDatastore::UpdateNode(NodeId nodeId, const CharSpan & friendlyName)
 {
-    for (auto & entry : mNodeInformationEntries)
-    {
-        if (entry.nodeID == nodeId)
-        {
-            entry.Set(MakeOptional(friendlyName));
-
-            for (Listener * listener = mListeners; listener != nullptr; listener = listener->mNext)
-            {
-                listener->MarkNodeListChanged();
-            }
+    size_t index = 0;
+    ReturnErrorOnFailure(IsNodeIDInDatastore(nodeId, index));
 
-            return CHIP_NO_ERROR;
-        }
+    auto & entry = mNodeInformationEntries[index];
+    if (entry.friendlyName.data_equal(friendlyName))
+    {
+        return CHIP_NO_ERROR;
     }
 
-    return CHIP_ERROR_NOT_FOUND;
+    entry.Set(MakeOptional(friendlyName));
+    NotifyNodeListChanged();
+
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR JointFabricDatastore::RemoveNode(NodeId nodeId)
 {
-    for (auto it = mNodeInformationEntries.begin(); it != mNodeInformationEntries.end(); ++it)
-    {
-        if (it->nodeID == nodeId)
-        {
-            mNodeInformationEntries.erase(it);
+    size_t index = 0;
+    ReturnErrorOnFailure(IsNodeIDInDatastore(nodeId, index));
 
-            for (Listener * listener = mListeners; listener != nullptr; listener = listener->mNext)
-            {
-                listener->MarkNodeListChanged();
-            }
+    mNodeInformationEntries.erase(mNodeInformationEntries.begin() + static_cast<std::ptrdiff_t>(index));
+    RebuildNodeIndex();
 
-            return CHIP_NO_ERROR;
-        }
-    }
+    NotifyNodeListChanged();
 
-    return CHIP_ERROR_NOT_FOUND;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR JointFabricDatastore::RefreshNode(NodeId nodeId, ReadOnlyBuffer<DataModel::EndpointEntry> endpointsList)
@@ -134,24 +164,25 @@ CHIP_ERROR JointFabricDatastore::RefreshNode(NodeId nodeId, ReadOnlyBuffer<DataM
 
     // 3.
 
+    const size_t endpointEntriesCount = mEndpointEntries.size();
+    bool endpointEntriesAdded         = false;
+
     // cycle through endpointsList and add them to the endpoint entries
     for (const auto & endpoint : endpointsList)
     {
-        auto it = std::find_if(
-            mEndpointEntries.begin(), mEndpointEntries.end(),
-            [&endpoint, &nodeId](const Clusters::JointFabricDatastore::Structs::DatastoreEndpointEntryStruct::Type & entry) {
-                return entry.nodeID == nodeId && entry.endpointID == endpoint.id;
-            });
-        if (it == mEndpointEntries.end())
+        if (mEndpointIndex.find(std::make_pair(nodeId, endpoint.id)) == mEndpointIndex.end())
         {
             Clusters::JointFabricDatastore::Structs::DatastoreEndpointEntryStruct::Type newEntry;
             newEntry.endpointID = endpoint.id;
             newEntry.nodeID     = nodeId;
             mEndpointEntries.push_back(newEntry);
+            mEndpointIndex.emplace(std::make_pair(nodeId, endpoint.id), mEndpointEntries.size() - 1);
+            endpointEntriesAdded = true;
         }
     }
 
     // Remove EndpointEntries that are not in the endpointsList
+    const size_t endpointEntriesCountAfterAdd = mEndpointEntries.size();
     mEndpointEntries.erase(std::remove_if(mEndpointEntries.begin(), mEndpointEntries.end(),
                                           [&](const auto & entry) {
                                               if (entry.nodeID != nodeId)
@@ -164,6 +195,18 @@ CHIP_ERROR JointFabricDatastore::RefreshNode(NodeId nodeId, ReadOnlyBuffer<DataM
                                                   [&](const auto & endpoint) { return entry.endpointID == endpoint.id; });
                                           }),
                            mEndpointEntries.end());
+    if (mEndpointEntries.size() != endpointEntriesCountAfterAdd)
+    {
+        RebuildEndpointIndex();
+    }
+    if (endpointEntriesAdded || mEndpointEntries.size() != endpointEntriesCount)
+    {
+        NotifyListChanged(Attributes::NodeEndpointList::Id);
+    }
+
+    const size_t endpointGroupIDEntriesCount = mEndpointGroupIDEntries.size();
+    const size_t endpointBindingEntriesCount = mEndpointBindingEntries.size();
+    const size_t aclEntriesCount             = mACLEntries.size();
 
     // TODO: read the Endpoint Group ID List from the actual device
 
@@ -300,13 +343,23 @@ CHIP_ERROR JointFabricDatastore::RefreshNode(NodeId nodeId, ReadOnlyBuffer<DataM
         ++it;
     }
 
+    if (mEndpointGroupIDEntries.size() != endpointGroupIDEntriesCount)
+    {
+        NotifyListChanged(Attributes::EndpointGroupIDList::Id);
+    }
+    if (mEndpointBindingEntries.size() != endpointBindingEntriesCount)
+    {
+        NotifyListChanged(Attributes::EndpointBindingList::Id);
+    }
+    if (mACLEntries.size() != aclEntriesCount)
+    {
+        NotifyListChanged(Attributes::NodeACLList::Id);
+    }
+
     // 6.
     ReturnErrorOnFailure(SetNode(nodeId, Clusters::JointFabricDatastore::DatastoreStateEnum::kCommitted));
 
-    for (Listener * listener = mListeners; listener != nullptr; listener = listener->mNext)
-    {
-        listener->MarkNodeListChanged();
-    }
+    NotifyNodeListChanged();
 
     return CHIP_NO_ERROR;
 }
@@ -321,16 +374,11 @@ CHIP_ERROR JointFabricDatastore::SetNode(NodeId nodeId, Clusters::JointFabricDat
 
 CHIP_ERROR JointFabricDatastore::IsNodeIDInDatastore(NodeId nodeId, size_t & index)
 {
-    for (auto & entry : mNodeInformationEntries)
-    {
-        if (entry.nodeID == nodeId)
-        {
-            index = static_cast<size_t>(&entry - &mNodeInformationEntries[0]);
-            return CHIP_NO_ERROR;
-        }
-    }
+    auto it = mNodeIndex.find(nodeId);
+    VerifyOrReturnError(it != mNodeIndex.end(), CHIP_ERROR_NOT_FOUND);
 
-    return CHIP_ERROR_NOT_FOUND;
+    index = it->second;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR
@@ -340,6 +388,7 @@ JointFabricDatastore::AddGroupKeySetEntry(Clusters::JointFabricDatastore::Struct
     VerifyOrReturnError(mGroupKeySetList.size() < kMaxGroupKeySet, CHIP_ERROR_NO_MEMORY);
 
     mGroupKeySetList.push_back(groupKeySet);
+    NotifyListChanged(Attributes::GroupKeySetList::Id);
 
     return CHIP_NO_ERROR;
 }
@@ -364,6 +413,7 @@ CHIP_ERROR JointFabricDatastore::RemoveGroupKeySetEntry(uint16_t groupKeySetId)
         if (it->groupKeySetID == groupKeySetId)
         {
             mGroupKeySetList.erase(it);
+            NotifyListChanged(Attributes::GroupKeySetList::Id);
             return CHIP_NO_ERROR;
         }
     }
@@ -380,6 +430,7 @@ JointFabricDatastore::UpdateGroupKeySetEntry(
         if (entry.groupKeySetID == groupKeySet.groupKeySetID)
         {
             entry = groupKeySet;
+            NotifyListChanged(Attributes::GroupKeySetList::Id);
 
             ReturnErrorOnFailure(UpdateNodeKeySetList(entry));
 
@@ -398,6 +449,7 @@ JointFabricDatastore::AddAdmin(
     VerifyOrReturnError(mAdminEntries.size() < kMaxAdminNodes, CHIP_ERROR_NO_MEMORY);
 
     mAdminEntries.push_back(adminId);
+    NotifyListChanged(Attributes::AdminList::Id);
 
     return CHIP_NO_ERROR;
 }
@@ -423,6 +475,7 @@ CHIP_ERROR JointFabricDatastore::UpdateAdmin(NodeId nodeId, CharSpan friendlyNam
         {
             entry.friendlyName = friendlyName;
             entry.icac         = icac;
+            NotifyListChanged(Attributes::AdminList::Id);
             return CHIP_NO_ERROR;
         }
     }
@@ -437,6 +490,7 @@ CHIP_ERROR JointFabricDatastore::RemoveAdmin(NodeId nodeId)
         if (it->nodeID == nodeId)
         {
             mAdminEntries.erase(it);
+            NotifyListChanged(Attributes::AdminList::Id);
             return CHIP_NO_ERROR;
         }
     }
@@ -453,6 +507,7 @@ JointFabricDatastore::UpdateNodeKeySetList(Clusters::JointFabricDatastore::Struc
         {
             // TODO: Need to update the keySetList on the actual device
             entry.statusEntry.state = Clusters::JointFabricDatastore::DatastoreStateEnum::kCommitted;
+            NotifyListChanged(Attributes::NodeKeySetList::Id);
             return CHIP_NO_ERROR;
         }
     }
@@ -503,6 +558,8 @@ CHIP_ERROR JointFabricDatastore::AddGroup(const Clusters::JointFabricDatastore::
 
     // Add the group entry to the datastore
     mGroupInformationEntries.push_back(groupEntry);
+    mGroupIndex.emplace(groupEntry.groupID, mGroupInformationEntries.size() - 1);
+    NotifyListChanged(Attributes::GroupList::Id);
 
     return CHIP_NO_ERROR;
 }
@@ -580,6 +637,8 @@ JointFabricDatastore::UpdateGroup(const Clusters::JointFabricDatastore::Commands
         // if found, set status to pending, update corresponding ACL on device, and then mark as committed.
     }
 
+    NotifyListChanged(Attributes::GroupList::Id);
+
     return CHIP_NO_ERROR;
 }
 
@@ -601,65 +660,45 @@ JointFabricDatastore::RemoveGroup(const Clusters::JointFabricDatastore::Commands
     }
 
     mGroupInformationEntries.erase(it);
+    RebuildGroupIndex();
+    NotifyListChanged(Attributes::GroupList::Id);
 
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR JointFabricDatastore::IsGroupIDInDatastore(chip::GroupId groupId, size_t & index)
 {
-    for (auto & entry : mGroupInformationEntries)
-    {
-        if (entry.groupID == groupId)
-        {
-            index = static_cast<size_t>(&entry - &mGroupInformationEntries[0]);
-            return CHIP_NO_ERROR;
-        }
-    }
+    auto it = mGroupIndex.find(groupId);
+    VerifyOrReturnError(it != mGroupIndex.end(), CHIP_ERROR_NOT_FOUND);
 
-    return CHIP_ERROR_NOT_FOUND;
+    index = it->second;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR JointFabricDatastore::IsNodeIdInNodeInformationEntries(NodeId nodeId, size_t & index)
 {
-    for (auto & entry : mNodeInformationEntries)
-    {
-        if (entry.nodeID == nodeId)
-        {
-            index = static_cast<size_t>(&entry - &mNodeInformationEntries[0]);
-            return CHIP_NO_ERROR;
-        }
-    }
-
-    return CHIP_ERROR_NOT_FOUND;
+    return IsNodeIDInDatastore(nodeId, index);
 }
 
 CHIP_ERROR JointFabricDatastore::UpdateEndpointForNode(NodeId nodeId, chip::EndpointId endpointId, CharSpan friendlyName)
 {
-    for (auto & entry : mEndpointEntries)
-    {
-        if (entry.nodeID == nodeId && entry.endpointID == endpointId)
-        {
-            entry.friendlyName = friendlyName;
-            return CHIP_NO_ERROR;
-        }
-    }
+    size_t index = 0;
+    ReturnErrorOnFailure(IsNodeIdAndEndpointInEndpointInformationEntries(nodeId, endpointId, index));
 
-    return CHIP_ERROR_NOT_FOUND;
+    mEndpointEntries[index].friendlyName = friendlyName;
+    NotifyListChanged(Attributes::NodeEndpointList::Id);
+
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR JointFabricDatastore::IsNodeIdAndEndpointInEndpointInformationEntries(NodeId nodeId, EndpointId endpointId,
                                                                                  size_t & index)
 {
-    for (auto & entry : mEndpointEntries)
-    {
-        if (entry.nodeID == nodeId && entry.endpointID == endpointId)
-        {
-            index = static_cast<size_t>(&entry - &mEndpointEntries[0]);
-            return CHIP_NO_ERROR;
-        }
-    }
+    auto it = mEndpointIndex.find(std::make_pair(nodeId, endpointId));
+    VerifyOrReturnError(it != mEndpointIndex.end(), CHIP_ERROR_NOT_FOUND);
 
-    return CHIP_ERROR_NOT_FOUND;
+    index = it->second;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR JointFabricDatastore::AddGroupIDToEndpointForNode(NodeId nodeId, chip::EndpointId endpointId, chip::GroupId groupId)
@@ -695,9 +734,11 @@ CHIP_ERROR JointFabricDatastore::AddGroupIDToEndpointForNode(NodeId nodeId, chip
             newNodeKeySet.statusEntry.state = Clusters::JointFabricDatastore::DatastoreStateEnum::kPending;
 
             mNodeKeySetEntries.push_back(newNodeKeySet);
+            NotifyListChanged(Attributes::NodeKeySetList::Id);
 
             ReturnErrorOnFailure(mDelegate->SyncNode(nodeId, newNodeKeySet, [this]() {
                 mNodeKeySetEntries.back().statusEntry.state = Clusters::JointFabricDatastore::DatastoreStateEnum::kCommitted;
+                NotifyListChanged(Attributes::NodeKeySetList::Id);
             }));
         }
     }
@@ -722,9 +763,11 @@ CHIP_ERROR JointFabricDatastore::AddGroupIDToEndpointForNode(NodeId nodeId, chip
 
     // Add the new ACL entry to the datastore
     mEndpointGroupIDEntries.push_back(newGroupEntry);
+    NotifyListChanged(Attributes::EndpointGroupIDList::Id);
 
     return mDelegate->SyncNode(nodeId, newGroupEntry, [this]() {
         mEndpointGroupIDEntries.back().statusEntry.state = Clusters::JointFabricDatastore::DatastoreStateEnum::kCommitted;
+        NotifyListChanged(Attributes::EndpointGroupIDList::Id);
     });
 }
 
@@ -740,12 +783,15 @@ CHIP_ERROR JointFabricDatastore::RemoveGroupIDFromEndpointForNode(NodeId nodeId,
         if (it->nodeID == nodeId && it->endpointID == endpointId && it->groupID == groupId)
         {
             it->statusEntry.state = Clusters::JointFabricDatastore::DatastoreStateEnum::kDeletePending;
+            NotifyListChanged(Attributes::EndpointGroupIDList::Id);
 
             // zero-initialized struct to indicate deletion for the SyncNode call
             Clusters::JointFabricDatastore::Structs::DatastoreEndpointGroupIDEntryStruct::Type endpointGroupIdNullEntry{ 0 };
 
-            ReturnErrorOnFailure(
-                mDelegate->SyncNode(nodeId, endpointGroupIdNullEntry, [this, it]() { mEndpointGroupIDEntries.erase(it); }));
+            ReturnErrorOnFailure(mDelegate->SyncNode(nodeId, endpointGroupIdNullEntry, [this, it]() {
+                mEndpointGroupIDEntries.erase(it);
+                NotifyListChanged(Attributes::EndpointGroupIDList::Id);
+            }));
 
             if (IsGroupIDInDatastore(groupId, index) == CHIP_NO_ERROR)
             {
@@ -757,11 +803,14 @@ CHIP_ERROR JointFabricDatastore::RemoveGroupIDFromEndpointForNode(NodeId nodeId,
                         it2->groupKeySetID == mGroupInformationEntries[index].groupKeySetID.Value())
                     {
                         it2->statusEntry.state = Clusters::JointFabricDatastore::DatastoreStateEnum::kDeletePending;
+                        NotifyListChanged(Attributes::NodeKeySetList::Id);
 
                         // zero-initialized struct to indicate deletion for the SyncNode call
                         Clusters::JointFabricDatastore::Structs::DatastoreNodeKeySetEntryStruct::Type nodeKeySetNullEntry{ 0 };
-                        ReturnErrorOnFailure(
-                            mDelegate->SyncNode(nodeId, nodeKeySetNullEntry, [this, it2]() { mNodeKeySetEntries.erase(it2); }));
+                        ReturnErrorOnFailure(mDelegate->SyncNode(nodeId, nodeKeySetNullEntry, [this, it2]() {
+                            mNodeKeySetEntries.erase(it2);
+                            NotifyListChanged(Attributes::NodeKeySetList::Id);
+                        }));
 
                         incrementIndex = false;
                     }
@@ -897,9 +946,11 @@ JointFabricDatastore::AddBindingToEndpointForNode(
 
     // Add the new binding entry to the datastore
     mEndpointBindingEntries.push_back(newBindingEntry);
+    NotifyListChanged(Attributes::EndpointBindingList::Id);
 
     return mDelegate->SyncNode(nodeId, newBindingEntry, [this]() {
         mEndpointBindingEntries.back().statusEntry.state = Clusters::JointFabricDatastore::DatastoreStateEnum::kCommitted;
+        NotifyListChanged(Attributes::EndpointBindingList::Id);
     });
 }
 
@@ -916,10 +967,14 @@ JointFabricDatastore::RemoveBindingFromEndpointForNode(uint16_t listId, NodeId n
         if (it->nodeID == nodeId && it->listID == listId && it->endpointID == endpointId)
         {
             it->statusEntry.state = Clusters::JointFabricDatastore::DatastoreStateEnum::kDeletePending;
+            NotifyListChanged(Attributes::EndpointBindingList::Id);
 
             // zero-initialized struct to indicate deletion for the SyncNode call
             Clusters::JointFabricDatastore::Structs::DatastoreEndpointBindingEntryStruct::Type nullEntry{ 0 };
-            return mDelegate->SyncNode(nodeId, nullEntry, [this, it]() { mEndpointBindingEntries.erase(it); });
+            return mDelegate->SyncNode(nodeId, nullEntry, [this, it]() {
+                mEndpointBindingEntries.erase(it);
+                NotifyListChanged(Attributes::EndpointBindingList::Id);
+            });
         }
     }
 
@@ -1075,6 +1130,7 @@ JointFabricDatastore::AddACLToNode(
 
     // Add the new ACL entry to the datastore
     mACLEntries.push_back(newACLEntry);
+    NotifyListChanged(Attributes::NodeACLList::Id);
 
     Clusters::JointFabricDatastore::Structs::DatastoreACLEntryStruct::Type entryToEncode;
     entryToEncode.nodeID             = newACLEntry.nodeID;
@@ -1090,6 +1146,7 @@ JointFabricDatastore::AddACLToNode(
 
     return mDelegate->SyncNode(nodeId, entryToEncode, [this]() {
         mACLEntries.back().statusEntry.state = Clusters::JointFabricDatastore::DatastoreStateEnum::kCommitted;
+        NotifyListChanged(Attributes::NodeACLList::Id);
     });
 }
 
@@ -1105,10 +1162,14 @@ CHIP_ERROR JointFabricDatastore::RemoveACLFromNode(uint16_t listId, NodeId nodeI
         if (it->nodeID == nodeId && it->listID == listId)
         {
             it->statusEntry.state = Clusters::JointFabricDatastore::DatastoreStateEnum::kDeletePending;
+            NotifyListChanged(Attributes::NodeACLList::Id);
 
             // zero-initialized struct to indicate deletion for the SyncNode call
             Clusters::JointFabricDatastore::Structs::DatastoreACLEntryStruct::Type nullEntry{ 0 };
-            return mDelegate->SyncNode(nodeId, nullEntry, [this, it]() { mACLEntries.erase(it); });
+            return mDelegate->SyncNode(nodeId, nullEntry, [this, it]() {
+                mACLEntries.erase(it);
+                NotifyListChanged(Attributes::NodeACLList::Id);
+            });
         }
     }
 
@@ -1131,6 +1192,7 @@ CHIP_ERROR JointFabricDatastore::AddNodeKeySetEntry(GroupId groupId, uint16_t gr
 
     // After adding the new entry, we can set it to committed
     mNodeKeySetEntries.back().statusEntry.state = Clusters::JointFabricDatastore::DatastoreStateEnum::kCommitted;
+    NotifyListChanged(Attributes::NodeKeySetList::Id);
 
     return CHIP_NO_ERROR;
 }
@@ -1162,7 +1224,10 @@ CHIP_ERROR JointFabricDatastore::RemoveNodeKeySetEntry(GroupId groupId, uint16_t
         }
     }
 
-    return any_node_removed ? CHIP_NO_ERROR : CHIP_ERROR_NOT_FOUND;
+    VerifyOrReturnError(any_node_removed, CHIP_ERROR_NOT_FOUND);
+    NotifyListChanged(Attributes::NodeKeySetList::Id);
+
+    return CHIP_NO_ERROR;
 }
 
 } // namespace app
@@ -25,6 +25,8 @@
 #include <lib/core/CHIPVendorIdentifiers.hpp>
 #include <lib/core/NodeId.h>
 #include <lib/support/ReadOnlyBuffer.h>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace chip {
@@ -263,7 +265,7 @@ public:
     }
 
     /**
-     * Used to notify of changes in the node list and more TODO.
+     * Used to notify of changes in the lists of the datastore.
      */
     class Listener
     {
@@ -275,6 +277,14 @@ public:
          */
         virtual void MarkNodeListChanged() = 0;
 
+        /**
+         * Notifies of a change in one of the other lists of the datastore. Only the lists which actually changed
+         * are notified, so that a change to one entry does not cause every list to be reported again.
+         *
+         * @param [in] attributeId  The Joint Fabric Datastore attribute holding the list, e.g. NodeEndpointList.
+         */
+        virtual void MarkListChanged(AttributeId attributeId) {}
+
     private:
         Listener * mNext = nullptr;
 
@@ -330,8 +340,28 @@ private:
     std::vector<datastore::ACLEntryStruct> mACLEntries;
     std::vector<Clusters::JointFabricDatastore::Structs::DatastoreEndpointEntryStruct::Type> mEndpointEntries;
 
+    // Hashed indexes into the vectors above, for the lookups done on every update. They hold vector indexes, so they
+    // are rebuilt whenever an entry is erased from the middle of the corresponding vector.
+    struct NodeEndpointHash
+    {
+        size_t operator()(const std::pair<NodeId, EndpointId> & key) const
+        {
+            return std::hash<NodeId>()(key.first) ^ (std::hash<EndpointId>()(key.second) << 1);
+        }
+    };
+    std::unordered_map<NodeId, size_t> mNodeIndex;
+    std::unordered_map<GroupId, size_t> mGroupIndex;
+    std::unordered_map<std::pair<NodeId, EndpointId>, size_t, NodeEndpointHash> mEndpointIndex;
+
     Listener * mListeners = nullptr;
 
+    void RebuildNodeIndex();
+    void RebuildGroupIndex();
+    void RebuildEndpointIndex();
+
+    void NotifyNodeListChanged();
+    void NotifyListChanged(AttributeId attributeId);
+
     CHIP_ERROR IsNodeIDInDatastore(NodeId nodeId, size_t & index);
 
     CHIP_ERROR UpdateNodeKeySetList(Clusters::JointFabricDatastore::Structs::DatastoreGroupKeySetStruct::Type & groupKeySet);
@@ -56,7 +56,9 @@
 #include <setup_payload/SetupPayload.h>
 #include <sys/param.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemStallDetector.h>
 #include <system/TLVPacketBufferBackingStore.h>
+#include <tracing/metric_event.h>
 #include <transport/SessionManager.h>
 #if CHIP_DEVICE_CONFIG_ENABLE_NFC_BASED_COMMISSIONING
 #include <transport/raw/NFC.h>
@@ -94,6 +96,34 @@ chip::Access::DynamicProviderDeviceTypeResolver sDeviceTypeResolver([] {
     return chip::app::InteractionModelEngine::GetInstance()->GetDataModelProvider();
 });
 
+// Reports the time spent in each phase of the server initialization as a metric, in milliseconds.
+class InitPhaseTimer
+{
+public:
+    InitPhaseTimer() : mStart(chip::System::SystemClock().GetMonotonicTimestamp()), mPhaseStart(mStart) {}
+
+    void EndPhase([[maybe_unused]] chip::Tracing::MetricKey key)
+    {
+        chip::System::Clock::Timestamp now = chip::System::SystemClock().GetMonotonicTimestamp();
+        MATTER_LOG_METRIC(key, ToMilliseconds(now - mPhaseStart));
+        mPhaseStart = now;
+    }
+
+    void End([[maybe_unused]] chip::Tracing::MetricKey key)
+    {
+        MATTER_LOG_METRIC(key, ToMilliseconds(chip::System::SystemClock().GetMonotonicTimestamp() - mStart));
+    }
+
+private:
+    static uint32_t ToMilliseconds(chip::System::Clock::Timestamp duration)
+    {
+        return std::chrono::duration_cast<chip::System::Clock::Milliseconds32>(duration).count();
+    }
+
+    const chip::System::Clock::Timestamp mStart;
+    chip::System::Clock::Timestamp mPhaseStart;
+};
+
 } // namespace
 
 namespace chip {
@@ -115,6 +145,14 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     assertChipStackLockedByCurrentThread();
 
     mInitTimestamp = System::SystemClock().GetMonotonicMicroseconds64();
+    InitPhaseTimer initTimer;
+
+#if CHIP_SYSTEM_CONFIG_STALL_DETECTION
+    System::StallDetector::Instance().SetStallHandler([](const System::StallDetector::Record & record) {
+        MATTER_LOG_METRIC(Tracing::kMetricEventLoopStall,
+                          std::chrono::duration_cast<System::Clock::Milliseconds32>(record.duration).count());
+    });
+#endif // CHIP_SYSTEM_CONFIG_STALL_DETECTION
 
     CASESessionManagerConfig caseSessionManagerConfig;
     DeviceLayer::DeviceInfoProvider * deviceInfoprovider = nullptr;
@@ -191,6 +229,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
         err = mFabrics.Init(fabricTableInitParams);
         SuccessOrExit(err);
     }
+    initTimer.EndPhase(Tracing::kMetricServerInitFabricTable);
 
     SuccessOrExit(err = mAccessControl.Init(initParams.accessDelegate, sDeviceTypeResolver));
     Access::SetAccessControl(mAccessControl);
@@ -204,6 +243,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 
     mAclStorage = initParams.aclStorage;
     SuccessOrExit(err = mAclStorage->Init(*mDeviceStorage, mFabrics.begin(), mFabrics.end()));
+    initTimer.EndPhase(Tracing::kMetricServerInitAccessControl);
 
     mGroupsProvider = initParams.groupDataProvider;
     SetGroupDataProvider(mGroupsProvider);
@@ -296,6 +336,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     app::DnssdServer::Instance().SetCommissioningModeProvider(&mCommissioningWindowManager);
 
     TEMPORARY_RETURN_IGNORED Dnssd::Resolver::Instance().Init(DeviceLayer::UDPEndPointManager());
+    initTimer.EndPhase(Tracing::kMetricServerInitTransport);
 
 #if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
     // Initialize event logging subsystem
@@ -313,10 +354,12 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
         err = app::EventManagement::GetInstance().Init(&mExchangeMgr, CHIP_NUM_EVENT_LOGGING_BUFFERS, &sLoggingBuffer[0],
                                                        &logStorageResources[0], &sGlobalEventIdCounter,
                                                        std::chrono::duration_cast<System::Clock::Milliseconds64>(mInitTimestamp),
-                                                       &app::InteractionModelEngine::GetInstance()->GetReportingEngine());
+                                                       &app::InteractionModelEngine::GetInstance()->GetReportingEngine(),
+                                                       initParams.persistentEventStore);
 
         SuccessOrExit(err);
     }
+    initTimer.EndPhase(Tracing::kMetricServerInitEventLogging);
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 
     // SetDataModelProvider() initializes and starts the provider, which in turn
@@ -335,6 +378,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     // This remains the single point of entry to ensure that all cluster-level
     // initialization is performed in the correct order.
     app::InteractionModelEngine::GetInstance()->SetDataModelProvider(initParams.dataModelProvider);
+    initTimer.EndPhase(Tracing::kMetricServerInitDataModel);
 
 #if defined(CHIP_APP_USE_ECHO)
     err = InitEchoHandler(&mExchangeMgr);
@@ -446,7 +490,10 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     // Thread LWIP devices using dedicated Inet endpoint implementations are excluded because they call this function from:
     // src/platform/OpenThread/GenericThreadStackManagerImpl_OpenThread_LwIP.cpp
 #if !CHIP_SYSTEM_CONFIG_USE_OPENTHREAD_ENDPOINT
-    RejoinExistingMulticastGroups();
+    if (!initParams.deferNonCriticalInit)
+    {
+        RejoinExistingMulticastGroups();
+    }
 #endif // !CHIP_SYSTEM_CONFIG_USE_OPENTHREAD_ENDPOINT
 
     // Handle deferred clean-up of a previously armed fail-safe that occurred during FabricTable commit.
@@ -507,6 +554,15 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     mIsDnssdReady = Dnssd::Resolver::Instance().IsInitialized();
     CheckServerReadyEvent();
 
+    if (initParams.deferNonCriticalInit)
+    {
+        SuccessOrExit(err = PlatformMgr().ScheduleWork(
+                          [](intptr_t arg) { reinterpret_cast<Server *>(arg)->DeferredInit(); }, reinterpret_cast<intptr_t>(this)));
+        mDeferredInitPending = true;
+    }
+    initTimer.EndPhase(Tracing::kMetricServerInitServices);
+    initTimer.End(Tracing::kMetricServerInit);
+
 exit:
     if (err != CHIP_NO_ERROR)
     {
@@ -577,6 +633,21 @@ void Server::CheckServerReadyEvent()
     }
 }
 
+void Server::DeferredInit()
+{
+    // The server may have been shut down before the work ran.
+    VerifyOrReturn(mDeferredInitPending);
+    mDeferredInitPending = false;
+
+    InitPhaseTimer initTimer;
+
+#if !CHIP_SYSTEM_CONFIG_USE_OPENTHREAD_ENDPOINT
+    RejoinExistingMulticastGroups();
+#endif // !CHIP_SYSTEM_CONFIG_USE_OPENTHREAD_ENDPOINT
+
+    initTimer.End(Tracing::kMetricServerInitDeferred);
+}
+
 void Server::OnPlatformEventWrapper(const DeviceLayer::ChipDeviceEvent * event, intptr_t server)
 {
     reinterpret_cast<Server *>(server)->OnPlatformEvent(*event);
@@ -659,6 +730,7 @@ void Server::ScheduleFactoryReset()
 void Server::Shutdown()
 {
     assertChipStackLockedByCurrentThread();
+    mDeferredInitPending = false;
     PlatformMgr().RemoveEventHandler(OnPlatformEventWrapper, 0);
     mCASEServer.Shutdown();
     mCASESessionManager.Shutdown();
@@ -27,6 +27,7 @@
 #include <app/DefaultSafeAttributePersistenceProvider.h>
 #include <app/FailSafeContext.h>
 #include <app/OperationalSessionSetupPool.h>
+#include <app/PersistentEventStore.h>
 #include <app/SimpleSubscriptionResumptionStorage.h>
 #include <app/TestEventTriggerDelegate.h>
 #include <app/server/AclStorage.h>
@@ -167,6 +168,9 @@ struct ServerInitParams
     // Session resumption storage: Optional. Support session resumption when provided.
     // Must be initialized before being provided.
     app::SubscriptionResumptionStorage * subscriptionResumptionStorage = nullptr;
+    // Persistent event store: Optional. Keeps events, so they can be delivered after a restart, when provided.
+    // Must be initialized before being provided.
+    app::PersistentEventStore * persistentEventStore = nullptr;
     // Certificate validity policy: Optional. If none is injected, CHIPCert
     // enforces a default policy.
     Credentials::CertificateValidityPolicy * certificateValidityPolicy = nullptr;
@@ -213,6 +217,11 @@ struct ServerInitParams
     chip::app::DataModel::Provider * dataModelProvider = nullptr;
 
     bool advertiseCommissionableIfNoFabrics = CHIP_DEVICE_CONFIG_ENABLE_PAIRING_AUTOSTART;
+
+    // Optional. When true, the initialization work that is not needed to answer the first requests (currently rejoining
+    // the multicast groups of the existing fabrics) is run from the event loop once Server::Init() returned, instead of
+    // delaying it.
+    bool deferNonCriticalInit = false;
 };
 
 /**
@@ -503,6 +512,7 @@ private:
     static Server sServer;
 
     void InitFailSafe();
+    void DeferredInit();
     void OnPlatformEvent(const DeviceLayer::ChipDeviceEvent & event);
     void CheckServerReadyEvent();
 
@@ -753,7 +763,8 @@ private:
     Credentials::OperationalCertificateStore * mOpCertStore;
     app::FailSafeContext mFailSafeContext;
 
-    bool mIsDnssdReady = false;
+    bool mIsDnssdReady        = false;
+    bool mDeferredInitPending = false;
     uint16_t mOperationalServicePort;
     uint16_t mUserDirectedCommissioningPort;
     Inet::InterfaceId mInterfaceId;
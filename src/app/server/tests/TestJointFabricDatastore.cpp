@@ -1,6 +1,8 @@
 #include "app/server/JointFabricDatastore.h"
 #include <pw_unit_test/framework.h>
 
+#include <vector>
+
 using namespace chip;
 using namespace chip::app;
 
@@ -10,9 +12,15 @@ class DummyListener : public JointFabricDatastore::Listener
 {
 public:
     void MarkNodeListChanged() override { mNotified = true; }
-    void Reset() { mNotified = false; }
+    void MarkListChanged(AttributeId attributeId) override { mChangedLists.push_back(attributeId); }
+    void Reset()
+    {
+        mNotified = false;
+        mChangedLists.clear();
+    }
 
     bool mNotified = false;
+    std::vector<AttributeId> mChangedLists;
 };
 
 TEST(JointFabricDatastoreTest, AddPendingNodeNotifiesListener)
@@ -42,4 +50,74 @@ TEST(JointFabricDatastoreTest, RemoveListenerPreventsNotification)
     EXPECT_FALSE(listener.mNotified);
 }
 
+TEST(JointFabricDatastoreTest, NodeLookupsSurviveRemovals)
+{
+    JointFabricDatastore store;
+
+    for (NodeId nodeId = 1; nodeId <= 200; nodeId++)
+    {
+        EXPECT_EQ(store.AddPendingNode(nodeId, CharSpan::fromCharString("node")), CHIP_NO_ERROR);
+    }
+    EXPECT_NE(store.AddPendingNode(100, CharSpan::fromCharString("duplicate")), CHIP_NO_ERROR);
+
+    // Removing entries from the middle moves the following ones in the node list
+    for (NodeId nodeId = 2; nodeId <= 200; nodeId += 2)
+    {
+        EXPECT_EQ(store.RemoveNode(nodeId), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(store.GetNodeInformationEntries().size(), 100u);
+
+    for (NodeId nodeId = 1; nodeId <= 200; nodeId++)
+    {
+        CHIP_ERROR expected = (nodeId % 2 == 1) ? CHIP_NO_ERROR : CHIP_ERROR_NOT_FOUND;
+        EXPECT_EQ(store.UpdateNode(nodeId, CharSpan::fromCharString("renamed")), expected);
+    }
+
+    for (const auto & entry : store.GetNodeInformationEntries())
+    {
+        EXPECT_EQ(entry.nodeID % 2, 1u);
+        EXPECT_TRUE(entry.friendlyName.data_equal(CharSpan::fromCharString("renamed")));
+    }
+
+    EXPECT_EQ(store.AddPendingNode(2, CharSpan::fromCharString("node")), CHIP_NO_ERROR);
+    EXPECT_EQ(store.SetNode(2, Clusters::JointFabricDatastore::DatastoreStateEnum::kCommitted), CHIP_NO_ERROR);
+}
+
+TEST(JointFabricDatastoreTest, OnlyChangedListsAreNotified)
+{
+    JointFabricDatastore store;
+    DummyListener listener;
+
+    store.AddListener(listener);
+    EXPECT_EQ(store.AddPendingNode(123, CharSpan::fromCharString("controller-a")), CHIP_NO_ERROR);
+    EXPECT_TRUE(listener.mNotified);
+    EXPECT_TRUE(listener.mChangedLists.empty());
+
+    // Same friendly name: nothing to report
+    listener.Reset();
+    EXPECT_EQ(store.UpdateNode(123, CharSpan::fromCharString("controller-a")), CHIP_NO_ERROR);
+    EXPECT_FALSE(listener.mNotified);
+
+    Clusters::JointFabricDatastore::Commands::AddGroup::DecodableType addGroup;
+    addGroup.groupID      = 0x1234;
+    addGroup.friendlyName = CharSpan::fromCharString("group");
+
+    listener.Reset();
+    EXPECT_EQ(store.AddGroup(addGroup), CHIP_NO_ERROR);
+    EXPECT_FALSE(listener.mNotified);
+    ASSERT_EQ(listener.mChangedLists.size(), 1u);
+    EXPECT_EQ(listener.mChangedLists[0], Clusters::JointFabricDatastore::Attributes::GroupList::Id);
+
+    Clusters::JointFabricDatastore::Commands::RemoveGroup::DecodableType removeGroup;
+    removeGroup.groupID = 0x1234;
+
+    listener.Reset();
+    EXPECT_EQ(store.RemoveGroup(removeGroup), CHIP_NO_ERROR);
+    ASSERT_EQ(listener.mChangedLists.size(), 1u);
+    EXPECT_EQ(listener.mChangedLists[0], Clusters::JointFabricDatastore::Attributes::GroupList::Id);
+    EXPECT_NE(store.RemoveGroup(removeGroup), CHIP_NO_ERROR);
+
+    store.RemoveListener(listener);
+}
+
 } // namespace
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <app/storage/TableEntry.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/support/CommonIterator.h>
 #include <lib/support/PersistentData.h>
 #include <lib/support/TypeTraits.h>
@@ -176,6 +177,23 @@ protected:
     // Endpoint entry count
     CHIP_ERROR SetEndpointEntryCount(const uint8_t & entry_count);
 
+    /**
+     * @brief Position in storage of a recently used entry, which lets GetTableEntry load the entry without first loading the
+     * fabric's entry map. A position is only a hint: the entry stored there is returned only if it has the expected ID.
+     */
+    struct EntryPositionHint
+    {
+        EndpointId endpoint_id   = kInvalidEndpointId;
+        FabricIndex fabric_index = kUndefinedFabricIndex;
+        StorageId entry_id;
+        EntryIndex index = 0;
+    };
+
+    const EntryPositionHint * FindPositionHint(FabricIndex fabric_index, const StorageId & entry_id) const;
+    void RememberPosition(FabricIndex fabric_index, const StorageId & entry_id, EntryIndex index);
+    // Forgets the hints of a fabric on an endpoint; kInvalidEndpointId and kUndefinedFabricIndex match any endpoint or fabric
+    void ForgetPositions(EndpointId endpoint, FabricIndex fabric_index);
+
     /**
      * @brief Implementation of an iterator over the elements in the FabricTableImpl.
      *
@@ -209,6 +227,10 @@ protected:
     uint16_t mMaxPerEndpoint;
     EndpointId mEndpointId               = kInvalidEndpointId;
     PersistentStorageDelegate * mStorage = nullptr;
+#if CHIP_CONFIG_FABRIC_TABLE_ENTRY_POSITION_HINTS > 0
+    EntryPositionHint mPositionHints[CHIP_CONFIG_FABRIC_TABLE_ENTRY_POSITION_HINTS];
+    uint8_t mNextPositionHint = 0;
+#endif
 }; // class FabricTableImpl
 
 } // namespace Storage
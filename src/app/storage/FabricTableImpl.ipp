@@ -514,12 +514,15 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::Init(PersistentStorageDelega
     VerifyOrReturnError(mMaxPerFabric <= Serializer::kMaxPerFabric() && mMaxPerEndpoint <= Serializer::kMaxPerEndpoint(),
                         CHIP_ERROR_INVALID_INTEGER_VALUE);
     this->mStorage = &storage;
+    ForgetPositions(kInvalidEndpointId, kUndefinedFabricIndex);
     return CHIP_NO_ERROR;
 }
 
 template <class StorageId, class StorageData>
 void FabricTableImpl<StorageId, StorageData>::Finish()
-{}
+{
+    ForgetPositions(kInvalidEndpointId, kUndefinedFabricIndex);
+}
 
 template <class StorageId, class StorageData>
 CHIP_ERROR FabricTableImpl<StorageId, StorageData>::GetFabricEntryCount(FabricIndex fabric_index, uint8_t & entry_count)
@@ -611,6 +614,8 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::SetTableEntry(FabricIndex fa
 
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    // A new entry updates the endpoint entry count, the fabric entry map and the entry itself
+    PersistentStorageBatch batch(*mStorage);
     TypedFabricEntryData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
 
     // Load fabric data (defaults to zero)
@@ -618,7 +623,18 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::SetTableEntry(FabricIndex fa
     VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
 
     err = fabric.SaveEntry(*mStorage, id, data, writeBuffer);
-    return err;
+    if (CHIP_NO_ERROR != err)
+    {
+        ForgetPositions(mEndpointId, fabric_index);
+        return err;
+    }
+
+    EntryIndex index;
+    if (fabric.Find(id, index) == CHIP_NO_ERROR)
+    {
+        RememberPosition(fabric_index, id, index);
+    }
+    return batch.Commit();
 }
 
 template <class StorageId, class StorageData>
@@ -630,6 +646,18 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::GetTableEntry(FabricIndex fa
                                                  Serializer::kFabricMaxBytes(), Serializer::kMaxPerFabric()>;
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    const EntryPositionHint * hint = FindPositionHint(fabric_index, entry_id);
+    if (hint != nullptr && hint->index < mMaxPerFabric)
+    {
+        StorageId stored_id = entry_id;
+        TableEntryData<StorageId, StorageData> hinted_entry(mEndpointId, fabric_index, stored_id, data, hint->index);
+        if (hinted_entry.Load(mStorage, buffer.BufferSpan()) == CHIP_NO_ERROR && stored_id == entry_id)
+        {
+            return CHIP_NO_ERROR;
+        }
+        ForgetPositions(mEndpointId, fabric_index);
+    }
+
     TypedFabricEntryData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
     TableEntryData<StorageId, StorageData> table_entry(mEndpointId, fabric_index, entry_id, data);
 
@@ -646,6 +674,7 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::GetTableEntry(FabricIndex fa
     }
     ReturnErrorOnFailure(err);
 
+    RememberPosition(fabric_index, entry_id, table_entry.index);
     return CHIP_NO_ERROR;
 }
 
@@ -672,11 +701,14 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::RemoveTableEntry(FabricIndex
                                                  Serializer::kFabricMaxBytes(), Serializer::kMaxPerFabric()>;
 
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    PersistentStorageBatch batch(*mStorage);
     TypedFabricEntryData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
 
+    ForgetPositions(mEndpointId, fabric_index);
     ReturnErrorOnFailure(fabric.Load(mStorage));
 
-    return fabric.RemoveEntry(*mStorage, entry_id);
+    ReturnErrorOnFailure(fabric.RemoveEntry(*mStorage, entry_id));
+    return batch.Commit();
 }
 
 /// @brief This function is meant to provide a way to empty the entry table without knowing any specific entry Id. Outside of this
@@ -693,15 +725,18 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::RemoveTableEntryAtPosition(E
 
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    PersistentStorageBatch batch(*mStorage);
     TypedFabricEntryData fabric(endpoint, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
 
+    ForgetPositions(endpoint, fabric_index);
     ReturnErrorOnFailure(fabric.Load(mStorage));
     StorageId entryId;
     CHIP_ERROR err = fabric.FindByIndex(*mStorage, entry_idx, entryId);
     VerifyOrReturnValue(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
     ReturnErrorOnFailure(err);
 
-    return fabric.RemoveEntry(*mStorage, entryId);
+    ReturnErrorOnFailure(fabric.RemoveEntry(*mStorage, entryId));
+    return batch.Commit();
 }
 
 template <class StorageId, class StorageData>
@@ -712,6 +747,8 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::RemoveFabric(FabricIndex fab
 
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    PersistentStorageBatch batch(*mStorage);
+    ForgetPositions(kInvalidEndpointId, fabric_index);
     for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
     {
         if (!emberAfEndpointIndexIsEnabled(index))
@@ -739,7 +776,7 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::RemoveFabric(FabricIndex fab
         ReturnErrorOnFailure(fabric.Delete(mStorage));
     }
 
-    return CHIP_NO_ERROR;
+    return batch.Commit();
 }
 
 template <class StorageId, class StorageData>
@@ -750,6 +787,8 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::RemoveEndpoint()
 
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    PersistentStorageBatch batch(*mStorage);
+    ForgetPositions(mEndpointId, kUndefinedFabricIndex);
     for (FabricIndex fabric_index = kMinValidFabricIndex; fabric_index < kMaxValidFabricIndex; fabric_index++)
     {
         TypedFabricEntryData fabric(mEndpointId, fabric_index);
@@ -772,7 +811,57 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::RemoveEndpoint()
         ReturnErrorOnFailure(fabric.Delete(mStorage));
     }
 
-    return CHIP_NO_ERROR;
+    return batch.Commit();
+}
+
+template <class StorageId, class StorageData>
+const typename FabricTableImpl<StorageId, StorageData>::EntryPositionHint *
+FabricTableImpl<StorageId, StorageData>::FindPositionHint(FabricIndex fabric_index, const StorageId & entry_id) const
+{
+#if CHIP_CONFIG_FABRIC_TABLE_ENTRY_POSITION_HINTS > 0
+    for (const EntryPositionHint & hint : mPositionHints)
+    {
+        if (hint.endpoint_id == mEndpointId && hint.fabric_index == fabric_index && hint.entry_id == entry_id)
+        {
+            return &hint;
+        }
+    }
+#endif
+    return nullptr;
+}
+
+template <class StorageId, class StorageData>
+void FabricTableImpl<StorageId, StorageData>::RememberPosition(FabricIndex fabric_index, const StorageId & entry_id,
+                                                               EntryIndex index)
+{
+#if CHIP_CONFIG_FABRIC_TABLE_ENTRY_POSITION_HINTS > 0
+    auto * hint = const_cast<EntryPositionHint *>(FindPositionHint(fabric_index, entry_id));
+    if (hint == nullptr)
+    {
+        hint              = &mPositionHints[mNextPositionHint];
+        mNextPositionHint = static_cast<uint8_t>((mNextPositionHint + 1) % CHIP_CONFIG_FABRIC_TABLE_ENTRY_POSITION_HINTS);
+    }
+    hint->endpoint_id  = mEndpointId;
+    hint->fabric_index = fabric_index;
+    hint->entry_id     = entry_id;
+    hint->index        = index;
+#endif
+}
+
+template <class StorageId, class StorageData>
+void FabricTableImpl<StorageId, StorageData>::ForgetPositions(EndpointId endpoint, FabricIndex fabric_index)
+{
+#if CHIP_CONFIG_FABRIC_TABLE_ENTRY_POSITION_HINTS > 0
+    for (EntryPositionHint & hint : mPositionHints)
+    {
+        if ((endpoint == kInvalidEndpointId || hint.endpoint_id == endpoint) &&
+            (fabric_index == kUndefinedFabricIndex || hint.fabric_index == fabric_index))
+        {
+            hint.endpoint_id  = kInvalidEndpointId;
+            hint.fabric_index = kUndefinedFabricIndex;
+        }
+    }
+#endif
 }
 
 template <class StorageId, class StorageData>
@@ -0,0 +1,152 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/AttributeReportCache.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <pw_unit_test/framework.h>
+
+#include <cstring>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+class TestAttributeReportCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+};
+
+constexpr EndpointId kEndpoint = 1;
+constexpr ClusterId kCluster   = 6;
+
+AttributeReportCache::Key MakeKey(AttributeId attribute, DataVersion version, FabricIndex fabric = 1)
+{
+    return AttributeReportCache::Key{ ConcreteAttributePath(kEndpoint, kCluster, attribute), version, fabric,
+                                      BitFlags<DataModel::ReadFlags>(DataModel::ReadFlags::kFabricFiltered) };
+}
+
+void AddEntry(AttributeReportCache & cache, const AttributeReportCache::Key & key, uint8_t value, size_t length)
+{
+    MutableByteSpan space = cache.GetFreeSpace();
+    ASSERT_GE(space.size(), length);
+    memset(space.data(), value, length);
+    cache.Add(key, length);
+}
+
+TEST_F(TestAttributeReportCache, TestNotInitialized)
+{
+    AttributeReportCache cache;
+    ByteSpan encoding;
+
+    EXPECT_FALSE(cache.IsInitialized());
+    EXPECT_TRUE(cache.GetFreeSpace().empty());
+    EXPECT_FALSE(cache.Find(MakeKey(0, 1), encoding));
+}
+
+TEST_F(TestAttributeReportCache, TestFindAdded)
+{
+    AttributeReportCache cache;
+    ASSERT_EQ(cache.Init(256), CHIP_NO_ERROR);
+
+    AddEntry(cache, MakeKey(0, 1), 0xAA, 8);
+    AddEntry(cache, MakeKey(1, 1), 0xBB, 4);
+
+    ByteSpan encoding;
+    ASSERT_TRUE(cache.Find(MakeKey(0, 1), encoding));
+    ASSERT_EQ(encoding.size(), 8u);
+    EXPECT_EQ(encoding[7], 0xAA);
+
+    ASSERT_TRUE(cache.Find(MakeKey(1, 1), encoding));
+    ASSERT_EQ(encoding.size(), 4u);
+    EXPECT_EQ(encoding[0], 0xBB);
+
+    // Anything the encoding depends on tells entries apart.
+    EXPECT_FALSE(cache.Find(MakeKey(0, 2), encoding));
+    EXPECT_FALSE(cache.Find(MakeKey(0, 1, 2), encoding));
+    EXPECT_FALSE(cache.Find(MakeKey(2, 1), encoding));
+
+    AttributeReportCache::Key unfiltered = MakeKey(0, 1);
+    unfiltered.mReadFlags.Clear(DataModel::ReadFlags::kFabricFiltered);
+    EXPECT_FALSE(cache.Find(unfiltered, encoding));
+
+    cache.Release();
+    EXPECT_FALSE(cache.IsInitialized());
+    EXPECT_FALSE(cache.Find(MakeKey(0, 1), encoding));
+}
+
+TEST_F(TestAttributeReportCache, TestFull)
+{
+    AttributeReportCache cache;
+    ASSERT_EQ(cache.Init(128), CHIP_NO_ERROR);
+
+    // Fill the cache up to the last byte.
+    const size_t length = cache.GetFreeSpace().size();
+    AddEntry(cache, MakeKey(0, 1), 0xCC, length);
+    EXPECT_TRUE(cache.GetFreeSpace().empty());
+
+    ByteSpan encoding;
+    ASSERT_TRUE(cache.Find(MakeKey(0, 1), encoding));
+    EXPECT_EQ(encoding.size(), length);
+
+    // Entries larger than the free space are not added.
+    ASSERT_EQ(cache.Init(128), CHIP_NO_ERROR);
+    cache.Add(MakeKey(0, 1), cache.GetFreeSpace().size() + 1);
+    EXPECT_FALSE(cache.Find(MakeKey(0, 1), encoding));
+}
+
+TEST_F(TestAttributeReportCache, TestClearAndHasEntryIn)
+{
+    AttributeReportCache cache;
+    ASSERT_EQ(cache.Init(256), CHIP_NO_ERROR);
+    EXPECT_TRUE(cache.IsEmpty());
+    EXPECT_FALSE(cache.HasEntryIn(AttributePathParams()));
+
+    AddEntry(cache, MakeKey(0, 1), 0xAA, 8);
+    AddEntry(cache, MakeKey(3, 1), 0xBB, 4);
+    EXPECT_FALSE(cache.IsEmpty());
+
+    EXPECT_TRUE(cache.HasEntryIn(AttributePathParams(kEndpoint, kCluster, 3)));
+    EXPECT_TRUE(cache.HasEntryIn(AttributePathParams(kEndpoint, kCluster)));
+    EXPECT_TRUE(cache.HasEntryIn(AttributePathParams()));
+    EXPECT_FALSE(cache.HasEntryIn(AttributePathParams(kEndpoint, kCluster, 2)));
+    EXPECT_FALSE(cache.HasEntryIn(AttributePathParams(static_cast<EndpointId>(kEndpoint + 1), kCluster)));
+    EXPECT_FALSE(cache.HasEntryIn(AttributePathParams(kEndpoint, static_cast<ClusterId>(kCluster + 1))));
+
+    // Clearing keeps the buffer for new entries.
+    const size_t freeSpace = cache.GetFreeSpace().size();
+    cache.Clear();
+    EXPECT_TRUE(cache.IsInitialized());
+    EXPECT_TRUE(cache.IsEmpty());
+    EXPECT_GT(cache.GetFreeSpace().size(), freeSpace);
+
+    ByteSpan encoding;
+    EXPECT_FALSE(cache.Find(MakeKey(0, 1), encoding));
+    EXPECT_FALSE(cache.HasEntryIn(AttributePathParams()));
+
+    AddEntry(cache, MakeKey(0, 2), 0xCC, 8);
+    ASSERT_TRUE(cache.Find(MakeKey(0, 2), encoding));
+    EXPECT_EQ(encoding[0], 0xCC);
+}
+
+} // namespace
@@ -577,6 +577,130 @@ TEST(TestAttributeValueEncoder, TestEncodeListChunking2)
     }
 }
 
+TEST(TestAttributeValueEncoder, TestEncodeResumableListChunking)
+{
+    bool list[]      = { true, false, false, true, true, false };
+    auto listEncoder = [&list](const auto & encoder) -> CHIP_ERROR {
+        for (auto & item : list)
+        {
+            ReturnErrorOnFailure(encoder.Encode(item));
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    uint32_t startPositions[3] = {};
+    size_t visitedItems        = 0;
+    size_t chunk               = 0;
+    auto resumableListEncoder  = [&](uint32_t startPosition, const auto & encoder) -> CHIP_ERROR {
+        startPositions[chunk] = startPosition;
+        for (uint32_t i = startPosition; i < MATTER_ARRAY_SIZE(list); i++)
+        {
+            visitedItems++;
+            ReturnErrorOnFailure(encoder.Encode(list[i], i + 1));
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    // Chunk the same way as TestEncodeListChunking: the resumable form must produce exactly the same reports.
+    AttributeEncodeState state;
+    AttributeEncodeState resumableState;
+    {
+        LimitedTestSetup<30> expected(kTestFabricIndex);
+        EXPECT_NE(expected.encoder.EncodeList(listEncoder), CHIP_NO_ERROR);
+        state = expected.encoder.GetState();
+
+        LimitedTestSetup<30> test(kTestFabricIndex);
+        CHIP_ERROR err = test.encoder.EncodeResumableList(resumableListEncoder);
+        EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        resumableState = test.encoder.GetState();
+
+        ASSERT_EQ(test.writer.GetLengthWritten(), expected.writer.GetLengthWritten());
+        EXPECT_EQ(memcmp(test.buf, expected.buf, test.writer.GetLengthWritten()), 0);
+        EXPECT_EQ(resumableState.CurrentEncodingListIndex(), state.CurrentEncodingListIndex());
+        EXPECT_EQ(resumableState.ListResumePosition(), 2u);
+    }
+    chunk++;
+    {
+        LimitedTestSetup<30> expected(0, state);
+        EXPECT_NE(expected.encoder.EncodeList(listEncoder), CHIP_NO_ERROR);
+        state = expected.encoder.GetState();
+
+        LimitedTestSetup<30> test(0, resumableState);
+        CHIP_ERROR err = test.encoder.EncodeResumableList(resumableListEncoder);
+        EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        resumableState = test.encoder.GetState();
+
+        ASSERT_EQ(test.writer.GetLengthWritten(), expected.writer.GetLengthWritten());
+        EXPECT_EQ(memcmp(test.buf, expected.buf, test.writer.GetLengthWritten()), 0);
+        EXPECT_EQ(resumableState.ListResumePosition(), 3u);
+    }
+    chunk++;
+    {
+        TestSetup expected(0, state);
+        EXPECT_EQ(expected.encoder.EncodeList(listEncoder), CHIP_NO_ERROR);
+
+        TestSetup test(0, resumableState);
+        EXPECT_EQ(test.encoder.EncodeResumableList(resumableListEncoder), CHIP_NO_ERROR);
+
+        ASSERT_EQ(test.writer.GetLengthWritten(), expected.writer.GetLengthWritten());
+        EXPECT_EQ(memcmp(test.buf, expected.buf, test.writer.GetLengthWritten()), 0);
+        EXPECT_EQ(test.encoder.GetState().CurrentEncodingListIndex(), kInvalidListIndex);
+        EXPECT_EQ(test.encoder.GetState().ListResumePosition(), 0u);
+    }
+
+    // Each chunk starts where the previous one stopped, so items are only visited again when they did not fit.
+    EXPECT_EQ(startPositions[0], 0u);
+    EXPECT_EQ(startPositions[1], 2u);
+    EXPECT_EQ(startPositions[2], 3u);
+    EXPECT_EQ(visitedItems, 3u + 2u + 3u);
+}
+
+TEST(TestAttributeValueEncoder, TestEncodeResumableFabricFilteredList)
+{
+    Clusters::AccessControl::Structs::AccessControlExtensionStruct::Type items[3];
+    items[0].fabricIndex = 2;
+    items[1].fabricIndex = kTestFabricIndex;
+    items[2].fabricIndex = 3;
+
+    TestSetup test(kTestFabricIndex);
+    uint32_t lastPosition = 0;
+    CHIP_ERROR err        = test.encoder.EncodeResumableList([&](uint32_t startPosition, const auto & encoder) -> CHIP_ERROR {
+        for (uint32_t i = startPosition; i < MATTER_ARRAY_SIZE(items); i++)
+        {
+            ReturnErrorOnFailure(encoder.Encode(items[i], i + 1));
+            lastPosition = test.encoder.GetState().ListResumePosition();
+        }
+        return CHIP_NO_ERROR;
+    });
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    // Items filtered out for other fabrics still move the resume position forward.
+    EXPECT_EQ(lastPosition, 3u);
+
+    const uint8_t expected[] = {
+        // clang-format off
+        0x15, 0x36, 0x01, // Test overhead, Start Anonymous struct + Start 1 byte Tag Array + Tag (01)
+        0x15, // Start anonymous struct
+          0x35, 0x01, // Start 1 byte tag struct + Tag (01)
+            0x24, 0x00, 0x99, // Tag (00) Value (1 byte uint) 0x99 (Attribute Version)
+            0x37, 0x01, // Start 1 byte tag list + Tag (01) (Attribute Path)
+              0x24, 0x02, 0x55, // Tag (02) Value (1 byte uint) 0x55
+              0x24, 0x03, 0xaa, // Tag (03) Value (1 byte uint) 0xaa
+              0x24, 0x04, 0xcc, // Tag (04) Value (1 byte uint) 0xcc
+            0x18, // End of container
+            0x36, 0x02, // Start 1 byte tag array + Tag (02) (Attribute Value)
+              0x15, // Start anonymous structure
+                0x30, 0x01, 0x00, // Tag 1, OCTET_STRING length 0 (data)
+                0x24, 0xFE, 0x01, // Tag 0xFE, UINT8 Value 1 (fabric index)
+              0x18, // End of array element (structure)
+            0x18, // End of array
+          0x18, // End of attribute data structure
+        0x18, // End of attribute structure
+        // clang-format on
+    };
+    VERIFY_BUFFER_STATE(test, expected);
+}
+
 TEST(TestAttributeValueEncoder, TestEncodePreEncoded)
 {
     TestSetup test{};
@@ -28,10 +28,12 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app-common/zap-generated/cluster-objects.h>
 #include <app/ClusterStateCache.h>
+#include <app/ClusterStateCacheArena.h>
 #include <app/MessageDef/DataVersionFilterIBs.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
 #include <app/tests/AppTestContext.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 
@@ -656,6 +658,8 @@ void RunAndValidateSequence(AttributeInstructionListType list)
             EXPECT_EQ(cache.GetBufferedCallback().OnUpdateDataVersionFilterList(builder, pathSpan, encodedDataVersionList),
                       CHIP_NO_ERROR);
             EXPECT_EQ(builder.GetError(), CHIP_NO_ERROR);
+            // Only the filters that made it into the list count as saved data.
+            EXPECT_EQ(encodedDataVersionList, cache.GetDataVersionFilterSavedBytes() > 0);
 
             if (writer.GetRemainingFreeLength() > 40)
             {
@@ -830,4 +834,252 @@ TEST_F(TestClusterStateCache, TestCache)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+
+
+class ChangeCounter : public ClusterStateCache::Callback
+{
+public:
+    size_t mChangedAttributes = 0;
+    size_t mChangedClusters   = 0;
+
+private:
+    void OnDone(ReadClient *) override {}
+    void OnAttributeChanged(ClusterStateCache *, const ConcreteAttributePath &) override { mChangedAttributes++; }
+    void OnClusterChanged(ClusterStateCache *, EndpointId, ClusterId) override { mChangedClusters++; }
+};
+
+void SendInt16uReport(ReadClient::Callback & callback, uint16_t value)
+{
+    ConcreteDataAttributePath path(1, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id);
+    path.mDataVersion.SetValue(1);
+
+    uint8_t buffer[16];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    ASSERT_EQ(DataModel::Encode(writer, TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    TLV::TLVReader reader;
+    reader.Init(buffer, writer.GetLengthWritten());
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+    callback.OnReportBegin();
+    callback.OnAttributeData(path, &reader, StatusIB());
+    callback.OnReportEnd();
+}
+
+TEST_F(TestClusterStateCache, TestSuppressUnchangedAttributeNotifications)
+{
+    const ConcreteAttributePath path(1, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id);
+    uint16_t value = 0;
+
+    // By default every report is a change.
+    {
+        ChangeCounter counter;
+        ClusterStateCache cache(counter);
+        SendInt16uReport(cache.GetBufferedCallback(), 5);
+        SendInt16uReport(cache.GetBufferedCallback(), 5);
+        EXPECT_EQ(counter.mChangedAttributes, 2u);
+        EXPECT_EQ(counter.mChangedClusters, 2u);
+    }
+
+    ChangeCounter counter;
+    ClusterStateCache cache(counter);
+    cache.SetSuppressUnchangedAttributeNotifications(true);
+
+    SendInt16uReport(cache.GetBufferedCallback(), 5);
+    EXPECT_EQ(counter.mChangedAttributes, 1u);
+
+    SendInt16uReport(cache.GetBufferedCallback(), 5);
+    EXPECT_EQ(counter.mChangedAttributes, 1u);
+    EXPECT_EQ(counter.mChangedClusters, 1u);
+    EXPECT_EQ(cache.Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, value), CHIP_NO_ERROR);
+    EXPECT_EQ(value, 5u);
+
+    SendInt16uReport(cache.GetBufferedCallback(), 6);
+    EXPECT_EQ(counter.mChangedAttributes, 2u);
+    EXPECT_EQ(counter.mChangedClusters, 2u);
+    EXPECT_EQ(cache.Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, value), CHIP_NO_ERROR);
+    EXPECT_EQ(value, 6u);
+}
+
+
+TEST_F(TestClusterStateCache, TestSnapshotRoundTrip)
+{
+    const ConcreteAttributePath dataPath(1, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id);
+    const ConcreteDataAttributePath statusPath(2, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int8u::Id);
+
+    uint8_t snapshot[256];
+    uint32_t snapshotLength = 0;
+    {
+        ChangeCounter counter;
+        ClusterStateCache cache(counter);
+
+        // Claim a wildcard path so that the cache commits data versions.
+        AttributePathParams wildcardPath;
+        uint8_t buf[20];
+        TLV::TLVWriter filterWriter;
+        filterWriter.Init(buf);
+        DataVersionFilterIBs::Builder builder;
+        ASSERT_EQ(builder.Init(&filterWriter), CHIP_NO_ERROR);
+        bool encodedDataVersionList = false;
+        ASSERT_EQ(cache.GetBufferedCallback().OnUpdateDataVersionFilterList(builder, Span<AttributePathParams>(&wildcardPath, 1),
+                                                                            encodedDataVersionList),
+                  CHIP_NO_ERROR);
+
+        SendInt16uReport(cache.GetBufferedCallback(), 42);
+        cache.GetBufferedCallback().OnReportBegin();
+        cache.GetBufferedCallback().OnAttributeData(statusPath, nullptr,
+                                                    StatusIB(Protocols::InteractionModel::Status::UnsupportedAttribute));
+        cache.GetBufferedCallback().OnReportEnd();
+        cache.SetHighestReceivedEventNumber(7);
+
+        TLV::TLVWriter writer;
+        writer.Init(snapshot);
+        ASSERT_EQ(cache.SaveSnapshot(writer), CHIP_NO_ERROR);
+        ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+        snapshotLength = writer.GetLengthWritten();
+    }
+
+    ChangeCounter counter;
+    ClusterStateCache cache(counter);
+    TLV::TLVReader reader;
+    reader.Init(snapshot, snapshotLength);
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    ASSERT_EQ(cache.RestoreSnapshot(reader), CHIP_NO_ERROR);
+    EXPECT_EQ(counter.mChangedAttributes, 0u);
+
+    uint16_t value = 0;
+    EXPECT_EQ(cache.Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(dataPath, value), CHIP_NO_ERROR);
+    EXPECT_EQ(value, 42u);
+
+    Optional<DataVersion> version;
+    EXPECT_EQ(cache.GetVersion(dataPath, version), CHIP_NO_ERROR);
+    ASSERT_TRUE(version.HasValue());
+    EXPECT_EQ(version.Value(), 1u);
+
+    StatusIB status;
+    EXPECT_EQ(cache.GetStatus(statusPath, status), CHIP_NO_ERROR);
+    EXPECT_EQ(status.mStatus, Protocols::InteractionModel::Status::UnsupportedAttribute);
+
+    Optional<EventNumber> highestEventNumber;
+    EXPECT_EQ(cache.GetHighestReceivedEventNumber(highestEventNumber), CHIP_NO_ERROR);
+    ASSERT_TRUE(highestEventNumber.HasValue());
+    EXPECT_EQ(highestEventNumber.Value(), 7u);
+
+    // Saving the restored cache gives back the same snapshot.
+    uint8_t resaved[sizeof(snapshot)];
+    TLV::TLVWriter writer;
+    writer.Init(resaved);
+    ASSERT_EQ(cache.SaveSnapshot(writer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.GetLengthWritten(), snapshotLength);
+    EXPECT_EQ(memcmp(resaved, snapshot, snapshotLength), 0);
+
+    // Snapshots in an unknown format are rejected and leave the cache alone.
+    TLV::TLVType container;
+    writer.Init(resaved);
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, container), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::ContextTag(0), static_cast<uint8_t>(2)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(container), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    reader.Init(resaved, writer.GetLengthWritten());
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.RestoreSnapshot(reader), CHIP_ERROR_VERSION_MISMATCH);
+    EXPECT_EQ(cache.Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(dataPath, value), CHIP_NO_ERROR);
+}
+
+TEST(TestClusterStateCacheFlatMap, KeepsEntriesSorted)
+{
+    app::detail::SortedVectorMap<EndpointId, uint32_t> map;
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(1), map.end());
+    EXPECT_EQ(map.erase(1), 0u);
+
+    map[3] = 30;
+    map[1] = 10;
+    map[2] = 20;
+    map[1] += 1;
+    EXPECT_EQ(map.size(), 3u);
+
+    EndpointId expectedKey = 1;
+    for (const auto & [key, value] : map)
+    {
+        EXPECT_EQ(key, expectedKey);
+        EXPECT_EQ(value, (key == 1) ? 11u : key * 10u);
+        expectedKey++;
+    }
+
+    ASSERT_NE(map.find(2), map.end());
+    EXPECT_EQ(map.find(2)->second, 20u);
+    EXPECT_EQ(map.find(4), map.end());
+
+    EXPECT_EQ(map.erase(2), 1u);
+    EXPECT_EQ(map.find(2), map.end());
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.begin()->first, 1u);
+}
+
+
+TEST(TestClusterStateCacheArena, AllocateAndCompact)
+{
+    ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+    {
+        constexpr uint32_t kValueSize = 16;
+        constexpr size_t kValueCount  = 4 * CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA_BLOCK_SIZE / kValueSize;
+        app::detail::TLVArena arena;
+        std::vector<app::detail::TLVArena::Buffer> buffers(kValueCount);
+
+        for (size_t i = 0; i < kValueCount; i++)
+        {
+            ASSERT_EQ(arena.Allocate(kValueSize, buffers[i]), CHIP_NO_ERROR);
+            memset(buffers[i].Get(), static_cast<int>(i), kValueSize);
+        }
+        EXPECT_EQ(arena.LiveBytes(), kValueCount * kValueSize);
+        EXPECT_EQ(arena.BlockCount(), 4u);
+        EXPECT_FALSE(arena.ShouldCompact());
+
+        // Values that do not fit in half a block get their own block.
+        app::detail::TLVArena::Buffer big;
+        ASSERT_EQ(arena.Allocate(CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA_BLOCK_SIZE, big), CHIP_NO_ERROR);
+        EXPECT_EQ(arena.BlockCount(), 5u);
+
+        // Updating a value leaves its old space behind.
+        for (size_t i = 0; i < kValueCount; i++)
+        {
+            ASSERT_EQ(arena.Allocate(kValueSize, buffers[i]), CHIP_NO_ERROR);
+            memset(buffers[i].Get(), static_cast<int>(i), kValueSize);
+        }
+        big = app::detail::TLVArena::Buffer();
+        EXPECT_EQ(arena.LiveBytes(), kValueCount * kValueSize);
+        EXPECT_TRUE(arena.ShouldCompact());
+
+        ASSERT_EQ(arena.BeginCompaction(), CHIP_NO_ERROR);
+        for (auto & buffer : buffers)
+        {
+            arena.Relocate(buffer);
+        }
+        arena.EndCompaction();
+
+        EXPECT_FALSE(arena.ShouldCompact());
+        EXPECT_EQ(arena.BlockCount(), 1u);
+        EXPECT_EQ(arena.AllocatedBytes(), kValueCount * kValueSize);
+        for (size_t i = 0; i < kValueCount; i++)
+        {
+            ASSERT_EQ(buffers[i].AllocatedSize(), kValueSize);
+            for (uint32_t j = 0; j < kValueSize; j++)
+            {
+                EXPECT_EQ(buffers[i].Get()[j], static_cast<uint8_t>(i));
+            }
+        }
+
+        // Releasing everything gives all blocks back.
+        buffers.clear();
+        EXPECT_EQ(arena.LiveBytes(), 0u);
+        EXPECT_EQ(arena.BlockCount(), 0u);
+    }
+    Platform::MemoryShutdown();
+}
+
 } // namespace
@@ -402,11 +402,13 @@ public:
     Optional<GroupId> GetGroupId() const override { return NullOptional; }
 
     void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) override { mChunks.AddToEnd(std::move(aPacket)); }
+    void InvokeResponseChunkReady() override { mChunksReady++; }
     void ResponseDropped() override { mResponseDropped = true; }
 
     size_t GetCommandResponseMaxBufferSize() override { return kMaxSecureSduLengthBytes; }
 
     System::PacketBufferHandle mChunks;
+    int mChunksReady      = 0;
     bool mResponseDropped = false;
 };
 
@@ -529,6 +531,7 @@ public:
     void TestCommandHandler_FillUpInvokeResponseMessageWhereSecondResponseIsStatusResponse();
     void TestCommandHandler_FillUpInvokeResponseMessageWhereSecondResponseIsDataResponsePrimative();
     void TestCommandHandler_FillUpInvokeResponseMessageWhereSecondResponseIsDataResponse();
+    void TestCommandHandler_InvokeResponseStats();
     void TestCommandHandler_ReleaseWithExchangeClosed();
 
     /**
@@ -2118,6 +2121,44 @@ TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandHandler_FillUpInvokeRespo
     EXPECT_GT(remainingSize, sizeToLeave);
 }
 
+TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandHandler_InvokeResponseStats)
+{
+    BasicCommandPathRegistry<4> basicCommandPathRegistry;
+    MockCommandResponder mockCommandResponder;
+    CommandHandlerImpl::TestOnlyOverrides testOnlyOverrides{ &basicCommandPathRegistry, &mockCommandResponder };
+    CommandHandlerImpl commandHandler(testOnlyOverrides, &mockCommandHandlerDelegate);
+    commandHandler.mReserveSpaceForMoreChunkMessages = true;
+    ConcreteCommandPath requestCommandPath1          = { kTestEndpointId, kTestClusterId, kTestCommandIdFillResponseMessage };
+    ConcreteCommandPath requestCommandPath2          = { kTestEndpointId, kTestClusterId, kTestCommandIdCommandSpecificResponse };
+    ConcreteCommandPath requestCommandPath3          = { kTestEndpointId, kTestClusterId, kTestCommandIdWithData };
+
+    EXPECT_EQ(basicCommandPathRegistry.Add(requestCommandPath1, std::make_optional<uint16_t>(static_cast<uint16_t>(1))),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(basicCommandPathRegistry.Add(requestCommandPath2, std::make_optional<uint16_t>(static_cast<uint16_t>(2))),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(basicCommandPathRegistry.Add(requestCommandPath3, std::make_optional<uint16_t>(static_cast<uint16_t>(3))),
+              CHIP_NO_ERROR);
+
+    CommandHandlerImpl::ResetInvokeResponseStats();
+
+    // The first response fills the first message, so the next two share a second one.
+    uint32_t sizeToLeave = 0;
+    FillCurrentInvokeResponseBuffer(&commandHandler, requestCommandPath1, sizeToLeave);
+    ForcedSizeBuffer responseData(50);
+    EXPECT_EQ(commandHandler.AddResponseData(requestCommandPath2, responseData.GetCommandId(), responseData), CHIP_NO_ERROR);
+    commandHandler.AddStatus(requestCommandPath3, Protocols::InteractionModel::Status::Success);
+    EXPECT_EQ(mockCommandResponder.mChunksReady, 1);
+
+    EXPECT_EQ(commandHandler.FinalizeLastInvokeResponseMessage(), CHIP_NO_ERROR);
+    EXPECT_EQ(mockCommandResponder.mChunksReady, 1);
+
+    const CommandHandlerImpl::InvokeResponseStats & stats = CommandHandlerImpl::GetInvokeResponseStats();
+    EXPECT_EQ(stats.responseMessages, 2u);
+    EXPECT_EQ(stats.responses, 3u);
+    EXPECT_EQ(stats.chunkedInvokes, 1u);
+    EXPECT_EQ(stats.maxResponsesPerMessage, 2u);
+}
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
 //
 // This test needs a special unit-test only API being exposed in ExchangeContext to be able to correctly simulate
@@ -288,4 +288,106 @@ TEST_F(TestEventLogging, TestCheckLogEventWithDiscardLowEvent)
     CheckLogState(logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
 
+TEST_F(TestEventLogging, TestFetchEventsSinceIndexedEvent)
+{
+    constexpr chip::EventNumber kEventCount = 5 * CHIP_CONFIG_EVENT_NUMBER_INDEX_INTERVAL + 1;
+
+    chip::EventNumber eid = 0;
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Critical;
+    TestEventGenerator testEventGenerator;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    for (chip::EventNumber i = 0; i < kEventCount; i++)
+    {
+        testEventGenerator.SetStatus(static_cast<int32_t>(i % 2));
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+    }
+    // Critical events move to the next buffer instead of being dropped, so each buffer holds 3 of them.
+    CheckLogState(logMgmt, 9, chip::app::PriorityLevel::Critical);
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> paths[1];
+    paths[0].mValue.mEndpointId = kTestEndpointId1;
+    paths[0].mValue.mClusterId  = kLivenessClusterId;
+
+    // Whether or not the fetch can start at an indexed event, it must return exactly the events since the requested one.
+    for (chip::EventNumber startingEventNumber = eid - 8; startingEventNumber <= eid; startingEventNumber++)
+    {
+        CheckLogReadOut(logMgmt, startingEventNumber, static_cast<size_t>(eid - startingEventNumber + 1), paths);
+    }
+}
+
+TEST_F(TestEventLogging, TestFetchEventsSinceSkipsOtherPaths)
+{
+    chip::EventNumber eid;
+    chip::app::EventOptions options1;
+    chip::app::EventOptions options2;
+    TestEventGenerator testEventGenerator;
+
+    options1.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options1.mPriority = chip::app::PriorityLevel::Info;
+    options2.mPath     = { kTestEndpointId2, kLivenessClusterId, kLivenessChangeEvent };
+    options2.mPriority = chip::app::PriorityLevel::Info;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    for (int32_t i = 0; i < 3; i++)
+    {
+        testEventGenerator.SetStatus(i % 2);
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options1, eid), CHIP_NO_ERROR);
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options2, eid), CHIP_NO_ERROR);
+    }
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> paths[1];
+    paths[0].mValue.mEndpointId = kTestEndpointId2;
+    paths[0].mValue.mClusterId  = kLivenessClusterId;
+
+    const uint64_t scanned   = logMgmt.GetScannedEventCount();
+    const uint64_t delivered = logMgmt.GetDeliveredEventCount();
+
+    // Every event is looked at, but only the ones on the interested endpoint make it to the report.
+    CheckLogReadOut(logMgmt, 0, 3, paths);
+    EXPECT_EQ(logMgmt.GetScannedEventCount() - scanned, 6u);
+    EXPECT_EQ(logMgmt.GetDeliveredEventCount() - delivered, 3u);
+}
+
+TEST_F(TestEventLogging, TestLogEventBatch)
+{
+    chip::EventNumber eid;
+    chip::app::EventOptions options1;
+    chip::app::EventOptions options2;
+    TestEventGenerator testEventGenerators[3];
+
+    options1.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options1.mPriority = chip::app::PriorityLevel::Info;
+    options2.mPath     = { kTestEndpointId2, kLivenessClusterId, kLivenessChangeEvent };
+    options2.mPriority = chip::app::PriorityLevel::Info;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    testEventGenerators[0].SetStatus(0);
+    EXPECT_EQ(logMgmt.LogEvent(&testEventGenerators[0], options1, eid), CHIP_NO_ERROR);
+
+    chip::app::BatchedEvent events[3];
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(events); i++)
+    {
+        testEventGenerators[i].SetStatus(static_cast<int32_t>(i % 2));
+        events[i].mpDelegate = &testEventGenerators[i];
+        events[i].mOptions   = (i == 1) ? options2 : options1;
+    }
+    EXPECT_EQ(logMgmt.LogEvents(chip::Span<chip::app::BatchedEvent>(events)), CHIP_NO_ERROR);
+    CheckLogState(logMgmt, 4, chip::app::PriorityLevel::Info);
+
+    EXPECT_EQ(events[0].mEventNumber, eid + 1);
+    EXPECT_EQ(events[1].mEventNumber, eid + 2);
+    EXPECT_EQ(events[2].mEventNumber, eid + 3);
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> paths[1];
+    paths[0].mValue.mEndpointId = kTestEndpointId1;
+    paths[0].mValue.mClusterId  = kLivenessClusterId;
+
+    // The batched events read out like events logged one by one.
+    CheckLogReadOut(logMgmt, 0, 3, paths);
+    CheckLogReadOut(logMgmt, events[2].mEventNumber, 1, paths);
+}
+
 } // namespace
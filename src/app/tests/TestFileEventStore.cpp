@@ -0,0 +1,403 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <access/SubjectDescriptor.h>
+#include <app/EventLoggingDelegate.h>
+#include <app/EventManagement.h>
+#include <app/FileEventStore.h>
+#include <app/InteractionModelEngine.h>
+#include <app/MessageDef/EventReportIB.h>
+#include <app/tests/AppTestContext.h>
+#include <data-model-providers/codegen/Instance.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPCounter.h>
+#include <lib/support/ScopedBuffer.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <cstdlib>
+#include <dirent.h>
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr ClusterId kTestClusterId   = 0x00000022;
+constexpr EventId kTestEventId       = 1;
+constexpr EndpointId kTestEndpointId = 2;
+constexpr FabricIndex kTestFabric    = 1;
+
+class TemporaryDirectory
+{
+public:
+    TemporaryDirectory()
+    {
+        char dirTemplate[] = "/tmp/chip-events-XXXXXX";
+        VerifyOrDie(mkdtemp(dirTemplate) != nullptr);
+        mPath = dirTemplate;
+    }
+
+    ~TemporaryDirectory()
+    {
+        for (const auto & name : Files())
+        {
+            unlink((mPath + "/" + name).c_str());
+        }
+        rmdir(mPath.c_str());
+    }
+
+    const char * Path() const { return mPath.c_str(); }
+
+    std::vector<std::string> Files() const
+    {
+        std::vector<std::string> names;
+        DIR * dir = opendir(mPath.c_str());
+        VerifyOrDie(dir != nullptr);
+        while (struct dirent * entry = readdir(dir))
+        {
+            if (entry->d_name[0] != '.')
+            {
+                names.push_back(entry->d_name);
+            }
+        }
+        closedir(dir);
+        return names;
+    }
+
+private:
+    std::string mPath;
+};
+
+// An anonymous structure holding aValue, padded with aPadding bytes, standing for a stored event.
+std::vector<uint8_t> MakeEvent(uint32_t aValue, size_t aPadding = 0)
+{
+    std::vector<uint8_t> padding(aPadding, 0xa5);
+    uint8_t buffer[128];
+    TLV::TLVWriter writer;
+    TLV::TLVType container;
+    writer.Init(buffer);
+    VerifyOrDie(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, container) == CHIP_NO_ERROR);
+    VerifyOrDie(writer.Put(TLV::ContextTag(1), aValue) == CHIP_NO_ERROR);
+    VerifyOrDie(writer.PutBytes(TLV::ContextTag(2), padding.data(), static_cast<uint32_t>(padding.size())) == CHIP_NO_ERROR);
+    VerifyOrDie(writer.EndContainer(container) == CHIP_NO_ERROR);
+    VerifyOrDie(writer.Finalize() == CHIP_NO_ERROR);
+    return std::vector<uint8_t>(buffer, buffer + writer.GetLengthWritten());
+}
+
+ByteSpan AsSpan(const std::vector<uint8_t> & aEvent)
+{
+    return AsSpan(aEvent);
+}
+
+std::vector<std::vector<uint8_t>> ReadAll(FileEventStore & store, PriorityLevel priority)
+{
+    std::vector<std::vector<uint8_t>> events;
+    PersistentEventStore::Cursor cursor;
+    PersistentEventStore::Cursor at;
+    ByteSpan event;
+    CHIP_ERROR err;
+    while ((err = store.ReadNext(priority, cursor, at, event)) == CHIP_NO_ERROR)
+    {
+        events.emplace_back(event.begin(), event.end());
+    }
+    EXPECT_EQ(err, CHIP_ERROR_NOT_FOUND);
+    return events;
+}
+
+TEST(TestFileEventStore, EventsAreReadBackInOrderAfterReopening)
+{
+    TemporaryDirectory dir;
+    std::vector<std::vector<uint8_t>> expected;
+    {
+        FileEventStore store;
+        ASSERT_EQ(store.Init(dir.Path(), PriorityLevel::Info), CHIP_NO_ERROR);
+        EXPECT_FALSE(store.Accepts(PriorityLevel::Debug));
+        EXPECT_TRUE(store.Accepts(PriorityLevel::Info));
+        EXPECT_TRUE(store.Accepts(PriorityLevel::Critical));
+        auto debug = MakeEvent(0);
+        EXPECT_EQ(store.Append(PriorityLevel::Debug, AsSpan(debug)), CHIP_ERROR_INVALID_ARGUMENT);
+
+        for (uint32_t i = 0; i < 5; i++)
+        {
+            expected.push_back(MakeEvent(i));
+            ASSERT_EQ(store.Append(PriorityLevel::Critical, AsSpan(expected.back())), CHIP_NO_ERROR);
+        }
+        auto info = MakeEvent(100);
+        ASSERT_EQ(store.Append(PriorityLevel::Info, AsSpan(info)), CHIP_NO_ERROR);
+
+        EXPECT_EQ(ReadAll(store, PriorityLevel::Critical), expected);
+    }
+
+    FileEventStore store;
+    ASSERT_EQ(store.Init(dir.Path(), PriorityLevel::Info), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadAll(store, PriorityLevel::Critical), expected);
+    EXPECT_EQ(ReadAll(store, PriorityLevel::Info), std::vector<std::vector<uint8_t>>{ MakeEvent(100) });
+}
+
+TEST(TestFileEventStore, OldestSegmentsAreDropped)
+{
+    TemporaryDirectory dir;
+    FileEventStore store;
+    // Two 40-byte records per segment, at most three segments.
+    auto sample = MakeEvent(0, 30);
+    ASSERT_EQ(sample.size() + 2, 40u);
+    ASSERT_EQ(store.Init(dir.Path(), PriorityLevel::Critical, 80, 3), CHIP_NO_ERROR);
+
+    std::vector<std::vector<uint8_t>> appended;
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        appended.push_back(MakeEvent(i, 30));
+        ASSERT_EQ(store.Append(PriorityLevel::Critical, AsSpan(appended.back())), CHIP_NO_ERROR);
+
+        // The events read back are always the most recent ones.
+        auto events = ReadAll(store, PriorityLevel::Critical);
+        ASSERT_LE(events.size(), 6u);
+        EXPECT_TRUE(std::equal(events.begin(), events.end(), appended.end() - static_cast<ptrdiff_t>(events.size())));
+    }
+
+    EXPECT_EQ(dir.Files().size(), 3u);
+    EXPECT_EQ(ReadAll(store, PriorityLevel::Critical).size(), 6u);
+}
+
+TEST(TestFileEventStore, PartlyWrittenEventIsDiscarded)
+{
+    TemporaryDirectory dir;
+    std::vector<std::vector<uint8_t>> expected = { MakeEvent(1), MakeEvent(2) };
+    {
+        FileEventStore store;
+        ASSERT_EQ(store.Init(dir.Path()), CHIP_NO_ERROR);
+        for (const auto & event : expected)
+        {
+            ASSERT_EQ(store.Append(PriorityLevel::Critical, AsSpan(event)), CHIP_NO_ERROR);
+        }
+    }
+
+    // Append the start of a third event, as if the system went down while it was being written.
+    auto files = dir.Files();
+    ASSERT_EQ(files.size(), 1u);
+    int fd = open((std::string(dir.Path()) + "/" + files[0]).c_str(), O_WRONLY | O_APPEND);
+    ASSERT_GE(fd, 0);
+    auto third       = MakeEvent(3);
+    uint8_t header[] = { static_cast<uint8_t>(third.size()), 0 };
+    EXPECT_EQ(write(fd, header, sizeof(header)), static_cast<ssize_t>(sizeof(header)));
+    EXPECT_EQ(write(fd, third.data(), third.size() - 1), static_cast<ssize_t>(third.size() - 1));
+    close(fd);
+
+    FileEventStore store;
+    ASSERT_EQ(store.Init(dir.Path()), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadAll(store, PriorityLevel::Critical), expected);
+
+    // New events go right after the last whole one.
+    expected.push_back(MakeEvent(4));
+    ASSERT_EQ(store.Append(PriorityLevel::Critical, AsSpan(expected.back())), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadAll(store, PriorityLevel::Critical), expected);
+}
+
+TEST(TestFileEventStore, OverwriteReplacesOneEvent)
+{
+    TemporaryDirectory dir;
+    FileEventStore store;
+    ASSERT_EQ(store.Init(dir.Path()), CHIP_NO_ERROR);
+    std::vector<std::vector<uint8_t>> expected = { MakeEvent(1), MakeEvent(2), MakeEvent(3) };
+    for (const auto & event : expected)
+    {
+        ASSERT_EQ(store.Append(PriorityLevel::Critical, AsSpan(event)), CHIP_NO_ERROR);
+    }
+
+    PersistentEventStore::Cursor cursor;
+    PersistentEventStore::Cursor at;
+    ByteSpan event;
+    ASSERT_EQ(store.ReadNext(PriorityLevel::Critical, cursor, at, event), CHIP_NO_ERROR);
+    ASSERT_EQ(store.ReadNext(PriorityLevel::Critical, cursor, at, event), CHIP_NO_ERROR);
+
+    auto replacement = MakeEvent(200);
+    ASSERT_EQ(replacement.size(), expected[1].size());
+    EXPECT_EQ(store.Overwrite(PriorityLevel::Critical, at, ByteSpan(replacement.data(), replacement.size() - 1)),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    ASSERT_EQ(store.Overwrite(PriorityLevel::Critical, at, AsSpan(replacement)), CHIP_NO_ERROR);
+    expected[1] = replacement;
+    EXPECT_EQ(ReadAll(store, PriorityLevel::Critical), expected);
+}
+
+uint8_t gDebugEventBuffer[128];
+uint8_t gInfoEventBuffer[128];
+uint8_t gCritEventBuffer[256];
+CircularEventBuffer gCircularEventBuffer[3];
+
+class TestEventGenerator : public EventLoggingDelegate
+{
+public:
+    CHIP_ERROR WriteEvent(TLV::TLVWriter & aWriter) override
+    {
+        TLV::TLVType dataContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::ContextTag(to_underlying(EventDataIB::Tag::kData)),
+                                                    TLV::kTLVType_Structure, dataContainerType));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(1), mStatus));
+        return aWriter.EndContainer(dataContainerType);
+    }
+
+    int32_t mStatus = 0;
+};
+
+class TestPersistentEventLogging : public Testing::AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(CodegenDataModelProviderInstance(nullptr));
+        ASSERT_EQ(mStore.Init(mDir.Path()), CHIP_NO_ERROR);
+    }
+
+    void TearDown() override
+    {
+        EventManagement::DestroyEventManagement();
+        mStore.Shutdown();
+        AppContext::TearDown();
+    }
+
+    // Start the event log afresh, as after a restart, with a counter that carries on from aEventNumber.
+    void Restart(EventNumber aEventNumber)
+    {
+        const LogStorageResources logStorageResources[] = {
+            { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), PriorityLevel::Debug },
+            { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), PriorityLevel::Info },
+            { &gCritEventBuffer[0], sizeof(gCritEventBuffer), PriorityLevel::Critical },
+        };
+
+        EventManagement::DestroyEventManagement();
+        memset(gDebugEventBuffer, 0, sizeof(gDebugEventBuffer));
+        memset(gInfoEventBuffer, 0, sizeof(gInfoEventBuffer));
+        memset(gCritEventBuffer, 0, sizeof(gCritEventBuffer));
+        ASSERT_EQ(mEventCounter.Init(aEventNumber), CHIP_NO_ERROR);
+        ASSERT_EQ(EventManagement::GetInstance().Init(&GetExchangeManager(), MATTER_ARRAY_SIZE(logStorageResources),
+                                                      gCircularEventBuffer, logStorageResources, &mEventCounter,
+                                                      System::Clock::kZero,
+                                                      &InteractionModelEngine::GetInstance()->GetReportingEngine(), &mStore),
+                  CHIP_NO_ERROR);
+    }
+
+    EventNumber LogEvent(PriorityLevel aPriority, FabricIndex aFabricIndex = kUndefinedFabricIndex)
+    {
+        EventOptions options;
+        options.mPath        = { kTestEndpointId, kTestClusterId, kTestEventId };
+        options.mPriority    = aPriority;
+        options.mFabricIndex = aFabricIndex;
+        EventNumber eventNumber;
+        EXPECT_EQ(EventManagement::GetInstance().LogEvent(&mGenerator, options, eventNumber), CHIP_NO_ERROR);
+        return eventNumber;
+    }
+
+    // The numbers of the events FetchEventsSince returns for the given subject.
+    std::vector<EventNumber> FetchEvents(const Access::SubjectDescriptor & aSubject = Access::SubjectDescriptor{})
+    {
+        SingleLinkedListNode<EventPathParams> path;
+        path.mValue.mEndpointId = kTestEndpointId;
+        path.mValue.mClusterId  = kTestClusterId;
+
+        Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+        VerifyOrDie(backingStore.Alloc(1024));
+        TLV::TLVWriter writer;
+        writer.Init(backingStore.Get(), 1024);
+        EventNumber startingEventNumber = 0;
+        size_t eventCount               = 0;
+        CHIP_ERROR err = EventManagement::GetInstance().FetchEventsSince(writer, &path, startingEventNumber, eventCount, aSubject);
+        EXPECT_TRUE(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+
+        std::vector<EventNumber> numbers;
+        TLV::TLVReader reader;
+        reader.Init(backingStore.Get(), writer.GetLengthWritten());
+        while (reader.Next() == CHIP_NO_ERROR)
+        {
+            EventReportIB::Parser report;
+            EventDataIB::Parser data;
+            EventNumber number;
+            EXPECT_EQ(report.Init(reader), CHIP_NO_ERROR);
+            EXPECT_EQ(report.GetEventData(&data), CHIP_NO_ERROR);
+            EXPECT_EQ(data.GetEventNumber(&number), CHIP_NO_ERROR);
+            numbers.push_back(number);
+        }
+        EXPECT_EQ(numbers.size(), eventCount);
+        return numbers;
+    }
+
+    TemporaryDirectory mDir;
+    FileEventStore mStore;
+    TestEventGenerator mGenerator;
+    MonotonicallyIncreasingCounter<EventNumber> mEventCounter;
+};
+
+TEST_F(TestPersistentEventLogging, CriticalEventsSurviveRestart)
+{
+    Restart(0);
+    EventNumber first  = LogEvent(PriorityLevel::Critical);
+    EventNumber info   = LogEvent(PriorityLevel::Info);
+    EventNumber second = LogEvent(PriorityLevel::Critical);
+    EXPECT_EQ(FetchEvents(), (std::vector<EventNumber>{ first, info, second }));
+
+    // Only the critical events are kept by the store.
+    Restart(EventManagement::GetInstance().GetLastEventNumber());
+    EXPECT_EQ(FetchEvents(), (std::vector<EventNumber>{ first, second }));
+
+    // Events logged after the restart follow the ones loaded, and loaded events are not stored again.
+    EventNumber third = LogEvent(PriorityLevel::Critical);
+    EXPECT_EQ(FetchEvents(), (std::vector<EventNumber>{ first, second, third }));
+    Restart(EventManagement::GetInstance().GetLastEventNumber());
+    EXPECT_EQ(FetchEvents(), (std::vector<EventNumber>{ first, second, third }));
+}
+
+TEST_F(TestPersistentEventLogging, OnlyTheMostRecentEventsThatFitAreLoaded)
+{
+    Restart(0);
+    std::vector<EventNumber> logged;
+    for (int i = 0; i < 20; i++)
+    {
+        logged.push_back(LogEvent(PriorityLevel::Critical));
+    }
+    auto inMemory = FetchEvents();
+    ASSERT_LT(inMemory.size(), logged.size());
+
+    Restart(EventManagement::GetInstance().GetLastEventNumber());
+    EXPECT_EQ(FetchEvents(), inMemory);
+}
+
+TEST_F(TestPersistentEventLogging, RemovedFabricIsScrubbedFromStore)
+{
+    Restart(0);
+    LogEvent(PriorityLevel::Critical, kTestFabric);
+    EventNumber other = LogEvent(PriorityLevel::Critical, kTestFabric + 1);
+
+    Access::SubjectDescriptor otherFabric;
+    otherFabric.fabricIndex = kTestFabric + 1;
+    ASSERT_EQ(EventManagement::GetInstance().FabricRemoved(kTestFabric), CHIP_NO_ERROR);
+
+    // The event of the removed fabric is not reported to anyone after a restart either.
+    Restart(EventManagement::GetInstance().GetLastEventNumber());
+    Access::SubjectDescriptor removedFabric;
+    removedFabric.fabricIndex = kTestFabric;
+    EXPECT_TRUE(FetchEvents(removedFabric).empty());
+    EXPECT_EQ(FetchEvents(otherFabric), (std::vector<EventNumber>{ other }));
+}
+
+} // namespace
@@ -0,0 +1,193 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/GlobalAttributeListCache.h>
+
+#include <app/data-model-provider/tests/ReadTesting.h>
+#include <app/data-model/DecodableList.h>
+#include <app/server-cluster/testing/EmptyProvider.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+using namespace chip::app::Clusters::Globals::Attributes;
+
+constexpr ClusterId kCluster = 6;
+// Endpoints 1 and 2 have the same cluster configuration, the cluster on endpoint 3 accepts fewer commands.
+constexpr EndpointId kLastEndpoint  = 3;
+constexpr EndpointId kOtherEndpoint = 3;
+
+const DataModel::AttributeEntry kAttributes[] = {
+    { 0, BitMask<DataModel::AttributeQualityFlags>(), Access::Privilege::kView, std::nullopt },
+    { AttributeList::Id, BitMask<DataModel::AttributeQualityFlags>(), Access::Privilege::kView, std::nullopt },
+};
+const DataModel::AcceptedCommandEntry kAcceptedCommands[] = { { 0 }, { 1 }, { 2 } };
+const CommandId kGeneratedCommands[]                      = { 0x10 };
+
+class ListProvider : public Testing::EmptyProvider
+{
+public:
+    size_t mAttributesQueries = 0;
+
+    CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<DataModel::AttributeEntry> & builder) override
+    {
+        VerifyOrReturnError(path.mEndpointId <= kLastEndpoint && path.mClusterId == kCluster, CHIP_ERROR_NOT_FOUND);
+        mAttributesQueries++;
+        return builder.ReferenceExisting(kAttributes);
+    }
+
+    CHIP_ERROR AcceptedCommands(const ConcreteClusterPath & path,
+                                ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> & builder) override
+    {
+        VerifyOrReturnError(path.mEndpointId <= kLastEndpoint && path.mClusterId == kCluster, CHIP_ERROR_NOT_FOUND);
+        const size_t count = (path.mEndpointId == kOtherEndpoint) ? 1 : MATTER_ARRAY_SIZE(kAcceptedCommands);
+        return builder.ReferenceExisting(Span<const DataModel::AcceptedCommandEntry>(kAcceptedCommands, count));
+    }
+
+    CHIP_ERROR GeneratedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<CommandId> & builder) override
+    {
+        VerifyOrReturnError(path.mEndpointId <= kLastEndpoint && path.mClusterId == kCluster, CHIP_ERROR_NOT_FOUND);
+        return builder.ReferenceExisting(kGeneratedCommands);
+    }
+};
+
+class TestGlobalAttributeListCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+protected:
+    std::vector<uint32_t> ReadList(DataModel::Provider & provider, EndpointId endpoint, AttributeId attribute)
+    {
+        std::vector<uint32_t> ids;
+        const ConcreteAttributePath path(endpoint, kCluster, attribute);
+
+        Testing::ReadOperation operation(path);
+        std::unique_ptr<AttributeValueEncoder> encoder = operation.StartEncoding();
+        EXPECT_TRUE(mCache.Read(&provider, path, *encoder).IsSuccess());
+        EXPECT_EQ(operation.FinishEncoding(), CHIP_NO_ERROR);
+
+        std::vector<Testing::DecodedAttributeData> items;
+        EXPECT_EQ(operation.GetEncodedIBs().Decode(items), CHIP_NO_ERROR);
+        VerifyOrReturnValue(items.size() == 1, ids, ADD_FAILURE() << "Expected a single attribute data");
+
+        DataModel::DecodableList<uint32_t> list;
+        EXPECT_EQ(list.Decode(items[0].dataReader), CHIP_NO_ERROR);
+        auto it = list.begin();
+        while (it.Next())
+        {
+            ids.push_back(it.GetValue());
+        }
+        EXPECT_EQ(it.GetStatus(), CHIP_NO_ERROR);
+        return ids;
+    }
+
+    GlobalAttributeListCache mCache;
+    ListProvider mProvider;
+};
+
+TEST_F(TestGlobalAttributeListCache, TestReadsFromCache)
+{
+    ASSERT_EQ(mCache.Init(256), CHIP_NO_ERROR);
+
+    EXPECT_EQ(ReadList(mProvider, 1, AttributeList::Id), (std::vector<uint32_t>{ 0, AttributeList::Id }));
+    EXPECT_EQ(ReadList(mProvider, 1, AcceptedCommandList::Id), (std::vector<uint32_t>{ 0, 1, 2 }));
+    EXPECT_EQ(ReadList(mProvider, 1, GeneratedCommandList::Id), (std::vector<uint32_t>{ 0x10 }));
+    EXPECT_EQ(ReadList(mProvider, 1, AttributeList::Id), (std::vector<uint32_t>{ 0, AttributeList::Id }));
+
+    // All three lists were built from a single pass over the metadata.
+    EXPECT_EQ(mProvider.mAttributesQueries, 1u);
+    EXPECT_EQ(mCache.GetNumClusters(), 1u);
+}
+
+TEST_F(TestGlobalAttributeListCache, TestSharesIdenticalLists)
+{
+    ASSERT_EQ(mCache.Init(256), CHIP_NO_ERROR);
+
+    ReadList(mProvider, 1, AttributeList::Id);
+    const size_t listsSize = mCache.GetListsSize();
+
+    ReadList(mProvider, 2, AttributeList::Id);
+    EXPECT_EQ(mCache.GetNumClusters(), 2u);
+    EXPECT_EQ(mCache.GetListsSize(), listsSize);
+
+    // Only the AcceptedCommandList of the other endpoint is stored.
+    EXPECT_EQ(ReadList(mProvider, kOtherEndpoint, AcceptedCommandList::Id), (std::vector<uint32_t>{ 0 }));
+    EXPECT_EQ(mCache.GetNumClusters(), 3u);
+    EXPECT_EQ(mCache.GetListsSize(), listsSize + sizeof(uint16_t) + sizeof(uint32_t));
+    EXPECT_EQ(ReadList(mProvider, 2, AcceptedCommandList::Id), (std::vector<uint32_t>{ 0, 1, 2 }));
+}
+
+TEST_F(TestGlobalAttributeListCache, TestInvalidate)
+{
+    ASSERT_EQ(mCache.Init(256), CHIP_NO_ERROR);
+    ReadList(mProvider, 1, AttributeList::Id);
+
+    mCache.Invalidate(AttributePathParams(2));
+    mCache.Invalidate(AttributePathParams(1, kCluster, FeatureMap::Id));
+    EXPECT_EQ(mCache.GetNumClusters(), 1u);
+
+    mCache.Invalidate(AttributePathParams(1));
+    EXPECT_EQ(mCache.GetNumClusters(), 0u);
+    EXPECT_EQ(mCache.GetListsSize(), 0u);
+
+    ReadList(mProvider, 1, AttributeList::Id);
+    EXPECT_EQ(mProvider.mAttributesQueries, 2u);
+}
+
+TEST_F(TestGlobalAttributeListCache, TestProviderChange)
+{
+    ASSERT_EQ(mCache.Init(256), CHIP_NO_ERROR);
+    ListProvider otherProvider;
+
+    ReadList(mProvider, 1, AttributeList::Id);
+    ReadList(otherProvider, 1, AttributeList::Id);
+    EXPECT_EQ(otherProvider.mAttributesQueries, 1u);
+    EXPECT_EQ(mCache.GetNumClusters(), 1u);
+}
+
+TEST_F(TestGlobalAttributeListCache, TestReadsMetadataWhenFull)
+{
+    // Too small for the lists of a cluster.
+    ASSERT_EQ(mCache.Init(24), CHIP_NO_ERROR);
+
+    EXPECT_EQ(ReadList(mProvider, 1, AcceptedCommandList::Id), (std::vector<uint32_t>{ 0, 1, 2 }));
+    EXPECT_EQ(mCache.GetNumClusters(), 0u);
+    EXPECT_EQ(mCache.GetListsSize(), 0u);
+}
+
+TEST_F(TestGlobalAttributeListCache, TestUnknownCluster)
+{
+    ASSERT_EQ(mCache.Init(256), CHIP_NO_ERROR);
+
+    const ConcreteAttributePath path(kLastEndpoint + 1, kCluster, AttributeList::Id);
+    Testing::ReadOperation operation(path);
+    std::unique_ptr<AttributeValueEncoder> encoder = operation.StartEncoding();
+    EXPECT_TRUE(mCache.Read(&mProvider, path, *encoder).IsError());
+    EXPECT_EQ(mCache.GetNumClusters(), 0u);
+}
+
+} // namespace
@@ -0,0 +1,179 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathParams.h>
+#include <app/reporting/IndexedDirtySet.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+struct TestDirtyPath : public AttributePathParams
+{
+    TestDirtyPath() {}
+    TestDirtyPath(const AttributePathParams & aPath) : AttributePathParams(aPath) {}
+    uint64_t mGeneration = 0;
+};
+
+constexpr size_t kTestCapacity = 16;
+using TestDirtySet             = IndexedDirtySet<TestDirtyPath, kTestCapacity>;
+
+TestDirtyPath * Insert(TestDirtySet & set, const AttributePathParams & path, uint64_t generation)
+{
+    TestDirtyPath * entry = set.CreateObject(path);
+    if (entry != nullptr)
+    {
+        entry->mGeneration = generation;
+    }
+    return entry;
+}
+
+size_t CountCandidates(TestDirtySet & set, const AttributePathParams & path)
+{
+    size_t count = 0;
+    set.ForEachCandidateOverlapping(path, [&](TestDirtyPath *) {
+        count++;
+        return Loop::Continue;
+    });
+    return count;
+}
+
+bool Contains(TestDirtySet & set, const AttributePathParams & path, uint64_t generation)
+{
+    return set.ForEachActiveObject([&](TestDirtyPath * entry) {
+        if (static_cast<AttributePathParams>(*entry) == path && entry->mGeneration == generation)
+        {
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    }) == Loop::Break;
+}
+
+TEST(TestIndexedDirtySet, TestCreateAndRelease)
+{
+    TestDirtySet set;
+
+    for (size_t i = 0; i < kTestCapacity; i++)
+    {
+        EXPECT_NE(Insert(set, AttributePathParams(1, 6, static_cast<AttributeId>(i)), 1), nullptr);
+    }
+    EXPECT_TRUE(set.Exhausted());
+    EXPECT_EQ(set.Allocated(), kTestCapacity);
+    EXPECT_EQ(set.CreateObject(AttributePathParams(1, 6, 100)), nullptr);
+
+    set.ForEachActiveObject([&](TestDirtyPath * entry) {
+        if (entry->mAttributeId % 2 == 0)
+        {
+            set.ReleaseObject(entry);
+        }
+        return Loop::Continue;
+    });
+    EXPECT_EQ(set.Allocated(), kTestCapacity / 2);
+    EXPECT_FALSE(set.Exhausted());
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(1, 6, 1)), kTestCapacity / 2);
+
+    set.ReleaseAll();
+    EXPECT_EQ(set.Allocated(), 0u);
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(1, 6, 1)), 0u);
+}
+
+TEST(TestIndexedDirtySet, TestCandidatesOnlyVisitMatchingCluster)
+{
+    TestDirtySet set;
+
+    ASSERT_NE(Insert(set, AttributePathParams(1, 6, 1), 1), nullptr);
+    ASSERT_NE(Insert(set, AttributePathParams(1, 6, 2), 1), nullptr);
+    ASSERT_NE(Insert(set, AttributePathParams(1, 8, 1), 1), nullptr);
+    ASSERT_NE(Insert(set, AttributePathParams(2, 6, 1), 1), nullptr);
+    ASSERT_NE(Insert(set, AttributePathParams(3), 1), nullptr);
+
+    // The two paths under endpoint 1 / cluster 6, plus the wildcard cluster path for endpoint 3.
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(1, 6, 5)), 3u);
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(EndpointId(2), ClusterId(6))), 2u);
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(4, 4, 4)), 1u);
+
+    // Wildcard lookups have to visit everything.
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(1)), 5u);
+    EXPECT_EQ(CountCandidates(set, AttributePathParams()), 5u);
+}
+
+TEST(TestIndexedDirtySet, TestUpdatePathMovesEntry)
+{
+    TestDirtySet set;
+
+    TestDirtyPath * entry = Insert(set, AttributePathParams(1, 6, 1), 3);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(1, 6, 1)), 1u);
+
+    set.UpdatePath(entry, AttributePathParams(2, 8, 1));
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(1, 6, 1)), 0u);
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(2, 8, 1)), 1u);
+    EXPECT_EQ(entry->mGeneration, 3u);
+
+    set.UpdatePath(entry, AttributePathParams(2));
+    EXPECT_TRUE(entry->HasWildcardClusterId());
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(5, 5, 5)), 1u);
+
+    set.ReleaseObject(entry);
+    EXPECT_EQ(set.Allocated(), 0u);
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(5, 5, 5)), 0u);
+}
+
+TEST(TestIndexedDirtySet, TestMergePathsUnderSameCluster)
+{
+    TestDirtySet set;
+
+    ASSERT_NE(Insert(set, AttributePathParams(1, 6, 1), 2), nullptr);
+    ASSERT_NE(Insert(set, AttributePathParams(1, 6, 2), 5), nullptr);
+    ASSERT_NE(Insert(set, AttributePathParams(1, 6, 3), 4), nullptr);
+    ASSERT_NE(Insert(set, AttributePathParams(1, 8, 1), 1), nullptr);
+
+    EXPECT_TRUE(set.MergePathsUnderSameCluster());
+    EXPECT_EQ(set.Allocated(), 2u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(EndpointId(1), ClusterId(6)), 5));
+    EXPECT_TRUE(Contains(set, AttributePathParams(1, 8, 1), 1));
+
+    // Nothing left to merge.
+    EXPECT_FALSE(set.MergePathsUnderSameCluster());
+}
+
+TEST(TestIndexedDirtySet, TestMergePathsUnderSameEndpoint)
+{
+    TestDirtySet set;
+
+    ASSERT_NE(Insert(set, AttributePathParams(1, 6, 1), 2), nullptr);
+    ASSERT_NE(Insert(set, AttributePathParams(1, 8, 1), 7), nullptr);
+    ASSERT_NE(Insert(set, AttributePathParams(EndpointId(1), ClusterId(9)), 3), nullptr);
+    ASSERT_NE(Insert(set, AttributePathParams(2, 6, 1), 1), nullptr);
+
+    EXPECT_TRUE(set.MergePathsUnderSameEndpoint());
+    EXPECT_EQ(set.Allocated(), 2u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(1), 7));
+    EXPECT_TRUE(Contains(set, AttributePathParams(2, 6, 1), 1));
+
+    // The merged endpoint path is now a wildcard cluster path, and is a candidate for any cluster.
+    EXPECT_EQ(CountCandidates(set, AttributePathParams(2, 6, 1)), 2u);
+    EXPECT_FALSE(set.MergePathsUnderSameEndpoint());
+}
+
+} // namespace
@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/AttributePathParams.h>
+#include <app/DataVersionFilter.h>
+#include <app/InteractionArena.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/LinkedList.h>
+
+#include <cstdint>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+class TestInteractionArena : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+};
+
+bool IsAligned(const void * pointer, size_t alignment)
+{
+    return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+TEST_F(TestInteractionArena, TestInlineThenBlocks)
+{
+    InteractionArena arena;
+
+    // Small objects first fill the inline space.
+    SingleLinkedListNode<AttributePathParams> * list = nullptr;
+    size_t inlineCount                               = 0;
+    while (arena.BlockCount() == 0)
+    {
+        auto * node = arena.New<SingleLinkedListNode<AttributePathParams>>();
+        ASSERT_NE(node, nullptr);
+        EXPECT_TRUE(IsAligned(node, alignof(SingleLinkedListNode<AttributePathParams>)));
+        EXPECT_TRUE(node->mValue.IsWildcardPath());
+        node->mValue.mEndpointId = static_cast<EndpointId>(inlineCount);
+        node->mpNext             = list;
+        list                     = node;
+        inlineCount++;
+    }
+    EXPECT_GE(inlineCount, InteractionArena::kInlineSize / sizeof(SingleLinkedListNode<AttributePathParams>));
+
+    // Earlier objects are left alone.
+    size_t count = 0;
+    for (auto * node = list; node != nullptr; node = node->mpNext)
+    {
+        EXPECT_EQ(node->mValue.mEndpointId, static_cast<EndpointId>(inlineCount - 1 - count));
+        count++;
+    }
+    EXPECT_EQ(count, inlineCount);
+
+    // Objects of different alignment share the blocks.
+    auto * filter = arena.New<SingleLinkedListNode<DataVersionFilter>>();
+    ASSERT_NE(filter, nullptr);
+    EXPECT_TRUE(IsAligned(filter, alignof(SingleLinkedListNode<DataVersionFilter>)));
+    EXPECT_EQ(arena.BlockCount(), 1u);
+
+    arena.Release();
+    EXPECT_EQ(arena.BlockCount(), 0u);
+    EXPECT_NE(arena.New<SingleLinkedListNode<AttributePathParams>>(), nullptr);
+    EXPECT_EQ(arena.BlockCount(), 0u);
+}
+
+TEST_F(TestInteractionArena, TestLargeAllocations)
+{
+    InteractionArena arena;
+
+    uint8_t * small = static_cast<uint8_t *>(arena.Allocate(1, 1));
+    ASSERT_NE(small, nullptr);
+
+    // Bigger than a block: a block of its own, and the current space keeps being used.
+    void * large = arena.Allocate(InteractionArena::kBlockSize + 1, alignof(std::max_align_t));
+    ASSERT_NE(large, nullptr);
+    EXPECT_TRUE(IsAligned(large, alignof(std::max_align_t)));
+    EXPECT_EQ(arena.BlockCount(), 1u);
+
+    uint8_t * next = static_cast<uint8_t *>(arena.Allocate(1, 1));
+    EXPECT_EQ(next, small + 1);
+
+    // Unsupported alignments are refused.
+    EXPECT_EQ(arena.Allocate(1, 0), nullptr);
+    EXPECT_EQ(arena.Allocate(1, alignof(std::max_align_t) * 2), nullptr);
+}
+
+} // namespace
@@ -243,6 +243,65 @@ TEST_F(TestInteractionModelEngine, TestRemoveDuplicateConcreteAttribute)
     engine->ReleaseAttributePathList(attributePathParamsList);
 }
 
+#if CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+TEST_F(TestInteractionModelEngine, TestCompactAttributePathList)
+{
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+
+    engine->SetDataModelProvider(CodegenDataModelProviderInstance(nullptr /* delegate */));
+    EXPECT_EQ(CHIP_NO_ERROR, engine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler()));
+
+    const Access::SubjectDescriptor subjectDescriptor = GetSessionBobToAlice()->GetSubjectDescriptor();
+    const ConcreteClusterPath fullCluster(chip::Testing::kMockEndpoint2, chip::Testing::MockClusterId(3));
+    ReadOnlyBuffer<DataModel::AttributeEntry> attributes = engine->GetDataModelProvider()->AttributesIgnoreError(fullCluster);
+    ASSERT_GT(attributes.size(), 1u);
+
+    SingleLinkedListNode<AttributePathParams> * attributePathParamsList = nullptr;
+
+    // Every attribute of one cluster, a duplicate, and paths on other endpoints, in no particular order.
+    using namespace chip::Testing;
+    AttributePathParams wildcardEndpoint(kInvalidEndpointId, MockClusterId(1), kInvalidAttributeId);
+    AttributePathParams endpoint3(kMockEndpoint3, MockClusterId(2), MockAttributeId(1));
+    AttributePathParams endpoint1(kMockEndpoint1, MockClusterId(2), MockAttributeId(1));
+    EXPECT_SUCCESS(engine->PushFrontAttributePathList(attributePathParamsList, wildcardEndpoint));
+    EXPECT_SUCCESS(engine->PushFrontAttributePathList(attributePathParamsList, endpoint3));
+    for (const auto & entry : attributes)
+    {
+        AttributePathParams path(fullCluster.mEndpointId, fullCluster.mClusterId, entry.attributeId);
+        EXPECT_SUCCESS(engine->PushFrontAttributePathList(attributePathParamsList, path));
+    }
+    EXPECT_SUCCESS(engine->PushFrontAttributePathList(attributePathParamsList, endpoint1));
+    EXPECT_SUCCESS(engine->PushFrontAttributePathList(attributePathParamsList, endpoint3));
+
+    engine->CompactAttributePathList(attributePathParamsList, subjectDescriptor);
+    ASSERT_EQ(GetAttributePathListLength(attributePathParamsList), 4);
+
+    auto * path = attributePathParamsList;
+    EXPECT_EQ(path->mValue, endpoint1);
+    path = path->mpNext;
+    EXPECT_EQ(path->mValue, AttributePathParams(fullCluster.mEndpointId, fullCluster.mClusterId));
+    path = path->mpNext;
+    EXPECT_EQ(path->mValue, endpoint3);
+    path = path->mpNext;
+    EXPECT_EQ(path->mValue, wildcardEndpoint);
+    engine->ReleaseAttributePathList(attributePathParamsList);
+
+    // A cluster missing one of its attributes stays as is.
+    for (size_t i = 1; i < attributes.size(); i++)
+    {
+        AttributePathParams partial(fullCluster.mEndpointId, fullCluster.mClusterId, attributes[i].attributeId);
+        EXPECT_SUCCESS(engine->PushFrontAttributePathList(attributePathParamsList, partial));
+    }
+    engine->CompactAttributePathList(attributePathParamsList, subjectDescriptor);
+    EXPECT_EQ(GetAttributePathListLength(attributePathParamsList), static_cast<int>(attributes.size() - 1));
+    for (path = attributePathParamsList; path != nullptr && path->mpNext != nullptr; path = path->mpNext)
+    {
+        EXPECT_LT(path->mValue.mAttributeId, path->mpNext->mValue.mAttributeId);
+    }
+    engine->ReleaseAttributePathList(attributePathParamsList);
+}
+#endif // CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+
 /**
  * @brief Test verifies the SubjectHasActiveSubscription with a single subscription with a single entry
  */
@@ -0,0 +1,183 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathParams.h>
+#include <app/ReadHandlerInterestIndex.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+struct FakeHandler
+{
+    int mVisits = 0;
+};
+
+using PathNode = SingleLinkedListNode<AttributePathParams>;
+
+constexpr size_t kTestCapacity = 8;
+using TestIndex                = ReadHandlerInterestIndex<FakeHandler, kTestCapacity>;
+
+void Chain(PathNode * nodes, size_t count)
+{
+    for (size_t i = 0; i + 1 < count; i++)
+    {
+        nodes[i].mpNext = &nodes[i + 1];
+    }
+    nodes[count - 1].mpNext = nullptr;
+}
+
+int VisitInterested(TestIndex & index, const AttributePathParams & path)
+{
+    int visited = 0;
+    index.ForEachInterestedHandler(path, [&](FakeHandler * handler) {
+        handler->mVisits++;
+        visited++;
+        return Loop::Continue;
+    });
+    return visited;
+}
+
+TEST(TestReadHandlerInterestIndex, TestConcretePathsAreIndexed)
+{
+    TestIndex index;
+    FakeHandler handlerA;
+    FakeHandler handlerB;
+
+    PathNode pathsA[3];
+    pathsA[0].mValue = AttributePathParams(1, 6, 0);
+    pathsA[1].mValue = AttributePathParams(1, 6, 1);
+    pathsA[2].mValue = AttributePathParams(EndpointId(1), ClusterId(8));
+    Chain(pathsA, 3);
+
+    PathNode pathsB[1];
+    pathsB[0].mValue = AttributePathParams(2, 6, 0);
+    Chain(pathsB, 1);
+
+    index.Register(handlerA, pathsA);
+    index.Register(handlerB, pathsB);
+
+    // Both paths of handler A in cluster 6 share a single entry.
+    EXPECT_EQ(index.Allocated(), 3u);
+
+    EXPECT_TRUE(index.CanLookup(AttributePathParams(1, 6, 3)));
+    EXPECT_EQ(VisitInterested(index, AttributePathParams(1, 6, 3)), 1);
+    EXPECT_EQ(handlerA.mVisits, 1);
+    EXPECT_EQ(handlerB.mVisits, 0);
+
+    EXPECT_EQ(VisitInterested(index, AttributePathParams(2, 6, 0)), 1);
+    EXPECT_EQ(handlerB.mVisits, 1);
+
+    EXPECT_EQ(VisitInterested(index, AttributePathParams(3, 6, 0)), 0);
+
+    // Wildcard changes cannot be looked up.
+    EXPECT_FALSE(index.CanLookup(AttributePathParams(1)));
+    EXPECT_FALSE(index.CanLookup(AttributePathParams(ClusterId(6), AttributeId(0))));
+}
+
+TEST(TestReadHandlerInterestIndex, TestWildcardHandlersAreAlwaysVisited)
+{
+    TestIndex index;
+    FakeHandler wildcardHandler;
+    FakeHandler concreteHandler;
+
+    PathNode wildcardPaths[2];
+    wildcardPaths[0].mValue = AttributePathParams(1, 6, 0);
+    wildcardPaths[1].mValue = AttributePathParams(ClusterId(8), kInvalidAttributeId);
+    Chain(wildcardPaths, 2);
+
+    PathNode concretePaths[1];
+    concretePaths[0].mValue = AttributePathParams(4, 4, 4);
+    Chain(concretePaths, 1);
+
+    index.Register(wildcardHandler, wildcardPaths);
+    index.Register(concreteHandler, concretePaths);
+    EXPECT_EQ(index.Allocated(), 2u);
+
+    EXPECT_EQ(VisitInterested(index, AttributePathParams(7, 7, 7)), 1);
+    EXPECT_EQ(wildcardHandler.mVisits, 1);
+    EXPECT_EQ(VisitInterested(index, AttributePathParams(4, 4, 4)), 2);
+    EXPECT_EQ(wildcardHandler.mVisits, 2);
+    EXPECT_EQ(concreteHandler.mVisits, 1);
+}
+
+TEST(TestReadHandlerInterestIndex, TestUnregisterAndReregister)
+{
+    TestIndex index;
+    FakeHandler handler;
+
+    PathNode paths[2];
+    paths[0].mValue = AttributePathParams(1, 6, 0);
+    paths[1].mValue = AttributePathParams(1, 8, 0);
+    Chain(paths, 2);
+
+    index.Register(handler, paths);
+    EXPECT_EQ(index.Allocated(), 2u);
+
+    // Registering again replaces the previous registration.
+    index.Register(handler, &paths[1]);
+    EXPECT_EQ(index.Allocated(), 1u);
+    EXPECT_EQ(VisitInterested(index, AttributePathParams(1, 6, 0)), 0);
+    EXPECT_EQ(VisitInterested(index, AttributePathParams(1, 8, 0)), 1);
+
+    index.Unregister(handler);
+    EXPECT_EQ(index.Allocated(), 0u);
+    EXPECT_EQ(VisitInterested(index, AttributePathParams(1, 8, 0)), 0);
+
+    // Unregistering an unknown handler is harmless.
+    index.Unregister(handler);
+    EXPECT_EQ(index.Allocated(), 0u);
+}
+
+TEST(TestReadHandlerInterestIndex, TestOverflow)
+{
+    TestIndex index;
+    FakeHandler handler;
+    FakeHandler extraHandler;
+
+    PathNode paths[kTestCapacity];
+    for (size_t i = 0; i < kTestCapacity; i++)
+    {
+        paths[i].mValue = AttributePathParams(1, static_cast<ClusterId>(i), 0);
+    }
+    Chain(paths, kTestCapacity);
+
+    PathNode extraPaths[1];
+    extraPaths[0].mValue = AttributePathParams(2, 2, 2);
+    Chain(extraPaths, 1);
+
+    index.Register(handler, paths);
+    EXPECT_FALSE(index.HasOverflowed());
+    EXPECT_TRUE(index.CanLookup(AttributePathParams(1, 1, 0)));
+
+    index.Register(extraHandler, extraPaths);
+    EXPECT_TRUE(index.HasOverflowed());
+    EXPECT_FALSE(index.CanLookup(AttributePathParams(1, 1, 0)));
+
+    // The index becomes usable again once it has been emptied.
+    index.Unregister(handler);
+    index.Unregister(extraHandler);
+    EXPECT_FALSE(index.HasOverflowed());
+    EXPECT_TRUE(index.CanLookup(AttributePathParams(1, 1, 0)));
+}
+
+} // namespace
@@ -58,6 +58,7 @@ public:
     void TestReportTiming();
     void TestObserverCallbacks();
     void TestSynchronizedScheduler();
+    void TestSynchronizedSchedulerReportSlack();
 
     /// @brief Mimicks the various operations that happen on a subscription transaction after a read handler was created so that
     /// readhandlers are in the expected state for further tests.
@@ -807,6 +808,59 @@ TEST_F_FROM_FIXTURE(TestReportScheduler, TestSynchronizedScheduler)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE(TestReportScheduler, TestSynchronizedSchedulerReportSlack)
+{
+    NullReadHandlerCallback nullCallback;
+    // exchange context
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(nullptr, false);
+
+    // Read handler pool
+    ObjectPool<ReadHandler, kNumMaxReadHandlers> readHandlerPool;
+
+    // Initialize the mock system time
+    sTestTimerSynchronizedDelegate.SetMockSystemTimestamp(System::Clock::Milliseconds64(0));
+    syncScheduler.SetReportSlack(System::Clock::Milliseconds32(1500));
+
+    ReadHandler * readHandler1 =
+        readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &syncScheduler);
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler1, &syncScheduler, 0, 2));
+    ReadHandlerNode * node1 = syncScheduler.FindReadHandlerNode(readHandler1);
+
+    ReadHandler * readHandler2 =
+        readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &syncScheduler);
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler2, &syncScheduler, 0, 10));
+
+    // A report that becomes due within the slack of readHandler1's max waits for it
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(1000));
+    readHandler2->ForceDirtyState();
+    EXPECT_TRUE(syncScheduler.IsReportableNow(readHandler2));
+    EXPECT_TRUE(syncScheduler.IsReportScheduled(readHandler2));
+    EXPECT_EQ(syncScheduler.mNextReportTimestamp, node1->GetMaxTimestamp());
+
+    // Both handlers report on the same wake
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(1000));
+    EXPECT_TRUE(syncScheduler.IsReportableNow(readHandler1));
+    EXPECT_TRUE(syncScheduler.IsReportableNow(readHandler2));
+    EXPECT_FALSE(syncScheduler.IsReportScheduled(readHandler1));
+
+    readHandler2->ClearForceDirtyFlag();
+    syncScheduler.OnSubscriptionReportSent(readHandler1);
+    syncScheduler.OnSubscriptionReportSent(readHandler2);
+
+    // A report that becomes due further than the slack from the next max is sent right away
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(100));
+    syncScheduler.SetReportSlack(System::Clock::Milliseconds32(500));
+    readHandler2->ForceDirtyState();
+    EXPECT_TRUE(syncScheduler.IsReportableNow(readHandler2));
+    EXPECT_FALSE(syncScheduler.IsReportScheduled(readHandler2));
+
+    syncScheduler.SetReportSlack(System::Clock::Milliseconds32(0));
+    syncScheduler.UnregisterAllHandlers();
+    readHandlerPool.ReleaseAll();
+    exchangeCtx->Close();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -0,0 +1,113 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathParams.h>
+#include <app/reporting/ReportThrottle.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+using namespace chip::System::Clock::Literals;
+
+using TestThrottle = ReportThrottle<2, 2>;
+using Decision     = TestThrottle::Decision;
+
+constexpr ClusterId kCluster     = 0x0008;
+constexpr AttributeId kThrottled = 0x0000;
+constexpr AttributeId kOther     = 0x0001;
+
+std::vector<ConcreteAttributePath> Due(TestThrottle & throttle, System::Clock::Milliseconds64 now)
+{
+    std::vector<ConcreteAttributePath> due;
+    throttle.ForEachDue(now, [&due](const ConcreteAttributePath & path) { due.push_back(path); });
+    return due;
+}
+
+TEST(TestReportThrottle, TestHoldsBackChangesDuringWindow)
+{
+    TestThrottle throttle;
+    EXPECT_EQ(throttle.SetInterval(kCluster, kThrottled, System::Clock::Milliseconds32(1000)), CHIP_NO_ERROR);
+
+    const AttributePathParams path(1, kCluster, kThrottled);
+    System::Clock::Milliseconds64 deadline;
+
+    EXPECT_EQ(throttle.OnDirty(path, 100_ms64), Decision::kReport);
+    EXPECT_FALSE(throttle.NextDeadline(deadline));
+
+    EXPECT_EQ(throttle.OnDirty(path, 200_ms64), Decision::kDefer);
+    EXPECT_EQ(throttle.OnDirty(path, 300_ms64), Decision::kDefer);
+    ASSERT_TRUE(throttle.NextDeadline(deadline));
+    EXPECT_EQ(deadline, 1100_ms64);
+
+    // Other attributes, other endpoints and wildcard paths are not held back.
+    EXPECT_EQ(throttle.OnDirty(AttributePathParams(1, kCluster, kOther), 300_ms64), Decision::kReport);
+    EXPECT_EQ(throttle.OnDirty(AttributePathParams(2, kCluster, kThrottled), 300_ms64), Decision::kReport);
+    EXPECT_EQ(throttle.OnDirty(AttributePathParams(EndpointId(1), kCluster), 300_ms64), Decision::kReport);
+
+    EXPECT_TRUE(Due(throttle, 1099_ms64).empty());
+    auto due = Due(throttle, 1100_ms64);
+    ASSERT_EQ(due.size(), 1u);
+    EXPECT_EQ(due[0], ConcreteAttributePath(1, kCluster, kThrottled));
+
+    // The held back change was released once, and marking it dirty again opens a new window.
+    EXPECT_TRUE(Due(throttle, 1100_ms64).empty());
+    EXPECT_EQ(throttle.OnDirty(path, 1100_ms64), Decision::kReport);
+    EXPECT_EQ(throttle.OnDirty(path, 1200_ms64), Decision::kDefer);
+
+    // Removing the policy stops the throttling.
+    EXPECT_EQ(throttle.SetInterval(kCluster, kThrottled, System::Clock::Milliseconds32(0)), CHIP_NO_ERROR);
+    EXPECT_EQ(throttle.PolicyCount(), 0u);
+    EXPECT_EQ(throttle.OnDirty(path, 1300_ms64), Decision::kReport);
+}
+
+TEST(TestReportThrottle, TestPathTableFull)
+{
+    TestThrottle throttle;
+    EXPECT_EQ(throttle.SetInterval(kCluster, kThrottled, System::Clock::Milliseconds32(1000)), CHIP_NO_ERROR);
+    EXPECT_EQ(throttle.SetInterval(kCluster, kOther, System::Clock::Milliseconds32(1000)), CHIP_NO_ERROR);
+    EXPECT_EQ(throttle.SetInterval(kCluster, 0x0002, System::Clock::Milliseconds32(1000)), CHIP_ERROR_NO_MEMORY);
+
+    // Two paths with held back changes fill the table.
+    for (EndpointId endpoint = 1; endpoint <= 2; endpoint++)
+    {
+        EXPECT_EQ(throttle.OnDirty(AttributePathParams(endpoint, kCluster, kThrottled), 0_ms64), Decision::kReport);
+        EXPECT_EQ(throttle.OnDirty(AttributePathParams(endpoint, kCluster, kThrottled), 10_ms64), Decision::kDefer);
+    }
+    const AttributePathParams third(3, kCluster, kThrottled);
+    EXPECT_EQ(throttle.OnDirty(third, 20_ms64), Decision::kReport);
+    EXPECT_EQ(throttle.OnDirty(third, 30_ms64), Decision::kReport);
+
+    // Once a window ends without held back changes, its entry is reused.
+    EXPECT_EQ(Due(throttle, 1000_ms64).size(), 2u);
+    EXPECT_EQ(throttle.OnDirty(third, 1000_ms64), Decision::kReport);
+    EXPECT_EQ(throttle.OnDirty(third, 1010_ms64), Decision::kDefer);
+
+    std::vector<ConcreteAttributePath> flushed;
+    throttle.Flush([&flushed](const ConcreteAttributePath & path) { flushed.push_back(path); });
+    ASSERT_EQ(flushed.size(), 1u);
+    EXPECT_EQ(flushed[0], ConcreteAttributePath(3, kCluster, kThrottled));
+}
+
+} // namespace
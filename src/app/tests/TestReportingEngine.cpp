@@ -98,6 +98,7 @@ public:
     void TestBuildAndSendSingleReportData();
     void TestMergeOverlappedAttributePath();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
+    void TestDeferAttributeEstimatedLargerThanChunk();
 
 private:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
@@ -120,6 +121,17 @@ class TestExchangeDelegate : public Messaging::ExchangeDelegate
     void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
 };
 
+/// Estimates kTestFieldId2 to be larger than any report message.
+class EstimatingDataModel : public TestImCustomDataModel
+{
+public:
+    std::optional<size_t> EstimateAttributeEncodedSize(const DataModel::ReadAttributeRequest & request) override
+    {
+        VerifyOrReturnValue(request.path.mAttributeId == kTestFieldId2, std::nullopt);
+        return System::PacketBuffer::kMaxSize;
+    }
+};
+
 class DummyDelegate : public ReadHandler::ManagementCallback
 {
 public:
@@ -169,9 +181,8 @@ bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
 
 bool TestReportingEngine::InsertToDirtySet(const AttributePathParams & aPath)
 {
-    auto path = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
+    auto path = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject(aPath);
     VerifyOrReturnError(path != nullptr, false);
-    *path             = aPath;
     path->mGeneration = InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
     return true;
 }
@@ -232,10 +243,8 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    AttributePathParams * clusterInfo = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    clusterInfo->mEndpointId          = 1;
-    clusterInfo->mClusterId           = 1;
-    clusterInfo->mAttributeId         = 1;
+    AttributePathParams * clusterInfo =
+        InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject(AttributePathParams(1, 1, 1));
 
     {
         AttributePathParams testClusterInfo;
@@ -359,6 +368,58 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestDeferAttributeEstimatedLargerThanChunk)
+{
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    ReadRequestMessage::Builder readRequestBuilder;
+    DummyDelegate dummy;
+    EstimatingDataModel model;
+
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+    InteractionModelEngine::GetInstance()->SetDataModelProvider(&model);
+    TestExchangeDelegate delegate;
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(&delegate);
+
+    writer.Init(std::move(readRequestbuf));
+    EXPECT_EQ(readRequestBuilder.Init(&writer), CHIP_NO_ERROR);
+    AttributePathIBs::Builder & attributePathListBuilder = readRequestBuilder.CreateAttributeRequests();
+    EXPECT_EQ(readRequestBuilder.GetError(), CHIP_NO_ERROR);
+    for (AttributeId attributeId : { kTestFieldId1, kTestFieldId2 })
+    {
+        AttributePathIB::Builder & attributePathBuilder = attributePathListBuilder.CreatePath();
+        EXPECT_EQ(attributePathListBuilder.GetError(), CHIP_NO_ERROR);
+        EXPECT_SUCCESS(attributePathBuilder.Node(1)
+                           .Endpoint(kTestEndpointId)
+                           .Cluster(kTestClusterId)
+                           .Attribute(attributeId)
+                           .EndOfAttributePathIB());
+    }
+    EXPECT_SUCCESS(attributePathListBuilder.EndOfAttributePathIBs());
+    EXPECT_SUCCESS(readRequestBuilder.IsFabricFiltered(false).EndOfReadRequestMessage());
+    EXPECT_EQ(writer.Finalize(&readRequestbuf), CHIP_NO_ERROR);
+
+    {
+        app::ReadHandler readHandler(dummy, exchangeCtx, chip::app::ReadHandler::InteractionType::Read,
+                                     app::reporting::GetDefaultReportScheduler());
+        readHandler.OnInitialRequest(std::move(readRequestbuf));
+
+        // The second attribute starts the next chunk instead of being encoded and rolled back.
+        Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+        EXPECT_EQ(engine.BuildAndSendSingleReportData(&readHandler), CHIP_NO_ERROR);
+        EXPECT_TRUE(readHandler.IsReporting());
+        EXPECT_EQ(engine.GetNumEstimatedDeferralsInLastReport(), 1u);
+        EXPECT_EQ(engine.GetNumEncodeRollbacksInLastReport(), 0u);
+
+        DrainAndServiceIO();
+    }
+
+    InteractionModelEngine::GetInstance()->SetDataModelProvider(&TestImCustomDataModel::Instance());
+    InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -0,0 +1,214 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ResubscriptionScheduler.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <pw_unit_test/framework.h>
+#include <system/RAIIMockClock.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+class TestEntry : public ResubscriptionScheduler::Entry
+{
+public:
+    TestEntry(NodeId nodeId, std::vector<TestEntry *> * admissions = nullptr) : mPeer(nodeId, 1), mAdmissions(admissions) {}
+
+    bool mHasActiveSession = false;
+    size_t mAdmittedCount  = 0;
+
+private:
+    ScopedNodeId GetResubscriptionPeer() const override { return mPeer; }
+    bool CanResubscribeOverActiveSession() const override { return mHasActiveSession; }
+    void OnResubscriptionAdmitted() override
+    {
+        mAdmittedCount++;
+        if (mAdmissions != nullptr)
+        {
+            mAdmissions->push_back(this);
+        }
+    }
+
+    ScopedNodeId mPeer;
+    std::vector<TestEntry *> * mAdmissions;
+};
+
+class TestResubscriptionScheduler : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        spIOContext = new Testing::IOContext();
+        ASSERT_EQ(spIOContext->Init(), CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        spIOContext->Shutdown();
+        delete spIOContext;
+        spIOContext = nullptr;
+        Platform::MemoryShutdown();
+    }
+
+    void SetUp() override
+    {
+        // Keep the clock where it was, for the timers started before the mock clock is installed.
+        mClock.SetMonotonic(mRealClock.GetMonotonicTimestamp());
+        mScheduler.Init(&spIOContext->GetSystemLayer());
+    }
+
+    void TearDown() override { mScheduler.Shutdown(); }
+
+protected:
+    void Advance(System::Clock::Timeout duration) { spIOContext->DriveIOInSimulatedTime(mClock, duration); }
+
+    // Use up the burst of the scheduler with resubscriptions that go ahead right away.
+    void UseUpBurst()
+    {
+        for (uint32_t i = 0; i < ResubscriptionScheduler::kBurst; i++)
+        {
+            TestEntry entry(0x1000 + i);
+            EXPECT_TRUE(mScheduler.RequestResubscription(entry, ResubscriptionPriority::kNormal));
+        }
+    }
+
+    static Testing::IOContext * spIOContext;
+
+    System::Clock::ClockBase & mRealClock = System::SystemClock();
+    System::Clock::Internal::RAIIMockClock mClock;
+    ResubscriptionScheduler mScheduler;
+};
+
+Testing::IOContext * TestResubscriptionScheduler::spIOContext = nullptr;
+
+TEST_F(TestResubscriptionScheduler, TestRateLimitsAfterBurst)
+{
+    constexpr size_t kWaitingCount = 3;
+
+    UseUpBurst();
+
+    std::unique_ptr<TestEntry> entries[kWaitingCount];
+    for (size_t i = 0; i < kWaitingCount; i++)
+    {
+        entries[i] = std::make_unique<TestEntry>(0x2000 + i);
+        EXPECT_FALSE(mScheduler.RequestResubscription(*entries[i], ResubscriptionPriority::kNormal));
+        EXPECT_TRUE(entries[i]->IsWaitingForResubscription());
+    }
+    EXPECT_EQ(mScheduler.GetNumWaitingResubscriptions(), kWaitingCount);
+
+    // One resubscription goes ahead per interval, first come first served.
+    for (size_t i = 0; i < kWaitingCount; i++)
+    {
+        Advance(ResubscriptionScheduler::kInterval);
+        for (size_t j = 0; j < kWaitingCount; j++)
+        {
+            EXPECT_EQ(entries[j]->mAdmittedCount, j <= i ? 1u : 0u);
+            EXPECT_EQ(entries[j]->IsWaitingForResubscription(), j > i);
+        }
+    }
+
+    // Tokens keep coming back up to the burst while nothing waits.
+    Advance(ResubscriptionScheduler::kInterval * ResubscriptionScheduler::kBurst);
+    UseUpBurst();
+    TestEntry entry(0x3000);
+    EXPECT_FALSE(mScheduler.RequestResubscription(entry, ResubscriptionPriority::kNormal));
+}
+
+TEST_F(TestResubscriptionScheduler, TestActiveSessionGoesAhead)
+{
+    UseUpBurst();
+
+    TestEntry entry(0x2000);
+    entry.mHasActiveSession = true;
+    EXPECT_TRUE(mScheduler.RequestResubscription(entry, ResubscriptionPriority::kLow));
+    EXPECT_FALSE(entry.IsWaitingForResubscription());
+}
+
+TEST_F(TestResubscriptionScheduler, TestPriorityOrder)
+{
+    std::vector<TestEntry *> admissions;
+    TestEntry low(0x2000, &admissions);
+    TestEntry normal(0x2001, &admissions);
+    TestEntry high(0x2002, &admissions);
+
+    UseUpBurst();
+    EXPECT_FALSE(mScheduler.RequestResubscription(low, ResubscriptionPriority::kLow));
+    EXPECT_FALSE(mScheduler.RequestResubscription(normal, ResubscriptionPriority::kNormal));
+    EXPECT_FALSE(mScheduler.RequestResubscription(high, ResubscriptionPriority::kHigh));
+
+    Advance(ResubscriptionScheduler::kInterval * 3);
+    ASSERT_EQ(admissions.size(), 3u);
+    EXPECT_EQ(admissions[0], &high);
+    EXPECT_EQ(admissions[1], &normal);
+    EXPECT_EQ(admissions[2], &low);
+}
+
+TEST_F(TestResubscriptionScheduler, TestSamePeerGoesAheadTogether)
+{
+    TestEntry first(0x2000);
+    TestEntry other(0x2001);
+    TestEntry second(0x2000);
+
+    UseUpBurst();
+    EXPECT_FALSE(mScheduler.RequestResubscription(first, ResubscriptionPriority::kNormal));
+    EXPECT_FALSE(mScheduler.RequestResubscription(other, ResubscriptionPriority::kNormal));
+    EXPECT_FALSE(mScheduler.RequestResubscription(second, ResubscriptionPriority::kLow));
+
+    // A single token lets both resubscriptions to the first peer through, since they share a session.
+    Advance(ResubscriptionScheduler::kInterval);
+    EXPECT_EQ(first.mAdmittedCount, 1u);
+    EXPECT_EQ(second.mAdmittedCount, 1u);
+    EXPECT_EQ(other.mAdmittedCount, 0u);
+
+    Advance(ResubscriptionScheduler::kInterval);
+    EXPECT_EQ(other.mAdmittedCount, 1u);
+}
+
+TEST_F(TestResubscriptionScheduler, TestCancel)
+{
+    TestEntry cancelled(0x2000);
+    TestEntry waiting(0x2002);
+
+    UseUpBurst();
+    EXPECT_FALSE(mScheduler.RequestResubscription(cancelled, ResubscriptionPriority::kNormal));
+    {
+        TestEntry destroyed(0x2001);
+        EXPECT_FALSE(mScheduler.RequestResubscription(destroyed, ResubscriptionPriority::kNormal));
+    }
+    EXPECT_FALSE(mScheduler.RequestResubscription(waiting, ResubscriptionPriority::kNormal));
+
+    ResubscriptionScheduler::CancelResubscription(cancelled);
+    EXPECT_FALSE(cancelled.IsWaitingForResubscription());
+    EXPECT_EQ(mScheduler.GetNumWaitingResubscriptions(), 1u);
+
+    // Cancelled and destroyed entries do not use up tokens.
+    Advance(ResubscriptionScheduler::kInterval);
+    EXPECT_EQ(cancelled.mAdmittedCount, 0u);
+    EXPECT_EQ(waiting.mAdmittedCount, 1u);
+}
+
+} // namespace
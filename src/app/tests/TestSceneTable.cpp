@@ -2249,4 +2249,42 @@ TEST_F(TestSceneTable, TestOTAChanges)
     EXPECT_EQ(1, fabric_capacity);
 }
 
+TEST_F(TestSceneTable, TestStalePositionHints)
+{
+    SceneTable * sceneTable = scenes::GetSceneTableImpl(kTestEndpoint1, defaultTestTableSize);
+    ASSERT_NE(nullptr, sceneTable);
+    ASSERT_NE(nullptr, mpTestStorage);
+
+    // Reset test
+    ResetSceneTable(sceneTable);
+
+    // Storing and loading the scenes lets the table remember their positions
+    SceneTableEntry scene;
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->SetSceneTableEntry(kFabric1, scene1));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->SetSceneTableEntry(kFabric1, scene2));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, scene1);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId2, scene));
+    EXPECT_EQ(scene, scene2);
+
+    // Another table on the same storage stores scene 2 where scene 1 was and scene 3 where scene 2 was
+    TestSceneTableImpl otherSceneTable;
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.Init(*mpTestStorage, app::CodegenDataModelProvider::Instance()));
+    otherSceneTable.SetEndpoint(kTestEndpoint1);
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.RemoveSceneTableEntry(kFabric1, sceneId1));
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.RemoveSceneTableEntry(kFabric1, sceneId2));
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.SetSceneTableEntry(kFabric1, scene2));
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.SetSceneTableEntry(kFabric1, scene3));
+    otherSceneTable.Finish();
+
+    // The remembered positions no longer hold the expected scenes, which are therefore looked up again
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable->GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId2, scene));
+    EXPECT_EQ(scene, scene2);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId3, scene));
+    EXPECT_EQ(scene, scene3);
+
+    ResetSceneTable(sceneTable);
+}
+
 } // namespace TestScenes
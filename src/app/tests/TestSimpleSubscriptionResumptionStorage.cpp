@@ -266,6 +266,108 @@ TEST_F(TestSimpleSubscriptionResumptionStorage, TestSubscriptionState)
               CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
 }
 
+TEST_F(TestSimpleSubscriptionResumptionStorage, TestSubscriptionUnchangedSave)
+{
+    chip::TestPersistentStorageDelegate storage;
+    SimpleSubscriptionResumptionStorageTest subscriptionStorage;
+    EXPECT_SUCCESS(subscriptionStorage.Init(&storage));
+
+    chip::app::SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo1 = {
+        .mNodeId         = 5555,
+        .mFabricIndex    = 45,
+        .mSubscriptionId = 5,
+        .mMinInterval    = 5,
+        .mMaxInterval    = 15,
+        .mFabricFiltered = true,
+    };
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    subscriptionInfo1.mResumptionRetries = 0;
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    subscriptionInfo1.mAttributePaths.Calloc(1);
+    subscriptionInfo1.mAttributePaths[0].mEndpointId  = 11;
+    subscriptionInfo1.mAttributePaths[0].mClusterId   = 11;
+    subscriptionInfo1.mAttributePaths[0].mAttributeId = 11;
+
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo1), CHIP_NO_ERROR);
+
+    // Saving the same subscription again does not write anything
+    storage.SetRejectWrites(true);
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo1), CHIP_NO_ERROR);
+
+    // A changed subscription is written in place
+    subscriptionInfo1.mMaxInterval = 16;
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo1), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    storage.SetRejectWrites(false);
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo1), CHIP_NO_ERROR);
+
+    auto * iterator = subscriptionStorage.IterateSubscriptions();
+    EXPECT_EQ(iterator->Count(), 1u);
+    TestSubscriptionInfo subscriptionInfo;
+    EXPECT_TRUE(iterator->Next(subscriptionInfo));
+    EXPECT_EQ(subscriptionInfo, subscriptionInfo1);
+    EXPECT_FALSE(iterator->Next(subscriptionInfo));
+    iterator->Release();
+}
+
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+TEST_F(TestSimpleSubscriptionResumptionStorage, TestSubscriptionResumptionRetries)
+{
+    chip::TestPersistentStorageDelegate storage;
+    SimpleSubscriptionResumptionStorageTest subscriptionStorage;
+    EXPECT_SUCCESS(subscriptionStorage.Init(&storage));
+
+    chip::app::SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo1 = {
+        .mNodeId            = 6666,
+        .mFabricIndex       = 46,
+        .mSubscriptionId    = 6,
+        .mResumptionRetries = 0,
+        .mMinInterval       = 6,
+        .mMaxInterval       = 16,
+        .mFabricFiltered    = false,
+    };
+
+    const auto entryKey   = chip::DefaultStorageKeyAllocator::SubscriptionResumption(0);
+    const auto retriesKey = chip::DefaultStorageKeyAllocator::SubscriptionResumptionRetries(0);
+
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo1), CHIP_NO_ERROR);
+    EXPECT_TRUE(storage.HasKey(entryKey.KeyName()));
+    EXPECT_FALSE(storage.HasKey(retriesKey.KeyName()));
+
+    uint8_t entry[SimpleSubscriptionResumptionStorageTest::TestMaxSubscriptionSize()];
+    uint16_t entryLen = sizeof(entry);
+    EXPECT_SUCCESS(storage.SyncGetKeyValue(entryKey.KeyName(), entry, entryLen));
+
+    // Only the separate counter changes when the retries do
+    subscriptionInfo1.mResumptionRetries = 3;
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo1), CHIP_NO_ERROR);
+    EXPECT_TRUE(storage.HasKey(retriesKey.KeyName()));
+
+    uint8_t savedEntry[SimpleSubscriptionResumptionStorageTest::TestMaxSubscriptionSize()];
+    uint16_t savedEntryLen = sizeof(savedEntry);
+    EXPECT_SUCCESS(storage.SyncGetKeyValue(entryKey.KeyName(), savedEntry, savedEntryLen));
+    EXPECT_TRUE(chip::ByteSpan(entry, entryLen).data_equal(chip::ByteSpan(savedEntry, savedEntryLen)));
+
+    auto * iterator = subscriptionStorage.IterateSubscriptions();
+    TestSubscriptionInfo subscriptionInfo;
+    EXPECT_TRUE(iterator->Next(subscriptionInfo));
+    EXPECT_EQ(subscriptionInfo, subscriptionInfo1);
+    EXPECT_EQ(subscriptionInfo.mResumptionRetries, 3u);
+    iterator->Release();
+
+    // Resetting the retries removes the counter, and deleting the subscription removes both keys
+    subscriptionInfo1.mResumptionRetries = 0;
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo1), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasKey(retriesKey.KeyName()));
+
+    subscriptionInfo1.mResumptionRetries = 1;
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo1), CHIP_NO_ERROR);
+    EXPECT_SUCCESS(
+        subscriptionStorage.Delete(subscriptionInfo1.mNodeId, subscriptionInfo1.mFabricIndex, subscriptionInfo1.mSubscriptionId));
+    EXPECT_FALSE(storage.HasKey(entryKey.KeyName()));
+    EXPECT_FALSE(storage.HasKey(retriesKey.KeyName()));
+}
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+
 static constexpr chip::TLV::Tag kTestValue1Tag = chip::TLV::ContextTag(30);
 static constexpr chip::TLV::Tag kTestValue2Tag = chip::TLV::ContextTag(31);
 
@@ -0,0 +1,198 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/SubscriptionLivenessWheel.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <pw_unit_test/framework.h>
+#include <system/RAIIMockClock.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <memory>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+class TestEntry : public SubscriptionLivenessWheel::Entry
+{
+public:
+    TestEntry(SubscriptionLivenessWheel & wheel) : mWheel(wheel) {}
+
+    size_t mTimeoutCount = 0;
+    System::Clock::Timestamp mLastTimeout;
+    // When set, the entry re-arms itself from its timeout callback.
+    System::Clock::Timeout mRearmTimeout = System::Clock::kZero;
+
+private:
+    void OnLivenessTimeout() override
+    {
+        mTimeoutCount++;
+        mLastTimeout = System::SystemClock().GetMonotonicTimestamp();
+        if (mRearmTimeout != System::Clock::kZero)
+        {
+            EXPECT_EQ(mWheel.Arm(*this, mRearmTimeout), CHIP_NO_ERROR);
+        }
+    }
+
+    SubscriptionLivenessWheel & mWheel;
+};
+
+class TestSubscriptionLivenessWheel : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        spIOContext = new Testing::IOContext();
+        ASSERT_EQ(spIOContext->Init(), CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        spIOContext->Shutdown();
+        delete spIOContext;
+        spIOContext = nullptr;
+        Platform::MemoryShutdown();
+    }
+
+    void SetUp() override
+    {
+        // Keep the clock where it was, for the timers started before the mock clock is installed.
+        mClock.SetMonotonic(mRealClock.GetMonotonicTimestamp());
+        mWheel.Init(&spIOContext->GetSystemLayer());
+    }
+
+    void TearDown() override { mWheel.Shutdown(); }
+
+protected:
+    void Advance(System::Clock::Timeout duration) { spIOContext->DriveIOInSimulatedTime(mClock, duration); }
+
+    static Testing::IOContext * spIOContext;
+
+    System::Clock::ClockBase & mRealClock = System::SystemClock();
+    System::Clock::Internal::RAIIMockClock mClock;
+    SubscriptionLivenessWheel mWheel;
+};
+
+Testing::IOContext * TestSubscriptionLivenessWheel::spIOContext = nullptr;
+
+TEST_F(TestSubscriptionLivenessWheel, TestExpiresAfterDeadline)
+{
+    TestEntry entry(mWheel);
+    System::Clock::Timestamp deadline = mClock.GetMonotonicTimestamp() + 1000_ms32;
+
+    ASSERT_EQ(mWheel.Arm(entry, 1000_ms32), CHIP_NO_ERROR);
+    EXPECT_TRUE(entry.IsLivenessCheckArmed());
+
+    Advance(999_ms32);
+    EXPECT_EQ(entry.mTimeoutCount, 0u);
+
+    Advance(SubscriptionLivenessWheel::kTick);
+    EXPECT_EQ(entry.mTimeoutCount, 1u);
+    EXPECT_FALSE(entry.IsLivenessCheckArmed());
+    EXPECT_GE(entry.mLastTimeout, deadline);
+    EXPECT_LT(entry.mLastTimeout, deadline + SubscriptionLivenessWheel::kTick);
+}
+
+TEST_F(TestSubscriptionLivenessWheel, TestRearmPushesDeadlineBack)
+{
+    TestEntry entry(mWheel);
+
+    ASSERT_EQ(mWheel.Arm(entry, 1000_ms32), CHIP_NO_ERROR);
+    for (int i = 0; i < 5; i++)
+    {
+        Advance(600_ms32);
+        ASSERT_EQ(mWheel.Arm(entry, 1000_ms32), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(entry.mTimeoutCount, 0u);
+
+    Advance(1100_ms32);
+    EXPECT_EQ(entry.mTimeoutCount, 1u);
+}
+
+TEST_F(TestSubscriptionLivenessWheel, TestDisarm)
+{
+    TestEntry entry(mWheel);
+
+    ASSERT_EQ(mWheel.Arm(entry, 1000_ms32), CHIP_NO_ERROR);
+    SubscriptionLivenessWheel::Disarm(entry);
+    EXPECT_FALSE(entry.IsLivenessCheckArmed());
+
+    Advance(2000_ms32);
+    EXPECT_EQ(entry.mTimeoutCount, 0u);
+}
+
+TEST_F(TestSubscriptionLivenessWheel, TestManyEntriesAcrossRevolutions)
+{
+    constexpr size_t kEntryCount = 3 * SubscriptionLivenessWheel::kSlotCount;
+    constexpr uint32_t kStepMs   = 20;
+
+    // Deadlines spread over several revolutions of the wheel, several entries per tick.
+    std::unique_ptr<TestEntry> entries[kEntryCount];
+    for (size_t i = 0; i < kEntryCount; i++)
+    {
+        entries[i] = std::make_unique<TestEntry>(mWheel);
+        ASSERT_EQ(mWheel.Arm(*entries[i], System::Clock::Milliseconds32(static_cast<uint32_t>(1000 + kStepMs * i))), CHIP_NO_ERROR);
+    }
+
+    Advance(System::Clock::Milliseconds32(static_cast<uint32_t>(1000 + kStepMs * kEntryCount / 2)));
+    size_t expiredCount = 0;
+    for (auto & entry : entries)
+    {
+        expiredCount += entry->mTimeoutCount;
+    }
+    EXPECT_GE(expiredCount, kEntryCount / 2 - SubscriptionLivenessWheel::kTick.count() / kStepMs);
+    EXPECT_LE(expiredCount, kEntryCount / 2 + 1);
+
+    Advance(System::Clock::Milliseconds32(static_cast<uint32_t>(kStepMs * kEntryCount / 2)) + SubscriptionLivenessWheel::kTick);
+    for (size_t i = 0; i < kEntryCount; i++)
+    {
+        EXPECT_EQ(entries[i]->mTimeoutCount, 1u);
+        if (i > 0)
+        {
+            EXPECT_GE(entries[i]->mLastTimeout, entries[i - 1]->mLastTimeout);
+        }
+    }
+}
+
+TEST_F(TestSubscriptionLivenessWheel, TestRearmFromTimeout)
+{
+    TestEntry entry(mWheel);
+    entry.mRearmTimeout = 500_ms32;
+
+    ASSERT_EQ(mWheel.Arm(entry, 500_ms32), CHIP_NO_ERROR);
+    Advance(1600_ms32);
+    EXPECT_EQ(entry.mTimeoutCount, 3u);
+    EXPECT_TRUE(entry.IsLivenessCheckArmed());
+}
+
+TEST_F(TestSubscriptionLivenessWheel, TestShutdownDisarmsEntries)
+{
+    TestEntry entry(mWheel);
+
+    ASSERT_EQ(mWheel.Arm(entry, 1000_ms32), CHIP_NO_ERROR);
+    mWheel.Shutdown();
+    EXPECT_FALSE(entry.IsLivenessCheckArmed());
+    EXPECT_EQ(mWheel.Arm(entry, 1000_ms32), CHIP_ERROR_INCORRECT_STATE);
+}
+
+} // namespace
@@ -684,6 +684,39 @@ TEST_F(TestWriteInteraction, TestWriteRoundtrip)
     }
 }
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+// This test makes sure that a write client allowing large payloads fills its chunks past the IPv6 MTU, and refuses to send them
+// over a session that does not allow large payloads.
+TEST_F(TestWriteInteraction, TestWriteClientLargePayload)
+{
+    app::AttributePathParams attributePath(2, 3, 4);
+    TestWriteClientCallback callback;
+
+    constexpr uint8_t kTestListLength = 20;
+    static const uint8_t kItem[100]   = { 0 };
+    ByteSpan list[kTestListLength];
+    for (auto & item : list)
+    {
+        item = ByteSpan(kItem);
+    }
+
+    {
+        app::WriteClient writeClient(&GetExchangeManager(), &callback, Optional<uint16_t>::Missing());
+        EXPECT_EQ(writeClient.EncodeAttribute(attributePath, app::DataModel::List<ByteSpan>(list, kTestListLength)),
+                  CHIP_NO_ERROR);
+        EXPECT_TRUE(writeClient.IsWriteRequestChunked());
+    }
+
+    app::WriteClient writeClient(&GetExchangeManager(), &callback, Optional<uint16_t>::Missing(), false /* suppressResponse */,
+                                 true /* allowLargePayload */);
+    EXPECT_EQ(writeClient.EncodeAttribute(attributePath, app::DataModel::List<ByteSpan>(list, kTestListLength)), CHIP_NO_ERROR);
+    EXPECT_FALSE(writeClient.IsWriteRequestChunked());
+
+    EXPECT_EQ(writeClient.SendWriteRequest(GetSessionBobToAlice()), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(callback.mOnDoneCalled, 0);
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+
 // This test creates a chunked write request, we drop the second write chunk message, then write handler receives unknown
 // report message and sends out a status report with invalid action.
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -0,0 +1,571 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Scale benchmarks for the InteractionModelEngine, over the loopback transport of the messaging tests.
+ *
+ *      The server side is a synthetic data model of manufacturer-specific clusters, with a configurable number of
+ *      endpoints, clusters per endpoint and attributes per cluster. The client side, in the same process, runs:
+ *        - wildcard reads of the whole data model, one at a time;
+ *        - a number of concurrent wildcard subscriptions, reporting changes of one attribute in every cluster;
+ *        - bursts of concurrent invokes, spread over the clusters.
+ *
+ *      For each of them, the throughput, the latency of an iteration (a read, a report delivered to every
+ *      subscription, a burst) and the heap high-water mark above the idle heap, sampled while the IO loop runs, are
+ *      reported. With --format=json, each result is printed as one JSON object per line, for trending in CI.
+ *
+ *      Usage: im-benchmark [--endpoints=<n>] [--clusters=<n>] [--attributes=<n>] [--subscriptions=<n>]
+ *                          [--invokes=<n>] [--iterations=<n>] [--format=text|json]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app/AttributePathParams.h>
+#include <app/CommandSender.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/persistence/DefaultAttributePersistenceProvider.h>
+#include <app/server-cluster/AttributeListBuilder.h>
+#include <app/server-cluster/DefaultServerCluster.h>
+#include <app/server-cluster/ServerClusterInterfaceRegistry.h>
+#include <app/tests/AppTestContext.h>
+#include <data-model-providers/codedriven/CodeDrivenDataModelProvider.h>
+#include <data-model-providers/codedriven/endpoint/SpanEndpoint.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTest.h>
+#include <platform/CHIPDeviceLayer.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Manufacturer-specific clusters of the test vendor, so that no cluster logic of the stack gets involved.
+constexpr ClusterId kFirstClusterId = 0xFFF1'FC00;
+constexpr CommandId kTouchCommandId = 0xFFF1'0000;
+
+constexpr uint32_t kMaxEndpoints  = 1000;
+constexpr uint32_t kMaxClusters   = 64;  // per endpoint
+constexpr uint32_t kMaxAttributes = 256; // per cluster
+
+constexpr System::Clock::Timeout kIterationTimeout = System::Clock::Seconds16(30);
+
+enum class Format
+{
+    kText,
+    kJson,
+};
+
+struct Options
+{
+    uint32_t endpoints     = 4;
+    uint32_t clusters      = 4;  // per endpoint
+    uint32_t attributes    = 8;  // per cluster
+    uint32_t subscriptions = std::min<uint32_t>(8, CHIP_IM_MAX_NUM_SUBSCRIPTIONS);
+    uint32_t invokes       = 4; // per burst
+    uint32_t iterations    = 20;
+    Format format          = Format::kText;
+} gOptions;
+
+/// Samples the heap in use while the benchmark runs, relative to the heap in use when sampling starts.
+class HeapSampler
+{
+public:
+    void Start()
+    {
+        mBaseline  = Current();
+        mHighWater = mBaseline;
+    }
+    void Sample() { mHighWater = std::max(mHighWater, Current()); }
+    size_t HighWater() const { return mHighWater - mBaseline; }
+
+    static bool Supported()
+    {
+#if defined(__GLIBC__)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+private:
+    static size_t Current()
+    {
+        // Same measure as the Linux DiagnosticDataProvider: the bytes allocated and not freed yet.
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+        return mallinfo2().uordblks;
+#elif defined(__GLIBC__)
+        return static_cast<size_t>(mallinfo().uordblks);
+#else
+        return 0;
+#endif
+    }
+
+    size_t mBaseline  = 0;
+    size_t mHighWater = 0;
+};
+
+struct Result
+{
+    const char * name;
+    uint64_t operations = 0; // attributes read, reports received, or commands invoked
+    uint64_t failures   = 0; // operations that failed or never completed
+    Clock::duration elapsed{};
+    std::vector<Clock::duration> latencies; // per iteration
+    size_t heapHighWater = 0;
+};
+
+double Microseconds(Clock::duration duration)
+{
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) / 1e3;
+}
+
+void PrintResult(Result & result)
+{
+    std::sort(result.latencies.begin(), result.latencies.end());
+    auto percentile = [&result](size_t percent) {
+        VerifyOrReturnValue(!result.latencies.empty(), 0.0);
+        return Microseconds(result.latencies[(result.latencies.size() - 1) * percent / 100]);
+    };
+
+    double seconds         = Microseconds(result.elapsed) / 1e6;
+    double opsPerSecond    = (seconds > 0) ? static_cast<double>(result.operations) / seconds : 0;
+    unsigned iterations    = static_cast<unsigned>(result.latencies.size());
+    unsigned long long ops = static_cast<unsigned long long>(result.operations);
+
+    if (gOptions.format == Format::kJson)
+    {
+        printf("{\"name\":\"%s\",\"endpoints\":%u,\"clusters\":%u,\"attributes\":%u,\"iterations\":%u,\"operations\":%llu,"
+               "\"failures\":%llu,\"ops_per_s\":%.1f,\"p50_us\":%.1f,\"p99_us\":%.1f,\"max_us\":%.1f",
+               result.name, static_cast<unsigned>(gOptions.endpoints), static_cast<unsigned>(gOptions.clusters),
+               static_cast<unsigned>(gOptions.attributes), iterations, ops, static_cast<unsigned long long>(result.failures),
+               opsPerSecond, percentile(50), percentile(99), percentile(100));
+        if (HeapSampler::Supported())
+        {
+            printf(",\"heap_high_water_bytes\":%u", static_cast<unsigned>(result.heapHighWater));
+        }
+        printf("}\n");
+        return;
+    }
+
+    printf("%-16s %5u iterations %9llu ops %10.1f ops/s  p50 %10.1f us  p99 %10.1f us  max %10.1f us", result.name,
+           iterations, ops, opsPerSecond, percentile(50), percentile(99), percentile(100));
+    if (HeapSampler::Supported())
+    {
+        printf("  heap %8u B", static_cast<unsigned>(result.heapHighWater));
+    }
+    if (result.failures > 0)
+    {
+        printf("  %llu failed", static_cast<unsigned long long>(result.failures));
+    }
+    printf("\n");
+}
+
+/// A cluster of uint32 attributes 0 .. attributeCount - 1, and a command that increments the first one.
+class SyntheticCluster : public DefaultServerCluster
+{
+public:
+    SyntheticCluster(EndpointId endpointId, ClusterId clusterId, uint32_t attributeCount) :
+        DefaultServerCluster({ endpointId, clusterId }), mValues(attributeCount, 0)
+    {
+        for (uint32_t i = 0; i < attributeCount; i++)
+        {
+            mAttributes.emplace_back(i, BitMask<DataModel::AttributeQualityFlags>(), Access::Privilege::kView, std::nullopt);
+        }
+    }
+
+    DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                AttributeValueEncoder & encoder) override
+    {
+        switch (request.path.mAttributeId)
+        {
+        case Clusters::Globals::Attributes::ClusterRevision::Id:
+            return encoder.Encode<uint16_t>(1);
+        case Clusters::Globals::Attributes::FeatureMap::Id:
+            return encoder.Encode<uint32_t>(0);
+        default:
+            VerifyOrReturnValue(request.path.mAttributeId < mValues.size(),
+                                Protocols::InteractionModel::Status::UnsupportedAttribute);
+            return encoder.Encode(mValues[request.path.mAttributeId]);
+        }
+    }
+
+    CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<DataModel::AttributeEntry> & builder) override
+    {
+        AttributeListBuilder listBuilder(builder);
+        return listBuilder.Append(Span<const DataModel::AttributeEntry>(mAttributes.data(), mAttributes.size()), {});
+    }
+
+    std::optional<DataModel::ActionReturnStatus> InvokeCommand(const DataModel::InvokeRequest & request,
+                                                               TLV::TLVReader & input_arguments, CommandHandler * handler) override
+    {
+        VerifyOrReturnValue(request.path.mCommandId == kTouchCommandId, Protocols::InteractionModel::Status::UnsupportedCommand);
+        Touch();
+        return Protocols::InteractionModel::Status::Success;
+    }
+
+    CHIP_ERROR AcceptedCommands(const ConcreteClusterPath & path,
+                                ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> & builder) override
+    {
+        static constexpr DataModel::AcceptedCommandEntry kCommands[] = { DataModel::AcceptedCommandEntry(kTouchCommandId) };
+        return builder.ReferenceExisting(kCommands);
+    }
+
+    void Touch()
+    {
+        VerifyOrReturn(!mValues.empty());
+        mValues[0]++;
+        NotifyAttributeChanged(0);
+    }
+
+private:
+    std::vector<uint32_t> mValues;
+    std::vector<DataModel::AttributeEntry> mAttributes;
+};
+
+/// The endpoints 1 .. endpointCount of SyntheticCluster instances.
+class SyntheticDataModel
+{
+public:
+    SyntheticDataModel() : mProvider(mStorage, mAttributePersistence) {}
+
+    CHIP_ERROR Init(const Options & options)
+    {
+        ReturnErrorOnFailure(mAttributePersistence.Init(&mStorage));
+
+        // Registrations are linked into lists by the provider, so they must not move once added.
+        size_t clusterCount = static_cast<size_t>(options.endpoints) * options.clusters;
+        mClusters.reserve(clusterCount);
+        mClusterRegistrations.reserve(clusterCount);
+        mEndpoints.reserve(options.endpoints);
+        mEndpointRegistrations.reserve(options.endpoints);
+
+        for (uint32_t endpoint = 1; endpoint <= options.endpoints; endpoint++)
+        {
+            for (uint32_t cluster = 0; cluster < options.clusters; cluster++)
+            {
+                mClusters.push_back(std::make_unique<SyntheticCluster>(static_cast<EndpointId>(endpoint),
+                                                                       kFirstClusterId + cluster, options.attributes));
+                mClusterRegistrations.emplace_back(*mClusters.back());
+                ReturnErrorOnFailure(mProvider.AddCluster(mClusterRegistrations.back()));
+            }
+
+            mEndpoints.push_back(SpanEndpoint::Builder().Build());
+            mEndpointRegistrations.emplace_back(mEndpoints.back(),
+                                                DataModel::EndpointEntry{ static_cast<EndpointId>(endpoint), kInvalidEndpointId,
+                                                                          DataModel::EndpointCompositionPattern::kFullFamily });
+            ReturnErrorOnFailure(mProvider.AddEndpoint(mEndpointRegistrations.back()));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    DataModel::Provider & Provider() { return mProvider; }
+    std::vector<std::unique_ptr<SyntheticCluster>> & Clusters() { return mClusters; }
+
+private:
+    TestPersistentStorageDelegate mStorage;
+    DefaultAttributePersistenceProvider mAttributePersistence;
+    CodeDrivenDataModelProvider mProvider;
+    std::vector<std::unique_ptr<SyntheticCluster>> mClusters;
+    std::vector<ServerClusterRegistration> mClusterRegistrations;
+    std::vector<SpanEndpoint> mEndpoints;
+    std::vector<EndpointInterfaceRegistration> mEndpointRegistrations;
+};
+
+class ReadCallback : public ReadClient::Callback
+{
+public:
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        mAttributes++;
+    }
+    void OnReportEnd() override { mReports++; }
+    void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override { mEstablished = true; }
+    void OnError(CHIP_ERROR aError) override { mErrors++; }
+    void OnDone(ReadClient * apReadClient) override { mDone = true; }
+
+    uint64_t mAttributes = 0;
+    uint64_t mReports    = 0;
+    uint64_t mErrors     = 0;
+    bool mEstablished    = false;
+    bool mDone           = false;
+};
+
+class InvokeCallback : public CommandSender::ExtendableCallback
+{
+public:
+    void OnResponse(CommandSender * commandSender, const CommandSender::ResponseData & aResponseData) override
+    {
+        (aResponseData.statusIB.IsSuccess() ? mSucceeded : mFailed)++;
+    }
+    void OnError(const CommandSender * apCommandSender, const CommandSender::ErrorData & aErrorData) override { mFailed++; }
+    void OnDone(CommandSender * apCommandSender) override { mDone++; }
+
+    uint64_t mSucceeded = 0;
+    uint64_t mFailed    = 0;
+    uint64_t mDone      = 0;
+};
+
+class IMBenchmark : public Testing::AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        VerifyOrReturn(!HasFailure()); // Stop if parent had a failure.
+
+        // The report scheduler runs its timers on the DeviceLayer system layer.
+        DeviceLayer::SetSystemLayerForTesting(&GetSystemLayer());
+
+        mDataModel = std::make_unique<SyntheticDataModel>();
+        ASSERT_EQ(mDataModel->Init(gOptions), CHIP_NO_ERROR);
+        mOldProvider = InteractionModelEngine::GetInstance()->SetDataModelProvider(&mDataModel->Provider());
+        mHeap.Start();
+    }
+
+    void TearDown() override
+    {
+        DrainAndServiceIO();
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
+        mDataModel.reset();
+        DeviceLayer::SetSystemLayerForTesting(nullptr);
+        AppContext::TearDown();
+    }
+
+protected:
+    // Runs the IO loop until done() holds, sampling the heap on the way. Returns false on timeout.
+    template <typename Done>
+    bool Run(Done && done)
+    {
+        GetIOContext().DriveIOUntil(kIterationTimeout, [&] {
+            mHeap.Sample();
+            return done();
+        });
+        return done();
+    }
+
+    static AttributePathParams sWildcardPath;
+
+    std::unique_ptr<SyntheticDataModel> mDataModel;
+    DataModel::Provider * mOldProvider = nullptr;
+    HeapSampler mHeap;
+};
+
+AttributePathParams IMBenchmark::sWildcardPath;
+
+TEST_F(IMBenchmark, WildcardRead)
+{
+    Result result{ "WildcardRead" };
+
+    for (uint32_t iteration = 0; iteration < gOptions.iterations; iteration++)
+    {
+        ReadCallback callback;
+        ReadClient readClient(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback,
+                              ReadClient::InteractionType::Read);
+        ReadPrepareParams params(GetSessionBobToAlice());
+        params.mpAttributePathParamsList    = &sWildcardPath;
+        params.mAttributePathParamsListSize = 1;
+
+        auto start = Clock::now();
+        ASSERT_EQ(readClient.SendRequest(params), CHIP_NO_ERROR);
+        bool done = Run([&] { return callback.mDone; });
+        Clock::duration elapsed = Clock::now() - start;
+
+        result.elapsed += elapsed;
+        result.latencies.push_back(elapsed);
+        result.operations += callback.mAttributes;
+        result.failures += (done && callback.mErrors == 0) ? 0 : 1;
+    }
+
+    result.heapHighWater = mHeap.HighWater();
+    PrintResult(result);
+    EXPECT_EQ(result.failures, 0u);
+}
+
+TEST_F(IMBenchmark, Subscriptions)
+{
+    Result result{ "Subscriptions" };
+    size_t count = gOptions.subscriptions;
+
+    std::vector<ReadCallback> callbacks(count);
+    std::vector<std::unique_ptr<ReadClient>> readClients;
+    for (size_t i = 0; i < count; i++)
+    {
+        readClients.push_back(std::make_unique<ReadClient>(InteractionModelEngine::GetInstance(), &GetExchangeManager(),
+                                                           callbacks[i], ReadClient::InteractionType::Subscribe));
+        ReadPrepareParams params(GetSessionBobToAlice());
+        params.mpAttributePathParamsList    = &sWildcardPath;
+        params.mAttributePathParamsListSize = 1;
+        params.mMinIntervalFloorSeconds     = 0;
+        params.mMaxIntervalCeilingSeconds   = 3600;
+        params.mKeepSubscriptions           = true;
+        ASSERT_EQ(readClients.back()->SendRequest(params), CHIP_NO_ERROR);
+    }
+
+    auto allEstablished = [&] {
+        return std::all_of(callbacks.begin(), callbacks.end(), [](const ReadCallback & c) { return c.mEstablished || c.mDone; });
+    };
+    ASSERT_TRUE(Run(allEstablished));
+    size_t established = static_cast<size_t>(
+        std::count_if(callbacks.begin(), callbacks.end(), [](const ReadCallback & c) { return c.mEstablished && !c.mDone; }));
+    EXPECT_EQ(established, count);
+
+    for (uint32_t iteration = 0; iteration < gOptions.iterations; iteration++)
+    {
+        std::vector<uint64_t> reportsBefore;
+        for (const auto & callback : callbacks)
+        {
+            reportsBefore.push_back(callback.mReports);
+        }
+        auto allReported = [&] {
+            for (size_t i = 0; i < count; i++)
+            {
+                if (!callbacks[i].mDone && callbacks[i].mReports == reportsBefore[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        auto start = Clock::now();
+        for (auto & cluster : mDataModel->Clusters())
+        {
+            cluster->Touch();
+        }
+        bool done = Run(allReported);
+        Clock::duration elapsed = Clock::now() - start;
+
+        result.elapsed += elapsed;
+        result.latencies.push_back(elapsed);
+        for (size_t i = 0; i < count; i++)
+        {
+            bool reported = callbacks[i].mReports != reportsBefore[i];
+            result.operations += reported ? 1 : 0;
+            result.failures += (done && reported) ? 0 : 1;
+        }
+    }
+
+    result.heapHighWater = mHeap.HighWater();
+    PrintResult(result);
+    EXPECT_EQ(result.failures, 0u);
+
+    readClients.clear();
+}
+
+TEST_F(IMBenchmark, InvokeBurst)
+{
+    Result result{ "InvokeBurst" };
+    auto & clusters = mDataModel->Clusters();
+    size_t next     = 0;
+
+    for (uint32_t iteration = 0; iteration < gOptions.iterations; iteration++)
+    {
+        InvokeCallback callback;
+        std::vector<std::unique_ptr<CommandSender>> senders;
+
+        auto start = Clock::now();
+        for (uint32_t i = 0; i < gOptions.invokes; i++)
+        {
+            const ConcreteClusterPath & path = clusters[next++ % clusters.size()]->GetPaths()[0];
+            CommandPathParams commandPath(path.mEndpointId, 0, path.mClusterId, kTouchCommandId,
+                                          CommandPathFlags::kEndpointIdValid);
+
+            CommandSender::PrepareCommandParameters prepareParams;
+            CommandSender::FinishCommandParameters finishParams;
+            prepareParams.SetStartDataStruct(true);
+            finishParams.SetEndDataStruct(true);
+
+            senders.push_back(std::make_unique<CommandSender>(&callback, &GetExchangeManager()));
+            ASSERT_EQ(senders.back()->PrepareCommand(commandPath, prepareParams), CHIP_NO_ERROR);
+            ASSERT_EQ(senders.back()->FinishCommand(finishParams), CHIP_NO_ERROR);
+            ASSERT_EQ(senders.back()->SendCommandRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+        }
+        bool done = Run([&] { return callback.mDone == gOptions.invokes; });
+        Clock::duration elapsed = Clock::now() - start;
+
+        result.elapsed += elapsed;
+        result.latencies.push_back(elapsed);
+        result.operations += callback.mSucceeded;
+        result.failures += done ? callback.mFailed : gOptions.invokes - callback.mSucceeded;
+    }
+
+    result.heapHighWater = mHeap.HighWater();
+    PrintResult(result);
+    EXPECT_EQ(result.failures, 0u);
+}
+
+bool ParseOption(const char * arg, const char * name, uint32_t & value, uint32_t max)
+{
+    size_t length = strlen(name);
+    VerifyOrReturnValue(strncmp(arg, name, length) == 0 && arg[length] == '=', false);
+    unsigned long parsed = strtoul(arg + length + 1, nullptr, 10);
+    value                = static_cast<uint32_t>(std::min<unsigned long>(std::max<unsigned long>(parsed, 1), max));
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char * arg = argv[i];
+        if (ParseOption(arg, "--endpoints", gOptions.endpoints, kMaxEndpoints) ||
+            ParseOption(arg, "--clusters", gOptions.clusters, kMaxClusters) ||
+            ParseOption(arg, "--attributes", gOptions.attributes, kMaxAttributes) ||
+            ParseOption(arg, "--subscriptions", gOptions.subscriptions, CHIP_IM_MAX_NUM_SUBSCRIPTIONS) ||
+            // Both the client and the server exchange of each invoke come from the same exchange pool.
+            ParseOption(arg, "--invokes", gOptions.invokes, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2) ||
+            ParseOption(arg, "--iterations", gOptions.iterations, UINT32_MAX))
+        {
+            continue;
+        }
+        if (strcmp(arg, "--format=json") == 0 || strcmp(arg, "--format=text") == 0)
+        {
+            gOptions.format = (strcmp(arg, "--format=json") == 0) ? Format::kJson : Format::kText;
+            continue;
+        }
+
+        fprintf(stderr,
+                "Usage: %s [--endpoints=<n>] [--clusters=<n>] [--attributes=<n>] [--subscriptions=<n>] [--invokes=<n>]\n"
+                "          [--iterations=<n>] [--format=text|json]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    return chip::test::RunAllTests();
+}
@@ -194,6 +194,10 @@ enum class EmberAfEndpointOptions : uint8_t
 {
     isEnabled         = 0x1,
     isFlatComposition = 0x2,
+    // Only set while a batch of dynamic endpoint changes is open (see emberAfBeginDynamicEndpointChanges):
+    isEnablePending          = 0x4,  // added in the batch, enabled when it is committed
+    isChangeReportPending    = 0x8,  // enabled in the batch, its attributes are marked dirty when it is committed
+    isPartsListChangePending = 0x10, // its PartsList changed in the batch
 };
 
 /**
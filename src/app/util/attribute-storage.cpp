@@ -39,6 +39,8 @@
 #include <platform/LockTracker.h>
 #include <protocols/interaction_model/StatusCode.h>
 
+#include <algorithm>
+
 using chip::Protocols::InteractionModel::Status;
 
 // Attribute storage depends on knowing the current layout/setup of attributes
@@ -92,6 +94,10 @@ uint16_t emberEndpointCount = 0;
 /// ember metadata (e.g. changing dynamic endpoints or enabling/disabling endpoints)
 unsigned emberMetadataStructureGeneration = 0;
 
+/// Number of emberAfBeginDynamicEndpointChanges calls not committed yet. While non-zero, added dynamic endpoints are only
+/// enabled and endpoint changes are only reported once the changes are committed.
+uint16_t dynamicEndpointChangesDepth = 0;
+
 // If we have attributes that are more than 4 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -138,8 +144,103 @@ constexpr const EmberAfDeviceType fixedDeviceTypeList[]             = FIXED_DEVI
 
 // Not const, because these need to mutate.
 DataVersion fixedEndpointDataVersions[ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT];
+
+// Offset of the internally stored attributes of each fixed endpoint in attributeData.
+uint16_t fixedEndpointAttributeOffsets[FIXED_ENDPOINT_COUNT];
+
+// Offset of each generated cluster in the storage of its endpoint type, and of each generated attribute in the storage of
+// its cluster, so that attributes of fixed endpoints are addressed without walking the attributes stored before them.
+uint16_t generatedClusterStorageOffsets[MATTER_ARRAY_SIZE(generatedClusters)];
+uint16_t generatedAttributeStorageOffsets[MATTER_ARRAY_SIZE(generatedAttributes)];
+
+void computeGeneratedStorageOffsets()
+{
+    for (const EmberAfEndpointType & endpointType : generatedEmberAfEndpointTypes)
+    {
+        uint16_t clusterOffset = 0;
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType.clusterCount; clusterIndex++)
+        {
+            const EmberAfCluster * cluster                              = &endpointType.cluster[clusterIndex];
+            generatedClusterStorageOffsets[cluster - generatedClusters] = clusterOffset;
+
+            uint16_t attributeOffset = 0;
+            for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+            {
+                const EmberAfAttributeMetadata * am                        = &cluster->attributes[attrIndex];
+                generatedAttributeStorageOffsets[am - generatedAttributes] = attributeOffset;
+                if (!am->IsExternal())
+                {
+                    attributeOffset = static_cast<uint16_t>(attributeOffset + emberAfAttributeSize(am));
+                }
+            }
+
+            clusterOffset = static_cast<uint16_t>(clusterOffset + cluster->clusterSize);
+        }
+    }
+}
+
+// Location of an internally stored attribute of the fixed endpoint at index ep.
+uint8_t * fixedAttributeLocation(uint16_t ep, const EmberAfCluster * cluster, const EmberAfAttributeMetadata * am)
+{
+    return attributeData + fixedEndpointAttributeOffsets[ep] + generatedClusterStorageOffsets[cluster - generatedClusters] +
+        generatedAttributeStorageOffsets[am - generatedAttributes];
+}
 #endif // FIXED_ENDPOINT_COUNT > 0
 
+// Lookup index from endpoint id to position in emAfEndpoints, sorted by endpoint id and then by position. It covers
+// every defined endpoint, enabled or not, and is rebuilt on the first lookup after a change to the endpoint set.
+struct EndpointIndexEntry
+{
+    EndpointId endpoint;
+    uint16_t index;
+};
+EndpointIndexEntry endpointIndex[MAX_ENDPOINT_COUNT];
+uint16_t endpointIndexCount = 0;
+bool endpointIndexValid     = false;
+
+void invalidateEndpointIndex()
+{
+    endpointIndexValid = false;
+}
+
+void rebuildEndpointIndex()
+{
+    endpointIndexCount = 0;
+    for (uint16_t epi = 0; epi < emberAfEndpointCount(); epi++)
+    {
+        if (emAfEndpoints[epi].endpoint != kInvalidEndpointId)
+        {
+            endpointIndex[endpointIndexCount++] = { emAfEndpoints[epi].endpoint, epi };
+        }
+    }
+
+    std::sort(endpointIndex, endpointIndex + endpointIndexCount, [](const EndpointIndexEntry & a, const EndpointIndexEntry & b) {
+        return (a.endpoint != b.endpoint) ? (a.endpoint < b.endpoint) : (a.index < b.index);
+    });
+    endpointIndexValid = true;
+}
+
+// Returns the index entries of all the endpoints defined with the given id, in increasing emAfEndpoints position.
+Span<const EndpointIndexEntry> endpointIndexEntries(EndpointId endpoint)
+{
+    if (!endpointIndexValid)
+    {
+        rebuildEndpointIndex();
+    }
+
+    auto lessThanId = [](const EndpointIndexEntry & entry, EndpointId id) { return entry.endpoint < id; };
+
+    const EndpointIndexEntry * begin = endpointIndex;
+    const EndpointIndexEntry * end   = begin + endpointIndexCount;
+    const EndpointIndexEntry * first = std::lower_bound(begin, end, endpoint, lessThanId);
+    const EndpointIndexEntry * last  = first;
+    while (last != end && last->endpoint == endpoint)
+    {
+        last++;
+    }
+    return Span<const EndpointIndexEntry>(first, static_cast<size_t>(last - first));
+}
+
 bool emberAfIsThisDataTypeAListType(EmberAfAttributeType dataType)
 {
     return dataType == ZCL_ARRAY_ATTRIBUTE_TYPE;
@@ -152,13 +253,11 @@ uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
+    for (const auto & entry : endpointIndexEntries(endpoint))
     {
-        if (emAfEndpoints[epi].endpoint == endpoint &&
-            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled)))
+        if (!ignoreDisabledEndpoints || emAfEndpoints[entry.index].bitmask.Has(EmberAfEndpointOptions::isEnabled))
         {
-            return epi;
+            return entry.index;
         }
     }
     return kEmberInvalidEndpointIndex;
@@ -221,7 +320,10 @@ void emberAfEndpointConfigure()
     }
 #endif // ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT > 0
 
+    computeGeneratedStorageOffsets();
+
     DataVersion * currentDataVersions = fixedEndpointDataVersions;
+    uint16_t currentAttributeOffset   = 0;
     for (ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
     {
         emAfEndpoints[ep].endpoint = fixedEndpoints[ep];
@@ -231,6 +333,11 @@ void emberAfEndpointConfigure()
         emAfEndpoints[ep].dataVersions     = currentDataVersions;
         emAfEndpoints[ep].parentEndpointId = fixedParentEndpoints[ep];
 
+        // Fixed endpoints keep their attributes in attributeData, one after the other.
+        fixedEndpointAttributeOffsets[ep] = currentAttributeOffset;
+
+        currentAttributeOffset = static_cast<uint16_t>(currentAttributeOffset + emAfEndpoints[ep].endpointType->endpointSize);
+
         constexpr const DeviceTypeId kRootnodeId   = 0x0016;
         constexpr const DeviceTypeId kAggregatorId = 0x000E;
         constexpr const DeviceTypeId kBridgedNode  = 0x0013;
@@ -268,11 +375,14 @@ void emberAfEndpointConfigure()
         }
     }
 #endif
+
+    invalidateEndpointIndex();
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
 {
     emberEndpointCount = static_cast<uint16_t>(FIXED_ENDPOINT_COUNT + dynamicEndpointCount);
+    invalidateEndpointIndex();
 }
 
 uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
@@ -359,6 +469,7 @@ CHIP_ERROR emberAfSetDynamicEndpointWithEpUniqueId(uint16_t index, EndpointId id
     emAfEndpoints[index].deviceTypeList = deviceTypeList;
     emAfEndpoints[index].endpointType   = ep;
     emAfEndpoints[index].dataVersions   = dataVersionStorage.data();
+    invalidateEndpointIndex();
 #if CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
     MutableCharSpan targetSpan(emAfEndpoints[index].endpointUniqueId);
     if (CopyCharSpanToMutableCharSpan(endpointUniqueId, targetSpan) != CHIP_NO_ERROR)
@@ -389,8 +500,12 @@ CHIP_ERROR emberAfSetDynamicEndpointWithEpUniqueId(uint16_t index, EndpointId id
         }
     }
 
-    // Now enable the endpoint.
-    emberAfEndpointEnableDisable(id, true);
+    // Now enable the endpoint, unless that is left to emberAfCommitDynamicEndpointChanges.
+    emAfEndpoints[index].bitmask.Set(EmberAfEndpointOptions::isEnablePending, dynamicEndpointChangesDepth > 0);
+    if (dynamicEndpointChangesDepth == 0)
+    {
+        emberAfEndpointEnableDisable(id, true);
+    }
 
     emberMetadataStructureGeneration++;
     return CHIP_NO_ERROR;
@@ -408,12 +523,69 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index)
         ep = emAfEndpoints[index].endpoint;
         emberAfEndpointEnableDisable(ep, false);
         emAfEndpoints[index].endpoint = kInvalidEndpointId;
+        invalidateEndpointIndex();
+    }
+    else if ((index < MAX_ENDPOINT_COUNT) && (emAfEndpoints[index].endpoint != kInvalidEndpointId) &&
+             emAfEndpoints[index].bitmask.Has(EmberAfEndpointOptions::isEnablePending))
+    {
+        // Added by the current batch of changes and never enabled: there is nothing to shut down or report.
+        ep = emAfEndpoints[index].endpoint;
+        emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::isEnablePending);
+        emAfEndpoints[index].endpoint = kInvalidEndpointId;
+        invalidateEndpointIndex();
     }
 
     emberMetadataStructureGeneration++;
     return ep;
 }
 
+void emberAfBeginDynamicEndpointChanges()
+{
+    dynamicEndpointChangesDepth++;
+}
+
+void emberAfCommitDynamicEndpointChanges()
+{
+    VerifyOrReturn(dynamicEndpointChangesDepth > 0);
+    VerifyOrReturn(--dynamicEndpointChangesDepth == 0);
+
+    // Keep reports deferred while enabling the added endpoints, so that a PartsList they all change is reported once.
+    dynamicEndpointChangesDepth = 1;
+    for (uint16_t index = FIXED_ENDPOINT_COUNT; index < MAX_ENDPOINT_COUNT; index++)
+    {
+        if (emAfEndpoints[index].bitmask.Has(EmberAfEndpointOptions::isEnablePending))
+        {
+            emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::isEnablePending);
+            emberAfEndpointEnableDisable(emAfEndpoints[index].endpoint, true);
+        }
+    }
+    dynamicEndpointChangesDepth = 0;
+
+    for (uint16_t index = 0; index < MAX_ENDPOINT_COUNT; index++)
+    {
+        EmberAfDefinedEndpoint & definedEndpoint = emAfEndpoints[index];
+        const bool reportEndpoint  = definedEndpoint.bitmask.Has(EmberAfEndpointOptions::isChangeReportPending);
+        const bool reportPartsList = definedEndpoint.bitmask.Has(EmberAfEndpointOptions::isPartsListChangePending);
+        definedEndpoint.bitmask.Clear(EmberAfEndpointOptions::isChangeReportPending);
+        definedEndpoint.bitmask.Clear(EmberAfEndpointOptions::isPartsListChangePending);
+
+        if (definedEndpoint.endpoint == kInvalidEndpointId || !emberAfEndpointIndexIsEnabled(index))
+        {
+            continue;
+        }
+        if (reportEndpoint)
+        {
+            emberAfEndpointChanged(definedEndpoint.endpoint, emberAfGlobalInteractionModelAttributesChangedListener());
+        }
+        if (reportPartsList)
+        {
+            emberAfAttributeChanged(definedEndpoint.endpoint, Clusters::Descriptor::Id,
+                                    Clusters::Descriptor::Attributes::PartsList::Id,
+                                    emberAfGlobalInteractionModelAttributesChangedListener());
+        }
+    }
+}
+
 uint16_t emberAfFixedEndpointCount()
 {
     return FIXED_ENDPOINT_COUNT;
@@ -647,125 +819,103 @@ Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord,
 {
     assertChipStackLockedByCurrentThread();
 
-    uint16_t attributeOffsetIndex = 0;
-
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    uint16_t ep = findIndexFromEndpoint(attRecord->endpoint, true /* ignoreDisabledEndpoints */);
+    if (ep == kEmberInvalidEndpointIndex)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+    }
 
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
-            {
-                continue;
-            }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    // Is this a dynamic endpoint?
+    bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+
+    const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
+    for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+        if (emAfMatchCluster(cluster, attRecord))
+        { // Got the cluster
+            uint16_t attrIndex;
+            for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
             {
-                const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+                const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                if (emAfMatchAttribute(cluster, am, attRecord))
+                { // Got the attribute
+                    // If passed metadata location is not null, populate
+                    if (metadata != nullptr)
+                    {
+                        *metadata = am;
+                    }
+
                     {
-                        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != nullptr)
+                        // Dynamic endpoints are external and don't factor into storage size
+                        uint8_t * attributeLocation = nullptr;
+#if FIXED_ENDPOINT_COUNT > 0
+                        if (!isDynamicEndpoint && !am->IsExternal())
+                        {
+                            attributeLocation = fixedAttributeLocation(ep, cluster, am);
+                        }
+#endif // FIXED_ENDPOINT_COUNT > 0
+                        uint8_t *src, *dst;
+                        if (write)
+                        {
+                            src = buffer;
+                            dst = attributeLocation;
+                            if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+                            {
+                                return Status::UnsupportedAccess;
+                            }
+                        }
+                        else
+                        {
+                            if (buffer == nullptr)
                             {
-                                *metadata = am;
+                                return Status::Success;
                             }
 
+                            src = attributeLocation;
+                            dst = buffer;
+                            if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
                             {
-                                uint8_t * attributeLocation = attributeData + attributeOffsetIndex;
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == nullptr)
-                                    {
-                                        return Status::Success;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-
-                                // Is the attribute externally stored?
-                                if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
-                                {
-                                    if (write)
-                                    {
-                                        return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
-                                                                                     buffer);
-                                    }
-
-                                    if (readLength < emberAfAttributeSize(am))
-                                    {
-                                        // Prevent a potential buffer overflow
-                                        return Status::ResourceExhausted;
-                                    }
-
-                                    return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am,
-                                                                                buffer, emberAfAttributeSize(am));
-                                }
-
-                                // Internal storage is only supported for fixed endpoints
-                                if (!isDynamicEndpoint)
-                                {
-                                    return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                                }
-
-                                return Status::Failure;
+                                return Status::UnsupportedAccess;
                             }
                         }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+
+                        // Is the attribute externally stored?
+                        if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
+                        {
+                            if (write)
+                            {
+                                return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am, buffer);
+                            }
+
+                            if (readLength < emberAfAttributeSize(am))
                             {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                                // Prevent a potential buffer overflow
+                                return Status::ResourceExhausted;
                             }
+
+                            return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
+                                                                        emberAfAttributeSize(am));
                         }
-                    }
 
-                    // Attribute is not in the cluster.
-                    return Status::UnsupportedAttribute;
-                }
+                        // Internal storage is only supported for fixed endpoints
+                        if (!isDynamicEndpoint)
+                        {
+                            return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
+                        }
 
-                // Not the cluster we are looking for
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+                        return Status::Failure;
+                    }
+                }
             }
 
-            // Cluster is not in the endpoint.
-            return Status::UnsupportedCluster;
-        }
-
-        // Not the endpoint we are looking for
-        // Dynamic endpoints are external and don't factor into storage size
-        if (!isDynamicEndpoint)
-        {
-            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
+            // Attribute is not in the cluster.
+            return Status::UnsupportedAttribute;
         }
     }
-    return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+
+    // Cluster is not in the endpoint.
+    return Status::UnsupportedCluster;
 }
 
 const EmberAfEndpointType * emberAfFindEndpointType(EndpointId endpointId)
@@ -809,18 +959,13 @@ const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endp
 
 uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask)
 {
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    for (const auto & entry : endpointIndexEntries(endpoint))
     {
-        // Check the endpoint id first, because that way we avoid examining the
-        // endpoint type for endpoints that are not actually defined.
-        if (emAfEndpoints[ep].endpoint == endpoint)
+        const EmberAfEndpointType * endpointType = emAfEndpoints[entry.index].endpointType;
+        uint8_t index                            = 0xFF;
+        if (emberAfFindClusterInType(endpointType, clusterId, mask, &index) != nullptr)
         {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t index                            = 0xFF;
-            if (emberAfFindClusterInType(endpointType, clusterId, mask, &index) != nullptr)
-            {
-                return index;
-            }
+            return index;
         }
     }
     return 0xFF;
@@ -978,6 +1123,22 @@ bool emberAfEndpointIsEnabled(EndpointId endpoint)
     return emberAfEndpointIndexIsEnabled(index);
 }
 
+namespace {
+
+// Reports a change of the PartsList of the endpoint at `index`, or defers it to emberAfCommitDynamicEndpointChanges.
+void partsListChanged(EndpointId endpoint, uint16_t index)
+{
+    if ((dynamicEndpointChangesDepth > 0) && (index != kEmberInvalidEndpointIndex))
+    {
+        emAfEndpoints[index].bitmask.Set(EmberAfEndpointOptions::isPartsListChangePending);
+        return;
+    }
+    emberAfAttributeChanged(endpoint, Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id,
+                            emberAfGlobalInteractionModelAttributesChangedListener());
+}
+
+} // namespace
+
 bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
 {
     uint16_t index = findIndexFromEndpoint(endpoint, false /* ignoreDisabledEndpoints */);
@@ -1000,7 +1161,14 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
         if (enable)
         {
             initializeEndpoint(&(emAfEndpoints[index]));
-            emberAfEndpointChanged(endpoint, emberAfGlobalInteractionModelAttributesChangedListener());
+            if (dynamicEndpointChangesDepth > 0)
+            {
+                emAfEndpoints[index].bitmask.Set(EmberAfEndpointOptions::isChangeReportPending);
+            }
+            else
+            {
+                emberAfEndpointChanged(endpoint, emberAfGlobalInteractionModelAttributesChangedListener());
+            }
         }
         else
         {
@@ -1011,9 +1179,8 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
         EndpointId parentEndpointId = emberAfParentEndpointFromIndex(index);
         while (parentEndpointId != kInvalidEndpointId)
         {
-            emberAfAttributeChanged(parentEndpointId, Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id,
-                                    emberAfGlobalInteractionModelAttributesChangedListener());
             uint16_t parentIndex = emberAfIndexFromEndpoint(parentEndpointId);
+            partsListChanged(parentEndpointId, parentIndex);
             if (parentIndex == kEmberInvalidEndpointIndex)
             {
                 // Something has gone wrong.
@@ -1022,8 +1189,7 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
             parentEndpointId = emberAfParentEndpointFromIndex(parentIndex);
         }
 
-        emberAfAttributeChanged(/* endpoint = */ 0, Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id,
-                                emberAfGlobalInteractionModelAttributesChangedListener());
+        partsListChanged(/* endpoint = */ 0, emberAfIndexFromEndpoint(0));
     }
 
     emberMetadataStructureGeneration++;
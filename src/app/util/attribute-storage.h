@@ -311,6 +311,19 @@ CHIP_ERROR emberAfSetDynamicEndpointWithEpUniqueId(uint16_t index, chip::Endpoin
 
 chip::EndpointId emberAfClearDynamicEndpoint(uint16_t index);
 uint16_t emberAfGetDynamicIndexFromEndpoint(chip::EndpointId id);
+
+// Open a batch of dynamic endpoint changes, e.g. to restore the endpoints of a bridge at boot.
+//
+// Until the matching emberAfCommitDynamicEndpointChanges call:
+//   - endpoints added with emberAfSetDynamicEndpoint are defined but stay disabled; they can be cleared again, but attributes
+//     cannot be read or written through ember before the commit.
+//   - the change reports of endpoints being enabled or disabled (their attributes, and the Descriptor PartsList of their
+//     ancestors and of the root endpoint) are deferred.
+//
+// The commit enables the added endpoints after a single rebuild of the endpoint lookup index and then reports every changed
+// endpoint and PartsList once. Batches may be nested; only the outermost commit applies the changes.
+void emberAfBeginDynamicEndpointChanges();
+void emberAfCommitDynamicEndpointChanges();
 /**
  * @brief Loads attribute defaults and any non-volatile attributes stored
  *
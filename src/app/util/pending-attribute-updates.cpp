@@ -0,0 +1,140 @@
+/**
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/util/pending-attribute-updates.h>
+
+#include <app/reporting/reporting.h>
+#include <app/util/attribute-table.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/LockTracker.h>
+
+#include <cstring>
+
+using chip::Protocols::InteractionModel::Status;
+
+namespace chip {
+namespace app {
+
+PendingAttributeUpdates & PendingAttributeUpdates::Instance()
+{
+    static PendingAttributeUpdates sInstance;
+    return sInstance;
+}
+
+CHIP_ERROR PendingAttributeUpdates::QueueWrite(const ConcreteAttributePath & path, EmberAfAttributeType type, ByteSpan value)
+{
+    VerifyOrReturnError(value.size() <= kMaxValueSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Update update;
+    update.path    = path;
+    update.isWrite = true;
+    update.type    = type;
+    update.size    = static_cast<uint8_t>(value.size());
+    if (!value.empty())
+    {
+        memcpy(update.value, value.data(), value.size());
+    }
+    return Queue(update);
+}
+
+CHIP_ERROR PendingAttributeUpdates::QueueReport(const ConcreteAttributePath & path)
+{
+    Update update;
+    update.path    = path;
+    update.isWrite = false;
+    update.type    = 0;
+    update.size    = 0;
+    return Queue(update);
+}
+
+CHIP_ERROR PendingAttributeUpdates::Queue(const Update & update)
+{
+    VerifyOrReturnError(mQueue.TryPush(update), CHIP_ERROR_NO_MEMORY);
+
+    // Only the first update since the last drain schedules one; Drain clears the flag before it pops, so that an update
+    // queued meanwhile is either popped by it or schedules the next one.
+    VerifyOrReturnError(!mDrainScheduled.exchange(true, std::memory_order_seq_cst), CHIP_NO_ERROR);
+
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(DrainWork, reinterpret_cast<intptr_t>(this));
+    if (err != CHIP_NO_ERROR)
+    {
+        // The update stays queued: the next one tries scheduling the drain again.
+        mDrainScheduled.store(false, std::memory_order_seq_cst);
+        ChipLogError(DataManagement, "Unable to schedule pending attribute updates: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+    return CHIP_NO_ERROR;
+}
+
+void PendingAttributeUpdates::DrainWork(intptr_t context)
+{
+    reinterpret_cast<PendingAttributeUpdates *>(context)->Drain();
+}
+
+void PendingAttributeUpdates::Drain()
+{
+    assertChipStackLockedByCurrentThread();
+
+    mDrainScheduled.store(false, std::memory_order_seq_cst);
+
+    size_t count;
+    do
+    {
+        count = 0;
+        while (count < MATTER_ARRAY_SIZE(mBatch) && mQueue.TryPop(mBatch[count]))
+        {
+            count++;
+        }
+        Apply(count);
+    } while (count == MATTER_ARRAY_SIZE(mBatch));
+}
+
+void PendingAttributeUpdates::Apply(size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        Update & update = mBatch[i];
+
+        // A later update of the same kind to the same attribute supersedes this one.
+        bool superseded = false;
+        for (size_t j = i + 1; j < count && !superseded; j++)
+        {
+            superseded = (mBatch[j].isWrite == update.isWrite && mBatch[j].path == update.path);
+        }
+        if (superseded)
+        {
+            continue;
+        }
+
+        if (!update.isWrite)
+        {
+            MatterReportingAttributeChangeCallback(update.path);
+            continue;
+        }
+
+        Status status = emberAfWriteAttribute(update.path, EmberAfWriteDataInput(update.value, update.type));
+        if (status != Status::Success)
+        {
+            ChipLogError(DataManagement, "Pending write to " ChipLogFormatMEI "/" ChipLogFormatMEI " on endpoint %u failed: 0x%02x",
+                         ChipLogValueMEI(update.path.mClusterId), ChipLogValueMEI(update.path.mAttributeId),
+                         update.path.mEndpointId, to_underlying(status));
+        }
+    }
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,113 @@
+/**
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/util/attribute-metadata.h>
+#include <app/util/attribute-storage-null-handling.h>
+#include <app/util/odd-sized-integers.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/MpscRingBuffer.h>
+#include <lib/support/Span.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * Attribute updates posted from application threads without taking the CHIP stack lock.
+ *
+ * Application threads queue attribute writes, in the attribute store representation, or reports of changes to
+ * attributes they store themselves. The first update queued after a batch schedules work on the Matter thread, which
+ * drains every update queued by then: each attribute written several times in the batch is written once with its
+ * latest value, through emberAfWriteAttribute, and each attribute reported several times is reported once.
+ *
+ * The queue is bounded by CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATES_QUEUE_SIZE. When it is full, queueing fails with
+ * CHIP_ERROR_NO_MEMORY and the caller can fall back to taking the stack lock.
+ *
+ *      // On a sensor thread:
+ *      PendingAttributeUpdates::Instance().QueueWrite(
+ *          ConcreteAttributePath(endpoint, TemperatureMeasurement::Id, TemperatureMeasurement::Attributes::MeasuredValue::Id),
+ *          ZCL_INT16S_ATTRIBUTE_TYPE, temperature);
+ */
+class PendingAttributeUpdates
+{
+public:
+    static constexpr size_t kMaxValueSize = CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATE_MAX_VALUE_SIZE;
+
+    static PendingAttributeUpdates & Instance();
+
+    /**
+     * Queues writing value, in the attribute store representation of type, to the attribute at path. From any thread.
+     *
+     * @retval CHIP_ERROR_INVALID_ARGUMENT if value is larger than kMaxValueSize.
+     * @retval CHIP_ERROR_NO_MEMORY if the queue is full.
+     */
+    CHIP_ERROR QueueWrite(const ConcreteAttributePath & path, EmberAfAttributeType type, ByteSpan value);
+
+    /**
+     * Queues writing a numeric value to the attribute at path, as the attribute accessors do. From any thread.
+     */
+    template <typename T>
+    CHIP_ERROR QueueWrite(const ConcreteAttributePath & path, EmberAfAttributeType type, T value)
+    {
+        using Traits = NumericAttributeTraits<T>;
+        typename Traits::StorageType storageValue;
+        Traits::WorkingToStorage(value, storageValue);
+        return QueueWrite(path, type, ByteSpan(Traits::ToAttributeStoreRepresentation(storageValue), sizeof(storageValue)));
+    }
+
+    /**
+     * Queues reporting a change to the attribute at path, stored by the application, as
+     * MatterReportingAttributeChangeCallback does. From any thread.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if the queue is full.
+     */
+    CHIP_ERROR QueueReport(const ConcreteAttributePath & path);
+
+    /**
+     * Applies the queued updates. Called on the Matter thread, with the stack lock held, by the scheduled work; an
+     * application running its own loop on the Matter thread may also call it.
+     */
+    void Drain();
+
+private:
+    struct Update
+    {
+        ConcreteAttributePath path;
+        bool isWrite;
+        EmberAfAttributeType type;
+        uint8_t size;
+        uint8_t value[kMaxValueSize];
+    };
+
+    static void DrainWork(intptr_t context);
+
+    CHIP_ERROR Queue(const Update & update);
+    void Apply(size_t count);
+
+    MpscRingBuffer<Update, CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATES_QUEUE_SIZE> mQueue;
+    std::atomic<bool> mDrainScheduled{ false };
+    Update mBatch[CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATES_QUEUE_SIZE]; // Matter thread only.
+};
+
+} // namespace app
+} // namespace chip
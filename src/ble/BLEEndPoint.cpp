@@ -28,6 +28,8 @@
 #define _CHIP_BLE_BLE_H
 #include "BLEEndPoint.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <cstdint>
 #include <cstring>
 #include <utility>
@@ -112,7 +114,8 @@ CHIP_ERROR BLEEndPoint::StartConnect()
     // Zero-initialize BLE transport capabilities request.
     memset(&req, 0, sizeof(req));
 
-    req.mMtu = mBle->mPlatformDelegate->GetMTU(mConnObj);
+    // Don't report an ATT MTU whose fragments we would not accept.
+    req.mMtu = std::min(mBle->mPlatformDelegate->GetMTU(mConnObj), static_cast<uint16_t>(BLE_MAX_FRAGMENT_SIZE + 3));
 
     req.mWindowSize = BLE_MAX_RECEIVE_WINDOW_SIZE;
 
@@ -155,11 +158,15 @@ CHIP_ERROR BLEEndPoint::HandleConnectComplete()
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    mState = kState_Connected;
+    mState                      = kState_Connected;
+    mTransferStats.mConnectedAt = System::SystemClock().GetMonotonicTimestamp();
 
     // Cancel the connect timer.
     StopConnectTimer();
 
+    // Commissioning exchanges are bound by BTP round trips, so ask for a fast link while the BTP connection is open.
+    SetConnectionProfile(BleConnectionProfile::kFastTransfer);
+
     // We've successfully completed the BLE transport protocol handshake, so let the application know we're open for business.
     if (mBleTransport != nullptr)
     {
@@ -180,7 +187,8 @@ CHIP_ERROR BLEEndPoint::HandleReceiveConnectionComplete()
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     ChipLogDebugBleEndPoint(Ble, "entered HandleReceiveConnectionComplete");
-    mState = kState_Connected;
+    mState                      = kState_Connected;
+    mTransferStats.mConnectedAt = System::SystemClock().GetMonotonicTimestamp();
 
     // Cancel receive connection timer.
     StopReceiveConnectionTimer();
@@ -442,6 +450,11 @@ void BLEEndPoint::ReleaseBleConnection()
 {
     if (mConnObj != BLE_CONNECTION_UNINITIALIZED)
     {
+        if (mConnStateFlags.Has(ConnectionStateFlag::kFastConnectionProfile))
+        {
+            SetConnectionProfile(BleConnectionProfile::kDefault);
+        }
+
         if (mConnStateFlags.Has(ConnectionStateFlag::kAutoClose))
         {
             ChipLogProgress(Ble, "Auto-closing end point's BLE connection.");
@@ -458,8 +471,48 @@ void BLEEndPoint::ReleaseBleConnection()
     }
 }
 
+void BLEEndPoint::SetConnectionProfile(BleConnectionProfile profile)
+{
+    CHIP_ERROR err = mBle->SetConnectionProfile(mConnObj, profile);
+    if (err == CHIP_NO_ERROR)
+    {
+        mConnStateFlags.Set(ConnectionStateFlag::kFastConnectionProfile, profile == BleConnectionProfile::kFastTransfer);
+    }
+    else if (err != CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        ChipLogError(Ble, "Failed to set BLE connection profile %u: %" CHIP_ERROR_FORMAT, static_cast<unsigned>(profile),
+                     err.Format());
+    }
+}
+
+void BLEEndPoint::LogTransferStats() const
+{
+    if (mTransferStats.mConnectedAt == System::Clock::kZero)
+    {
+        return;
+    }
+
+    const uint32_t connectedMs =
+        static_cast<uint32_t>((System::SystemClock().GetMonotonicTimestamp() - mTransferStats.mConnectedAt).count());
+    uint32_t txBytesPerSecond = 0;
+    if (mTransferStats.mTxActiveMs > 0)
+    {
+        txBytesPerSecond = static_cast<uint32_t>(uint64_t{ mTransferStats.mTxBytes } * 1000 / mTransferStats.mTxActiveMs);
+    }
+
+    ChipLogProgress(Ble,
+                    "BTP connection of %" PRIu32 " ms: tx %" PRIu32 " msgs / %" PRIu32 " B in %" PRIu32 " fragments (%" PRIu32
+                    " B/s while sending), rx %" PRIu32 " msgs / %" PRIu32 " B in %" PRIu32 " fragments, %" PRIu32
+                    " stand-alone acks sent",
+                    connectedMs, mTransferStats.mTxMessages, mTransferStats.mTxBytes, mTransferStats.mTxFragments, txBytesPerSecond,
+                    mTransferStats.mRxMessages, mTransferStats.mRxBytes, mTransferStats.mRxFragments,
+                    mTransferStats.mStandAloneAcksSent);
+}
+
 void BLEEndPoint::Free()
 {
+    LogTransferStats();
+
     // Release BLE connection. Will close connection if AutoClose enabled for this end point. Otherwise, informs
     // application that CHIP is done with this BLE connection, and application makes decision about whether to close
     // and clean up or retain connection.
@@ -533,6 +586,9 @@ CHIP_ERROR BLEEndPoint::Init(BleLayer * bleLayer, BLE_CONNECTION_OBJECT connObj,
     mReceiveWindowMaxSize    = 0;
     mSendQueue               = nullptr;
     mAckToSend               = nullptr;
+    mFragmentsInFlight       = 0;
+    mTransferStats           = {};
+    mTxMessageStartTime      = System::Clock::kZero;
 
     ChipLogDebugBleEndPoint(Ble, "initialized local rx window, size = %u", mLocalReceiveWindowSize);
 
@@ -662,11 +718,36 @@ bool BLEEndPoint::PrepareNextFragment(PacketBufferHandle && data, bool & sentAck
     return mBtpEngine.HandleCharacteristicSend(std::move(data), sentAck);
 }
 
+bool BLEEndPoint::CanPipelineFragment() const
+{
+    // Only further fragments of the message being sent may join fragments already in flight. Stand-alone acks, handshake
+    // and subscription operations, and the first fragment of the next message still wait for every confirmation.
+    return (BLE_MAX_PIPELINED_FRAGMENTS > 1) && mFragmentsInFlight > 0 && mFragmentsInFlight < BLE_MAX_PIPELINED_FRAGMENTS &&
+        mAckToSend.IsNull() && !mConnStateFlags.Has(ConnectionStateFlag::kStandAloneAckInFlight) &&
+        mBtpEngine.TxState() == BtpEngine::kState_InProgress;
+}
+
+PacketBufferHandle BLEEndPoint::GetFragmentToSend()
+{
+#if BLE_MAX_PIPELINED_FRAGMENTS > 1
+    // The fragmenter writes the header of the next fragment over the tail of this one, so a fragment that the platform
+    // may still hold when the next one is prepared needs a buffer of its own.
+    PacketBufferHandle fragment = mBtpEngine.BorrowTxPacket();
+    return PacketBufferHandle::NewWithData(fragment->Start(), fragment->DataLength());
+#else
+    return mBtpEngine.BorrowTxPacket();
+#endif
+}
+
 CHIP_ERROR BLEEndPoint::SendNextMessage()
 {
     // Get the first queued packet to send
     PacketBufferHandle data = mSendQueue.PopHead();
 
+    mTransferStats.mTxMessages++;
+    mTransferStats.mTxBytes += static_cast<uint32_t>(data->DataLength());
+    mTxMessageStartTime = System::SystemClock().GetMonotonicTimestamp();
+
     // Hand whole message payload to the fragmenter.
     bool sentAck;
     VerifyOrReturnError(PrepareNextFragment(std::move(data), sentAck), BLE_ERROR_CHIPOBLE_PROTOCOL_ABORT);
@@ -686,7 +767,11 @@ CHIP_ERROR BLEEndPoint::SendNextMessage()
         ExitNow();
     });
      */
-    ReturnErrorOnFailure(SendCharacteristic(mBtpEngine.BorrowTxPacket()));
+    PacketBufferHandle fragment = GetFragmentToSend();
+    VerifyOrReturnError(!fragment.IsNull(), CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(SendCharacteristic(std::move(fragment)));
+    mFragmentsInFlight++;
+    mTransferStats.mTxFragments++;
 
     if (sentAck)
     {
@@ -711,7 +796,11 @@ CHIP_ERROR BLEEndPoint::ContinueMessageSend()
         return BLE_ERROR_CHIPOBLE_PROTOCOL_ABORT;
     }
 
-    ReturnErrorOnFailure(SendCharacteristic(mBtpEngine.BorrowTxPacket()));
+    PacketBufferHandle fragment = GetFragmentToSend();
+    VerifyOrReturnError(!fragment.IsNull(), CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(SendCharacteristic(std::move(fragment)));
+    mFragmentsInFlight++;
+    mTransferStats.mTxFragments++;
 
     if (sentAck)
     {
@@ -841,8 +930,16 @@ CHIP_ERROR BLEEndPoint::HandleGattSendConfirmationReceived()
 {
     ChipLogDebugBleEndPoint(Ble, "entered HandleGattSendConfirmationReceived");
 
-    // Mark outstanding GATT operation as finished.
-    mConnStateFlags.Clear(ConnectionStateFlag::kGattOperationInFlight);
+    // Mark outstanding GATT operation as finished. Confirmations of pipelined fragments arrive in the order the fragments
+    // were sent, so the operation is only finished once the last of them is confirmed.
+    if (mFragmentsInFlight > 0)
+    {
+        mFragmentsInFlight--;
+    }
+    if (mFragmentsInFlight == 0)
+    {
+        mConnStateFlags.Clear(ConnectionStateFlag::kGattOperationInFlight);
+    }
 
     // If confirmation was for outbound portion of BTP connect handshake...
     if (!mConnStateFlags.Has(ConnectionStateFlag::kCapabilitiesConfReceived))
@@ -884,6 +981,7 @@ CHIP_ERROR BLEEndPoint::DoSendStandAloneAck()
     ChipLogDebugBleEndPoint(Ble, "reset local rx window on stand-alone ack tx, size = %u", mLocalReceiveWindowSize);
 
     mConnStateFlags.Set(ConnectionStateFlag::kStandAloneAckInFlight);
+    mTransferStats.mStandAloneAcksSent++;
 
     // Start ack received timer, if it's not already running.
     return StartAckReceivedTimer();
@@ -894,10 +992,12 @@ CHIP_ERROR BLEEndPoint::DriveSending()
     ChipLogDebugBleEndPoint(Ble, "entered DriveSending");
 
     // If receiver's window is almost closed and we don't have an ack to send, OR we do have an ack to send but
-    // receiver's window is completely empty, OR another GATT operation is in flight, awaiting confirmation...
+    // receiver's window is completely empty, OR another GATT operation is in flight, awaiting confirmation, and the next
+    // fragment may not be pipelined behind it...
     if ((mRemoteReceiveWindowSize <= BTP_WINDOW_NO_ACK_SEND_THRESHOLD &&
          !mTimerStateFlags.Has(TimerStateFlag::kSendAckTimerRunning) && mAckToSend.IsNull()) ||
-        (mRemoteReceiveWindowSize == 0) || (mConnStateFlags.Has(ConnectionStateFlag::kGattOperationInFlight)))
+        (mRemoteReceiveWindowSize == 0) ||
+        (mConnStateFlags.Has(ConnectionStateFlag::kGattOperationInFlight) && !CanPipelineFragment()))
     {
 #ifdef CHIP_BLE_END_POINT_DEBUG_LOGGING_ENABLED
         if (mRemoteReceiveWindowSize <= BTP_WINDOW_NO_ACK_SEND_THRESHOLD &&
@@ -922,6 +1022,7 @@ CHIP_ERROR BLEEndPoint::DriveSending()
     }
 
     // Otherwise, let's see what we can send.
+    bool sentFragment = false;
 
     if (!mAckToSend.IsNull()) // If immediate, stand-alone ack is pending, send it.
     {
@@ -934,6 +1035,7 @@ CHIP_ERROR BLEEndPoint::DriveSending()
         {
             // Transmit first fragment of next whole message in send queue.
             ReturnErrorOnFailure(SendNextMessage());
+            sentFragment = true;
         }
         else
         {
@@ -944,6 +1046,7 @@ CHIP_ERROR BLEEndPoint::DriveSending()
     {
         // Send next fragment of message currently held by fragmenter.
         ReturnErrorOnFailure(ContinueMessageSend());
+        sentFragment = true;
     }
     else if (mBtpEngine.TxState() == BtpEngine::kState_Complete)
     {
@@ -951,6 +1054,11 @@ CHIP_ERROR BLEEndPoint::DriveSending()
         // Buffer will be freed at scope exit.
         PacketBufferHandle sentBuf = mBtpEngine.TakeTxPacket();
 
+        const uint32_t sendMs =
+            static_cast<uint32_t>((System::SystemClock().GetMonotonicTimestamp() - mTxMessageStartTime).count());
+        mTransferStats.mTxActiveMs += sendMs;
+        ChipLogDetail(Ble, "BTP sent message in %" PRIu32 " ms", sendMs);
+
         if (!mSendQueue.IsNull())
         {
             // Transmit first fragment of next whole message in send queue.
@@ -968,6 +1076,12 @@ CHIP_ERROR BLEEndPoint::DriveSending()
         }
     }
 
+    // Keep handing the platform fragments of the current message while it accepts more in flight.
+    if (sentFragment && CanPipelineFragment())
+    {
+        return DriveSending();
+    }
+
     return CHIP_NO_ERROR;
 }
 
@@ -1193,6 +1307,7 @@ CHIP_ERROR BLEEndPoint::Receive(PacketBufferHandle && data)
     mBtpEngine.LogStateDebug();
 
     SuccessOrExit(err);
+    mTransferStats.mRxFragments++;
 
     // Protocol engine accepted the fragment, so shrink local receive window counter by 1.
     mLocalReceiveWindowSize = static_cast<SequenceNumber_t>(mLocalReceiveWindowSize - 1);
@@ -1278,6 +1393,8 @@ CHIP_ERROR BLEEndPoint::Receive(PacketBufferHandle && data)
         System::PacketBufferHandle full_packet = mBtpEngine.TakeRxPacket();
 
         ChipLogDebugBleEndPoint(Ble, "reassembled whole msg, len = %u", static_cast<unsigned>(full_packet->DataLength()));
+        mTransferStats.mRxMessages++;
+        mTransferStats.mRxBytes += static_cast<uint32_t>(full_packet->DataLength());
 
         // If we have a message received callback, and end point is not closing...
         if (mBleTransport != nullptr && mState != kState_Closing)
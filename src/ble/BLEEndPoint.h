@@ -36,6 +36,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/DLLUtil.h>
+#include <system/SystemClock.h>
 #include <system/SystemLayer.h>
 #include <system/SystemPacketBuffer.h>
 
@@ -88,12 +89,27 @@ public:
     typedef void (*OnConnectionClosedFunct)(BLEEndPoint * endPoint, CHIP_ERROR err);
     OnConnectionClosedFunct OnConnectionClosed;
 
+    // Byte, fragment and message counts of the BTP connection, for throughput measurements.
+    struct TransferStats
+    {
+        uint32_t mTxMessages;                  // Messages whose transmission was started.
+        uint32_t mTxBytes;                     // Message payload bytes handed to the fragmenter.
+        uint32_t mTxFragments;                 // Data fragments sent, excluding stand-alone acks.
+        uint32_t mRxMessages;                  // Messages reassembled and passed up the stack.
+        uint32_t mRxBytes;                     // Payload bytes of the reassembled messages.
+        uint32_t mRxFragments;                 // Post-handshake fragments received, including stand-alone acks.
+        uint32_t mStandAloneAcksSent;          // Stand-alone acks sent.
+        uint32_t mTxActiveMs;                  // Time from the start of each message to the confirmation of its last fragment.
+        System::Clock::Timestamp mConnectedAt; // Time at which the BTP handshake completed.
+    };
+
     // Public functions:
     CHIP_ERROR Send(PacketBufferHandle && data);
     CHIP_ERROR Receive(PacketBufferHandle && data);
     CHIP_ERROR StartConnect();
 
     bool IsUnsubscribePending() const;
+    const TransferStats & GetTransferStats() const { return mTransferStats; }
     bool ConnectionObjectIs(BLE_CONNECTION_OBJECT connObj) { return connObj == mConnObj; }
     void Close();
     void Abort();
@@ -115,8 +131,9 @@ private:
         kCapabilitiesMsgReceived  = 0x04, // Capabilities request or response message received.
         kDidBeginSubscribe        = 0x08, // GATT subscribe request sent; must unsubscribe on close.
         kStandAloneAckInFlight    = 0x10, // Stand-alone ack in flight, awaiting GATT confirmation.
-        kGattOperationInFlight    = 0x20  // GATT write, indication, subscribe, or unsubscribe in flight,
+        kGattOperationInFlight    = 0x20, // GATT write, indication, subscribe, or unsubscribe in flight,
                                           // awaiting GATT confirmation.
+        kFastConnectionProfile    = 0x40  // BleConnectionProfile::kFastTransfer requested for the BLE connection.
     };
 
     enum class TimerStateFlag : uint8_t
@@ -151,6 +168,12 @@ private:
     SequenceNumber_t mRemoteReceiveWindowSize;
     SequenceNumber_t mReceiveWindowMaxSize;
 
+    // Number of data fragments handed to the platform whose GATT confirmation is still pending.
+    uint8_t mFragmentsInFlight;
+
+    TransferStats mTransferStats;
+    System::Clock::Timestamp mTxMessageStartTime;
+
     // Private functions:
     BLEEndPoint()  = delete;
     ~BLEEndPoint() = delete;
@@ -158,6 +181,8 @@ private:
     CHIP_ERROR Init(BleLayer * bleLayer, BLE_CONNECTION_OBJECT connObj, BleRole role, bool autoClose);
     bool IsConnected(uint8_t state) const;
     void DoClose(uint8_t flags, CHIP_ERROR err);
+    void SetConnectionProfile(BleConnectionProfile profile);
+    void LogTransferStats() const;
 
     // Transmit path:
     CHIP_ERROR DriveSending();
@@ -166,6 +191,8 @@ private:
     CHIP_ERROR SendNextMessage();
     CHIP_ERROR ContinueMessageSend();
     CHIP_ERROR DoSendStandAloneAck();
+    bool CanPipelineFragment() const;
+    PacketBufferHandle GetFragmentToSend();
     CHIP_ERROR SendCharacteristic(PacketBufferHandle && buf);
     CHIP_ERROR SendIndication(PacketBufferHandle && buf);
     CHIP_ERROR SendWrite(PacketBufferHandle && buf);
@@ -170,6 +170,52 @@
 #error "BLE_MAX_RECEIVE_WINDOW_SIZE must be greater than 2 for BLE transport protocol stability."
 #endif
 
+#if (BLE_MAX_RECEIVE_WINDOW_SIZE > 255)
+#error "BLE_MAX_RECEIVE_WINDOW_SIZE must fit in the one-byte window size field of the BTP handshake."
+#endif
+
+/**
+ *  @def BLE_MAX_FRAGMENT_SIZE
+ *
+ *  @brief
+ *    This is the largest BTP fragment, in bytes, that a BLE end point will send or accept. The fragment size of a
+ *    connection is picked by the peripheral as the ATT MTU less the 3-byte ATT header, capped to this value, and a
+ *    central reports an ATT MTU no larger than this value plus 3 in its capabilities request.
+ *
+ *    The default of 244 is the largest BTP segment of the specification, which fills an ATT MTU of 247. Platforms
+ *    whose BLE stack supports a larger ATT MTU may raise it, but only where every peer is known to accept the larger
+ *    fragments, since a peer that caps its fragment size to 244 cannot tell the peripheral so.
+ *
+ */
+#ifndef BLE_MAX_FRAGMENT_SIZE
+#define BLE_MAX_FRAGMENT_SIZE 244
+#endif
+
+#if (BLE_MAX_FRAGMENT_SIZE < 20)
+#error "BLE_MAX_FRAGMENT_SIZE must allow at least the fragment size of the minimum ATT MTU of 23."
+#endif
+
+/**
+ *  @def BLE_MAX_PIPELINED_FRAGMENTS
+ *
+ *  @brief
+ *    This is the number of BTP data fragments a BLE end point may hand to the platform before the GATT confirmation
+ *    for the first of them is received. The remote receive window still bounds the number of unacknowledged fragments.
+ *
+ *    The default of 1 waits for the confirmation of every GATT write or indication before the next fragment is sent.
+ *    Platforms whose BLE stack queues GATT operations, or sends writes without response, may raise it so that several
+ *    fragments go out in the same connection event. Each pipelined fragment is copied into its own packet buffer, and
+ *    the platform must report confirmations in the order the fragments were sent. Stand-alone acks are never pipelined.
+ *
+ */
+#ifndef BLE_MAX_PIPELINED_FRAGMENTS
+#define BLE_MAX_PIPELINED_FRAGMENTS 1
+#endif
+
+#if (BLE_MAX_PIPELINED_FRAGMENTS < 1)
+#error "BLE_MAX_PIPELINED_FRAGMENTS must be at least 1."
+#endif
+
 /**
  *  @def BLE_CONFIG_ERROR_MIN
  *
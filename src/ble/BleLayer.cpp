@@ -319,6 +319,14 @@ void BleLayer::CloseAllBleConnections()
     }
 }
 
+CHIP_ERROR BleLayer::SetConnectionProfile(BLE_CONNECTION_OBJECT connObj, BleConnectionProfile profile)
+{
+    VerifyOrReturnError(mState == kState_Initialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(connObj != BLE_CONNECTION_UNINITIALIZED, CHIP_ERROR_INVALID_ARGUMENT);
+
+    return mPlatformDelegate->SetConnectionProfile(connObj, profile);
+}
+
 void BleLayer::CloseBleConnection(BLE_CONNECTION_OBJECT connObj)
 {
     // Close and free all BLE endpoints.
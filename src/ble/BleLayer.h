@@ -286,6 +286,16 @@ public:
     void CloseAllBleConnections();
     void CloseBleConnection(BLE_CONNECTION_OBJECT connObj);
 
+    /**
+     * Ask the platform to apply the given set of connection parameters to a BLE connection.
+     *
+     * End points in the central role request BleConnectionProfile::kFastTransfer once their BTP connection is open, and
+     * BleConnectionProfile::kDefault when they hand a BLE connection they did not close back to the application.
+     *
+     * @retval CHIP_ERROR_NOT_IMPLEMENTED if the platform cannot change connection parameters.
+     */
+    CHIP_ERROR SetConnectionProfile(BLE_CONNECTION_OBJECT connObj, BleConnectionProfile profile);
+
     /**< Platform interface functions:
 
      *   Calling conventions:
@@ -40,6 +40,13 @@ namespace Ble {
 
 using ::chip::System::PacketBufferHandle;
 
+// Sets of connection parameters that BleLayer may ask the platform to apply to a BLE connection.
+enum class BleConnectionProfile : uint8_t
+{
+    kDefault,      // The platform's default parameters, suited to a link that is idle most of the time.
+    kFastTransfer, // A short connection interval, and the LE 2M PHY where available, while a BTP connection is open.
+};
+
 // Platform-agnostic BLE interface
 class DLL_EXPORT BlePlatformDelegate
 {
@@ -69,6 +76,15 @@ public:
     // Send GATT characteristic write request
     virtual CHIP_ERROR SendWriteRequest(BLE_CONNECTION_OBJECT connObj, const ChipBleUUID * svcId, const ChipBleUUID * charId,
                                         PacketBufferHandle pBuf) = 0;
+
+    // Following APIs are optional:
+
+    // Ask the BLE stack to apply the given set of connection parameters to the specified BLE connection. The parameters
+    // actually used remain up to the stack and the peer. Platforms that cannot change them keep this implementation.
+    virtual CHIP_ERROR SetConnectionProfile(BLE_CONNECTION_OBJECT connObj, BleConnectionProfile profile)
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
 };
 
 } /* namespace Ble */
@@ -39,6 +39,7 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <system/SystemPacketBuffer.h>
 
+#include "BleConfig.h"
 #include "BleError.h"
 
 // Define below to enable extremely verbose BLE-specific debug logging.
@@ -66,8 +67,8 @@ static inline bool DidReceiveData(BitFlags<BtpEngine::HeaderFlags> rx_flags)
                            BtpEngine::HeaderFlags::kEndMessage);
 }
 
-const uint16_t BtpEngine::sDefaultFragmentSize = 20;  // 23-byte minimum ATT_MTU - 3 bytes for ATT operation header
-const uint16_t BtpEngine::sMaxFragmentSize     = 244; // Maximum size of BTP segment
+const uint16_t BtpEngine::sDefaultFragmentSize = 20;                    // 23-byte minimum ATT_MTU - 3 bytes for ATT operation header
+const uint16_t BtpEngine::sMaxFragmentSize     = BLE_MAX_FRAGMENT_SIZE; // Maximum size of BTP segment
 
 CHIP_ERROR BtpEngine::Init(void * an_app_state, bool expect_first_ack)
 {
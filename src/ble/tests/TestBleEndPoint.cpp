@@ -152,17 +152,25 @@ protected:
         mPendingConnObj = connObj;
         return CHIP_NO_ERROR;
     }
+    CHIP_ERROR SetConnectionProfile(BLE_CONNECTION_OBJECT, BleConnectionProfile profile) override
+    {
+        mLastConnectionProfile = profile;
+        mConnectionProfileCalls++;
+        return CHIP_NO_ERROR;
+    }
     CHIP_ERROR mLastConnectErr = CHIP_NO_ERROR;
     CHIP_ERROR mLastCloseErr   = CHIP_NO_ERROR;
     void ResetCounters()
     {
-        mConnectCompleteCalls  = 0;
-        mConnectionClosedCalls = 0;
-        mLastEndPoint          = nullptr;
-        mLastWriteBuf          = nullptr;
-        mPendingConnObj        = BLE_CONNECTION_UNINITIALIZED;
-        mLastConnectErr        = CHIP_NO_ERROR;
-        mLastCloseErr          = CHIP_NO_ERROR;
+        mConnectCompleteCalls   = 0;
+        mConnectionClosedCalls  = 0;
+        mLastEndPoint           = nullptr;
+        mLastWriteBuf           = nullptr;
+        mPendingConnObj         = BLE_CONNECTION_UNINITIALIZED;
+        mLastConnectErr         = CHIP_NO_ERROR;
+        mLastCloseErr           = CHIP_NO_ERROR;
+        mLastConnectionProfile  = BleConnectionProfile::kDefault;
+        mConnectionProfileCalls = 0;
     }
 
     // Fixture state
@@ -172,6 +180,9 @@ protected:
     BLE_CONNECTION_OBJECT mPendingConnObj = BLE_CONNECTION_UNINITIALIZED; // last connObj used in a platform callback
     int mConnectCompleteCalls             = 0;
     int mConnectionClosedCalls            = 0;
+
+    BleConnectionProfile mLastConnectionProfile = BleConnectionProfile::kDefault; // last profile requested from the platform
+    int mConnectionProfileCalls                 = 0;
 };
 
 /* ==================== Test Cases ==================== */
@@ -205,6 +216,27 @@ TEST_F(TestBleEndPoint, HandleConnectCompleteTriggersCallback)
     ep->Abort();
 }
 
+// Verify a central asks for a fast connection once its BTP connection is open
+TEST_F(TestBleEndPoint, ConnectCompleteRequestsFastConnectionProfile)
+{
+    BLEEndPoint * ep = CreateCentralEndPoint();
+    ASSERT_NE(ep, nullptr);
+    EXPECT_EQ(ep->StartConnect(), CHIP_NO_ERROR);
+    EXPECT_EQ(mConnectionProfileCalls, 0);
+    ep->Abort();
+
+    ep = CreateCentralEndPoint();
+    ASSERT_NE(ep, nullptr);
+    ASSERT_EQ(CompleteCentralHandshake(ep), CHIP_NO_ERROR);
+    EXPECT_EQ(mConnectionProfileCalls, 1);
+    EXPECT_EQ(mLastConnectionProfile, BleConnectionProfile::kFastTransfer);
+
+    // Releasing the connection restores the default profile.
+    ep->Abort();
+    EXPECT_EQ(mConnectionProfileCalls, 2);
+    EXPECT_EQ(mLastConnectionProfile, BleConnectionProfile::kDefault);
+}
+
 // Ensure connection closure invokes proper cleanup callback
 TEST_F(TestBleEndPoint, CloseFiresConnectionClosedCallback)
 {
@@ -215,5 +247,36 @@ TEST_F(TestBleEndPoint, CloseFiresConnectionClosedCallback)
     EXPECT_EQ(mConnectionClosedCalls, 1);
 }
 
+// Verify transfer statistics count the messages and fragments sent
+TEST_F(TestBleEndPoint, SendUpdatesTransferStats)
+{
+    BLEEndPoint * ep = CreateCentralEndPoint();
+    ASSERT_NE(ep, nullptr);
+    ASSERT_EQ(CompleteCentralHandshake(ep), CHIP_NO_ERROR);
+    EXPECT_EQ(ep->GetTransferStats().mTxMessages, 0u);
+
+    // Two fragments' worth of payload needs a third fragment for the BTP headers.
+    constexpr size_t kMessageLength = 2 * kBleTestFragmentSize;
+    System::PacketBufferHandle msg  = System::PacketBufferHandle::New(kMessageLength);
+    ASSERT_FALSE(msg.IsNull());
+    msg->SetDataLength(kMessageLength);
+    EXPECT_EQ(ep->Send(std::move(msg)), CHIP_NO_ERROR);
+
+    // Each write confirmation lets the next fragment go out, and the last one completes the message.
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_TRUE(mBleLayer.HandleWriteConfirmation(mPendingConnObj, &CHIP_BLE_SVC_ID, &CHIP_BLE_CHAR_1_UUID));
+    }
+
+    const BLEEndPoint::TransferStats & stats = ep->GetTransferStats();
+    EXPECT_EQ(stats.mTxMessages, 1u);
+    EXPECT_EQ(stats.mTxBytes, static_cast<uint32_t>(kMessageLength));
+    EXPECT_EQ(stats.mTxFragments, 3u);
+    EXPECT_EQ(stats.mStandAloneAcksSent, 0u);
+    EXPECT_NE(stats.mConnectedAt, System::Clock::kZero);
+
+    ep->Abort();
+}
+
 } // namespace Ble
 } // namespace chip
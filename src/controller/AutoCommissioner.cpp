@@ -746,12 +746,19 @@ Optional<System::Clock::Timeout> AutoCommissioner::GetCommandTimeout(DeviceProxy
 CHIP_ERROR AutoCommissioner::NOCChainGenerated(ByteSpan noc, ByteSpan icac, ByteSpan rcac, IdentityProtectionKeySpan ipk,
                                                NodeId adminSubject)
 {
+    if (!mNOCertBuffer || !mICACertBuffer)
+    {
+        mNOCertBuffer.Alloc(Credentials::kMaxCHIPCertLength);
+        mICACertBuffer.Alloc(Credentials::kMaxCHIPCertLength);
+        VerifyOrReturnError(mNOCertBuffer && mICACertBuffer, CHIP_ERROR_NO_MEMORY);
+    }
+
     // Reuse ICA Cert buffer for temporary store Root Cert.
-    MutableByteSpan rootCert = MutableByteSpan(mICACertBuffer);
+    MutableByteSpan rootCert = mICACertBuffer.Span();
     ReturnErrorOnFailure(Credentials::ConvertX509CertToChipCert(rcac, rootCert));
     mParams.SetRootCert(rootCert);
 
-    MutableByteSpan noCert = MutableByteSpan(mNOCertBuffer);
+    MutableByteSpan noCert = mNOCertBuffer.Span();
     ReturnErrorOnFailure(Credentials::ConvertX509CertToChipCert(noc, noCert));
     mParams.SetNoc(noCert);
 
@@ -762,7 +769,7 @@ CHIP_ERROR AutoCommissioner::NOCChainGenerated(ByteSpan noc, ByteSpan icac, Byte
     // Trusted root cert has been sent, so we can re-use the icac buffer for the icac.
     if (!icac.empty())
     {
-        MutableByteSpan icaCert = MutableByteSpan(mICACertBuffer);
+        MutableByteSpan icaCert = mICACertBuffer.Span();
         ReturnErrorOnFailure(Credentials::ConvertX509CertToChipCert(icac, icaCert));
         mParams.SetIcac(icaCert);
     }
@@ -782,6 +789,9 @@ void AutoCommissioner::CleanupCommissioning()
     ResetNetworkAttemptType();
     mPAI.Free();
     mDAC.Free();
+    mNOCertBuffer.Free();
+    mICACertBuffer.Free();
+    mAttestationElements.Free();
     mCommissioneeDeviceProxy = nullptr;
     mOperationalDeviceProxy  = OperationalDeviceProxy();
     mDeviceCommissioningInfo = ReadCommissioningInfo();
@@ -941,15 +951,15 @@ CHIP_ERROR AutoCommissioner::CommissioningStepFinished(CHIP_ERROR err, Commissio
         case CommissioningStage::kSendAttestationRequest: {
             auto & elements  = report.Get<AttestationResponse>().attestationElements;
             auto & signature = report.Get<AttestationResponse>().signature;
-            if (elements.size() > sizeof(mAttestationElements))
+            if (elements.size() > Credentials::kMaxRspLen)
             {
                 ChipLogError(Controller, "AutoCommissioner attestationElements buffer size %u larger than cache size %u",
-                             static_cast<unsigned>(elements.size()), static_cast<unsigned>(sizeof(mAttestationElements)));
+                             static_cast<unsigned>(elements.size()), static_cast<unsigned>(Credentials::kMaxRspLen));
                 return CHIP_ERROR_MESSAGE_TOO_LONG;
             }
-            memcpy(mAttestationElements, elements.data(), elements.size());
-            mAttestationElementsLen = static_cast<uint16_t>(elements.size());
-            mParams.SetAttestationElements(ByteSpan(mAttestationElements, elements.size()));
+            mAttestationElements.CopyFromSpan(elements);
+            VerifyOrReturnError(mAttestationElements.AllocatedSize() == elements.size(), CHIP_ERROR_NO_MEMORY);
+            mParams.SetAttestationElements(ByteSpan(mAttestationElements.Span()));
             ChipLogDetail(Controller, "AutoCommissioner setting attestationElements buffer size %u/%u",
                           static_cast<unsigned>(elements.size()),
                           static_cast<unsigned>(mParams.GetAttestationElements().Value().size()));
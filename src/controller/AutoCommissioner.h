@@ -190,11 +190,12 @@ private:
 
     uint8_t mAttestationNonce[kAttestationNonceLength];
     uint8_t mCSRNonce[kCSRNonceLength];
-    uint8_t mNOCertBuffer[Credentials::kMaxCHIPCertLength];
-    uint8_t mICACertBuffer[Credentials::kMaxCHIPCertLength];
+    // The operational certificates and the attestation elements are only held while a device is being commissioned, so
+    // that a process running a commissioner per fabric does not keep ~2.5 KB of idle buffers in each of them.
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mNOCertBuffer;
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mICACertBuffer;
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mAttestationElements;
 
-    uint16_t mAttestationElementsLen = 0;
-    uint8_t mAttestationElements[Credentials::kMaxRspLen];
     uint16_t mAttestationSignatureLen = 0;
     uint8_t mAttestationSignature[Crypto::kMax_ECDSA_Signature_Length];
 };
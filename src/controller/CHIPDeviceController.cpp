@@ -2328,19 +2328,9 @@ void DeviceCommissioner::ContinueReadingCommissioningInfo(const CommissioningPar
     // The use of an immediately-invoked lambda is convenient for control flow.
     ReadInteractionBuilder builder(mReadCommissioningInfoProgress);
     [&]() -> void {
-        // General Commissioning
-        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::GeneralCommissioning::Id,
-                                                Clusters::GeneralCommissioning::Attributes::SupportsConcurrentConnection::Id));
-        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::GeneralCommissioning::Id,
-                                                Clusters::GeneralCommissioning::Attributes::Breadcrumb::Id));
-        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::GeneralCommissioning::Id,
-                                                Clusters::GeneralCommissioning::Attributes::BasicCommissioningInfo::Id));
-        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::GeneralCommissioning::Id,
-                                                Clusters::GeneralCommissioning::Attributes::RegulatoryConfig::Id));
-        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::GeneralCommissioning::Id,
-                                                Clusters::GeneralCommissioning::Attributes::LocationCapability::Id));
-        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::GeneralCommissioning::Id,
-                                                Clusters::GeneralCommissioning::Attributes::IsCommissioningWithoutPower::Id));
+        // General Commissioning: all attributes.  Most of them are needed and the others are small, so reading the
+        // whole cluster with one path costs less than the extra read interaction that separate paths would need.
+        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::GeneralCommissioning::Id));
 
         // Basic Information: VID and PID for device attestation purposes
         VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::BasicInformation::Id,
@@ -2373,22 +2363,13 @@ void DeviceCommissioner::ContinueReadingCommissioningInfo(const CommissioningPar
                                                     Clusters::OperationalCredentials::Attributes::Fabrics::Id));
         }
 
-        // ICD Management
+        // ICD Management: all attributes, for the same reason as General Commissioning.  Without the FeatureMap,
+        // ParseICDInfo treats the device as not being an ICD and ignores the other attributes, so skip the cluster
+        // altogether when ICD registration is ignored.
         if (params.GetICDRegistrationStrategy() != ICDRegistrationStrategy::kIgnore)
         {
-            VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::IcdManagement::Id,
-                                                    Clusters::IcdManagement::Attributes::FeatureMap::Id));
-        }
-        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::IcdManagement::Id,
-                                                Clusters::IcdManagement::Attributes::UserActiveModeTriggerHint::Id));
-        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::IcdManagement::Id,
-                                                Clusters::IcdManagement::Attributes::UserActiveModeTriggerInstruction::Id));
-        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::IcdManagement::Id,
-                                                Clusters::IcdManagement::Attributes::IdleModeDuration::Id));
-        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::IcdManagement::Id,
-                                                Clusters::IcdManagement::Attributes::ActiveModeDuration::Id));
-        VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::IcdManagement::Id,
-                                                Clusters::IcdManagement::Attributes::ActiveModeThreshold::Id));
+            VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::IcdManagement::Id));
+        }
 
         // Extra paths requested via CommissioningParameters
         for (auto const & path : params.GetExtraReadPaths())
@@ -0,0 +1,197 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningPipeline.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Controller {
+
+CHIP_ERROR CommissioningPipeline::Init(Span<DeviceCommissioner * const> commissioners, Delegate & delegate, size_t maxConcurrent)
+{
+    VerifyOrReturnError(mLanes.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!commissioners.empty() && maxConcurrent > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (DeviceCommissioner * commissioner : commissioners)
+    {
+        VerifyOrReturnError(commissioner != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    for (DeviceCommissioner * commissioner : commissioners)
+    {
+        mLanes.push_back(std::make_unique<Lane>(*this, *commissioner));
+        commissioner->RegisterPairingDelegate(mLanes.back().get());
+    }
+    mDelegate      = &delegate;
+    mMaxConcurrent = std::min(maxConcurrent, mLanes.size());
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningPipeline::Shutdown()
+{
+    if (mStartScheduled)
+    {
+        DeviceLayer::SystemLayer().CancelTimer(StartQueuedJobs, this);
+        mStartScheduled = false;
+    }
+
+    for (auto & lane : mLanes)
+    {
+        lane->GetCommissioner().RegisterPairingDelegate(lane->GetPreviousDelegate());
+        lane->Stop();
+    }
+    mLanes.clear();
+    mJobs.clear();
+    mActiveCount = 0;
+    mDelegate    = nullptr;
+}
+
+CHIP_ERROR CommissioningPipeline::Enqueue(NodeId nodeId, const char * setUpCode, const CommissioningParameters & params,
+                                          DiscoveryType discoveryType)
+{
+    VerifyOrReturnError(!mLanes.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(nodeId != kUndefinedNodeId && setUpCode != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mJobs.push_back(Job{ nodeId, setUpCode, params, discoveryType });
+    ScheduleQueuedJobs();
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningPipeline::ScheduleQueuedJobs()
+{
+    VerifyOrReturn(!mStartScheduled && !mJobs.empty() && mActiveCount < mMaxConcurrent);
+
+    // Devices are started from the event loop rather than from the callbacks of the commissioner that just finished
+    // one, since that commissioner is still cleaning up after it.
+    CHIP_ERROR err = DeviceLayer::SystemLayer().ScheduleWork(StartQueuedJobs, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Unable to schedule queued commissioning: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mStartScheduled = true;
+}
+
+void CommissioningPipeline::StartQueuedJobs(System::Layer * layer, void * context)
+{
+    static_cast<CommissioningPipeline *>(context)->StartQueuedJobs();
+}
+
+void CommissioningPipeline::StartQueuedJobs()
+{
+    mStartScheduled = false;
+
+    for (auto & lane : mLanes)
+    {
+        if (mJobs.empty() || mActiveCount >= mMaxConcurrent)
+        {
+            break;
+        }
+        if (lane->IsBusy())
+        {
+            continue;
+        }
+
+        Job job = std::move(mJobs.front());
+        mJobs.pop_front();
+
+        CHIP_ERROR err = lane->Start(job);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Unable to start commissioning node 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(job.nodeId), err.Format());
+            mDelegate->OnDeviceCommissioned(job.nodeId, err);
+            // The delegate may have shut the pipeline down.
+            VerifyOrReturn(!mLanes.empty());
+            continue;
+        }
+        mActiveCount++;
+    }
+
+    if (mJobs.empty() && mActiveCount == 0)
+    {
+        mDelegate->OnPipelineIdle();
+        return;
+    }
+    // Commissioners that failed to start a device get the next one.
+    ScheduleQueuedJobs();
+}
+
+void CommissioningPipeline::OnLaneFinished(NodeId nodeId, CHIP_ERROR error)
+{
+    mActiveCount--;
+    mDelegate->OnDeviceCommissioned(nodeId, error);
+    VerifyOrReturn(!mLanes.empty());
+
+    if (mJobs.empty() && mActiveCount == 0)
+    {
+        mDelegate->OnPipelineIdle();
+        return;
+    }
+    ScheduleQueuedJobs();
+}
+
+CHIP_ERROR CommissioningPipeline::Lane::Start(Job & job)
+{
+    mNodeId        = job.nodeId;
+    CHIP_ERROR err = mCommissioner.PairDevice(job.nodeId, job.setUpCode.c_str(), job.params, job.discoveryType);
+    if (err != CHIP_NO_ERROR)
+    {
+        mNodeId = kUndefinedNodeId;
+    }
+    return err;
+}
+
+void CommissioningPipeline::Lane::Stop()
+{
+    VerifyOrReturn(IsBusy());
+
+    NodeId nodeId = mNodeId;
+    mNodeId       = kUndefinedNodeId;
+    LogErrorOnFailure(mCommissioner.StopPairing(nodeId));
+}
+
+void CommissioningPipeline::Lane::OnPairingComplete(CHIP_ERROR error)
+{
+    // On success, the commissioning goes on and ends with OnCommissioningComplete.
+    VerifyOrReturn(error != CHIP_NO_ERROR);
+    Finish(error);
+}
+
+void CommissioningPipeline::Lane::OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error)
+{
+    VerifyOrReturn(deviceId == mNodeId);
+    Finish(error);
+}
+
+void CommissioningPipeline::Lane::Finish(CHIP_ERROR error)
+{
+    VerifyOrReturn(IsBusy());
+
+    NodeId nodeId = mNodeId;
+    mNodeId       = kUndefinedNodeId;
+    mPipeline.OnLaneFinished(nodeId, error);
+}
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningDelegate.h>
+#include <controller/DevicePairingDelegate.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/Span.h>
+#include <system/SystemLayer.h>
+
+#include <deque>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace chip {
+namespace Controller {
+
+/*
+ * Commissions a queue of devices, several at a time.
+ *
+ * A DeviceCommissioner only commissions one device at a time, so the pipeline drives a set of commissioners, all
+ * initialized by the application on the same fabric, and starts the next queued device on whichever is free.  At
+ * most the given concurrency limit of devices are commissioned at once.
+ *
+ * To keep the crypto-heavy stages of all these devices off the Matter thread, give every commissioner the verifier
+ * and credentials delegate of a CommissioningWorkerPool.
+ *
+ * Usage:
+ *
+ *      DeviceCommissioner * commissioners[4] = { ... };
+ *      CommissioningPipeline pipeline;
+ *      pipeline.Init(Span<DeviceCommissioner * const>(commissioners), delegate, 2);
+ *      pipeline.Enqueue(nodeId, "MT:...", params);
+ *      ...
+ *      pipeline.Shutdown();            // before the commissioners are shut down
+ *
+ * The pipeline registers itself as the DevicePairingDelegate of every commissioner until it is shut down.  All
+ * methods must be called on the Matter thread.  Commissioning over BLE is limited to one device at a time by the BLE
+ * layer, so the pipeline is meant for devices that are already on the network.
+ */
+class CommissioningPipeline
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        // Called once for every enqueued device, when its commissioning succeeded or failed.
+        virtual void OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error) = 0;
+
+        // Called when the queue is empty and no device is being commissioned anymore.
+        virtual void OnPipelineIdle() {}
+    };
+
+    CommissioningPipeline() = default;
+    ~CommissioningPipeline() { Shutdown(); }
+
+    CommissioningPipeline(const CommissioningPipeline &)             = delete;
+    CommissioningPipeline & operator=(const CommissioningPipeline &) = delete;
+
+    /*
+     * @param maxConcurrent  The number of devices commissioned at once, at most one per commissioner.
+     */
+    CHIP_ERROR Init(Span<DeviceCommissioner * const> commissioners, Delegate & delegate, size_t maxConcurrent = SIZE_MAX);
+
+    /*
+     * Stop the devices being commissioned, drop the queued ones without reporting them, and give the commissioners
+     * back their previous DevicePairingDelegate.
+     */
+    void Shutdown();
+
+    /*
+     * Queue a device to be commissioned with DeviceCommissioner::PairDevice.  The buffers referenced by params must
+     * stay valid until the device is reported to the Delegate.
+     */
+    CHIP_ERROR Enqueue(NodeId nodeId, const char * setUpCode, const CommissioningParameters & params,
+                       DiscoveryType discoveryType = DiscoveryType::kAll);
+
+    size_t GetQueuedCount() const { return mJobs.size(); }
+    size_t GetActiveCount() const { return mActiveCount; }
+
+private:
+    struct Job
+    {
+        NodeId nodeId;
+        std::string setUpCode;
+        CommissioningParameters params;
+        DiscoveryType discoveryType;
+    };
+
+    class Lane : public DevicePairingDelegate
+    {
+    public:
+        Lane(CommissioningPipeline & pipeline, DeviceCommissioner & commissioner) :
+            mPipeline(pipeline), mCommissioner(commissioner), mPreviousDelegate(commissioner.GetPairingDelegate())
+        {}
+
+        CHIP_ERROR Start(Job & job);
+        void Stop();
+
+        bool IsBusy() const { return mNodeId != kUndefinedNodeId; }
+        DeviceCommissioner & GetCommissioner() { return mCommissioner; }
+        DevicePairingDelegate * GetPreviousDelegate() const { return mPreviousDelegate; }
+
+        void OnPairingComplete(CHIP_ERROR error) override;
+        void OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error) override;
+
+    private:
+        void Finish(CHIP_ERROR error);
+
+        CommissioningPipeline & mPipeline;
+        DeviceCommissioner & mCommissioner;
+        DevicePairingDelegate * const mPreviousDelegate;
+        // The device being commissioned, if any.
+        NodeId mNodeId = kUndefinedNodeId;
+    };
+
+    static void StartQueuedJobs(System::Layer * layer, void * context);
+
+    void ScheduleQueuedJobs();
+    void StartQueuedJobs();
+    void OnLaneFinished(NodeId nodeId, CHIP_ERROR error);
+
+    std::vector<std::unique_ptr<Lane>> mLanes;
+    std::deque<Job> mJobs;
+    Delegate * mDelegate  = nullptr;
+    size_t mMaxConcurrent = 0;
+    size_t mActiveCount   = 0;
+    bool mStartScheduled  = false;
+};
+
+} // namespace Controller
+} // namespace chip
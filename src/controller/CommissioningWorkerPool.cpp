@@ -0,0 +1,380 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningWorkerPool.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/PlatformManager.h>
+
+#include <functional>
+#include <string.h>
+
+namespace chip {
+namespace Controller {
+
+using namespace Credentials;
+
+namespace {
+
+using Bytes = std::vector<uint8_t>;
+
+Bytes Copy(const ByteSpan & span)
+{
+    return Bytes(span.data(), span.data() + span.size());
+}
+
+ByteSpan AsSpan(const Bytes & bytes)
+{
+    return ByteSpan(bytes.data(), bytes.size());
+}
+
+} // namespace
+
+class CommissioningWorkerPool::AttestationTask : public CommissioningWorkerPool::Task
+{
+public:
+    AttestationTask(DeviceAttestationVerifier & verifier, const DeviceAttestationVerifier::AttestationInfo & info,
+                    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> * onCompletion) :
+        mVerifier(verifier),
+        mAttestationElements(Copy(info.attestationElementsBuffer)), mAttestationChallenge(Copy(info.attestationChallengeBuffer)),
+        mAttestationSignature(Copy(info.attestationSignatureBuffer)), mPai(Copy(info.paiDerBuffer)), mDac(Copy(info.dacDerBuffer)),
+        mAttestationNonce(Copy(info.attestationNonceBuffer)), mVendorId(info.vendorId), mProductId(info.productId),
+        mOnCompletion(onCompletion)
+    {}
+
+    void Run() override
+    {
+        Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> onVerified(OnVerified, this);
+        mVerifier.VerifyAttestationInformation(GetInfo(), &onVerified);
+    }
+
+    void Complete() override { mOnCompletion->mCall(mOnCompletion->mContext, GetInfo(), mResult); }
+
+private:
+    static void OnVerified(void * context, const DeviceAttestationVerifier::AttestationInfo & info,
+                           AttestationVerificationResult result)
+    {
+        static_cast<AttestationTask *>(context)->mResult = result;
+    }
+
+    DeviceAttestationVerifier::AttestationInfo GetInfo() const
+    {
+        return DeviceAttestationVerifier::AttestationInfo(AsSpan(mAttestationElements), AsSpan(mAttestationChallenge),
+                                                          AsSpan(mAttestationSignature), AsSpan(mPai), AsSpan(mDac),
+                                                          AsSpan(mAttestationNonce), mVendorId, mProductId);
+    }
+
+    DeviceAttestationVerifier & mVerifier;
+    const Bytes mAttestationElements;
+    const Bytes mAttestationChallenge;
+    const Bytes mAttestationSignature;
+    const Bytes mPai;
+    const Bytes mDac;
+    const Bytes mAttestationNonce;
+    const VendorId mVendorId;
+    const uint16_t mProductId;
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> * const mOnCompletion;
+    AttestationVerificationResult mResult = AttestationVerificationResult::kInternalError;
+};
+
+class CommissioningWorkerPool::NOCChainTask : public CommissioningWorkerPool::Task
+{
+public:
+    NOCChainTask(OperationalCredentialsDelegate & delegate, std::mutex & delegateMutex, const ByteSpan & csrElements,
+                 const ByteSpan & csrNonce, const ByteSpan & attestationSignature, const ByteSpan & attestationChallenge,
+                 const ByteSpan & dac, const ByteSpan & pai, const Optional<NodeId> & nodeId, const Optional<FabricId> & fabricId,
+                 Callback::Callback<OnNOCChainGeneration> * onCompletion) :
+        mDelegate(delegate),
+        mDelegateMutex(delegateMutex), mCsrElements(Copy(csrElements)), mCsrNonce(Copy(csrNonce)),
+        mAttestationSignature(Copy(attestationSignature)), mAttestationChallenge(Copy(attestationChallenge)), mDac(Copy(dac)),
+        mPai(Copy(pai)), mNodeId(nodeId), mFabricId(fabricId), mOnCompletion(onCompletion)
+    {}
+
+    void Run() override
+    {
+        Callback::Callback<OnNOCChainGeneration> onGenerated(OnGenerated, this);
+
+        std::lock_guard<std::mutex> lock(mDelegateMutex);
+        if (mNodeId.HasValue())
+        {
+            mDelegate.SetNodeIdForNextNOCRequest(mNodeId.Value());
+        }
+        if (mFabricId.HasValue())
+        {
+            mDelegate.SetFabricIdForNextNOCRequest(mFabricId.Value());
+        }
+        CHIP_ERROR err = mDelegate.GenerateNOCChain(AsSpan(mCsrElements), AsSpan(mCsrNonce), AsSpan(mAttestationSignature),
+                                                    AsSpan(mAttestationChallenge), AsSpan(mDac), AsSpan(mPai), &onGenerated);
+        if (err != CHIP_NO_ERROR)
+        {
+            mStatus = err;
+        }
+    }
+
+    void Complete() override
+    {
+        Optional<Crypto::IdentityProtectionKeySpan> ipk;
+        if (mHasIpk)
+        {
+            ipk.SetValue(Crypto::IdentityProtectionKeySpan(mIpk));
+        }
+        mOnCompletion->mCall(mOnCompletion->mContext, mStatus, AsSpan(mNoc), AsSpan(mIcac), AsSpan(mRcac), ipk, mAdminSubject);
+    }
+
+private:
+    static void OnGenerated(void * context, CHIP_ERROR status, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                            Optional<Crypto::IdentityProtectionKeySpan> ipk, Optional<NodeId> adminSubject)
+    {
+        auto * task         = static_cast<NOCChainTask *>(context);
+        task->mStatus       = status;
+        task->mNoc          = Copy(noc);
+        task->mIcac         = Copy(icac);
+        task->mRcac         = Copy(rcac);
+        task->mHasIpk       = ipk.HasValue();
+        task->mAdminSubject = adminSubject;
+        if (ipk.HasValue())
+        {
+            memcpy(task->mIpk, ipk.Value().data(), sizeof(task->mIpk));
+        }
+    }
+
+    OperationalCredentialsDelegate & mDelegate;
+    std::mutex & mDelegateMutex;
+    const Bytes mCsrElements;
+    const Bytes mCsrNonce;
+    const Bytes mAttestationSignature;
+    const Bytes mAttestationChallenge;
+    const Bytes mDac;
+    const Bytes mPai;
+    const Optional<NodeId> mNodeId;
+    const Optional<FabricId> mFabricId;
+    Callback::Callback<OnNOCChainGeneration> * const mOnCompletion;
+
+    // The NOC chain, copied out of the wrapped delegate's buffers.  The status stays an error if the task never ran.
+    CHIP_ERROR mStatus = CHIP_ERROR_INCORRECT_STATE;
+    Bytes mNoc;
+    Bytes mIcac;
+    Bytes mRcac;
+    uint8_t mIpk[Crypto::CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES] = {};
+    bool mHasIpk                                                = false;
+    Optional<NodeId> mAdminSubject;
+};
+
+CHIP_ERROR CommissioningWorkerPool::Init(size_t workerCount, DeviceAttestationVerifier & verifier,
+                                         OperationalCredentialsDelegate & credentialsDelegate)
+{
+    VerifyOrReturnError(mWorkers.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(workerCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mWrappedVerifier            = &verifier;
+    mWrappedCredentialsDelegate = &credentialsDelegate;
+    mStopping                   = false;
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        mWorkers.emplace_back(Run, std::ref(*this));
+    }
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningWorkerPool::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mWorkAvailable.notify_all();
+    for (auto & worker : mWorkers)
+    {
+        worker.join();
+    }
+    mWorkers.clear();
+
+    // Anything the workers ran but the event loop has not gotten to yet.
+    CompleteTasks();
+}
+
+void CommissioningWorkerPool::Start(std::unique_ptr<Task> && task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mWorkers.empty() && !mStopping)
+        {
+            mTasks.push_back(std::move(task));
+        }
+    }
+    if (task)
+    {
+        // Not running: the caller still gets its callback, with the error set up by the task.
+        task->Complete();
+        return;
+    }
+    mWorkAvailable.notify_one();
+}
+
+void CommissioningWorkerPool::Run(CommissioningWorkerPool & pool)
+{
+    std::unique_lock<std::mutex> lock(pool.mMutex);
+    while (true)
+    {
+        pool.mWorkAvailable.wait(lock, [&] { return pool.mStopping || !pool.mTasks.empty(); });
+        if (pool.mTasks.empty())
+        {
+            // Only get here when stopping, and every task has run.
+            return;
+        }
+
+        auto task = std::move(pool.mTasks.front());
+        pool.mTasks.pop_front();
+
+        lock.unlock();
+        task->Run();
+        pool.PostCompleted(std::move(task));
+        lock.lock();
+    }
+}
+
+void CommissioningWorkerPool::PostCompleted(std::unique_ptr<Task> && task)
+{
+    std::lock_guard<std::mutex> lock(mCompletedMutex);
+    mCompleted.push_back(std::move(task));
+    if (mCompletionScheduled)
+    {
+        return;
+    }
+
+    // If this fails, the task stays queued until the next one gets through, or Shutdown.
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(CompleteTasks, reinterpret_cast<intptr_t>(this));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Unable to schedule completion of commissioning tasks: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mCompletionScheduled = true;
+}
+
+void CommissioningWorkerPool::CompleteTasks(intptr_t arg)
+{
+    reinterpret_cast<CommissioningWorkerPool *>(arg)->CompleteTasks();
+}
+
+void CommissioningWorkerPool::CompleteTasks()
+{
+    std::deque<std::unique_ptr<Task>> completed;
+    {
+        std::lock_guard<std::mutex> lock(mCompletedMutex);
+        completed.swap(mCompleted);
+        mCompletionScheduled = false;
+    }
+
+    for (auto & task : completed)
+    {
+        task->Complete();
+    }
+}
+
+void CommissioningWorkerPool::Verifier::VerifyAttestationInformation(
+    const AttestationInfo & info, Callback::Callback<OnAttestationInformationVerification> * onCompletion)
+{
+    VerifyOrReturn(onCompletion != nullptr);
+    VerifyOrReturn(mPool.mWrappedVerifier != nullptr,
+                   onCompletion->mCall(onCompletion->mContext, info, AttestationVerificationResult::kInternalError));
+
+    // The buffers behind info only live until this returns, so the task copies them.
+    mPool.Start(std::make_unique<AttestationTask>(*mPool.mWrappedVerifier, info, onCompletion));
+}
+
+AttestationVerificationResult CommissioningWorkerPool::Verifier::ValidateCertificationDeclarationSignature(
+    const ByteSpan & cmsEnvelopeBuffer, ByteSpan & certDeclBuffer)
+{
+    VerifyOrReturnValue(mPool.mWrappedVerifier != nullptr, AttestationVerificationResult::kInternalError);
+    return mPool.mWrappedVerifier->ValidateCertificationDeclarationSignature(cmsEnvelopeBuffer, certDeclBuffer);
+}
+
+AttestationVerificationResult
+CommissioningWorkerPool::Verifier::ValidateCertificateDeclarationPayload(const ByteSpan & certDeclBuffer,
+                                                                         const ByteSpan & firmwareInfo,
+                                                                         const DeviceInfoForAttestation & deviceInfo)
+{
+    VerifyOrReturnValue(mPool.mWrappedVerifier != nullptr, AttestationVerificationResult::kInternalError);
+    return mPool.mWrappedVerifier->ValidateCertificateDeclarationPayload(certDeclBuffer, firmwareInfo, deviceInfo);
+}
+
+CHIP_ERROR CommissioningWorkerPool::Verifier::VerifyNodeOperationalCSRInformation(const ByteSpan & nocsrElementsBuffer,
+                                                                                  const ByteSpan & attestationChallengeBuffer,
+                                                                                  const ByteSpan & attestationSignatureBuffer,
+                                                                                  const Crypto::P256PublicKey & dacPublicKey,
+                                                                                  const ByteSpan & csrNonce)
+{
+    VerifyOrReturnError(mPool.mWrappedVerifier != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mPool.mWrappedVerifier->VerifyNodeOperationalCSRInformation(nocsrElementsBuffer, attestationChallengeBuffer,
+                                                                       attestationSignatureBuffer, dacPublicKey, csrNonce);
+}
+
+void CommissioningWorkerPool::Verifier::CheckForRevokedDACChain(
+    const AttestationInfo & info, Callback::Callback<OnAttestationInformationVerification> * onCompletion)
+{
+    VerifyOrReturn(onCompletion != nullptr);
+    VerifyOrReturn(mPool.mWrappedVerifier != nullptr,
+                   onCompletion->mCall(onCompletion->mContext, info, AttestationVerificationResult::kInternalError));
+
+    // Revocation checks are already asynchronous when they need to be, so they are not moved to the workers.
+    mPool.mWrappedVerifier->CheckForRevokedDACChain(info, onCompletion);
+}
+
+WellKnownKeysTrustStore * CommissioningWorkerPool::Verifier::GetCertificationDeclarationTrustStore()
+{
+    return (mPool.mWrappedVerifier != nullptr) ? mPool.mWrappedVerifier->GetCertificationDeclarationTrustStore() : nullptr;
+}
+
+CHIP_ERROR CommissioningWorkerPool::Verifier::SetRevocationDelegate(DeviceAttestationRevocationDelegate * revocationDelegate)
+{
+    VerifyOrReturnError(mPool.mWrappedVerifier != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mPool.mWrappedVerifier->SetRevocationDelegate(revocationDelegate);
+}
+
+CHIP_ERROR CommissioningWorkerPool::CredentialsDelegate::GenerateNOCChain(const ByteSpan & csrElements, const ByteSpan & csrNonce,
+                                                                         const ByteSpan & attestationSignature,
+                                                                         const ByteSpan & attestationChallenge,
+                                                                         const ByteSpan & DAC, const ByteSpan & PAI,
+                                                                         Callback::Callback<OnNOCChainGeneration> * onCompletion)
+{
+    VerifyOrReturnError(onCompletion != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mPool.mWrappedCredentialsDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // The buffers passed in only live until this returns, so the task copies them.
+    auto task = std::make_unique<NOCChainTask>(*mPool.mWrappedCredentialsDelegate, mPool.mCredentialsMutex, csrElements, csrNonce,
+                                               attestationSignature, attestationChallenge, DAC, PAI, mNextNodeId, mNextFabricId,
+                                               onCompletion);
+    mNextNodeId.ClearValue();
+    mNextFabricId.ClearValue();
+
+    mPool.Start(std::move(task));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CommissioningWorkerPool::CredentialsDelegate::ObtainCsrNonce(MutableByteSpan & csrNonce)
+{
+    VerifyOrReturnError(mPool.mWrappedCredentialsDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    std::lock_guard<std::mutex> lock(mPool.mCredentialsMutex);
+    return mPool.mWrappedCredentialsDelegate->ObtainCsrNonce(csrNonce);
+}
+
+} // namespace Controller
+} // namespace chip
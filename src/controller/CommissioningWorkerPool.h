@@ -0,0 +1,168 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <controller/OperationalCredentialsDelegate.h>
+#include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <lib/core/CHIPError.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace chip {
+namespace Controller {
+
+/*
+ * Runs the crypto-heavy commissioning stages, device attestation verification and NOC chain generation, on a fixed
+ * set of worker threads, so that commissioning many devices at once (see CommissioningPipeline) does not serialize
+ * them on the Matter thread.
+ *
+ * The pool wraps an existing DeviceAttestationVerifier and OperationalCredentialsDelegate, and hands out a verifier
+ * and a delegate to give to every DeviceCommissioner instead.  Their results are reported back on the Matter thread.
+ *
+ * Usage:
+ *
+ *      CommissioningWorkerPool pool;
+ *      pool.Init(4, dacVerifier, opCredsIssuer);
+ *      commissioner.SetDeviceAttestationVerifier(pool.GetDeviceAttestationVerifier());
+ *      // and CommissionerInitParams::operationalCredentialsDelegate = pool.GetOperationalCredentialsDelegate()
+ *      ...
+ *      pool.Shutdown();                // on the Matter thread, before the commissioners are shut down
+ *
+ * Attestation is verified for several devices in parallel, so the wrapped verifier and its trust stores must be
+ * thread-safe, which is the case for the DefaultDACVerifier.  NOC chains are generated one at a time, since issuers
+ * such as the ExampleOperationalCredentialsIssuer keep state between requests.  Both wrapped objects must call their
+ * completion callback before returning.  The crypto backend must be thread-safe, which is the case on Linux and Darwin.
+ */
+class CommissioningWorkerPool
+{
+public:
+    CommissioningWorkerPool() : mVerifier(*this), mCredentialsDelegate(*this) {}
+    ~CommissioningWorkerPool() { Shutdown(); }
+
+    CommissioningWorkerPool(const CommissioningWorkerPool &)             = delete;
+    CommissioningWorkerPool & operator=(const CommissioningWorkerPool &) = delete;
+
+    CHIP_ERROR Init(size_t workerCount, Credentials::DeviceAttestationVerifier & verifier,
+                    OperationalCredentialsDelegate & credentialsDelegate);
+
+    /*
+     * Run and complete every task started so far, then stop the workers.  Must be called on the Matter thread.
+     * Tasks started afterwards complete with an error.
+     */
+    void Shutdown();
+
+    Credentials::DeviceAttestationVerifier * GetDeviceAttestationVerifier() { return &mVerifier; }
+    OperationalCredentialsDelegate * GetOperationalCredentialsDelegate() { return &mCredentialsDelegate; }
+
+private:
+    class Task
+    {
+    public:
+        virtual ~Task() = default;
+
+        // Called on a worker thread.
+        virtual void Run() = 0;
+        // Called on the Matter thread, after Run, or instead of it when the task could not be started.
+        virtual void Complete() = 0;
+    };
+
+    class AttestationTask;
+    class NOCChainTask;
+
+    class Verifier : public Credentials::DeviceAttestationVerifier
+    {
+    public:
+        explicit Verifier(CommissioningWorkerPool & pool) : mPool(pool) {}
+
+        void VerifyAttestationInformation(const AttestationInfo & info,
+                                          Callback::Callback<OnAttestationInformationVerification> * onCompletion) override;
+        Credentials::AttestationVerificationResult
+        ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer, ByteSpan & certDeclBuffer) override;
+        Credentials::AttestationVerificationResult
+        ValidateCertificateDeclarationPayload(const ByteSpan & certDeclBuffer, const ByteSpan & firmwareInfo,
+                                              const Credentials::DeviceInfoForAttestation & deviceInfo) override;
+        CHIP_ERROR VerifyNodeOperationalCSRInformation(const ByteSpan & nocsrElementsBuffer,
+                                                       const ByteSpan & attestationChallengeBuffer,
+                                                       const ByteSpan & attestationSignatureBuffer,
+                                                       const Crypto::P256PublicKey & dacPublicKey,
+                                                       const ByteSpan & csrNonce) override;
+        void CheckForRevokedDACChain(const AttestationInfo & info,
+                                     Callback::Callback<OnAttestationInformationVerification> * onCompletion) override;
+        Credentials::WellKnownKeysTrustStore * GetCertificationDeclarationTrustStore() override;
+        CHIP_ERROR SetRevocationDelegate(Credentials::DeviceAttestationRevocationDelegate * revocationDelegate) override;
+
+    private:
+        CommissioningWorkerPool & mPool;
+    };
+
+    class CredentialsDelegate : public OperationalCredentialsDelegate
+    {
+    public:
+        explicit CredentialsDelegate(CommissioningWorkerPool & pool) : mPool(pool) {}
+
+        CHIP_ERROR GenerateNOCChain(const ByteSpan & csrElements, const ByteSpan & csrNonce, const ByteSpan & attestationSignature,
+                                    const ByteSpan & attestationChallenge, const ByteSpan & DAC, const ByteSpan & PAI,
+                                    Callback::Callback<OnNOCChainGeneration> * onCompletion) override;
+        void SetNodeIdForNextNOCRequest(NodeId nodeId) override { mNextNodeId.SetValue(nodeId); }
+        void SetFabricIdForNextNOCRequest(FabricId fabricId) override { mNextFabricId.SetValue(fabricId); }
+        CHIP_ERROR ObtainCsrNonce(MutableByteSpan & csrNonce) override;
+
+    private:
+        CommissioningWorkerPool & mPool;
+        // Hints for the next request, given to the wrapped delegate right before that request runs.
+        Optional<NodeId> mNextNodeId;
+        Optional<FabricId> mNextFabricId;
+    };
+
+    static void Run(CommissioningWorkerPool & pool);
+    static void CompleteTasks(intptr_t arg);
+
+    void Start(std::unique_ptr<Task> && task);
+    void PostCompleted(std::unique_ptr<Task> && task);
+    void CompleteTasks();
+
+    Verifier mVerifier;
+    CredentialsDelegate mCredentialsDelegate;
+    Credentials::DeviceAttestationVerifier * mWrappedVerifier    = nullptr;
+    OperationalCredentialsDelegate * mWrappedCredentialsDelegate = nullptr;
+
+    std::vector<std::thread> mWorkers;
+
+    // Tasks waiting for a worker.
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailable;
+    std::deque<std::unique_ptr<Task>> mTasks;
+    bool mStopping = false;
+
+    // Serializes calls into the wrapped OperationalCredentialsDelegate.
+    std::mutex mCredentialsMutex;
+
+    // Tasks waiting to be completed on the Matter thread, in the order they ran.
+    std::mutex mCompletedMutex;
+    std::deque<std::unique_ptr<Task>> mCompleted;
+    bool mCompletionScheduled = false;
+};
+
+} // namespace Controller
+} // namespace chip
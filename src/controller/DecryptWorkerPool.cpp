@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/DecryptWorkerPool.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/PlatformManager.h>
+
+#include <functional>
+
+namespace chip {
+namespace Controller {
+
+CHIP_ERROR DecryptWorkerPool::Init(size_t workerCount)
+{
+    VerifyOrReturnError(mWorkers.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(workerCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        auto worker     = std::make_unique<Worker>();
+        worker->mThread = std::thread(Run, std::ref(*this), std::ref(*worker));
+        mWorkers.push_back(std::move(worker));
+    }
+    return CHIP_NO_ERROR;
+}
+
+void DecryptWorkerPool::Shutdown()
+{
+    for (auto & worker : mWorkers)
+    {
+        {
+            std::lock_guard<std::mutex> lock(worker->mMutex);
+            worker->mStopping = true;
+        }
+        worker->mWorkAvailable.notify_one();
+    }
+    for (auto & worker : mWorkers)
+    {
+        worker->mThread.join();
+    }
+    mWorkers.clear();
+
+    // Anything the workers decrypted but the event loop has not gotten to yet.
+    CompleteDecrypted();
+}
+
+CHIP_ERROR DecryptWorkerPool::Offload(Platform::UniquePtr<PendingSecureUnicastMessage> && message)
+{
+    VerifyOrReturnError(!mWorkers.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    Worker & worker = *mWorkers[std::hash<const void *>()(message->GetSessionKey()) % mWorkers.size()];
+    {
+        std::lock_guard<std::mutex> lock(worker.mMutex);
+        VerifyOrReturnError(!worker.mStopping, CHIP_ERROR_INCORRECT_STATE);
+        worker.mMessages.push_back(std::move(message));
+    }
+    worker.mWorkAvailable.notify_one();
+    return CHIP_NO_ERROR;
+}
+
+void DecryptWorkerPool::Run(DecryptWorkerPool & pool, Worker & worker)
+{
+    std::unique_lock<std::mutex> lock(worker.mMutex);
+    while (true)
+    {
+        worker.mWorkAvailable.wait(lock, [&] { return worker.mStopping || !worker.mMessages.empty(); });
+        if (worker.mMessages.empty())
+        {
+            // Only get here when stopping, and everything has been decrypted.
+            return;
+        }
+
+        auto message = std::move(worker.mMessages.front());
+        worker.mMessages.pop_front();
+
+        lock.unlock();
+        message->Decrypt();
+        pool.PostDecrypted(std::move(message));
+        lock.lock();
+    }
+}
+
+void DecryptWorkerPool::PostDecrypted(Platform::UniquePtr<PendingSecureUnicastMessage> && message)
+{
+    std::lock_guard<std::mutex> lock(mDecryptedMutex);
+    mDecrypted.push_back(std::move(message));
+    if (mCompletionScheduled)
+    {
+        return;
+    }
+
+    // If this fails, the message stays queued until the next one gets through, or Shutdown.
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(CompleteDecrypted, reinterpret_cast<intptr_t>(this));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Unable to schedule completion of decrypted messages: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mCompletionScheduled = true;
+}
+
+void DecryptWorkerPool::CompleteDecrypted(intptr_t arg)
+{
+    reinterpret_cast<DecryptWorkerPool *>(arg)->CompleteDecrypted();
+}
+
+void DecryptWorkerPool::CompleteDecrypted()
+{
+    std::deque<Platform::UniquePtr<PendingSecureUnicastMessage>> decrypted;
+    {
+        std::lock_guard<std::mutex> lock(mDecryptedMutex);
+        decrypted.swap(mDecrypted);
+        mCompletionScheduled = false;
+    }
+
+    for (auto & message : decrypted)
+    {
+        PendingSecureUnicastMessage::Complete(std::move(message));
+    }
+}
+
+} // namespace Controller
+} // namespace chip
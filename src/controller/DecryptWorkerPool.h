@@ -0,0 +1,99 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <transport/SessionManager.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace chip {
+namespace Controller {
+
+/*
+ * A SecureMessageDecryptOffload that decrypts secure unicast messages on a fixed set of worker threads and hands
+ * them back to the SessionManager on the Matter thread.
+ *
+ * Every session is pinned to one worker, so its messages are decrypted and dispatched in order, while messages for
+ * different sessions are decrypted in parallel.  Header parsing, message counter checks and dispatch to the
+ * ExchangeManager still happen on the Matter thread.
+ *
+ * Usage:
+ *
+ *      DecryptWorkerPool pool;
+ *      pool.Init(4);
+ *      sessionManager.SetDecryptOffload(&pool);
+ *      ...
+ *      sessionManager.SetDecryptOffload(nullptr);
+ *      pool.Shutdown();                // on the Matter thread, before the SessionManager is shut down
+ *
+ * The session keystore and crypto backend must be thread-safe, and packet buffers must be heap allocated, which is
+ * the case on Linux and Darwin.  The pool must outlive the event loop.
+ */
+class DecryptWorkerPool : public SecureMessageDecryptOffload
+{
+public:
+    DecryptWorkerPool() = default;
+    ~DecryptWorkerPool() override { Shutdown(); }
+
+    DecryptWorkerPool(const DecryptWorkerPool &)             = delete;
+    DecryptWorkerPool & operator=(const DecryptWorkerPool &) = delete;
+
+    CHIP_ERROR Init(size_t workerCount);
+
+    /*
+     * Decrypt and complete every message offloaded so far, then stop the workers.  Must be called on the Matter
+     * thread.  Offload fails afterwards.
+     */
+    void Shutdown();
+
+    CHIP_ERROR Offload(Platform::UniquePtr<PendingSecureUnicastMessage> && message) override;
+
+private:
+    struct Worker
+    {
+        std::thread mThread;
+        std::mutex mMutex;
+        std::condition_variable mWorkAvailable;
+        std::deque<Platform::UniquePtr<PendingSecureUnicastMessage>> mMessages;
+        bool mStopping = false;
+    };
+
+    static void Run(DecryptWorkerPool & pool, Worker & worker);
+    static void CompleteDecrypted(intptr_t arg);
+
+    void PostDecrypted(Platform::UniquePtr<PendingSecureUnicastMessage> && message);
+    void CompleteDecrypted();
+
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+
+    // Decrypted messages waiting to be completed on the Matter thread, in the order they were decrypted.
+    std::mutex mDecryptedMutex;
+    std::deque<Platform::UniquePtr<PendingSecureUnicastMessage>> mDecrypted;
+    bool mCompletionScheduled = false;
+};
+
+} // namespace Controller
+} // namespace chip
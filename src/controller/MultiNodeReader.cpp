@@ -0,0 +1,268 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/MultiNodeReader.h>
+
+#include <app/InteractionModelEngine.h>
+#include <app/ReadPrepareParams.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Controller {
+
+CHIP_ERROR MultiNodeReader::Init(DeviceController & controller, Span<const app::AttributePathParams> paths, Delegate & delegate,
+                                 const Options & options)
+{
+    VerifyOrReturnError(mController == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!paths.empty() && options.maxConcurrent > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mPaths.assign(paths.begin(), paths.end());
+    mController = &controller;
+    mDelegate   = &delegate;
+    mOptions    = options;
+    return CHIP_NO_ERROR;
+}
+
+void MultiNodeReader::Shutdown()
+{
+    if (mStartScheduled)
+    {
+        DeviceLayer::SystemLayer().CancelTimer(StartQueuedNodes, this);
+        mStartScheduled = false;
+    }
+
+    // Destroying the nodes cancels their pending session setup and ends their read or subscription.
+    mNodes.clear();
+    mQueue.clear();
+    mPaths.clear();
+    mActiveCount = 0;
+    mController  = nullptr;
+    mDelegate    = nullptr;
+}
+
+CHIP_ERROR MultiNodeReader::Enqueue(NodeId nodeId)
+{
+    VerifyOrReturnError(mController != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(nodeId != kUndefinedNodeId, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mQueue.push_back(nodeId);
+    ScheduleQueuedNodes();
+    return CHIP_NO_ERROR;
+}
+
+MultiNodeReader::LatencyStats MultiNodeReader::GetLatencyStats() const
+{
+    LatencyStats stats;
+    VerifyOrReturnValue(!mLatencies.empty(), stats);
+
+    std::vector<System::Clock::Milliseconds32> sorted(mLatencies);
+    std::sort(sorted.begin(), sorted.end());
+
+    // Nearest-rank percentiles.
+    auto percentile = [&sorted](size_t percent) { return sorted[(sorted.size() * percent + 99) / 100 - 1]; };
+
+    stats.count = sorted.size();
+    stats.p50   = percentile(50);
+    stats.p90   = percentile(90);
+    stats.p99   = percentile(99);
+    stats.max   = sorted.back();
+    return stats;
+}
+
+void MultiNodeReader::ScheduleQueuedNodes()
+{
+    VerifyOrReturn(!mStartScheduled);
+
+    // Nodes are started, and finished ones destroyed, from the event loop rather than from the callbacks of the node
+    // that just finished, since its ReadClient or session setup is still calling it.
+    CHIP_ERROR err = DeviceLayer::SystemLayer().ScheduleWork(StartQueuedNodes, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Unable to schedule queued reads: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mStartScheduled = true;
+}
+
+void MultiNodeReader::StartQueuedNodes(System::Layer * layer, void * context)
+{
+    static_cast<MultiNodeReader *>(context)->StartQueuedNodes();
+}
+
+void MultiNodeReader::StartQueuedNodes()
+{
+    mStartScheduled = false;
+
+    mNodes.erase(std::remove_if(mNodes.begin(), mNodes.end(), [](const auto & node) { return node->IsFinished(); }),
+                 mNodes.end());
+
+    while (!mQueue.empty() && mActiveCount < mOptions.maxConcurrent)
+    {
+        NodeId nodeId = mQueue.front();
+        mQueue.pop_front();
+
+        auto node = std::make_unique<NodeRead>(*this, nodeId);
+        mActiveCount++;
+        CHIP_ERROR err = node->Start();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Unable to start reading node 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(nodeId), err.Format());
+            mActiveCount--;
+            mDelegate->OnNodeDone(nodeId, err);
+            continue;
+        }
+        mNodes.push_back(std::move(node));
+    }
+
+    if (mQueue.empty() && mActiveCount == 0)
+    {
+        mDelegate->OnReaderIdle();
+    }
+}
+
+void MultiNodeReader::OnNodeSetUp(NodeRead & node, CHIP_ERROR error)
+{
+    mActiveCount--;
+    mDelegate->OnNodeDone(node.GetNodeId(), error);
+    ScheduleQueuedNodes();
+}
+
+void MultiNodeReader::OnNodeReleased()
+{
+    ScheduleQueuedNodes();
+}
+
+MultiNodeReader::NodeRead::NodeRead(MultiNodeReader & reader, NodeId nodeId) :
+    mReader(reader), mNodeId(nodeId), mOnConnected(HandleDeviceConnected, this),
+    mOnConnectionFailure(HandleDeviceConnectionFailure, this), mBufferedReadAdapter(*this)
+{}
+
+CHIP_ERROR MultiNodeReader::NodeRead::Start()
+{
+    mStartTime = System::SystemClock().GetMonotonicTimestamp();
+    return mReader.mController->GetConnectedDevice(mNodeId, &mOnConnected, &mOnConnectionFailure);
+}
+
+void MultiNodeReader::NodeRead::HandleDeviceConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                                      const SessionHandle & sessionHandle)
+{
+    auto * node = static_cast<NodeRead *>(context);
+    VerifyOrReturn(node->mState == State::kConnecting);
+
+    CHIP_ERROR err = node->SendRequest(exchangeMgr, sessionHandle);
+    if (err != CHIP_NO_ERROR)
+    {
+        node->mReadClient.reset();
+        node->Finish(err);
+        return;
+    }
+    node->mState = State::kReading;
+}
+
+void MultiNodeReader::NodeRead::HandleDeviceConnectionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+{
+    auto * node = static_cast<NodeRead *>(context);
+    VerifyOrReturn(node->mState == State::kConnecting);
+    node->Finish(error);
+}
+
+CHIP_ERROR MultiNodeReader::NodeRead::SendRequest(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle)
+{
+    const Options & options = mReader.mOptions;
+    auto type = options.subscribe ? app::ReadClient::InteractionType::Subscribe : app::ReadClient::InteractionType::Read;
+
+    mReadClient = std::make_unique<app::ReadClient>(app::InteractionModelEngine::GetInstance(), &exchangeMgr,
+                                                    mBufferedReadAdapter, type);
+
+    // The paths are owned by the reader, which outlives the ReadClient, so OnDeallocatePaths has nothing to free.
+    app::ReadPrepareParams params(sessionHandle);
+    params.mpAttributePathParamsList    = mReader.mPaths.data();
+    params.mAttributePathParamsListSize = mReader.mPaths.size();
+    params.mIsFabricFiltered            = options.fabricFiltered;
+
+    if (!options.subscribe)
+    {
+        return mReadClient->SendRequest(params);
+    }
+
+    params.mMinIntervalFloorSeconds   = options.minIntervalFloorSeconds;
+    params.mMaxIntervalCeilingSeconds = options.maxIntervalCeilingSeconds;
+    params.mKeepSubscriptions         = true;
+    return mReadClient->SendAutoResubscribeRequest(std::move(params));
+}
+
+void MultiNodeReader::NodeRead::OnAttributeData(const app::ConcreteDataAttributePath & path, TLV::TLVReader * data,
+                                                const app::StatusIB & status)
+{
+    mReader.mDelegate->OnAttributeData(mNodeId, path, data, status);
+}
+
+void MultiNodeReader::NodeRead::OnSubscriptionEstablished(SubscriptionId subscriptionId)
+{
+    VerifyOrReturn(mState == State::kReading);
+
+    mState = State::kSubscribed;
+    mReader.mLatencies.push_back(
+        std::chrono::duration_cast<System::Clock::Milliseconds32>(System::SystemClock().GetMonotonicTimestamp() - mStartTime));
+    mReader.OnNodeSetUp(*this, CHIP_NO_ERROR);
+}
+
+CHIP_ERROR MultiNodeReader::NodeRead::OnResubscriptionNeeded(app::ReadClient * readClient, CHIP_ERROR terminationCause)
+{
+    // A subscription that could not be established is reported as failed rather than retried, so that it does not
+    // hold its slot forever.
+    VerifyOrReturnError(mState == State::kSubscribed, terminationCause);
+    return app::ReadClient::Callback::OnResubscriptionNeeded(readClient, terminationCause);
+}
+
+void MultiNodeReader::NodeRead::OnError(CHIP_ERROR error)
+{
+    mError = error;
+}
+
+void MultiNodeReader::NodeRead::OnDone(app::ReadClient * readClient)
+{
+    if (mState == State::kReading && mError == CHIP_NO_ERROR)
+    {
+        mReader.mLatencies.push_back(
+            std::chrono::duration_cast<System::Clock::Milliseconds32>(System::SystemClock().GetMonotonicTimestamp() - mStartTime));
+    }
+    Finish(mError);
+}
+
+void MultiNodeReader::NodeRead::Finish(CHIP_ERROR error)
+{
+    State previousState = mState;
+    mState              = State::kFinished;
+
+    if (previousState == State::kSubscribed)
+    {
+        mReader.mDelegate->OnSubscriptionTerminated(mNodeId, error);
+        mReader.OnNodeReleased();
+        return;
+    }
+    mReader.OnNodeSetUp(*this, error);
+}
+
+} // namespace Controller
+} // namespace chip
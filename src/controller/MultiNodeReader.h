@@ -0,0 +1,201 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/BufferedReadCallback.h>
+#include <app/ReadClient.h>
+#include <controller/CHIPDeviceController.h>
+#include <lib/core/CHIPCallback.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <deque>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+namespace chip {
+namespace Controller {
+
+/*
+ * Reads, or subscribes to, the same attribute paths on many nodes, several at a time.
+ *
+ * Each enqueued node gets a CASE session from the controller, which reuses the session already established with the
+ * node if there is one, then a ReadClient for the paths.  At most the given concurrency limit of nodes are being set
+ * up at once: the next queued node is started when a read completes, or when a subscription is established.  The time
+ * from starting a node to that point is recorded for the latency statistics.
+ *
+ * Usage:
+ *
+ *      app::AttributePathParams paths[] = { ... };
+ *      MultiNodeReader reader;
+ *      reader.Init(controller, Span<const app::AttributePathParams>(paths), delegate);
+ *      reader.Enqueue(nodeId1);
+ *      reader.Enqueue(nodeId2);
+ *      ...
+ *      // In Delegate::OnReaderIdle:
+ *      MultiNodeReader::LatencyStats stats = reader.GetLatencyStats();
+ *      reader.Shutdown();            // also ends the subscriptions
+ *
+ * All methods must be called on the Matter thread, and the controller must outlive the reader.  The reader may be shut
+ * down from Delegate::OnReaderIdle, but not from the other Delegate callbacks.
+ */
+class MultiNodeReader
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        // Called for every attribute report of every node, as ReadClient::Callback::OnAttributeData.
+        virtual void OnAttributeData(NodeId nodeId, const app::ConcreteDataAttributePath & path, TLV::TLVReader * data,
+                                     const app::StatusIB & status) = 0;
+
+        // Called once for every enqueued node: when its read completed or failed, or when its subscription was
+        // established or could not be.
+        virtual void OnNodeDone(NodeId nodeId, CHIP_ERROR error) = 0;
+
+        // Called when an established subscription ended for good.
+        virtual void OnSubscriptionTerminated(NodeId nodeId, CHIP_ERROR error) {}
+
+        // Called when the queue is empty and no node is being set up anymore.
+        virtual void OnReaderIdle() {}
+    };
+
+    struct Options
+    {
+        // The number of nodes set up at once.
+        size_t maxConcurrent = 8;
+        // Subscribe instead of reading, with these intervals.  Subscriptions resubscribe once they were established.
+        bool subscribe                     = false;
+        uint16_t minIntervalFloorSeconds   = 0;
+        uint16_t maxIntervalCeilingSeconds = 60;
+        bool fabricFiltered                = true;
+    };
+
+    // Latencies of the nodes that succeeded so far, from starting the node to its read completing or its
+    // subscription being established.
+    struct LatencyStats
+    {
+        size_t count = 0;
+        System::Clock::Milliseconds32 p50{ 0 };
+        System::Clock::Milliseconds32 p90{ 0 };
+        System::Clock::Milliseconds32 p99{ 0 };
+        System::Clock::Milliseconds32 max{ 0 };
+    };
+
+    MultiNodeReader() = default;
+    ~MultiNodeReader() { Shutdown(); }
+
+    MultiNodeReader(const MultiNodeReader &)             = delete;
+    MultiNodeReader & operator=(const MultiNodeReader &) = delete;
+
+    /*
+     * @param paths  The paths read from every node.  They are copied.
+     */
+    CHIP_ERROR Init(DeviceController & controller, Span<const app::AttributePathParams> paths, Delegate & delegate,
+                    const Options & options);
+    CHIP_ERROR Init(DeviceController & controller, Span<const app::AttributePathParams> paths, Delegate & delegate)
+    {
+        return Init(controller, paths, delegate, Options());
+    }
+
+    /*
+     * Stop the nodes being set up and the established subscriptions, and drop the queued nodes without reporting them.
+     */
+    void Shutdown();
+
+    CHIP_ERROR Enqueue(NodeId nodeId);
+
+    size_t GetQueuedCount() const { return mQueue.size(); }
+    size_t GetActiveCount() const { return mActiveCount; }
+
+    LatencyStats GetLatencyStats() const;
+
+private:
+    class NodeRead : public app::ReadClient::Callback
+    {
+    public:
+        NodeRead(MultiNodeReader & reader, NodeId nodeId);
+
+        CHIP_ERROR Start();
+
+        NodeId GetNodeId() const { return mNodeId; }
+        // Whether the node is done with and can be destroyed.
+        bool IsFinished() const { return mState == State::kFinished; }
+
+        void OnAttributeData(const app::ConcreteDataAttributePath & path, TLV::TLVReader * data,
+                             const app::StatusIB & status) override;
+        void OnSubscriptionEstablished(SubscriptionId subscriptionId) override;
+        CHIP_ERROR OnResubscriptionNeeded(app::ReadClient * readClient, CHIP_ERROR terminationCause) override;
+        void OnError(CHIP_ERROR error) override;
+        void OnDone(app::ReadClient * readClient) override;
+
+    private:
+        enum class State : uint8_t
+        {
+            kConnecting,
+            kReading,
+            kSubscribed,
+            kFinished,
+        };
+
+        static void HandleDeviceConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                          const SessionHandle & sessionHandle);
+        static void HandleDeviceConnectionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error);
+
+        CHIP_ERROR SendRequest(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle);
+        void Finish(CHIP_ERROR error);
+
+        MultiNodeReader & mReader;
+        const NodeId mNodeId;
+        State mState = State::kConnecting;
+        System::Clock::Timestamp mStartTime;
+        CHIP_ERROR mError = CHIP_NO_ERROR;
+        Callback::Callback<OnDeviceConnected> mOnConnected;
+        Callback::Callback<OnDeviceConnectionFailure> mOnConnectionFailure;
+        app::BufferedReadCallback mBufferedReadAdapter;
+        std::unique_ptr<app::ReadClient> mReadClient;
+    };
+
+    static void StartQueuedNodes(System::Layer * layer, void * context);
+
+    void ScheduleQueuedNodes();
+    void StartQueuedNodes();
+    void OnNodeSetUp(NodeRead & node, CHIP_ERROR error);
+    void OnNodeReleased();
+
+    DeviceController * mController = nullptr;
+    Delegate * mDelegate            = nullptr;
+    Options mOptions;
+    std::vector<app::AttributePathParams> mPaths;
+    std::deque<NodeId> mQueue;
+    std::vector<std::unique_ptr<NodeRead>> mNodes;
+    std::vector<System::Clock::Milliseconds32> mLatencies;
+    size_t mActiveCount  = 0;
+    bool mStartScheduled = false;
+};
+
+} // namespace Controller
+} // namespace chip
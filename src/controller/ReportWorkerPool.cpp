@@ -0,0 +1,117 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/ReportWorkerPool.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <functional>
+
+namespace chip {
+namespace Controller {
+
+CHIP_ERROR ReportWorkerPool::Init(size_t workerCount)
+{
+    VerifyOrReturnError(mWorkers.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(workerCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        auto worker     = std::make_unique<Worker>();
+        worker->mThread = std::thread(Run, std::ref(*worker));
+        mWorkers.push_back(std::move(worker));
+    }
+    return CHIP_NO_ERROR;
+}
+
+void ReportWorkerPool::Shutdown()
+{
+    for (auto & worker : mWorkers)
+    {
+        {
+            std::lock_guard<std::mutex> lock(worker->mMutex);
+            worker->mStopping = true;
+        }
+        worker->mWorkAvailable.notify_one();
+    }
+    for (auto & worker : mWorkers)
+    {
+        worker->mThread.join();
+    }
+    mWorkers.clear();
+}
+
+ReportWorkerPool::Worker & ReportWorkerPool::WorkerFor(const app::DeferredReportCallback & target)
+{
+    return *mWorkers[std::hash<const app::DeferredReportCallback *>()(&target) % mWorkers.size()];
+}
+
+CHIP_ERROR ReportWorkerPool::Dispatch(app::DeferredReportCallback & target, app::RecordedReport && report)
+{
+    VerifyOrReturnError(!mWorkers.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    Worker & worker = WorkerFor(target);
+    {
+        std::lock_guard<std::mutex> lock(worker.mMutex);
+        VerifyOrReturnError(!worker.mStopping, CHIP_ERROR_INCORRECT_STATE);
+        worker.mJobs.push_back(Job{ &target, std::move(report) });
+        worker.mPending[&target]++;
+    }
+    worker.mWorkAvailable.notify_one();
+    return CHIP_NO_ERROR;
+}
+
+void ReportWorkerPool::WaitUntilIdle(app::DeferredReportCallback & target)
+{
+    VerifyOrReturn(!mWorkers.empty());
+
+    Worker & worker = WorkerFor(target);
+    std::unique_lock<std::mutex> lock(worker.mMutex);
+    worker.mWorkDone.wait(lock, [&] { return worker.mPending.find(&target) == worker.mPending.end(); });
+}
+
+void ReportWorkerPool::Run(Worker & worker)
+{
+    std::unique_lock<std::mutex> lock(worker.mMutex);
+    while (true)
+    {
+        worker.mWorkAvailable.wait(lock, [&] { return worker.mStopping || !worker.mJobs.empty(); });
+        if (worker.mJobs.empty())
+        {
+            // Only get here when stopping, and everything has been delivered.
+            return;
+        }
+
+        Job job = std::move(worker.mJobs.front());
+        worker.mJobs.pop_front();
+
+        lock.unlock();
+        job.mTarget->Deliver(job.mReport);
+        lock.lock();
+
+        auto pending = worker.mPending.find(job.mTarget);
+        if (--pending->second == 0)
+        {
+            worker.mPending.erase(pending);
+            worker.mWorkDone.notify_all();
+        }
+    }
+}
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,97 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/DeferredReportCallback.h>
+#include <lib/core/CHIPError.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace chip {
+namespace Controller {
+
+/*
+ * A ReportDispatcher that delivers reports on a fixed set of worker threads.
+ *
+ * Every DeferredReportCallback (typically one per node subscription) is pinned to one worker, so its reports are
+ * delivered in order while reports for different nodes are consumed in parallel. Workers never take the stack lock.
+ *
+ * Usage, with one ClusterStateCache per node:
+ *
+ *      ReportWorkerPool pool;
+ *      pool.Init(4);
+ *      ...
+ *      app::DeferredReportCallback deferred(cache.GetBufferedCallback(), pool);
+ *      app::ReadClient client(engine, exchangeMgr, deferred, app::ReadClient::InteractionType::Subscribe);
+ *
+ * WaitUntilIdle (and so any non-report callback of a DeferredReportCallback) must not be called from a worker.
+ */
+class ReportWorkerPool : public app::ReportDispatcher
+{
+public:
+    ReportWorkerPool() = default;
+    ~ReportWorkerPool() override { Shutdown(); }
+
+    ReportWorkerPool(const ReportWorkerPool &)             = delete;
+    ReportWorkerPool & operator=(const ReportWorkerPool &) = delete;
+
+    CHIP_ERROR Init(size_t workerCount);
+
+    /*
+     * Deliver all reports dispatched so far, then stop the workers. Dispatch fails afterwards.
+     */
+    void Shutdown();
+
+    CHIP_ERROR Dispatch(app::DeferredReportCallback & target, app::RecordedReport && report) override;
+    void WaitUntilIdle(app::DeferredReportCallback & target) override;
+
+private:
+    struct Job
+    {
+        app::DeferredReportCallback * mTarget;
+        app::RecordedReport mReport;
+    };
+
+    struct Worker
+    {
+        std::thread mThread;
+        std::mutex mMutex;
+        std::condition_variable mWorkAvailable;
+        std::condition_variable mWorkDone;
+        std::deque<Job> mJobs;
+        // Jobs queued or being delivered, per target.
+        std::unordered_map<app::DeferredReportCallback *, size_t> mPending;
+        bool mStopping = false;
+    };
+
+    static void Run(Worker & worker);
+
+    Worker & WorkerFor(const app::DeferredReportCallback & target);
+
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+};
+
+} // namespace Controller
+} // namespace chip
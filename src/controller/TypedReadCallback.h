@@ -24,6 +24,7 @@
 #include <app/data-model/Decode.h>
 #include <functional>
 #include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
 namespace chip {
@@ -171,6 +172,122 @@ private:
     bool mCalledCallback = false;
 };
 
+/*
+ * Destination of one attribute read by a TypedStreamingReadCallback: each reported value of the attribute is decoded
+ * straight into an object owned by the caller, typically a member of a fixed structure gathering all the attributes of
+ * interest, so nothing is allocated per attribute.
+ *
+ * List attributes (DataModel::DecodableList) only keep a reader on the report when decoded: their items are decoded on
+ * demand by iterating the list, which is only valid from within TypedStreamingReadCallback::Listener::OnAttributeStreamed.
+ */
+class StreamedAttribute
+{
+public:
+    using DecodeFunction = CHIP_ERROR (*)(TLV::TLVReader & aReader, void * apDestination);
+
+    template <typename AttributeTypeInfo>
+    static StreamedAttribute Into(typename AttributeTypeInfo::DecodableType & aDestination)
+    {
+        return StreamedAttribute(AttributeTypeInfo::GetClusterId(), AttributeTypeInfo::GetAttributeId(), &aDestination,
+                                 [](TLV::TLVReader & aReader, void * apDestination) {
+                                     using Type = typename AttributeTypeInfo::DecodableType;
+                                     return app::DataModel::Decode(aReader, *static_cast<Type *>(apDestination));
+                                 });
+    }
+
+    ClusterId GetClusterId() const { return mClusterId; }
+    AttributeId GetAttributeId() const { return mAttributeId; }
+
+    bool Matches(const app::ConcreteAttributePath & aPath) const
+    {
+        return aPath.mClusterId == mClusterId && aPath.mAttributeId == mAttributeId;
+    }
+
+    CHIP_ERROR Decode(TLV::TLVReader & aReader) const { return mDecode(aReader, mpDestination); }
+
+private:
+    StreamedAttribute(ClusterId aClusterId, AttributeId aAttributeId, void * apDestination, DecodeFunction aDecode) :
+        mClusterId(aClusterId), mAttributeId(aAttributeId), mpDestination(apDestination), mDecode(aDecode)
+    {}
+
+    ClusterId mClusterId;
+    AttributeId mAttributeId;
+    void * mpDestination;
+    DecodeFunction mDecode;
+};
+
+/*
+ * A ReadClient::Callback for controllers that only aggregate what they read (e.g. energy totals over all the endpoints of
+ * a node): attribute data is decoded into the StreamedAttribute destinations as it arrives and the listener is told about
+ * each value, instead of caching the whole report in a ClusterStateCache. Attributes without a destination are ignored.
+ *
+ * The callback makes no allocation of its own; the buffered read adapter only allocates to reassemble lists that were
+ * chunked across reports. Both the destinations and the listener must outlive the ReadClient using the callback.
+ */
+class TypedStreamingReadCallback final : public app::ReadClient::Callback
+{
+public:
+    class Listener
+    {
+    public:
+        virtual ~Listener() = default;
+
+        /// Called once aAttribute has been decoded into its destination, for each path reporting it.
+        virtual void OnAttributeStreamed(const app::ConcreteDataAttributePath & aPath, const StreamedAttribute & aAttribute) = 0;
+
+        /// Called for an attribute that could not be read or decoded, or with a null path for an error of the whole read.
+        virtual void OnStreamError(const app::ConcreteDataAttributePath * apPath, CHIP_ERROR aError) = 0;
+
+        /// Called when the ReadClient is done; it may be released from here.
+        virtual void OnStreamDone(app::ReadClient * apReadClient) {}
+    };
+
+    TypedStreamingReadCallback(Span<const StreamedAttribute> aAttributes, Listener & aListener) :
+        mAttributes(aAttributes), mListener(aListener), mBufferedReadAdapter(*this)
+    {}
+
+    app::BufferedReadCallback & GetBufferedCallback() { return mBufferedReadAdapter; }
+
+private:
+    void OnAttributeData(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                         const app::StatusIB & aStatus) override
+    {
+        // The buffered read callback reassembles list item operations.
+        VerifyOrDie(!aPath.IsListItemOperation());
+
+        for (const auto & attribute : mAttributes)
+        {
+            if (!attribute.Matches(aPath))
+            {
+                continue;
+            }
+
+            CHIP_ERROR err = aStatus.ToChipError();
+            if (err == CHIP_NO_ERROR)
+            {
+                err = (apData == nullptr) ? CHIP_ERROR_INVALID_ARGUMENT : attribute.Decode(*apData);
+            }
+
+            if (err != CHIP_NO_ERROR)
+            {
+                mListener.OnStreamError(&aPath, err);
+                return;
+            }
+
+            mListener.OnAttributeStreamed(aPath, attribute);
+            return;
+        }
+    }
+
+    void OnError(CHIP_ERROR aError) override { mListener.OnStreamError(nullptr, aError); }
+
+    void OnDone(app::ReadClient * apReadClient) override { mListener.OnStreamDone(apReadClient); }
+
+    Span<const StreamedAttribute> mAttributes;
+    Listener & mListener;
+    app::BufferedReadCallback mBufferedReadAdapter;
+};
+
 template <typename DecodableEventType>
 class TypedReadEventCallback final : public app::ReadClient::Callback
 {
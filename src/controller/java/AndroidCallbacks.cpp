@@ -27,10 +27,12 @@
 #include <lib/support/CHIPJNIError.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/JniReferences.h>
+#include <lib/support/SafeInt.h>
 #include <lib/support/jsontlv/JsonToTlv.h>
 #include <lib/support/jsontlv/TlvToJson.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <platform/PlatformManager.h>
+#include <iterator>
 #include <string>
 #include <type_traits>
 
@@ -148,9 +150,10 @@ jobject GetNodeStateObj(JNIEnv * env, const char * nodeStateClassSignature, jobj
 }
 
 ReportCallback::ReportCallback(jobject wrapperCallback, jobject subscriptionEstablishedCallback,
-                               jobject resubscriptionAttemptCallback, const char * nodeStateClassSignature) :
+                               jobject resubscriptionAttemptCallback, const char * nodeStateClassSignature,
+                               bool batchAttributeReports) :
     mClusterCacheAdapter(*this, Optional<EventNumber>::Missing(), false /*cacheData*/),
-    mNodeStateClassSignature(nodeStateClassSignature)
+    mNodeStateClassSignature(nodeStateClassSignature), mBatchAttributeReports(batchAttributeReports)
 {
     JNIEnv * env = JniReferences::GetInstance().GetEnvForCurrentThread();
     VerifyOrReturn(env != nullptr, ChipLogError(Controller, "Could not get JNIEnv for current thread"));
@@ -180,6 +183,10 @@ ReportCallback::~ReportCallback()
 
 void ReportCallback::OnReportBegin()
 {
+    // Attributes of a report that did not complete are dropped, as they are from the NodeState.
+    mAttributeBatchTlv.clear();
+    mAttributeBatchIndex.clear();
+
     JNIEnv * env = JniReferences::GetInstance().GetEnvForCurrentThread();
     VerifyOrReturn(env != nullptr, ChipLogError(Controller, "Could not get JNIEnv for current thread"));
 
@@ -234,6 +241,11 @@ void ReportCallback::OnReportEnd()
     VerifyOrReturn(mWrapperCallbackRef.HasValidObjectRef(),
                    ChipLogError(Controller, "mWrapperCallbackRef is not valid in %s", __func__));
     jobject wrapperCallback = mWrapperCallbackRef.ObjectRef();
+    if (mBatchAttributeReports)
+    {
+        DeliverAttributeBatch(env, wrapperCallback);
+    }
+
     jmethodID onReportEndMethod;
     err = JniReferences::GetInstance().FindMethod(env, wrapperCallback, "onReportEnd", "()V", &onReportEndMethod);
     VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(Controller, "Could not find onReportEnd method"));
@@ -272,6 +284,12 @@ CHIP_ERROR ConvertReportTlvToJson(const uint32_t id, TLV::TLVReader & data, std:
 void ReportCallback::OnAttributeData(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
                                      const app::StatusIB & aStatus)
 {
+    if (mBatchAttributeReports)
+    {
+        AddAttributeToBatch(aPath, apData, aStatus);
+        return;
+    }
+
     DeviceLayer::StackUnlock unlock;
     CHIP_ERROR err = CHIP_NO_ERROR;
     JNIEnv * env   = JniReferences::GetInstance().GetEnvForCurrentThread();
@@ -376,6 +394,82 @@ void ReportCallback::OnAttributeData(const app::ConcreteDataAttributePath & aPat
     UpdateClusterDataVersion();
 }
 
+void ReportCallback::AddAttributeToBatch(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                         const app::StatusIB & aStatus)
+{
+    VerifyOrReturn(!aPath.IsListItemOperation(), ChipLogError(Controller, "Expect non-list item operation"); aPath.LogPath());
+
+    const size_t tlvOffset = mAttributeBatchTlv.size();
+    size_t tlvLength       = 0;
+    if (aStatus.IsSuccess())
+    {
+        VerifyOrReturn(apData != nullptr, ChipLogError(Controller, "Receive empty apData"); aPath.LogPath());
+
+        // Same normalized TLV as AttributeState.getTlv(): wrapped with an anonymous tag, no extra "end of container" tag.
+        TLV::TLVReader reader;
+        reader.Init(*apData);
+        size_t bufferLen = reader.GetRemainingLength() + reader.GetLengthRead();
+        mAttributeBatchTlv.resize(tlvOffset + bufferLen);
+
+        TLV::TLVWriter writer;
+        writer.Init(mAttributeBatchTlv.data() + tlvOffset, bufferLen);
+        CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), reader);
+        if (err != CHIP_NO_ERROR)
+        {
+            mAttributeBatchTlv.resize(tlvOffset);
+            ChipLogError(Controller, "Fail to copy tlv element with error %" CHIP_ERROR_FORMAT, err.Format());
+            aPath.LogPath();
+            return;
+        }
+        tlvLength = writer.GetLengthWritten();
+        mAttributeBatchTlv.resize(tlvOffset + tlvLength);
+    }
+
+    jlong fields[kAttributeBatchFieldCount];
+    fields[kEndpointId]    = static_cast<jlong>(aPath.mEndpointId);
+    fields[kClusterId]     = static_cast<jlong>(aPath.mClusterId);
+    fields[kAttributeId]   = static_cast<jlong>(aPath.mAttributeId);
+    fields[kStatus]        = static_cast<jlong>(aStatus.mStatus);
+    fields[kClusterStatus] = aStatus.mClusterStatus.has_value() ? static_cast<jlong>(*aStatus.mClusterStatus) : -1;
+    fields[kDataVersion]   = aPath.mDataVersion.HasValue() ? static_cast<jlong>(aPath.mDataVersion.Value()) : -1;
+    fields[kTlvOffset]     = static_cast<jlong>(tlvOffset);
+    fields[kTlvLength]     = static_cast<jlong>(tlvLength);
+    mAttributeBatchIndex.insert(mAttributeBatchIndex.end(), std::begin(fields), std::end(fields));
+}
+
+void ReportCallback::DeliverAttributeBatch(JNIEnv * env, jobject wrapperCallback)
+{
+    VerifyOrReturn(!mAttributeBatchIndex.empty());
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    VerifyOrExit(CanCastTo<jsize>(mAttributeBatchTlv.size()) && CanCastTo<jsize>(mAttributeBatchIndex.size()),
+                 err = CHIP_ERROR_BUFFER_TOO_SMALL);
+    {
+        jmethodID onAttributeReportBatchMethod;
+        SuccessOrExit(err = JniReferences::GetInstance().FindMethod(env, wrapperCallback, "onAttributeReportBatch", "([B[J)V",
+                                                                    &onAttributeReportBatchMethod));
+
+        chip::ByteArray tlv(env, ByteSpan(mAttributeBatchTlv.data(), mAttributeBatchTlv.size()));
+        jlongArray index = env->NewLongArray(static_cast<jsize>(mAttributeBatchIndex.size()));
+        VerifyOrExit(tlv.jniValue() != nullptr && index != nullptr, err = CHIP_ERROR_NO_MEMORY);
+        env->SetLongArrayRegion(index, 0, static_cast<jsize>(mAttributeBatchIndex.size()), mAttributeBatchIndex.data());
+
+        DeviceLayer::StackUnlock unlock;
+        env->CallVoidMethod(wrapperCallback, onAttributeReportBatchMethod, tlv.jniValue(), index);
+        VerifyOrExit(!env->ExceptionCheck(), env->ExceptionDescribe());
+    }
+
+exit:
+    // Keep the capacity for the next report.
+    mAttributeBatchTlv.clear();
+    mAttributeBatchIndex.clear();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Fail to deliver attribute report batch with error %" CHIP_ERROR_FORMAT, err.Format());
+        ReportError(nullptr, nullptr, err);
+    }
+}
+
 void ReportCallback::UpdateClusterDataVersion()
 {
     JNIEnv * env = JniReferences::GetInstance().GetEnvForCurrentThread();
@@ -1221,11 +1315,13 @@ void deleteConnectedDeviceCallback(JNIEnv * env, jobject self, jlong callbackHan
 }
 
 jlong newReportCallback(JNIEnv * env, jobject self, jobject subscriptionEstablishedCallbackJava,
-                        jobject resubscriptionAttemptCallbackJava, const char * nodeStateClassSignature)
+                        jobject resubscriptionAttemptCallbackJava, const char * nodeStateClassSignature,
+                        bool batchAttributeReports)
 {
     chip::DeviceLayer::StackLock lock;
-    ReportCallback * reportCallback = chip::Platform::New<ReportCallback>(
-        self, subscriptionEstablishedCallbackJava, resubscriptionAttemptCallbackJava, nodeStateClassSignature);
+    ReportCallback * reportCallback =
+        chip::Platform::New<ReportCallback>(self, subscriptionEstablishedCallbackJava, resubscriptionAttemptCallbackJava,
+                                            nodeStateClassSignature, batchAttributeReports);
     return reinterpret_cast<jlong>(reportCallback);
 }
 
@@ -27,6 +27,7 @@
 #include <list>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace chip {
 namespace Controller {
@@ -55,9 +56,15 @@ private:
 
 struct ReportCallback : public app::ClusterStateCache::Callback
 {
-    /** Subscription established callback can be nullptr. */
+    /**
+     * Subscription established callback can be nullptr.
+     *
+     * When batchAttributeReports is true, attribute data is not decoded into Java objects one attribute at a time. Instead,
+     * the TLV of all the attributes of a report is handed to onAttributeReportBatch() in a single byte array, along with an
+     * index of their paths, statuses and offsets, right before onReportEnd().
+     */
     ReportCallback(jobject wrapperCallback, jobject subscriptionEstablishedCallback, jobject resubscriptionAttemptCallback,
-                   const char * nodeStateClassSignature);
+                   const char * nodeStateClassSignature, bool batchAttributeReports = false);
     ~ReportCallback();
 
     void OnReportBegin() override;
@@ -87,6 +94,24 @@ struct ReportCallback : public app::ClusterStateCache::Callback
 
     void UpdateClusterDataVersion();
 
+    void AddAttributeToBatch(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const app::StatusIB & aStatus);
+    void DeliverAttributeBatch(JNIEnv * env, jobject wrapperCallback);
+
+    // Fields of each attribute in the batch index, must match AttributeReportBatch.java. A missing cluster status or data
+    // version is -1, and the TLV is empty when the status is not Success.
+    enum AttributeBatchField : size_t
+    {
+        kEndpointId = 0,
+        kClusterId,
+        kAttributeId,
+        kStatus,
+        kClusterStatus,
+        kDataVersion,
+        kTlvOffset,
+        kTlvLength,
+        kAttributeBatchFieldCount,
+    };
+
     app::ReadClient * mReadClient = nullptr;
 
     app::ClusterStateCache mClusterCacheAdapter;
@@ -95,6 +120,10 @@ struct ReportCallback : public app::ClusterStateCache::Callback
     JniGlobalReference mResubscriptionAttemptCallbackRef;
 
     const char * mNodeStateClassSignature;
+
+    bool mBatchAttributeReports = false;
+    std::vector<uint8_t> mAttributeBatchTlv;
+    std::vector<jlong> mAttributeBatchIndex;
 };
 
 struct WriteAttributesCallback : public app::WriteClient::Callback
@@ -156,7 +185,8 @@ struct ExtendableInvokeCallback : public app::CommandSender::ExtendableCallback
 jlong newConnectedDeviceCallback(JNIEnv * env, jobject self, jobject callback);
 void deleteConnectedDeviceCallback(JNIEnv * env, jobject self, jlong callbackHandle);
 jlong newReportCallback(JNIEnv * env, jobject self, jobject subscriptionEstablishedCallbackJava,
-                        jobject resubscriptionAttemptCallbackJava, const char * nodeStateClassSignature);
+                        jobject resubscriptionAttemptCallbackJava, const char * nodeStateClassSignature,
+                        bool batchAttributeReports = false);
 void deleteReportCallback(JNIEnv * env, jobject self, jlong callbackHandle);
 jlong newWriteAttributesCallback(JNIEnv * env, jobject self);
 void deleteWriteAttributesCallback(JNIEnv * env, jobject self, jlong callbackHandle);
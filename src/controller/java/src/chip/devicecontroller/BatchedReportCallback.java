@@ -0,0 +1,33 @@
+/*
+ *   Copyright (c) 2026 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+package chip.devicecontroller;
+
+import chip.devicecontroller.model.AttributeReportBatch;
+
+/**
+ * A {@link ReportCallback} receiving the attributes of each report as a single {@link
+ * AttributeReportBatch}, so that large reads and subscriptions do not create Java objects for every
+ * attribute.
+ *
+ * <p>For each report, {@link #onAttributeReportBatch} is called before {@link
+ * ReportCallback#onReport}. The {@code NodeState} passed to {@code onReport} then only holds the
+ * events of the report.
+ */
+public interface BatchedReportCallback extends ReportCallback {
+  void onAttributeReportBatch(AttributeReportBatch batch);
+}
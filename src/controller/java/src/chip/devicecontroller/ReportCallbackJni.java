@@ -17,6 +17,7 @@
  */
 package chip.devicecontroller;
 
+import chip.devicecontroller.model.AttributeReportBatch;
 import chip.devicecontroller.model.ChipAttributePath;
 import chip.devicecontroller.model.ChipEventPath;
 import chip.devicecontroller.model.NodeState;
@@ -38,7 +39,10 @@ public class ReportCallbackJni {
     this.wrappedReportCallback = reportCallback;
     this.wrappedResubscriptionAttemptCallback = resubscriptionAttemptCallback;
     this.callbackHandle =
-        newCallback(subscriptionEstablishedCallback, resubscriptionAttemptCallback);
+        newCallback(
+            subscriptionEstablishedCallback,
+            resubscriptionAttemptCallback,
+            reportCallback instanceof BatchedReportCallback);
   }
 
   long getCallbackHandle() {
@@ -47,7 +51,8 @@ public class ReportCallbackJni {
 
   private native long newCallback(
       @Nullable SubscriptionEstablishedCallback subscriptionEstablishedCallback,
-      @Nullable ResubscriptionAttemptCallback resubscriptionAttemptCallback);
+      @Nullable ResubscriptionAttemptCallback resubscriptionAttemptCallback,
+      boolean batchAttributeReports);
 
   private native void deleteCallback(long callbackHandle);
 
@@ -67,6 +72,11 @@ public class ReportCallbackJni {
     return nodeState;
   }
 
+  private void onAttributeReportBatch(byte[] tlv, long[] index) {
+    ((BatchedReportCallback) wrappedReportCallback)
+        .onAttributeReportBatch(new AttributeReportBatch(tlv, index));
+  }
+
   private void onError(
       boolean isAttributePath,
       int attributeEndpointId,
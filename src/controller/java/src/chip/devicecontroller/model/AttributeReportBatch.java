@@ -0,0 +1,102 @@
+/*
+ *   Copyright (c) 2026 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+package chip.devicecontroller.model;
+
+import java.util.Arrays;
+import javax.annotation.Nullable;
+
+/**
+ * The attributes of one report, as the TLV of all the attribute values in a single byte array and
+ * an index of their paths, statuses and offsets. Nothing is decoded until asked for.
+ */
+public final class AttributeReportBatch {
+  // Fields of each attribute in the index, must match ReportCallback::AttributeBatchField.
+  private static final int ENDPOINT_ID = 0;
+  private static final int CLUSTER_ID = 1;
+  private static final int ATTRIBUTE_ID = 2;
+  private static final int STATUS = 3;
+  private static final int CLUSTER_STATUS = 4;
+  private static final int DATA_VERSION = 5;
+  private static final int TLV_OFFSET = 6;
+  private static final int TLV_LENGTH = 7;
+  private static final int FIELD_COUNT = 8;
+
+  private final byte[] tlv;
+  private final long[] index;
+
+  public AttributeReportBatch(byte[] tlv, long[] index) {
+    this.tlv = tlv;
+    this.index = index;
+  }
+
+  /** Returns the number of attributes in the report. */
+  public int size() {
+    return index.length / FIELD_COUNT;
+  }
+
+  public ChipAttributePath getAttributePath(int i) {
+    return ChipAttributePath.newInstance(
+        (int) field(i, ENDPOINT_ID), field(i, CLUSTER_ID), field(i, ATTRIBUTE_ID));
+  }
+
+  public Status getStatus(int i) {
+    long clusterStatus = field(i, CLUSTER_STATUS);
+    return Status.newInstance(
+        (int) field(i, STATUS), clusterStatus < 0 ? null : Integer.valueOf((int) clusterStatus));
+  }
+
+  public boolean isSuccess(int i) {
+    return field(i, STATUS) == Status.Code.Success.getId();
+  }
+
+  /** Returns the data version of the attribute's cluster, or null if it was not reported. */
+  @Nullable
+  public Long getDataVersion(int i) {
+    long dataVersion = field(i, DATA_VERSION);
+    return dataVersion < 0 ? null : Long.valueOf(dataVersion);
+  }
+
+  /**
+   * Returns a copy of the TLV of an attribute, wrapped within an anonymous TLV tag like {@link
+   * AttributeState#getTlv()}. It is empty when the status is not Success.
+   */
+  public byte[] getTlv(int i) {
+    int offset = getTlvOffset(i);
+    return Arrays.copyOfRange(tlv, offset, offset + getTlvLength(i));
+  }
+
+  /**
+   * Returns the TLV of all the attributes, to be read without copies using {@link #getTlvOffset}
+   * and {@link #getTlvLength}.
+   */
+  public byte[] getTlvBuffer() {
+    return tlv;
+  }
+
+  public int getTlvOffset(int i) {
+    return (int) field(i, TLV_OFFSET);
+  }
+
+  public int getTlvLength(int i) {
+    return (int) field(i, TLV_LENGTH);
+  }
+
+  private long field(int i, int field) {
+    return index[i * FIELD_COUNT + field];
+  }
+}
@@ -22,6 +22,7 @@ import builtins
 import ctypes
 import inspect
 import logging
+import struct
 import sys
 from asyncio.futures import Future
 from ctypes import CFUNCTYPE, POINTER, c_bool, c_size_t, c_uint8, c_uint16, c_uint32, c_uint64, c_void_p, cast, py_object
@@ -917,7 +918,7 @@ class AsyncWriteTransaction:
 
 
 _OnReadAttributeDataCallbackFunct = CFUNCTYPE(
-    None, py_object, c_uint32, c_uint16, c_uint32, c_uint32, c_uint8, c_void_p, c_size_t)
+    None, py_object, c_void_p, c_size_t, c_size_t)
 _OnSubscriptionEstablishedCallbackFunct = CFUNCTYPE(None, py_object, c_uint32)
 _OnResubscriptionAttemptedCallbackFunct = CFUNCTYPE(
     None, py_object, PyChipError, c_uint32)
@@ -933,11 +934,24 @@ _OnReportEndCallbackFunct = CFUNCTYPE(
     None, py_object)
 
 
+# Layout of AttributeDataRecord in attribute.cpp: dataVersion, endpointId, clusterId, attributeId, imStatus and dataLen,
+# followed by dataLen bytes of TLV.
+_AttributeDataRecordHeader = struct.Struct('<IHIIBI')
+
+
 @_OnReadAttributeDataCallbackFunct
-def _OnReadAttributeDataCallback(closure, dataVersion: int, endpoint: int, cluster: int, attribute: int, status, data, len):
-    dataBytes = ctypes.string_at(data, len)
-    closure.handleAttributeData(AttributePath(
-        EndpointId=endpoint, ClusterId=cluster, AttributeId=attribute), dataVersion, status, dataBytes[:])
+def _OnReadAttributeDataCallback(closure, records, recordsLen: int, recordCount: int):
+    # The whole batch is copied out of the native buffer at once, then split up on the Python side.
+    recordBytes = ctypes.string_at(records, recordsLen)
+    offset = 0
+    for _ in range(recordCount):
+        dataVersion, endpoint, cluster, attribute, status, dataLen = _AttributeDataRecordHeader.unpack_from(
+            recordBytes, offset)
+        offset += _AttributeDataRecordHeader.size
+        closure.handleAttributeData(AttributePath(
+            EndpointId=endpoint, ClusterId=cluster, AttributeId=attribute), dataVersion, status,
+            recordBytes[offset:offset + dataLen])
+        offset += dataLen
 
 
 @_OnReadEventDataCallbackFunct
@@ -17,8 +17,10 @@
 
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 #include <app/BufferedReadCallback.h>
 #include <app/ChunkedWriteCallback.h>
@@ -31,6 +33,7 @@
 #include <controller/python/matter/native/PyChipError.h>
 #include <lib/core/Optional.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <system/SystemClock.h>
 
@@ -66,10 +69,24 @@ struct __attribute__((packed)) DataVersionFilter
     chip::DataVersion dataVersion;
 };
 
-using OnReadAttributeDataCallback       = void (*)(PyObject * appContext, chip::DataVersion version, chip::EndpointId endpointId,
-                                             chip::ClusterId clusterId, chip::AttributeId attributeId,
-                                             std::underlying_type_t<Protocols::InteractionModel::Status> imstatus, uint8_t * data,
-                                             size_t dataLen);
+// Header of each record in an attribute data batch, followed by dataLen bytes of TLV. The TLV is empty when the status is not
+// Success.
+struct __attribute__((packed)) AttributeDataRecord
+{
+    chip::DataVersion dataVersion;
+    chip::EndpointId endpointId;
+    chip::ClusterId clusterId;
+    chip::AttributeId attributeId;
+    std::underlying_type_t<Protocols::InteractionModel::Status> imStatus;
+    uint32_t dataLen;
+};
+
+// Attribute data is buffered and handed to Python in batches, so that a large report does not cross the ctypes boundary once
+// per attribute. A batch is delivered when the report ends, or earlier once it grows past this size.
+constexpr size_t kMaxAttributeDataBatchSize = 64 * 1024;
+
+using OnReadAttributeDataCallback       = void (*)(PyObject * appContext, const uint8_t * records, size_t recordsLen,
+                                             size_t recordCount);
 using OnReadEventDataCallback           = void (*)(PyObject * appContext, chip::EndpointId endpointId, chip::ClusterId clusterId,
                                          chip::EventId eventId, chip::EventNumber eventNumber, uint8_t priority, uint64_t timestamp,
                                          uint8_t timestampType, uint8_t * data, size_t dataLen,
@@ -113,37 +130,49 @@ public:
         //
         VerifyOrDie(!aPath.IsListItemOperation());
 
-        std::unique_ptr<uint8_t[]> buffer;
-        size_t size = 0;
+        const size_t recordOffset = mAttributeDataBatch.size();
+        size_t size               = 0;
 
         // When the apData is nullptr, means we did not receive a valid attribute data from server, status will be some error
         // status.
         if (apData != nullptr)
         {
             size_t bufferLen = apData->GetRemainingLength() + apData->GetLengthRead();
-            buffer           = std::make_unique<uint8_t[]>(bufferLen);
+            mAttributeDataBatch.resize(recordOffset + sizeof(AttributeDataRecord) + bufferLen);
             // The TLVReader's read head is not pointing to the first element in the container instead of the container itself, use
             // a TLVWriter to get a TLV with a normalized TLV buffer (Wrapped with a anonymous tag, no extra "end of container" tag
             // at the end.)
             TLV::TLVWriter writer;
-            writer.Init(buffer.get(), bufferLen);
+            writer.Init(mAttributeDataBatch.data() + recordOffset + sizeof(AttributeDataRecord), bufferLen);
             CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), *apData);
+            if (err == CHIP_NO_ERROR && !CanCastTo<uint32_t>(writer.GetLengthWritten()))
+            {
+                err = CHIP_ERROR_BUFFER_TOO_SMALL;
+            }
             if (err != CHIP_NO_ERROR)
             {
+                mAttributeDataBatch.resize(recordOffset);
                 this->OnError(err);
                 return;
             }
             size = writer.GetLengthWritten();
         }
-
-        DataVersion version = 0;
-        if (aPath.mDataVersion.HasValue())
+        mAttributeDataBatch.resize(recordOffset + sizeof(AttributeDataRecord) + size);
+
+        AttributeDataRecord record;
+        record.dataVersion = aPath.mDataVersion.ValueOr(0);
+        record.endpointId  = aPath.mEndpointId;
+        record.clusterId   = aPath.mClusterId;
+        record.attributeId = aPath.mAttributeId;
+        record.imStatus    = to_underlying(aStatus.mStatus);
+        record.dataLen     = static_cast<uint32_t>(size);
+        memcpy(mAttributeDataBatch.data() + recordOffset, &record, sizeof(record));
+        mAttributeDataBatchCount++;
+
+        if (mAttributeDataBatch.size() >= kMaxAttributeDataBatchSize)
         {
-            version = aPath.mDataVersion.Value();
+            FlushAttributeData();
         }
-
-        gOnReadAttributeDataCallback(mAppContext, version, aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId,
-                                     to_underlying(aStatus.mStatus), buffer.get(), size);
     }
 
     void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override
@@ -207,7 +236,11 @@ public:
             to_underlying(apStatus == nullptr ? Protocols::InteractionModel::Status::Success : apStatus->mStatus));
     }
 
-    void OnError(CHIP_ERROR aError) override { gOnReadErrorCallback(mAppContext, ToPyChipError(aError)); }
+    void OnError(CHIP_ERROR aError) override
+    {
+        FlushAttributeData();
+        gOnReadErrorCallback(mAppContext, ToPyChipError(aError));
+    }
 
     void OnReportBegin() override { gOnReportBeginCallback(mAppContext); }
     void OnDeallocatePaths(chip::app::ReadPrepareParams && aReadPrepareParams) override
@@ -228,10 +261,15 @@ public:
         }
     }
 
-    void OnReportEnd() override { gOnReportEndCallback(mAppContext); }
+    void OnReportEnd() override
+    {
+        FlushAttributeData();
+        gOnReportEndCallback(mAppContext);
+    }
 
     void OnDone(ReadClient *) override
     {
+        FlushAttributeData();
         gOnReadDoneCallback(mAppContext);
 
         delete this;
@@ -242,10 +280,22 @@ public:
     void SetAutoResubscribe(bool autoResubscribe) { mAutoResubscribe = autoResubscribe; }
 
 private:
+    void FlushAttributeData()
+    {
+        VerifyOrReturn(mAttributeDataBatchCount > 0);
+        gOnReadAttributeDataCallback(mAppContext, mAttributeDataBatch.data(), mAttributeDataBatch.size(), mAttributeDataBatchCount);
+        // Keep the capacity for the next report.
+        mAttributeDataBatch.clear();
+        mAttributeDataBatchCount = 0;
+    }
+
     BufferedReadCallback mBufferedReadCallback;
 
     PyObject * mAppContext;
 
+    std::vector<uint8_t> mAttributeDataBatch;
+    size_t mAttributeDataBatchCount = 0;
+
     std::unique_ptr<ReadClient> mReadClient;
     bool mAutoResubscribe       = true;
     bool mAutoResubscribeNeeded = false;
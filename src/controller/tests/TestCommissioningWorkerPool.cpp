@@ -0,0 +1,297 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningWorkerPool.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::Controller;
+
+namespace {
+
+constexpr size_t kRequestCount = 20;
+
+// Answers every request right away and remembers the threads it ran on.
+class FakeVerifier : public DeviceAttestationVerifier
+{
+public:
+    void VerifyAttestationInformation(const AttestationInfo & info,
+                                      Callback::Callback<OnAttestationInformationVerification> * onCompletion) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mThreads.push_back(std::this_thread::get_id());
+        }
+        onCompletion->mCall(onCompletion->mContext, info,
+                            (info.productId % 2 == 0) ? AttestationVerificationResult::kSuccess
+                                                      : AttestationVerificationResult::kDacProductIdMismatch);
+    }
+    AttestationVerificationResult ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer,
+                                                                            ByteSpan & certDeclBuffer) override
+    {
+        return AttestationVerificationResult::kNotImplemented;
+    }
+    AttestationVerificationResult ValidateCertificateDeclarationPayload(const ByteSpan & certDeclBuffer,
+                                                                        const ByteSpan & firmwareInfo,
+                                                                        const DeviceInfoForAttestation & deviceInfo) override
+    {
+        return AttestationVerificationResult::kNotImplemented;
+    }
+    CHIP_ERROR VerifyNodeOperationalCSRInformation(const ByteSpan & nocsrElementsBuffer,
+                                                   const ByteSpan & attestationChallengeBuffer,
+                                                   const ByteSpan & attestationSignatureBuffer,
+                                                   const Crypto::P256PublicKey & dacPublicKey, const ByteSpan & csrNonce) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    void CheckForRevokedDACChain(const AttestationInfo & info,
+                                 Callback::Callback<OnAttestationInformationVerification> * onCompletion) override
+    {
+        onCompletion->mCall(onCompletion->mContext, info, AttestationVerificationResult::kSuccess);
+    }
+
+    std::mutex mMutex;
+    std::vector<std::thread::id> mThreads;
+};
+
+// Echoes the CSR elements as the NOC, with the node id hint as the admin subject.
+class FakeIssuer : public OperationalCredentialsDelegate
+{
+public:
+    CHIP_ERROR GenerateNOCChain(const ByteSpan & csrElements, const ByteSpan & csrNonce, const ByteSpan & attestationSignature,
+                                const ByteSpan & attestationChallenge, const ByteSpan & DAC, const ByteSpan & PAI,
+                                Callback::Callback<OnNOCChainGeneration> * onCompletion) override
+    {
+        mRunning++;
+        mMaxRunning = std::max(mMaxRunning, mRunning);
+        mThreads.push_back(std::this_thread::get_id());
+        // Give another worker a chance to run a request at the same time, if it could.
+        std::this_thread::yield();
+
+        const uint8_t ipk[Crypto::CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES] = { 1 };
+        onCompletion->mCall(onCompletion->mContext, CHIP_NO_ERROR, csrElements, ByteSpan(), ByteSpan(),
+                            MakeOptional(Crypto::IdentityProtectionKeySpan(ipk)), MakeOptional(mNextNodeId));
+        mRunning--;
+        return CHIP_NO_ERROR;
+    }
+    void SetNodeIdForNextNOCRequest(NodeId nodeId) override { mNextNodeId = nodeId; }
+
+    // Only touched with the pool's lock held.
+    NodeId mNextNodeId = kUndefinedNodeId;
+    int mRunning       = 0;
+    int mMaxRunning    = 0;
+    std::vector<std::thread::id> mThreads;
+};
+
+struct AttestationResult
+{
+    uint16_t productId;
+    uint8_t firstElementByte;
+    AttestationVerificationResult result;
+};
+
+struct NOCChainResult
+{
+    CHIP_ERROR status;
+    uint8_t firstNocByte;
+    NodeId adminSubject;
+};
+
+std::vector<AttestationResult> gAttestationResults;
+std::vector<NOCChainResult> gNOCChainResults;
+std::vector<std::thread::id> gCompletionThreads;
+
+void StopWhenDone(size_t count)
+{
+    if (count == kRequestCount)
+    {
+        EXPECT_EQ(DeviceLayer::PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+    }
+}
+
+void OnAttestationVerified(void * context, const DeviceAttestationVerifier::AttestationInfo & info,
+                           AttestationVerificationResult result)
+{
+    gAttestationResults.push_back({ info.productId, info.attestationElementsBuffer.data()[0], result });
+    gCompletionThreads.push_back(std::this_thread::get_id());
+    StopWhenDone(gAttestationResults.size());
+}
+
+void OnNOCChainGenerated(void * context, CHIP_ERROR status, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                         Optional<Crypto::IdentityProtectionKeySpan> ipk, Optional<NodeId> adminSubject)
+{
+    EXPECT_TRUE(status != CHIP_NO_ERROR || ipk.HasValue());
+    gNOCChainResults.push_back(
+        { status, noc.empty() ? uint8_t(0) : noc.data()[0], adminSubject.HasValue() ? adminSubject.Value() : kUndefinedNodeId });
+    gCompletionThreads.push_back(std::this_thread::get_id());
+    StopWhenDone(gNOCChainResults.size());
+}
+
+class TestCommissioningWorkerPool : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(DeviceLayer::PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    }
+    static void TearDownTestSuite()
+    {
+        DeviceLayer::PlatformMgr().Shutdown();
+        Platform::MemoryShutdown();
+    }
+
+    void SetUp() override
+    {
+        gAttestationResults.clear();
+        gNOCChainResults.clear();
+        gCompletionThreads.clear();
+    }
+
+protected:
+    FakeVerifier mVerifier;
+    FakeIssuer mIssuer;
+};
+
+TEST_F(TestCommissioningWorkerPool, AttestationIsVerifiedOnWorkers)
+{
+    CommissioningWorkerPool pool;
+    ASSERT_EQ(pool.Init(4, mVerifier, mIssuer), CHIP_NO_ERROR);
+
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> onVerified(OnAttestationVerified,
+                                                                                                  nullptr);
+    for (size_t i = 0; i < kRequestCount; i++)
+    {
+        uint8_t elements[8] = { static_cast<uint8_t>(i) };
+        uint8_t other[8]    = {};
+        const ByteSpan otherSpan(other);
+        DeviceAttestationVerifier::AttestationInfo info(ByteSpan(elements), otherSpan, otherSpan, otherSpan, otherSpan, otherSpan,
+                                                        VendorId::TestVendor1, static_cast<uint16_t>(i));
+        pool.GetDeviceAttestationVerifier()->VerifyAttestationInformation(info, &onVerified);
+
+        // The buffers go away now, like those of the DeviceCommissioner would.
+        memset(elements, 0xFF, sizeof(elements));
+    }
+
+    DeviceLayer::PlatformMgr().RunEventLoop();
+    pool.Shutdown();
+
+    ASSERT_EQ(gAttestationResults.size(), kRequestCount);
+    for (const auto & result : gAttestationResults)
+    {
+        EXPECT_EQ(result.firstElementByte, result.productId);
+        EXPECT_TRUE(result.result ==
+                    ((result.productId % 2 == 0) ? AttestationVerificationResult::kSuccess
+                                                 : AttestationVerificationResult::kDacProductIdMismatch));
+    }
+
+    // Verified on the workers, reported on the Matter thread.
+    ASSERT_EQ(mVerifier.mThreads.size(), kRequestCount);
+    for (auto id : mVerifier.mThreads)
+    {
+        EXPECT_NE(id, std::this_thread::get_id());
+    }
+    for (auto id : gCompletionThreads)
+    {
+        EXPECT_EQ(id, std::this_thread::get_id());
+    }
+}
+
+TEST_F(TestCommissioningWorkerPool, NOCChainsAreGeneratedOneAtATime)
+{
+    CommissioningWorkerPool pool;
+    ASSERT_EQ(pool.Init(4, mVerifier, mIssuer), CHIP_NO_ERROR);
+
+    Callback::Callback<OnNOCChainGeneration> onGenerated(OnNOCChainGenerated, nullptr);
+    OperationalCredentialsDelegate * delegate = pool.GetOperationalCredentialsDelegate();
+    for (size_t i = 0; i < kRequestCount; i++)
+    {
+        uint8_t csrElements[8] = { static_cast<uint8_t>(i) };
+        delegate->SetNodeIdForNextNOCRequest(0x1000 + i);
+        EXPECT_EQ(delegate->GenerateNOCChain(ByteSpan(csrElements), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(),
+                                             &onGenerated),
+                  CHIP_NO_ERROR);
+        memset(csrElements, 0xFF, sizeof(csrElements));
+    }
+
+    DeviceLayer::PlatformMgr().RunEventLoop();
+    pool.Shutdown();
+
+    // Every request was generated with its own node id hint, even though the hints were all given up front.
+    ASSERT_EQ(gNOCChainResults.size(), kRequestCount);
+    for (const auto & result : gNOCChainResults)
+    {
+        EXPECT_EQ(result.status, CHIP_NO_ERROR);
+        EXPECT_EQ(result.adminSubject, 0x1000u + result.firstNocByte);
+    }
+
+    EXPECT_EQ(mIssuer.mMaxRunning, 1);
+    ASSERT_EQ(mIssuer.mThreads.size(), kRequestCount);
+    for (auto id : mIssuer.mThreads)
+    {
+        EXPECT_NE(id, std::this_thread::get_id());
+    }
+    for (auto id : gCompletionThreads)
+    {
+        EXPECT_EQ(id, std::this_thread::get_id());
+    }
+}
+
+TEST_F(TestCommissioningWorkerPool, RequestsFailWithoutWorkers)
+{
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> onVerified(OnAttestationVerified,
+                                                                                                  nullptr);
+    Callback::Callback<OnNOCChainGeneration> onGenerated(OnNOCChainGenerated, nullptr);
+    uint8_t buffer[8] = { 2 };
+    const ByteSpan span(buffer);
+    DeviceAttestationVerifier::AttestationInfo info(span, span, span, span, span, span, VendorId::TestVendor1, 2);
+
+    CommissioningWorkerPool pool;
+    pool.GetDeviceAttestationVerifier()->VerifyAttestationInformation(info, &onVerified);
+    EXPECT_EQ(pool.GetOperationalCredentialsDelegate()->GenerateNOCChain(span, ByteSpan(), ByteSpan(), ByteSpan(),
+                                                                         ByteSpan(), ByteSpan(), &onGenerated),
+              CHIP_ERROR_INCORRECT_STATE);
+
+    // Once shut down, requests still get their callback, right away.
+    ASSERT_EQ(pool.Init(1, mVerifier, mIssuer), CHIP_NO_ERROR);
+    pool.Shutdown();
+    pool.GetDeviceAttestationVerifier()->VerifyAttestationInformation(info, &onVerified);
+    EXPECT_EQ(pool.GetOperationalCredentialsDelegate()->GenerateNOCChain(span, ByteSpan(), ByteSpan(), ByteSpan(),
+                                                                         ByteSpan(), ByteSpan(), &onGenerated),
+              CHIP_NO_ERROR);
+
+    ASSERT_EQ(gAttestationResults.size(), 2u);
+    EXPECT_TRUE(gAttestationResults[0].result == AttestationVerificationResult::kInternalError);
+    EXPECT_TRUE(gAttestationResults[1].result == AttestationVerificationResult::kInternalError);
+    ASSERT_EQ(gNOCChainResults.size(), 1u);
+    EXPECT_EQ(gNOCChainResults[0].status, CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_TRUE(mVerifier.mThreads.empty());
+    EXPECT_TRUE(mIssuer.mThreads.empty());
+}
+
+} // namespace
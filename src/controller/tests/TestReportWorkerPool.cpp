@@ -0,0 +1,185 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/DeferredReportCallback.h>
+#include <controller/ReportWorkerPool.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr ClusterId kTestClusterId     = 6;
+constexpr AttributeId kTestAttributeId = 0;
+
+// Remembers what it was told, in order. Entries are attribute values, or one of the markers below.
+class RecordingCallback : public ReadClient::Callback
+{
+public:
+    static constexpr int64_t kReportBegin             = -1;
+    static constexpr int64_t kReportEnd               = -2;
+    static constexpr int64_t kStatus                  = -3;
+    static constexpr int64_t kSubscriptionEstablished = -4;
+
+    std::vector<int64_t> mLog;
+    std::vector<std::thread::id> mReportThreads;
+
+private:
+    void OnReportBegin() override
+    {
+        mLog.push_back(kReportBegin);
+        mReportThreads.push_back(std::this_thread::get_id());
+    }
+    void OnReportEnd() override { mLog.push_back(kReportEnd); }
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        EXPECT_EQ(aPath.mClusterId, kTestClusterId);
+        if (apData == nullptr)
+        {
+            mLog.push_back(kStatus);
+            return;
+        }
+        uint32_t value = 0;
+        EXPECT_EQ(apData->Get(value), CHIP_NO_ERROR);
+        mLog.push_back(value);
+    }
+    void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override { mLog.push_back(kSubscriptionEstablished); }
+    void OnDone(ReadClient *) override {}
+};
+
+// Deliver a report with the given values for endpoints 0, 1, ... as the ReadClient would.
+void SendReport(ReadClient::Callback & callback, std::initializer_list<uint32_t> values)
+{
+    callback.OnReportBegin();
+    EndpointId endpoint = 0;
+    for (uint32_t value : values)
+    {
+        uint8_t buffer[16];
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+        ASSERT_EQ(writer.Put(TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+        ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+        TLV::TLVReader reader;
+        reader.Init(buffer, writer.GetLengthWritten());
+        ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+        ConcreteDataAttributePath path(endpoint++, kTestClusterId, kTestAttributeId);
+        callback.OnAttributeData(path, &reader, StatusIB());
+
+        // The buffer goes away now, like a packet buffer would.
+        memset(buffer, 0, sizeof(buffer));
+    }
+    callback.OnAttributeData(ConcreteDataAttributePath(endpoint, kTestClusterId, kTestAttributeId), nullptr,
+                             StatusIB(Protocols::InteractionModel::Status::UnsupportedAttribute));
+    callback.OnReportEnd();
+}
+
+std::vector<int64_t> ExpectedLog(std::initializer_list<uint32_t> values)
+{
+    std::vector<int64_t> log;
+    log.push_back(RecordingCallback::kReportBegin);
+    log.insert(log.end(), values.begin(), values.end());
+    log.push_back(RecordingCallback::kStatus);
+    log.push_back(RecordingCallback::kReportEnd);
+    return log;
+}
+
+TEST(TestReportWorkerPool, ReportsAreDeliveredInOrderOnWorkers)
+{
+    Controller::ReportWorkerPool pool;
+    ASSERT_EQ(pool.Init(2), CHIP_NO_ERROR);
+
+    constexpr uint32_t kReportCount = 100;
+    RecordingCallback recorders[3];
+    DeferredReportCallback deferred[3] = { { recorders[0], pool }, { recorders[1], pool }, { recorders[2], pool } };
+
+    for (uint32_t i = 0; i < kReportCount; i++)
+    {
+        for (auto & callback : deferred)
+        {
+            SendReport(callback, { i, i + 1 });
+        }
+    }
+
+    for (size_t n = 0; n < 3; n++)
+    {
+        pool.WaitUntilIdle(deferred[n]);
+
+        std::vector<int64_t> expected;
+        for (uint32_t i = 0; i < kReportCount; i++)
+        {
+            auto report = ExpectedLog({ i, i + 1 });
+            expected.insert(expected.end(), report.begin(), report.end());
+        }
+        EXPECT_EQ(recorders[n].mLog, expected);
+
+        ASSERT_EQ(recorders[n].mReportThreads.size(), kReportCount);
+        for (auto id : recorders[n].mReportThreads)
+        {
+            EXPECT_NE(id, std::this_thread::get_id());
+        }
+    }
+}
+
+TEST(TestReportWorkerPool, OtherCallbacksWaitForReports)
+{
+    Controller::ReportWorkerPool pool;
+    ASSERT_EQ(pool.Init(1), CHIP_NO_ERROR);
+
+    RecordingCallback recorder;
+    DeferredReportCallback deferred(recorder, pool);
+    ReadClient::Callback & callback = deferred;
+
+    SendReport(callback, { 1 });
+    SendReport(callback, { 2 });
+    callback.OnSubscriptionEstablished(1);
+
+    // No need to wait: OnSubscriptionEstablished only got through after both reports.
+    std::vector<int64_t> expected = ExpectedLog({ 1 });
+    auto second                   = ExpectedLog({ 2 });
+    expected.insert(expected.end(), second.begin(), second.end());
+    expected.push_back(RecordingCallback::kSubscriptionEstablished);
+    EXPECT_EQ(recorder.mLog, expected);
+}
+
+TEST(TestReportWorkerPool, ReportsAreDeliveredSynchronouslyWithoutWorkers)
+{
+    Controller::ReportWorkerPool pool;
+    RecordingCallback recorder;
+    DeferredReportCallback deferred(recorder, pool);
+
+    SendReport(deferred, { 7 });
+    EXPECT_EQ(recorder.mLog, ExpectedLog({ 7 }));
+
+    ASSERT_EQ(pool.Init(1), CHIP_NO_ERROR);
+    pool.Shutdown();
+
+    SendReport(deferred, { 8 });
+    ASSERT_EQ(recorder.mReportThreads.size(), 2u);
+    EXPECT_EQ(recorder.mReportThreads[1], std::this_thread::get_id());
+}
+
+} // namespace
@@ -265,6 +265,64 @@ TEST_F(TestRead, TestReadAttributeResponse)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F(TestRead, TestReadAttributeResponseStreaming)
+{
+    ScopedChange directive(gReadResponseDirective, ReadResponseDirective::kSendDataResponse);
+
+    struct Listener : public Controller::TypedStreamingReadCallback::Listener
+    {
+        void OnAttributeStreamed(const ConcreteDataAttributePath & aPath, const Controller::StreamedAttribute & aAttribute) override
+        {
+            EXPECT_EQ(aAttribute.GetAttributeId(), Clusters::UnitTesting::Attributes::ListStructOctetString::Id);
+            // The list items are decoded here, from the report.
+            auto iter = mList.begin();
+            while (iter.Next())
+            {
+                EXPECT_EQ(iter.GetValue().member1, mNumItems);
+                mNumItems++;
+            }
+            EXPECT_EQ(iter.GetStatus(), CHIP_NO_ERROR);
+            mNumAttributes++;
+        }
+
+        void OnStreamError(const ConcreteDataAttributePath * aPath, CHIP_ERROR aError) override { mNumErrors++; }
+
+        void OnStreamDone(ReadClient * apReadClient) override { mDone = true; }
+
+        Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo::DecodableType mList;
+        uint8_t mNumItems  = 0;
+        int mNumAttributes = 0;
+        int mNumErrors     = 0;
+        bool mDone         = false;
+    } listener;
+
+    const Controller::StreamedAttribute attributes[] = {
+        Controller::StreamedAttribute::Into<Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo>(listener.mList),
+    };
+    Controller::TypedStreamingReadCallback callback(Span<const Controller::StreamedAttribute>(attributes), listener);
+
+    AttributePathParams path(kTestEndpointId, Clusters::UnitTesting::Id,
+                             Clusters::UnitTesting::Attributes::ListStructOctetString::Id);
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = &path;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+
+    {
+        ReadClient readClient(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback.GetBufferedCallback(),
+                              ReadClient::InteractionType::Read);
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+    }
+
+    EXPECT_TRUE(listener.mDone);
+    EXPECT_EQ(listener.mNumAttributes, 1);
+    EXPECT_EQ(listener.mNumItems, 4u);
+    EXPECT_EQ(listener.mNumErrors, 0);
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->GetNumActiveReadClients(), 0u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 // NOTE: This test must execute before TestReadSubscribeAttributeResponseWithCache or else it will fail on
 // `EXPECT_TRUE(version1.HasValue() && (version1.Value() == 0))`.
 TEST_F(TestRead, TestReadSubscribeAttributeResponseWithVersionOnlyCache)
@@ -29,6 +29,7 @@
 
 #include <credentials/CHIPCert_Internal.h>
 #include <credentials/CHIPCertificateSet.h>
+#include <credentials/VerifiedCertificateCache.h>
 #include <lib/asn1/ASN1.h>
 #include <lib/asn1/ASN1Macros.h>
 #include <lib/core/CHIPCore.h>
@@ -411,7 +412,19 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
     }
 
     // Verify signature of the current certificate against public key of the CA certificate. If signature verification
-    // succeeds, the current certificate is valid.
+    // succeeds, the current certificate is valid.  ICAC signatures that were verified before are not verified again.
+    if ((certType == CertType::kICA) && (context.mVerifiedCertificates != nullptr))
+    {
+        VerifiedCertificateCache::Digest digest;
+        SuccessOrExit(err = VerifiedCertificateCache::ComputeDigest(*cert, *caCert, digest));
+        if (!context.mVerifiedCertificates->Contains(digest))
+        {
+            SuccessOrExit(err = VerifyCertSignature(*cert, *caCert));
+            context.mVerifiedCertificates->Add(digest);
+        }
+        ExitNow();
+    }
+
     err = VerifyCertSignature(*cert, *caCert);
     SuccessOrExit(err);
 
@@ -500,9 +513,10 @@ bool ChipCertificateData::IsEqual(const ChipCertificateData & other) const
 
 void ValidationContext::Reset()
 {
-    mEffectiveTime  = EffectiveTime{};
-    mTrustAnchor    = nullptr;
-    mValidityPolicy = nullptr;
+    mEffectiveTime        = EffectiveTime{};
+    mTrustAnchor          = nullptr;
+    mValidityPolicy       = nullptr;
+    mVerifiedCertificates = nullptr;
     mRequiredKeyUsages.ClearAll();
     mRequiredKeyPurposes.ClearAll();
     mRequiredCertType = CertType::kNotSpecified;
@@ -37,6 +37,8 @@
 namespace chip {
 namespace Credentials {
 
+class VerifiedCertificateCache;
+
 struct CurrentChipEpochTime : chip::System::Clock::Seconds32
 {
     template <typename... Args>
@@ -75,6 +77,9 @@ struct ValidationContext
     CertificateValidityPolicy * mValidityPolicy =
         nullptr; /**< Optional application policy to apply for certificate validity period evaluation. */
 
+    VerifiedCertificateCache * mVerifiedCertificates =
+        nullptr; /**< Optional cache of verified ICAC signatures, consulted and updated during validation. */
+
     void Reset();
 
     template <typename T>
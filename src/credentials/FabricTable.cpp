@@ -122,9 +122,10 @@ CHIP_ERROR FabricInfo::Init(const FabricInfo::InitParams & initParams)
     mFabricId                = initParams.fabricId;
     mFabricIndex             = initParams.fabricIndex;
     mCompressedFabricId      = initParams.compressedFabricId;
-    mRootPublicKey           = initParams.rootPublicKey;
+    mNocCATs                 = initParams.nocCATs;
     mVendorId                = static_cast<VendorId>(initParams.vendorId);
     mShouldAdvertiseIdentity = initParams.advertiseIdentity;
+    SetRootPublicKey(initParams.rootPublicKey);
 
     // Deal with externally injected keys
     if (initParams.operationalKeypair != nullptr)
@@ -151,6 +152,8 @@ void FabricInfo::operator=(FabricInfo && other)
     mFabricIndex             = other.mFabricIndex;
     mCompressedFabricId      = other.mCompressedFabricId;
     mRootPublicKey           = other.mRootPublicKey;
+    mRootPublicKeyTag        = other.mRootPublicKeyTag;
+    mNocCATs                 = other.mNocCATs;
     mVendorId                = other.mVendorId;
     mShouldAdvertiseIdentity = other.mShouldAdvertiseIdentity;
 
@@ -197,13 +200,17 @@ CHIP_ERROR FabricInfo::LoadFromStorage(PersistentStorageDelegate * storage, Fabr
 {
     mFabricIndex = newFabricIndex;
 
-    // Regenerate operational metadata from NOC/RCAC
+    // Regenerate operational metadata from NOC/RCAC. Each certificate is decoded once, since this runs for every
+    // fabric at boot.
     {
-        ReturnErrorOnFailure(ExtractNodeIdFabricIdFromOpCert(noc, &mNodeId, &mFabricId));
+        ChipCertificateData certData;
 
-        P256PublicKeySpan rootPubKeySpan;
-        ReturnErrorOnFailure(ExtractPublicKeyFromChipCert(rcac, rootPubKeySpan));
-        mRootPublicKey = rootPubKeySpan;
+        ReturnErrorOnFailure(DecodeChipCert(noc, certData));
+        ReturnErrorOnFailure(ExtractNodeIdFabricIdFromOpCert(certData, &mNodeId, &mFabricId));
+        ReturnErrorOnFailure(ExtractCATsFromOpCert(certData, mNocCATs));
+
+        ReturnErrorOnFailure(DecodeChipCert(rcac, certData));
+        SetRootPublicKey(P256PublicKey(certData.mPublicKey));
 
         uint8_t compressedFabricIdBuf[sizeof(uint64_t)];
         MutableByteSpan compressedFabricIdSpan(compressedFabricIdBuf);
@@ -317,7 +324,7 @@ CHIP_ERROR FabricTable::ValidateIncomingNOCChain(const ByteSpan & noc, const Byt
                                                  FabricId existingFabricId, Credentials::CertificateValidityPolicy * policy,
                                                  CompressedFabricId & outCompressedFabricId, FabricId & outFabricId,
                                                  NodeId & outNodeId, Crypto::P256PublicKey & outNocPubkey,
-                                                 Crypto::P256PublicKey & outRootPubkey)
+                                                 Crypto::P256PublicKey & outRootPubkey, CATValues & outNocCATs)
 {
     MATTER_TRACE_SCOPE("ValidateIncomingNOCChain", "Fabric");
     Credentials::ValidationContext validContext;
@@ -346,7 +353,7 @@ CHIP_ERROR FabricTable::ValidateIncomingNOCChain(const ByteSpan & noc, const Byt
 
     ChipLogProgress(FabricProvisioning, "Validating NOC chain");
     CHIP_ERROR err = FabricTable::VerifyCredentials(noc, icac, rcac, validContext, outCompressedFabricId, outFabricId, outNodeId,
-                                                    outNocPubkey, &outRootPubkey);
+                                                    outNocPubkey, &outRootPubkey, &outNocCATs);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(FabricProvisioning, "Failed NOC chain validation, VerifyCredentials returned: %" CHIP_ERROR_FORMAT,
@@ -387,7 +394,8 @@ CHIP_ERROR FabricInfo::FetchRootPubkey(Crypto::P256PublicKey & outPublicKey) con
 
 CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc, ByteSpan icac, ValidationContext & context,
                                           CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
-                                          Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey) const
+                                          Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey,
+                                          CATValues * outNocCATs) const
 {
     MATTER_TRACE_SCOPE("VerifyCredentials", "Fabric");
     assertChipStackLockedByCurrentThread();
@@ -395,12 +403,13 @@ CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc,
     MutableByteSpan rootCertSpan{ rootCertBuf };
     ReturnErrorOnFailure(FetchRootCert(fabricIndex, rootCertSpan));
     return VerifyCredentials(noc, icac, rootCertSpan, context, outCompressedFabricId, outFabricId, outNodeId, outNocPubkey,
-                             outRootPublicKey);
+                             outRootPublicKey, outNocCATs);
 }
 
 CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, ValidationContext & context,
                                           CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
-                                          Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey)
+                                          Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey,
+                                          CATValues * outNocCATs)
 {
     // TODO - Optimize credentials verification logic
     //        The certificate chain construction and verification is a compute and memory intensive operation.
@@ -476,6 +485,11 @@ CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan
         }
     }
 
+    if (outNocCATs != nullptr)
+    {
+        ReturnErrorOnFailure(ExtractCATsFromOpCert(certificates.GetLastCert()[0], *outNocCATs));
+    }
+
     outNocPubkey = certificates.GetLastCert()->mPublicKey;
 
     return CHIP_NO_ERROR;
@@ -493,33 +507,22 @@ const FabricInfo * FabricTable::FindIdentity(const Crypto::P256PublicKey & rootP
 
 const FabricInfo * FabricTable::FindFabricCommon(const Crypto::P256PublicKey & rootPubKey, FabricId fabricId, NodeId nodeId) const
 {
-    P256PublicKey candidatePubKey;
+    // Compare the cheap fields first, so that the root public key is only compared for the fabric that matches.
+    uint16_t rootPubKeyTag = FabricInfo::RootPublicKeyTag(rootPubKey);
+    auto matches           = [&](const FabricInfo & fabric) {
+        return fabric.IsInitialized() && fabricId == fabric.GetFabricId() &&
+            (nodeId == kUndefinedNodeId || nodeId == fabric.GetNodeId()) && fabric.RootPublicKeyMatches(rootPubKey, rootPubKeyTag);
+    };
 
     // Try to match pending fabric first if available
-    if (HasPendingFabricUpdate())
+    if (HasPendingFabricUpdate() && matches(mPendingFabric))
     {
-        bool pubKeyAvailable = (mPendingFabric.FetchRootPubkey(candidatePubKey) == CHIP_NO_ERROR);
-        auto matchingNodeId  = (nodeId == kUndefinedNodeId) ? mPendingFabric.GetNodeId() : nodeId;
-        if (pubKeyAvailable && rootPubKey.Matches(candidatePubKey) && fabricId == mPendingFabric.GetFabricId() &&
-            matchingNodeId == mPendingFabric.GetNodeId())
-        {
-            return &mPendingFabric;
-        }
+        return &mPendingFabric;
     }
 
     for (auto & fabric : mStates)
     {
-        auto matchingNodeId = (nodeId == kUndefinedNodeId) ? fabric.GetNodeId() : nodeId;
-
-        if (!fabric.IsInitialized())
-        {
-            continue;
-        }
-        if (fabric.FetchRootPubkey(candidatePubKey) != CHIP_NO_ERROR)
-        {
-            continue;
-        }
-        if (rootPubKey.Matches(candidatePubKey) && fabricId == fabric.GetFabricId() && matchingNodeId == fabric.GetNodeId())
+        if (matches(fabric))
         {
             return &fabric;
         }
@@ -596,7 +599,7 @@ const FabricInfo * FabricTable::FindFabricWithCompressedId(CompressedFabricId co
             continue;
         }
 
-        if (compressedFabricId == fabric.GetPeerId().GetCompressedFabricId())
+        if (compressedFabricId == fabric.GetCompressedFabricId())
         {
             return &fabric;
         }
@@ -667,10 +670,9 @@ CHIP_ERROR FabricTable::FetchRootPubkey(FabricIndex fabricIndex, Crypto::P256Pub
 
 CHIP_ERROR FabricTable::FetchCATs(const FabricIndex fabricIndex, CATValues & cats) const
 {
-    uint8_t nocBuf[Credentials::kMaxCHIPCertLength];
-    MutableByteSpan nocSpan{ nocBuf };
-    ReturnErrorOnFailure(FetchNOCCert(fabricIndex, nocSpan));
-    ReturnErrorOnFailure(ExtractCATsFromOpCert(nocSpan, cats));
+    const FabricInfo * fabricInfo = FindFabricWithIndex(fabricIndex);
+    VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INVALID_FABRIC_INDEX);
+    cats = fabricInfo->mNocCATs;
     return CHIP_NO_ERROR;
 }
 
@@ -875,7 +877,8 @@ FabricTable::AddOrUpdateInner(FabricIndex fabricIndex, bool isAddition, Crypto::
 
         ReturnErrorOnFailure(ValidateIncomingNOCChain(nocSpan, icacSpan, rcacSpan, fabricIdToValidate, &notBeforeCollector,
                                                       newFabricInfo.compressedFabricId, newFabricInfo.fabricId,
-                                                      newFabricInfo.nodeId, nocPubKey, newFabricInfo.rootPublicKey));
+                                                      newFabricInfo.nodeId, nocPubKey, newFabricInfo.rootPublicKey,
+                                                      newFabricInfo.nocCATs));
     }
 
     if (existingOpKey != nullptr)
@@ -1177,6 +1180,7 @@ void FabricTable::Shutdown()
         // direct lookups fail.
         fabricInfo.Reset();
     }
+    mVerifiedCertificates.Clear();
 
     mStorage = nullptr;
 }
@@ -1500,7 +1504,11 @@ CHIP_ERROR FabricTable::GetCommitMarker(CommitMarker & outCommitMarker)
 
 void FabricTable::ClearCommitMarker()
 {
-    TEMPORARY_RETURN_IGNORED mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricTableCommitMarkerKey().KeyName());
+    // The commit is complete once the data is written, so the marker can go away in the background: asynchronous writes
+    // reach storage in order, so it never disappears before the data it guards. The writes of the commit itself stay
+    // synchronous, since a failure to make them durable must fail the commit.
+    TEMPORARY_RETURN_IGNORED mStorage->AsyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricTableCommitMarkerKey().KeyName(),
+                                                           PersistentStorageDelegate::LogAsyncFailure, nullptr);
 }
 
 bool FabricTable::HasOperationalKeyForFabric(FabricIndex fabricIndex) const
@@ -1956,6 +1964,10 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
         // This scope block is to illustrate the complete commit transaction
         // state. We can see it contains a LARGE number of items...
 
+        // The commit marker is already on storage; everything else is written in one storage
+        // batch, atomically if the storage supports it.
+        PersistentStorageBatch storageBatch(*mStorage);
+
         // Atomically assume data no longer pending, since we are committing it. Do so here
         // so that FindFabricBy* will return real data and never pending.
         mStateFlags.Clear(StateFlags::kIsPendingFabricDataPresent);
@@ -2050,6 +2062,13 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
             }
         }
         stickyError = (stickyError != CHIP_NO_ERROR) ? stickyError : fabricIndexErr;
+
+        CHIP_ERROR batchErr = storageBatch.Commit();
+        if (batchErr != CHIP_NO_ERROR)
+        {
+            ChipLogError(FabricProvisioning, "Failed to write committed fabric data: %" CHIP_ERROR_FORMAT, batchErr.Format());
+        }
+        stickyError = (stickyError != CHIP_NO_ERROR) ? stickyError : batchErr;
     }
 
     // Commit must have same side-effect as reverting all pending data
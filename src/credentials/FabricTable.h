@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
+#include <credentials/VerifiedCertificateCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/OperationalKeystore.h>
 #include <lib/core/CHIPEncoding.h>
@@ -124,6 +125,7 @@ private:
         Crypto::P256Keypair * operationalKeypair = nullptr;
         FabricId fabricId                        = kUndefinedFabricId;
         Crypto::P256PublicKey rootPublicKey;
+        CATValues nocCATs;
         VendorId vendorId              = VendorId::NotSpecified; /**< Vendor ID for commissioner of fabric */
         bool hasExternallyOwnedKeypair = false;
         bool advertiseIdentity         = false;
@@ -198,6 +200,7 @@ private:
         mFabricId           = kUndefinedFabricId;
         mFabricIndex        = kUndefinedFabricIndex;
         mCompressedFabricId = kUndefinedCompressedFabricId;
+        mNocCATs            = CATValues();
 
         mVendorId       = VendorId::NotSpecified;
         mFabricLabel[0] = '\0';
@@ -216,6 +219,23 @@ private:
 
     void SetShouldAdvertiseIdentity(bool advertiseIdentity) { mShouldAdvertiseIdentity = advertiseIdentity; }
 
+    void SetRootPublicKey(const Crypto::P256PublicKey & rootPublicKey)
+    {
+        mRootPublicKey    = rootPublicKey;
+        mRootPublicKeyTag = RootPublicKeyTag(rootPublicKey);
+    }
+
+    // Root public keys are uniformly distributed points, so the start of their X coordinate is a good enough hash.
+    static uint16_t RootPublicKeyTag(const Crypto::P256PublicKey & rootPublicKey)
+    {
+        return Encoding::BigEndian::Get16(rootPublicKey.ConstBytes() + 1);
+    }
+
+    bool RootPublicKeyMatches(const Crypto::P256PublicKey & rootPublicKey, uint16_t rootPublicKeyTag) const
+    {
+        return mRootPublicKeyTag == rootPublicKeyTag && mRootPublicKey.Matches(rootPublicKey);
+    }
+
     static constexpr size_t MetadataTLVMaxSize()
     {
         return TLV::EstimateStructOverhead(sizeof(uint16_t), kFabricLabelMaxLengthInBytes);
@@ -232,6 +252,8 @@ private:
     CompressedFabricId mCompressedFabricId = kUndefinedCompressedFabricId;
     // We cache the root public key since it's used so often and costly to get.
     Crypto::P256PublicKey mRootPublicKey;
+    // We cache the NOC CATs so that they do not need the NOC to be read from storage and decoded.
+    CATValues mNocCATs;
 
     // mFabricLabel is 33 bytes, so ends on a 1 mod 4 byte boundary.
     char mFabricLabel[kFabricLabelMaxLengthInBytes + 1] = { '\0' };
@@ -245,8 +267,11 @@ private:
     bool mHasExternallyOwnedOperationalKey = false;
     bool mShouldAdvertiseIdentity          = true;
 
-    // 2 bytes of padding here, since mOperationalKey needs to be void*-aligned,
-    // so has to be at a 0 mod 4 byte location.
+    // Tag of mRootPublicKey, so that lookups by root public key only compare
+    // the full key of fabrics that are likely to match.  It fills the 2 bytes
+    // that would otherwise be padding before mOperationalKey, which needs to be
+    // void*-aligned, so has to be at a 0 mod 4 byte location.
+    uint16_t mRootPublicKeyTag = 0;
 
     mutable Crypto::P256Keypair * mOperationalKey = nullptr;
 
@@ -1010,12 +1035,22 @@ public:
     // Verifies credentials, using the root certificate of the provided fabric index.
     CHIP_ERROR VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc, ByteSpan icac, Credentials::ValidationContext & context,
                                  CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
-                                 Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr) const;
+                                 Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr,
+                                 CATValues * outNocCATs = nullptr) const;
 
     // Verifies credentials, using the provided root certificate.
+    // The NOC CATs, if requested, come from the NOC decoded for verification, so callers do not need to decode it again.
     static CHIP_ERROR VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, Credentials::ValidationContext & context,
                                         CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
-                                        Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr);
+                                        Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr,
+                                        CATValues * outNocCATs = nullptr);
+
+    /**
+     * ICAC signatures verified during CASE session establishment, see Credentials::ValidationContext::mVerifiedCertificates.
+     * Only to be used on the Matter thread.
+     */
+    Credentials::VerifiedCertificateCache & GetVerifiedCertificateCache() { return mVerifiedCertificates; }
+
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1263,7 +1298,7 @@ private:
                                                FabricId existingFabricId, Credentials::CertificateValidityPolicy * policy,
                                                CompressedFabricId & outCompressedFabricId, FabricId & outFabricId,
                                                NodeId & outNodeId, Crypto::P256PublicKey & outNocPubkey,
-                                               Crypto::P256PublicKey & outRootPubkey);
+                                               Crypto::P256PublicKey & outRootPubkey, CATValues & outNocCATs);
 
     /**
      * Read our fabric index info from the given TLV reader and set up the
@@ -1298,6 +1333,8 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+    Credentials::VerifiedCertificateCache mVerifiedCertificates;
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
@@ -832,6 +832,9 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+    InvalidateGroupSessionIndex();
+    InvalidateIpkCache();
+    InvalidateGroupMembershipIndex();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
@@ -895,6 +898,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfo(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index, size_t index, const GroupInfo & info)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupMembershipIndex();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -977,6 +981,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupInfoAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfoAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupMembershipIndex();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1025,6 +1030,21 @@ bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::Gr
 {
     VerifyOrReturnError(IsInitialized(), false);
 
+#if CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE > 0
+    if (PrepareGroupMembershipIndex())
+    {
+        for (size_t i = 0; i < mGroupMembershipIndexCount; i++)
+        {
+            const GroupMembershipIndexEntry & entry = mGroupMembershipIndex[i];
+            if (entry.fabric_index == fabric_index && entry.group_id == group_id && entry.endpoint_id == endpoint_id)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+#endif // CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE > 0
+
     FabricData fabric(fabric_index);
     GroupData group;
     EndpointData endpoint;
@@ -1037,6 +1057,7 @@ bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::Gr
 CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, chip::GroupId group_id, chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupMembershipIndex();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1095,6 +1116,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
                                                  chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupMembershipIndex();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1135,6 +1157,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    PersistentStorageBatch batch(*mStorage);
     FabricData fabric(fabric_index);
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
@@ -1160,7 +1183,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
         group_index++;
     }
 
-    return CHIP_NO_ERROR;
+    return batch.Commit();
 }
 
 GroupDataProvider::GroupInfoIterator * GroupDataProviderImpl::IterateGroupInfo(chip::FabricIndex fabric_index)
@@ -1219,24 +1242,38 @@ GroupDataProviderImpl::EndpointIteratorImpl::EndpointIteratorImpl(GroupDataProvi
     mProvider(provider),
     mFabric(fabric_index)
 {
-    FabricData fabric(fabric_index);
-    VerifyOrReturn(CHIP_NO_ERROR == fabric.Load(provider.mStorage));
-
     if (group_id.has_value())
     {
-        GroupData group(fabric_index, *group_id);
-        VerifyOrReturn(CHIP_NO_ERROR == group.Load(provider.mStorage));
+        mSingleGroup = true;
+        mFirstGroup  = *group_id;
+    }
+
+    mUseIndex   = provider.PrepareGroupMembershipIndex();
+    mGeneration = provider.mGroupMembershipIndexGeneration;
+    VerifyOrReturn(!mUseIndex);
+
+    StartFromStorage();
+}
+
+void GroupDataProviderImpl::EndpointIteratorImpl::StartFromStorage()
+{
+    FabricData fabric(mFabric);
+    VerifyOrReturn(CHIP_NO_ERROR == fabric.Load(mProvider.mStorage));
 
-        mGroup         = *group_id;
-        mFirstGroup    = *group_id;
+    if (mSingleGroup)
+    {
+        GroupData group(mFabric, mFirstGroup);
+        VerifyOrReturn(CHIP_NO_ERROR == group.Load(mProvider.mStorage));
+
+        mGroup         = mFirstGroup;
         mGroupCount    = 1;
         mEndpoint      = group.first_endpoint;
         mEndpointCount = group.endpoint_count;
     }
     else
     {
-        GroupData group(fabric_index, fabric.first_group);
-        VerifyOrReturn(CHIP_NO_ERROR == group.Load(provider.mStorage));
+        GroupData group(mFabric, fabric.first_group);
+        VerifyOrReturn(CHIP_NO_ERROR == group.Load(mProvider.mStorage));
 
         mGroup         = fabric.first_group;
         mFirstGroup    = fabric.first_group;
@@ -1246,8 +1283,44 @@ GroupDataProviderImpl::EndpointIteratorImpl::EndpointIteratorImpl(GroupDataProvi
     }
 }
 
+void GroupDataProviderImpl::EndpointIteratorImpl::CheckIndex()
+{
+    VerifyOrReturn(mUseIndex && mGeneration != mProvider.mGroupMembershipIndexGeneration);
+
+    // The groups changed since the index was read: continue from storage, after the last mapping returned if any.
+    mUseIndex                   = false;
+    const uint16_t group        = mGroup;
+    const uint16_t endpoint     = mEndpoint;
+    const size_t group_index    = mGroupIndex;
+    const size_t endpoint_index = mEndpointIndex;
+    const size_t endpoint_count = mEndpointCount;
+    const bool returned_mapping = !mFirstEndpoint;
+
+    StartFromStorage();
+    if (returned_mapping)
+    {
+        mGroup         = group;
+        mEndpoint      = endpoint;
+        mGroupIndex    = group_index;
+        mEndpointIndex = endpoint_index;
+        mEndpointCount = endpoint_count;
+        mFirstEndpoint = false;
+    }
+}
+
 size_t GroupDataProviderImpl::EndpointIteratorImpl::Count()
 {
+    CheckIndex();
+    if (mUseIndex)
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < mProvider.mGroupMembershipIndexCount; i++)
+        {
+            count += MatchesIndexEntry(i) ? 1 : 0;
+        }
+        return count;
+    }
+
     GroupData group(mFabric, mFirstGroup);
     size_t group_index    = 0;
     size_t endpoint_index = 0;
@@ -1275,8 +1348,47 @@ size_t GroupDataProviderImpl::EndpointIteratorImpl::Count()
     return count;
 }
 
+bool GroupDataProviderImpl::EndpointIteratorImpl::MatchesIndexEntry(size_t position) const
+{
+#if CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE > 0
+    const GroupMembershipIndexEntry & entry = mProvider.mGroupMembershipIndex[position];
+    return entry.fabric_index == mFabric && (!mSingleGroup || entry.group_id == mFirstGroup);
+#else
+    return false;
+#endif // CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE > 0
+}
+
 bool GroupDataProviderImpl::EndpointIteratorImpl::Next(GroupEndpoint & output)
 {
+    CheckIndex();
+#if CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE > 0
+    if (mUseIndex)
+    {
+        while (mIndexPosition < mProvider.mGroupMembershipIndexCount)
+        {
+            const size_t position = mIndexPosition++;
+            if (!MatchesIndexEntry(position))
+            {
+                continue;
+            }
+
+            // Keep the position that iterating the storage would have, in case the index changes.
+            const GroupMembershipIndexEntry & entry = mProvider.mGroupMembershipIndex[position];
+            mGroup                                  = entry.group_id;
+            mGroupIndex                             = mSingleGroup ? 0 : entry.group_position;
+            mEndpoint                               = entry.next_endpoint;
+            mEndpointIndex                          = static_cast<size_t>(entry.endpoint_position + 1);
+            mEndpointCount                          = entry.endpoint_count;
+            mFirstEndpoint                          = false;
+
+            output.group_id    = entry.group_id;
+            output.endpoint_id = entry.endpoint_id;
+            return true;
+        }
+        return false;
+    }
+#endif // CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE > 0
+
     while (mGroupIndex < mGroupCount)
     {
         GroupData group(mFabric, mGroup);
@@ -1319,6 +1431,7 @@ void GroupDataProviderImpl::EndpointIteratorImpl::Release()
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index, chip::GroupId group_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupMembershipIndex();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1326,6 +1439,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
     VerifyOrReturnError(group.Find(mStorage, fabric, group_id), CHIP_ERROR_KEY_NOT_FOUND);
 
+    PersistentStorageBatch batch(*mStorage);
     EndpointData endpoint(fabric_index, group.group_id, group.first_endpoint);
     size_t endpoint_index = 0;
     while (endpoint_index < group.endpoint_count)
@@ -1339,7 +1453,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
     group.endpoint_count = 0;
     ReturnErrorOnFailure(group.Save(mStorage));
 
-    return CHIP_NO_ERROR;
+    return batch.Commit();
 }
 
 //
@@ -1349,6 +1463,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1415,6 +1530,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1447,10 +1563,12 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
 
+    PersistentStorageBatch batch(*mStorage);
     size_t count = 0;
     KeyMapData map(fabric_index, fabric.first_map);
     while (count++ < fabric.map_count)
@@ -1466,7 +1584,8 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index
     // Update fabric
     fabric.first_map = 0;
     fabric.map_count = 0;
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    return batch.Commit();
 }
 
 GroupDataProvider::GroupKeyIterator * GroupDataProviderImpl::IterateGroupKeys(chip::FabricIndex fabric_index)
@@ -1523,6 +1642,8 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
+    InvalidateIpkCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1594,6 +1715,8 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
+    InvalidateIpkCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1695,6 +1818,10 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateGroupSessionIndex();
+    InvalidateIpkCache();
+    InvalidateGroupMembershipIndex();
+
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1702,6 +1829,9 @@ CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
     CHIP_ERROR err = fabric.Load(mStorage);
     VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
 
+    // All of the fabric's keys go away in a single storage batch
+    PersistentStorageBatch batch(*mStorage);
+
     // Remove Group mappings
 
     for (size_t i = 0; i < fabric.map_count; i++)
@@ -1734,7 +1864,9 @@ CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
     }
 
     // Remove fabric
-    return fabric.Delete(mStorage);
+    err                  = fabric.Delete(mStorage);
+    CHIP_ERROR commitErr = batch.Commit();
+    return (err != CHIP_NO_ERROR) ? err : commitErr;
 }
 
 //
@@ -1771,6 +1903,22 @@ Crypto::SymmetricKeyContext * GroupDataProviderImpl::GetKeyContext(FabricIndex f
 
 CHIP_ERROR GroupDataProviderImpl::GetIpkKeySet(FabricIndex fabric_index, KeySet & out_keyset)
 {
+#if CHIP_CONFIG_IPK_CACHE_SIZE > 0
+    IpkCacheEntry * free_entry = nullptr;
+    for (IpkCacheEntry & entry : mIpkCache)
+    {
+        if (entry.fabric_index == fabric_index)
+        {
+            out_keyset = entry.keyset;
+            return CHIP_NO_ERROR;
+        }
+        if (free_entry == nullptr && entry.fabric_index == kUndefinedFabricIndex)
+        {
+            free_entry = &entry;
+        }
+    }
+#endif // CHIP_CONFIG_IPK_CACHE_SIZE > 0
+
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_NOT_FOUND);
 
@@ -1797,6 +1945,14 @@ CHIP_ERROR GroupDataProviderImpl::GetIpkKeySet(FabricIndex fabric_index, KeySet
         }
     }
 
+#if CHIP_CONFIG_IPK_CACHE_SIZE > 0
+    if (free_entry != nullptr)
+    {
+        free_entry->fabric_index = fabric_index;
+        free_entry->keyset       = out_keyset;
+    }
+#endif // CHIP_CONFIG_IPK_CACHE_SIZE > 0
+
     return CHIP_NO_ERROR;
 }
 
@@ -1845,6 +2001,9 @@ GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGrou
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+    mUseIndex = provider.PrepareGroupSessionIndex();
+    VerifyOrReturn(!mUseIndex);
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1860,6 +2019,16 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
+    if (mUseIndex)
+    {
+        size_t position = 0;
+        while (mProvider.NextGroupSessionIndexEntry(mSessionId, position) != nullptr)
+        {
+            count++;
+        }
+        return count;
+    }
+
     for (size_t i = 0; i < mFabricTotal; i++, fabric.fabric_index = fabric.next)
     {
         if (CHIP_NO_ERROR != fabric.Load(mProvider.mStorage))
@@ -1898,6 +2067,19 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+    if (mUseIndex)
+    {
+        const GroupSessionIndexEntry * entry = mProvider.NextGroupSessionIndexEntry(mSessionId, mIndexPosition);
+        VerifyOrReturnError(entry != nullptr, false);
+
+        TEMPORARY_RETURN_IGNORED mGroupKeyContext.Initialize(entry->encryption_key, mSessionId, entry->privacy_key);
+        output.fabric_index    = entry->fabric_index;
+        output.group_id        = entry->group_id;
+        output.security_policy = entry->security_policy;
+        output.keyContext      = &mGroupKeyContext;
+        return true;
+    }
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -1956,6 +2138,165 @@ void GroupDataProviderImpl::GroupSessionIteratorImpl::Release()
     mProvider.mGroupSessionsIterator.ReleaseObject(this);
 }
 
+bool GroupDataProviderImpl::PrepareGroupSessionIndex()
+{
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    if (mGroupSessionIndexState != IndexState::kStale)
+    {
+        return mGroupSessionIndexState == IndexState::kValid;
+    }
+
+    // NOT_FOUND means that no fabric has group data yet, and leaves the list empty.
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    VerifyOrReturnValue(err == CHIP_NO_ERROR || err == CHIP_ERROR_NOT_FOUND, false);
+
+    // Same traversal as GroupSessionIteratorImpl::Next(), for all the session IDs at once. If the storage cannot be
+    // read completely, the index is not used and the iterators report what they can read from storage.
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        VerifyOrReturnValue(CHIP_NO_ERROR == fabric.Load(mStorage), false, InvalidateGroupSessionIndex());
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            VerifyOrReturnValue(CHIP_NO_ERROR == mapping.Load(mStorage), false, InvalidateGroupSessionIndex());
+
+            KeySetData keyset;
+            VerifyOrReturnValue(keyset.Find(mStorage, fabric, mapping.keyset_id), false, InvalidateGroupSessionIndex());
+
+            for (uint16_t k = 0; k < keyset.keys_count && k < KeySet::kEpochKeysMax; ++k)
+            {
+                if (mGroupSessionIndexCount >= MATTER_ARRAY_SIZE(mGroupSessionIndex))
+                {
+                    InvalidateGroupSessionIndex();
+                    mGroupSessionIndexState = IndexState::kOverflowed;
+                    return false;
+                }
+
+                const Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[k];
+                GroupSessionIndexEntry & entry                    = mGroupSessionIndex[mGroupSessionIndexCount++];
+                entry.fabric_index                                = fabric.fabric_index;
+                entry.group_id                                    = mapping.group_id;
+                entry.security_policy                             = keyset.policy;
+                entry.session_id                                  = creds.hash;
+                memcpy(entry.encryption_key, creds.encryption_key, sizeof(entry.encryption_key));
+                memcpy(entry.privacy_key, creds.privacy_key, sizeof(entry.privacy_key));
+            }
+        }
+    }
+
+    mGroupSessionIndexState = IndexState::kValid;
+    return true;
+#else
+    return false;
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+}
+
+bool GroupDataProviderImpl::PrepareGroupMembershipIndex()
+{
+#if CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE > 0
+    if (mGroupMembershipIndexState != IndexState::kStale)
+    {
+        return mGroupMembershipIndexState == IndexState::kValid;
+    }
+
+    // NOT_FOUND means that no fabric has group data yet, and leaves the list empty.
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    VerifyOrReturnValue(err == CHIP_NO_ERROR || err == CHIP_ERROR_NOT_FOUND, false);
+
+    // Same traversal as EndpointIteratorImpl::Next(), for all the fabrics at once. If the storage cannot be read
+    // completely, the index is not used and the iterators report what they can read from storage.
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        VerifyOrReturnValue(CHIP_NO_ERROR == fabric.Load(mStorage), false, InvalidateGroupMembershipIndex());
+
+        GroupData group(fabric.fabric_index, fabric.first_group);
+        for (uint16_t j = 0; j < fabric.group_count; ++j, group.group_id = group.next)
+        {
+            VerifyOrReturnValue(CHIP_NO_ERROR == group.Load(mStorage), false, InvalidateGroupMembershipIndex());
+
+            EndpointData endpoint(fabric.fabric_index, group.group_id, group.first_endpoint);
+            for (uint16_t k = 0; k < group.endpoint_count; ++k, endpoint.endpoint_id = endpoint.next)
+            {
+                VerifyOrReturnValue(CHIP_NO_ERROR == endpoint.Load(mStorage), false, InvalidateGroupMembershipIndex());
+
+                if (mGroupMembershipIndexCount >= MATTER_ARRAY_SIZE(mGroupMembershipIndex))
+                {
+                    InvalidateGroupMembershipIndex();
+                    mGroupMembershipIndexState = IndexState::kOverflowed;
+                    return false;
+                }
+
+                GroupMembershipIndexEntry & entry = mGroupMembershipIndex[mGroupMembershipIndexCount++];
+                entry.fabric_index                = fabric.fabric_index;
+                entry.group_id                    = group.group_id;
+                entry.endpoint_id                 = endpoint.endpoint_id;
+                entry.next_endpoint               = endpoint.next;
+                entry.group_position              = j;
+                entry.endpoint_position           = k;
+                entry.endpoint_count              = group.endpoint_count;
+            }
+        }
+    }
+
+    mGroupMembershipIndexState = IndexState::kValid;
+    return true;
+#else
+    return false;
+#endif // CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE > 0
+}
+
+void GroupDataProviderImpl::InvalidateGroupMembershipIndex()
+{
+    mGroupMembershipIndexCount = 0;
+    mGroupMembershipIndexState = IndexState::kStale;
+    mGroupMembershipIndexGeneration++;
+}
+
+void GroupDataProviderImpl::InvalidateIpkCache()
+{
+#if CHIP_CONFIG_IPK_CACHE_SIZE > 0
+    for (IpkCacheEntry & entry : mIpkCache)
+    {
+        entry.keyset.ClearKeys();
+        entry.fabric_index = kUndefinedFabricIndex;
+    }
+#endif // CHIP_CONFIG_IPK_CACHE_SIZE > 0
+}
+
+void GroupDataProviderImpl::InvalidateGroupSessionIndex()
+{
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    for (size_t i = 0; i < mGroupSessionIndexCount; i++)
+    {
+        Crypto::ClearSecretData(mGroupSessionIndex[i].encryption_key);
+        Crypto::ClearSecretData(mGroupSessionIndex[i].privacy_key);
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    mGroupSessionIndexCount = 0;
+    mGroupSessionIndexState = IndexState::kStale;
+}
+
+const GroupDataProviderImpl::GroupSessionIndexEntry *
+GroupDataProviderImpl::NextGroupSessionIndexEntry(uint16_t session_id, size_t & position) const
+{
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    while (position < mGroupSessionIndexCount)
+    {
+        const GroupSessionIndexEntry & entry = mGroupSessionIndex[position++];
+        if (entry.session_id == session_id)
+        {
+            return &entry;
+        }
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    return nullptr;
+}
+
 namespace {
 
 GroupDataProvider * gGroupsProvider = nullptr;
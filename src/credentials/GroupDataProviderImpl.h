@@ -33,7 +33,11 @@ public:
     GroupDataProviderImpl(uint16_t maxGroupsPerFabric, uint16_t maxGroupKeysPerFabric) :
         GroupDataProvider(maxGroupsPerFabric, maxGroupKeysPerFabric)
     {}
-    ~GroupDataProviderImpl() override {}
+    ~GroupDataProviderImpl() override
+    {
+        InvalidateGroupSessionIndex();
+        InvalidateIpkCache();
+    }
 
     /**
      * @brief Set the storage implementation used for non-volatile storage of configuration data.
@@ -139,6 +143,11 @@ protected:
         void Release() override;
 
     protected:
+        void StartFromStorage();
+        // Switches to storage if the group membership index changed since the iterator last read it.
+        void CheckIndex();
+        bool MatchesIndexEntry(size_t position) const;
+
         GroupDataProviderImpl & mProvider;
         FabricIndex mFabric   = kUndefinedFabricIndex;
         GroupId mFirstGroup   = kUndefinedGroupId;
@@ -149,6 +158,12 @@ protected:
         size_t mEndpointIndex = 0;
         size_t mEndpointCount = 0;
         bool mFirstEndpoint   = true;
+        bool mSingleGroup     = false;
+        // Whether the mappings come from the provider's group membership index rather than from storage. The iterator
+        // keeps the storage position up to date, and continues from storage if the index changes while iterating.
+        bool mUseIndex        = false;
+        size_t mIndexPosition = 0;
+        uint32_t mGeneration  = 0; // of the index when the iterator last read it
     };
 
     class GroupKeyContext : public Crypto::SymmetricKeyContext
@@ -241,10 +256,64 @@ protected:
         uint16_t mKeyIndex       = 0;
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
+        // Whether the sessions come from the provider's group session index rather than from storage
+        bool mUseIndex        = false;
+        size_t mIndexPosition = 0;
         GroupKeyContext mGroupKeyContext;
     };
+
+    // In-memory copy of the group sessions of all fabrics, so that incoming group messages do not need
+    // any persistent storage access. Built on first use and dropped whenever key mappings or keysets change.
+    struct GroupSessionIndexEntry
+    {
+        FabricIndex fabric_index;
+        GroupId group_id;
+        SecurityPolicy security_policy;
+        uint16_t session_id;
+        Crypto::Symmetric128BitsKeyByteArray encryption_key;
+        Crypto::Symmetric128BitsKeyByteArray privacy_key;
+    };
+
+    enum class IndexState : uint8_t
+    {
+        kStale,     // Needs to be rebuilt from storage before use
+        kValid,     // Holds all the entries
+        kOverflowed // Too many entries, storage has to be used until the next change
+    };
+
+    // In-memory copy of the group endpoints of all fabrics, in storage order, so that HasEndpoint() and the endpoint
+    // iterators used when processing group messages do not need any persistent storage access. Built on first use and
+    // dropped whenever groups or their endpoints change, storage remaining the source of truth.
+    struct GroupMembershipIndexEntry
+    {
+        FabricIndex fabric_index;
+        GroupId group_id;
+        EndpointId endpoint_id;
+        EndpointId next_endpoint;
+        uint16_t group_position;
+        uint16_t endpoint_position;
+        uint16_t endpoint_count;
+    };
+
+    // In-memory copy of the IPK keyset of a fabric, so that matching the destination ID of incoming CASE Sigma1
+    // messages does not need any persistent storage access. Filled on first use and dropped whenever keysets change.
+    struct IpkCacheEntry
+    {
+        FabricIndex fabric_index = kUndefinedFabricIndex;
+        KeySet keyset;
+    };
+
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
+    // Returns true if the group session index is usable, rebuilding it first if needed.
+    bool PrepareGroupSessionIndex();
+    void InvalidateGroupSessionIndex();
+    void InvalidateIpkCache();
+    // Returns true if the group membership index is usable, rebuilding it first if needed.
+    bool PrepareGroupMembershipIndex();
+    void InvalidateGroupMembershipIndex();
+    // Returns the next index entry for session_id, starting at position, and moves position past it.
+    const GroupSessionIndexEntry * NextGroupSessionIndexEntry(uint16_t session_id, size_t & position) const;
 
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
@@ -254,6 +323,21 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    GroupSessionIndexEntry mGroupSessionIndex[CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE];
+#endif
+    size_t mGroupSessionIndexCount     = 0;
+    IndexState mGroupSessionIndexState = IndexState::kStale;
+#if CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE > 0
+    GroupMembershipIndexEntry mGroupMembershipIndex[CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE];
+#endif
+    size_t mGroupMembershipIndexCount     = 0;
+    IndexState mGroupMembershipIndexState = IndexState::kStale;
+    // Bumped whenever the group membership index is dropped, so that iterators notice it changed.
+    uint32_t mGroupMembershipIndexGeneration = 0;
+#if CHIP_CONFIG_IPK_CACHE_SIZE > 0
+    IpkCacheEntry mIpkCache[CHIP_CONFIG_IPK_CACHE_SIZE];
+#endif
 };
 
 } // namespace Credentials
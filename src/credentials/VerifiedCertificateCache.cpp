@@ -0,0 +1,84 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/VerifiedCertificateCache.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Credentials {
+
+CHIP_ERROR VerifiedCertificateCache::ComputeDigest(const ChipCertificateData & cert, const ChipCertificateData & signer,
+                                                   Digest & outDigest)
+{
+    VerifyOrReturnError(cert.mCertFlags.Has(CertFlags::kTBSHashPresent), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Crypto::Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(cert.mTBSHash)));
+    ReturnErrorOnFailure(hash.AddData(cert.mSignature));
+    ReturnErrorOnFailure(hash.AddData(signer.mPublicKey));
+
+    MutableByteSpan digestSpan(outDigest.data(), outDigest.size());
+    return hash.Finish(digestSpan);
+}
+
+bool VerifiedCertificateCache::Contains(const Digest & digest) const
+{
+    for (size_t i = 0; i < mCount; i++)
+    {
+        if (mEntries[i] == digest)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void VerifiedCertificateCache::Add(const Digest & digest)
+{
+    VerifyOrReturn(kCapacity > 0 && !Contains(digest));
+
+    if (mCount < kCapacity)
+    {
+        mEntries[mCount++] = digest;
+        return;
+    }
+
+    mEntries[mNext] = digest;
+    if (++mNext == kCapacity)
+    {
+        mNext = 0;
+    }
+}
+
+void VerifiedCertificateCache::Add(const VerifiedCertificateCache & other)
+{
+    for (size_t i = 0; i < other.mCount; i++)
+    {
+        Add(other.mEntries[i]);
+    }
+}
+
+void VerifiedCertificateCache::Clear()
+{
+    mCount = 0;
+    mNext  = 0;
+}
+
+} // namespace Credentials
+} // namespace chip
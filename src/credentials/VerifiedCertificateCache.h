@@ -0,0 +1,70 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @brief Defines a bounded cache of certificate signatures that were already verified.
+ */
+
+#pragma once
+
+#include <credentials/CHIPCert.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+
+#include <array>
+#include <cstddef>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * Signatures of intermediate CA certificates that were verified against the public key of their issuer, so that the many
+ * operational certificate chains sharing an ICAC do not each pay for verifying its signature again.
+ *
+ * An entry is a digest of the certificate's TBS hash, its signature and the public key of the issuer, so it only matches when
+ * exactly that certificate is checked against exactly that key.  Everything else about the chain (links, validity period,
+ * key usage) is still checked on every validation.  When the cache is full, the oldest entry is replaced.
+ *
+ * The cache is not thread-safe.  Validation in the background is expected to use a copy, merged back afterwards with Add.
+ */
+class VerifiedCertificateCache
+{
+public:
+    static constexpr size_t kCapacity = CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE;
+
+    using Digest = std::array<uint8_t, Crypto::kSHA256_Hash_Length>;
+
+    static CHIP_ERROR ComputeDigest(const ChipCertificateData & cert, const ChipCertificateData & signer, Digest & outDigest);
+
+    bool Contains(const Digest & digest) const;
+    void Add(const Digest & digest);
+
+    // Add the entries of another cache, typically a copy that was used in the background, that are not in this one.
+    void Add(const VerifiedCertificateCache & other);
+
+    void Clear();
+
+private:
+    // Entries [0, mCount) are in use; mNext is the one to replace once all are.
+    Digest mEntries[kCapacity > 0 ? kCapacity : 1];
+    size_t mCount = 0;
+    size_t mNext  = 0;
+};
+
+} // namespace Credentials
+} // namespace chip
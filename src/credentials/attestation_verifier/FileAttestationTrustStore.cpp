@@ -48,11 +48,30 @@ FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStoreP
     {
         mPAADerCerts = LoadAllX509DerCerts(paaTrustStorePath);
         VerifyOrReturn(paaCount());
+        BuildSkidIndex();
     }
 
     mIsInitialized = true;
 }
 
+void FileAttestationTrustStore::BuildSkidIndex()
+{
+    mPAAIndexBySkid.clear();
+    mPAAIndexBySkid.reserve(mPAADerCerts.size());
+    for (size_t i = 0; i < mPAADerCerts.size(); i++)
+    {
+        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
+        MutableByteSpan skidSpan{ skidBuf };
+        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ mPAADerCerts[i].data(), mPAADerCerts[i].size() }, skidSpan))
+        {
+            continue;
+        }
+
+        // Like the linear search this replaces, the first certificate with a given SKID wins.
+        mPAAIndexBySkid.emplace(std::string(reinterpret_cast<const char *>(skidSpan.data()), skidSpan.size()), i);
+    }
+}
+
 std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath, CertificateValidationMode validationMode)
 {
     std::vector<std::vector<uint8_t>> certs;
@@ -141,6 +160,7 @@ FileAttestationTrustStore::~FileAttestationTrustStore()
 void FileAttestationTrustStore::Cleanup()
 {
     mPAADerCerts.clear();
+    mPAAIndexBySkid.clear();
     mIsInitialized = false;
 }
 
@@ -158,23 +178,11 @@ CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const B
     VerifyOrReturnError(!skid.empty() && (skid.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(skid.size() == Crypto::kSubjectKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto candidate : mPAADerCerts)
-    {
-        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
-        MutableByteSpan candidateSkidSpan{ skidBuf };
-        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, candidateSkidSpan))
-        {
-            continue;
-        }
-
-        if (skid.data_equal(candidateSkidSpan))
-        {
-            // Found a match
-            return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
-        }
-    }
+    auto match = mPAAIndexBySkid.find(std::string(reinterpret_cast<const char *>(skid.data()), skid.size()));
+    VerifyOrReturnError(match != mPAAIndexBySkid.end(), CHIP_ERROR_CA_CERT_NOT_FOUND);
 
-    return CHIP_ERROR_CA_CERT_NOT_FOUND;
+    const std::vector<uint8_t> & candidate = mPAADerCerts[match->second];
+    return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
 }
 
 } // namespace Credentials
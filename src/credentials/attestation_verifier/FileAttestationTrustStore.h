@@ -20,6 +20,8 @@
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
 
 #include <array>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace chip {
@@ -66,6 +68,11 @@ protected:
 private:
     bool mIsInitialized = false;
 
+    // Index in mPAADerCerts of the PAA for each SKID, built once when the certificates are loaded, so that lookups
+    // do not have to parse every certificate.  The key holds the raw SKID bytes.
+    std::unordered_map<std::string, size_t> mPAAIndexBySkid;
+
+    void BuildSkidIndex();
     void Cleanup();
 };
 
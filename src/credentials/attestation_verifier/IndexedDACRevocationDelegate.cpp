@@ -0,0 +1,486 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/attestation_verifier/IndexedDACRevocationDelegate.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/Base64.h>
+#include <lib/support/BytesToHex.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <json/json.h>
+#include <sstream>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace chip::Crypto;
+
+namespace chip {
+namespace Credentials {
+
+namespace {
+
+using EntryDigest = std::array<uint8_t, IndexedDACRevocationDelegate::kDigestLength>;
+
+constexpr uint8_t kIndexMagic[]       = { 'M', 'R', 'S', 'I' };
+constexpr uint16_t kIndexVersion      = 1;
+constexpr size_t kIndexHeaderLength   = 16;
+constexpr uint8_t kBloomHashCount     = 7;
+constexpr size_t kBloomBitsPerEntry   = 10;
+constexpr uint8_t kMaxBloomHashCount  = 16;
+constexpr size_t kMaxIndexEntryCount  = UINT32_MAX / IndexedDACRevocationDelegate::kDigestLength;
+constexpr size_t kAKIDLength          = kAuthorityKeyIdentifierLength;
+constexpr size_t kMaxBase64CertLength = BASE64_ENCODED_LEN(kMax_x509_Certificate_Length);
+// Room for any padded base64 encoding of a distinguished name.
+constexpr size_t kMaxDecodedIssuerLength = BASE64_MAX_DECODED_LEN(BASE64_ENCODED_LEN(kMaxCertificateDistinguishedNameLength));
+
+CHIP_ERROR LastPosixError()
+{
+    return CHIP_ERROR_POSIX(errno);
+}
+
+// The digest covers the length of every variable-size field, so that no two triples are hashed from the same bytes.
+CHIP_ERROR ComputeEntryDigest(const ByteSpan & akid, const ByteSpan & issuer, const ByteSpan & serialNumber,
+                              EntryDigest & outDigest)
+{
+    VerifyOrReturnError(akid.size() == kAKIDLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t lengths[2 * sizeof(uint16_t)];
+    Encoding::LittleEndian::Put16(&lengths[0], static_cast<uint16_t>(issuer.size()));
+    Encoding::LittleEndian::Put16(&lengths[sizeof(uint16_t)], static_cast<uint16_t>(serialNumber.size()));
+
+    uint8_t digestBuf[kSHA256_Hash_Length];
+    MutableByteSpan digest(digestBuf);
+
+    Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(lengths)));
+    ReturnErrorOnFailure(hash.AddData(akid));
+    ReturnErrorOnFailure(hash.AddData(issuer));
+    ReturnErrorOnFailure(hash.AddData(serialNumber));
+    ReturnErrorOnFailure(hash.GetDigest(digest));
+
+    memcpy(outDigest.data(), digest.data(), outDigest.size());
+    return CHIP_NO_ERROR;
+}
+
+// The bit positions come from the digest itself, which is already uniformly distributed, by double hashing.
+template <typename Func>
+void ForEachBloomBit(const uint8_t * digest, size_t bloomBits, uint8_t hashCount, Func func)
+{
+    static_assert(IndexedDACRevocationDelegate::kDigestLength >= 2 * sizeof(uint64_t), "Digest too short for the Bloom filter");
+
+    uint64_t h1 = Encoding::LittleEndian::Get64(digest);
+    uint64_t h2 = Encoding::LittleEndian::Get64(digest + sizeof(uint64_t)) | 1;
+    for (uint8_t i = 0; i < hashCount; i++)
+    {
+        func(static_cast<size_t>((h1 + i * h2) % bloomBits));
+    }
+}
+
+bool DecodeHex(const Json::Value & value, MutableByteSpan & out)
+{
+    VerifyOrReturnValue(value.isString(), false);
+    const std::string hex = value.asString();
+    size_t length         = Encoding::HexToBytes(hex.data(), hex.size(), out.data(), out.size());
+    VerifyOrReturnValue(length != 0, false);
+    out.reduce_size(length);
+    return true;
+}
+
+bool DecodeBase64(const Json::Value & value, MutableByteSpan & out)
+{
+    VerifyOrReturnValue(value.isString(), false);
+    const std::string base64 = value.asString();
+    VerifyOrReturnValue(base64.size() <= kMaxBase64CertLength && BASE64_MAX_DECODED_LEN(base64.size()) <= out.size(), false);
+
+    uint16_t length = Base64Decode(base64.data(), static_cast<uint16_t>(base64.size()), out.data());
+    VerifyOrReturnValue(length != UINT16_MAX, false);
+    out.reduce_size(length);
+    return true;
+}
+
+// Check that the issuer and AKID of the entry match the subject and SKID of its CRL signer or CRL signer delegator.
+bool CrossValidateCRLSigner(const Json::Value & entry, const ByteSpan & akid, const ByteSpan & issuer)
+{
+    const char * certKey = entry.isMember("crl_signer_delegator") ? "crl_signer_delegator" : "crl_signer_cert";
+
+    uint8_t certBuf[kMax_x509_Certificate_Length];
+    MutableByteSpan cert(certBuf);
+    VerifyOrReturnValue(DecodeBase64(entry[certKey], cert), false);
+
+    uint8_t subjectBuf[kMaxCertificateDistinguishedNameLength];
+    MutableByteSpan subject(subjectBuf);
+    uint8_t skidBuf[kSubjectKeyIdentifierLength];
+    MutableByteSpan skid(skidBuf);
+    VerifyOrReturnValue(ExtractSubjectFromX509Cert(cert, subject) == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(ExtractSKIDFromX509Cert(cert, skid) == CHIP_NO_ERROR, false);
+
+    return skid.data_equal(akid) && subject.data_equal(issuer);
+}
+
+// Collect the digests of the revocation set generated by credentials/generate_revocation_set.py:
+// [
+//   {
+//     "type": "revocation_set",
+//     "issuer_subject_key_id": "<issuer subject key ID as hex, 20 bytes>",
+//     "issuer_name": "<ASN.1 SEQUENCE of Issuer of the CRL as base64>",
+//     "revoked_serial_numbers": [ "<serial number as hex>", ... ],
+//     "crl_signer_cert": "<base64 encoded DER certificate>",
+//     "crl_signer_delegator": "<base64 encoded DER certificate>",
+//   }
+// ]
+CHIP_ERROR CollectDigests(const Json::Value & revocationSet, std::vector<EntryDigest> & outDigests)
+{
+    VerifyOrReturnError(revocationSet.isArray(), CHIP_ERROR_INVALID_ARGUMENT,
+                        ChipLogError(NotSpecified, "Revocation set is not a valid JSON Array"));
+
+    for (const auto & entry : revocationSet)
+    {
+        VerifyOrReturnError(entry.isObject(), CHIP_ERROR_INVALID_ARGUMENT,
+                            ChipLogError(NotSpecified, "Revocation set entry is not a valid JSON object"));
+
+        uint8_t akidBuf[kAKIDLength];
+        MutableByteSpan akid(akidBuf);
+        uint8_t issuerBuf[kMaxDecodedIssuerLength];
+        MutableByteSpan issuer(issuerBuf);
+        if (!DecodeHex(entry["issuer_subject_key_id"], akid) || akid.size() != kAKIDLength ||
+            !DecodeBase64(entry["issuer_name"], issuer))
+        {
+            ChipLogError(NotSpecified, "Skipping revocation set entry with an invalid issuer");
+            continue;
+        }
+
+        // 6.2.4.2. Determining Revocation Status of an Entity, 4.a and 4.b
+        if (!CrossValidateCRLSigner(entry, akid, issuer))
+        {
+            ChipLogError(NotSpecified, "Skipping revocation set entry whose CRL signer does not match its issuer");
+            continue;
+        }
+
+        for (const auto & revokedSerialNumber : entry["revoked_serial_numbers"])
+        {
+            uint8_t serialNumberBuf[kMaxCertificateSerialNumberLength];
+            MutableByteSpan serialNumber(serialNumberBuf);
+            if (!DecodeHex(revokedSerialNumber, serialNumber))
+            {
+                ChipLogError(NotSpecified, "Skipping invalid revoked serial number");
+                continue;
+            }
+
+            EntryDigest digest;
+            ReturnErrorOnFailure(ComputeEntryDigest(akid, issuer, serialNumber, digest));
+            outDigests.push_back(digest);
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BuildImage(std::vector<EntryDigest> & digests, std::vector<uint8_t> & outImage)
+{
+    std::sort(digests.begin(), digests.end());
+    digests.erase(std::unique(digests.begin(), digests.end()), digests.end());
+    VerifyOrReturnError(digests.size() <= kMaxIndexEntryCount, CHIP_ERROR_NO_MEMORY);
+
+    // About 1% of the certificates that are not revoked go on to the binary search.
+    size_t bloomBytes = std::max<size_t>((digests.size() * kBloomBitsPerEntry + 7) / 8, 1);
+    VerifyOrReturnError(bloomBytes <= UINT32_MAX, CHIP_ERROR_NO_MEMORY);
+
+    outImage.assign(kIndexHeaderLength + bloomBytes + digests.size() * IndexedDACRevocationDelegate::kDigestLength, 0);
+
+    uint8_t * header = outImage.data();
+    memcpy(header, kIndexMagic, sizeof(kIndexMagic));
+    Encoding::LittleEndian::Put16(&header[4], kIndexVersion);
+    header[6] = kBloomHashCount;
+    Encoding::LittleEndian::Put32(&header[8], static_cast<uint32_t>(digests.size()));
+    Encoding::LittleEndian::Put32(&header[12], static_cast<uint32_t>(bloomBytes));
+
+    uint8_t * bloom = header + kIndexHeaderLength;
+    uint8_t * entry = bloom + bloomBytes;
+    for (const auto & digest : digests)
+    {
+        ForEachBloomBit(digest.data(), bloomBytes * 8, kBloomHashCount,
+                        [bloom](size_t bit) { bloom[bit / 8] = static_cast<uint8_t>(bloom[bit / 8] | (1u << (bit % 8))); });
+        memcpy(entry, digest.data(), digest.size());
+        entry += digest.size();
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // anonymous namespace
+
+CHIP_ERROR IndexedDACRevocationDelegate::LoadRevocationSet(const std::string & jsonData)
+{
+    Json::Value revocationSet;
+    std::string errs;
+    std::istringstream jsonStream(jsonData);
+    VerifyOrReturnError(Json::parseFromStream(Json::CharReaderBuilder(), jsonStream, &revocationSet, &errs),
+                        CHIP_ERROR_INVALID_ARGUMENT, ChipLogError(NotSpecified, "Failed to parse JSON data: %s", errs.c_str()));
+
+    std::vector<EntryDigest> digests;
+    ReturnErrorOnFailure(CollectDigests(revocationSet, digests));
+
+    std::vector<uint8_t> image;
+    ReturnErrorOnFailure(BuildImage(digests, image));
+
+    Clear();
+    mOwnedImage = std::move(image);
+    return Attach(ByteSpan(mOwnedImage.data(), mOwnedImage.size()));
+}
+
+CHIP_ERROR IndexedDACRevocationDelegate::LoadRevocationSetFile(std::string_view path)
+{
+    VerifyOrReturnError(!path.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::ifstream file{ std::string(path) };
+    VerifyOrReturnError(file.is_open(), CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(NotSpecified, "Failed to open file: %.*s", static_cast<int>(path.size()), path.data()));
+
+    std::stringstream jsonData;
+    jsonData << file.rdbuf();
+    return LoadRevocationSet(jsonData.str());
+}
+
+CHIP_ERROR IndexedDACRevocationDelegate::LoadIndexFile(std::string_view path)
+{
+    VerifyOrReturnError(!path.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Clear();
+    CHIP_ERROR err = MapFile(path);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = Attach(ByteSpan(static_cast<const uint8_t *>(mMap), mMapLength));
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(NotSpecified, "Failed to load revocation index %.*s: %" CHIP_ERROR_FORMAT, static_cast<int>(path.size()),
+                     path.data(), err.Format());
+        Clear();
+    }
+    return err;
+}
+
+CHIP_ERROR IndexedDACRevocationDelegate::MapFile(std::string_view path)
+{
+    int fd = open(std::string(path).c_str(), O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, LastPosixError());
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        err = LastPosixError();
+    }
+    else if (info.st_size < static_cast<off_t>(kIndexHeaderLength))
+    {
+        err = CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+    }
+    else
+    {
+        void * map = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED)
+        {
+            err = LastPosixError();
+        }
+        else
+        {
+            mMap       = map;
+            mMapLength = static_cast<size_t>(info.st_size);
+        }
+    }
+    close(fd);
+    return err;
+}
+
+CHIP_ERROR IndexedDACRevocationDelegate::Attach(ByteSpan image)
+{
+    VerifyOrReturnError(image.size() >= kIndexHeaderLength, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+
+    const uint8_t * header = image.data();
+    VerifyOrReturnError(memcmp(header, kIndexMagic, sizeof(kIndexMagic)) == 0, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+    VerifyOrReturnError(Encoding::LittleEndian::Get16(&header[4]) == kIndexVersion, CHIP_ERROR_VERSION_MISMATCH);
+
+    uint8_t hashCount = header[6];
+    size_t entryCount = Encoding::LittleEndian::Get32(&header[8]);
+    size_t bloomBytes = Encoding::LittleEndian::Get32(&header[12]);
+    VerifyOrReturnError(hashCount > 0 && hashCount <= kMaxBloomHashCount && bloomBytes > 0 && entryCount <= kMaxIndexEntryCount,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(image.size() - kIndexHeaderLength == bloomBytes + entryCount * kDigestLength,
+                        CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    mImage      = image;
+    mBloom      = header + kIndexHeaderLength;
+    mBloomBits  = bloomBytes * 8;
+    mHashCount  = hashCount;
+    mDigests    = mBloom + bloomBytes;
+    mEntryCount = entryCount;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR IndexedDACRevocationDelegate::WriteIndexFile(std::string_view path) const
+{
+    VerifyOrReturnError(!path.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(HasIndex(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Write next to the destination and rename over it, so that a delegate mapping the old file keeps a consistent view.
+    const std::string target(path);
+    const std::string temp = target + ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        VerifyOrReturnError(file.is_open(), CHIP_ERROR_OPEN_FAILED);
+        file.write(reinterpret_cast<const char *>(mImage.data()), static_cast<std::streamsize>(mImage.size()));
+        file.close();
+        if (!file)
+        {
+            unlink(temp.c_str());
+            return CHIP_ERROR_WRITE_FAILED;
+        }
+    }
+    if (rename(temp.c_str(), target.c_str()) != 0)
+    {
+        CHIP_ERROR err = LastPosixError();
+        unlink(temp.c_str());
+        return err;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR IndexedDACRevocationDelegate::ConvertRevocationSetToIndexFile(std::string_view jsonPath, std::string_view indexPath)
+{
+    IndexedDACRevocationDelegate delegate;
+    ReturnErrorOnFailure(delegate.LoadRevocationSetFile(jsonPath));
+    return delegate.WriteIndexFile(indexPath);
+}
+
+void IndexedDACRevocationDelegate::Clear()
+{
+    if (mMap != nullptr)
+    {
+        munmap(mMap, mMapLength);
+    }
+    mMap       = nullptr;
+    mMapLength = 0;
+    mOwnedImage.clear();
+    mOwnedImage.shrink_to_fit();
+
+    mImage      = ByteSpan();
+    mBloom      = nullptr;
+    mBloomBits  = 0;
+    mHashCount  = 0;
+    mDigests    = nullptr;
+    mEntryCount = 0;
+}
+
+bool IndexedDACRevocationDelegate::Contains(const uint8_t * digest) const
+{
+    bool maybePresent = true;
+    ForEachBloomBit(digest, mBloomBits, mHashCount, [this, &maybePresent](size_t bit) {
+        maybePresent = maybePresent && (mBloom[bit / 8] & (1u << (bit % 8))) != 0;
+    });
+    VerifyOrReturnValue(maybePresent, false);
+
+    size_t low  = 0;
+    size_t high = mEntryCount;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        int order     = memcmp(mDigests + middle * kDigestLength, digest, kDigestLength);
+        if (order == 0)
+        {
+            return true;
+        }
+        if (order < 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return false;
+}
+
+// @param certDer Certificate, in DER format, to check for revocation
+bool IndexedDACRevocationDelegate::IsCertificateRevoked(const ByteSpan & certDer) const
+{
+    uint8_t akidBuf[kAKIDLength];
+    MutableByteSpan akid(akidBuf);
+    uint8_t issuerBuf[kMaxCertificateDistinguishedNameLength];
+    MutableByteSpan issuer(issuerBuf);
+    uint8_t serialNumberBuf[kMaxCertificateSerialNumberLength];
+    MutableByteSpan serialNumber(serialNumberBuf);
+
+    VerifyOrReturnValue(ExtractAKIDFromX509Cert(certDer, akid) == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(ExtractIssuerFromX509Cert(certDer, issuer) == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(ExtractSerialNumberFromX509Cert(certDer, serialNumber) == CHIP_NO_ERROR, false);
+
+    EntryDigest digest;
+    VerifyOrReturnValue(ComputeEntryDigest(akid, issuer, serialNumber, digest) == CHIP_NO_ERROR, false);
+    return Contains(digest.data());
+}
+
+void IndexedDACRevocationDelegate::CheckForRevokedDACChain(
+    const DeviceAttestationVerifier::AttestationInfo & info,
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> * onCompletion)
+{
+    AttestationVerificationResult attestationError = AttestationVerificationResult::kSuccess;
+
+    if (!HasIndex())
+    {
+        ChipLogProgress(NotSpecified, "WARNING: No revocation information available. Revocation checks will be skipped!");
+        onCompletion->mCall(onCompletion->mContext, info, attestationError);
+        return;
+    }
+
+    if (IsCertificateRevoked(info.dacDerBuffer))
+    {
+        ChipLogProgress(NotSpecified, "Found revoked DAC in the revocation index");
+        attestationError = AttestationVerificationResult::kDacRevoked;
+    }
+
+    if (IsCertificateRevoked(info.paiDerBuffer))
+    {
+        ChipLogProgress(NotSpecified, "Found revoked PAI in the revocation index");
+
+        if (attestationError == AttestationVerificationResult::kDacRevoked)
+        {
+            attestationError = AttestationVerificationResult::kPaiAndDacRevoked;
+        }
+        else
+        {
+            attestationError = AttestationVerificationResult::kPaiRevoked;
+        }
+    }
+
+    onCompletion->mCall(onCompletion->mContext, info, attestationError);
+}
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,112 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * A DeviceAttestationRevocationDelegate for large revocation sets.
+ *
+ * Unlike the TestDACRevocationDelegateImpl, which parses the whole JSON revocation set on every check, the revocation
+ * set is turned once into an index: a sorted table of the digests of every revoked (AKID, issuer, serial number)
+ * triple, with a Bloom filter in front of it.  A certificate that is not revoked, which is nearly all of them, is then
+ * usually accepted after a single digest and a few bit lookups, and a revoked one is confirmed by a binary search.
+ *
+ * The index is either built from the JSON revocation set generated by credentials/generate_revocation_set.py, or
+ * loaded from an index file, which is mapped read-only rather than read into memory.  Use
+ * ConvertRevocationSetToIndexFile to produce that file from the JSON revocation set.  The CRL signer of every entry of
+ * the revocation set is validated when the index is built, and entries that fail validation are left out.
+ *
+ * Index file layout, all integers little-endian:
+ *
+ *      magic "MRSI" | version (2) | hash count (1) | reserved (1) | entry count (4) | Bloom filter size (4)
+ *      Bloom filter bits
+ *      sorted entry digests, kDigestLength bytes each
+ *
+ * CheckForRevokedDACChain may be called from several threads at once, but not while the index is being loaded.
+ */
+class IndexedDACRevocationDelegate : public DeviceAttestationRevocationDelegate
+{
+public:
+    // Entries are identified by a truncated SHA-256 digest.  A collision can only report a certificate as revoked.
+    static constexpr size_t kDigestLength = 16;
+
+    IndexedDACRevocationDelegate() = default;
+    ~IndexedDACRevocationDelegate() override { Clear(); }
+
+    IndexedDACRevocationDelegate(const IndexedDACRevocationDelegate &)             = delete;
+    IndexedDACRevocationDelegate & operator=(const IndexedDACRevocationDelegate &) = delete;
+
+    void CheckForRevokedDACChain(
+        const DeviceAttestationVerifier::AttestationInfo & info,
+        Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> * onCompletion) override;
+
+    // Build the index from JSON revocation set data, replacing the current one.
+    CHIP_ERROR LoadRevocationSet(const std::string & jsonData);
+
+    // Build the index from a JSON revocation set file, replacing the current one.
+    CHIP_ERROR LoadRevocationSetFile(std::string_view path);
+
+    // Map an index file written by WriteIndexFile or ConvertRevocationSetToIndexFile, replacing the current index.
+    CHIP_ERROR LoadIndexFile(std::string_view path);
+
+    // Write the current index to a file.  The file is replaced atomically, so it may be mapped by another delegate.
+    CHIP_ERROR WriteIndexFile(std::string_view path) const;
+
+    // Drop the index.  Revocation checks are skipped until another one is loaded.
+    void Clear();
+
+    bool HasIndex() const { return !mImage.empty(); }
+    size_t GetEntryCount() const { return mEntryCount; }
+
+    static CHIP_ERROR ConvertRevocationSetToIndexFile(std::string_view jsonPath, std::string_view indexPath);
+
+private:
+    // Point the index at an image in the index file layout, which must outlive it.
+    CHIP_ERROR Attach(ByteSpan image);
+    CHIP_ERROR MapFile(std::string_view path);
+
+    bool Contains(const uint8_t * digest) const;
+    bool IsCertificateRevoked(const ByteSpan & certDer) const;
+
+    // Backing storage for an index built from JSON, or the mapping of an index file.
+    std::vector<uint8_t> mOwnedImage;
+    void * mMap       = nullptr;
+    size_t mMapLength = 0;
+
+    ByteSpan mImage;
+    const uint8_t * mBloom   = nullptr;
+    size_t mBloomBits        = 0;
+    uint8_t mHashCount       = 0;
+    const uint8_t * mDigests = nullptr;
+    size_t mEntryCount       = 0;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -27,6 +27,7 @@
 #include <pw_unit_test/framework.h>
 
 #include <credentials/CHIPCert.h>
+#include <credentials/VerifiedCertificateCache.h>
 #include <credentials/examples/LastKnownGoodTimeCertificateValidityPolicyExample.h>
 #include <credentials/examples/StrictCertificateValidityPolicyExample.h>
 #include <crypto/CHIPCryptoPAL.h>
@@ -567,6 +568,59 @@ TEST_F(TestChipCert, TestChipCert_CertValidation)
     }
 }
 
+TEST_F(TestChipCert, TestChipCert_VerifiedCertificateCache)
+{
+    ChipCertificateSet certSet;
+    ValidationContext validContext;
+    VerifiedCertificateCache verifiedCertificates;
+
+    ASSERT_EQ(certSet.Init(kStandardCertsCount), CHIP_NO_ERROR);
+    ASSERT_EQ(LoadTestCertSet01(certSet), CHIP_NO_ERROR);
+
+    const ChipCertificateData & rootCert = certSet.GetCertSet()[0];
+    const ChipCertificateData & icaCert  = certSet.GetCertSet()[1];
+    const ChipCertificateData & nodeCert = certSet.GetCertSet()[2];
+
+    VerifiedCertificateCache::Digest icaDigest;
+    VerifiedCertificateCache::Digest nodeDigest;
+    ASSERT_EQ(VerifiedCertificateCache::ComputeDigest(icaCert, rootCert, icaDigest), CHIP_NO_ERROR);
+    ASSERT_EQ(VerifiedCertificateCache::ComputeDigest(nodeCert, icaCert, nodeDigest), CHIP_NO_ERROR);
+    EXPECT_NE(icaDigest, nodeDigest);
+
+    validContext.Reset();
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kClientAuth);
+    ClearTimeSource(validContext);
+    validContext.mVerifiedCertificates = &verifiedCertificates;
+
+    // Only the signature of the ICAC is remembered.
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+    EXPECT_TRUE(verifiedCertificates.Contains(icaDigest));
+    EXPECT_FALSE(verifiedCertificates.Contains(nodeDigest));
+
+    // Validation with the remembered signature still succeeds.
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+
+    // Entries of a copy used elsewhere can be merged back.
+    VerifiedCertificateCache merged;
+    merged.Add(verifiedCertificates);
+    EXPECT_TRUE(merged.Contains(icaDigest));
+
+    // Once full, the oldest entry is replaced.
+    VerifiedCertificateCache::Digest digest = icaDigest;
+    for (size_t i = 0; i < VerifiedCertificateCache::kCapacity; i++)
+    {
+        digest[0]++;
+        verifiedCertificates.Add(digest);
+    }
+    EXPECT_FALSE(verifiedCertificates.Contains(icaDigest));
+    EXPECT_TRUE(verifiedCertificates.Contains(digest));
+
+    verifiedCertificates.Clear();
+    EXPECT_FALSE(verifiedCertificates.Contains(digest));
+}
+
 TEST_F(TestChipCert, TestChipCert_CertValidTime)
 {
     CHIP_ERROR err;
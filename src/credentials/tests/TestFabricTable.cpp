@@ -2578,6 +2578,23 @@ TEST_F(TestFabricTable, TestFetchCATs)
         EXPECT_EQ(cats, kUndefinedCATs);
     }
 
+    // CATs are only available for existing fabrics.
+    {
+        CATValues cats;
+        EXPECT_EQ(fabricTable.FetchCATs(3, cats), CHIP_ERROR_INVALID_FABRIC_INDEX);
+        EXPECT_EQ(fabricTable.FetchCATs(kUndefinedFabricIndex, cats), CHIP_ERROR_INVALID_FABRIC_INDEX);
+    }
+
+    // CATs of fabrics loaded from storage are available as well.
+    {
+        ScopedFabricTable reloadedFabricTableHolder;
+        EXPECT_EQ(reloadedFabricTableHolder.Init(&testStorage), CHIP_NO_ERROR);
+
+        CATValues cats;
+        EXPECT_EQ(reloadedFabricTableHolder.GetFabricTable().FetchCATs(2, cats), CHIP_NO_ERROR);
+        EXPECT_EQ(cats, kUndefinedCATs);
+    }
+
     // TODO(#20335): Add test cases for NOCs that actually embed CATs
 }
 
@@ -610,6 +610,35 @@ TEST_F(TestGroupDataProvider, TestEndpointIterator)
     }
     EXPECT_EQ(count, it->Count());
     it->Release();
+
+    // Iterate a single group of fabric 1
+
+    std::set<std::pair<GroupId, EndpointId>> expected_g2 = {
+        { kGroup2, kEndpointId1 },
+        { kGroup2, kEndpointId2 },
+        { kGroup2, kEndpointId3 },
+    };
+
+    it = provider->IterateEndpoints(kFabric1, std::make_optional(kGroup2));
+    ASSERT_TRUE(it);
+    count = 0;
+    EXPECT_EQ(expected_g2.size(), it->Count());
+    while (it->Next(output) && count < expected_g2.size())
+    {
+        std::pair<chip::GroupId, chip::EndpointId> mapping(output.group_id, output.endpoint_id);
+        EXPECT_GT(expected_g2.count(mapping), 0u);
+        count++;
+    }
+    EXPECT_EQ(count, it->Count());
+    it->Release();
+
+    // A group of another fabric has no endpoints on this one
+
+    it = provider->IterateEndpoints(kFabric1, std::make_optional(kGroup3));
+    ASSERT_TRUE(it);
+    EXPECT_EQ(0u, it->Count());
+    EXPECT_FALSE(it->Next(output));
+    it->Release();
 }
 
 TEST_F(TestGroupDataProvider, TestGroupKeys)
@@ -1223,6 +1252,190 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+void PoisonAllKeys(TestPersistentStorageDelegate & storage)
+{
+    for (const std::string & key : storage.GetKeys())
+    {
+        storage.AddPoisonKey(key);
+    }
+}
+
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE >= 3
+
+size_t CountGroupSessions(GroupDataProvider * provider, uint16_t session_id, FabricIndex fabric_index, GroupId group_id)
+{
+    auto it = provider->IterateGroupSessions(session_id);
+    VerifyOrReturnValue(it != nullptr, 0);
+
+    GroupSession session;
+    size_t count = 0;
+    while (it->Next(session))
+    {
+        if (session.fabric_index == fabric_index && session.group_id == group_id && session.keyContext != nullptr)
+        {
+            count++;
+        }
+    }
+    it->Release();
+    return count;
+}
+
+uint16_t GetSessionId(GroupDataProvider * provider, FabricIndex fabric_index, GroupId group_id)
+{
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(fabric_index, group_id);
+    VerifyOrReturnValue(key_context != nullptr, 0);
+
+    uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+    return session_id;
+}
+
+TEST_F(TestGroupDataProvider, TestGroupSessionIndex)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    // 1 + 2 group sessions, which fit in the index
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset2), CHIP_NO_ERROR);
+
+    uint16_t session_id1 = GetSessionId(provider, kFabric1, kGroup1);
+    uint16_t session_id2 = GetSessionId(provider, kFabric2, kGroup2);
+    EXPECT_EQ(CountGroupSessions(provider, session_id1, kFabric1, kGroup1), 1u);
+
+    // Once loaded, group sessions are found without reading the storage
+    PoisonAllKeys(sDelegate);
+    EXPECT_EQ(CountGroupSessions(provider, session_id1, kFabric1, kGroup1), 1u);
+    EXPECT_EQ(CountGroupSessions(provider, session_id2, kFabric2, kGroup2), 1u);
+    auto it = provider->IterateGroupSessions(session_id2);
+    ASSERT_NE(it, nullptr);
+    EXPECT_EQ(it->Count(), 1u);
+    it->Release();
+    sDelegate.ClearPoisonKeys();
+
+    // Updating a keyset drops the group sessions of its previous keys
+    KeySet updated = kKeySet1;
+    memcpy(updated.epoch_keys, kEpochKeys2, sizeof(EpochKey));
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, updated), CHIP_NO_ERROR);
+
+    uint16_t updated_session_id = GetSessionId(provider, kFabric1, kGroup1);
+    EXPECT_NE(updated_session_id, session_id1);
+    EXPECT_EQ(CountGroupSessions(provider, session_id1, kFabric1, kGroup1), 0u);
+
+    PoisonAllKeys(sDelegate);
+    EXPECT_EQ(CountGroupSessions(provider, updated_session_id, kFabric1, kGroup1), 1u);
+    sDelegate.ClearPoisonKeys();
+
+    // Removing the group-key mapping drops its group sessions
+    EXPECT_EQ(provider->RemoveGroupKeyAt(kFabric1, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(CountGroupSessions(provider, updated_session_id, kFabric1, kGroup1), 0u);
+    EXPECT_EQ(CountGroupSessions(provider, session_id2, kFabric2, kGroup2), 1u);
+}
+
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE >= 3
+
+#if CHIP_CONFIG_IPK_CACHE_SIZE >= 2
+
+TEST_F(TestGroupDataProvider, TestIpkCache)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(SetSingleIpkEpochKey(provider, kFabric1, ByteSpan(kEpochKeys1[0].key), kCompressedFabricId1), CHIP_NO_ERROR);
+    EXPECT_EQ(SetSingleIpkEpochKey(provider, kFabric2, ByteSpan(kEpochKeys2[0].key), kCompressedFabricId2), CHIP_NO_ERROR);
+
+    KeySet ipk1;
+    KeySet ipk2;
+    EXPECT_EQ(provider->GetIpkKeySet(kFabric1, ipk1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->GetIpkKeySet(kFabric2, ipk2), CHIP_NO_ERROR);
+
+    // Once loaded, IPK keysets are found without reading the storage
+    KeySet ipk;
+    PoisonAllKeys(sDelegate);
+    EXPECT_EQ(provider->GetIpkKeySet(kFabric1, ipk), CHIP_NO_ERROR);
+    EXPECT_TRUE(ipk == ipk1);
+    EXPECT_EQ(provider->GetIpkKeySet(kFabric2, ipk), CHIP_NO_ERROR);
+    EXPECT_TRUE(ipk == ipk2);
+    sDelegate.ClearPoisonKeys();
+
+    // Updating the IPK drops the previous one
+    EXPECT_EQ(SetSingleIpkEpochKey(provider, kFabric1, ByteSpan(kEpochKeys3[0].key), kCompressedFabricId1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->GetIpkKeySet(kFabric1, ipk), CHIP_NO_ERROR);
+    EXPECT_FALSE(ipk == ipk1);
+
+    // Removing a fabric drops its IPK
+    EXPECT_EQ(provider->RemoveFabric(kFabric2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->GetIpkKeySet(kFabric2, ipk), CHIP_ERROR_NOT_FOUND);
+}
+
+#endif // CHIP_CONFIG_IPK_CACHE_SIZE >= 2
+
+#if CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE >= 4
+
+TEST_F(TestGroupDataProvider, TestGroupMembershipIndex)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup1, kEndpointId0), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup1, kEndpointId2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup2, kEndpointId1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->AddEndpoint(kFabric2, kGroup3, kEndpointId3), CHIP_NO_ERROR);
+    EXPECT_TRUE(provider->HasEndpoint(kFabric1, kGroup1, kEndpointId0));
+
+    // Once loaded, group endpoints are found without reading the storage
+    PoisonAllKeys(sDelegate);
+    EXPECT_TRUE(provider->HasEndpoint(kFabric1, kGroup1, kEndpointId2));
+    EXPECT_TRUE(provider->HasEndpoint(kFabric2, kGroup3, kEndpointId3));
+    EXPECT_FALSE(provider->HasEndpoint(kFabric1, kGroup3, kEndpointId3));
+    EXPECT_FALSE(provider->HasEndpoint(kFabric1, kGroup2, kEndpointId2));
+
+    auto it = provider->IterateEndpoints(kFabric1);
+    ASSERT_NE(it, nullptr);
+    EXPECT_EQ(it->Count(), 3u);
+    it->Release();
+
+    GroupEndpoint output;
+    it = provider->IterateEndpoints(kFabric1, std::make_optional(kGroup1));
+    ASSERT_NE(it, nullptr);
+    EXPECT_EQ(it->Count(), 2u);
+    EXPECT_TRUE(it->Next(output));
+    EXPECT_EQ(output.group_id, kGroup1);
+    EXPECT_EQ(output.endpoint_id, kEndpointId0);
+    sDelegate.ClearPoisonKeys();
+
+    // Changing the groups while iterating continues from storage, after the last endpoint returned
+    EXPECT_EQ(provider->RemoveEndpoint(kFabric1, kGroup1, kEndpointId0), CHIP_NO_ERROR);
+    EXPECT_TRUE(it->Next(output));
+    EXPECT_EQ(output.group_id, kGroup1);
+    EXPECT_EQ(output.endpoint_id, kEndpointId2);
+    EXPECT_FALSE(it->Next(output));
+    it->Release();
+
+    // The index is rebuilt with the changes
+    EXPECT_FALSE(provider->HasEndpoint(kFabric1, kGroup1, kEndpointId0));
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup2, kEndpointId4), CHIP_NO_ERROR);
+    EXPECT_TRUE(provider->HasEndpoint(kFabric1, kGroup2, kEndpointId4));
+
+    // Removing a fabric drops its group endpoints
+    EXPECT_EQ(provider->RemoveFabric(kFabric2), CHIP_NO_ERROR);
+    EXPECT_FALSE(provider->HasEndpoint(kFabric2, kGroup3, kEndpointId3));
+    EXPECT_TRUE(provider->HasEndpoint(kFabric1, kGroup1, kEndpointId2));
+}
+
+#endif // CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE >= 4
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
@@ -0,0 +1,189 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <credentials/attestation_verifier/IndexedDACRevocationDelegate.h>
+#include <credentials/tests/CHIPAttCert_test_vectors.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+
+namespace {
+
+// Details for TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, signed by TestCerts::sTestCert_PAI_FFF1_8000_Cert
+constexpr char kDacRevocationEntry[] = R"({
+        "type": "revocation_set",
+        "issuer_subject_key_id": "AF42B7094DEBD515EC6ECF33B81115225F325288",
+        "issuer_name": "MEYxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBSTEUMBIGCisGAQQBgqJ8AgEMBEZGRjExFDASBgorBgEEAYKifAICDAQ4MDAw",
+        "crl_signer_cert": "MIIB1DCCAXqgAwIBAgIIPmzmUJrYQM0wCgYIKoZIzj0EAwIwMDEYMBYGA1UEAwwPTWF0dGVyIFRlc3QgUEFBMRQwEgYKKwYBBAGConwCAQwERkZGMTAgFw0yMTA2MjgxNDIzNDNaGA85OTk5MTIzMTIzNTk1OVowRjEYMBYGA1UEAwwPTWF0dGVyIFRlc3QgUEFJMRQwEgYKKwYBBAGConwCAQwERkZGMTEUMBIGCisGAQQBgqJ8AgIMBDgwMDAwWTATBgcqhkjOPQIBBggqhkjOPQMBBwNCAASA3fEbIo8+MfY7z1eY2hRiOuu96C7zeO6tv7GP4avOMdCO1LIGBLbMxtm1+rZOfeEMt0vgF8nsFRYFbXDyzQsio2YwZDASBgNVHRMBAf8ECDAGAQH/AgEAMA4GA1UdDwEB/wQEAwIBBjAdBgNVHQ4EFgQUr0K3CU3r1RXsbs8zuBEVIl8yUogwHwYDVR0jBBgwFoAUav0idx9RH+y/FkGXZxDc3DGhcX4wCgYIKoZIzj0EAwIDSAAwRQIhAJbJyM8uAYhgBdj1vHLAe3X9mldpWsSRETETi+oDPOUDAiAlVJQ75X1T1sR199I+v8/CA2zSm6Y5PsfvrYcUq3GCGQ==",
+        "revoked_serial_numbers": ["0c694f7f866067b2", "0C694F7F866067B21234", "3E6CE6509AD840CD1"]
+    })";
+
+// Details for TestCerts::sTestCert_PAI_FFF1_8000_Cert, signed by the FFF1 test PAA
+constexpr char kPaiRevocationEntry[] = R"({
+        "type": "revocation_set",
+        "issuer_subject_key_id": "6AFD22771F511FECBF1641976710DCDC31A1717E",
+        "issuer_name": "MDAxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBQTEUMBIGCisGAQQBgqJ8AgEMBEZGRjE=",
+        "crl_signer_cert": "MIIBvTCCAWSgAwIBAgIITqjoMYLUHBwwCgYIKoZIzj0EAwIwMDEYMBYGA1UEAwwPTWF0dGVyIFRlc3QgUEFBMRQwEgYKKwYBBAGConwCAQwERkZGMTAgFw0yMTA2MjgxNDIzNDNaGA85OTk5MTIzMTIzNTk1OVowMDEYMBYGA1UEAwwPTWF0dGVyIFRlc3QgUEFBMRQwEgYKKwYBBAGConwCAQwERkZGMTBZMBMGByqGSM49AgEGCCqGSM49AwEHA0IABLbLY3KIfyko9brIGqnZOuJDHK2p154kL2UXfvnO2TKijs0Duq9qj8oYShpQNUKWDUU/MD8fGUIddR6Pjxqam3WjZjBkMBIGA1UdEwEB/wQIMAYBAf8CAQEwDgYDVR0PAQH/BAQDAgEGMB0GA1UdDgQWBBRq/SJ3H1Ef7L8WQZdnENzcMaFxfjAfBgNVHSMEGDAWgBRq/SJ3H1Ef7L8WQZdnENzcMaFxfjAKBggqhkjOPQQDAgNHADBEAiBQqoAC9NkyqaAFOPZTaK0P/8jvu8m+t9pWmDXPmqdRDgIgI7rI/g8j51RFtlM5CBpHmUkpxyqvChVI1A0DTVFLJd4=",
+        "revoked_serial_numbers": ["3E6CE6509AD840CD"]
+    })";
+
+void OnAttestationInformationVerificationCallback(void * context, const DeviceAttestationVerifier::AttestationInfo & info,
+                                                  AttestationVerificationResult result)
+{
+    *static_cast<AttestationVerificationResult *>(context) = result;
+}
+
+struct TestIndexedDACRevocationDelegate : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    AttestationVerificationResult Check(IndexedDACRevocationDelegate & delegate, const ByteSpan & pai, const ByteSpan & dac)
+    {
+        const ByteSpan empty;
+        DeviceAttestationVerifier::AttestationInfo info(empty, empty, empty, pai, dac, empty, static_cast<VendorId>(0xFFF1),
+                                                        0x8000);
+
+        AttestationVerificationResult result = AttestationVerificationResult::kNotImplemented;
+        Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> callback(
+            OnAttestationInformationVerificationCallback, &result);
+        delegate.CheckForRevokedDACChain(info, &callback);
+        return result;
+    }
+
+    AttestationVerificationResult Check(IndexedDACRevocationDelegate & delegate)
+    {
+        return Check(delegate, TestCerts::sTestCert_PAI_FFF1_8000_Cert, TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert);
+    }
+};
+
+std::string TempPath()
+{
+    char path[] = "/tmp/chip-revocation-index-XXXXXX";
+    int fd      = mkstemp(path);
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    return path;
+}
+
+} // namespace
+
+TEST_F(TestIndexedDACRevocationDelegate, SkipsCheckWithoutIndex)
+{
+    IndexedDACRevocationDelegate delegate;
+    EXPECT_FALSE(delegate.HasIndex());
+    EXPECT_EQ(Check(delegate), AttestationVerificationResult::kSuccess);
+}
+
+TEST_F(TestIndexedDACRevocationDelegate, FindsRevokedCertificates)
+{
+    IndexedDACRevocationDelegate delegate;
+
+    EXPECT_SUCCESS(delegate.LoadRevocationSet("[]"));
+    EXPECT_TRUE(delegate.HasIndex());
+    EXPECT_EQ(delegate.GetEntryCount(), 0u);
+    EXPECT_EQ(Check(delegate), AttestationVerificationResult::kSuccess);
+
+    // Serial numbers are compared as bytes, so hex case does not matter, and malformed ones are skipped.
+    EXPECT_SUCCESS(delegate.LoadRevocationSet(std::string("[") + kDacRevocationEntry + "]"));
+    EXPECT_EQ(delegate.GetEntryCount(), 2u);
+    EXPECT_EQ(Check(delegate), AttestationVerificationResult::kDacRevoked);
+
+    EXPECT_SUCCESS(delegate.LoadRevocationSet(std::string("[") + kPaiRevocationEntry + "]"));
+    EXPECT_EQ(Check(delegate), AttestationVerificationResult::kPaiRevoked);
+
+    EXPECT_SUCCESS(delegate.LoadRevocationSet(std::string("[") + kDacRevocationEntry + "," + kPaiRevocationEntry + "]"));
+    EXPECT_EQ(Check(delegate), AttestationVerificationResult::kPaiAndDacRevoked);
+    EXPECT_EQ(Check(delegate, TestCerts::sTestCert_PAI_FFF2_8001_Cert, TestCerts::sTestCert_DAC_FFF2_8001_0008_Cert),
+              AttestationVerificationResult::kSuccess);
+
+    delegate.Clear();
+    EXPECT_EQ(Check(delegate), AttestationVerificationResult::kSuccess);
+}
+
+TEST_F(TestIndexedDACRevocationDelegate, SkipsEntriesWithMismatchedCRLSigner)
+{
+    IndexedDACRevocationDelegate delegate;
+
+    // The CRL signer of the PAI entry is the PAA, whose subject is not the issuer of the DAC.
+    std::string entry(kDacRevocationEntry);
+    std::string paiEntry(kPaiRevocationEntry);
+    const std::string signerKey = "\"crl_signer_cert\": \"";
+    size_t start                = entry.find(signerKey) + signerKey.size();
+    size_t paiStart             = paiEntry.find(signerKey) + signerKey.size();
+    entry.replace(start, entry.find('"', start) - start, paiEntry.substr(paiStart, paiEntry.find('"', paiStart) - paiStart));
+
+    EXPECT_SUCCESS(delegate.LoadRevocationSet("[" + entry + "]"));
+    EXPECT_EQ(delegate.GetEntryCount(), 0u);
+    EXPECT_EQ(Check(delegate), AttestationVerificationResult::kSuccess);
+}
+
+TEST_F(TestIndexedDACRevocationDelegate, RejectsMalformedRevocationSet)
+{
+    IndexedDACRevocationDelegate delegate;
+
+    EXPECT_EQ(delegate.LoadRevocationSet(""), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(delegate.LoadRevocationSet(kDacRevocationEntry), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(delegate.LoadRevocationSet("[1]"), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_FALSE(delegate.HasIndex());
+}
+
+TEST_F(TestIndexedDACRevocationDelegate, RoundTripsThroughIndexFile)
+{
+    const std::string jsonPath  = TempPath();
+    const std::string indexPath = TempPath();
+    {
+        std::ofstream json(jsonPath);
+        json << "[" << kDacRevocationEntry << "," << kPaiRevocationEntry << "]";
+    }
+
+    EXPECT_SUCCESS(IndexedDACRevocationDelegate::ConvertRevocationSetToIndexFile(jsonPath, indexPath));
+
+    IndexedDACRevocationDelegate delegate;
+    EXPECT_SUCCESS(delegate.LoadIndexFile(indexPath));
+    EXPECT_EQ(delegate.GetEntryCount(), 3u);
+    EXPECT_EQ(Check(delegate), AttestationVerificationResult::kPaiAndDacRevoked);
+
+    // A truncated index is rejected.
+    {
+        std::ofstream index(indexPath, std::ios::binary | std::ios::trunc);
+        index << "MRSI";
+    }
+    EXPECT_NE(delegate.LoadIndexFile(indexPath), CHIP_NO_ERROR);
+    EXPECT_FALSE(delegate.HasIndex());
+    EXPECT_NE(delegate.LoadIndexFile(jsonPath), CHIP_NO_ERROR);
+
+    unlink(jsonPath.c_str());
+    unlink(indexPath.c_str());
+}
@@ -849,6 +849,58 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
                            size_t nonce_length, uint8_t * plaintext);
 
+#if CHIP_CRYPTO_MBEDTLS || CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+#define CHIP_CRYPTO_HAVE_AES_CCM_CONTEXT 1
+#else
+#define CHIP_CRYPTO_HAVE_AES_CCM_CONTEXT 0
+#endif
+
+#if CHIP_CRYPTO_HAVE_AES_CCM_CONTEXT
+/**
+ * @brief AES-CCM state bound to a single key, reusable across messages.
+ *
+ * AES_CCM_encrypt() and AES_CCM_decrypt() expand the key schedule on every call. This context expands it once in Init()
+ * and keeps it until Clear(), which is cheaper for callers that process many messages with the same key.
+ *
+ * Only the nonce and tag lengths of Matter messages are supported: `nonce_length` must be
+ * CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES and `tag_length` must be CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES. Other parameters
+ * follow the contract of AES_CCM_encrypt() and AES_CCM_decrypt().
+ */
+class AesCcmContext
+{
+public:
+    AesCcmContext() = default;
+    ~AesCcmContext() { Clear(); }
+
+    AesCcmContext(const AesCcmContext &)             = delete;
+    AesCcmContext & operator=(const AesCcmContext &) = delete;
+
+    /**
+     * @brief Expand the key schedule of `key`, replacing any previously set key.
+     *
+     * @return CHIP_ERROR_NO_MEMORY if the backend state could not be allocated, CHIP_ERROR_INTERNAL on
+     *         other backend failures, CHIP_NO_ERROR otherwise.
+     */
+    CHIP_ERROR Init(const Aes128KeyHandle & key);
+
+    bool IsInitialized() const { return mContext != nullptr; }
+
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length);
+
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext);
+
+    /**
+     * @brief Release the backend state, including the expanded key schedule.
+     */
+    void Clear();
+
+private:
+    void * mContext = nullptr;
+};
+#endif // CHIP_CRYPTO_HAVE_AES_CCM_CONTEXT
+
 /**
  * @brief A function that implements AES-CTR encryption/decryption
  *
@@ -49,6 +49,7 @@
 #include <lib/support/BufferWriter.h>
 #include <lib/support/BytesToHex.h>
 #include <lib/support/CHIPArgParser.hpp>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/SafePointerCast.h>
@@ -404,6 +405,239 @@ exit:
     return error;
 }
 
+#if CHIP_CRYPTO_BORINGSSL
+
+CHIP_ERROR AesCcmContext::Init(const Aes128KeyHandle & key)
+{
+    Clear();
+
+    EVP_AEAD_CTX * context = EVP_AEAD_CTX_new(EVP_aead_aes_128_ccm_matter(), key.As<Symmetric128BitsKeyByteArray>(),
+                                              sizeof(Symmetric128BitsKeyByteArray), CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mContext = context;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcmContext::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                  const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                  size_t tag_length)
+{
+    size_t written_tag_len = 0;
+
+    VerifyOrReturnError(mContext != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(plaintext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr && nonce_length == CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr && tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+
+    int result = EVP_AEAD_CTX_seal_scatter(static_cast<EVP_AEAD_CTX *>(mContext), ciphertext, tag, &written_tag_len, tag_length,
+                                           nonce, nonce_length, plaintext, plaintext_length, nullptr, 0, aad, aad_length);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(written_tag_len == tag_length, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcmContext::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                  const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                  uint8_t * plaintext)
+{
+    VerifyOrReturnError(mContext != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(ciphertext != nullptr || ciphertext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr || ciphertext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr && nonce_length == CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr && tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+
+    int result = EVP_AEAD_CTX_open_gather(static_cast<EVP_AEAD_CTX *>(mContext), plaintext, nonce, nonce_length, ciphertext,
+                                          ciphertext_length, tag, tag_length, aad, aad_length);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+void AesCcmContext::Clear()
+{
+    if (mContext != nullptr)
+    {
+        EVP_AEAD_CTX_free(static_cast<EVP_AEAD_CTX *>(mContext));
+        mContext = nullptr;
+    }
+}
+
+#else
+
+namespace {
+
+// OpenSSL selects direction-specific CCM routines when the key is set, so a keyed EVP_CIPHER_CTX can only be used
+// in the direction it was keyed for: AesCcmContext keeps one for each direction.
+struct OpenSSLAesCcmContext
+{
+    EVP_CIPHER_CTX * encryptContext;
+    EVP_CIPHER_CTX * decryptContext;
+};
+
+EVP_CIPHER_CTX * NewKeyedAesCcmContext(const Aes128KeyHandle & key, int encrypt)
+{
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnValue(context != nullptr, nullptr);
+
+    // The nonce and tag lengths are also bound to the key schedule, so they are set before the key and never change.
+    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+    if (EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, encrypt) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES, nullptr) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, nullptr) != 1 ||
+        EVP_CipherInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), nullptr, encrypt) != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return nullptr;
+    }
+
+    return context;
+}
+
+} // namespace
+
+CHIP_ERROR AesCcmContext::Init(const Aes128KeyHandle & key)
+{
+    Clear();
+
+    OpenSSLAesCcmContext * context = Platform::New<OpenSSLAesCcmContext>();
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+    mContext = context;
+
+    context->encryptContext = NewKeyedAesCcmContext(key, 1);
+    context->decryptContext = NewKeyedAesCcmContext(key, 0);
+    if (context->encryptContext == nullptr || context->decryptContext == nullptr)
+    {
+        Clear();
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcmContext::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                  const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                  size_t tag_length)
+{
+    int bytesWritten         = 0;
+    size_t ciphertext_length = 0;
+
+    // See AES_CCM_encrypt() for why these are needed.
+    uint8_t placeholder_empty_plaintext = 0;
+    uint8_t placeholder_ciphertext[kAES_CCM128_Block_Length];
+
+    VerifyOrReturnError(mContext != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(plaintext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(plaintext_length) && CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr && nonce_length == CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr && tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+
+    EVP_CIPHER_CTX * context = static_cast<OpenSSLAesCcmContext *>(mContext)->encryptContext;
+
+    if (plaintext_length == 0)
+    {
+        plaintext  = &placeholder_empty_plaintext;
+        ciphertext = &placeholder_ciphertext[0];
+    }
+
+    // Only the nonce is passed in: the key schedule set up by Init() is kept.
+    VerifyOrReturnError(EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    VerifyOrReturnError(EVP_EncryptUpdate(context, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(EVP_EncryptUpdate(context, nullptr, &bytesWritten, Uint8::to_const_uchar(aad),
+                                              static_cast<int>(aad_length)) == 1,
+                            CHIP_ERROR_INTERNAL);
+    }
+
+    VerifyOrReturnError(EVP_EncryptUpdate(context, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
+                                          static_cast<int>(plaintext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten >= 0, CHIP_ERROR_INTERNAL);
+    ciphertext_length = static_cast<unsigned int>(bytesWritten);
+
+    VerifyOrReturnError(EVP_EncryptFinal_ex(context, ciphertext + ciphertext_length, &bytesWritten) == 1, CHIP_ERROR_INTERNAL);
+
+    VerifyOrReturnError(EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcmContext::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                  const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                  uint8_t * plaintext)
+{
+    int bytesOutput = 0;
+
+    // See AES_CCM_decrypt() for why these are needed.
+    uint8_t placeholder_empty_ciphertext = 0;
+    uint8_t placeholder_plaintext[kAES_CCM128_Block_Length];
+
+    VerifyOrReturnError(mContext != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(ciphertext != nullptr || ciphertext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr || ciphertext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(ciphertext_length) && CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr && nonce_length == CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr && tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+
+    EVP_CIPHER_CTX * context = static_cast<OpenSSLAesCcmContext *>(mContext)->decryptContext;
+
+    if (ciphertext_length == 0)
+    {
+        ciphertext = &placeholder_empty_ciphertext;
+        plaintext  = &placeholder_plaintext[0];
+    }
+
+    // Removing "const" from |tag| is safe, the tag is only read.
+    VerifyOrReturnError(EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                            const_cast<void *>(static_cast<const void *>(tag))) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    // Only the nonce is passed in: the key schedule set up by Init() is kept.
+    VerifyOrReturnError(EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    VerifyOrReturnError(EVP_DecryptUpdate(context, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(EVP_DecryptUpdate(context, nullptr, &bytesOutput, Uint8::to_const_uchar(aad),
+                                              static_cast<int>(aad_length)) == 1,
+                            CHIP_ERROR_INTERNAL);
+    }
+
+    // Nothing is written to |plaintext| if the tag does not match.
+    VerifyOrReturnError(EVP_DecryptUpdate(context, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
+                                          static_cast<int>(ciphertext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+void AesCcmContext::Clear()
+{
+    if (mContext != nullptr)
+    {
+        OpenSSLAesCcmContext * context = static_cast<OpenSSLAesCcmContext *>(mContext);
+        // Freeing also wipes the expanded key schedules.
+        EVP_CIPHER_CTX_free(context->encryptContext);
+        EVP_CIPHER_CTX_free(context->decryptContext);
+        Platform::Delete(context);
+        mContext = nullptr;
+    }
+}
+
+#endif // CHIP_CRYPTO_BORINGSSL
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
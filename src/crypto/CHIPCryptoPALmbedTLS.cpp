@@ -45,6 +45,7 @@
 #include <lib/support/BufferWriter.h>
 #include <lib/support/BytesToHex.h>
 #include <lib/support/CHIPArgParser.hpp>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/SafePointerCast.h>
@@ -150,6 +151,83 @@ exit:
     return error;
 }
 
+CHIP_ERROR AesCcmContext::Init(const Aes128KeyHandle & key)
+{
+    Clear();
+
+    mbedtls_ccm_context * context = Platform::New<mbedtls_ccm_context>();
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+    mbedtls_ccm_init(context);
+
+    // Size of key is expressed in bits, hence the multiplication by 8.
+    int result = mbedtls_ccm_setkey(context, MBEDTLS_CIPHER_ID_AES, key.As<Symmetric128BitsKeyByteArray>(),
+                                    sizeof(Symmetric128BitsKeyByteArray) * 8);
+    _log_mbedTLS_error(result);
+    if (result != 0)
+    {
+        mbedtls_ccm_free(context);
+        Platform::Delete(context);
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    mContext = context;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcmContext::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                  const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                  size_t tag_length)
+{
+    VerifyOrReturnError(mContext != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(plaintext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr && nonce_length == CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr && tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+
+    int result = mbedtls_ccm_encrypt_and_tag(static_cast<mbedtls_ccm_context *>(mContext), plaintext_length,
+                                             Uint8::to_const_uchar(nonce), nonce_length, Uint8::to_const_uchar(aad), aad_length,
+                                             Uint8::to_const_uchar(plaintext), Uint8::to_uchar(ciphertext), Uint8::to_uchar(tag),
+                                             tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcmContext::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                  const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                  uint8_t * plaintext)
+{
+    VerifyOrReturnError(mContext != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(ciphertext != nullptr || ciphertext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr || ciphertext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr && nonce_length == CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr && tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+
+    int result = mbedtls_ccm_auth_decrypt(static_cast<mbedtls_ccm_context *>(mContext), ciphertext_length,
+                                          Uint8::to_const_uchar(nonce), nonce_length, Uint8::to_const_uchar(aad), aad_length,
+                                          Uint8::to_const_uchar(ciphertext), Uint8::to_uchar(plaintext), Uint8::to_const_uchar(tag),
+                                          tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+void AesCcmContext::Clear()
+{
+    if (mContext != nullptr)
+    {
+        mbedtls_ccm_context * context = static_cast<mbedtls_ccm_context *>(mContext);
+        // Also wipes the expanded key schedule.
+        mbedtls_ccm_free(context);
+        Platform::Delete(context);
+        mContext = nullptr;
+    }
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
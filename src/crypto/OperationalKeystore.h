@@ -221,6 +221,51 @@ public:
     virtual CHIP_ERROR SignWithOpKeypair(FabricIndex fabricIndex, const ByteSpan & message,
                                          Crypto::P256ECDSASignature & outSignature) const = 0;
 
+    /**
+     * @brief Completion of `SignWithOpKeypairAsync`, with the result of the signature.
+     */
+    using SignCompletion = void (*)(void * context, CHIP_ERROR result);
+
+    /**
+     * @brief Whether `SignWithOpKeypairAsync` is implemented.
+     *
+     * If true, `CASESession` starts the Sigma3 signature with `SignWithOpKeypairAsync` and completes
+     * Sigma3 from the completion, so that keystores backed by a secure element or a hardware crypto
+     * queue can keep several signatures in flight without blocking the Matter thread. This takes
+     * precedence over `SupportsSignWithOpKeypairInBackground`.
+     *
+     * @retval true if `SignWithOpKeypairAsync` may be used
+     * @retval false if only `SignWithOpKeypair` may be used
+     */
+    virtual bool SupportsSignWithOpKeypairAsync() const { return false; }
+
+    /**
+     * @brief Start signing a message with a fabric's currently-active operational keypair, as `SignWithOpKeypair`.
+     *
+     * On success, `completion` is called exactly once with `context` and the result of the signature, on the
+     * Matter thread, and never from within this call. Until then, `message` and `outSignature` must remain
+     * valid and must not be touched by the caller. No completion is called if this returns an error.
+     *
+     * @param fabricIndex - FabricIndex whose operational keypair will be used to sign the `message`
+     * @param message - Message to sign with the currently active operational keypair
+     * @param outSignature - Buffer to contain the signature
+     * @param completion - Called once the signature is done or failed
+     * @param context - Passed to `completion`
+     *
+     * @retval CHIP_NO_ERROR if the signature was started
+     * @retval CHIP_ERROR_INCORRECT_STATE if the key store is not properly initialized.
+     * @retval CHIP_ERROR_INVALID_FABRIC_INDEX if no active key is found for the given `fabricIndex` or if
+     *                                         `fabricIndex` is invalid.
+     * @retval CHIP_ERROR_NO_MEMORY if too many signatures are in flight already
+     * @retval CHIP_ERROR_NOT_IMPLEMENTED if `SupportsSignWithOpKeypairAsync` returns false
+     */
+    virtual CHIP_ERROR SignWithOpKeypairAsync(FabricIndex fabricIndex, const ByteSpan & message,
+                                              Crypto::P256ECDSASignature & outSignature, SignCompletion completion,
+                                              void * context) const
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
     /**
      * @brief Create an ephemeral keypair for use in session establishment.
      *
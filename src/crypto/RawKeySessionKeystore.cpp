@@ -95,6 +95,9 @@ CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const HkdfKeyHandle & hkdfKe
 
 void RawKeySessionKeystore::DestroyKey(Symmetric128BitsKeyHandle & key)
 {
+#if CHIP_RAW_KEYSTORE_AES_CCM_CACHE
+    EvictAesCcmContext(key.As<Symmetric128BitsKeyByteArray>());
+#endif // CHIP_RAW_KEYSTORE_AES_CCM_CACHE
     ClearSecretData(key.AsMutable<Symmetric128BitsKeyByteArray>());
 }
 
@@ -106,5 +109,126 @@ void RawKeySessionKeystore::DestroyKey(HkdfKeyHandle & key)
     rawKey.size = 0;
 }
 
+#if CHIP_RAW_KEYSTORE_AES_CCM_CACHE
+
+namespace {
+
+// AesCcmContext only supports the nonce and tag lengths of Matter messages.
+bool CanUseAesCcmContext(size_t nonceLength, size_t tagLength)
+{
+    return nonceLength == CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES && tagLength == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
+}
+
+} // namespace
+
+CHIP_ERROR RawKeySessionKeystore::AesCcmEncrypt(const Aes128KeyHandle & key, const uint8_t * plaintext, size_t plaintext_length,
+                                                const uint8_t * aad, size_t aad_length, const uint8_t * nonce,
+                                                size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    AesCcmContext * context = CanUseAesCcmContext(nonce_length, tag_length) ? GetAesCcmContext(key) : nullptr;
+
+    if (context == nullptr)
+    {
+        return SessionKeystore::AesCcmEncrypt(key, plaintext, plaintext_length, aad, aad_length, nonce, nonce_length, ciphertext,
+                                              tag, tag_length);
+    }
+
+    return context->Encrypt(plaintext, plaintext_length, aad, aad_length, nonce, nonce_length, ciphertext, tag, tag_length);
+}
+
+CHIP_ERROR RawKeySessionKeystore::AesCcmDecrypt(const Aes128KeyHandle & key, const uint8_t * ciphertext,
+                                                size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                                const uint8_t * tag, size_t tag_length, const uint8_t * nonce,
+                                                size_t nonce_length, uint8_t * plaintext)
+{
+    AesCcmContext * context = CanUseAesCcmContext(nonce_length, tag_length) ? GetAesCcmContext(key) : nullptr;
+
+    if (context == nullptr)
+    {
+        return SessionKeystore::AesCcmDecrypt(key, ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, nonce,
+                                              nonce_length, plaintext);
+    }
+
+    return context->Decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, nonce, nonce_length, plaintext);
+}
+
+CHIP_ERROR RawKeySessionKeystore::AesCcmEncryptBatch(const Aes128KeyHandle & key, Span<AesCcmEncryptRequest> requests)
+{
+    AesCcmContext * context = GetAesCcmContext(key);
+
+    VerifyOrReturnError(context != nullptr, SessionKeystore::AesCcmEncryptBatch(key, requests));
+
+    for (AesCcmEncryptRequest & request : requests)
+    {
+        if (CanUseAesCcmContext(request.nonce.size(), request.tag.size()))
+        {
+            ReturnErrorOnFailure(context->Encrypt(request.plaintext.data(), request.plaintext.size(), request.aad.data(),
+                                                  request.aad.size(), request.nonce.data(), request.nonce.size(),
+                                                  request.ciphertext, request.tag.data(), request.tag.size()));
+        }
+        else
+        {
+            ReturnErrorOnFailure(SessionKeystore::AesCcmEncrypt(key, request.plaintext.data(), request.plaintext.size(),
+                                                                request.aad.data(), request.aad.size(), request.nonce.data(),
+                                                                request.nonce.size(), request.ciphertext, request.tag.data(),
+                                                                request.tag.size()));
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+AesCcmContext * RawKeySessionKeystore::GetAesCcmContext(const Aes128KeyHandle & key)
+{
+    const Symmetric128BitsKeyByteArray & keyBytes = key.As<Symmetric128BitsKeyByteArray>();
+    AesCcmCacheEntry * victim                      = &mAesCcmCache[0];
+
+    for (AesCcmCacheEntry & entry : mAesCcmCache)
+    {
+        if (!entry.context.IsInitialized())
+        {
+            victim = &entry;
+            continue;
+        }
+
+        if (IsBufferContentEqualConstantTime(entry.key, keyBytes, sizeof(keyBytes)))
+        {
+            entry.lastUse = ++mAesCcmUseCounter;
+            return &entry.context;
+        }
+
+        if (victim->context.IsInitialized() && entry.lastUse < victim->lastUse)
+        {
+            victim = &entry;
+        }
+    }
+
+    if (victim->context.Init(key) != CHIP_NO_ERROR)
+    {
+        ClearSecretData(victim->key);
+        return nullptr;
+    }
+
+    memcpy(victim->key, keyBytes, sizeof(keyBytes));
+    victim->lastUse = ++mAesCcmUseCounter;
+
+    return &victim->context;
+}
+
+void RawKeySessionKeystore::EvictAesCcmContext(const Symmetric128BitsKeyByteArray & key)
+{
+    for (AesCcmCacheEntry & entry : mAesCcmCache)
+    {
+        if (entry.context.IsInitialized() && IsBufferContentEqualConstantTime(entry.key, key, sizeof(key)))
+        {
+            entry.context.Clear();
+            ClearSecretData(entry.key);
+            entry.lastUse = 0;
+        }
+    }
+}
+
+#endif // CHIP_RAW_KEYSTORE_AES_CCM_CACHE
+
 } // namespace Crypto
 } // namespace chip
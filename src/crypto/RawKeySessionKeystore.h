@@ -22,6 +22,12 @@
 namespace chip {
 namespace Crypto {
 
+#if CHIP_CRYPTO_HAVE_AES_CCM_CONTEXT && CHIP_CONFIG_RAW_KEYSTORE_AES_CCM_CACHE_SIZE > 0
+#define CHIP_RAW_KEYSTORE_AES_CCM_CACHE 1
+#else
+#define CHIP_RAW_KEYSTORE_AES_CCM_CACHE 0
+#endif
+
 class RawKeySessionKeystore : public SessionKeystore
 {
 public:
@@ -37,6 +43,34 @@ public:
                                  AttestationChallenge & attestationChallenge) override;
     void DestroyKey(Symmetric128BitsKeyHandle & key) override;
     void DestroyKey(HkdfKeyHandle & key) override;
+
+#if CHIP_RAW_KEYSTORE_AES_CCM_CACHE
+    CHIP_ERROR AesCcmEncrypt(const Aes128KeyHandle & key, const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad,
+                             size_t aad_length, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                             size_t tag_length) override;
+    CHIP_ERROR AesCcmDecrypt(const Aes128KeyHandle & key, const uint8_t * ciphertext, size_t ciphertext_length,
+                             const uint8_t * aad, size_t aad_length, const uint8_t * tag, size_t tag_length,
+                             const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext) override;
+    CHIP_ERROR AesCcmEncryptBatch(const Aes128KeyHandle & key, Span<AesCcmEncryptRequest> requests) override;
+
+private:
+    struct AesCcmCacheEntry
+    {
+        ~AesCcmCacheEntry() { ClearSecretData(key); }
+
+        Symmetric128BitsKeyByteArray key;
+        AesCcmContext context;
+        uint32_t lastUse = 0;
+    };
+
+    // Returns the AES-CCM context for the key, replacing the least recently used one if the key is not cached yet.
+    // Returns nullptr if the context could not be set up, in which case callers fall back to the one-shot functions.
+    AesCcmContext * GetAesCcmContext(const Aes128KeyHandle & key);
+    void EvictAesCcmContext(const Symmetric128BitsKeyByteArray & key);
+
+    AesCcmCacheEntry mAesCcmCache[CHIP_CONFIG_RAW_KEYSTORE_AES_CCM_CACHE_SIZE];
+    uint32_t mAesCcmUseCounter = 0;
+#endif // CHIP_RAW_KEYSTORE_AES_CCM_CACHE
 };
 
 } // namespace Crypto
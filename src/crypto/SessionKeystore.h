@@ -23,6 +23,20 @@
 namespace chip {
 namespace Crypto {
 
+/**
+ * @brief A single message of an AES-CCM batch encryption, see SessionKeystore::AesCcmEncryptBatch().
+ */
+struct AesCcmEncryptRequest
+{
+    ByteSpan plaintext;
+    ByteSpan aad;
+    ByteSpan nonce;
+    // Must be able to hold plaintext.size() bytes. May be the same buffer as plaintext.
+    uint8_t * ciphertext = nullptr;
+    // Its size is the expected tag length.
+    MutableByteSpan tag;
+};
+
 /**
  * @brief Interface for deriving session keys and managing their lifetime.
  *
@@ -151,6 +165,54 @@ public:
      * using the DestroyKey() method when the key is no longer needed.
      */
     virtual CHIP_ERROR PersistICDKey(Symmetric128BitsKeyHandle & key) { return CHIP_NO_ERROR; }
+
+    /****************************
+     * Message encryption APIs
+     *****************************/
+
+    /**
+     * @brief Encrypt a message with AES-CCM using a key created by this keystore.
+     *
+     * Same contract as Crypto::AES_CCM_encrypt(). Keystores that can keep per-key crypto state between messages override
+     * this method; the default implementation simply calls Crypto::AES_CCM_encrypt().
+     */
+    virtual CHIP_ERROR AesCcmEncrypt(const Aes128KeyHandle & key, const uint8_t * plaintext, size_t plaintext_length,
+                                     const uint8_t * aad, size_t aad_length, const uint8_t * nonce, size_t nonce_length,
+                                     uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+    {
+        return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, key, nonce, nonce_length, ciphertext, tag,
+                               tag_length);
+    }
+
+    /**
+     * @brief Decrypt a message with AES-CCM using a key created by this keystore.
+     *
+     * Same contract as Crypto::AES_CCM_decrypt(). The default implementation simply calls Crypto::AES_CCM_decrypt().
+     */
+    virtual CHIP_ERROR AesCcmDecrypt(const Aes128KeyHandle & key, const uint8_t * ciphertext, size_t ciphertext_length,
+                                     const uint8_t * aad, size_t aad_length, const uint8_t * tag, size_t tag_length,
+                                     const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext)
+    {
+        return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, key, nonce, nonce_length,
+                               plaintext);
+    }
+
+    /**
+     * @brief Encrypt several messages with the same AES-CCM key.
+     *
+     * Requests are processed in order, and processing stops at the first failure, whose error is returned. Keystores
+     * may use this to look up or set up the per-key state only once for the whole batch.
+     */
+    virtual CHIP_ERROR AesCcmEncryptBatch(const Aes128KeyHandle & key, Span<AesCcmEncryptRequest> requests)
+    {
+        for (AesCcmEncryptRequest & request : requests)
+        {
+            ReturnErrorOnFailure(AesCcmEncrypt(key, request.plaintext.data(), request.plaintext.size(), request.aad.data(),
+                                               request.aad.size(), request.nonce.data(), request.nonce.size(), request.ciphertext,
+                                               request.tag.data(), request.tag.size()));
+        }
+        return CHIP_NO_ERROR;
+    }
 };
 
 /**
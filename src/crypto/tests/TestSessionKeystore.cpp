@@ -150,6 +150,115 @@ TEST_F(TestSessionKeystore, TestBasicImport)
     }
 }
 
+TEST_F(TestSessionKeystore, TestAesCcmThroughKeystore)
+{
+    TestSessionKeystoreImpl keystore;
+
+    for (const ccm_128_test_vector * testPtr : ccm_128_test_vectors)
+    {
+        const ccm_128_test_vector & test = *testPtr;
+
+        Symmetric128BitsKeyByteArray keyMaterial;
+        memcpy(keyMaterial, test.key, test.key_len);
+
+        Aes128KeyHandle keyHandle;
+        EXPECT_EQ(keystore.CreateKey(keyMaterial, keyHandle), CHIP_NO_ERROR);
+
+        Platform::ScopedMemoryBuffer<uint8_t> ciphertext;
+        Platform::ScopedMemoryBuffer<uint8_t> plaintext;
+        uint8_t * ciphertext_ptr = nullptr;
+        uint8_t * plaintext_ptr  = nullptr;
+        if (test.ct_len > 0)
+        {
+            EXPECT_TRUE(ciphertext.Alloc(test.ct_len));
+            EXPECT_TRUE(plaintext.Alloc(test.pt_len));
+            ciphertext_ptr = ciphertext.Get();
+            plaintext_ptr  = plaintext.Get();
+        }
+        uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        ASSERT_LE(test.tag_len, sizeof(tag));
+
+        // Go through the keystore twice, so that keystores keeping per-key state also use the state set up the first time.
+        for (int i = 0; i < 2; i++)
+        {
+            EXPECT_EQ(keystore.AesCcmEncrypt(keyHandle, test.pt, test.pt_len, test.aad, test.aad_len, test.nonce, test.nonce_len,
+                                             ciphertext_ptr, tag, test.tag_len),
+                      test.result);
+            if (test.result != CHIP_NO_ERROR)
+            {
+                continue;
+            }
+            EXPECT_EQ(memcmp(ciphertext_ptr, test.ct, test.ct_len), 0);
+            EXPECT_EQ(memcmp(tag, test.tag, test.tag_len), 0);
+
+            EXPECT_EQ(keystore.AesCcmDecrypt(keyHandle, test.ct, test.ct_len, test.aad, test.aad_len, test.tag, test.tag_len,
+                                             test.nonce, test.nonce_len, plaintext_ptr),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(plaintext_ptr, test.pt, test.pt_len), 0);
+
+            // A bad tag is rejected, and does not prevent the next message from being decrypted.
+            tag[0] ^= 0x01;
+            EXPECT_NE(keystore.AesCcmDecrypt(keyHandle, test.ct, test.ct_len, test.aad, test.aad_len, tag, test.tag_len,
+                                             test.nonce, test.nonce_len, plaintext_ptr),
+                      CHIP_NO_ERROR);
+        }
+
+        keystore.DestroyKey(keyHandle);
+    }
+}
+
+TEST_F(TestSessionKeystore, TestAesCcmEncryptBatch)
+{
+    TestSessionKeystoreImpl keystore;
+
+    Symmetric128BitsKeyByteArray keyMaterial = { 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08,
+                                                 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00 };
+    Aes128KeyHandle keyHandle;
+    EXPECT_EQ(keystore.CreateKey(keyMaterial, keyHandle), CHIP_NO_ERROR);
+
+    constexpr size_t kMessageCount = 4;
+    const uint8_t aad[]            = { 0xa0, 0xa1, 0xa2, 0xa3 };
+    uint8_t plaintexts[kMessageCount][32];
+    uint8_t nonces[kMessageCount][CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES];
+    uint8_t ciphertexts[kMessageCount][32];
+    uint8_t tags[kMessageCount][CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+    AesCcmEncryptRequest requests[kMessageCount];
+
+    for (size_t i = 0; i < kMessageCount; i++)
+    {
+        memset(plaintexts[i], static_cast<int>(i), sizeof(plaintexts[i]));
+        memset(nonces[i], static_cast<int>(0x10 + i), sizeof(nonces[i]));
+
+        requests[i].plaintext  = ByteSpan(plaintexts[i], 8 * (i + 1));
+        requests[i].aad        = ByteSpan(aad);
+        requests[i].nonce      = ByteSpan(nonces[i]);
+        requests[i].ciphertext = ciphertexts[i];
+        requests[i].tag        = MutableByteSpan(tags[i]);
+    }
+
+    EXPECT_EQ(keystore.AesCcmEncryptBatch(keyHandle, Span<AesCcmEncryptRequest>(requests)), CHIP_NO_ERROR);
+
+    // Each message of the batch matches the one-shot encryption of the same message.
+    for (size_t i = 0; i < kMessageCount; i++)
+    {
+        uint8_t expectedCiphertext[sizeof(ciphertexts[i])];
+        uint8_t expectedTag[sizeof(tags[i])];
+        size_t length = requests[i].plaintext.size();
+
+        EXPECT_EQ(AES_CCM_encrypt(plaintexts[i], length, aad, sizeof(aad), keyHandle, nonces[i], sizeof(nonces[i]),
+                                  expectedCiphertext, expectedTag, sizeof(expectedTag)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(ciphertexts[i], expectedCiphertext, length), 0);
+        EXPECT_EQ(memcmp(tags[i], expectedTag, sizeof(expectedTag)), 0);
+    }
+
+    // Processing stops at the first invalid request.
+    requests[1].nonce = ByteSpan();
+    EXPECT_NE(keystore.AesCcmEncryptBatch(keyHandle, Span<AesCcmEncryptRequest>(requests)), CHIP_NO_ERROR);
+
+    keystore.DestroyKey(keyHandle);
+}
+
 TEST_F(TestSessionKeystore, TestDeriveKey)
 {
     TestSessionKeystoreImpl keystore;
@@ -0,0 +1,443 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Latency benchmarks for the Crypto PAL, so that the OpenSSL, mbedTLS, PSA and platform backends can be
+ *      compared on the operations the stack relies on.
+ *
+ *      Everything goes through the CHIPCryptoPAL.h API: AES-CCM at message-sized payloads, ECDSA and ECDH on
+ *      P-256, HKDF as used for session keys, and for PASE, PBKDF2 and verifier generation at the iteration counts
+ *      found on devices, plus each SPAKE2+ prover and verifier stage in the order a handshake goes through them.
+ *
+ *      With --format=json, each result is printed as one JSON object per line, for trending in CI.
+ *
+ *      Usage: crypto-benchmark [--min-time-ms=<ms>] [--format=text|json] [<name filter>]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#if CHIP_CRYPTO_PSA_SPAKE2P
+#include <crypto/PSASpake2p.h>
+#endif
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+#if CHIP_CRYPTO_PSA_SPAKE2P
+using Spake2pImpl = PSASpake2p_P256_SHA256_HKDF_HMAC;
+#else
+using Spake2pImpl = Spake2p_P256_SHA256_HKDF_HMAC;
+#endif
+
+constexpr uint32_t kDefaultMinTimeMs = 500;
+constexpr uint32_t kSetupPasscode    = 20202021;
+constexpr uint8_t kSalt[]            = { 0x53, 0x50, 0x41, 0x4b, 0x45, 0x32, 0x50, 0x20,
+                                         0x4b, 0x65, 0x79, 0x20, 0x53, 0x61, 0x6c, 0x74 };
+constexpr uint8_t kContext[]         = { 0x50, 0x41, 0x53, 0x45, 0x20, 0x62, 0x65, 0x6e, 0x63, 0x68 };
+constexpr uint8_t kSessionKeysInfo[] = { 0x53, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x4b, 0x65, 0x79, 0x73 };
+constexpr size_t kAadLength          = 8;  // Unsecured message header of a unicast message
+constexpr size_t kSignedLength       = 256; // About the size of the Sigma2/Sigma3 TBS data
+constexpr size_t kMaxPayloadLength   = 1280;
+
+// Inputs and outputs of the symmetric and signature benchmarks.
+uint8_t gInput[kMaxPayloadLength];
+uint8_t gOutput[kMaxPayloadLength];
+
+// Outputs end up here so that the computations cannot be optimized away.
+volatile uint8_t gSink;
+
+enum class Format
+{
+    kText,
+    kJson,
+};
+
+// Keys shared by the benchmarks, created on first use, once the platform memory is initialized.
+struct Keys
+{
+    Keys()
+    {
+        Symmetric128BitsKeyByteArray keyMaterial;
+        memset(keyMaterial, 0x42, sizeof(keyMaterial));
+        SuccessOrDie(mKeystore.CreateKey(keyMaterial, mAesKey));
+        SuccessOrDie(mLocal.Initialize(ECPKeyTarget::ECDH));
+        SuccessOrDie(mRemote.Initialize(ECPKeyTarget::ECDH));
+        SuccessOrDie(mLocal.ECDSA_sign_msg(gInput, kSignedLength, mSignature));
+    }
+    ~Keys() { mKeystore.DestroyKey(mAesKey); }
+
+    DefaultSessionKeystore mKeystore;
+    Aes128KeyHandle mAesKey;
+    P256Keypair mLocal;
+    P256Keypair mRemote;
+    P256ECDSASignature mSignature;
+};
+
+Keys & GetKeys()
+{
+    static Keys keys;
+    return keys;
+}
+
+const char * CryptoBackend()
+{
+#if CHIP_CRYPTO_PSA
+    return "PSA";
+#elif CHIP_CRYPTO_MBEDTLS
+    return "mbedTLS";
+#elif CHIP_CRYPTO_BORINGSSL
+    return "BoringSSL";
+#elif CHIP_CRYPTO_OPENSSL
+    return "OpenSSL";
+#elif CHIP_CRYPTO_PLATFORM
+    return "platform";
+#else
+    return "unknown";
+#endif
+}
+
+template <size_t kLength>
+Clock::duration BenchAesCcmEncrypt()
+{
+    static_assert(kLength > kAadLength && kLength <= kMaxPayloadLength, "Payload does not fit");
+    Keys & keys = GetKeys();
+    uint8_t nonce[kAES_CCM128_Nonce_Length] = { 0 };
+    uint8_t tag[kAES_CCM128_Tag_Length];
+
+    auto start = Clock::now();
+    SuccessOrDie(AES_CCM_encrypt(&gInput[kAadLength], kLength - kAadLength, gInput, kAadLength, keys.mAesKey, nonce,
+                                 sizeof(nonce), gOutput, tag, sizeof(tag)));
+    auto elapsed = Clock::now() - start;
+
+    gSink = tag[0];
+    return elapsed;
+}
+
+template <size_t kLength>
+Clock::duration BenchAesCcmDecrypt()
+{
+    static_assert(kLength > kAadLength && kLength <= kMaxPayloadLength, "Payload does not fit");
+    Keys & keys = GetKeys();
+    uint8_t nonce[kAES_CCM128_Nonce_Length] = { 0 };
+    uint8_t tag[kAES_CCM128_Tag_Length];
+    uint8_t ciphertext[kLength - kAadLength];
+    SuccessOrDie(AES_CCM_encrypt(&gInput[kAadLength], sizeof(ciphertext), gInput, kAadLength, keys.mAesKey, nonce,
+                                 sizeof(nonce), ciphertext, tag, sizeof(tag)));
+
+    auto start = Clock::now();
+    SuccessOrDie(AES_CCM_decrypt(ciphertext, sizeof(ciphertext), gInput, kAadLength, tag, sizeof(tag), keys.mAesKey, nonce,
+                                 sizeof(nonce), gOutput));
+    auto elapsed = Clock::now() - start;
+
+    gSink = gOutput[0];
+    return elapsed;
+}
+
+Clock::duration BenchEcdsaSign()
+{
+    Keys & keys = GetKeys();
+    P256ECDSASignature signature;
+
+    auto start = Clock::now();
+    SuccessOrDie(keys.mLocal.ECDSA_sign_msg(gInput, kSignedLength, signature));
+    auto elapsed = Clock::now() - start;
+
+    gSink = signature.ConstBytes()[0];
+    return elapsed;
+}
+
+Clock::duration BenchEcdsaVerify()
+{
+    Keys & keys = GetKeys();
+
+    auto start = Clock::now();
+    SuccessOrDie(keys.mLocal.Pubkey().ECDSA_validate_msg_signature(gInput, kSignedLength, keys.mSignature));
+    return Clock::now() - start;
+}
+
+Clock::duration BenchEcdh()
+{
+    Keys & keys = GetKeys();
+    P256ECDHDerivedSecret secret;
+
+    auto start = Clock::now();
+    SuccessOrDie(keys.mLocal.ECDH_derive_secret(keys.mRemote.Pubkey(), secret));
+    auto elapsed = Clock::now() - start;
+
+    gSink = secret.ConstBytes()[0];
+    return elapsed;
+}
+
+// Derives the I2R, R2I and attestation challenge keys of a session.
+Clock::duration BenchHkdf()
+{
+    HKDF_sha hkdf;
+    uint8_t keys[3 * kAES_CCM128_Key_Length];
+
+    auto start = Clock::now();
+    SuccessOrDie(hkdf.HKDF_SHA256(gInput, kMax_ECDH_Secret_Length, &gInput[kMax_ECDH_Secret_Length], kSHA256_Hash_Length,
+                                  kSessionKeysInfo, sizeof(kSessionKeysInfo), keys, sizeof(keys)));
+    auto elapsed = Clock::now() - start;
+
+    gSink = keys[0];
+    return elapsed;
+}
+
+template <uint32_t kIterations>
+Clock::duration BenchPBKDF2()
+{
+    PBKDF2_sha256 pbkdf2;
+    uint8_t passcode[sizeof(kSetupPasscode)];
+    uint8_t ws[kSpake2p_WS_Length * 2];
+    memcpy(passcode, &kSetupPasscode, sizeof(passcode));
+
+    auto start = Clock::now();
+    SuccessOrDie(pbkdf2.pbkdf2_sha256(passcode, sizeof(passcode), kSalt, sizeof(kSalt), kIterations, sizeof(ws), ws));
+    auto elapsed = Clock::now() - start;
+
+    gSink = ws[0];
+    return elapsed;
+}
+
+template <uint32_t kIterations>
+Clock::duration BenchGenerateVerifier()
+{
+    Spake2pVerifier verifier;
+
+    auto start = Clock::now();
+    SuccessOrDie(verifier.Generate(kIterations, ByteSpan(kSalt), kSetupPasscode));
+    auto elapsed = Clock::now() - start;
+
+    gSink = verifier.mL[0];
+    return elapsed;
+}
+
+enum class Stage
+{
+    kBeginProver,
+    kBeginVerifier,
+    kProverRoundOne,
+    kVerifierRoundOne,
+    kVerifierRoundTwo,
+    kProverRoundTwo,
+    kVerifierKeyConfirm,
+    kProverKeyConfirm,
+};
+
+// Keep the PBKDF2 cost out of the SPAKE2+ numbers: both parties' inputs are derived once.
+struct Credentials
+{
+    Credentials()
+    {
+        SuccessOrDie(Spake2pVerifier::ComputeWS(kSpake2p_Min_PBKDF_Iterations, ByteSpan(kSalt), kSetupPasscode, mWS,
+                                                sizeof(mWS)));
+        SuccessOrDie(mVerifier.Generate(kSpake2p_Min_PBKDF_Iterations, ByteSpan(kSalt), kSetupPasscode));
+    }
+
+    uint8_t mWS[kSpake2p_WS_Length * 2];
+    Spake2pVerifier mVerifier;
+};
+
+// Runs a whole handshake, and returns the time spent in the given stage.
+template <Stage kStage>
+Clock::duration BenchSpake2p()
+{
+    static const Credentials credentials;
+
+    Spake2pImpl prover;
+    Spake2pImpl verifier;
+    uint8_t X[kMAX_Point_Length];
+    uint8_t Y[kMAX_Point_Length];
+    uint8_t proverConfirm[kMAX_Hash_Length];
+    uint8_t verifierConfirm[kMAX_Hash_Length];
+    size_t XLength               = sizeof(X);
+    size_t YLength               = sizeof(Y);
+    size_t proverConfirmLength   = sizeof(proverConfirm);
+    size_t verifierConfirmLength = sizeof(verifierConfirm);
+    Clock::duration elapsed{};
+
+    auto timed = [&elapsed](Stage stage, auto && step) {
+        auto start = Clock::now();
+        SuccessOrDie(step());
+        if (stage == kStage)
+        {
+            elapsed = Clock::now() - start;
+        }
+    };
+
+    SuccessOrDie(prover.Init(kContext, sizeof(kContext)));
+    SuccessOrDie(verifier.Init(kContext, sizeof(kContext)));
+
+    timed(Stage::kBeginProver, [&] {
+        return prover.BeginProver(nullptr, 0, nullptr, 0, &credentials.mWS[0], kSpake2p_WS_Length,
+                                  &credentials.mWS[kSpake2p_WS_Length], kSpake2p_WS_Length);
+    });
+    timed(Stage::kBeginVerifier, [&] {
+        return verifier.BeginVerifier(nullptr, 0, nullptr, 0, credentials.mVerifier.mW0, kP256_FE_Length,
+                                      credentials.mVerifier.mL, kP256_Point_Length);
+    });
+    timed(Stage::kProverRoundOne, [&] { return prover.ComputeRoundOne(nullptr, 0, X, &XLength); });
+    timed(Stage::kVerifierRoundOne, [&] { return verifier.ComputeRoundOne(X, XLength, Y, &YLength); });
+    timed(Stage::kVerifierRoundTwo,
+          [&] { return verifier.ComputeRoundTwo(X, XLength, verifierConfirm, &verifierConfirmLength); });
+    timed(Stage::kProverRoundTwo, [&] { return prover.ComputeRoundTwo(Y, YLength, proverConfirm, &proverConfirmLength); });
+    timed(Stage::kVerifierKeyConfirm, [&] { return verifier.KeyConfirm(proverConfirm, proverConfirmLength); });
+    timed(Stage::kProverKeyConfirm, [&] { return prover.KeyConfirm(verifierConfirm, verifierConfirmLength); });
+
+    gSink = proverConfirm[0];
+    return elapsed;
+}
+
+struct Benchmark
+{
+    const char * name;
+    // Runs one iteration and returns the time spent in the part being measured.
+    Clock::duration (*run)();
+    // Bytes processed by one iteration, for the benchmarks where throughput is meaningful.
+    size_t bytes = 0;
+};
+
+const Benchmark sBenchmarks[] = {
+    { "AES-CCM/Encrypt/64", BenchAesCcmEncrypt<64>, 64 },
+    { "AES-CCM/Encrypt/256", BenchAesCcmEncrypt<256>, 256 },
+    { "AES-CCM/Encrypt/1280", BenchAesCcmEncrypt<1280>, 1280 },
+    { "AES-CCM/Decrypt/64", BenchAesCcmDecrypt<64>, 64 },
+    { "AES-CCM/Decrypt/256", BenchAesCcmDecrypt<256>, 256 },
+    { "AES-CCM/Decrypt/1280", BenchAesCcmDecrypt<1280>, 1280 },
+    { "ECDSA/Sign", BenchEcdsaSign },
+    { "ECDSA/Verify", BenchEcdsaVerify },
+    { "ECDH/DeriveSecret", BenchEcdh },
+    { "HKDF/SessionKeys", BenchHkdf },
+    { "PBKDF2/1000", BenchPBKDF2<kSpake2p_Min_PBKDF_Iterations> },
+    { "PBKDF2/10000", BenchPBKDF2<10000> },
+    { "PBKDF2/100000", BenchPBKDF2<kSpake2p_Max_PBKDF_Iterations> },
+    { "Verifier/Generate/1000", BenchGenerateVerifier<kSpake2p_Min_PBKDF_Iterations> },
+    { "Verifier/Generate/10000", BenchGenerateVerifier<10000> },
+    { "Verifier/Generate/100000", BenchGenerateVerifier<kSpake2p_Max_PBKDF_Iterations> },
+    { "SPAKE2P/BeginProver", BenchSpake2p<Stage::kBeginProver> },
+    { "SPAKE2P/BeginVerifier", BenchSpake2p<Stage::kBeginVerifier> },
+    { "SPAKE2P/Prover/RoundOne", BenchSpake2p<Stage::kProverRoundOne> },
+    { "SPAKE2P/Verifier/RoundOne", BenchSpake2p<Stage::kVerifierRoundOne> },
+    { "SPAKE2P/Verifier/RoundTwo", BenchSpake2p<Stage::kVerifierRoundTwo> },
+    { "SPAKE2P/Prover/RoundTwo", BenchSpake2p<Stage::kProverRoundTwo> },
+    { "SPAKE2P/Verifier/KeyConfirm", BenchSpake2p<Stage::kVerifierKeyConfirm> },
+    { "SPAKE2P/Prover/KeyConfirm", BenchSpake2p<Stage::kProverKeyConfirm> },
+};
+
+void RunBenchmark(const Benchmark & benchmark, std::chrono::nanoseconds minTime, Format format)
+{
+    // Warm up.
+    benchmark.run();
+
+    // These operations take from microseconds to tens of milliseconds, so just run them until the minimum time is
+    // reached, rather than in batches.
+    uint64_t iterations = 0;
+    Clock::duration measured{};
+    auto start = Clock::now();
+    do
+    {
+        measured += benchmark.run();
+        iterations++;
+    } while (Clock::now() - start < minTime);
+
+    auto measuredNs       = std::chrono::duration_cast<std::chrono::nanoseconds>(measured).count();
+    double nsPerIteration = static_cast<double>(measuredNs) / static_cast<double>(iterations);
+    double mbPerSecond = static_cast<double>(benchmark.bytes) * 1e3 / nsPerIteration;
+
+    if (format == Format::kJson)
+    {
+        printf("{\"name\":\"%s\",\"backend\":\"%s\",\"iterations\":%" PRIu64 ",\"ns_per_op\":%.1f,\"ops_per_s\":%.1f",
+               benchmark.name, CryptoBackend(), iterations, nsPerIteration, 1e9 / nsPerIteration);
+        if (benchmark.bytes > 0)
+        {
+            printf(",\"bytes\":%u,\"mb_per_s\":%.1f", static_cast<unsigned>(benchmark.bytes), mbPerSecond);
+        }
+        printf("}\n");
+        return;
+    }
+
+    printf("%-28s %8" PRIu64 " iterations %12.1f us/op %10.1f ops/s", benchmark.name, iterations, nsPerIteration / 1e3,
+           1e9 / nsPerIteration);
+    if (benchmark.bytes > 0)
+    {
+        printf(" %8.1f MB/s", mbPerSecond);
+    }
+    printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    uint32_t minTimeMs  = kDefaultMinTimeMs;
+    const char * filter = nullptr;
+    Format format       = Format::kText;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--min-time-ms=", strlen("--min-time-ms=")) == 0)
+        {
+            minTimeMs = static_cast<uint32_t>(strtoul(argv[i] + strlen("--min-time-ms="), nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--format=json") == 0)
+        {
+            format = Format::kJson;
+        }
+        else if (strcmp(argv[i], "--format=text") == 0)
+        {
+            format = Format::kText;
+        }
+        else
+        {
+            filter = argv[i];
+        }
+    }
+
+    SuccessOrDie(Platform::MemoryInit());
+
+    if (format == Format::kText)
+    {
+        printf("Crypto backend: %s\n", CryptoBackend());
+    }
+    for (const auto & benchmark : sBenchmarks)
+    {
+        if (filter == nullptr || strstr(benchmark.name, filter) != nullptr)
+        {
+            RunBenchmark(benchmark, std::chrono::milliseconds(minTimeMs), format);
+        }
+    }
+
+    Platform::MemoryShutdown();
+    return EXIT_SUCCESS;
+}
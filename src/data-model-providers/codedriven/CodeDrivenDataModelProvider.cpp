@@ -18,6 +18,7 @@
 #include <app/persistence/AttributePersistenceProvider.h>
 #include <app/server-cluster/ServerClusterContext.h>
 #include <app/server-cluster/ServerClusterInterface.h>
+#include <clusters/Descriptor/Ids.h>
 #include <data-model-providers/codedriven/endpoint/EndpointInterface.h>
 #include <lib/core/CHIPError.h>
 #include <lib/support/CodeUtils.h>
@@ -42,6 +43,9 @@ CHIP_ERROR CodeDrivenDataModelProvider::Startup(DataModel::InteractionModelConte
         .interactionContext = *mInteractionModelContext,
     });
 
+    // Endpoints added by an open batch of changes are started up here, not when the batch is committed.
+    mEndpointChangesStart = FirstEndpointRegistration();
+
     // Start up registered server clusters if one of their associated endpoints is registered.
     bool had_failure = false;
     for (auto * cluster : mServerClusterRegistry.AllServerClusterInstances())
@@ -98,6 +102,9 @@ CHIP_ERROR CodeDrivenDataModelProvider::Shutdown()
 
     mServerClusterContext.reset();
     mInteractionModelContext.reset();
+    mEndpointChangesStart    = nullptr;
+    mEndpointChangesDepth    = 0;
+    mEndpointsRemovedInBatch = false;
 
     if (had_failure)
     {
@@ -114,6 +121,13 @@ DataModel::ActionReturnStatus CodeDrivenDataModelProvider::ReadAttribute(const D
     return serverCluster->ReadAttribute(request, encoder);
 }
 
+std::optional<size_t> CodeDrivenDataModelProvider::EstimateAttributeEncodedSize(const DataModel::ReadAttributeRequest & request)
+{
+    ServerClusterInterface * serverCluster = GetServerClusterInterface(request.path);
+    VerifyOrReturnValue(serverCluster != nullptr, std::nullopt);
+    return serverCluster->EstimateAttributeEncodedSize(request);
+}
+
 DataModel::ActionReturnStatus CodeDrivenDataModelProvider::WriteAttribute(const DataModel::WriteAttributeRequest & request,
                                                                           AttributeValueDecoder & decoder)
 {
@@ -130,6 +144,20 @@ void CodeDrivenDataModelProvider::ListAttributeWriteNotification(const ConcreteA
     serverCluster->ListAttributeWriteNotification(path, opType, accessingFabric);
 }
 
+void CodeDrivenDataModelProvider::BeginClusterWrites(const ConcreteClusterPath & path)
+{
+    ServerClusterInterface * serverCluster = GetServerClusterInterface(path);
+    VerifyOrReturn(serverCluster != nullptr);
+    serverCluster->BeginWrites(path);
+}
+
+void CodeDrivenDataModelProvider::EndClusterWrites(const ConcreteClusterPath & path)
+{
+    ServerClusterInterface * serverCluster = GetServerClusterInterface(path);
+    VerifyOrReturn(serverCluster != nullptr);
+    serverCluster->EndWrites(path);
+}
+
 std::optional<DataModel::ActionReturnStatus> CodeDrivenDataModelProvider::InvokeCommand(const DataModel::InvokeRequest & request,
                                                                                         TLV::TLVReader & input_arguments,
                                                                                         CommandHandler * handler)
@@ -141,20 +169,7 @@ std::optional<DataModel::ActionReturnStatus> CodeDrivenDataModelProvider::Invoke
 
 CHIP_ERROR CodeDrivenDataModelProvider::Endpoints(ReadOnlyBufferBuilder<DataModel::EndpointEntry> & out)
 {
-    // TODO: Add a size() method to EndpointInterfaceRegistry to avoid iterating twice.
-    size_t count = 0;
-    for (const auto & registration : mEndpointInterfaceRegistry)
-    {
-        (void) registration; // Silence unused variable warning
-        count++;
-    }
-
-    ReturnErrorOnFailure(out.EnsureAppendCapacity(count));
-    for (const auto & registration : mEndpointInterfaceRegistry)
-    {
-        ReturnErrorOnFailure(out.Append(registration.GetEndpointEntry()));
-    }
-    return CHIP_NO_ERROR;
+    return out.AppendElements(mEndpointInterfaceRegistry.EndpointEntries());
 }
 
 CHIP_ERROR CodeDrivenDataModelProvider::DeviceTypes(EndpointId endpointId, ReadOnlyBufferBuilder<DataModel::DeviceTypeEntry> & out)
@@ -266,7 +281,8 @@ CHIP_ERROR CodeDrivenDataModelProvider::AddEndpoint(EndpointInterfaceRegistratio
 
     ReturnErrorOnFailure(mEndpointInterfaceRegistry.Register(registration));
 
-    if (mServerClusterContext.has_value())
+    // Clusters are started when the open batch of changes is committed.
+    if (mServerClusterContext.has_value() && (mEndpointChangesDepth == 0))
     {
         // If the provider has been started, we need to check if any clusters on this new endpoint
         // should be started up.
@@ -301,7 +317,18 @@ CHIP_ERROR CodeDrivenDataModelProvider::AddEndpoint(EndpointInterfaceRegistratio
 
 CHIP_ERROR CodeDrivenDataModelProvider::RemoveEndpoint(EndpointId endpointId)
 {
-    if (mServerClusterContext.has_value())
+    const bool pending = IsPendingEndpoint(endpointId);
+    if (mEndpointChangesDepth > 0)
+    {
+        mEndpointsRemovedInBatch = true;
+        if ((mEndpointChangesStart != nullptr) && (mEndpointChangesStart->endpointEntry.id == endpointId))
+        {
+            mEndpointChangesStart = mEndpointChangesStart->next;
+        }
+    }
+
+    // The clusters of an endpoint added by the open batch of changes have not been started.
+    if (mServerClusterContext.has_value() && !pending)
     {
         // If the provider has been started, we need to check if any clusters on this endpoint
         // need to be shut down because it's their last registered endpoint.
@@ -312,7 +339,7 @@ CHIP_ERROR CodeDrivenDataModelProvider::RemoveEndpoint(EndpointId endpointId)
 
             for (const auto & path : cluster->GetPaths())
             {
-                if (mEndpointInterfaceRegistry.Get(path.mEndpointId) != nullptr)
+                if ((mEndpointInterfaceRegistry.Get(path.mEndpointId) != nullptr) && !IsPendingEndpoint(path.mEndpointId))
                 {
                     registeredEndpointCount++;
                 }
@@ -333,6 +360,94 @@ CHIP_ERROR CodeDrivenDataModelProvider::RemoveEndpoint(EndpointId endpointId)
     return mEndpointInterfaceRegistry.Unregister(endpointId);
 }
 
+void CodeDrivenDataModelProvider::BeginEndpointChanges()
+{
+    if (mEndpointChangesDepth++ == 0)
+    {
+        mEndpointChangesStart    = FirstEndpointRegistration();
+        mEndpointsRemovedInBatch = false;
+    }
+}
+
+CHIP_ERROR CodeDrivenDataModelProvider::CommitEndpointChanges()
+{
+    VerifyOrReturnError(mEndpointChangesDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+    if (mEndpointChangesDepth > 1)
+    {
+        mEndpointChangesDepth--;
+        return CHIP_NO_ERROR;
+    }
+
+    bool had_failure = false;
+    if (mServerClusterContext.has_value())
+    {
+        // Start up the clusters that are on an added endpoint and on no endpoint registered before the batch.
+        for (auto * cluster : mServerClusterRegistry.AllServerClusterInstances())
+        {
+            bool clusterIsOnAddedEndpoint = false;
+            bool clusterIsStarted         = false;
+
+            for (const auto & path : cluster->GetPaths())
+            {
+                if (IsPendingEndpoint(path.mEndpointId))
+                {
+                    clusterIsOnAddedEndpoint = true;
+                }
+                else if (mEndpointInterfaceRegistry.Get(path.mEndpointId) != nullptr)
+                {
+                    clusterIsStarted = true;
+                }
+            }
+
+            if (clusterIsOnAddedEndpoint && !clusterIsStarted && (cluster->Startup(*mServerClusterContext) != CHIP_NO_ERROR))
+            {
+                had_failure = true;
+            }
+        }
+    }
+
+    if (mInteractionModelContext.has_value())
+    {
+        bool changed = mEndpointsRemovedInBatch;
+        for (auto * added = FirstEndpointRegistration(); added != mEndpointChangesStart; added = added->next)
+        {
+            mInteractionModelContext->dataModelChangeListener.MarkDirty(AttributePathParams(added->endpointEntry.id));
+            changed = true;
+        }
+        if (changed)
+        {
+            // Wildcard endpoint: the PartsList of the root endpoint and of the parents of the changed endpoints
+            mInteractionModelContext->dataModelChangeListener.MarkDirty(
+                AttributePathParams(Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id));
+        }
+    }
+
+    mEndpointChangesStart    = nullptr;
+    mEndpointChangesDepth    = 0;
+    mEndpointsRemovedInBatch = false;
+
+    return had_failure ? CHIP_ERROR_HAD_FAILURES : CHIP_NO_ERROR;
+}
+
+EndpointInterfaceRegistration * CodeDrivenDataModelProvider::FirstEndpointRegistration()
+{
+    auto first = mEndpointInterfaceRegistry.begin();
+    return (first == mEndpointInterfaceRegistry.end()) ? nullptr : &*first;
+}
+
+bool CodeDrivenDataModelProvider::IsPendingEndpoint(EndpointId endpointId)
+{
+    VerifyOrReturnValue(mEndpointChangesDepth > 0, false);
+    for (auto * added = FirstEndpointRegistration(); added != mEndpointChangesStart; added = added->next)
+    {
+        if (added->endpointEntry.id == endpointId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 CHIP_ERROR CodeDrivenDataModelProvider::AddCluster(ServerClusterRegistration & entry)
 {
     VerifyOrReturnError(entry.serverClusterInterface != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
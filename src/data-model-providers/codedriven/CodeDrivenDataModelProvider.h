@@ -71,11 +71,14 @@ public:
 
     DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
                                                 AttributeValueEncoder & encoder) override;
+    std::optional<size_t> EstimateAttributeEncodedSize(const DataModel::ReadAttributeRequest & request) override;
     DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest & request,
                                                  AttributeValueDecoder & decoder) override;
 
     void ListAttributeWriteNotification(const ConcreteAttributePath & path, DataModel::ListWriteOperation opType,
                                         FabricIndex accessingFabric) override;
+    void BeginClusterWrites(const ConcreteClusterPath & path) override;
+    void EndClusterWrites(const ConcreteClusterPath & path) override;
     std::optional<DataModel::ActionReturnStatus> InvokeCommand(const DataModel::InvokeRequest & request,
                                                                TLV::TLVReader & input_arguments, CommandHandler * handler) override;
 
@@ -154,6 +157,30 @@ public:
      */
     CHIP_ERROR RemoveEndpoint(EndpointId endpointId);
 
+    /**
+     * @brief Opens a batch of endpoint changes, e.g. to restore the endpoints of a bridge.
+     *
+     * Until the matching CommitEndpointChanges() call, AddEndpoint() only registers endpoints: the
+     * Startup() of their clusters is left to the commit, which goes through the clusters once for
+     * all the added endpoints. RemoveEndpoint() still shuts clusters down immediately.
+     *
+     * Batches may be nested; only the outermost commit applies the changes.
+     */
+    void BeginEndpointChanges();
+
+    /**
+     * @brief Commits the batch of endpoint changes opened by BeginEndpointChanges().
+     *
+     * Starts up the clusters of the endpoints added by the batch (see AddEndpoint()) and, if the
+     * provider is started, marks the attributes of the added endpoints and the Descriptor PartsList
+     * attributes dirty once.
+     *
+     * @return CHIP_NO_ERROR on success.
+     *         CHIP_ERROR_INCORRECT_STATE if no batch is open.
+     *         CHIP_ERROR_HAD_FAILURES if the Startup() of some clusters failed.
+     */
+    CHIP_ERROR CommitEndpointChanges();
+
     /**
      * @brief Add a ServerClusterInterface to the Data Model Provider.
      *
@@ -205,6 +232,17 @@ private:
     PersistentStorageDelegate & mPersistentStorageDelegate;
     AttributePersistenceProvider & mAttributePersistenceProvider;
 
+    /// Registrations added by the open batch of endpoint changes come before this one in mEndpointInterfaceRegistry.
+    EndpointInterfaceRegistration * mEndpointChangesStart = nullptr;
+    unsigned mEndpointChangesDepth                        = 0;
+    bool mEndpointsRemovedInBatch                         = false;
+
+    /// Return the first registration of mEndpointInterfaceRegistry, or nullptr if there is none
+    EndpointInterfaceRegistration * FirstEndpointRegistration();
+
+    /// Whether the endpoint was added by the open batch of endpoint changes, so its clusters are not started yet
+    bool IsPendingEndpoint(EndpointId endpointId);
+
     /// Return the interface registered for the given endpoint ID or nullptr if one does not exist
     EndpointInterface * GetEndpointInterface(EndpointId endpointId);
 
@@ -15,17 +15,40 @@
  *    limitations under the License.
  */
 #include <data-model-providers/codedriven/endpoint/EndpointInterfaceRegistry.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 
+#include <algorithm>
+#include <string.h>
+
 namespace chip {
 namespace app {
 
+namespace {
+
+constexpr size_t kMinIndexCapacity = 8;
+
+} // namespace
+
+EndpointInterfaceRegistry::~EndpointInterfaceRegistry()
+{
+    ReleaseIndex();
+}
+
 CHIP_ERROR EndpointInterfaceRegistry::Register(EndpointInterfaceRegistration & entry)
 {
     VerifyOrReturnError(entry.next == nullptr, CHIP_ERROR_INVALID_ARGUMENT);              // Should not be part of another list
     VerifyOrReturnError(entry.endpointInterface != nullptr, CHIP_ERROR_INVALID_ARGUMENT); // Should not be null
     VerifyOrReturnError(entry.endpointEntry.id != kInvalidEndpointId, CHIP_ERROR_INVALID_ARGUMENT); // Should not be invalid ID
     VerifyOrReturnError(Get(entry.endpointEntry.id) == nullptr, CHIP_ERROR_DUPLICATE_KEY_ID);       // Check for duplicates
+    ReturnErrorOnFailure(EnsureIndexCapacity(mCount + 1));
+
+    const size_t position = LowerBound(entry.endpointEntry.id);
+    memmove(&mEntries[position + 1], &mEntries[position], (mCount - position) * sizeof(mEntries[0]));
+    memmove(&mInterfaces[position + 1], &mInterfaces[position], (mCount - position) * sizeof(mInterfaces[0]));
+    mEntries[position]    = entry.endpointEntry;
+    mInterfaces[position] = entry.endpointInterface;
+    mCount++;
 
     entry.next     = mRegistrations;
     mRegistrations = &entry;
@@ -37,6 +60,16 @@ CHIP_ERROR EndpointInterfaceRegistry::Unregister(EndpointId endpointId)
 {
     VerifyOrReturnError(endpointId != kInvalidEndpointId, CHIP_ERROR_INVALID_ARGUMENT);
 
+    const size_t position = LowerBound(endpointId);
+    VerifyOrReturnError(position < mCount && mEntries[position].id == endpointId, CHIP_ERROR_NOT_FOUND);
+    mCount--;
+    memmove(&mEntries[position], &mEntries[position + 1], (mCount - position) * sizeof(mEntries[0]));
+    memmove(&mInterfaces[position], &mInterfaces[position + 1], (mCount - position) * sizeof(mInterfaces[0]));
+    if (mCount == 0)
+    {
+        ReleaseIndex();
+    }
+
     EndpointInterfaceRegistration * prev    = nullptr;
     EndpointInterfaceRegistration * current = mRegistrations;
 
@@ -74,22 +107,73 @@ EndpointInterface * EndpointInterfaceRegistry::Get(EndpointId endpointId)
         return mCachedInterface;
     }
 
-    // The endpoint searched for is not cached, do a linear search for it
-    EndpointInterfaceRegistration * current = mRegistrations;
+    const size_t position = LowerBound(endpointId);
+    if (position < mCount && mEntries[position].id == endpointId)
+    {
+        mCachedInterface  = mInterfaces[position];
+        mCachedEndpointId = endpointId;
+        return mCachedInterface;
+    }
 
-    while (current != nullptr)
+    // Not found
+    return nullptr;
+}
+
+size_t EndpointInterfaceRegistry::LowerBound(EndpointId endpointId) const
+{
+    size_t low  = 0;
+    size_t high = mCount;
+    while (low < high)
     {
-        if (current->endpointEntry.id == endpointId)
+        const size_t middle = low + (high - low) / 2;
+        if (mEntries[middle].id < endpointId)
         {
-            mCachedInterface  = current->endpointInterface;
-            mCachedEndpointId = endpointId;
-            return mCachedInterface;
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
         }
-        current = current->next;
     }
+    return low;
+}
 
-    // Not found
-    return nullptr;
+CHIP_ERROR EndpointInterfaceRegistry::EnsureIndexCapacity(size_t capacity)
+{
+    VerifyOrReturnError(capacity > mCapacity, CHIP_NO_ERROR);
+    VerifyOrReturnError(mOwnsIndex, CHIP_ERROR_NO_MEMORY);
+
+    const size_t newCapacity = std::max(capacity, std::max(kMinIndexCapacity, mCapacity * 2));
+
+    auto * entries    = static_cast<DataModel::EndpointEntry *>(Platform::MemoryAlloc(newCapacity * sizeof(mEntries[0])));
+    auto * interfaces = static_cast<EndpointInterface **>(Platform::MemoryAlloc(newCapacity * sizeof(mInterfaces[0])));
+    if (entries == nullptr || interfaces == nullptr)
+    {
+        Platform::MemoryFree(entries);
+        Platform::MemoryFree(interfaces);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    if (mCount > 0)
+    {
+        memcpy(entries, mEntries, mCount * sizeof(mEntries[0]));
+        memcpy(interfaces, mInterfaces, mCount * sizeof(mInterfaces[0]));
+    }
+    ReleaseIndex();
+    mEntries    = entries;
+    mInterfaces = interfaces;
+    mCapacity   = newCapacity;
+    return CHIP_NO_ERROR;
+}
+
+void EndpointInterfaceRegistry::ReleaseIndex()
+{
+    VerifyOrReturn(mOwnsIndex);
+    Platform::MemoryFree(mEntries);
+    Platform::MemoryFree(mInterfaces);
+    mEntries    = nullptr;
+    mInterfaces = nullptr;
+    mCapacity   = 0;
 }
 
 } // namespace app
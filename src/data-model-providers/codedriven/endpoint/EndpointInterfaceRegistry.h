@@ -20,6 +20,9 @@
 #include <data-model-providers/codedriven/endpoint/EndpointInterface.h>
 #include <lib/core/CHIPError.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+#include <cstddef>
 
 namespace chip {
 namespace app {
@@ -58,7 +61,12 @@ struct EndpointInterfaceRegistration
  *
  * The EndpointInterfaceRegistry can be used to discover and interact programmatically
  * with Matter endpoints. It maintains a linked list of EndpointInterfaceRegistration
- * objects.
+ * objects, iterated in reverse order of registration, and an index of the registered
+ * endpoints sorted by EndpointId, so that lookups are binary searches over contiguous
+ * memory and the endpoint entries can be copied out in one go.
+ *
+ * The index grows on the heap by default. StaticEndpointInterfaceRegistry keeps it in
+ * fixed storage instead.
  *
  * Responsibilities:
  * - Allows registration and unregistration of endpoints.
@@ -75,6 +83,12 @@ struct EndpointInterfaceRegistration
 class EndpointInterfaceRegistry
 {
 public:
+    EndpointInterfaceRegistry() = default;
+    ~EndpointInterfaceRegistry();
+
+    EndpointInterfaceRegistry(const EndpointInterfaceRegistry &)             = delete;
+    EndpointInterfaceRegistry & operator=(const EndpointInterfaceRegistry &) = delete;
+
     class Iterator
     {
     public:
@@ -108,6 +122,7 @@ public:
      *                                     entry.endpointInterface is nullptr,
      *                                     or the endpoint ID is kInvalidEndpointId.
      *         CHIP_ERROR_DUPLICATE_KEY_ID if an endpoint with the same ID is already registered.
+     *         CHIP_ERROR_NO_MEMORY if the index of the registered endpoints cannot grow.
      */
     CHIP_ERROR Register(EndpointInterfaceRegistration & entry);
 
@@ -129,10 +144,52 @@ public:
     Iterator begin() { return Iterator(mRegistrations); }
     Iterator end() { return Iterator(nullptr); }
 
+    /** @return The number of registered endpoints. */
+    size_t Count() const { return mCount; }
+
+    /**
+     * @return The entries of the registered endpoints, sorted by EndpointId.
+     *
+     * The returned span is invalidated by Register() and Unregister().
+     */
+    Span<const DataModel::EndpointEntry> EndpointEntries() const { return Span<const DataModel::EndpointEntry>(mEntries, mCount); }
+
+protected:
+    /// Keeps the index in the given storage, which must outlive the registry, instead of on the heap.
+    EndpointInterfaceRegistry(DataModel::EndpointEntry * entries, EndpointInterface ** interfaces, size_t capacity) :
+        mEntries(entries), mInterfaces(interfaces), mCapacity(capacity), mOwnsIndex(false)
+    {}
+
 private:
+    /// Returns the position of the first indexed endpoint whose ID is not less than endpointId.
+    size_t LowerBound(EndpointId endpointId) const;
+    CHIP_ERROR EnsureIndexCapacity(size_t capacity);
+    void ReleaseIndex();
+
     EndpointInterfaceRegistration * mRegistrations = nullptr;
     EndpointInterface * mCachedInterface           = nullptr;
     EndpointId mCachedEndpointId                   = kInvalidEndpointId;
+
+    // Index of the registrations sorted by EndpointId, kept as parallel arrays.
+    DataModel::EndpointEntry * mEntries = nullptr;
+    EndpointInterface ** mInterfaces    = nullptr;
+    size_t mCount                       = 0;
+    size_t mCapacity                    = 0;
+    bool mOwnsIndex                     = true;
+};
+
+/**
+ * @brief An EndpointInterfaceRegistry that does not allocate, holding up to kCapacity endpoints.
+ */
+template <size_t kCapacity>
+class StaticEndpointInterfaceRegistry : public EndpointInterfaceRegistry
+{
+public:
+    StaticEndpointInterfaceRegistry() : EndpointInterfaceRegistry(mEntryStorage, mInterfaceStorage, kCapacity) {}
+
+private:
+    DataModel::EndpointEntry mEntryStorage[kCapacity];
+    EndpointInterface * mInterfaceStorage[kCapacity];
 };
 
 } // namespace app
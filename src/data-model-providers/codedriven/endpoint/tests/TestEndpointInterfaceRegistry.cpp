@@ -3,6 +3,7 @@
 #include <app/data-model-provider/MetadataTypes.h>
 #include <data-model-providers/codedriven/endpoint/EndpointInterfaceRegistry.h>
 #include <data-model-providers/codedriven/endpoint/SpanEndpoint.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 
 #include <algorithm>
@@ -24,9 +25,16 @@ constexpr EndpointId kValidIdForArgsTest = 1; // Same as kTestEndpointId1, but f
 constexpr EndpointId kListId1ForArgsTest = 10;
 constexpr EndpointId kListId2ForArgsTest = 11;
 
+class TestEndpointInterfaceRegistry : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+};
+
 } // namespace
 
-TEST(TestEndpointInterfaceRegistry, CreateAndDestroy)
+TEST_F(TestEndpointInterfaceRegistry, CreateAndDestroy)
 {
     EndpointInterfaceRegistry registry;
 
@@ -55,7 +63,7 @@ TEST(TestEndpointInterfaceRegistry, CreateAndDestroy)
     ASSERT_EQ(registry.Get(kTestEndpointId1), nullptr);
 }
 
-TEST(TestEndpointInterfaceRegistry, RegisterMultipleProviders)
+TEST_F(TestEndpointInterfaceRegistry, RegisterMultipleProviders)
 {
     EndpointInterfaceRegistry registry;
 
@@ -85,7 +93,7 @@ TEST(TestEndpointInterfaceRegistry, RegisterMultipleProviders)
     ASSERT_EQ(registry.Get(kTestEndpointId2), nullptr);
 }
 
-TEST(TestEndpointInterfaceRegistry, RegisterDuplicateProviderId)
+TEST_F(TestEndpointInterfaceRegistry, RegisterDuplicateProviderId)
 {
     EndpointInterfaceRegistry registry;
 
@@ -109,7 +117,7 @@ TEST(TestEndpointInterfaceRegistry, RegisterDuplicateProviderId)
     ASSERT_EQ(registry.Get(kTestEndpointId1), endpoint1a.get()); // Should still be the first one
 }
 
-TEST(TestEndpointInterfaceRegistry, RegisterSameRegistrationObject)
+TEST_F(TestEndpointInterfaceRegistry, RegisterSameRegistrationObject)
 {
     EndpointInterfaceRegistry registry;
     auto endpoint = std::make_unique<SpanEndpoint>(SpanEndpoint::Builder().Build());
@@ -123,19 +131,19 @@ TEST(TestEndpointInterfaceRegistry, RegisterSameRegistrationObject)
     ASSERT_EQ(registry.Register(registration), CHIP_ERROR_DUPLICATE_KEY_ID);
 }
 
-TEST(TestEndpointInterfaceRegistry, UnregisterNonExistentProvider)
+TEST_F(TestEndpointInterfaceRegistry, UnregisterNonExistentProvider)
 {
     EndpointInterfaceRegistry registry;
     ASSERT_EQ(registry.Unregister(kTestEndpointId1), CHIP_ERROR_NOT_FOUND);
 }
 
-TEST(TestEndpointInterfaceRegistry, GetNonExistentProvider)
+TEST_F(TestEndpointInterfaceRegistry, GetNonExistentProvider)
 {
     EndpointInterfaceRegistry registry;
     ASSERT_EQ(registry.Get(kNonExistentId), nullptr);
 }
 
-TEST(TestEndpointInterfaceRegistry, IteratorTest)
+TEST_F(TestEndpointInterfaceRegistry, IteratorTest)
 {
     EndpointInterfaceRegistry registry;
 
@@ -176,7 +184,7 @@ TEST(TestEndpointInterfaceRegistry, IteratorTest)
     ASSERT_EQ(emptyRegistry.begin(), emptyRegistry.end());
 }
 
-TEST(TestEndpointInterfaceRegistry, RegisterInvalidArgs)
+TEST_F(TestEndpointInterfaceRegistry, RegisterInvalidArgs)
 {
     EndpointInterfaceRegistry registry;
     auto endpointValid = std::make_unique<SpanEndpoint>(SpanEndpoint::Builder().Build());
@@ -210,7 +218,7 @@ TEST(TestEndpointInterfaceRegistry, RegisterInvalidArgs)
     EXPECT_EQ(registry.Get(kValidIdForArgsTest), endpointValid.get());
 }
 
-TEST(TestEndpointInterfaceRegistry, StressTestRegistration)
+TEST_F(TestEndpointInterfaceRegistry, StressTestRegistration)
 {
     constexpr int kNumProviders = 100;
     EndpointInterfaceRegistry registry;
@@ -278,3 +286,49 @@ TEST(TestEndpointInterfaceRegistry, StressTestRegistration)
         ASSERT_NE(registry.Get(id), nullptr) << "Failed to get endpoint with ID " << id << " after re-registration";
     }
 }
+
+TEST_F(TestEndpointInterfaceRegistry, EndpointEntriesAreSorted)
+{
+    EndpointInterfaceRegistry registry;
+    SpanEndpoint endpoint = SpanEndpoint::Builder().Build();
+
+    const EndpointId ids[] = { 7, 2, 9, 4 };
+    std::list<EndpointInterfaceRegistration> registrations;
+    for (EndpointId id : ids)
+    {
+        registrations.emplace_back(endpoint,
+                                   DataModel::EndpointEntry{ .id = id, .compositionPattern = EndpointCompositionPattern(0) });
+        ASSERT_EQ(registry.Register(registrations.back()), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(registry.Unregister(4), CHIP_NO_ERROR);
+
+    auto entries = registry.EndpointEntries();
+    ASSERT_EQ(registry.Count(), 3u);
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[0].id, 2);
+    EXPECT_EQ(entries[1].id, 7);
+    EXPECT_EQ(entries[2].id, 9);
+    EXPECT_EQ(registry.Get(4), nullptr);
+    EXPECT_EQ(registry.Get(9), &endpoint);
+}
+
+TEST_F(TestEndpointInterfaceRegistry, StaticCapacity)
+{
+    StaticEndpointInterfaceRegistry<2> registry;
+    SpanEndpoint endpoint = SpanEndpoint::Builder().Build();
+
+    EndpointInterfaceRegistration registration1(endpoint, { .id = 1, .compositionPattern = EndpointCompositionPattern(0) });
+    EndpointInterfaceRegistration registration2(endpoint, { .id = 2, .compositionPattern = EndpointCompositionPattern(0) });
+    EndpointInterfaceRegistration registration3(endpoint, { .id = 3, .compositionPattern = EndpointCompositionPattern(0) });
+
+    EXPECT_EQ(registry.Register(registration1), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.Register(registration2), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.Register(registration3), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(registration3.next, nullptr);
+
+    // Space is reclaimed when an endpoint is unregistered.
+    EXPECT_EQ(registry.Unregister(1), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.Register(registration3), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.Get(3), &endpoint);
+    EXPECT_EQ(registry.Count(), 2u);
+}
@@ -25,6 +25,7 @@
 #include <app/server-cluster/ServerClusterInterface.h>
 #include <app/server-cluster/testing/TestEventGenerator.h>
 #include <app/server-cluster/testing/TestServerClusterContext.h>
+#include <clusters/Descriptor/AttributeIds.h>
 #include <clusters/Descriptor/ClusterId.h>
 #include <data-model-providers/codedriven/CodeDrivenDataModelProvider.h>
 #include <data-model-providers/codedriven/endpoint/SpanEndpoint.h>
@@ -1095,3 +1096,52 @@ TEST_F(TestCodeDrivenDataModelProvider, StartupOnlyStartsClustersWithRegisteredE
 
     EXPECT_SUCCESS(localProvider.Shutdown());
 }
+
+TEST_F(TestCodeDrivenDataModelProvider, EndpointChangesStartClustersOnCommit)
+{
+    CodeDrivenDataModelProvider localProvider(mServerClusterTestContext.StorageDelegate(),
+                                              mServerClusterTestContext.AttributePersistenceProvider());
+    ASSERT_EQ(localProvider.Startup(mContext), CHIP_NO_ERROR);
+
+    MockServerCluster sharedCluster({ { 1, 100 }, { 2, 100 } }, 1, {});
+    static ServerClusterRegistration sharedRegistration(sharedCluster);
+    ASSERT_EQ(localProvider.AddCluster(sharedRegistration), CHIP_NO_ERROR);
+
+    MockServerCluster removedCluster(ConcreteClusterPath(endpointEntry3.id, 100), 1, {});
+    static ServerClusterRegistration removedRegistration(removedCluster);
+    ASSERT_EQ(localProvider.AddCluster(removedRegistration), CHIP_NO_ERROR);
+
+    EXPECT_EQ(localProvider.CommitEndpointChanges(), CHIP_ERROR_INCORRECT_STATE);
+
+    mChangeListener.mDirtyList.clear();
+    localProvider.BeginEndpointChanges();
+    localProvider.BeginEndpointChanges();
+    for (const auto & entry : { endpointEntry1, endpointEntry2, endpointEntry3 })
+    {
+        mEndpointStorage.push_back(std::make_unique<SpanEndpoint>(SpanEndpoint::Builder().Build()));
+        mOwnedRegistrations.push_back(std::make_unique<EndpointInterfaceRegistration>(*mEndpointStorage.back(), entry));
+        ASSERT_EQ(localProvider.AddEndpoint(*mOwnedRegistrations.back()), CHIP_NO_ERROR);
+    }
+
+    // Endpoints removed before the commit never start their clusters.
+    ASSERT_EQ(localProvider.RemoveEndpoint(endpointEntry3.id), CHIP_NO_ERROR);
+    EXPECT_EQ(removedCluster.shutdownCallCount, 0);
+
+    // Only the outermost commit applies the changes.
+    EXPECT_EQ(localProvider.CommitEndpointChanges(), CHIP_NO_ERROR);
+    EXPECT_EQ(sharedCluster.startupCallCount, 0);
+    EXPECT_TRUE(mChangeListener.mDirtyList.empty());
+
+    EXPECT_EQ(localProvider.CommitEndpointChanges(), CHIP_NO_ERROR);
+    EXPECT_EQ(sharedCluster.startupCallCount, 1);
+    EXPECT_EQ(removedCluster.startupCallCount, 0);
+
+    // Both added endpoints and the PartsList of all endpoints are reported.
+    ASSERT_EQ(mChangeListener.mDirtyList.size(), 3u);
+    EXPECT_TRUE(mChangeListener.mDirtyList[2] ==
+                AttributePathParams(Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id));
+
+    EXPECT_SUCCESS(localProvider.Shutdown());
+    EXPECT_EQ(sharedCluster.shutdownCallCount, 1);
+    EXPECT_EQ(removedCluster.shutdownCallCount, 0);
+}
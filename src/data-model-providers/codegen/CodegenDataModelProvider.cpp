@@ -45,6 +45,8 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ReadOnlyBuffer.h>
 #include <lib/support/ScopedBuffer.h>
+#include <tracing/metric_keys.h>
+#include <tracing/metric_macros.h>
 
 #include <cstdint>
 #include <optional>
@@ -120,10 +122,68 @@ DataModel::AttributeEntry AttributeEntryFrom(const ConcreteClusterPath & cluster
     return entry;
 }
 
+/// Appends the attribute entries of an ember cluster to `builder`
+CHIP_ERROR AppendEmberAttributeEntries(const ConcreteClusterPath & path, const EmberAfCluster & cluster,
+                                       ReadOnlyBufferBuilder<DataModel::AttributeEntry> & builder)
+{
+    // We have Attributes from ember + global attributes that are NOT in ember metadata.
+    // We have to report them all
+    constexpr size_t kGlobalAttributeNotInMetadataCount = MATTER_ARRAY_SIZE(GlobalAttributesNotInMetadata);
+
+    ReturnErrorOnFailure(builder.EnsureAppendCapacity(cluster.attributeCount + kGlobalAttributeNotInMetadataCount));
+
+    Span<const EmberAfAttributeMetadata> attributeSpan(cluster.attributes, cluster.attributeCount);
+
+    for (auto & attribute : attributeSpan)
+    {
+        ReturnErrorOnFailure(builder.Append(AttributeEntryFrom(path, attribute)));
+    }
+
+    for (auto & attributeId : GlobalAttributesNotInMetadata)
+    {
+
+        // This "GlobalListEntry" is specific for metadata that ember does not include
+        // in its attribute list metadata.
+        //
+        // By spec these Attribute/AcceptedCommands/GeneratedCommants lists are:
+        //   - lists of elements
+        //   - read-only, with read privilege view
+        //   - fixed value (no such flag exists, so this is not a quality flag we set/track)
+        DataModel::AttributeEntry globalListEntry(attributeId, DataModel::AttributeQualityFlags::kListAttribute,
+                                                  Access::Privilege::kView, std::nullopt);
+
+        ReturnErrorOnFailure(builder.Append(std::move(globalListEntry)));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 DefaultAttributePersistenceProvider gDefaultAttributePersistence;
 
+#if CHIP_CODEGEN_CONFIG_CLUSTER_LOOKUP_CACHE_SIZE > 0
+// How many cluster lookups are counted before the cache hit/miss metrics are reported
+constexpr uint32_t kClusterLookupMetricsReportInterval = 1024;
+#endif
+
 } // namespace
 
+CodegenDataModelProvider::~CodegenDataModelProvider()
+{
+#if CHIP_CODEGEN_CONFIG_PREBUILT_ATTRIBUTE_ENTRIES
+    ReleasePrebuiltAttributeEntries();
+#endif
+}
+
+void CodegenDataModelProvider::Reset()
+{
+#if CHIP_CODEGEN_CONFIG_CLUSTER_LOOKUP_CACHE_SIZE > 0
+    InvalidateClusterLookupCache();
+#endif
+#if CHIP_CODEGEN_CONFIG_PREBUILT_ATTRIBUTE_ENTRIES
+    ReleasePrebuiltAttributeEntries();
+#endif
+}
+
 CHIP_ERROR CodegenDataModelProvider::Shutdown()
 {
     Reset();
@@ -167,7 +227,7 @@ std::optional<DataModel::ActionReturnStatus> CodegenDataModelProvider::InvokeCom
                                                                                      TLV::TLVReader & input_arguments,
                                                                                      CommandHandler * handler)
 {
-    if (auto * cluster = mRegistry.Get(request.path); cluster != nullptr)
+    if (auto * cluster = FindServerClusterInterface(request.path); cluster != nullptr)
     {
         return cluster->InvokeCommand(request, input_arguments, handler);
     }
@@ -248,7 +308,7 @@ std::optional<unsigned> CodegenDataModelProvider::TryFindEndpointIndex(EndpointI
 
 CHIP_ERROR CodegenDataModelProvider::EventInfo(const ConcreteEventPath & path, DataModel::EventEntry & eventInfo)
 {
-    if (auto * cluster = mRegistry.Get(path); cluster != nullptr)
+    if (auto * cluster = FindServerClusterInterface(path); cluster != nullptr)
     {
         return cluster->EventInfo(path, eventInfo);
     }
@@ -346,7 +406,7 @@ CHIP_ERROR CodegenDataModelProvider::ServerClusters(EndpointId endpointId,
 CHIP_ERROR CodegenDataModelProvider::Attributes(const ConcreteClusterPath & path,
                                                 ReadOnlyBufferBuilder<DataModel::AttributeEntry> & builder)
 {
-    if (auto * cluster = mRegistry.Get(path); cluster != nullptr)
+    if (auto * cluster = FindServerClusterInterface(path); cluster != nullptr)
     {
         return cluster->Attributes(path, builder);
     }
@@ -357,41 +417,59 @@ CHIP_ERROR CodegenDataModelProvider::Attributes(const ConcreteClusterPath & path
     VerifyOrReturnValue(cluster->attributeCount > 0, CHIP_NO_ERROR);
     VerifyOrReturnValue(cluster->attributes != nullptr, CHIP_NO_ERROR);
 
-    // TODO: if ember would encode data in AttributeEntry form, we could reference things directly (shorter code,
-    //       although still allocation overhead due to global attributes not in metadata)
-    //
-    // We have Attributes from ember + global attributes that are NOT in ember metadata.
-    // We have to report them all
-    constexpr size_t kGlobalAttributeNotInMetadataCount = MATTER_ARRAY_SIZE(GlobalAttributesNotInMetadata);
-
-    ReturnErrorOnFailure(builder.EnsureAppendCapacity(cluster->attributeCount + kGlobalAttributeNotInMetadataCount));
+#if CHIP_CODEGEN_CONFIG_PREBUILT_ATTRIBUTE_ENTRIES
+    if (const PrebuiltAttributeEntries * prebuilt = GetPrebuiltAttributeEntries(path, *cluster); prebuilt != nullptr)
+    {
+        return builder.ReferenceExisting(prebuilt->entries);
+    }
+    // Could not allocate the prebuilt list, build a copy instead
+#endif
 
-    Span<const EmberAfAttributeMetadata> attributeSpan(cluster->attributes, cluster->attributeCount);
+    return AppendEmberAttributeEntries(path, *cluster, builder);
+}
 
-    for (auto & attribute : attributeSpan)
+#if CHIP_CODEGEN_CONFIG_PREBUILT_ATTRIBUTE_ENTRIES
+const CodegenDataModelProvider::PrebuiltAttributeEntries *
+CodegenDataModelProvider::GetPrebuiltAttributeEntries(const ConcreteClusterPath & path, const EmberAfCluster & cluster)
+{
+    if (mPrebuiltAttributeEntriesGeneration != emberAfMetadataStructureGeneration())
     {
-        ReturnErrorOnFailure(builder.Append(AttributeEntryFrom(path, attribute)));
+        ReleasePrebuiltAttributeEntries();
+        mPrebuiltAttributeEntriesGeneration = emberAfMetadataStructureGeneration();
     }
 
-    for (auto & attributeId : GlobalAttributesNotInMetadata)
+    for (const PrebuiltAttributeEntries * prebuilt = mPrebuiltAttributeEntries; prebuilt != nullptr; prebuilt = prebuilt->next)
     {
+        if (prebuilt->cluster == &cluster)
+        {
+            return prebuilt;
+        }
+    }
 
-        // This "GlobalListEntry" is specific for metadata that ember does not include
-        // in its attribute list metadata.
-        //
-        // By spec these Attribute/AcceptedCommands/GeneratedCommants lists are:
-        //   - lists of elements
-        //   - read-only, with read privilege view
-        //   - fixed value (no such flag exists, so this is not a quality flag we set/track)
-        DataModel::AttributeEntry globalListEntry(attributeId, DataModel::AttributeQualityFlags::kListAttribute,
-                                                  Access::Privilege::kView, std::nullopt);
+    ReadOnlyBufferBuilder<DataModel::AttributeEntry> entriesBuilder;
+    VerifyOrReturnValue(AppendEmberAttributeEntries(path, cluster, entriesBuilder) == CHIP_NO_ERROR, nullptr);
 
-        ReturnErrorOnFailure(builder.Append(std::move(globalListEntry)));
-    }
+    PrebuiltAttributeEntries * prebuilt = Platform::New<PrebuiltAttributeEntries>();
+    VerifyOrReturnValue(prebuilt != nullptr, nullptr);
 
-    return CHIP_NO_ERROR;
+    prebuilt->next            = mPrebuiltAttributeEntries;
+    prebuilt->cluster         = &cluster;
+    prebuilt->entries         = entriesBuilder.TakeBuffer();
+    mPrebuiltAttributeEntries = prebuilt;
+    return prebuilt;
 }
 
+void CodegenDataModelProvider::ReleasePrebuiltAttributeEntries()
+{
+    while (mPrebuiltAttributeEntries != nullptr)
+    {
+        PrebuiltAttributeEntries * next = mPrebuiltAttributeEntries->next;
+        Platform::Delete(mPrebuiltAttributeEntries);
+        mPrebuiltAttributeEntries = next;
+    }
+}
+#endif
+
 CHIP_ERROR CodegenDataModelProvider::ClientClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ClusterId> & builder)
 {
     const EmberAfEndpointType * endpoint = emberAfFindEndpointType(endpointId);
@@ -416,28 +494,70 @@ CHIP_ERROR CodegenDataModelProvider::ClientClusters(EndpointId endpointId, ReadO
     return CHIP_NO_ERROR;
 }
 
-const EmberAfCluster * CodegenDataModelProvider::FindServerCluster(const ConcreteClusterPath & path)
+CodegenDataModelProvider::ClusterLookup CodegenDataModelProvider::LookupCluster(const ConcreteClusterPath & path)
 {
-    if (mPreviouslyFoundCluster.has_value() && (mPreviouslyFoundCluster->path == path) &&
-        (mEmberMetadataStructureGeneration == emberAfMetadataStructureGeneration()))
+#if CHIP_CODEGEN_CONFIG_CLUSTER_LOOKUP_CACHE_SIZE > 0
+    if ((mEmberMetadataStructureGeneration != emberAfMetadataStructureGeneration()) ||
+        (mRegistryGeneration != mRegistry.Generation()))
+    {
+        InvalidateClusterLookupCache();
+    }
+
+    // Cluster ids are manufacturer-prefixed, so fold the prefix into the index as well
+    const uint32_t index  = (path.mEndpointId ^ path.mClusterId ^ (path.mClusterId >> 16)) % MATTER_ARRAY_SIZE(mClusterLookupCache);
+    ClusterLookup & entry = mClusterLookupCache[index];
 
+    if (entry.path == path)
+    {
+        mClusterLookupCacheHits++;
+    }
+    else
     {
-        return mPreviouslyFoundCluster->cluster;
+        mClusterLookupCacheMisses++;
+        entry.path                   = path;
+        entry.serverClusterInterface = mRegistry.Get(path);
+        entry.emberCluster           = emberAfFindServerCluster(path.mEndpointId, path.mClusterId);
     }
 
-    const EmberAfCluster * cluster = emberAfFindServerCluster(path.mEndpointId, path.mClusterId);
-    if (cluster != nullptr)
+    if (mClusterLookupCacheHits + mClusterLookupCacheMisses >= kClusterLookupMetricsReportInterval)
     {
-        mPreviouslyFoundCluster           = std::make_optional<ClusterReference>(path, cluster);
-        mEmberMetadataStructureGeneration = emberAfMetadataStructureGeneration();
+        ReportClusterLookupCacheMetrics();
     }
-    return cluster;
+
+    return entry;
+#else
+    ClusterLookup lookup;
+    lookup.path                   = path;
+    lookup.serverClusterInterface = mRegistry.Get(path);
+    lookup.emberCluster           = emberAfFindServerCluster(path.mEndpointId, path.mClusterId);
+    return lookup;
+#endif
 }
 
+#if CHIP_CODEGEN_CONFIG_CLUSTER_LOOKUP_CACHE_SIZE > 0
+void CodegenDataModelProvider::InvalidateClusterLookupCache()
+{
+    for (auto & entry : mClusterLookupCache)
+    {
+        entry = ClusterLookup();
+    }
+    mEmberMetadataStructureGeneration = emberAfMetadataStructureGeneration();
+    mRegistryGeneration               = mRegistry.Generation();
+}
+
+void CodegenDataModelProvider::ReportClusterLookupCacheMetrics()
+{
+    MATTER_LOG_METRIC(Tracing::kMetricCodegenClusterLookupCacheHits, mClusterLookupCacheHits);
+    MATTER_LOG_METRIC(Tracing::kMetricCodegenClusterLookupCacheMisses, mClusterLookupCacheMisses);
+    mClusterLookupCacheHits   = 0;
+    mClusterLookupCacheMisses = 0;
+}
+#endif
+
 CHIP_ERROR CodegenDataModelProvider::AcceptedCommands(const ConcreteClusterPath & path,
                                                       ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> & builder)
 {
-    if (auto * cluster = mRegistry.Get(path); cluster != nullptr)
+    if (auto * cluster = FindServerClusterInterface(path); cluster != nullptr)
     {
         return cluster->AcceptedCommands(path, builder);
     }
@@ -481,7 +601,7 @@ CHIP_ERROR CodegenDataModelProvider::AcceptedCommands(const ConcreteClusterPath
 
 CHIP_ERROR CodegenDataModelProvider::GeneratedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<CommandId> & builder)
 {
-    if (auto * cluster = mRegistry.Get(path); cluster != nullptr)
+    if (auto * cluster = FindServerClusterInterface(path); cluster != nullptr)
     {
         return cluster->GeneratedCommands(path, builder);
     }
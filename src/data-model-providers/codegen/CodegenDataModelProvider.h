@@ -25,6 +25,7 @@
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/server-cluster/SingleEndpointServerClusterRegistry.h>
 #include <app/util/af-types.h>
+#include <data-model-providers/codegen/CodegenProcessingConfig.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/ReadOnlyBuffer.h>
 
@@ -49,9 +50,11 @@ public:
     // access to the typed global singleton of this class.
     static CodegenDataModelProvider & Instance();
 
+    ~CodegenDataModelProvider() override;
+
     /// clears out internal caching. Especially useful in unit tests,
     /// where path caching does not really apply (the same path may result in different outcomes)
-    void Reset() { mPreviouslyFoundCluster = std::nullopt; }
+    void Reset();
 
     void SetPersistentStorageDelegate(PersistentStorageDelegate * delegate) { mPersistentStorageDelegate = delegate; }
     PersistentStorageDelegate * GetPersistentStorageDelegate() { return mPersistentStorageDelegate; }
@@ -64,11 +67,14 @@ public:
 
     DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
                                                 AttributeValueEncoder & encoder) override;
+    std::optional<size_t> EstimateAttributeEncodedSize(const DataModel::ReadAttributeRequest & request) override;
     DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest & request,
                                                  AttributeValueDecoder & decoder) override;
 
     void ListAttributeWriteNotification(const ConcreteAttributePath & aPath, DataModel::ListWriteOperation opType,
                                         FabricIndex accessingFabric) override;
+    void BeginClusterWrites(const ConcreteClusterPath & path) override;
+    void EndClusterWrites(const ConcreteClusterPath & path) override;
     std::optional<DataModel::ActionReturnStatus> InvokeCommand(const DataModel::InvokeRequest & request,
                                                                TLV::TLVReader & input_arguments, CommandHandler * handler) override;
 
@@ -103,34 +109,80 @@ private:
     // To avoid N^2 iterations, cache a hint of where something is positioned
     uint16_t mEndpointIterationHint = 0;
 
-    // represents a remembered cluster reference that has been found as
-    // looking for clusters is very common (for every attribute iteration)
-    struct ClusterReference
-    {
-        ConcreteClusterPath path;
-        const EmberAfCluster * cluster;
-
-        ClusterReference(const ConcreteClusterPath p, const EmberAfCluster * c) : path(p), cluster(c) {}
-    };
-
     enum class ClusterSide : uint8_t
     {
         kServer,
         kClient,
     };
 
-    std::optional<ClusterReference> mPreviouslyFoundCluster;
+    // Remembers what a cluster path resolves to, as looking up clusters is very
+    // common (every read/write/invoke and every attribute iteration). Either
+    // pointer may be null if the path has no such cluster.
+    struct ClusterLookup
+    {
+        ConcreteClusterPath path                        = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
+        ServerClusterInterface * serverClusterInterface = nullptr;
+        const EmberAfCluster * emberCluster             = nullptr;
+    };
+
+#if CHIP_CODEGEN_CONFIG_CLUSTER_LOOKUP_CACHE_SIZE > 0
+    // Direct-mapped cache of cluster lookups. Contents are only valid for the generations below
+    // and the whole cache is dropped if either the ember metadata or the registry changes.
+    ClusterLookup mClusterLookupCache[CHIP_CODEGEN_CONFIG_CLUSTER_LOOKUP_CACHE_SIZE];
     unsigned mEmberMetadataStructureGeneration = 0;
+    unsigned mRegistryGeneration               = 0;
+
+    // Counts since the hit/miss metrics were last reported
+    uint32_t mClusterLookupCacheHits   = 0;
+    uint32_t mClusterLookupCacheMisses = 0;
+
+    void InvalidateClusterLookupCache();
+    void ReportClusterLookupCacheMetrics();
+#endif
+
+#if CHIP_CODEGEN_CONFIG_PREBUILT_ATTRIBUTE_ENTRIES
+    // Attribute entries of one ember cluster, built once so that `Attributes` can reference
+    // them instead of building a new list on every call. Entries only depend on the ember
+    // cluster metadata, so clusters sharing the same metadata share the list.
+    struct PrebuiltAttributeEntries
+    {
+        PrebuiltAttributeEntries * next = nullptr;
+        const EmberAfCluster * cluster  = nullptr;
+        ReadOnlyBuffer<DataModel::AttributeEntry> entries;
+    };
+
+    // Lists handed out by reference MUST stay valid for as long as the ember metadata they were
+    // built from, so they are only released when its structure changes (or on Reset).
+    PrebuiltAttributeEntries * mPrebuiltAttributeEntries = nullptr;
+    unsigned mPrebuiltAttributeEntriesGeneration         = 0;
+
+    /// Returns the prebuilt entries of `cluster` (found at `path`), building them if needed.
+    /// Returns nullptr if they could not be allocated.
+    const PrebuiltAttributeEntries * GetPrebuiltAttributeEntries(const ConcreteClusterPath & path, const EmberAfCluster & cluster);
+    void ReleasePrebuiltAttributeEntries();
+#endif
 
     // Ember requires a persistence provider, so we make sure we can always have something
     PersistentStorageDelegate * mPersistentStorageDelegate = nullptr;
 
     SingleEndpointServerClusterRegistry mRegistry;
 
+    /// Resolves both the registry entry and the ember cluster for the given path, going
+    /// through the cluster lookup cache when enabled.
+    ClusterLookup LookupCluster(const ConcreteClusterPath & path);
+
     /// Finds the specified ember cluster
     ///
     /// Effectively the same as `emberAfFindServerCluster` except with some caching capabilities
-    const EmberAfCluster * FindServerCluster(const ConcreteClusterPath & path);
+    const EmberAfCluster * FindServerCluster(const ConcreteClusterPath & path) { return LookupCluster(path).emberCluster; }
+
+    /// Finds the ServerClusterInterface registered for the specified path
+    ///
+    /// Effectively the same as `mRegistry.Get` except with some caching capabilities
+    ServerClusterInterface * FindServerClusterInterface(const ConcreteClusterPath & path)
+    {
+        return LookupCluster(path).serverClusterInterface;
+    }
 
     /// Find the index of the given endpoint id
     std::optional<unsigned> TryFindEndpointIndex(EndpointId id) const;
@@ -113,7 +113,7 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::ReadAttribute(const Data
         VerifyOrReturnError(!aai_result.has_value(), *aai_result);
     }
 
-    if (auto * cluster = mRegistry.Get(request.path); cluster != nullptr)
+    if (auto * cluster = FindServerClusterInterface(request.path); cluster != nullptr)
     {
         return cluster->ReadAttribute(request, encoder);
     }
@@ -144,5 +144,23 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::ReadAttribute(const Data
     return encoder.Encode(emberData);
 }
 
+std::optional<size_t> CodegenDataModelProvider::EstimateAttributeEncodedSize(const DataModel::ReadAttributeRequest & request)
+{
+    // Same precedence as ReadAttribute: AAI reads of ember-registered clusters cannot be estimated.
+    if ((emberAfLocateAttributeMetadata(request.path.mEndpointId, request.path.mClusterId, request.path.mAttributeId) != nullptr) &&
+        (AttributeAccessInterfaceRegistry::Instance().Get(request.path.mEndpointId, request.path.mClusterId) != nullptr))
+    {
+        return std::nullopt;
+    }
+
+    if (auto * cluster = FindServerClusterInterface(request.path); cluster != nullptr)
+    {
+        return cluster->EstimateAttributeEncodedSize(request);
+    }
+
+    // Ember values are small, or strings whose length is only known once read.
+    return std::nullopt;
+}
+
 } // namespace app
 } // namespace chip
@@ -107,7 +107,7 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::WriteAttribute(const Dat
     }
 
     // If ServerClusterInterface is available, it provides the final answer
-    if (auto * cluster = mRegistry.Get(request.path); cluster != nullptr)
+    if (auto * cluster = FindServerClusterInterface(request.path); cluster != nullptr)
     {
         return cluster->WriteAttribute(request, decoder);
     }
@@ -187,13 +187,29 @@ void CodegenDataModelProvider::ListAttributeWriteNotification(const ConcreteAttr
         // for now we err on the side of notifying both.
     }
 
-    if (auto * cluster = mRegistry.Get(aPath); cluster != nullptr)
+    if (auto * cluster = FindServerClusterInterface(aPath); cluster != nullptr)
     {
         cluster->ListAttributeWriteNotification(aPath, opType, accessingFabric);
         return;
     }
 }
 
+void CodegenDataModelProvider::BeginClusterWrites(const ConcreteClusterPath & path)
+{
+    if (auto * cluster = FindServerClusterInterface(path); cluster != nullptr)
+    {
+        cluster->BeginWrites(path);
+    }
+}
+
+void CodegenDataModelProvider::EndClusterWrites(const ConcreteClusterPath & path)
+{
+    if (auto * cluster = FindServerClusterInterface(path); cluster != nullptr)
+    {
+        cluster->EndWrites(path);
+    }
+}
+
 void CodegenDataModelProvider::Temporary_ReportAttributeChanged(const AttributePathParams & path)
 {
     // we must be started up to process changes since we use the context
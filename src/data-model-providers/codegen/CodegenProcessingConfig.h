@@ -18,3 +18,36 @@
 #if CHIP_HAVE_CONFIG_H
 #include <codegen/CodegenProcessingBuildConfig.h>
 #endif
+
+/**
+ * @def CHIP_CODEGEN_CONFIG_CLUSTER_LOOKUP_CACHE_SIZE
+ *
+ * @brief
+ *   Number of entries in the direct-mapped cache that CodegenDataModelProvider keeps
+ *   of (endpoint, cluster) to ember metadata and ServerClusterInterface registry entry.
+ *
+ *   Every read, write and invoke resolves both, so caching them avoids walking the
+ *   ember endpoint tables and the registry list on each request. Each entry costs
+ *   a cluster path and two pointers of RAM. Setting this to 0 disables the cache.
+ */
+#ifndef CHIP_CODEGEN_CONFIG_CLUSTER_LOOKUP_CACHE_SIZE
+#define CHIP_CODEGEN_CONFIG_CLUSTER_LOOKUP_CACHE_SIZE 8
+#endif
+
+/**
+ * @def CHIP_CODEGEN_CONFIG_PREBUILT_ATTRIBUTE_ENTRIES
+ *
+ * @brief
+ *   If enabled, CodegenDataModelProvider builds the attribute entry list of an ember
+ *   cluster once, on first use, and `Attributes` hands out a reference to it instead of
+ *   allocating and filling a new list on every call (i.e. for every cluster step of a
+ *   wildcard expansion and every attribute lookup).
+ *
+ *   The lists are kept until the ember metadata structure changes (e.g. dynamic endpoints
+ *   are added or removed) and cost one attribute entry per attribute of every cluster
+ *   that was queried, plus a small header per cluster. If allocating a list fails, a
+ *   copy is built as if this was disabled.
+ */
+#ifndef CHIP_CODEGEN_CONFIG_PREBUILT_ATTRIBUTE_ENTRIES
+#define CHIP_CODEGEN_CONFIG_PREBUILT_ATTRIBUTE_ENTRIES 1
+#endif
@@ -45,6 +45,8 @@ SET(CODEGEN_DATA_MODEL_SOURCES
   "${BASE_DIR}/../../app/persistence/String.h"
 
   # "${chip_root}/src/app/server-cluster:registry",
+  "${BASE_DIR}/../../app/server-cluster/ServerClusterIndex.cpp"
+  "${BASE_DIR}/../../app/server-cluster/ServerClusterIndex.h"
   "${BASE_DIR}/../../app/server-cluster/ServerClusterInterfaceRegistry.cpp"
   "${BASE_DIR}/../../app/server-cluster/ServerClusterInterfaceRegistry.h"
   "${BASE_DIR}/../../app/server-cluster/SingleEndpointServerClusterRegistry.cpp"
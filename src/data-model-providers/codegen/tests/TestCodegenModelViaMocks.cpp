@@ -1278,6 +1278,36 @@ TEST_F(TestCodegenModelViaMocks, IterateOverAttributes)
     ASSERT_TRUE(attributes[6].HasFlags(AttributeQualityFlags::kListAttribute));
 }
 
+#if CHIP_CODEGEN_CONFIG_PREBUILT_ATTRIBUTE_ENTRIES
+TEST_F(TestCodegenModelViaMocks, AttributesAreNotRebuiltForEachCall)
+{
+    CodegenDataModelProviderWithContext model;
+    const ConcreteClusterPath path(kMockEndpoint2, MockClusterId(2));
+
+    {
+        UseMockNodeConfig config(gTestNodeConfig);
+
+        auto first  = model.AttributesIgnoreError(path);
+        auto second = model.AttributesIgnoreError(path);
+        ASSERT_EQ(first.size(), 7u);
+        ASSERT_EQ(second.size(), 7u);
+
+        // Both reference the same prebuilt list
+        EXPECT_EQ(first.data(), second.data());
+    }
+
+    // Changing the ember metadata structure drops the prebuilt lists
+    UseMockNodeConfig config(gTestNodeConfig);
+    auto attributes = model.AttributesIgnoreError(path);
+    ASSERT_EQ(attributes.size(), 7u);
+    EXPECT_EQ(attributes[2].attributeId, MockAttributeId(1));
+    EXPECT_EQ(attributes[6].attributeId, AttributeList::Id);
+
+    model.Reset();
+    EXPECT_EQ(model.AttributesIgnoreError(path).size(), 7u);
+}
+#endif
+
 TEST_F(TestCodegenModelViaMocks, FindAttribute)
 {
     UseMockNodeConfig config(gTestNodeConfig);
@@ -2810,6 +2840,49 @@ TEST_F(TestCodegenModelViaMocks, ServerClusterInterfacesRead)
     EXPECT_SUCCESS(model.Registry().Unregister(&fakeClusterServer));
 }
 
+TEST_F(TestCodegenModelViaMocks, ClusterLookupFollowsRegistryChanges)
+{
+    TestServerClusterContext testContext;
+
+    UseMockNodeConfig config(gTestNodeConfig);
+    CodegenDataModelProviderWithContext model;
+
+    model.SetPersistentStorageDelegate(&testContext.StorageDelegate());
+    ASSERT_EQ(model.Startup(testContext.ImContext()), CHIP_NO_ERROR);
+
+    const ConcreteClusterPath kTestClusterPath(kMockEndpoint2, MockClusterId(2));
+
+    // Resolves to ember first, which makes the lookup cached
+    {
+        ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> builder;
+        ASSERT_EQ(model.AcceptedCommands(kTestClusterPath, builder), CHIP_NO_ERROR);
+        ASSERT_EQ(builder.Size(), 3u);
+    }
+
+    FakeDefaultServerCluster fakeClusterServer(kTestClusterPath);
+    ServerClusterRegistration registration(fakeClusterServer);
+    ASSERT_EQ(model.Registry().Register(registration), CHIP_NO_ERROR);
+
+    // A new registration takes over without needing a Reset()
+    {
+        ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> builder;
+        ASSERT_EQ(model.AcceptedCommands(kTestClusterPath, builder), CHIP_NO_ERROR);
+        auto cmds = builder.TakeBuffer();
+        ASSERT_EQ(cmds.size(), 2u);
+        ASSERT_EQ(cmds[0].commandId, 101u);
+        ASSERT_EQ(cmds[1].commandId, 102u);
+    }
+
+    EXPECT_SUCCESS(model.Registry().Unregister(&fakeClusterServer));
+
+    // and once gone, ember is used again
+    {
+        ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> builder;
+        ASSERT_EQ(model.AcceptedCommands(kTestClusterPath, builder), CHIP_NO_ERROR);
+        ASSERT_EQ(builder.Size(), 3u);
+    }
+}
+
 TEST_F(TestCodegenModelViaMocks, ServerClusterInterfacesRegistration)
 {
     TestServerClusterContext testContext;
@@ -0,0 +1,226 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <data-model-providers/overlay/OverlayDataModelProvider.h>
+
+#include <clusters/Descriptor/AttributeIds.h>
+#include <clusters/Descriptor/ClusterId.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+const DataModel::EndpointEntry * FindEndpoint(Span<const DataModel::EndpointEntry> endpoints, EndpointId endpointId)
+{
+    for (const auto & ep : endpoints)
+    {
+        if (ep.id == endpointId)
+        {
+            return &ep;
+        }
+    }
+    return nullptr;
+}
+
+/// Whether `ep` is in the PartsList of `parent`, following the rules of the Descriptor cluster.
+bool IsPartOf(const DataModel::EndpointEntry & ep, const DataModel::EndpointEntry & parent,
+              Span<const DataModel::EndpointEntry> endpoints)
+{
+    if (parent.id == kRootEndpointId)
+    {
+        return ep.id != kRootEndpointId;
+    }
+
+    if (parent.compositionPattern == DataModel::EndpointCompositionPattern::kTree)
+    {
+        return ep.parentId == parent.id;
+    }
+
+    // Full family: all the descendants of the endpoint
+    const DataModel::EndpointEntry * current = &ep;
+    while ((current != nullptr) && (current->parentId != kInvalidEndpointId))
+    {
+        VerifyOrReturnValue(current->parentId != parent.id, true);
+        current = FindEndpoint(endpoints, current->parentId);
+    }
+    return false;
+}
+
+} // namespace
+
+CHIP_ERROR OverlayDataModelProvider::Startup(DataModel::InteractionModelContext context)
+{
+    ReturnErrorOnFailure(mBase.Startup(context));
+    CHIP_ERROR err = mOverlay.Startup(context);
+    if (err != CHIP_NO_ERROR)
+    {
+        TEMPORARY_RETURN_IGNORED mBase.Shutdown();
+    }
+    return err;
+}
+
+CHIP_ERROR OverlayDataModelProvider::Shutdown()
+{
+    CHIP_ERROR overlayErr = mOverlay.Shutdown();
+    CHIP_ERROR baseErr    = mBase.Shutdown();
+    return (overlayErr != CHIP_NO_ERROR) ? overlayErr : baseErr;
+}
+
+DataModel::ActionReturnStatus OverlayDataModelProvider::ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                                      AttributeValueEncoder & encoder)
+{
+    if (!IsOverlayEndpoint(request.path.mEndpointId) && (request.path.mClusterId == Clusters::Descriptor::Id) &&
+        (request.path.mAttributeId == Clusters::Descriptor::Attributes::PartsList::Id))
+    {
+        return ReadBasePartsList(request.path.mEndpointId, encoder);
+    }
+    return ProviderFor(request.path.mEndpointId).ReadAttribute(request, encoder);
+}
+
+std::optional<size_t> OverlayDataModelProvider::EstimateAttributeEncodedSize(const DataModel::ReadAttributeRequest & request)
+{
+    if (!IsOverlayEndpoint(request.path.mEndpointId) && (request.path.mClusterId == Clusters::Descriptor::Id) &&
+        (request.path.mAttributeId == Clusters::Descriptor::Attributes::PartsList::Id))
+    {
+        return std::nullopt;
+    }
+    return ProviderFor(request.path.mEndpointId).EstimateAttributeEncodedSize(request);
+}
+
+DataModel::ActionReturnStatus OverlayDataModelProvider::WriteAttribute(const DataModel::WriteAttributeRequest & request,
+                                                                       AttributeValueDecoder & decoder)
+{
+    return ProviderFor(request.path.mEndpointId).WriteAttribute(request, decoder);
+}
+
+void OverlayDataModelProvider::ListAttributeWriteNotification(const ConcreteAttributePath & aPath,
+                                                              DataModel::ListWriteOperation opType, FabricIndex accessingFabric)
+{
+    ProviderFor(aPath.mEndpointId).ListAttributeWriteNotification(aPath, opType, accessingFabric);
+}
+
+void OverlayDataModelProvider::BeginClusterWrites(const ConcreteClusterPath & path)
+{
+    ProviderFor(path.mEndpointId).BeginClusterWrites(path);
+}
+
+void OverlayDataModelProvider::EndClusterWrites(const ConcreteClusterPath & path)
+{
+    ProviderFor(path.mEndpointId).EndClusterWrites(path);
+}
+
+std::optional<DataModel::ActionReturnStatus> OverlayDataModelProvider::InvokeCommand(const DataModel::InvokeRequest & request,
+                                                                                     TLV::TLVReader & input_arguments,
+                                                                                     CommandHandler * handler)
+{
+    return ProviderFor(request.path.mEndpointId).InvokeCommand(request, input_arguments, handler);
+}
+
+CHIP_ERROR OverlayDataModelProvider::Endpoints(ReadOnlyBufferBuilder<DataModel::EndpointEntry> & out)
+{
+    ReturnErrorOnFailure(mBase.Endpoints(out));
+    return mOverlay.Endpoints(out);
+}
+
+CHIP_ERROR OverlayDataModelProvider::DeviceTypes(EndpointId endpointId, ReadOnlyBufferBuilder<DataModel::DeviceTypeEntry> & out)
+{
+    return ProviderFor(endpointId).DeviceTypes(endpointId, out);
+}
+
+CHIP_ERROR OverlayDataModelProvider::ClientClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ClusterId> & out)
+{
+    return ProviderFor(endpointId).ClientClusters(endpointId, out);
+}
+
+CHIP_ERROR OverlayDataModelProvider::ServerClusters(EndpointId endpointId,
+                                                   ReadOnlyBufferBuilder<DataModel::ServerClusterEntry> & out)
+{
+    return ProviderFor(endpointId).ServerClusters(endpointId, out);
+}
+
+#if CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
+CHIP_ERROR OverlayDataModelProvider::EndpointUniqueID(EndpointId endpointId, MutableCharSpan & epUniqueId)
+{
+    return ProviderFor(endpointId).EndpointUniqueID(endpointId, epUniqueId);
+}
+#endif
+
+CHIP_ERROR OverlayDataModelProvider::EventInfo(const ConcreteEventPath & path, DataModel::EventEntry & eventInfo)
+{
+    return ProviderFor(path.mEndpointId).EventInfo(path, eventInfo);
+}
+
+CHIP_ERROR OverlayDataModelProvider::GeneratedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<CommandId> & out)
+{
+    return ProviderFor(path.mEndpointId).GeneratedCommands(path, out);
+}
+
+CHIP_ERROR OverlayDataModelProvider::AcceptedCommands(const ConcreteClusterPath & path,
+                                                      ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> & out)
+{
+    return ProviderFor(path.mEndpointId).AcceptedCommands(path, out);
+}
+
+CHIP_ERROR OverlayDataModelProvider::Attributes(const ConcreteClusterPath & path,
+                                                ReadOnlyBufferBuilder<DataModel::AttributeEntry> & out)
+{
+    return ProviderFor(path.mEndpointId).Attributes(path, out);
+}
+
+void OverlayDataModelProvider::Temporary_ReportAttributeChanged(const AttributePathParams & path)
+{
+    if (path.HasWildcardEndpointId())
+    {
+        mBase.Temporary_ReportAttributeChanged(path);
+        mOverlay.Temporary_ReportAttributeChanged(path);
+        return;
+    }
+    ProviderFor(path.mEndpointId).Temporary_ReportAttributeChanged(path);
+}
+
+CHIP_ERROR OverlayDataModelProvider::ReadBasePartsList(EndpointId endpointId, AttributeValueEncoder & encoder)
+{
+    ReadOnlyBufferBuilder<DataModel::EndpointEntry> builder;
+    ReturnErrorOnFailure(Endpoints(builder));
+    auto endpoints = builder.TakeBuffer();
+
+    // The root endpoint lists all others, even if the provider does not report it
+    const DataModel::EndpointEntry rootInfo{ .id                 = kRootEndpointId,
+                                             .parentId           = kInvalidEndpointId,
+                                             .compositionPattern = DataModel::EndpointCompositionPattern::kFullFamily };
+    const DataModel::EndpointEntry * endpointInfo = FindEndpoint(endpoints, endpointId);
+    if ((endpointInfo == nullptr) && (endpointId == kRootEndpointId))
+    {
+        endpointInfo = &rootInfo;
+    }
+    VerifyOrReturnError(endpointInfo != nullptr, CHIP_IM_GLOBAL_STATUS(UnsupportedEndpoint));
+
+    return encoder.EncodeList([&](const auto & listEncoder) -> CHIP_ERROR {
+        for (const auto & ep : endpoints)
+        {
+            if (IsPartOf(ep, *endpointInfo, endpoints))
+            {
+                ReturnErrorOnFailure(listEncoder.Encode(ep.id));
+            }
+        }
+        return CHIP_NO_ERROR;
+    });
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,98 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/data-model-provider/Provider.h>
+#include <lib/core/DataModelTypes.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief A data model provider made of two providers, routing each endpoint to one of them.
+ *
+ * Endpoints in the [overlayStart, overlayEnd] range are served by the overlay provider and all other
+ * endpoints by the base provider. This lets a bridge keep its root and aggregator endpoints in the
+ * code-generated (ember) data model while its bridged endpoints live in a CodeDrivenDataModelProvider,
+ * which avoids the linear dynamic endpoint tables of ember.
+ *
+ * Routing a request is a range check. Metadata that spans endpoints (the endpoint list, and the
+ * PartsList attribute of the Descriptor cluster of base endpoints) is merged from both providers.
+ *
+ * Requirements:
+ *   - The base provider MUST NOT expose endpoints in the overlay range and the overlay provider
+ *     MUST NOT expose endpoints outside of it.
+ *   - Both providers MUST outlive this provider. They are started up and shut down by it.
+ */
+class OverlayDataModelProvider : public DataModel::Provider
+{
+public:
+    OverlayDataModelProvider(DataModel::Provider & base, DataModel::Provider & overlay, EndpointId overlayStart,
+                             EndpointId overlayEnd) :
+        mBase(base),
+        mOverlay(overlay), mOverlayStart(overlayStart), mOverlayEnd(overlayEnd)
+    {}
+
+    /* DataModel::Provider implementation */
+    CHIP_ERROR Startup(DataModel::InteractionModelContext context) override;
+    CHIP_ERROR Shutdown() override;
+
+    DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                AttributeValueEncoder & encoder) override;
+    std::optional<size_t> EstimateAttributeEncodedSize(const DataModel::ReadAttributeRequest & request) override;
+    DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest & request,
+                                                 AttributeValueDecoder & decoder) override;
+    void ListAttributeWriteNotification(const ConcreteAttributePath & aPath, DataModel::ListWriteOperation opType,
+                                        FabricIndex accessingFabric) override;
+    void BeginClusterWrites(const ConcreteClusterPath & path) override;
+    void EndClusterWrites(const ConcreteClusterPath & path) override;
+    std::optional<DataModel::ActionReturnStatus> InvokeCommand(const DataModel::InvokeRequest & request,
+                                                               chip::TLV::TLVReader & input_arguments,
+                                                               CommandHandler * handler) override;
+
+    /* ProviderMetadataTree implementation */
+    CHIP_ERROR Endpoints(ReadOnlyBufferBuilder<DataModel::EndpointEntry> & out) override;
+    CHIP_ERROR DeviceTypes(EndpointId endpointId, ReadOnlyBufferBuilder<DataModel::DeviceTypeEntry> & out) override;
+    CHIP_ERROR ClientClusters(EndpointId endpointId, ReadOnlyBufferBuilder<ClusterId> & out) override;
+    CHIP_ERROR ServerClusters(EndpointId endpointId, ReadOnlyBufferBuilder<DataModel::ServerClusterEntry> & out) override;
+#if CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
+    CHIP_ERROR EndpointUniqueID(EndpointId endpointId, MutableCharSpan & epUniqueId) override;
+#endif
+    CHIP_ERROR EventInfo(const ConcreteEventPath & path, DataModel::EventEntry & eventInfo) override;
+    CHIP_ERROR GeneratedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<CommandId> & out) override;
+    CHIP_ERROR AcceptedCommands(const ConcreteClusterPath & path,
+                                ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> & out) override;
+    CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<DataModel::AttributeEntry> & out) override;
+    void Temporary_ReportAttributeChanged(const AttributePathParams & path) override;
+
+private:
+    bool IsOverlayEndpoint(EndpointId endpointId) const { return (endpointId >= mOverlayStart) && (endpointId <= mOverlayEnd); }
+
+    /// Return the provider serving the given endpoint
+    DataModel::Provider & ProviderFor(EndpointId endpointId) { return IsOverlayEndpoint(endpointId) ? mOverlay : mBase; }
+
+    /// Encodes the PartsList of a base endpoint, which may contain endpoints of the overlay provider
+    CHIP_ERROR ReadBasePartsList(EndpointId endpointId, AttributeValueEncoder & encoder);
+
+    DataModel::Provider & mBase;
+    DataModel::Provider & mOverlay;
+    const EndpointId mOverlayStart;
+    const EndpointId mOverlayEnd;
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,175 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <app/data-model-provider/MetadataTypes.h>
+#include <app/data-model-provider/StringBuilderAdapters.h>
+#include <app/data-model-provider/tests/ReadTesting.h>
+#include <app/data-model-provider/tests/TestConstants.h>
+#include <app/data-model/DecodableList.h>
+#include <app/server-cluster/testing/TestEventGenerator.h>
+#include <app/server-cluster/testing/TestProviderChangeListener.h>
+#include <app/server-cluster/testing/TestServerClusterContext.h>
+#include <clusters/Descriptor/AttributeIds.h>
+#include <clusters/Descriptor/ClusterId.h>
+#include <data-model-providers/codedriven/CodeDrivenDataModelProvider.h>
+#include <data-model-providers/codedriven/endpoint/SpanEndpoint.h>
+#include <data-model-providers/overlay/OverlayDataModelProvider.h>
+#include <lib/support/ReadOnlyBuffer.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::DataModel;
+using namespace chip::Testing;
+
+namespace {
+
+class TestActionContext : public DataModel::ActionContext
+{
+public:
+    Messaging::ExchangeContext * CurrentExchange() override { return nullptr; }
+};
+
+constexpr EndpointId kOverlayStart = 10;
+
+constexpr EndpointEntry kRootEntry       = { .id                 = kRootEndpointId,
+                                             .parentId           = kInvalidEndpointId,
+                                             .compositionPattern = EndpointCompositionPattern::kFullFamily };
+constexpr EndpointEntry kAggregatorEntry = { .id                 = 1,
+                                             .parentId           = kInvalidEndpointId,
+                                             .compositionPattern = EndpointCompositionPattern::kFullFamily };
+constexpr EndpointEntry kBridgedEntry    = { .id                 = kOverlayStart,
+                                             .parentId           = 1,
+                                             .compositionPattern = EndpointCompositionPattern::kFullFamily };
+constexpr EndpointEntry kChildEntry      = { .id                 = kOverlayStart + 1,
+                                             .parentId           = kOverlayStart,
+                                             .compositionPattern = EndpointCompositionPattern::kFullFamily };
+
+const DeviceTypeEntry kBaseDeviceTypes[]    = { { .deviceTypeId = 0x000E, .deviceTypeRevision = 1 } };
+const DeviceTypeEntry kOverlayDeviceTypes[] = { { .deviceTypeId = 0x0100, .deviceTypeRevision = 2 } };
+
+class TestOverlayDataModelProvider : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+protected:
+    TestProviderChangeListener mChangeListener;
+    LogOnlyEvents mEventGenerator;
+    TestActionContext mActionContext;
+    InteractionModelContext mContext{
+        .eventsGenerator         = mEventGenerator,
+        .dataModelChangeListener = mChangeListener,
+        .actionContext           = mActionContext,
+    };
+    TestServerClusterContext mServerClusterTestContext;
+
+    CodeDrivenDataModelProvider mBase{ mServerClusterTestContext.StorageDelegate(),
+                                       mServerClusterTestContext.AttributePersistenceProvider() };
+    CodeDrivenDataModelProvider mOverlay{ mServerClusterTestContext.StorageDelegate(),
+                                          mServerClusterTestContext.AttributePersistenceProvider() };
+    OverlayDataModelProvider mProvider{ mBase, mOverlay, kOverlayStart, kInvalidEndpointId - 1 };
+
+    SpanEndpoint mBaseEndpoint = SpanEndpoint::Builder().SetDeviceTypes(Span<const DeviceTypeEntry>(kBaseDeviceTypes)).Build();
+    SpanEndpoint mOverlayEndpoint =
+        SpanEndpoint::Builder().SetDeviceTypes(Span<const DeviceTypeEntry>(kOverlayDeviceTypes)).Build();
+
+    EndpointInterfaceRegistration mRootRegistration{ mBaseEndpoint, kRootEntry };
+    EndpointInterfaceRegistration mAggregatorRegistration{ mBaseEndpoint, kAggregatorEntry };
+    EndpointInterfaceRegistration mBridgedRegistration{ mOverlayEndpoint, kBridgedEntry };
+    EndpointInterfaceRegistration mChildRegistration{ mOverlayEndpoint, kChildEntry };
+
+    void SetUp() override
+    {
+        ASSERT_EQ(mProvider.Startup(mContext), CHIP_NO_ERROR);
+        ASSERT_EQ(mBase.AddEndpoint(mRootRegistration), CHIP_NO_ERROR);
+        ASSERT_EQ(mBase.AddEndpoint(mAggregatorRegistration), CHIP_NO_ERROR);
+        ASSERT_EQ(mOverlay.AddEndpoint(mBridgedRegistration), CHIP_NO_ERROR);
+        ASSERT_EQ(mOverlay.AddEndpoint(mChildRegistration), CHIP_NO_ERROR);
+    }
+
+    void TearDown() override { EXPECT_SUCCESS(mProvider.Shutdown()); }
+
+    std::vector<EndpointId> ReadPartsList(EndpointId endpointId)
+    {
+        std::vector<EndpointId> partsList;
+
+        ReadOperation testRequest(endpointId, Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id);
+        testRequest.SetSubjectDescriptor(kAdminSubjectDescriptor);
+        std::unique_ptr<AttributeValueEncoder> encoder = testRequest.StartEncoding();
+        EXPECT_TRUE(mProvider.ReadAttribute(testRequest.GetRequest(), *encoder).IsSuccess());
+        EXPECT_EQ(testRequest.FinishEncoding(), CHIP_NO_ERROR);
+
+        std::vector<DecodedAttributeData> attributeData;
+        EXPECT_EQ(testRequest.GetEncodedIBs().Decode(attributeData), CHIP_NO_ERROR);
+        VerifyOrReturnValue(attributeData.size() == 1u, partsList);
+
+        DataModel::DecodableList<EndpointId> decodedList;
+        EXPECT_EQ(decodedList.Decode(attributeData[0].dataReader), CHIP_NO_ERROR);
+        auto it = decodedList.begin();
+        while (it.Next())
+        {
+            partsList.push_back(it.GetValue());
+        }
+        EXPECT_EQ(it.GetStatus(), CHIP_NO_ERROR);
+        return partsList;
+    }
+};
+
+} // namespace
+
+TEST_F(TestOverlayDataModelProvider, MergesEndpoints)
+{
+    ReadOnlyBufferBuilder<EndpointEntry> builder;
+    ASSERT_EQ(mProvider.Endpoints(builder), CHIP_NO_ERROR);
+    auto endpoints = builder.TakeBuffer();
+
+    ASSERT_EQ(endpoints.size(), 4u);
+    EXPECT_EQ(endpoints[0], kRootEntry);
+    EXPECT_EQ(endpoints[1], kAggregatorEntry);
+    EXPECT_EQ(endpoints[2], kBridgedEntry);
+    EXPECT_EQ(endpoints[3], kChildEntry);
+}
+
+TEST_F(TestOverlayDataModelProvider, RoutesByEndpoint)
+{
+    ReadOnlyBufferBuilder<DeviceTypeEntry> baseBuilder;
+    ASSERT_EQ(mProvider.DeviceTypes(kAggregatorEntry.id, baseBuilder), CHIP_NO_ERROR);
+    auto baseDeviceTypes = baseBuilder.TakeBuffer();
+    ASSERT_EQ(baseDeviceTypes.size(), 1u);
+    EXPECT_EQ(baseDeviceTypes[0], kBaseDeviceTypes[0]);
+
+    ReadOnlyBufferBuilder<DeviceTypeEntry> overlayBuilder;
+    ASSERT_EQ(mProvider.DeviceTypes(kChildEntry.id, overlayBuilder), CHIP_NO_ERROR);
+    auto overlayDeviceTypes = overlayBuilder.TakeBuffer();
+    ASSERT_EQ(overlayDeviceTypes.size(), 1u);
+    EXPECT_EQ(overlayDeviceTypes[0], kOverlayDeviceTypes[0]);
+
+    // An endpoint of the overlay range is never looked up in the base provider
+    ReadOnlyBufferBuilder<DeviceTypeEntry> missingBuilder;
+    EXPECT_NE(mProvider.DeviceTypes(kOverlayStart + 2, missingBuilder), CHIP_NO_ERROR);
+}
+
+TEST_F(TestOverlayDataModelProvider, PartsListOfBaseEndpointsIncludesOverlayEndpoints)
+{
+    EXPECT_EQ(ReadPartsList(kRootEndpointId), (std::vector<EndpointId>{ kAggregatorEntry.id, kBridgedEntry.id, kChildEntry.id }));
+    EXPECT_EQ(ReadPartsList(kAggregatorEntry.id), (std::vector<EndpointId>{ kBridgedEntry.id, kChildEntry.id }));
+}
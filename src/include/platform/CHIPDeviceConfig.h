@@ -91,6 +91,16 @@
 #define CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE 100
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_SAFE_QUEUE_RING_SIZE
+ *
+ * The number of events held in the lock-free ring of the chip Platform event queue on POSIX platforms. Events posted
+ * while the ring is full go through a slower, locked, overflow queue. Must be a power of two.
+ */
+#ifndef CHIP_DEVICE_CONFIG_SAFE_QUEUE_RING_SIZE
+#define CHIP_DEVICE_CONFIG_SAFE_QUEUE_RING_SIZE 256
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
  *
@@ -432,6 +442,16 @@
 #define CHIP_DEVICE_CONFIG_WIFI_SCAN_COMPLETION_TIMEOUT 10000
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_MAX_AGE
+ *
+ * The age (in milliseconds) under which the results of the previous WiFi scan are returned for a new scan
+ * request, on platforms that support it, instead of scanning again.  A value of 0 always scans.
+ */
+#ifndef CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_MAX_AGE
+#define CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_MAX_AGE 0
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_WIFI_CONNECTIVITY_TIMEOUT
  *
@@ -170,6 +170,33 @@ public:
      */
     CHIP_ERROR Delete(const char * key);
 
+    /**
+     * @brief
+     * Starts a batch of Puts and Deletes, which are written to storage together
+     * when the matching CommitBatch is called.  Batches nest: the outermost
+     * CommitBatch writes the batch.
+     *
+     * Platforms that support it write a batch atomically, so that after a
+     * reset, either all or none of its changes are found.  On other platforms,
+     * each change is written as it is made.
+     *
+     * @return CHIP_NO_ERROR the batch was started.
+     *         CHIP_ERROR_UNINITIALIZED the KVS is not initialized
+     */
+    CHIP_ERROR BeginBatch();
+
+    /**
+     * @brief
+     * Ends a batch started with BeginBatch.  Must be called for every
+     * successful BeginBatch, including when some changes of the batch failed.
+     *
+     * @return CHIP_NO_ERROR the changes of the batch were written, or the
+     *                       batch is nested in another one.
+     *         CHIP_ERROR_PERSISTED_STORAGE_FAILED failed to write the changes.
+     *         CHIP_ERROR_INCORRECT_STATE there is no batch to commit.
+     */
+    CHIP_ERROR CommitBatch();
+
 private:
     using ImplClass = ::chip::DeviceLayer::PersistedStorage::KeyValueStoreManagerImpl;
 
@@ -178,6 +205,10 @@ protected:
     KeyValueStoreManager()  = default;
     ~KeyValueStoreManager() = default;
 
+    // Platforms that can write several changes at once implement their own versions of these.
+    CHIP_ERROR _BeginBatch() { return CHIP_NO_ERROR; }
+    CHIP_ERROR _CommitBatch() { return CHIP_NO_ERROR; }
+
     // No copy, move or assignment.
     KeyValueStoreManager(const KeyValueStoreManager &)             = delete;
     KeyValueStoreManager(const KeyValueStoreManager &&)            = delete;
@@ -233,6 +264,16 @@ inline CHIP_ERROR KeyValueStoreManager::Delete(const char * key)
     return static_cast<ImplClass *>(this)->_Delete(key);
 }
 
+inline CHIP_ERROR KeyValueStoreManager::BeginBatch()
+{
+    return static_cast<ImplClass *>(this)->_BeginBatch();
+}
+
+inline CHIP_ERROR KeyValueStoreManager::CommitBatch()
+{
+    return static_cast<ImplClass *>(this)->_CommitBatch();
+}
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
@@ -103,6 +103,18 @@ public:
         return mKvsManager->Delete(key);
     }
 
+    CHIP_ERROR SyncBeginBatch() override
+    {
+        VerifyOrReturnError(mKvsManager != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        return mKvsManager->BeginBatch();
+    }
+
+    CHIP_ERROR SyncCommitBatch() override
+    {
+        VerifyOrReturnError(mKvsManager != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        return mKvsManager->CommitBatch();
+    }
+
 protected:
     DeviceLayer::PersistedStorage::KeyValueStoreManager * mKvsManager = nullptr;
 };
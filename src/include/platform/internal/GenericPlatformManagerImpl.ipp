@@ -38,6 +38,7 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemStallDetector.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -319,17 +320,22 @@ void GenericPlatformManagerImpl<ImplClass>::_DispatchEvent(const ChipDeviceEvent
         // Do nothing for no-op events.
         break;
 
-    case DeviceEventType::kChipLambdaEvent:
+    case DeviceEventType::kChipLambdaEvent: {
+        CHIP_SYSTEM_STALL_DETECTOR_SCOPE(kLambda, event->LambdaEvent.GetProxyAddress());
         event->LambdaEvent();
         break;
+    }
 
-    case DeviceEventType::kCallWorkFunct:
+    case DeviceEventType::kCallWorkFunct: {
         // If the event is a "call work function" event, call the specified function.
+        CHIP_SYSTEM_STALL_DETECTOR_SCOPE(kScheduledWork, event->CallWorkFunct.WorkFunct);
         event->CallWorkFunct.WorkFunct(event->CallWorkFunct.Arg);
         break;
+    }
 
-    default:
+    default: {
         // For all other events, deliver the event to each of the components in the Device Layer.
+        CHIP_SYSTEM_STALL_DETECTOR_SCOPE(kDeviceEvent, event->Type);
         Impl()->DispatchEventToDeviceLayer(event);
 
         // If the event is not an internal event, also deliver it to the application's registered
@@ -341,6 +347,7 @@ void GenericPlatformManagerImpl<ImplClass>::_DispatchEvent(const ChipDeviceEvent
 
         break;
     }
+    }
 
 #if (CHIP_DISPATCH_EVENT_LONG_DISPATCH_TIME_WARNING_THRESHOLD_MS != 0)
     uint32_t deltaMs = System::Clock::Milliseconds32(System::SystemClock().GetMonotonicTimestamp() - start).count();
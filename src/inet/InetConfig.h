@@ -272,6 +272,55 @@
 #endif
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+/**
+ *  @def INET_CONFIG_CACHE_INTERFACES
+ *
+ *  @brief
+ *    Share a snapshot of the network interfaces and their addresses between
+ *    the interface iterators, refreshed when the system reports a change.
+ *
+ *  @details
+ *    When this flag is set, the socket-based InterfaceIterator and
+ *    InterfaceAddressIterator read a process-wide snapshot instead of calling
+ *    if_nameindex() and getifaddrs() each time they are created. The snapshot
+ *    is taken again when a netlink route socket reports a link or address
+ *    change, so this requires Linux.
+ */
+#ifndef INET_CONFIG_CACHE_INTERFACES
+#define INET_CONFIG_CACHE_INTERFACES 0
+#endif // INET_CONFIG_CACHE_INTERFACES
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_RECVMMSG
+ *
+ *  @brief
+ *    Use recvmmsg() to receive several UDP datagrams per readiness event.
+ *
+ *  @details
+ *    When this flag is set, the socket-based implementation of UDP endpoints
+ *    drains up to INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE datagrams with a
+ *    single system call, which saves a system call and an event loop wakeup per
+ *    datagram on bursts of traffic. Requires recvmmsg(), e.g. on Linux.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_RECVMMSG
+#define INET_CONFIG_UDP_SOCKET_RECVMMSG 0
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of datagrams received by one recvmmsg() call, when
+ *    INET_CONFIG_UDP_SOCKET_RECVMMSG is set.
+ *
+ *  @details
+ *    A packet buffer of the maximum size is allocated for each datagram of
+ *    the batch before the call, and the unused ones freed after it.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE 8
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE
+
 /**
  *  @def HAVE_SO_BINDTODEVICE
  *
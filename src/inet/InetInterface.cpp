@@ -50,6 +50,15 @@
 #include <ifaddrs.h>
 #include <net/if.h>
 #include <sys/ioctl.h>
+#if INET_CONFIG_CACHE_INTERFACES
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+#endif // INET_CONFIG_CACHE_INTERFACES
 #endif // (CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK) && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -554,21 +563,208 @@ void CloseIOCTLSocket()
     }
 }
 
+#if INET_CONFIG_CACHE_INTERFACES
+
+/**
+ * @brief   The interfaces, their flags and their addresses, as read at one point in time.
+ *
+ * @details
+ *   The iterators share the current snapshot instead of each reading the interfaces again. A netlink route socket
+ *   subscribed to the link and address changes tells when the current snapshot is out of date: the next iterator to
+ *   acquire it then takes a new one, while the iterators still holding the old one keep it alive until they release it.
+ */
+class InterfaceSnapshot
+{
+public:
+    /**
+     * Returns the current snapshot, taking a new one first if the interfaces changed since it was taken, or nullptr if
+     * the interfaces cannot be read. The caller must release the returned snapshot.
+     */
+    static InterfaceSnapshot * Acquire();
+    void Release();
+
+    struct if_nameindex * GetInterfaces() const { return mInterfaces; }
+    struct ifaddrs * GetAddresses() const { return mAddresses; }
+    short GetFlags(size_t interfaceIndex) const { return mFlags[interfaceIndex]; }
+
+    /**
+     * Same as if_nametoindex(), without the system call.
+     */
+    unsigned int GetInterfaceIndex(const char * name) const;
+
+private:
+    InterfaceSnapshot() = default;
+    ~InterfaceSnapshot();
+
+    bool Read();
+    static bool InterfacesChanged();
+
+    static std::mutex sMutex;
+    static InterfaceSnapshot * sCurrent;
+    static int sNotificationSocket;
+
+    // One reference is held by sCurrent while the snapshot is current.
+    std::atomic<uint32_t> mRefCount{ 1 };
+    struct if_nameindex * mInterfaces = nullptr;
+    struct ifaddrs * mAddresses       = nullptr;
+    std::vector<short> mFlags;
+};
+
+std::mutex InterfaceSnapshot::sMutex;
+InterfaceSnapshot * InterfaceSnapshot::sCurrent = nullptr;
+int InterfaceSnapshot::sNotificationSocket      = -1;
+
+InterfaceSnapshot * InterfaceSnapshot::Acquire()
+{
+    std::lock_guard<std::mutex> lock(sMutex);
+
+    // The notifications are drained before reading the interfaces, so that a change racing with the read is seen by the
+    // next call rather than lost.
+    if (InterfacesChanged() && sCurrent != nullptr)
+    {
+        sCurrent->Release();
+        sCurrent = nullptr;
+    }
+
+    if (sCurrent == nullptr)
+    {
+        InterfaceSnapshot * snapshot = new (std::nothrow) InterfaceSnapshot();
+        VerifyOrReturnValue(snapshot != nullptr, nullptr);
+        if (!snapshot->Read())
+        {
+            snapshot->Release();
+            return nullptr;
+        }
+        sCurrent = snapshot;
+    }
+
+    sCurrent->mRefCount.fetch_add(1, std::memory_order_relaxed);
+    return sCurrent;
+}
+
+void InterfaceSnapshot::Release()
+{
+    if (mRefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        delete this;
+    }
+}
+
+InterfaceSnapshot::~InterfaceSnapshot()
+{
+    if (mInterfaces != nullptr)
+    {
+        if_freenameindexImpl(mInterfaces);
+    }
+    if (mAddresses != nullptr)
+    {
+        freeifaddrs(mAddresses);
+    }
+}
+
+bool InterfaceSnapshot::Read()
+{
+    mInterfaces = if_nameindexImpl();
+    VerifyOrReturnValue(mInterfaces != nullptr, false);
+    VerifyOrReturnValue(getifaddrs(&mAddresses) == 0, false);
+
+    for (size_t i = 0; mInterfaces[i].if_index != 0; i++)
+    {
+        struct ifreq intfData;
+        Platform::CopyString(intfData.ifr_name, mInterfaces[i].if_name);
+        mFlags.push_back(ioctl(GetIOCTLSocket(), SIOCGIFFLAGS, &intfData) == 0 ? intfData.ifr_flags : 0);
+    }
+    return true;
+}
+
+unsigned int InterfaceSnapshot::GetInterfaceIndex(const char * name) const
+{
+    for (size_t i = 0; mInterfaces[i].if_index != 0; i++)
+    {
+        if (strcmp(mInterfaces[i].if_name, name) == 0)
+        {
+            return mInterfaces[i].if_index;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief   Drains the pending link and address notifications, and returns whether there was any.
+ *
+ * @details
+ *   Whenever the notifications cannot be relied on, e.g. when the socket cannot be opened or the kernel dropped some
+ *   of them, the interfaces are assumed to have changed.
+ */
+bool InterfaceSnapshot::InterfacesChanged()
+{
+    if (sNotificationSocket == -1)
+    {
+        int s = socket(AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_ROUTE);
+        VerifyOrReturnValue(s >= 0, true);
+
+        struct sockaddr_nl addr = {};
+        addr.nl_family          = AF_NETLINK;
+        addr.nl_groups          = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+        if (bind(s, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0)
+        {
+            close(s);
+            return true;
+        }
+        sNotificationSocket = s;
+        return true;
+    }
+
+    bool changed = false;
+    while (true)
+    {
+        // Only the arrival of a notification matters, not its content.
+        char buffer[4096];
+        ssize_t len = recv(sNotificationSocket, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (len > 0)
+        {
+            changed = true;
+            continue;
+        }
+        if (len < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        // EAGAIN means there is nothing left to read; anything else, such as ENOBUFS when notifications were dropped,
+        // means the snapshot cannot be trusted.
+        return changed || len == 0 || (errno != EAGAIN && errno != EWOULDBLOCK);
+    }
+}
+
+#endif // INET_CONFIG_CACHE_INTERFACES
+
 InterfaceIterator::InterfaceIterator()
 {
     mIntfArray       = nullptr;
     mCurIntf         = 0;
     mIntfFlags       = 0;
     mIntfFlagsCached = false;
+#if INET_CONFIG_CACHE_INTERFACES
+    mSnapshot = nullptr;
+#endif // INET_CONFIG_CACHE_INTERFACES
 }
 
 InterfaceIterator::~InterfaceIterator()
 {
+#if INET_CONFIG_CACHE_INTERFACES
+    if (mSnapshot != nullptr)
+    {
+        mSnapshot->Release();
+        mSnapshot  = nullptr;
+        mIntfArray = nullptr;
+    }
+#else
     if (mIntfArray != nullptr)
     {
         if_freenameindexImpl(mIntfArray);
         mIntfArray = nullptr;
     }
+#endif // INET_CONFIG_CACHE_INTERFACES
 }
 
 bool InterfaceIterator::HasCurrent()
@@ -580,7 +776,12 @@ bool InterfaceIterator::Next()
 {
     if (mIntfArray == nullptr)
     {
+#if INET_CONFIG_CACHE_INTERFACES
+        mSnapshot  = InterfaceSnapshot::Acquire();
+        mIntfArray = (mSnapshot != nullptr) ? mSnapshot->GetInterfaces() : nullptr;
+#else
         mIntfArray = if_nameindexImpl();
+#endif // INET_CONFIG_CACHE_INTERFACES
     }
     else if (mIntfArray[mCurIntf].if_index != 0)
     {
@@ -626,6 +827,9 @@ bool InterfaceIterator::HasBroadcastAddress()
 
 short InterfaceIterator::GetFlags()
 {
+#if INET_CONFIG_CACHE_INTERFACES
+    return HasCurrent() ? mSnapshot->GetFlags(mCurIntf) : 0;
+#else
     struct ifreq intfData;
 
     if (!mIntfFlagsCached && HasCurrent())
@@ -644,6 +848,7 @@ short InterfaceIterator::GetFlags()
     }
 
     return mIntfFlags;
+#endif // INET_CONFIG_CACHE_INTERFACES
 }
 
 CHIP_ERROR InterfaceIterator::GetInterfaceType(InterfaceType & type)
@@ -660,15 +865,27 @@ InterfaceAddressIterator::InterfaceAddressIterator()
 {
     mAddrsList = nullptr;
     mCurAddr   = nullptr;
+#if INET_CONFIG_CACHE_INTERFACES
+    mSnapshot = nullptr;
+#endif // INET_CONFIG_CACHE_INTERFACES
 }
 
 InterfaceAddressIterator::~InterfaceAddressIterator()
 {
+#if INET_CONFIG_CACHE_INTERFACES
+    if (mSnapshot != nullptr)
+    {
+        mSnapshot->Release();
+        mSnapshot  = nullptr;
+        mAddrsList = mCurAddr = nullptr;
+    }
+#else
     if (mAddrsList != nullptr)
     {
         freeifaddrs(mAddrsList);
         mAddrsList = mCurAddr = nullptr;
     }
+#endif // INET_CONFIG_CACHE_INTERFACES
 }
 
 bool InterfaceAddressIterator::HasCurrent()
@@ -682,11 +899,19 @@ bool InterfaceAddressIterator::Next()
     {
         if (mAddrsList == nullptr)
         {
+#if INET_CONFIG_CACHE_INTERFACES
+            // The snapshot is acquired once: an empty address list must not be read again on every call.
+            VerifyOrReturnValue(mSnapshot == nullptr, false);
+            mSnapshot = InterfaceSnapshot::Acquire();
+            VerifyOrReturnValue(mSnapshot != nullptr, false);
+            mAddrsList = mSnapshot->GetAddresses();
+#else
             int res = getifaddrs(&mAddrsList);
             if (res < 0)
             {
                 return false;
             }
+#endif // INET_CONFIG_CACHE_INTERFACES
             mCurAddr = mAddrsList;
         }
         else if (mCurAddr != nullptr)
@@ -742,7 +967,11 @@ uint8_t InterfaceAddressIterator::GetPrefixLength()
 
 InterfaceId InterfaceAddressIterator::GetInterfaceId()
 {
+#if INET_CONFIG_CACHE_INTERFACES
+    return HasCurrent() ? InterfaceId(mSnapshot->GetInterfaceIndex(mCurAddr->ifa_name)) : InterfaceId::Null();
+#else
     return HasCurrent() ? InterfaceId(if_nametoindex(mCurAddr->ifa_name)) : InterfaceId::Null();
+#endif // INET_CONFIG_CACHE_INTERFACES
 }
 
 CHIP_ERROR InterfaceAddressIterator::GetInterfaceName(char * nameBuf, size_t nameBufSize)
@@ -58,6 +58,10 @@ namespace Inet {
 class IPAddress;
 class IPPrefix;
 
+#if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS && INET_CONFIG_CACHE_INTERFACES
+class InterfaceSnapshot;
+#endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS && INET_CONFIG_CACHE_INTERFACES
+
 /**
  * Data type describing interface type.
  */
@@ -356,6 +360,10 @@ protected:
     size_t mCurIntf;
     short mIntfFlags;
     bool mIntfFlagsCached;
+#if INET_CONFIG_CACHE_INTERFACES
+    // The snapshot mIntfArray points into.
+    InterfaceSnapshot * mSnapshot;
+#endif // INET_CONFIG_CACHE_INTERFACES
 
     short GetFlags();
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
@@ -546,6 +554,10 @@ private:
 #if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
     struct ifaddrs * mAddrsList;
     struct ifaddrs * mCurAddr;
+#if INET_CONFIG_CACHE_INTERFACES
+    // The snapshot mAddrsList points into.
+    InterfaceSnapshot * mSnapshot;
+#endif // INET_CONFIG_CACHE_INTERFACES
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -167,6 +167,93 @@ CHIP_ERROR IPv4Bind(int socket, const IPAddress & address, uint16_t port)
 }
 #endif // INET_CONFIG_ENABLE_IPV4
 
+// Room for the IP_PKTINFO/IPV6_PKTINFO control message of a received datagram.
+constexpr size_t kReceiveControlDataSize = 256;
+
+void PrepareReceiveHeader(System::PacketBuffer & buffer, struct iovec & msgIOV, SockAddr & peerSockAddr,
+                          uint8_t (&controlData)[kReceiveControlDataSize], struct msghdr & msgHeader)
+{
+    msgIOV.iov_base = buffer.Start();
+    msgIOV.iov_len  = buffer.AvailableDataLength();
+
+    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
+
+    memset(&msgHeader, 0, sizeof(msgHeader));
+
+    msgHeader.msg_name       = &peerSockAddr;
+    msgHeader.msg_namelen    = sizeof(peerSockAddr);
+    msgHeader.msg_iov        = &msgIOV;
+    msgHeader.msg_iovlen     = 1;
+    msgHeader.msg_control    = controlData;
+    msgHeader.msg_controllen = sizeof(controlData);
+}
+
+// Fills in the length of a datagram received with a header from PrepareReceiveHeader, and its source and, from the
+// control messages, destination in packetInfo.
+CHIP_ERROR DecodeReceivedMessage(struct msghdr & msgHeader, size_t rcvLen, System::PacketBuffer & buffer, IPPacketInfo & packetInfo)
+{
+    if (buffer.AvailableDataLength() < rcvLen)
+    {
+        return CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+    }
+
+    buffer.SetDataLength(static_cast<uint16_t>(rcvLen));
+
+    const SockAddr & lPeerSockAddr = *static_cast<const SockAddr *>(msgHeader.msg_name);
+    if (lPeerSockAddr.any.sa_family == AF_INET6)
+    {
+        packetInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
+        packetInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (lPeerSockAddr.any.sa_family == AF_INET)
+    {
+        packetInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
+        packetInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            packetInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            packetInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 } // anonymous namespace
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
@@ -574,6 +661,17 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 
     // Prevent the endpoint from being freed while in the middle of a callback.
     UDPEndPointHandle ref(this);
+
+#if INET_CONFIG_UDP_SOCKET_RECVMMSG
+    ReceiveMessages();
+#else
+    ReceiveMessage();
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG
+}
+
+#if !INET_CONFIG_UDP_SOCKET_RECVMMSG
+void UDPEndPointImplSockets::ReceiveMessage()
+{
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
@@ -588,22 +686,10 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
     {
         struct iovec msgIOV;
         SockAddr lPeerSockAddr;
-        uint8_t controlData[256];
+        uint8_t controlData[kReceiveControlDataSize];
         struct msghdr msgHeader;
 
-        msgIOV.iov_base = lBuffer->Start();
-        msgIOV.iov_len  = lBuffer->AvailableDataLength();
-
-        memset(&lPeerSockAddr, 0, sizeof(lPeerSockAddr));
-
-        memset(&msgHeader, 0, sizeof(msgHeader));
-
-        msgHeader.msg_name       = &lPeerSockAddr;
-        msgHeader.msg_namelen    = sizeof(lPeerSockAddr);
-        msgHeader.msg_iov        = &msgIOV;
-        msgHeader.msg_iovlen     = 1;
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        PrepareReceiveHeader(*lBuffer, msgIOV, lPeerSockAddr, controlData, msgHeader);
 
         ssize_t rcvLen = recvmsg(mSocket, &msgHeader, MSG_DONTWAIT);
 
@@ -611,86 +697,85 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         {
             lStatus = CHIP_ERROR_POSIX(errno);
         }
-        else if (lBuffer->AvailableDataLength() < static_cast<size_t>(rcvLen))
-        {
-            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
-        }
         else
         {
-            lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
+            lStatus = DecodeReceivedMessage(msgHeader, static_cast<size_t>(rcvLen), *lBuffer, lPacketInfo);
         }
+    }
+    else
+    {
+        lStatus = CHIP_ERROR_NO_MEMORY;
+    }
 
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
+    DeliverReceivedMessage(lStatus, std::move(lBuffer), lPacketInfo);
+}
+#else  // INET_CONFIG_UDP_SOCKET_RECVMMSG
+void UDPEndPointImplSockets::ReceiveMessages()
+{
+    // Drain up to a batch of datagrams with a single system call.  Whatever is left in the socket keeps it readable, so
+    // the event loop comes back to it.
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE;
 
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+    System::PacketBufferHandle buffers[kBatchSize];
+    struct iovec msgIOVs[kBatchSize];
+    SockAddr peerSockAddrs[kBatchSize];
+    uint8_t controlData[kBatchSize][kReceiveControlDataSize];
+    struct mmsghdr msgHeaders[kBatchSize];
+
+    size_t count = 0;
+    for (; count < kBatchSize; count++)
+    {
+        buffers[count] = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        if (buffers[count].IsNull())
+        {
+            break;
         }
+        PrepareReceiveHeader(*buffers[count], msgIOVs[count], peerSockAddrs[count], controlData[count],
+                             msgHeaders[count].msg_hdr);
+        msgHeaders[count].msg_len = 0;
     }
-    else
+
+    IPPacketInfo lPacketInfo;
+    if (count == 0)
     {
-        lStatus = CHIP_ERROR_NO_MEMORY;
+        DeliverReceivedMessage(CHIP_ERROR_NO_MEMORY, System::PacketBufferHandle(), lPacketInfo);
+        return;
     }
 
-    if (lStatus == CHIP_NO_ERROR)
+    int received = recvmmsg(mSocket, msgHeaders, static_cast<unsigned int>(count), MSG_DONTWAIT, nullptr);
+    if (received == -1)
+    {
+        DeliverReceivedMessage(CHIP_ERROR_POSIX(errno), System::PacketBufferHandle(), lPacketInfo);
+        return;
+    }
+
+    // The receive callback may close the endpoint, in which case the remaining datagrams are dropped, as they would
+    // have been had they stayed in the socket.
+    for (size_t i = 0; i < static_cast<size_t>(received) && mState == State::kListening && OnMessageReceived != nullptr; i++)
+    {
+        lPacketInfo.Clear();
+        lPacketInfo.DestPort  = mBoundPort;
+        lPacketInfo.Interface = mBoundIntfId;
+
+        CHIP_ERROR lStatus = DecodeReceivedMessage(msgHeaders[i].msg_hdr, msgHeaders[i].msg_len, *buffers[i], lPacketInfo);
+        DeliverReceivedMessage(lStatus, std::move(buffers[i]), lPacketInfo);
+    }
+}
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG
+
+void UDPEndPointImplSockets::DeliverReceivedMessage(CHIP_ERROR status, System::PacketBufferHandle && buffer,
+                                                    const IPPacketInfo & packetInfo)
+{
+    if (status == CHIP_NO_ERROR)
     {
-        lBuffer.RightSize();
-        OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+        buffer.RightSize();
+        OnMessageReceived(this, std::move(buffer), &packetInfo);
     }
     else
     {
-        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        if (OnReceiveError != nullptr && status != CHIP_ERROR_POSIX(EAGAIN))
         {
-            OnReceiveError(this, lStatus, nullptr);
+            OnReceiveError(this, status, nullptr);
         }
     }
 }
@@ -56,6 +56,12 @@ private:
     CHIP_ERROR GetSocket(IPAddressType addressType);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
+#if INET_CONFIG_UDP_SOCKET_RECVMMSG
+    void ReceiveMessages();
+#else
+    void ReceiveMessage();
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG
+    void DeliverReceivedMessage(CHIP_ERROR status, System::PacketBufferHandle && buffer, const IPPacketInfo & packetInfo);
 
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
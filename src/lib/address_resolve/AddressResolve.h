@@ -247,6 +247,14 @@ public:
     /// a clear decision if the callback should or should not be invoked.
     virtual CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) = 0;
 
+    /// Inform the resolver that the address previously resolved for a node
+    /// could not be used (e.g. establishing a session with it failed).
+    ///
+    /// Implementations that keep resolved addresses around to answer later
+    /// lookups without going to DNSSD must drop the address of the node, so
+    /// that the next lookup resolves it again.
+    virtual void InvalidateCachedResult(const PeerId & peerId) {}
+
     /// Shut down any active resolves
     ///
     /// Will immediately fail any scheduled resolve calls and will refuse to register
@@ -32,9 +32,11 @@ static constexpr System::Clock::Timeout kInvalidTimeout{ System::Clock::Timeout:
 
 void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request)
 {
-    mRequestStartTime = now;
-    mRequest          = request;
-    mResults          = NodeLookupResults();
+    mRequestStartTime  = now;
+    mRequest           = request;
+    mResults           = NodeLookupResults();
+    mResultsExpiry     = System::Clock::Timestamp::max();
+    mAnsweredFromCache = false;
 }
 
 void NodeLookupHandle::LookupResult(const ResolveResult & result)
@@ -204,8 +206,50 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
 
     VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
-    auto & peerId = request.GetPeerId();
+    const System::Clock::Timestamp now = mTimeSource.GetMonotonicTimestamp();
+    auto & peerId                      = request.GetPeerId();
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    CachedResult * cached = FindCachedResult(peerId, now);
+    if (cached != nullptr)
+    {
+        mCacheStats.mHits++;
+
+        // The result is still delivered from the timer, as listeners expect to
+        // be called after LookupNode returns.
+        NodeLookupRequest cachedRequest(request);
+        cachedRequest.SetMinLookupTime(System::Clock::Milliseconds32(0));
+        handle.ResetForLookup(now, cachedRequest);
+        handle.LookupResult(cached->result);
+        handle.LookupResultsExpireAt(cached->expiry);
+        handle.MarkAnsweredFromCache();
+        mActiveLookups.PushBack(&handle);
+        ReArmTimer();
+        ChipLogProgress(Discovery, "Lookup answered from cache for " ChipLogFormatPeerId, ChipLogValuePeerId(peerId));
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+    handle.ResetForLookup(now, request);
+
+    NodeLookupHandle * resolving = FindResolvingLookup(peerId);
+    if (resolving != nullptr)
+    {
+        mCacheStats.mDeduplicated++;
+
+        // The lookup keeps its own min/max lookup times, but gets the results
+        // of the resolve already in progress.
+        handle.CopyResultsFrom(*resolving);
+        mActiveLookups.PushBack(&handle);
+        ReArmTimer();
+        ChipLogProgress(Discovery, "Lookup joined the one in progress for " ChipLogFormatPeerId, ChipLogValuePeerId(peerId));
+        return CHIP_NO_ERROR;
+    }
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    mCacheStats.mMisses++;
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
     ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
     mActiveLookups.PushBack(&handle);
     ReArmTimer();
@@ -232,7 +276,7 @@ CHIP_ERROR Resolver::CancelLookup(Impl::NodeLookupHandle & handle, FailureCallba
 {
     VerifyOrReturnError(handle.IsActive(), CHIP_ERROR_INVALID_ARGUMENT);
     mActiveLookups.Remove(&handle);
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    ReleaseResolve(handle.GetRequest().GetPeerId());
 
     // Adjust any timing updates.
     ReArmTimer();
@@ -254,6 +298,58 @@ CHIP_ERROR Resolver::CancelLookup(Impl::NodeLookupHandle & handle, FailureCallba
     return CHIP_NO_ERROR;
 }
 
+void Resolver::InvalidateCachedResult(const PeerId & peerId)
+{
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    for (auto & entry : mCache)
+    {
+        if (entry.peerId == peerId)
+        {
+            entry.expiry = System::Clock::kZero;
+        }
+    }
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+}
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+Resolver::CachedResult * Resolver::FindCachedResult(const PeerId & peerId, System::Clock::Timestamp now)
+{
+    for (auto & entry : mCache)
+    {
+        if ((entry.expiry > now) && (entry.peerId == peerId))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void Resolver::CacheResult(const PeerId & peerId, const ResolveResult & result, System::Clock::Timestamp expiry)
+{
+    VerifyOrReturn(expiry > mTimeSource.GetMonotonicTimestamp());
+
+    // Use the entry for the same node if there is one, otherwise replace the
+    // one expiring first (expired entries first of all).
+    CachedResult * target = &mCache[0];
+    for (auto & entry : mCache)
+    {
+        if (entry.peerId == peerId)
+        {
+            target = &entry;
+            break;
+        }
+        if (entry.expiry < target->expiry)
+        {
+            target = &entry;
+        }
+    }
+
+    target->peerId = peerId;
+    target->result = result;
+    target->expiry = expiry;
+}
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
 CHIP_ERROR Resolver::Init(System::Layer * systemLayer)
 {
     mSystemLayer = systemLayer;
@@ -278,7 +374,7 @@ void Resolver::Shutdown()
 
         MATTER_LOG_NODE_DISCOVERY_FAILED(&peerId, CHIP_ERROR_SHUT_DOWN);
 
-        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+        ReleaseResolve(peerId);
         // Failure callback only called after iterator was cleared:
         // This allows failure handlers to deallocate structures that may
         // contain the active lookup data as a member (intrusive lists members)
@@ -289,12 +385,27 @@ void Resolver::Shutdown()
     // internal list of active lookups is empty at this point.
     ReArmTimer();
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    for (auto & entry : mCache)
+    {
+        entry = CachedResult();
+    }
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
     mSystemLayer = nullptr;
     Dnssd::Resolver::Instance().SetOperationalDelegate(nullptr);
 }
 
 void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData)
 {
+    const System::Clock::Seconds32 ttl = nodeData.operationalData.ttl.value_or(kDefaultResultTtl);
+    if (ttl == System::Clock::kZero)
+    {
+        // The node withdrew the records.
+        InvalidateCachedResult(nodeData.operationalData.peerId);
+    }
+    const System::Clock::Timestamp expiry = mTimeSource.GetMonotonicTimestamp() + ttl;
+
     auto it = mActiveLookups.begin();
     while (it != mActiveLookups.end())
     {
@@ -330,6 +441,7 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
             result.address.SetIPAddress(nodeData.resolutionData.ipAddress[i]);
             current->LookupResult(result);
         }
+        current->LookupResultsExpireAt(expiry);
 
         HandleAction(current);
     }
@@ -337,6 +449,24 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
     ReArmTimer();
 }
 
+NodeLookupHandle * Resolver::FindResolvingLookup(const PeerId & peerId)
+{
+    for (auto & activeLookup : mActiveLookups)
+    {
+        if (activeLookup.IsResolving() && activeLookup.GetRequest().GetPeerId() == peerId)
+        {
+            return &activeLookup;
+        }
+    }
+    return nullptr;
+}
+
+void Resolver::ReleaseResolve(const PeerId & peerId)
+{
+    VerifyOrReturn(FindResolvingLookup(peerId) == nullptr);
+    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+}
+
 void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
 {
     const NodeLookupAction action = current->NextAction(mTimeSource.GetMonotonicTimestamp());
@@ -348,11 +478,12 @@ void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
     }
 
     // final result, handle either success or failure
-    const PeerId peerId     = current->GetRequest().GetPeerId();
-    NodeListener * listener = current->GetListener();
+    const PeerId peerId                              = current->GetRequest().GetPeerId();
+    NodeListener * listener                          = current->GetListener();
+    [[maybe_unused]] System::Clock::Timestamp expiry = current->GetResultsExpiry();
     mActiveLookups.Erase(current);
 
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    ReleaseResolve(peerId);
 
     // ensure action is taken AFTER the current current lookup is marked complete
     // This allows failure handlers to deallocate structures that may
@@ -364,6 +495,9 @@ void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
         listener->OnNodeAddressResolutionFailed(peerId, action.ErrorResult());
         break;
     case NodeLookupResult::kLookupSuccess:
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+        CacheResult(peerId, action.ResolveResult(), expiry);
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
         MATTER_LOG_NODE_DISCOVERED(Tracing::DiscoveryInfoType::kResolutionDone, &peerId, &action.ResolveResult());
         listener->OnNodeAddressResolved(peerId, action.ResolveResult());
         break;
@@ -402,7 +536,7 @@ void Resolver::OnOperationalNodeResolutionFailed(const PeerId & peerId, CHIP_ERR
         NodeListener * listener = current->GetListener();
         mActiveLookups.Erase(current);
 
-        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+        ReleaseResolve(peerId);
 
         // Failure callback only called after iterator was cleared:
         // This allows failure handlers to deallocate structures that may
@@ -450,7 +584,7 @@ void Resolver::ReArmTimer()
             mActiveLookups.Erase(it);
             it = mActiveLookups.begin();
 
-            Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+            ReleaseResolve(peerId);
             // Callback only called after active lookup is cleared
             // This allows failure handlers to deallocate structures that may
             // contain the active lookup data as a member (intrusive lists members)
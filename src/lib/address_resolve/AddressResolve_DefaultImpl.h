@@ -22,12 +22,18 @@
 #include <system/TimeSource.h>
 #include <transport/raw/PeerAddress.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace AddressResolve {
 namespace Impl {
 
 inline constexpr uint8_t kNodeLookupResultsLen = CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS;
 
+/// How long results are cached for when the DNSSD backend does not report
+/// record TTLs: the TTL Matter nodes advertise their SRV and AAAA records with.
+inline constexpr System::Clock::Seconds32 kDefaultResultTtl = System::Clock::Seconds32(120);
+
 enum class NodeLookupResult
 {
     kKeepSearching, // keep the current search active
@@ -136,6 +142,27 @@ public:
     /// Mark that a specific IP address has been found
     void LookupResult(const ResolveResult & result);
 
+    /// Mark that some of the results found so far are only valid until `expiry`.
+    void LookupResultsExpireAt(System::Clock::Timestamp expiry) { mResultsExpiry = std::min(mResultsExpiry, expiry); }
+
+    /// When the first of the results found so far stops being valid.
+    System::Clock::Timestamp GetResultsExpiry() const { return mResultsExpiry; }
+
+    /// Mark that the lookup is answered from the resolver cache rather than
+    /// by a DNSSD resolve.
+    void MarkAnsweredFromCache() { mAnsweredFromCache = true; }
+
+    /// Whether a DNSSD resolve is in progress on behalf of this lookup.
+    bool IsResolving() const { return !mAnsweredFromCache; }
+
+    /// Start from the results that `other`, a lookup of the same node, found so
+    /// far, when joining its DNSSD resolve.
+    void CopyResultsFrom(const NodeLookupHandle & other)
+    {
+        mResults       = other.mResults;
+        mResultsExpiry = other.mResultsExpiry;
+    }
+
     /// Called after timeouts or after a series of IP addresses have been
     /// marked as found.
     ///
@@ -161,11 +188,30 @@ private:
     NodeLookupResults mResults;
     NodeLookupRequest mRequest; // active request to process
     System::Clock::Timestamp mRequestStartTime;
+    System::Clock::Timestamp mResultsExpiry = System::Clock::Timestamp::max();
+    bool mAnsweredFromCache                 = false;
 };
 
+/// Default address resolver, looking nodes up through Dnssd::Resolver.
+///
+/// The address found by a successful lookup is kept (see
+/// CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE) until the first of the DNSSD records
+/// it was resolved from expires, and later lookups of the same node are
+/// answered with it without a new DNSSD resolve.  Callers that cannot use such
+/// an address must call InvalidateCachedResult.
+///
+/// Concurrent lookups of the same node share a single DNSSD resolve, which is
+/// only stopped once the last of them is done.
 class Resolver : public ::chip::AddressResolve::Resolver, public Dnssd::OperationalResolveDelegate
 {
 public:
+    struct CacheStats
+    {
+        uint32_t mHits         = 0; ///< Lookups answered with a cached result
+        uint32_t mMisses       = 0; ///< Lookups that needed a DNSSD resolve
+        uint32_t mDeduplicated = 0; ///< Lookups that joined the DNSSD resolve of another lookup of the same node
+    };
+
     ~Resolver() override = default;
 
     // AddressResolve::Resolver
@@ -174,6 +220,7 @@ public:
     CHIP_ERROR LookupNode(const NodeLookupRequest & request, Impl::NodeLookupHandle & handle) override;
     CHIP_ERROR TryNextResult(Impl::NodeLookupHandle & handle) override;
     CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) override;
+    void InvalidateCachedResult(const PeerId & peerId) override;
     void Shutdown() override;
 
     // Dnssd::OperationalResolveDelegate
@@ -181,7 +228,32 @@ public:
     void OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData) override;
     void OnOperationalNodeResolutionFailed(const PeerId & peerId, CHIP_ERROR error) override;
 
+    const CacheStats & GetCacheStats() const { return mCacheStats; }
+    void ResetCacheStats() { mCacheStats = CacheStats(); }
+
 private:
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    struct CachedResult
+    {
+        PeerId peerId;
+        ResolveResult result;
+        System::Clock::Timestamp expiry = System::Clock::kZero; // not valid from then on
+    };
+
+    /// The valid cached result for the node, or nullptr if there is none.
+    CachedResult * FindCachedResult(const PeerId & peerId, System::Clock::Timestamp now);
+    void CacheResult(const PeerId & peerId, const ResolveResult & result, System::Clock::Timestamp expiry);
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+    /// An active lookup of the node that a DNSSD resolve is in progress for, or
+    /// nullptr if there is none.
+    NodeLookupHandle * FindResolvingLookup(const PeerId & peerId);
+
+    /// Stop the DNSSD resolve of the node unless another active lookup still
+    /// needs it.  Called after a lookup of the node was removed from
+    /// mActiveLookups.
+    void ReleaseResolve(const PeerId & peerId);
+
     static void OnResolveTimer(System::Layer * layer, void * context) { static_cast<Resolver *>(context)->HandleTimer(); }
 
     /// Timer on lookup node events: min and max search times.
@@ -203,6 +275,10 @@ private:
     System::Layer * mSystemLayer = nullptr;
     Time::TimeSource<Time::Source::kSystem> mTimeSource;
     IntrusiveList<NodeLookupHandle> mActiveLookups;
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    CachedResult mCache[CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE];
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    CacheStats mCacheStats;
 };
 
 } // namespace Impl
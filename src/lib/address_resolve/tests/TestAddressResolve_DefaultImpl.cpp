@@ -529,8 +529,12 @@ public:
     bool IsInitialized() override { return true; }
     void Shutdown() override {}
     void SetOperationalDelegate(OperationalResolveDelegate * delegate) override {}
-    CHIP_ERROR ResolveNodeId(const PeerId & peerId) override { return ResolveNodeIdStatus; }
-    void NodeIdResolutionNoLongerNeeded(const PeerId & peerId) override {}
+    CHIP_ERROR ResolveNodeId(const PeerId & peerId) override
+    {
+        ResolveNodeIdCalls++;
+        return ResolveNodeIdStatus;
+    }
+    void NodeIdResolutionNoLongerNeeded(const PeerId & peerId) override { NoLongerNeededCalls++; }
     CHIP_ERROR StartDiscovery(DiscoveryType type, DiscoveryFilter filter, DiscoveryContext &) override
     {
         if (DiscoveryType::kCommissionerNode == type)
@@ -546,6 +550,8 @@ public:
     CHIP_ERROR InitStatus                  = CHIP_NO_ERROR;
     CHIP_ERROR ResolveNodeIdStatus         = CHIP_NO_ERROR;
     CHIP_ERROR DiscoverCommissionersStatus = CHIP_NO_ERROR;
+    unsigned ResolveNodeIdCalls            = 0;
+    unsigned NoLongerNeededCalls           = 0;
 };
 
 class TestAddressResolveDefaultImplWithSystemLayer : public ::testing::Test
@@ -865,4 +871,175 @@ TEST_F(TestAddressResolveDefaultImplWithSystemLayerAndNodeListener, ResolverShut
     EXPECT_EQ(expectedError, CHIP_ERROR_SHUT_DOWN);
 }
 
+Dnssd::ResolvedNodeData MakeResolvedNodeData(const chip::PeerId & peerId, const Transport::PeerAddress & address)
+{
+    Dnssd::ResolvedNodeData resolvedData;
+    resolvedData.resolutionData.numIPs       = 1;
+    resolvedData.resolutionData.ipAddress[0] = address.GetIPAddress();
+    resolvedData.resolutionData.interfaceId  = address.GetInterface();
+    resolvedData.resolutionData.port         = address.GetPort();
+    resolvedData.operationalData.peerId      = peerId;
+    return resolvedData;
+}
+
+TEST_F(TestAddressResolveDefaultImplWithSystemLayerAndNodeListener, AnswersLookupsFromCacheUntilTtlExpires)
+{
+    chip::Dnssd::Resolver::SetInstance(mockResolver);
+
+    chip::AddressResolve::Impl::Resolver resolver;
+    ASSERT_EQ(resolver.Init(&mSystemLayer), CHIP_NO_ERROR);
+
+    System::Clock::Internal::RAIIMockClock clock;
+
+    System::TimerCompleteCallback timerCallback = nullptr;
+    void * timerContext                         = nullptr;
+    mSystemLayer.mStartTimerCallback = [&timerCallback, &timerContext](auto, System::TimerCompleteCallback complete,
+                                                                       void * context) {
+        timerCallback = complete;
+        timerContext  = context;
+        return CHIP_NO_ERROR;
+    };
+
+    unsigned resolvedCount = 0;
+    chip::AddressResolve::ResolveResult lastResult;
+    mNodeListener.SetOnNodeAddressResolved(
+        [&resolvedCount, &lastResult](const chip::PeerId & peerId, const chip::AddressResolve::ResolveResult & result) {
+            resolvedCount++;
+            lastResult = result;
+        });
+
+    auto request = NodeLookupRequest(chip::PeerId(1, 2));
+    request.SetMinLookupTime(0_ms32);
+    request.SetMaxLookupTime(200_ms32);
+
+    AddressResolve::NodeLookupHandle firstHandle;
+    firstHandle.SetListener(&mNodeListener);
+    EXPECT_SUCCESS(resolver.LookupNode(request, firstHandle));
+
+    auto resolvedData                = MakeResolvedNodeData(request.GetPeerId(), GetAddressWithLowScore());
+    resolvedData.operationalData.ttl = System::Clock::Seconds32(60);
+    resolver.OnOperationalNodeResolved(resolvedData);
+
+    EXPECT_EQ(resolvedCount, 1u);
+    EXPECT_EQ(mockResolver.ResolveNodeIdCalls, 1u);
+    EXPECT_EQ(resolver.GetCacheStats().mMisses, 1u);
+
+    // Within the TTL, the node is not resolved again, and the result is delivered from the timer.
+    clock.AdvanceMonotonic(30000_ms64);
+    timerCallback = nullptr;
+
+    AddressResolve::NodeLookupHandle secondHandle;
+    secondHandle.SetListener(&mNodeListener);
+    EXPECT_SUCCESS(resolver.LookupNode(request, secondHandle));
+    EXPECT_EQ(resolvedCount, 1u);
+
+    ASSERT_NE(timerCallback, nullptr);
+    timerCallback(&mSystemLayer, timerContext);
+    EXPECT_EQ(resolvedCount, 2u);
+    EXPECT_EQ(lastResult.address, GetAddressWithLowScore());
+    EXPECT_EQ(mockResolver.ResolveNodeIdCalls, 1u);
+    EXPECT_EQ(resolver.GetCacheStats().mHits, 1u);
+
+    // Once the TTL is over, it is.
+    clock.AdvanceMonotonic(30000_ms64);
+
+    AddressResolve::NodeLookupHandle thirdHandle;
+    thirdHandle.SetListener(&mNodeListener);
+    EXPECT_SUCCESS(resolver.LookupNode(request, thirdHandle));
+    EXPECT_EQ(mockResolver.ResolveNodeIdCalls, 2u);
+    EXPECT_EQ(resolver.GetCacheStats().mHits, 1u);
+    EXPECT_EQ(resolver.GetCacheStats().mMisses, 2u);
+
+    EXPECT_SUCCESS(resolver.CancelLookup(thirdHandle, Resolver::FailureCallback::Skip));
+}
+
+TEST_F(TestAddressResolveDefaultImplWithSystemLayerAndNodeListener, InvalidatedResultIsResolvedAgain)
+{
+    chip::Dnssd::Resolver::SetInstance(mockResolver);
+
+    chip::AddressResolve::Impl::Resolver resolver;
+    ASSERT_EQ(resolver.Init(&mSystemLayer), CHIP_NO_ERROR);
+
+    System::Clock::Internal::RAIIMockClock clock;
+
+    auto request = NodeLookupRequest(chip::PeerId(1, 2));
+    request.SetMinLookupTime(0_ms32);
+
+    AddressResolve::NodeLookupHandle handle;
+    handle.SetListener(&mNodeListener);
+    EXPECT_SUCCESS(resolver.LookupNode(request, handle));
+    resolver.OnOperationalNodeResolved(MakeResolvedNodeData(request.GetPeerId(), GetAddressWithLowScore()));
+    EXPECT_FALSE(handle.IsActive());
+
+    // e.g. establishing a session at the resolved address failed
+    resolver.InvalidateCachedResult(request.GetPeerId());
+
+    AddressResolve::NodeLookupHandle retryHandle;
+    retryHandle.SetListener(&mNodeListener);
+    EXPECT_SUCCESS(resolver.LookupNode(request, retryHandle));
+    EXPECT_EQ(mockResolver.ResolveNodeIdCalls, 2u);
+    EXPECT_EQ(resolver.GetCacheStats().mHits, 0u);
+
+    // A node removing its records also drops the cached result.
+    resolver.OnOperationalNodeResolved(MakeResolvedNodeData(request.GetPeerId(), GetAddressWithLowScore()));
+
+    auto goodbyeData                = MakeResolvedNodeData(request.GetPeerId(), GetAddressWithLowScore());
+    goodbyeData.operationalData.ttl = System::Clock::Seconds32(0);
+    resolver.OnOperationalNodeResolved(goodbyeData);
+
+    AddressResolve::NodeLookupHandle lastHandle;
+    lastHandle.SetListener(&mNodeListener);
+    EXPECT_SUCCESS(resolver.LookupNode(request, lastHandle));
+    EXPECT_EQ(mockResolver.ResolveNodeIdCalls, 3u);
+    EXPECT_EQ(resolver.GetCacheStats().mHits, 0u);
+
+    EXPECT_SUCCESS(resolver.CancelLookup(lastHandle, Resolver::FailureCallback::Skip));
+}
+
+TEST_F(TestAddressResolveDefaultImplWithSystemLayerAndNodeListener, ConcurrentLookupsShareOneResolve)
+{
+    chip::Dnssd::Resolver::SetInstance(mockResolver);
+
+    chip::AddressResolve::Impl::Resolver resolver;
+    ASSERT_EQ(resolver.Init(&mSystemLayer), CHIP_NO_ERROR);
+
+    System::Clock::Internal::RAIIMockClock clock;
+
+    unsigned resolvedCount = 0;
+    mNodeListener.SetOnNodeAddressResolved(
+        [&resolvedCount](const chip::PeerId & peerId, const chip::AddressResolve::ResolveResult & result) {
+            EXPECT_EQ(result.address, GetAddressWithLowScore());
+            resolvedCount++;
+        });
+
+    auto request = NodeLookupRequest(chip::PeerId(1, 2));
+    request.SetMinLookupTime(0_ms32);
+    request.SetMaxLookupTime(200_ms32);
+
+    AddressResolve::NodeLookupHandle firstHandle;
+    firstHandle.SetListener(&mNodeListener);
+    EXPECT_SUCCESS(resolver.LookupNode(request, firstHandle));
+
+    AddressResolve::NodeLookupHandle secondHandle;
+    secondHandle.SetListener(&mNodeListener);
+    EXPECT_SUCCESS(resolver.LookupNode(request, secondHandle));
+
+    AddressResolve::NodeLookupHandle cancelledHandle;
+    cancelledHandle.SetListener(&mNodeListener);
+    EXPECT_SUCCESS(resolver.LookupNode(request, cancelledHandle));
+
+    EXPECT_EQ(mockResolver.ResolveNodeIdCalls, 1u);
+    EXPECT_EQ(resolver.GetCacheStats().mDeduplicated, 2u);
+
+    // Cancelling one of the lookups does not stop the resolve the others still need.
+    EXPECT_SUCCESS(resolver.CancelLookup(cancelledHandle, Resolver::FailureCallback::Skip));
+    EXPECT_EQ(mockResolver.NoLongerNeededCalls, 0u);
+
+    resolver.OnOperationalNodeResolved(MakeResolvedNodeData(request.GetPeerId(), GetAddressWithLowScore()));
+    EXPECT_EQ(resolvedCount, 2u);
+    EXPECT_FALSE(firstHandle.IsActive());
+    EXPECT_FALSE(secondHandle.IsActive());
+    EXPECT_EQ(mockResolver.NoLongerNeededCalls, 1u);
+}
+
 } // namespace
@@ -163,6 +163,22 @@
 #define CHIP_CONFIG_MEMORY_DEBUG_DMALLOC 0
 #endif // CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
 
+/**
+ *  @def CHIP_CONFIG_MEMORY_TAGGING
+ *
+ *  @brief
+ *    Enable (1) or disable (0) attributing chip::Platform heap usage to
+ *    subsystems (see lib/support/MemoryTags.h). When enabled, every
+ *    allocation carries a small header recording its size and tag, and
+ *    per-tag current and peak usage can be queried at runtime.
+ *
+ *  @note This is only supported with #CHIP_CONFIG_MEMORY_MGMT_MALLOC.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_TAGGING
+#define CHIP_CONFIG_MEMORY_TAGGING 0
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+
 /**
  *  @def CHIP_CONFIG_GLOBALS_LAZY_INIT
  *
@@ -231,6 +247,20 @@
 #define CHIP_CONFIG_HKDF_KEY_HANDLE_CONTEXT_SIZE (32 + 1)
 #endif // CHIP_CONFIG_HKDF_KEY_HANDLE_CONTEXT_SIZE
 
+/**
+ *  @def CHIP_CONFIG_RAW_KEYSTORE_AES_CCM_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of AES-CCM key schedules kept by RawKeySessionKeystore.
+ *
+ *  Each secure session uses one key per direction. Messages encrypted or decrypted with a cached key skip the key
+ *  expansion; when the cache is full, the least recently used key schedule is dropped. Setting this to 0 disables
+ *  the cache. It has no effect with crypto backends that do not provide Crypto::AesCcmContext.
+ */
+#ifndef CHIP_CONFIG_RAW_KEYSTORE_AES_CCM_CACHE_SIZE
+#define CHIP_CONFIG_RAW_KEYSTORE_AES_CCM_CACHE_SIZE 8
+#endif // CHIP_CONFIG_RAW_KEYSTORE_AES_CCM_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_CRYPTO_PSA_KEY_ID_BASE
  *
@@ -483,6 +513,50 @@
 #define CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE 256
 #endif
 
+/**
+ *  @def CHIP_CONFIG_DEFERRED_LOGGING
+ *
+ *  @brief
+ *    If asserted (1), log messages are not formatted when logged: their format string and
+ *    arguments are stored in a ring of CHIP_CONFIG_DEFERRED_LOG_RECORDS records, and only
+ *    formatted when chip::Logging::FlushDeferredLogs() is called.  See DeferredLogging.h.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOGGING
+#define CHIP_CONFIG_DEFERRED_LOGGING 0
+#endif // CHIP_CONFIG_DEFERRED_LOGGING
+
+/**
+ *  @def CHIP_CONFIG_DEFERRED_LOG_RECORDS
+ *
+ *  @brief
+ *    Number of log messages kept by deferred logging; older messages are dropped.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOG_RECORDS
+#define CHIP_CONFIG_DEFERRED_LOG_RECORDS 32
+#endif // CHIP_CONFIG_DEFERRED_LOG_RECORDS
+
+/**
+ *  @def CHIP_CONFIG_DEFERRED_LOG_MAX_ARGS
+ *
+ *  @brief
+ *    Maximum number of arguments (including '*' widths and precisions) of a deferred log
+ *    message.  Messages with more arguments are formatted when logged.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOG_MAX_ARGS
+#define CHIP_CONFIG_DEFERRED_LOG_MAX_ARGS 8
+#endif // CHIP_CONFIG_DEFERRED_LOG_MAX_ARGS
+
+/**
+ *  @def CHIP_CONFIG_DEFERRED_LOG_STRING_BYTES
+ *
+ *  @brief
+ *    Space in each deferred log record for copies of its string (%s) arguments, including
+ *    their terminators.  Longer strings are truncated.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOG_STRING_BYTES
+#define CHIP_CONFIG_DEFERRED_LOG_STRING_BYTES 48
+#endif // CHIP_CONFIG_DEFERRED_LOG_STRING_BYTES
+
 /**
  *  @def CHIP_CONFIG_ENABLE_CONDITION_LOGGING
  *
@@ -811,7 +885,7 @@
  *
  * This is sized by default to cover the sum of the following:
  *  - At least 3 CASE sessions / fabric (Spec Ref: 4.13.2.8)
- *  - 1 reserved slot for CASEServer as a responder.
+ *  - 1 reserved slot per concurrent CASEServer handshake as a responder.
  *  - 1 reserved slot for PASE.
  *
  *  NOTE: On heap-based platforms, there is no pre-allocation of the pool.
@@ -821,9 +895,21 @@
  *
  */
 #ifndef CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
-#define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
+#define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES + 1)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ *  @def CHIP_CONFIG_OBJECT_POOL_REGISTRY
+ *
+ *  @brief
+ *    Whether the usage (objects in use, high water mark and failed allocations) of the SDK's main object
+ *    pools, such as exchanges, secure sessions and read handlers, can be enumerated through
+ *    chip::ObjectPoolRegistry, to help size them.  Costs a few words of RAM per registered pool.
+ */
+#ifndef CHIP_CONFIG_OBJECT_POOL_REGISTRY
+#define CHIP_CONFIG_OBJECT_POOL_REGISTRY 1
+#endif // CHIP_CONFIG_OBJECT_POOL_REGISTRY
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -846,6 +932,19 @@
 #define CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS 2
 #endif // CHIP_CONFIG_MAX_GROUP_CONTROL_PEER
 
+/**
+ *  @def CHIP_CONFIG_GROUP_PEER_TABLE_EVICT_LRU
+ *
+ *  @brief
+ *   Whether a group message from a new peer evicts the least recently heard peer of the same fabric
+ *   once CHIP_CONFIG_MAX_GROUP_DATA_PEERS or CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS is reached, rather
+ *   than being dropped.  The message counter of an evicted peer is forgotten, so its next message is
+ *   trusted again (or resynchronized for control messages).
+ */
+#ifndef CHIP_CONFIG_GROUP_PEER_TABLE_EVICT_LRU
+#define CHIP_CONFIG_GROUP_PEER_TABLE_EVICT_LRU 0
+#endif // CHIP_CONFIG_GROUP_PEER_TABLE_EVICT_LRU
+
 /**
  *  @def CHIP_CONFIG_SLOW_CRYPTO
  *
@@ -857,6 +956,53 @@
 #define CHIP_CONFIG_SLOW_CRYPTO 1
 #endif // CHIP_CONFIG_SLOW_CRYPTO
 
+/**
+ *  @def CHIP_CONFIG_CASE_MAX_CONCURRENT_BACKGROUND_WORK
+ *
+ *  @brief
+ *   Maximum number of CASE sessions whose Sigma crypto (certificate chain validation, signing and signature
+ *   verification) may be queued to or running on the background worker at the same time.  Work of further
+ *   sessions waits until one of them is done, so that a burst of session establishments cannot fill the
+ *   background work queue.  0 means no limit.
+ */
+#ifndef CHIP_CONFIG_CASE_MAX_CONCURRENT_BACKGROUND_WORK
+#define CHIP_CONFIG_CASE_MAX_CONCURRENT_BACKGROUND_WORK 0
+#endif // CHIP_CONFIG_CASE_MAX_CONCURRENT_BACKGROUND_WORK
+
+/**
+ *  @def CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE
+ *
+ *  @brief
+ *   Number of intermediate CA certificate signatures that the fabric table remembers as verified, so that CASE
+ *   sessions with peers whose NOCs share an ICAC skip verifying its signature again.  0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE 4
+#endif // CHIP_CONFIG_VERIFIED_CERTIFICATE_CACHE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+ *
+ *  @brief
+ *   Number of CASE handshakes that the CASE server can respond to at the same time.  Each of them keeps a
+ *   responder CASESession and a reserved secure session.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+#define CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES 1
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+
+/**
+ *  @def CHIP_CONFIG_CASE_SERVER_ADMISSION_QUEUE_SIZE
+ *
+ *  @brief
+ *   Number of Sigma1 messages that the CASE server holds while all of its handshakes are in use, instead of
+ *   answering Busy right away.  Session resumption requests are taken from the queue before full handshakes.
+ *   0 means every Sigma1 arriving while the server is busy is answered Busy.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_ADMISSION_QUEUE_SIZE
+#define CHIP_CONFIG_CASE_SERVER_ADMISSION_QUEUE_SIZE 0
+#endif // CHIP_CONFIG_CASE_SERVER_ADMISSION_QUEUE_SIZE
+
 /**
  * @def CHIP_NON_PRODUCTION_MARKER
  *
@@ -986,6 +1132,173 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_CONFIG_IM_INDEXED_DIRTY_SET
+ *
+ * @brief If enabled, the reporting engine keeps its global dirty set in a hash index keyed by (endpoint, cluster) instead of a
+ * plain object pool, so marking paths dirty and matching them against read handlers does not scan the whole set. Useful for
+ * devices (e.g. bridges) that raise CHIP_IM_SERVER_MAX_NUM_DIRTY_SET well above the default.
+ */
+#ifndef CHIP_CONFIG_IM_INDEXED_DIRTY_SET
+#define CHIP_CONFIG_IM_INDEXED_DIRTY_SET 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_REPORT_ENCODE_CACHE_SIZE
+ *
+ * @brief Size in bytes of the buffer in which the reporting engine keeps the attribute data it encodes while generating reports,
+ * so that other read handlers with the same accessing fabric and fabric filtering that report the same attribute data version in
+ * the same run copy it instead of reading and encoding it again. The buffer is only allocated for runs with more than one read
+ * handler. Useful for devices (e.g. bridges) where several controllers subscribe to the same attributes. 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_ENCODE_CACHE_SIZE
+#define CHIP_CONFIG_IM_REPORT_ENCODE_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE
+ *
+ * @brief Size in bytes of the buffer in which the reporting engine keeps, across reports, the encoding of attributes that rarely
+ * change: the Descriptor lists, the fixed Basic Information attributes and the global AttributeList, AcceptedCommandList and
+ * GeneratedCommandList. Entries are keyed by data version and dropped when one of these attributes is marked dirty. Speeds up
+ * the wildcard reads made by controllers at commissioning and on reconnection. 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE
+#define CHIP_CONFIG_IM_STATIC_ATTRIBUTE_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_GLOBAL_ATTRIBUTE_LIST_CACHE_SIZE
+ *
+ * @brief Size in bytes (at most 65535) of the buffer in which the reporting engine keeps the AttributeList, AcceptedCommandList
+ * and GeneratedCommandList of the clusters it reports, so that they are not rebuilt from the data model metadata on every read.
+ * Identical lists, e.g. of the same cluster on the endpoints of a bridge, are stored once.  The cache is dropped when one of its
+ * lists is marked dirty.  0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_IM_GLOBAL_ATTRIBUTE_LIST_CACHE_SIZE
+#define CHIP_CONFIG_IM_GLOBAL_ATTRIBUTE_LIST_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_READ_HANDLER_ACCESS_CACHE_SIZE
+ *
+ * @brief Number of clusters for which each read handler remembers the cluster-wide ACL results of its subject, which cannot
+ * change during the interaction, across reports. The results are dropped whenever the ACL or the access restrictions change.
+ * Steady-state subscription reports then do not evaluate the ACL again for the clusters they keep reporting. 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_IM_READ_HANDLER_ACCESS_CACHE_SIZE
+#define CHIP_CONFIG_IM_READ_HANDLER_ACCESS_CACHE_SIZE 4
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES
+ *
+ * @brief Number of attributes for which clusters can set, with Engine::SetReportThrottleInterval, a minimum interval between
+ * reported changes (quieter reporting). Changes made during the interval are held back by Engine::SetDirty and the last one is
+ * reported when it ends. Useful for attributes that change on every step of a transition (CurrentLevel, CurrentHue, CurrentX,
+ * ...). 0 disables report throttling.
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES
+#define CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_REPORT_THROTTLE_PATHS
+ *
+ * @brief Number of concrete attribute paths whose throttling window the reporting engine tracks at a time when
+ * CHIP_CONFIG_IM_REPORT_THROTTLE_POLICIES is non-zero. Changes to further paths are reported without throttling.
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_THROTTLE_PATHS
+#define CHIP_CONFIG_IM_REPORT_THROTTLE_PATHS 16
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX
+ *
+ * @brief If enabled, the interaction model engine maintains an index from (endpoint, cluster) to the read handlers interested in
+ * it, so that marking an attribute dirty only visits the handlers whose attribute paths may intersect it instead of every active
+ * read handler. Costs one index entry per attribute path pool entry.
+ */
+#ifndef CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX
+#define CHIP_CONFIG_IM_READ_HANDLER_INTEREST_INDEX 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_READ_HANDLER_ARENA
+ *
+ * @brief If enabled, each read handler allocates the attribute paths and data version filters of its request from an arena it
+ * owns (see app/InteractionArena.h) instead of the interaction model engine's pools, and frees them all at once when it closes.
+ * With heap-backed pools (CHIP_SYSTEM_CONFIG_POOL_USE_HEAP) this replaces one heap allocation per path with one allocation per
+ * handler, reducing heap fragmentation. Event paths stay in the engine's pool, which the reporting engine checks to skip event
+ * processing when nobody subscribed to events.
+ */
+#ifndef CHIP_CONFIG_IM_READ_HANDLER_ARENA
+#define CHIP_CONFIG_IM_READ_HANDLER_ARENA 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_INTERACTION_ARENA_INLINE_SIZE
+ *
+ * @brief Size in bytes of the space an InteractionArena keeps inline, before it allocates blocks from the heap.
+ */
+#ifndef CHIP_CONFIG_IM_INTERACTION_ARENA_INLINE_SIZE
+#define CHIP_CONFIG_IM_INTERACTION_ARENA_INLINE_SIZE 192
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_INTERACTION_ARENA_BLOCK_SIZE
+ *
+ * @brief Size in bytes of the heap blocks an InteractionArena allocates once its inline space is used up.
+ */
+#ifndef CHIP_CONFIG_IM_INTERACTION_ARENA_BLOCK_SIZE
+#define CHIP_CONFIG_IM_INTERACTION_ARENA_BLOCK_SIZE 512
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+ *
+ * @brief If enabled, the attribute paths of a subscription are sorted and compacted when it is established: exact duplicates
+ * are dropped, and concrete paths naming every attribute of a cluster (all readable by the subscriber at that time) are merged
+ * into one wildcard path for the cluster. This frees path pool entries for controllers that subscribe to many concrete paths,
+ * and lets dirty path matching skip the paths on other endpoints. Reports are ordered by path rather than by request order,
+ * and later ACL changes or attribute additions on a merged cluster are handled like for a wildcard path.
+ */
+#ifndef CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION
+#define CHIP_CONFIG_IM_SUBSCRIPTION_PATH_COMPACTION 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE
+ *
+ * @brief If enabled, ClusterStateCache keeps its endpoint, cluster and attribute state in sorted vectors rather than nested
+ * std::map trees. This removes a heap node per entry and makes lookups cache friendly, which matters for controllers that cache
+ * many nodes. Inserting a new endpoint, cluster or attribute moves the entries after it.
+ */
+#ifndef CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE
+#define CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA
+ *
+ * @brief If enabled, ClusterStateCache stores cached attribute TLV in a per-cache arena of a few large blocks instead of one heap
+ * allocation per attribute. Space freed by updated or cleared attributes is reclaimed by moving all live values into a single
+ * block when a report begins, once more than half of the arena is dead.
+ */
+#ifndef CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA
+#define CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA_BLOCK_SIZE
+ *
+ * @brief Size in bytes of the blocks CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA allocates. Values bigger than half a block get a
+ * block of their own.
+ */
+#ifndef CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA_BLOCK_SIZE
+#define CHIP_CONFIG_CLUSTER_STATE_CACHE_TLV_ARENA_BLOCK_SIZE 1024
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1107,6 +1420,71 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_DEVICE_MAX_ACTIVE_CASE_CLIENTS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS
+ *
+ * @brief Maximum number of resolved addresses of a peer that an operational
+ *        session setup sends CASE Sigma1 to at the same time.
+ *
+ *        With a value above 1, the handshake with the best address is started
+ *        first, and one more is started with the next best address every
+ *        CHIP_CONFIG_CASE_PARALLEL_ATTEMPT_DELAY_MS while none has completed,
+ *        keeping the first one to succeed.  This needs
+ *        CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS to be above 1, and uses one
+ *        more CASE client per attempt.  With 1, addresses are only tried one
+ *        after the other, after the previous one timed out.
+ */
+#ifndef CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS
+#define CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS 1
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_PARALLEL_ATTEMPT_DELAY_MS
+ *
+ * @brief Delay between the CASE handshakes started with the different
+ *        addresses of a peer, in milliseconds.  See CHIP_CONFIG_CASE_PARALLEL_ATTEMPTS.
+ */
+#ifndef CHIP_CONFIG_CASE_PARALLEL_ATTEMPT_DELAY_MS
+#define CHIP_CONFIG_CASE_PARALLEL_ATTEMPT_DELAY_MS 250
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_WARM_SESSION_COUNT
+ *
+ * @brief Number of peers for which CASESessionManager keeps a CASE session
+ *        established ahead of use.  Peers are added explicitly with
+ *        CASESessionManager::AddWarmPeer, or are the most recently used ones
+ *        if CASESessionManagerConfig::keepRecentPeersWarm is set.  0 disables
+ *        warm sessions.
+ */
+#ifndef CHIP_CONFIG_CASE_WARM_SESSION_COUNT
+#define CHIP_CONFIG_CASE_WARM_SESSION_COUNT 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_WARM_SESSION_REFRESH_INTERVAL_MS
+ *
+ * @brief How often CASESessionManager checks that the warm peers still have a
+ *        session, and re-establishes the ones that were evicted, in
+ *        milliseconds.  See CHIP_CONFIG_CASE_WARM_SESSION_COUNT.
+ */
+#ifndef CHIP_CONFIG_CASE_WARM_SESSION_REFRESH_INTERVAL_MS
+#define CHIP_CONFIG_CASE_WARM_SESSION_REFRESH_INTERVAL_MS 30000
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT
+ *
+ * @brief Number of peers for which CASESessionManager remembers how many
+ *        attempts the last, failed, session setup made, so that the next
+ *        session setup with the peer, whichever caller requests it, continues
+ *        the automatic CASE retry backoff instead of restarting it from the
+ *        initial delay.  0 disables this.
+ */
+#ifndef CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT
+#define CHIP_CONFIG_CASE_PEER_BACKOFF_COUNT 4
+#endif
+
 /**
  * @def CHIP_CONFIG_DEVICE_MAX_ACTIVE_DEVICES
  *
@@ -1182,6 +1560,45 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE
+ *
+ * @brief Defines the number of group sessions GroupDataProviderImpl keeps in memory for incoming group messages
+ *
+ * A group session is one operational key of a keyset mapped to a group, so each group-key mapping accounts for up
+ * to 3 entries. While all the group sessions of all the fabrics fit, IterateGroupSessions() is served from memory
+ * instead of persistent storage. Set to 0 to always read the persistent storage.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE
+#define CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE
+ *
+ * @brief Defines the number of group endpoints GroupDataProviderImpl keeps in memory for processing group messages
+ *
+ * One entry is used for each endpoint of each group of each fabric. While all of them fit, HasEndpoint() and
+ * IterateEndpoints() are served from memory instead of persistent storage. Set to 0 to always read the persistent
+ * storage.
+ */
+#ifndef CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE
+#define CHIP_CONFIG_GROUP_MEMBERSHIP_INDEX_SIZE 16
+#endif
+
+/**
+ * @def CHIP_CONFIG_IPK_CACHE_SIZE
+ *
+ * @brief Defines the number of fabrics whose IPK keyset GroupDataProviderImpl keeps in memory
+ *
+ * The IPK keysets of all the fabrics are needed to match the destination ID of every incoming CASE Sigma1. While
+ * they are in memory, that matching does not read the persistent storage. Fabrics past this count are read from
+ * storage each time. Set to 0 to always read the persistent storage.
+ */
+#ifndef CHIP_CONFIG_IPK_CACHE_SIZE
+#define CHIP_CONFIG_IPK_CACHE_SIZE CHIP_CONFIG_MAX_FABRICS
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1293,6 +1710,33 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
     "Please enable at least one of CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FAST_COPY_SUPPORT or CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FLEXIBLE_COPY_SUPPORT"
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+ *
+ * If set to 1, AccessControl::Check evaluates a flattened, heap allocated copy of
+ * the ACL entries of the accessing fabric instead of reading every entry through
+ * the access control delegate on each check. The copy is rebuilt on first use
+ * after the entries of that fabric change. If the copy cannot be built (e.g. out
+ * of memory), checks read the entries through the delegate as before.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+#define CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES 1
+#endif
+
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE
+ *
+ * Number of recent AccessControl::Check results (keyed by subject, fabric, endpoint,
+ * cluster and privilege) that are remembered until the ACL changes. Wildcard reads
+ * check the same cluster for every attribute, so even a few entries avoid most
+ * re-evaluations. Results that depended on device type targets are not cached.
+ *
+ * Only used with CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES; 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE 8
+#endif
+
 /**
  * @def CHIP_CONFIG_ACCESS_RESTRICTION_MAX_ENTRIES_PER_FABRIC
  *
@@ -1344,6 +1788,58 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE
+ *
+ * @brief The number of entries in the sparse event number index kept by
+ *   each event buffer.
+ *
+ * Every CHIP_CONFIG_EVENT_NUMBER_INDEX_INTERVAL-th event logged gets an
+ * index entry recording where it is stored, so that fetching events
+ * since a given event number can start reading near that event instead
+ * of parsing every older event in the buffers.  When the index of a
+ * buffer is full, its oldest entry is dropped.  Set to 0 to disable the
+ * index.
+ */
+#ifndef CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE 8
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE
+
+/**
+ * @def CHIP_CONFIG_EVENT_NUMBER_INDEX_INTERVAL
+ *
+ * @brief The number of events between two entries of the event number
+ *   index.  See CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE.
+ */
+#ifndef CHIP_CONFIG_EVENT_NUMBER_INDEX_INTERVAL
+#define CHIP_CONFIG_EVENT_NUMBER_INDEX_INTERVAL 8
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_INTERVAL
+
+/**
+ * @def CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_SIZE
+ *
+ * @brief The size, in bytes, past which a persistent event store starts
+ *   a new segment for a priority level.
+ *
+ * Events are only ever appended to the newest segment of their priority,
+ * and a whole segment is deleted at once when there are more than
+ * CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_COUNT of them, so each event is
+ * written to storage once.
+ */
+#ifndef CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_SIZE
+#define CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_SIZE 4096
+#endif // CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_SIZE
+
+/**
+ * @def CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_COUNT
+ *
+ * @brief The number of segments a persistent event store keeps for each
+ *   priority level.  See CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_SIZE.
+ */
+#ifndef CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_COUNT
+#define CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_COUNT 4
+#endif // CHIP_CONFIG_PERSISTENT_EVENT_SEGMENT_COUNT
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1424,6 +1920,31 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_RESUBSCRIBE_WAIT_TIME_MULTIPLIER_MS 10000
 #endif
 
+/**
+ *  @def CHIP_RESUBSCRIBE_SCHEDULER_BURST
+ *
+ *  @brief
+ *    Number of resubscriptions that need a new CASE session that a client
+ *    may start at once, before it starts rate limiting them, see
+ *    chip::app::ResubscriptionScheduler.
+ *
+ */
+#ifndef CHIP_RESUBSCRIBE_SCHEDULER_BURST
+#define CHIP_RESUBSCRIBE_SCHEDULER_BURST 8
+#endif
+
+/**
+ *  @def CHIP_RESUBSCRIBE_SCHEDULER_INTERVAL_MS
+ *
+ *  @brief
+ *    Once CHIP_RESUBSCRIBE_SCHEDULER_BURST resubscriptions have been
+ *    started, the time between the starts of the following ones.
+ *
+ */
+#ifndef CHIP_RESUBSCRIBE_SCHEDULER_INTERVAL_MS
+#define CHIP_RESUBSCRIBE_SCHEDULER_INTERVAL_MS 200
+#endif
+
 /*
  * @def CHIP_CONFIG_MAX_ATTRIBUTE_STORE_ELEMENT_SIZE
  *
@@ -1440,6 +1961,38 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_ATTRIBUTE_STORE_ELEMENT_SIZE 1003
 #endif // CHIP_CONFIG_MAX_ATTRIBUTE_STORE_ELEMENT_SIZE
 
+/*
+ * @def CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE
+ *
+ * @brief Number of slots in the hash index that ServerClusterInterfaceRegistry
+ *        keeps of registered cluster paths, so that lookups do not have to
+ *        walk every registration.
+ *
+ *        Must be 0 or a power of two. At most 3/4 of the slots are used; paths
+ *        that do not fit are still found through a linear search. Setting this
+ *        to 0 (and not enabling CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_DYNAMIC_INDEX)
+ *        disables the index.
+ */
+#ifndef CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE
+#define CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE 32
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE
+
+/*
+ * @def CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_DYNAMIC_INDEX
+ *
+ * @brief Enables usage of heap for the ServerClusterInterfaceRegistry hash index.
+ *
+ *        When this is set, the index is allocated on first use with
+ *        CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE slots (or a small
+ *        default if that is 0) and doubles whenever it fills up.
+ *
+ *        When this is not set, CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE slots
+ *        are statically allocated within each registry.
+ */
+#ifndef CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_DYNAMIC_INDEX
+#define CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_DYNAMIC_INDEX 0
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_DYNAMIC_INDEX
+
 /*
  * @def CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
  *
@@ -1467,6 +2020,33 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES 2
 #endif // CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+ *
+ * @brief Number of unicast mDNS replies the minmdns responder keeps serialized,
+ *        so that a repeated query is answered by copying the previous reply
+ *        instead of walking all the advertised records again.
+ *
+ *        Every cached reply holds a packet buffer. Platforms with a small
+ *        packet buffer pool should set this to 0, which disables the cache.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 4
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS
+ *
+ * @brief Number of nodes found by the current browse that the minmdns
+ *        resolver lists as known answers in its browse retries (RFC 6762
+ *        section 7.1), so that those nodes do not answer again.
+ *
+ *        Setting this to 0 disables known-answer suppression.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS
+#define CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS 8
+#endif // CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS
+
 /**
  * def CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS
  *
@@ -1500,6 +2080,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS 45000
 #endif // CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS
 
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+ *
+ * @brief Number of resolved operational node addresses kept by the default
+ *        address resolver, so that looking a node up again does not need a
+ *        new DNSSD resolve while the records it was resolved from are valid.
+ *
+ *        Controllers reconnecting to many nodes at once may want to raise this.
+ *        Setting it to 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 4
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -1557,6 +2151,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_SUBSCRIPTION_RESUMPTION_STORAGE_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_MAX_CONCURRENT_SUBSCRIPTION_RESUMPTIONS
+ *
+ * @brief Maximum number of persisted subscriptions whose CASE session is being established for resumption at once
+ *
+ * The remaining subscriptions are resumed as earlier attempts complete, taking turns between fabrics. 0 means that all
+ * subscriptions are resumed at once.
+ */
+#ifndef CHIP_CONFIG_MAX_CONCURRENT_SUBSCRIPTION_RESUMPTIONS
+#define CHIP_CONFIG_MAX_CONCURRENT_SUBSCRIPTION_RESUMPTIONS 0
+#endif // CHIP_CONFIG_MAX_CONCURRENT_SUBSCRIPTION_RESUMPTIONS
+
 /**
  * @brief Maximum length of Scene names
  */
@@ -1658,6 +2264,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #endif // CHIP_CONFIG_TEST
 #endif // CHIP_CONFIG_MAX_SCENES_TABLE_SIZE
 
+/**
+ * @def CHIP_CONFIG_FABRIC_TABLE_ENTRY_POSITION_HINTS
+ *
+ * @brief The number of recently used entries of a fabric table (e.g. the scene table) whose position in storage is remembered,
+ * so that loading them again, e.g. to recall a scene, reads only the entry and not the fabric's entry map. The entry at a
+ * remembered position is checked before being returned, so this is safe with tables sharing the same storage. Each hint takes
+ * a few bytes of RAM; 0 disables the hints.
+ */
+#ifndef CHIP_CONFIG_FABRIC_TABLE_ENTRY_POSITION_HINTS
+#define CHIP_CONFIG_FABRIC_TABLE_ENTRY_POSITION_HINTS 8
+#endif
+
 /**
  * @def CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS
  *
@@ -1669,6 +2287,35 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS 1
 #endif // CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS
 
+/**
+ * @def CHIP_CONFIG_TRANSITION_TICKER
+ *
+ * @brief If enabled, the Level Control and Color Control servers step their transitions from the shared
+ * chip::app::TransitionTicker instead of one timer per endpoint, so that transitions on many endpoints (e.g. started by a
+ * group command to a bridge) are stepped in the same timer callback and reported in the same reporting run.
+ */
+#ifndef CHIP_CONFIG_TRANSITION_TICKER
+#define CHIP_CONFIG_TRANSITION_TICKER 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_TRANSITION_TICKER_PERIOD_MS
+ *
+ * @brief The TransitionTicker rounds transition step deadlines up to a multiple of this period.
+ */
+#ifndef CHIP_CONFIG_TRANSITION_TICKER_PERIOD_MS
+#define CHIP_CONFIG_TRANSITION_TICKER_PERIOD_MS 10
+#endif
+
+/**
+ * @def CHIP_CONFIG_TRANSITION_TICKER_MAX_ENTRIES
+ *
+ * @brief Number of transition steps the TransitionTicker can have scheduled; further ones use their own timer.
+ */
+#ifndef CHIP_CONFIG_TRANSITION_TICKER_MAX_ENTRIES
+#define CHIP_CONFIG_TRANSITION_TICKER_MAX_ENTRIES 32
+#endif
+
 /**
  * @def CHIP_CONFIG_TIME_ZONE_LIST_MAX_SIZE
  *
@@ -1852,6 +2499,16 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED 0
 #endif
 
+/**
+ * @def CHIP_CONFIG_SYNCHRONOUS_REPORTS_SLACK_MS
+ *
+ * @brief Default delay, in milliseconds, the synchronized report scheduler may add to a report that became due so that it is sent
+ *        together with the next report due to a max interval, instead of waking the device twice.  0 disables the delay.
+ */
+#ifndef CHIP_CONFIG_SYNCHRONOUS_REPORTS_SLACK_MS
+#define CHIP_CONFIG_SYNCHRONOUS_REPORTS_SLACK_MS 0
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS
  *
@@ -1906,6 +2563,17 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #error "CHIP_CONFIG_MAX_PATHS_PER_INVOKE is not allowed to be a number less than 1 or greater than 65535"
 #endif
 
+/**
+ * @def CHIP_CONFIG_IM_STREAM_INVOKE_RESPONSE_CHUNKS
+ *
+ * @brief If enabled, the chunks of a chunked InvokeResponse are sent as soon as they are full, instead of once every command
+ * of the batch has completed. A batch with slow asynchronous commands then no longer holds back the responses of the commands
+ * that already completed. The requester still acknowledges each chunk with a StatusResponse before the next one is sent.
+ */
+#ifndef CHIP_CONFIG_IM_STREAM_INVOKE_RESPONSE_CHUNKS
+#define CHIP_CONFIG_IM_STREAM_INVOKE_RESPONSE_CHUNKS 0
+#endif
+
 /**
  * @def CHIP_CONFIG_ICD_OBSERVERS_POOL_SIZE
  *
@@ -1916,6 +2584,16 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_ICD_OBSERVERS_POOL_SIZE 3
 #endif
 
+/**
+ * @def CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+ *
+ * @brief Enables the ICDManager to account for the time spent in Active Mode per cause (keep active requirements, network
+ *        activity, subscription reports, ...), see ICDManager::GetActiveModeStats.
+ */
+#ifndef CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING
+#define CHIP_CONFIG_ICD_ACTIVE_MODE_PROFILING 0
+#endif
+
 /**
  * @def CHIP_CONFIG_ENABLE_BDX_LOG_TRANSFER
  *
@@ -1952,6 +2630,33 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_BDX_LOG_TRANSFER_MAX_BLOCK_SIZE 1024
 #endif // CHIP_CONFIG_BDX_LOG_TRANSFER_MAX_BLOCK_SIZE
 
+/**
+ *  @def CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE
+ *
+ *  @brief
+ *    Maximum number of Blocks a BDX sender has in flight, without a BlockAck for them,
+ *    in transfers using the asynchronous control mode.  The receiver acknowledges Blocks
+ *    cumulatively.  Since an exchange only has one message waiting for an MRP ack at a
+ *    time, more than one Block in flight needs a session that does not use MRP (e.g. TCP).
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE
+#define CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE 4
+#endif // CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE
+
+/**
+ *  @def CHIP_CONFIG_BDX_COMPRESSION
+ *
+ *  @brief
+ *    If asserted (1), BDX transfers may negotiate the compression of their Block data, for
+ *    the applications that call TransferSession::EnableCompression().  Each compressed
+ *    transfer allocates about 8 KB for the sender, and 4 KB for the receiver, of codec state.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_COMPRESSION
+#define CHIP_CONFIG_BDX_COMPRESSION 1
+#endif // CHIP_CONFIG_BDX_COMPRESSION
+
 /**
  *  @def CHIP_CONFIG_TEST_GOOGLETEST
  *
@@ -1977,6 +2682,19 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MRP_ANALYTICS_ENABLED 0
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
+/**
+ *  @def CHIP_CONFIG_MESSAGE_TYPE_STATS_TABLE_SIZE
+ *
+ *  @brief
+ *    Number of distinct message types (protocol and opcode) for which the SessionManager keeps
+ *    message and byte counts, see chip::MessageTypeStatsTable.
+ *
+ *    Each entry takes 20 bytes; 0 disables the per-message-type counters.
+ */
+#ifndef CHIP_CONFIG_MESSAGE_TYPE_STATS_TABLE_SIZE
+#define CHIP_CONFIG_MESSAGE_TYPE_STATS_TABLE_SIZE 16
+#endif // CHIP_CONFIG_MESSAGE_TYPE_STATS_TABLE_SIZE
+
 /**
  *  @def CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
  *
@@ -2059,6 +2777,26 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #ifndef CHIP_CONFIG_MAX_NUM_CAMERA_SNAPSHOT_STREAMS
 #define CHIP_CONFIG_MAX_NUM_CAMERA_SNAPSHOT_STREAMS 8
 #endif // CHIP_CONFIG_MAX_NUM_CAMERA_SNAPSHOT_STREAMS
+
+/**
+ * @def CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATES_QUEUE_SIZE
+ *
+ * @brief The number of attribute updates application threads can queue for the Matter thread without taking the
+ *        stack lock (see app/util/pending-attribute-updates.h). Must be a power of two.
+ */
+#ifndef CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATES_QUEUE_SIZE
+#define CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATES_QUEUE_SIZE 64
+#endif // CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATES_QUEUE_SIZE
+
+/**
+ * @def CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATE_MAX_VALUE_SIZE
+ *
+ * @brief The largest attribute value, in its attribute store representation, that can be queued as a pending
+ *        attribute update.
+ */
+#ifndef CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATE_MAX_VALUE_SIZE
+#define CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATE_MAX_VALUE_SIZE 16
+#endif // CHIP_CONFIG_PENDING_ATTRIBUTE_UPDATE_MAX_VALUE_SIZE
 /**
  * @}
  */
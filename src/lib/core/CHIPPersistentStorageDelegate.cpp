@@ -0,0 +1,34 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+
+void PersistentStorageDelegate::LogAsyncFailure(void * context, const char * key, CHIP_ERROR result)
+{
+    if (result != CHIP_NO_ERROR)
+    {
+        ChipLogError(Support, "Asynchronous storage write of '%s' failed: %" CHIP_ERROR_FORMAT, StringOrNullMarker(key),
+                     result.Format());
+    }
+}
+
+} // namespace chip
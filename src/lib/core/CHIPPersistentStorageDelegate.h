@@ -110,6 +110,114 @@ public:
         CHIP_ERROR err = SyncGetKeyValue(key, nullptr, size);
         return (err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_NO_ERROR);
     }
+
+    /**
+     * @brief
+     *   Start a batch of writes. Values set and deleted before the matching SyncCommitBatch are
+     *   read back right away, but may only be written to storage, all together, by SyncCommitBatch.
+     *   Batches nest: the outermost SyncCommitBatch writes the batch.
+     *
+     *   Implementations that support it commit a batch atomically, so that after a reset either
+     *   all or none of its writes are found. By default, every write is committed as it is made.
+     *
+     *   Prefer PersistentStorageBatch, which commits the batch when it goes out of scope.
+     *
+     * @return CHIP_NO_ERROR if the batch was started, in which case SyncCommitBatch must be called.
+     */
+    virtual CHIP_ERROR SyncBeginBatch() { return CHIP_NO_ERROR; }
+
+    /**
+     * @brief
+     *   End a batch of writes started with SyncBeginBatch, even if some of its writes failed.
+     *
+     * @return CHIP_NO_ERROR if the writes of the batch were committed or the batch is nested in
+     *         another one, or another CHIP_ERROR value from implementation on failure.
+     */
+    virtual CHIP_ERROR SyncCommitBatch() { return CHIP_NO_ERROR; }
+
+    /**
+     * Completion of AsyncSetKeyValue or AsyncDeleteKeyValue.
+     *
+     * @param[in] context Context given to the asynchronous call.
+     * @param[in] key     Key that was written or deleted, only valid during the call.
+     * @param[in] result  CHIP_NO_ERROR once the write is durable, or the error that made it fail.
+     */
+    using AsyncCompletion = void (*)(void * context, const char * key, CHIP_ERROR result);
+
+    /**
+     * @brief
+     *   Asynchronous version of SyncSetKeyValue, for implementations backed by slow or remote
+     *   storage that would otherwise block the Matter event loop.
+     *
+     *   The value is copied before returning, and Sync calls made afterwards already see it, even
+     *   if it has not reached storage yet. Asynchronous writes and deletes reach storage in the
+     *   order they were made. `completion`, if not null, is called on the Matter thread once the
+     *   write is durable or failed, and only if this returned CHIP_NO_ERROR.
+     *
+     *   By default, the write is made synchronously and `completion` is called before returning.
+     *
+     * @return CHIP_NO_ERROR if the write was accepted, or the error that made it fail right away.
+     */
+    virtual CHIP_ERROR AsyncSetKeyValue(const char * key, const void * value, uint16_t size, AsyncCompletion completion,
+                                        void * context)
+    {
+        CHIP_ERROR err = SyncSetKeyValue(key, value, size);
+        if (err == CHIP_NO_ERROR && completion != nullptr)
+        {
+            completion(context, key, err);
+        }
+        return err;
+    }
+
+    /**
+     * @brief
+     *   Asynchronous version of SyncDeleteKeyValue, with the same contract as AsyncSetKeyValue.
+     *   A key that is not found is reported by the return value rather than to `completion`.
+     */
+    virtual CHIP_ERROR AsyncDeleteKeyValue(const char * key, AsyncCompletion completion, void * context)
+    {
+        CHIP_ERROR err = SyncDeleteKeyValue(key);
+        if (err == CHIP_NO_ERROR && completion != nullptr)
+        {
+            completion(context, key, err);
+        }
+        return err;
+    }
+
+    /**
+     * AsyncCompletion that logs failures, for writes whose outcome the caller does not otherwise act on.
+     */
+    static void LogAsyncFailure(void * context, const char * key, CHIP_ERROR result);
+};
+
+/**
+ * Batch of writes to a PersistentStorageDelegate, started on construction and committed by
+ * Commit() or, ignoring errors, on destruction.
+ */
+class PersistentStorageBatch
+{
+public:
+    explicit PersistentStorageBatch(PersistentStorageDelegate & storage) :
+        mStorage(storage), mOpen(storage.SyncBeginBatch() == CHIP_NO_ERROR)
+    {}
+    ~PersistentStorageBatch() { TEMPORARY_RETURN_IGNORED Commit(); }
+
+    PersistentStorageBatch(const PersistentStorageBatch &)             = delete;
+    PersistentStorageBatch & operator=(const PersistentStorageBatch &) = delete;
+
+    CHIP_ERROR Commit()
+    {
+        if (!mOpen)
+        {
+            return CHIP_NO_ERROR;
+        }
+        mOpen = false;
+        return mStorage.SyncCommitBatch();
+    }
+
+private:
+    PersistentStorageDelegate & mStorage;
+    bool mOpen;
 };
 
 } // namespace chip
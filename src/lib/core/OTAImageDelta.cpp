@@ -0,0 +1,104 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/OTAImageDelta.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace chip {
+
+void OTAImageDeltaPatcher::Init(ByteSpan baseImage, uint64_t targetSize)
+{
+    mBaseImage       = baseImage;
+    mTargetSize      = targetSize;
+    mOutputSize      = 0;
+    mInsertRemaining = 0;
+    mCommandLength   = 0;
+}
+
+CHIP_ERROR OTAImageDeltaPatcher::Apply(ByteSpan payload, Output & output)
+{
+    while (!payload.empty())
+    {
+        if (mInsertRemaining > 0)
+        {
+            const size_t length = std::min<size_t>(mInsertRemaining, payload.size());
+            ReturnErrorOnFailure(Emit(payload.SubSpan(0, length), output));
+            mInsertRemaining -= static_cast<uint32_t>(length);
+            payload = payload.SubSpan(length);
+            continue;
+        }
+
+        // A command may be split across chunks.
+        const size_t length = std::min(kCommandSize - mCommandLength, payload.size());
+        memcpy(&mCommand[mCommandLength], payload.data(), length);
+        mCommandLength += length;
+        payload = payload.SubSpan(length);
+
+        if (mCommandLength == kCommandSize)
+        {
+            mCommandLength = 0;
+            ReturnErrorOnFailure(ExecuteCommand(output));
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageDeltaPatcher::Finish() const
+{
+    VerifyOrReturnError(mCommandLength == 0 && mInsertRemaining == 0, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    VerifyOrReturnError(mOutputSize == mTargetSize, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageDeltaPatcher::ExecuteCommand(Output & output)
+{
+    const Command command = static_cast<Command>(mCommand[0]);
+    const uint32_t first  = Encoding::LittleEndian::Get32(&mCommand[1]);
+    const uint32_t second = Encoding::LittleEndian::Get32(&mCommand[5]);
+
+    switch (command)
+    {
+    case Command::kCopy:
+        VerifyOrReturnError(first <= mBaseImage.size() && second <= mBaseImage.size() - first, CHIP_ERROR_INVALID_ARGUMENT);
+        return Emit(mBaseImage.SubSpan(first, second), output);
+    case Command::kInsert:
+        VerifyOrReturnError(second == 0, CHIP_ERROR_INVALID_ARGUMENT);
+        mInsertRemaining = first;
+        return CHIP_NO_ERROR;
+    default:
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+}
+
+CHIP_ERROR OTAImageDeltaPatcher::Emit(ByteSpan data, Output & output)
+{
+    VerifyOrReturnError(data.size() <= mTargetSize - mOutputSize, CHIP_ERROR_INVALID_ARGUMENT);
+    if (!data.empty())
+    {
+        ReturnErrorOnFailure(output.Write(data));
+    }
+    mOutputSize += data.size();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace chip
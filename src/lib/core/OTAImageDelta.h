@@ -0,0 +1,97 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+
+/**
+ * Applies the payload of a delta OTA image to its base image, as the payload is downloaded.
+ *
+ * The payload is a sequence of commands. Each command starts with a command byte and two 32-bit little-endian
+ * arguments:
+ *   - kCopy:   copy the number of bytes given by the second argument from the offset of the base image given by
+ *              the first argument.
+ *   - kInsert: insert the number of bytes given by the first argument, which follow the command. The second argument
+ *              is 0.
+ */
+class OTAImageDeltaPatcher
+{
+public:
+    enum class Command : uint8_t
+    {
+        kCopy   = 1,
+        kInsert = 2,
+    };
+
+    static constexpr size_t kCommandSize = 9;
+
+    /// Receives the patched image, in order.
+    class Output
+    {
+    public:
+        virtual ~Output()                       = default;
+        virtual CHIP_ERROR Write(ByteSpan data) = 0;
+    };
+
+    /**
+     * @brief Prepare the patcher for a new payload.
+     *
+     * @param baseImage  The image the delta was made from, which must stay valid until the patcher is initialized again.
+     * @param targetSize The size of the patched image, from the image header.
+     */
+    void Init(ByteSpan baseImage, uint64_t targetSize);
+
+    /**
+     * @brief Apply the next chunk of the payload, of any size.
+     *
+     * Data copied from the base image is written to the output without an intermediate copy.
+     *
+     * @retval CHIP_ERROR_INVALID_ARGUMENT  The payload is not valid for the base image or the target size.
+     * @retval Error code                   Returned by the output.
+     */
+    CHIP_ERROR Apply(ByteSpan payload, Output & output);
+
+    /**
+     * @brief Check that the whole payload was applied.
+     *
+     * @retval CHIP_ERROR_INVALID_MESSAGE_LENGTH The payload ends in the middle of a command, or the patched image
+     *                                           does not have the target size.
+     */
+    CHIP_ERROR Finish() const;
+
+    uint64_t GetOutputSize() const { return mOutputSize; }
+
+private:
+    CHIP_ERROR ExecuteCommand(Output & output);
+    CHIP_ERROR Emit(ByteSpan data, Output & output);
+
+    ByteSpan mBaseImage;
+    uint64_t mTargetSize      = 0;
+    uint64_t mOutputSize      = 0;
+    uint32_t mInsertRemaining = 0;
+    size_t mCommandLength     = 0;
+    uint8_t mCommand[kCommandSize];
+};
+
+} // namespace chip
@@ -44,6 +44,11 @@ enum class Tag : uint8_t
     kReleaseNotesURL       = 7,
     kImageDigestType       = 8,
     kImageDigest           = 9,
+    // Fields of delta images, after the fields of the specification so that other parsers skip them
+    kDeltaBaseVersion  = 10,
+    kDeltaBaseDigest   = 11,
+    kDeltaTargetSize   = 12,
+    kDeltaTargetDigest = 13,
 };
 
 /// Length of the fixed portion of the Matter OTA image header: FileIdentifier (4B), TotalSize (8B) and HeaderSize (4B)
@@ -58,6 +63,9 @@ constexpr size_t kMaxSoftwareVersionStringSize = 64;
 /// Maximum size of the release notes URL
 constexpr size_t kMaxReleaseNotesURLSize = 256;
 
+/// Size of the SHA-256 digests of the base and target images of a delta image
+constexpr size_t kDeltaDigestSize = 32;
+
 } // namespace
 
 void OTAImageHeaderParser::Init()
@@ -175,6 +183,26 @@ CHIP_ERROR OTAImageHeaderParser::DecodeTlv(OTAImageHeader & header)
     ReturnErrorOnFailure(tlvReader.Next(TLV::ContextTag(Tag::kImageDigest)));
     ReturnErrorOnFailure(tlvReader.Get(header.mImageDigest));
 
+    header.mDelta.ClearValue();
+    CHIP_ERROR error = tlvReader.Next();
+    if (error == CHIP_NO_ERROR && tlvReader.GetTag() == TLV::ContextTag(Tag::kDeltaBaseVersion))
+    {
+        OTAImageDeltaInfo & delta = header.mDelta.Emplace();
+        ReturnErrorOnFailure(tlvReader.Get(delta.mBaseSoftwareVersion));
+        ReturnErrorOnFailure(tlvReader.Next(TLV::ContextTag(Tag::kDeltaBaseDigest)));
+        ReturnErrorOnFailure(tlvReader.Get(delta.mBaseDigest));
+        VerifyOrReturnError(delta.mBaseDigest.size() == kDeltaDigestSize, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(tlvReader.Next(TLV::ContextTag(Tag::kDeltaTargetSize)));
+        ReturnErrorOnFailure(tlvReader.Get(delta.mTargetSize));
+        ReturnErrorOnFailure(tlvReader.Next(TLV::ContextTag(Tag::kDeltaTargetDigest)));
+        ReturnErrorOnFailure(tlvReader.Get(delta.mTargetDigest));
+        VerifyOrReturnError(delta.mTargetDigest.size() == kDeltaDigestSize, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+    else
+    {
+        VerifyOrReturnError(error == CHIP_NO_ERROR || error == CHIP_END_OF_TLV, error);
+    }
+
     ReturnErrorOnFailure(tlvReader.ExitContainer(outerType));
 
     return CHIP_NO_ERROR;
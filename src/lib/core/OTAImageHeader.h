@@ -45,6 +45,18 @@ enum class OTAImageDigestType : uint8_t
     kSha3_512   = 12,
 };
 
+/**
+ * Description of the base image of a delta image, whose payload is not the new image itself but the commands to
+ * patch the base image into it (see OTAImageDeltaPatcher). The digests are SHA-256 digests of the whole images.
+ */
+struct OTAImageDeltaInfo
+{
+    uint32_t mBaseSoftwareVersion;
+    ByteSpan mBaseDigest;
+    uint64_t mTargetSize;
+    ByteSpan mTargetDigest;
+};
+
 struct OTAImageHeader
 {
     uint16_t mVendorId;
@@ -57,6 +69,8 @@ struct OTAImageHeader
     CharSpan mReleaseNotesURL;
     OTAImageDigestType mImageDigestType;
     ByteSpan mImageDigest;
+    /// Only present for a delta image. The image digest is then the digest of the delta payload.
+    Optional<OTAImageDeltaInfo> mDelta;
 };
 
 class OTAImageHeaderParser
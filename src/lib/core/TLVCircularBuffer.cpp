@@ -35,6 +35,7 @@
 #include <lib/support/BufferWriter.h>
 #include <lib/support/CodeUtils.h>
 
+#include <algorithm>
 #include <stdint.h>
 
 namespace chip {
@@ -58,7 +59,8 @@ TLVCircularBuffer::TLVCircularBuffer(uint8_t * inBuffer, uint32_t inBufferLength
     mQueue       = inBuffer;
     mQueueSize   = inBufferLength;
     mQueueLength = 0;
-    mQueueHead   = inHead;
+    // Keep the head within the storage, which QueueTail() relies on.
+    mQueueHead = (inHead == mQueue + mQueueSize) ? mQueue : inHead;
 
     mProcessEvictedElement = nullptr;
     mAppData               = nullptr;
@@ -157,11 +159,59 @@ CHIP_ERROR TLVCircularBuffer::EvictHead()
 
     // update queue state
     mQueueLength = newLen;
-    mQueueHead   = newHead;
+    mQueueHead   = (newHead == mQueue + mQueueSize) ? mQueue : newHead;
 
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TLVCircularBuffer::EvictHeadUntilAvailable(uint32_t aRequiredSpace)
+{
+    VerifyOrReturnError(aRequiredSpace <= mQueueSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    if (mProcessEvictedElement != nullptr)
+    {
+        while (AvailableDataLength() < aRequiredSpace)
+        {
+            ReturnErrorOnFailure(EvictHead());
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    CircularTLVReader reader;
+    uint32_t evictedLen     = 0;
+    const uint8_t * newHead = mQueueHead;
+
+    reader.Init(*this);
+    reader.ImplicitProfileId = mImplicitProfileId;
+
+    while (AvailableDataLength() + evictedLen < aRequiredSpace)
+    {
+        err = reader.Next();
+        SuccessOrExit(err);
+        err = reader.Skip();
+        SuccessOrExit(err);
+
+        evictedLen = reader.GetLengthRead();
+        newHead    = reader.GetReadPoint();
+    }
+
+exit:
+    // update queue state with the elements evicted so far
+    mQueueLength -= evictedLen;
+    mQueueHead = (newHead == mQueue + mQueueSize) ? mQueue : const_cast<uint8_t *>(newHead);
+
+    return err;
+}
+
+void TLVCircularBuffer::GetDataSpans(ByteSpan & outFirst, ByteSpan & outSecond) const
+{
+    const uint32_t firstLength = std::min(mQueueLength, mQueueSize - static_cast<uint32_t>(mQueueHead - mQueue));
+
+    outFirst  = ByteSpan(mQueueHead, firstLength);
+    outSecond = ByteSpan(mQueue, mQueueLength - firstLength);
+}
+
 /**
  * @brief
  *  Implements TLVBackingStore::OnInit(TLVWriter) for circular buffers.
@@ -34,6 +34,7 @@
 #include <lib/core/TLVReader.h>
 #include <lib/core/TLVWriter.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/Span.h>
 
 #include <stdint.h>
 #include <stdlib.h>
@@ -62,7 +63,16 @@ public:
 
     void Init(uint8_t * inBuffer, uint32_t inBufferLength);
     inline uint8_t * QueueHead() const { return mQueueHead; }
-    inline uint8_t * QueueTail() const { return mQueue + ((static_cast<size_t>(mQueueHead - mQueue) + mQueueLength) % mQueueSize); }
+    inline uint8_t * QueueTail() const
+    {
+        // The head is always within the storage, so the tail is at most one wraparound away from it.
+        size_t tailOffset = static_cast<size_t>(mQueueHead - mQueue) + mQueueLength;
+        if (tailOffset >= mQueueSize)
+        {
+            tailOffset -= mQueueSize;
+        }
+        return mQueue + tailOffset;
+    }
     inline uint32_t DataLength() const { return mQueueLength; }
     inline uint32_t AvailableDataLength() const { return mQueueSize - mQueueLength; }
     inline uint32_t GetTotalDataLength() const { return mQueueSize; }
@@ -70,6 +80,29 @@ public:
 
     CHIP_ERROR EvictHead();
 
+    /**
+     * @brief
+     *   Evicts the oldest top-level TLV elements until at least @a aRequiredSpace bytes are available.
+     *
+     * Without an #mProcessEvictedElement callback, the elements are walked with a single reader and the queue is updated
+     * once, rather than once per element as with repeated calls to EvictHead().  With a callback, each element is
+     * evicted with EvictHead() so that the callback can keep it.
+     *
+     * @retval #CHIP_NO_ERROR               On success.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL If @a aRequiredSpace is larger than the buffer.
+     * @retval other                        If an element could not be evicted.  The elements before it stay evicted.
+     */
+    CHIP_ERROR EvictHeadUntilAvailable(uint32_t aRequiredSpace);
+
+    /**
+     * @brief
+     *   Gets the queued data as at most two contiguous spans, oldest first.  @a outSecond is empty unless the data wraps
+     *   around the end of the storage, and both are empty if the buffer is.
+     *
+     * The spans stay valid until the buffer is next written to or evicted from.
+     */
+    void GetDataSpans(ByteSpan & outFirst, ByteSpan & outSecond) const;
+
     // chip::TLV::TLVBackingStore overrides:
     CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
     CHIP_ERROR GetNextBuffer(TLVReader & ioReader, const uint8_t *& outBufStart, uint32_t & outBufLen) override;
@@ -84,6 +84,7 @@ class DLL_EXPORT TLVReader
 {
     friend class TLVWriter;
     friend class TLVUpdater;
+    friend class TLVStructIndex;
 
 public:
     TLVReader();
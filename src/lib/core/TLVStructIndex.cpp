@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/TLVStructIndex.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace TLV {
+
+CHIP_ERROR TLVStructIndex::Init(const TLVReader & reader)
+{
+    Reset();
+
+    const TLVType type = reader.GetType();
+    VerifyOrReturnError(type == kTLVType_Structure || type == kTLVType_List, CHIP_ERROR_WRONG_TLV_TYPE);
+
+    TLVType outerContainerType;
+    mContainer.Init(reader);
+    ReturnErrorOnFailure(mContainer.EnterContainer(outerContainerType));
+
+    TLVReader scan;
+    scan.Init(mContainer);
+    while (true)
+    {
+        // Between members, the length read is the offset of the head of the next one.
+        const uint32_t offset = scan.GetLengthRead();
+
+        CHIP_ERROR err = scan.Next();
+        if (err == CHIP_END_OF_TLV)
+        {
+            // Running out of data before the end of the container is an error.
+            VerifyOrReturnError(scan.ElementType() == TLVElementType::EndOfContainer, CHIP_ERROR_TLV_UNDERRUN);
+            break;
+        }
+        ReturnErrorOnFailure(err);
+
+        VerifyOrReturnError(mCount < mStorage.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+        mStorage[mCount++] = Entry{ scan.GetTag(), offset };
+        ReturnErrorOnFailure(scan.Skip());
+    }
+
+    // Members are reached by moving the read point, so the whole container must be in the buffer the reader started in.
+    const uint32_t containerLength = scan.GetLengthRead() - mContainer.mLenRead;
+    VerifyOrReturnError(containerLength <= static_cast<size_t>(mContainer.mBufEnd - mContainer.mReadPoint),
+                        CHIP_ERROR_NOT_IMPLEMENTED);
+
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVStructIndex::Find(Tag tag, TLVReader & destReader) const
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    const Entry * entry = FindEntry(tag);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_TLV_TAG_NOT_FOUND);
+
+    TLVReader reader;
+    reader.Init(mContainer);
+    reader.mReadPoint += entry->offset - mContainer.mLenRead;
+    reader.mLenRead = entry->offset;
+    ReturnErrorOnFailure(reader.Next());
+
+    destReader.Init(reader);
+    return CHIP_NO_ERROR;
+}
+
+const TLVStructIndex::Entry * TLVStructIndex::FindEntry(Tag tag) const
+{
+    VerifyOrReturnValue(mInitialized, nullptr);
+
+    for (size_t i = 0; i < mCount; i++)
+    {
+        if (mStorage[i].tag == tag)
+        {
+            return &mStorage[i];
+        }
+    }
+    return nullptr;
+}
+
+} // namespace TLV
+} // namespace chip
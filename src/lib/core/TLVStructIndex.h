@@ -0,0 +1,114 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVTags.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace TLV {
+
+/**
+ * An index of the members of a TLV structure or list, for code that looks up many of its members by tag.
+ *
+ * Looking a member up with TLV::Utilities::Find or TLVReader::FindElementWithTag scans the container from its start
+ * every time.  TLVStructIndex scans the container once, recording the offset of every member, and then positions a
+ * reader directly on the member with a given tag.
+ *
+ * The container must be held in a single contiguous buffer: a reader over a ByteSpan or a plain buffer, or over a
+ * packet buffer that is not chained.  The index refers to that buffer, which must outlive it.
+ */
+class TLVStructIndex
+{
+public:
+    struct Entry
+    {
+        Tag tag;
+        uint32_t offset;
+    };
+
+    /**
+     * @param[in] storage  The entries of the index, one per member of the containers it indexes.
+     */
+    explicit TLVStructIndex(Span<Entry> storage) : mStorage(storage) {}
+
+    TLVStructIndex(const TLVStructIndex &)             = delete;
+    TLVStructIndex & operator=(const TLVStructIndex &) = delete;
+
+    /**
+     * Index the members of the container the reader is positioned on.  The reader is not moved.
+     *
+     * @retval #CHIP_NO_ERROR                  If the container was indexed.
+     * @retval #CHIP_ERROR_WRONG_TLV_TYPE      If the reader is not positioned on a structure or a list.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL    If the container has more members than the index has entries.
+     * @retval #CHIP_ERROR_NOT_IMPLEMENTED     If the container does not lie in a single buffer.
+     * @retval other                           Errors from decoding the container.
+     */
+    CHIP_ERROR Init(const TLVReader & reader);
+
+    /**
+     * Position destReader on the member of the indexed container with the given tag.  destReader may then be used
+     * like a reader positioned there by Next(), including to read the members that follow.
+     *
+     * @retval #CHIP_NO_ERROR                  If destReader is positioned on the member.
+     * @retval #CHIP_ERROR_TLV_TAG_NOT_FOUND   If the container has no member with that tag.
+     * @retval #CHIP_ERROR_INCORRECT_STATE     If no container is indexed.
+     */
+    CHIP_ERROR Find(Tag tag, TLVReader & destReader) const;
+
+    bool Contains(Tag tag) const { return FindEntry(tag) != nullptr; }
+
+    size_t Count() const { return mCount; }
+
+    bool IsInitialized() const { return mInitialized; }
+
+    void Reset()
+    {
+        mCount       = 0;
+        mInitialized = false;
+    }
+
+private:
+    const Entry * FindEntry(Tag tag) const;
+
+    Span<Entry> mStorage;
+    size_t mCount = 0;
+    // Reader positioned before the first member of the container.
+    TLVReader mContainer;
+    bool mInitialized = false;
+};
+
+/**
+ * A TLVStructIndex with room for kMaxMembers members.
+ */
+template <size_t kMaxMembers>
+class FixedTLVStructIndex : public TLVStructIndex
+{
+public:
+    FixedTLVStructIndex() : TLVStructIndex(Span<Entry>(mEntries)) {}
+
+private:
+    Entry mEntries[kMaxMembers];
+};
+
+} // namespace TLV
+} // namespace chip
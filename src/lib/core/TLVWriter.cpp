@@ -446,15 +446,12 @@ CHIP_ERROR TLVWriter::CopyElement(TLVReader & reader)
     return CopyElement(reader.GetTag(), reader);
 }
 
-const size_t kTLVCopyChunkSize = 16;
-
 CHIP_ERROR TLVWriter::CopyElement(Tag tag, TLVReader & reader)
 {
     TLVElementType elemType = reader.ElementType();
     uint64_t elemLenOrVal   = reader.mElemLenOrVal;
     TLVReader readerHelper; // used to figure out the length of the element and read data of the element
     uint32_t copyDataLen;
-    uint8_t chunk[kTLVCopyChunkSize];
 
     VerifyOrReturnError(elemType != TLVElementType::NotSpecified && elemType != TLVElementType::EndOfContainer,
                         CHIP_ERROR_INCORRECT_STATE);
@@ -472,14 +469,21 @@ CHIP_ERROR TLVWriter::CopyElement(Tag tag, TLVReader & reader)
     // specified tag.
     ReturnErrorOnFailure(WriteElementHead(elemType, tag, elemLenOrVal));
 
+    // Write the data straight out of the reader's buffers, one contiguous piece at a time (e.g. the two sides of the
+    // wraparound point of a circular buffer), instead of going through an intermediate buffer.
     while (copyDataLen > 0)
     {
-        uint32_t chunkSize = copyDataLen > kTLVCopyChunkSize ? kTLVCopyChunkSize : copyDataLen;
-        ReturnErrorOnFailure(readerHelper.ReadData(chunk, chunkSize));
+        ReturnErrorOnFailure(readerHelper.EnsureData(CHIP_ERROR_TLV_UNDERRUN));
+
+        uint32_t pieceLen = static_cast<uint32_t>(readerHelper.mBufEnd - readerHelper.mReadPoint);
+        if (pieceLen > copyDataLen)
+            pieceLen = copyDataLen;
 
-        ReturnErrorOnFailure(WriteData(chunk, chunkSize));
+        ReturnErrorOnFailure(WriteData(readerHelper.mReadPoint, pieceLen));
 
-        copyDataLen -= chunkSize;
+        readerHelper.mReadPoint += pieceLen;
+        readerHelper.mLenRead += pieceLen;
+        copyDataLen -= pieceLen;
     }
 
     return CHIP_NO_ERROR;
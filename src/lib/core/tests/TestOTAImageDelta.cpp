@@ -0,0 +1,128 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/OTAImageDelta.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+
+using namespace chip;
+
+namespace {
+
+const uint8_t kBaseImage[] = "0123456789abcdef";
+
+// Copy "0123", insert "XY", copy "89ab"
+const uint8_t kPayload[] = { 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00,
+                             0x00, 0x00, 0x00, 0x00, 'X',  'Y',  0x01, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 };
+
+constexpr char kTargetImage[] = "0123XY89ab";
+constexpr size_t kTargetSize  = sizeof(kTargetImage) - 1;
+
+class BufferOutput : public OTAImageDeltaPatcher::Output
+{
+public:
+    CHIP_ERROR Write(ByteSpan data) override
+    {
+        VerifyOrReturnError(data.size() <= sizeof(mBuffer) - mLength, CHIP_ERROR_BUFFER_TOO_SMALL);
+        memcpy(&mBuffer[mLength], data.data(), data.size());
+        mLength += data.size();
+        return CHIP_NO_ERROR;
+    }
+
+    uint8_t mBuffer[64];
+    size_t mLength = 0;
+};
+
+ByteSpan BaseImage()
+{
+    return ByteSpan(kBaseImage, sizeof(kBaseImage) - 1);
+}
+
+TEST(TestOTAImageDelta, TestApply)
+{
+    for (size_t chunkSize : { size_t{ 1 }, size_t{ 5 }, sizeof(kPayload) })
+    {
+        OTAImageDeltaPatcher patcher;
+        BufferOutput output;
+
+        patcher.Init(BaseImage(), kTargetSize);
+        for (size_t offset = 0; offset < sizeof(kPayload); offset += chunkSize)
+        {
+            ByteSpan chunk(&kPayload[offset], std::min(chunkSize, sizeof(kPayload) - offset));
+            EXPECT_EQ(patcher.Apply(chunk, output), CHIP_NO_ERROR);
+        }
+
+        EXPECT_EQ(patcher.Finish(), CHIP_NO_ERROR);
+        EXPECT_EQ(patcher.GetOutputSize(), kTargetSize);
+        EXPECT_EQ(output.mLength, kTargetSize);
+        EXPECT_EQ(0, memcmp(output.mBuffer, kTargetImage, kTargetSize));
+    }
+}
+
+TEST(TestOTAImageDelta, TestTruncatedPayload)
+{
+    OTAImageDeltaPatcher patcher;
+    BufferOutput output;
+
+    // Ends in the middle of the inserted data.
+    patcher.Init(BaseImage(), kTargetSize);
+    EXPECT_EQ(patcher.Apply(ByteSpan(kPayload, 19), output), CHIP_NO_ERROR);
+    EXPECT_EQ(patcher.Finish(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    // Ends in the middle of a command.
+    patcher.Init(BaseImage(), kTargetSize);
+    EXPECT_EQ(patcher.Apply(ByteSpan(kPayload, sizeof(kPayload) - 1), output), CHIP_NO_ERROR);
+    EXPECT_EQ(patcher.Finish(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    // Produces less than the target size.
+    patcher.Init(BaseImage(), kTargetSize + 1);
+    EXPECT_EQ(patcher.Apply(ByteSpan(kPayload), output), CHIP_NO_ERROR);
+    EXPECT_EQ(patcher.Finish(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+}
+
+TEST(TestOTAImageDelta, TestInvalidPayload)
+{
+    OTAImageDeltaPatcher patcher;
+    BufferOutput output;
+
+    // Copies past the end of the base image.
+    const uint8_t copyPastEnd[] = { 0x01, 0x0c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00 };
+    patcher.Init(BaseImage(), kTargetSize);
+    EXPECT_EQ(patcher.Apply(ByteSpan(copyPastEnd), output), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Offset and length that overflow 32 bits.
+    const uint8_t copyOverflow[] = { 0x01, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00 };
+    patcher.Init(BaseImage(), kTargetSize);
+    EXPECT_EQ(patcher.Apply(ByteSpan(copyOverflow), output), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Unknown command.
+    const uint8_t unknownCommand[] = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    patcher.Init(BaseImage(), kTargetSize);
+    EXPECT_EQ(patcher.Apply(ByteSpan(unknownCommand), output), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Produces more than the target size.
+    patcher.Init(BaseImage(), kTargetSize - 1);
+    EXPECT_EQ(patcher.Apply(ByteSpan(kPayload), output), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+} // namespace
@@ -70,6 +70,32 @@ const uint8_t kMinOtaImageWithoutVendor[] = { 0x1e, 0xf1, 0xee, 0x1b, 0x44, 0x00
                                               0x42, 0x36, 0x67, 0xdb, 0xb7, 0x3b, 0x6e, 0x15, 0x45, 0x4f, 0x0e, 0xb1, 0xab,
                                               0xd4, 0x59, 0x7f, 0x9a, 0x1b, 0x07, 0x8e, 0x3f, 0x5b, 0x5a, 0x6b, 0xc7, 0x18 };
 
+// Magic: 1beef11e
+// Total Size: 148
+// Header Size: 132
+// Header TLV:
+//   [0] Vendor Id: 1 (0x1)
+//   [1] Product Id: 1 (0x1)
+//   [2] Version: 2 (0x2)
+//   [3] Version String: 2
+//   [4] Payload Size: 0 (0x0)
+//   [8] Digest Type: 1 (0x1)
+//   [9] Digest: 1111111111111111111111111111111111111111111111111111111111111111
+//   [10] Delta Base Version: 1 (0x1)
+//   [11] Delta Base Digest: 2222222222222222222222222222222222222222222222222222222222222222
+//   [12] Delta Target Size: 16 (0x10)
+//   [13] Delta Target Digest: 3333333333333333333333333333333333333333333333333333333333333333
+const uint8_t kDeltaOtaImage[] = {
+    0x1e, 0xf1, 0xee, 0x1b, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x15, 0x24, 0x00, 0x01,
+    0x24, 0x01, 0x01, 0x24, 0x02, 0x02, 0x2c, 0x03, 0x01, 0x32, 0x24, 0x04, 0x00, 0x24, 0x08, 0x01, 0x30, 0x09, 0x20, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x24, 0x0a, 0x01, 0x30, 0x0b, 0x20, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x0c, 0x10, 0x30, 0x0d, 0x20, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x18
+};
+
 class TestOTAImageHeader : public ::testing::Test
 {
 public:
@@ -99,6 +125,27 @@ TEST_F(TestOTAImageHeader, TestHappyPath)
     EXPECT_TRUE(header.mReleaseNotesURL.data_equal("https://rn"_span));
     EXPECT_EQ(header.mImageDigestType, OTAImageDigestType::kSha256);
     EXPECT_EQ(header.mImageDigest.size(), 256u / 8);
+    EXPECT_FALSE(header.mDelta.HasValue());
+}
+
+TEST_F(TestOTAImageHeader, TestDeltaImage)
+{
+    ByteSpan buffer(kDeltaOtaImage);
+    OTAImageHeader header;
+    OTAImageHeaderParser parser;
+
+    parser.Init();
+    EXPECT_EQ(parser.AccumulateAndDecode(buffer, header), CHIP_NO_ERROR);
+    EXPECT_EQ(buffer.size(), 0u);
+    EXPECT_EQ(header.mSoftwareVersion, 2u);
+    EXPECT_EQ(header.mImageDigest.size(), 256u / 8);
+    ASSERT_TRUE(header.mDelta.HasValue());
+    EXPECT_EQ(header.mDelta.Value().mBaseSoftwareVersion, 1u);
+    EXPECT_EQ(header.mDelta.Value().mBaseDigest.size(), 256u / 8);
+    EXPECT_EQ(header.mDelta.Value().mBaseDigest.data()[0], 0x22);
+    EXPECT_EQ(header.mDelta.Value().mTargetSize, 16u);
+    EXPECT_EQ(header.mDelta.Value().mTargetDigest.size(), 256u / 8);
+    EXPECT_EQ(header.mDelta.Value().mTargetDigest.data()[0], 0x33);
 }
 
 TEST_F(TestOTAImageHeader, TestEmptyBuffer)
@@ -2450,6 +2450,71 @@ TEST_F(TestTLV, CheckCircularTLVBufferEvictStraddlingEvent)
     TestEnd<TLVReader>(reader);
 }
 
+TEST_F(TestTLV, CheckCircularTLVBufferBulkEviction)
+{
+    // Leave 2 instances of Encoding3 in the buffer, the second one wrapping around the end, as in
+    // CheckCircularTLVBufferSimple, then evict them in bulk.
+
+    TestTLVContext * context = &TestTLV::ctx;
+    uint8_t backingStore[30];
+    CircularTLVWriter writer;
+    CircularTLVReader reader;
+    TLVCircularBuffer buffer(backingStore, 30);
+    ByteSpan first, second;
+    writer.Init(buffer);
+    writer.ImplicitProfileId = TestProfile_2;
+
+    EXPECT_SUCCESS(writer.PutBoolean(ProfileTag(TestProfile_1, 2), true));
+    WriteEncoding3(writer);
+    WriteEncoding3(writer);
+    WriteEncoding3(writer);
+    EXPECT_EQ(buffer.DataLength(), 22u);
+
+    buffer.GetDataSpans(first, second);
+    EXPECT_EQ(first.data(), buffer.QueueHead());
+    EXPECT_EQ(first.size(), 12u);
+    EXPECT_EQ(second.data(), &backingStore[0]);
+    EXPECT_EQ(second.size(), 10u);
+
+    EXPECT_EQ(buffer.EvictHeadUntilAvailable(31), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(buffer.DataLength(), 22u);
+
+    // Already available: nothing is evicted.
+    EXPECT_SUCCESS(buffer.EvictHeadUntilAvailable(8));
+    EXPECT_EQ(buffer.DataLength(), 22u);
+
+    // The first element has to go, and it is enough.
+    EXPECT_SUCCESS(buffer.EvictHeadUntilAvailable(9));
+    EXPECT_EQ(buffer.DataLength(), 11u);
+
+    buffer.GetDataSpans(first, second);
+    EXPECT_EQ(first.size() + second.size(), 11u);
+
+    reader.Init(buffer);
+    reader.ImplicitProfileId = TestProfile_2;
+    TestNext<TLVReader>(reader);
+    ReadEncoding3(reader);
+    TestEnd<TLVReader>(reader);
+
+    // The callback sees every evicted element.
+    context->mEvictionCount       = 0;
+    context->mEvictedBytes        = 0;
+    buffer.mProcessEvictedElement = CountEvictedMembers;
+    buffer.mAppData               = &TestTLV::ctx;
+
+    writer.Init(buffer);
+    writer.ImplicitProfileId = TestProfile_2;
+    WriteEncoding3(writer);
+    EXPECT_SUCCESS(buffer.EvictHeadUntilAvailable(30));
+    EXPECT_EQ(context->mEvictionCount, 2);
+    EXPECT_EQ(context->mEvictedBytes, 22u);
+    EXPECT_EQ(buffer.DataLength(), 0u);
+
+    buffer.GetDataSpans(first, second);
+    EXPECT_TRUE(first.empty());
+    EXPECT_TRUE(second.empty());
+}
+
 TEST_F(TestTLV, CheckCircularTLVBufferEdge)
 {
     TestTLVContext * context = &TestTLV::ctx;
@@ -2987,6 +3052,46 @@ TEST_F(TestTLV, CheckTLVSkipCircular)
     EXPECT_EQ(err, CHIP_NO_ERROR);
 }
 
+TEST_F(TestTLV, CheckTLVCopyElementCircular)
+{
+    const size_t bufsize = 40; // large enough s.t. 2 elements fit, 3rd causes eviction
+    uint8_t backingStore[bufsize];
+    uint8_t expected[bufsize];
+    uint8_t copied[bufsize];
+    char testString[] = "Sample string";
+    CircularTLVWriter writer;
+    CircularTLVReader reader;
+    TLVCircularBuffer buffer(backingStore, bufsize);
+    TLVWriter flatWriter;
+
+    // The third string straddles the end of the backing store.
+    writer.Init(buffer);
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(writer.PutString(AnonymousTag(), testString), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    flatWriter.Init(expected);
+    EXPECT_EQ(flatWriter.PutString(AnonymousTag(), testString), CHIP_NO_ERROR);
+    EXPECT_EQ(flatWriter.Finalize(), CHIP_NO_ERROR);
+    uint32_t expectedLen = flatWriter.GetLengthWritten();
+
+    reader.Init(buffer);
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_GT(reader.GetReadPoint() - backingStore + expectedLen, bufsize);
+
+    flatWriter.Init(copied);
+    EXPECT_EQ(flatWriter.CopyElement(reader), CHIP_NO_ERROR);
+    EXPECT_EQ(flatWriter.Finalize(), CHIP_NO_ERROR);
+    EXPECT_EQ(flatWriter.GetLengthWritten(), expectedLen);
+    EXPECT_EQ(memcmp(copied, expected, expectedLen), 0);
+
+    // The reader carries on after the copied element.
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+}
+
 /**
  *  Test Buffer Overflow
  */
@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVStructIndex.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/TLVPacketBufferBackingStore.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+constexpr uint8_t kBytes[] = { 1, 2, 3, 4, 5 };
+
+CHIP_ERROR WriteTestStruct(TLVWriter & writer)
+{
+    TLVType outer;
+    ReturnErrorOnFailure(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outer));
+    ReturnErrorOnFailure(writer.Put(ContextTag(1), static_cast<uint8_t>(10)));
+    ReturnErrorOnFailure(writer.Put(ContextTag(2), ByteSpan(kBytes)));
+
+    TLVType inner;
+    ReturnErrorOnFailure(writer.StartContainer(ContextTag(3), kTLVType_Structure, inner));
+    ReturnErrorOnFailure(writer.Put(ContextTag(1), static_cast<uint32_t>(1000)));
+    ReturnErrorOnFailure(writer.EndContainer(inner));
+
+    ReturnErrorOnFailure(writer.PutString(ContextTag(4), "label"));
+    ReturnErrorOnFailure(writer.Put(ProfileTag(0x1234u, 5), true));
+    ReturnErrorOnFailure(writer.EndContainer(outer));
+    return writer.Finalize();
+}
+
+class TestTLVStructIndex : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        TLVWriter writer;
+        writer.Init(mBuffer);
+        ASSERT_EQ(WriteTestStruct(writer), CHIP_NO_ERROR);
+        mLength = writer.GetLengthWritten();
+    }
+
+    uint8_t mBuffer[64];
+    size_t mLength = 0;
+};
+
+void CheckMembers(const TLVStructIndex & index)
+{
+    TLVReader reader;
+
+    // Members are found in any order.
+    EXPECT_EQ(index.Find(ContextTag(4), reader), CHIP_NO_ERROR);
+    CharSpan label;
+    EXPECT_EQ(reader.Get(label), CHIP_NO_ERROR);
+    EXPECT_TRUE(label.data_equal("label"_span));
+
+    EXPECT_EQ(index.Find(ContextTag(1), reader), CHIP_NO_ERROR);
+    uint8_t value = 0;
+    EXPECT_EQ(reader.Get(value), CHIP_NO_ERROR);
+    EXPECT_EQ(value, 10);
+
+    EXPECT_EQ(index.Find(ContextTag(2), reader), CHIP_NO_ERROR);
+    ByteSpan bytes;
+    EXPECT_EQ(reader.Get(bytes), CHIP_NO_ERROR);
+    EXPECT_TRUE(bytes.data_equal(ByteSpan(kBytes)));
+
+    EXPECT_EQ(index.Find(ContextTag(3), reader), CHIP_NO_ERROR);
+    TLVType outer;
+    EXPECT_EQ(reader.EnterContainer(outer), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(ContextTag(1)), CHIP_NO_ERROR);
+    uint32_t innerValue = 0;
+    EXPECT_EQ(reader.Get(innerValue), CHIP_NO_ERROR);
+    EXPECT_EQ(innerValue, 1000u);
+    EXPECT_EQ(reader.ExitContainer(outer), CHIP_NO_ERROR);
+
+    // The reader carries on with the members that follow.
+    EXPECT_EQ(reader.Next(ContextTag(4)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(ProfileTag(0x1234u, 5)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+
+    EXPECT_EQ(index.Find(ContextTag(6), reader), CHIP_ERROR_TLV_TAG_NOT_FOUND);
+    EXPECT_FALSE(index.Contains(ContextTag(6)));
+    EXPECT_TRUE(index.Contains(ProfileTag(0x1234u, 5)));
+}
+
+} // namespace
+
+TEST_F(TestTLVStructIndex, FindsMembersOfByteSpan)
+{
+    TLVReader reader;
+    reader.Init(ByteSpan(mBuffer, mLength));
+    ASSERT_EQ(reader.Next(kTLVType_Structure, AnonymousTag()), CHIP_NO_ERROR);
+
+    FixedTLVStructIndex<8> index;
+    EXPECT_FALSE(index.IsInitialized());
+    ASSERT_EQ(index.Init(reader), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Count(), 5u);
+    CheckMembers(index);
+
+    // The reader the index was built from is still on the structure.
+    EXPECT_EQ(reader.GetType(), kTLVType_Structure);
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+}
+
+TEST_F(TestTLVStructIndex, FindsMembersOfPacketBuffer)
+{
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::NewWithData(mBuffer, mLength);
+    ASSERT_FALSE(buffer.IsNull());
+
+    System::PacketBufferTLVReader reader;
+    reader.Init(std::move(buffer));
+    ASSERT_EQ(reader.Next(kTLVType_Structure, AnonymousTag()), CHIP_NO_ERROR);
+
+    FixedTLVStructIndex<8> index;
+    ASSERT_EQ(index.Init(reader), CHIP_NO_ERROR);
+    CheckMembers(index);
+}
+
+TEST_F(TestTLVStructIndex, RejectsUnsuitableContainers)
+{
+    TLVReader reader;
+    FixedTLVStructIndex<4> index;
+
+    EXPECT_EQ(index.Find(ContextTag(1), reader), CHIP_ERROR_INCORRECT_STATE);
+
+    reader.Init(ByteSpan(mBuffer, mLength));
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Init(reader), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_FALSE(index.IsInitialized());
+
+    // Only structures and lists are indexed.
+    TLVType outer;
+    ASSERT_EQ(reader.EnterContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(reader.Next(ContextTag(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Init(reader), CHIP_ERROR_WRONG_TLV_TYPE);
+
+    // A truncated structure is rejected.
+    reader.Init(ByteSpan(mBuffer, mLength - 1));
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    FixedTLVStructIndex<8> largerIndex;
+    EXPECT_NE(largerIndex.Init(reader), CHIP_NO_ERROR);
+    EXPECT_FALSE(largerIndex.IsInitialized());
+}
@@ -0,0 +1,482 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Throughput benchmarks for the TLVWriter and TLVReader hot paths, and for the TLVCircularBuffer backing the
+ *      event log.
+ *
+ *      The payloads mirror the shapes of Interaction Model messages (a ReportData carrying a batch of attribute reports,
+ *      an InvokeRequest with command fields) so that numbers track what the stack actually encodes and decodes.
+ *
+ *      Usage: tlv-benchmark [--min-time-ms=<ms>] [<name filter>]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVCircularBuffer.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+constexpr size_t kBufferSize             = 4096;
+constexpr uint32_t kDefaultMinTimeMs     = 500;
+constexpr size_t kReportAttributeCount   = 24;
+constexpr size_t kInvokeCommandCount     = 4;
+constexpr size_t kPrimitiveElementCount  = 256;
+constexpr uint32_t kEventBufferSize      = 2048;
+constexpr uint32_t kMaxEventSize         = 64;
+constexpr size_t kLoggedEventCount       = 64;
+constexpr uint8_t kCommandFieldBytes[32] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa,
+                                             0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55,
+                                             0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff };
+
+// Output buffer for the encode benchmarks.
+uint8_t gScratch[kBufferSize];
+
+// Consumed values end up here so that the decoders cannot be optimized away.
+volatile uint64_t gSink;
+
+// ReportDataMessage { SubscriptionId, AttributeReportIBs [ AttributeReportIB { AttributeDataIB { DataVersion,
+// AttributePathIB [ Endpoint, Cluster, Attribute ], Data } } ... ], SuppressResponse }
+size_t EncodeReportData(uint8_t * buffer, size_t bufferSize)
+{
+    TLVWriter writer;
+    TLVType message, reports, report, data, path, value;
+
+    writer.Init(buffer, bufferSize);
+    SuccessOrDie(writer.StartContainer(AnonymousTag(), kTLVType_Structure, message));
+    SuccessOrDie(writer.Put(ContextTag(0), static_cast<uint32_t>(0x12345678)));
+    SuccessOrDie(writer.StartContainer(ContextTag(1), kTLVType_Array, reports));
+    for (size_t i = 0; i < kReportAttributeCount; i++)
+    {
+        SuccessOrDie(writer.StartContainer(AnonymousTag(), kTLVType_Structure, report));
+        SuccessOrDie(writer.StartContainer(ContextTag(1), kTLVType_Structure, data));
+        SuccessOrDie(writer.Put(ContextTag(0), static_cast<uint32_t>(0xA5A5A5A5u + i)));
+        SuccessOrDie(writer.StartContainer(ContextTag(1), kTLVType_List, path));
+        SuccessOrDie(writer.Put(ContextTag(2), static_cast<uint16_t>(1 + i % 3)));
+        SuccessOrDie(writer.Put(ContextTag(3), static_cast<uint32_t>(0x0006 + i % 5)));
+        SuccessOrDie(writer.Put(ContextTag(4), static_cast<uint32_t>(i)));
+        SuccessOrDie(writer.EndContainer(path));
+        switch (i % 4)
+        {
+        case 0:
+            SuccessOrDie(writer.PutBoolean(ContextTag(2), (i & 1) != 0));
+            break;
+        case 1:
+            SuccessOrDie(writer.Put(ContextTag(2), static_cast<uint16_t>(i * 1000)));
+            break;
+        case 2:
+            SuccessOrDie(writer.PutString(ContextTag(2), "Living Room Light"));
+            break;
+        default:
+            // A small struct, like a list entry of a complex attribute.
+            SuccessOrDie(writer.StartContainer(ContextTag(2), kTLVType_Structure, value));
+            SuccessOrDie(writer.Put(ContextTag(0), static_cast<uint8_t>(i)));
+            SuccessOrDie(writer.Put(ContextTag(1), static_cast<int16_t>(-2500)));
+            SuccessOrDie(writer.PutNull(ContextTag(2)));
+            SuccessOrDie(writer.EndContainer(value));
+            break;
+        }
+        SuccessOrDie(writer.EndContainer(data));
+        SuccessOrDie(writer.EndContainer(report));
+    }
+    SuccessOrDie(writer.EndContainer(reports));
+    SuccessOrDie(writer.PutBoolean(ContextTag(4), true));
+    SuccessOrDie(writer.Put(ContextTag(0xFF), static_cast<uint8_t>(12)));
+    SuccessOrDie(writer.EndContainer(message));
+    SuccessOrDie(writer.Finalize());
+
+    return writer.GetLengthWritten();
+}
+
+// InvokeRequestMessage { SuppressResponse, TimedRequest, InvokeRequests [ CommandDataIB { CommandPathIB [ Endpoint,
+// Cluster, Command ], CommandFields { ... } } ... ] }
+size_t EncodeInvokeRequest(uint8_t * buffer, size_t bufferSize)
+{
+    TLVWriter writer;
+    TLVType message, requests, command, path, fields;
+
+    writer.Init(buffer, bufferSize);
+    SuccessOrDie(writer.StartContainer(AnonymousTag(), kTLVType_Structure, message));
+    SuccessOrDie(writer.PutBoolean(ContextTag(0), false));
+    SuccessOrDie(writer.PutBoolean(ContextTag(1), false));
+    SuccessOrDie(writer.StartContainer(ContextTag(2), kTLVType_Array, requests));
+    for (size_t i = 0; i < kInvokeCommandCount; i++)
+    {
+        SuccessOrDie(writer.StartContainer(AnonymousTag(), kTLVType_Structure, command));
+        SuccessOrDie(writer.StartContainer(ContextTag(0), kTLVType_List, path));
+        SuccessOrDie(writer.Put(ContextTag(0), static_cast<uint16_t>(1)));
+        SuccessOrDie(writer.Put(ContextTag(1), static_cast<uint32_t>(0x0101)));
+        SuccessOrDie(writer.Put(ContextTag(2), static_cast<uint32_t>(i)));
+        SuccessOrDie(writer.EndContainer(path));
+        SuccessOrDie(writer.StartContainer(ContextTag(1), kTLVType_Structure, fields));
+        SuccessOrDie(writer.Put(ContextTag(0), ByteSpan(kCommandFieldBytes)));
+        SuccessOrDie(writer.PutString(ContextTag(1), "user-credential"));
+        SuccessOrDie(writer.Put(ContextTag(2), static_cast<uint16_t>(0x1234)));
+        SuccessOrDie(writer.Put(ContextTag(3), static_cast<uint64_t>(0x0102030405060708ull)));
+        SuccessOrDie(writer.PutNull(ContextTag(4)));
+        SuccessOrDie(writer.EndContainer(fields));
+        SuccessOrDie(writer.EndContainer(command));
+    }
+    SuccessOrDie(writer.EndContainer(requests));
+    SuccessOrDie(writer.Put(ContextTag(0xFF), static_cast<uint8_t>(12)));
+    SuccessOrDie(writer.EndContainer(message));
+    SuccessOrDie(writer.Finalize());
+
+    return writer.GetLengthWritten();
+}
+
+// A flat array of integers of mixed widths, to isolate the cost of Put / Next / Get on primitives.
+size_t EncodePrimitives(uint8_t * buffer, size_t bufferSize)
+{
+    TLVWriter writer;
+    TLVType array;
+
+    writer.Init(buffer, bufferSize);
+    SuccessOrDie(writer.StartContainer(AnonymousTag(), kTLVType_Array, array));
+    for (size_t i = 0; i < kPrimitiveElementCount; i++)
+    {
+        SuccessOrDie(writer.Put(AnonymousTag(), static_cast<uint64_t>(i) << ((i % 4) * 12)));
+    }
+    SuccessOrDie(writer.EndContainer(array));
+    SuccessOrDie(writer.Finalize());
+
+    return writer.GetLengthWritten();
+}
+
+// An event as EventManagement stores it: EventDataIB { EventPathIB [ Endpoint, Cluster, Event ], EventNumber, Priority,
+// EpochTimestamp, Data { ... } }
+size_t WriteEvent(TLVCircularBuffer & buffer, uint64_t eventNumber)
+{
+    CircularTLVWriter writer;
+    TLVType event, path, data;
+
+    writer.Init(buffer);
+    SuccessOrDie(writer.StartContainer(AnonymousTag(), kTLVType_Structure, event));
+    SuccessOrDie(writer.StartContainer(ContextTag(0), kTLVType_List, path));
+    SuccessOrDie(writer.Put(ContextTag(1), static_cast<uint16_t>(1)));
+    SuccessOrDie(writer.Put(ContextTag(2), static_cast<uint32_t>(0x0028)));
+    SuccessOrDie(writer.Put(ContextTag(3), static_cast<uint32_t>(eventNumber % 3)));
+    SuccessOrDie(writer.EndContainer(path));
+    SuccessOrDie(writer.Put(ContextTag(1), static_cast<uint64_t>(0x10000 + eventNumber)));
+    SuccessOrDie(writer.Put(ContextTag(2), static_cast<uint8_t>(1)));
+    SuccessOrDie(writer.Put(ContextTag(3), static_cast<uint64_t>(1700000000000ull + eventNumber)));
+    SuccessOrDie(writer.StartContainer(ContextTag(7), kTLVType_Structure, data));
+    SuccessOrDie(writer.Put(ContextTag(0), static_cast<uint32_t>(eventNumber)));
+    SuccessOrDie(writer.PutBoolean(ContextTag(1), (eventNumber & 1) != 0));
+    SuccessOrDie(writer.EndContainer(data));
+    SuccessOrDie(writer.EndContainer(event));
+    SuccessOrDie(writer.Finalize());
+
+    VerifyOrDie(writer.GetLengthWritten() <= kMaxEventSize);
+    return writer.GetLengthWritten();
+}
+
+// Fills an empty buffer for as long as one more event is sure to fit.
+size_t FillEvents(TLVCircularBuffer & buffer)
+{
+    size_t written = 0;
+    for (uint64_t eventNumber = 0; buffer.AvailableDataLength() >= kMaxEventSize; eventNumber++)
+    {
+        written += WriteEvent(buffer, eventNumber);
+    }
+    return written;
+}
+
+// Walks every element, descending into every container and reading every value, like a full message decode does.
+uint64_t DecodeRecursive(TLVReader & reader)
+{
+    uint64_t acc = 0;
+    CHIP_ERROR err;
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        acc += TagNumFromTag(reader.GetTag());
+        switch (reader.GetType())
+        {
+        case kTLVType_Structure:
+        case kTLVType_Array:
+        case kTLVType_List: {
+            TLVType outer;
+            SuccessOrDie(reader.EnterContainer(outer));
+            acc += DecodeRecursive(reader);
+            SuccessOrDie(reader.ExitContainer(outer));
+            break;
+        }
+        case kTLVType_UnsignedInteger: {
+            uint64_t v;
+            SuccessOrDie(reader.Get(v));
+            acc += v;
+            break;
+        }
+        case kTLVType_SignedInteger: {
+            int64_t v;
+            SuccessOrDie(reader.Get(v));
+            acc += static_cast<uint64_t>(v);
+            break;
+        }
+        case kTLVType_Boolean: {
+            bool v;
+            SuccessOrDie(reader.Get(v));
+            acc += v ? 1 : 0;
+            break;
+        }
+        case kTLVType_ByteString: {
+            ByteSpan v;
+            SuccessOrDie(reader.Get(v));
+            acc += v.size();
+            break;
+        }
+        case kTLVType_UTF8String: {
+            CharSpan v;
+            SuccessOrDie(reader.Get(v));
+            acc += v.size();
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    VerifyOrDie(err == CHIP_END_OF_TLV);
+
+    return acc;
+}
+
+size_t DecodeAll(const uint8_t * encoded, size_t length)
+{
+    TLVReader reader;
+    reader.Init(encoded, length);
+    gSink = gSink + DecodeRecursive(reader);
+    return length;
+}
+
+size_t BenchEncodeReportData()
+{
+    return EncodeReportData(gScratch, sizeof(gScratch));
+}
+
+size_t BenchDecodeReportData()
+{
+    static uint8_t sEncoded[kBufferSize];
+    static const size_t sLength = EncodeReportData(sEncoded, sizeof(sEncoded));
+    return DecodeAll(sEncoded, sLength);
+}
+
+// Finds one attribute report by skipping over the others, like a consumer only interested in a single path.
+size_t BenchSkipReportData()
+{
+    static uint8_t sEncoded[kBufferSize];
+    static const size_t sLength = EncodeReportData(sEncoded, sizeof(sEncoded));
+
+    TLVReader reader;
+    TLVType message, reports;
+    size_t count = 0;
+
+    reader.Init(sEncoded, sLength);
+    SuccessOrDie(reader.Next());
+    SuccessOrDie(reader.EnterContainer(message));
+    SuccessOrDie(reader.Next(ContextTag(0)));
+    SuccessOrDie(reader.Next(kTLVType_Array, ContextTag(1)));
+    SuccessOrDie(reader.EnterContainer(reports));
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        count++;
+    }
+    SuccessOrDie(reader.ExitContainer(reports));
+    SuccessOrDie(reader.ExitContainer(message));
+
+    VerifyOrDie(count == kReportAttributeCount);
+    gSink = gSink + count;
+    return sLength;
+}
+
+size_t BenchEncodeInvokeRequest()
+{
+    return EncodeInvokeRequest(gScratch, sizeof(gScratch));
+}
+
+size_t BenchDecodeInvokeRequest()
+{
+    static uint8_t sEncoded[kBufferSize];
+    static const size_t sLength = EncodeInvokeRequest(sEncoded, sizeof(sEncoded));
+    return DecodeAll(sEncoded, sLength);
+}
+
+size_t BenchEncodePrimitives()
+{
+    return EncodePrimitives(gScratch, sizeof(gScratch));
+}
+
+size_t BenchDecodePrimitives()
+{
+    static uint8_t sEncoded[kBufferSize];
+    static const size_t sLength = EncodePrimitives(sEncoded, sizeof(sEncoded));
+    return DecodeAll(sEncoded, sLength);
+}
+
+// Logs events into a full buffer, making room for each one first, like EventManagement::LogEvent does.
+size_t BenchLogEvents()
+{
+    static uint8_t sStorage[kEventBufferSize];
+    static TLVCircularBuffer sBuffer(sStorage, kEventBufferSize);
+    static uint64_t sEventNumber = 0;
+
+    size_t written = 0;
+    for (size_t i = 0; i < kLoggedEventCount; i++)
+    {
+        SuccessOrDie(sBuffer.EvictHeadUntilAvailable(kMaxEventSize));
+        written += WriteEvent(sBuffer, sEventNumber++);
+    }
+    return written;
+}
+
+// A full buffer whose data wraps around.  Evicting only moves the head, so copies of it can be emptied over and over.
+const TLVCircularBuffer & GetFilledEventBuffer()
+{
+    static uint8_t sStorage[kEventBufferSize];
+    static TLVCircularBuffer * sBuffer = [] {
+        auto * buffer = new TLVCircularBuffer(sStorage, kEventBufferSize, &sStorage[kEventBufferSize / 2]);
+        FillEvents(*buffer);
+        return buffer;
+    }();
+    return *sBuffer;
+}
+
+// Empties the buffer one element at a time.
+size_t BenchEvictEach()
+{
+    TLVCircularBuffer buffer = GetFilledEventBuffer();
+    while (buffer.DataLength() > 0)
+    {
+        SuccessOrDie(buffer.EvictHead());
+    }
+    return GetFilledEventBuffer().DataLength();
+}
+
+// Empties the buffer in one batch.
+size_t BenchEvictBatch()
+{
+    TLVCircularBuffer buffer = GetFilledEventBuffer();
+    SuccessOrDie(buffer.EvictHeadUntilAvailable(kEventBufferSize));
+    return GetFilledEventBuffer().DataLength();
+}
+
+// Copies the whole content of the buffer out, as when the event log is saved.
+size_t BenchCopySpans()
+{
+    ByteSpan first, second;
+    GetFilledEventBuffer().GetDataSpans(first, second);
+    memcpy(gScratch, first.data(), first.size());
+    memcpy(gScratch + first.size(), second.data(), second.size());
+    gSink = gSink + gScratch[0];
+    return first.size() + second.size();
+}
+
+struct Benchmark
+{
+    const char * name;
+    // Runs one iteration and returns the number of TLV bytes it encoded, decoded or copied.
+    size_t (*run)();
+};
+
+const Benchmark sBenchmarks[] = {
+    { "TLVWriter/ReportData", BenchEncodeReportData },       { "TLVReader/ReportData", BenchDecodeReportData },
+    { "TLVReader/ReportDataSkip", BenchSkipReportData },     { "TLVWriter/InvokeRequest", BenchEncodeInvokeRequest },
+    { "TLVReader/InvokeRequest", BenchDecodeInvokeRequest }, { "TLVWriter/Primitives", BenchEncodePrimitives },
+    { "TLVReader/Primitives", BenchDecodePrimitives },
+    { "TLVCircularBuffer/LogEvents", BenchLogEvents },       { "TLVCircularBuffer/EvictEach", BenchEvictEach },
+    { "TLVCircularBuffer/EvictBatch", BenchEvictBatch },     { "TLVCircularBuffer/CopySpans", BenchCopySpans },
+};
+
+void RunBenchmark(const Benchmark & benchmark, std::chrono::nanoseconds minTime)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Warm up, and learn the payload size.
+    size_t bytesPerIteration = benchmark.run();
+
+    uint64_t iterations = 1;
+    for (;;)
+    {
+        auto start = Clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            benchmark.run();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+
+        if (elapsed >= minTime || iterations >= (UINT64_MAX / 10))
+        {
+            double nsPerIteration = static_cast<double>(elapsed.count()) / static_cast<double>(iterations);
+            double mbPerSecond    = static_cast<double>(bytesPerIteration) * 1e3 / nsPerIteration;
+            printf("%-28s %12" PRIu64 " iterations %10.1f ns/op %8.1f MB/s %6u bytes\n", benchmark.name, iterations,
+                   nsPerIteration, mbPerSecond, static_cast<unsigned>(bytesPerIteration));
+            return;
+        }
+
+        // Aim slightly past the minimum time, growing by at most 10x per round.
+        uint64_t next = elapsed.count() > 0
+            ? static_cast<uint64_t>(static_cast<double>(iterations) * 1.2 * static_cast<double>(minTime.count()) /
+                                    static_cast<double>(elapsed.count()))
+            : iterations * 10;
+        iterations = std::max(iterations + 1, std::min(next, iterations * 10));
+    }
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    uint32_t minTimeMs  = kDefaultMinTimeMs;
+    const char * filter = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--min-time-ms=", strlen("--min-time-ms=")) == 0)
+        {
+            minTimeMs = static_cast<uint32_t>(strtoul(argv[i] + strlen("--min-time-ms="), nullptr, 10));
+        }
+        else
+        {
+            filter = argv[i];
+        }
+    }
+
+    for (const auto & benchmark : sBenchmarks)
+    {
+        if (filter == nullptr || strstr(benchmark.name, filter) != nullptr)
+        {
+            RunBenchmark(benchmark, std::chrono::milliseconds(minTimeMs));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -17,6 +17,7 @@
 
 #include "ActiveResolveAttempts.h"
 
+#include <crypto/RandUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 using namespace chip;
@@ -25,6 +26,8 @@ namespace mdns {
 namespace Minimal {
 
 constexpr chip::System::Clock::Timeout ActiveResolveAttempts::kMaxRetryDelay;
+constexpr chip::System::Clock::Timeout ActiveResolveAttempts::kMinBurstQueryDelay;
+constexpr chip::System::Clock::Timeout ActiveResolveAttempts::kMaxBurstQueryDelay;
 
 void ActiveResolveAttempts::Reset()
 
@@ -188,12 +191,34 @@ void ActiveResolveAttempts::MarkPending(ScheduledAttempt && attempt)
         ChipLogError(Discovery, "Re-using pending resolve entry before reply was received.");
     }
 
+    chip::System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+
     attempt.WillCoalesceWith(entryToUse->attempt);
     entryToUse->attempt        = attempt;
-    entryToUse->queryDueTime   = mClock->GetMonotonicTimestamp();
+    entryToUse->queryDueTime   = FirstQueryTime(*entryToUse, now);
     entryToUse->nextRetryDelay = System::Clock::Seconds16(1);
 }
 
+chip::System::Clock::Timestamp ActiveResolveAttempts::FirstQueryTime(const RetryEntry & entry, chip::System::Clock::Timestamp now)
+{
+    const bool inBurst   = mLastMarkPendingTime.has_value() && (now < *mLastMarkPendingTime + kMaxBurstQueryDelay);
+    mLastMarkPendingTime = now;
+
+    VerifyOrReturnValue(mDelayBurstQueries && inBurst, now);
+
+    // Join the first queries of the burst that are already waiting to be sent.
+    for (auto & other : mRetryQueue)
+    {
+        if ((&other != &entry) && !other.attempt.IsEmpty() && other.attempt.firstSend && (other.queryDueTime > now))
+        {
+            return other.queryDueTime;
+        }
+    }
+
+    const uint32_t jitterMs = (kMaxBurstQueryDelay - kMinBurstQueryDelay).count();
+    return now + kMinBurstQueryDelay + System::Clock::Milliseconds32(Crypto::GetRandU32() % (jitterMs + 1));
+}
+
 std::optional<System::Clock::Timeout> ActiveResolveAttempts::GetTimeUntilNextExpectedResponse() const
 {
     std::optional<System::Clock::Timeout> minDelay = std::nullopt;
@@ -224,6 +249,16 @@ std::optional<System::Clock::Timeout> ActiveResolveAttempts::GetTimeUntilNextExp
 }
 
 std::optional<ActiveResolveAttempts::ScheduledAttempt> ActiveResolveAttempts::NextScheduled()
+{
+    return FindNextScheduled(std::optional<bool>());
+}
+
+std::optional<ActiveResolveAttempts::ScheduledAttempt> ActiveResolveAttempts::NextScheduled(bool firstSend)
+{
+    return FindNextScheduled(std::make_optional(firstSend));
+}
+
+std::optional<ActiveResolveAttempts::ScheduledAttempt> ActiveResolveAttempts::FindNextScheduled(std::optional<bool> firstSend)
 {
     chip::System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
 
@@ -234,6 +269,11 @@ std::optional<ActiveResolveAttempts::ScheduledAttempt> ActiveResolveAttempts::Ne
             continue; // not a pending item
         }
 
+        if (firstSend.has_value() && (entry.attempt.firstSend != *firstSend))
+        {
+            continue; // goes in a different packet
+        }
+
         if (entry.queryDueTime > now)
         {
             continue; // not yet due
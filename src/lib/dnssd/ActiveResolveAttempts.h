@@ -44,6 +44,10 @@ public:
     static constexpr size_t kRetryQueueSize                      = 4;
     static constexpr chip::System::Clock::Timeout kMaxRetryDelay = chip::System::Clock::Seconds16(16);
 
+    // Range of the random delay of first queries marked pending in a burst, see SetDelayBurstQueries.
+    static constexpr chip::System::Clock::Timeout kMinBurstQueryDelay = chip::System::Clock::Milliseconds16(20);
+    static constexpr chip::System::Clock::Timeout kMaxBurstQueryDelay = chip::System::Clock::Milliseconds16(120);
+
     struct ScheduledAttempt
     {
         struct Browse
@@ -283,6 +287,20 @@ public:
     //    any peer that needs a new request sent
     std::optional<ScheduledAttempt> NextScheduled();
 
+    /// Same as NextScheduled(), only returning attempts for which `firstSend`
+    /// matches, i.e. that can go in the same query packet.
+    std::optional<ScheduledAttempt> NextScheduled(bool firstSend);
+
+    /// Delay first queries marked pending within kMaxBurstQueryDelay of a
+    /// previous one.
+    ///
+    /// The first attempt of a burst is scheduled right away. The following ones
+    /// all get the same random delay between kMinBurstQueryDelay and
+    /// kMaxBurstQueryDelay (RFC 6762 section 5.2), so that they can share a
+    /// single query packet and so that queriers starting at the same time do
+    /// not stay synchronized.
+    void SetDelayBurstQueries(bool delay) { mDelayBurstQueries = delay; }
+
     /// Check if any of the pending queries are for the given host name for
     /// IP resolution.
     bool IsWaitingForIpResolutionFor(SerializedQNameIterator hostName) const;
@@ -314,8 +332,13 @@ private:
         chip::System::Clock::Timeout nextRetryDelay = chip::System::Clock::Seconds16(1);
     };
     void MarkPending(ScheduledAttempt && attempt);
+    chip::System::Clock::Timestamp FirstQueryTime(const RetryEntry & entry, chip::System::Clock::Timestamp now);
+    std::optional<ScheduledAttempt> FindNextScheduled(std::optional<bool> firstSend);
+
     chip::System::Clock::ClockBase * mClock;
     RetryEntry mRetryQueue[kRetryQueueSize];
+    bool mDelayBurstQueries = false;
+    std::optional<chip::System::Clock::Timestamp> mLastMarkPendingTime;
 };
 
 } // namespace Minimal
@@ -38,6 +38,7 @@
 #include <lib/support/BytesToHex.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/IntrusiveList.h>
+#include <lib/support/MemoryTags.h>
 #include <lib/support/StringBuilder.h>
 
 // Enable detailed mDNS logging for received queries
@@ -437,6 +438,7 @@ void AdvertiserMinMdns::ClearServices()
 
     mQueryResponderAllocatorCommissionable.Clear();
     mQueryResponderAllocatorCommissioner.Clear();
+    mResponseSender.InvalidateResponseCache();
 }
 
 OperationalQueryAllocator::Allocator * AdvertiserMinMdns::FindOperationalAllocator(const FullQName & qname)
@@ -477,6 +479,10 @@ OperationalQueryAllocator::Allocator * AdvertiserMinMdns::FindEmptyOperationalAl
 CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters & params)
 {
     VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kDnssd);
+
+    // The records of an existing responder may be replaced below.
+    mResponseSender.InvalidateResponseCache();
 
     char nameBuffer[Operational::kInstanceNameMaxLength + 1] = "";
 
@@ -610,6 +616,9 @@ CHIP_ERROR AdvertiserMinMdns::UpdateCommissionableInstanceName()
 CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters & params)
 {
     VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kDnssd);
+
+    mResponseSender.InvalidateResponseCache();
 
     if (params.GetCommissionAdvertiseMode() == CommssionAdvertiseMode::kCommissionableNode)
     {
@@ -24,6 +24,8 @@
 #include <lib/support/CHIPMemString.h>
 #include <tracing/macros.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Dnssd {
 
@@ -185,6 +187,7 @@ CHIP_ERROR IncrementalResolver::InitializeParsing(mdns::Minimal::SerializedQName
                 return err;
             }
             mSpecificResolutionData.Get<OperationalNodeData>().hasZeroTTL = (ttl == 0);
+            LowerOperationalTtl(ttl);
         }
 
         LogFoundOperationalSrvRecord(mSpecificResolutionData.Get<OperationalNodeData>().peerId, mTargetHostName.Get());
@@ -263,7 +266,7 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
-        return OnIpAddress(interface, addr);
+        return OnIpAddress(interface, addr, data.GetTtlSeconds());
 #else
 #if CHIP_MINMDNS_HIGH_VERBOSITY
         ChipLogProgress(Discovery, "Ignoring A record: IPv4 not supported");
@@ -285,7 +288,7 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
-        return OnIpAddress(interface, addr);
+        return OnIpAddress(interface, addr, data.GetTtlSeconds());
     }
     case QType::SRV: // SRV handled on creation, ignored for 'additional data'
     default:
@@ -318,7 +321,7 @@ CHIP_ERROR IncrementalResolver::OnTxtRecord(const ResourceData & data, BytesRang
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr)
+CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr, uint64_t ttl)
 {
     if (mCommonResolutionData.numIPs >= MATTER_ARRAY_SIZE(mCommonResolutionData.ipAddress))
     {
@@ -338,11 +341,27 @@ CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const I
 
     mCommonResolutionData.ipAddress[mCommonResolutionData.numIPs++] = addr;
 
+    if (IsActiveOperationalParse())
+    {
+        LowerOperationalTtl(ttl);
+    }
+
     LogFoundIPAddress(mTargetHostName.Get(), addr);
 
     return CHIP_NO_ERROR;
 }
 
+void IncrementalResolver::LowerOperationalTtl(uint64_t ttl)
+{
+    auto & operationalData = mSpecificResolutionData.Get<OperationalNodeData>();
+    const System::Clock::Seconds32 recordTtl(static_cast<uint32_t>(std::min<uint64_t>(ttl, UINT32_MAX)));
+
+    if (!operationalData.ttl.has_value() || (recordTtl < *operationalData.ttl))
+    {
+        operationalData.ttl = recordTtl;
+    }
+}
+
 CHIP_ERROR IncrementalResolver::Take(DiscoveredNodeData & outputData)
 {
     VerifyOrReturnError(IsActiveCommissionParse(), CHIP_ERROR_INCORRECT_STATE);
@@ -184,7 +184,11 @@ private:
     /// addresses.
     ///
     /// Prerequisite: IP address belongs to the right nost name
-    CHIP_ERROR OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr);
+    CHIP_ERROR OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr, uint64_t ttl);
+
+    /// Lower the TTL of operational data to `ttl` seconds, if it is lower than
+    /// the TTLs of the records seen so far.
+    void LowerOperationalTtl(uint64_t ttl);
 
     using ParsedRecordSpecificData = Variant<OperationalNodeData, CommissionNodeData>;
 
@@ -27,6 +27,7 @@
 #include <lib/dnssd/minimal_mdns/QueryBuilder.h>
 #include <lib/dnssd/minimal_mdns/RecordData.h>
 #include <lib/dnssd/minimal_mdns/core/FlatAllocatedQName.h>
+#include <lib/dnssd/minimal_mdns/records/Ptr.h>
 #include <lib/support/CHIPMemString.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <tracing/macros.h>
@@ -270,6 +271,7 @@ public:
     MinMdnsResolver() : mActiveResolves(&chip::System::SystemClock()), mPacketParser(mActiveResolves)
     {
         GlobalMinimalMdnsServer::Instance().SetResponseDelegate(this);
+        mActiveResolves.SetDelayBurstQueries(true);
     }
     ~MinMdnsResolver() { SetDiscoveryContext(nullptr); }
 
@@ -294,6 +296,21 @@ private:
     ActiveResolveAttempts mActiveResolves;
     PacketParser mPacketParser;
 
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+    /// A node reported by the current browse, sent as a known answer in the browse retries.
+    struct KnownAnswer
+    {
+        DiscoveryType type = DiscoveryType::kUnknown;
+        char instanceName[Common::kInstanceNameMaxLength + 1];
+        System::Clock::Timestamp foundTime;
+    };
+    KnownAnswer mKnownAnswers[CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS];
+#endif // CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+
+    void AddKnownAnswer(DiscoveryType type, const char * instanceName);
+    void ForgetKnownAnswers(DiscoveryType type);
+    void AddKnownAnswers(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt::Browse & data);
+
     void SetDiscoveryContext(DiscoveryContext * context);
     void ScheduleIpAddressResolve(SerializedQNameIterator hostName);
 
@@ -304,6 +321,7 @@ private:
     CHIP_ERROR BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt & attempt);
 
     /// Prepare a query for specific resolve types
+    CHIP_ERROR BuildBrowseQName(const ActiveResolveAttempts::ScheduledAttempt::Browse & data, mdns::Minimal::FullQName & qname);
     CHIP_ERROR BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt::Browse & data, bool firstSend);
     CHIP_ERROR BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt::Resolve & data, bool firstSend);
     CHIP_ERROR BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt::IpResolve & data, bool firstSend);
@@ -435,6 +453,10 @@ void MinMdnsResolver::AdvancePendingResolverStates()
 
             if (discoveredNodeIsRelevant)
             {
+                AddKnownAnswer(resolver->GetCurrentType() == IncrementalResolver::ServiceNameType::kCommissioner
+                                   ? DiscoveryType::kCommissionerNode
+                                   : DiscoveryType::kCommissionableNode,
+                               nodeData.Get<CommissionNodeData>().instanceName);
                 if (mDiscoveryContext != nullptr)
                 {
                     mDiscoveryContext->OnNodeDiscovered(nodeData);
@@ -461,6 +483,11 @@ void MinMdnsResolver::AdvancePendingResolverStates()
 
             if (mActiveResolves.HasBrowseFor(chip::Dnssd::DiscoveryType::kOperational))
             {
+                char instanceName[Operational::kInstanceNameMaxLength + 1];
+                if (MakeInstanceName(instanceName, sizeof(instanceName), nodeResolvedData.operationalData.peerId) == CHIP_NO_ERROR)
+                {
+                    AddKnownAnswer(DiscoveryType::kOperational, instanceName);
+                }
                 if (mDiscoveryContext != nullptr)
                 {
                     DiscoveredNodeData nodeData;
@@ -536,11 +563,9 @@ void MinMdnsResolver::Shutdown()
     GlobalMinimalMdnsServer::Instance().ShutdownServer();
 }
 
-CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt::Browse & data,
-                                       bool firstSend)
+CHIP_ERROR MinMdnsResolver::BuildBrowseQName(const ActiveResolveAttempts::ScheduledAttempt::Browse & data,
+                                             mdns::Minimal::FullQName & qname)
 {
-    mdns::Minimal::FullQName qname;
-
     switch (data.type)
     {
     case DiscoveryType::kOperational:
@@ -591,6 +616,14 @@ CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResol
     }
 
     VerifyOrReturnError(qname.nameCount, CHIP_ERROR_NO_MEMORY);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt::Browse & data,
+                                       bool firstSend)
+{
+    mdns::Minimal::FullQName qname;
+    ReturnErrorOnFailure(BuildBrowseQName(data, qname));
 
     mdns::Minimal::Query query(qname);
     query
@@ -671,14 +704,12 @@ CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResol
 
 CHIP_ERROR MinMdnsResolver::SendAllPendingQueries()
 {
-    while (true)
-    {
-        std::optional<ActiveResolveAttempts::ScheduledAttempt> resolve = mActiveResolves.NextScheduled();
+    std::optional<ActiveResolveAttempts::ScheduledAttempt> resolve = mActiveResolves.NextScheduled();
 
-        if (!resolve.has_value())
-        {
-            break;
-        }
+    while (resolve.has_value())
+    {
+        // All the due attempts that are sent the same way share packets, as many queries per packet as fit.
+        const bool firstSend = resolve->firstSend;
 
         System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
         VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
@@ -688,7 +719,33 @@ CHIP_ERROR MinMdnsResolver::SendAllPendingQueries()
 
         ReturnErrorOnFailure(BuildQuery(builder, *resolve));
 
-        if (resolve->firstSend)
+        std::optional<ActiveResolveAttempts::ScheduledAttempt::Browse> browse;
+        while (resolve.has_value())
+        {
+            if (resolve->IsBrowse() && !browse.has_value())
+            {
+                browse.emplace(resolve->BrowseData());
+            }
+
+            resolve = mActiveResolves.NextScheduled(firstSend);
+            if (resolve.has_value())
+            {
+                CHIP_ERROR err = BuildQuery(builder, *resolve);
+                if (!builder.Ok())
+                {
+                    break; // does not fit, goes in the next packet
+                }
+                ReturnErrorOnFailure(err);
+            }
+        }
+
+        // Known answers go after all the queries: only the first browse of the packet gets them.
+        if (browse.has_value())
+        {
+            AddKnownAnswers(builder, *browse);
+        }
+
+        if (firstSend)
         {
             ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(builder.ReleasePacket(), kMdnsPort));
         }
@@ -696,6 +753,11 @@ CHIP_ERROR MinMdnsResolver::SendAllPendingQueries()
         {
             ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort));
         }
+
+        if (!resolve.has_value())
+        {
+            resolve = mActiveResolves.NextScheduled();
+        }
     }
 
     ExpireIncrementalResolvers();
@@ -739,6 +801,10 @@ CHIP_ERROR MinMdnsResolver::StopDiscovery(DiscoveryContext & context)
 {
     SetDiscoveryContext(nullptr);
 
+    ForgetKnownAnswers(DiscoveryType::kOperational);
+    ForgetKnownAnswers(DiscoveryType::kCommissionableNode);
+    ForgetKnownAnswers(DiscoveryType::kCommissionerNode);
+
     return mActiveResolves.CompleteAllBrowses();
 }
 
@@ -749,6 +815,8 @@ CHIP_ERROR MinMdnsResolver::ReconfirmRecord(const char * hostname, Inet::IPAddre
 
 CHIP_ERROR MinMdnsResolver::BrowseNodes(DiscoveryType type, DiscoveryFilter filter)
 {
+    // A new browse reports all the nodes again.
+    ForgetKnownAnswers(type);
     mActiveResolves.MarkPending(filter, type);
 
     return SendAllPendingQueries();
@@ -766,6 +834,90 @@ void MinMdnsResolver::NodeIdResolutionNoLongerNeeded(const PeerId & peerId)
     mActiveResolves.NodeIdResolutionNoLongerNeeded(peerId);
 }
 
+void MinMdnsResolver::AddKnownAnswer(DiscoveryType type, const char * instanceName)
+{
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+    // Use the entry for the same node, or a free one, or replace the oldest one.
+    KnownAnswer * entry = &mKnownAnswers[0];
+    for (auto & known : mKnownAnswers)
+    {
+        if ((known.type == type) && (strcmp(known.instanceName, instanceName) == 0))
+        {
+            entry = &known;
+            break;
+        }
+        if ((entry->type != DiscoveryType::kUnknown) &&
+            ((known.type == DiscoveryType::kUnknown) || (known.foundTime < entry->foundTime)))
+        {
+            entry = &known;
+        }
+    }
+
+    entry->type = type;
+    Platform::CopyString(entry->instanceName, instanceName);
+    entry->foundTime = System::SystemClock().GetMonotonicTimestamp();
+#endif // CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+}
+
+void MinMdnsResolver::ForgetKnownAnswers(DiscoveryType type)
+{
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+    for (auto & known : mKnownAnswers)
+    {
+        if (known.type == type)
+        {
+            known.type = DiscoveryType::kUnknown;
+        }
+    }
+#endif // CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+}
+
+void MinMdnsResolver::AddKnownAnswers(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt::Browse & data)
+{
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+    // Browses for an instance name are not PTR queries.
+    VerifyOrReturn(data.filter.type != DiscoveryFilterType::kInstanceName);
+
+    const char * serviceName = kOperationalServiceName;
+    const char * protocol    = kOperationalProtocol;
+    if (data.type == DiscoveryType::kCommissionableNode)
+    {
+        serviceName = kCommissionableServiceName;
+        protocol    = kCommissionProtocol;
+    }
+    else if (data.type == DiscoveryType::kCommissionerNode)
+    {
+        serviceName = kCommissionerServiceName;
+        protocol    = kCommissionProtocol;
+    }
+
+    mdns::Minimal::FullQName qname;
+    VerifyOrReturn(BuildBrowseQName(data, qname) == CHIP_NO_ERROR);
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    for (auto & known : mKnownAnswers)
+    {
+        if (known.type != data.type)
+        {
+            continue;
+        }
+
+        // The TTL used by the responder is not kept, so assume it is the default one. Answers are only
+        // known while they have more than half of their TTL left.
+        const uint32_t elapsedSeconds = std::chrono::duration_cast<System::Clock::Seconds32>(now - known.foundTime).count();
+        if (elapsedSeconds >= ResourceRecord::kDefaultTtl / 2)
+        {
+            continue;
+        }
+
+        const char * instanceQName[] = { known.instanceName, serviceName, protocol, kLocalDomain };
+        PtrResourceRecord record(qname, instanceQName);
+        record.SetTtl(ResourceRecord::kDefaultTtl - elapsedSeconds);
+        VerifyOrReturn(builder.AddKnownAnswer(record));
+    }
+#endif // CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+}
+
 CHIP_ERROR MinMdnsResolver::ScheduleRetries()
 {
     MATTER_TRACE_SCOPE("Schedule retries", "MinMdnsResolver");
@@ -210,7 +210,13 @@ struct OperationalNodeData
 {
     PeerId peerId;
     bool hasZeroTTL;
-    void Reset() { peerId = PeerId(); }
+    // Lowest TTL of the SRV and address records the data was resolved from, if known.
+    std::optional<System::Clock::Seconds32> ttl;
+    void Reset()
+    {
+        peerId = PeerId();
+        ttl.reset();
+    }
 };
 
 struct OperationalNodeBrowseData : public OperationalNodeData
@@ -21,6 +21,7 @@
 
 #include <lib/dnssd/minimal_mdns/Query.h>
 #include <lib/dnssd/minimal_mdns/core/DnsHeader.h>
+#include <lib/dnssd/minimal_mdns/records/ResourceRecord.h>
 
 namespace mdns {
 namespace Minimal {
@@ -28,8 +29,11 @@ namespace Minimal {
 class QueryBuilder
 {
 public:
-    QueryBuilder() : mHeader(nullptr) {}
-    QueryBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr) { Reset(std::move(packet)); }
+    QueryBuilder() : mHeader(nullptr), mEndianOutput(nullptr, 0), mWriter(&mEndianOutput) {}
+    QueryBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr), mEndianOutput(nullptr, 0), mWriter(&mEndianOutput)
+    {
+        Reset(std::move(packet));
+    }
 
     QueryBuilder & Reset(chip::System::PacketBufferHandle && packet)
     {
@@ -47,6 +51,14 @@ public:
         }
 
         mHeader.SetFlags(mHeader.GetFlags().SetQuery());
+
+        mEndianOutput =
+            chip::Encoding::BigEndian::BufferWriter(mPacket->Start(), mPacket->DataLength() + mPacket->AvailableDataLength());
+        mEndianOutput.Skip(mPacket->DataLength());
+
+        mWriter.Reset();
+        mKnownAnswersFull = false;
+
         return *this;
     }
 
@@ -67,26 +79,49 @@ public:
             return *this;
         }
 
-        chip::Encoding::BigEndian::BufferWriter out(mPacket->Start() + mPacket->DataLength(), mPacket->AvailableDataLength());
-        RecordWriter writer(&out);
-
-        if (!query.Append(mHeader, writer))
+        if (!query.Append(mHeader, mWriter))
         {
             mQueryBuildOk = false;
         }
         else
         {
-            mPacket->SetDataLength(static_cast<uint16_t>(mPacket->DataLength() + out.Needed()));
+            mPacket->SetDataLength(static_cast<uint16_t>(mEndianOutput.Needed()));
         }
         return *this;
     }
 
+    /// Adds a record that the querier already has, so that responders do not
+    /// send it again (known-answer suppression, RFC 6762 section 7.1).
+    ///
+    /// Known answers go after all the queries. A known answer that does not fit is
+    /// dropped, as are all the ones added after it: this returns false, and the packet
+    /// is left as it was.
+    bool AddKnownAnswer(const ResourceRecord & record)
+    {
+        if (!mQueryBuildOk || mKnownAnswersFull)
+        {
+            return false;
+        }
+
+        if (!record.Append(mHeader, ResourceType::kAnswer, mWriter))
+        {
+            mKnownAnswersFull = true;
+            return false;
+        }
+
+        mPacket->SetDataLength(static_cast<uint16_t>(mEndianOutput.Needed()));
+        return true;
+    }
+
     bool Ok() const { return mQueryBuildOk; }
 
 private:
     chip::System::PacketBufferHandle mPacket;
     HeaderRef mHeader;
-    bool mQueryBuildOk = true;
+    chip::Encoding::BigEndian::BufferWriter mEndianOutput;
+    RecordWriter mWriter;
+    bool mQueryBuildOk     = true;
+    bool mKnownAnswersFull = false;
 };
 
 } // namespace Minimal
@@ -21,6 +21,8 @@
 
 #include <system/SystemClock.h>
 
+#include <string.h>
+
 namespace mdns {
 namespace Minimal {
 
@@ -37,6 +39,44 @@ constexpr uint16_t kMdnsStandardPort = 5353;
 //    the header.
 constexpr uint16_t kPacketSizeBytes = 512;
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
+/// Writes the labels of `name` as length-prefixed labels into `out`, or just computes their
+/// length if `out` is nullptr. Returns 0 if the name is not valid.
+size_t EncodeQueryName(SerializedQNameIterator name, uint8_t * out)
+{
+    size_t length = 0;
+    while (name.Next())
+    {
+        const size_t labelLength = strlen(name.Value());
+        if (out != nullptr)
+        {
+            out[length] = static_cast<uint8_t>(labelLength);
+            memcpy(out + length + 1, name.Value(), labelLength);
+        }
+        length += labelLength + 1;
+    }
+    return name.IsValid() ? length : 0;
+}
+
+bool QueryNameMatches(SerializedQNameIterator name, const uint8_t * encoded, size_t encodedLength)
+{
+    size_t offset = 0;
+    while (name.Next())
+    {
+        const size_t labelLength = strlen(name.Value());
+        if ((offset + labelLength + 1 > encodedLength) || (encoded[offset] != labelLength) ||
+            (memcmp(encoded + offset + 1, name.Value(), labelLength) != 0))
+        {
+            return false;
+        }
+        offset += labelLength + 1;
+    }
+    return name.IsValid() && (offset == encodedLength);
+}
+
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 } // namespace
 namespace Internal {
 
@@ -62,11 +102,13 @@ CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder
         if (responder == nullptr || responder == queryResponder)
         {
             responder = queryResponder;
+            InvalidateResponseCache();
             return CHIP_NO_ERROR;
         }
     }
 
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
+    InvalidateResponseCache();
     mResponders.push_back(queryResponder);
     return CHIP_NO_ERROR;
 #else
@@ -81,6 +123,7 @@ CHIP_ERROR ResponseSender::RemoveQueryResponder(QueryResponderBase * queryRespon
         if (*it == queryResponder)
         {
             *it = nullptr;
+            InvalidateResponseCache();
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
             mResponders.erase(it);
 #endif
@@ -102,11 +145,119 @@ bool ResponseSender::HasQueryResponders() const
     return false;
 }
 
+void ResponseSender::InvalidateResponseCache()
+{
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    for (auto & cached : mCache)
+    {
+        cached.mValid = false;
+        cached.mName.Free();
+        cached.mPacket = nullptr;
+    }
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+}
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
+bool ResponseSender::IsCacheable(const QueryData & query, const ResponseSendingState & state,
+                                 const ResponseConfiguration & configuration)
+{
+    // Multicast replies depend on when each record was last multicast, and announcements
+    // and TTL overrides are one-off replies.
+    return state.SendUnicast() && !query.IsAnnounceBroadcast() && !configuration.GetTtlSecondsOverride().has_value();
+}
+
+ResponseSender::CachedReply * ResponseSender::FindCachedReply(const QueryData & query, chip::System::Clock::Timestamp now)
+{
+    for (auto & cached : mCache)
+    {
+        if (cached.mValid && (now - cached.mCreated >= kMaxCachedReplyAge))
+        {
+            cached.mValid = false;
+            cached.mName.Free();
+            cached.mPacket = nullptr;
+        }
+        if (!cached.mValid || (cached.mType != query.GetType()) || (cached.mClass != query.GetClass()) ||
+            (cached.mUnicastAnswer != query.RequestedUnicastAnswer()) || (cached.mIncludeQuery != mSendState.IncludeQuery()) ||
+            (cached.mInterface != mSendState.GetSourceInterfaceId()) ||
+            (cached.mAddressType != mSendState.GetSourceAddress().Type()))
+        {
+            continue;
+        }
+        if (QueryNameMatches(query.GetName(), cached.mName.Get(), cached.mNameLength))
+        {
+            return &cached;
+        }
+    }
+    return nullptr;
+}
+
+void ResponseSender::CacheReply(const QueryData & query, chip::System::Clock::Timestamp now)
+{
+    const size_t nameLength = EncodeQueryName(query.GetName(), nullptr);
+    VerifyOrReturn(nameLength > 0);
+
+    // Use a free entry, or replace the oldest one.
+    CachedReply * cached = &mCache[0];
+    for (auto & entry : mCache)
+    {
+        if (!entry.mValid)
+        {
+            cached = &entry;
+            break;
+        }
+        if (entry.mCreated < cached->mCreated)
+        {
+            cached = &entry;
+        }
+    }
+
+    cached->mValid = false;
+    VerifyOrReturn(cached->mName.Alloc(nameLength));
+    EncodeQueryName(query.GetName(), cached->mName.Get());
+    cached->mNameLength    = nameLength;
+    cached->mType          = query.GetType();
+    cached->mClass         = query.GetClass();
+    cached->mUnicastAnswer = query.RequestedUnicastAnswer();
+    cached->mIncludeQuery  = mSendState.IncludeQuery();
+    cached->mInterface     = mSendState.GetSourceInterfaceId();
+    cached->mAddressType   = mSendState.GetSourceAddress().Type();
+    cached->mCreated       = now;
+    cached->mPacket        = std::move(mCapturedPacket);
+    cached->mValid         = true;
+}
+
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
                                    const ResponseConfiguration & configuration)
 {
     mSendState.Reset(messageId, query, querySource);
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    const chip::System::Clock::Timestamp cacheTime = chip::System::SystemClock().GetMonotonicTimestamp();
+
+    mCapturing      = IsCacheable(query, mSendState, configuration);
+    mCapturedPacket = nullptr;
+    if (mCapturing)
+    {
+        CachedReply * cached = FindCachedReply(query, cacheTime);
+        if (cached != nullptr)
+        {
+            mCapturing = false;
+            mCacheStats.mHits++;
+            VerifyOrReturnError(!cached->mPacket.IsNull(), CHIP_NO_ERROR); // nothing to send
+
+            chip::System::PacketBufferHandle reply = cached->mPacket.CloneData();
+            VerifyOrReturnError(!reply.IsNull(), CHIP_ERROR_NO_MEMORY);
+            HeaderRef(reply->Start()).SetMessageId(messageId);
+            return mServer->DirectSend(std::move(reply), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                                       mSendState.GetSourceInterfaceId());
+        }
+        mCacheStats.mMisses++;
+    }
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
     if (query.IsAnnounceBroadcast())
     {
         // Deny listing large amount of data
@@ -195,7 +346,18 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
         }
     }
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    ReturnErrorOnFailure(FlushReply());
+    if (mCapturing)
+    {
+        mCapturing = false;
+        CacheReply(query, cacheTime);
+    }
+    mCapturedPacket = nullptr;
+    return CHIP_NO_ERROR;
+#else
     return FlushReply();
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
 }
 
 CHIP_ERROR ResponseSender::FlushReply()
@@ -213,8 +375,17 @@ CHIP_ERROR ResponseSender::FlushReply()
             ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString,
                           mSendState.GetSourcePort());
 #endif
-            ReturnErrorOnFailure(mServer->DirectSend(mResponseBuilder.ReleasePacket(), mSendState.GetSourceAddress(),
-                                                     mSendState.GetSourcePort(), mSendState.GetSourceInterfaceId()));
+            chip::System::PacketBufferHandle reply = mResponseBuilder.ReleasePacket();
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+            if (mCapturing)
+            {
+                // Keep a copy so that the same query can be answered without building the reply again.
+                mCapturedPacket = reply.CloneData();
+                mCapturing      = !mCapturedPacket.IsNull();
+            }
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+            ReturnErrorOnFailure(mServer->DirectSend(std::move(reply), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                                                     mSendState.GetSourceInterfaceId()));
         }
         else
         {
@@ -308,6 +479,11 @@ void ResponseSender::AddResponse(const ResourceRecord & record)
     {
         mResponseBuilder.Header().SetFlags(mResponseBuilder.Header().GetFlags().SetTruncated(true));
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+        // Only single packet replies are cached.
+        mCapturing = false;
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
         ReturnOnFailure(mSendState.SetError(FlushReply()));
         ReturnOnFailure(mSendState.SetError(PrepareNewReplyPacket()));
 
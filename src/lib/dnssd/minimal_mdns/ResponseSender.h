@@ -22,7 +22,9 @@
 #include "Server.h"
 
 #include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
+#include <lib/support/ScopedBuffer.h>
 
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
@@ -125,9 +127,25 @@ private:
 ///
 /// Handles processing the query via a QueryResponderBase and then sending back the reply
 /// using appropriate paths (unicast or multicast) via the given Server.
+///
+/// Unicast replies that fit in a single packet are kept serialized (see
+/// CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE), so that the same query from the same
+/// interface is answered with a copy of the previous reply. The cache is dropped
+/// whenever query responders are added or removed; owners that change the records of
+/// an existing query responder must call InvalidateResponseCache.
 class ResponseSender : public ResponderDelegate
 {
 public:
+    struct CacheStats
+    {
+        uint32_t mHits   = 0; ///< Queries answered with a cached reply
+        uint32_t mMisses = 0; ///< Cacheable queries for which the reply had to be built
+    };
+
+    /// How long a cached reply is used for. Bounds how stale the addresses in a reply
+    /// can get, since interface address changes do not invalidate the cache.
+    static constexpr chip::System::Clock::Milliseconds32 kMaxCachedReplyAge = chip::System::Clock::Seconds16(10);
+
     ResponseSender(ServerBase * server) : mServer(server) {}
 
     CHIP_ERROR AddQueryResponder(QueryResponderBase * queryResponder);
@@ -143,12 +161,49 @@ public:
     bool ShouldSend(const Responder &) const override;
     void ResponsesAdded(const Responder &) override;
 
-    void SetServer(ServerBase * server) { mServer = server; }
+    void SetServer(ServerBase * server)
+    {
+        mServer = server;
+        InvalidateResponseCache();
+    }
+
+    /// Drop all cached replies. Must be called when the records of a query responder change.
+    void InvalidateResponseCache();
+
+    const CacheStats & GetCacheStats() const { return mCacheStats; }
+    void ResetCacheStats() { mCacheStats = CacheStats(); }
 
 private:
     CHIP_ERROR FlushReply();
     CHIP_ERROR PrepareNewReplyPacket();
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    struct CachedReply
+    {
+        bool mValid = false;
+        chip::Platform::ScopedMemoryBuffer<uint8_t> mName; // query name, as uncompressed length-prefixed labels
+        size_t mNameLength  = 0;
+        QType mType         = QType::ANY;
+        QClass mClass       = QClass::IN;
+        bool mUnicastAnswer = false;
+        bool mIncludeQuery  = false;
+        chip::Inet::InterfaceId mInterface;
+        chip::Inet::IPAddressType mAddressType = chip::Inet::IPAddressType::kUnknown;
+        chip::System::Clock::Timestamp mCreated;
+        chip::System::PacketBufferHandle mPacket; // null if nothing was sent in reply
+    };
+
+    static bool IsCacheable(const QueryData & query, const Internal::ResponseSendingState & state,
+                            const ResponseConfiguration & configuration);
+    CachedReply * FindCachedReply(const QueryData & query, chip::System::Clock::Timestamp now);
+    void CacheReply(const QueryData & query, chip::System::Clock::Timestamp now);
+
+    CachedReply mCache[CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE];
+    chip::System::PacketBufferHandle mCapturedPacket; // copy of the reply being sent, if it can be cached
+    bool mCapturing = false;                          // whether the reply being built can be cached
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    CacheStats mCacheStats;
+
     ServerBase * mServer;
     QueryResponderPtrPool mResponders = {};
 
@@ -21,6 +21,7 @@
 #include <utility>
 
 #include <lib/dnssd/minimal_mdns/core/DnsHeader.h>
+#include <lib/support/MemoryTags.h>
 #include <platform/CHIPDeviceLayer.h>
 
 namespace mdns {
@@ -426,6 +427,7 @@ CHIP_ERROR ServerBase::BroadcastImpl(chip::System::PacketBufferHandle && data, u
 void ServerBase::OnUdpPacketReceived(chip::Inet::UDPEndPoint * endPoint, chip::System::PacketBufferHandle && buffer,
                                      const chip::Inet::IPPacketInfo * info)
 {
+    chip::Platform::ScopedMemoryTag memoryTag(chip::Platform::MemoryTag::kDnssd);
     ServerBase * srv = static_cast<ServerBase *>(endPoint->mAppState);
     if (!srv->mDelegate)
     {
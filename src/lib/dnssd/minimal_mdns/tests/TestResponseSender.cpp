@@ -351,4 +351,85 @@ TEST_F(TestResponseSender, PtrSrvTxtMultipleRespondersToServiceListing)
     EXPECT_TRUE(common1->server.GetHeaderFound());
 }
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+TEST_F(TestResponseSender, RepeatedQueryUsesCachedReply)
+{
+    CommonTestElements common("test");
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+    common.queryResponder.AddResponder(&common.txtResponder);
+
+    common.recordWriter.WriteQName(common.instance);
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_SUCCESS(responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseSender.GetCacheStats().mMisses, 1u);
+    EXPECT_EQ(responseSender.GetCacheStats().mHits, 0u);
+
+    // The same query gets the same reply, without building it again.
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_SUCCESS(responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseSender.GetCacheStats().mHits, 1u);
+
+    // A different query type is not answered from the cache.
+    QueryData srvQueryData = QueryData(QType::SRV, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_SUCCESS(responseSender.Respond(3, srvQueryData, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseSender.GetCacheStats().mMisses, 2u);
+
+    // A unicast reply to the mDNS port does not include the query, so is cached separately.
+    QueryData unicastQueryData = QueryData(QType::ANY, QClass::IN, true, common.requestNameStart, common.requestBytesRange);
+    Inet::IPPacketInfo mdnsPortSource = common.packetInfo;
+    mdnsPortSource.SrcPort            = 5353;
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_SUCCESS(responseSender.Respond(4, unicastQueryData, &mdnsPortSource, ResponseConfiguration()));
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseSender.GetCacheStats().mMisses, 3u);
+    EXPECT_EQ(responseSender.GetCacheStats().mHits, 1u);
+}
+
+TEST_F(TestResponseSender, CachedReplyInvalidation)
+{
+    CommonTestElements common("test");
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+
+    common.recordWriter.WriteQName(common.instance);
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    // Having nothing to reply is cached as well.
+    EXPECT_SUCCESS(responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_SUCCESS(responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_FALSE(common.server.GetSendCalled());
+    EXPECT_EQ(responseSender.GetCacheStats().mHits, 1u);
+
+    // Once the records change, the reply is built again.
+    common.queryResponder.AddResponder(&common.srvResponder);
+    responseSender.InvalidateResponseCache();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_SUCCESS(responseSender.Respond(3, queryData, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseSender.GetCacheStats().mMisses, 2u);
+
+    // Removing a query responder drops the cache too.
+    EXPECT_EQ(responseSender.RemoveQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.server.Reset();
+    EXPECT_SUCCESS(responseSender.Respond(4, queryData, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_FALSE(common.server.GetSendCalled());
+    EXPECT_EQ(responseSender.GetCacheStats().mMisses, 3u);
+}
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 } // namespace
@@ -382,4 +382,59 @@ TEST(TestActiveResolveAttempts, TestCombination)
     EXPECT_FALSE(attempts.GetTimeUntilNextExpectedResponse().has_value());
     EXPECT_FALSE(attempts.NextScheduled().has_value());
 }
+TEST(TestActiveResolveAttempts, TestNextScheduledForSendType)
+{
+    System::Clock::Internal::MockClock mockClock;
+    mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
+
+    attempts.MarkPending(MakePeerId(1));
+    EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(1, true));
+
+    // Peer 1 is due for a retry when peer 2 is added
+    mockClock.AdvanceMonotonic(1000_ms32);
+    attempts.MarkPending(MakePeerId(2));
+
+    EXPECT_EQ(attempts.NextScheduled(true), ScheduledPeer(2, true));
+    EXPECT_FALSE(attempts.NextScheduled(true).has_value());
+    EXPECT_EQ(attempts.NextScheduled(false), ScheduledPeer(1, false));
+    EXPECT_FALSE(attempts.NextScheduled(false).has_value());
+    EXPECT_FALSE(attempts.NextScheduled().has_value());
+}
+
+TEST(TestActiveResolveAttempts, TestBurstQueryDelay)
+{
+    System::Clock::Internal::MockClock mockClock;
+    mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
+    attempts.SetDelayBurstQueries(true);
+
+    mockClock.AdvanceMonotonic(1234_ms32);
+
+    // The first attempt goes out right away
+    attempts.MarkPending(MakePeerId(1));
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(0_ms32));
+    EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(1, true));
+
+    // The following ones are delayed, all until the same time
+    mockClock.AdvanceMonotonic(10_ms32);
+    attempts.MarkPending(MakePeerId(2));
+    mockClock.AdvanceMonotonic(10_ms32);
+    attempts.MarkPending(MakePeerId(3));
+    EXPECT_FALSE(attempts.NextScheduled().has_value());
+
+    std::optional<Timeout> delay = attempts.GetTimeUntilNextExpectedResponse();
+    ASSERT_TRUE(delay.has_value());
+    EXPECT_GE(*delay, ActiveResolveAttempts::kMinBurstQueryDelay - 10_ms32);
+    EXPECT_LE(*delay, ActiveResolveAttempts::kMaxBurstQueryDelay - 10_ms32);
+
+    mockClock.AdvanceMonotonic(*delay);
+    EXPECT_EQ(attempts.NextScheduled(true), ScheduledPeer(2, true));
+    EXPECT_EQ(attempts.NextScheduled(true), ScheduledPeer(3, true));
+    EXPECT_FALSE(attempts.NextScheduled(true).has_value());
+
+    // Once the burst is over, attempts go out right away again
+    mockClock.AdvanceMonotonic(ActiveResolveAttempts::kMaxBurstQueryDelay);
+    attempts.MarkPending(MakePeerId(4));
+    EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(4, true));
+}
+
 } // namespace
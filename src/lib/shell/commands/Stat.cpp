@@ -17,6 +17,7 @@
 #include <lib/shell/Commands.h>
 #include <lib/shell/Engine.h>
 #include <lib/shell/SubShellCommand.h>
+#include <lib/support/ObjectPoolRegistry.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/DiagnosticDataProvider.h>
@@ -65,6 +66,25 @@ CHIP_ERROR StatPeakHandler(int argc, char ** argv)
     return CHIP_NO_ERROR;
 }
 
+#if CHIP_CONFIG_OBJECT_POOL_REGISTRY
+CHIP_ERROR StatPoolsHandler(int argc, char ** argv)
+{
+    ObjectPoolRegistry::ForEach([](const ObjectPoolRegistration & registration) {
+        streamer_printf(streamer_get(), "%s: in use %u, peak %u, failed %u", registration.GetNames().mName,
+                        static_cast<unsigned>(registration.Allocated()), static_cast<unsigned>(registration.HighWaterMark()),
+                        static_cast<unsigned>(registration.FailedAllocations()));
+        if (registration.Capacity() != SIZE_MAX)
+        {
+            streamer_printf(streamer_get(), ", capacity %u", static_cast<unsigned>(registration.Capacity()));
+        }
+        streamer_printf(streamer_get(), "\r\n");
+        return Loop::Continue;
+    });
+
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_CONFIG_OBJECT_POOL_REGISTRY
+
 CHIP_ERROR StatResetHandler(int argc, char ** argv)
 {
     auto current    = System::Stats::GetResourcesInUse();
@@ -75,6 +95,8 @@ CHIP_ERROR StatResetHandler(int argc, char ** argv)
         watermarks[i] = current[i];
     }
 
+    ObjectPoolRegistry::ResetStatistics();
+
     if (DeviceLayer::GetDiagnosticDataProvider().SupportsWatermarks())
     {
         ReturnErrorOnFailure(DeviceLayer::GetDiagnosticDataProvider().ResetWatermarks());
@@ -93,7 +115,10 @@ void RegisterStatCommands()
 {
     static constexpr Command subCommands[] = {
         { &StatPeakHandler, "peak", "Print peak usage of system resources" },
-        { &StatResetHandler, "reset", "Reset peak usage of system resources" },
+#if CHIP_CONFIG_OBJECT_POOL_REGISTRY
+        { &StatPoolsHandler, "pools", "Print usage of object pools" },
+#endif
+        { &StatResetHandler, "reset", "Reset peak usage of system resources and object pools" },
     };
 
     static constexpr Command statCommand = { &SubShellCommand<MATTER_ARRAY_SIZE(subCommands), subCommands>, "stat",
@@ -111,10 +111,64 @@ static uint8_t Base64URLCharToVal(uint8_t c)
     return UINT8_MAX;
 }
 
+static const char kBase64Alphabet[]    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char kBase64URLAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// Encodes the whole 3-byte groups of the input with a table lookup per character.
+static void Base64EncodeGroups(const uint8_t *& in, uint16_t & inLen, char *& out, const char * alphabet)
+{
+    while (inLen >= 3)
+    {
+        const uint32_t group = static_cast<uint32_t>(in[0] << 16 | in[1] << 8 | in[2]);
+        out[0]               = alphabet[(group >> 18) & 0x3F];
+        out[1]               = alphabet[(group >> 12) & 0x3F];
+        out[2]               = alphabet[(group >> 6) & 0x3F];
+        out[3]               = alphabet[group & 0x3F];
+        in += 3;
+        inLen = static_cast<uint16_t>(inLen - 3);
+        out += 4;
+    }
+}
+
+// Decodes whole 4-character groups of the input for as long as none of them is padding, whitespace or invalid.  The
+// rest, if any, is left to the general loop of Base64Decode.
+template <uint8_t (*kCharToVal)(uint8_t)>
+static void Base64DecodeGroups(const char *& in, uint16_t & inLen, uint8_t *& out)
+{
+    while (inLen >= 4)
+    {
+        const uint8_t a = kCharToVal(static_cast<uint8_t>(in[0]));
+        const uint8_t b = kCharToVal(static_cast<uint8_t>(in[1]));
+        const uint8_t c = kCharToVal(static_cast<uint8_t>(in[2]));
+        const uint8_t d = kCharToVal(static_cast<uint8_t>(in[3]));
+        // Values are below 64, so UINT8_MAX is the only one with the high bits set.
+        if ((a | b | c | d) & 0xC0)
+        {
+            return;
+        }
+        out[0] = static_cast<uint8_t>((a << 2) | (b >> 4));
+        out[1] = static_cast<uint8_t>((b << 4) | (c >> 2));
+        out[2] = static_cast<uint8_t>((c << 6) | d);
+        in += 4;
+        inLen = static_cast<uint16_t>(inLen - 4);
+        out += 3;
+    }
+}
+
 uint16_t Base64Encode(const uint8_t * in, uint16_t inLen, char * out, Base64ValToCharFunct valToCharFunct)
 {
     char * outStart = out;
 
+    // The built-in alphabets skip the per-character calls for all but the last group.
+    if (valToCharFunct == Base64ValToChar)
+    {
+        Base64EncodeGroups(in, inLen, out, kBase64Alphabet);
+    }
+    else if (valToCharFunct == Base64URLValToChar)
+    {
+        Base64EncodeGroups(in, inLen, out, kBase64URLAlphabet);
+    }
+
     while (inLen > 0)
     {
         uint8_t val1, val2, val3, val4;
@@ -201,6 +255,15 @@ uint16_t Base64Decode(const char * in, uint16_t inLen, uint8_t * out, Base64Char
 {
     uint8_t * outStart = out;
 
+    if (charToValFunct == Base64CharToVal)
+    {
+        Base64DecodeGroups<Base64CharToVal>(in, inLen, out);
+    }
+    else if (charToValFunct == Base64URLCharToVal)
+    {
+        Base64DecodeGroups<Base64URLCharToVal>(in, inLen, out);
+    }
+
     // isgraph() returns false for space and ctrl chars
     while (inLen > 0 && isgraph(*in))
     {
@@ -26,51 +26,38 @@ namespace Encoding {
 
 namespace {
 
-char NibbleToHex(uint8_t nibble, bool uppercase)
-{
-    char x = static_cast<char>(nibble & 0xFu);
-
-    if (x >= 10)
-    {
-        return static_cast<char>((x - 10) + (uppercase ? 'A' : 'a'));
-    }
+constexpr char kLowercaseHexDigits[] = "0123456789abcdef";
+constexpr char kUppercaseHexDigits[] = "0123456789ABCDEF";
 
-    return static_cast<char>(x + '0');
-}
+// Marks lowercase digits in kHexDigitValues, which the kUppercase flag rejects.
+constexpr uint8_t kLowercaseDigitFlag = 0x10;
+// High bits set only for characters that are not hex digits.
+constexpr uint8_t kInvalidDigitMask = 0xE0;
 
-CHIP_ERROR MakeU8FromAsciiHex(const char * src, const size_t srcLen, uint8_t * val, BitFlags<HexFlags> flags)
+struct HexDigitValues
 {
-    if (srcLen != 2)
-    {
-        return CHIP_ERROR_INVALID_ARGUMENT;
-    }
-    uint8_t ret = 0;
-    for (size_t i = 0; i < srcLen; ++i)
+    constexpr HexDigitValues() : values()
     {
-        ret          = static_cast<uint8_t>(ret << 4);
-        char c       = src[i];
-        uint8_t cval = static_cast<uint8_t>(c);
-        if (c >= '0' && c <= '9')
+        for (size_t c = 0; c < sizeof(values); c++)
         {
-            ret = static_cast<uint8_t>(ret + cval - static_cast<uint8_t>('0'));
+            values[c] = UINT8_MAX;
         }
-        else if (c >= 'A' && c <= 'F')
+        for (uint8_t i = 0; i < 10; i++)
         {
-            ret = static_cast<uint8_t>(ret + cval - static_cast<uint8_t>('A') + 0xA);
+            values['0' + i] = i;
         }
-        // If kUppercase flag is not set then lowercase are also allowed.
-        else if (!flags.Has(HexFlags::kUppercase) && c >= 'a' && c <= 'f')
+        for (uint8_t i = 0; i < 6; i++)
         {
-            ret = static_cast<uint8_t>(ret + cval - static_cast<uint8_t>('a') + 0xA);
-        }
-        else
-        {
-            return CHIP_ERROR_INVALID_ARGUMENT;
+            values['A' + i] = static_cast<uint8_t>(0xA + i);
+            values['a' + i] = static_cast<uint8_t>(kLowercaseDigitFlag | (0xA + i));
         }
     }
-    *val = ret;
-    return CHIP_NO_ERROR;
-}
+
+    uint8_t values[256];
+};
+
+// Decoding is a lookup per character rather than a chain of range checks.
+constexpr HexDigitValues kHexDigitValues;
 
 size_t HexToBytes(const char * src_hex, const size_t src_size, uint8_t * dest_bytes, size_t dest_size_max, BitFlags<HexFlags> flags)
 {
@@ -85,13 +72,18 @@ size_t HexToBytes(const char * src_hex, const size_t src_size, uint8_t * dest_by
         return 0;
     }
 
-    size_t bytesFilled = 0;
+    // If kUppercase flag is not set then lowercase are also allowed.
+    const uint8_t rejectMask = flags.Has(HexFlags::kUppercase) ? (kInvalidDigitMask | kLowercaseDigitFlag) : kInvalidDigitMask;
+
+    // Both digits are read before the byte is written, so that decoding in place works.
     for (size_t i = 0; i < src_size; i += 2)
     {
-        VerifyOrReturnError(MakeU8FromAsciiHex(src_hex + i, 2, &dest_bytes[i / 2], flags) == CHIP_NO_ERROR, 0);
-        bytesFilled++;
+        const uint8_t high = kHexDigitValues.values[static_cast<uint8_t>(src_hex[i])];
+        const uint8_t low  = kHexDigitValues.values[static_cast<uint8_t>(src_hex[i + 1])];
+        VerifyOrReturnError(((high | low) & rejectMask) == 0, 0);
+        dest_bytes[i / 2] = static_cast<uint8_t>(((high & 0xFu) << 4) | (low & 0xFu));
     }
-    return bytesFilled;
+    return src_size / 2;
 }
 
 } // namespace
@@ -123,12 +115,12 @@ CHIP_ERROR BytesToHex(const uint8_t * src_bytes, size_t src_size, char * dest_he
         return CHIP_ERROR_BUFFER_TOO_SMALL;
     }
 
-    bool uppercase = flags.Has(HexFlags::kUppercase);
-    char * cursor  = dest_hex;
+    const char * digits = flags.Has(HexFlags::kUppercase) ? kUppercaseHexDigits : kLowercaseHexDigits;
+    char * cursor       = dest_hex;
     for (size_t byte_idx = 0; byte_idx < src_size; ++byte_idx)
     {
-        *cursor++ = NibbleToHex((src_bytes[byte_idx] >> 4) & 0xFu, uppercase);
-        *cursor++ = NibbleToHex((src_bytes[byte_idx] >> 0) & 0xFu, uppercase);
+        *cursor++ = digits[(src_bytes[byte_idx] >> 4) & 0xFu];
+        *cursor++ = digits[(src_bytes[byte_idx] >> 0) & 0xFu];
     }
 
     if (nul_terminate)
@@ -25,10 +25,16 @@
 
 #include <lib/core/CHIPConfig.h>
 #include <lib/support/CHIPMem.h>
+#include <lib/support/MemoryTags.h>
 #include <lib/support/VerificationMacrosNoLogging.h>
 
 #include <stdlib.h>
 
+#if CHIP_CONFIG_MEMORY_TAGGING
+#include <cstddef>
+#include <stdint.h>
+#endif
+
 #ifndef NDEBUG
 #include <atomic>
 #include <cstdio>
@@ -68,6 +74,39 @@ static void VerifyInitialized(const char * func)
 
 #endif
 
+#if CHIP_CONFIG_MEMORY_TAGGING
+
+namespace {
+
+// Prepended to every block, so that frees can be credited to the tag the block was charged to.
+struct alignas(std::max_align_t) TagHeader
+{
+    size_t size;
+    MemoryTag tag;
+};
+
+void * TagBlock(void * block, size_t size, MemoryTag tag)
+{
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+    TagHeader * header = static_cast<TagHeader *>(block);
+    header->size       = size;
+    header->tag        = tag;
+    Internal::RecordMemoryTagAllocation(tag, size);
+    return header + 1;
+}
+
+TagHeader * HeaderOf(void * p)
+{
+    return static_cast<TagHeader *>(p) - 1;
+}
+
+} // namespace
+
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+
 CHIP_ERROR MemoryAllocatorInit(void * buf, size_t bufSize)
 {
     // Logging can use Memory::Alloc, so we can't use logging with our
@@ -93,32 +132,91 @@ void MemoryAllocatorShutdown()
 void * MemoryAlloc(size_t size)
 {
     VERIFY_INITIALIZED();
+#if CHIP_CONFIG_MEMORY_TAGGING
+    if (size > SIZE_MAX - sizeof(TagHeader))
+    {
+        return nullptr;
+    }
+    return TagBlock(malloc(sizeof(TagHeader) + size), size, GetCurrentMemoryTag());
+#else
     return malloc(size);
+#endif
 }
 
 void * MemoryCalloc(size_t num, size_t size)
 {
     VERIFY_INITIALIZED();
+#if CHIP_CONFIG_MEMORY_TAGGING
+    if (size != 0 && num > (SIZE_MAX - sizeof(TagHeader)) / size)
+    {
+        return nullptr;
+    }
+    return TagBlock(calloc(1, sizeof(TagHeader) + num * size), num * size, GetCurrentMemoryTag());
+#else
     return calloc(num, size);
+#endif
 }
 
 void * MemoryRealloc(void * p, size_t size)
 {
     VERIFY_INITIALIZED();
     VERIFY_POINTER(p);
+#if CHIP_CONFIG_MEMORY_TAGGING
+    if (p == nullptr)
+    {
+        return MemoryAlloc(size);
+    }
+    if (size > SIZE_MAX - sizeof(TagHeader))
+    {
+        return nullptr;
+    }
+
+    // The block keeps the tag it was first charged to.
+    TagHeader * header = HeaderOf(p);
+    size_t oldSize     = header->size;
+    MemoryTag tag      = header->tag;
+
+    void * block = realloc(header, sizeof(TagHeader) + size);
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+    Internal::RecordMemoryTagFree(tag, oldSize);
+    return TagBlock(block, size, tag);
+#else
     return realloc(p, size);
+#endif
 }
 
 void MemoryFree(void * p)
 {
     VERIFY_INITIALIZED();
     VERIFY_POINTER(p);
+#if CHIP_CONFIG_MEMORY_TAGGING
+    if (p == nullptr)
+    {
+        return;
+    }
+    TagHeader * header = HeaderOf(p);
+    Internal::RecordMemoryTagFree(header->tag, header->size);
+    free(header);
+#else
     free(p);
+#endif
 }
 
 bool MemoryInternalCheckPointer(const void * p, size_t min_size)
 {
 #if CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
+#if CHIP_CONFIG_MEMORY_TAGGING
+    // dmalloc knows the blocks including their tag header.
+    if (p == nullptr)
+    {
+        return false;
+    }
+    p = static_cast<const TagHeader *>(p) - 1;
+    min_size += sizeof(TagHeader);
+#endif // CHIP_CONFIG_MEMORY_TAGGING
     return CanCastTo<int>(min_size) && (p != nullptr) &&
         (dmalloc_verify_pnt(__FILE__, __LINE__, __func__, p, 1, static_cast<int>(min_size)) == MALLOC_VERIFY_NOERROR);
 #else  // CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
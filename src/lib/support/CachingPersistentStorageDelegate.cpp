@@ -0,0 +1,212 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/CachingPersistentStorageDelegate.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace chip {
+
+CHIP_ERROR CachingPersistentStorageDelegate::SyncGetKeyValue(const char * key, void * buffer, uint16_t & size)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(buffer != nullptr || size == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Entry * entry = Find(key);
+    if (entry != nullptr)
+    {
+        mStats.mHits++;
+        VerifyOrReturnError(entry->mPresent, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+        // Values were set through a uint16_t size, so the cast is safe.
+        const uint16_t valueSize = static_cast<uint16_t>(entry->mValue.AllocatedSize());
+        const uint16_t copySize  = std::min(size, valueSize);
+        if (copySize > 0)
+        {
+            memcpy(buffer, entry->mValue.Get(), copySize);
+        }
+        size = copySize;
+        return (copySize < valueSize) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+    }
+
+    mStats.mMisses++;
+    CHIP_ERROR err = mStorage.SyncGetKeyValue(key, buffer, size);
+    if (err == CHIP_NO_ERROR)
+    {
+        Remember(key, true, buffer, size);
+    }
+    else if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        Remember(key, false, nullptr, 0);
+    }
+
+    // A value that did not fit in the buffer was only partly read, and is not cached.
+    return err;
+}
+
+CHIP_ERROR CachingPersistentStorageDelegate::SyncSetKeyValue(const char * key, const void * value, uint16_t size)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    CHIP_ERROR err = mStorage.SyncSetKeyValue(key, value, size);
+    if (err == CHIP_NO_ERROR)
+    {
+        Remember(key, true, value, size);
+    }
+    else
+    {
+        // The stored value is not known any more.
+        Forget(key);
+    }
+    return err;
+}
+
+CHIP_ERROR CachingPersistentStorageDelegate::SyncDeleteKeyValue(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    CHIP_ERROR err = mStorage.SyncDeleteKeyValue(key);
+    if (err == CHIP_NO_ERROR || err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        Remember(key, false, nullptr, 0);
+    }
+    else
+    {
+        Forget(key);
+    }
+    return err;
+}
+
+// An asynchronous write may still fail after it was accepted, so the key is left for the underlying storage, which
+// answers reads from its pending writes, to report until it is read again.
+CHIP_ERROR CachingPersistentStorageDelegate::AsyncSetKeyValue(const char * key, const void * value, uint16_t size,
+                                                              AsyncCompletion completion, void * context)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Forget(key);
+    return mStorage.AsyncSetKeyValue(key, value, size, completion, context);
+}
+
+CHIP_ERROR CachingPersistentStorageDelegate::AsyncDeleteKeyValue(const char * key, AsyncCompletion completion, void * context)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Forget(key);
+    return mStorage.AsyncDeleteKeyValue(key, completion, context);
+}
+
+bool CachingPersistentStorageDelegate::SyncDoesKeyExist(const char * key)
+{
+    VerifyOrReturnValue(key != nullptr, false);
+
+    Entry * entry = Find(key);
+    if (entry != nullptr)
+    {
+        mStats.mHits++;
+        return entry->mPresent;
+    }
+
+    // Only the absence of a key can be cached without reading its value.
+    mStats.mMisses++;
+    bool exists = mStorage.SyncDoesKeyExist(key);
+    if (!exists)
+    {
+        Remember(key, false, nullptr, 0);
+    }
+    return exists;
+}
+
+void CachingPersistentStorageDelegate::Clear()
+{
+    while (!mEntries.Empty())
+    {
+        Drop(&*mEntries.begin());
+    }
+}
+
+CachingPersistentStorageDelegate::Entry * CachingPersistentStorageDelegate::Find(const char * key)
+{
+    for (Entry & entry : mEntries)
+    {
+        if (strcmp(entry.mKey, key) == 0)
+        {
+            mEntries.Remove(&entry);
+            mEntries.PushFront(&entry);
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void CachingPersistentStorageDelegate::Remember(const char * key, bool present, const void * value, uint16_t size)
+{
+    Forget(key);
+
+    // Keys past the length every storage must support are rare enough to not be worth caching.
+    const size_t keyLength = strnlen(key, kKeyLengthMax + 1);
+    VerifyOrReturn(keyLength <= kKeyLengthMax && Cost(size) <= mBudget);
+
+    while (mUsed + Cost(size) > mBudget)
+    {
+        Drop(&*(--mEntries.end()));
+        mStats.mEvictions++;
+    }
+
+    Entry * entry = Platform::New<Entry>();
+    VerifyOrReturn(entry != nullptr);
+    if (size > 0)
+    {
+        entry->mValue.Alloc(size);
+        if (!entry->mValue)
+        {
+            Platform::Delete(entry);
+            return;
+        }
+        memcpy(entry->mValue.Get(), value, size);
+    }
+    memcpy(entry->mKey, key, keyLength + 1);
+    entry->mPresent = present;
+
+    mEntries.PushFront(entry);
+    mUsed += Cost(size);
+}
+
+void CachingPersistentStorageDelegate::Forget(const char * key)
+{
+    for (Entry & entry : mEntries)
+    {
+        if (strcmp(entry.mKey, key) == 0)
+        {
+            Drop(&entry);
+            return;
+        }
+    }
+}
+
+void CachingPersistentStorageDelegate::Drop(Entry * entry)
+{
+    mEntries.Remove(entry);
+    mUsed -= Cost(entry->mValue.AllocatedSize());
+    Platform::Delete(entry);
+}
+
+} // namespace chip
@@ -0,0 +1,103 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/ScopedBuffer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * PersistentStorageDelegate decorator that keeps recently used values in memory, so that reading them
+ * again does not go to the underlying storage.
+ *
+ * Writes and deletes go to the underlying storage right away, and update the cache once they succeed.
+ * Keys found missing from storage are remembered as well, so that probing for them is also answered from
+ * memory.  The cache holds at most `budget` bytes, counting values and per-entry overhead; the least
+ * recently used entries are dropped to make room.
+ *
+ * While a cache is in use, the underlying storage must only be modified through it, or Clear() must be
+ * called after modifying it directly.
+ */
+class CachingPersistentStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    struct Stats
+    {
+        uint32_t mHits      = 0; ///< Reads answered from memory
+        uint32_t mMisses    = 0; ///< Reads passed to the underlying storage
+        uint32_t mEvictions = 0; ///< Entries dropped to stay within the budget
+    };
+
+    CachingPersistentStorageDelegate(PersistentStorageDelegate & storage, size_t budget) : mStorage(storage), mBudget(budget) {}
+    ~CachingPersistentStorageDelegate() override { Clear(); }
+
+    CachingPersistentStorageDelegate(const CachingPersistentStorageDelegate &)             = delete;
+    CachingPersistentStorageDelegate & operator=(const CachingPersistentStorageDelegate &) = delete;
+
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override;
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override;
+    bool SyncDoesKeyExist(const char * key) override;
+    CHIP_ERROR AsyncSetKeyValue(const char * key, const void * value, uint16_t size, AsyncCompletion completion,
+                                void * context) override;
+    CHIP_ERROR AsyncDeleteKeyValue(const char * key, AsyncCompletion completion, void * context) override;
+    CHIP_ERROR SyncBeginBatch() override { return mStorage.SyncBeginBatch(); }
+    CHIP_ERROR SyncCommitBatch() override { return mStorage.SyncCommitBatch(); }
+
+    /**
+     * Drop all cached entries.
+     */
+    void Clear();
+
+    const Stats & GetStats() const { return mStats; }
+    void ResetStats() { mStats = Stats(); }
+
+    /**
+     * The number of bytes of the budget in use.
+     */
+    size_t GetUsedBytes() const { return mUsed; }
+
+private:
+    struct Entry : public IntrusiveListNodeBase<>
+    {
+        char mKey[kKeyLengthMax + 1];
+        bool mPresent = false; ///< Whether the key is in storage; mValue is empty if not
+        Platform::ScopedMemoryBufferWithSize<uint8_t> mValue;
+    };
+
+    static size_t Cost(size_t valueSize) { return sizeof(Entry) + valueSize; }
+
+    // The entry for the key, made the most recently used one, or nullptr if the key is not cached.
+    Entry * Find(const char * key);
+    void Remember(const char * key, bool present, const void * value, uint16_t size);
+    void Forget(const char * key);
+    void Drop(Entry * entry);
+
+    PersistentStorageDelegate & mStorage;
+    const size_t mBudget;
+    size_t mUsed = 0;
+    Stats mStats;
+    IntrusiveList<Entry> mEntries; // Most recently used first
+};
+
+} // namespace chip
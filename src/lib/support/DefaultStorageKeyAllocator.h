@@ -223,6 +223,10 @@ public:
     {
         return StorageKeyName::Formatted("g/su/%x", static_cast<unsigned>(index));
     }
+    static StorageKeyName SubscriptionResumptionRetries(size_t index)
+    {
+        return StorageKeyName::Formatted("g/sur/%x", static_cast<unsigned>(index));
+    }
     static StorageKeyName SubscriptionResumptionMaxCount() { return StorageKeyName::Formatted("g/sum"); }
 
     // Number of scenes stored in a given endpoint's scene table, across all fabrics.
@@ -42,6 +42,9 @@ public:
 
     void operator()() const { mLambdaProxy(mLambdaBody); }
 
+    // Address of the code that invokes the lambda, which identifies the lambda type.  For diagnostics.
+    uintptr_t GetProxyAddress() const { return reinterpret_cast<uintptr_t>(mLambdaProxy); }
+
 private:
     using LambdaStorage = std::aligned_storage_t<CHIP_CONFIG_LAMBDA_EVENT_SIZE, CHIP_CONFIG_LAMBDA_EVENT_ALIGN>;
     void (*mLambdaProxy)(const LambdaStorage & body);
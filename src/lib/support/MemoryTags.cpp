@@ -0,0 +1,143 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/MemoryTags.h>
+
+#if CHIP_CONFIG_MEMORY_TAGGING
+#include <atomic>
+
+#if !CHIP_CONFIG_MEMORY_MGMT_MALLOC
+#error "CHIP_CONFIG_MEMORY_TAGGING requires CHIP_CONFIG_MEMORY_MGMT_MALLOC"
+#endif
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+
+namespace chip {
+namespace Platform {
+
+const char * MemoryTagName(MemoryTag tag)
+{
+    switch (tag)
+    {
+    case MemoryTag::kUntagged:
+        return "untagged";
+    case MemoryTag::kApp:
+        return "app";
+    case MemoryTag::kInteractionModel:
+        return "im";
+    case MemoryTag::kTransport:
+        return "transport";
+    case MemoryTag::kCrypto:
+        return "crypto";
+    case MemoryTag::kDnssd:
+        return "dnssd";
+    case MemoryTag::kCache:
+        return "cache";
+    case MemoryTag::kCount:
+        break;
+    }
+    return "?";
+}
+
+#if CHIP_CONFIG_MEMORY_TAGGING
+
+namespace {
+
+// Allocation and free happen on arbitrary threads, so every counter is atomic on its own.
+struct TagCounters
+{
+    std::atomic<size_t> currentBytes{ 0 };
+    std::atomic<size_t> peakBytes{ 0 };
+    std::atomic<size_t> currentAllocations{ 0 };
+    std::atomic<uint64_t> totalAllocations{ 0 };
+};
+
+TagCounters sCounters[static_cast<size_t>(MemoryTag::kCount)];
+
+thread_local MemoryTag tCurrentTag = MemoryTag::kUntagged;
+
+TagCounters & CountersFor(MemoryTag tag)
+{
+    size_t index = static_cast<size_t>(tag);
+    return sCounters[index < static_cast<size_t>(MemoryTag::kCount) ? index : 0];
+}
+
+} // namespace
+
+ScopedMemoryTag::ScopedMemoryTag(MemoryTag tag) : mPrevious(tCurrentTag)
+{
+    tCurrentTag = tag;
+}
+
+ScopedMemoryTag::~ScopedMemoryTag()
+{
+    tCurrentTag = mPrevious;
+}
+
+MemoryTag GetCurrentMemoryTag()
+{
+    return tCurrentTag;
+}
+
+MemoryTagStats GetMemoryTagStats(MemoryTag tag)
+{
+    const TagCounters & counters = CountersFor(tag);
+
+    MemoryTagStats stats;
+    stats.currentBytes       = counters.currentBytes.load(std::memory_order_relaxed);
+    stats.peakBytes          = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.currentAllocations = counters.currentAllocations.load(std::memory_order_relaxed);
+    stats.totalAllocations   = counters.totalAllocations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ResetMemoryTagPeaks()
+{
+    for (TagCounters & counters : sCounters)
+    {
+        counters.peakBytes.store(counters.currentBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+namespace Internal {
+
+void RecordMemoryTagAllocation(MemoryTag tag, size_t size)
+{
+    TagCounters & counters = CountersFor(tag);
+
+    size_t current = counters.currentBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    size_t peak    = counters.peakBytes.load(std::memory_order_relaxed);
+    while (current > peak && !counters.peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+    {
+    }
+    counters.currentAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RecordMemoryTagFree(MemoryTag tag, size_t size)
+{
+    TagCounters & counters = CountersFor(tag);
+
+    counters.currentBytes.fetch_sub(size, std::memory_order_relaxed);
+    counters.currentAllocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+} // namespace Internal
+
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+
+} // namespace Platform
+} // namespace chip
@@ -0,0 +1,114 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Attribution of chip::Platform heap usage to the subsystems that allocate it.
+ *
+ *      Code enters a subsystem with a ScopedMemoryTag; allocations made through
+ *      chip::Platform::MemoryAlloc and friends on the same thread while the scope is active are
+ *      charged to its tag, and freeing them credits the same tag no matter where that happens.
+ *
+ *      Accounting is only performed when CHIP_CONFIG_MEMORY_TAGGING is enabled (which requires
+ *      CHIP_CONFIG_MEMORY_MGMT_MALLOC); otherwise the scopes compile to nothing.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Platform {
+
+enum class MemoryTag : uint8_t
+{
+    kUntagged = 0,
+    kApp,
+    kInteractionModel,
+    kTransport,
+    kCrypto,
+    kDnssd,
+    kCache,
+
+    kCount,
+};
+
+struct MemoryTagStats
+{
+    size_t currentBytes       = 0;
+    size_t peakBytes          = 0;
+    size_t currentAllocations = 0;
+    uint64_t totalAllocations = 0; // since startup, including the ones freed since
+};
+
+/// Short human-readable name of a tag, e.g. "im".
+const char * MemoryTagName(MemoryTag tag);
+
+#if CHIP_CONFIG_MEMORY_TAGGING
+
+/**
+ * Charges the allocations made on the current thread to a tag for the lifetime of the object.
+ * Scopes nest: the innermost one wins, and the previous tag is restored on destruction.
+ */
+class ScopedMemoryTag
+{
+public:
+    explicit ScopedMemoryTag(MemoryTag tag);
+    ~ScopedMemoryTag();
+
+    ScopedMemoryTag(const ScopedMemoryTag &)             = delete;
+    ScopedMemoryTag & operator=(const ScopedMemoryTag &) = delete;
+
+private:
+    MemoryTag mPrevious;
+};
+
+/// The tag allocations on the current thread are charged to.
+MemoryTag GetCurrentMemoryTag();
+
+/// Snapshot of the usage of one tag. The fields are read individually and may be slightly inconsistent with each other.
+MemoryTagStats GetMemoryTagStats(MemoryTag tag);
+
+/// Set the peak of every tag to its current usage.
+void ResetMemoryTagPeaks();
+
+namespace Internal {
+
+// Used by the allocator implementation.
+void RecordMemoryTagAllocation(MemoryTag tag, size_t size);
+void RecordMemoryTagFree(MemoryTag tag, size_t size);
+
+} // namespace Internal
+
+#else // CHIP_CONFIG_MEMORY_TAGGING
+
+class ScopedMemoryTag
+{
+public:
+    explicit ScopedMemoryTag(MemoryTag) {}
+
+    ScopedMemoryTag(const ScopedMemoryTag &)             = delete;
+    ScopedMemoryTag & operator=(const ScopedMemoryTag &) = delete;
+};
+
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+
+} // namespace Platform
+} // namespace chip
@@ -0,0 +1,124 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+
+/**
+ * @brief A bounded, lock-free queue with any number of producer threads and a single consumer thread.
+ *
+ * Each slot carries a sequence number telling whether it is free for the push at a given position, or holds the
+ * element pushed there. Producers claim a position with a compare-and-swap and publish the element by advancing the
+ * sequence of its slot, so that the consumer never sees a partly written element.
+ *
+ * An element whose position is claimed but not published yet hides the ones pushed after it from the consumer, until
+ * its producer publishes it: consumers that wait for pushes must be woken up by the producers after TryPush.
+ *
+ * @tparam T         The element type, copied in and out of the ring.
+ * @tparam kCapacity The number of slots, a power of two.
+ */
+template <typename T, size_t kCapacity>
+class MpscRingBuffer
+{
+public:
+    static_assert(kCapacity >= 2 && (kCapacity & (kCapacity - 1)) == 0, "The capacity must be a power of two");
+
+    MpscRingBuffer()
+    {
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            mSlots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingBuffer(const MpscRingBuffer &)             = delete;
+    MpscRingBuffer & operator=(const MpscRingBuffer &) = delete;
+
+    /**
+     * Pushes an element, from any thread.
+     *
+     * @return false if the ring is full.
+     */
+    bool TryPush(const T & element)
+    {
+        size_t position = mPushPosition.load(std::memory_order_relaxed);
+        Slot * slot;
+        for (;;)
+        {
+            slot          = &mSlots[position & (kCapacity - 1)];
+            size_t seq    = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(position);
+            if (diff == 0)
+            {
+                if (mPushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The consumer has not freed this slot yet.
+                return false;
+            }
+            else
+            {
+                position = mPushPosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->element = element;
+        slot->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Pops the oldest published element, from the consumer thread only.
+     *
+     * @return false if there is none.
+     */
+    bool TryPop(T & element)
+    {
+        Slot & slot = mSlots[mPopPosition & (kCapacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != mPopPosition + 1)
+        {
+            return false;
+        }
+
+        element = slot.element;
+        slot.sequence.store(mPopPosition + kCapacity, std::memory_order_release);
+        mPopPosition++;
+        return true;
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        T element;
+    };
+
+    Slot mSlots[kCapacity];
+    std::atomic<size_t> mPushPosition{ 0 };
+    size_t mPopPosition = 0; // Consumer only.
+};
+
+} // namespace chip
@@ -0,0 +1,54 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/ObjectPoolRegistry.h>
+
+#if CHIP_CONFIG_OBJECT_POOL_REGISTRY
+
+namespace chip {
+
+ObjectPoolRegistration * ObjectPoolRegistry::sFirst = nullptr;
+
+void ObjectPoolRegistration::Register()
+{
+    mNext                      = ObjectPoolRegistry::sFirst;
+    ObjectPoolRegistry::sFirst = this;
+}
+
+void ObjectPoolRegistration::Unregister()
+{
+    for (ObjectPoolRegistration ** link = &ObjectPoolRegistry::sFirst; *link != nullptr; link = &(*link)->mNext)
+    {
+        if (*link == this)
+        {
+            *link = mNext;
+            return;
+        }
+    }
+}
+
+void ObjectPoolRegistry::ResetStatistics()
+{
+    ForEach([](ObjectPoolRegistration & registration) {
+        registration.ResetStatistics();
+        return Loop::Continue;
+    });
+}
+
+} // namespace chip
+
+#endif // CHIP_CONFIG_OBJECT_POOL_REGISTRY
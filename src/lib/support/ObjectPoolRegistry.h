@@ -0,0 +1,152 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * Defines a registry of named object pools, so that their usage can be reported (e.g. by the "stat pools" shell
+ * command or as tracing metrics) to size them.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/Iterators.h>
+#include <lib/support/Pool.h>
+
+#include <stddef.h>
+
+namespace chip {
+
+/**
+ * The name of a registered pool, and the keys its usage is reported under as metrics.
+ *
+ * Use CHIP_OBJECT_POOL_NAMES to make one from a string literal.
+ */
+struct ObjectPoolNames
+{
+    const char * mName;
+    const char * mInUseKey;
+    const char * mHighWaterMarkKey;
+    const char * mFailedAllocationsKey;
+};
+
+#define CHIP_OBJECT_POOL_NAMES(name)                                                                                               \
+    ::chip::ObjectPoolNames { name, name "_in_use", name "_high_water_mark", name "_failed_allocations" }
+
+#if CHIP_CONFIG_OBJECT_POOL_REGISTRY
+
+/**
+ * Registers a pool with the ObjectPoolRegistry for as long as it exists.  Meant to be a member declared right after
+ * the pool it registers:
+ *
+ *      ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
+ *      ObjectPoolRegistration mContextPoolRegistration{ CHIP_OBJECT_POOL_NAMES("core_exchanges"), mContextPool };
+ *
+ * Registrations must be created and destroyed with the stack lock held (or before the stack runs).
+ */
+class ObjectPoolRegistration
+{
+public:
+    template <class Pool>
+    ObjectPoolRegistration(const ObjectPoolNames & names, Pool & pool) :
+        mNames(names), mStatistics(pool), mCapacity(pool.Capacity())
+    {
+        Register();
+    }
+    ~ObjectPoolRegistration() { Unregister(); }
+
+    ObjectPoolRegistration(const ObjectPoolRegistration &)             = delete;
+    ObjectPoolRegistration & operator=(const ObjectPoolRegistration &) = delete;
+
+    const ObjectPoolNames & GetNames() const { return mNames; }
+    size_t Allocated() const { return mStatistics.Allocated(); }
+    size_t HighWaterMark() const { return mStatistics.HighWaterMark(); }
+    size_t FailedAllocations() const { return mStatistics.FailedAllocations(); }
+    void ResetStatistics() { mStatistics.ResetStatistics(); }
+
+    /**
+     * The number of objects the pool can hold, or SIZE_MAX if it allocates them from the heap.
+     */
+    size_t Capacity() const { return mCapacity; }
+
+private:
+    friend class ObjectPoolRegistry;
+
+    void Register();
+    void Unregister();
+
+    const ObjectPoolNames mNames;
+    internal::Statistics & mStatistics;
+    const size_t mCapacity;
+    ObjectPoolRegistration * mNext = nullptr;
+};
+
+/**
+ * All the pools currently registered by an ObjectPoolRegistration.
+ */
+class ObjectPoolRegistry
+{
+public:
+    /**
+     * Call `function(ObjectPoolRegistration &)` for each registered pool, most recently registered first, until it
+     * returns Loop::Break.
+     */
+    template <typename Function>
+    static Loop ForEach(Function && function)
+    {
+        for (ObjectPoolRegistration * registration = sFirst; registration != nullptr; registration = registration->mNext)
+        {
+            if (function(*registration) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+    /**
+     * Reset the high water marks and failed allocation counts of all registered pools.
+     */
+    static void ResetStatistics();
+
+private:
+    friend class ObjectPoolRegistration;
+
+    static ObjectPoolRegistration * sFirst;
+};
+
+#else // CHIP_CONFIG_OBJECT_POOL_REGISTRY
+
+class ObjectPoolRegistration
+{
+public:
+    template <class Pool>
+    ObjectPoolRegistration(const ObjectPoolNames & names, Pool & pool)
+    {}
+
+    ObjectPoolRegistration(const ObjectPoolRegistration &)             = delete;
+    ObjectPoolRegistration & operator=(const ObjectPoolRegistration &) = delete;
+};
+
+class ObjectPoolRegistry
+{
+public:
+    static void ResetStatistics() {}
+};
+
+#endif // CHIP_CONFIG_OBJECT_POOL_REGISTRY
+
+} // namespace chip
@@ -46,8 +46,9 @@ struct DataAccessor
         writer.Init(buffer);
         ReturnErrorOnFailure(this->Serialize(writer));
 
-        // Save serialized data
-        return storage->SyncSetKeyValue(key.KeyName(), buffer.data(), static_cast<uint16_t>(writer.GetLengthWritten()));
+        // Save serialized data. Readers see it right away; failures to make it durable later on are only logged.
+        return storage->AsyncSetKeyValue(key.KeyName(), buffer.data(), static_cast<uint16_t>(writer.GetLengthWritten()),
+                                         PersistentStorageDelegate::LogAsyncFailure, nullptr);
     }
 
     CHIP_ERROR Load(PersistentStorageDelegate * storage, const MutableByteSpan & buffer)
@@ -79,7 +80,7 @@ struct DataAccessor
         StorageKeyName key = StorageKeyName::Uninitialized();
         ReturnErrorOnFailure(this->UpdateKey(key));
 
-        return storage->SyncDeleteKeyValue(key.KeyName());
+        return storage->AsyncDeleteKeyValue(key.KeyName(), PersistentStorageDelegate::LogAsyncFailure, nullptr);
     }
 };
 
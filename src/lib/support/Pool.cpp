@@ -64,24 +64,29 @@ StaticAllocatorBitmap::StaticAllocatorBitmap(void * storage, std::atomic<tBitChu
 
 void * StaticAllocatorBitmap::Allocate()
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    // Words below the hint are usually full, so start there; wrap around in case a racing Deallocate just freed another
+    // slot below it.
+    const size_t wordCount = WordCount();
+    const size_t hint      = mFreeWordHint.load(std::memory_order_relaxed);
+    for (size_t n = 0; n < wordCount; ++n)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        const size_t word = (hint + n < wordCount) ? hint + n : hint + n - wordCount;
+        auto & usage      = mUsage[word];
+        auto value        = usage.load(std::memory_order_relaxed);
+        tBitChunkType freeSlots;
+        while ((freeSlots = ~value & WordMask(word)) != 0)
         {
-            if ((value & (kBit1 << offset)) == 0)
+            const tBitChunkType bit = freeSlots & (~freeSlots + 1); // lowest free slot
+            if (usage.compare_exchange_weak(value, value | bit))
             {
-                if (usage.compare_exchange_strong(value, value | (kBit1 << offset)))
-                {
-                    IncreaseUsage();
-                    return At(word * kBitChunkSize + offset);
-                }
-
-                value = usage.load(std::memory_order_relaxed); // if there is a race, update new usage
+                mFreeWordHint.store(((value | bit) == WordMask(word)) ? word + 1 : word, std::memory_order_relaxed);
+                IncreaseUsage();
+                return At(word * kBitChunkSize + static_cast<size_t>(__builtin_ctzl(bit)));
             }
+            // On a race, value now holds the new usage.
         }
     }
+    RecordFailedAllocation();
     return nullptr;
 }
 
@@ -97,6 +102,11 @@ void StaticAllocatorBitmap::Deallocate(void * element)
     auto value = mUsage[word].fetch_and(~(kBit1 << offset));
     VerifyOrDie((value & (kBit1 << offset)) != 0); // assert fail when free an unused slot
     DecreaseUsage();
+
+    if (word < mFreeWordHint.load(std::memory_order_relaxed))
+    {
+        mFreeWordHint.store(word, std::memory_order_relaxed);
+    }
 }
 
 size_t StaticAllocatorBitmap::IndexOf(void * element)
@@ -111,17 +121,13 @@ size_t StaticAllocatorBitmap::IndexOf(void * element)
 
 Loop StaticAllocatorBitmap::ForEachActiveObjectInner(void * context, Lambda lambda)
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    for (size_t word = 0; word < WordCount(); ++word)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        // Visit the set bits of the word, lowest first; empty words cost a single load.
+        for (auto value = mUsage[word].load(std::memory_order_relaxed); value != 0; value &= value - 1)
         {
-            if ((value & (kBit1 << offset)) != 0)
-            {
-                if (lambda(context, At(word * kBitChunkSize + offset)) == Loop::Break)
-                    return Loop::Break;
-            }
+            if (lambda(context, At(word * kBitChunkSize + static_cast<size_t>(__builtin_ctzl(value)))) == Loop::Break)
+                return Loop::Break;
         }
     }
     return Loop::Finish;
@@ -129,41 +135,28 @@ Loop StaticAllocatorBitmap::ForEachActiveObjectInner(void * context, Lambda lamb
 
 size_t StaticAllocatorBitmap::FirstActiveIndex()
 {
-    size_t idx = 0;
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
-    {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
-        {
-            if ((value & (kBit1 << offset)) != 0)
-            {
-                return idx;
-            }
-            idx++;
-        }
-    }
-    VerifyOrDie(idx == mCapacity);
-    return mCapacity;
+    return ActiveIndexFrom(0);
 }
 
 size_t StaticAllocatorBitmap::NextActiveIndexAfter(size_t start)
 {
-    size_t idx = 0;
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    return ActiveIndexFrom(start + 1);
+}
+
+size_t StaticAllocatorBitmap::ActiveIndexFrom(size_t start)
+{
+    for (size_t word = start / kBitChunkSize; word < WordCount(); ++word)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        auto value = mUsage[word].load(std::memory_order_relaxed);
+        if (word == start / kBitChunkSize)
         {
-            if (((value & (kBit1 << offset)) != 0) && (start < idx))
-            {
-                return idx;
-            }
-            idx++;
+            value &= ~((kBit1 << (start % kBitChunkSize)) - 1);
+        }
+        if (value != 0)
+        {
+            return word * kBitChunkSize + static_cast<size_t>(__builtin_ctzl(value));
         }
     }
-    VerifyOrDie(idx == mCapacity);
     return mCapacity;
 }
 
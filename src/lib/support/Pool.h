@@ -45,10 +45,12 @@ namespace internal {
 class Statistics
 {
 public:
-    Statistics() : mAllocated(0), mHighWaterMark(0) {}
+    Statistics() : mAllocated(0), mHighWaterMark(0), mFailedAllocations(0) {}
 
     size_t Allocated() const { return mAllocated; }
     size_t HighWaterMark() const { return mHighWaterMark; }
+    // Number of times an object could not be allocated, e.g. because the pool was exhausted.
+    size_t FailedAllocations() const { return mFailedAllocations; }
     void IncreaseUsage()
     {
         if (++mAllocated > mHighWaterMark)
@@ -57,10 +59,19 @@ public:
         }
     }
     void DecreaseUsage() { --mAllocated; }
+    void RecordFailedAllocation() { ++mFailedAllocations; }
+
+    // Start measuring the high water mark and failed allocations from now on.
+    void ResetStatistics()
+    {
+        mHighWaterMark     = mAllocated;
+        mFailedAllocations = 0;
+    }
 
 protected:
     size_t mAllocated;
     size_t mHighWaterMark;
+    size_t mFailedAllocations;
 };
 
 class StaticAllocatorBase : public Statistics
@@ -105,6 +116,18 @@ protected:
     /// If nothing else active/allocated, returns mCapacity
     size_t NextActiveIndexAfter(size_t start);
 
+    /// Returns the first active index that is not below `start`, or mCapacity.
+    size_t ActiveIndexFrom(size_t start);
+
+    size_t WordCount() const { return (Capacity() + kBitChunkSize - 1) / kBitChunkSize; }
+
+    /// The usage bits of `word` that correspond to elements of the pool.
+    tBitChunkType WordMask(size_t word) const
+    {
+        const size_t bits = Capacity() - word * kBitChunkSize;
+        return (bits >= kBitChunkSize) ? ~tBitChunkType(0) : (kBit1 << bits) - 1;
+    }
+
     using Lambda = Loop (*)(void * context, void * object);
     Loop ForEachActiveObjectInner(void * context, Lambda lambda);
     Loop ForEachActiveObjectInner(void * context, Loop lambda(void * context, const void * object)) const
@@ -116,6 +139,8 @@ private:
     void * mElements;
     const size_t mElementSize;
     std::atomic<tBitChunkType> * mUsage;
+    // The lowest word that may have a free slot, so that allocations do not rescan the full words before it.
+    std::atomic<size_t> mFreeWordHint{ 0 };
 
     /// allow accessing direct At() calls
     template <class T>
@@ -506,7 +531,9 @@ public:
                 IncreaseUsage();
                 return object;
             }
+            Platform::Delete(object);
         }
+        RecordFailedAllocation();
         return nullptr;
     }
 
@@ -0,0 +1,254 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/ProfilingPersistentStorageDelegate.h>
+
+#include <lib/support/CHIPMemString.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <inttypes.h>
+#include <string.h>
+
+namespace chip {
+
+using namespace System::Clock;
+
+namespace {
+
+bool IsVariableSegment(const char * segment, size_t length, size_t index, bool fabricScoped)
+{
+    if (length > ProfilingPersistentStorageDelegate::kMaxLiteralSegmentLength || (fabricScoped && index == 1))
+    {
+        return true;
+    }
+    return std::any_of(segment, segment + length, [](char c) { return c >= '0' && c <= '9'; });
+}
+
+Microseconds64 Now()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64();
+}
+
+} // namespace
+
+void ProfilingPersistentStorageDelegate::GetKeyPrefix(const char * key, char (&prefix)[kKeyLengthMax + 1])
+{
+    const bool fabricScoped = (strncmp(key, "f/", 2) == 0);
+    size_t length           = 0;
+    size_t index            = 0;
+
+    for (const char * segment = key; length < kKeyLengthMax; index++)
+    {
+        const char * end     = strchr(segment, '/');
+        size_t segmentLength = (end != nullptr) ? static_cast<size_t>(end - segment) : strlen(segment);
+
+        if (IsVariableSegment(segment, segmentLength, index, fabricScoped))
+        {
+            prefix[length++] = '*';
+        }
+        else
+        {
+            segmentLength = std::min(segmentLength, kKeyLengthMax - length);
+            memcpy(&prefix[length], segment, segmentLength);
+            length += segmentLength;
+        }
+
+        if (end == nullptr || length == kKeyLengthMax)
+        {
+            break;
+        }
+        prefix[length++] = '/';
+        segment          = end + 1;
+    }
+    prefix[length] = '\0';
+}
+
+ProfilingPersistentStorageDelegate::PrefixStats * ProfilingPersistentStorageDelegate::StatsFor(const char * key)
+{
+    char prefix[kKeyLengthMax + 1];
+    GetKeyPrefix(key, prefix);
+
+    for (size_t i = 0; i < mStatsCount; i++)
+    {
+        if (strcmp(mStats[i].mPrefix, prefix) == 0)
+        {
+            return &mStats[i];
+        }
+    }
+
+    // Past kMaxPrefixes, the keys of new prefixes are counted together in the last slot.
+    if (mStatsCount == MATTER_ARRAY_SIZE(mStats))
+    {
+        return &mStats[kMaxPrefixes];
+    }
+
+    PrefixStats & stats = mStats[mStatsCount++];
+    stats               = PrefixStats();
+    Platform::CopyString(stats.mPrefix, (mStatsCount <= kMaxPrefixes) ? prefix : kOverflowPrefix);
+    return &stats;
+}
+
+void ProfilingPersistentStorageDelegate::Record(Microseconds64 & total, Microseconds64 & max, Microseconds64 start)
+{
+    Microseconds64 elapsed = Now() - start;
+    total += elapsed;
+    max = std::max(max, elapsed);
+}
+
+CHIP_ERROR ProfilingPersistentStorageDelegate::SyncGetKeyValue(const char * key, void * buffer, uint16_t & size)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Microseconds64 start = Now();
+    CHIP_ERROR err       = mStorage.SyncGetKeyValue(key, buffer, size);
+
+    PrefixStats * stats = StatsFor(key);
+    Record(stats->mReadTime, stats->mMaxLatency, start);
+    stats->mReads++;
+    if (err == CHIP_NO_ERROR || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    {
+        stats->mBytesRead += size;
+    }
+    return err;
+}
+
+CHIP_ERROR ProfilingPersistentStorageDelegate::SyncSetKeyValue(const char * key, const void * value, uint16_t size)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Microseconds64 start = Now();
+    CHIP_ERROR err       = mStorage.SyncSetKeyValue(key, value, size);
+
+    PrefixStats * stats = StatsFor(key);
+    Record(stats->mWriteTime, stats->mMaxLatency, start);
+    stats->mWrites++;
+    stats->mBytesWritten += size;
+    return err;
+}
+
+CHIP_ERROR ProfilingPersistentStorageDelegate::SyncDeleteKeyValue(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Microseconds64 start = Now();
+    CHIP_ERROR err       = mStorage.SyncDeleteKeyValue(key);
+
+    PrefixStats * stats = StatsFor(key);
+    Record(stats->mWriteTime, stats->mMaxLatency, start);
+    stats->mDeletes++;
+    return err;
+}
+
+bool ProfilingPersistentStorageDelegate::SyncDoesKeyExist(const char * key)
+{
+    VerifyOrReturnValue(key != nullptr, false);
+
+    Microseconds64 start = Now();
+    bool exists          = mStorage.SyncDoesKeyExist(key);
+
+    PrefixStats * stats = StatsFor(key);
+    Record(stats->mReadTime, stats->mMaxLatency, start);
+    stats->mReads++;
+    return exists;
+}
+
+// Only the time to accept an asynchronous call is recorded, since that is the time the caller is held up for.
+CHIP_ERROR ProfilingPersistentStorageDelegate::AsyncSetKeyValue(const char * key, const void * value, uint16_t size,
+                                                                AsyncCompletion completion, void * context)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Microseconds64 start = Now();
+    CHIP_ERROR err       = mStorage.AsyncSetKeyValue(key, value, size, completion, context);
+
+    PrefixStats * stats = StatsFor(key);
+    Record(stats->mWriteTime, stats->mMaxLatency, start);
+    stats->mWrites++;
+    stats->mBytesWritten += size;
+    return err;
+}
+
+CHIP_ERROR ProfilingPersistentStorageDelegate::AsyncDeleteKeyValue(const char * key, AsyncCompletion completion, void * context)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Microseconds64 start = Now();
+    CHIP_ERROR err       = mStorage.AsyncDeleteKeyValue(key, completion, context);
+
+    PrefixStats * stats = StatsFor(key);
+    Record(stats->mWriteTime, stats->mMaxLatency, start);
+    stats->mDeletes++;
+    return err;
+}
+
+const ProfilingPersistentStorageDelegate::PrefixStats * ProfilingPersistentStorageDelegate::GetStats(const char * prefix) const
+{
+    for (const PrefixStats & stats : GetStats())
+    {
+        if (strcmp(stats.mPrefix, prefix) == 0)
+        {
+            return &stats;
+        }
+    }
+    return nullptr;
+}
+
+size_t ProfilingPersistentStorageDelegate::GetHottestPrefixes(Span<const PrefixStats *> out) const
+{
+    size_t count = 0;
+    for (const PrefixStats & stats : GetStats())
+    {
+        // Insertion into the sorted output, dropping whatever falls off its end.
+        size_t position = count;
+        while (position > 0 && out[position - 1]->GetMutations() < stats.GetMutations())
+        {
+            position--;
+        }
+        if (position == out.size())
+        {
+            continue;
+        }
+        count = std::min(count + 1, out.size());
+        for (size_t i = count - 1; i > position; i--)
+        {
+            out[i] = out[i - 1];
+        }
+        out[position] = &stats;
+    }
+    return count;
+}
+
+void ProfilingPersistentStorageDelegate::LogStats() const
+{
+    const PrefixStats * sorted[MATTER_ARRAY_SIZE(mStats)];
+    size_t count = GetHottestPrefixes(Span<const PrefixStats *>(sorted));
+
+    ChipLogProgress(Support, "Storage profile: %u key prefixes, hottest first", static_cast<unsigned>(count));
+    for (size_t i = 0; i < count; i++)
+    {
+        const PrefixStats & stats = *sorted[i];
+        ChipLogProgress(Support,
+                        "  %s: %" PRIu32 " writes, %" PRIu32 " deletes, %" PRIu64 " B written in %" PRIu64 " us, %" PRIu32
+                        " reads, %" PRIu64 " B read in %" PRIu64 " us, max %" PRIu64 " us",
+                        stats.mPrefix, stats.mWrites, stats.mDeletes, stats.mBytesWritten, stats.mWriteTime.count(), stats.mReads,
+                        stats.mBytesRead, stats.mReadTime.count(), stats.mMaxLatency.count());
+    }
+}
+
+} // namespace chip
@@ -0,0 +1,118 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * PersistentStorageDelegate decorator that profiles how the stack uses storage: how often each kind of
+ * key is read, written and deleted, how many bytes move, and how long the underlying storage takes.
+ *
+ * Keys are grouped by prefix, which is the key with its variable segments replaced by an asterisk, so
+ * that the keys of every fabric, node or endpoint count together: "f/1/s/00000000000000AB" and
+ * "f/2/s/00000000000000CD" share a prefix. A segment is variable when it holds a decimal digit or is
+ * longer than kMaxLiteralSegmentLength; the fabric index of "f/" keys always is. Up to kMaxPrefixes
+ * prefixes are tracked, and any further prefix counts as kOverflowPrefix.
+ *
+ * The writes and deletes of a prefix are what wears flash out, so the hottest prefixes are the ones with
+ * the most of them.
+ */
+class ProfilingPersistentStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    static constexpr size_t kMaxPrefixes             = 32;
+    static constexpr size_t kMaxLiteralSegmentLength = 8;
+    static constexpr char kOverflowPrefix[]          = "*";
+
+    struct PrefixStats
+    {
+        char mPrefix[kKeyLengthMax + 1];
+        uint32_t mReads        = 0; ///< Gets and existence checks
+        uint32_t mWrites       = 0; ///< Sets, synchronous or not
+        uint32_t mDeletes      = 0; ///< Deletes, synchronous or not
+        uint64_t mBytesRead    = 0;
+        uint64_t mBytesWritten = 0;
+        System::Clock::Microseconds64 mReadTime{ 0 };  ///< Total time spent in the underlying storage reading
+        System::Clock::Microseconds64 mWriteTime{ 0 }; ///< Total time spent in the underlying storage writing or deleting
+        System::Clock::Microseconds64 mMaxLatency{ 0 };
+
+        uint32_t GetMutations() const { return mWrites + mDeletes; }
+    };
+
+    explicit ProfilingPersistentStorageDelegate(PersistentStorageDelegate & storage) : mStorage(storage) {}
+
+    ProfilingPersistentStorageDelegate(const ProfilingPersistentStorageDelegate &)             = delete;
+    ProfilingPersistentStorageDelegate & operator=(const ProfilingPersistentStorageDelegate &) = delete;
+
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override;
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override;
+    bool SyncDoesKeyExist(const char * key) override;
+    CHIP_ERROR SyncBeginBatch() override { return mStorage.SyncBeginBatch(); }
+    CHIP_ERROR SyncCommitBatch() override { return mStorage.SyncCommitBatch(); }
+    CHIP_ERROR AsyncSetKeyValue(const char * key, const void * value, uint16_t size, AsyncCompletion completion,
+                                void * context) override;
+    CHIP_ERROR AsyncDeleteKeyValue(const char * key, AsyncCompletion completion, void * context) override;
+
+    /**
+     * The statistics of every prefix seen since the last reset, in the order they were first seen.
+     */
+    Span<const PrefixStats> GetStats() const { return Span<const PrefixStats>(mStats, mStatsCount); }
+
+    /**
+     * The statistics of the given prefix, or nullptr if it was not seen.
+     */
+    const PrefixStats * GetStats(const char * prefix) const;
+
+    /**
+     * Fill `out` with the prefixes that were written or deleted the most, most first.
+     *
+     * @return the number of prefixes placed in `out`, at most `out.size()`.
+     */
+    size_t GetHottestPrefixes(Span<const PrefixStats *> out) const;
+
+    /**
+     * Log the statistics of every prefix, hottest first.
+     */
+    void LogStats() const;
+
+    void ResetStats() { mStatsCount = 0; }
+
+    /**
+     * Write the prefix of `key` to `prefix`, truncated to kKeyLengthMax characters.
+     */
+    static void GetKeyPrefix(const char * key, char (&prefix)[kKeyLengthMax + 1]);
+
+private:
+    PrefixStats * StatsFor(const char * key);
+    static void Record(System::Clock::Microseconds64 & total, System::Clock::Microseconds64 & max,
+                       System::Clock::Microseconds64 start);
+
+    PersistentStorageDelegate & mStorage;
+    PrefixStats mStats[kMaxPrefixes + 1]; // One more for kOverflowPrefix
+    size_t mStatsCount = 0;
+};
+
+} // namespace chip
@@ -126,6 +126,58 @@ public:
         return err;
     }
 
+    CHIP_ERROR AsyncSetKeyValue(const char * key, const void * value, uint16_t size, AsyncCompletion completion,
+                                void * context) override
+    {
+        if (!mDeferAsyncCompletions)
+        {
+            return PersistentStorageDelegate::AsyncSetKeyValue(key, value, size, completion, context);
+        }
+
+        ReturnErrorOnFailure(SyncSetKeyValue(key, value, size));
+        mPendingCompletions.push_back({ key, completion, context });
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR AsyncDeleteKeyValue(const char * key, AsyncCompletion completion, void * context) override
+    {
+        if (!mDeferAsyncCompletions)
+        {
+            return PersistentStorageDelegate::AsyncDeleteKeyValue(key, completion, context);
+        }
+
+        ReturnErrorOnFailure(SyncDeleteKeyValue(key));
+        mPendingCompletions.push_back({ key, completion, context });
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * @brief Hold back the completions of asynchronous writes until CompleteAsyncWrites() is called,
+     *        as slow storage would. The values are readable right away either way.
+     */
+    virtual void SetDeferAsyncCompletions(bool defer) { mDeferAsyncCompletions = defer; }
+
+    /**
+     * @return the number of asynchronous writes and deletes whose completion is held back
+     */
+    virtual size_t GetPendingAsyncWriteCount() { return mPendingCompletions.size(); }
+
+    /**
+     * @brief Call the held back completions, in order, with the given result.
+     */
+    virtual void CompleteAsyncWrites(CHIP_ERROR result = CHIP_NO_ERROR)
+    {
+        std::vector<PendingCompletion> completions;
+        completions.swap(mPendingCompletions);
+        for (const PendingCompletion & pending : completions)
+        {
+            if (pending.completion != nullptr)
+            {
+                pending.completion(pending.context, pending.key.c_str(), result);
+            }
+        }
+    }
+
     /**
      * @brief Adds a "poison key": a key that, if read/written, implies some bad
      *        behavior occurred.
@@ -276,10 +328,19 @@ protected:
         return CHIP_NO_ERROR;
     }
 
+    struct PendingCompletion
+    {
+        std::string key;
+        AsyncCompletion completion;
+        void * context;
+    };
+
     std::map<std::string, std::vector<uint8_t>> mStorage;
     std::set<std::string> mPoisonKeys;
-    bool mRejectWrites         = false;
-    LoggingLevel mLoggingLevel = LoggingLevel::kDisabled;
+    std::vector<PendingCompletion> mPendingCompletions;
+    bool mRejectWrites          = false;
+    bool mDeferAsyncCompletions = false;
+    LoggingLevel mLoggingLevel  = LoggingLevel::kDisabled;
 };
 
 } // namespace chip
@@ -17,6 +17,10 @@
 
 #include "lib/support/CHIPMemString.h"
 #include "lib/support/ScopedBuffer.h"
+#include <cmath>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
 #include <json/json.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/Base64.h>
@@ -329,6 +333,261 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR WriteJson(JsonOutputStream & output, const char * text)
+{
+    return output.Write(CharSpan::fromCharString(text));
+}
+
+/*
+ * Writes the given string as a quoted JSON string, escaping what needs to be.
+ */
+CHIP_ERROR WriteJsonString(JsonOutputStream & output, const CharSpan & str)
+{
+    ReturnErrorOnFailure(WriteJson(output, "\""));
+
+    size_t unescapedStart = 0;
+    for (size_t i = 0; i < str.size(); i++)
+    {
+        const unsigned char c = static_cast<unsigned char>(str.data()[i]);
+        if (c >= 0x20 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+
+        ReturnErrorOnFailure(output.Write(str.SubSpan(unescapedStart, i - unescapedStart)));
+        unescapedStart = i + 1;
+
+        char escaped[7];
+        switch (c)
+        {
+        case '"':
+            ReturnErrorOnFailure(WriteJson(output, "\\\""));
+            break;
+        case '\\':
+            ReturnErrorOnFailure(WriteJson(output, "\\\\"));
+            break;
+        case '\n':
+            ReturnErrorOnFailure(WriteJson(output, "\\n"));
+            break;
+        case '\r':
+            ReturnErrorOnFailure(WriteJson(output, "\\r"));
+            break;
+        case '\t':
+            ReturnErrorOnFailure(WriteJson(output, "\\t"));
+            break;
+        default:
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            ReturnErrorOnFailure(WriteJson(output, escaped));
+            break;
+        }
+    }
+    ReturnErrorOnFailure(output.Write(str.SubSpan(unescapedStart)));
+
+    return WriteJson(output, "\"");
+}
+
+/*
+ * Given a TLVReader positioned on an array, finds the type of its elements without moving the reader, and validates that
+ * they all have that type.
+ */
+CHIP_ERROR GetTlvArraySubType(const TLV::TLVReader & arrayReader, ElementTypeContext & subType)
+{
+    CHIP_ERROR err;
+    TLV::TLVReader reader;
+    TLV::TLVType containerType;
+    bool first = true;
+
+    reader.Init(arrayReader);
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+        VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+        ElementTypeContext elementType;
+        elementType.tlvType = reader.GetType();
+        if (elementType.tlvType == TLV::kTLVType_FloatingPointNumber)
+        {
+            elementType.isDouble = reader.IsElementDouble();
+        }
+
+        if (first)
+        {
+            subType = elementType;
+            first   = false;
+        }
+        else
+        {
+            VerifyOrReturnError(subType.tlvType == elementType.tlvType && subType.isDouble == elementType.isDouble,
+                                CHIP_ERROR_INVALID_TLV_ELEMENT);
+        }
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR StreamTlvValue(TLV::TLVReader & reader, JsonOutputStream & output);
+
+CHIP_ERROR StreamTlvStruct(TLV::TLVReader & reader, JsonOutputStream & output)
+{
+    CHIP_ERROR err;
+    TLV::TLVType containerType;
+    bool first = true;
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(WriteJson(output, "{"));
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        TLV::Tag tag = reader.GetTag();
+        VerifyOrReturnError(TLV::IsContextTag(tag) || TLV::IsProfileTag(tag), CHIP_ERROR_INVALID_TLV_TAG);
+
+        if (TLV::IsProfileTag(tag) && TLV::VendorIdFromTag(tag) == 0)
+        {
+            VerifyOrReturnError(TLV::TagNumFromTag(tag) > UINT8_MAX, CHIP_ERROR_INVALID_TLV_TAG);
+        }
+
+        JsonObjectElementContext context(reader);
+        if (context.type.tlvType == TLV::kTLVType_Array)
+        {
+            // The element name carries the type of the array elements, which must be known before they are written.
+            ReturnErrorOnFailure(GetTlvArraySubType(reader, context.subType));
+        }
+
+        if (!first)
+        {
+            ReturnErrorOnFailure(WriteJson(output, ","));
+        }
+        first = false;
+
+        std::string name = context.GenerateJsonElementName();
+        ReturnErrorOnFailure(WriteJsonString(output, CharSpan(name.data(), name.size())));
+        ReturnErrorOnFailure(WriteJson(output, ":"));
+        ReturnErrorOnFailure(StreamTlvValue(reader, output));
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(WriteJson(output, "}"));
+    return reader.ExitContainer(containerType);
+}
+
+CHIP_ERROR StreamTlvArray(TLV::TLVReader & reader, JsonOutputStream & output)
+{
+    CHIP_ERROR err;
+    TLV::TLVType containerType;
+    bool first = true;
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(WriteJson(output, "["));
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (!first)
+        {
+            ReturnErrorOnFailure(WriteJson(output, ","));
+        }
+        first = false;
+
+        ReturnErrorOnFailure(StreamTlvValue(reader, output));
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(WriteJson(output, "]"));
+    return reader.ExitContainer(containerType);
+}
+
+/*
+ * Writes the JSON value of the element the reader is positioned on, formatted like Json::StyledWriter formats the value
+ * TlvToJson builds for it.
+ */
+CHIP_ERROR StreamTlvValue(TLV::TLVReader & reader, JsonOutputStream & output)
+{
+    char number[32];
+
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        // Values that do not fit 32 bits are strings, as in TlvToJson.
+        snprintf(number, sizeof(number), CanCastTo<uint32_t>(v) ? "%" PRIu64 : "\"%" PRIu64 "\"", v);
+        return WriteJson(output, number);
+    }
+
+    case TLV::kTLVType_SignedInteger: {
+        int64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        snprintf(number, sizeof(number), CanCastTo<int32_t>(v) ? "%" PRId64 : "\"%" PRId64 "\"", v);
+        return WriteJson(output, number);
+    }
+
+    case TLV::kTLVType_Boolean: {
+        bool v;
+        ReturnErrorOnFailure(reader.Get(v));
+        return WriteJson(output, v ? "true" : "false");
+    }
+
+    case TLV::kTLVType_FloatingPointNumber: {
+        double v;
+        ReturnErrorOnFailure(reader.Get(v));
+        if (v == std::numeric_limits<double>::infinity())
+        {
+            return WriteJsonString(output, CharSpan::fromCharString(kFloatingPointPositiveInfinity));
+        }
+        if (v == -std::numeric_limits<double>::infinity())
+        {
+            return WriteJsonString(output, CharSpan::fromCharString(kFloatingPointNegativeInfinity));
+        }
+        if (std::isnan(v))
+        {
+            return WriteJson(output, "null");
+        }
+        snprintf(number, sizeof(number), "%.17g", v);
+        ReturnErrorOnFailure(WriteJson(output, number));
+        // Keep the value a real number, not an integer, for JSON readers.
+        if (strpbrk(number, ".e") == nullptr)
+        {
+            ReturnErrorOnFailure(WriteJson(output, ".0"));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    case TLV::kTLVType_ByteString: {
+        ByteSpan span;
+        ReturnErrorOnFailure(reader.Get(span));
+
+        Platform::ScopedMemoryBuffer<char> byteString;
+        byteString.Alloc(BASE64_ENCODED_LEN(span.size()) + 1);
+        VerifyOrReturnError(byteString.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        auto encodedLen = Base64Encode(span.data(), static_cast<uint16_t>(span.size()), byteString.Get());
+        ReturnErrorOnFailure(WriteJson(output, "\""));
+        ReturnErrorOnFailure(output.Write(CharSpan(byteString.Get(), encodedLen)));
+        return WriteJson(output, "\"");
+    }
+
+    case TLV::kTLVType_UTF8String: {
+        CharSpan span;
+        ReturnErrorOnFailure(reader.Get(span));
+        return WriteJsonString(output, span);
+    }
+
+    case TLV::kTLVType_Null:
+        return WriteJson(output, "null");
+
+    case TLV::kTLVType_Structure:
+        return StreamTlvStruct(reader, output);
+
+    case TLV::kTLVType_Array:
+        return StreamTlvArray(reader, output);
+
+    default:
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
+    }
+}
+
 } // namespace
 
 CHIP_ERROR TlvToJson(const ByteSpan & tlv, std::string & jsonString)
@@ -357,4 +616,26 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString)
     jsonString = writer.write(jsonObject);
     return CHIP_NO_ERROR;
 }
+
+CHIP_ERROR TlvToJson(const ByteSpan & tlv, JsonOutputStream & output)
+{
+    TLV::TLVReader reader;
+    reader.Init(tlv);
+    reader.ImplicitProfileId = kTemporaryImplicitProfileId;
+
+    ReturnErrorOnFailure(reader.Next());
+    return TlvToJson(reader, output);
+}
+
+CHIP_ERROR TlvToJson(TLV::TLVReader & reader, JsonOutputStream & output)
+{
+    // The top level element must be a TLV Structure of Anonymous type.
+    VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+    VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+
+    // During json conversion, a implicit profile ID is required
+    ImplicitProfileIdChange implicitProfileIdChange(reader, kTemporaryImplicitProfileId);
+
+    return StreamTlvStruct(reader, output);
+}
 } // namespace chip
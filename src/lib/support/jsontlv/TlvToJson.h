@@ -33,4 +33,30 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString);
  * Given a TLV encoded byte array, this function converts it into JSON object.
  */
 CHIP_ERROR TlvToJson(const ByteSpan & tlv, std::string & jsonString);
+
+/*
+ * Receives the text of a JSON document piece by piece, as it is generated.
+ */
+class JsonOutputStream
+{
+public:
+    virtual ~JsonOutputStream() = default;
+
+    virtual CHIP_ERROR Write(const CharSpan & text) = 0;
+};
+
+/*
+ * Same conversion as TlvToJson above, but the JSON text is written to the output stream while the TLV is read, without
+ * building a Json::Value tree of the whole payload first. Memory use is bounded by the largest single element (e.g. the
+ * Base64 encoding of a byte string) and the nesting depth, not by the size of the payload.
+ *
+ * The generated JSON is compact (no whitespace) and object members are in TLV order. Once parsed, it is equal to the
+ * output of TlvToJson.
+ */
+CHIP_ERROR TlvToJson(TLV::TLVReader & reader, JsonOutputStream & output);
+
+/*
+ * Given a TLV encoded byte array, this function streams its JSON object representation to the output stream.
+ */
+CHIP_ERROR TlvToJson(const ByteSpan & tlv, JsonOutputStream & output);
 } // namespace chip
@@ -0,0 +1,454 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "DeferredLogging.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace chip {
+namespace Logging {
+namespace {
+
+// One conversion specification of a format string, e.g. "%-*.*s".
+struct ConversionSpec
+{
+    size_t length        = 0;  // of the whole specification, starting at the '%'
+    unsigned stars       = 0;  // '*' width and precision, each taking an int argument
+    bool precisionIsStar = false;
+    int precision        = -1; // literal precision, -1 if none
+    char conversion      = 0;
+};
+
+enum class LengthModifier : uint8_t
+{
+    kNone,
+    kChar,
+    kShort,
+    kLong,
+    kLongLong,
+    kIntMax,
+    kSize,
+    kPtrDiff,
+};
+
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * Parse the conversion specification at format (which points at a '%' not followed by another
+ * '%') and determine the kind of its argument.
+ *
+ * @return false if the conversion is not supported.
+ */
+template <typename ArgKind>
+bool ParseSpec(const char * format, ConversionSpec & spec, ArgKind & kind)
+{
+    const char * p = format + 1;
+
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0')
+    {
+        p++;
+    }
+
+    if (*p == '*')
+    {
+        spec.stars++;
+        p++;
+    }
+    else
+    {
+        while (IsDigit(*p))
+        {
+            p++;
+        }
+    }
+
+    if (*p == '.')
+    {
+        p++;
+        if (*p == '*')
+        {
+            spec.stars++;
+            spec.precisionIsStar = true;
+            p++;
+        }
+        else
+        {
+            spec.precision = 0;
+            while (IsDigit(*p))
+            {
+                spec.precision = (spec.precision < 100000) ? spec.precision * 10 + (*p - '0') : spec.precision;
+                p++;
+            }
+        }
+    }
+
+    LengthModifier modifier = LengthModifier::kNone;
+    switch (*p)
+    {
+    case 'h':
+        modifier = (p[1] == 'h') ? LengthModifier::kChar : LengthModifier::kShort;
+        p += (p[1] == 'h') ? 2 : 1;
+        break;
+    case 'l':
+        modifier = (p[1] == 'l') ? LengthModifier::kLongLong : LengthModifier::kLong;
+        p += (p[1] == 'l') ? 2 : 1;
+        break;
+    case 'j':
+        modifier = LengthModifier::kIntMax;
+        p++;
+        break;
+    case 'z':
+        modifier = LengthModifier::kSize;
+        p++;
+        break;
+    case 't':
+        modifier = LengthModifier::kPtrDiff;
+        p++;
+        break;
+    default:
+        break;
+    }
+
+    spec.conversion = *p;
+    switch (spec.conversion)
+    {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+        switch (modifier)
+        {
+        case LengthModifier::kLong:
+            kind = ArgKind::kLong;
+            break;
+        case LengthModifier::kLongLong:
+            kind = ArgKind::kLongLong;
+            break;
+        case LengthModifier::kIntMax:
+            kind = ArgKind::kIntMax;
+            break;
+        case LengthModifier::kSize:
+            kind = ArgKind::kSize;
+            break;
+        case LengthModifier::kPtrDiff:
+            kind = ArgKind::kPtrDiff;
+            break;
+        default:
+            // char and short arguments are promoted to int.
+            kind = ArgKind::kInt;
+            break;
+        }
+        break;
+    case 'c':
+        if (modifier != LengthModifier::kNone)
+        {
+            return false;
+        }
+        kind = ArgKind::kInt;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        if (modifier != LengthModifier::kNone && modifier != LengthModifier::kLong)
+        {
+            return false;
+        }
+        kind = ArgKind::kDouble;
+        break;
+    case 'p':
+        if (modifier != LengthModifier::kNone)
+        {
+            return false;
+        }
+        kind = ArgKind::kPointer;
+        break;
+    case 's':
+        if (modifier != LengthModifier::kNone)
+        {
+            return false;
+        }
+        kind = ArgKind::kString;
+        break;
+    default:
+        // %n, wide characters, long doubles, and malformed specifications.
+        return false;
+    }
+
+    spec.length = static_cast<size_t>(p + 1 - format);
+    return true;
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+
+// The specification was validated against the type of value when the message was captured.
+template <typename T>
+int FormatOne(char * buffer, size_t bufferSize, const char * spec, unsigned stars, const int * starValues, T value)
+{
+    switch (stars)
+    {
+    case 0:
+        return snprintf(buffer, bufferSize, spec, value);
+    case 1:
+        return snprintf(buffer, bufferSize, spec, starValues[0], value);
+    default:
+        return snprintf(buffer, bufferSize, spec, starValues[0], starValues[1], value);
+    }
+}
+
+#pragma GCC diagnostic pop
+
+} // namespace
+
+bool DeferredLogBuffer::Capture(Record & record, const char * format, va_list args)
+{
+    size_t argCount    = 0;
+    size_t stringBytes = 0;
+
+    for (const char * p = format; *p != '\0';)
+    {
+        if (*p != '%')
+        {
+            p++;
+            continue;
+        }
+        if (p[1] == '%')
+        {
+            p += 2;
+            continue;
+        }
+
+        ConversionSpec spec;
+        ArgKind kind;
+        if (!ParseSpec(p, spec, kind))
+        {
+            return false;
+        }
+        if (argCount + spec.stars + 1 > kMaxArgs)
+        {
+            return false;
+        }
+
+        int precision = spec.precision;
+        for (unsigned i = 0; i < spec.stars; i++)
+        {
+            record.kinds[argCount]  = ArgKind::kInt;
+            record.args[argCount].i = va_arg(args, int);
+            precision               = record.args[argCount].i;
+            argCount++;
+        }
+        precision = (spec.precisionIsStar || spec.precision >= 0) ? precision : -1;
+
+        ArgValue & value       = record.args[argCount];
+        record.kinds[argCount] = kind;
+        argCount++;
+
+        switch (kind)
+        {
+        case ArgKind::kInt:
+            value.i = va_arg(args, int);
+            break;
+        case ArgKind::kLong:
+            value.l = va_arg(args, long);
+            break;
+        case ArgKind::kLongLong:
+            value.ll = va_arg(args, long long);
+            break;
+        case ArgKind::kIntMax:
+            value.im = va_arg(args, intmax_t);
+            break;
+        case ArgKind::kSize:
+            value.z = va_arg(args, size_t);
+            break;
+        case ArgKind::kPtrDiff:
+            value.t = va_arg(args, ptrdiff_t);
+            break;
+        case ArgKind::kDouble:
+            value.d = va_arg(args, double);
+            break;
+        case ArgKind::kPointer:
+            value.p = va_arg(args, const void *);
+            break;
+        case ArgKind::kString: {
+            const char * string = va_arg(args, const char *);
+            string              = (string != nullptr) ? string : "(null)";
+            if (stringBytes >= kStringBytes)
+            {
+                return false;
+            }
+
+            // Honor the precision: the string does not need to be terminated within it.
+            size_t length = (precision >= 0) ? strnlen(string, static_cast<size_t>(precision)) : strlen(string);
+            length        = (length < kStringBytes - stringBytes - 1) ? length : kStringBytes - stringBytes - 1;
+            memcpy(&record.strings[stringBytes], string, length);
+            record.strings[stringBytes + length] = '\0';
+            value.stringOffset                   = static_cast<uint16_t>(stringBytes);
+            stringBytes += length + 1;
+            break;
+        }
+        }
+
+        p += spec.length;
+    }
+
+    record.format = format;
+    return true;
+}
+
+void DeferredLogBuffer::Format(const Record & record, char * buffer, size_t bufferSize)
+{
+    if (bufferSize == 0)
+    {
+        return;
+    }
+    buffer[0] = '\0';
+
+    size_t used     = 0;
+    size_t argIndex = 0;
+    for (const char * p = record.format; *p != '\0' && used + 1 < bufferSize;)
+    {
+        if (*p != '%' || p[1] == '%')
+        {
+            buffer[used++] = *p;
+            p += (*p == '%') ? 2 : 1;
+            continue;
+        }
+
+        ConversionSpec spec;
+        ArgKind kind;
+        if (!ParseSpec(p, spec, kind) || spec.length >= 32)
+        {
+            // Cannot happen for captured records, but never format beyond what was captured.
+            break;
+        }
+
+        char specString[32];
+        memcpy(specString, p, spec.length);
+        specString[spec.length] = '\0';
+
+        int starValues[2] = { 0, 0 };
+        for (unsigned i = 0; i < spec.stars && i < 2; i++)
+        {
+            starValues[i] = record.args[argIndex++].i;
+        }
+
+        const ArgValue & value = record.args[argIndex++];
+        char * out             = &buffer[used];
+        size_t available       = bufferSize - used;
+        int written            = 0;
+        switch (kind)
+        {
+        case ArgKind::kInt:
+            written = FormatOne(out, available, specString, spec.stars, starValues, value.i);
+            break;
+        case ArgKind::kLong:
+            written = FormatOne(out, available, specString, spec.stars, starValues, value.l);
+            break;
+        case ArgKind::kLongLong:
+            written = FormatOne(out, available, specString, spec.stars, starValues, value.ll);
+            break;
+        case ArgKind::kIntMax:
+            written = FormatOne(out, available, specString, spec.stars, starValues, value.im);
+            break;
+        case ArgKind::kSize:
+            written = FormatOne(out, available, specString, spec.stars, starValues, value.z);
+            break;
+        case ArgKind::kPtrDiff:
+            written = FormatOne(out, available, specString, spec.stars, starValues, value.t);
+            break;
+        case ArgKind::kDouble:
+            written = FormatOne(out, available, specString, spec.stars, starValues, value.d);
+            break;
+        case ArgKind::kPointer:
+            written = FormatOne(out, available, specString, spec.stars, starValues, value.p);
+            break;
+        case ArgKind::kString:
+            written = FormatOne(out, available, specString, spec.stars, starValues, &record.strings[value.stringOffset]);
+            break;
+        }
+
+        if (written < 0)
+        {
+            break;
+        }
+        used += (static_cast<size_t>(written) < available) ? static_cast<size_t>(written) : available - 1;
+        p += spec.length;
+    }
+
+    buffer[used] = '\0';
+}
+
+bool DeferredLogBuffer::Append(uint8_t module, uint8_t category, const char * format, va_list args)
+{
+    Record record;
+    if (!Capture(record, format, args))
+    {
+        return false;
+    }
+    record.module   = module;
+    record.category = category;
+
+    if (!TryLock())
+    {
+        return false;
+    }
+    if (mCount == kCapacity)
+    {
+        mOldest = (mOldest + 1) % kCapacity;
+        mCount--;
+        mDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    mRecords[(mOldest + mCount) % kCapacity] = record;
+    mCount++;
+    Unlock();
+    return true;
+}
+
+size_t DeferredLogBuffer::Drain(DrainCallback callback, void * context, char * buffer, size_t bufferSize)
+{
+    size_t drained = 0;
+    while (TryLock())
+    {
+        if (mCount == 0)
+        {
+            Unlock();
+            break;
+        }
+        Record record = mRecords[mOldest];
+        mOldest       = (mOldest + 1) % kCapacity;
+        mCount--;
+        Unlock();
+
+        Format(record, buffer, bufferSize);
+        callback(record.module, record.category, buffer, context);
+        drained++;
+    }
+    return drained;
+}
+
+} // namespace Logging
+} // namespace chip
@@ -0,0 +1,149 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Deferred formatting of log messages: messages are stored as their format string and
+ *      raw arguments, and only formatted when read out.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/EnforceFormat.h>
+
+#include <atomic>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Logging {
+
+/**
+ * A ring of log messages whose formatting is deferred until they are drained.
+ *
+ * Appending a message only walks its format string to collect the arguments; string arguments
+ * are copied (and truncated to kStringBytes in total), everything else is stored as is. This
+ * relies on format strings being constants that outlive the buffer, which holds for all
+ * ChipLog* macros. When the ring is full the oldest messages are dropped.
+ *
+ * Messages that cannot be deferred (unsupported conversions such as %n or %Lf, more than
+ * kMaxArgs arguments, or a concurrent access to the ring) are rejected, and should be
+ * formatted right away by the caller.
+ *
+ * THREAD SAFETY:
+ *    Append and Drain may be called from any thread; they never block, but fail on contention.
+ */
+class DeferredLogBuffer
+{
+public:
+    static constexpr size_t kCapacity    = CHIP_CONFIG_DEFERRED_LOG_RECORDS;
+    static constexpr size_t kMaxArgs     = CHIP_CONFIG_DEFERRED_LOG_MAX_ARGS;
+    static constexpr size_t kStringBytes = CHIP_CONFIG_DEFERRED_LOG_STRING_BYTES;
+
+    /// Receives one formatted message; the message is only valid during the call.
+    using DrainCallback = void (*)(uint8_t module, uint8_t category, const char * message, void * context);
+
+    /**
+     * Store a message without formatting it.
+     *
+     * @return false if the message was not stored.  args are consumed either way, so callers that
+     *         fall back to formatting must pass a copy.
+     */
+    bool Append(uint8_t module, uint8_t category, const char * format, va_list args) ENFORCE_FORMAT(4, 0);
+
+    /**
+     * Format the stored messages into buffer, oldest first, passing each one to callback and
+     * removing it.  Messages longer than bufferSize are truncated.
+     *
+     * @return the number of messages drained.
+     */
+    size_t Drain(DrainCallback callback, void * context, char * buffer, size_t bufferSize);
+
+    /// Number of messages dropped because the ring was full.
+    uint32_t GetDroppedCount() const { return mDropped.load(std::memory_order_relaxed); }
+
+private:
+    enum class ArgKind : uint8_t
+    {
+        kInt,
+        kLong,
+        kLongLong,
+        kIntMax,
+        kSize,
+        kPtrDiff,
+        kDouble,
+        kPointer,
+        kString,
+    };
+
+    union ArgValue
+    {
+        int i;
+        long l;
+        long long ll;
+        intmax_t im;
+        size_t z;
+        ptrdiff_t t;
+        double d;
+        const void * p;
+        uint16_t stringOffset; // into Record::strings
+    };
+
+    struct Record
+    {
+        const char * format;
+        uint8_t module;
+        uint8_t category;
+        ArgKind kinds[kMaxArgs];
+        ArgValue args[kMaxArgs];
+        char strings[kStringBytes];
+    };
+
+    static bool Capture(Record & record, const char * format, va_list args);
+    static void Format(const Record & record, char * buffer, size_t bufferSize);
+
+    bool TryLock() { return !mLock.test_and_set(std::memory_order_acquire); }
+    void Unlock() { mLock.clear(std::memory_order_release); }
+
+    Record mRecords[kCapacity];
+    size_t mOldest = 0;
+    size_t mCount  = 0;
+    std::atomic<uint32_t> mDropped{ 0 };
+    std::atomic_flag mLock = ATOMIC_FLAG_INIT;
+};
+
+#if CHIP_CONFIG_DEFERRED_LOGGING
+
+/**
+ * The buffer that chip::Logging::LogV stores messages into when CHIP_CONFIG_DEFERRED_LOGGING is
+ * enabled, instead of formatting them.
+ */
+DeferredLogBuffer & GetDeferredLogBuffer();
+
+/**
+ * Format the deferred messages and hand them to the regular log output (the log redirect
+ * callback if set, the platform logging otherwise).
+ *
+ * @return the number of messages flushed.
+ */
+size_t FlushDeferredLogs();
+
+#endif // CHIP_CONFIG_DEFERRED_LOGGING
+
+} // namespace Logging
+} // namespace chip
@@ -26,6 +26,7 @@
 
 #include <lib/core/CHIPConfig.h>
 #include <lib/support/CHIPMem.h>
+#include <lib/support/logging/DeferredLogging.h>
 
 #include <platform/logging/LogV.h>
 
@@ -154,7 +155,9 @@ void Log(uint8_t module, uint8_t category, const char * msg, ...)
     va_end(v);
 }
 
-void LogV(uint8_t module, uint8_t category, const char * msg, va_list args)
+namespace {
+
+void EmitV(uint8_t module, uint8_t category, const char * msg, va_list args)
 {
     const char * moduleName        = GetModuleName(static_cast<LogModule>(module));
     LogRedirectCallback_t redirect = sLogRedirectCallback.load();
@@ -168,6 +171,58 @@ void LogV(uint8_t module, uint8_t category, const char * msg, va_list args)
     }
 }
 
+#if CHIP_CONFIG_DEFERRED_LOGGING
+
+DeferredLogBuffer sDeferredLogBuffer;
+
+void ENFORCE_FORMAT(3, 4) Emit(uint8_t module, uint8_t category, const char * msg, ...)
+{
+    va_list v;
+    va_start(v, msg);
+    EmitV(module, category, msg, v);
+    va_end(v);
+}
+
+void EmitDeferred(uint8_t module, uint8_t category, const char * message, void * context)
+{
+    Emit(module, category, "%s", message);
+}
+
+#endif // CHIP_CONFIG_DEFERRED_LOGGING
+
+} // namespace
+
+void LogV(uint8_t module, uint8_t category, const char * msg, va_list args)
+{
+#if CHIP_CONFIG_DEFERRED_LOGGING
+    va_list deferredArgs;
+    va_copy(deferredArgs, args);
+    bool deferred = sDeferredLogBuffer.Append(module, category, msg, deferredArgs);
+    va_end(deferredArgs);
+    if (deferred)
+    {
+        return;
+    }
+#endif // CHIP_CONFIG_DEFERRED_LOGGING
+
+    EmitV(module, category, msg, args);
+}
+
+#if CHIP_CONFIG_DEFERRED_LOGGING
+
+DeferredLogBuffer & GetDeferredLogBuffer()
+{
+    return sDeferredLogBuffer;
+}
+
+size_t FlushDeferredLogs()
+{
+    char buffer[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];
+    return sDeferredLogBuffer.Drain(EmitDeferred, nullptr, buffer, sizeof(buffer));
+}
+
+#endif // CHIP_CONFIG_DEFERRED_LOGGING
+
 #if CHIP_LOG_FILTERING
 std::atomic<uint8_t> gLogFilter(kLogCategory_Max);
 
@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/Base64.h>
+
+namespace {
+
+using namespace chip;
+
+// Alphabet of Base64 written without the built-in conversion functions, to exercise the general path.
+char ReferenceValToChar(uint8_t val)
+{
+    static const char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    return (val < 64) ? kAlphabet[val] : '=';
+}
+
+uint8_t ReferenceCharToVal(uint8_t c)
+{
+    const char * p = (c != 0) ? strchr("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", c) : nullptr;
+    return (p != nullptr) ? static_cast<uint8_t>(p - "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/")
+                          : UINT8_MAX;
+}
+
+struct TestVector
+{
+    const char * decoded;
+    const char * encoded;
+};
+
+// RFC 4648, section 10.
+const TestVector kTestVectors[] = {
+    { "", "" },         { "f", "Zg==" },         { "fo", "Zm8=" },         { "foo", "Zm9v" },
+    { "foob", "Zm9vYg==" }, { "fooba", "Zm9vYmE=" }, { "foobar", "Zm9vYmFy" },
+};
+
+} // namespace
+
+TEST(TestBase64, TestVectors)
+{
+    for (const auto & vector : kTestVectors)
+    {
+        char encoded[16];
+        uint8_t decoded[16];
+        const uint16_t decodedLen = static_cast<uint16_t>(strlen(vector.decoded));
+        const uint16_t encodedLen = static_cast<uint16_t>(strlen(vector.encoded));
+
+        EXPECT_EQ(Base64Encode(reinterpret_cast<const uint8_t *>(vector.decoded), decodedLen, encoded), encodedLen);
+        EXPECT_EQ(memcmp(encoded, vector.encoded, encodedLen), 0);
+
+        EXPECT_EQ(Base64Decode(vector.encoded, encodedLen, decoded), decodedLen);
+        EXPECT_EQ(memcmp(decoded, vector.decoded, decodedLen), 0);
+    }
+
+    // Padding may be left out.
+    uint8_t decoded[16];
+    EXPECT_EQ(Base64Decode("Zm9vYg", 6, decoded), 4u);
+    EXPECT_EQ(memcmp(decoded, "foob", 4), 0);
+
+    const uint8_t urlBytes[] = { 'B', 'a', 's', 'e', '6', '4', 0x0F, 0xEF, '1', '2', '3', '4', 0x0F, 0xFF };
+    char encoded[32];
+    EXPECT_EQ(Base64URLEncode(urlBytes, sizeof(urlBytes), encoded), 20u);
+    EXPECT_EQ(memcmp(encoded, "QmFzZTY0D-8xMjM0D_8=", 20), 0);
+    EXPECT_EQ(Base64URLDecode("QmFzZTY0D-8xMjM0D_8=", 20, decoded), sizeof(urlBytes));
+    EXPECT_EQ(memcmp(decoded, urlBytes, sizeof(urlBytes)), 0);
+    EXPECT_EQ(Base64Decode("QmFzZTY0D-8xMjM0D_8=", 20, decoded), UINT16_MAX);
+}
+
+TEST(TestBase64, TestInvalidInput)
+{
+    uint8_t decoded[16];
+
+    EXPECT_EQ(Base64Decode("Z", 1, decoded), UINT16_MAX);
+    EXPECT_EQ(Base64Decode("Zm9vY", 5, decoded), UINT16_MAX);
+    EXPECT_EQ(Base64Decode("Zm9vY;", 6, decoded), UINT16_MAX);
+    EXPECT_EQ(Base64Decode("Zm9vYmE;", 8, decoded), UINT16_MAX);
+    EXPECT_EQ(Base64Decode("Z\x01" "9vYmFy", 8, decoded), UINT16_MAX);
+
+    // Decoding stops at whitespace.
+    EXPECT_EQ(Base64Decode("Zm9 vYg", 7, decoded), UINT16_MAX);
+    EXPECT_EQ(Base64Decode("Zm9v vYg", 8, decoded), 3u);
+}
+
+TEST(TestBase64, TestMatchesGeneralPath)
+{
+    uint8_t bytes[300];
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    char encoded[BASE64_ENCODED_LEN(sizeof(bytes))];
+    char expected[BASE64_ENCODED_LEN(sizeof(bytes))];
+    uint8_t decoded[sizeof(bytes)];
+    for (uint16_t len = 0; len <= sizeof(bytes); len++)
+    {
+        const uint16_t encodedLen = Base64Encode(bytes, len, encoded);
+        ASSERT_EQ(Base64Encode(bytes, len, expected, ReferenceValToChar), encodedLen);
+        EXPECT_EQ(memcmp(encoded, expected, encodedLen), 0);
+
+        EXPECT_EQ(Base64Decode(encoded, encodedLen, decoded), len);
+        EXPECT_EQ(memcmp(decoded, bytes, len), 0);
+        EXPECT_EQ(Base64Decode(encoded, encodedLen, decoded, ReferenceCharToVal), len);
+        EXPECT_EQ(memcmp(decoded, bytes, len), 0);
+    }
+}
@@ -321,6 +321,43 @@ TEST(TestBytesToHex, TestHexToBytesAndUint)
     EXPECT_EQ(test16Out, test16OutExpected);
 }
 
+TEST(TestBytesToHex, TestHexRoundTrip)
+{
+    uint8_t bytes[256];
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    char hex[sizeof(bytes) * 2];
+    uint8_t decoded[sizeof(bytes)];
+    for (auto flags : { HexFlags::kNone, HexFlags::kUppercase })
+    {
+        EXPECT_EQ(BytesToHex(bytes, sizeof(bytes), hex, sizeof(hex), flags), CHIP_NO_ERROR);
+        for (size_t i = 0; i < sizeof(bytes); i++)
+        {
+            char expected[3];
+            snprintf(expected, sizeof(expected), (flags == HexFlags::kUppercase) ? "%02X" : "%02x", static_cast<unsigned>(i));
+            EXPECT_EQ(memcmp(&hex[i * 2], expected, 2), 0);
+        }
+
+        memset(decoded, 0, sizeof(decoded));
+        EXPECT_EQ(HexToBytes(hex, sizeof(hex), decoded, sizeof(decoded)), sizeof(decoded));
+        EXPECT_EQ(memcmp(decoded, bytes, sizeof(bytes)), 0);
+    }
+
+    // Every character that is not a hex digit is rejected, in either position of a byte.
+    for (unsigned c = 0; c <= UINT8_MAX; c++)
+    {
+        bool isDigit = (c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f');
+        char pair[2] = { static_cast<char>(c), '0' };
+        EXPECT_EQ(HexToBytes(pair, sizeof(pair), decoded, sizeof(decoded)), isDigit ? 1u : 0u);
+        pair[0] = '0';
+        pair[1] = static_cast<char>(c);
+        EXPECT_EQ(HexToBytes(pair, sizeof(pair), decoded, sizeof(decoded)), isDigit ? 1u : 0u);
+    }
+}
+
 TEST(TestBytesToHex, TestHexToBytesInPlace)
 {
     // Test that HexToBytes can decode in-place (dest_bytes == src_hex)
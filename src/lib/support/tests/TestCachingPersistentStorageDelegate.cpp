@@ -0,0 +1,169 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstring>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CachingPersistentStorageDelegate.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kLargeBudget = 1024;
+
+class TestCachingPersistentStorageDelegate : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+protected:
+    TestPersistentStorageDelegate mBacking;
+};
+
+TEST_F(TestCachingPersistentStorageDelegate, ReadsAreCached)
+{
+    CachingPersistentStorageDelegate cache(mBacking, kLargeBudget);
+    EXPECT_EQ(mBacking.SyncSetKeyValue("a", "123", 3), CHIP_NO_ERROR);
+
+    uint8_t buf[8];
+    uint16_t size = sizeof(buf);
+    EXPECT_EQ(cache.SyncGetKeyValue("a", buf, size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, 3u);
+    EXPECT_EQ(cache.GetStats().mMisses, 1u);
+    EXPECT_EQ(cache.GetStats().mHits, 0u);
+
+    // The second read does not reach the underlying storage.
+    mBacking.AddPoisonKey("a");
+    size = sizeof(buf);
+    memset(buf, 0, sizeof(buf));
+    EXPECT_EQ(cache.SyncGetKeyValue("a", buf, size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, 3u);
+    EXPECT_EQ(memcmp(buf, "123", 3), 0);
+    EXPECT_TRUE(cache.SyncDoesKeyExist("a"));
+    EXPECT_EQ(cache.GetStats().mHits, 2u);
+
+    // Short buffers get the start of the value, as from any storage.
+    size = 2;
+    EXPECT_EQ(cache.SyncGetKeyValue("a", buf, size), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(size, 2u);
+
+    cache.ResetStats();
+    EXPECT_EQ(cache.GetStats().mHits, 0u);
+}
+
+TEST_F(TestCachingPersistentStorageDelegate, MissingKeysAreCached)
+{
+    CachingPersistentStorageDelegate cache(mBacking, kLargeBudget);
+
+    uint8_t buf[8];
+    uint16_t size = sizeof(buf);
+    EXPECT_EQ(cache.SyncGetKeyValue("a", buf, size), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_FALSE(cache.SyncDoesKeyExist("a"));
+    EXPECT_FALSE(cache.SyncDoesKeyExist("b"));
+    EXPECT_FALSE(cache.SyncDoesKeyExist("b"));
+    EXPECT_EQ(cache.GetStats().mMisses, 2u);
+    EXPECT_EQ(cache.GetStats().mHits, 2u);
+}
+
+TEST_F(TestCachingPersistentStorageDelegate, WritesGoThrough)
+{
+    CachingPersistentStorageDelegate cache(mBacking, kLargeBudget);
+
+    uint8_t buf[8];
+    uint16_t size = sizeof(buf);
+    EXPECT_EQ(cache.SyncGetKeyValue("a", buf, size), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    EXPECT_EQ(cache.SyncSetKeyValue("a", "xy", 2), CHIP_NO_ERROR);
+    EXPECT_TRUE(mBacking.SyncDoesKeyExist("a"));
+    size = sizeof(buf);
+    EXPECT_EQ(cache.SyncGetKeyValue("a", buf, size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, 2u);
+    EXPECT_EQ(memcmp(buf, "xy", 2), 0);
+
+    EXPECT_EQ(cache.SyncDeleteKeyValue("a"), CHIP_NO_ERROR);
+    EXPECT_FALSE(mBacking.SyncDoesKeyExist("a"));
+    EXPECT_FALSE(cache.SyncDoesKeyExist("a"));
+    EXPECT_EQ(cache.GetStats().mMisses, 1u);
+    EXPECT_EQ(cache.GetStats().mHits, 2u);
+
+    // A failed write leaves the value unknown.
+    EXPECT_EQ(cache.SyncSetKeyValue("b", "1", 1), CHIP_NO_ERROR);
+    mBacking.SetRejectWrites(true);
+    EXPECT_NE(cache.SyncSetKeyValue("b", "2", 1), CHIP_NO_ERROR);
+    mBacking.SetRejectWrites(false);
+    size = sizeof(buf);
+    EXPECT_EQ(cache.SyncGetKeyValue("b", buf, size), CHIP_NO_ERROR);
+    EXPECT_EQ(buf[0], '1');
+    EXPECT_EQ(cache.GetStats().mMisses, 2u);
+}
+
+TEST_F(TestCachingPersistentStorageDelegate, LeastRecentlyUsedAreEvicted)
+{
+    uint8_t value[64] = {};
+    uint8_t buf[sizeof(value)];
+    uint16_t size = sizeof(buf);
+
+    size_t entryCost = 0;
+    {
+        CachingPersistentStorageDelegate probe(mBacking, kLargeBudget);
+        EXPECT_EQ(probe.SyncSetKeyValue("a", value, sizeof(value)), CHIP_NO_ERROR);
+        entryCost = probe.GetUsedBytes();
+    }
+
+    // Room for two of the values, not three.
+    CachingPersistentStorageDelegate cache(mBacking, 2 * entryCost + entryCost / 2);
+    EXPECT_EQ(cache.SyncSetKeyValue("a", value, sizeof(value)), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.SyncSetKeyValue("b", value, sizeof(value)), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.SyncGetKeyValue("a", buf, size), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetStats().mHits, 1u);
+
+    EXPECT_EQ(cache.SyncSetKeyValue("c", value, sizeof(value)), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetStats().mEvictions, 1u);
+    EXPECT_EQ(cache.GetUsedBytes(), 2 * entryCost);
+
+    // "b" was the least recently used.
+    EXPECT_TRUE(cache.SyncDoesKeyExist("a"));
+    EXPECT_TRUE(cache.SyncDoesKeyExist("c"));
+    EXPECT_EQ(cache.GetStats().mMisses, 0u);
+    EXPECT_TRUE(cache.SyncDoesKeyExist("b"));
+    EXPECT_EQ(cache.GetStats().mMisses, 1u);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetUsedBytes(), 0u);
+}
+
+TEST_F(TestCachingPersistentStorageDelegate, OversizedValuesAreNotCached)
+{
+    uint8_t value[128] = {};
+    uint8_t buf[sizeof(value)];
+    uint16_t size = sizeof(buf);
+
+    CachingPersistentStorageDelegate cache(mBacking, sizeof(value));
+    EXPECT_EQ(cache.SyncSetKeyValue("a", value, sizeof(value)), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetUsedBytes(), 0u);
+    EXPECT_EQ(cache.SyncGetKeyValue("a", buf, size), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetStats().mMisses, 1u);
+}
+
+} // namespace
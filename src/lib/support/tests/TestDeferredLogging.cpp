@@ -0,0 +1,131 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <stdarg.h>
+#include <string>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/EnforceFormat.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/logging/DeferredLogging.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Logging;
+
+struct DrainedMessage
+{
+    uint8_t module;
+    uint8_t category;
+    std::string message;
+};
+
+bool ENFORCE_FORMAT(3, 4) Append(DeferredLogBuffer & buffer, uint8_t module, const char * format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    bool appended = buffer.Append(module, kLogCategory_Progress, format, args);
+    va_end(args);
+    return appended;
+}
+
+std::vector<DrainedMessage> Drain(DeferredLogBuffer & buffer, size_t bufferSize = 128)
+{
+    std::vector<DrainedMessage> messages;
+    std::vector<char> text(bufferSize);
+    buffer.Drain(
+        [](uint8_t module, uint8_t category, const char * message, void * context) {
+            static_cast<std::vector<DrainedMessage> *>(context)->push_back({ module, category, message });
+        },
+        &messages, text.data(), text.size());
+    return messages;
+}
+
+TEST(TestDeferredLogging, TestFormatting)
+{
+    static DeferredLogBuffer buffer;
+
+    char name[] = "deferred";
+    EXPECT_TRUE(Append(buffer, kLogModule_Support, "int %d, unsigned %u, hex 0x%04x, char %c%%", -12, 34u, 0xab, 'z'));
+    EXPECT_TRUE(Append(buffer, kLogModule_Support, "string '%s' '%.*s' '%-6s|'", name, 3, name, "ab"));
+    EXPECT_TRUE(Append(buffer, kLogModule_Support, "node " ChipLogFormatX64 " size %zu", ChipLogValueX64(0x0123456789ABCDEF),
+                       static_cast<size_t>(42)));
+    EXPECT_TRUE(Append(buffer, kLogModule_Support, "%*d|%.2f|%s", 5, 7, 1.5, "end"));
+
+    // String arguments are copied when appended.
+    name[0] = 'X';
+
+    std::vector<DrainedMessage> messages = Drain(buffer);
+    ASSERT_EQ(messages.size(), 4u);
+    EXPECT_EQ(messages[0].module, kLogModule_Support);
+    EXPECT_EQ(messages[0].category, kLogCategory_Progress);
+    EXPECT_EQ(messages[0].message, "int -12, unsigned 34, hex 0x00ab, char z%");
+    EXPECT_EQ(messages[1].message, "string 'deferred' 'def' 'ab    |'");
+    EXPECT_EQ(messages[2].message, "node 0123456789ABCDEF size 42");
+    EXPECT_EQ(messages[3].message, "    7|1.50|end");
+
+    EXPECT_TRUE(Drain(buffer).empty());
+
+    // Drained messages are truncated to the buffer.
+    EXPECT_TRUE(Append(buffer, kLogModule_Support, "%s and more", "long message"));
+    messages = Drain(buffer, 8);
+    ASSERT_EQ(messages.size(), 1u);
+    EXPECT_EQ(messages[0].message, "long me");
+}
+
+TEST(TestDeferredLogging, TestRejected)
+{
+    static DeferredLogBuffer buffer;
+
+    int count = 0;
+    EXPECT_FALSE(Append(buffer, kLogModule_Support, "count%n", &count));
+    EXPECT_FALSE(Append(buffer, kLogModule_Support, "%Lf", static_cast<long double>(1.0)));
+    EXPECT_FALSE(Append(buffer, kLogModule_Support, "%d %d %d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6, 7, 8, 9));
+
+    // Strings are truncated to kStringBytes in total; once there is no room left, appending fails.
+    std::string longString(DeferredLogBuffer::kStringBytes * 2, 'a');
+    EXPECT_FALSE(Append(buffer, kLogModule_Support, "%s%s", longString.c_str(), "b"));
+    EXPECT_TRUE(Append(buffer, kLogModule_Support, "%s", longString.c_str()));
+    std::vector<DrainedMessage> messages = Drain(buffer);
+    ASSERT_EQ(messages.size(), 1u);
+    EXPECT_EQ(messages[0].message, std::string(DeferredLogBuffer::kStringBytes - 1, 'a'));
+
+    EXPECT_TRUE(Drain(buffer).empty());
+}
+
+TEST(TestDeferredLogging, TestOverflow)
+{
+    static DeferredLogBuffer buffer;
+
+    for (size_t i = 0; i < DeferredLogBuffer::kCapacity + 3; i++)
+    {
+        EXPECT_TRUE(Append(buffer, kLogModule_Support, "message %u", static_cast<unsigned>(i)));
+    }
+    EXPECT_EQ(buffer.GetDroppedCount(), 3u);
+
+    // The oldest messages were dropped.
+    std::vector<DrainedMessage> messages = Drain(buffer);
+    ASSERT_EQ(messages.size(), DeferredLogBuffer::kCapacity);
+    EXPECT_EQ(messages.front().message, "message 3");
+    EXPECT_EQ(messages.back().message, "message " + std::to_string(DeferredLogBuffer::kCapacity + 2));
+}
+
+} // namespace
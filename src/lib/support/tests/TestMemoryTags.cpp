@@ -0,0 +1,108 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/MemoryTags.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Platform;
+
+namespace {
+
+class TestMemoryTags : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { MemoryShutdown(); }
+};
+
+TEST_F(TestMemoryTags, TestNames)
+{
+    for (uint8_t tag = 0; tag < static_cast<uint8_t>(MemoryTag::kCount); tag++)
+    {
+        EXPECT_NE(strcmp(MemoryTagName(static_cast<MemoryTag>(tag)), "?"), 0);
+    }
+    EXPECT_STREQ(MemoryTagName(MemoryTag::kInteractionModel), "im");
+}
+
+#if CHIP_CONFIG_MEMORY_TAGGING
+
+TEST_F(TestMemoryTags, TestScopes)
+{
+    EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kUntagged);
+    {
+        ScopedMemoryTag outer(MemoryTag::kTransport);
+        EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kTransport);
+        {
+            ScopedMemoryTag inner(MemoryTag::kInteractionModel);
+            EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kInteractionModel);
+        }
+        EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kTransport);
+    }
+    EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kUntagged);
+}
+
+TEST_F(TestMemoryTags, TestAccounting)
+{
+    const MemoryTagStats before = GetMemoryTagStats(MemoryTag::kCache);
+
+    void * a = nullptr;
+    void * b = nullptr;
+    {
+        ScopedMemoryTag tag(MemoryTag::kCache);
+        a = MemoryAlloc(100);
+        b = MemoryCalloc(4, 25);
+    }
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+
+    MemoryTagStats stats = GetMemoryTagStats(MemoryTag::kCache);
+    EXPECT_EQ(stats.currentBytes, before.currentBytes + 200);
+    EXPECT_EQ(stats.currentAllocations, before.currentAllocations + 2);
+    EXPECT_EQ(stats.totalAllocations, before.totalAllocations + 2);
+    EXPECT_GE(stats.peakBytes, before.currentBytes + 200);
+
+    // A block keeps its tag when reallocated or freed under another one.
+    {
+        ScopedMemoryTag tag(MemoryTag::kApp);
+        a = MemoryRealloc(a, 300);
+        ASSERT_NE(a, nullptr);
+        EXPECT_EQ(GetMemoryTagStats(MemoryTag::kCache).currentBytes, before.currentBytes + 400);
+        MemoryFree(b);
+    }
+    stats = GetMemoryTagStats(MemoryTag::kCache);
+    EXPECT_EQ(stats.currentBytes, before.currentBytes + 300);
+    EXPECT_EQ(stats.currentAllocations, before.currentAllocations + 1);
+
+    MemoryFree(a);
+    stats = GetMemoryTagStats(MemoryTag::kCache);
+    EXPECT_EQ(stats.currentBytes, before.currentBytes);
+    EXPECT_EQ(stats.currentAllocations, before.currentAllocations);
+    EXPECT_GE(stats.peakBytes, before.currentBytes + 400);
+
+    ResetMemoryTagPeaks();
+    EXPECT_EQ(GetMemoryTagStats(MemoryTag::kCache).peakBytes, before.currentBytes);
+}
+
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+
+} // namespace
@@ -0,0 +1,71 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/support/MpscRingBuffer.h>
+
+namespace {
+
+using namespace chip;
+
+TEST(TestMpscRingBuffer, TestPushPop)
+{
+    MpscRingBuffer<uint32_t, 4> ring;
+    uint32_t value = 0;
+
+    EXPECT_FALSE(ring.TryPop(value));
+
+    EXPECT_TRUE(ring.TryPush(1));
+    EXPECT_TRUE(ring.TryPush(2));
+
+    EXPECT_TRUE(ring.TryPop(value));
+    EXPECT_EQ(value, 1u);
+    EXPECT_TRUE(ring.TryPop(value));
+    EXPECT_EQ(value, 2u);
+    EXPECT_FALSE(ring.TryPop(value));
+}
+
+TEST(TestMpscRingBuffer, TestFullAndWrapAround)
+{
+    MpscRingBuffer<uint32_t, 4> ring;
+    uint32_t value = 0;
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        EXPECT_TRUE(ring.TryPush(i));
+    }
+    EXPECT_FALSE(ring.TryPush(4));
+
+    // Popping frees a slot, and the positions keep going around the ring.
+    for (uint32_t i = 4; i < 20; i++)
+    {
+        EXPECT_TRUE(ring.TryPop(value));
+        EXPECT_EQ(value, i - 4);
+        EXPECT_TRUE(ring.TryPush(i));
+        EXPECT_FALSE(ring.TryPush(i + 1));
+    }
+
+    for (uint32_t i = 16; i < 20; i++)
+    {
+        EXPECT_TRUE(ring.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(ring.TryPop(value));
+}
+
+} // namespace
@@ -24,10 +24,12 @@
  */
 
 #include <set>
+#include <string.h>
 
 #include <pw_unit_test/framework.h>
 
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/ObjectPoolRegistry.h>
 #include <lib/support/Pool.h>
 #include <lib/support/PoolWrapper.h>
 #include <system/SystemConfig.h>
@@ -589,4 +591,101 @@ TEST_F(TestPool, TestPoolAutoReleaseDynamic)
 }
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
+TEST_F(TestPool, TestLowestFreeSlotIsReusedAcrossWords)
+{
+    // Spans several bitmap words, the last one partially.
+    constexpr size_t kSize = 150;
+    ObjectPool<size_t, kSize, ObjectPoolMem::kInline> pool;
+    size_t * objects[kSize];
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        objects[i] = pool.CreateObject(i);
+        ASSERT_NE(objects[i], nullptr);
+    }
+    EXPECT_EQ(pool.CreateObject(kSize), nullptr);
+
+    const size_t released[] = { 140, 3, 70 };
+    for (size_t i : released)
+    {
+        pool.ReleaseObject(objects[i]);
+    }
+
+    // Iteration visits the remaining objects in slot order.
+    size_t expected = 0;
+    pool.ForEachActiveObject([&](size_t * object) {
+        while (expected == 3 || expected == 70 || expected == 140)
+        {
+            ++expected;
+        }
+        EXPECT_EQ(*object, expected++);
+        return Loop::Continue;
+    });
+    EXPECT_EQ(expected, kSize);
+
+    // Freed slots are handed out again lowest first.
+    EXPECT_EQ(pool.CreateObject(1003u), objects[3]);
+    EXPECT_EQ(pool.CreateObject(1070u), objects[70]);
+    EXPECT_EQ(pool.CreateObject(1140u), objects[140]);
+    EXPECT_EQ(pool.CreateObject(kSize), nullptr);
+
+    pool.ReleaseAll();
+}
+
+TEST_F(TestPool, TestFailedAllocations)
+{
+    ObjectPool<uint32_t, 2, ObjectPoolMem::kInline> pool;
+    uint32_t * first  = pool.CreateObject(1u);
+    uint32_t * second = pool.CreateObject(2u);
+    EXPECT_EQ(pool.CreateObject(3u), nullptr);
+    EXPECT_EQ(pool.CreateObject(4u), nullptr);
+    EXPECT_EQ(pool.FailedAllocations(), 2u);
+    EXPECT_EQ(pool.HighWaterMark(), 2u);
+
+    pool.ReleaseObject(second);
+    pool.ResetStatistics();
+    EXPECT_EQ(pool.FailedAllocations(), 0u);
+    EXPECT_EQ(pool.HighWaterMark(), 1u);
+
+    pool.ReleaseObject(first);
+}
+
+#if CHIP_CONFIG_OBJECT_POOL_REGISTRY
+TEST_F(TestPool, TestObjectPoolRegistry)
+{
+    auto find = [](const char * name) {
+        const ObjectPoolRegistration * found = nullptr;
+        ObjectPoolRegistry::ForEach([&](const ObjectPoolRegistration & registration) {
+            if (strcmp(registration.GetNames().mName, name) == 0)
+            {
+                found = &registration;
+                return Loop::Break;
+            }
+            return Loop::Continue;
+        });
+        return found;
+    };
+
+    {
+        ObjectPool<uint32_t, 3, ObjectPoolMem::kInline> pool;
+        ObjectPoolRegistration registration(CHIP_OBJECT_POOL_NAMES("test_pool"), pool);
+        EXPECT_STREQ(registration.GetNames().mHighWaterMarkKey, "test_pool_high_water_mark");
+
+        const ObjectPoolRegistration * found = find("test_pool");
+        ASSERT_EQ(found, &registration);
+        EXPECT_EQ(found->Capacity(), 3u);
+
+        uint32_t * object = pool.CreateObject(1u);
+        EXPECT_EQ(found->Allocated(), 1u);
+        pool.ReleaseObject(object);
+        EXPECT_EQ(found->Allocated(), 0u);
+        EXPECT_EQ(found->HighWaterMark(), 1u);
+
+        ObjectPoolRegistry::ResetStatistics();
+        EXPECT_EQ(found->HighWaterMark(), 0u);
+    }
+
+    EXPECT_EQ(find("test_pool"), nullptr);
+}
+#endif // CHIP_CONFIG_OBJECT_POOL_REGISTRY
+
 } // namespace
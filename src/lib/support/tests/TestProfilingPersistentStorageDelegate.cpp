@@ -0,0 +1,165 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/ProfilingPersistentStorageDelegate.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <system/SystemClock.h>
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+using PrefixStats = ProfilingPersistentStorageDelegate::PrefixStats;
+
+// Storage whose writes take 5 ms of mock time.
+class SlowStorage : public TestPersistentStorageDelegate
+{
+public:
+    explicit SlowStorage(System::Clock::Internal::MockClock & clock) : mClock(clock) {}
+
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mClock.AdvanceMonotonic(5_ms64);
+        return TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+    }
+
+private:
+    System::Clock::Internal::MockClock & mClock;
+};
+
+class TestProfilingPersistentStorageDelegate : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        mRealClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mMockClock);
+    }
+    void TearDown() override { System::Clock::Internal::SetSystemClockForTesting(mRealClock); }
+
+    System::Clock::ClockBase * mRealClock = nullptr;
+    System::Clock::Internal::MockClock mMockClock;
+    SlowStorage mBacking{ mMockClock };
+};
+
+std::string PrefixOf(const char * key)
+{
+    char prefix[PersistentStorageDelegate::kKeyLengthMax + 1];
+    ProfilingPersistentStorageDelegate::GetKeyPrefix(key, prefix);
+    return prefix;
+}
+
+TEST_F(TestProfilingPersistentStorageDelegate, KeyPrefixes)
+{
+    EXPECT_EQ(PrefixOf("g/gfl"), "g/gfl");
+    EXPECT_EQ(PrefixOf("g/sri"), "g/sri");
+    EXPECT_EQ(PrefixOf("f/1/n"), "f/*/n");
+    EXPECT_EQ(PrefixOf("f/a/n"), "f/*/n");
+    EXPECT_EQ(PrefixOf("f/3/e/1/sc/2"), "f/*/e/*/sc/*");
+    EXPECT_EQ(PrefixOf("f/1/s/00000000000000ab"), "f/*/s/*");
+    EXPECT_EQ(PrefixOf("g/s/AAECAwQFBgcICQoLDA=="), "g/s/*");
+    EXPECT_EQ(PrefixOf("g/su/1f"), "g/su/*");
+    EXPECT_EQ(PrefixOf(""), "");
+}
+
+TEST_F(TestProfilingPersistentStorageDelegate, CountsPerPrefix)
+{
+    ProfilingPersistentStorageDelegate profiler(mBacking);
+
+    EXPECT_EQ(profiler.SyncSetKeyValue("f/1/n", "abcd", 4), CHIP_NO_ERROR);
+    EXPECT_EQ(profiler.SyncSetKeyValue("f/2/n", "ef", 2), CHIP_NO_ERROR);
+    EXPECT_EQ(profiler.AsyncSetKeyValue("g/gfl", "x", 1, nullptr, nullptr), CHIP_NO_ERROR);
+
+    uint8_t buf[8];
+    uint16_t size = sizeof(buf);
+    EXPECT_EQ(profiler.SyncGetKeyValue("f/2/n", buf, size), CHIP_NO_ERROR);
+    size = sizeof(buf);
+    EXPECT_EQ(profiler.SyncGetKeyValue("f/3/n", buf, size), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_TRUE(profiler.SyncDoesKeyExist("g/gfl"));
+    EXPECT_EQ(profiler.SyncDeleteKeyValue("f/1/n"), CHIP_NO_ERROR);
+
+    EXPECT_EQ(profiler.GetStats().size(), 2u);
+
+    const PrefixStats * fabricStats = profiler.GetStats("f/*/n");
+    ASSERT_NE(fabricStats, nullptr);
+    EXPECT_EQ(fabricStats->mWrites, 2u);
+    EXPECT_EQ(fabricStats->mDeletes, 1u);
+    EXPECT_EQ(fabricStats->mReads, 2u);
+    EXPECT_EQ(fabricStats->mBytesWritten, 6u);
+    EXPECT_EQ(fabricStats->mBytesRead, 2u);
+    EXPECT_EQ(fabricStats->mWriteTime, System::Clock::Microseconds64(10000));
+    EXPECT_EQ(fabricStats->mMaxLatency, System::Clock::Microseconds64(5000));
+    EXPECT_EQ(fabricStats->mReadTime, System::Clock::Microseconds64(0));
+
+    const PrefixStats * groupStats = profiler.GetStats("g/gfl");
+    ASSERT_NE(groupStats, nullptr);
+    EXPECT_EQ(groupStats->mWrites, 1u);
+    EXPECT_EQ(groupStats->mReads, 1u);
+
+    profiler.LogStats();
+    profiler.ResetStats();
+    EXPECT_EQ(profiler.GetStats().size(), 0u);
+}
+
+TEST_F(TestProfilingPersistentStorageDelegate, HottestPrefixes)
+{
+    ProfilingPersistentStorageDelegate profiler(mBacking);
+
+    EXPECT_EQ(profiler.SyncSetKeyValue("g/a", "1", 1), CHIP_NO_ERROR);
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(profiler.SyncSetKeyValue("g/c", "1", 1), CHIP_NO_ERROR);
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        EXPECT_EQ(profiler.SyncSetKeyValue("g/b", "1", 1), CHIP_NO_ERROR);
+    }
+
+    const PrefixStats * hottest[2];
+    ASSERT_EQ(profiler.GetHottestPrefixes(Span<const PrefixStats *>(hottest)), 2u);
+    EXPECT_STREQ(hottest[0]->mPrefix, "g/c");
+    EXPECT_STREQ(hottest[1]->mPrefix, "g/b");
+}
+
+TEST_F(TestProfilingPersistentStorageDelegate, PrefixOverflow)
+{
+    ProfilingPersistentStorageDelegate profiler(mBacking);
+
+    char key[PersistentStorageDelegate::kKeyLengthMax + 1];
+    for (size_t i = 0; i < ProfilingPersistentStorageDelegate::kMaxPrefixes + 2; i++)
+    {
+        // Letters only, so that every key is a prefix of its own.
+        snprintf(key, sizeof(key), "g/%c%c", 'a' + static_cast<char>(i / 26), 'a' + static_cast<char>(i % 26));
+        EXPECT_EQ(profiler.SyncSetKeyValue(key, "1", 1), CHIP_NO_ERROR);
+    }
+
+    EXPECT_EQ(profiler.GetStats().size(), ProfilingPersistentStorageDelegate::kMaxPrefixes + 1);
+    const PrefixStats * overflow = profiler.GetStats(ProfilingPersistentStorageDelegate::kOverflowPrefix);
+    ASSERT_NE(overflow, nullptr);
+    EXPECT_EQ(overflow->mWrites, 2u);
+}
+
+} // namespace
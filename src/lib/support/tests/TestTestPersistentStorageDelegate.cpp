@@ -341,4 +341,56 @@ TEST(TestTestPersistentStorageDelegate, TestClearStorage)
     EXPECT_EQ(size, sizeof(buf));
 }
 
+
+struct AsyncResults
+{
+    int mCount             = 0;
+    CHIP_ERROR mLastResult = CHIP_NO_ERROR;
+};
+
+void OnAsyncWriteDone(void * context, const char * key, CHIP_ERROR result)
+{
+    auto * results = static_cast<AsyncResults *>(context);
+    results->mCount++;
+    results->mLastResult = result;
+}
+
+// The asynchronous API defaults to a synchronous write whose completion is called before returning. Deferred
+// completions stand in for slow storage, whose pending writes are readable right away.
+TEST(TestTestPersistentStorageDelegate, TestAsyncWrites)
+{
+    TestPersistentStorageDelegate storage;
+    AsyncResults results;
+    uint8_t buf[8];
+    uint16_t size = sizeof(buf);
+
+    EXPECT_EQ(storage.AsyncSetKeyValue("key", "abc", 3, OnAsyncWriteDone, &results), CHIP_NO_ERROR);
+    EXPECT_EQ(results.mCount, 1);
+    EXPECT_EQ(results.mLastResult, CHIP_NO_ERROR);
+
+    storage.SetDeferAsyncCompletions(true);
+    EXPECT_EQ(storage.AsyncSetKeyValue("key", "defg", 4, OnAsyncWriteDone, &results), CHIP_NO_ERROR);
+    EXPECT_EQ(results.mCount, 1);
+    EXPECT_EQ(storage.GetPendingAsyncWriteCount(), 1u);
+    EXPECT_EQ(storage.SyncGetKeyValue("key", buf, size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, 4u);
+    EXPECT_EQ(0, memcmp(buf, "defg", 4));
+
+    EXPECT_EQ(storage.AsyncDeleteKeyValue("key", OnAsyncWriteDone, &results), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.SyncDoesKeyExist("key"));
+    EXPECT_EQ(storage.GetPendingAsyncWriteCount(), 2u);
+
+    storage.CompleteAsyncWrites(CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    EXPECT_EQ(results.mCount, 3);
+    EXPECT_EQ(results.mLastResult, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    EXPECT_EQ(storage.GetPendingAsyncWriteCount(), 0u);
+
+    // Errors found right away are returned, and the completion is not called.
+    EXPECT_EQ(storage.AsyncDeleteKeyValue("key", OnAsyncWriteDone, &results), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    storage.SetRejectWrites(true);
+    EXPECT_EQ(storage.AsyncSetKeyValue("key", "abc", 3, OnAsyncWriteDone, &results), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    EXPECT_EQ(storage.GetPendingAsyncWriteCount(), 0u);
+    EXPECT_EQ(results.mCount, 3);
+}
+
 } // namespace
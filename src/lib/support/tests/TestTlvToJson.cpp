@@ -87,6 +87,18 @@ bool Matches(const std::string & referenceString, const std::string & generatedS
     return matches;
 }
 
+class StringJsonOutputStream : public JsonOutputStream
+{
+public:
+    CHIP_ERROR Write(const CharSpan & text) override
+    {
+        mString.append(text.data(), text.size());
+        return CHIP_NO_ERROR;
+    }
+
+    std::string mString;
+};
+
 template <typename T>
 void EncodeAndValidate(T val, const std::string & expectedJsonString)
 {
@@ -116,6 +128,15 @@ void EncodeAndValidate(T val, const std::string & expectedJsonString)
 
     bool matches = Matches(expectedJsonString, jsonString);
     EXPECT_TRUE(matches);
+
+    // The streaming converter generates the same JSON.
+    err = SetupReader();
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    StringJsonOutputStream streamedJson;
+    err = TlvToJson(gReader, streamedJson);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_TRUE(Matches(expectedJsonString, streamedJson.mString));
 }
 
 TEST_F(TestTlvToJson, TestConverter)
@@ -246,4 +267,24 @@ TEST_F(TestTlvToJson, TestConverter)
     EncodeAndValidate(structList, jsonString);
 }
 
+TEST_F(TestTlvToJson, TestConverterEscapesStrings)
+{
+    CharSpan charSpan      = "say \"hi\"\\\n\x01"_span;
+    std::string jsonString = "{\n"
+                             "   \"1:STRING\" : \"say \\\"hi\\\"\\\\\\n\\u0001\"\n"
+                             "}\n";
+    EncodeAndValidate(charSpan, jsonString);
+
+    // Integers that do not fit 32 bits are strings.
+    jsonString = "{\n"
+                 "   \"1:UINT\" : \"4294967296\"\n"
+                 "}\n";
+    EncodeAndValidate(static_cast<uint64_t>(UINT32_MAX) + 1, jsonString);
+
+    jsonString = "{\n"
+                 "   \"1:INT\" : \"-2147483649\"\n"
+                 "}\n";
+    EncodeAndValidate(static_cast<int64_t>(INT32_MIN) - 1, jsonString);
+}
+
 } // namespace
@@ -18,6 +18,7 @@
  */
 
 #include <functional>
+#include <string.h>
 
 #include <pw_unit_test/framework.h>
 
@@ -168,4 +169,35 @@ TEST(TestUtf8, TestInvalidStrings)
     TEST_INVALID_BYTES(0xfc, 0x80, 0x80, 0x80, 0x80, 0x80);
 }
 
+TEST(TestUtf8, TestLongStrings)
+{
+    // ASCII is checked a word at a time, so put multi-byte sequences and errors at every position of a word.
+    for (size_t offset = 0; offset < 24; offset++)
+    {
+        char buffer[40];
+        memset(buffer, 'a', sizeof(buffer));
+
+        // U+20AC, split across words for some of the offsets.
+        buffer[offset]     = static_cast<char>(0xE2);
+        buffer[offset + 1] = static_cast<char>(0x82);
+        buffer[offset + 2] = static_cast<char>(0xAC);
+        EXPECT_TRUE(Utf8::IsValid(CharSpan(buffer, sizeof(buffer))));
+
+        // Missing continuation, the ASCII after it must not be skipped.
+        EXPECT_FALSE(Utf8::IsValid(CharSpan(buffer, offset + 2)));
+        buffer[offset + 2] = 'a';
+        EXPECT_FALSE(Utf8::IsValid(CharSpan(buffer, sizeof(buffer))));
+
+        // Stray continuation byte.
+        buffer[offset] = static_cast<char>(0x82);
+        EXPECT_FALSE(Utf8::IsValid(CharSpan(buffer, sizeof(buffer))));
+    }
+
+    char ascii[37];
+    memset(ascii, 'z', sizeof(ascii));
+    EXPECT_TRUE(Utf8::IsValid(CharSpan(ascii, sizeof(ascii))));
+    ascii[sizeof(ascii) - 1] = static_cast<char>(0xC2);
+    EXPECT_FALSE(Utf8::IsValid(CharSpan(ascii, sizeof(ascii))));
+}
+
 } // namespace
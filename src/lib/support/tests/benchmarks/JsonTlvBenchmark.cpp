@@ -0,0 +1,217 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for the TLV to JSON conversion, comparing TlvToJson through a Json::Value tree with the streaming
+ *      TlvToJson.
+ *
+ *      The payload is shaped like the value of a large list attribute: a structure holding an array of structures with
+ *      integer, string and byte string fields.
+ *
+ *      Usage: jsontlv-benchmark [--min-time-ms=<ms>] [<name filter>]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/jsontlv/TlvToJson.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint32_t kDefaultMinTimeMs = 500;
+constexpr size_t kListEntries        = 256;
+constexpr size_t kPayloadSize        = 32 * 1024;
+
+uint8_t gPayload[kPayloadSize];
+ByteSpan gPayloadSpan;
+
+// Consumed values end up here so that the loops cannot be optimized away.
+volatile size_t gSink;
+
+// Appends to a string that keeps its capacity between iterations, like a converter reused for every report.
+class StringJsonOutputStream : public JsonOutputStream
+{
+public:
+    CHIP_ERROR Write(const CharSpan & text) override
+    {
+        mString.append(text.data(), text.size());
+        return CHIP_NO_ERROR;
+    }
+
+    std::string mString;
+};
+
+// Counts the generated bytes without keeping them, like a converter writing straight to a socket.
+class CountingJsonOutputStream : public JsonOutputStream
+{
+public:
+    CHIP_ERROR Write(const CharSpan & text) override
+    {
+        mSize += text.size();
+        return CHIP_NO_ERROR;
+    }
+
+    size_t mSize = 0;
+};
+
+void BuildPayload()
+{
+    static const uint8_t kBytes[16] = { 0 };
+    TLV::TLVWriter writer;
+    TLV::TLVType outer;
+    TLV::TLVType list;
+    TLV::TLVType entry;
+
+    writer.Init(gPayload);
+    SuccessOrDie(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer));
+    SuccessOrDie(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Array, list));
+    for (size_t i = 0; i < kListEntries; i++)
+    {
+        SuccessOrDie(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, entry));
+        SuccessOrDie(writer.Put(TLV::ContextTag(0), static_cast<uint32_t>(i)));
+        SuccessOrDie(writer.Put(TLV::ContextTag(1), -static_cast<int32_t>(i)));
+        SuccessOrDie(writer.PutBoolean(TLV::ContextTag(2), (i % 2) == 0));
+        SuccessOrDie(writer.PutString(TLV::ContextTag(3), "entry label"));
+        SuccessOrDie(writer.PutBytes(TLV::ContextTag(4), kBytes, sizeof(kBytes)));
+        SuccessOrDie(writer.EndContainer(entry));
+    }
+    SuccessOrDie(writer.EndContainer(list));
+    SuccessOrDie(writer.EndContainer(outer));
+    SuccessOrDie(writer.Finalize());
+
+    gPayloadSpan = ByteSpan(gPayload, writer.GetLengthWritten());
+}
+
+size_t BenchJsonValueTree()
+{
+    std::string json;
+    SuccessOrDie(TlvToJson(gPayloadSpan, json));
+    gSink = gSink + json.size();
+    return kListEntries;
+}
+
+size_t BenchStreamingToString()
+{
+    static StringJsonOutputStream sOutput;
+    sOutput.mString.clear();
+    SuccessOrDie(TlvToJson(gPayloadSpan, sOutput));
+    gSink = gSink + sOutput.mString.size();
+    return kListEntries;
+}
+
+size_t BenchStreamingToCounter()
+{
+    CountingJsonOutputStream output;
+    SuccessOrDie(TlvToJson(gPayloadSpan, output));
+    gSink = gSink + output.mSize;
+    return kListEntries;
+}
+
+struct Benchmark
+{
+    const char * name;
+    // Runs one iteration and returns the number of list entries it converted.
+    size_t (*run)();
+};
+
+const Benchmark sBenchmarks[] = {
+    { "TlvToJson/JsonValueTree", BenchJsonValueTree },
+    { "TlvToJson/StreamingToString", BenchStreamingToString },
+    { "TlvToJson/StreamingToCounter", BenchStreamingToCounter },
+};
+
+void RunBenchmark(const Benchmark & benchmark, std::chrono::nanoseconds minTime)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Warm up, and learn the number of entries per iteration.
+    size_t entriesPerIteration = benchmark.run();
+
+    uint64_t iterations = 1;
+    for (;;)
+    {
+        auto start = Clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            benchmark.run();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+
+        if (elapsed >= minTime || iterations >= (UINT64_MAX / 10))
+        {
+            double nsPerIteration = static_cast<double>(elapsed.count()) / static_cast<double>(iterations);
+            printf("%-30s %10" PRIu64 " iterations %12.1f ns/op %8.1f ns/entry %6u entries\n", benchmark.name, iterations,
+                   nsPerIteration, nsPerIteration / static_cast<double>(std::max<size_t>(entriesPerIteration, 1)),
+                   static_cast<unsigned>(entriesPerIteration));
+            return;
+        }
+
+        // Aim slightly past the minimum time, growing by at most 10x per round.
+        uint64_t next = elapsed.count() > 0
+            ? static_cast<uint64_t>(static_cast<double>(iterations) * 1.2 * static_cast<double>(minTime.count()) /
+                                    static_cast<double>(elapsed.count()))
+            : iterations * 10;
+        iterations = std::max(iterations + 1, std::min(next, iterations * 10));
+    }
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    uint32_t minTimeMs  = kDefaultMinTimeMs;
+    const char * filter = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--min-time-ms=", strlen("--min-time-ms=")) == 0)
+        {
+            minTimeMs = static_cast<uint32_t>(strtoul(argv[i] + strlen("--min-time-ms="), nullptr, 10));
+        }
+        else
+        {
+            filter = argv[i];
+        }
+    }
+
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+    BuildPayload();
+    printf("Payload: %u bytes of TLV\n", static_cast<unsigned>(gPayloadSpan.size()));
+
+    for (const auto & benchmark : sBenchmarks)
+    {
+        if (filter == nullptr || strstr(benchmark.name, filter) != nullptr)
+        {
+            RunBenchmark(benchmark, std::chrono::milliseconds(minTimeMs));
+        }
+    }
+
+    Platform::MemoryShutdown();
+    return EXIT_SUCCESS;
+}
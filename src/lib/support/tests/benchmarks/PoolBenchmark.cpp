@@ -0,0 +1,250 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for BitMapObjectPool allocation and iteration.
+ *
+ *      The pools are sized like the larger pools of the stack (exchanges, sessions, dirty attribute sets on big
+ *      devices), at the occupancies they typically run at.
+ *
+ *      Usage: pool-benchmark [--min-time-ms=<ms>] [<name filter>]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Pool.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint32_t kDefaultMinTimeMs = 500;
+constexpr size_t kPoolSize           = 512;
+constexpr size_t kSparseActiveCount  = 8;
+
+struct Object
+{
+    uint64_t mValue;
+};
+
+using BenchmarkPool = BitMapObjectPool<Object, kPoolSize>;
+
+// Consumed values end up here so that the loops cannot be optimized away.
+volatile uint64_t gSink;
+
+// A pool with every slot but the last one in use, so an allocation has to get past all the full words.
+BenchmarkPool & NearlyFullPool()
+{
+    // Never destroyed: the pool dies if it is destroyed with objects in it.
+    static BenchmarkPool * sPool = [] {
+        auto * pool = new BenchmarkPool();
+        for (size_t i = 0; i < kPoolSize - 1; i++)
+        {
+            VerifyOrDie(pool->CreateObject(Object{ i }) != nullptr);
+        }
+        return pool;
+    }();
+    return *sPool;
+}
+
+// A pool with a few objects spread over its slots, like a session table on a device with few peers.
+BenchmarkPool & SparsePool()
+{
+    static BenchmarkPool * sPool = [] {
+        auto * pool = new BenchmarkPool();
+        Object * objects[kPoolSize];
+        for (size_t i = 0; i < kPoolSize; i++)
+        {
+            objects[i] = pool->CreateObject(Object{ i });
+        }
+        for (size_t i = 0; i < kPoolSize; i++)
+        {
+            if (i % (kPoolSize / kSparseActiveCount) != kPoolSize / kSparseActiveCount - 1)
+            {
+                pool->ReleaseObject(objects[i]);
+            }
+        }
+        return pool;
+    }();
+    return *sPool;
+}
+
+BenchmarkPool & FullPool()
+{
+    static BenchmarkPool * sPool = [] {
+        auto * pool = new BenchmarkPool();
+        for (size_t i = 0; i < kPoolSize; i++)
+        {
+            VerifyOrDie(pool->CreateObject(Object{ i }) != nullptr);
+        }
+        return pool;
+    }();
+    return *sPool;
+}
+
+size_t BenchAllocReleaseNearlyFull()
+{
+    BenchmarkPool & pool = NearlyFullPool();
+    Object * object      = pool.CreateObject(Object{ 0 });
+    VerifyOrDie(object != nullptr);
+    pool.ReleaseObject(object);
+    return 1;
+}
+
+size_t BenchAllocReleaseSparse()
+{
+    BenchmarkPool & pool = SparsePool();
+    Object * object      = pool.CreateObject(Object{ 0 });
+    VerifyOrDie(object != nullptr);
+    pool.ReleaseObject(object);
+    return 1;
+}
+
+size_t ForEachSum(BenchmarkPool & pool)
+{
+    uint64_t sum = 0;
+    size_t count = 0;
+    pool.ForEachActiveObject([&](Object * object) {
+        sum += object->mValue;
+        count++;
+        return Loop::Continue;
+    });
+    gSink = gSink + sum;
+    return count;
+}
+
+size_t IteratorSum(BenchmarkPool & pool)
+{
+    uint64_t sum = 0;
+    size_t count = 0;
+    for (Object * object : pool)
+    {
+        sum += object->mValue;
+        count++;
+    }
+    gSink = gSink + sum;
+    return count;
+}
+
+size_t BenchForEachSparse()
+{
+    return ForEachSum(SparsePool());
+}
+
+size_t BenchForEachFull()
+{
+    return ForEachSum(FullPool());
+}
+
+size_t BenchIterateSparse()
+{
+    return IteratorSum(SparsePool());
+}
+
+size_t BenchIterateFull()
+{
+    return IteratorSum(FullPool());
+}
+
+struct Benchmark
+{
+    const char * name;
+    // Runs one iteration and returns the number of objects it allocated or visited.
+    size_t (*run)();
+};
+
+const Benchmark sBenchmarks[] = {
+    { "Pool/AllocReleaseNearlyFull", BenchAllocReleaseNearlyFull },
+    { "Pool/AllocReleaseSparse", BenchAllocReleaseSparse },
+    { "Pool/ForEachSparse", BenchForEachSparse },
+    { "Pool/ForEachFull", BenchForEachFull },
+    { "Pool/IterateSparse", BenchIterateSparse },
+    { "Pool/IterateFull", BenchIterateFull },
+};
+
+void RunBenchmark(const Benchmark & benchmark, std::chrono::nanoseconds minTime)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Warm up (and build the pool), and learn the number of objects per iteration.
+    size_t objectsPerIteration = benchmark.run();
+
+    uint64_t iterations = 1;
+    for (;;)
+    {
+        auto start = Clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            benchmark.run();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+
+        if (elapsed >= minTime || iterations >= (UINT64_MAX / 10))
+        {
+            double nsPerIteration = static_cast<double>(elapsed.count()) / static_cast<double>(iterations);
+            printf("%-28s %12" PRIu64 " iterations %10.1f ns/op %8.2f ns/object %6u objects\n", benchmark.name, iterations,
+                   nsPerIteration, nsPerIteration / static_cast<double>(std::max<size_t>(objectsPerIteration, 1)),
+                   static_cast<unsigned>(objectsPerIteration));
+            return;
+        }
+
+        // Aim slightly past the minimum time, growing by at most 10x per round.
+        uint64_t next = elapsed.count() > 0
+            ? static_cast<uint64_t>(static_cast<double>(iterations) * 1.2 * static_cast<double>(minTime.count()) /
+                                    static_cast<double>(elapsed.count()))
+            : iterations * 10;
+        iterations = std::max(iterations + 1, std::min(next, iterations * 10));
+    }
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    uint32_t minTimeMs  = kDefaultMinTimeMs;
+    const char * filter = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--min-time-ms=", strlen("--min-time-ms=")) == 0)
+        {
+            minTimeMs = static_cast<uint32_t>(strtoul(argv[i] + strlen("--min-time-ms="), nullptr, 10));
+        }
+        else
+        {
+            filter = argv[i];
+        }
+    }
+
+    for (const auto & benchmark : sBenchmarks)
+    {
+        if (filter == nullptr || strstr(benchmark.name, filter) != nullptr)
+        {
+            RunBenchmark(benchmark, std::chrono::milliseconds(minTimeMs));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
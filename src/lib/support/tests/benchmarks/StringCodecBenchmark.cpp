@@ -0,0 +1,220 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Throughput benchmarks for UTF-8 validation, hex and Base64 encoding and decoding.
+ *
+ *      The UTF-8 payloads are lists of labels, like a controller decoding names and fixed labels of many endpoints;
+ *      the hex and Base64 ones are the size of a certificate.
+ *
+ *      Usage: string-codec-benchmark [--min-time-ms=<ms>] [<name filter>]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lib/support/Base64.h>
+#include <lib/support/BytesToHex.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+#include <lib/support/utf8.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint32_t kDefaultMinTimeMs = 500;
+constexpr size_t kLabelCount         = 64;
+constexpr size_t kBinarySize         = 600;
+
+const char * const kAsciiLabels[] = { "Living Room Light", "Kitchen", "Front Door Lock", "Thermostat", "Garage" };
+// Labels in German, French and Japanese.
+const char * const kMixedLabels[] = { "Küche", "Wohnzimmer Tür", "Salle à manger", "照明", "Schlafzimmer Süd" };
+
+// Consumed values end up here so that the loops cannot be optimized away.
+volatile uint64_t gSink;
+
+struct Payloads
+{
+    char asciiLabels[kLabelCount][32];
+    char mixedLabels[kLabelCount][32];
+    uint8_t binary[kBinarySize];
+    char hex[kBinarySize * 2];
+    char base64[BASE64_ENCODED_LEN(kBinarySize)];
+    uint16_t base64Len;
+};
+
+const Payloads & GetPayloads()
+{
+    static Payloads * sPayloads = [] {
+        auto * payloads = new Payloads();
+        for (size_t i = 0; i < kLabelCount; i++)
+        {
+            strncpy(payloads->asciiLabels[i], kAsciiLabels[i % MATTER_ARRAY_SIZE(kAsciiLabels)], sizeof(payloads->asciiLabels[i]));
+            strncpy(payloads->mixedLabels[i], kMixedLabels[i % MATTER_ARRAY_SIZE(kMixedLabels)], sizeof(payloads->mixedLabels[i]));
+        }
+        for (size_t i = 0; i < kBinarySize; i++)
+        {
+            payloads->binary[i] = static_cast<uint8_t>(i * 37 + 11);
+        }
+        SuccessOrDie(Encoding::BytesToUppercaseHexBuffer(payloads->binary, kBinarySize, payloads->hex, sizeof(payloads->hex)));
+        payloads->base64Len = Base64Encode(payloads->binary, kBinarySize, payloads->base64);
+        return payloads;
+    }();
+    return *sPayloads;
+}
+
+size_t ValidateLabels(const char (&labels)[kLabelCount][32])
+{
+    size_t bytes = 0;
+    for (const auto & label : labels)
+    {
+        CharSpan span(label, strlen(label));
+        VerifyOrDie(Utf8::IsValid(span));
+        bytes += span.size();
+    }
+    return bytes;
+}
+
+size_t BenchUtf8Ascii()
+{
+    return ValidateLabels(GetPayloads().asciiLabels);
+}
+
+size_t BenchUtf8Mixed()
+{
+    return ValidateLabels(GetPayloads().mixedLabels);
+}
+
+size_t BenchHexEncode()
+{
+    char hex[kBinarySize * 2];
+    SuccessOrDie(Encoding::BytesToUppercaseHexBuffer(GetPayloads().binary, kBinarySize, hex, sizeof(hex)));
+    gSink = gSink + static_cast<uint8_t>(hex[0]);
+    return kBinarySize;
+}
+
+size_t BenchHexDecode()
+{
+    uint8_t bytes[kBinarySize];
+    VerifyOrDie(Encoding::HexToBytes(GetPayloads().hex, sizeof(GetPayloads().hex), bytes, sizeof(bytes)) == kBinarySize);
+    gSink = gSink + bytes[0];
+    return kBinarySize;
+}
+
+size_t BenchBase64Encode()
+{
+    char base64[BASE64_ENCODED_LEN(kBinarySize)];
+    VerifyOrDie(Base64Encode(GetPayloads().binary, kBinarySize, base64) == GetPayloads().base64Len);
+    gSink = gSink + static_cast<uint8_t>(base64[0]);
+    return kBinarySize;
+}
+
+size_t BenchBase64Decode()
+{
+    uint8_t bytes[kBinarySize];
+    VerifyOrDie(Base64Decode(GetPayloads().base64, GetPayloads().base64Len, bytes) == kBinarySize);
+    gSink = gSink + bytes[0];
+    return kBinarySize;
+}
+
+struct Benchmark
+{
+    const char * name;
+    // Runs one iteration and returns the number of bytes it validated, or encoded or decoded to.
+    size_t (*run)();
+};
+
+const Benchmark sBenchmarks[] = {
+    { "Utf8/ValidateAsciiLabels", BenchUtf8Ascii },
+    { "Utf8/ValidateMixedLabels", BenchUtf8Mixed },
+    { "Hex/Encode", BenchHexEncode },
+    { "Hex/Decode", BenchHexDecode },
+    { "Base64/Encode", BenchBase64Encode },
+    { "Base64/Decode", BenchBase64Decode },
+};
+
+void RunBenchmark(const Benchmark & benchmark, std::chrono::nanoseconds minTime)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Warm up (and build the payloads), and learn the number of bytes per iteration.
+    size_t bytesPerIteration = benchmark.run();
+
+    uint64_t iterations = 1;
+    for (;;)
+    {
+        auto start = Clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            benchmark.run();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+
+        if (elapsed >= minTime || iterations >= (UINT64_MAX / 10))
+        {
+            double nsPerIteration = static_cast<double>(elapsed.count()) / static_cast<double>(iterations);
+            double mbPerSecond    = static_cast<double>(bytesPerIteration) * 1e3 / nsPerIteration;
+            printf("%-28s %12" PRIu64 " iterations %10.1f ns/op %8.1f MB/s %6u bytes\n", benchmark.name, iterations,
+                   nsPerIteration, mbPerSecond, static_cast<unsigned>(bytesPerIteration));
+            return;
+        }
+
+        // Aim slightly past the minimum time, growing by at most 10x per round.
+        uint64_t next = elapsed.count() > 0
+            ? static_cast<uint64_t>(static_cast<double>(iterations) * 1.2 * static_cast<double>(minTime.count()) /
+                                    static_cast<double>(elapsed.count()))
+            : iterations * 10;
+        iterations = std::max(iterations + 1, std::min(next, iterations * 10));
+    }
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    uint32_t minTimeMs  = kDefaultMinTimeMs;
+    const char * filter = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--min-time-ms=", strlen("--min-time-ms=")) == 0)
+        {
+            minTimeMs = static_cast<uint32_t>(strtoul(argv[i] + strlen("--min-time-ms="), nullptr, 10));
+        }
+        else
+        {
+            filter = argv[i];
+        }
+    }
+
+    for (const auto & benchmark : sBenchmarks)
+    {
+        if (filter == nullptr || strstr(benchmark.name, filter) != nullptr)
+        {
+            RunBenchmark(benchmark, std::chrono::milliseconds(minTimeMs));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
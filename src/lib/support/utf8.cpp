@@ -17,6 +17,9 @@
  */
 #include "utf8.h"
 
+#include <stdint.h>
+#include <string.h>
+
 namespace chip {
 namespace Utf8 {
 
@@ -176,9 +179,30 @@ bool IsValid(CharSpan span)
     const size_t kLength = span.size();
 
     // Every byte should be valid
-    for (size_t i = 0; i < kLength; i++)
+    size_t i = 0;
+    while (i < kLength)
     {
-        state = NextState(state, static_cast<uint8_t>(data[i]));
+        if (state == ParserState::kFirstByte)
+        {
+            // Labels and names are mostly ASCII, which needs no state changes: skip it a word at a time.
+            constexpr uint64_t kHighBits = 0x8080808080808080ull;
+            while (kLength - i >= sizeof(uint64_t))
+            {
+                uint64_t word;
+                memcpy(&word, data + i, sizeof(word));
+                if ((word & kHighBits) != 0)
+                {
+                    break;
+                }
+                i += sizeof(uint64_t);
+            }
+            if (i == kLength)
+            {
+                break;
+            }
+        }
+
+        state = NextState(state, static_cast<uint8_t>(data[i++]));
 
         if (state == ParserState::kInvalid)
         {
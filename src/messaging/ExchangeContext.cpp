@@ -322,8 +322,12 @@ ExchangeContext::ExchangeContext(ExchangeManager * em, uint16_t ExchangeId, cons
     SetAutoRequestAck(session->AllowsMRP());
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
-    // TODO(#33075) : Add check for group context to not a req since it serves no purpose
-    app::ICDNotifier::GetInstance().NotifyActiveRequestNotification(app::ICDListener::KeepActiveFlag::kExchangeContextOpen);
+    // Nothing is ever received on a group exchange, neither a response nor an ack, so there is no reason to poll fast for it.
+    if (!session->IsGroupSession())
+    {
+        mFlags.Set(Flags::kFlagKeepsICDActive);
+        app::ICDNotifier::GetInstance().NotifyActiveRequestNotification(app::ICDListener::KeepActiveFlag::kExchangeContextOpen);
+    }
 #endif
 
 #if defined(CHIP_EXCHANGE_CONTEXT_DETAIL_LOGGING)
@@ -342,8 +346,10 @@ ExchangeContext::~ExchangeContext()
     VerifyOrDieWithObject(mFlags.Has(Flags::kFlagClosed), this);
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
-    // TODO(#33075) : Add check for group context to not a req since it serves no purpose
-    app::ICDNotifier::GetInstance().NotifyActiveRequestWithdrawal(app::ICDListener::KeepActiveFlag::kExchangeContextOpen);
+    if (mFlags.Has(Flags::kFlagKeepsICDActive))
+    {
+        app::ICDNotifier::GetInstance().NotifyActiveRequestWithdrawal(app::ICDListener::KeepActiveFlag::kExchangeContextOpen);
+    }
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
 
     // Ideally, in this scenario, the retransmit table should
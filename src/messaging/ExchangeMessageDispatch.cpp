@@ -78,6 +78,15 @@ CHIP_ERROR ExchangeMessageDispatch::SendMessage(SessionManager * sessionManager,
         {
             ReturnErrorOnFailure(PrepareAndSendNonMRPMessage(sessionManager, session, payloadHeader, std::move(message)));
         }
+
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+        if (payloadHeader.GetAckMessageCounter().HasValue() && reliableMessageContext->GetReliableMessageMgr() != nullptr)
+        {
+            reliableMessageContext->GetReliableMessageMgr()->NotifyAckSendAnalytics(
+                *reliableMessageContext, session, payloadHeader.GetAckMessageCounter().Value(),
+                payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StandaloneAck));
+        }
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     }
     else
     {
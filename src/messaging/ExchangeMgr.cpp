@@ -115,7 +115,7 @@ ExchangeContext * ExchangeManager::NewContext(const SessionHandle & session, Exc
         // Disallow creating exchange on an inactive session
         return nullptr;
     }
-    return mContextPool.CreateObject(this, mNextExchangeId++, session, isInitiator, delegate);
+    return CreateContext(mNextExchangeId++, session, isInitiator, delegate);
 }
 
 CHIP_ERROR ExchangeManager::RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId,
@@ -274,24 +274,15 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     if (!packetHeader.IsGroupSession())
     {
         // Search for an existing exchange that the message applies to. If a match is found...
-        bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            if (ec->MatchExchange(session, packetHeader, payloadHeader))
-            {
-                ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
-                              ChipLogValueExchange(ec), ec->GetDelegate());
-
-                // Matched ExchangeContext; send to message handler.
-                TEMPORARY_RETURN_IGNORED ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags,
-                                                           std::move(msgBuf));
-                found = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-
-        if (found)
+        ExchangeContext * ec = FindExchange(session, packetHeader, payloadHeader);
+        if (ec != nullptr)
         {
+            ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
+                          ChipLogValueExchange(ec), ec->GetDelegate());
+
+            // Matched ExchangeContext; send to message handler.
+            TEMPORARY_RETURN_IGNORED ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags,
+                                                       std::move(msgBuf));
             return;
         }
     }
@@ -373,7 +364,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
             return;
         }
 
-        ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, false, delegate);
+        ExchangeContext * ec = CreateContext(payloadHeader.GetExchangeID(), session, false, delegate);
 
         if (ec == nullptr)
         {
@@ -425,8 +416,8 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
     // If rcvd msg is from initiator then this exchange is created as not Initiator.
     // If rcvd msg is not from initiator then this exchange is created as Initiator.
     // Create a EphemeralExchange to generate a StandaloneAck
-    ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(),
-                                                     nullptr, true /* IsEphemeralExchange */);
+    ExchangeContext * ec = CreateContext(payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), nullptr,
+                                         true /* IsEphemeralExchange */);
 
     if (ec == nullptr)
     {
@@ -449,6 +440,30 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
     // The exchange should be closed inside HandleMessage function. So don't bother close it here.
 }
 
+ExchangeContext * ExchangeManager::FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                                const PayloadHeader & payloadHeader)
+{
+    ExchangeContext * ec = mExchangeIdBuckets[payloadHeader.GetExchangeID() % kExchangeIdBucketCount];
+    while (ec != nullptr && !ec->MatchExchange(session, packetHeader, payloadHeader))
+    {
+        ec = ec->mNextInExchangeIdBucket;
+    }
+    return ec;
+}
+
+void ExchangeManager::RemoveFromExchangeIdIndex(ExchangeContext * ec)
+{
+    ExchangeContext ** link = &mExchangeIdBuckets[ec->GetExchangeId() % kExchangeIdBucketCount];
+    while (*link != nullptr && *link != ec)
+    {
+        link = &(*link)->mNextInExchangeIdBucket;
+    }
+    if (*link == ec)
+    {
+        *link = ec->mNextInExchangeIdBucket;
+    }
+}
+
 void ExchangeManager::CloseAllContextsForDelegate(const ExchangeDelegate * delegate)
 {
     mContextPool.ForEachActiveObject([&](auto * ec) {
@@ -27,6 +27,7 @@
 #include <array>
 
 #include <lib/support/DLLUtil.h>
+#include <lib/support/ObjectPoolRegistry.h>
 #include <lib/support/Pool.h>
 #include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeContext.h>
@@ -108,7 +109,11 @@ public:
      */
     ExchangeContext * NewContext(const SessionHandle & session, ExchangeDelegate * delegate, bool isInitiator = true);
 
-    void ReleaseContext(ExchangeContext * ec) { mContextPool.ReleaseObject(ec); }
+    void ReleaseContext(ExchangeContext * ec)
+    {
+        RemoveFromExchangeIdIndex(ec);
+        mContextPool.ReleaseObject(ec);
+    }
 
     /**
      *  Register an unsolicited message handler for a given protocol identifier. This handler would be
@@ -243,12 +248,40 @@ private:
     FabricIndex mFabricIndex = 0;
 
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
+    ObjectPoolRegistration mContextPoolRegistration{ CHIP_OBJECT_POOL_NAMES("core_pool_exchange_contexts"), mContextPool };
+
+    // The exchanges in mContextPool, hashed by exchange ID and chained through ExchangeContext::mNextInExchangeIdBucket,
+    // so that OnMessageReceived does not have to walk the whole pool.  The session is not part of the key, since the
+    // session of an exchange can change over its lifetime; it is matched while walking the bucket instead.
+    static constexpr size_t kExchangeIdBucketCount               = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS;
+    ExchangeContext * mExchangeIdBuckets[kExchangeIdBucketCount] = {};
 
     SessionManager * mSessionManager;
     ReliableMessageMgr mReliableMessageMgr;
 
     UnsolicitedMessageHandlerSlot UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
 
+    /**
+     * Create an exchange in mContextPool and add it to mExchangeIdBuckets.
+     */
+    template <typename... Args>
+    ExchangeContext * CreateContext(Args &&... args)
+    {
+        ExchangeContext * ec = mContextPool.CreateObject(this, std::forward<Args>(args)...);
+        if (ec != nullptr)
+        {
+            ExchangeContext *& bucket   = mExchangeIdBuckets[ec->GetExchangeId() % kExchangeIdBucketCount];
+            ec->mNextInExchangeIdBucket = bucket;
+            bucket                      = ec;
+        }
+        return ec;
+    }
+
+    void RemoveFromExchangeIdIndex(ExchangeContext * ec);
+
+    ExchangeContext * FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                   const PayloadHeader & payloadHeader);
+
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType,
                              Messaging::UnsolicitedMessageHandler ** outHandler = nullptr);
@@ -76,9 +76,43 @@ public:
         // that have elapsed between when the initial message was sent and when we received
         // acknowledgment for the message.
         std::optional<System::Clock::Milliseconds64> ackLatencyMs;
+        // When eventType is kAcknowledged and the session has a round-trip time estimate (which includes this ack if
+        // the message was not retransmitted), these will be populated with its smoothed round-trip time and
+        // round-trip time variation.
+        std::optional<System::Clock::Milliseconds32> smoothedRttMs;
+        std::optional<System::Clock::Milliseconds32> rttVariationMs;
+    };
+
+    enum class AckEventType
+    {
+        // A pending acknowledgement was carried by an outgoing message of the same exchange, so no standalone ack
+        // had to be sent for it.
+        kPiggybacked,
+        // A pending acknowledgement was sent in a standalone ack message.
+        kStandalone,
+    };
+
+    struct AckEvent
+    {
+        // When the session has a peer node ID, this will be a value other than kUndefinedNodeId.
+        NodeId nodeId = kUndefinedNodeId;
+        // When the session has a fabric index, this will be a value other than kUndefinedFabricIndex.
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        // Session type of session the acknowledgement is being sent on.
+        SessionType sessionType = SessionType::kEstablishedCase;
+        // How the acknowledgement was sent.
+        AckEventType eventType = AckEventType::kStandalone;
+        // The peer message counter being acknowledged.
+        uint32_t ackMessageCounter = 0;
+        // When eventType is kStandalone, true if the ack was sent at a deadline shared with other exchanges of the same
+        // session (see CHIP_CONFIG_MRP_STANDALONE_ACK_COALESCING_WINDOW).
+        bool coalesced = false;
     };
 
     virtual void OnTransmitEvent(const TransmitEvent & event) = 0;
+
+    // Called every time we acknowledge a message from the peer. The kPiggybacked events count the standalone acks saved.
+    virtual void OnAckEvent(const AckEvent & event) {}
 };
 
 } // namespace Messaging
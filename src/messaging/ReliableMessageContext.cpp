@@ -169,7 +169,10 @@ CHIP_ERROR ReliableMessageContext::HandleNeedsAckInner(uint32_t messageCounter,
     // Replace the Pending ack message counter.
     SetPendingPeerAckMessageCounter(messageCounter);
     using namespace System::Clock::Literals;
-    mNextAckTime = System::SystemClock().GetMonotonicTimestamp() + CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT;
+    bool coalesced = false;
+    mNextAckTime   = GetReliableMessageMgr()->GetStandaloneAckTime(
+        this, System::SystemClock().GetMonotonicTimestamp() + CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT, coalesced);
+    mFlags.Set(Flags::kFlagAckCoalesced, coalesced);
     return CHIP_NO_ERROR;
 }
 
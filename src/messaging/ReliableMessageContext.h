@@ -184,6 +184,14 @@ protected:
         ///     IsResponseExpected() is true).
         /// (2) We have received neither a response nor an ack for that message.
         kFlagWaitingForResponseOrAck = (1u << 11),
+
+        /// When set, mNextAckTime was moved earlier to the standalone ack deadline of another exchange on the same
+        /// session, so that both acks are flushed together.
+        kFlagAckCoalesced = (1u << 12),
+
+        /// When set, this exchange holds a kExchangeContextOpen request, keeping the ICD in Active Mode (fast polling)
+        /// until it is destroyed.
+        kFlagKeepsICDActive = (1u << 13),
     };
 
     BitFlags<Flags> mFlags; // Internal state flags
@@ -216,6 +224,10 @@ private:
 
     System::Clock::Timestamp mNextAckTime; // Next time for triggering Solo Ack
     uint32_t mPendingPeerAckMessageCounter;
+
+    // Where the retransmission table entry of this exchange is in the ReliableMessageMgr retransmission heap.
+    // Only meaningful while IsWaitingForAck().
+    uint16_t mRetransHeapIndex = 0;
 };
 
 inline bool ReliableMessageContext::AutoRequestAck() const
@@ -21,6 +21,7 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 
@@ -51,7 +52,7 @@ namespace Messaging {
 System::Clock::Timeout ReliableMessageMgr::sAdditionalMRPBackoffTime = CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST;
 
 ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0), scheduleOrder(0), initialSentTime(0)
 {
     ec->SetWaitingForAck(true);
 }
@@ -81,6 +82,7 @@ void ReliableMessageMgr::Shutdown()
         mRetransTable.ReleaseObject(entry);
         return Loop::Continue;
     });
+    mRetransHeapSize = 0;
 
     mSystemLayer = nullptr;
 }
@@ -135,10 +137,45 @@ void ReliableMessageMgr::NotifyMessageSendAnalytics(const RetransTableEntry & en
     {
         auto now           = System::SystemClock().GetMonotonicTimestamp();
         event.ackLatencyMs = now - entry.initialSentTime;
+
+        const Transport::RttEstimator & estimator = secureSession->GetRttEstimator();
+        if (estimator.HasEstimate())
+        {
+            event.smoothedRttMs  = estimator.GetSmoothedRtt();
+            event.rttVariationMs = estimator.GetRttVariation();
+        }
     }
 
     mAnalyticsDelegate->OnTransmitEvent(event);
 }
+
+void ReliableMessageMgr::NotifyAckSendAnalytics(const ReliableMessageContext & rc, const SessionHandle & sessionHandle,
+                                                uint32_t ackMessageCounter, bool isStandaloneAck)
+{
+    // Same restriction as for transmit events: only established CASE sessions are reported.
+    if (!mAnalyticsDelegate || !sessionHandle->IsSecureSession())
+    {
+        return;
+    }
+
+    auto secureSession = sessionHandle->AsSecureSession();
+    if (!secureSession->IsCASESession())
+    {
+        return;
+    }
+
+    ReliableMessageAnalyticsDelegate::AckEvent event = {
+        .nodeId            = secureSession->GetPeerNodeId(),
+        .fabricIndex       = sessionHandle->GetFabricIndex(),
+        .sessionType       = ReliableMessageAnalyticsDelegate::SessionType::kEstablishedCase,
+        .eventType         = isStandaloneAck ? ReliableMessageAnalyticsDelegate::AckEventType::kStandalone
+                                             : ReliableMessageAnalyticsDelegate::AckEventType::kPiggybacked,
+        .ackMessageCounter = ackMessageCounter,
+        .coalesced         = isStandaloneAck && rc.mFlags.Has(ReliableMessageContext::Flags::kFlagAckCoalesced),
+    };
+
+    mAnalyticsDelegate->OnAckEvent(event);
+}
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
 void ReliableMessageMgr::ExecuteActions()
@@ -162,10 +199,16 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired.  Entries that get (re)scheduled
+    // while doing so are left for the next pass; they sort after the entries that were due before this pass started.
+    const uint32_t passScheduleOrder = mNextRetransScheduleOrder;
+    while (mRetransHeapSize > 0)
+    {
+        RetransTableEntry * entry = mRetransHeap[0];
+        if (entry->nextRetransTime > now || static_cast<int32_t>(entry->scheduleOrder - passScheduleOrder) >= 0)
+        {
+            break;
+        }
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -212,9 +255,10 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
+            RemoveFromRetransHeap(*entry);
             mRetransTable.ReleaseObject(entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
@@ -227,11 +271,44 @@ void ReliableMessageMgr::ExecuteActions()
         MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
 
         TEMPORARY_RETURN_IGNORED SendFromRetransTable(entry);
+    }
 
-        return Loop::Continue;
+    TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
+}
+
+System::Clock::Timestamp ReliableMessageMgr::GetStandaloneAckTime(ReliableMessageContext * rc, System::Clock::Timestamp deadline,
+                                                                  bool & coalesced)
+{
+    coalesced = false;
+
+    const System::Clock::Timeout window = CHIP_CONFIG_MRP_STANDALONE_ACK_COALESCING_WINDOW;
+    if (window == System::Clock::kZero || !rc->GetExchangeContext()->HasSessionHandle())
+    {
+        return deadline;
+    }
+
+    // Join the latest pending ack of the same session that is due within the window, to give up as little
+    // piggybacking time as possible.
+    const SessionHandle session        = rc->GetExchangeContext()->GetSessionHandle();
+    System::Clock::Timestamp flushTime = deadline;
+    ExecuteForAllContext([&](ReliableMessageContext * other) {
+        if (other == rc || !other->IsAckPending() || other->mNextAckTime > deadline || other->mNextAckTime + window < deadline)
+        {
+            return;
+        }
+        ExchangeContext * otherExchange = other->GetExchangeContext();
+        if (!otherExchange->HasSessionHandle() || !(otherExchange->GetSessionHandle() == session))
+        {
+            return;
+        }
+        if (!coalesced || other->mNextAckTime > flushTime)
+        {
+            flushTime = other->mNextAckTime;
+            coalesced = true;
+        }
     });
 
-    TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
+    return flushTime;
 }
 
 void ReliableMessageMgr::Timeout(System::Layer * aSystemLayer, void * aAppState)
@@ -261,6 +338,7 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
         ChipLogError(ExchangeManager, "mRetransTable Already Full");
         return CHIP_ERROR_RETRANS_TABLE_FULL;
     }
+    InsertIntoRetransHeap(**rEntry);
 
     return CHIP_NO_ERROR;
 }
@@ -329,8 +407,8 @@ System::Clock::Timeout ReliableMessageMgr::GetBackoff(System::Clock::Timeout bas
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
     CalculateNextRetransTime(*entry);
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     entry->initialSentTime = System::SystemClock().GetMonotonicTimestamp();
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     NotifyMessageSendAnalytics(*entry, entry->ec->GetSessionHandle(), ReliableMessageAnalyticsDelegate::EventType::kInitialSend);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     StartTimer();
@@ -338,29 +416,27 @@ void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 
 bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
 {
-    bool removed = false;
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
-        {
+    RetransTableEntry * entry = GetRetransEntry(rc);
+    if (entry == nullptr || entry->retainedBuf.GetMessageCounter() != ackMessageCounter)
+    {
+        return false;
+    }
+
+    AddRttSample(*entry);
+
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
-            auto session = entry->ec->GetSessionHandle();
-            NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
+    auto session = entry->ec->GetSessionHandle();
+    NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
-            // Clear the entry from the retransmision table.
-            ClearRetransTable(*entry);
+    // Clear the entry from the retransmision table.
+    ClearRetransTable(*entry);
 
-            ChipLogDetail(ExchangeManager,
-                          "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
-                          " from Retrans Table on exchange " ChipLogFormatExchange,
-                          ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
-            removed = true;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-
-    return removed;
+    ChipLogDetail(ExchangeManager,
+                  "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
+                  " from Retrans Table on exchange " ChipLogFormatExchange,
+                  ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
+    return true;
 }
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
@@ -383,6 +459,7 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
     if (err == CHIP_NO_ERROR)
     {
+        sessionManager->CountRetransmission();
         CalculateNextRetransTime(*entry);
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -425,18 +502,16 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc)
-        {
-            ClearRetransTable(*entry);
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    RetransTableEntry * entry = GetRetransEntry(rc);
+    if (entry != nullptr)
+    {
+        ClearRetransTable(*entry);
+    }
 }
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
+    RemoveFromRetransHeap(entry);
     mRetransTable.ReleaseObject(&entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
@@ -455,13 +530,10 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    if (mRetransHeapSize > 0 && mRetransHeap[0]->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mRetransHeap[0]->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -556,8 +628,24 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
         baseTimeout = sessionHandle->GetMRPBaseTimeout();
     }
 
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+    // Once the round-trip time of an active peer is known, it is a better base than its advertised active interval.
+    if (sessionHandle->IsSecureSession())
+    {
+        const Transport::SecureSession * secureSession = sessionHandle->AsSecureSession();
+        const Transport::RttEstimator & estimator      = secureSession->GetRttEstimator();
+        if (estimator.HasEstimate() && (entry.ec->HasReceivedAtLeastOneMessage() || secureSession->IsPeerActive()))
+        {
+            baseTimeout = std::clamp(estimator.GetRetransmissionTimeout(),
+                                     System::Clock::Timeout(CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MIN_TIMEOUT),
+                                     System::Clock::Timeout(CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MAX_TIMEOUT));
+        }
+    }
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    RescheduleInRetransHeap(entry);
 
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
@@ -587,6 +675,128 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 #endif // CHIP_PROGRESS_LOGGING
 }
 
+void ReliableMessageMgr::AddRttSample(const RetransTableEntry & entry)
+{
+    // Karn's algorithm: the ack of a retransmitted message can't be matched to one of its transmissions.
+    VerifyOrReturn(entry.sendCount == 0 && entry.ec->HasSessionHandle());
+
+    const auto sessionHandle = entry.ec->GetSessionHandle();
+    VerifyOrReturn(sessionHandle->IsSecureSession());
+
+    const System::Clock::Timestamp rtt = System::SystemClock().GetMonotonicTimestamp() - entry.initialSentTime;
+    sessionHandle->AsSecureSession()->GetRttEstimator().AddSample(std::chrono::duration_cast<System::Clock::Milliseconds32>(rtt));
+}
+
+static_assert(CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE <= UINT16_MAX + 1, "Retransmission heap indices must fit in uint16_t");
+
+uint16_t & ReliableMessageMgr::RetransHeapIndex(RetransTableEntry & entry)
+{
+    return entry.ec->GetReliableMessageContext()->mRetransHeapIndex;
+}
+
+bool ReliableMessageMgr::RetransDueBefore(const RetransTableEntry & a, const RetransTableEntry & b)
+{
+    if (a.nextRetransTime != b.nextRetransTime)
+    {
+        return a.nextRetransTime < b.nextRetransTime;
+    }
+    // scheduleOrder wraps around, but entries never live long enough for that to matter.
+    return static_cast<int32_t>(a.scheduleOrder - b.scheduleOrder) < 0;
+}
+
+ReliableMessageMgr::RetransTableEntry * ReliableMessageMgr::GetRetransEntry(ReliableMessageContext * rc)
+{
+    VerifyOrReturnValue(rc->IsWaitingForAck() && rc->mRetransHeapIndex < mRetransHeapSize, nullptr);
+
+    RetransTableEntry * entry = mRetransHeap[rc->mRetransHeapIndex];
+    VerifyOrReturnValue(entry->ec->GetReliableMessageContext() == rc, nullptr);
+    return entry;
+}
+
+void ReliableMessageMgr::InsertIntoRetransHeap(RetransTableEntry & entry)
+{
+    // mRetransTable can't hold more entries than mRetransHeap.
+    VerifyOrDie(mRetransHeapSize < MATTER_ARRAY_SIZE(mRetransHeap));
+
+    entry.scheduleOrder = mNextRetransScheduleOrder++;
+    SetRetransHeapSlot(mRetransHeapSize, &entry);
+    mRetransHeapSize++;
+    SiftUpRetransHeap(mRetransHeapSize - 1);
+}
+
+void ReliableMessageMgr::RemoveFromRetransHeap(RetransTableEntry & entry)
+{
+    const size_t index = RetransHeapIndex(entry);
+    VerifyOrDie(index < mRetransHeapSize && mRetransHeap[index] == &entry);
+
+    mRetransHeapSize--;
+    if (index == mRetransHeapSize)
+    {
+        return;
+    }
+
+    // Move the last entry into the hole, then let it find its place.
+    SetRetransHeapSlot(index, mRetransHeap[mRetransHeapSize]);
+    SiftUpRetransHeap(index);
+    SiftDownRetransHeap(index);
+}
+
+void ReliableMessageMgr::RescheduleInRetransHeap(RetransTableEntry & entry)
+{
+    const size_t index = RetransHeapIndex(entry);
+    VerifyOrDie(index < mRetransHeapSize && mRetransHeap[index] == &entry);
+
+    entry.scheduleOrder = mNextRetransScheduleOrder++;
+    SiftUpRetransHeap(index);
+    SiftDownRetransHeap(index);
+}
+
+void ReliableMessageMgr::SetRetransHeapSlot(size_t index, RetransTableEntry * entry)
+{
+    mRetransHeap[index]      = entry;
+    RetransHeapIndex(*entry) = static_cast<uint16_t>(index);
+}
+
+void ReliableMessageMgr::SiftUpRetransHeap(size_t index)
+{
+    RetransTableEntry * entry = mRetransHeap[index];
+    while (index > 0)
+    {
+        const size_t parent = (index - 1) / 2;
+        if (!RetransDueBefore(*entry, *mRetransHeap[parent]))
+        {
+            break;
+        }
+        SetRetransHeapSlot(index, mRetransHeap[parent]);
+        index = parent;
+    }
+    SetRetransHeapSlot(index, entry);
+}
+
+void ReliableMessageMgr::SiftDownRetransHeap(size_t index)
+{
+    RetransTableEntry * entry = mRetransHeap[index];
+    while (true)
+    {
+        size_t child = 2 * index + 1;
+        if (child >= mRetransHeapSize)
+        {
+            break;
+        }
+        if (child + 1 < mRetransHeapSize && RetransDueBefore(*mRetransHeap[child + 1], *mRetransHeap[child]))
+        {
+            child++;
+        }
+        if (!RetransDueBefore(*mRetransHeap[child], *entry))
+        {
+            break;
+        }
+        SetRetransHeapSlot(index, mRetransHeap[child]);
+        index = child;
+    }
+    SetRetransHeapSlot(index, entry);
+}
+
 #if CHIP_CONFIG_TEST
 int ReliableMessageMgr::TestGetCountRetransTable()
 {
@@ -67,9 +67,9 @@ public:
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+        uint32_t scheduleOrder;                   /**< When nextRetransTime was last set, relative to the other entries;
+                                                       orders entries due at the same time. */
         System::Clock::Timestamp initialSentTime; /**< Timestamp when the initial message was sent */
-#endif                                            // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     };
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
@@ -129,8 +129,7 @@ public:
     void StartRetransmision(RetransTableEntry * entry);
 
     /**
-     *  Iterate through active exchange contexts and retrans table entries. Clear the entry matching
-     *  the specified ExchangeContext and the message ID from the retransmision table.
+     *  Clear the retransmission table entry of the specified ExchangeContext if it is for the acknowledged message ID.
      *
      *  @param[in]    rc                 A pointer to the ExchangeContext object.
      *  @param[in]    ackMessageCounter  The acknowledged message counter of the received packet.
@@ -165,7 +164,7 @@ public:
     void ClearRetransTable(RetransTableEntry & rEntry);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
+     * Iterate through active exchange contexts and look at the earliest retrans table entry.
      * Determine how many ReliableMessageProtocol ticks we need to sleep before we
      * need to physically wake the CPU to perform an action.  Set a timer to go off
      * when we next need to wake the system.
@@ -196,8 +195,32 @@ public:
      *  @param[in] analyticsDelegate - Pointer to delegate for reporting analytic
      */
     void RegisterAnalyticsDelegate(ReliableMessageAnalyticsDelegate * analyticsDelegate);
+
+    /**
+     *  Report that a message sent on an exchange carried the exchange's pending acknowledgement.
+     *
+     *  @param[in] rc                 The exchange the message was sent on.
+     *  @param[in] sessionHandle      The session the message was sent on.
+     *  @param[in] ackMessageCounter  The acknowledged peer message counter.
+     *  @param[in] isStandaloneAck    Whether the message was a standalone ack (as opposed to a piggybacked ack).
+     */
+    void NotifyAckSendAnalytics(const ReliableMessageContext & rc, const SessionHandle & sessionHandle, uint32_t ackMessageCounter,
+                                bool isStandaloneAck);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
+    /**
+     *  Compute when the standalone ack of an exchange should be sent if nothing piggybacks it first.
+     *
+     *  Without CHIP_CONFIG_MRP_STANDALONE_ACK_COALESCING_WINDOW this is the given deadline. Otherwise, if another
+     *  exchange on the same session has a standalone ack due within the window before that deadline, its deadline is
+     *  returned instead, so that both acks are flushed by the same ExecuteActions() pass.
+     *
+     *  @param[in]  rc          The exchange the ack is pending on.
+     *  @param[in]  deadline    The latest time at which the ack must be sent.
+     *  @param[out] coalesced   Set to whether the returned time is the deadline of another exchange.
+     */
+    System::Clock::Timestamp GetStandaloneAckTime(ReliableMessageContext * rc, System::Clock::Timestamp deadline, bool & coalesced);
+
     /**
      * Map a send error code to the error code we should actually use for
      * success checks.  This maps some error codes to CHIP_NO_ERROR as
@@ -243,6 +266,29 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+    /**
+     * Feed the round-trip time of an acknowledged entry to the RTT estimator of its session, if the message was
+     * not retransmitted.
+     */
+    void AddRttSample(const RetransTableEntry & entry);
+
+    /*
+     * The retransmission table entries are also kept in mRetransHeap, a binary min-heap ordered by
+     * (nextRetransTime, scheduleOrder), so that the next entry due is always mRetransHeap[0].  The position of each
+     * entry in the heap is kept in the mRetransHeapIndex of its exchange, which makes finding the entry of an exchange
+     * (e.g. when an ack comes in) and moving it in the heap (when it is rescheduled) O(log n) rather than O(n).
+     */
+    static uint16_t & RetransHeapIndex(RetransTableEntry & entry);
+    static bool RetransDueBefore(const RetransTableEntry & a, const RetransTableEntry & b);
+    RetransTableEntry * GetRetransEntry(ReliableMessageContext * rc);
+    void InsertIntoRetransHeap(RetransTableEntry & entry);
+    void RemoveFromRetransHeap(RetransTableEntry & entry);
+    // Restore the heap order after the nextRetransTime of the entry changed.
+    void RescheduleInRetransHeap(RetransTableEntry & entry);
+    void SetRetransHeapSlot(size_t index, RetransTableEntry * entry);
+    void SiftUpRetransHeap(size_t index);
+    void SiftDownRetransHeap(size_t index);
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -265,6 +311,9 @@ private:
 
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
+    RetransTableEntry * mRetransHeap[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+    size_t mRetransHeapSize            = 0;
+    uint32_t mNextRetransScheduleOrder = 0;
 
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
@@ -95,6 +95,75 @@ namespace chip {
 #define CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT (200_ms32)
 #endif // CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT
 
+/**
+ *  @def CHIP_CONFIG_MRP_STANDALONE_ACK_COALESCING_WINDOW
+ *
+ *  @brief
+ *    Window within which the standalone acks pending on different exchanges of
+ *    the same session are flushed together.
+ *
+ *  Acknowledgements are per exchange, so each exchange still needs its own
+ *  standalone ack when nothing piggybacks it. When a peer runs many concurrent
+ *  exchanges with us though (e.g. a controller firing a batch of reads), an
+ *  exchange whose ack would become due less than this window after an ack that
+ *  is already pending on the same session reuses that earlier deadline, so the
+ *  acks for the peer go out back to back in a single wake-up instead of one
+ *  wake-up each. The cost is that those exchanges get up to this much less
+ *  time to piggyback their ack on a response.
+ *
+ *  A value of 0 disables coalescing.
+ */
+#ifndef CHIP_CONFIG_MRP_STANDALONE_ACK_COALESCING_WINDOW
+#define CHIP_CONFIG_MRP_STANDALONE_ACK_COALESCING_WINDOW (0_ms32)
+#endif // CHIP_CONFIG_MRP_STANDALONE_ACK_COALESCING_WINDOW
+
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+ *
+ *  @brief
+ *    Base the retransmission timeout of messages sent to an active peer over a
+ *    secure session on the round-trip time measured on that session, rather
+ *    than on the active interval the peer advertises.
+ *
+ *  Every secure session keeps a smoothed round-trip time estimate (see
+ *  Transport::RttEstimator) from the acks of messages that did not need to be
+ *  retransmitted. When this is enabled and an estimate is available, it takes
+ *  the place of the peer's active retransmission interval as the base of the
+ *  MRP backoff, so that retransmissions to fast peers happen sooner and the
+ *  ones to slow peers don't happen before an ack could have made it back. The
+ *  idle interval is still used when the peer is not known to be active, since
+ *  a sleepy peer may not be listening then.
+ *
+ *  The result is clamped to the range given by
+ *  CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MIN_TIMEOUT and
+ *  CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MAX_TIMEOUT.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+#define CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT 0
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MIN_TIMEOUT
+ *
+ *  @brief
+ *    The smallest base retransmission timeout used by
+ *    CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MIN_TIMEOUT
+#define CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MIN_TIMEOUT (100_ms32)
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MIN_TIMEOUT
+
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MAX_TIMEOUT
+ *
+ *  @brief
+ *    The largest base retransmission timeout used by
+ *    CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MAX_TIMEOUT
+#define CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MAX_TIMEOUT (10000_ms32)
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_MAX_TIMEOUT
+
 /**
  *  @def CHIP_CONFIG_RESOLVE_PEER_ON_FIRST_TRANSMIT_FAILURE
  *
@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "SimulatedNode.h"
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Testing {
+
+CHIP_ERROR SimulatedNode::Init(SimulatedNetwork & network, System::Layer & systemLayer, NodeId nodeId, uint16_t port)
+{
+    VerifyOrReturnError(!mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(IsOperationalNodeId(nodeId), CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(network.Attach(mInterface, port));
+    mInitialized = true;
+    mNodeId      = nodeId;
+
+    CHIP_ERROR err = [&]() {
+        ReturnErrorOnFailure(mTransportMgr.Init(&mInterface));
+        ReturnErrorOnFailure(mOpKeyStore.Init(&mStorage));
+        ReturnErrorOnFailure(mOpCertStore.Init(&mStorage));
+
+        FabricTable::InitParams initParams;
+        initParams.storage             = &mStorage;
+        initParams.operationalKeystore = &mOpKeyStore;
+        initParams.opCertStore         = &mOpCertStore;
+        ReturnErrorOnFailure(mFabricTable.Init(initParams));
+
+        ReturnErrorOnFailure(mSessionManager.Init(&systemLayer, &mTransportMgr, &mMessageCounterManager, &mStorage, &mFabricTable,
+                                                  mSessionKeystore));
+        ReturnErrorOnFailure(mExchangeManager.Init(&mSessionManager));
+        return mMessageCounterManager.Init(&mExchangeManager);
+    }();
+
+    if (err != CHIP_NO_ERROR)
+    {
+        Shutdown();
+    }
+    return err;
+}
+
+void SimulatedNode::Shutdown()
+{
+    VerifyOrReturn(mInitialized);
+    mInitialized = false;
+
+    mSessions.clear();
+    mMessageCounterManager.Shutdown();
+    mExchangeManager.Shutdown();
+    mSessionManager.Shutdown();
+    mFabricTable.Shutdown();
+    mOpCertStore.Finish();
+    mOpKeyStore.Finish();
+    mTransportMgr.Close();
+    mInterface.Close();
+}
+
+CHIP_ERROR SimulatedNode::Connect(SimulatedNode & initiator, SimulatedNode & responder)
+{
+    VerifyOrReturnError(initiator.mInitialized && responder.mInitialized && &initiator != &responder,
+                        CHIP_ERROR_INCORRECT_STATE);
+
+    uint16_t initiatorSessionId = initiator.AllocateSessionId();
+    uint16_t responderSessionId = responder.AllocateSessionId();
+
+    ReturnErrorOnFailure(initiator.mSessionManager.InjectCaseSessionWithTestKey(
+        initiator.mSessions[responder.mNodeId], initiatorSessionId, responderSessionId, initiator.mNodeId, responder.mNodeId,
+        kFabricIndex, responder.GetAddress(), CryptoContext::SessionRole::kInitiator));
+    return responder.mSessionManager.InjectCaseSessionWithTestKey(
+        responder.mSessions[initiator.mNodeId], responderSessionId, initiatorSessionId, responder.mNodeId, initiator.mNodeId,
+        kFabricIndex, initiator.GetAddress(), CryptoContext::SessionRole::kResponder);
+}
+
+Optional<SessionHandle> SimulatedNode::GetSessionTo(NodeId peerNodeId)
+{
+    auto it = mSessions.find(peerNodeId);
+    VerifyOrReturnValue(it != mSessions.end(), NullOptional);
+    return it->second.Get();
+}
+
+} // namespace Testing
+} // namespace chip
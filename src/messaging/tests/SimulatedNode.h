@@ -0,0 +1,104 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <credentials/FabricTable.h>
+#include <credentials/PersistentStorageOpCertStore.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <crypto/PersistentStorageOperationalKeystore.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+#include <lib/core/Optional.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <messaging/ExchangeMgr.h>
+#include <protocols/secure_channel/MessageCounterManager.h>
+#include <system/SystemLayer.h>
+#include <transport/SessionHolder.h>
+#include <transport/SessionManager.h>
+#include <transport/TransportMgrBase.h>
+#include <transport/raw/tests/SimulatedNetwork.h>
+
+#include <map>
+
+namespace chip {
+namespace Testing {
+
+/**
+ * One virtual node on a SimulatedNetwork: its own storage, fabric table, SessionManager,
+ * ExchangeManager and MessageCounterManager, sharing the system layer of the process.
+ *
+ * Many nodes can run in one test process, e.g. a controller node with hundreds of device nodes
+ * running a protocol server each (echo, BDX, ...) on their ExchangeManager.  Nodes are connected
+ * with CASE sessions keyed with the test key, without certificates; every session is on
+ * kFabricIndex.  The Interaction Model engine and the Server are process-wide singletons, so
+ * they can serve one node of the process at most.
+ *
+ * The number of peers of a node is limited by CHIP_CONFIG_SECURE_SESSION_POOL_SIZE.
+ */
+class SimulatedNode
+{
+public:
+    static constexpr FabricIndex kFabricIndex = 1;
+
+    SimulatedNode() = default;
+    ~SimulatedNode() { Shutdown(); }
+
+    SimulatedNode(const SimulatedNode &)             = delete;
+    SimulatedNode & operator=(const SimulatedNode &) = delete;
+
+    /// Attach the node to `network` on `port`, which must be unique on the network.
+    CHIP_ERROR Init(SimulatedNetwork & network, System::Layer & systemLayer, NodeId nodeId, uint16_t port);
+    void Shutdown();
+
+    /// Establish a pair of CASE sessions between `initiator` and `responder`, replacing the sessions they had.
+    static CHIP_ERROR Connect(SimulatedNode & initiator, SimulatedNode & responder);
+
+    /// The session to `peerNodeId` established by Connect, if any.
+    Optional<SessionHandle> GetSessionTo(NodeId peerNodeId);
+
+    NodeId GetNodeId() const { return mNodeId; }
+    const Transport::PeerAddress & GetAddress() const { return mInterface.GetAddress(); }
+
+    SessionManager & GetSessionManager() { return mSessionManager; }
+    Messaging::ExchangeManager & GetExchangeManager() { return mExchangeManager; }
+    FabricTable & GetFabricTable() { return mFabricTable; }
+
+private:
+    uint16_t AllocateSessionId() { return mNextSessionId++; }
+
+    bool mInitialized = false;
+    NodeId mNodeId    = kUndefinedNodeId;
+    // Session ids are never reused: sessions replaced by Connect may still be referenced.
+    uint16_t mNextSessionId = 1;
+
+    SimulatedNetwork::Interface mInterface;
+    TransportMgrBase mTransportMgr;
+    TestPersistentStorageDelegate mStorage;
+    PersistentStorageOperationalKeystore mOpKeyStore;
+    Credentials::PersistentStorageOpCertStore mOpCertStore;
+    Crypto::DefaultSessionKeystore mSessionKeystore;
+    FabricTable mFabricTable;
+    SessionManager mSessionManager;
+    Messaging::ExchangeManager mExchangeManager;
+    secure_channel::MessageCounterManager mMessageCounterManager;
+    std::map<NodeId, SessionHolder> mSessions;
+};
+
+} // namespace Testing
+} // namespace chip
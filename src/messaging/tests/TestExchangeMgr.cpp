@@ -273,4 +273,45 @@ TEST_F(TestExchangeMgr, CheckExchangeMessages)
     EXPECT_EQ(removedHandler, &mockUnsolicitedAppDelegate);
 }
 
+TEST_F(TestExchangeMgr, CheckResponsesRoutedToMatchingExchange)
+{
+    // Answers every request on the exchange it arrived on.
+    class EchoDelegate : public MockAppDelegate
+    {
+        CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                     System::PacketBufferHandle && buffer) override
+        {
+            return ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST2,
+                                   System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                                   SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+        }
+    };
+
+    EchoDelegate echoDelegate;
+    EXPECT_SUCCESS(
+        GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &echoDelegate));
+
+    constexpr size_t kExchangeCount = 4;
+    MockAppDelegate delegates[kExchangeCount];
+    for (auto & delegate : delegates)
+    {
+        ExchangeContext * ec = NewExchangeToBob(&delegate);
+        ASSERT_NE(ec, nullptr);
+        EXPECT_SUCCESS(ec->SendMessage(
+            Protocols::BDX::Id, kMsgType_TEST1, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+            SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck, Messaging::SendMessageFlags::kExpectResponse)));
+    }
+
+    DrainAndServiceIO();
+
+    for (auto & delegate : delegates)
+    {
+        EXPECT_TRUE(delegate.IsOnMessageReceivedCalled);
+    }
+    // Every exchange is done, so none of them should be left behind.
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+
+    EXPECT_SUCCESS(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1));
+}
+
 } // namespace
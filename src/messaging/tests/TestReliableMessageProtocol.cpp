@@ -37,6 +37,7 @@
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <protocols/Protocols.h>
 #include <protocols/echo/Echo.h>
+#include <system/RAIIMockClock.h>
 #include <transport/SessionManager.h>
 #include <transport/TransportMgr.h>
 
@@ -68,7 +69,9 @@ class TestReliablityAnalyticDelegate : public ReliableMessageAnalyticsDelegate
 {
 public:
     virtual void OnTransmitEvent(const TransmitEvent & event) override { mTransmitEvents.push(event); }
+    virtual void OnAckEvent(const AckEvent & event) override { mAckEvents.push(event); }
     std::queue<ReliableMessageAnalyticsDelegate::TransmitEvent> mTransmitEvents;
+    std::queue<ReliableMessageAnalyticsDelegate::AckEvent> mAckEvents;
 };
 
 class TestReliableMessageProtocol : public chip::Testing::LoopbackMessagingContext
@@ -373,6 +376,42 @@ TEST_F(TestReliableMessageProtocol, CheckAddClearRetrans)
     exchange->Close();
 }
 
+TEST_F(TestReliableMessageProtocol, CheckClearRetransPerExchange)
+{
+    constexpr size_t kExchangeCount = 4;
+
+    MockAppDelegate mockAppDelegate(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    ExchangeContext * exchanges[kExchangeCount];
+    for (auto & exchange : exchanges)
+    {
+        exchange = NewExchangeToAlice(&mockAppDelegate);
+        ASSERT_NE(exchange, nullptr);
+
+        ReliableMessageMgr::RetransTableEntry * entry;
+        EXPECT_SUCCESS(rm->AddToRetransTable(exchange->GetReliableMessageContext(), &entry));
+    }
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kExchangeCount));
+
+    // Each exchange only finds its own entry, whatever order they are cleared in.
+    for (size_t i : { 2u, 0u, 3u, 1u })
+    {
+        ReliableMessageContext * rc = exchanges[i]->GetReliableMessageContext();
+        EXPECT_TRUE(rc->IsWaitingForAck());
+        rm->ClearRetransTable(rc);
+        EXPECT_FALSE(rc->IsWaitingForAck());
+        EXPECT_FALSE(rm->CheckAndRemRetransTable(rc, 0));
+    }
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    for (auto & exchange : exchanges)
+    {
+        exchange->Close();
+    }
+}
+
 /**
  * Tests MRP retransmission logic with the following scenario:
  *
@@ -515,6 +554,64 @@ TEST_F(TestReliableMessageProtocol, CheckResendApplicationMessage)
     exchange->Close();
 }
 
+/**
+ * Same as CheckResendApplicationMessage, for several exchanges at once, with the retransmissions
+ * run in simulated time instead of waiting for them.
+ */
+TEST_F(TestReliableMessageProtocol, CheckResendApplicationMessagesInSimulatedTime)
+{
+    constexpr size_t kExchangeCount = 8;
+
+    // Timers started before the mock clock is installed keep their deadlines, so keep the clock where it was.
+    System::Clock::Timestamp startTime = System::SystemClock().GetMonotonicTimestamp();
+    System::Clock::Internal::RAIIMockClock clock;
+    clock.SetMonotonic(startTime);
+
+    MockAppDelegate mockSender(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    // Drop the initial message and the first 3 retries of every exchange.  The retries of one attempt all happen
+    // before the next attempt of any exchange, whatever the jitter.
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 4 * kExchangeCount;
+    loopback.mDroppedMessageCount = 0;
+
+    ExchangeContext * exchanges[kExchangeCount];
+    for (auto & exchange : exchanges)
+    {
+        exchange = NewExchangeToAlice(&mockSender);
+        ASSERT_NE(exchange, nullptr);
+
+        exchange->GetSessionHandle()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+            System::Clock::Timestamp(300), // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+            System::Clock::Timestamp(300), // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+        }));
+
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        ASSERT_FALSE(buffer.IsNull());
+        EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendMessageFlags::kExpectResponse),
+                  CHIP_NO_ERROR);
+    }
+
+    EXPECT_TRUE(GetIOContext().DriveIOUntilInSimulatedTime(clock, 10_s, [&] { return rm->TestGetCountRetransTable() == 0; }));
+
+    // Every exchange got through on its 4th retry.
+    System::Clock::Timeout minDuration = theBackoffComplianceTestVector[0].backoffMin +
+        theBackoffComplianceTestVector[1].backoffMin + theBackoffComplianceTestVector[2].backoffMin +
+        theBackoffComplianceTestVector[3].backoffMin;
+    EXPECT_GE(clock.GetMonotonicTimestamp() - startTime, minDuration);
+    EXPECT_EQ(loopback.mDroppedMessageCount, 4 * kExchangeCount);
+    EXPECT_GE(loopback.mSentMessageCount, 5 * kExchangeCount);
+
+    for (auto * exchange : exchanges)
+    {
+        exchange->Close();
+    }
+    DrainAndServiceIO();
+}
+
 TEST_F(TestReliableMessageProtocol, CheckCloseExchangeAndResendApplicationMessage)
 {
     chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
@@ -2450,6 +2547,85 @@ TEST_F(TestReliableMessageProtocol, CheckReliableMessageAnalyticsForTransmitUnau
 
     ASSERT_EQ(testAnalyticsDelegate.mTransmitEvents.size(), 0u);
 }
+
+TEST_F(TestReliableMessageProtocol, CheckReliableMessageAnalyticsForAcksForEstablishedCase)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    ExpireSessionBobToAlice();
+    ExpireSessionAliceToBob();
+    err = CreateCASESessionBobToAlice();
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    err = CreateCASESessionAliceToBob();
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    MockAppDelegate mockReceiver(*this);
+    err = GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest, &mockReceiver);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    MockAppDelegate mockSender(*this);
+    ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(exchange, nullptr);
+
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+    TestReliablityAnalyticDelegate testAnalyticsDelegate;
+    rm->RegisterAnalyticsDelegate(&testAnalyticsDelegate);
+
+    const auto expectedFabricIndex = exchange->GetSessionHandle()->GetFabricIndex();
+
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 0;
+    loopback.mDroppedMessageCount = 0;
+    mockReceiver.mRetainExchange  = true;
+    mockSender.mRetainExchange    = true;
+
+    // The response carries the ack of the request: one standalone ack saved.
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    EXPECT_FALSE(buffer.IsNull());
+    err = exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendFlags(SendMessageFlags::kExpectResponse));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    ASSERT_NE(mockReceiver.mExchange, nullptr);
+    EXPECT_TRUE(testAnalyticsDelegate.mAckEvents.empty());
+
+    buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    EXPECT_FALSE(buffer.IsNull());
+    err =
+        mockReceiver.mExchange->SendMessage(Echo::MsgType::EchoResponse, std::move(buffer),
+                                            SendFlags(SendMessageFlags::kExpectResponse).Set(SendMessageFlags::kNoAutoRequestAck));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_TRUE(mockSender.mReceivedPiggybackAck);
+
+    ASSERT_EQ(testAnalyticsDelegate.mAckEvents.size(), 1u);
+    auto piggybackedAckEvent = testAnalyticsDelegate.mAckEvents.front();
+    EXPECT_EQ(piggybackedAckEvent.fabricIndex, expectedFabricIndex);
+    EXPECT_EQ(piggybackedAckEvent.eventType, ReliableMessageAnalyticsDelegate::AckEventType::kPiggybacked);
+    EXPECT_FALSE(piggybackedAckEvent.coalesced);
+    testAnalyticsDelegate.mAckEvents.pop();
+
+    // The receiver closes its exchange without responding to this one, so the ack goes out standalone.
+    mockReceiver.mRetainExchange = false;
+    mockSender.mRetainExchange   = false;
+
+    buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    EXPECT_FALSE(buffer.IsNull());
+    err = exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    ASSERT_EQ(testAnalyticsDelegate.mAckEvents.size(), 1u);
+    auto standaloneAckEvent = testAnalyticsDelegate.mAckEvents.front();
+    EXPECT_EQ(standaloneAckEvent.fabricIndex, expectedFabricIndex);
+    EXPECT_EQ(standaloneAckEvent.eventType, ReliableMessageAnalyticsDelegate::AckEventType::kStandalone);
+    EXPECT_NE(standaloneAckEvent.ackMessageCounter, piggybackedAckEvent.ackMessageCounter);
+
+    rm->RegisterAnalyticsDelegate(nullptr);
+    err = GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+}
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
 /**
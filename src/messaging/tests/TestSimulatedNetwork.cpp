@@ -0,0 +1,153 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a test of many nodes exchanging messages
+ *      over a SimulatedNetwork in one process.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <messaging/ReliableMessageProtocolConfig.h>
+#include <messaging/tests/SimulatedNode.h>
+#include <protocols/echo/Echo.h>
+#include <system/RAIIMockClock.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+#include <transport/raw/tests/SimulatedNetwork.h>
+
+#include <algorithm>
+#include <memory>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Testing;
+using namespace chip::System::Clock::Literals;
+
+// Every device takes a session of the controller, and every echo request an exchange of the controller.
+constexpr size_t kDeviceCount =
+    std::min<size_t>({ 32, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE - 1, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2 });
+constexpr NodeId kControllerNodeId  = 0x1000;
+constexpr NodeId kFirstDeviceNodeId = 0x2000;
+constexpr uint16_t kFirstPort       = 5540;
+
+const char kPayload[] = "Hello!";
+
+size_t gEchoResponseCount = 0;
+
+void HandleEchoResponseReceived(Messaging::ExchangeContext * ec, System::PacketBufferHandle && payload)
+{
+    gEchoResponseCount++;
+}
+
+class TestSimulatedNetwork : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        spIOContext = new IOContext();
+        ASSERT_EQ(spIOContext->Init(), CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        spIOContext->Shutdown();
+        delete spIOContext;
+        spIOContext = nullptr;
+        Platform::MemoryShutdown();
+    }
+
+protected:
+    static IOContext * spIOContext;
+};
+
+IOContext * TestSimulatedNetwork::spIOContext = nullptr;
+
+TEST_F(TestSimulatedNetwork, EchoToManyDevices)
+{
+    System::Layer & systemLayer = spIOContext->GetSystemLayer();
+
+    // Timers started before the mock clock is installed keep their deadlines, so keep the clock where it was.
+    System::Clock::Timestamp startTime = System::SystemClock().GetMonotonicTimestamp();
+    System::Clock::Internal::RAIIMockClock clock;
+    clock.SetMonotonic(startTime);
+
+    SimulatedNetwork network;
+    network.Init(systemLayer);
+    network.SetLatency(20_ms32);
+
+    // Nodes are large, so keep them off the stack.
+    auto controller = std::make_unique<SimulatedNode>();
+    ASSERT_EQ(controller->Init(network, systemLayer, kControllerNodeId, kFirstPort), CHIP_NO_ERROR);
+
+    std::unique_ptr<SimulatedNode> devices[kDeviceCount];
+    std::unique_ptr<Protocols::Echo::EchoServer> servers[kDeviceCount];
+    std::unique_ptr<Protocols::Echo::EchoClient> clients[kDeviceCount];
+    for (size_t i = 0; i < kDeviceCount; i++)
+    {
+        devices[i] = std::make_unique<SimulatedNode>();
+        ASSERT_EQ(devices[i]->Init(network, systemLayer, kFirstDeviceNodeId + i, static_cast<uint16_t>(kFirstPort + 1 + i)),
+                  CHIP_NO_ERROR);
+        ASSERT_EQ(SimulatedNode::Connect(*controller, *devices[i]), CHIP_NO_ERROR);
+
+        servers[i] = std::make_unique<Protocols::Echo::EchoServer>();
+        ASSERT_EQ(servers[i]->Init(&devices[i]->GetExchangeManager()), CHIP_NO_ERROR);
+
+        Optional<SessionHandle> session = controller->GetSessionTo(devices[i]->GetNodeId());
+        ASSERT_TRUE(session.HasValue());
+        clients[i] = std::make_unique<Protocols::Echo::EchoClient>();
+        ASSERT_EQ(clients[i]->Init(&controller->GetExchangeManager(), session.Value()), CHIP_NO_ERROR);
+        clients[i]->SetEchoResponseReceived(HandleEchoResponseReceived);
+    }
+
+    // Lose the first requests, so that MRP has to retransmit them.
+    constexpr uint32_t kDroppedMessageCount = 4;
+    network.DropNextMessages(kDroppedMessageCount);
+
+    gEchoResponseCount = 0;
+    for (auto & client : clients)
+    {
+        System::PacketBufferHandle payload = MessagePacketBuffer::NewWithData(kPayload, sizeof(kPayload));
+        ASSERT_FALSE(payload.IsNull());
+        EXPECT_EQ(client->SendEchoRequest(std::move(payload)), CHIP_NO_ERROR);
+    }
+
+    EXPECT_TRUE(spIOContext->DriveIOUntilInSimulatedTime(clock, 60_s, [] { return gEchoResponseCount == kDeviceCount; }));
+    EXPECT_EQ(gEchoResponseCount, kDeviceCount);
+    EXPECT_EQ(network.GetDroppedMessageCount(), kDroppedMessageCount);
+    EXPECT_EQ(network.GetUndeliverableMessageCount(), 0u);
+
+    // Let the standalone acks of the responses get through before tearing the nodes down.
+    spIOContext->DriveIOInSimulatedTime(clock, 5_s);
+    EXPECT_FALSE(network.HasPendingMessages());
+
+    for (size_t i = 0; i < kDeviceCount; i++)
+    {
+        clients[i]->Shutdown();
+        servers[i]->Shutdown();
+        devices[i]->Shutdown();
+    }
+    controller->Shutdown();
+    network.Shutdown();
+}
+
+} // namespace
@@ -0,0 +1,456 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a chip-echo-benchmark, which measures the
+ *      round-trip time and throughput of the CHIP transport, secure
+ *      session and MRP layers with the CHIP Echo Protocol, without the
+ *      Interaction Model on top.
+ *
+ *      A number of Echo exchanges are kept in flight at once against a
+ *      chip-echo-responder, each sending its next request as soon as
+ *      the previous response arrived, until the requested number of
+ *      requests was sent.
+ *
+ */
+
+#include "common.h"
+
+#include <lib/core/CHIPCore.h>
+#include <lib/core/ErrorStr.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeDelegate.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/echo/Echo.h>
+#include <system/SystemPacketBuffer.h>
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+#include <transport/raw/TCP.h>
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+#include <transport/raw/UDP.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#define ECHO_CLIENT_PORT (CHIP_PORT + 1)
+
+namespace {
+
+// Exchanges kept in flight at most.  A closed exchange holds its context until its standalone ack is sent, so at most
+// half of the exchange contexts are used for requests.
+constexpr size_t kMaxConcurrency = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2;
+
+// Time given to a request for its response, including the MRP retransmissions.
+constexpr chip::System::Clock::Timeout kEchoResponseTimeout = chip::System::Clock::Seconds16(5);
+
+constexpr chip::FabricIndex gFabricIndex = 0;
+
+chip::TransportMgr<chip::Transport::UDP> gUDPManager;
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+chip::TransportMgr<chip::Transport::TCP<kMaxTcpActiveConnectionCount, kMaxTcpPendingPackets>> gTCPManager;
+
+chip::Transport::AppTCPConnectionCallbackCtxt gAppTCPConnCbCtxt;
+chip::Transport::ActiveTCPConnectionHandle gActiveTCPConnState;
+
+bool gClientConEstablished = false;
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+
+chip::Inet::IPAddress gDestAddr;
+chip::SessionHolder gSession;
+
+// Options.
+bool gUseTCP           = false;
+size_t gConcurrency    = 1;
+size_t gPayloadSize    = 32;
+uint32_t gRequestCount = 100;
+uint8_t gPayload[chip::kMaxAppMessageLen];
+
+// Run state and results.
+chip::System::Clock::Microseconds64 gStartTime;
+chip::System::Clock::Microseconds64 gEndTime;
+size_t gActiveSlots       = 0;
+uint32_t gRequestsSent    = 0;
+uint32_t gResponses       = 0;
+uint32_t gTimeouts        = 0;
+uint32_t gSendFailures    = 0;
+uint32_t gBadResponses    = 0;
+uint32_t gRetransmissions = 0;
+std::vector<uint64_t> gRoundTripTimesUs;
+
+void Finish();
+
+// One Echo exchange in flight at a time, sending the next request once the previous one is done.
+class EchoSlot : public chip::Messaging::ExchangeDelegate
+{
+public:
+    void SendNextRequest();
+
+private:
+    CHIP_ERROR OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                 chip::System::PacketBufferHandle && payload) override;
+    void OnResponseTimeout(chip::Messaging::ExchangeContext * ec) override;
+
+    void Stop();
+
+    chip::System::Clock::Microseconds64 mSendTime;
+};
+
+EchoSlot gSlots[kMaxConcurrency];
+
+void EchoSlot::SendNextRequest()
+{
+    if (gRequestsSent >= gRequestCount)
+    {
+        Stop();
+        return;
+    }
+
+    chip::System::PacketBufferHandle payloadBuf = chip::MessagePacketBuffer::NewWithData(gPayload, gPayloadSize);
+    chip::Messaging::ExchangeContext * ec       = gExchangeManager.NewContext(gSession.Get().Value(), this);
+    if (payloadBuf.IsNull() || ec == nullptr)
+    {
+        printf("Unable to allocate a request\n");
+        gSendFailures++;
+        if (ec != nullptr)
+        {
+            ec->Abort();
+        }
+        Stop();
+        return;
+    }
+
+    ec->SetResponseTimeout(kEchoResponseTimeout);
+    mSendTime = chip::System::SystemClock().GetMonotonicMicroseconds64();
+
+    CHIP_ERROR err = ec->SendMessage(chip::Protocols::Echo::MsgType::EchoRequest, std::move(payloadBuf),
+                                     chip::Messaging::SendFlags(chip::Messaging::SendMessageFlags::kExpectResponse));
+    if (err != CHIP_NO_ERROR)
+    {
+        printf("Send echo request failed, err: %s\n", chip::ErrorStr(err));
+        gSendFailures++;
+        ec->Abort();
+        Stop();
+        return;
+    }
+
+    gRequestsSent++;
+}
+
+CHIP_ERROR EchoSlot::OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                       chip::System::PacketBufferHandle && payload)
+{
+    chip::System::Clock::Microseconds64 now = chip::System::SystemClock().GetMonotonicMicroseconds64();
+
+    if (!payloadHeader.HasMessageType(chip::Protocols::Echo::MsgType::EchoResponse) || payload.IsNull() ||
+        payload->DataLength() != gPayloadSize || memcmp(payload->Start(), gPayload, gPayloadSize) != 0)
+    {
+        gBadResponses++;
+    }
+    else
+    {
+        gResponses++;
+        gRoundTripTimesUs.push_back((now - mSendTime).count());
+    }
+
+    SendNextRequest();
+    return CHIP_NO_ERROR;
+}
+
+void EchoSlot::OnResponseTimeout(chip::Messaging::ExchangeContext * ec)
+{
+    gTimeouts++;
+    SendNextRequest();
+}
+
+void EchoSlot::Stop()
+{
+    if (--gActiveSlots == 0)
+    {
+        Finish();
+    }
+}
+
+void StartBenchmark(chip::System::Layer * systemLayer, void * appState)
+{
+    printf("Sending %" PRIu32 " echo requests of %u bytes, %u at a time, over %s\n", gRequestCount,
+           static_cast<unsigned>(gPayloadSize), static_cast<unsigned>(gConcurrency), gUseTCP ? "TCP" : "UDP");
+
+    gRetransmissions = gSessionManager.GetMessageStats().retransmissions;
+    gStartTime       = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    gActiveSlots     = gConcurrency;
+    for (size_t i = 0; i < gConcurrency; i++)
+    {
+        gSlots[i].SendNextRequest();
+    }
+}
+
+void Finish()
+{
+    gEndTime         = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    gRetransmissions = gSessionManager.GetMessageStats().retransmissions - gRetransmissions;
+    TEMPORARY_RETURN_IGNORED chip::DeviceLayer::PlatformMgr().StopEventLoopTask();
+}
+
+double ToMilliseconds(uint64_t us)
+{
+    return static_cast<double>(us) / 1000;
+}
+
+void PrintReport()
+{
+    double elapsedSecs = static_cast<double>((gEndTime - gStartTime).count()) / 1000000;
+
+    printf("\nRequests: %" PRIu32 ", responses: %" PRIu32 ", timeouts: %" PRIu32 ", bad responses: %" PRIu32
+           ", send failures: %" PRIu32 "\n",
+           gRequestsSent, gResponses, gTimeouts, gBadResponses, gSendFailures);
+    printf("Elapsed: %.3fs, throughput: %.1f round trips/s, %.1f KiB/s each way\n", elapsedSecs,
+           elapsedSecs > 0 ? gResponses / elapsedSecs : 0.0,
+           elapsedSecs > 0 ? static_cast<double>(gResponses) * static_cast<double>(gPayloadSize) / 1024 / elapsedSecs : 0.0);
+    // Only the retransmissions of this side, i.e. of the requests and of the acks they carry; MRP is not used over TCP.
+    printf("MRP retransmissions: %" PRIu32 " (%.2f per 100 requests)\n", gRetransmissions,
+           gRequestsSent > 0 ? static_cast<double>(gRetransmissions) * 100 / gRequestsSent : 0.0);
+
+    if (gRoundTripTimesUs.empty())
+    {
+        return;
+    }
+
+    std::sort(gRoundTripTimesUs.begin(), gRoundTripTimesUs.end());
+
+    // Nearest-rank percentiles.
+    auto percentile = [](size_t percent) {
+        return gRoundTripTimesUs[(gRoundTripTimesUs.size() * percent + 99) / 100 - 1];
+    };
+
+    printf("Round trip (ms): min %.3f, p50 %.3f, p90 %.3f, p99 %.3f, max %.3f\n", ToMilliseconds(gRoundTripTimesUs.front()),
+           ToMilliseconds(percentile(50)), ToMilliseconds(percentile(90)), ToMilliseconds(percentile(99)),
+           ToMilliseconds(gRoundTripTimesUs.back()));
+}
+
+CHIP_ERROR EstablishSecureSession()
+{
+    chip::Transport::PeerAddress peerAddr;
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    if (gUseTCP)
+    {
+        peerAddr = chip::Transport::PeerAddress::TCP(gDestAddr, CHIP_PORT);
+    }
+    else
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+    {
+        peerAddr = chip::Transport::PeerAddress::UDP(gDestAddr, CHIP_PORT, chip::Inet::InterfaceId::Null());
+    }
+
+    ReturnErrorOnFailure(gSessionManager.InjectPaseSessionWithTestKey(gSession, 1, chip::kTestDeviceNodeId, 1, gFabricIndex,
+                                                                      peerAddr, chip::CryptoContext::SessionRole::kInitiator));
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    if (gUseTCP)
+    {
+        gSession.Get().Value()->AsSecureSession()->SetTCPConnection(gActiveTCPConnState);
+    }
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+    return CHIP_NO_ERROR;
+}
+
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+void HandleConnectionAttemptComplete(chip::Transport::ActiveTCPConnectionHandle & conn, CHIP_ERROR err)
+{
+    TEMPORARY_RETURN_IGNORED chip::DeviceLayer::PlatformMgr().StopEventLoopTask();
+
+    if (err != CHIP_NO_ERROR || conn != gActiveTCPConnState)
+    {
+        printf("Connection FAILED with err: %s\n", chip::ErrorStr(err));
+        gActiveTCPConnState.Release();
+        return;
+    }
+
+    gClientConEstablished = true;
+}
+
+void HandleConnectionClosed(chip::Transport::ActiveTCPConnectionState & conn, CHIP_ERROR conErr)
+{
+    gActiveTCPConnState.Release();
+    gClientConEstablished = false;
+}
+
+CHIP_ERROR EstablishTCPConnection()
+{
+    chip::Transport::PeerAddress peerAddr = chip::Transport::PeerAddress::TCP(gDestAddr, CHIP_PORT);
+
+    ReturnErrorOnFailure(gSessionManager.TCPConnect(peerAddr, &gAppTCPConnCbCtxt, gActiveTCPConnState));
+
+    // Runs until HandleConnectionAttemptComplete.
+    chip::DeviceLayer::PlatformMgr().RunEventLoop();
+    return gClientConEstablished ? CHIP_NO_ERROR : CHIP_ERROR_CONNECTION_ABORTED;
+}
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+
+bool ParseUnsigned(const char * value, unsigned long min, unsigned long max, unsigned long & out)
+{
+    char * end = nullptr;
+    errno      = 0;
+    out        = strtoul(value, &end, 0);
+    return errno == 0 && end != value && *end == '\0' && out >= min && out <= max;
+}
+
+CHIP_ERROR ParseArguments(int argc, char * argv[])
+{
+    if (argc <= 1)
+    {
+        printf("Missing Echo Server IP address\n");
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (!chip::Inet::IPAddress::FromString(argv[1], gDestAddr) || gDestAddr.Type() != chip::Inet::IPAddressType::kIPv6)
+    {
+        printf("Invalid Echo Server IPv6 address: %s\n", argv[1]);
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (int i = 2; i < argc; i++)
+    {
+        unsigned long value = 0;
+        const char * next   = (i + 1 < argc) ? argv[i + 1] : "";
+
+        if (strcmp(argv[i], "--tcp") == 0)
+        {
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+            gUseTCP = true;
+#else
+            printf("TCP is not enabled in this build\n");
+            return CHIP_ERROR_INVALID_ARGUMENT;
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+        }
+        else if (strcmp(argv[i], "--concurrency") == 0 && ParseUnsigned(next, 1, kMaxConcurrency, value))
+        {
+            gConcurrency = value;
+            i++;
+        }
+        else if (strcmp(argv[i], "--payload-size") == 0 && ParseUnsigned(next, 0, sizeof(gPayload), value))
+        {
+            gPayloadSize = value;
+            i++;
+        }
+        else if (strcmp(argv[i], "--count") == 0 && ParseUnsigned(next, 1, UINT32_MAX, value))
+        {
+            gRequestCount = static_cast<uint32_t>(value);
+            i++;
+        }
+        else
+        {
+            printf("Invalid argument: %s\n", argv[i]);
+            printf("Usage: %s <Server's IPv6 address> [--tcp] [--concurrency 1..%u] [--payload-size 0..%u] [--count N]\n",
+                   argv[0], static_cast<unsigned>(kMaxConcurrency), static_cast<unsigned>(sizeof(gPayload)));
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    // A recognizable pattern, checked in the responses.
+    for (size_t i = 0; i < sizeof(gPayload); i++)
+    {
+        gPayload[i] = static_cast<uint8_t>(i);
+    }
+
+    gRoundTripTimesUs.reserve(gRequestCount);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    CHIP_ERROR err = ParseArguments(argc, argv);
+    SuccessOrExit(err);
+
+    InitializeChip();
+
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    if (gUseTCP)
+    {
+        err = gTCPManager.Init(chip::Transport::TcpListenParameters(chip::DeviceLayer::TCPEndPointManager())
+                                   .SetAddressType(chip::Inet::IPAddressType::kIPv6)
+                                   .SetListenPort(ECHO_CLIENT_PORT));
+        SuccessOrExit(err);
+
+        err = gSessionManager.Init(&chip::DeviceLayer::SystemLayer(), &gTCPManager, &gMessageCounterManager, &gStorage,
+                                   &gFabricTable, gSessionKeystore);
+        SuccessOrExit(err);
+
+        gAppTCPConnCbCtxt.appContext     = nullptr;
+        gAppTCPConnCbCtxt.connCompleteCb = HandleConnectionAttemptComplete;
+        gAppTCPConnCbCtxt.connClosedCb   = HandleConnectionClosed;
+    }
+    else
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+    {
+        err = gUDPManager.Init(chip::Transport::UdpListenParameters(chip::DeviceLayer::UDPEndPointManager())
+                                   .SetAddressType(chip::Inet::IPAddressType::kIPv6)
+                                   .SetListenPort(ECHO_CLIENT_PORT));
+        SuccessOrExit(err);
+
+        err = gSessionManager.Init(&chip::DeviceLayer::SystemLayer(), &gUDPManager, &gMessageCounterManager, &gStorage,
+                                   &gFabricTable, gSessionKeystore);
+        SuccessOrExit(err);
+    }
+
+    err = gExchangeManager.Init(&gSessionManager);
+    SuccessOrExit(err);
+
+    err = gMessageCounterManager.Init(&gExchangeManager);
+    SuccessOrExit(err);
+
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    if (gUseTCP)
+    {
+        err = EstablishTCPConnection();
+        SuccessOrExit(err);
+    }
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+
+    err = EstablishSecureSession();
+    SuccessOrExit(err);
+
+    err = chip::DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::kZero, StartBenchmark, nullptr);
+    SuccessOrExit(err);
+
+    chip::DeviceLayer::PlatformMgr().RunEventLoop();
+
+    PrintReport();
+
+    gUDPManager.Close();
+
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    gActiveTCPConnState.Release();
+    gTCPManager.Close();
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+
+    ShutdownChip();
+
+exit:
+    if (err != CHIP_NO_ERROR || gResponses == 0)
+    {
+        printf("ChipEchoBenchmark failed: %s\n", chip::ErrorStr(err));
+        exit(EXIT_FAILURE);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -66,25 +66,35 @@ int main(int argc, char * argv[])
     bool useTCP = false;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
     bool disableEcho = false;
+    bool quiet       = false;
 
     const chip::FabricIndex gFabricIndex = 0;
 
-    if (argc > 2)
+    if (argc > 3)
     {
         printf("Too many arguments specified!\n");
         ExitNow(err = CHIP_ERROR_INVALID_ARGUMENT);
     }
 
-#if INET_CONFIG_ENABLE_TCP_ENDPOINT
-    if ((argc == 2) && (strcmp(argv[1], "--tcp") == 0))
+    for (int i = 1; i < argc; i++)
     {
-        useTCP = true;
-    }
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+        if (strcmp(argv[i], "--tcp") == 0)
+        {
+            useTCP = true;
+        }
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-    if ((argc == 2) && (strcmp(argv[1], "--disable") == 0))
-    {
-        disableEcho = true;
+        if (strcmp(argv[i], "--disable") == 0)
+        {
+            disableEcho = true;
+        }
+
+        // Do not print every request, e.g. when serving chip-echo-benchmark.
+        if (strcmp(argv[i], "--quiet") == 0)
+        {
+            quiet = true;
+        }
     }
 
     InitializeChip();
@@ -128,7 +138,7 @@ int main(int argc, char * argv[])
                                                        chip::CryptoContext::SessionRole::kResponder);
     SuccessOrExit(err);
 
-    if (!disableEcho)
+    if (!disableEcho && !quiet)
     {
         // Arrange to get a callback whenever an Echo Request is received.
         gEchoServer.SetEchoRequestReceived(HandleEchoRequestReceived);
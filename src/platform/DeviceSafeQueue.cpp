@@ -28,26 +28,59 @@ namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
-void DeviceSafeQueue::Push(const ChipDeviceEvent & event)
+bool DeviceSafeQueue::Push(const ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    mEventQueue.push(event);
+    // Counted before the event becomes visible, so that the consumer never takes the depth below zero.
+    size_t depth         = mDepth.fetch_add(1, std::memory_order_relaxed) + 1;
+    size_t highWatermark = mHighWatermark.load(std::memory_order_relaxed);
+    while (depth > highWatermark && !mHighWatermark.compare_exchange_weak(highWatermark, depth, std::memory_order_relaxed))
+    {
+    }
+
+    if (mOverflowSize.load(std::memory_order_acquire) != 0 || !mRing.TryPush(event))
+    {
+        std::unique_lock<std::mutex> lock(mOverflowLock);
+        mOverflow.push_back(event);
+        mOverflowSize.fetch_add(1, std::memory_order_release);
+        mOverflowCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Pairs with the store in PopFront: either the consumer sees this event after clearing the flag, or this push sees
+    // the flag cleared and wakes the consumer up.
+    return !mWakeRequested.exchange(true, std::memory_order_seq_cst);
 }
 
-bool DeviceSafeQueue::Empty()
+bool DeviceSafeQueue::PopFront(ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    return mEventQueue.empty();
+    VerifyOrReturnValue(!TryPop(event), true);
+
+    // The queue looked empty: ask for a wakeup on the next push, then look again for an event pushed before the flag
+    // was cleared, whose producer did not ask for one.
+    mWakeRequested.store(false, std::memory_order_seq_cst);
+    return TryPop(event);
 }
 
-ChipDeviceEvent DeviceSafeQueue::PopFront()
+bool DeviceSafeQueue::TryPop(ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
+    // Events taken out of the overflow queue are older than anything pushed to the ring since, so they go first.
+    if (mOverflowBatch.empty())
+    {
+        if (mRing.TryPop(event))
+        {
+            mDepth.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        VerifyOrReturnValue(mOverflowSize.load(std::memory_order_acquire) != 0, false);
 
-    const ChipDeviceEvent event = mEventQueue.front();
-    mEventQueue.pop();
+        std::unique_lock<std::mutex> lock(mOverflowLock);
+        mOverflowBatch.swap(mOverflow);
+        mOverflowSize.store(0, std::memory_order_release);
+    }
 
-    return event;
+    event = mOverflowBatch.front();
+    mOverflowBatch.pop_front();
+    mDepth.fetch_sub(1, std::memory_order_relaxed);
+    return true;
 }
 
 } // namespace Internal
@@ -20,14 +20,17 @@
  *    @file
  *      This file declares the CHIP device event queue which operates in a FIFO context (first-in first-out),
  *      and provides a specific set of member functions to access its elements wth thread safety.
+ *      Events are posted from any thread and consumed by the CHIP event loop only.
  */
 
 #pragma once
 
+#include <atomic>
+#include <deque>
 #include <mutex>
-#include <queue>
 
 #include <lib/core/CHIPCore.h>
+#include <lib/support/MpscRingBuffer.h>
 #include <platform/CHIPDeviceConfig.h>
 #include <platform/CHIPDeviceEvent.h>
 
@@ -39,10 +42,16 @@ namespace Internal {
  *  @class DeviceSafeQueue
  *
  *  @brief
- *      This class represents a thread-safe message queue implemented with C++ Standard Library, the message queue
- *      is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued, decoded,
- *      and then an action is performed.
+ *      This class represents a thread-safe message queue, the message queue is used by the CHIP event loop to hold
+ *      incoming messages. Each message is sequentially dequeued, decoded, and then an action is performed.
  *
+ *      The queue has any number of producers and a single consumer. Events are pushed without taking a lock into a
+ *      ring of CHIP_DEVICE_CONFIG_SAFE_QUEUE_RING_SIZE slots; when the ring is full, they spill into a locked overflow
+ *      queue instead, so that pushing never fails. The events pushed by one thread are popped in the order they were
+ *      pushed.
+ *
+ *      Push reports whether the consumer needs waking up: only the first event pushed after the consumer found the
+ *      queue empty does, so that a burst of events costs a single wakeup.
  */
 class DeviceSafeQueue
 {
@@ -50,13 +59,43 @@ public:
     DeviceSafeQueue()  = default;
     ~DeviceSafeQueue() = default;
 
-    void Push(const ChipDeviceEvent & event);
-    bool Empty();
-    ChipDeviceEvent PopFront();
+    /**
+     * Pushes an event, from any thread.
+     *
+     * @return Whether the consumer must be woken up to process the event.
+     */
+    bool Push(const ChipDeviceEvent & event);
+
+    /**
+     * Pops the oldest event, from the consumer thread only.
+     *
+     * @return false when the queue is empty. Events pushed from then on ask for a wakeup.
+     */
+    bool PopFront(ChipDeviceEvent & event);
+
+    // Number of events waiting, and the highest it has been.
+    size_t GetDepth() const { return mDepth.load(std::memory_order_relaxed); }
+    size_t GetHighWatermark() const { return mHighWatermark.load(std::memory_order_relaxed); }
+    // Number of events that did not fit in the ring and went through the overflow queue.
+    size_t GetOverflowCount() const { return mOverflowCount.load(std::memory_order_relaxed); }
 
 private:
-    std::queue<ChipDeviceEvent> mEventQueue;
-    std::mutex mEventQueueLock;
+    bool TryPop(ChipDeviceEvent & event);
+
+    MpscRingBuffer<ChipDeviceEvent, CHIP_DEVICE_CONFIG_SAFE_QUEUE_RING_SIZE> mRing;
+
+    // While mOverflowSize is not zero, events are pushed to the overflow queue rather than the ring, so that they do
+    // not overtake events of the same thread waiting there.
+    std::mutex mOverflowLock;
+    std::deque<ChipDeviceEvent> mOverflow;
+    std::atomic<size_t> mOverflowSize{ 0 };
+    std::deque<ChipDeviceEvent> mOverflowBatch; // Consumer only: events taken out of mOverflow, popped first.
+
+    std::atomic<bool> mWakeRequested{ false };
+
+    std::atomic<size_t> mDepth{ 0 };
+    std::atomic<size_t> mHighWatermark{ 0 };
+    std::atomic<size_t> mOverflowCount{ 0 };
 
     DeviceSafeQueue(const DeviceSafeQueue &)             = delete;
     DeviceSafeQueue & operator=(const DeviceSafeQueue &) = delete;
@@ -41,8 +41,10 @@
 #include <lib/support/SafeInt.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/CommissionableDataProvider.h>
+#include <tracing/metric_event.h>
 
 #include "bluez/BluezEndpoint.h"
+#include "bluez/BluezManagement.h"
 
 #if !CHIP_DEVICE_CONFIG_SUPPORTS_CONCURRENT_CONNECTION
 #include <platform/DeviceControlServer.h>
@@ -328,6 +330,59 @@ exit:
     return mtu;
 }
 
+CHIP_ERROR BLEManagerImpl::SetConnectionProfile(BLE_CONNECTION_OBJECT conId, Ble::BleConnectionProfile profile)
+{
+    // Connection interval of 7.5 to 15 ms while BTP is open, and the kernel defaults of 30 to 50 ms otherwise.
+    constexpr BluezConnectionParameters kFastParameters    = { 6, 12, 0, 42 };
+    constexpr BluezConnectionParameters kDefaultParameters = { 24, 40, 0, 42 };
+
+    VerifyOrReturnError(conId != BLE_CONNECTION_UNINITIALIZED, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const bool fast                          = (profile == Ble::BleConnectionProfile::kFastTransfer);
+    const BluezConnectionParameters & params = fast ? kFastParameters : kDefaultParameters;
+    const auto adapterIndex                  = static_cast<uint16_t>(mAdapterId);
+
+    ReturnErrorOnFailure(
+        BluezManagement::LoadConnectionParameters(adapterIndex, conId->GetPeerAddress(), conId->IsPeerAddressRandom(), params));
+
+    // The PHY preference applies to the whole adapter, so the previous selection is restored once BTP is closed.
+    bool phy2M = false;
+    if (fast)
+    {
+        uint32_t supportedPhys = 0;
+        uint32_t selectedPhys  = 0;
+        if (mSavedSelectedPhys.HasValue())
+        {
+            phy2M = true;
+        }
+        else if (BluezManagement::ReadPhyConfiguration(adapterIndex, supportedPhys, selectedPhys) == CHIP_NO_ERROR &&
+                 (supportedPhys & kBluezPhyLe2M) == kBluezPhyLe2M)
+        {
+            phy2M = (selectedPhys & kBluezPhyLe2M) == kBluezPhyLe2M;
+            if (!phy2M && BluezManagement::SetPhyConfiguration(adapterIndex, selectedPhys | kBluezPhyLe2M) == CHIP_NO_ERROR)
+            {
+                mSavedSelectedPhys.SetValue(selectedPhys);
+                phy2M = true;
+            }
+        }
+    }
+    else if (mSavedSelectedPhys.HasValue())
+    {
+        LogErrorOnFailure(BluezManagement::SetPhyConfiguration(adapterIndex, mSavedSelectedPhys.Value()));
+        mSavedSelectedPhys.ClearValue();
+    }
+
+    ChipLogProgress(DeviceLayer, "BLE connection profile %s: peer=%s interval<=%u LE-2M=%d MTU=%u", fast ? "fast" : "default",
+                    conId->GetPeerAddress(), params.mMaxInterval, phy2M, conId->GetMTU());
+    if (fast)
+    {
+        MATTER_LOG_METRIC(Tracing::kMetricBleConnectionInterval, static_cast<uint32_t>(params.mMaxInterval));
+        MATTER_LOG_METRIC(Tracing::kMetricBlePhy2M, static_cast<uint32_t>(phy2M));
+        MATTER_LOG_METRIC(Tracing::kMetricBleAttMtu, static_cast<uint32_t>(conId->GetMTU()));
+    }
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR BLEManagerImpl::SubscribeCharacteristic(BLE_CONNECTION_OBJECT conId, const ChipBleUUID * svcId,
                                                    const ChipBleUUID * charId)
 {
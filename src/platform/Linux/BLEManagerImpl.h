@@ -27,6 +27,7 @@
 #include <string>
 
 #include <ble/Ble.h>
+#include <lib/core/Optional.h>
 #include <platform/internal/BLEManager.h>
 
 #include "bluez/BluezAdvertisement.h"
@@ -128,6 +129,7 @@ private:
                               System::PacketBufferHandle pBuf) override;
     CHIP_ERROR SendWriteRequest(BLE_CONNECTION_OBJECT conId, const Ble::ChipBleUUID * svcId, const Ble::ChipBleUUID * charId,
                                 System::PacketBufferHandle pBuf) override;
+    CHIP_ERROR SetConnectionProfile(BLE_CONNECTION_OBJECT conId, Ble::BleConnectionProfile profile) override;
 
     // ===== Members that implement virtual methods on BleApplicationDelegate.
 
@@ -200,6 +202,8 @@ private:
     BluezObjectManager mBluezObjectManager;
     GAutoPtr<BluezAdapter1> mAdapter;
     uint32_t mAdapterId = 0;
+    // PHYs the adapter selected before the LE 2M PHY was requested for a BTP session.
+    Optional<uint32_t> mSavedSelectedPhys;
 
     char mDeviceName[kMaxDeviceNameLength + 1];
     bool mIsCentral = false;
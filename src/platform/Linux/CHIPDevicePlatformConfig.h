@@ -33,6 +33,11 @@
 #define CHIP_DEVICE_CONFIG_ENABLE_WIFI_AP 0
 #endif
 
+// Back-to-back ScanNetworks requests during commissioning reuse the results of wpa_supplicant's last scan.
+#ifndef CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_MAX_AGE
+#define CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_MAX_AGE 5000
+#endif
+
 #ifndef CHIP_DEVICE_CONFIG_ENABLE_THREAD
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD CHIP_ENABLE_OPENTHREAD
 #endif
@@ -0,0 +1,166 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides read-only access to a binary factory data image for the Linux platform.
+ */
+
+#include <platform/Linux/CHIPLinuxFactoryData.h>
+
+#include <lib/core/TLVReader.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/FileDescriptor.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+CHIP_ERROR ChipLinuxFactoryData::Init(const char * imageFile)
+{
+    Close();
+
+    FileDescriptor fd(open(imageFile, O_RDONLY | O_CLOEXEC));
+    if (fd.Get() < 0)
+    {
+        VerifyOrReturnError(errno != ENOENT, CHIP_ERROR_NOT_FOUND);
+        ChipLogError(DeviceLayer, "Failed to open %s: %s", imageFile, strerror(errno));
+        return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+
+    struct stat st;
+    VerifyOrReturnError(fstat(fd.Get(), &st) == 0, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    VerifyOrReturnError(st.st_size > 0, CHIP_ERROR_INVALID_TLV_ELEMENT,
+                        ChipLogError(DeviceLayer, "Factory data image %s is empty", imageFile));
+
+    // The mapping outlives the descriptor, which is closed on return.
+    void * image = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd.Get(), 0);
+    VerifyOrReturnError(image != MAP_FAILED, CHIP_ERROR_PERSISTED_STORAGE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to map %s: %s", imageFile, strerror(errno)));
+    mImage = ByteSpan(static_cast<const uint8_t *>(image), static_cast<size_t>(st.st_size));
+
+    CHIP_ERROR err = Index();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Invalid factory data image %s: %" CHIP_ERROR_FORMAT, imageFile, err.Format());
+        Close();
+        return err;
+    }
+
+    ChipLogDetail(DeviceLayer, "Mapped factory data image %s: %u values", imageFile, static_cast<unsigned>(mValues.size()));
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxFactoryData::Close()
+{
+    if (IsLoaded())
+    {
+        munmap(const_cast<uint8_t *>(mImage.data()), mImage.size());
+    }
+    mImage = ByteSpan();
+    mValues.clear();
+}
+
+CHIP_ERROR ChipLinuxFactoryData::Index()
+{
+    TLV::TLVReader reader;
+    reader.Init(mImage);
+
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(reader.EnterContainer(arrayType));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag())) == CHIP_NO_ERROR)
+    {
+        TLV::TLVType structType;
+        ReturnErrorOnFailure(reader.EnterContainer(structType));
+
+        Value value;
+        ReturnErrorOnFailure(reader.Next(TLV::kTLVType_UTF8String, TLV::ContextTag(Tag::kKey)));
+        ReturnErrorOnFailure(reader.Get(value.key));
+        VerifyOrReturnError(!value.key.empty(), CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+        ReturnErrorOnFailure(reader.Next());
+        VerifyOrReturnError(reader.GetTag() == TLV::ContextTag(Tag::kValue), CHIP_ERROR_INVALID_TLV_TAG);
+        value.type   = reader.GetType();
+        value.number = 0;
+        switch (value.type)
+        {
+        case TLV::kTLVType_UnsignedInteger:
+            ReturnErrorOnFailure(reader.Get(value.number));
+            break;
+        case TLV::kTLVType_UTF8String:
+        case TLV::kTLVType_ByteString:
+            ReturnErrorOnFailure(reader.GetByteView(value.bytes));
+            break;
+        default:
+            return CHIP_ERROR_WRONG_TLV_TYPE;
+        }
+
+        ReturnErrorOnFailure(reader.ExitContainer(structType));
+        mValues.push_back(value);
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    ReturnErrorOnFailure(reader.ExitContainer(arrayType));
+    VerifyOrReturnError(reader.Next() == CHIP_END_OF_TLV, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    return CHIP_NO_ERROR;
+}
+
+const ChipLinuxFactoryData::Value * ChipLinuxFactoryData::Find(const char * key) const
+{
+    CharSpan keySpan = CharSpan::fromCharString(key);
+    for (const Value & value : mValues)
+    {
+        if (value.key.data_equal(keySpan))
+        {
+            return &value;
+        }
+    }
+    return nullptr;
+}
+
+CHIP_ERROR ChipLinuxFactoryData::GetValue(const char * key, uint64_t & value) const
+{
+    const Value * found = Find(key);
+    VerifyOrReturnError(found != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+    VerifyOrReturnError(found->type == TLV::kTLVType_UnsignedInteger, CHIP_ERROR_WRONG_TLV_TYPE);
+    value = found->number;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxFactoryData::GetValue(const char * key, ByteSpan & value) const
+{
+    const Value * found = Find(key);
+    VerifyOrReturnError(found != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+    VerifyOrReturnError(found->type != TLV::kTLVType_UnsignedInteger, CHIP_ERROR_WRONG_TLV_TYPE);
+    value = found->bytes;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,93 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides read-only access to a binary factory data image for the Linux platform.
+ *
+ *          The image is a TLV anonymous array of anonymous structures, one per factory value, each holding the key
+ *          name as a UTF-8 string under context tag 1 and the value under context tag 2, as an unsigned integer, a
+ *          UTF-8 string or a byte string. The file is mapped read-only and indexed once by Init(), so that looking a
+ *          value up involves neither file I/O nor parsing, and string and binary values are returned as spans into
+ *          the mapping rather than copied.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVTypes.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxFactoryData
+{
+public:
+    enum class Tag : uint8_t
+    {
+        kKey   = 1,
+        kValue = 2,
+    };
+
+    ChipLinuxFactoryData() = default;
+    ~ChipLinuxFactoryData() { Close(); }
+
+    ChipLinuxFactoryData(const ChipLinuxFactoryData &)             = delete;
+    ChipLinuxFactoryData & operator=(const ChipLinuxFactoryData &) = delete;
+
+    /// Map and index the image. Returns CHIP_ERROR_NOT_FOUND if the file does not exist, in which case the factory
+    /// data is expected to come from elsewhere.
+    CHIP_ERROR Init(const char * imageFile);
+    void Close();
+
+    bool IsLoaded() const { return mImage.data() != nullptr; }
+    size_t GetValueCount() const { return mValues.size(); }
+
+    /// Returns CHIP_ERROR_KEY_NOT_FOUND if the image is not loaded or does not hold the key, and CHIP_ERROR_WRONG_TLV_TYPE
+    /// if the value is not of the requested kind. Strings and byte strings are both returned as bytes; the span stays
+    /// valid until Close().
+    CHIP_ERROR GetValue(const char * key, uint64_t & value) const;
+    CHIP_ERROR GetValue(const char * key, ByteSpan & value) const;
+
+    bool HasValue(const char * key) const { return Find(key) != nullptr; }
+
+private:
+    struct Value
+    {
+        CharSpan key;
+        TLV::TLVType type;
+        uint64_t number;
+        ByteSpan bytes;
+    };
+
+    CHIP_ERROR Index();
+    const Value * Find(const char * key) const;
+
+    ByteSpan mImage;
+    std::vector<Value> mValues;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
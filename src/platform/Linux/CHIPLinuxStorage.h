@@ -52,6 +52,9 @@
 #define CHIP_DEFAULT_FACTORY_PATH                                                                                                  \
     FATCONFDIR "/"                                                                                                                 \
                "chip_factory.ini"
+#define CHIP_DEFAULT_FACTORY_DATA_PATH                                                                                             \
+    FATCONFDIR "/"                                                                                                                 \
+               "chip_factory.bin"
 #define CHIP_DEFAULT_CONFIG_PATH                                                                                                   \
     SYSCONFDIR "/"                                                                                                                 \
                "chip_config.ini"
@@ -0,0 +1,515 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides an implementation of the log-structured key-value store on Linux platform.
+ *
+ *          File layout: an 8 byte magic, followed by records of the form
+ *
+ *              crc32 (4, LE) | type (1) | key length (1) | value length (4, LE) | key | value
+ *
+ *          where the CRC covers everything following it in the record.  A batch record has no key, and its value is
+ *          the sequence of records written by a batch, so that they are all found after a restart or, when the batch
+ *          record was torn, none of them.
+ */
+
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr uint8_t kLogMagic[]         = { 'C', 'H', 'I', 'P', 'K', 'V', 'L', '1' };
+constexpr size_t kLogMagicSize        = sizeof(kLogMagic);
+constexpr size_t kRecordCrcSize       = 4;
+constexpr size_t kRecordHeaderSize    = kRecordCrcSize + 1 + 1 + 4;
+constexpr uint32_t kCrc32Polynomial   = 0xEDB88320;
+constexpr uint32_t kCrc32InitialValue = 0xFFFFFFFF;
+
+uint32_t Crc32(const uint8_t * data, size_t length)
+{
+    uint32_t crc = kCrc32InitialValue;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ ((crc & 1) ? kCrc32Polynomial : 0);
+        }
+    }
+    return ~crc;
+}
+
+bool WriteAll(int fd, const uint8_t * data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t rv = write(fd, data, length);
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (rv <= 0)
+        {
+            return false;
+        }
+        data += rv;
+        length -= static_cast<size_t>(rv);
+    }
+    return true;
+}
+
+bool ReadAll(int fd, std::vector<uint8_t> & out)
+{
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 0)
+    {
+        return false;
+    }
+
+    out.resize(static_cast<size_t>(st.st_size));
+    size_t done = 0;
+    while (done < out.size())
+    {
+        ssize_t rv = pread(fd, out.data() + done, out.size() - done, static_cast<off_t>(done));
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (rv <= 0)
+        {
+            return false;
+        }
+        done += static_cast<size_t>(rv);
+    }
+    return true;
+}
+
+// Make a rename() within the directory of `path` durable.
+void SyncParentDirectory(const std::string & path)
+{
+    std::string dirPath(path);
+    int dirFd = open(dirname(dirPath.data()), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd >= 0)
+    {
+        fsync(dirFd);
+        close(dirFd);
+    }
+}
+
+} // namespace
+
+CHIP_ERROR ChipLinuxStorageLog::Init(const char * logFile)
+{
+    VerifyOrReturnError(logFile != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (mInitialized)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageLog::Init: Attempt to re-initialize with KVS log file: %s, IGNORING.", logFile);
+        return CHIP_NO_ERROR;
+    }
+
+    ChipLogDetail(DeviceLayer, "ChipLinuxStorageLog::Init: Using KVS log file: %s", logFile);
+
+    mLogPath.assign(logFile);
+    mEntries.clear();
+    mLiveSize = 0;
+    mLogSize  = 0;
+
+    mFd = FileDescriptor(open(mLogPath.c_str(), O_RDWR | O_APPEND | O_CLOEXEC));
+    if (mFd.Get() < 0)
+    {
+        VerifyOrReturnError(errno == ENOENT, CHIP_ERROR_PERSISTED_STORAGE_FAILED,
+                            ChipLogError(DeviceLayer, "Failed to open %s: %s", mLogPath.c_str(), strerror(errno)));
+
+        // Create the file through compaction, so that a log file always starts with a complete magic.
+        ReturnErrorOnFailure(CompactLocked());
+    }
+    else
+    {
+        ReturnErrorOnFailure(Replay());
+        if (ShouldCompact())
+        {
+            ReturnErrorOnFailure(CompactLocked());
+        }
+    }
+
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Replay()
+{
+    std::vector<uint8_t> contents;
+    VerifyOrReturnError(ReadAll(mFd.Get(), contents), CHIP_ERROR_PERSISTED_STORAGE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to read %s: %s", mLogPath.c_str(), strerror(errno)));
+    VerifyOrReturnError(contents.size() >= kLogMagicSize && memcmp(contents.data(), kLogMagic, kLogMagicSize) == 0,
+                        CHIP_ERROR_PERSISTED_STORAGE_FAILED,
+                        ChipLogError(DeviceLayer, "%s is not a log-structured KVS file", mLogPath.c_str()));
+
+    size_t offset = kLogMagicSize;
+    while (offset < contents.size())
+    {
+        const uint8_t * record = contents.data() + offset;
+        size_t recordSize      = CheckRecord(record, contents.size() - offset);
+        if (recordSize == 0)
+        {
+            break;
+        }
+
+        if (static_cast<RecordType>(record[kRecordCrcSize]) == RecordType::kBatch)
+        {
+            if (!ApplyBatch(record + kRecordHeaderSize, recordSize - kRecordHeaderSize))
+            {
+                break;
+            }
+        }
+        else
+        {
+            ApplyRecord(record);
+        }
+
+        offset += recordSize;
+    }
+
+    if (offset < contents.size())
+    {
+        // A record that does not check out can only be the last one, torn by a crash in the middle of an append; drop it
+        // so that new records are not appended behind it.
+        ChipLogError(DeviceLayer, "Discarding %u trailing bytes of %s", static_cast<unsigned>(contents.size() - offset),
+                     mLogPath.c_str());
+        VerifyOrReturnError(ftruncate(mFd.Get(), static_cast<off_t>(offset)) == 0 && fdatasync(mFd.Get()) == 0,
+                            CHIP_ERROR_PERSISTED_STORAGE_FAILED,
+                            ChipLogError(DeviceLayer, "Failed to truncate %s: %s", mLogPath.c_str(), strerror(errno)));
+    }
+
+    mLogSize = offset;
+    return CHIP_NO_ERROR;
+}
+
+size_t ChipLinuxStorageLog::CheckRecord(const uint8_t * record, size_t remaining)
+{
+    VerifyOrReturnValue(remaining >= kRecordHeaderSize, 0);
+
+    auto type         = static_cast<RecordType>(record[kRecordCrcSize]);
+    size_t keySize    = record[kRecordCrcSize + 1];
+    size_t valueSize  = Encoding::LittleEndian::Get32(record + kRecordCrcSize + 2);
+    bool validLengths = (type == RecordType::kBatch)
+        ? (keySize == 0 && valueSize > 0)
+        : (keySize > 0) && (valueSize <= kMaxValueSize) &&
+            (type == RecordType::kPut || (type == RecordType::kDelete && valueSize == 0));
+    VerifyOrReturnValue(validLengths && remaining >= RecordSize(keySize, valueSize), 0);
+
+    size_t recordSize = RecordSize(keySize, valueSize);
+    VerifyOrReturnValue(Crc32(record + kRecordCrcSize, recordSize - kRecordCrcSize) == Encoding::LittleEndian::Get32(record), 0);
+    return recordSize;
+}
+
+void ChipLinuxStorageLog::ApplyRecord(const uint8_t * record)
+{
+    auto type        = static_cast<RecordType>(record[kRecordCrcSize]);
+    size_t keySize   = record[kRecordCrcSize + 1];
+    size_t valueSize = Encoding::LittleEndian::Get32(record + kRecordCrcSize + 2);
+
+    std::string key(reinterpret_cast<const char *>(record + kRecordHeaderSize), keySize);
+    auto it = mEntries.find(key);
+    if (it != mEntries.end())
+    {
+        mLiveSize -= RecordSize(keySize, it->second.size());
+    }
+
+    if (type == RecordType::kPut)
+    {
+        const uint8_t * value = record + kRecordHeaderSize + keySize;
+        mEntries[key].assign(value, value + valueSize);
+        mLiveSize += RecordSize(keySize, valueSize);
+    }
+    else if (it != mEntries.end())
+    {
+        mEntries.erase(it);
+    }
+}
+
+bool ChipLinuxStorageLog::ApplyBatch(const uint8_t * records, size_t length)
+{
+    // Check all of the records before applying any of them.
+    for (size_t offset = 0, recordSize = 0; offset < length; offset += recordSize)
+    {
+        recordSize = CheckRecord(records + offset, length - offset);
+        VerifyOrReturnValue(recordSize != 0 && static_cast<RecordType>(records[offset + kRecordCrcSize]) != RecordType::kBatch,
+                            false);
+    }
+
+    for (size_t offset = 0; offset < length; offset += CheckRecord(records + offset, length - offset))
+    {
+        ApplyRecord(records + offset);
+    }
+    return true;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size, size_t offset)
+{
+    VerifyOrReturnError(key != nullptr && value != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_UNINITIALIZED);
+
+    auto it = mEntries.find(key);
+    VerifyOrReturnError(it != mEntries.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    const std::vector<uint8_t> & stored = it->second;
+    VerifyOrReturnError(offset <= stored.size(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    size_t total_size_to_read = stored.size() - offset;
+    size_t copy_size          = std::min(value_size, total_size_to_read);
+    if (read_bytes_size != nullptr)
+    {
+        *read_bytes_size = copy_size;
+    }
+    if (copy_size > 0)
+    {
+        memcpy(value, stored.data() + offset, copy_size);
+    }
+
+    return (value_size < total_size_to_read) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Put(const char * key, const void * value, size_t value_size)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(value != nullptr || value_size == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(value_size <= kMaxValueSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::string keyString(key);
+    VerifyOrReturnError(!keyString.empty() && keyString.size() <= kMaxKeySize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_UNINITIALIZED);
+
+    const uint8_t * bytes = static_cast<const uint8_t *>(value);
+    ReturnErrorOnFailure(LogRecord(RecordType::kPut, keyString, bytes, value_size));
+
+    auto it = mEntries.find(keyString);
+    if (it != mEntries.end())
+    {
+        mLiveSize -= RecordSize(keyString.size(), it->second.size());
+        it->second.assign(bytes, bytes + value_size);
+    }
+    else
+    {
+        mEntries.emplace(keyString, std::vector<uint8_t>(bytes, bytes + value_size));
+    }
+    mLiveSize += RecordSize(keyString.size(), value_size);
+
+    if (mBatchDepth == 0 && ShouldCompact())
+    {
+        // The record is already durable; a failed compaction only leaves a larger log behind.
+        LogErrorOnFailure(CompactLocked());
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Delete(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_UNINITIALIZED);
+
+    auto it = mEntries.find(key);
+    VerifyOrReturnError(it != mEntries.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    ReturnErrorOnFailure(LogRecord(RecordType::kDelete, it->first, nullptr, 0));
+
+    mLiveSize -= RecordSize(it->first.size(), it->second.size());
+    mEntries.erase(it);
+
+    if (mBatchDepth == 0 && ShouldCompact())
+    {
+        LogErrorOnFailure(CompactLocked());
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::BeginBatch()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_UNINITIALIZED);
+
+    mBatchDepth++;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CommitBatch()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_UNINITIALIZED);
+    VerifyOrReturnError(mBatchDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+
+    VerifyOrReturnError(--mBatchDepth == 0 && !mBatch.empty(), CHIP_NO_ERROR);
+
+    std::vector<uint8_t> batch;
+    batch.swap(mBatch);
+
+    CHIP_ERROR err = AppendRecord(RecordType::kBatch, std::string(), batch.data(), batch.size());
+    if (err != CHIP_NO_ERROR)
+    {
+        // None of the batch made it to storage; go back to what is there.
+        mEntries.clear();
+        mLiveSize = 0;
+        LogErrorOnFailure(Replay());
+        return err;
+    }
+
+    if (ShouldCompact())
+    {
+        LogErrorOnFailure(CompactLocked());
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_UNINITIALIZED);
+
+    return CompactLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::LogRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueSize)
+{
+    VerifyOrReturnError(mBatchDepth > 0, AppendRecord(type, key, value, valueSize));
+
+    std::vector<uint8_t> record;
+    EncodeRecord(type, key, value, valueSize, record);
+    mBatch.insert(mBatch.end(), record.begin(), record.end());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::AppendRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueSize)
+{
+    std::vector<uint8_t> record;
+    EncodeRecord(type, key, value, valueSize, record);
+
+    // A single append followed by a data sync; the record is only reflected in memory once it is on storage.
+    if (!WriteAll(mFd.Get(), record.data(), record.size()) || fdatasync(mFd.Get()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to append to %s: %s", mLogPath.c_str(), strerror(errno));
+
+        // Do not leave a partial record for the next append to land behind.
+        if (ftruncate(mFd.Get(), static_cast<off_t>(mLogSize)) != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to truncate %s: %s", mLogPath.c_str(), strerror(errno));
+        }
+        return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+
+    mLogSize += record.size();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CompactLocked()
+{
+    std::vector<uint8_t> contents(kLogMagic, kLogMagic + kLogMagicSize);
+    contents.reserve(kLogMagicSize + mLiveSize);
+
+    std::vector<uint8_t> record;
+    for (const auto & entry : mEntries)
+    {
+        EncodeRecord(RecordType::kPut, entry.first, entry.second.data(), entry.second.size(), record);
+        contents.insert(contents.end(), record.begin(), record.end());
+    }
+
+    std::string tmpPath = mLogPath + "-XXXXXX";
+    FileDescriptor tmpFd(mkostemp(tmpPath.data(), O_CLOEXEC));
+    VerifyOrReturnError(tmpFd.Get() >= 0, CHIP_ERROR_PERSISTED_STORAGE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to create temp file %s: %s", tmpPath.c_str(), strerror(errno)));
+
+    if (!WriteAll(tmpFd.Get(), contents.data(), contents.size()) || fdatasync(tmpFd.Get()) != 0 ||
+        rename(tmpPath.c_str(), mLogPath.c_str()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to compact %s: %s", mLogPath.c_str(), strerror(errno));
+        unlink(tmpPath.c_str());
+        return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+    SyncParentDirectory(mLogPath);
+
+    // The temporary descriptor now refers to the log; reopen it for appending.
+    mFd = FileDescriptor(open(mLogPath.c_str(), O_RDWR | O_APPEND | O_CLOEXEC));
+    VerifyOrReturnError(mFd.Get() >= 0, CHIP_ERROR_PERSISTED_STORAGE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to reopen %s: %s", mLogPath.c_str(), strerror(errno)));
+
+    ChipLogDetail(DeviceLayer, "Compacted %s from %u to %u bytes", mLogPath.c_str(), static_cast<unsigned>(mLogSize),
+                  static_cast<unsigned>(contents.size()));
+    mLogSize = contents.size();
+    return CHIP_NO_ERROR;
+}
+
+bool ChipLinuxStorageLog::ShouldCompact() const
+{
+    // Compact once more than half of the log is made of superseded or deleted records.
+    return mLogSize >= kCompactionMinLogSize && (mLogSize - kLogMagicSize) > 2 * mLiveSize;
+}
+
+size_t ChipLinuxStorageLog::RecordSize(size_t keySize, size_t valueSize)
+{
+    return kRecordHeaderSize + keySize + valueSize;
+}
+
+void ChipLinuxStorageLog::EncodeRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueSize,
+                                       std::vector<uint8_t> & out)
+{
+    out.resize(RecordSize(key.size(), valueSize));
+
+    uint8_t * p           = out.data();
+    p[kRecordCrcSize]     = static_cast<uint8_t>(type);
+    p[kRecordCrcSize + 1] = static_cast<uint8_t>(key.size());
+    Encoding::LittleEndian::Put32(p + kRecordCrcSize + 2, static_cast<uint32_t>(valueSize));
+    memcpy(p + kRecordHeaderSize, key.data(), key.size());
+    if (valueSize > 0)
+    {
+        memcpy(p + kRecordHeaderSize + key.size(), value, valueSize);
+    }
+    Encoding::LittleEndian::Put32(p, Crc32(p + kRecordCrcSize, out.size() - kRecordCrcSize));
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,117 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides a log-structured key-value store for the Linux KVS.
+ *
+ *          Every Put or Delete appends a single checksummed record to the end of the file and syncs it, instead of
+ *          rewriting the whole store. The live values are kept in memory and rebuilt by replaying the log on Init().
+ *          A record that was only partially written when the process died is detected by its checksum and truncated
+ *          away during replay. Once superseded records make up most of the file, the live values are written to a
+ *          temporary file that atomically replaces the log.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/FileDescriptor.h>
+
+#include <map>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxStorageLog
+{
+public:
+    /// Largest value accepted by Put(); also bounds record lengths accepted during replay.
+    static constexpr size_t kMaxValueSize = 64 * 1024;
+
+    /// Largest key accepted by Put().
+    static constexpr size_t kMaxKeySize = UINT8_MAX;
+
+    /// The log is not compacted before it reaches this size, no matter how much of it is garbage.
+    static constexpr size_t kCompactionMinLogSize = 16 * 1024;
+
+    CHIP_ERROR Init(const char * logFile);
+
+    /// Same contract as KeyValueStoreManager::Get().
+    CHIP_ERROR Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size, size_t offset);
+    /// Same contract as KeyValueStoreManager::Put().
+    CHIP_ERROR Put(const char * key, const void * value, size_t value_size);
+    /// Same contract as KeyValueStoreManager::Delete().
+    CHIP_ERROR Delete(const char * key);
+
+    /// Start a batch: the Puts and Deletes until the matching CommitBatch() take effect right away, but are only appended
+    /// to the log by CommitBatch(), as a single record, so that either all or none of them are replayed after a crash.
+    /// Batches nest; the outermost CommitBatch() writes the batch.
+    CHIP_ERROR BeginBatch();
+    CHIP_ERROR CommitBatch();
+
+    /// Rewrite the log so that it only holds the live values.
+    CHIP_ERROR Compact();
+
+    /// Current size of the log file, in bytes.
+    size_t GetLogSize() const { return mLogSize; }
+
+private:
+    enum class RecordType : uint8_t
+    {
+        kPut    = 1,
+        kDelete = 2,
+        kBatch  = 3,
+    };
+
+    CHIP_ERROR Replay();
+    // The size of the well-formed record at the start of `record`, or 0 if there is none within `remaining` bytes.
+    static size_t CheckRecord(const uint8_t * record, size_t remaining);
+    void ApplyRecord(const uint8_t * record);
+    bool ApplyBatch(const uint8_t * records, size_t length);
+    // Append a record to the log, or to the open batch.
+    CHIP_ERROR LogRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueSize);
+    CHIP_ERROR AppendRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueSize);
+    CHIP_ERROR CompactLocked();
+    bool ShouldCompact() const;
+    static size_t RecordSize(size_t keySize, size_t valueSize);
+    static void EncodeRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueSize,
+                             std::vector<uint8_t> & out);
+
+    std::mutex mLock;
+    std::string mLogPath;
+    FileDescriptor mFd;
+    std::map<std::string, std::vector<uint8_t>> mEntries;
+    // Size of the log file, and the size a freshly compacted log holding mEntries would have.
+    size_t mLogSize   = 0;
+    size_t mLiveSize  = 0;
+    bool mInitialized = false;
+
+    // Nesting depth of the open batch, and its records.
+    unsigned mBatchDepth = 0;
+    std::vector<uint8_t> mBatch;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
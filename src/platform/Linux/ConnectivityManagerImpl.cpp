@@ -1926,6 +1926,21 @@ CHIP_ERROR ConnectivityManagerImpl::StartWiFiScan(ByteSpan ssid, WiFiDriver::Sca
     memcpy(sInterestedSSID, ssid.data(), ssid.size());
     sInterestedSSIDLen = ssid.size();
 
+    // Results of a recent scan, for instance one made just before for another SSID, are returned without scanning again.
+    if (mWiFiScanCacheValid && mWiFiScanCacheMaxAge.count() > 0 &&
+        System::SystemClock().GetMonotonicTimestamp() - mWiFiScanCacheTime <= mWiFiScanCacheMaxAge)
+    {
+        mpScanCallback   = callback;
+        CHIP_ERROR error = DeviceLayer::SystemLayer().ScheduleLambda([this]() { _DeliverWiFiScanResults(); });
+        if (error != CHIP_NO_ERROR)
+        {
+            mpScanCallback = nullptr;
+            return error;
+        }
+        ChipLogProgress(DeviceLayer, "wpa_supplicant: using cached network scan results");
+        return CHIP_NO_ERROR;
+    }
+
     g_variant_builder_init(&builder, G_VARIANT_TYPE_VARDICT);
     g_variant_builder_add(&builder, "{sv}", "Type", g_variant_new_string("active"));
     args = g_variant_builder_end(&builder);
@@ -2213,44 +2228,30 @@ void ConnectivityManagerImpl::_OnWpaInterfaceScanDone(WpaSupplicant1Interface *
 {
     ChipLogProgress(DeviceLayer, "wpa_supplicant: network scan done");
 
-    const char * const * bsss = wpa_supplicant_1_interface_get_bsss(iface);
+    // All the networks are kept, whatever the SSID of the pending request, so that they can serve the following requests.
+    std::vector<WiFiScanResponse> * networkScanned = new std::vector<WiFiScanResponse>();
+    const char * const * bsss                      = wpa_supplicant_1_interface_get_bsss(iface);
     if (bsss == nullptr)
     {
         ChipLogProgress(DeviceLayer, "wpa_supplicant: no network found");
-        TEMPORARY_RETURN_IGNORED DeviceLayer::SystemLayer().ScheduleLambda([this]() {
-            if (mpScanCallback != nullptr)
-            {
-                mpScanCallback->OnFinished(Status::kSuccess, CharSpan(), nullptr);
-                mpScanCallback = nullptr;
-            }
-        });
-        return;
     }
-
-    std::vector<WiFiScanResponse> * networkScanned = new std::vector<WiFiScanResponse>();
     for (const char * bssPath = (bsss != nullptr ? *bsss : nullptr); bssPath != nullptr; bssPath = *(++bsss))
     {
         WiFiScanResponse network;
         if (_GetBssInfo(bssPath, network))
         {
-            if (sInterestedSSIDLen == 0 ||
-                (network.ssidLen == sInterestedSSIDLen && memcmp(network.ssid, sInterestedSSID, sInterestedSSIDLen) == 0))
-            {
-                networkScanned->push_back(network);
-            }
+            networkScanned->push_back(network);
         }
     }
 
     TEMPORARY_RETURN_IGNORED DeviceLayer::SystemLayer().ScheduleLambda([this, networkScanned]() {
         // Note: We cannot post an event in ScheduleLambda since std::vector is not trivial copyable.
-        if (mpScanCallback != nullptr)
-        {
-            LinuxScanResponseIterator<WiFiScanResponse> iter(networkScanned);
-            mpScanCallback->OnFinished(Status::kSuccess, CharSpan(), &iter);
-            mpScanCallback = nullptr;
-        }
-
+        mWiFiScanCache.swap(*networkScanned);
+        mWiFiScanCacheTime  = System::SystemClock().GetMonotonicTimestamp();
+        mWiFiScanCacheValid = true;
         delete networkScanned;
+
+        _DeliverWiFiScanResults();
     });
 
 #if CHIP_DEVICE_CONFIG_ENABLE_WIFIPAF
@@ -2258,6 +2259,25 @@ void ConnectivityManagerImpl::_OnWpaInterfaceScanDone(WpaSupplicant1Interface *
 #endif
 }
 
+void ConnectivityManagerImpl::_DeliverWiFiScanResults()
+{
+    VerifyOrReturn(mpScanCallback != nullptr);
+
+    std::vector<WiFiScanResponse> networks;
+    for (const WiFiScanResponse & network : mWiFiScanCache)
+    {
+        if (sInterestedSSIDLen == 0 ||
+            (network.ssidLen == sInterestedSSIDLen && memcmp(network.ssid, sInterestedSSID, sInterestedSSIDLen) == 0))
+        {
+            networks.push_back(network);
+        }
+    }
+
+    LinuxScanResponseIterator<WiFiScanResponse> iter(&networks);
+    mpScanCallback->OnFinished(Status::kSuccess, CharSpan(), &iter);
+    mpScanCallback = nullptr;
+}
+
 CHIP_ERROR ConnectivityManagerImpl::_StartWiFiManagement()
 {
     // When creating D-Bus proxy object, the thread default context must be initialized. Otherwise,
@@ -166,6 +166,8 @@ public:
     CHIP_ERROR GetWiFiVersion(app::Clusters::WiFiNetworkDiagnostics::WiFiVersionEnum & wiFiVersion);
     CHIP_ERROR GetConfiguredNetwork(NetworkCommissioning::Network & network);
     CHIP_ERROR StartWiFiScan(ByteSpan ssid, NetworkCommissioning::WiFiDriver::ScanCallback * callback);
+    // Results of a scan no older than maxAge are returned for the following scan requests. Zero always scans.
+    void SetWiFiScanCacheMaxAge(System::Clock::Milliseconds32 maxAge) { mWiFiScanCacheMaxAge = maxAge; }
 
 private:
     bool _IsWiFiInterfaceEnabled() CHIP_REQUIRES(mWpaSupplicantMutex);
@@ -235,6 +237,7 @@ private:
     void _OnWpaInterfaceAdded(WpaSupplicant1 * proxy, const char * path, GVariant * properties);
     void _OnWpaPropertiesChanged(WpaSupplicant1Interface * iface, GVariant * properties);
     void _OnWpaInterfaceScanDone(WpaSupplicant1Interface * iface, gboolean success);
+    void _DeliverWiFiScanResults();
     void _OnWpaInterfaceReady(GObject * sourceObject, GAsyncResult * res);
     void _OnWpaInterfaceProxyReady(GObject * sourceObject, GAsyncResult * res);
     CHIP_ERROR StartWiFiManagementSync();
@@ -300,6 +303,11 @@ private:
 #if CHIP_DEVICE_CONFIG_ENABLE_WPA
     uint8_t sInterestedSSID[Internal::kMaxWiFiSSIDLength];
     uint8_t sInterestedSSIDLen;
+    // Every network of the last scan, filtered by SSID when delivered to the scan callback.
+    std::vector<NetworkCommissioning::WiFiScanResponse> mWiFiScanCache;
+    System::Clock::Timestamp mWiFiScanCacheTime;
+    System::Clock::Milliseconds32 mWiFiScanCacheMaxAge{ CHIP_DEVICE_CONFIG_WIFI_SCAN_CACHE_MAX_AGE };
+    bool mWiFiScanCacheValid = false;
 #endif
     NetworkCommissioning::WiFiDriver::ScanCallback * mpScanCallback;
     NetworkCommissioning::Internal::WirelessDriver::ConnectCallback * mpConnectCallback;
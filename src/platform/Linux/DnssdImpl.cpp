@@ -348,6 +348,7 @@ exit:
 void MdnsAvahi::Shutdown()
 {
     TEMPORARY_RETURN_IGNORED StopPublish();
+    FreeAllBrowsesAndResolves();
     if (mClient)
     {
         avahi_client_free(mClient);
@@ -355,6 +356,27 @@ void MdnsAvahi::Shutdown()
     }
 }
 
+void MdnsAvahi::FreeAllBrowsesAndResolves()
+{
+    // Nothing is called back: this only happens when the Avahi client, and every object created from it, goes away.
+    for (auto browser : mSharedBrowsers)
+    {
+        for (auto context : browser->mSubscribers)
+        {
+            chip::Platform::Delete(context);
+        }
+        avahi_service_browser_free(browser->mBrowser);
+        chip::Platform::Delete(browser);
+    }
+    mSharedBrowsers.clear();
+
+    for (auto context : mAllocatedResolves)
+    {
+        chip::Platform::Delete(context);
+    }
+    mAllocatedResolves.clear();
+}
+
 CHIP_ERROR MdnsAvahi::SetHostname(const char * hostname)
 {
     CHIP_ERROR error = CHIP_NO_ERROR;
@@ -599,52 +621,128 @@ CHIP_ERROR MdnsAvahi::Browse(const char * type, DnssdServiceProtocol protocol, c
                              chip::Inet::InterfaceId interface, DnssdBrowseCallback callback, void * context,
                              intptr_t * browseIdentifier)
 {
-    AvahiServiceBrowser * browser;
-    BrowseContext * browseContext = chip::Platform::New<BrowseContext>();
-    AvahiIfIndex avahiInterface   = static_cast<AvahiIfIndex>(interface.GetPlatformInterface());
+    AvahiIfIndex avahiInterface = static_cast<AvahiIfIndex>(interface.GetPlatformInterface());
+    std::string fullType        = GetFullType(type, protocol);
+    SharedBrowser * browser     = nullptr;
+    BrowseContext * browseContext;
 
-    browseContext->mInstance    = this;
-    browseContext->mContext     = context;
-    browseContext->mCallback    = callback;
-    browseContext->mAddressType = addressType;
+    *browseIdentifier = reinterpret_cast<intptr_t>(nullptr);
     if (!interface.IsPresent())
     {
         avahiInterface = AVAHI_IF_UNSPEC;
     }
-    browseContext->mInterface         = avahiInterface;
-    browseContext->mProtocol          = GetFullType(type, protocol);
-    browseContext->mReceivedAllCached = false;
-    browseContext->mStopped.store(false);
-
-    browser = avahi_service_browser_new(mClient, avahiInterface, AVAHI_PROTO_UNSPEC, browseContext->mProtocol.c_str(), nullptr,
-                                        static_cast<AvahiLookupFlags>(0), HandleBrowse, browseContext);
-    // Otherwise the browser will be freed in the callback
+
+    for (auto it : mSharedBrowsers)
+    {
+        if (it->mInterface == avahiInterface && it->mProtocol == fullType)
+        {
+            browser = it;
+            break;
+        }
+    }
+
     if (browser == nullptr)
     {
-        chip::Platform::Delete(browseContext);
-        *browseIdentifier = reinterpret_cast<intptr_t>(nullptr);
+        browser = chip::Platform::New<SharedBrowser>();
+        VerifyOrReturnError(browser != nullptr, CHIP_ERROR_NO_MEMORY);
+        browser->mInstance  = this;
+        browser->mProtocol  = std::move(fullType);
+        browser->mInterface = avahiInterface;
+        browser->mBrowser   = avahi_service_browser_new(mClient, avahiInterface, AVAHI_PROTO_UNSPEC, browser->mProtocol.c_str(),
+                                                        nullptr, static_cast<AvahiLookupFlags>(0), HandleBrowse, browser);
+        // Otherwise the browser will be freed once its last browse is stopped
+        if (browser->mBrowser == nullptr)
+        {
+            chip::Platform::Delete(browser);
+            return CHIP_ERROR_INTERNAL;
+        }
+        mSharedBrowsers.push_back(browser);
     }
-    else
+
+    browseContext = chip::Platform::New<BrowseContext>();
+    if (browseContext == nullptr)
+    {
+        // Frees the browser if it was just created.
+        ReleaseStoppedBrowses(browser);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+    browseContext->mNumber      = mBrowseCount++;
+    browseContext->mBrowser     = browser;
+    browseContext->mCallback    = callback;
+    browseContext->mContext     = context;
+    browseContext->mAddressType = addressType;
+    browser->mSubscribers.push_back(browseContext);
+
+    if (browser->mReceivedAllCached)
     {
-        *browseIdentifier = reinterpret_cast<intptr_t>(browseContext);
+        // The browser will not report the services it has already found again, so hand them over from its cache, once
+        // the caller has its browse identifier.
+        intptr_t handle  = browseContext->mNumber;
+        CHIP_ERROR error = DeviceLayer::SystemLayer().ScheduleLambda([this, handle] { DeliverCachedServices(handle); });
+        if (error != CHIP_NO_ERROR)
+        {
+            browseContext->mStopped.store(true);
+            ReleaseStoppedBrowses(browser);
+            return error;
+        }
     }
 
-    return browser == nullptr ? CHIP_ERROR_INTERNAL : CHIP_NO_ERROR;
+    *browseIdentifier = browseContext->mNumber;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR MdnsAvahi::StopBrowse(intptr_t browseIdentifier)
 {
-    BrowseContext * browseContext = reinterpret_cast<BrowseContext *>(browseIdentifier);
+    BrowseContext * browseContext = BrowseContextForHandle(browseIdentifier);
     if (browseContext == nullptr)
     {
         return CHIP_ERROR_NOT_FOUND;
     }
-    // Any running timers here will check mStopped before rescheduling. Leave the timer running
-    // so we don't race on deletion of the browse context.
+    // If the browser is calling its browses back, the context is only freed once it is done.
     browseContext->mStopped.store(true);
+    ReleaseStoppedBrowses(browseContext->mBrowser);
     return CHIP_NO_ERROR;
 }
 
+MdnsAvahi::BrowseContext * MdnsAvahi::BrowseContextForHandle(intptr_t handle)
+{
+    for (auto browser : mSharedBrowsers)
+    {
+        for (auto context : browser->mSubscribers)
+        {
+            if (context->mNumber == handle)
+            {
+                return context;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void MdnsAvahi::ReleaseStoppedBrowses(SharedBrowser * browser)
+{
+    if (browser->mDispatchDepth > 0)
+    {
+        return;
+    }
+
+    browser->mSubscribers.remove_if([](BrowseContext * context) {
+        if (!context->mStopped.load())
+        {
+            return false;
+        }
+        chip::Platform::Delete(context);
+        return true;
+    });
+
+    if (browser->mSubscribers.empty())
+    {
+        avahi_service_browser_free(browser->mBrowser);
+        mSharedBrowsers.remove(browser);
+        chip::Platform::Delete(browser);
+    }
+}
+
 DnssdServiceProtocol GetProtocolInType(const char * type)
 {
     const char * deliminator = strrchr(type, '.');
@@ -686,108 +784,135 @@ void CopyTypeWithoutProtocol(char (&dest)[N], const char * typeAndProtocol)
     }
 }
 
-void MdnsAvahi::InvokeDelegateOrCleanUp(BrowseContext * context, AvahiServiceBrowser * browser)
+DnssdService BrowsedService(AvahiIfIndex interface, AvahiProtocol protocol, const char * name, const char * type)
 {
-    // If we were already asked to stop, no need to send a callback - no one is listening.
-    if (!context->mStopped.load())
+    DnssdService service = {};
+
+    Platform::CopyString(service.mName, name);
+    CopyTypeWithoutProtocol(service.mType, type);
+    service.mProtocol      = GetProtocolInType(type);
+    service.mTransportType = ToAddressType(protocol);
+    service.mInterface     = Inet::InterfaceId::Null();
+    if (interface != AVAHI_IF_UNSPEC)
     {
-        // since this is continuous browse, finalBrowse will always be false.
-        context->mCallback(context->mContext, context->mServices.data(), context->mServices.size(), false, CHIP_NO_ERROR);
+        service.mInterface = static_cast<chip::Inet::InterfaceId>(interface);
+    }
+    service.mType[kDnssdTypeMaxSize] = 0;
+    return service;
+}
 
-        // Clearing records/services already passed to application through delegate. Keeping it may cause
-        // duplicates in next query / retry attempt as currently found will also come again from cache.
-        context->mServices.clear();
+void MdnsAvahi::DeliverServices(BrowseContext * context, const DnssdService * services, size_t count, bool removed)
+{
+    std::vector<DnssdService> delivered(services, services + count);
+
+    for (auto & service : delivered)
+    {
+        service.mAddressType = context->mAddressType;
+        if (removed)
+        {
+            service.mTtlSeconds = 0;
+        }
     }
-    else
+
+    // since this is continuous browse, finalBrowse will always be false.
+    context->mCallback(context->mContext, delivered.data(), delivered.size(), false, CHIP_NO_ERROR);
+}
+
+void MdnsAvahi::DeliverCachedServices(intptr_t handle)
+{
+    BrowseContext * context = BrowseContextForHandle(handle);
+
+    // The browse may have been stopped, or have got the services from an "all for now" event, in the meantime.
+    if (context == nullptr || context->mStopped.load() || context->mReceivedAllCached)
     {
-        // browse is stopped, so free browse handle and context
-        avahi_service_browser_free(browser);
-        chip::Platform::Delete(context);
+        return;
     }
+
+    SharedBrowser * browser     = context->mBrowser;
+    context->mReceivedAllCached = true;
+    browser->mDispatchDepth++;
+    DeliverServices(context, browser->mServices.data(), browser->mServices.size(), false);
+    browser->mDispatchDepth--;
+    ReleaseStoppedBrowses(browser);
 }
 
-void MdnsAvahi::HandleBrowse(AvahiServiceBrowser * browser, AvahiIfIndex interface, AvahiProtocol protocol, AvahiBrowserEvent event,
-                             const char * name, const char * type, const char * domain, AvahiLookupResultFlags /*flags*/,
-                             void * userdata)
+void MdnsAvahi::HandleBrowse(AvahiServiceBrowser * /*avahiBrowser*/, AvahiIfIndex interface, AvahiProtocol protocol,
+                             AvahiBrowserEvent event, const char * name, const char * type, const char * domain,
+                             AvahiLookupResultFlags /*flags*/, void * userdata)
 {
-    BrowseContext * context = static_cast<BrowseContext *>(userdata);
+    SharedBrowser * browser = static_cast<SharedBrowser *>(userdata);
+    // Browses may be stopped or started from the callbacks, so go through the ones there were when the event came in.
+    // Stopped ones are only freed once all of them have been called back.
+    std::vector<BrowseContext *> subscribers(browser->mSubscribers.begin(), browser->mSubscribers.end());
 
+    browser->mDispatchDepth++;
     switch (event)
     {
     case AVAHI_BROWSER_FAILURE:
-        context->mCallback(context->mContext, nullptr, 0, true, CHIP_ERROR_INTERNAL);
-        avahi_service_browser_free(browser);
-        chip::Platform::Delete(context);
+        // Browses started from now on, including from the callbacks below, get a new browser.  This one is freed below,
+        // as all its browses are stopped.
+        browser->mInstance->mSharedBrowsers.remove(browser);
+        for (auto context : subscribers)
+        {
+            if (!context->mStopped.exchange(true))
+            {
+                context->mCallback(context->mContext, nullptr, 0, true, CHIP_ERROR_INTERNAL);
+            }
+        }
         break;
     case AVAHI_BROWSER_NEW:
         ChipLogProgress(DeviceLayer, "Avahi browse: cache new");
-        if (context->mStopped.load())
-        {
-            // browse is stopped, so free browse handle and context
-            avahi_service_browser_free(browser);
-            chip::Platform::Delete(context);
-            break;
-        }
         if (strcmp("local", domain) == 0)
         {
-            DnssdService service = {};
-
-            Platform::CopyString(service.mName, name);
-            CopyTypeWithoutProtocol(service.mType, type);
-            service.mProtocol      = GetProtocolInType(type);
-            service.mAddressType   = context->mAddressType;
-            service.mTransportType = ToAddressType(protocol);
-            service.mInterface     = Inet::InterfaceId::Null();
-            if (interface != AVAHI_IF_UNSPEC)
-            {
-                service.mInterface = static_cast<chip::Inet::InterfaceId>(interface);
-            }
-            service.mType[kDnssdTypeMaxSize] = 0;
-            context->mServices.push_back(service);
-            if (context->mReceivedAllCached)
+            DnssdService service = BrowsedService(interface, protocol, name, type);
+
+            browser->mServices.push_back(service);
+            for (auto context : subscribers)
             {
-                InvokeDelegateOrCleanUp(context, browser);
+                if (context->mReceivedAllCached && !context->mStopped.load())
+                {
+                    DeliverServices(context, &service, 1, false);
+                }
             }
         }
         break;
     case AVAHI_BROWSER_ALL_FOR_NOW: {
         ChipLogProgress(DeviceLayer, "Avahi browse: all for now");
-        context->mReceivedAllCached = true;
+        browser->mReceivedAllCached = true;
 
-        InvokeDelegateOrCleanUp(context, browser);
+        // Copied, since the callbacks may change the cache through a browse of their own.
+        std::vector<DnssdService> services = browser->mServices;
+        for (auto context : subscribers)
+        {
+            if (!context->mReceivedAllCached && !context->mStopped.load())
+            {
+                context->mReceivedAllCached = true;
+                DeliverServices(context, services.data(), services.size(), false);
+            }
+        }
         break;
     }
     case AVAHI_BROWSER_REMOVE:
         ChipLogProgress(DeviceLayer, "Avahi browse: remove");
         if (strcmp("local", domain) == 0)
         {
-            // don't attempt to erase if vector has been cleared
-            if (context->mServices.size())
-            {
-                context->mServices.erase(std::remove_if(
-                    context->mServices.begin(), context->mServices.end(), [name, type](const DnssdService & service) {
-                        return strcmp(name, service.mName) == 0 && type == GetFullType(service.mType, service.mProtocol);
-                    }));
-            }
-
-            if (context->mReceivedAllCached)
+            DnssdService service = BrowsedService(interface, protocol, name, type);
+            auto & services      = browser->mServices;
+
+            auto isRemoved = [&service](const DnssdService & cached) {
+                return strcmp(cached.mName, service.mName) == 0 && strcmp(cached.mType, service.mType) == 0 &&
+                    cached.mProtocol == service.mProtocol && cached.mInterface == service.mInterface &&
+                    cached.mTransportType == service.mTransportType;
+            };
+            services.erase(std::remove_if(services.begin(), services.end(), isRemoved), services.end());
+
+            // Browses that have not got the services found so far yet will not see this one.
+            for (auto context : subscribers)
             {
-                DnssdService service = {};
-
-                Platform::CopyString(service.mName, name);
-                CopyTypeWithoutProtocol(service.mType, type);
-                service.mProtocol      = GetProtocolInType(type);
-                service.mAddressType   = context->mAddressType;
-                service.mTransportType = ToAddressType(protocol);
-                service.mInterface     = Inet::InterfaceId::Null();
-                if (interface != AVAHI_IF_UNSPEC)
+                if (context->mReceivedAllCached && !context->mStopped.load())
                 {
-                    service.mInterface = static_cast<chip::Inet::InterfaceId>(interface);
+                    DeliverServices(context, &service, 1, true);
                 }
-                service.mTtlSeconds = 0;
-
-                context->mServices.push_back(service);
-                InvokeDelegateOrCleanUp(context, browser);
             }
         }
 
@@ -796,6 +921,9 @@ void MdnsAvahi::HandleBrowse(AvahiServiceBrowser * browser, AvahiIfIndex interfa
         ChipLogProgress(DeviceLayer, "Avahi browse: cache exhausted");
         break;
     }
+    browser->mDispatchDepth--;
+
+    browser->mInstance->ReleaseStoppedBrowses(browser);
 }
 
 MdnsAvahi::ResolveContext * MdnsAvahi::AllocateResolveContext()
@@ -837,59 +965,142 @@ void MdnsAvahi::FreeResolveContext(size_t handle)
     }
 }
 
+CHIP_ERROR MdnsAvahi::StartResolver(ResolveContext * context)
+{
+    context->mResolver =
+        avahi_service_resolver_new(mClient, context->mInterface, context->mTransport, context->mName, context->mFullType.c_str(),
+                                   nullptr, context->mAddressType, static_cast<AvahiLookupFlags>(0), HandleResolve,
+                                   reinterpret_cast<void *>(context->mNumber));
+    // Otherwise the resolver will be freed in the callback
+    return context->mResolver == nullptr ? CHIP_ERROR_INTERNAL : CHIP_NO_ERROR;
+}
+
+void MdnsAvahi::StartPendingResolves()
+{
+    // Completing a resolve that cannot be started calls its requesters, which may start or stop resolves, so look at
+    // the list afresh every time.
+    while (true)
+    {
+        size_t running           = 0;
+        ResolveContext * pending = nullptr;
+
+        for (auto context : mAllocatedResolves)
+        {
+            if (context->mResolver != nullptr)
+            {
+                running++;
+            }
+            else if (pending == nullptr)
+            {
+                pending = context;
+            }
+        }
+
+        if (pending == nullptr || running >= kMaxConcurrentResolves)
+        {
+            return;
+        }
+
+        if (StartResolver(pending) != CHIP_NO_ERROR)
+        {
+            ChipLogError(Discovery, "Failed to start queued resolve");
+            CompleteResolve(pending, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_INTERNAL);
+        }
+    }
+}
+
+void MdnsAvahi::CompleteResolve(ResolveContext * context, DnssdService * result, const Span<Inet::IPAddress> & addresses,
+                                CHIP_ERROR error)
+{
+    // Taken out of the list first, as the requesters may start or stop resolves from their callbacks.
+    mAllocatedResolves.remove(context);
+
+    for (auto & requester : context->mRequesters)
+    {
+        requester.mCallback(requester.mContext, result, addresses, error);
+    }
+
+    chip::Platform::Delete(context);
+}
+
 void MdnsAvahi::StopResolve(const char * name)
 {
-    auto truncate_end = std::remove_if(mAllocatedResolves.begin(), mAllocatedResolves.end(),
-                                       [name](ResolveContext * ctx) { return strcmp(ctx->mName, name) == 0; });
+    std::vector<ResolveContext *> stopped;
+
+    for (auto context : mAllocatedResolves)
+    {
+        if (strcmp(context->mName, name) == 0)
+        {
+            stopped.push_back(context);
+        }
+    }
 
-    for (auto it = truncate_end; it != mAllocatedResolves.end(); it++)
+    for (auto context : stopped)
     {
-        (*it)->mCallback((*it)->mContext, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_CANCELLED);
-        chip::Platform::Delete(*it);
+        // An earlier callback may have stopped it already.
+        if (std::find(mAllocatedResolves.begin(), mAllocatedResolves.end(), context) != mAllocatedResolves.end())
+        {
+            CompleteResolve(context, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_CANCELLED);
+        }
     }
 
-    mAllocatedResolves.erase(truncate_end, mAllocatedResolves.end());
+    StartPendingResolves();
 }
 
 CHIP_ERROR MdnsAvahi::Resolve(const char * name, const char * type, DnssdServiceProtocol protocol, Inet::IPAddressType addressType,
                               Inet::IPAddressType transportType, Inet::InterfaceId interface, DnssdResolveCallback callback,
                               void * context)
 {
-    AvahiIfIndex avahiInterface     = static_cast<AvahiIfIndex>(interface.GetPlatformInterface());
+    AvahiIfIndex avahiInterface    = static_cast<AvahiIfIndex>(interface.GetPlatformInterface());
+    AvahiProtocol transport        = ToAvahiProtocol(transportType);
+    AvahiProtocol avahiAddressType = ToAvahiProtocol(addressType);
+    std::string fullType           = GetFullType(type, protocol);
+    size_t running                 = 0;
+
+    if (!interface.IsPresent())
+    {
+        avahiInterface = AVAHI_IF_UNSPEC;
+    }
+
+    // A resolve of the same service that is running or waiting answers this one too.
+    for (auto it : mAllocatedResolves)
+    {
+        if (strcmp(it->mName, name) == 0 && it->mFullType == fullType && it->mInterface == avahiInterface &&
+            it->mTransport == transport && it->mAddressType == avahiAddressType)
+        {
+            it->mRequesters.push_back(ResolveRequester{ callback, context });
+            return CHIP_NO_ERROR;
+        }
+        running += (it->mResolver != nullptr) ? 1 : 0;
+    }
+
     ResolveContext * resolveContext = AllocateResolveContext();
     if (resolveContext == nullptr)
     {
         ChipLogError(Discovery, "Failed to allocate resolve context");
         return CHIP_ERROR_NO_MEMORY;
     }
-    CHIP_ERROR error          = CHIP_NO_ERROR;
     resolveContext->mInstance = this;
-    resolveContext->mCallback = callback;
-    resolveContext->mContext  = context;
-
-    if (!interface.IsPresent())
-    {
-        avahiInterface = AVAHI_IF_UNSPEC;
-    }
+    resolveContext->mRequesters.push_back(ResolveRequester{ callback, context });
 
     Platform::CopyString(resolveContext->mName, name);
     resolveContext->mInterface   = avahiInterface;
-    resolveContext->mTransport   = ToAvahiProtocol(transportType);
-    resolveContext->mAddressType = ToAvahiProtocol(addressType);
-    resolveContext->mFullType    = GetFullType(type, protocol);
-
-    resolveContext->mResolver =
-        avahi_service_resolver_new(mClient, avahiInterface, resolveContext->mTransport, name, resolveContext->mFullType.c_str(),
-                                   nullptr, resolveContext->mAddressType, static_cast<AvahiLookupFlags>(0), HandleResolve,
-                                   reinterpret_cast<void *>(resolveContext->mNumber));
-    // Otherwise the resolver will be freed in the callback
-    if (resolveContext->mResolver == nullptr)
+    resolveContext->mTransport   = transport;
+    resolveContext->mAddressType = avahiAddressType;
+    resolveContext->mFullType    = std::move(fullType);
+
+    // Otherwise the resolve is started by StartPendingResolves once another one is done.
+    if (running < kMaxConcurrentResolves)
     {
-        error = CHIP_ERROR_INTERNAL;
-        FreeResolveContext(resolveContext->mNumber);
+        CHIP_ERROR error = StartResolver(resolveContext);
+        if (error != CHIP_NO_ERROR)
+        {
+            FreeResolveContext(resolveContext->mNumber);
+            return error;
+        }
     }
 
-    return error;
+    return CHIP_NO_ERROR;
 }
 
 void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex interface, AvahiProtocol protocol,
@@ -914,19 +1125,16 @@ void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex inte
         {
             ChipLogProgress(DeviceLayer, "Re-trying resolve");
             avahi_service_resolver_free(resolver);
-            context->mResolver = avahi_service_resolver_new(
-                context->mInstance->mClient, context->mInterface, context->mTransport, context->mName, context->mFullType.c_str(),
-                nullptr, context->mAddressType, static_cast<AvahiLookupFlags>(0), HandleResolve, userdata);
-            if (context->mResolver == nullptr)
+            if (sInstance.StartResolver(context) != CHIP_NO_ERROR)
             {
                 ChipLogError(DeviceLayer, "Avahi resolve failed on retry");
-                context->mCallback(context->mContext, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_INTERNAL);
-                sInstance.FreeResolveContext(handle);
+                sInstance.CompleteResolve(context, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_INTERNAL);
+                sInstance.StartPendingResolves();
             }
             return;
         }
         ChipLogError(DeviceLayer, "Avahi resolve failed");
-        context->mCallback(context->mContext, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_INTERNAL);
+        sInstance.CompleteResolve(context, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_INTERNAL);
         break;
     case AVAHI_RESOLVER_FOUND:
         DnssdService result = {};
@@ -1004,16 +1212,16 @@ void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex inte
 
         if (result_err == CHIP_NO_ERROR)
         {
-            context->mCallback(context->mContext, &result, Span<Inet::IPAddress>(&ipAddress, 1), CHIP_NO_ERROR);
+            sInstance.CompleteResolve(context, &result, Span<Inet::IPAddress>(&ipAddress, 1), CHIP_NO_ERROR);
         }
         else
         {
-            context->mCallback(context->mContext, nullptr, Span<Inet::IPAddress>(), result_err);
+            sInstance.CompleteResolve(context, nullptr, Span<Inet::IPAddress>(), result_err);
         }
         break;
     }
 
-    sInstance.FreeResolveContext(handle);
+    sInstance.StartPendingResolves();
 }
 
 CHIP_ERROR ChipDnssdInit(DnssdAsyncReturnCallback initCallback, DnssdAsyncReturnCallback errorCallback, void * context)
@@ -124,33 +124,55 @@ public:
     static MdnsAvahi & GetInstance() { return sInstance; }
 
 private:
+    struct SharedBrowser;
+
     struct BrowseContext
     {
-        MdnsAvahi * mInstance;
+        intptr_t mNumber; // unique number for this context, used as the browse identifier
+        SharedBrowser * mBrowser;
         DnssdBrowseCallback mCallback;
         void * mContext;
         Inet::IPAddressType mAddressType;
-        std::vector<DnssdService> mServices;
-        bool mReceivedAllCached;
-        AvahiIfIndex mInterface;
-        std::string mProtocol;
+        // Whether the services found so far have been delivered, after which updates are delivered as they come.
+        bool mReceivedAllCached = false;
         std::atomic_bool mStopped{ false };
-        AvahiServiceBrowser * mBrowser;
     };
 
-    struct ResolveContext
+    // A single Avahi browser for a service type and interface, shared by all the browses of that type, together with
+    // the services it currently sees.  A browse started while another one of the same type is running gets the
+    // services found so far without another round trip to the daemon.
+    struct SharedBrowser
     {
-        size_t mNumber; // unique number for this context
         MdnsAvahi * mInstance;
+        std::string mProtocol;
+        AvahiIfIndex mInterface;
+        AvahiServiceBrowser * mBrowser = nullptr;
+        bool mReceivedAllCached        = false;
+        // Non-zero while subscriber callbacks run, during which stopped subscribers are not freed.
+        unsigned mDispatchDepth = 0;
+        std::vector<DnssdService> mServices;
+        std::list<BrowseContext *> mSubscribers;
+    };
+
+    struct ResolveRequester
+    {
         DnssdResolveCallback mCallback;
         void * mContext;
+    };
+
+    struct ResolveContext
+    {
+        size_t mNumber; // unique number for this context
+        MdnsAvahi * mInstance;
+        // Resolves of the same service share one context and one Avahi resolver.
+        std::vector<ResolveRequester> mRequesters;
         char mName[Common::kInstanceNameMaxLength + 1];
         AvahiIfIndex mInterface;
         AvahiProtocol mTransport;
         AvahiProtocol mAddressType;
         std::string mFullType;
         uint8_t mAttempts                = 0;
-        AvahiServiceResolver * mResolver = nullptr;
+        AvahiServiceResolver * mResolver = nullptr; // nullptr while the resolve waits for a free slot
 
         ~ResolveContext()
         {
@@ -170,7 +192,23 @@ private:
 
     ResolveContext * ResolveContextForHandle(size_t handle);
     void FreeResolveContext(size_t handle);
-    void FreeResolveContext(const char * name);
+
+    // Creates the Avahi resolver of a context.
+    CHIP_ERROR StartResolver(ResolveContext * context);
+    // Starts waiting resolves while fewer than kMaxConcurrentResolves are running.
+    void StartPendingResolves();
+    // Removes a context from the allocated resolves, calls its requesters back and frees it.
+    void CompleteResolve(ResolveContext * context, DnssdService * result, const Span<Inet::IPAddress> & addresses,
+                         CHIP_ERROR error);
+
+    BrowseContext * BrowseContextForHandle(intptr_t handle);
+    // Calls a subscriber back with services of its shared browser, removed ones with a zero TTL.
+    static void DeliverServices(BrowseContext * context, const DnssdService * services, size_t count, bool removed);
+    // Delivers the services found so far to a browse that joined a running shared browser.
+    void DeliverCachedServices(intptr_t handle);
+    // Frees the stopped subscribers of a browser, and the browser when none is left.
+    void ReleaseStoppedBrowses(SharedBrowser * browser);
+    void FreeAllBrowsesAndResolves();
 
     static void HandleClientState(AvahiClient * client, AvahiClientState state, void * context);
     void HandleClientState(AvahiClient * client, AvahiClientState state);
@@ -181,7 +219,6 @@ private:
     static void HandleBrowse(AvahiServiceBrowser * broswer, AvahiIfIndex interface, AvahiProtocol protocol, AvahiBrowserEvent event,
                              const char * name, const char * type, const char * domain, AvahiLookupResultFlags flags,
                              void * userdata);
-    static void InvokeDelegateOrCleanUp(BrowseContext * context, AvahiServiceBrowser * browser);
     static void HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex interface, AvahiProtocol protocol,
                               AvahiResolverEvent event, const char * name, const char * type, const char * domain,
                               const char * host_name, const AvahiAddress * address, uint16_t port, AvahiStringList * txt,
@@ -195,10 +232,17 @@ private:
     std::map<std::string, AvahiEntryGroup *> mPublishedGroups;
     Poller mPoller;
     static constexpr size_t kMaxBrowseRetries = 4;
+    // Resolves beyond this wait for a running one to finish, so that a controller resolving many nodes at once does
+    // not flood the daemon with resolvers.
+    static constexpr size_t kMaxConcurrentResolves = 16;
 
-    // Handling of allocated resolves
+    // Handling of allocated resolves, in the order they were requested
     size_t mResolveCount = 0;
     std::list<ResolveContext *> mAllocatedResolves;
+
+    // Handling of browses. Identifiers start at 1, since 0 is returned when a browse could not be started.
+    intptr_t mBrowseCount = 1;
+    std::list<SharedBrowser *> mSharedBrowsers;
 };
 
 } // namespace Dnssd
@@ -46,3 +46,11 @@
 
 // On linux platform, we have sys/socket.h, so HAVE_SO_BINDTODEVICE should be set to 1
 #define HAVE_SO_BINDTODEVICE 1
+
+#ifndef INET_CONFIG_UDP_SOCKET_RECVMMSG
+#define INET_CONFIG_UDP_SOCKET_RECVMMSG 1
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG
+
+#ifndef INET_CONFIG_CACHE_INTERFACES
+#define INET_CONFIG_CACHE_INTERFACES 1
+#endif // INET_CONFIG_CACHE_INTERFACES
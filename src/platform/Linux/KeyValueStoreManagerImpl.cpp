@@ -28,7 +28,6 @@
 
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
-#include <platform/Linux/CHIPLinuxStorage.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -36,6 +35,36 @@ namespace PersistedStorage {
 
 KeyValueStoreManagerImpl KeyValueStoreManagerImpl::sInstance;
 
+#if CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
+                                          size_t offset_bytes)
+{
+    return mStorage.Get(key, value, value_size, read_bytes_size, offset_bytes);
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value, size_t value_size)
+{
+    return mStorage.Put(key, value, value_size);
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
+{
+    return mStorage.Delete(key);
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_BeginBatch()
+{
+    return mStorage.BeginBatch();
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_CommitBatch()
+{
+    return mStorage.CommitBatch();
+}
+
+#else // CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS
+
 CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
                                           size_t offset_bytes)
 {
@@ -83,6 +112,12 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value,
     err = mStorage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), value_size);
     SuccessOrExit(err);
 
+    if (mBatchDepth > 0)
+    {
+        mBatchDirty = true;
+        ExitNow();
+    }
+
     // Commit the value to the persistent store.
     err = mStorage.Commit();
     SuccessOrExit(err);
@@ -102,6 +137,12 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
     }
     SuccessOrExit(err);
 
+    if (mBatchDepth > 0)
+    {
+        mBatchDirty = true;
+        ExitNow();
+    }
+
     // Commit the value to the persistent store.
     err = mStorage.Commit();
     SuccessOrExit(err);
@@ -110,6 +151,27 @@ exit:
     return err;
 }
 
+CHIP_ERROR KeyValueStoreManagerImpl::_BeginBatch()
+{
+    if (mBatchDepth++ == 0)
+    {
+        mBatchDirty = false;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_CommitBatch()
+{
+    VerifyOrReturnError(mBatchDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(--mBatchDepth == 0 && mBatchDirty, CHIP_NO_ERROR);
+
+    // The file is replaced as a whole, so all the changes of the batch are committed at once.
+    mBatchDirty = false;
+    return mStorage.Commit();
+}
+
+#endif // CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
@@ -23,7 +23,11 @@
 
 #pragma once
 
+#if CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+#else
 #include <platform/Linux/CHIPLinuxStorage.h>
+#endif
 
 namespace chip {
 namespace DeviceLayer {
@@ -41,10 +45,20 @@ public:
     CHIP_ERROR _Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size = nullptr, size_t offset = 0);
     CHIP_ERROR _Delete(const char * key);
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
+    CHIP_ERROR _BeginBatch();
+    CHIP_ERROR _CommitBatch();
 
 private:
+#if CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS
+    DeviceLayer::Internal::ChipLinuxStorageLog mStorage;
+#else
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
 
+    // While a batch is open, changes are only committed to the file when it ends.
+    unsigned mBatchDepth = 0;
+    bool mBatchDirty     = false;
+#endif
+
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
     friend KeyValueStoreManagerImpl & KeyValueStoreMgrImpl();
@@ -21,7 +21,11 @@
 
 #include "OTAImageProcessorImpl.h"
 
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 namespace chip {
 
@@ -59,7 +63,7 @@ CHIP_ERROR OTAImageProcessorImpl::Abort()
 
 CHIP_ERROR OTAImageProcessorImpl::ProcessBlock(ByteSpan & block)
 {
-    if (!mOfs.is_open() || !mOfs.good())
+    if (mFd < 0)
     {
         return CHIP_ERROR_INTERNAL;
     }
@@ -125,8 +129,10 @@ void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
     imageProcessor->mParams.downloadedBytes = 0;
     imageProcessor->mParams.totalFileBytes  = 0;
     imageProcessor->mHeaderParser.Init();
-    imageProcessor->mOfs.open(imageProcessor->mImageFile, std::ofstream::out | std::ofstream::ate | std::ofstream::app);
-    if (!imageProcessor->mOfs.good())
+    imageProcessor->mImageValid     = false;
+    imageProcessor->mHasImageDigest = false;
+    imageProcessor->mIsDelta        = false;
+    if (imageProcessor->StartWriter() != CHIP_NO_ERROR)
     {
         TEMPORARY_RETURN_IGNORED imageProcessor->mDownloader->OnPreparedForDownload(CHIP_ERROR_OPEN_FAILED);
         return;
@@ -143,9 +149,28 @@ void OTAImageProcessorImpl::HandleFinalize(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
+    CHIP_ERROR error = imageProcessor->StopWriter(/* flush = */ true);
     TEMPORARY_RETURN_IGNORED imageProcessor->ReleaseBlock();
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot write OTA image: %" CHIP_ERROR_FORMAT, error.Format());
+        unlink(imageProcessor->mImageFile);
+        return;
+    }
+    if (!imageProcessor->VerifyImageDigest())
+    {
+        ChipLogError(SoftwareUpdate, "OTA image digest does not match the image header");
+        unlink(imageProcessor->mImageFile);
+        return;
+    }
+    if (!imageProcessor->VerifyPatchedImage())
+    {
+        ChipLogError(SoftwareUpdate, "Patched OTA image does not match the delta image header");
+        unlink(imageProcessor->mImageFile);
+        return;
+    }
 
+    imageProcessor->mImageValid = true;
     ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s", imageProcessor->mImageFile);
 }
 
@@ -157,6 +182,13 @@ void OTAImageProcessorImpl::HandleApply(intptr_t context)
     OTARequestorInterface * requestor = chip::GetRequestorInstance();
     VerifyOrReturn(requestor != nullptr);
 
+    if (!imageProcessor->mImageValid)
+    {
+        ChipLogError(SoftwareUpdate, "No valid OTA image to apply");
+        return;
+    }
+
+    // The image was written out and synced by HandleFinalize, so applying it is only a rename.
     // Move the downloaded image to the location where the new image is to be executed from
     unlink(kImageExecPath);
     rename(imageProcessor->mImageFile, kImageExecPath);
@@ -177,7 +209,8 @@ void OTAImageProcessorImpl::HandleAbort(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
+    TEMPORARY_RETURN_IGNORED imageProcessor->StopWriter(/* flush = */ false);
+    imageProcessor->mImageValid = false;
     unlink(imageProcessor->mImageFile);
     TEMPORARY_RETURN_IGNORED imageProcessor->ReleaseBlock();
 }
@@ -205,13 +238,30 @@ void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
         return;
     }
 
-    if (!imageProcessor->mOfs.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size())))
     {
+        std::lock_guard<std::mutex> lock(imageProcessor->mWriterMutex);
+        error = imageProcessor->mWriterError;
+    }
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot write OTA image: %" CHIP_ERROR_FORMAT, error.Format());
         imageProcessor->mDownloader->EndDownload(CHIP_ERROR_WRITE_FAILED);
         return;
     }
 
     imageProcessor->mParams.downloadedBytes += block.size();
+    if (imageProcessor->QueueData(block))
+    {
+        TEMPORARY_RETURN_IGNORED imageProcessor->mDownloader->FetchNextData();
+    }
+}
+
+void OTAImageProcessorImpl::HandleFetchNextData(intptr_t context)
+{
+    auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
+    VerifyOrReturn(imageProcessor != nullptr && imageProcessor->mDownloader != nullptr);
+    VerifyOrReturn(imageProcessor->mFd >= 0);
+
     TEMPORARY_RETURN_IGNORED imageProcessor->mDownloader->FetchNextData();
 }
 
@@ -227,12 +277,94 @@ CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
         ReturnErrorOnFailure(error);
 
         mParams.totalFileBytes = header.mPayloadSize;
+
+        // The header digest is only referenced by the parser buffer, so keep a copy for HandleFinalize.
+        mHasImageDigest =
+            header.mImageDigestType == OTAImageDigestType::kSha256 && header.mImageDigest.size() == sizeof(mImageDigest);
+        if (mHasImageDigest)
+        {
+            memcpy(mImageDigest, header.mImageDigest.data(), sizeof(mImageDigest));
+        }
+        else
+        {
+            ChipLogProgress(SoftwareUpdate, "OTA image digest type %u is not verified", to_underlying(header.mImageDigestType));
+        }
+        if (header.mDelta.HasValue())
+        {
+            ReturnErrorOnFailure(PrepareDelta(header.mDelta.Value()));
+        }
         mHeaderParser.Clear();
     }
 
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR OTAImageProcessorImpl::PrepareDelta(const OTAImageDeltaInfo & delta)
+{
+    uint32_t currentVersion;
+    ReturnErrorOnFailure(DeviceLayer::ConfigurationMgr().GetSoftwareVersion(currentVersion));
+    if (currentVersion != delta.mBaseSoftwareVersion)
+    {
+        ChipLogError(SoftwareUpdate, "Delta OTA image applies to software version %" PRIu32 ", current version = %" PRIu32,
+                     delta.mBaseSoftwareVersion, currentVersion);
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    CHIP_ERROR error = MapBaseImage();
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot map current image %s: %" CHIP_ERROR_FORMAT, mCurrentImageFile, error.Format());
+        return error;
+    }
+
+    // Hashing the base image also pages it in before the writer thread copies from it.
+    uint8_t baseDigest[Crypto::kSHA256_Hash_Length];
+    ReturnErrorOnFailure(Crypto::Hash_SHA256(static_cast<const uint8_t *>(mBaseImage), mBaseImageSize, baseDigest));
+    if (!delta.mBaseDigest.data_equal(ByteSpan(baseDigest)))
+    {
+        ChipLogError(SoftwareUpdate, "Current image is not the base of the delta OTA image");
+        return CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+    }
+
+    ReturnErrorOnFailure(mTargetHash.Begin());
+    memcpy(mTargetDigest, delta.mTargetDigest.data(), sizeof(mTargetDigest));
+    mPatcher.Init(ByteSpan(static_cast<const uint8_t *>(mBaseImage), mBaseImageSize), delta.mTargetSize);
+    mIsDelta = true;
+    ChipLogProgress(SoftwareUpdate, "Applying delta OTA image to software version %" PRIu32, currentVersion);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::MapBaseImage()
+{
+    UnmapBaseImage();
+
+    int fd = open(mCurrentImageFile, O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_OPEN_FAILED);
+
+    struct stat status;
+    void * image = MAP_FAILED;
+    if (fstat(fd, &status) == 0 && status.st_size > 0)
+    {
+        image = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    VerifyOrReturnError(image != MAP_FAILED, CHIP_ERROR_OPEN_FAILED);
+
+    mBaseImage     = image;
+    mBaseImageSize = static_cast<size_t>(status.st_size);
+    return CHIP_NO_ERROR;
+}
+
+void OTAImageProcessorImpl::UnmapBaseImage()
+{
+    VerifyOrReturn(mBaseImage != nullptr);
+
+    munmap(mBaseImage, mBaseImageSize);
+    mBaseImage     = nullptr;
+    mBaseImageSize = 0;
+}
+
 CHIP_ERROR OTAImageProcessorImpl::SetBlock(ByteSpan & block)
 {
     if (block.empty())
@@ -273,4 +405,151 @@ CHIP_ERROR OTAImageProcessorImpl::ReleaseBlock()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR OTAImageProcessorImpl::StartWriter()
+{
+    TEMPORARY_RETURN_IGNORED StopWriter(/* flush = */ false);
+    ReturnErrorOnFailure(mPayloadHash.Begin());
+
+    mFd = open(mImageFile, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_OPEN_FAILED);
+
+    mQueuedData.clear();
+    mQueuedData.reserve(kMaxQueuedBytes);
+    mWriterStop   = false;
+    mWriterFlush  = false;
+    mFetchPending = false;
+    mWriterError  = CHIP_NO_ERROR;
+    mWriterThread = std::thread(&OTAImageProcessorImpl::WriterThreadMain, this);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::StopWriter(bool flush)
+{
+    if (mWriterThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mWriterMutex);
+            mWriterStop  = !flush;
+            mWriterFlush = flush;
+        }
+        mWriterCondition.notify_one();
+        mWriterThread.join();
+    }
+
+    CHIP_ERROR error = mWriterError;
+    if (mFd >= 0)
+    {
+        if (flush && error == CHIP_NO_ERROR && fsync(mFd) != 0)
+        {
+            error = CHIP_ERROR_WRITE_FAILED;
+        }
+        close(mFd);
+        mFd = -1;
+    }
+    mQueuedData.clear();
+    UnmapBaseImage();
+    return error;
+}
+
+bool OTAImageProcessorImpl::QueueData(ByteSpan data)
+{
+    std::lock_guard<std::mutex> lock(mWriterMutex);
+    mQueuedData.insert(mQueuedData.end(), data.begin(), data.end());
+    if (mQueuedData.size() >= kWriteChunkSize)
+    {
+        mWriterCondition.notify_one();
+    }
+
+    // Data past the limit stays queued; fetching resumes once the writer has caught up.
+    mFetchPending = mQueuedData.size() >= kMaxQueuedBytes;
+    return !mFetchPending;
+}
+
+void OTAImageProcessorImpl::WriterThreadMain()
+{
+    std::vector<uint8_t> writing;
+    writing.reserve(kMaxQueuedBytes);
+
+    std::unique_lock<std::mutex> lock(mWriterMutex);
+    while (true)
+    {
+        mWriterCondition.wait(lock, [this] { return mWriterStop || mWriterFlush || mQueuedData.size() >= kWriteChunkSize; });
+        if (mWriterStop || (mWriterFlush && mQueuedData.empty()))
+        {
+            break;
+        }
+
+        writing.swap(mQueuedData);
+        ResumeFetching();
+        lock.unlock();
+
+        ByteSpan data(writing.data(), writing.size());
+        CHIP_ERROR error = mPayloadHash.AddData(data);
+        if (error == CHIP_NO_ERROR)
+        {
+            error = mIsDelta ? mPatcher.Apply(data, mPatchedImageOutput) : WriteToFile(data);
+        }
+        writing.clear();
+
+        lock.lock();
+        if (error != CHIP_NO_ERROR)
+        {
+            // Let a waiting download fetch its next block, so that it sees the error and ends.
+            mWriterError = error;
+            ResumeFetching();
+            break;
+        }
+    }
+}
+
+CHIP_ERROR OTAImageProcessorImpl::WriteToFile(ByteSpan data)
+{
+    for (size_t written = 0; written < data.size();)
+    {
+        ssize_t result = write(mFd, data.data() + written, data.size() - written);
+        if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(result > 0, CHIP_ERROR_WRITE_FAILED);
+        written += static_cast<size_t>(result);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::PatchedImageOutput::Write(ByteSpan data)
+{
+    ReturnErrorOnFailure(mProcessor.mTargetHash.AddData(data));
+    return mProcessor.WriteToFile(data);
+}
+
+void OTAImageProcessorImpl::ResumeFetching()
+{
+    VerifyOrReturn(mFetchPending);
+
+    mFetchPending = false;
+    TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().ScheduleWork(HandleFetchNextData, reinterpret_cast<intptr_t>(this));
+}
+
+bool OTAImageProcessorImpl::VerifyImageDigest()
+{
+    VerifyOrReturnValue(mHasImageDigest, true);
+
+    MutableByteSpan digest(mPayloadDigest);
+    VerifyOrReturnValue(mPayloadHash.Finish(digest) == CHIP_NO_ERROR, false);
+    return digest.data_equal(ByteSpan(mImageDigest));
+}
+
+bool OTAImageProcessorImpl::VerifyPatchedImage()
+{
+    VerifyOrReturnValue(mIsDelta, true);
+    VerifyOrReturnValue(mPatcher.Finish() == CHIP_NO_ERROR, false);
+
+    uint8_t targetDigest[Crypto::kSHA256_Hash_Length];
+    MutableByteSpan digest(targetDigest);
+    VerifyOrReturnValue(mTargetHash.Finish(digest) == CHIP_NO_ERROR, false);
+    return digest.data_equal(ByteSpan(mTargetDigest));
+}
+
 } // namespace chip
@@ -19,20 +19,36 @@
 #pragma once
 
 #include <app/clusters/ota-requestor/OTADownloader.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/OTAImageDelta.h>
 #include <lib/core/OTAImageHeader.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/OTAImageProcessor.h>
 
-#include <fstream>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace chip {
 
 // Full file path to where the new image will be executed from post-download
 static constexpr char kImageExecPath[] = "/tmp/ota.update";
 
+/**
+ * Downloaded blocks are handed over to a writer thread, which writes the image file in large chunks and computes
+ * the image digest as the data goes, so that the download does not wait for the file system and no extra pass over
+ * the image is needed before applying it. The next block is fetched as soon as the previous one is queued, unless
+ * too much data is waiting to be written.
+ *
+ * The payload of a delta image is applied by the writer thread to the current image, which is mapped in memory, so
+ * that only the difference between the images is downloaded.
+ */
 class OTAImageProcessorImpl : public OTAImageProcessorInterface
 {
 public:
+    ~OTAImageProcessorImpl() { TEMPORARY_RETURN_IGNORED StopWriter(/* flush = */ false); }
+
     //////////// OTAImageProcessorInterface Implementation ///////////////
     CHIP_ERROR PrepareDownload() override;
     CHIP_ERROR Finalize() override;
@@ -44,6 +60,8 @@ public:
 
     void SetOTADownloader(OTADownloader * downloader) { mDownloader = downloader; }
     void SetOTAImageFile(const char * imageFile) { mImageFile = imageFile; }
+    /// Sets the image delta images are applied to, by default the running executable.
+    void SetCurrentImageFile(const char * imageFile) { mCurrentImageFile = imageFile; }
 
 private:
     //////////// Actual handlers for the OTAImageProcessorInterface ///////////////
@@ -52,8 +70,41 @@ private:
     static void HandleApply(intptr_t context);
     static void HandleAbort(intptr_t context);
     static void HandleProcessBlock(intptr_t context);
+    static void HandleFetchNextData(intptr_t context);
 
     CHIP_ERROR ProcessHeader(ByteSpan & block);
+    CHIP_ERROR PrepareDelta(const OTAImageDeltaInfo & delta);
+    CHIP_ERROR MapBaseImage();
+    void UnmapBaseImage();
+
+    /// Size from which queued data is written to the image file.
+    static constexpr size_t kWriteChunkSize = 256 * 1024;
+    /// Amount of queued data above which fetching the next block waits for the writer.
+    static constexpr size_t kMaxQueuedBytes = 4 * kWriteChunkSize;
+
+    CHIP_ERROR StartWriter();
+    /// Stops the writer thread, writing out any queued data first if flush is true.
+    CHIP_ERROR StopWriter(bool flush);
+    /// Queues data for the writer thread. Returns true if the next block may be fetched right away.
+    bool QueueData(ByteSpan data);
+    void WriterThreadMain();
+    /// Writes data to the image file. Only called by the writer thread.
+    CHIP_ERROR WriteToFile(ByteSpan data);
+    /// Schedules fetching the next block if it waits for the writer. Called with mWriterMutex held.
+    void ResumeFetching();
+    bool VerifyImageDigest();
+    bool VerifyPatchedImage();
+
+    /// Writes the image patched by mPatcher, computing its digest.
+    class PatchedImageOutput : public OTAImageDeltaPatcher::Output
+    {
+    public:
+        explicit PatchedImageOutput(OTAImageProcessorImpl & processor) : mProcessor(processor) {}
+        CHIP_ERROR Write(ByteSpan data) override;
+
+    private:
+        OTAImageProcessorImpl & mProcessor;
+    };
 
     /**
      * Called to allocate memory for mBlock if necessary and set it to block
@@ -65,11 +116,40 @@ private:
      */
     CHIP_ERROR ReleaseBlock();
 
-    std::ofstream mOfs;
+    int mFd = -1;
     MutableByteSpan mBlock;
     OTADownloader * mDownloader;
     OTAImageHeaderParser mHeaderParser;
     const char * mImageFile = nullptr;
+    bool mImageValid        = false;
+
+    // Digest advertised by the image header, if it is one the writer computes.
+    bool mHasImageDigest = false;
+    uint8_t mImageDigest[Crypto::kSHA256_Hash_Length];
+
+    // Delta image state, set up by ProcessHeader before any payload is queued.
+    const char * mCurrentImageFile = "/proc/self/exe";
+    bool mIsDelta                  = false;
+    void * mBaseImage              = nullptr;
+    size_t mBaseImageSize          = 0;
+    uint8_t mTargetDigest[Crypto::kSHA256_Hash_Length];
+
+    // State shared with the writer thread, protected by mWriterMutex.
+    std::thread mWriterThread;
+    std::mutex mWriterMutex;
+    std::condition_variable mWriterCondition;
+    std::vector<uint8_t> mQueuedData;
+    bool mWriterStop        = false;
+    bool mWriterFlush       = false;
+    bool mFetchPending      = false;
+    CHIP_ERROR mWriterError = CHIP_NO_ERROR;
+
+    // Only used by the writer thread while it runs.
+    Crypto::Hash_SHA256_stream mPayloadHash;
+    uint8_t mPayloadDigest[Crypto::kSHA256_Hash_Length];
+    OTAImageDeltaPatcher mPatcher;
+    PatchedImageOutput mPatchedImageOutput{ *this };
+    Crypto::Hash_SHA256_stream mTargetHash;
 };
 
 } // namespace chip
@@ -28,7 +28,10 @@
 #include <platform/internal/testing/ConfigUnitTest.h>
 
 #include <lib/core/CHIPEncoding.h>
+#include <lib/core/CHIPSafeCasts.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <platform/Linux/CHIPLinuxFactoryData.h>
 #include <platform/Linux/CHIPLinuxStorage.h>
 #include <platform/Linux/PosixConfig.h>
 
@@ -39,6 +42,7 @@ namespace Internal {
 static ChipLinuxStorage gChipLinuxFactoryStorage;
 static ChipLinuxStorage gChipLinuxConfigStorage;
 static ChipLinuxStorage gChipLinuxCountersStorage;
+static ChipLinuxFactoryData gChipLinuxFactoryData;
 
 // *** CAUTION ***: Changing the names or namespaces of these values will *break* existing devices.
 
@@ -96,6 +100,48 @@ ChipLinuxStorage * PosixConfig::GetStorageForNamespace(Key key)
     return nullptr;
 }
 
+// Factory values are read from the mapped factory data image when it holds them, and from the INI file otherwise.
+// These return CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND when the value has to be read from the INI file.
+static CHIP_ERROR ReadFactoryDataValue(const PosixConfig::Key & key, uint64_t & val)
+{
+    VerifyOrReturnError(strcmp(key.Namespace, PosixConfig::kConfigNamespace_ChipFactory) == 0, CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
+
+    CHIP_ERROR err = gChipLinuxFactoryData.GetValue(key.Name, val);
+    return (err == CHIP_ERROR_KEY_NOT_FOUND) ? CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND : err;
+}
+
+template <typename T>
+static CHIP_ERROR ReadFactoryDataInteger(const PosixConfig::Key & key, T & val)
+{
+    uint64_t number;
+    ReturnErrorOnFailure(ReadFactoryDataValue(key, number));
+    VerifyOrReturnError(CanCastTo<T>(number), CHIP_ERROR_INVALID_INTEGER_VALUE);
+    val = static_cast<T>(number);
+    return CHIP_NO_ERROR;
+}
+
+// Same buffer contract as ReadConfigValueStr() when nullTerminate is set, and as ReadConfigValueBin() otherwise.
+static CHIP_ERROR ReadFactoryDataBytes(const PosixConfig::Key & key, uint8_t * buf, size_t bufSize, size_t & outLen,
+                                       bool nullTerminate)
+{
+    VerifyOrReturnError(strcmp(key.Namespace, PosixConfig::kConfigNamespace_ChipFactory) == 0, CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
+
+    ByteSpan value;
+    CHIP_ERROR err = gChipLinuxFactoryData.GetValue(key.Name, value);
+    VerifyOrReturnError(err != CHIP_ERROR_KEY_NOT_FOUND, CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
+    ReturnErrorOnFailure(err);
+
+    outLen = value.size();
+    VerifyOrReturnError(buf != nullptr, CHIP_NO_ERROR);
+    VerifyOrReturnError(value.size() + (nullTerminate ? 1 : 0) <= bufSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+    memcpy(buf, value.data(), value.size());
+    if (nullTerminate)
+    {
+        buf[value.size()] = '\0';
+    }
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR PosixConfig::Init()
 {
     return PersistedStorage::KeyValueStoreMgrImpl().Init(CHIP_CONFIG_KVS_PATH);
@@ -107,6 +153,13 @@ CHIP_ERROR PosixConfig::ReadConfigValue(Key key, bool & val)
     ChipLinuxStorage * storage;
     uint32_t intVal;
 
+    err = ReadFactoryDataInteger(key, intVal);
+    if (err == CHIP_NO_ERROR)
+    {
+        val = (intVal != 0);
+    }
+    VerifyOrReturnError(err == CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND, err);
+
     storage = GetStorageForNamespace(key);
     VerifyOrExit(storage != nullptr, err = CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
 
@@ -128,6 +181,9 @@ CHIP_ERROR PosixConfig::ReadConfigValue(Key key, uint16_t & val)
     CHIP_ERROR err;
     ChipLinuxStorage * storage;
 
+    err = ReadFactoryDataInteger(key, val);
+    VerifyOrReturnError(err == CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND, err);
+
     storage = GetStorageForNamespace(key);
     VerifyOrExit(storage != nullptr, err = CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
 
@@ -147,6 +203,9 @@ CHIP_ERROR PosixConfig::ReadConfigValue(Key key, uint32_t & val)
     CHIP_ERROR err;
     ChipLinuxStorage * storage;
 
+    err = ReadFactoryDataInteger(key, val);
+    VerifyOrReturnError(err == CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND, err);
+
     storage = GetStorageForNamespace(key);
     VerifyOrExit(storage != nullptr, err = CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
 
@@ -166,6 +225,9 @@ CHIP_ERROR PosixConfig::ReadConfigValue(Key key, uint64_t & val)
     CHIP_ERROR err;
     ChipLinuxStorage * storage;
 
+    err = ReadFactoryDataInteger(key, val);
+    VerifyOrReturnError(err == CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND, err);
+
     storage = GetStorageForNamespace(key);
     VerifyOrExit(storage != nullptr, err = CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
 
@@ -201,6 +263,9 @@ CHIP_ERROR PosixConfig::ReadConfigValueStr(Key key, char * buf, size_t bufSize,
     CHIP_ERROR err;
     ChipLinuxStorage * storage;
 
+    err = ReadFactoryDataBytes(key, Uint8::from_char(buf), bufSize, outLen, /* nullTerminate = */ true);
+    VerifyOrReturnError(err == CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND, err);
+
     storage = GetStorageForNamespace(key);
     VerifyOrExit(storage != nullptr, err = CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
 
@@ -242,6 +307,9 @@ CHIP_ERROR PosixConfig::ReadConfigValueBin(Key key, uint8_t * buf, size_t bufSiz
     CHIP_ERROR err;
     ChipLinuxStorage * storage;
 
+    err = ReadFactoryDataBytes(key, buf, bufSize, outLen, /* nullTerminate = */ false);
+    VerifyOrReturnError(err == CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND, err);
+
     storage = GetStorageForNamespace(key);
     VerifyOrExit(storage != nullptr, err = CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
 
@@ -464,6 +532,9 @@ bool PosixConfig::ConfigValueExists(Key key)
 {
     ChipLinuxStorage * storage;
 
+    if (strcmp(key.Namespace, kConfigNamespace_ChipFactory) == 0 && gChipLinuxFactoryData.HasValue(key.Name))
+        return true;
+
     storage = GetStorageForNamespace(key);
     if (storage == nullptr)
         return false;
@@ -480,6 +551,17 @@ CHIP_ERROR PosixConfig::EnsureNamespace(const char * ns)
     {
         storage = &gChipLinuxFactoryStorage;
         err     = storage->Init(CHIP_DEFAULT_FACTORY_PATH);
+        SuccessOrExit(err);
+
+        // The binary image is optional; without it every factory value comes from the INI file.
+        if (!gChipLinuxFactoryData.IsLoaded())
+        {
+            err = gChipLinuxFactoryData.Init(CHIP_DEFAULT_FACTORY_DATA_PATH);
+            if (err == CHIP_ERROR_NOT_FOUND)
+            {
+                err = CHIP_NO_ERROR;
+            }
+        }
     }
     else if (strcmp(ns, kConfigNamespace_ChipConfig) == 0)
     {
@@ -169,6 +169,12 @@ const char * BluezConnection::GetPeerAddress() const
     return bluez_device1_get_address(mDevice.get());
 }
 
+bool BluezConnection::IsPeerAddressRandom() const
+{
+    const char * type = bluez_device1_get_address_type(mDevice.get());
+    return type != nullptr && strcmp(type, "random") == 0;
+}
+
 gboolean BluezConnection::WriteHandlerCallback(GIOChannel * aChannel, GIOCondition aCond, BluezConnection * apConn)
 {
     VerifyOrReturnValue(!(aCond & G_IO_HUP), G_SOURCE_REMOVE,
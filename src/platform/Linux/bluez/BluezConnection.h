@@ -45,6 +45,7 @@ public:
     CHIP_ERROR Init(const BluezEndpoint & aEndpoint);
 
     const char * GetPeerAddress() const;
+    bool IsPeerAddressRandom() const;
 
     uint16_t GetMTU() const { return mMtu; }
     void SetMTU(uint16_t aMtu) { mMtu = aMtu; }
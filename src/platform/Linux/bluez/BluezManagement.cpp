@@ -0,0 +1,193 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "BluezManagement.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+// Constants of the Linux kernel Bluetooth headers, which are not part of the C library.
+constexpr int kBtProtoHci             = 1;
+constexpr uint16_t kHciDevNone        = 0xffff;
+constexpr uint16_t kHciChannelControl = 3;
+
+// Management interface, see doc/mgmt-api.txt in the BlueZ sources.
+constexpr size_t kMgmtHeaderSize                = 6;
+constexpr uint16_t kMgmtEventCommandComplete    = 0x0001;
+constexpr uint16_t kMgmtEventCommandStatus      = 0x0002;
+constexpr uint16_t kMgmtOpLoadConnParam         = 0x0035;
+constexpr uint16_t kMgmtOpReadPhyConfiguration  = 0x0044;
+constexpr uint16_t kMgmtOpSetPhyConfiguration   = 0x0045;
+constexpr uint8_t kMgmtAddressTypeLePublic      = 1;
+constexpr uint8_t kMgmtAddressTypeLeRandom      = 2;
+constexpr System::Clock::Milliseconds32 kMgmtReplyTimeout(200);
+
+struct SockAddrHci
+{
+    sa_family_t mFamily;
+    uint16_t mDevice;
+    uint16_t mChannel;
+};
+
+CHIP_ERROR ParseAddress(const char * aAddress, uint8_t (&aBdAddr)[6])
+{
+    unsigned int bytes[6];
+    VerifyOrReturnError(aAddress != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(sscanf(aAddress, "%2x:%2x:%2x:%2x:%2x:%2x", &bytes[0], &bytes[1], &bytes[2], &bytes[3], &bytes[4],
+                               &bytes[5]) == 6,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The kernel expects the address in little-endian order, the reverse of its text form.
+    for (size_t i = 0; i < 6; i++)
+    {
+        aBdAddr[i] = static_cast<uint8_t>(bytes[5 - i]);
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR BluezManagement::SendCommand(uint16_t aOpcode, uint16_t aAdapterIndex, const uint8_t * aParams, size_t aParamsLen,
+                                        uint8_t * aReply, size_t aReplySize)
+{
+    uint8_t buffer[512];
+    VerifyOrReturnError(kMgmtHeaderSize + aParamsLen <= sizeof(buffer), CHIP_ERROR_INVALID_ARGUMENT);
+
+    int fd = socket(AF_BLUETOOTH, SOCK_RAW | SOCK_CLOEXEC | SOCK_NONBLOCK, kBtProtoHci);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno),
+                        ChipLogError(DeviceLayer, "FAIL: mgmt socket: %s", StringOrNullMarker(strerror(errno))));
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    SockAddrHci addr = { AF_BLUETOOTH, kHciDevNone, kHciChannelControl };
+    System::Clock::Timestamp deadline;
+
+    Encoding::LittleEndian::BufferWriter writer(buffer, sizeof(buffer));
+    writer.Put16(aOpcode).Put16(aAdapterIndex).Put16(static_cast<uint16_t>(aParamsLen)).Put(aParams, aParamsLen);
+
+    // Binding to the control channel needs CAP_NET_ADMIN.
+    VerifyOrExit(bind(fd, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) == 0, err = CHIP_ERROR_POSIX(errno));
+    VerifyOrExit(write(fd, buffer, writer.Needed()) == static_cast<ssize_t>(writer.Needed()), err = CHIP_ERROR_POSIX(errno));
+
+    // Other events may be broadcast on the control channel, so skip anything but the reply to this command.
+    deadline = System::SystemClock().GetMonotonicTimestamp() + kMgmtReplyTimeout;
+    while (true)
+    {
+        System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        VerifyOrExit(now < deadline, err = CHIP_ERROR_TIMEOUT);
+
+        pollfd pfd = { fd, POLLIN, 0 };
+        int ret    = poll(&pfd, 1, static_cast<int>((deadline - now).count()));
+        VerifyOrExit(ret >= 0 || errno == EINTR, err = CHIP_ERROR_POSIX(errno));
+        if (ret <= 0)
+        {
+            continue;
+        }
+
+        ssize_t len = read(fd, buffer, sizeof(buffer));
+        VerifyOrExit(len >= 0 || errno == EAGAIN || errno == EINTR, err = CHIP_ERROR_POSIX(errno));
+        if (len < static_cast<ssize_t>(kMgmtHeaderSize + 3))
+        {
+            continue;
+        }
+
+        const uint8_t * p = buffer;
+        uint16_t event    = Encoding::LittleEndian::Read16(p);
+        uint16_t index    = Encoding::LittleEndian::Read16(p);
+        p += 2; // Length of the event parameters.
+        uint16_t opcode = Encoding::LittleEndian::Read16(p);
+        uint8_t status  = Encoding::Read8(p);
+
+        if ((event != kMgmtEventCommandComplete && event != kMgmtEventCommandStatus) || index != aAdapterIndex ||
+            opcode != aOpcode)
+        {
+            continue;
+        }
+
+        VerifyOrExit(status == 0, err = CHIP_ERROR_INTERNAL;
+                     ChipLogError(DeviceLayer, "FAIL: mgmt command 0x%04x on hci%u: status 0x%02x", aOpcode, aAdapterIndex, status));
+        if (aReply != nullptr)
+        {
+            size_t replyLen = static_cast<size_t>(len) - static_cast<size_t>(p - buffer);
+            VerifyOrExit(replyLen >= aReplySize, err = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+            memcpy(aReply, p, aReplySize);
+        }
+        break;
+    }
+
+exit:
+    close(fd);
+    return err;
+}
+
+CHIP_ERROR BluezManagement::LoadConnectionParameters(uint16_t aAdapterIndex, const char * aAddress, bool aRandomAddress,
+                                                     const BluezConnectionParameters & aParams)
+{
+    uint8_t bdAddr[6];
+    ReturnErrorOnFailure(ParseAddress(aAddress, bdAddr));
+
+    uint8_t params[2 + 15];
+    Encoding::LittleEndian::BufferWriter writer(params, sizeof(params));
+    writer.Put16(1) // Number of devices.
+        .Put(bdAddr, sizeof(bdAddr))
+        .Put8(aRandomAddress ? kMgmtAddressTypeLeRandom : kMgmtAddressTypeLePublic)
+        .Put16(aParams.mMinInterval)
+        .Put16(aParams.mMaxInterval)
+        .Put16(aParams.mLatency)
+        .Put16(aParams.mSupervisionTimeout);
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    return SendCommand(kMgmtOpLoadConnParam, aAdapterIndex, params, writer.Needed());
+}
+
+CHIP_ERROR BluezManagement::ReadPhyConfiguration(uint16_t aAdapterIndex, uint32_t & aSupportedPhys, uint32_t & aSelectedPhys)
+{
+    // Supported, configurable and selected PHYs.
+    uint8_t reply[12];
+    ReturnErrorOnFailure(SendCommand(kMgmtOpReadPhyConfiguration, aAdapterIndex, nullptr, 0, reply, sizeof(reply)));
+
+    aSupportedPhys = Encoding::LittleEndian::Get32(&reply[0]);
+    aSelectedPhys  = Encoding::LittleEndian::Get32(&reply[8]);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BluezManagement::SetPhyConfiguration(uint16_t aAdapterIndex, uint32_t aSelectedPhys)
+{
+    uint8_t params[4];
+    Encoding::LittleEndian::Put32(params, aSelectedPhys);
+    return SendCommand(kMgmtOpSetPhyConfiguration, aAdapterIndex, params, sizeof(params));
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,72 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lib/core/CHIPError.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+/// LE connection parameters, in the units of the Bluetooth Core specification.
+struct BluezConnectionParameters
+{
+    uint16_t mMinInterval;        ///< Minimum connection interval, in units of 1.25 ms.
+    uint16_t mMaxInterval;        ///< Maximum connection interval, in units of 1.25 ms.
+    uint16_t mLatency;            ///< Number of connection events the peripheral may skip.
+    uint16_t mSupervisionTimeout; ///< Supervision timeout, in units of 10 ms.
+};
+
+/// Bits of the PHY configuration of an adapter that select the LE 2M PHY.
+inline constexpr uint32_t kBluezPhyLe2M = 0x00000800 /* LE 2M TX */ | 0x00001000 /* LE 2M RX */;
+
+/// Minimal client of the Bluetooth management (mgmt) interface of the Linux kernel.
+///
+/// BlueZ does not expose LE connection parameters or PHY preferences over D-Bus, so
+/// they are set through the kernel management socket. Opening this socket requires the
+/// CAP_NET_ADMIN capability. Every call opens its own socket and waits briefly for the
+/// kernel to complete the command.
+class BluezManagement
+{
+public:
+    /// Store the connection parameters to use with an LE device. Linux 6.10 and later also
+    /// apply them to an existing connection in which the adapter is the central.
+    ///
+    /// @param aAdapterIndex  Index of the adapter, as in hciN.
+    /// @param aAddress       Address of the device, as "XX:XX:XX:XX:XX:XX".
+    /// @param aRandomAddress Whether the address of the device is a random address.
+    static CHIP_ERROR LoadConnectionParameters(uint16_t aAdapterIndex, const char * aAddress, bool aRandomAddress,
+                                               const BluezConnectionParameters & aParams);
+
+    /// Read the PHYs supported by the adapter, and the ones it prefers for its connections.
+    static CHIP_ERROR ReadPhyConfiguration(uint16_t aAdapterIndex, uint32_t & aSupportedPhys, uint32_t & aSelectedPhys);
+
+    /// Select the PHYs the adapter prefers for its connections.
+    static CHIP_ERROR SetPhyConfiguration(uint16_t aAdapterIndex, uint32_t aSelectedPhys);
+
+private:
+    static CHIP_ERROR SendCommand(uint16_t aOpcode, uint16_t aAdapterIndex, const uint8_t * aParams, size_t aParamsLen,
+                                  uint8_t * aReply = nullptr, size_t aReplySize = 0);
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
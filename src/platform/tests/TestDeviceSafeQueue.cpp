@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the POSIX device event queue.
+ *
+ */
+
+#include <thread>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <platform/DeviceSafeQueue.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+ChipDeviceEvent MakeEvent(uint16_t type, intptr_t arg)
+{
+    ChipDeviceEvent event;
+    event.Type                 = type;
+    event.CallWorkFunct.Arg = arg;
+    return event;
+}
+
+TEST(TestDeviceSafeQueue, PopsInOrderAndAsksForOneWakeupPerBurst)
+{
+    DeviceSafeQueue queue;
+    ChipDeviceEvent event;
+
+    EXPECT_FALSE(queue.PopFront(event));
+
+    EXPECT_TRUE(queue.Push(MakeEvent(DeviceEventType::kCallWorkFunct, 1)));
+    EXPECT_FALSE(queue.Push(MakeEvent(DeviceEventType::kCallWorkFunct, 2)));
+    EXPECT_EQ(queue.GetDepth(), 2u);
+
+    ASSERT_TRUE(queue.PopFront(event));
+    EXPECT_EQ(event.CallWorkFunct.Arg, 1);
+    ASSERT_TRUE(queue.PopFront(event));
+    EXPECT_EQ(event.CallWorkFunct.Arg, 2);
+
+    // Finding the queue empty re-arms the wakeup.
+    EXPECT_FALSE(queue.PopFront(event));
+    EXPECT_TRUE(queue.Push(MakeEvent(DeviceEventType::kCallWorkFunct, 3)));
+    ASSERT_TRUE(queue.PopFront(event));
+    EXPECT_EQ(event.CallWorkFunct.Arg, 3);
+
+    EXPECT_EQ(queue.GetDepth(), 0u);
+    EXPECT_EQ(queue.GetHighWatermark(), 2u);
+    EXPECT_EQ(queue.GetOverflowCount(), 0u);
+}
+
+TEST(TestDeviceSafeQueue, OverflowKeepsOrder)
+{
+    constexpr intptr_t kEventCount = CHIP_DEVICE_CONFIG_SAFE_QUEUE_RING_SIZE * 2 + 3;
+
+    DeviceSafeQueue queue;
+    ChipDeviceEvent event;
+
+    for (intptr_t i = 0; i < kEventCount; i++)
+    {
+        queue.Push(MakeEvent(DeviceEventType::kCallWorkFunct, i));
+        // Freeing ring slots while events wait in the overflow queue must not let new events overtake them.
+        if (i == CHIP_DEVICE_CONFIG_SAFE_QUEUE_RING_SIZE + 1)
+        {
+            ASSERT_TRUE(queue.PopFront(event));
+            EXPECT_EQ(event.CallWorkFunct.Arg, 0);
+        }
+    }
+    EXPECT_GT(queue.GetOverflowCount(), 0u);
+
+    for (intptr_t i = 1; i < kEventCount; i++)
+    {
+        ASSERT_TRUE(queue.PopFront(event));
+        EXPECT_EQ(event.CallWorkFunct.Arg, i);
+    }
+    EXPECT_FALSE(queue.PopFront(event));
+}
+
+TEST(TestDeviceSafeQueue, ConcurrentProducersKeepTheirOrder)
+{
+    constexpr uint16_t kProducerCount   = 4;
+    constexpr intptr_t kEventsPerThread = 10000;
+
+    DeviceSafeQueue queue;
+    std::vector<std::thread> producers;
+    for (uint16_t producer = 0; producer < kProducerCount; producer++)
+    {
+        producers.emplace_back([&queue, producer]() {
+            for (intptr_t i = 0; i < kEventsPerThread; i++)
+            {
+                queue.Push(MakeEvent(static_cast<uint16_t>(DeviceEventType::kRange_PublicPlatformSpecific + producer), i));
+            }
+        });
+    }
+
+    intptr_t next[kProducerCount] = {};
+    intptr_t popped               = 0;
+    ChipDeviceEvent event;
+    while (popped < kProducerCount * kEventsPerThread)
+    {
+        if (!queue.PopFront(event))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        uint16_t producer = static_cast<uint16_t>(event.Type - DeviceEventType::kRange_PublicPlatformSpecific);
+        ASSERT_LT(producer, kProducerCount);
+        EXPECT_EQ(event.CallWorkFunct.Arg, next[producer]++);
+        popped++;
+    }
+
+    for (auto & thread : producers)
+    {
+        thread.join();
+    }
+    EXPECT_FALSE(queue.PopFront(event));
+}
+
+} // namespace
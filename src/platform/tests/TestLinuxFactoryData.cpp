@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the Linux binary
+ *      factory data image.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVWriter.h>
+#include <platform/Linux/CHIPLinuxFactoryData.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+using Tag = ChipLinuxFactoryData::Tag;
+
+class TestLinuxFactoryData : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/chip-factory-data-XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate), nullptr);
+        mDir  = dirTemplate;
+        mPath = mDir + "/factory.bin";
+    }
+
+    void TearDown() override
+    {
+        unlink(mPath.c_str());
+        rmdir(mDir.c_str());
+    }
+
+    void WriteFile(ByteSpan contents)
+    {
+        FILE * file = fopen(mPath.c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        EXPECT_EQ(fwrite(contents.data(), 1, contents.size(), file), contents.size());
+        fclose(file);
+    }
+
+    std::string mDir;
+    std::string mPath;
+};
+
+CHIP_ERROR EncodeImage(MutableByteSpan & image)
+{
+    const uint8_t dac[] = { 0x30, 0x82, 0x01, 0x02, 0x03 };
+
+    TLV::TLVWriter writer;
+    writer.Init(image);
+
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, arrayType));
+
+    TLV::TLVType structType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, structType));
+    ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(Tag::kKey), "vendor-id"));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(Tag::kValue), static_cast<uint16_t>(0xFFF1)));
+    ReturnErrorOnFailure(writer.EndContainer(structType));
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, structType));
+    ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(Tag::kKey), "serial-num"));
+    ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(Tag::kValue), "SN-0001"));
+    ReturnErrorOnFailure(writer.EndContainer(structType));
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, structType));
+    ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(Tag::kKey), "device-cert"));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(Tag::kValue), ByteSpan(dac)));
+    ReturnErrorOnFailure(writer.EndContainer(structType));
+
+    ReturnErrorOnFailure(writer.EndContainer(arrayType));
+    ReturnErrorOnFailure(writer.Finalize());
+    image.reduce_size(writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+TEST_F(TestLinuxFactoryData, MissingImage)
+{
+    ChipLinuxFactoryData factoryData;
+    EXPECT_EQ(factoryData.Init(mPath.c_str()), CHIP_ERROR_NOT_FOUND);
+    EXPECT_FALSE(factoryData.IsLoaded());
+
+    uint64_t number;
+    EXPECT_EQ(factoryData.GetValue("vendor-id", number), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+TEST_F(TestLinuxFactoryData, ReadValues)
+{
+    uint8_t buffer[128];
+    MutableByteSpan image(buffer);
+    ASSERT_EQ(EncodeImage(image), CHIP_NO_ERROR);
+    WriteFile(image);
+
+    ChipLinuxFactoryData factoryData;
+    ASSERT_EQ(factoryData.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_TRUE(factoryData.IsLoaded());
+    EXPECT_EQ(factoryData.GetValueCount(), 3u);
+
+    uint64_t number = 0;
+    EXPECT_EQ(factoryData.GetValue("vendor-id", number), CHIP_NO_ERROR);
+    EXPECT_EQ(number, 0xFFF1u);
+
+    ByteSpan bytes;
+    EXPECT_EQ(factoryData.GetValue("serial-num", bytes), CHIP_NO_ERROR);
+    EXPECT_TRUE(bytes.data_equal(ByteSpan(reinterpret_cast<const uint8_t *>("SN-0001"), 7)));
+
+    const uint8_t dac[] = { 0x30, 0x82, 0x01, 0x02, 0x03 };
+    EXPECT_EQ(factoryData.GetValue("device-cert", bytes), CHIP_NO_ERROR);
+    EXPECT_TRUE(bytes.data_equal(ByteSpan(dac)));
+
+    EXPECT_EQ(factoryData.GetValue("vendor-id", bytes), CHIP_ERROR_WRONG_TLV_TYPE);
+    EXPECT_EQ(factoryData.GetValue("serial-num", number), CHIP_ERROR_WRONG_TLV_TYPE);
+    EXPECT_EQ(factoryData.GetValue("product-id", number), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_TRUE(factoryData.HasValue("device-cert"));
+    EXPECT_FALSE(factoryData.HasValue("device-key"));
+
+    factoryData.Close();
+    EXPECT_FALSE(factoryData.IsLoaded());
+    EXPECT_EQ(factoryData.GetValue("vendor-id", number), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+TEST_F(TestLinuxFactoryData, RejectInvalidImage)
+{
+    uint8_t buffer[128];
+    MutableByteSpan image(buffer);
+    ASSERT_EQ(EncodeImage(image), CHIP_NO_ERROR);
+
+    // Truncated in the middle of a value.
+    WriteFile(image.SubSpan(0, image.size() - 4));
+    ChipLinuxFactoryData factoryData;
+    EXPECT_NE(factoryData.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_FALSE(factoryData.IsLoaded());
+
+    // Not a TLV array.
+    const uint8_t notAnArray[] = { 0x15, 0x18 };
+    WriteFile(ByteSpan(notAnArray));
+    EXPECT_NE(factoryData.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_FALSE(factoryData.IsLoaded());
+}
+
+} // namespace
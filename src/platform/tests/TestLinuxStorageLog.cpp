@@ -0,0 +1,290 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the Linux log-structured
+ *      key-value store.
+ *
+ */
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+class TestLinuxStorageLog : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/chip-kvs-log-XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate), nullptr);
+        mDir  = dirTemplate;
+        mPath = mDir + "/kvs";
+    }
+
+    void TearDown() override
+    {
+        unlink(mPath.c_str());
+        rmdir(mDir.c_str());
+    }
+
+    size_t FileSize() const
+    {
+        struct stat st;
+        return (stat(mPath.c_str(), &st) == 0) ? static_cast<size_t>(st.st_size) : 0;
+    }
+
+    std::string mDir;
+    std::string mPath;
+};
+
+TEST_F(TestLinuxStorageLog, PutGetDelete)
+{
+    ChipLinuxStorageLog storage;
+    uint8_t buf[8];
+    size_t readSize = 0;
+
+    EXPECT_EQ(storage.Put("key", "abc", 3), CHIP_ERROR_UNINITIALIZED);
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    EXPECT_EQ(storage.Get("key", buf, sizeof(buf), &readSize, 0), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(storage.Delete("key"), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    EXPECT_EQ(storage.Put("key", "abcdef", 6), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Get("key", buf, sizeof(buf), &readSize, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, 6u);
+    EXPECT_EQ(memcmp(buf, "abcdef", 6), 0);
+
+    // Partial and offset reads.
+    EXPECT_EQ(storage.Get("key", buf, 2, &readSize, 0), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(readSize, 2u);
+    EXPECT_EQ(storage.Get("key", buf, sizeof(buf), &readSize, 4), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, 2u);
+    EXPECT_EQ(memcmp(buf, "ef", 2), 0);
+    EXPECT_EQ(storage.Get("key", buf, sizeof(buf), &readSize, 7), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Empty values are stored as such.
+    EXPECT_EQ(storage.Put("empty", nullptr, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Get("empty", buf, sizeof(buf), &readSize, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, 0u);
+
+    EXPECT_EQ(storage.Delete("key"), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Get("key", buf, sizeof(buf), &readSize, 0), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    EXPECT_EQ(storage.Put("", "a", 1), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(storage.Put("big", buf, ChipLinuxStorageLog::kMaxValueSize + 1), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(TestLinuxStorageLog, WritesAppend)
+{
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    size_t before = storage.GetLogSize();
+    EXPECT_EQ(FileSize(), before);
+
+    EXPECT_EQ(storage.Put("a", "1234", 4), CHIP_NO_ERROR);
+    size_t recordSize = storage.GetLogSize() - before;
+    EXPECT_GT(recordSize, 4u);
+
+    // Overwriting a value adds one record of the same size rather than rewriting the file.
+    EXPECT_EQ(storage.Put("a", "5678", 4), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetLogSize(), before + 2 * recordSize);
+    EXPECT_EQ(FileSize(), storage.GetLogSize());
+}
+
+TEST_F(TestLinuxStorageLog, ReplayAfterRestart)
+{
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("a", "1", 1), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("b", "22", 2), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("a", "333", 3), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Delete("b"), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    uint8_t buf[8];
+    size_t readSize = 0;
+    EXPECT_EQ(storage.Get("a", buf, sizeof(buf), &readSize, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, 3u);
+    EXPECT_EQ(memcmp(buf, "333", 3), 0);
+    EXPECT_EQ(storage.Get("b", buf, sizeof(buf), &readSize, 0), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+TEST_F(TestLinuxStorageLog, TornRecordIsDiscarded)
+{
+    size_t intactSize = 0;
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("a", "1", 1), CHIP_NO_ERROR);
+        intactSize = storage.GetLogSize();
+        EXPECT_EQ(storage.Put("b", "2222", 4), CHIP_NO_ERROR);
+    }
+
+    // Simulate a crash in the middle of the last append.
+    ASSERT_EQ(truncate(mPath.c_str(), static_cast<off_t>(FileSize() - 2)), 0);
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetLogSize(), intactSize);
+    EXPECT_EQ(FileSize(), intactSize);
+
+    uint8_t buf[8];
+    size_t readSize = 0;
+    EXPECT_EQ(storage.Get("a", buf, sizeof(buf), &readSize, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Get("b", buf, sizeof(buf), &readSize, 0), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    // New records go right after the last intact one.
+    EXPECT_EQ(storage.Put("c", "3", 1), CHIP_NO_ERROR);
+    ChipLinuxStorageLog reopened;
+    ASSERT_EQ(reopened.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(reopened.Get("c", buf, sizeof(buf), &readSize, 0), CHIP_NO_ERROR);
+}
+
+TEST_F(TestLinuxStorageLog, BatchIsWrittenOnCommit)
+{
+    uint8_t buf[8];
+    size_t readSize = 0;
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("a", "1", 1), CHIP_NO_ERROR);
+        size_t before = storage.GetLogSize();
+
+        EXPECT_EQ(storage.CommitBatch(), CHIP_ERROR_INCORRECT_STATE);
+        EXPECT_EQ(storage.BeginBatch(), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("b", "22", 2), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.BeginBatch(), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Delete("a"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.CommitBatch(), CHIP_NO_ERROR);
+
+        // Changes take effect right away, but nothing is written until the outermost batch is committed.
+        EXPECT_EQ(storage.Get("a", buf, sizeof(buf), &readSize, 0), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        EXPECT_EQ(storage.Get("b", buf, sizeof(buf), &readSize, 0), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.GetLogSize(), before);
+        EXPECT_EQ(FileSize(), before);
+
+        EXPECT_EQ(storage.CommitBatch(), CHIP_NO_ERROR);
+        EXPECT_GT(storage.GetLogSize(), before);
+        EXPECT_EQ(FileSize(), storage.GetLogSize());
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Get("a", buf, sizeof(buf), &readSize, 0), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(storage.Get("b", buf, sizeof(buf), &readSize, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, 2u);
+    EXPECT_EQ(memcmp(buf, "22", 2), 0);
+}
+
+TEST_F(TestLinuxStorageLog, TornBatchIsDiscarded)
+{
+    size_t intactSize = 0;
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("a", "1", 1), CHIP_NO_ERROR);
+        intactSize = storage.GetLogSize();
+
+        EXPECT_EQ(storage.BeginBatch(), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("a", "2", 1), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Put("b", "3333", 4), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.CommitBatch(), CHIP_NO_ERROR);
+    }
+
+    // Cut the batch record in its last change; none of its changes may survive.
+    ASSERT_EQ(truncate(mPath.c_str(), static_cast<off_t>(FileSize() - 2)), 0);
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetLogSize(), intactSize);
+
+    uint8_t buf[8];
+    size_t readSize = 0;
+    EXPECT_EQ(storage.Get("a", buf, sizeof(buf), &readSize, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, 1u);
+    EXPECT_EQ(buf[0], '1');
+    EXPECT_EQ(storage.Get("b", buf, sizeof(buf), &readSize, 0), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+TEST_F(TestLinuxStorageLog, Compaction)
+{
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    uint8_t value[128];
+    memset(value, 0x5a, sizeof(value));
+    EXPECT_EQ(storage.Put("keep", "k", 1), CHIP_NO_ERROR);
+
+    // Keep overwriting the same key; the log must stay bounded.
+    for (unsigned i = 0; i < 4 * ChipLinuxStorageLog::kCompactionMinLogSize / sizeof(value); i++)
+    {
+        value[0] = static_cast<uint8_t>(i);
+        EXPECT_EQ(storage.Put("churn", value, sizeof(value)), CHIP_NO_ERROR);
+        EXPECT_LE(storage.GetLogSize(), ChipLinuxStorageLog::kCompactionMinLogSize + sizeof(value) + 64);
+    }
+    EXPECT_EQ(FileSize(), storage.GetLogSize());
+
+    EXPECT_EQ(storage.Compact(), CHIP_NO_ERROR);
+    size_t compactedSize = storage.GetLogSize();
+    EXPECT_LT(compactedSize, 2 * sizeof(value));
+
+    ChipLinuxStorageLog reopened;
+    ASSERT_EQ(reopened.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(reopened.GetLogSize(), compactedSize);
+
+    uint8_t buf[sizeof(value)];
+    size_t readSize = 0;
+    EXPECT_EQ(reopened.Get("keep", buf, sizeof(buf), &readSize, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(reopened.Get("churn", buf, sizeof(buf), &readSize, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(memcmp(buf, value, sizeof(value)), 0);
+}
+
+TEST_F(TestLinuxStorageLog, RejectsForeignFile)
+{
+    int fd = open(mPath.c_str(), O_CREAT | O_WRONLY, 0600);
+    ASSERT_GE(fd, 0);
+    const char kIni[] = "[DEFAULT]\nkey=dmFsdWU=\n";
+    EXPECT_EQ(write(fd, kIni, sizeof(kIni) - 1), static_cast<ssize_t>(sizeof(kIni) - 1));
+    close(fd);
+
+    ChipLinuxStorageLog storage;
+    EXPECT_EQ(storage.Init(mPath.c_str()), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+}
+
+} // namespace
@@ -0,0 +1,165 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/bdx/BdxCompression.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace chip {
+namespace bdx {
+
+static_assert((LzssCodec::kWindowSize & (LzssCodec::kWindowSize - 1)) == 0, "The window size must be a power of 2");
+static_assert(LzssCodec::kWindowSize <= (1u << 12), "Distances must fit in 12 bits");
+
+LzssEncoder::LzssEncoder()
+{
+    memset(mHashHeads, 0, sizeof(mHashHeads));
+}
+
+uint32_t LzssEncoder::Hash(const uint8_t * data)
+{
+    const uint32_t value = (static_cast<uint32_t>(data[0]) << 16) | (static_cast<uint32_t>(data[1]) << 8) | data[2];
+    return (value * 2654435761u) >> (32 - kHashBits);
+}
+
+CHIP_ERROR LzssEncoder::Encode(ByteSpan input, MutableByteSpan & output)
+{
+    const uint8_t * in    = input.data();
+    const size_t inLength = input.size();
+    uint8_t * out         = output.data();
+    const uint64_t start  = mTotalLength;
+
+    size_t outLength = 0;
+    size_t flagsPos  = 0;
+    uint8_t flagBit  = 8;
+
+    // The data before the chunk is in the window, which is only updated once the whole chunk has been encoded.
+    auto byteAt = [&](uint64_t pos) { return (pos < start) ? mWindow[pos & kWindowMask] : in[pos - start]; };
+
+    size_t i = 0;
+    while (i < inLength)
+    {
+        if (flagBit == 8)
+        {
+            VerifyOrReturnError(outLength < output.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+            flagsPos      = outLength++;
+            out[flagsPos] = 0;
+            flagBit       = 0;
+        }
+
+        const uint64_t pos = start + i;
+        size_t matchLength = 0;
+        uint32_t distance  = 0;
+
+        if (inLength - i >= kMinMatch)
+        {
+            // Only the last position with the same hash is tried, which finds most repetitions of logs and images at a
+            // fraction of the cost of a full search of the window.
+            uint32_t & head = mHashHeads[Hash(&in[i])];
+            distance        = static_cast<uint32_t>(pos + 1) - head;
+            if (head != 0 && distance >= 1 && distance <= kWindowSize && distance <= pos)
+            {
+                const size_t maxLength = std::min(kMaxMatch, inLength - i);
+                while (matchLength < maxLength && byteAt(pos - distance + matchLength) == in[i + matchLength])
+                {
+                    matchLength++;
+                }
+            }
+            head = static_cast<uint32_t>(pos + 1);
+        }
+
+        if (matchLength >= kMinMatch)
+        {
+            VerifyOrReturnError(output.size() - outLength >= 2, CHIP_ERROR_BUFFER_TOO_SMALL);
+            const uint32_t code = distance - 1;
+            out[outLength++]    = static_cast<uint8_t>(code >> 4);
+            out[outLength++]    = static_cast<uint8_t>(((code & 0xF) << 4) | (matchLength - kMinMatch));
+
+            for (size_t j = i + 1; j < i + matchLength && j + kMinMatch <= inLength; j++)
+            {
+                mHashHeads[Hash(&in[j])] = static_cast<uint32_t>(start + j + 1);
+            }
+            i += matchLength;
+        }
+        else
+        {
+            VerifyOrReturnError(outLength < output.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+            out[flagsPos]    = static_cast<uint8_t>(out[flagsPos] | (1u << flagBit));
+            out[outLength++] = in[i++];
+        }
+        flagBit++;
+    }
+
+    for (size_t j = (inLength > kWindowSize) ? inLength - kWindowSize : 0; j < inLength; j++)
+    {
+        mWindow[(start + j) & kWindowMask] = in[j];
+    }
+    mTotalLength += inLength;
+    output.reduce_size(outLength);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LzssDecoder::Decode(ByteSpan input, MutableByteSpan & output)
+{
+    const uint8_t * in = input.data();
+    size_t inPos       = 0;
+    size_t outLength   = 0;
+
+    auto put = [&](uint8_t value) {
+        output.data()[outLength++]            = value;
+        mWindow[mTotalLength++ & kWindowMask] = value;
+    };
+
+    while (inPos < input.size())
+    {
+        const uint8_t flags = in[inPos++];
+        for (uint8_t bit = 0; bit < 8 && inPos < input.size(); bit++)
+        {
+            if (flags & (1u << bit))
+            {
+                VerifyOrReturnError(outLength < output.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+                put(in[inPos++]);
+                continue;
+            }
+
+            VerifyOrReturnError(input.size() - inPos >= 2, CHIP_ERROR_INVALID_ARGUMENT);
+            const uint32_t distance = ((static_cast<uint32_t>(in[inPos]) << 4) | (in[inPos + 1] >> 4)) + 1;
+            const size_t length     = static_cast<size_t>(in[inPos + 1] & 0xF) + kMinMatch;
+            inPos += 2;
+
+            VerifyOrReturnError(distance <= mTotalLength, CHIP_ERROR_INVALID_ARGUMENT);
+            VerifyOrReturnError(output.size() - outLength >= length, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+            // The source may overlap the bytes being written, which repeats the last distance bytes.
+            for (size_t j = 0; j < length; j++)
+            {
+                put(mWindow[(mTotalLength - distance) & kWindowMask]);
+            }
+        }
+    }
+
+    output.reduce_size(outLength);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace bdx
+} // namespace chip
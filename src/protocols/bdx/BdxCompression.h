@@ -0,0 +1,111 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Streaming LZSS codec used to compress the data of BDX Blocks.
+ *
+ *      The compressed stream is a sequence of groups. Each group starts with a flag byte followed by up to 8 tokens,
+ *      the least significant bit of the flag byte describing the first token. A set bit is a literal byte, a cleared
+ *      bit a 2-byte back-reference: 12 bits of distance minus 1, then 4 bits of length minus 3. Each Block is encoded
+ *      as complete groups, so it decodes on its own, but back-references may reach into the data of previous Blocks.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace bdx {
+
+/// Compression algorithms that may be negotiated for the data of a BDX transfer.
+enum class CompressionAlgorithm : uint8_t
+{
+    kNone = 0,
+    kLzss = 1,
+};
+
+class LzssCodec
+{
+public:
+    static constexpr size_t kWindowSize = 4096;
+    static constexpr size_t kMinMatch   = 3;
+    static constexpr size_t kMaxMatch   = kMinMatch + 15;
+
+    /// Largest amount of data whose compressed form is guaranteed to fit in maxEncodedLength bytes.
+    static constexpr size_t MaxDecodedLengthFor(size_t maxEncodedLength) { return maxEncodedLength * 8 / 9; }
+
+protected:
+    static constexpr size_t kWindowMask = kWindowSize - 1;
+
+    uint8_t mWindow[kWindowSize];
+    uint64_t mTotalLength = 0; ///< Number of bytes encoded or decoded so far.
+};
+
+/**
+ * Compresses consecutive chunks of a stream, each into a buffer that can be decoded by LzssDecoder::Decode().
+ */
+class LzssEncoder : public LzssCodec
+{
+public:
+    LzssEncoder();
+
+    /**
+     * Compress the next chunk of the stream.
+     *
+     * @param[in]     input   The chunk to compress.
+     * @param[in,out] output  Buffer for the compressed chunk, resized to the compressed length on success. A buffer of
+     *                        input.size() + (input.size() + 7) / 8 bytes is always large enough.
+     *
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL if the compressed chunk does not fit in output, in which case the chunk is not
+     *                                     part of the stream.
+     */
+    CHIP_ERROR Encode(ByteSpan input, MutableByteSpan & output);
+
+private:
+    static constexpr size_t kHashBits = 10;
+
+    static uint32_t Hash(const uint8_t * data);
+
+    uint32_t mHashHeads[1u << kHashBits]; ///< Last position + 1 of each 3-byte hash, 0 if none.
+};
+
+/**
+ * Decompresses the chunks produced by LzssEncoder::Encode(), in the same order.
+ */
+class LzssDecoder : public LzssCodec
+{
+public:
+    /**
+     * Decompress the next chunk of the stream.
+     *
+     * @param[in]     input   A chunk produced by LzssEncoder::Encode().
+     * @param[in,out] output  Buffer for the decompressed chunk, resized to the decompressed length on success.
+     *
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL  if the decompressed chunk does not fit in output.
+     * @retval CHIP_ERROR_INVALID_ARGUMENT  if the input is not a valid chunk of the stream.
+     */
+    CHIP_ERROR Decode(ByteSpan input, MutableByteSpan & output);
+};
+
+} // namespace bdx
+} // namespace chip
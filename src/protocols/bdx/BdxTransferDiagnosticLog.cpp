@@ -112,7 +112,9 @@ CHIP_ERROR BdxTransferDiagnosticLog::OnMessageReceived(Messaging::ExchangeContex
 
         mTransferProxy.SetFabricIndex(fabricIndex);
         mTransferProxy.SetPeerNodeId(peerNodeId);
-        auto flags(TransferControlFlags::kSenderDrive);
+        BitFlags<TransferControlFlags> flags(TransferControlFlags::kSenderDrive, TransferControlFlags::kAsync);
+        // Logs are mostly text, so accept to have them compressed if the provider proposes it.
+        mTransfer.EnableCompression(true);
         ReturnLogErrorOnFailure(
             Responder::PrepareForTransfer(mSystemLayer, kBdxRole, flags, kMaxBdxBlockSize, kBdxTimeout, kBdxPollInterval));
     }
@@ -155,6 +157,7 @@ CHIP_ERROR BdxTransferDiagnosticLog::OnTransferSessionEnd(CHIP_ERROR error)
     assertChipStackLockedByCurrentThread();
     VerifyOrReturnError(nullptr != mDelegate, CHIP_ERROR_INCORRECT_STATE);
 
+    mDelegate->OnTransferStats(&mTransferProxy, mTransfer.GetTransferStats());
     LogErrorOnFailure(mDelegate->OnTransferEnd(&mTransferProxy, error));
     Reset();
     return CHIP_NO_ERROR;
@@ -46,8 +46,11 @@ CHIP_ERROR BDXTransferProxyDiagnosticLog::Accept()
     ReturnErrorOnFailure(EnsureState());
     VerifyOrReturnError(nullptr != mTransfer, CHIP_ERROR_INCORRECT_STATE);
 
+    // Let the sender have several Blocks in flight if it proposed to.
+    const bool async = mTransfer->GetProposedControlOptions().Has(TransferControlFlags::kAsync);
+
     TransferSession::TransferAcceptData acceptData;
-    acceptData.ControlMode  = TransferControlFlags::kSenderDrive;
+    acceptData.ControlMode  = async ? TransferControlFlags::kAsync : TransferControlFlags::kSenderDrive;
     acceptData.MaxBlockSize = mTransfer->GetTransferBlockSize();
     acceptData.StartOffset  = mTransfer->GetStartOffset();
     acceptData.Length       = mTransfer->GetTransferLength();
@@ -21,6 +21,7 @@
 #include "BdxTransferProxy.h"
 
 #include <lib/core/CHIPError.h>
+#include <protocols/bdx/BdxTransferSession.h>
 
 namespace chip {
 namespace bdx {
@@ -47,6 +48,13 @@ public:
      *  This method is invoked when a block is received.
      */
     virtual CHIP_ERROR OnTransferData(BDXTransferProxy * transfer, const ByteSpan & data) = 0;
+
+    /**
+     * @brief
+     *  This method is invoked right before OnTransferEnd, with the number of blocks and bytes received and the
+     *  throughput of the transfer.
+     */
+    virtual void OnTransferStats(BDXTransferProxy * transfer, const TransferSession::TransferStats & stats) {}
 };
 
 } // namespace bdx
@@ -6,6 +6,8 @@
 
 #include <protocols/bdx/BdxTransferSession.h>
 
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/TLV.h>
 #include <lib/support/BufferReader.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/TypeTraits.h>
@@ -17,11 +19,18 @@
 #include <system/SystemPacketBuffer.h>
 #include <transport/SessionManager.h>
 
+#include <algorithm>
 #include <type_traits>
 
 namespace {
 constexpr uint8_t kBdxVersion = 0; ///< The version of this implementation of the BDX spec
 
+constexpr uint32_t kAsyncWindowSize = CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE;
+static_assert(kAsyncWindowSize > 0, "CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE must allow at least one Block in flight");
+
+/// Tag, in the BDX profile, of the compression algorithm in the Metadata of the TransferInit and Accept messages.
+constexpr uint32_t kCompressionMetadataTag = 1;
+
 /**
  * @brief
  *   Allocate a new PacketBuffer and write data from a BDX message struct.
@@ -164,6 +173,13 @@ CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitD
     initMsg.Metadata           = initData.Metadata;
     initMsg.MetadataLength     = initData.MetadataLength;
 
+    // Compression can only be proposed in the Metadata when the application has none of its own.
+    mCompressionEnabled = mCompressionEnabled && (initData.MetadataLength == 0);
+    if (mCompressionEnabled)
+    {
+        ReturnErrorOnFailure(WriteCompressionMetadata(initMsg.Metadata, initMsg.MetadataLength));
+    }
+
     ReturnErrorOnFailure(WriteToPacketBuffer(initMsg, mPendingMsgHandle));
 
     const MessageType msgType = (mRole == TransferRole::kSender) ? MessageType::SendInit : MessageType::ReceiveInit;
@@ -211,8 +227,18 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     VerifyOrReturnError(proposedControlOpts.Has(acceptData.ControlMode), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(acceptData.MaxBlockSize <= mTransferRequestData.MaxBlockSize, CHIP_ERROR_INVALID_ARGUMENT);
 
+    // The application picks the mode when more than one is supported by both nodes.
+    mControlMode          = acceptData.ControlMode;
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
 
+    // Accept the compression proposed by the initiator, unless the application has Metadata of its own.
+    const uint8_t * metadata = acceptData.Metadata;
+    uint16_t metadataLength  = acceptData.MetadataLength;
+    if (mCompressionEnabled && metadataLength == 0 && StartCompression() == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(WriteCompressionMetadata(metadata, metadataLength));
+    }
+
     if (mRole == TransferRole::kSender)
     {
         mStartOffset    = acceptData.StartOffset;
@@ -224,8 +250,8 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
         acceptMsg.StartOffset    = acceptData.StartOffset;
         acceptMsg.Length         = acceptData.Length;
-        acceptMsg.Metadata       = acceptData.Metadata;
-        acceptMsg.MetadataLength = acceptData.MetadataLength;
+        acceptMsg.Metadata       = metadata;
+        acceptMsg.MetadataLength = metadataLength;
 
         ReturnErrorOnFailure(WriteToPacketBuffer(acceptMsg, mPendingMsgHandle));
         msgType = MessageType::ReceiveAccept;
@@ -241,8 +267,8 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
         acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode);
         acceptMsg.Version        = mTransferVersion;
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
-        acceptMsg.Metadata       = acceptData.Metadata;
-        acceptMsg.MetadataLength = acceptData.MetadataLength;
+        acceptMsg.Metadata       = metadata;
+        acceptMsg.MetadataLength = metadataLength;
 
         ReturnErrorOnFailure(WriteToPacketBuffer(acceptMsg, mPendingMsgHandle));
         msgType = MessageType::SendAccept;
@@ -254,8 +280,10 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     }
 
     mState = TransferState::kTransferInProgress;
+    StartTransferStats();
 
-    if ((mRole == TransferRole::kReceiver && mControlMode == TransferControlFlags::kSenderDrive) ||
+    if ((mRole == TransferRole::kReceiver &&
+         (mControlMode == TransferControlFlags::kSenderDrive || mControlMode == TransferControlFlags::kAsync)) ||
         (mRole == TransferRole::kSender && mControlMode == TransferControlFlags::kReceiverDrive))
     {
         mAwaitingResponse = true;
@@ -327,16 +355,24 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(CanPrepareBlock(), CHIP_ERROR_INCORRECT_STATE);
 
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
-    VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= GetBlockDataSize()), CHIP_ERROR_INVALID_ARGUMENT);
 
     DataBlock blockMsg;
     blockMsg.BlockCounter = mNextBlockNum;
     blockMsg.Data         = inData.Data;
     blockMsg.DataLength   = inData.Length;
 
+    if (mEncoder)
+    {
+        MutableByteSpan compressed(mCompressedBlock.Get(), mTransferMaxBlockSize);
+        ReturnErrorOnFailure(mEncoder->Encode(ByteSpan(inData.Data, inData.Length), compressed));
+        blockMsg.Data       = compressed.data();
+        blockMsg.DataLength = compressed.size();
+    }
+
     ReturnErrorOnFailure(WriteToPacketBuffer(blockMsg, mPendingMsgHandle));
 
     const MessageType msgType = inData.IsEof ? MessageType::BlockEOF : MessageType::Block;
@@ -352,6 +388,7 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
 
     mAwaitingResponse = true;
     mLastBlockNum     = mNextBlockNum++;
+    RecordBlockStats(inData.Length, blockMsg.DataLength);
 
     PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
 
@@ -380,6 +417,7 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
             mLastQueryNum     = ackMsg.BlockCounter + 1;
             mAwaitingResponse = true;
         }
+        // In Async mode, the next Block may already be in flight: HandleBlock() keeps track of the next Block to receive.
     }
     else if (mState == TransferState::kReceivedEOF)
     {
@@ -418,6 +456,12 @@ void TransferSession::Reset()
     mTransferLength        = 0;
     mTransferMaxBlockSize  = 0;
 
+    mCompressionEnabled = false;
+    mCompression        = CompressionAlgorithm::kNone;
+    mEncoder.reset();
+    mDecoder.reset();
+    mCompressedBlock.Free();
+
     mPendingMsgHandle = nullptr;
 
     mNumBytesProcessed = 0;
@@ -425,6 +469,8 @@ void TransferSession::Reset()
     mNextBlockNum      = 0;
     mLastQueryNum      = 0;
     mNextQueryNum      = 0;
+    mNextAckNum        = 0;
+    mStats             = TransferStats();
 
     mTimeout                = System::Clock::kZero;
     mTimeoutStartTime       = System::Clock::kZero;
@@ -569,6 +615,12 @@ void TransferSession::HandleTransferInit(MessageType msgType, System::PacketBuff
     mTransferRequestData.Metadata         = transferInit.Metadata;
     mTransferRequestData.MetadataLength   = transferInit.MetadataLength;
 
+    // Compression is only accepted in AcceptTransfer() if the initiator proposed it.
+    if (ReadCompressionMetadata(transferInit.Metadata, transferInit.MetadataLength) != CompressionAlgorithm::kLzss)
+    {
+        mCompressionEnabled = false;
+    }
+
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kInitReceived;
 
@@ -591,6 +643,12 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     // Verify that Accept parameters are compatible with the original proposed parameters
     ReturnOnFailure(VerifyProposedMode(rcvAcceptMsg.TransferCtlFlags));
 
+    if (mCompressionEnabled &&
+        ReadCompressionMetadata(rcvAcceptMsg.Metadata, rcvAcceptMsg.MetadataLength) == CompressionAlgorithm::kLzss)
+    {
+        VerifyOrReturn(StartCompression() == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kTransferFailedUnknownError));
+    }
+
     mTransferMaxBlockSize = rcvAcceptMsg.MaxBlockSize;
     mStartOffset          = rcvAcceptMsg.StartOffset;
     mTransferLength       = rcvAcceptMsg.Length;
@@ -607,8 +665,10 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kAcceptReceived;
 
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kSenderDrive);
-    mState            = TransferState::kTransferInProgress;
+    mAwaitingResponse =
+        (mControlMode == TransferControlFlags::kSenderDrive || mControlMode == TransferControlFlags::kAsync);
+    mState = TransferState::kTransferInProgress;
+    StartTransferStats();
 
 #if CHIP_AUTOMATION_LOGGING
     rcvAcceptMsg.LogMessage(MessageType::ReceiveAccept);
@@ -631,6 +691,12 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
     // message
     mTransferMaxBlockSize = sendAcceptMsg.MaxBlockSize;
 
+    if (mCompressionEnabled &&
+        ReadCompressionMetadata(sendAcceptMsg.Metadata, sendAcceptMsg.MetadataLength) == CompressionAlgorithm::kLzss)
+    {
+        VerifyOrReturn(StartCompression() == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kTransferFailedUnknownError));
+    }
+
     mTransferAcceptData.ControlMode    = mControlMode;
     mTransferAcceptData.MaxBlockSize   = sendAcceptMsg.MaxBlockSize;
     mTransferAcceptData.StartOffset    = mStartOffset;    // Not included in SendAccept msg, so use member
@@ -643,6 +709,7 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
 
     mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
     mState            = TransferState::kTransferInProgress;
+    StartTransferStats();
 
 #if CHIP_AUTOMATION_LOGGING
     sendAcceptMsg.LogMessage(MessageType::SendAccept);
@@ -665,6 +732,7 @@ void TransferSession::HandleBlockQuery(System::PacketBufferHandle msgData)
 
     mAwaitingResponse = false;
     mLastQueryNum     = query.BlockCounter;
+    mNextAckNum       = query.BlockCounter;
 }
 
 void TransferSession::HandleBlockQueryWithSkip(System::PacketBufferHandle msgData)
@@ -683,6 +751,7 @@ void TransferSession::HandleBlockQueryWithSkip(System::PacketBufferHandle msgDat
 
     mAwaitingResponse        = false;
     mLastQueryNum            = query.BlockCounter;
+    mNextAckNum              = query.BlockCounter;
     mBytesToSkip.BytesToSkip = query.BytesToSkip;
 }
 
@@ -700,24 +769,41 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     VerifyOrReturn((blockMsg.DataLength > 0) && (blockMsg.DataLength <= mTransferMaxBlockSize),
                    PrepareStatusReport(StatusCode::kBadMessageContents));
 
+    const uint8_t * data    = blockMsg.Data;
+    size_t length           = blockMsg.DataLength;
+    const size_t wireLength = blockMsg.DataLength;
+    if (mDecoder)
+    {
+        VerifyOrReturn(DecompressBlock(data, length, msgData) == CHIP_NO_ERROR,
+                       PrepareStatusReport(StatusCode::kBadMessageContents));
+    }
+
     if (IsTransferLengthDefinite())
     {
-        VerifyOrReturn(mNumBytesProcessed + blockMsg.DataLength <= mTransferLength,
-                       PrepareStatusReport(StatusCode::kLengthMismatch));
+        VerifyOrReturn(mNumBytesProcessed + length <= mTransferLength, PrepareStatusReport(StatusCode::kLengthMismatch));
     }
 
-    mBlockEventData.Data         = blockMsg.Data;
-    mBlockEventData.Length       = blockMsg.DataLength;
+    mBlockEventData.Data         = data;
+    mBlockEventData.Length       = length;
     mBlockEventData.IsEof        = false;
     mBlockEventData.BlockCounter = blockMsg.BlockCounter;
 
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kBlockReceived;
 
-    mNumBytesProcessed += blockMsg.DataLength;
+    mNumBytesProcessed += length;
     mLastBlockNum = blockMsg.BlockCounter;
+    RecordBlockStats(length, wireLength);
 
-    mAwaitingResponse = false;
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        // The sender does not wait for a BlockAck before sending the next Block.
+        mLastQueryNum = blockMsg.BlockCounter + 1;
+    }
+    else
+    {
+        mAwaitingResponse = false;
+    }
 }
 
 void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
@@ -733,16 +819,26 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
     VerifyOrReturn(blockEOFMsg.BlockCounter == mLastQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
     VerifyOrReturn(blockEOFMsg.DataLength <= mTransferMaxBlockSize, PrepareStatusReport(StatusCode::kBadMessageContents));
 
-    mBlockEventData.Data         = blockEOFMsg.Data;
-    mBlockEventData.Length       = blockEOFMsg.DataLength;
+    const uint8_t * data    = blockEOFMsg.Data;
+    size_t length           = blockEOFMsg.DataLength;
+    const size_t wireLength = blockEOFMsg.DataLength;
+    if (mDecoder)
+    {
+        VerifyOrReturn(DecompressBlock(data, length, msgData) == CHIP_NO_ERROR,
+                       PrepareStatusReport(StatusCode::kBadMessageContents));
+    }
+
+    mBlockEventData.Data         = data;
+    mBlockEventData.Length       = length;
     mBlockEventData.IsEof        = true;
     mBlockEventData.BlockCounter = blockEOFMsg.BlockCounter;
 
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kBlockReceived;
 
-    mNumBytesProcessed += blockEOFMsg.DataLength;
+    mNumBytesProcessed += length;
     mLastBlockNum = blockEOFMsg.BlockCounter;
+    RecordBlockStats(length, wireLength);
 
     mAwaitingResponse = false;
     mState            = TransferState::kReceivedEOF;
@@ -754,20 +850,42 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 
 void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
+    const bool isAsync = (mControlMode == TransferControlFlags::kAsync);
+
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    // In Async mode, the Blocks sent before the BlockEOF can be acknowledged after it was sent.
+    VerifyOrReturn(mState == TransferState::kTransferInProgress || (isAsync && mState == TransferState::kAwaitingEOFAck),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockAck ackMsg;
     const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
-    VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+    if (isAsync)
+    {
+        // The BlockAck acknowledges all the Blocks up to its counter.
+        VerifyOrReturn(ackMsg.BlockCounter >= mNextAckNum && ackMsg.BlockCounter < mNextBlockNum,
+                       PrepareStatusReport(StatusCode::kBadBlockCounter));
+    }
+    else
+    {
+        VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    }
 
     mPendingOutput = OutputEventType::kAckReceived;
+    mNextAckNum    = ackMsg.BlockCounter + 1;
 
-    // In Receiver Drive, the Receiver can send a BlockAck to indicate receipt of the message and reset the timeout.
-    // In this case, the Sender should wait to receive a BlockQuery next.
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+    if (isAsync)
+    {
+        mAwaitingResponse = (GetNumBlocksInFlight() > 0);
+    }
+    else
+    {
+        // In Receiver Drive, the Receiver can send a BlockAck to indicate receipt of the message and reset the timeout.
+        // In this case, the Sender should wait to receive a BlockQuery next.
+        mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+    }
 }
 
 void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
@@ -782,6 +900,7 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
     VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
     mPendingOutput = OutputEventType::kAckEOFReceived;
+    mNextAckNum    = ackMsg.BlockCounter + 1;
 
     mAwaitingResponse = false;
 
@@ -892,6 +1011,128 @@ bool TransferSession::IsTransferLengthDefinite() const
     return (mTransferLength > 0);
 }
 
+bool TransferSession::CanPrepareBlock() const
+{
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        return GetNumBlocksInFlight() < kAsyncWindowSize;
+    }
+    return !mAwaitingResponse;
+}
+
+void TransferSession::StartTransferStats()
+{
+    mStats           = TransferStats();
+    mStats.StartTime = System::SystemClock().GetMonotonicTimestamp();
+}
+
+void TransferSession::RecordBlockStats(size_t length, size_t wireLength)
+{
+    mStats.Blocks++;
+    mStats.Bytes += length;
+    if (IsCompressed())
+    {
+        mStats.CompressedBytes += wireLength;
+    }
+    mStats.LastBlockTime = System::SystemClock().GetMonotonicTimestamp();
+}
+
+void TransferSession::EnableCompression(bool enable)
+{
+    mCompressionEnabled = enable && CHIP_CONFIG_BDX_COMPRESSION;
+}
+
+uint16_t TransferSession::GetBlockDataSize() const
+{
+    VerifyOrReturnValue(IsCompressed(), mTransferMaxBlockSize);
+    return static_cast<uint16_t>(LzssCodec::MaxDecodedLengthFor(mTransferMaxBlockSize));
+}
+
+CHIP_ERROR TransferSession::WriteCompressionMetadata(const uint8_t *& metadata, uint16_t & metadataLength)
+{
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+
+    writer.Init(mCompressionMetadata, sizeof(mCompressionMetadata));
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+    ReturnErrorOnFailure(writer.Put(TLV::ProfileTag(Protocols::BDX::Id.ToTLVProfileId(), kCompressionMetadataTag),
+                                    to_underlying(CompressionAlgorithm::kLzss)));
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    metadata       = mCompressionMetadata;
+    metadataLength = static_cast<uint16_t>(writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+CompressionAlgorithm TransferSession::ReadCompressionMetadata(const uint8_t * metadata, uint16_t metadataLength)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType outerType;
+    uint8_t algorithm = 0;
+
+    VerifyOrReturnValue(metadata != nullptr && metadataLength > 0, CompressionAlgorithm::kNone);
+
+    // Metadata of the application may share the structure, so any other element is ignored.
+    reader.Init(metadata, metadataLength);
+    VerifyOrReturnValue(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()) == CHIP_NO_ERROR, CompressionAlgorithm::kNone);
+    VerifyOrReturnValue(reader.EnterContainer(outerType) == CHIP_NO_ERROR, CompressionAlgorithm::kNone);
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        if (reader.GetTag() == TLV::ProfileTag(Protocols::BDX::Id.ToTLVProfileId(), kCompressionMetadataTag))
+        {
+            VerifyOrReturnValue(reader.Get(algorithm) == CHIP_NO_ERROR, CompressionAlgorithm::kNone);
+            break;
+        }
+    }
+
+    VerifyOrReturnValue(algorithm == to_underlying(CompressionAlgorithm::kLzss), CompressionAlgorithm::kNone);
+    return CompressionAlgorithm::kLzss;
+}
+
+CHIP_ERROR TransferSession::StartCompression()
+{
+    // The codec state is only allocated for the transfers that use it.
+    if (mRole == TransferRole::kSender)
+    {
+        mEncoder = Platform::MakeUnique<LzssEncoder>();
+        VerifyOrReturnError(mEncoder && mCompressedBlock.Alloc(mTransferMaxBlockSize), CHIP_ERROR_NO_MEMORY);
+    }
+    else
+    {
+        mDecoder = Platform::MakeUnique<LzssDecoder>();
+        VerifyOrReturnError(mDecoder, CHIP_ERROR_NO_MEMORY);
+    }
+
+    mCompression = CompressionAlgorithm::kLzss;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TransferSession::DecompressBlock(const uint8_t *& data, size_t & length, System::PacketBufferHandle & msgData)
+{
+    // The Block is decompressed in a buffer of its own, which replaces the message in the kBlockReceived event.
+    System::PacketBufferHandle decompressed = System::PacketBufferHandle::New(mTransferMaxBlockSize, 0);
+    VerifyOrReturnError(!decompressed.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    MutableByteSpan output(decompressed->Start(), mTransferMaxBlockSize);
+    ReturnErrorOnFailure(mDecoder->Decode(ByteSpan(data, length), output));
+    decompressed->SetDataLength(output.size());
+
+    data    = decompressed->Start();
+    length  = output.size();
+    msgData = std::move(decompressed);
+    return CHIP_NO_ERROR;
+}
+
+uint64_t TransferSession::TransferStats::GetBytesPerSecond() const
+{
+    VerifyOrReturnValue(Blocks > 0, 0);
+
+    // Count at least a millisecond, so that a transfer of a single Block does not divide by 0.
+    const uint64_t elapsedMs = std::max<uint64_t>((LastBlockTime - StartTime).count(), 1);
+    return Bytes * 1000 / elapsedMs;
+}
+
 const char * TransferSession::OutputEvent::ToString(OutputEventType outputEventType)
 {
     return TypeToString(outputEventType);
@@ -8,6 +8,9 @@
 #pragma once
 
 #include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/ScopedBuffer.h>
+#include <protocols/bdx/BdxCompression.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
@@ -106,6 +109,19 @@ public:
         uint64_t BytesToSkip = 0;
     };
 
+    /// Progress of the transfer, counting the Block messages sent or received since the transfer was accepted.
+    struct TransferStats
+    {
+        uint32_t Blocks                        = 0;
+        uint64_t Bytes                         = 0;
+        uint64_t CompressedBytes               = 0; ///< Block data sent or received on the wire, if compressed
+        System::Clock::Timestamp StartTime     = System::Clock::kZero; ///< When the transfer was accepted
+        System::Clock::Timestamp LastBlockTime = System::Clock::kZero; ///< When the last Block was sent or received
+
+        /// Average throughput since the transfer was accepted, 0 if no Block was sent or received yet.
+        uint64_t GetBytesPerSecond() const;
+    };
+
     /**
      * @brief
      *   All output data processed by the TransferSession object will be passed to the caller using this struct via PollOutput().
@@ -265,6 +281,9 @@ public:
      * @brief
      *   Prepare a Block message. The Block counter will be populated automatically.
      *
+     *   In the asynchronous control mode, Blocks may be prepared while fewer than CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE are waiting
+     *   for a BlockAck (see CanPrepareBlock()). Otherwise, one Block at a time may be prepared, when the receiver asks for it.
+     *
      * @param inData Contains data for filling out the Block message
      *
      * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
@@ -276,6 +295,9 @@ public:
      * @brief
      *   Prepare a BlockAck message. The Block counter will be populated automatically.
      *
+     *   In the asynchronous control mode, a BlockAck acknowledges all the Blocks received so far, and the sender may have more
+     *   Blocks in flight.
+     *
      * @return CHIP_ERROR The result of the preparation of a BlockAck message. May also indicate if the TransferSession object
      *                    is unable to handle this request.
      */
@@ -299,6 +321,20 @@ public:
      */
     void Reset();
 
+    /**
+     * @brief
+     *   Offer, or accept, to compress the Block data of the next transfer. Must be called before StartTransfer() or
+     *   WaitForTransfer(), since Reset() turns it off again.
+     *
+     *   Compression is negotiated in the Metadata of the TransferInit and Accept messages, so only when the application does
+     *   not provide Metadata of its own. Once negotiated, PrepareBlock() compresses the data and kBlockReceived events carry
+     *   the decompressed data, so the application only needs to limit Blocks to GetBlockDataSize().
+     */
+    void EnableCompression(bool enable);
+
+    /// Whether the peers agreed to compress the Block data of this transfer.
+    bool IsCompressed() const { return mCompression != CompressionAlgorithm::kNone; }
+
     /**
      * @brief
      *   Process a message intended for this TransferSession object.
@@ -315,12 +351,26 @@ public:
                                      System::Clock::Timestamp curTime);
 
     TransferControlFlags GetControlMode() const { return mControlMode; }
+    /// Control modes proposed by the TransferInit message received, to pick the ControlMode of AcceptTransfer() from.
+    BitFlags<TransferControlFlags> GetProposedControlOptions() const
+    {
+        return BitFlags<TransferControlFlags>(mTransferRequestData.TransferCtlFlags);
+    }
     uint64_t GetStartOffset() const { return mStartOffset; }
     uint64_t GetTransferLength() const { return mTransferLength; }
     uint16_t GetTransferBlockSize() const { return mTransferMaxBlockSize; }
+    /// Largest amount of data to pass to PrepareBlock(), smaller than GetTransferBlockSize() for a compressed transfer.
+    uint16_t GetBlockDataSize() const;
     uint32_t GetNextBlockNum() const { return mNextBlockNum; }
     uint32_t GetNextQueryNum() const { return mNextQueryNum; }
     size_t GetNumBytesProcessed() const { return mNumBytesProcessed; }
+    const TransferStats & GetTransferStats() const { return mStats; }
+
+    /// Number of Blocks sent that were not acknowledged yet.
+    uint32_t GetNumBlocksInFlight() const { return mNextBlockNum - mNextAckNum; }
+
+    /// Whether PrepareBlock() can be called now, as far as flow control is concerned.
+    bool CanPrepareBlock() const;
     const uint8_t * GetFileDesignator(uint16_t & fileDesignatorLen) const
     {
         fileDesignatorLen = mTransferRequestData.FileDesLength;
@@ -371,6 +421,14 @@ private:
 
     void PrepareStatusReport(StatusCode code);
     bool IsTransferLengthDefinite() const;
+    void StartTransferStats();
+    void RecordBlockStats(size_t length, size_t wireLength);
+
+    // Compression of the Block data, see EnableCompression()
+    CHIP_ERROR WriteCompressionMetadata(const uint8_t *& metadata, uint16_t & metadataLength);
+    static CompressionAlgorithm ReadCompressionMetadata(const uint8_t * metadata, uint16_t metadataLength);
+    CHIP_ERROR StartCompression();
+    CHIP_ERROR DecompressBlock(const uint8_t *& data, size_t & length, System::PacketBufferHandle & msgData);
 
     OutputEventType mPendingOutput = OutputEventType::kNone;
     TransferState mState           = TransferState::kUnitialized;
@@ -402,6 +460,18 @@ private:
     uint32_t mNextBlockNum = 0;
     uint32_t mLastQueryNum = 0;
     uint32_t mNextQueryNum = 0;
+    uint32_t mNextAckNum   = 0; ///< Sender: first Block that was not acknowledged yet
+
+    TransferStats mStats;
+
+    static constexpr size_t kCompressionMetadataSize = 16;
+
+    bool mCompressionEnabled          = false;
+    CompressionAlgorithm mCompression = CompressionAlgorithm::kNone;
+    uint8_t mCompressionMetadata[kCompressionMetadataSize];
+    Platform::UniquePtr<LzssEncoder> mEncoder;
+    Platform::UniquePtr<LzssDecoder> mDecoder;
+    Platform::ScopedMemoryBuffer<uint8_t> mCompressedBlock;
 
     System::Clock::Timeout mTimeout            = System::Clock::kZero;
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
@@ -0,0 +1,141 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <protocols/bdx/BdxCompression.h>
+
+using namespace ::chip;
+using namespace ::chip::bdx;
+
+namespace {
+
+constexpr size_t kBlockSize = 128;
+
+// Compress data in chunks of at most MaxDecodedLengthFor(kBlockSize) bytes, and check that each chunk decodes to the original.
+// Returns the total compressed length.
+size_t RoundTrip(const uint8_t * data, size_t length)
+{
+    LzssEncoder encoder;
+    LzssDecoder decoder;
+    size_t compressedLength = 0;
+
+    for (size_t offset = 0; offset < length;)
+    {
+        const size_t chunkLength = std::min(LzssCodec::MaxDecodedLengthFor(kBlockSize), length - offset);
+        uint8_t compressed[kBlockSize];
+        uint8_t decompressed[kBlockSize];
+
+        MutableByteSpan compressedSpan(compressed);
+        EXPECT_EQ(encoder.Encode(ByteSpan(data + offset, chunkLength), compressedSpan), CHIP_NO_ERROR);
+        EXPECT_LE(compressedSpan.size(), kBlockSize);
+
+        MutableByteSpan decompressedSpan(decompressed);
+        EXPECT_EQ(decoder.Decode(compressedSpan, decompressedSpan), CHIP_NO_ERROR);
+        EXPECT_EQ(decompressedSpan.size(), chunkLength);
+        EXPECT_EQ(0, memcmp(decompressedSpan.data(), data + offset, chunkLength));
+
+        compressedLength += compressedSpan.size();
+        offset += chunkLength;
+    }
+
+    return compressedLength;
+}
+
+TEST(TestBdxCompression, TestRepetitiveData)
+{
+    static const char kLine[] = "I [1234.567] [DMG] Refreshing subscription 0x1234, status OK\n";
+    uint8_t data[2048];
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(kLine[i % (sizeof(kLine) - 1)]);
+    }
+
+    // Back-references reach into previous chunks, so the repetition across chunks is compressed as well.
+    EXPECT_LT(RoundTrip(data, sizeof(data)), sizeof(data) / 4);
+}
+
+TEST(TestBdxCompression, TestIncompressibleData)
+{
+    uint8_t data[2048];
+    uint32_t state = 1;
+    for (auto & byte : data)
+    {
+        state = state * 1103515245u + 12345u;
+        byte  = static_cast<uint8_t>(state >> 24);
+    }
+
+    // The data expands, but every chunk still fits in a Block.
+    EXPECT_LE(RoundTrip(data, sizeof(data)), sizeof(data) + (sizeof(data) + 7) / 8 + kBlockSize);
+}
+
+TEST(TestBdxCompression, TestOverlappingMatch)
+{
+    uint8_t data[kBlockSize / 2];
+    memset(data, 'a', sizeof(data));
+
+    EXPECT_LT(RoundTrip(data, sizeof(data)), sizeof(data) / 4);
+}
+
+TEST(TestBdxCompression, TestOutputTooSmall)
+{
+    uint8_t data[64];
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    // Data without repetitions needs a flag byte for each 8 literals.
+    LzssEncoder encoder;
+    uint8_t compressed[sizeof(data) + sizeof(data) / 8];
+    MutableByteSpan tooSmall(compressed, sizeof(compressed) - 1);
+    EXPECT_EQ(encoder.Encode(ByteSpan(data), tooSmall), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // A failed chunk is not part of the stream, so it can be encoded again.
+    MutableByteSpan compressedSpan(compressed);
+    EXPECT_EQ(encoder.Encode(ByteSpan(data), compressedSpan), CHIP_NO_ERROR);
+    EXPECT_EQ(compressedSpan.size(), sizeof(compressed));
+
+    LzssDecoder decoder;
+    uint8_t decompressed[sizeof(data) - 1];
+    MutableByteSpan decompressedSpan(decompressed);
+    EXPECT_EQ(decoder.Decode(compressedSpan, decompressedSpan), CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+TEST(TestBdxCompression, TestInvalidInput)
+{
+    uint8_t decompressed[kBlockSize];
+
+    // A back-reference before the start of the stream.
+    const uint8_t beforeStart[] = { 0x00, 0x00, 0x10 };
+    LzssDecoder decoder;
+    MutableByteSpan output(decompressed);
+    EXPECT_EQ(decoder.Decode(ByteSpan(beforeStart), output), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // A truncated back-reference.
+    const uint8_t truncated[] = { 0x01, 'a', 0x00 };
+    LzssDecoder otherDecoder;
+    output = MutableByteSpan(decompressed);
+    EXPECT_EQ(otherDecoder.Decode(ByteSpan(truncated), output), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+} // namespace
@@ -530,6 +530,189 @@ TEST_F(TestBdxTransferSession, TestInitiatingSenderSenderDrive)
     SendAndVerifyBlockAck(initiatingSender, respondingReceiver, outEvent, true);
 }
 
+// Test a transfer where the Sender has several Blocks in flight, acknowledged at once by the Receiver.
+TEST_F(TestBdxTransferSession, TestInitiatingSenderAsyncWindow)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+
+    constexpr uint32_t kWindowSize = CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE;
+    uint16_t transferBlockSize     = 10;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+
+    BitFlags<TransferControlFlags> receiverOpts(TransferControlFlags::kSenderDrive, TransferControlFlags::kAsync);
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = BitFlags<TransferControlFlags>(TransferControlFlags::kSenderDrive, TransferControlFlags::kAsync);
+    initOptions.MaxBlockSize     = transferBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    SendAndVerifyTransferInit(outEvent, timeout, initiatingSender, TransferRole::kSender, initOptions, respondingReceiver,
+                              receiverOpts, transferBlockSize);
+    EXPECT_TRUE(respondingReceiver.GetProposedControlOptions().Has(TransferControlFlags::kAsync));
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kAsync;
+    acceptData.MaxBlockSize = transferBlockSize;
+    SendAndVerifyAcceptMsg(outEvent, respondingReceiver, TransferRole::kReceiver, acceptData, initiatingSender, initOptions);
+
+    // Fill the window without waiting for a BlockAck.
+    uint8_t blockData[10] = { 0 };
+    TransferSession::BlockData block;
+    block.Data   = blockData;
+    block.Length = sizeof(blockData);
+
+    TransferSession::MessageTypeData blockTypes[kWindowSize];
+    System::PacketBufferHandle blockMsgs[kWindowSize];
+    for (uint32_t i = 0; i < kWindowSize; i++)
+    {
+        EXPECT_TRUE(initiatingSender.CanPrepareBlock());
+        EXPECT_EQ(initiatingSender.PrepareBlock(block), CHIP_NO_ERROR);
+        initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+        VerifyBdxMessageToSend(outEvent, MessageType::Block);
+        blockTypes[i] = outEvent.msgTypeData;
+        blockMsgs[i]  = std::move(outEvent.MsgData);
+    }
+    EXPECT_EQ(initiatingSender.GetNumBlocksInFlight(), kWindowSize);
+    EXPECT_FALSE(initiatingSender.CanPrepareBlock());
+    EXPECT_EQ(initiatingSender.PrepareBlock(block), CHIP_ERROR_INCORRECT_STATE);
+
+    for (uint32_t i = 0; i < kWindowSize; i++)
+    {
+        err = AttachHeaderAndSend(blockTypes[i], std::move(blockMsgs[i]), respondingReceiver);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        respondingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+        EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kBlockReceived);
+        EXPECT_EQ(outEvent.blockdata.BlockCounter, i);
+    }
+
+    // A single BlockAck acknowledges the whole window.
+    SendAndVerifyBlockAck(initiatingSender, respondingReceiver, outEvent, false);
+    EXPECT_EQ(initiatingSender.GetNumBlocksInFlight(), 0u);
+
+    SendAndVerifyArbitraryBlock(initiatingSender, respondingReceiver, outEvent, true, kWindowSize);
+    SendAndVerifyBlockAck(initiatingSender, respondingReceiver, outEvent, true);
+
+    EXPECT_EQ(initiatingSender.GetTransferStats().Blocks, kWindowSize + 1);
+    EXPECT_EQ(respondingReceiver.GetTransferStats().Blocks, kWindowSize + 1);
+    EXPECT_EQ(respondingReceiver.GetTransferStats().Bytes, respondingReceiver.GetNumBytesProcessed());
+}
+
+// Exchange the TransferInit and Accept messages of a sender-drive transfer from an initiating sender, and return whether it is
+// compressed.
+bool NegotiateCompression(TransferSession & initiatingSender, TransferSession & respondingReceiver, uint16_t blockSize)
+{
+    TransferSession::OutputEvent outEvent;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+    BitFlags<TransferControlFlags> receiverOpts(TransferControlFlags::kSenderDrive);
+
+    EXPECT_EQ(respondingReceiver.WaitForTransfer(TransferRole::kReceiver, receiverOpts, blockSize, timeout), CHIP_NO_ERROR);
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = TransferControlFlags::kSenderDrive;
+    initOptions.MaxBlockSize     = blockSize;
+    char testFileDes[9]          = { "test.log" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+    EXPECT_EQ(initiatingSender.StartTransfer(TransferRole::kSender, initOptions, timeout), CHIP_NO_ERROR);
+
+    initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(outEvent, MessageType::SendInit);
+    EXPECT_EQ(AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), respondingReceiver), CHIP_NO_ERROR);
+    respondingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kInitReceived);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kSenderDrive;
+    acceptData.MaxBlockSize = blockSize;
+    EXPECT_EQ(respondingReceiver.AcceptTransfer(acceptData), CHIP_NO_ERROR);
+
+    respondingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(outEvent, MessageType::SendAccept);
+    EXPECT_EQ(AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingSender), CHIP_NO_ERROR);
+    initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kAcceptReceived);
+
+    EXPECT_EQ(initiatingSender.IsCompressed(), respondingReceiver.IsCompressed());
+    return initiatingSender.IsCompressed();
+}
+
+// Test a transfer whose Block data is compressed by the sender and decompressed by the receiver.
+TEST_F(TestBdxTransferSession, TestCompressedTransfer)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+    constexpr uint16_t kBlockSize = 128;
+
+    initiatingSender.EnableCompression(true);
+    respondingReceiver.EnableCompression(true);
+    ASSERT_TRUE(NegotiateCompression(initiatingSender, respondingReceiver, kBlockSize));
+    EXPECT_LT(initiatingSender.GetBlockDataSize(), kBlockSize);
+
+    static const char kLine[] = "I [1234.567] [DMG] Refreshing subscription 0x1234, status OK\n";
+    uint8_t blockData[kBlockSize];
+    for (size_t i = 0; i < sizeof(blockData); i++)
+    {
+        blockData[i] = static_cast<uint8_t>(kLine[i % (sizeof(kLine) - 1)]);
+    }
+
+    TransferSession::BlockData block;
+    block.Data   = blockData;
+    block.Length = sizeof(blockData);
+    EXPECT_EQ(initiatingSender.PrepareBlock(block), CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        block.Length = initiatingSender.GetBlockDataSize();
+        block.IsEof  = (i == 2);
+        EXPECT_EQ(initiatingSender.PrepareBlock(block), CHIP_NO_ERROR);
+        initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+        VerifyBdxMessageToSend(outEvent, block.IsEof ? MessageType::BlockEOF : MessageType::Block);
+        EXPECT_LT(outEvent.MsgData->DataLength(), block.Length);
+
+        EXPECT_EQ(AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), respondingReceiver), CHIP_NO_ERROR);
+        respondingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+        ASSERT_EQ(outEvent.EventType, TransferSession::OutputEventType::kBlockReceived);
+        ASSERT_EQ(outEvent.blockdata.Length, block.Length);
+        EXPECT_EQ(0, memcmp(outEvent.blockdata.Data, blockData, block.Length));
+        EXPECT_EQ(outEvent.blockdata.IsEof, block.IsEof);
+
+        SendAndVerifyBlockAck(initiatingSender, respondingReceiver, outEvent, block.IsEof);
+    }
+
+    const auto & stats = respondingReceiver.GetTransferStats();
+    EXPECT_EQ(stats.Bytes, respondingReceiver.GetNumBytesProcessed());
+    EXPECT_LT(stats.CompressedBytes, stats.Bytes);
+    EXPECT_EQ(initiatingSender.GetTransferStats().CompressedBytes, stats.CompressedBytes);
+}
+
+// Test that a transfer is not compressed unless both peers enable compression.
+TEST_F(TestBdxTransferSession, TestCompressionNotAccepted)
+{
+    constexpr uint16_t kBlockSize = 128;
+
+    {
+        TransferSession initiatingSender;
+        TransferSession respondingReceiver;
+        initiatingSender.EnableCompression(true);
+        EXPECT_FALSE(NegotiateCompression(initiatingSender, respondingReceiver, kBlockSize));
+        EXPECT_EQ(initiatingSender.GetBlockDataSize(), kBlockSize);
+    }
+
+    {
+        TransferSession initiatingSender;
+        TransferSession respondingReceiver;
+        respondingReceiver.EnableCompression(true);
+        EXPECT_FALSE(NegotiateCompression(initiatingSender, respondingReceiver, kBlockSize));
+        EXPECT_EQ(initiatingSender.GetBlockDataSize(), kBlockSize);
+    }
+}
+
 // Test that calls to AcceptTransfer() with bad parameters result in an error.
 TEST_F(TestBdxTransferSession, TestBadAcceptMessageFields)
 {
@@ -25,12 +25,51 @@
 #include <tracing/macros.h>
 #include <transport/SessionManager.h>
 
+#include <algorithm>
+
 using namespace ::chip::Inet;
 using namespace ::chip::Transport;
 using namespace ::chip::Credentials;
 
 namespace chip {
 
+CASEServer::CASEServer()
+{
+    for (auto & slot : mSlots)
+    {
+        slot.mServer = this;
+    }
+}
+
+void CASEServer::Shutdown()
+{
+    if (mExchangeManager != nullptr)
+    {
+        TEMPORARY_RETURN_IGNORED mExchangeManager->UnregisterUnsolicitedMessageHandlerForType(
+            Protocols::SecureChannel::MsgType::CASE_Sigma1);
+        mExchangeManager = nullptr;
+    }
+
+    if (mQueueHandlerScheduled)
+    {
+        mSessionManager->SystemLayer()->CancelTimer(HandleQueuedSigma1, this);
+        mQueueHandlerScheduled = false;
+    }
+
+    while (mQueueLength > 0)
+    {
+        Messaging::ExchangeContext * ec = mQueue[0].mExchange;
+        RemoveFromQueue(0);
+        ec->Close();
+    }
+
+    for (auto & slot : mSlots)
+    {
+        slot.mSession.Clear();
+        slot.mPinnedSecureSession.ClearValue();
+    }
+}
+
 CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, SessionManager * sessionManager,
                                                      FabricTable * fabrics, SessionResumptionStorage * sessionResumptionStorage,
                                                      Credentials::CertificateValidityPolicy * certificateValidityPolicy,
@@ -47,25 +86,27 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     mExchangeManager           = exchangeManager;
     mGroupDataProvider         = responderGroupDataProvider;
 
-    // Set up the group state provider that persists across all handshakes.
-    GetSession().SetGroupDataProvider(mGroupDataProvider);
-
     ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
     TEMPORARY_RETURN_IGNORED mExchangeManager->RegisterUnsolicitedMessageHandlerForType(
         Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
 
-    PrepareForSessionEstablishment();
+    for (auto & slot : mSlots)
+    {
+        // Set up the group state provider that persists across all handshakes.
+        slot.mSession.SetGroupDataProvider(mGroupDataProvider);
+        PrepareForSessionEstablishment(slot);
+    }
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASEServer::InitCASEHandshake(Messaging::ExchangeContext * ec)
+CHIP_ERROR CASEServer::InitCASEHandshake(Slot & slot, Messaging::ExchangeContext * ec)
 {
     MATTER_TRACE_SCOPE("InitCASEHandshake", "CASEServer");
     VerifyOrReturnError(ec != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
     // Hand over the exchange context to the CASE session.
-    ec->SetDelegate(&GetSession());
+    ec->SetDelegate(&slot.mSession);
 
     return CHIP_NO_ERROR;
 }
@@ -82,67 +123,75 @@ CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const
 {
     MATTER_TRACE_SCOPE("OnMessageReceived", "CASEServer");
 
-    bool busy = GetSession().GetState() != CASESession::State::kInitialized;
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASEServerBusy, busy = true);
-    if (busy)
-    {
-        // We are in the middle of CASE handshake
+    // A queued Sigma1 is handled once a slot is idle; its exchange stays open until then.
+    VerifyOrReturnError(!IsQueued(ec), CHIP_NO_ERROR);
 
-        // Invoke watchdog to fix any stuck handshakes
-        bool watchdogFired = GetSession().InvokeBackgroundWorkWatchdog();
-        if (!watchdogFired)
-        {
-            // Handshake wasn't stuck, send the busy status report and let the existing handshake continue.
+    if (!ec->GetSessionHandle()->IsUnauthenticatedSession())
+    {
+        ChipLogError(Inet, "CASE Server received Sigma1 message %s EC %p", "over encrypted session. Ignoring.", ec);
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
 
-            // A successful CASE handshake can take several seconds and some may time out (30 seconds or more).
+    Slot * slot = FindIdleSlot();
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASEServerBusy, slot = nullptr);
+    if (slot == nullptr)
+    {
+        // We are in the middle of CASE handshakes
 
-            System::Clock::Milliseconds16 delay = System::Clock::kZero;
-            if (GetSession().GetState() == CASESession::State::kSentSigma2)
-            {
-                // The delay should be however long we think it will take for
-                // that to time out.
-                auto sigma2Timeout = CASESession::ComputeSigma2ResponseTimeout(GetSession().GetRemoteMRPConfig());
-                if (sigma2Timeout < System::Clock::Milliseconds16::max())
-                {
-                    delay = std::chrono::duration_cast<System::Clock::Milliseconds16>(sigma2Timeout);
-                }
-                else
-                {
-                    // Avoid overflow issues, just wait for as long as we can to
-                    // get close to our expected Sigma2 timeout.
-                    delay = System::Clock::Milliseconds16::max();
-                }
-            }
-            else
-            {
-                // For now, setting minimum wait time to 5000 milliseconds if we
-                // have no other information.
-                delay = System::Clock::Milliseconds16(5000);
-            }
-            CHIP_ERROR err = SendBusyStatusReport(ec, delay);
-            if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Inet, "Failed to send the busy status report, err:%" CHIP_ERROR_FORMAT, err.Format());
-            }
-            return err;
+        // Invoke watchdogs to fix any stuck handshakes
+        bool watchdogFired = false;
+        for (auto & busySlot : mSlots)
+        {
+            watchdogFired = busySlot.mSession.InvokeBackgroundWorkWatchdog() || watchdogFired;
+        }
+        if (watchdogFired)
+        {
+            slot = FindIdleSlot();
         }
     }
 
-    if (!ec->GetSessionHandle()->IsUnauthenticatedSession())
+    if (slot == nullptr)
     {
-        ChipLogError(Inet, "CASE Server received Sigma1 message %s EC %p", "over encrypted session. Ignoring.", ec);
-        return CHIP_ERROR_INCORRECT_STATE;
+        // No handshake was stuck, hold the Sigma1 until a slot is idle if there is room for it, and otherwise send the
+        // busy status report and let the existing handshakes continue.
+        if (Enqueue(ec, payloadHeader, std::move(payload)))
+        {
+            ChipLogProgress(Inet, "CASE Server queued Sigma1 message EC %p, %u queued", ec, static_cast<unsigned>(mQueueLength));
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR err = SendBusyStatusReport(ec, ComputeBusyWaitTime());
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to send the busy status report, err:%" CHIP_ERROR_FORMAT, err.Format());
+        }
+        return err;
     }
 
     ChipLogProgress(Inet, "CASE Server received Sigma1 message %s EC %p", ". Starting handshake.", ec);
 
-    CHIP_ERROR err = InitCASEHandshake(ec);
-    SuccessOrExit(err);
+    return StartHandshake(*slot, ec, payloadHeader, std::move(payload));
+}
 
-    // TODO - Enable multiple concurrent CASE session establishment
-    // https://github.com/project-chip/connectedhomeip/issues/8342
+void CASEServer::OnExchangeClosing(Messaging::ExchangeContext * ec)
+{
+    for (size_t i = 0; i < mQueueLength; ++i)
+    {
+        if (mQueue[i].mExchange == ec)
+        {
+            RemoveFromQueue(i);
+            return;
+        }
+    }
+}
 
-    err = GetSession().OnMessageReceived(ec, payloadHeader, std::move(payload));
+CHIP_ERROR CASEServer::StartHandshake(Slot & slot, Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                      System::PacketBufferHandle && payload)
+{
+    CHIP_ERROR err = InitCASEHandshake(slot, ec);
+    SuccessOrExit(err);
+
+    err = slot.mSession.OnMessageReceived(ec, payloadHeader, std::move(payload));
     SuccessOrExit(err);
 
 exit:
@@ -151,9 +200,21 @@ exit:
     return err;
 }
 
-void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer)
+CASEServer::Slot * CASEServer::FindIdleSlot()
 {
-    GetSession().Clear();
+    for (auto & slot : mSlots)
+    {
+        if (slot.IsIdle())
+        {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+void CASEServer::PrepareForSessionEstablishment(Slot & slot, const ScopedNodeId & previouslyEstablishedPeer)
+{
+    slot.mSession.Clear();
 
     //
     // This releases our reference to a previously pinned session. If that was a successfully established session and is now
@@ -164,7 +225,7 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // de-allocated since no one else is holding onto this session. This will mean that when we get to allocating a session below,
     // we'll at least have one free session available in the session table, and won't need to evict an arbitrary session.
     //
-    mPinnedSecureSession.ClearValue();
+    slot.mPinnedSecureSession.ClearValue();
 
     //
     // Indicate to the underlying CASE session to prepare for session establishment requests coming its way. This will
@@ -182,9 +243,9 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // TODO(#17568): Once session eviction is actually in place, this call should NEVER fail and if so, is a logic bug.
     // Dying here on failure is even more appropriate then.
     //
-    VerifyOrDie(GetSession().PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
-                                                            mCertificateValidityPolicy, this, previouslyEstablishedPeer,
-                                                            GetLocalMRPConfig()) == CHIP_NO_ERROR);
+    VerifyOrDie(slot.mSession.PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
+                                                             mCertificateValidityPolicy, &slot, previouslyEstablishedPeer,
+                                                             GetLocalMRPConfig()) == CHIP_NO_ERROR);
 
     //
     // PairingSession::mSecureSessionHolder is a weak-reference. If MarkForEviction is called on this session, the session is
@@ -196,30 +257,170 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     //
     // Let's create a SessionHandle strong-reference to it to keep it resident.
     //
-    mPinnedSecureSession = GetSession().CopySecureSession();
+    slot.mPinnedSecureSession = slot.mSession.CopySecureSession();
 
     //
     // If we've gotten this far, it means we have successfully allocated a SecureSession to back our next attempt. If we haven't,
     // there is a bug somewhere and we should raise attention to it by dying.
     //
-    VerifyOrDie(mPinnedSecureSession.HasValue());
+    VerifyOrDie(slot.mPinnedSecureSession.HasValue());
+
+    // The slot is idle again, so a queued Sigma1 can take it.
+    ScheduleQueuedSigma1();
+}
+
+bool CASEServer::Enqueue(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                         System::PacketBufferHandle && payload)
+{
+    VerifyOrReturnValue(kQueueSize > 0, false);
+
+    bool isResumption = CASESession::IsSessionResumptionRequest(payload);
+    if (mQueueLength == kQueueSize)
+    {
+        VerifyOrReturnValue(isResumption, false);
+
+        // Make room by turning away the most recently queued full handshake.
+        size_t index = mQueueLength;
+        while (index > 0 && mQueue[index - 1].mIsResumption)
+        {
+            --index;
+        }
+        VerifyOrReturnValue(index > 0, false);
+
+        Messaging::ExchangeContext * displaced = mQueue[index - 1].mExchange;
+        RemoveFromQueue(index - 1);
+        CHIP_ERROR err = SendBusyStatusReport(displaced, ComputeBusyWaitTime());
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to send the busy status report, err:%" CHIP_ERROR_FORMAT, err.Format());
+            displaced->Close();
+        }
+    }
+
+    QueuedSigma1 & entry = mQueue[mQueueLength++];
+    entry.mExchange      = ec;
+    entry.mPayloadHeader = payloadHeader;
+    entry.mPayload       = std::move(payload);
+    entry.mIsResumption  = isResumption;
+    entry.mExpiry        = System::SystemClock().GetMonotonicTimestamp() +
+        CASESession::ComputeSigma1ResponseTimeout(GetLocalMRPConfig().ValueOr(GetDefaultMRPConfig()));
+
+    // Keep the exchange open until the Sigma1 is handled.
+    ec->WillSendMessage();
+    return true;
+}
+
+bool CASEServer::IsQueued(const Messaging::ExchangeContext * ec) const
+{
+    for (size_t i = 0; i < mQueueLength; ++i)
+    {
+        if (mQueue[i].mExchange == ec)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CASEServer::RemoveFromQueue(size_t index)
+{
+    for (size_t i = index; i + 1 < mQueueLength; ++i)
+    {
+        mQueue[i] = std::move(mQueue[i + 1]);
+    }
+    mQueue[--mQueueLength] = QueuedSigma1();
+}
+
+void CASEServer::ScheduleQueuedSigma1()
+{
+    VerifyOrReturn(mQueueLength > 0 && !mQueueHandlerScheduled);
+    mQueueHandlerScheduled =
+        (mSessionManager->SystemLayer()->StartTimer(System::Clock::kZero, HandleQueuedSigma1, this) == CHIP_NO_ERROR);
+}
+
+void CASEServer::HandleQueuedSigma1(System::Layer * systemLayer, void * context)
+{
+    auto * server                  = static_cast<CASEServer *>(context);
+    server->mQueueHandlerScheduled = false;
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    Slot * slot;
+    while (server->mQueueLength > 0 && (slot = server->FindIdleSlot()) != nullptr)
+    {
+        // Resumption requests are cheaper and go first, the rest are taken in arrival order.
+        size_t next = 0;
+        for (size_t i = 0; i < server->mQueueLength; ++i)
+        {
+            if (server->mQueue[i].mIsResumption)
+            {
+                next = i;
+                break;
+            }
+        }
+
+        QueuedSigma1 entry = std::move(server->mQueue[next]);
+        server->RemoveFromQueue(next);
+
+        // Keep the exchange alive until we know whether it still has to be closed.
+        Messaging::ExchangeHandle exchange(*entry.mExchange);
+        if (entry.mExpiry < now)
+        {
+            ChipLogProgress(Inet, "CASE Server dropping queued Sigma1 message EC %p: initiator stopped waiting", entry.mExchange);
+            exchange->Close();
+            continue;
+        }
+
+        ChipLogProgress(Inet, "CASE Server received Sigma1 message %s EC %p", ". Starting queued handshake.", entry.mExchange);
+        CHIP_ERROR err = server->StartHandshake(*slot, entry.mExchange, entry.mPayloadHeader, std::move(entry.mPayload));
+        if (err != CHIP_NO_ERROR && exchange->IsSendExpected())
+        {
+            // Nothing was sent in response, so nothing else is going to close the exchange.
+            exchange->Close();
+        }
+    }
+}
+
+System::Clock::Milliseconds16 CASEServer::ComputeBusyWaitTime()
+{
+    // A successful CASE handshake can take several seconds and some may time out (30 seconds or more).
+    System::Clock::Milliseconds32 untilIdle = System::Clock::Milliseconds32::max();
+    for (auto & slot : mSlots)
+    {
+        System::Clock::Milliseconds32 remaining = kExpectedHandshakeTime;
+        if (slot.mSession.GetState() == CASESession::State::kSentSigma2)
+        {
+            // The delay should be however long we think it will take for
+            // that to time out.
+            remaining = std::chrono::duration_cast<System::Clock::Milliseconds32>(
+                CASESession::ComputeSigma2ResponseTimeout(slot.mSession.GetRemoteMRPConfig()));
+        }
+        untilIdle = std::min(untilIdle, remaining);
+    }
+
+    // The idle slots then work through the queued Sigma1 messages, one handshake at a time each.
+    const uint64_t rounds = mQueueLength / kSlotCount;
+    const uint64_t delay  = untilIdle.count() + uint64_t{ kExpectedHandshakeTime.count() } * rounds;
+
+    // Avoid overflow issues, just wait for as long as we can if the estimate does not fit.
+    return System::Clock::Milliseconds16(
+        static_cast<uint16_t>(std::min<uint64_t>(delay, System::Clock::Milliseconds16::max().count())));
 }
 
-void CASEServer::OnSessionEstablishmentError(CHIP_ERROR err)
+void CASEServer::Slot::OnSessionEstablishmentError(CHIP_ERROR err)
 {
     MATTER_TRACE_SCOPE("OnSessionEstablishmentError", "CASEServer");
     ChipLogError(Inet, "CASE Session establishment failed: %" CHIP_ERROR_FORMAT, err.Format());
 
     MATTER_TRACE_SCOPE("CASEFail", "CASESession");
-    PrepareForSessionEstablishment();
+    mServer->PrepareForSessionEstablishment(*this);
 }
 
-void CASEServer::OnSessionEstablished(const SessionHandle & session)
+void CASEServer::Slot::OnSessionEstablished(const SessionHandle & session)
 {
     MATTER_TRACE_SCOPE("OnSessionEstablished", "CASEServer");
     ChipLogProgress(Inet, "CASE Session established to peer: " ChipLogFormatScopedNodeId,
                     ChipLogValueScopedNodeId(session->GetPeer()));
-    PrepareForSessionEstablishment(session->GetPeer());
+    mServer->PrepareForSessionEstablishment(*this, session->GetPeer());
 }
 
 CHIP_ERROR CASEServer::SendBusyStatusReport(Messaging::ExchangeContext * ec, System::Clock::Milliseconds16 minimumWaitTime)
@@ -26,42 +26,25 @@
 
 namespace chip {
 
-class CASEServer : public SessionEstablishmentDelegate,
-                   public Messaging::UnsolicitedMessageHandler,
-                   public Messaging::ExchangeDelegate
+class CASEServer : public Messaging::UnsolicitedMessageHandler, public Messaging::ExchangeDelegate
 {
 public:
-    CASEServer() {}
+    CASEServer();
     ~CASEServer() override { Shutdown(); }
 
     /*
-     * This method will shutdown this object, releasing the strong reference to the pinned SecureSession object.
-     * It will also unregister the unsolicited handler and clear out the session object (which will release the weak
-     * reference through the underlying SessionHolder).
+     * This method will shutdown this object, releasing the strong references to the pinned SecureSession objects.
+     * It will also unregister the unsolicited handler, drop the queued Sigma1 messages and clear out the session objects
+     * (which will release the weak references through the underlying SessionHolders).
      *
      */
-    void Shutdown()
-    {
-        if (mExchangeManager != nullptr)
-        {
-            TEMPORARY_RETURN_IGNORED mExchangeManager->UnregisterUnsolicitedMessageHandlerForType(
-                Protocols::SecureChannel::MsgType::CASE_Sigma1);
-            mExchangeManager = nullptr;
-        }
-
-        GetSession().Clear();
-        mPinnedSecureSession.ClearValue();
-    }
+    void Shutdown();
 
     CHIP_ERROR ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, SessionManager * sessionManager,
                                              FabricTable * fabrics, SessionResumptionStorage * sessionResumptionStorage,
                                              Credentials::CertificateValidityPolicy * policy,
                                              Credentials::GroupDataProvider * responderGroupDataProvider);
 
-    //////////// SessionEstablishmentDelegate Implementation ///////////////
-    void OnSessionEstablishmentError(CHIP_ERROR error) override;
-    void OnSessionEstablished(const SessionHandle & session) override;
-
     //// UnsolicitedMessageHandler Implementation ////
     CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override;
 
@@ -69,46 +52,106 @@ public:
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                  System::PacketBufferHandle && payload) override;
     void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
+    void OnExchangeClosing(Messaging::ExchangeContext * ec) override;
     Messaging::ExchangeMessageDispatch & GetMessageDispatch() override { return GetSession().GetMessageDispatch(); }
 
-    CASESession & GetSession() { return mPairingSession; }
+    CASESession & GetSession() { return mSlots[0].mSession; }
+
+    size_t GetQueuedSigma1Count() const { return mQueueLength; }
 
 private:
+    static constexpr size_t kSlotCount = CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES;
+    static constexpr size_t kQueueSize = CHIP_CONFIG_CASE_SERVER_ADMISSION_QUEUE_SIZE;
+    static_assert(kSlotCount > 0, "The CASE server needs at least one handshake slot");
+
+    // How long a handshake is expected to take when nothing more is known about it.
+    static constexpr System::Clock::Milliseconds32 kExpectedHandshakeTime = System::Clock::Milliseconds32(5000);
+
+    // A responder CASESession and what it needs to handle the next handshake.
+    class Slot : public SessionEstablishmentDelegate
+    {
+    public:
+        //////////// SessionEstablishmentDelegate Implementation ///////////////
+        void OnSessionEstablishmentError(CHIP_ERROR error) override;
+        void OnSessionEstablished(const SessionHandle & session) override;
+
+        bool IsIdle() { return mSession.GetState() == CASESession::State::kInitialized; }
+
+        CASEServer * mServer = nullptr;
+        CASESession mSession;
+
+        //
+        // When we're in the process of establishing a session, this is used
+        // to maintain an additional, strong reference to the underlying SecureSession.
+        // This is because the existing reference in PairingSession is a weak one
+        // (i.e a SessionHolder) and can lose its reference if the session is evicted
+        // for any reason.
+        //
+        // This initially points to a session that is not yet active. Upon activation, it
+        // transfers ownership of the session to the SecureSessionManager and this reference
+        // is released before simultaneously acquiring ownership of a new SecureSession.
+        //
+        Optional<SessionHandle> mPinnedSecureSession;
+    };
+
+    // A Sigma1 waiting for a slot to become idle.  Its exchange is kept open, with this server as its delegate.
+    struct QueuedSigma1
+    {
+        Messaging::ExchangeContext * mExchange = nullptr;
+        PayloadHeader mPayloadHeader;
+        System::PacketBufferHandle mPayload;
+        bool mIsResumption             = false;
+        System::Clock::Timestamp mExpiry = System::Clock::kZero; ///< When the initiator stops waiting for a response
+    };
+
     Messaging::ExchangeManager * mExchangeManager                       = nullptr;
     SessionResumptionStorage * mSessionResumptionStorage                = nullptr;
     Credentials::CertificateValidityPolicy * mCertificateValidityPolicy = nullptr;
 
-    //
-    // When we're in the process of establishing a session, this is used
-    // to maintain an additional, strong reference to the underlying SecureSession.
-    // This is because the existing reference in PairingSession is a weak one
-    // (i.e a SessionHolder) and can lose its reference if the session is evicted
-    // for any reason.
-    //
-    // This initially points to a session that is not yet active. Upon activation, it
-    // transfers ownership of the session to the SecureSessionManager and this reference
-    // is released before simultaneously acquiring ownership of a new SecureSession.
-    //
-    Optional<SessionHandle> mPinnedSecureSession;
-
-    CASESession mPairingSession;
+    Slot mSlots[kSlotCount];
     SessionManager * mSessionManager = nullptr;
 
     FabricTable * mFabrics                              = nullptr;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
 
-    CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
+    // Queued Sigma1 messages, oldest first.
+    QueuedSigma1 mQueue[kQueueSize > 0 ? kQueueSize : 1];
+    size_t mQueueLength         = 0;
+    bool mQueueHandlerScheduled = false;
+
+    CHIP_ERROR InitCASEHandshake(Slot & slot, Messaging::ExchangeContext * ec);
+
+    // Start the handshake of a Sigma1 on an idle slot.
+    CHIP_ERROR StartHandshake(Slot & slot, Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                              System::PacketBufferHandle && payload);
+
+    // An idle slot, or nullptr if all of them are in the middle of a handshake.
+    Slot * FindIdleSlot();
 
     /*
      * This will clean up any state from a previous session establishment
-     * attempt (if any) and setup the machinery to listen for and handle
+     * attempt (if any) on the slot and setup the machinery to listen for and handle
      * any session handshakes there-after.
      *
      * If a session had previously been established successfully, previouslyEstablishedPeer
      * should be set to the scoped node-id of the peer associated with that session.
      *
      */
-    void PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
+    void PrepareForSessionEstablishment(Slot & slot, const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
+
+    // Queue a Sigma1 received while all slots are busy.  If the queue is full, a resumption request takes the place of
+    // the most recently queued full handshake, which is answered Busy.  Returns false if the Sigma1 was not queued.
+    bool Enqueue(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader, System::PacketBufferHandle && payload);
+    bool IsQueued(const Messaging::ExchangeContext * ec) const;
+    void RemoveFromQueue(size_t index);
+
+    // Start the handshakes of queued Sigma1 messages on the idle slots, resumption requests first.
+    void ScheduleQueuedSigma1();
+    static void HandleQueuedSigma1(System::Layer * systemLayer, void * context);
+
+    // How long an initiator should wait before sending Sigma1 again: the time until the first slot becomes idle, plus
+    // expected handshake times for the Sigma1 messages queued ahead of it.
+    System::Clock::Milliseconds16 ComputeBusyWaitTime();
 
     // If we are in the middle of handshake and receive a Sigma1 then respond with Busy status code.
     // @param[in] ec              Exchange Context
@@ -35,6 +35,7 @@
 #include <lib/support/CHIPFaultInjection.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/MemoryTags.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/TypeTraits.h>
@@ -153,11 +154,99 @@ static constexpr ExchangeContext::Timeout kExpectedLowProcessingTime    = System
 static constexpr ExchangeContext::Timeout kExpectedSigma1ProcessingTime = kExpectedLowProcessingTime;
 static constexpr ExchangeContext::Timeout kExpectedHighProcessingTime   = System::Clock::Seconds16(30);
 
+namespace {
+
+// The part of CASESession::WorkHelper that does not depend on the work data: capping the background work of all sessions
+// that is outstanding at once to CHIP_CONFIG_CASE_MAX_CONCURRENT_BACKGROUND_WORK (0 for no cap).  Work scheduled beyond
+// the cap waits in a queue until earlier work is done.  The queue is only used on the Matter thread.
+class BackgroundWorkItem
+{
+public:
+    virtual ~BackgroundWorkItem() = default;
+
+protected:
+    static bool CanStartWork() { return (sFirstQueued == nullptr) && IsUnderCap(); }
+
+    // Count work handed to the background thread, until it calls WorkDone.
+    static void WorkStarted() { sInProgress++; }
+    static void WorkDone()
+    {
+        sInProgress--;
+        if (CHIP_CONFIG_CASE_MAX_CONCURRENT_BACKGROUND_WORK != 0)
+        {
+            // Best effort: queued work is also started whenever an after work callback is done.
+            RETURN_SAFELY_IGNORED DeviceLayer::PlatformMgr().ScheduleWork(StartQueuedWork);
+        }
+    }
+
+    bool IsQueued() const { return mQueued; }
+
+    void Enqueue()
+    {
+        mNextQueued = nullptr;
+        (sLastQueued != nullptr ? sLastQueued->mNextQueued : sFirstQueued) = this;
+        sLastQueued = this;
+        mQueued     = true;
+    }
+
+    void Dequeue()
+    {
+        VerifyOrReturn(mQueued);
+        BackgroundWorkItem ** link    = &sFirstQueued;
+        BackgroundWorkItem * previous = nullptr;
+        while (*link != this)
+        {
+            previous = *link;
+            link     = &previous->mNextQueued;
+        }
+        *link = mNextQueued;
+        if (sLastQueued == this)
+        {
+            sLastQueued = previous;
+        }
+        mNextQueued = nullptr;
+        mQueued     = false;
+    }
+
+    static void StartQueuedWork(intptr_t = 0)
+    {
+        assertChipStackLockedByCurrentThread();
+        while ((sFirstQueued != nullptr) && IsUnderCap())
+        {
+            BackgroundWorkItem * item = sFirstQueued;
+            item->Dequeue();
+            item->StartQueued();
+        }
+    }
+
+    // Start work taken off the queue.
+    virtual void StartQueued() = 0;
+
+private:
+    static bool IsUnderCap()
+    {
+#if CHIP_CONFIG_CASE_MAX_CONCURRENT_BACKGROUND_WORK > 0
+        return sInProgress.load() < CHIP_CONFIG_CASE_MAX_CONCURRENT_BACKGROUND_WORK;
+#else
+        return true;
+#endif
+    }
+
+    static inline std::atomic<uint32_t> sInProgress{ 0 };
+    static inline BackgroundWorkItem * sFirstQueued = nullptr;
+    static inline BackgroundWorkItem * sLastQueued  = nullptr;
+
+    BackgroundWorkItem * mNextQueued = nullptr;
+    bool mQueued                     = false;
+};
+
+} // namespace
+
 // Helper for managing a session's outstanding work.
 // Holds work data which is provided to a scheduled work callback (standalone),
 // then (if not canceled) to a scheduled after work callback (on the session).
 template <class DATA>
-class CASESession::WorkHelper
+class CASESession::WorkHelper : public BackgroundWorkItem
 {
 public:
     // Work callback, processed in the background via `PlatformManager::ScheduleBackgroundWork`.
@@ -176,6 +265,12 @@ public:
     // that it will keep itself (and hence `data`) alive until the callback completes.
     typedef CHIP_ERROR (CASESession::*AfterWorkCallback)(DATA & data, CHIP_ERROR status);
 
+    // Async start callback, called in the main Matter task by `StartAsyncWork` to start work that completes later
+    // on its own (e.g. in a secure element), by calling `completion` with `context` once, on the Matter thread.
+    // The work callback is then called on the Matter thread if the async work succeeded, then the after work callback.
+    typedef CHIP_ERROR (*AsyncStartCallback)(DATA & data, Crypto::OperationalKeystore::SignCompletion completion,
+                                             void * context);
+
 public:
     // Create a work helper using the specified session, work callback, after work callback, and data (template arg).
     // Lifetime is managed by sharing between the caller (typically the session) and the helper itself (while work is scheduled).
@@ -219,22 +314,51 @@ public:
 
     // Schedule the work for later execution.
     // If lifetime is managed, the helper shares management while work is outstanding.
+    // If too much background work is outstanding already, the work is queued and scheduled once earlier work is done.
     CHIP_ERROR ScheduleWork()
     {
+        assertChipStackLockedByCurrentThread();
+
         VerifyOrReturnError(mSession && mWorkCallback && mAfterWorkCallback, CHIP_ERROR_INCORRECT_STATE);
         // Hold strong ptr while work is outstanding
+        mStrongPtr = mWeakPtr.lock(); // set in `Create`
+        if (!CanStartWork())
+        {
+            Enqueue();
+            return CHIP_NO_ERROR;
+        }
+        return StartWork();
+    }
+
+    // Start async work, which does not use a background thread and is not capped with the background work.
+    // If lifetime is managed, the helper shares management until the async work completes.
+    CHIP_ERROR StartAsyncWork(AsyncStartCallback start)
+    {
+        assertChipStackLockedByCurrentThread();
+
+        VerifyOrReturnError(mSession && mWorkCallback && mAfterWorkCallback && start, CHIP_ERROR_INCORRECT_STATE);
+        // Hold strong ptr while work is outstanding
         mStrongPtr  = mWeakPtr.lock(); // set in `Create`
-        auto status = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(WorkHandler, reinterpret_cast<intptr_t>(this));
+        auto status = start(mData, AsyncWorkHandler, this);
         if (status != CHIP_NO_ERROR)
         {
-            // Release strong ptr since scheduling failed.
+            // Release strong ptr since no completion will come.
             mStrongPtr.reset();
         }
         return status;
     }
 
     // Cancel the work, by clearing the associated session.
-    void CancelWork() { mSession.store(nullptr); }
+    void CancelWork()
+    {
+        mSession.store(nullptr);
+        if (IsQueued())
+        {
+            // The work will not be started; the caller still holds a reference, so this does not destroy the helper.
+            Dequeue();
+            mStrongPtr.reset();
+        }
+    }
 
     bool IsCancelled() const { return mSession.load() == nullptr; }
 
@@ -256,16 +380,47 @@ private:
         mSession(&session), mWorkCallback(workCallback), mAfterWorkCallback(afterWorkCallback)
     {}
 
+    CHIP_ERROR StartWork()
+    {
+        WorkStarted();
+        auto status = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(WorkHandler, reinterpret_cast<intptr_t>(this));
+        if (status != CHIP_NO_ERROR)
+        {
+            // Release strong ptr since scheduling failed.
+            mStrongPtr.reset();
+            WorkDone();
+        }
+        return status;
+    }
+
+    void StartQueued() override
+    {
+        // Keep the helper alive in case starting fails, since that releases the reference held while queued.
+        auto strongPtr = mWeakPtr.lock();
+        auto status    = StartWork();
+        if (status != CHIP_NO_ERROR)
+        {
+            // Nothing is waiting for the status of ScheduleWork anymore; pass it to the after work callback instead.
+            mStatus = status;
+            AfterWorkHandler(reinterpret_cast<intptr_t>(this));
+        }
+    }
+
     // Handler for the work callback.
     static void WorkHandler(intptr_t arg)
     {
         auto * helper = reinterpret_cast<WorkHelper *>(arg);
         // Hold strong ptr while work is handled
         auto strongPtr(std::move(helper->mStrongPtr));
-        VerifyOrReturn(!helper->IsCancelled());
+        if (helper->IsCancelled())
+        {
+            WorkDone();
+            return;
+        }
         bool cancel = false;
         // Execute callback in background thread; data must be OK with this
         helper->mStatus = helper->mWorkCallback(helper->mData, cancel);
+        WorkDone();
         VerifyOrReturn(!cancel && !helper->IsCancelled());
         // Hold strong ptr to ourselves while work is outstanding
         helper->mStrongPtr.swap(strongPtr);
@@ -319,6 +474,32 @@ private:
             // Execute callback in Matter thread; session should be OK with this
             TEMPORARY_RETURN_IGNORED(session->*(helper->mAfterWorkCallback))(helper->mData, helper->mStatus);
         }
+
+        StartQueuedWork();
+    }
+
+    // Handler for the completion of async work.
+    static void AsyncWorkHandler(void * context, CHIP_ERROR result)
+    {
+        // Ensure that this function is being called from main Matter thread
+        assertChipStackLockedByCurrentThread();
+
+        auto * helper = static_cast<WorkHelper *>(context);
+        // Hold strong ptr while work is handled; the async work was holding the helper alive until now.
+        auto strongPtr(std::move(helper->mStrongPtr));
+        auto * session = helper->mSession.load();
+        VerifyOrReturn(session != nullptr);
+
+        bool cancel     = false;
+        helper->mStatus = result;
+        if (result == CHIP_NO_ERROR)
+        {
+            helper->mStatus = helper->mWorkCallback(helper->mData, cancel);
+        }
+        if (!cancel)
+        {
+            TEMPORARY_RETURN_IGNORED(session->*(helper->mAfterWorkCallback))(helper->mData, helper->mStatus);
+        }
     }
 
 private:
@@ -369,6 +550,11 @@ void CASESession::Clear()
 {
     MATTER_TRACE_SCOPE("Clear", "CASESession");
     // Cancel any outstanding work.
+    if (mHandleSigma2Helper)
+    {
+        mHandleSigma2Helper->CancelWork();
+        mHandleSigma2Helper.reset();
+    }
     if (mSendSigma3Helper)
     {
         mSendSigma3Helper->CancelWork();
@@ -489,6 +675,7 @@ CHIP_ERROR CASESession::EstablishSession(SessionManager & sessionManager, Fabric
                                          Optional<ReliableMessageProtocolConfig> mrpLocalConfig)
 {
     MATTER_TRACE_SCOPE("EstablishSession", "CASESession");
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kCrypto);
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     // Return early on error here, as we have not initialized any state yet
@@ -947,7 +1134,7 @@ CHIP_ERROR CASESession::FindLocalNodeFromDestinationId(const ByteSpan & destinat
         FabricId fabricId = fabricInfo.GetFabricId();
         NodeId nodeId     = fabricInfo.GetNodeId();
         Crypto::P256PublicKey rootPubKey;
-        ReturnErrorOnFailure(mFabricsTable->FetchRootPubkey(fabricInfo.GetFabricIndex(), rootPubKey));
+        ReturnErrorOnFailure(fabricInfo.FetchRootPubkey(rootPubKey));
         Credentials::P256PublicKeySpan rootPubKeySpan{ rootPubKey.ConstBytes() };
 
         // Get IPK operational group key set for current candidate fabric
@@ -1381,6 +1568,7 @@ CHIP_ERROR CASESession::HandleSigma2Resume(System::PacketBufferHandle && msg)
 
     MATTER_LOG_METRIC(kMetricDeviceCASESessionSigmaFinished);
     SendStatusReport(mExchangeCtxt, kProtocolCodeSuccess);
+    MATTER_LOG_METRIC_END(kMetricDeviceCASESession);
 
     mState = State::kFinishedViaResume;
     Finish();
@@ -1436,27 +1624,18 @@ CHIP_ERROR CASESession::ParseSigma2Resume(ContiguousBufferTLVReader & tlvReader,
 CHIP_ERROR CASESession::HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2_and_SendSigma3", "CASESession");
-    CHIP_ERROR err = HandleSigma2(std::move(msg));
-    MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
-    SuccessOrExit(err);
-
-    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma3);
-    err = SendSigma3a();
-    if (CHIP_NO_ERROR != err)
-    {
-        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3, err);
-    }
-
-exit:
+    // On success, the responder's credentials are verified in the background, and Sigma3 is sent from HandleSigma2c.
+    CHIP_ERROR err = HandleSigma2a(std::move(msg));
     if (CHIP_NO_ERROR != err)
     {
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
         mState = State::kInitialized;
     }
     return err;
 }
 
-CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
+CHIP_ERROR CASESession::HandleSigma2a(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2", "CASESession");
     ChipLogProgress(SecureChannel, "Received Sigma2 msg");
@@ -1467,12 +1646,15 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     size_t buflen       = msg->DataLength();
     VerifyOrReturnError(buf != nullptr, CHIP_ERROR_MESSAGE_INCOMPLETE);
 
-    FabricId fabricId = kUndefinedFabricId;
+    auto helper = WorkHelper<HandleSigma2Data>::Create(*this, &HandleSigma2b, &CASESession::HandleSigma2c);
+    VerifyOrReturnError(helper, CHIP_ERROR_NO_MEMORY);
+    auto & data = helper->mData;
+
     {
         VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
         const auto * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
         VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INCORRECT_STATE);
-        fabricId = fabricInfo->GetFabricId();
+        data.fabricId = fabricInfo->GetFabricId();
     }
 
     System::PacketBufferTLVReader tlvReader;
@@ -1511,60 +1693,141 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     ParsedSigma2TBEData parsedSigma2TBEData;
     ReturnErrorOnFailure(ParseSigma2TBEData(decryptedDataTlvReader, parsedSigma2TBEData));
 
-    // Validate responder identity located in msgR2Decrypted
-    // Constructing responder identity
-    P256PublicKey responderPublicKey;
-    {
-        NodeId responderNodeId;
-
-        CompressedFabricId unused;
-        FabricId responderFabricId;
-        ReturnErrorOnFailure(SetEffectiveTime());
-        ReturnErrorOnFailure(mFabricsTable->VerifyCredentials(mFabricIndex, parsedSigma2TBEData.responderNOC,
-                                                              parsedSigma2TBEData.responderICAC, mValidContext, unused,
-                                                              responderFabricId, responderNodeId, responderPublicKey));
-        VerifyOrReturnError(fabricId == responderFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
-        // Verify that responderNodeId (from responderNOC) matches one that was included
-        // in the computation of the Destination Identifier when generating Sigma1.
-        VerifyOrReturnError(mPeerNodeId == responderNodeId, CHIP_ERROR_INVALID_CASE_PARAMETER);
-    }
-
-    // Construct msgR2Signed and validate the signature in msgR2Decrypted.
+    // Construct msgR2Signed, whose signature in msgR2Decrypted is validated in the background.
     size_t msgR2SignedLen = EstimateStructOverhead(parsedSigma2TBEData.responderNOC.size(),  // resonderNOC
                                                    parsedSigma2TBEData.responderICAC.size(), // responderICAC
                                                    kP256_PublicKey_Length,                   // responderEphPubKey
                                                    kP256_PublicKey_Length                    // initiatorEphPubKey
     );
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
-    VerifyOrReturnError(msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
-    MutableByteSpan msgR2SignedSpan{ msgR2Signed.Get(), msgR2SignedLen };
+    VerifyOrReturnError(data.msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
+    data.msgR2SignedSpan = MutableByteSpan{ data.msgR2Signed.Get(), msgR2SignedLen };
 
     ReturnErrorOnFailure(ConstructTBSData(parsedSigma2TBEData.responderNOC, parsedSigma2TBEData.responderICAC,
                                           ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
-                                          ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()), msgR2SignedSpan));
+                                          ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
+                                          data.msgR2SignedSpan));
+
+    // Prepare for validating the responder identity
+    {
+        MutableByteSpan fabricRCAC{ data.rootCertBuf };
+        ReturnErrorOnFailure(mFabricsTable->FetchRootCert(mFabricIndex, fabricRCAC));
+        data.fabricRCAC = fabricRCAC;
+        ReturnErrorOnFailure(SetEffectiveTime());
+    }
+
+    // Copy remaining needed data into work structure
+    {
+        data.verifiedCertificates               = mFabricsTable->GetVerifiedCertificateCache();
+        data.validContext                       = mValidContext;
+        data.validContext.mVerifiedCertificates = &data.verifiedCertificates;
+        data.responderNodeId                    = mPeerNodeId;
+        data.tbsData2Signature                  = parsedSigma2TBEData.tbsData2Signature;
+        std::copy(parsedSigma2TBEData.resumptionId.begin(), parsedSigma2TBEData.resumptionId.end(), data.resumptionId.begin());
+        data.responderSessionId                 = parsedSigma2.responderSessionId;
+        data.responderSessionParams             = parsedSigma2.responderSessionParams;
+        data.responderSessionParamStructPresent = parsedSigma2.responderSessionParamStructPresent;
+
+        // The responder NOC and ICAC are spans into msgR2Decrypted, which is going away, so redirect them to their copies
+        // in msgR2Signed, which is staying around.
+        TLVType containerType = kTLVType_Structure;
+        TLV::ContiguousBufferTLVReader signedDataTlvReader;
+        signedDataTlvReader.Init(data.msgR2SignedSpan);
+        ReturnErrorOnFailure(signedDataTlvReader.Next(containerType, AnonymousTag()));
+        ReturnErrorOnFailure(signedDataTlvReader.EnterContainer(containerType));
+
+        ReturnErrorOnFailure(signedDataTlvReader.Next(AsTlvContextTag(TBSDataTags::kSenderNOC)));
+        ReturnErrorOnFailure(signedDataTlvReader.GetByteView(data.responderNOC));
+
+        if (!parsedSigma2TBEData.responderICAC.empty())
+        {
+            ReturnErrorOnFailure(signedDataTlvReader.Next(AsTlvContextTag(TBSDataTags::kSenderICAC)));
+            ReturnErrorOnFailure(signedDataTlvReader.GetByteView(data.responderICAC));
+        }
+
+        ReturnErrorOnFailure(signedDataTlvReader.ExitContainer(containerType));
+    }
+
+    ReturnErrorOnFailure(helper->ScheduleWork());
+    mHandleSigma2Helper = helper;
+    mExchangeCtxt.Value()->WillSendMessage();
+    mState = State::kHandleSigma2Pending;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::HandleSigma2b(HandleSigma2Data & data, bool & cancel)
+{
+    // Validate responder identity located in msgR2Decrypted
+    CompressedFabricId unused;
+    FabricId responderFabricId;
+    NodeId responderNodeId;
+    P256PublicKey responderPublicKey;
+    ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.responderNOC, data.responderICAC, data.fabricRCAC, data.validContext,
+                                                        unused, responderFabricId, responderNodeId, responderPublicKey,
+                                                        /* outRootPublicKey = */ nullptr, &data.responderCATs));
+    VerifyOrReturnError(data.fabricId == responderFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+    // Verify that responderNodeId (from responderNOC) matches one that was included
+    // in the computation of the Destination Identifier when generating Sigma1.
+    VerifyOrReturnError(data.responderNodeId == responderNodeId, CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     // Validate signature
-    ReturnErrorOnFailure(responderPublicKey.ECDSA_validate_msg_signature(msgR2SignedSpan.data(), msgR2SignedSpan.size(),
-                                                                         parsedSigma2TBEData.tbsData2Signature));
+    ReturnErrorOnFailure(responderPublicKey.ECDSA_validate_msg_signature(data.msgR2SignedSpan.data(), data.msgR2SignedSpan.size(),
+                                                                         data.tbsData2Signature));
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::HandleSigma2c(HandleSigma2Data & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    VerifyOrExit(mState == State::kHandleSigma2Pending, err = CHIP_ERROR_INCORRECT_STATE);
+
+    SuccessOrExit(err = status);
+
+    mFabricsTable->GetVerifiedCertificateCache().Add(data.verifiedCertificates);
 
     ChipLogDetail(SecureChannel, "Peer " ChipLogFormatScopedNodeId " assigned session ID %d", ChipLogValueScopedNodeId(GetPeer()),
-                  parsedSigma2.responderSessionId);
-    SetPeerSessionId(parsedSigma2.responderSessionId);
+                  data.responderSessionId);
+    SetPeerSessionId(data.responderSessionId);
 
-    std::copy(parsedSigma2TBEData.resumptionId.begin(), parsedSigma2TBEData.resumptionId.end(), mNewResumptionId.begin());
+    mNewResumptionId = data.resumptionId;
 
-    // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
-    ReturnErrorOnFailure(ExtractCATsFromOpCert(parsedSigma2TBEData.responderNOC, mPeerCATs));
+    // Peer CASE Authenticated Tags (CATs) from peer's NOC.
+    mPeerCATs = data.responderCATs;
 
-    if (parsedSigma2.responderSessionParamStructPresent)
+    if (data.responderSessionParamStructPresent)
     {
-        SetRemoteSessionParameters(parsedSigma2.responderSessionParams);
+        SetRemoteSessionParameters(data.responderSessionParams);
         mExchangeCtxt.Value()->GetSessionHandle()->AsUnauthenticatedSession()->SetRemoteSessionParameters(
             GetRemoteSessionParameters());
     }
 
-    return CHIP_NO_ERROR;
+exit:
+    mHandleSigma2Helper.reset();
+    MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
+
+    if (err == CHIP_NO_ERROR)
+    {
+        MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma3);
+        err = SendSigma3a();
+        if (CHIP_NO_ERROR != err)
+        {
+            MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3, err);
+        }
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        // Abort the pending establish, which is normally done by CASESession::OnMessageReceived,
+        // but in the background processing case must be done here.
+        DiscardExchange();
+        AbortPendingEstablish(err);
+    }
+
+    return err;
 }
 
 CHIP_ERROR CASESession::ParseSigma2(ContiguousBufferTLVReader & tlvReader, ParsedSigma2 & outParsedSigma2)
@@ -1692,11 +1955,19 @@ CHIP_ERROR CASESession::SendSigma3a()
         data.fabricTable = nullptr;
         data.keystore    = nullptr;
 
+        data.keystoreSignsAsync = false;
+
         {
             const FabricInfo * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
             VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
             auto * keystore = mFabricsTable->GetOperationalKeystore();
-            if (!fabricInfo->HasOperationalKey() && keystore != nullptr && keystore->SupportsSignWithOpKeypairInBackground())
+            if (!fabricInfo->HasOperationalKey() && keystore != nullptr && keystore->SupportsSignWithOpKeypairAsync())
+            {
+                // NOTE: signed by the keystore, which completes later.
+                data.keystore           = keystore;
+                data.keystoreSignsAsync = true;
+            }
+            else if (!fabricInfo->HasOperationalKey() && keystore != nullptr && keystore->SupportsSignWithOpKeypairInBackground())
             {
                 // NOTE: used to sign in background.
                 data.keystore = keystore;
@@ -1741,7 +2012,14 @@ CHIP_ERROR CASESession::SendSigma3a()
                                               ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
                                               ByteSpan(mRemotePubKey, mRemotePubKey.Length()), data.msgR3SignedSpan));
 
-        if (data.keystore != nullptr)
+        if (data.keystoreSignsAsync)
+        {
+            ReturnErrorOnFailure(helper->StartAsyncWork(&SendSigma3Sign));
+            mSendSigma3Helper = helper;
+            mExchangeCtxt.Value()->WillSendMessage();
+            mState = State::kSendSigma3Pending;
+        }
+        else if (data.keystore != nullptr)
         {
             ReturnErrorOnFailure(helper->ScheduleWork());
             mSendSigma3Helper = helper;
@@ -1757,10 +2035,21 @@ CHIP_ERROR CASESession::SendSigma3a()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CASESession::SendSigma3Sign(SendSigma3Data & data, Crypto::OperationalKeystore::SignCompletion completion,
+                                       void * context)
+{
+    return data.keystore->SignWithOpKeypairAsync(data.fabricIndex, data.msgR3SignedSpan, data.tbsData3Signature, completion,
+                                                 context);
+}
+
 CHIP_ERROR CASESession::SendSigma3b(SendSigma3Data & data, bool & cancel)
 {
     // Generate a signature
-    if (data.keystore != nullptr)
+    if (data.keystoreSignsAsync)
+    {
+        // Already signed by `SendSigma3Sign`
+    }
+    else if (data.keystore != nullptr)
     {
         // Recommended case: delegate to operational keystore
         ReturnErrorOnFailure(data.keystore->SignWithOpKeypair(data.fabricIndex, data.msgR3SignedSpan, data.tbsData3Signature));
@@ -1979,7 +2268,9 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
 
         // Copy remaining needed data into work structure
         {
-            data.validContext = mValidContext;
+            data.verifiedCertificates               = mFabricsTable->GetVerifiedCertificateCache();
+            data.validContext                       = mValidContext;
+            data.validContext.mVerifiedCertificates = &data.verifiedCertificates;
 
             // initiatorNOC and initiatorICAC are spans into msgR3Encrypted
             // which is going away, so to save memory, redirect them to their
@@ -2093,7 +2384,8 @@ CHIP_ERROR CASESession::HandleSigma3b(HandleSigma3Data & data, bool & cancel)
     FabricId initiatorFabricId;
     P256PublicKey initiatorPublicKey;
     ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC, data.validContext,
-                                                        unused, initiatorFabricId, data.initiatorNodeId, initiatorPublicKey));
+                                                        unused, initiatorFabricId, data.initiatorNodeId, initiatorPublicKey,
+                                                        /* outRootPublicKey = */ nullptr, &data.initiatorCATs));
     VerifyOrReturnError(data.fabricId == initiatorFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     // Step 7 - Validate Signature
@@ -2111,6 +2403,8 @@ CHIP_ERROR CASESession::HandleSigma3c(HandleSigma3Data & data, CHIP_ERROR status
 
     SuccessOrExit(err = status);
 
+    mFabricsTable->GetVerifiedCertificateCache().Add(data.verifiedCertificates);
+
     mPeerNodeId = data.initiatorNodeId;
 
     {
@@ -2118,10 +2412,8 @@ CHIP_ERROR CASESession::HandleSigma3c(HandleSigma3Data & data, CHIP_ERROR status
         SuccessOrExit(err = mCommissioningHash.Finish(messageDigestSpan));
     }
 
-    // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
-    {
-        SuccessOrExit(err = ExtractCATsFromOpCert(data.initiatorNOC, mPeerCATs));
-    }
+    // Peer CASE Authenticated Tags (CATs) from peer's NOC.
+    mPeerCATs = data.initiatorCATs;
 
     if (mSessionResumptionStorage != nullptr)
     {
@@ -2316,6 +2608,8 @@ void CASESession::OnSuccessStatusReport()
     switch (mState)
     {
     case State::kSentSigma3:
+        // Only the initiator tracks the overall session establishment.
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESession);
         mState = State::kFinished;
         break;
     case State::kSentSigma2Resume:
@@ -2469,6 +2763,7 @@ CHIP_ERROR CASESession::OnMessageReceived(ExchangeContext * ec, const PayloadHea
                                           System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("OnMessageReceived", "CASESession");
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kCrypto);
     CHIP_ERROR err                            = ValidateReceivedMessage(ec, payloadHeader, msg);
     Protocols::SecureChannel::MsgType msgType = static_cast<Protocols::SecureChannel::MsgType>(payloadHeader.GetMessageType());
     SuccessOrExit(err);
@@ -2642,10 +2937,27 @@ System::Clock::Timeout CASESession::ComputeSigma2ResponseTimeout(const ReliableM
     return ComputeRoundTripTimeout(kExpectedHighProcessingTime, remoteMrpConfig, false /*isFirstMessageOnExchange*/);
 }
 
+bool CASESession::IsSessionResumptionRequest(const System::PacketBufferHandle & sigma1)
+{
+    VerifyOrReturnValue(!sigma1.IsNull(), false);
+
+    TLV::ContiguousBufferTLVReader tlvReader;
+    tlvReader.Init(sigma1->Start(), sigma1->DataLength());
+    ParsedSigma1 parsedSigma1;
+    return ParseSigma1(tlvReader, parsedSigma1) == CHIP_NO_ERROR && parsedSigma1.sessionResumptionRequested;
+}
+
 bool CASESession::InvokeBackgroundWorkWatchdog()
 {
     bool watchdogFired = false;
 
+    if (mHandleSigma2Helper && mHandleSigma2Helper->UnableToScheduleAfterWorkCallback())
+    {
+        ChipLogError(SecureChannel, "HandleSigma2Helper was unable to schedule the AfterWorkCallback");
+        mHandleSigma2Helper->DoAfterWork();
+        watchdogFired = true;
+    }
+
     if (mSendSigma3Helper && mSendSigma3Helper->UnableToScheduleAfterWorkCallback())
     {
         ChipLogError(SecureChannel, "SendSigma3Helper was unable to schedule the AfterWorkCallback");
@@ -2676,6 +2988,7 @@ SessionEstablishmentStage CASESession::MapCASEStateToSessionEstablishmentStage(S
     case State::kSentSigma2:
     case State::kSentSigma2Resume:
         return SessionEstablishmentStage::kSentSigma2;
+    case State::kHandleSigma2Pending:
     case State::kSendSigma3Pending:
         return SessionEstablishmentStage::kReceivedSigma2;
     case State::kSentSigma3:
@@ -165,6 +165,9 @@ public:
     // how long it will take to detect that our Sigma1 did not get through.
     static System::Clock::Timeout ComputeSigma2ResponseTimeout(const ReliableMessageProtocolConfig & remoteMrpConfig);
 
+    // Whether a received Sigma1 message asks to resume a previous session.  Malformed messages do not.
+    static bool IsSessionResumptionRequest(const System::PacketBufferHandle & sigma1);
+
     // TODO: remove Clear, we should create a new instance instead reset the old instance.
     /** @brief This function zeroes out and resets the memory used by the object.
      **/
@@ -182,6 +185,7 @@ public:
         kFinishedViaResume   = 7,
         kSendSigma3Pending   = 8,
         kHandleSigma3Pending = 9,
+        kHandleSigma2Pending = 10,
     };
 
     State GetState() { return mState; }
@@ -242,9 +246,9 @@ protected:
     };
     struct ParsedSigma2
     {
-        // Below ByteSpans are Backed by: Sigma2 PacketBuffer passed to the method HandleSigma2()
-        // Lifetime: Valid for the lifetime of the TLVReader, which takes ownership of the Sigma2 PacketBuffer in the HandleSigma2()
-        // method.
+        // Below ByteSpans are Backed by: Sigma2 PacketBuffer passed to the method HandleSigma2a()
+        // Lifetime: Valid for the lifetime of the TLVReader, which takes ownership of the Sigma2 PacketBuffer in the
+        // HandleSigma2a() method.
         ByteSpan responderRandom;
         ByteSpan responderEphPubKey;
 
@@ -290,6 +294,37 @@ protected:
         bool responderSessionParamStructPresent = false;
     };
 
+    struct HandleSigma2Data
+    {
+        chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
+        MutableByteSpan msgR2SignedSpan;
+
+        // Below ByteSpans are Backed by: msgR2Decrypted Buffer, local to the HandleSigma2a() method,
+        // The Spans are later modified to point to the msgR2Signed member of this struct.
+        ByteSpan responderNOC;
+        ByteSpan responderICAC;
+
+        uint8_t rootCertBuf[Credentials::kMaxCHIPCertLength];
+        ByteSpan fabricRCAC;
+
+        Crypto::P256ECDSASignature tbsData2Signature;
+
+        FabricId fabricId;
+        // The node ID included in the computation of the Destination Identifier of Sigma1.
+        NodeId responderNodeId;
+        // CATs of responderNOC, taken from its decoding for validation.
+        CATValues responderCATs;
+
+        Credentials::ValidationContext validContext;
+        // Copy of the fabric table's cache used by validContext in the background, merged back on success.
+        Credentials::VerifiedCertificateCache verifiedCertificates;
+
+        SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        SessionParameters responderSessionParams;
+        uint16_t responderSessionId;
+        bool responderSessionParamStructPresent = false;
+    };
+
     struct SendSigma3Data
     {
         FabricIndex fabricIndex;
@@ -297,6 +332,8 @@ protected:
         // Use one or the other
         const FabricTable * fabricTable;
         const Crypto::OperationalKeystore * keystore;
+        // Whether `keystore` signs with `SignWithOpKeypairAsync`, in which case the signature is done before `SendSigma3b`.
+        bool keystoreSignsAsync;
 
         chip::Platform::ScopedMemoryBuffer<uint8_t> msgR3Signed;
         MutableByteSpan msgR3SignedSpan;
@@ -330,8 +367,12 @@ protected:
 
         FabricId fabricId;
         NodeId initiatorNodeId;
+        // CATs of initiatorNOC, taken from its decoding for validation.
+        CATValues initiatorCATs;
 
         Credentials::ValidationContext validContext;
+        // Copy of the fabric table's cache used by validContext in the background, merged back on success.
+        Credentials::VerifiedCertificateCache verifiedCertificates;
     };
 
     /**
@@ -462,6 +503,8 @@ protected:
      **/
     static CHIP_ERROR ParseSigma3TBEData(TLV::ContiguousBufferTLVReader & tlvReader, HandleSigma3Data & data);
 
+    static CHIP_ERROR HandleSigma2b(HandleSigma2Data & data, bool & cancel);
+
     static CHIP_ERROR HandleSigma3b(HandleSigma3Data & data, bool & cancel);
 
 private:
@@ -499,10 +542,13 @@ private:
     CHIP_ERROR SendSigma2Resume(System::PacketBufferHandle && msg_R2_resume);
 
     CHIP_ERROR HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg);
-    CHIP_ERROR HandleSigma2(System::PacketBufferHandle && msg);
+    CHIP_ERROR HandleSigma2a(System::PacketBufferHandle && msg);
+    CHIP_ERROR HandleSigma2c(HandleSigma2Data & data, CHIP_ERROR status);
     CHIP_ERROR HandleSigma2Resume(System::PacketBufferHandle && msg);
 
     CHIP_ERROR SendSigma3a();
+    static CHIP_ERROR SendSigma3Sign(SendSigma3Data & data, Crypto::OperationalKeystore::SignCompletion completion,
+                                     void * context);
     static CHIP_ERROR SendSigma3b(SendSigma3Data & data, bool & cancel);
     CHIP_ERROR SendSigma3c(SendSigma3Data & data, CHIP_ERROR status);
 
@@ -585,6 +631,7 @@ private:
 
     template <class DATA>
     class WorkHelper;
+    Platform::SharedPtr<WorkHelper<HandleSigma2Data>> mHandleSigma2Helper;
     Platform::SharedPtr<WorkHelper<SendSigma3Data>> mSendSigma3Helper;
     Platform::SharedPtr<WorkHelper<HandleSigma3Data>> mHandleSigma3Helper;
 
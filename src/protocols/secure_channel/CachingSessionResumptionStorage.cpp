@@ -0,0 +1,247 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/secure_channel/CachingSessionResumptionStorage.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+
+CachingSessionResumptionStorage::~CachingSessionResumptionStorage()
+{
+    if (mFlushScheduled)
+    {
+        mSystemLayer->CancelTimer(OnFlushTimer, this);
+        mFlushScheduled = false;
+    }
+    Clear();
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
+                                                               Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
+{
+    Entry * entry = Find(node);
+    if (entry != nullptr)
+    {
+        mStats.mHits++;
+        resumptionId = entry->mResumptionId;
+        sharedSecret = entry->mSharedSecret;
+        peerCATs     = entry->mPeerCATs;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR err = mStorage.FindByScopedNodeId(node, resumptionId, sharedSecret, peerCATs);
+    if (err != CHIP_NO_ERROR)
+    {
+        mStats.mMisses++;
+        return err;
+    }
+
+    mStats.mStorageHits++;
+    Remember(node, resumptionId, sharedSecret, peerCATs, /* dirty = */ false);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::FindByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node,
+                                                               Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
+{
+    Entry * entry = Find(resumptionId);
+    if (entry != nullptr)
+    {
+        mStats.mHits++;
+        node         = entry->mNode;
+        sharedSecret = entry->mSharedSecret;
+        peerCATs     = entry->mPeerCATs;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR err = mStorage.FindByResumptionId(resumptionId, node, sharedSecret, peerCATs);
+    if (err == CHIP_NO_ERROR && Find(node) != nullptr)
+    {
+        // The node was saved with a newer resumption ID that is not written yet; the stored one is no longer valid.
+        err = CHIP_ERROR_KEY_NOT_FOUND;
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        mStats.mMisses++;
+        return err;
+    }
+
+    mStats.mStorageHits++;
+    Remember(node, resumptionId, sharedSecret, peerCATs, /* dirty = */ false);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                                 const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
+{
+    if (Remember(node, resumptionId, sharedSecret, peerCATs, /* dirty = */ true) == nullptr)
+    {
+        // Not kept in memory, so it has to be written now.
+        ReturnErrorOnFailure(mStorage.Save(node, resumptionId, sharedSecret, peerCATs));
+        mStats.mWrites++;
+        return CHIP_NO_ERROR;
+    }
+
+    ScheduleFlush();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
+{
+    for (auto it = mEntries.begin(); it != mEntries.end();)
+    {
+        Entry & entry = *it;
+        ++it;
+        if (entry.mNode.GetFabricIndex() == fabricIndex)
+        {
+            Drop(&entry);
+        }
+    }
+    return mStorage.DeleteAll(fabricIndex);
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::Flush()
+{
+    CHIP_ERROR stickyErr = CHIP_NO_ERROR;
+    for (Entry & entry : mEntries)
+    {
+        if (entry.mDirty)
+        {
+            CHIP_ERROR err = Write(entry);
+            stickyErr      = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
+        }
+    }
+    return stickyErr;
+}
+
+void CachingSessionResumptionStorage::Clear()
+{
+    while (!mEntries.Empty())
+    {
+        Entry * entry = &*mEntries.begin();
+        if (entry->mDirty)
+        {
+            RETURN_SAFELY_IGNORED Write(*entry);
+        }
+        Drop(entry);
+    }
+}
+
+CachingSessionResumptionStorage::Entry * CachingSessionResumptionStorage::Find(const ScopedNodeId & node)
+{
+    for (Entry & entry : mEntries)
+    {
+        if (entry.mNode == node)
+        {
+            mEntries.Remove(&entry);
+            mEntries.PushFront(&entry);
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CachingSessionResumptionStorage::Entry * CachingSessionResumptionStorage::Find(ConstResumptionIdView resumptionId)
+{
+    for (Entry & entry : mEntries)
+    {
+        if (std::equal(entry.mResumptionId.begin(), entry.mResumptionId.end(), resumptionId.begin(), resumptionId.end()))
+        {
+            mEntries.Remove(&entry);
+            mEntries.PushFront(&entry);
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CachingSessionResumptionStorage::Entry *
+CachingSessionResumptionStorage::Remember(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                          const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs,
+                                          bool dirty)
+{
+    Entry * entry = Find(node);
+    if (entry == nullptr)
+    {
+        VerifyOrReturnValue(mCapacity > 0, nullptr);
+        if (mCount == mCapacity)
+        {
+            Entry * oldest = &*(--mEntries.end());
+            if (oldest->mDirty)
+            {
+                // Best effort: if the record cannot be written, the peer falls back to a full CASE handshake.
+                RETURN_SAFELY_IGNORED Write(*oldest);
+            }
+            Drop(oldest);
+            mStats.mEvictions++;
+        }
+
+        entry = Platform::New<Entry>();
+        VerifyOrReturnValue(entry != nullptr, nullptr);
+        entry->mNode = node;
+        mEntries.PushFront(entry);
+        mCount++;
+    }
+
+    std::copy(resumptionId.begin(), resumptionId.end(), entry->mResumptionId.begin());
+    entry->mSharedSecret = sharedSecret;
+    entry->mPeerCATs     = peerCATs;
+    entry->mDirty        = entry->mDirty || dirty;
+    return entry;
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::Write(Entry & entry)
+{
+    CHIP_ERROR err = mStorage.Save(entry.mNode, entry.mResumptionId, entry.mSharedSecret, entry.mPeerCATs);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Unable to write session resumption record for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(entry.mNode.GetNodeId()), err.Format());
+        return err;
+    }
+    entry.mDirty = false;
+    mStats.mWrites++;
+    return CHIP_NO_ERROR;
+}
+
+void CachingSessionResumptionStorage::Drop(Entry * entry)
+{
+    mEntries.Remove(entry);
+    mCount--;
+    Platform::Delete(entry);
+}
+
+void CachingSessionResumptionStorage::ScheduleFlush()
+{
+    VerifyOrReturn(mSystemLayer != nullptr && !mFlushScheduled);
+    mFlushScheduled = (mSystemLayer->StartTimer(mPersistDelay, OnFlushTimer, this) == CHIP_NO_ERROR);
+}
+
+void CachingSessionResumptionStorage::OnFlushTimer(System::Layer * systemLayer, void * context)
+{
+    auto * self           = static_cast<CachingSessionResumptionStorage *>(context);
+    self->mFlushScheduled = false;
+    // Records that could not be written stay dirty and are written with the next ones.
+    RETURN_SAFELY_IGNORED self->Flush();
+}
+
+} // namespace chip
@@ -0,0 +1,123 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/IntrusiveList.h>
+#include <protocols/secure_channel/SessionResumptionStorage.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * SessionResumptionStorage decorator that keeps up to `capacity` resumption records in memory, most recently
+ * used first, on top of a persistent SessionResumptionStorage.
+ *
+ * The capacity can be much larger than what the persistent storage keeps (CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE
+ * for DefaultSessionResumptionStorage), so that a controller talking to many peers can keep resuming sessions with
+ * them instead of falling back to a full CASE handshake.  Records not in memory are looked up in the persistent
+ * storage, and are kept in memory from then on.
+ *
+ * Saved records are persisted lazily: a record saved several times in a row is only written once.  If a system
+ * layer is given, the records saved since the last write are written `persistDelay` after the first of them was saved;
+ * otherwise that only happens on Flush().  Records are also written when they are dropped from memory to make room,
+ * and on destruction, so the persistent storage must outlive the cache.  DeleteAll goes to the persistent storage
+ * right away.
+ */
+class CachingSessionResumptionStorage : public SessionResumptionStorage
+{
+public:
+    static constexpr System::Clock::Timeout kDefaultPersistDelay = System::Clock::Seconds16(10);
+
+    struct Stats
+    {
+        uint32_t mHits        = 0; ///< Lookups answered from memory
+        uint32_t mStorageHits = 0; ///< Lookups answered from the persistent storage
+        uint32_t mMisses      = 0; ///< Lookups finding no record, i.e. falling back to a full CASE handshake
+        uint32_t mEvictions   = 0; ///< Records dropped from memory to make room
+        uint32_t mWrites      = 0; ///< Records written to the persistent storage
+    };
+
+    CachingSessionResumptionStorage(SessionResumptionStorage & storage, size_t capacity, System::Layer * systemLayer = nullptr,
+                                    System::Clock::Timeout persistDelay = kDefaultPersistDelay) :
+        mStorage(storage), mCapacity(capacity), mSystemLayer(systemLayer), mPersistDelay(persistDelay)
+    {}
+    ~CachingSessionResumptionStorage() override;
+
+    CachingSessionResumptionStorage(const CachingSessionResumptionStorage &)             = delete;
+    CachingSessionResumptionStorage & operator=(const CachingSessionResumptionStorage &) = delete;
+
+    CHIP_ERROR FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
+                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs) override;
+    CHIP_ERROR FindByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node,
+                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs) override;
+    CHIP_ERROR Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                    const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs) override;
+    CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
+
+    /**
+     * Write the records saved since they were last written to the persistent storage.  Records that could not be
+     * written are tried again on the next flush.
+     */
+    CHIP_ERROR Flush();
+
+    /**
+     * Drop all records from memory, after writing them to the persistent storage.
+     */
+    void Clear();
+
+    const Stats & GetStats() const { return mStats; }
+    void ResetStats() { mStats = Stats(); }
+
+    size_t GetCachedCount() const { return mCount; }
+
+private:
+    struct Entry : public IntrusiveListNodeBase<>
+    {
+        ScopedNodeId mNode;
+        ResumptionIdStorage mResumptionId;
+        Crypto::P256ECDHDerivedSecret mSharedSecret;
+        CATValues mPeerCATs;
+        bool mDirty = false; ///< Whether the record was saved since it was last written to the persistent storage
+    };
+
+    // The entry for the node or resumption ID, made the most recently used one, or nullptr if there is none.
+    Entry * Find(const ScopedNodeId & node);
+    Entry * Find(ConstResumptionIdView resumptionId);
+    Entry * Remember(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                     const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs, bool dirty);
+    CHIP_ERROR Write(Entry & entry);
+    void Drop(Entry * entry);
+
+    void ScheduleFlush();
+    static void OnFlushTimer(System::Layer * systemLayer, void * context);
+
+    SessionResumptionStorage & mStorage;
+    const size_t mCapacity;
+    System::Layer * const mSystemLayer;
+    const System::Clock::Timeout mPersistDelay;
+    bool mFlushScheduled = false;
+    size_t mCount        = 0;
+    Stats mStats;
+    IntrusiveList<Entry> mEntries; // Most recently used first
+};
+
+} // namespace chip
@@ -37,6 +37,7 @@
 #include <lib/support/BufferWriter.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/MemoryTags.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/TypeTraits.h>
 #include <messaging/SessionParameters.h>
@@ -920,6 +921,7 @@ CHIP_ERROR PASESession::OnMessageReceived(ExchangeContext * exchange, const Payl
                                           System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("OnMessageReceived", "PASESession");
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kCrypto);
     CHIP_ERROR err  = ValidateReceivedMessage(exchange, payloadHeader, msg);
     MsgType msgType = static_cast<MsgType>(payloadHeader.GetMessageType());
     SuccessOrExit(err);
@@ -71,8 +71,10 @@ CHIP_ERROR SimpleSessionResumptionStorage::SaveIndex(const SessionIndex & index)
     const auto len = writer.GetLengthWritten();
     VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
 
-    ReturnErrorOnFailure(mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SessionResumptionIndex().KeyName(), buf.data(),
-                                                   static_cast<uint16_t>(len)));
+    // Sessions are saved as CASE completes, so the writes are asynchronous to keep slow storage off the handshake.
+    ReturnErrorOnFailure(mStorage->AsyncSetKeyValue(DefaultStorageKeyAllocator::SessionResumptionIndex().KeyName(), buf.data(),
+                                                    static_cast<uint16_t>(len), PersistentStorageDelegate::LogAsyncFailure,
+                                                    nullptr));
 
     return CHIP_NO_ERROR;
 }
@@ -149,7 +151,8 @@ CHIP_ERROR SimpleSessionResumptionStorage::SaveLink(ConstResumptionIdView resump
     const auto len = writer.GetLengthWritten();
     VerifyOrDie(CanCastTo<uint16_t>(len));
 
-    ReturnErrorOnFailure(mStorage->SyncSetKeyValue(GetStorageKey(resumptionId).KeyName(), buf.data(), static_cast<uint16_t>(len)));
+    ReturnErrorOnFailure(mStorage->AsyncSetKeyValue(GetStorageKey(resumptionId).KeyName(), buf.data(), static_cast<uint16_t>(len),
+                                                    PersistentStorageDelegate::LogAsyncFailure, nullptr));
     return CHIP_NO_ERROR;
 }
 
@@ -185,7 +188,8 @@ CHIP_ERROR SimpleSessionResumptionStorage::LoadLink(ConstResumptionIdView resump
 
 CHIP_ERROR SimpleSessionResumptionStorage::DeleteLink(ConstResumptionIdView resumptionId)
 {
-    ReturnErrorOnFailure(mStorage->SyncDeleteKeyValue(GetStorageKey(resumptionId).KeyName()));
+    ReturnErrorOnFailure(
+        mStorage->AsyncDeleteKeyValue(GetStorageKey(resumptionId).KeyName(), PersistentStorageDelegate::LogAsyncFailure, nullptr));
     return CHIP_NO_ERROR;
 }
 
@@ -213,7 +217,8 @@ CHIP_ERROR SimpleSessionResumptionStorage::SaveState(const ScopedNodeId & node,
     const auto len = writer.GetLengthWritten();
     VerifyOrDie(CanCastTo<uint16_t>(len));
 
-    ReturnErrorOnFailure(mStorage->SyncSetKeyValue(GetStorageKey(node).KeyName(), buf.data(), static_cast<uint16_t>(len)));
+    ReturnErrorOnFailure(mStorage->AsyncSetKeyValue(GetStorageKey(node).KeyName(), buf.data(), static_cast<uint16_t>(len),
+                                                    PersistentStorageDelegate::LogAsyncFailure, nullptr));
     return CHIP_NO_ERROR;
 }
 
@@ -258,7 +263,7 @@ CHIP_ERROR SimpleSessionResumptionStorage::LoadState(const ScopedNodeId & node,
 
 CHIP_ERROR SimpleSessionResumptionStorage::DeleteState(const ScopedNodeId & node)
 {
-    return mStorage->SyncDeleteKeyValue(GetStorageKey(node).KeyName());
+    return mStorage->AsyncDeleteKeyValue(GetStorageKey(node).KeyName(), PersistentStorageDelegate::LogAsyncFailure, nullptr);
 }
 
 } // namespace chip
@@ -1039,6 +1039,7 @@ TEST_F(TestCASESession, EncodeSigma1Test)
 
         // Round Trip Test: Encode Sigma1, Parse it then verify parsed values
         EXPECT_EQ(CHIP_NO_ERROR, CASESessionAccess::EncodeSigma1(msg1, encodeParams));
+        EXPECT_FALSE(CASESession::IsSessionResumptionRequest(msg1));
 
         System::PacketBufferTLVReader tlvReader;
         tlvReader.Init(std::move(msg1));
@@ -1072,6 +1073,7 @@ TEST_F(TestCASESession, EncodeSigma1Test)
         System::PacketBufferHandle msg2;
 
         EXPECT_EQ(CHIP_NO_ERROR, CASESessionAccess::EncodeSigma1(msg2, encodeParams));
+        EXPECT_TRUE(CASESession::IsSessionResumptionRequest(msg2));
 
         System::PacketBufferTLVReader tlvReader;
         tlvReader.Init(std::move(msg2));
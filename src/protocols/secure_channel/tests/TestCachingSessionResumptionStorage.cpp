@@ -0,0 +1,192 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <protocols/secure_channel/CachingSessionResumptionStorage.h>
+#include <protocols/secure_channel/SimpleSessionResumptionStorage.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr FabricIndex kFabric1 = 1;
+constexpr FabricIndex kFabric2 = 2;
+
+struct Record
+{
+    ScopedNodeId mNode;
+    SessionResumptionStorage::ResumptionIdStorage mResumptionId;
+    Crypto::P256ECDHDerivedSecret mSharedSecret;
+    CATValues mPeerCATs;
+};
+
+Record MakeRecord(NodeId nodeId, FabricIndex fabricIndex)
+{
+    Record record;
+    record.mNode = ScopedNodeId(nodeId, fabricIndex);
+    EXPECT_EQ(Crypto::DRBG_get_bytes(record.mResumptionId.data(), record.mResumptionId.size()), CHIP_NO_ERROR);
+    EXPECT_EQ(record.mSharedSecret.SetLength(record.mSharedSecret.Capacity()), CHIP_NO_ERROR);
+    EXPECT_EQ(Crypto::DRBG_get_bytes(record.mSharedSecret.Bytes(), record.mSharedSecret.Length()), CHIP_NO_ERROR);
+    return record;
+}
+
+CHIP_ERROR Save(SessionResumptionStorage & storage, const Record & record)
+{
+    return storage.Save(record.mNode, record.mResumptionId, record.mSharedSecret, record.mPeerCATs);
+}
+
+void ExpectFound(SessionResumptionStorage & storage, const Record & record)
+{
+    SessionResumptionStorage::ResumptionIdStorage resumptionId;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+    ASSERT_EQ(storage.FindByScopedNodeId(record.mNode, resumptionId, sharedSecret, peerCATs), CHIP_NO_ERROR);
+    EXPECT_EQ(resumptionId, record.mResumptionId);
+    ASSERT_EQ(sharedSecret.Length(), record.mSharedSecret.Length());
+    EXPECT_EQ(memcmp(sharedSecret.ConstBytes(), record.mSharedSecret.ConstBytes(), sharedSecret.Length()), 0);
+}
+
+class TestCachingSessionResumptionStorage : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override { ASSERT_EQ(mStored.Init(&mBacking), CHIP_NO_ERROR); }
+
+protected:
+    TestPersistentStorageDelegate mBacking;
+    SimpleSessionResumptionStorage mStored;
+};
+
+TEST_F(TestCachingSessionResumptionStorage, SavesAreWrittenOnFlush)
+{
+    CachingSessionResumptionStorage cache(mStored, 4);
+    Record record = MakeRecord(100, kFabric1);
+
+    EXPECT_EQ(Save(cache, record), CHIP_NO_ERROR);
+    record = MakeRecord(100, kFabric1);
+    EXPECT_EQ(Save(cache, record), CHIP_NO_ERROR);
+    EXPECT_EQ(mBacking.GetNumKeys(), 0u);
+    ExpectFound(cache, record);
+    EXPECT_EQ(cache.GetStats().mHits, 1u);
+
+    // Both saves are written at once.
+    EXPECT_EQ(cache.Flush(), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetStats().mWrites, 1u);
+    ExpectFound(mStored, record);
+}
+
+TEST_F(TestCachingSessionResumptionStorage, KeepsMoreThanStorage)
+{
+    constexpr size_t kCount = CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE * 2;
+    CachingSessionResumptionStorage cache(mStored, kCount);
+
+    Record records[kCount];
+    for (size_t i = 0; i < kCount; i++)
+    {
+        records[i] = MakeRecord(static_cast<NodeId>(i + 1), kFabric1);
+        EXPECT_EQ(Save(cache, records[i]), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(cache.Flush(), CHIP_NO_ERROR);
+
+    for (const auto & record : records)
+    {
+        ExpectFound(cache, record);
+    }
+    EXPECT_EQ(cache.GetStats().mHits, kCount);
+    EXPECT_EQ(cache.GetStats().mMisses, 0u);
+}
+
+TEST_F(TestCachingSessionResumptionStorage, FallsBackToStorage)
+{
+    Record stored  = MakeRecord(100, kFabric1);
+    Record missing = MakeRecord(200, kFabric1);
+    EXPECT_EQ(Save(mStored, stored), CHIP_NO_ERROR);
+
+    CachingSessionResumptionStorage cache(mStored, 4);
+    ExpectFound(cache, stored);
+    ExpectFound(cache, stored);
+    EXPECT_EQ(cache.GetStats().mStorageHits, 1u);
+    EXPECT_EQ(cache.GetStats().mHits, 1u);
+
+    ScopedNodeId node;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+    EXPECT_NE(cache.FindByResumptionId(missing.mResumptionId, node, sharedSecret, peerCATs), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetStats().mMisses, 1u);
+}
+
+TEST_F(TestCachingSessionResumptionStorage, StoredResumptionIdIsReplaced)
+{
+    CachingSessionResumptionStorage cache(mStored, 4);
+    Record older = MakeRecord(100, kFabric1);
+    EXPECT_EQ(Save(cache, older), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Flush(), CHIP_NO_ERROR);
+
+    Record newer = MakeRecord(100, kFabric1);
+    EXPECT_EQ(Save(cache, newer), CHIP_NO_ERROR);
+
+    // The older resumption ID is still in storage, but must not be usable any more.
+    ScopedNodeId node;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+    EXPECT_EQ(cache.FindByResumptionId(older.mResumptionId, node, sharedSecret, peerCATs), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(cache.FindByResumptionId(newer.mResumptionId, node, sharedSecret, peerCATs), CHIP_NO_ERROR);
+    EXPECT_EQ(node, newer.mNode);
+}
+
+TEST_F(TestCachingSessionResumptionStorage, EvictedRecordsAreWritten)
+{
+    CachingSessionResumptionStorage cache(mStored, 1);
+    Record first  = MakeRecord(100, kFabric1);
+    Record second = MakeRecord(200, kFabric1);
+
+    EXPECT_EQ(Save(cache, first), CHIP_NO_ERROR);
+    EXPECT_EQ(Save(cache, second), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetCachedCount(), 1u);
+    EXPECT_EQ(cache.GetStats().mEvictions, 1u);
+    ExpectFound(mStored, first);
+
+    cache.Clear();
+    ExpectFound(mStored, second);
+}
+
+TEST_F(TestCachingSessionResumptionStorage, DeleteAll)
+{
+    CachingSessionResumptionStorage cache(mStored, 4);
+    Record record1 = MakeRecord(100, kFabric1);
+    Record record2 = MakeRecord(100, kFabric2);
+    EXPECT_EQ(Save(cache, record1), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Flush(), CHIP_NO_ERROR);
+    EXPECT_EQ(Save(cache, record2), CHIP_NO_ERROR);
+
+    EXPECT_EQ(cache.DeleteAll(kFabric1), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetCachedCount(), 1u);
+
+    SessionResumptionStorage::ResumptionIdStorage resumptionId;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+    EXPECT_NE(cache.FindByScopedNodeId(record1.mNode, resumptionId, sharedSecret, peerCATs), CHIP_NO_ERROR);
+    ExpectFound(cache, record2);
+}
+
+} // namespace
@@ -165,6 +165,37 @@ public:
      */
     virtual Timestamp GetMonotonicTimestamp();
 
+    /**
+     * Returns the monotonic time cached by the event loop for the iteration in progress, or
+     * GetMonotonicTimestamp() when no time is cached.
+     *
+     * Event loops that support it cache the time once, before handling the expired timers and the
+     * I/O events of an iteration, so the value lags behind the actual time by as long as the handlers
+     * called so far in the iteration took.  This is meant for callers that run for every message and
+     * only need the time to that granularity, such as session activity tracking.
+     *
+     * Must only be called from the Matter stack execution context.
+     */
+    Timestamp GetCachedMonotonicTimestamp() { return mHasCachedTimestamp ? mCachedTimestamp : GetMonotonicTimestamp(); }
+
+    /**
+     * Cache the current monotonic time, returned by GetCachedMonotonicTimestamp() until
+     * ClearCachedMonotonicTimestamp() is called.  Reserved for event loop implementations.
+     *
+     * @returns The cached time.
+     */
+    Timestamp CacheMonotonicTimestamp()
+    {
+        mCachedTimestamp    = GetMonotonicTimestamp();
+        mHasCachedTimestamp = true;
+        return mCachedTimestamp;
+    }
+
+    /**
+     * Stop returning the time cached by CacheMonotonicTimestamp().  Reserved for event loop implementations.
+     */
+    void ClearCachedMonotonicTimestamp() { mHasCachedTimestamp = false; }
+
     /**
      * Returns a monotonic system time in units of microseconds, from the platform.
      *
@@ -304,6 +335,10 @@ public:
 
 protected:
     uint64_t mLastTimestamp = 0;
+
+private:
+    Timestamp mCachedTimestamp;
+    bool mHasCachedTimestamp = false;
 };
 
 // Currently we have a single implementation class, ClockImpl, whose members are implemented in build-specific files.
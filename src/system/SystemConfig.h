@@ -119,6 +119,10 @@
     "FORBIDDEN: CHIP_SYSTEM_CONFIG_USE_OPENTHREAD_ENDPOINT && ( CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK || CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_LWIP )"
 #endif
 
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL && (!CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_LIBEV)
+#error "FORBIDDEN: CHIP_SYSTEM_CONFIG_USE_EPOLL && (!CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_LIBEV)"
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL && (!CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_LIBEV)
+
 #if CHIP_SYSTEM_CONFIG_MULTICAST_HOMING && (!CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK)
 #error "FORBIDDEN: CHIP_SYSTEM_CONFIG_MULTICAST_HOMING CAN ONLY BE USED WITH SOCKET IMPL OR Network.framework IMPL"
 #endif
@@ -381,6 +385,71 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE
+ *
+ *  @brief
+ *      This is the number of small packet buffers for the BSD sockets configuration, in addition to the
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE full size ones.
+ *
+ *      Small packet buffers have room for CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_CAPACITY bytes of reserve and
+ *      data, which is enough for e.g. standalone acks.  PacketBufferHandle::New() hands out the smallest free buffer
+ *      that fits the request, so that small messages don't tie up full size buffers.
+ *
+ *      Only applies when CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is not zero.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_CAPACITY
+ *
+ *  @brief
+ *      The size of the reserve and data space of the packet buffers counted by
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_CAPACITY
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_CAPACITY 128
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_CAPACITY */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE
+ *
+ *  @brief
+ *      This is the number of medium packet buffers for the BSD sockets configuration, see
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_CAPACITY
+ *
+ *  @brief
+ *      The size of the reserve and data space of the packet buffers counted by
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_CAPACITY
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_CAPACITY 512
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_CAPACITY */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE
+ *
+ *  @brief
+ *      Use atomic operations instead of a mutex for the free lists and reference counts of the
+ *      packet buffer pool (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE > 0), so that threads allocating
+ *      and freeing packet buffers do not contend on a lock.
+ *
+ *      Requires lock-free 32-bit atomics.  Has no effect on other packet buffer configurations, or
+ *      with CHIP_SYSTEM_CONFIG_NO_LOCKING.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM
  *
@@ -518,6 +587,65 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+ *
+ *  @brief
+ *      Defines whether (1) or not (0) the select() and epoll() based System Layer implementations keep their timers in a
+ *      hierarchical timer wheel instead of a sorted list. The wheel makes starting and cancelling timers O(1), which matters
+ *      for controllers with many concurrent sessions, at the cost of a few kilobytes of RAM.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL 0
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS
+ *
+ *  @brief
+ *      Number of buckets of the hash table used by the timer wheel to find timers by callback and application state. Should
+ *      be in the order of the number of concurrently active timers.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS 256
+#else
+#define CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS CHIP_SYSTEM_CONFIG_NUM_TIMERS
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_STALL_DETECTION
+ *
+ *  @brief
+ *      Defines whether (1) or not (0) the event loop times every timer callback, socket handler and scheduled work item it
+ *      dispatches, keeping the slowest ones and reporting those exceeding a threshold. See chip::System::StallDetector.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_STALL_DETECTION
+#define CHIP_SYSTEM_CONFIG_STALL_DETECTION 0
+#endif // CHIP_SYSTEM_CONFIG_STALL_DETECTION
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_STALL_DETECTION_MAX_RECORDS
+ *
+ *  @brief
+ *      Number of slowest dispatches kept by the stall detector.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_STALL_DETECTION_MAX_RECORDS
+#define CHIP_SYSTEM_CONFIG_STALL_DETECTION_MAX_RECORDS 8
+#endif // CHIP_SYSTEM_CONFIG_STALL_DETECTION_MAX_RECORDS
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_STALL_DETECTION_THRESHOLD_MS
+ *
+ *  @brief
+ *      Default duration, in milliseconds, from which a single dispatch is reported as a stall of the event loop. Can be
+ *      changed at runtime with StallDetector::SetThreshold().
+ */
+#ifndef CHIP_SYSTEM_CONFIG_STALL_DETECTION_THRESHOLD_MS
+#define CHIP_SYSTEM_CONFIG_STALL_DETECTION_THRESHOLD_MS 100
+#endif // CHIP_SYSTEM_CONFIG_STALL_DETECTION_THRESHOLD_MS
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
  *
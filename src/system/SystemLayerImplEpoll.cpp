@@ -0,0 +1,571 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using epoll() and timerfd.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TimeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+namespace {
+
+constexpr Clock::Seconds64 kDefaultMinSleepPeriod = Clock::Seconds64(60 * 60 * 24 * 30); // Month [sec]
+
+CHIP_ERROR AddEdgeTriggeredReader(int epollFd, int fd, void * tag)
+{
+    struct epoll_event event = {};
+    event.events             = EPOLLIN | EPOLLET;
+    event.data.ptr           = tag;
+    VerifyOrReturnError(epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) == 0, CHIP_ERROR_POSIX(errno));
+    return CHIP_NO_ERROR;
+}
+
+void CloseIfValid(int & fd)
+{
+    if (fd != kInvalidFd)
+    {
+        close(fd);
+        fd = kInvalidFd;
+    }
+}
+
+} // namespace
+
+CriticalFailure LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleEventsThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    mEventCount    = 0;
+    mWaitTimeoutMs = -1;
+
+    // Create an event to allow an arbitrary thread to wake the thread in the epoll loop.
+    ReturnErrorOnFailure(mWakeEvent.Open());
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    mEpollFD = epoll_create1(EPOLL_CLOEXEC);
+    mTimerFD = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrExit(mEpollFD != kInvalidFd && mTimerFD != kInvalidFd, err = CHIP_ERROR_POSIX(errno));
+
+    // The tags only need to be distinct from the socket watches; they are never dereferenced.
+    SuccessOrExit(err = AddEdgeTriggeredReader(mEpollFD, mWakeEvent.GetReadFD(), &mWakeEvent));
+    SuccessOrExit(err = AddEdgeTriggeredReader(mEpollFD, mTimerFD, &mTimerFD));
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        mWakeEvent.Close();
+        CloseIfValid(mTimerFD);
+        CloseIfValid(mEpollFD);
+        return err;
+    }
+
+    VerifyOrReturnError(mLayerState.SetInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturn(mLayerState.SetShuttingDown());
+
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+    mEventCount = 0;
+
+    mWakeEvent.Close();
+    CloseIfValid(mTimerFD);
+    CloseIfValid(mEpollFD);
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by notifying the wake event.
+     *
+     * If this is being called from within an I/O event callback, then the notification can be skipped,
+     * since the I/O thread is already awake.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleEventsThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+CriticalFailure LayerImplEpoll::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the timer descriptor has to be re-armed.
+        Signal();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(delay.count() > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    assertChipStackLockedByCurrentThread();
+
+    Clock::Timeout remainingTime = mTimerList.GetRemainingTime(onComplete, appState);
+    if (remainingTime.count() < delay.count())
+    {
+        // Just call StartTimer; it will invoke CancelTimer(), then start a new timer.
+        return StartTimer(delay, onComplete, appState);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool LayerImplEpoll::IsTimerActive(TimerCompleteCallback onComplete, void * appState)
+{
+    bool timerIsActive = (mTimerList.GetRemainingTime(onComplete, appState) > Clock::kZero);
+
+    if (!timerIsActive)
+    {
+        // check if the timer is in the mExpiredTimers list about to be fired.
+        for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer)
+        {
+            if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState)
+            {
+                return true;
+            }
+        }
+    }
+
+    return timerIsActive;
+}
+
+Clock::Timeout LayerImplEpoll::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
+{
+    return mTimerList.GetRemainingTime(onComplete, appState);
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerQueue::Node * timer = mTimerList.Remove(onComplete, appState);
+    if (timer == nullptr)
+    {
+        // The timer might be in the chunk of expired timers being fired right now; still cancel it there.
+        timer = static_cast<TimerQueue::Node *>(mExpiredTimers.Remove(onComplete, appState));
+    }
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+    Signal();
+}
+
+CriticalFailure LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Same approach as LayerImplSelect: an expires-ASAP timer that does not cancel existing timers with the same
+    // callback and appState.
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    // Find a free slot.
+    SocketWatch * watch = nullptr;
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == fd)
+        {
+            // Already registered, return the existing token
+            *tokenOut = reinterpret_cast<SocketWatchToken>(&w);
+            return CHIP_NO_ERROR;
+        }
+        if ((w.mFD == kInvalidFd) && (watch == nullptr))
+        {
+            watch = &w;
+        }
+    }
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    // The descriptor only joins the epoll interest set once some I/O is requested, see UpdateInterest().
+    watch->mFD = fd;
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    VerifyOrReturnError(tokenInOut != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    watch->mPendingIO.ClearAll();
+    (void) UpdateInterest(*watch);
+    watch->Clear();
+
+    // This may be called from a socket callback while HandleEvents() is still walking the events returned by
+    // epoll_wait(); make sure the remaining ones do not reach this watch, since its slot may be reused right away.
+    for (int i = 0; i < mEventCount; i++)
+    {
+        if (mEvents[i].data.ptr == watch)
+        {
+            mEvents[i].data.ptr = nullptr;
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::UpdateInterest(SocketWatch & watch)
+{
+    VerifyOrReturnError(mEpollFD != kInvalidFd, CHIP_ERROR_INCORRECT_STATE);
+
+    uint32_t wanted = (watch.mPendingIO.Has(SocketEventFlags::kRead) ? static_cast<uint32_t>(EPOLLIN) : 0u) |
+        (watch.mPendingIO.Has(SocketEventFlags::kWrite) ? static_cast<uint32_t>(EPOLLOUT) : 0u);
+    VerifyOrReturnError(wanted != watch.mRegisteredEvents, CHIP_NO_ERROR);
+
+    if (wanted == 0)
+    {
+        // Remove the descriptor entirely rather than keeping it with an empty mask: epoll always reports
+        // EPOLLERR / EPOLLHUP, which would keep waking the loop for a socket nobody is listening to.
+        if (epoll_ctl(mEpollFD, EPOLL_CTL_DEL, watch.mFD, nullptr) != 0 && errno != ENOENT && errno != EBADF)
+        {
+            return CHIP_ERROR_POSIX(errno);
+        }
+        watch.mRegisteredEvents = 0;
+        return CHIP_NO_ERROR;
+    }
+
+    struct epoll_event event = {};
+    event.events             = wanted;
+    event.data.ptr           = &watch;
+    int op                   = (watch.mRegisteredEvents == 0) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+    VerifyOrReturnError(epoll_ctl(mEpollFD, op, watch.mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+    watch.mRegisteredEvents = wanted;
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Convert the events reported by epoll for a socket into the events the watch asked for.
+ *
+ *  Like select(), an error or hang-up condition is reported as the socket being readable / writable, so that the
+ *  subsequent recv() / send() surfaces the actual error to the endpoint.
+ */
+SocketEvents LayerImplEpoll::SocketEventsFromEpoll(const SocketWatch & watch, uint32_t events)
+{
+    SocketEvents res;
+
+    if ((events & (EPOLLIN | EPOLLERR | EPOLLHUP)) && watch.mPendingIO.Has(SocketEventFlags::kRead))
+    {
+        res.Set(SocketEventFlags::kRead);
+    }
+    if ((events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) && watch.mPendingIO.Has(SocketEventFlags::kWrite))
+    {
+        res.Set(SocketEventFlags::kWrite);
+    }
+
+    return res;
+}
+
+enum : intptr_t
+{
+    kLoopHandlerInactive = 0, // default value for EventLoopHandler::mState
+    kLoopHandlerPending,
+    kLoopHandlerActive,
+};
+
+void LayerImplEpoll::AddLoopHandler(EventLoopHandler & handler)
+{
+    // Add the handler as pending because this method can be called at any point
+    // in a PrepareEvents() / WaitForEvents() / HandleEvents() sequence.
+    // It will be marked active when we call PrepareEvents() on it for the first time.
+    auto & state = LoopHandlerState(handler);
+    VerifyOrDie(state == kLoopHandlerInactive);
+    state = kLoopHandlerPending;
+    mLoopHandlers.PushBack(&handler);
+}
+
+void LayerImplEpoll::RemoveLoopHandler(EventLoopHandler & handler)
+{
+    mLoopHandlers.Remove(&handler);
+    LoopHandlerState(handler) = kLoopHandlerInactive;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
+
+    TimerList::Node * timer = mTimerList.Earliest();
+    if (timer)
+    {
+        awakenTime = std::min(awakenTime, timer->AwakenTime());
+    }
+
+    // Activate added EventLoopHandlers and call PrepareEvents on active handlers.
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        switch (auto & state = LoopHandlerState(loop))
+        {
+        case kLoopHandlerPending:
+            state = kLoopHandlerActive;
+            [[fallthrough]];
+        case kLoopHandlerActive:
+            awakenTime = std::min(awakenTime, loop.PrepareEvents(currentTime));
+            break;
+        }
+    }
+
+    const Clock::Timestamp sleepTime = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
+    if (sleepTime == Clock::kZero)
+    {
+        // An all-zero itimerspec disarms the timer descriptor, so poll instead of waiting for it.
+        mWaitTimeoutMs = 0;
+        return;
+    }
+
+    // The timer descriptor has microsecond resolution, unlike the millisecond timeout of epoll_wait().
+    const Clock::Microseconds64 sleepUs = sleepTime;
+    struct itimerspec spec              = {};
+    spec.it_value.tv_sec                = static_cast<time_t>(sleepUs.count() / kMicrosecondsPerSecond);
+    spec.it_value.tv_nsec =
+        static_cast<long>((sleepUs.count() % kMicrosecondsPerSecond) * kNanosecondsPerMicrosecond);
+    if (timerfd_settime(mTimerFD, 0, &spec, nullptr) == 0)
+    {
+        mWaitTimeoutMs = -1;
+    }
+    else
+    {
+        ChipLogError(chipSystemLayer, "timerfd_settime failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        mWaitTimeoutMs = static_cast<int>(std::min<uint64_t>(Clock::Milliseconds64(sleepTime).count() + 1, INT32_MAX));
+    }
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    mEventCount = epoll_wait(mEpollFD, mEvents, kMaxEventsPerWait, mWaitTimeoutMs);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsWaitResultValid())
+    {
+        int err     = errno;
+        mEventCount = 0;
+        VerifyOrReturn(err != EINTR); // EINTR is not really an error (and we don't use it for signal handling)
+        ChipLogError(DeviceLayer, "epoll_wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(err).Format());
+        return;
+    }
+
+    // Drain the edge-triggered wake and timer descriptors first; expired timers are found from the timer list below.
+    for (int i = 0; i < mEventCount; i++)
+    {
+        if (mEvents[i].data.ptr == &mWakeEvent)
+        {
+            mWakeEvent.Confirm();
+            mEvents[i].data.ptr = nullptr;
+        }
+        else if (mEvents[i].data.ptr == &mTimerFD)
+        {
+            uint64_t expirations;
+            (void) read(mTimerFD, &expirations, sizeof(expirations));
+            mEvents[i].data.ptr = nullptr;
+        }
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleEventsThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(static_cast<TimerQueue::Node *>(timer));
+    }
+
+    // Process socket events; only the ready sockets are visited. The entries of watches stopped by a callback (or by a
+    // timer above) have been cleared by StopWatchingSocket().
+    for (int i = 0; i < mEventCount; i++)
+    {
+        SocketWatch * watch = static_cast<SocketWatch *>(mEvents[i].data.ptr);
+        if (watch != nullptr && watch->mFD != kInvalidFd && watch->mCallback != nullptr)
+        {
+            SocketEvents events = SocketEventsFromEpoll(*watch, mEvents[i].events);
+            if (events.HasAny())
+            {
+                watch->mCallback(events, watch->mCallbackData);
+            }
+        }
+    }
+    mEventCount = 0;
+
+    // Call HandleEvents for active loop handlers
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        if (LoopHandlerState(loop) == kLoopHandlerActive)
+        {
+            loop.HandleEvents();
+        }
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleEventsThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplEpoll::SocketWatch::Clear()
+{
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mRegisteredEvents = 0;
+    mCallback         = nullptr;
+    mCallbackData     = 0;
+}
+
+} // namespace System
+} // namespace chip
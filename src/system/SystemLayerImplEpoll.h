@@ -0,0 +1,155 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using epoll() and timerfd, for Linux.
+ */
+
+#pragma once
+
+#include "system/SystemConfig.h"
+
+#include <sys/epoll.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <lib/support/ObjectLifeCycle.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+#include <system/WakeEvent.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * Sockets event loop backed by epoll.
+ *
+ * Unlike LayerImplSelect, the kernel interest set is only updated when a watch changes its requested events, and waking up
+ * only reports the descriptors that are actually ready, so the cost of an iteration scales with the number of active
+ * sockets rather than with the number of watched ones. There is also no FD_SETSIZE limit on descriptor values.
+ *
+ * The wake event and the timer descriptor are edge-triggered; sockets are level-triggered, because socket consumers only
+ * process one datagram / chunk per callback and rely on being called again while data is pending.
+ */
+class LayerImplEpoll : public LayerSocketsLoop
+{
+public:
+    LayerImplEpoll() = default;
+    ~LayerImplEpoll() override { VerifyOrDie(mLayerState.Destroy()); }
+
+    // Layer overrides.
+    CriticalFailure Init() override;
+    void Shutdown() override;
+    bool IsInitialized() const override { return mLayerState.IsInitialized(); }
+    CriticalFailure StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    bool IsTimerActive(TimerCompleteCallback onComplete, void * appState) override;
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback onComplete, void * appState) override;
+    void CancelTimer(TimerCompleteCallback onComplete, void * appState) override;
+    CriticalFailure ScheduleWork(TimerCompleteCallback onComplete, void * appState) override;
+
+    // LayerSocket overrides.
+    CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
+    CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+    SocketWatchToken InvalidSocketWatchToken() override { return reinterpret_cast<SocketWatchToken>(nullptr); }
+
+    // LayerSocketLoop overrides.
+    void Signal() override;
+    void EventLoopBegins() override {}
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+    void EventLoopEnds() override {}
+
+    void AddLoopHandler(EventLoopHandler & handler) override;
+    void RemoveLoopHandler(EventLoopHandler & handler) override;
+
+    // Expose the result of WaitForEvents() for non-blocking socket implementations.
+    bool IsWaitResultValid() const { return mEventCount >= 0; }
+
+    // The awaken time of the earliest pending timer, or false if there is none.  For test event loops that
+    // fast-forward a mock clock from one timer to the next.
+    bool GetEarliestTimerAwakenTime(Clock::Timestamp & outAwakenTime) const
+    {
+        const TimerList::Node * timer = mTimerList.Earliest();
+        VerifyOrReturnValue(timer != nullptr, false);
+        outAwakenTime = timer->AwakenTime();
+        return true;
+    }
+
+protected:
+    static constexpr int kSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
+        (INET_CONFIG_ENABLE_UDP_ENDPOINT ? INET_CONFIG_NUM_UDP_ENDPOINTS : 0);
+
+    // Room for every socket watch, plus the wake event and the timer descriptor.
+    static constexpr int kMaxEventsPerWait = kSocketWatchMax + 2;
+
+    struct SocketWatch
+    {
+        void Clear();
+        int mFD;
+        SocketEvents mPendingIO;
+        // Events currently registered with the kernel for mFD; none means the descriptor is not in the interest set.
+        uint32_t mRegisteredEvents;
+        SocketWatchCallback mCallback;
+        intptr_t mCallbackData;
+    };
+    SocketWatch mSocketWatchPool[kSocketWatchMax];
+
+    CHIP_ERROR UpdateInterest(SocketWatch & watch);
+    static SocketEvents SocketEventsFromEpoll(const SocketWatch & watch, uint32_t events);
+
+    TimerPool<TimerQueue::Node> mTimerPool;
+    TimerQueue mTimerList;
+    // List of expired timers being processed right now.  Stored in a member so
+    // we can cancel them.
+    TimerList mExpiredTimers;
+
+    IntrusiveList<EventLoopHandler> mLoopHandlers;
+
+    int mEpollFD = kInvalidFd;
+    int mTimerFD = kInvalidFd;
+
+    // Timeout for epoll_wait(): 0 when something is already due, -1 to wait for the timer descriptor or an I/O event.
+    int mWaitTimeoutMs = -1;
+
+    // Events returned by epoll_wait(), carried between WaitForEvents() and HandleEvents().
+    struct epoll_event mEvents[kMaxEventsPerWait];
+    int mEventCount = 0;
+
+    ObjectLifeCycle mLayerState;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    std::atomic<pthread_t> mHandleEventsThread;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    WakeEvent mWakeEvent;
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
@@ -27,6 +27,7 @@
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 #include <system/SystemLayerImplSelect.h>
+#include <system/SystemStallDetector.h>
 
 #include <algorithm>
 #include <errno.h>
@@ -81,7 +82,7 @@ void LayerImplSelect::Shutdown()
     VerifyOrReturn(mLayerState.SetShuttingDown());
 
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
-    TimerList::Node * timer;
+    TimerQueue::Node * timer;
     while ((timer = mTimerList.PopEarliest()) != nullptr)
     {
         if (ev_is_active(&timer->mLibEvTimer))
@@ -145,7 +146,7 @@ CriticalFailure LayerImplSelect::StartTimer(Clock::Timeout delay, TimerCompleteC
 
     CancelTimer(onComplete, appState);
 
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
 
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
@@ -221,14 +222,14 @@ void LayerImplSelect::CancelTimer(TimerCompleteCallback onComplete, void * appSt
 
     VerifyOrReturn(mLayerState.IsInitialized());
 
-    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    TimerQueue::Node * timer = mTimerList.Remove(onComplete, appState);
     if (timer == nullptr)
     {
         // The timer was not in our "will fire in the future" list, but it might
         // be in the "we're about to fire these" chunk we already grabbed from
         // that list.  Check for it there too, and if found there we still want
         // to cancel it.
-        timer = mExpiredTimers.Remove(onComplete, appState);
+        timer = static_cast<TimerQueue::Node *>(mExpiredTimers.Remove(onComplete, appState));
     }
     VerifyOrReturn(timer != nullptr);
 
@@ -252,7 +253,7 @@ CriticalFailure LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete,
 
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
     // schedule as timer with no delay, but do NOT cancel previous timers with same onComplete/appState!
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
     VerifyOrDie(mLibEvLoopP != nullptr);
     ev_timer_init(&timer->mLibEvTimer, &LayerImplSelect::HandleLibEvTimer, 1, 0);
@@ -287,7 +288,7 @@ CriticalFailure LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete,
     // timer, but just make sure we don't cancel existing timers with the same
     // callback and appState, so ScheduleWork invocations don't stomp on each
     // other.
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
 
     if (mTimerList.Add(timer) == timer)
@@ -607,14 +608,20 @@ void LayerImplSelect::HandleEvents()
     mHandleSelectThread = pthread_self();
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 
+    // The time is read once for the whole iteration, see ClockBase::GetCachedMonotonicTimestamp.  The clock is kept so
+    // that the cache is cleared on it even if a handler swaps the system clock (as tests do).
+    Clock::ClockBase & clock           = SystemClock();
+    const Clock::Timestamp currentTime = clock.CacheMonotonicTimestamp();
+
     // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
     // since that could result in infinite handling of new timers blocking any other progress.
     VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
-    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + currentTime);
     TimerList::Node * timer = nullptr;
     while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
     {
-        mTimerPool.Invoke(timer);
+        CHIP_SYSTEM_STALL_DETECTOR_SCOPE(kTimer, timer->GetCallback().GetOnComplete());
+        mTimerPool.Invoke(static_cast<TimerQueue::Node *>(timer));
     }
 
     // Process socket events, if any
@@ -627,6 +634,7 @@ void LayerImplSelect::HandleEvents()
                 SocketEvents events = SocketEventsFromFDs(w.mFD, mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet);
                 if (events.HasAny())
                 {
+                    CHIP_SYSTEM_STALL_DETECTOR_SCOPE(kSocket, w.mCallback);
                     w.mCallback(events, w.mCallbackData);
                 }
             }
@@ -644,6 +652,8 @@ void LayerImplSelect::HandleEvents()
         }
     }
 
+    clock.ClearCachedMonotonicTimestamp();
+
 #if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
     mHandleSelectThread = PTHREAD_NULL;
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
@@ -653,11 +663,12 @@ void LayerImplSelect::HandleEvents()
 
 void LayerImplSelect::HandleLibEvTimer(EV_P_ struct ev_timer * t, int revents)
 {
-    TimerList::Node * timer = static_cast<TimerList::Node *>(t->data);
+    TimerQueue::Node * timer = static_cast<TimerQueue::Node *>(t->data);
     VerifyOrDie(timer != nullptr);
     LayerImplSelect * layerP = dynamic_cast<LayerImplSelect *>(timer->mCallback.mSystemLayer);
     VerifyOrDie(layerP != nullptr);
     layerP->mTimerList.Remove(timer);
+    CHIP_SYSTEM_STALL_DETECTOR_SCOPE(kTimer, timer->GetCallback().GetOnComplete());
     layerP->mTimerPool.Invoke(timer);
 }
 
@@ -677,6 +688,7 @@ void LayerImplSelect::HandleLibEvIoWatcher(EV_P_ struct ev_io * i, int revents)
         }
         if (events.HasAny())
         {
+            CHIP_SYSTEM_STALL_DETECTOR_SCOPE(kSocket, watch->mCallback);
             watch->mCallback(events, watch->mCallbackData);
         }
     }
@@ -97,6 +97,16 @@ public:
     // Expose the result of WaitForEvents() for non-blocking socket implementations.
     bool IsSelectResultValid() const { return mSelectResult >= 0; }
 
+    // The awaken time of the earliest pending timer, or false if there is none.  For test event loops that
+    // fast-forward a mock clock from one timer to the next.
+    bool GetEarliestTimerAwakenTime(Clock::Timestamp & outAwakenTime) const
+    {
+        const TimerList::Node * timer = mTimerList.Earliest();
+        VerifyOrReturnValue(timer != nullptr, false);
+        outAwakenTime = timer->AwakenTime();
+        return true;
+    }
+
 protected:
     static SocketEvents SocketEventsFromFDs(int socket, const fd_set & readfds, const fd_set & writefds, const fd_set & exceptfds);
 
@@ -119,8 +129,8 @@ protected:
     };
     SocketWatch mSocketWatchPool[kSocketWatchMax];
 
-    TimerPool<TimerList::Node> mTimerPool;
-    TimerList mTimerList;
+    TimerPool<TimerQueue::Node> mTimerPool;
+    TimerQueue mTimerList;
     // List of expired timers being processed right now.  Stored in a member so
     // we can cancel them.
     TimerList mExpiredTimers;
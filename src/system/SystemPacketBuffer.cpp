@@ -68,9 +68,110 @@ namespace System {
 
 PacketBuffer::BufferPoolElement PacketBuffer::sBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE];
 
-PacketBuffer * PacketBuffer::sFreeList = PacketBuffer::BuildFreeList();
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE > 0
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_CAPACITY < CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX,
+              "Small packet buffers must be smaller than full size ones");
+PacketBuffer::BufferPoolElementFor<CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_CAPACITY>
+    PacketBuffer::sSmallBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE];
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE > 0
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_CAPACITY < CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX,
+              "Medium packet buffers must be smaller than full size ones");
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE == 0 ||
+                  CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_CAPACITY < CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_CAPACITY,
+              "Small packet buffers must be smaller than medium ones");
+PacketBuffer::BufferPoolElementFor<CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_CAPACITY>
+    PacketBuffer::sMediumBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE];
+#endif
+
+PacketBuffer::BufferPoolClass PacketBuffer::sBufferPoolClasses[kBufferPoolClassCount] = {
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE > 0
+    { sSmallBufferPool[0].Block, sizeof(sSmallBufferPool[0]), CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE,
+      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_CAPACITY, {}, Stats::kSystemLayer_NumSmallPacketBufs },
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE > 0
+    { sMediumBufferPool[0].Block, sizeof(sMediumBufferPool[0]), CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE,
+      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_CAPACITY, {}, Stats::kSystemLayer_NumMediumPacketBufs },
+#endif
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_HAS_SIZE_CLASSES
+    { sBufferPool[0].Block, sizeof(sBufferPool[0]), CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE, kMaxSizeWithoutReserve, {},
+      Stats::kSystemLayer_NumLargePacketBufs },
+#else
+    // Without size classes, kSystemLayer_NumPacketBufs already counts the buffers of this single class.
+    { sBufferPool[0].Block, sizeof(sBufferPool[0]), CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE, kMaxSizeWithoutReserve, {},
+      Stats::kSystemLayer_NumPacketBufs },
+#endif
+};
+
+const bool PacketBuffer::sBufferPoolReady = PacketBuffer::BuildFreeLists();
+
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_SHORT_LOCK_FREE == 2,
+              "CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE requires lock-free atomics");
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE + CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE +
+                      CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE <
+                  UINT16_MAX,
+              "Packet buffer indexes must fit in the free list head");
+
+constexpr uint32_t kFreeListIndexMask  = 0xFFFF;
+constexpr uint32_t kFreeListChangeUnit = kFreeListIndexMask + 1;
+
+static std::atomic<uint16_t> sFreeListLinks[CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE +
+                                            CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE +
+                                            CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE];
+
+PacketBuffer * PacketBuffer::BufferPoolClass::PopFree()
+{
+    uint32_t head = mFreeList.load(std::memory_order_acquire);
+    while (true)
+    {
+        const uint32_t index = head & kFreeListIndexMask;
+        if (index == 0)
+        {
+            return nullptr;
+        }
+
+        // If the buffer was popped (and maybe pushed back onto another one) since head was read, this link is stale,
+        // but the compare-exchange then fails because of the change count.
+        const uint32_t next = mFreeListLinks[index - 1].load(std::memory_order_relaxed);
+        if (mFreeList.compare_exchange_weak(head, ((head & ~kFreeListIndexMask) + kFreeListChangeUnit) | next,
+                                            std::memory_order_acquire, std::memory_order_acquire))
+        {
+            return reinterpret_cast<PacketBuffer *>(mStorage + (index - 1) * mElementSize);
+        }
+    }
+}
+
+void PacketBuffer::BufferPoolClass::PushFree(PacketBuffer * buffer)
+{
+    const uint32_t index = static_cast<uint32_t>((reinterpret_cast<uint8_t *>(buffer) - mStorage) / mElementSize + 1);
+
+    uint32_t head = mFreeList.load(std::memory_order_relaxed);
+    do
+    {
+        mFreeListLinks[index - 1].store(static_cast<uint16_t>(head & kFreeListIndexMask), std::memory_order_relaxed);
+    } while (!mFreeList.compare_exchange_weak(head, ((head & ~kFreeListIndexMask) + kFreeListChangeUnit) | index,
+                                              std::memory_order_release, std::memory_order_relaxed));
+}
+#else  // !CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+PacketBuffer * PacketBuffer::BufferPoolClass::PopFree()
+{
+    PacketBuffer * buffer = mFreeList;
+    if (buffer != nullptr)
+    {
+        mFreeList = buffer->ChainedBuffer();
+    }
+    return buffer;
+}
+
+void PacketBuffer::BufferPoolClass::PushFree(PacketBuffer * buffer)
+{
+    buffer->next = mFreeList;
+    mFreeList    = buffer;
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
 
-#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING && !CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
 static Mutex sBufferPoolMutex;
 
 #define LOCK_BUF_POOL()                                                                                                            \
@@ -83,25 +184,44 @@ static Mutex sBufferPoolMutex;
     {                                                                                                                              \
         sBufferPoolMutex.Unlock();                                                                                                 \
     } while (0)
-#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING && !CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
 
-PacketBuffer * PacketBuffer::BuildFreeList()
+bool PacketBuffer::BuildFreeLists()
 {
-    pbuf * lHead = nullptr;
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+    std::atomic<uint16_t> * lLinks = sFreeListLinks;
+#endif
 
-    for (int i = 0; i < CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE; i++)
+    for (auto & poolClass : sBufferPoolClasses)
     {
-        pbuf * lCursor = &sBufferPool[i].Header;
-        lCursor->next  = lHead;
-        lCursor->ref   = 0;
-        lHead          = lCursor;
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+        poolClass.mFreeListLinks = lLinks;
+        lLinks += poolClass.mCount;
+#endif
+        for (size_t i = 0; i < poolClass.mCount; i++)
+        {
+            PacketBuffer * lCursor = reinterpret_cast<PacketBuffer *>(poolClass.mStorage + i * poolClass.mElementSize);
+            lCursor->ref           = 0;
+            poolClass.PushFree(lCursor);
+        }
     }
 
-#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING && !CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
     SuccessOrDie(Mutex::Init(sBufferPoolMutex));
-#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING && !CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+
+    return true;
+}
 
-    return static_cast<PacketBuffer *>(lHead);
+PacketBuffer::BufferPoolClass & PacketBuffer::BufferPoolClassOf(const PacketBuffer * buffer)
+{
+    size_t i = 0;
+    while (i < kBufferPoolClassCount - 1 && !sBufferPoolClasses[i].Contains(buffer))
+    {
+        i++;
+    }
+    VerifyOrDieWithMsg(sBufferPoolClasses[i].Contains(buffer), chipSystemLayer, "packet buffer not from the pool");
+    return sBufferPoolClasses[i];
 }
 
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
@@ -499,13 +619,17 @@ void PacketBuffer::AddRef()
 {
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
     pbuf_ref(this);
-#else  // !CHIP_SYSTEM_CONFIG_USE_LWIP
+#elif CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+    const auto lPreviousRef = __atomic_fetch_add(&this->ref, 1, __ATOMIC_RELAXED);
+    VerifyOrDieWithMsg(lPreviousRef < std::numeric_limits<decltype(this->ref)>::max(), chipSystemLayer,
+                       "packet buffer refcount overflow");
+#else  // !CHIP_SYSTEM_CONFIG_USE_LWIP && !CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
     LOCK_BUF_POOL();
     VerifyOrDieWithMsg(this->ref < std::numeric_limits<decltype(this->ref)>::max(), chipSystemLayer,
                        "packet buffer refcount overflow");
     ++this->ref;
     UNLOCK_BUF_POOL();
-#endif // !CHIP_SYSTEM_CONFIG_USE_LWIP
+#endif // !CHIP_SYSTEM_CONFIG_USE_LWIP && !CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
 }
 
 PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aReservedSize)
@@ -623,7 +747,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
 
-#if !CHIP_SYSTEM_CONFIG_NO_LOCKING && CHIP_SYSTEM_CONFIG_FREERTOS_LOCKING
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING && !CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE && CHIP_SYSTEM_CONFIG_FREERTOS_LOCKING
     if (!sBufferPoolMutex.isInitialized())
     {
         SuccessOrDie(Mutex::Init(sBufferPoolMutex));
@@ -631,11 +755,23 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 #endif
     LOCK_BUF_POOL();
 
-    lPacket = PacketBuffer::sFreeList;
-    if (lPacket != nullptr)
+    // Take the smallest free buffer that fits.  The last (full size) class also takes the requests that fit no
+    // class, as it always did.
+    lPacket = nullptr;
+    for (auto & poolClass : PacketBuffer::sBufferPoolClasses)
     {
-        PacketBuffer::sFreeList = lPacket->ChainedBuffer();
-        SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
+        const bool isLastClass = (&poolClass == &PacketBuffer::sBufferPoolClasses[PacketBuffer::kBufferPoolClassCount - 1]);
+        if (poolClass.mAllocSize >= lAllocSize || isLastClass)
+        {
+            lPacket = poolClass.PopFree();
+            if (lPacket != nullptr)
+            {
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_HAS_SIZE_CLASSES
+                SYSTEM_STATS_INCREMENT(poolClass.mStatsEntry);
+#endif
+                break;
+            }
+        }
     }
 
     UNLOCK_BUF_POOL();
@@ -717,10 +853,17 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
     {
         PacketBuffer * lNextPacket = aPacket->ChainedBuffer();
 
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+        // Whoever drops the last reference owns the buffer, and returns it to the pool.
+        const auto lPreviousRef = __atomic_fetch_sub(&aPacket->ref, 1, __ATOMIC_ACQ_REL);
+        VerifyOrDieWithMsg(lPreviousRef > 0, chipSystemLayer, "SystemPacketBuffer::Free: aPacket->ref = 0");
+        if (lPreviousRef == 1)
+#else
         VerifyOrDieWithMsg(aPacket->ref > 0, chipSystemLayer, "SystemPacketBuffer::Free: aPacket->ref = 0");
 
         aPacket->ref--;
         if (aPacket->ref == 0)
+#endif
         {
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
@@ -728,8 +871,11 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
-            aPacket->next = sFreeList;
-            sFreeList     = aPacket;
+            BufferPoolClass & poolClass = BufferPoolClassOf(aPacket);
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_HAS_SIZE_CLASSES
+            SYSTEM_STATS_DECREMENT(poolClass.mStatsEntry);
+#endif
+            poolClass.PushFree(aPacket);
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
             chip::Platform::MemoryFree(aPacket);
 #endif
@@ -38,6 +38,10 @@
 #include <stddef.h>
 #include <utility>
 
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+#include <atomic>
+#endif
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #include <lwip/mem.h>
 #include <lwip/memp.h>
@@ -168,8 +172,11 @@ public:
      */
     size_t AllocSize() const
     {
-#if CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_STANDARD_POOL || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_STANDARD_POOL ||                                                                            \
+    (CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL && !CHIP_SYSTEM_PACKETBUFFER_POOL_HAS_SIZE_CLASSES)
         return kMaxSizeWithoutReserve;
+#elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
+        return BufferPoolClassOf(this).mAllocSize;
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
         return this->alloc_size;
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_CUSTOM_POOL
@@ -379,14 +386,62 @@ private:
 
     // Note: this condition includes DOXYGEN to work around a Doxygen error. DOXYGEN is never defined in any actual build.
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL || defined(DOXYGEN)
-    typedef union
+    template <size_t kAllocSize>
+    union BufferPoolElementFor
     {
         pbuf Header;
-        uint8_t Block[PacketBuffer::kBlockSize];
-    } BufferPoolElement;
+        uint8_t Block[PacketBuffer::kStructureSize + kAllocSize];
+    };
+    typedef BufferPoolElementFor<PacketBuffer::kMaxSizeWithoutReserve> BufferPoolElement;
     static BufferPoolElement sBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE];
-    static PacketBuffer * sFreeList;
-    static PacketBuffer * BuildFreeList();
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE > 0
+    static BufferPoolElementFor<CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_CAPACITY>
+        sSmallBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE];
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE > 0
+    static BufferPoolElementFor<CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_CAPACITY>
+        sMediumBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE];
+#endif
+
+    // The buffers of one size, and the ones of them that are free.
+    struct BufferPoolClass
+    {
+        uint8_t * mStorage;
+        size_t mElementSize;
+        size_t mCount;
+        size_t mAllocSize;
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+        // A Treiber stack: the low 16 bits are 1 + the index of the top buffer (0 if empty), the high 16 bits count
+        // the changes to the head, so that a pop that raced with other pops and pushes fails its compare-exchange.
+        std::atomic<uint32_t> mFreeList;
+#else
+        PacketBuffer * mFreeList;
+#endif
+        int mStatsEntry;
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+        // 1 + the index of the buffer below each free buffer (0 for the bottom one).  Kept outside of the buffers
+        // since a pop can read the link of a buffer that another thread has just taken and is writing to.
+        std::atomic<uint16_t> * mFreeListLinks = nullptr;
+#endif
+
+        bool Contains(const PacketBuffer * buffer) const
+        {
+            const uint8_t * address = reinterpret_cast<const uint8_t *>(buffer);
+            return address >= mStorage && address < mStorage + mElementSize * mCount;
+        }
+
+        // Unless CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE, these must be called with the buffer pool lock held.
+        PacketBuffer * PopFree();
+        void PushFree(PacketBuffer * buffer);
+    };
+
+    // Ordered from the smallest to the largest (sBufferPool) buffers.
+    static constexpr size_t kBufferPoolClassCount = 1 + (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE > 0 ? 1 : 0) +
+        (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE > 0 ? 1 : 0);
+    static BufferPoolClass sBufferPoolClasses[kBufferPoolClassCount];
+    static const bool sBufferPoolReady;
+    static bool BuildFreeLists();
+    static BufferPoolClass & BufferPoolClassOf(const PacketBuffer * buffer);
 #endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL || defined(DOXYGEN)
 
 #if CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
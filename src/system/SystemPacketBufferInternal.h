@@ -49,6 +49,29 @@
 #define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL 0
 #endif
 
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_POOL_HAS_SIZE_CLASSES
+ *
+ * True if the internal pool has small and/or medium packet buffers besides the full size ones.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL &&                                                                                     \
+    (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE > 0 || CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE > 0)
+#define CHIP_SYSTEM_PACKETBUFFER_POOL_HAS_SIZE_CLASSES 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_POOL_HAS_SIZE_CLASSES 0
+#endif
+
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+ *
+ * True if the internal pool is shared between threads without taking a lock.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL && CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_LOCK_FREE && !CHIP_SYSTEM_CONFIG_NO_LOCKING
+#define CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE 0
+#endif
+
 /**
  * CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_POOL
  *
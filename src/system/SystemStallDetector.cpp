@@ -0,0 +1,91 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <system/SystemStallDetector.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <inttypes.h>
+#include <string.h>
+
+namespace chip {
+namespace System {
+
+StallDetector & StallDetector::Instance()
+{
+    static StallDetector sInstance;
+    return sInstance;
+}
+
+const char * StallDetector::SourceName(Source source)
+{
+    switch (source)
+    {
+    case Source::kTimer:
+        return "timer";
+    case Source::kSocket:
+        return "socket";
+    case Source::kScheduledWork:
+        return "work";
+    case Source::kLambda:
+        return "lambda";
+    case Source::kDeviceEvent:
+        return "event";
+    }
+    return "unknown";
+}
+
+void StallDetector::Add(Source source, uintptr_t handler, Clock::Microseconds64 duration)
+{
+    Clock::Microseconds32 duration32(static_cast<uint32_t>(duration.count() > UINT32_MAX ? UINT32_MAX : duration.count()));
+
+    if (duration32 >= mThreshold)
+    {
+        mStallCount++;
+        ChipLogError(DeviceLayer, "Event loop stalled for %" PRIu32 " ms by %s handler 0x%" PRIxPTR,
+                     std::chrono::duration_cast<Clock::Milliseconds32>(duration32).count(),
+                     SourceName(source), handler);
+        if (mStallHandler != nullptr)
+        {
+            mStallHandler(Record{ source, handler, duration32 });
+        }
+    }
+
+    // Find where the dispatch ranks among the slowest ones, if at all.
+    size_t index = mCount;
+    while (index > 0 && mSlowest[index - 1].duration < duration32)
+    {
+        index--;
+    }
+    VerifyOrReturn(index < kMaxRecords);
+
+    size_t moved = ((mCount < kMaxRecords) ? mCount : kMaxRecords - 1) - index;
+    memmove(&mSlowest[index + 1], &mSlowest[index], moved * sizeof(Record));
+    mSlowest[index] = Record{ source, handler, duration32 };
+    mCount          = (mCount < kMaxRecords) ? mCount + 1 : kMaxRecords;
+}
+
+size_t StallDetector::GetSlowest(Record * records, size_t maxCount) const
+{
+    size_t count = (maxCount < mCount) ? maxCount : mCount;
+    memcpy(records, mSlowest, count * sizeof(Record));
+    return count;
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  Timing of the work dispatched by the event loop, to find what stalls the Matter thread.
+ */
+
+#pragma once
+
+#include <system/SystemClock.h>
+#include <system/SystemConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace chip {
+namespace System {
+
+/**
+ * Keeps the kMaxRecords slowest dispatches of the event loop, and reports every dispatch that takes longer than a
+ * threshold: it is logged, and passed to the stall handler if one is set.
+ *
+ * Handlers are identified by the address of their code, which can be resolved to a symbol with the usual tools
+ * (e.g. addr2line). Device events are identified by their type instead.
+ *
+ * All methods must be called on the Matter thread, or with the Matter stack lock held.
+ */
+class StallDetector
+{
+public:
+    static constexpr size_t kMaxRecords = CHIP_SYSTEM_CONFIG_STALL_DETECTION_MAX_RECORDS;
+
+    enum class Source : uint8_t
+    {
+        kTimer,         ///< A timer callback
+        kSocket,        ///< A socket event handler
+        kScheduledWork, ///< Work scheduled with PlatformManager::ScheduleWork
+        kLambda,        ///< A lambda scheduled with SystemLayer::ScheduleLambda
+        kDeviceEvent,   ///< A device event delivered to the device layer and application handlers
+    };
+
+    struct Record
+    {
+        Source source;
+        uintptr_t handler; ///< Address of the code that handled the dispatch, or the type of a device event
+        Clock::Microseconds32 duration;
+    };
+
+    using StallHandler = void (*)(const Record & record);
+
+    /**
+     * Times a dispatch from construction to destruction.
+     */
+    class Scope
+    {
+    public:
+        Scope(Source source, uintptr_t handler) :
+            mSource(source), mHandler(handler), mStart(SystemClock().GetMonotonicMicroseconds64())
+        {}
+        ~Scope() { Instance().Add(mSource, mHandler, SystemClock().GetMonotonicMicroseconds64() - mStart); }
+
+        Scope(const Scope &)             = delete;
+        Scope & operator=(const Scope &) = delete;
+
+    private:
+        Source mSource;
+        uintptr_t mHandler;
+        Clock::Microseconds64 mStart;
+    };
+
+    static StallDetector & Instance();
+
+    /// Identifier of a handler as stored in Record::handler: a function pointer, or an integer.
+    template <typename Handler>
+    static uintptr_t HandlerId(Handler handler)
+    {
+        if constexpr (std::is_integral<Handler>::value)
+        {
+            return static_cast<uintptr_t>(handler);
+        }
+        else
+        {
+            return reinterpret_cast<uintptr_t>(handler);
+        }
+    }
+
+    static const char * SourceName(Source source);
+
+    void Add(Source source, uintptr_t handler, Clock::Microseconds64 duration);
+
+    /**
+     * Copy up to maxCount of the slowest dispatches into records, slowest first.
+     *
+     * @return the number of records copied.
+     */
+    size_t GetSlowest(Record * records, size_t maxCount) const;
+
+    /// Forget the dispatches recorded so far.
+    void Reset() { mCount = 0; }
+
+    void SetThreshold(Clock::Milliseconds32 threshold) { mThreshold = threshold; }
+    Clock::Milliseconds32 GetThreshold() const { return mThreshold; }
+
+    /// Set a function called for every dispatch exceeding the threshold, e.g. to emit a trace event; nullptr to unset.
+    void SetStallHandler(StallHandler handler) { mStallHandler = handler; }
+
+    /// Number of dispatches that exceeded the threshold.
+    uint32_t GetStallCount() const { return mStallCount; }
+
+private:
+    Record mSlowest[kMaxRecords]; // slowest first
+    size_t mCount                    = 0;
+    uint32_t mStallCount             = 0;
+    Clock::Milliseconds32 mThreshold = Clock::Milliseconds32(CHIP_SYSTEM_CONFIG_STALL_DETECTION_THRESHOLD_MS);
+    StallHandler mStallHandler       = nullptr;
+};
+
+} // namespace System
+} // namespace chip
+
+#if CHIP_SYSTEM_CONFIG_STALL_DETECTION
+
+/**
+ * Time the rest of the enclosing block as a dispatch of the given StallDetector::Source, handled by the given function
+ * pointer or identified by the given integer.
+ */
+#define CHIP_SYSTEM_STALL_DETECTOR_SCOPE(source, handler)                                                                          \
+    ::chip::System::StallDetector::Scope _chipStallDetectorScope(::chip::System::StallDetector::Source::source,                    \
+                                                                 ::chip::System::StallDetector::HandlerId(handler))
+
+#else // CHIP_SYSTEM_CONFIG_STALL_DETECTION
+
+#define CHIP_SYSTEM_STALL_DETECTOR_SCOPE(source, handler)                                                                          \
+    do                                                                                                                             \
+    {                                                                                                                              \
+    } while (false)
+
+#endif // CHIP_SYSTEM_CONFIG_STALL_DETECTION
@@ -44,6 +44,11 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #undef LWIP_PBUF_MEMPOOL
 #else
     "Packet Buffers",
+#endif
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_HAS_SIZE_CLASSES
+    "Small packet buffers",
+    "Medium packet buffers",
+    "Large packet buffers",
 #endif
     "Timers",
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
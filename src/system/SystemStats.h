@@ -28,6 +28,7 @@
 #include <inet/InetConfig.h>
 #include <lib/core/CHIPConfig.h>
 #include <system/SystemConfig.h>
+#include <system/SystemPacketBufferInternal.h>
 
 // Include dependent headers
 #include <lib/support/DLLUtil.h>
@@ -54,6 +55,12 @@ enum
 #undef LWIP_PBUF_MEMPOOL
 #else
     kSystemLayer_NumPacketBufs,
+#endif
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_HAS_SIZE_CLASSES
+    // Packet buffers in use per pool size class; kSystemLayer_NumPacketBufs counts all of them.
+    kSystemLayer_NumSmallPacketBufs,
+    kSystemLayer_NumMediumPacketBufs,
+    kSystemLayer_NumLargePacketBufs,
 #endif
     kSystemLayer_NumTimers,
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
@@ -68,8 +75,8 @@ enum
     kNumEntries
 };
 
-typedef int8_t count_t;
-#define CHIP_SYS_STATS_COUNT_MAX INT8_MAX
+typedef int16_t count_t;
+#define CHIP_SYS_STATS_COUNT_MAX INT16_MAX
 
 extern count_t ResourcesInUse[kNumEntries];
 extern count_t HighWatermarks[kNumEntries];
@@ -35,6 +35,8 @@
 
 #include <lib/support/CodeUtils.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace System {
 
@@ -178,5 +180,508 @@ Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, vo
     return Clock::kZero;
 }
 
+namespace {
+
+bool SequenceBefore(uint32_t a, uint32_t b)
+{
+    return static_cast<int32_t>(a - b) < 0;
+}
+
+// Index of the first occupied slot in a (non-zero) occupancy bitmap.
+unsigned LowestSlot(uint64_t occupied)
+{
+    return static_cast<unsigned>(__builtin_ctzll(occupied));
+}
+
+} // namespace
+
+bool TimerWheel::FiresBefore(const Node * a, const Node * b)
+{
+    return (a->AwakenTime() < b->AwakenTime()) ||
+        (a->AwakenTime() == b->AwakenTime() && SequenceBefore(a->mSequence, b->mSequence));
+}
+
+size_t TimerWheel::BucketFor(TimerCompleteCallback onComplete, void * appState)
+{
+    uint64_t hash = (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(onComplete)) * 0x9E3779B97F4A7C15ull) ^
+        (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(appState)) * 0xC2B2AE3D27D4EB4Full);
+    return static_cast<size_t>((hash ^ (hash >> 29)) % kBuckets);
+}
+
+void TimerWheel::ListAppend(Node *& head, Node * node)
+{
+    if (head == nullptr)
+    {
+        node->mWheelNext = node;
+        node->mWheelPrev = node;
+        head             = node;
+        return;
+    }
+    Node * tail      = head->mWheelPrev;
+    node->mWheelPrev = tail;
+    node->mWheelNext = head;
+    tail->mWheelNext = node;
+    head->mWheelPrev = node;
+}
+
+void TimerWheel::ListInsertBefore(Node *& head, Node * next, Node * node)
+{
+    node->mWheelNext             = next;
+    node->mWheelPrev             = next->mWheelPrev;
+    next->mWheelPrev->mWheelNext = node;
+    next->mWheelPrev             = node;
+    if (next == head)
+    {
+        head = node;
+    }
+}
+
+void TimerWheel::ListRemove(Node *& head, Node * node)
+{
+    if (node->mWheelNext == node)
+    {
+        head = nullptr;
+    }
+    else
+    {
+        node->mWheelPrev->mWheelNext = node->mWheelNext;
+        node->mWheelNext->mWheelPrev = node->mWheelPrev;
+        if (head == node)
+        {
+            head = node->mWheelNext;
+        }
+    }
+    node->mWheelNext = nullptr;
+    node->mWheelPrev = nullptr;
+}
+
+TimerWheel::Node *& TimerWheel::ListFor(const Node * node)
+{
+    if (node->mLocation < kLevels)
+    {
+        return mSlots[node->mLocation][node->mSlot];
+    }
+    return (node->mLocation == kLocationDue) ? mDue : mOverflow;
+}
+
+void TimerWheel::Place(Node * node)
+{
+    const uint64_t expiry = Ticks(node->AwakenTime());
+
+    if (expiry < mNow)
+    {
+        // Already due. Keep the due list ordered, timers added with the same expiry fire in insertion order.
+        node->mLocation = kLocationDue;
+        if (mDue == nullptr || Ticks(mDue->mWheelPrev->AwakenTime()) <= expiry)
+        {
+            ListAppend(mDue, node);
+            return;
+        }
+        Node * next = mDue;
+        while (Ticks(next->AwakenTime()) <= expiry)
+        {
+            next = next->mWheelNext;
+        }
+        ListInsertBefore(mDue, next, node);
+        return;
+    }
+
+    for (unsigned level = 0; level < kLevels; level++)
+    {
+        const unsigned shift = level * kSlotBits;
+        if ((expiry >> shift) - (mNow >> shift) < kSlots)
+        {
+            const unsigned slot = static_cast<unsigned>((expiry >> shift) & (kSlots - 1));
+            node->mLocation     = static_cast<uint8_t>(level);
+            node->mSlot         = static_cast<uint8_t>(slot);
+            mOccupied[level] |= (1ull << slot);
+
+            Node *& head = mSlots[level][slot];
+            if (level == 0 && head != nullptr && SequenceBefore(node->mSequence, head->mWheelPrev->mSequence))
+            {
+                // Cascaded timers are older than the ones added straight to level 0; keep the slot in insertion order.
+                Node * next = head;
+                while (!SequenceBefore(node->mSequence, next->mSequence))
+                {
+                    next = next->mWheelNext;
+                }
+                ListInsertBefore(head, next, node);
+                return;
+            }
+            ListAppend(head, node);
+            return;
+        }
+    }
+
+    node->mLocation = kLocationOverflow;
+    ListAppend(mOverflow, node);
+}
+
+void TimerWheel::Unlink(Node * node)
+{
+    Node *& head = ListFor(node);
+    ListRemove(head, node);
+    if (node->mLocation < kLevels && head == nullptr)
+    {
+        mOccupied[node->mLocation] &= ~(1ull << node->mSlot);
+    }
+    node->mLocation = kLocationNone;
+
+    Node ** link = &mBuckets[BucketFor(node->GetCallback().GetOnComplete(), node->GetCallback().GetAppState())];
+    while (*link != nullptr && *link != node)
+    {
+        link = &(*link)->mBucketNext;
+    }
+    if (*link == node)
+    {
+        *link = node->mBucketNext;
+    }
+    node->mBucketNext = nullptr;
+
+    mCount--;
+    if (mEarliest == node)
+    {
+        mEarliest = nullptr;
+    }
+}
+
+void TimerWheel::MoveSlotToDue(unsigned slot)
+{
+    Node * head = mSlots[0][slot];
+    mSlots[0][slot] = nullptr;
+    mOccupied[0] &= ~(1ull << slot);
+
+    // Every timer of a level 0 slot expires on the same tick, which is later than any timer already due.
+    head->mWheelPrev->mWheelNext = nullptr;
+    for (Node * node = head; node != nullptr;)
+    {
+        Node * next     = node->mWheelNext;
+        node->mLocation = kLocationDue;
+        ListAppend(mDue, node);
+        node = next;
+    }
+}
+
+void TimerWheel::Cascade()
+{
+    auto replace = [this](Node * head) {
+        if (head == nullptr)
+        {
+            return;
+        }
+        head->mWheelPrev->mWheelNext = nullptr;
+        for (Node * node = head; node != nullptr;)
+        {
+            Node * next = node->mWheelNext;
+            Place(node);
+            node = next;
+        }
+    };
+
+    if ((mNow & ((1ull << (kLevels * kSlotBits)) - 1)) == 0)
+    {
+        Node * overflow = mOverflow;
+        mOverflow       = nullptr;
+        replace(overflow);
+    }
+
+    for (unsigned level = kLevels - 1; level > 0; level--)
+    {
+        const unsigned shift = level * kSlotBits;
+        if ((mNow & ((1ull << shift) - 1)) != 0)
+        {
+            continue;
+        }
+        const unsigned slot = static_cast<unsigned>((mNow >> shift) & (kSlots - 1));
+        Node * head         = mSlots[level][slot];
+        mSlots[level][slot] = nullptr;
+        mOccupied[level] &= ~(1ull << slot);
+        replace(head);
+    }
+}
+
+void TimerWheel::Advance(uint64_t target)
+{
+    while (mNow < target)
+    {
+        uint64_t next;
+
+        if (mOccupied[0] != 0)
+        {
+            const unsigned current = static_cast<unsigned>(mNow & (kSlots - 1));
+            const uint64_t pending = mOccupied[0] & (~0ull << current);
+            if (pending != 0)
+            {
+                const unsigned slot = LowestSlot(pending);
+                const uint64_t tick = (mNow & ~static_cast<uint64_t>(kSlots - 1)) + slot;
+                if (tick >= target)
+                {
+                    break;
+                }
+                mNow = tick;
+                MoveSlotToDue(slot);
+                mNow = tick + 1;
+                if ((mNow & (kSlots - 1)) == 0)
+                {
+                    Cascade();
+                }
+                continue;
+            }
+            // The remaining level 0 timers have wrapped around, the next thing to do is the next cascade.
+            next = (mNow | (kSlots - 1)) + 1;
+        }
+        else
+        {
+            // Nothing expires before the next occupied slot of the lowest occupied level, or before the end of the
+            // rotation of that level, so jump straight there.
+            unsigned level = 1;
+            while (level < kLevels && mOccupied[level] == 0)
+            {
+                level++;
+            }
+
+            if (level < kLevels)
+            {
+                const unsigned shift         = level * kSlotBits;
+                const unsigned current       = static_cast<unsigned>((mNow >> shift) & (kSlots - 1));
+                const uint64_t pending       = (current == kSlots - 1) ? 0 : (mOccupied[level] & (~0ull << (current + 1)));
+                const uint64_t rotationStart = (mNow >> (shift + kSlotBits)) << (shift + kSlotBits);
+                next = (pending != 0) ? rotationStart + (static_cast<uint64_t>(LowestSlot(pending)) << shift)
+                                      : rotationStart + (1ull << (shift + kSlotBits));
+            }
+            else if (mOverflow != nullptr)
+            {
+                next = ((mNow >> (kLevels * kSlotBits)) + 1) << (kLevels * kSlotBits);
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (next > target)
+        {
+            break;
+        }
+        mNow = next;
+        Cascade();
+    }
+
+    if (mNow < target)
+    {
+        mNow = target;
+    }
+}
+
+TimerWheel::Node * TimerWheel::FindByCallback(TimerCompleteCallback onComplete, void * appState) const
+{
+    Node * found = nullptr;
+    for (Node * node = mBuckets[BucketFor(onComplete, appState)]; node != nullptr; node = node->mBucketNext)
+    {
+        if (node->GetCallback().GetOnComplete() == onComplete && node->GetCallback().GetAppState() == appState &&
+            (found == nullptr || FiresBefore(node, found)))
+        {
+            found = node;
+        }
+    }
+    return found;
+}
+
+TimerWheel::Node * TimerWheel::ComputeEarliest() const
+{
+    if (mDue != nullptr)
+    {
+        return mDue;
+    }
+
+    Node * earliest = nullptr;
+    auto consider   = [&earliest](Node * head) {
+        Node * node = head;
+        do
+        {
+            if (earliest == nullptr || FiresBefore(node, earliest))
+            {
+                earliest = node;
+            }
+            node = node->mWheelNext;
+        } while (node != head);
+    };
+
+    // Higher levels may hold timers that expire before the wrapped-around slots of lower levels, so look at the next
+    // occupied slot of every level.
+    for (unsigned level = 0; level < kLevels; level++)
+    {
+        if (mOccupied[level] == 0)
+        {
+            continue;
+        }
+
+        const unsigned shift    = level * kSlotBits;
+        const unsigned start    = static_cast<unsigned>(((mNow >> shift) + (level == 0 ? 0 : 1)) & (kSlots - 1));
+        const uint64_t occupied = mOccupied[level];
+        const uint64_t bits     = (start == 0) ? occupied : (occupied >> start) | (occupied << (kSlots - start));
+        const unsigned slot     = (start + LowestSlot(bits)) & (kSlots - 1);
+
+        if (level == 0)
+        {
+            // Every timer in a level 0 slot has the same expiry; the first one was added first.
+            Node * head = mSlots[0][slot];
+            if (earliest == nullptr || FiresBefore(head, earliest))
+            {
+                earliest = head;
+            }
+            continue;
+        }
+        consider(mSlots[level][slot]);
+    }
+
+    // Overflow timers all expire after the current rotation of the top level.
+    const uint64_t overflowFloor = ((mNow >> (kLevels * kSlotBits)) + 1) << (kLevels * kSlotBits);
+    if (mOverflow != nullptr && (earliest == nullptr || Ticks(earliest->AwakenTime()) >= overflowFloor))
+    {
+        consider(mOverflow);
+    }
+
+    return earliest;
+}
+
+TimerWheel::Node * TimerWheel::Add(Node * timer)
+{
+    VerifyOrDie(timer->mLocation == kLocationNone);
+
+    if (mCount == 0)
+    {
+        // Nothing depends on the current position of an empty wheel, so move it to the present.
+        mNow = std::min(Ticks(SystemClock().GetMonotonicTimestamp()), Ticks(timer->AwakenTime()));
+    }
+
+    timer->mSequence = mNextSequence++;
+    Place(timer);
+
+    Node *& bucket     = mBuckets[BucketFor(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState())];
+    timer->mBucketNext = bucket;
+    bucket             = timer;
+
+    mCount++;
+    if (mCount == 1 || (mEarliest != nullptr && timer->AwakenTime() < mEarliest->AwakenTime()))
+    {
+        mEarliest = timer;
+    }
+    return Earliest();
+}
+
+TimerWheel::Node * TimerWheel::Remove(Node * remove)
+{
+    if (remove != nullptr && remove->mLocation != kLocationNone)
+    {
+        Unlink(remove);
+    }
+    return Earliest();
+}
+
+TimerWheel::Node * TimerWheel::Remove(TimerCompleteCallback onComplete, void * appState)
+{
+    Node * timer = FindByCallback(onComplete, appState);
+    if (timer != nullptr)
+    {
+        Unlink(timer);
+    }
+    return timer;
+}
+
+TimerWheel::Node * TimerWheel::PopEarliest()
+{
+    Node * earliest = Earliest();
+    if (earliest != nullptr)
+    {
+        Unlink(earliest);
+    }
+    return earliest;
+}
+
+TimerWheel::Node * TimerWheel::PopIfEarlier(Clock::Timestamp t)
+{
+    Advance(Ticks(t));
+    if (mDue == nullptr || !(mDue->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    Node * earliest = mDue;
+    Unlink(earliest);
+    return earliest;
+}
+
+TimerWheel::Node * TimerWheel::Earliest() const
+{
+    if (mEarliest == nullptr && mCount != 0)
+    {
+        mEarliest = ComputeEarliest();
+    }
+    return mEarliest;
+}
+
+TimerList TimerWheel::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+    TimerList::Node * last = nullptr;
+
+    Advance(Ticks(t));
+    while (mDue != nullptr && mDue->AwakenTime() < t)
+    {
+        Node * timer = mDue;
+        Unlink(timer);
+        timer->mNextTimer = nullptr;
+        if (last == nullptr)
+        {
+            out.mEarliestTimer = timer;
+        }
+        else
+        {
+            last->mNextTimer = timer;
+        }
+        last = timer;
+    }
+
+    return out;
+}
+
+void TimerWheel::Clear()
+{
+    for (auto & level : mSlots)
+    {
+        for (auto & slot : level)
+        {
+            slot = nullptr;
+        }
+    }
+    for (auto & occupied : mOccupied)
+    {
+        occupied = 0;
+    }
+    for (auto & bucket : mBuckets)
+    {
+        bucket = nullptr;
+    }
+    mDue          = nullptr;
+    mOverflow     = nullptr;
+    mNow          = 0;
+    mCount        = 0;
+    mNextSequence = 0;
+    mEarliest     = nullptr;
+}
+
+Clock::Timeout TimerWheel::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = FindByCallback(aOnComplete, aAppState);
+    VerifyOrReturnValue(timer != nullptr, Clock::kZero);
+
+    Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    if (currentTime < timer->AwakenTime())
+    {
+        return Clock::Timeout(timer->AwakenTime() - currentTime);
+    }
+    return Clock::kZero;
+}
+
 } // namespace System
 } // namespace chip
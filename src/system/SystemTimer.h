@@ -186,9 +186,152 @@ public:
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
 private:
+    friend class TimerWheel;
+
     Node * mEarliestTimer;
 };
 
+/**
+ * Hierarchical timer wheel with the same interface as `TimerList`.
+ *
+ * Timers are hashed into 64 slots per level according to their expiration time, with a millisecond resolution at the
+ * lowest level, and are cascaded to lower levels as time advances. Timers that expire beyond the range of the wheel wait on
+ * an overflow list until they get close enough. A hash table keyed by callback and application state makes lookups by
+ * callback O(1) as well, so adding, removing and cancelling timers do not depend on the number of active timers.
+ *
+ * Time only advances when expired timers are extracted (ExtractEarlier / PopIfEarlier). The extracted timers are returned
+ * as a plain, ordered `TimerList`.
+ *
+ * Nodes must be `TimerWheel::Node`s, i.e. the owning `TimerPool` must be a `TimerPool<TimerWheel::Node>`.
+ */
+class TimerWheel
+{
+public:
+    class Node : public TimerList::Node
+    {
+    public:
+        Node(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState) :
+            TimerList::Node(systemLayer, awakenTime, onComplete, appState)
+        {}
+
+    private:
+        friend class TimerWheel;
+
+        Node * mWheelNext  = nullptr; // Circular list of the slot / due / overflow list the node is in.
+        Node * mWheelPrev  = nullptr;
+        Node * mBucketNext = nullptr; // Chain of the (callback, appState) hash bucket.
+        uint32_t mSequence = 0;       // Order of addition, to fire timers with the same expiry in insertion order.
+        uint8_t mLocation  = kLocationNone;
+        uint8_t mSlot      = 0;
+    };
+
+    TimerWheel() { Clear(); }
+
+    TimerWheel(const TimerWheel &)             = delete;
+    TimerWheel & operator=(const TimerWheel &) = delete;
+
+    /**
+     * @copydoc TimerList::Add
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * @copydoc TimerList::Remove(Node *)
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the earliest timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the wheel contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * @copydoc TimerList::PopEarliest
+     */
+    Node * PopEarliest();
+
+    /**
+     * @copydoc TimerList::PopIfEarlier
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * @copydoc TimerList::Earliest
+     */
+    Node * Earliest() const;
+
+    /**
+     * @copydoc TimerList::Empty
+     */
+    bool Empty() const { return mCount == 0; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t, ordered by expiration time.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * @copydoc TimerList::Clear
+     */
+    void Clear();
+
+    /**
+     * @copydoc TimerList::GetRemainingTime
+     */
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
+
+private:
+    static constexpr unsigned kSlotBits = 6;
+    static constexpr unsigned kSlots    = 1u << kSlotBits;
+    static constexpr unsigned kLevels   = 4;
+
+    // Values of Node::mLocation besides the wheel levels.
+    static constexpr uint8_t kLocationDue      = kLevels;
+    static constexpr uint8_t kLocationOverflow = kLevels + 1;
+    static constexpr uint8_t kLocationNone     = kLevels + 2;
+
+    static constexpr size_t kBuckets = CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS;
+    static_assert(kBuckets > 0, "The timer wheel needs at least one hash bucket");
+
+    static uint64_t Ticks(Clock::Timestamp t) { return t.count(); }
+    static size_t BucketFor(TimerCompleteCallback onComplete, void * appState);
+    static bool FiresBefore(const Node * a, const Node * b);
+
+    static void ListAppend(Node *& head, Node * node);
+    static void ListInsertBefore(Node *& head, Node * next, Node * node);
+    static void ListRemove(Node *& head, Node * node);
+
+    Node *& ListFor(const Node * node);
+    void Place(Node * node);
+    void Unlink(Node * node);
+    void Advance(uint64_t target);
+    void Cascade();
+    void MoveSlotToDue(unsigned slot);
+    Node * FindByCallback(TimerCompleteCallback onComplete, void * appState) const;
+    Node * ComputeEarliest() const;
+
+    Node * mSlots[kLevels][kSlots];
+    uint64_t mOccupied[kLevels];
+    Node * mDue;      // Timers expiring before mNow, ordered by expiration time.
+    Node * mOverflow; // Timers too far in the future for the wheel, unordered.
+    Node * mBuckets[kBuckets];
+    uint64_t mNow; // Every tick before this one has been processed.
+    size_t mCount;
+    uint32_t mNextSequence;
+    mutable Node * mEarliest; // Cached result of Earliest(), nullptr when it needs to be recomputed.
+};
+
+/**
+ * Timer queue used by the System::Layer implementations that support both `TimerList` and `TimerWheel`.
+ */
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+using TimerQueue = TimerWheel;
+#else
+using TimerQueue = TimerList;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
@@ -91,4 +91,21 @@ TEST(TestSystemClock, TestMockClock)
     EXPECT_EQ(SystemClock().GetMonotonicMicroseconds64(), k1234);
 }
 
+TEST(TestSystemClock, TestCachedMonotonicTimestamp)
+{
+    Clock::Internal::RAIIMockClock clock;
+
+    // Without a cached time, the current one is returned.
+    clock.SetMonotonic(Clock::Milliseconds64(100));
+    EXPECT_EQ(SystemClock().GetCachedMonotonicTimestamp(), Clock::Milliseconds64(100));
+
+    EXPECT_EQ(SystemClock().CacheMonotonicTimestamp(), Clock::Milliseconds64(100));
+    clock.AdvanceMonotonic(Clock::Milliseconds64(50));
+    EXPECT_EQ(SystemClock().GetCachedMonotonicTimestamp(), Clock::Milliseconds64(100));
+    EXPECT_EQ(SystemClock().GetMonotonicTimestamp(), Clock::Milliseconds64(150));
+
+    SystemClock().ClearCachedMonotonicTimestamp();
+    EXPECT_EQ(SystemClock().GetCachedMonotonicTimestamp(), Clock::Milliseconds64(150));
+}
+
 } // namespace
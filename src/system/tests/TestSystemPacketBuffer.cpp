@@ -45,6 +45,10 @@
 #include <lwip/tcpip.h>
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+#include <thread>
+#endif // CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #if (LWIP_VERSION_MAJOR == 2) && (LWIP_VERSION_MINOR == 0)
 #define PBUF_TYPE(pbuf) (pbuf)->type
@@ -1719,6 +1723,60 @@ TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckHandleCloneData)
 #endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
 }
 
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_HAS_SIZE_CLASSES
+TEST_F(TestSystemPacketBuffer, CheckPoolSizeClasses)
+{
+    // A small request gets a buffer from a smaller class, a full size one gets a full size buffer.
+    PacketBufferHandle small = PacketBufferHandle::New(20, 0);
+    ASSERT_FALSE(small.IsNull());
+    EXPECT_GE(small->AllocSize(), 20u);
+    EXPECT_LT(small->AllocSize(), PacketBuffer::kMaxSizeWithoutReserve);
+
+    PacketBufferHandle large = PacketBufferHandle::New(PacketBuffer::kMaxSizeWithoutReserve, 0);
+    ASSERT_FALSE(large.IsNull());
+    EXPECT_EQ(large->AllocSize(), PacketBuffer::kMaxSizeWithoutReserve);
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_POOL_HAS_SIZE_CLASSES
+
+#if CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+TEST_F(TestSystemPacketBuffer, CheckPoolLockFreeConcurrentUse)
+{
+    constexpr int kThreadCount    = 4;
+    constexpr int kIterationCount = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreadCount; t++)
+    {
+        threads.emplace_back([] {
+            for (int i = 0; i < kIterationCount; i++)
+            {
+                const size_t size         = static_cast<size_t>(i) % PacketBuffer::kMaxSizeWithoutReserve;
+                PacketBufferHandle first  = PacketBufferHandle::New(size, 0);
+                PacketBufferHandle second = PacketBufferHandle::New(20, 0);
+                if (!first.IsNull())
+                {
+                    PacketBufferHandle shared = first.Retain();
+                }
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every buffer made it back to the pool.
+    std::vector<PacketBufferHandle> buffers;
+    for (PacketBufferHandle buffer = PacketBufferHandle::New(20, 0); !buffer.IsNull(); buffer = PacketBufferHandle::New(20, 0))
+    {
+        buffers.push_back(std::move(buffer));
+    }
+    EXPECT_EQ(buffers.size(),
+              static_cast<size_t>(CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE + CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SMALL_SIZE +
+                                  CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_MEDIUM_SIZE));
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_POOL_LOCK_FREE
+
 TEST_F(TestSystemPacketBuffer, CheckPacketBufferWriter)
 {
     static const char kPayload[] = "Hello, world!";
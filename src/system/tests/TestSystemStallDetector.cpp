@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <system/RAIIMockClock.h>
+#include <system/SystemStallDetector.h>
+
+using namespace chip::System;
+
+namespace {
+
+StallDetector::Record gLastStall;
+unsigned gStallHandlerCalls = 0;
+
+void OnStall(const StallDetector::Record & record)
+{
+    gLastStall = record;
+    gStallHandlerCalls++;
+}
+
+void TimerHandler() {}
+
+class TestSystemStallDetector : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        mDetector.SetStallHandler(OnStall);
+        gStallHandlerCalls = 0;
+    }
+
+protected:
+    StallDetector mDetector;
+};
+
+TEST_F(TestSystemStallDetector, TestKeepsSlowest)
+{
+    // Durations in ms, sent to the same handler; only the slowest kMaxRecords are kept, slowest first.
+    for (uint32_t i = 1; i <= 2 * StallDetector::kMaxRecords; i++)
+    {
+        mDetector.Add(StallDetector::Source::kTimer, static_cast<uintptr_t>(i), Clock::Milliseconds64((i * 7) % 23));
+    }
+
+    StallDetector::Record records[StallDetector::kMaxRecords + 1];
+    size_t count = mDetector.GetSlowest(records, MATTER_ARRAY_SIZE(records));
+    ASSERT_EQ(count, StallDetector::kMaxRecords);
+    for (size_t i = 1; i < count; i++)
+    {
+        EXPECT_GE(records[i - 1].duration, records[i].duration);
+    }
+    EXPECT_EQ(records[0].duration, Clock::Milliseconds32(22));
+
+    EXPECT_EQ(mDetector.GetSlowest(records, 1), 1u);
+    EXPECT_EQ(records[0].duration, Clock::Milliseconds32(22));
+
+    mDetector.Reset();
+    EXPECT_EQ(mDetector.GetSlowest(records, MATTER_ARRAY_SIZE(records)), 0u);
+}
+
+TEST_F(TestSystemStallDetector, TestThreshold)
+{
+    mDetector.SetThreshold(Clock::Milliseconds32(50));
+
+    mDetector.Add(StallDetector::Source::kSocket, 1, Clock::Milliseconds64(49));
+    EXPECT_EQ(gStallHandlerCalls, 0u);
+    EXPECT_EQ(mDetector.GetStallCount(), 0u);
+
+    mDetector.Add(StallDetector::Source::kTimer, StallDetector::HandlerId(&TimerHandler), Clock::Milliseconds64(120));
+    EXPECT_EQ(gStallHandlerCalls, 1u);
+    EXPECT_EQ(mDetector.GetStallCount(), 1u);
+    EXPECT_EQ(gLastStall.source, StallDetector::Source::kTimer);
+    EXPECT_EQ(gLastStall.handler, reinterpret_cast<uintptr_t>(&TimerHandler));
+    EXPECT_EQ(gLastStall.duration, Clock::Milliseconds32(120));
+}
+
+TEST_F(TestSystemStallDetector, TestScope)
+{
+    Clock::Internal::RAIIMockClock clock;
+
+    {
+        StallDetector::Scope scope(StallDetector::Source::kScheduledWork, 42);
+        clock.AdvanceMonotonic(Clock::Milliseconds64(15));
+    }
+
+    // Scopes report to the shared instance.
+    StallDetector::Record record;
+    ASSERT_EQ(StallDetector::Instance().GetSlowest(&record, 1), 1u);
+    EXPECT_EQ(record.source, StallDetector::Source::kScheduledWork);
+    EXPECT_EQ(record.handler, 42u);
+    EXPECT_EQ(record.duration, Clock::Milliseconds32(15));
+    StallDetector::Instance().Reset();
+}
+
+} // namespace
@@ -0,0 +1,264 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for TimerWheel, checked against TimerList, plus a rough comparison of their cost.
+ */
+
+#include <chrono>
+#include <deque>
+#include <inttypes.h>
+#include <random>
+#include <stdio.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <system/RAIIMockClock.h>
+#include <system/SystemLayerImpl.h>
+#include <system/SystemTimer.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System;
+using namespace chip::System::Clock::Literals;
+
+LayerImpl sLayer; // Only used as the owner recorded in timer nodes; never initialized.
+
+void Callback(Layer *, void *) {}
+void OtherCallback(Layer *, void *) {}
+
+int sAppStates[256];
+
+template <typename NodeType>
+class NodeStore
+{
+public:
+    NodeType * Make(Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState)
+    {
+        return &mNodes.emplace_back(sLayer, awakenTime, onComplete, appState);
+    }
+
+private:
+    std::deque<NodeType> mNodes;
+};
+
+TEST(TestTimerWheel, TestExtractInOrder)
+{
+    Clock::Internal::RAIIMockClock clock;
+    clock.SetMonotonic(1000_ms64);
+
+    TimerWheel wheel;
+    NodeStore<TimerWheel::Node> nodes;
+    EXPECT_TRUE(wheel.Empty());
+
+    // Spread over every level of the wheel and the overflow list.
+    const uint64_t delays[] = { 5, 1, 63, 64, 65, 4000, 4096, 300000, 262144, 20000000, 100000000, 5 };
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(delays); i++)
+    {
+        wheel.Add(nodes.Make(Clock::Timestamp(1000 + delays[i]), Callback, &sAppStates[i]));
+    }
+    EXPECT_FALSE(wheel.Empty());
+    ASSERT_NE(wheel.Earliest(), nullptr);
+    EXPECT_EQ(wheel.Earliest()->AwakenTime(), Clock::Timestamp(1001));
+
+    // Nothing expires before 1001.
+    TimerList none = wheel.ExtractEarlier(Clock::Timestamp(1001));
+    EXPECT_TRUE(none.Empty());
+
+    TimerList first = wheel.ExtractEarlier(Clock::Timestamp(1006));
+    ASSERT_NE(first.Earliest(), nullptr);
+    EXPECT_EQ(first.PopEarliest()->AwakenTime(), Clock::Timestamp(1001));
+    // Timers with the same expiry come out in insertion order.
+    TimerList::Node * five = first.PopEarliest();
+    ASSERT_NE(five, nullptr);
+    EXPECT_EQ(five->GetCallback().GetAppState(), &sAppStates[0]);
+    five = first.PopEarliest();
+    ASSERT_NE(five, nullptr);
+    EXPECT_EQ(five->GetCallback().GetAppState(), &sAppStates[11]);
+    EXPECT_TRUE(first.Empty());
+
+    uint64_t previous = 0;
+    size_t extracted  = 3;
+    TimerList rest    = wheel.ExtractEarlier(Clock::Timestamp(1000 + 100000001));
+    for (TimerList::Node * node = rest.PopEarliest(); node != nullptr; node = rest.PopEarliest())
+    {
+        EXPECT_LE(previous, node->AwakenTime().count());
+        previous = node->AwakenTime().count();
+        extracted++;
+    }
+    EXPECT_EQ(extracted, MATTER_ARRAY_SIZE(delays));
+    EXPECT_TRUE(wheel.Empty());
+    EXPECT_EQ(wheel.Earliest(), nullptr);
+}
+
+TEST(TestTimerWheel, TestRemoveByCallback)
+{
+    Clock::Internal::RAIIMockClock clock;
+    clock.SetMonotonic(50_ms64);
+
+    TimerWheel wheel;
+    NodeStore<TimerWheel::Node> nodes;
+
+    TimerWheel::Node * a = nodes.Make(Clock::Timestamp(150), Callback, &sAppStates[0]);
+    TimerWheel::Node * b = nodes.Make(Clock::Timestamp(90), Callback, &sAppStates[1]);
+    TimerWheel::Node * c = nodes.Make(Clock::Timestamp(70), OtherCallback, &sAppStates[0]);
+
+    EXPECT_EQ(wheel.Add(a), a);
+    EXPECT_EQ(wheel.Add(b), b);
+    EXPECT_EQ(wheel.Add(c), c);
+
+    EXPECT_EQ(wheel.GetRemainingTime(Callback, &sAppStates[0]), Clock::Timeout(100));
+    EXPECT_EQ(wheel.GetRemainingTime(OtherCallback, &sAppStates[1]), Clock::kZero);
+
+    EXPECT_EQ(wheel.Remove(OtherCallback, &sAppStates[1]), nullptr);
+    EXPECT_EQ(wheel.Remove(OtherCallback, &sAppStates[0]), c);
+    EXPECT_EQ(wheel.Earliest(), b);
+
+    EXPECT_EQ(wheel.Remove(b), a);
+    // Removing a timer that is not in the wheel is harmless.
+    EXPECT_EQ(wheel.Remove(b), a);
+
+    EXPECT_EQ(wheel.PopIfEarlier(Clock::Timestamp(150)), nullptr);
+    EXPECT_EQ(wheel.PopIfEarlier(Clock::Timestamp(151)), a);
+    EXPECT_TRUE(wheel.Empty());
+}
+
+TEST(TestTimerWheel, TestMatchesTimerList)
+{
+    Clock::Internal::RAIIMockClock clock;
+    clock.SetMonotonic(12345_ms64);
+
+    TimerWheel wheel;
+    TimerList list;
+    NodeStore<TimerWheel::Node> wheelNodes;
+    NodeStore<TimerList::Node> listNodes;
+
+    std::mt19937 random(42);
+    uint64_t now = 12345;
+
+    for (int step = 0; step < 20000; step++)
+    {
+        const uint32_t op = random() % 10;
+        void * appState   = &sAppStates[random() % MATTER_ARRAY_SIZE(sAppStates)];
+
+        if (op < 5)
+        {
+            // Mostly short timers, with the occasional very long one.
+            uint64_t delay = (random() % 8 == 0) ? (random() % 100000000) : (random() % 5000);
+            Clock::Timestamp awakenTime(now + delay);
+
+            // Like System::Layer::StartTimer: cancel first, so there is at most one timer per appState.
+            TimerList::Node * removedFromList   = list.Remove(Callback, appState);
+            TimerWheel::Node * removedFromWheel = wheel.Remove(Callback, appState);
+            EXPECT_EQ(removedFromList == nullptr, removedFromWheel == nullptr);
+
+            list.Add(listNodes.Make(awakenTime, Callback, appState));
+            wheel.Add(wheelNodes.Make(awakenTime, Callback, appState));
+        }
+        else if (op < 7)
+        {
+            TimerList::Node * removedFromList   = list.Remove(Callback, appState);
+            TimerWheel::Node * removedFromWheel = wheel.Remove(Callback, appState);
+            ASSERT_EQ(removedFromList == nullptr, removedFromWheel == nullptr);
+            if (removedFromList != nullptr)
+            {
+                EXPECT_EQ(removedFromList->AwakenTime(), removedFromWheel->AwakenTime());
+            }
+        }
+        else if (op == 7)
+        {
+            TimerList::Node * expectedNode = list.PopEarliest();
+            TimerWheel::Node * actualNode  = wheel.PopEarliest();
+            ASSERT_EQ(expectedNode == nullptr, actualNode == nullptr);
+            if (expectedNode != nullptr)
+            {
+                EXPECT_EQ(expectedNode->AwakenTime(), actualNode->AwakenTime());
+                EXPECT_EQ(expectedNode->GetCallback().GetAppState(), actualNode->GetCallback().GetAppState());
+            }
+        }
+        else
+        {
+            now += (random() % 4 == 0) ? (random() % 10000000) : (random() % 200);
+            clock.SetMonotonic(Clock::Milliseconds64(now));
+
+            TimerList fromList  = list.ExtractEarlier(Clock::Timestamp(now));
+            TimerList fromWheel = wheel.ExtractEarlier(Clock::Timestamp(now));
+            for (;;)
+            {
+                TimerList::Node * expectedNode = fromList.PopEarliest();
+                TimerList::Node * actualNode   = fromWheel.PopEarliest();
+                ASSERT_EQ(expectedNode == nullptr, actualNode == nullptr);
+                if (expectedNode == nullptr)
+                {
+                    break;
+                }
+                EXPECT_EQ(expectedNode->AwakenTime(), actualNode->AwakenTime());
+                EXPECT_EQ(expectedNode->GetCallback().GetAppState(), actualNode->GetCallback().GetAppState());
+            }
+        }
+
+        ASSERT_EQ(list.Empty(), wheel.Empty());
+        if (!list.Empty())
+        {
+            ASSERT_EQ(list.Earliest()->AwakenTime(), wheel.Earliest()->AwakenTime());
+        }
+    }
+}
+
+// Not a real benchmark, but gives an idea of how both implementations scale with the number of active timers, for the
+// typical StartTimer (cancel + add) and CancelTimer pattern.
+template <typename Queue, typename NodeType>
+uint64_t MeasureStartCancel(size_t timerCount)
+{
+    Queue queue;
+    NodeStore<NodeType> nodes;
+    std::mt19937 random(7);
+    std::deque<int> appStates(timerCount);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < timerCount; i++)
+    {
+        (void) queue.Remove(Callback, &appStates[i]);
+        queue.Add(nodes.Make(Clock::Timestamp(1000 + random() % 60000), Callback, &appStates[i]));
+    }
+    for (size_t i = 0; i < timerCount; i++)
+    {
+        (void) queue.Remove(Callback, &appStates[i]);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / (2 * timerCount);
+}
+
+TEST(TestTimerWheel, TestCompareWithTimerList)
+{
+    Clock::Internal::RAIIMockClock clock;
+    clock.SetMonotonic(1000_ms64);
+
+    for (size_t timerCount : { 16u, 256u, 4096u })
+    {
+        uint64_t listNs  = MeasureStartCancel<TimerList, TimerList::Node>(timerCount);
+        uint64_t wheelNs = MeasureStartCancel<TimerWheel, TimerWheel::Node>(timerCount);
+        printf("%5u timers: TimerList %6" PRIu64 " ns/op, TimerWheel %6" PRIu64 " ns/op\n", static_cast<unsigned>(timerCount),
+               listNs, wheelNs);
+    }
+}
+
+} // namespace
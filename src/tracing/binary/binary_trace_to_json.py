@@ -0,0 +1,148 @@
+#!/usr/bin/env -S python3 -B
+
+#
+#    Copyright (c) 2026 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+"""Converts a trace written by chip::Tracing::Binary::BinaryBackend::Dump into
+the Chrome trace event (JSON) format, which Perfetto UI (ui.perfetto.dev) and
+chrome://tracing can open.
+
+See binary_tracing.cpp for the layout of the input file.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+FILE_MAGIC = b'MTRB'
+FILE_VERSION = 1
+
+RECORD = struct.Struct('<QIHBB')
+
+EVENT_BEGIN = 0
+EVENT_END = 1
+EVENT_INSTANT = 2
+EVENT_COUNTER = 3
+
+OVERFLOW_LABEL_ID = 0xFFFF
+OVERFLOW_GROUP_ID = 0xFF
+
+
+class Reader:
+    def __init__(self, data: bytes):
+        self.data = data
+        self.offset = 0
+
+    def read(self, size: int) -> bytes:
+        if self.offset + size > len(self.data):
+            raise ValueError('Truncated trace file')
+        value = self.data[self.offset:self.offset + size]
+        self.offset += size
+        return value
+
+    def u16(self) -> int:
+        return struct.unpack('<H', self.read(2))[0]
+
+    def u32(self) -> int:
+        return struct.unpack('<I', self.read(4))[0]
+
+    def strings(self) -> list:
+        return [self.read(self.u16()).decode('utf-8', errors='replace') for _ in range(self.u32())]
+
+
+def lookup(strings: list, index: int, overflow_id: int) -> str:
+    if index == overflow_id:
+        return '<overflow>'
+    if index >= len(strings):
+        return '<unknown %d>' % index
+    return strings[index]
+
+
+def convert(data: bytes, pid: int) -> dict:
+    reader = Reader(data)
+    if reader.read(4) != FILE_MAGIC:
+        raise ValueError('Not a binary trace file')
+    version = reader.u32()
+    if version != FILE_VERSION:
+        raise ValueError('Unsupported binary trace version %d' % version)
+
+    labels = reader.strings()
+    groups = reader.strings()
+
+    records = []
+    for _ in range(reader.u32()):
+        thread_index = reader.u32()
+        for _ in range(reader.u32()):
+            records.append((thread_index,) + RECORD.unpack(reader.read(RECORD.size)))
+
+    # Counters only carry increments; their values are rebuilt in time order.
+    records.sort(key=lambda record: record[1])
+    start_ns = records[0][1] if records else 0
+    counters = {}
+
+    events = []
+    for thread_index, timestamp_ns, arg, label_id, group_id, event_type in records:
+        name = lookup(labels, label_id, OVERFLOW_LABEL_ID)
+        event = {
+            'name': name,
+            'cat': lookup(groups, group_id, OVERFLOW_GROUP_ID),
+            'ts': (timestamp_ns - start_ns) / 1000.0,
+            'pid': pid,
+            'tid': thread_index,
+        }
+
+        if event_type == EVENT_BEGIN:
+            event['ph'] = 'B'
+        elif event_type == EVENT_END:
+            event['ph'] = 'E'
+        elif event_type == EVENT_INSTANT:
+            event['ph'] = 'i'
+            event['s'] = 't'
+        elif event_type == EVENT_COUNTER:
+            counters[name] = counters.get(name, 0) + 1
+            event['ph'] = 'C'
+            event['args'] = {'count': counters[name]}
+        else:
+            continue
+
+        if arg and event_type != EVENT_COUNTER:
+            event['args'] = {'value': arg}
+        events.append(event)
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a Matter binary trace into Chrome/Perfetto JSON.')
+    parser.add_argument('input', help='Binary trace, as written by BinaryBackend::Dump')
+    parser.add_argument('output', nargs='?', help='Output JSON file (default: stdout)')
+    parser.add_argument('--pid', type=int, default=1, help='Process id to report events under')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        trace = convert(f.read(), args.pid)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
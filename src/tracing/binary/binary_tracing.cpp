@@ -0,0 +1,366 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/binary/binary_tracing.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <tracing/metric_event.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+namespace {
+
+/// File layout (all integers little endian):
+///
+///   magic "MTRB", uint32 version
+///   uint32 labelCount, labelCount x (uint16 length, bytes)
+///   uint32 groupCount, groupCount x (uint16 length, bytes)
+///   uint32 threadCount, threadCount x (uint32 threadIndex, uint32 recordCount,
+///                                      recordCount x (uint64 timestampNs, uint32 arg,
+///                                                     uint16 labelId, uint8 groupId, uint8 type))
+constexpr char kFileMagic[]       = { 'M', 'T', 'R', 'B' };
+constexpr uint32_t kFileVersion   = 1;
+constexpr size_t kRecordFileBytes = 16;
+
+std::atomic<uint64_t> gNextInstanceId{ 1 };
+
+struct CurrentThreadRingCache
+{
+    uint64_t instanceId = 0;
+    void * ring         = nullptr;
+};
+
+thread_local CurrentThreadRingCache tCurrentRing;
+
+// Its address identifies the current thread, to find rings of this thread again.
+thread_local const uint8_t tThreadMarker = 0;
+
+size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+size_t CacheSlot(const char * string, size_t cacheSize)
+{
+    // String literals are at least 1 byte apart; drop a few low bits that tend to repeat.
+    return (reinterpret_cast<uintptr_t>(string) >> 3) & (cacheSize - 1);
+}
+
+class FileWriter
+{
+public:
+    FileWriter(std::ofstream & stream) : mStream(stream) {}
+
+    void Put16(uint16_t value)
+    {
+        uint8_t buffer[sizeof(value)];
+        Encoding::LittleEndian::Put16(buffer, value);
+        Write(buffer, sizeof(buffer));
+    }
+
+    void Put32(uint32_t value)
+    {
+        uint8_t buffer[sizeof(value)];
+        Encoding::LittleEndian::Put32(buffer, value);
+        Write(buffer, sizeof(buffer));
+    }
+
+    void PutString(const char * string)
+    {
+        size_t length = strnlen(string, UINT16_MAX);
+        Put16(static_cast<uint16_t>(length));
+        mStream.write(string, static_cast<std::streamsize>(length));
+    }
+
+    void Write(const uint8_t * data, size_t size)
+    {
+        mStream.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size));
+    }
+
+private:
+    std::ofstream & mStream;
+};
+
+} // namespace
+
+BinaryBackend::ThreadRing::ThreadRing(size_t capacity, uint32_t index) :
+    threadIndex(index), owner(&tThreadMarker), records(new Record[capacity])
+{}
+
+BinaryBackend::BinaryBackend(size_t recordsPerThread) :
+    mInstanceId(gNextInstanceId.fetch_add(1)), mRecordsPerThread(RoundUpToPowerOfTwo(recordsPerThread > 0 ? recordsPerThread : 1))
+{}
+
+BinaryBackend::~BinaryBackend()
+{
+    ThreadRing * ring = mThreadRings.exchange(nullptr);
+    while (ring != nullptr)
+    {
+        ThreadRing * next = ring->next;
+        delete ring;
+        ring = next;
+    }
+}
+
+BinaryBackend::ThreadRing & BinaryBackend::CurrentThreadRing()
+{
+    if (tCurrentRing.instanceId == mInstanceId)
+    {
+        return *static_cast<ThreadRing *>(tCurrentRing.ring);
+    }
+
+    // This thread may already have a ring, if it has traced to another backend since.
+    ThreadRing * ring = mThreadRings.load(std::memory_order_acquire);
+    while ((ring != nullptr) && (ring->owner != &tThreadMarker))
+    {
+        ring = ring->next;
+    }
+
+    if (ring == nullptr)
+    {
+        ring       = new ThreadRing(mRecordsPerThread, mThreadCount.fetch_add(1));
+        ring->next = mThreadRings.load(std::memory_order_relaxed);
+        while (!mThreadRings.compare_exchange_weak(ring->next, ring, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    tCurrentRing.instanceId = mInstanceId;
+    tCurrentRing.ring       = ring;
+    return *ring;
+}
+
+template <typename Id>
+Id BinaryBackend::Intern(InternTable<Id> & table, size_t maxCount, Id overflowId, const char * string)
+{
+    std::lock_guard<std::mutex> lock(mInternLock);
+
+    auto it = table.ids.find(string);
+    if (it != table.ids.end())
+    {
+        return it->second;
+    }
+    if (table.strings.size() >= maxCount)
+    {
+        return overflowId;
+    }
+
+    Id id = static_cast<Id>(table.strings.size());
+    table.strings.push_back(string);
+    table.ids.emplace(string, id);
+    return id;
+}
+
+uint16_t BinaryBackend::InternLabel(ThreadRing & ring, const char * label)
+{
+    InternCacheEntry & entry = ring.labelCache[CacheSlot(label, kInternCacheSize)];
+    if (entry.string != label)
+    {
+        entry.id     = Intern<uint16_t>(mLabels, kMaxLabels, kOverflowLabelId, label);
+        entry.string = label;
+    }
+    return entry.id;
+}
+
+uint8_t BinaryBackend::InternGroup(ThreadRing & ring, const char * group)
+{
+    InternCacheEntry & entry = ring.groupCache[CacheSlot(group, kInternCacheSize)];
+    if (entry.string != group)
+    {
+        entry.id     = Intern<uint8_t>(mGroups, kMaxGroups, kOverflowGroupId, group);
+        entry.string = group;
+    }
+    return static_cast<uint8_t>(entry.id);
+}
+
+void BinaryBackend::Trace(EventType type, const char * label, const char * group, uint32_t arg)
+{
+    ThreadRing & ring = CurrentThreadRing();
+
+    Record record;
+    record.timestampNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    record.arg     = arg;
+    record.labelId = InternLabel(ring, label);
+    record.groupId = InternGroup(ring, group);
+    record.type    = type;
+
+    // Only this thread writes to the ring; readers use writeIndex to discard records that
+    // may have been overwritten while being copied.
+    uint64_t index                                = ring.writeIndex.load(std::memory_order_relaxed);
+    ring.records[index & (mRecordsPerThread - 1)] = record;
+    ring.writeIndex.store(index + 1, std::memory_order_release);
+}
+
+void BinaryBackend::LogMetricEvent(const MetricEvent & event)
+{
+    uint32_t arg = 0;
+
+    using ValueType = MetricEvent::Value::Type;
+    switch (event.ValueType())
+    {
+    case ValueType::kInt32:
+        arg = static_cast<uint32_t>(event.ValueInt32());
+        break;
+    case ValueType::kUInt32:
+        arg = event.ValueUInt32();
+        break;
+    case ValueType::kChipErrorCode:
+        arg = event.ValueErrorCode();
+        break;
+    default:
+        break;
+    }
+
+    switch (event.type())
+    {
+    case MetricEvent::Type::kBeginEvent:
+        Trace(EventType::kBegin, event.key(), "Metric", arg);
+        break;
+    case MetricEvent::Type::kEndEvent:
+        Trace(EventType::kEnd, event.key(), "Metric", arg);
+        break;
+    case MetricEvent::Type::kInstantEvent:
+        Trace(EventType::kInstant, event.key(), "Metric", arg);
+        break;
+    }
+}
+
+void BinaryBackend::SnapshotRing(const ThreadRing & ring, std::vector<Record> & records) const
+{
+    const uint64_t capacity = mRecordsPerThread;
+
+    uint64_t end   = ring.writeIndex.load(std::memory_order_acquire);
+    uint64_t start = (end > capacity) ? (end - capacity) : 0;
+
+    records.clear();
+    records.reserve(static_cast<size_t>(end - start));
+    for (uint64_t index = start; index < end; index++)
+    {
+        records.push_back(ring.records[index & (capacity - 1)]);
+    }
+
+    // The writer may have wrapped around while copying: records older than one ring
+    // before the slot being written now may be torn.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t after = ring.writeIndex.load(std::memory_order_acquire);
+    if (after + 1 > capacity + start)
+    {
+        uint64_t overwritten = after + 1 - capacity - start;
+        records.erase(records.begin(), records.begin() + static_cast<ptrdiff_t>(std::min<uint64_t>(overwritten, records.size())));
+    }
+}
+
+void BinaryBackend::ForEachRecord(const RecordVisitor & visitor)
+{
+    std::vector<Record> records;
+    for (const ThreadRing * ring = mThreadRings.load(std::memory_order_acquire); ring != nullptr; ring = ring->next)
+    {
+        SnapshotRing(*ring, records);
+        for (const Record & record : records)
+        {
+            visitor(ring->threadIndex, record);
+        }
+    }
+}
+
+const char * BinaryBackend::LabelName(uint16_t labelId)
+{
+    std::lock_guard<std::mutex> lock(mInternLock);
+    return (labelId < mLabels.strings.size()) ? mLabels.strings[labelId] : nullptr;
+}
+
+const char * BinaryBackend::GroupName(uint8_t groupId)
+{
+    std::lock_guard<std::mutex> lock(mInternLock);
+    return (groupId < mGroups.strings.size()) ? mGroups.strings[groupId] : nullptr;
+}
+
+CHIP_ERROR BinaryBackend::Dump(const char * path)
+{
+    std::ofstream stream(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    VerifyOrReturnError(stream.is_open(), CHIP_ERROR_OPEN_FAILED);
+
+    FileWriter writer(stream);
+    writer.Write(reinterpret_cast<const uint8_t *>(kFileMagic), sizeof(kFileMagic));
+    writer.Put32(kFileVersion);
+
+    {
+        std::lock_guard<std::mutex> lock(mInternLock);
+        writer.Put32(static_cast<uint32_t>(mLabels.strings.size()));
+        for (const char * label : mLabels.strings)
+        {
+            writer.PutString(label);
+        }
+        writer.Put32(static_cast<uint32_t>(mGroups.strings.size()));
+        for (const char * group : mGroups.strings)
+        {
+            writer.PutString(group);
+        }
+    }
+
+    // Rings are only ever prepended, so everything after the head read here is stable.
+    ThreadRing * head    = mThreadRings.load(std::memory_order_acquire);
+    uint32_t threadCount = 0;
+    for (const ThreadRing * ring = head; ring != nullptr; ring = ring->next)
+    {
+        threadCount++;
+    }
+    writer.Put32(threadCount);
+
+    std::vector<Record> records;
+    for (const ThreadRing * ring = head; ring != nullptr; ring = ring->next)
+    {
+        SnapshotRing(*ring, records);
+        writer.Put32(ring->threadIndex);
+        writer.Put32(static_cast<uint32_t>(records.size()));
+        for (const Record & record : records)
+        {
+            uint8_t buffer[kRecordFileBytes];
+            uint8_t * p = buffer;
+            Encoding::LittleEndian::Write64(p, record.timestampNs);
+            Encoding::LittleEndian::Write32(p, record.arg);
+            Encoding::LittleEndian::Write16(p, record.labelId);
+            Encoding::Write8(p, record.groupId);
+            Encoding::Write8(p, to_underlying(record.type));
+            writer.Write(buffer, sizeof(buffer));
+        }
+    }
+
+    stream.flush();
+    VerifyOrReturnError(stream.good(), CHIP_ERROR_WRITE_FAILED);
+
+    ChipLogProgress(Automation, "Wrote binary trace to %s", path);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,159 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <tracing/backend.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+/// A Backend that keeps fixed-size binary records of trace events in memory.
+///
+/// Every thread that emits events gets its own ring buffer of records on first use, so
+/// tracing an event is a clock read plus a store into memory owned by the emitting thread.
+/// Labels and groups are reduced to small ids: they are constant strings (see the tracing
+/// README), so ids are assigned per string pointer and cached per thread. Once a ring is full,
+/// the oldest records of that thread are overwritten.
+///
+/// The records are written out with Dump and can be converted offline into the Chrome trace
+/// format (loadable by Perfetto UI and chrome://tracing) using `binary_trace_to_json.py`.
+///
+/// THREAD SAFETY:
+///    Tracing calls never block once the thread ring exists and a label has been seen by
+///    the thread. Dump may run concurrently with tracing; records being overwritten while
+///    they are copied are skipped.
+///
+/// A backend must outlive all of its tracing calls (i.e. it must be unregistered before
+/// being destroyed), as thread rings are only released on destruction.
+class BinaryBackend : public ::chip::Tracing::Backend
+{
+public:
+    enum class EventType : uint8_t
+    {
+        kBegin   = 0,
+        kEnd     = 1,
+        kInstant = 2,
+        kCounter = 3,
+    };
+
+    struct Record
+    {
+        uint64_t timestampNs; // steady clock
+        uint32_t arg;         // metric value, 0 if not applicable
+        uint16_t labelId;
+        uint8_t groupId;
+        EventType type;
+    };
+    static_assert(sizeof(Record) == 16, "Records are expected to be packed into 16 bytes");
+
+    /// Ids returned when the intern tables are full.
+    static constexpr uint16_t kOverflowLabelId = UINT16_MAX;
+    static constexpr uint8_t kOverflowGroupId  = UINT8_MAX;
+
+    static constexpr size_t kDefaultRecordsPerThread = 8192;
+
+    /// recordsPerThread is rounded up to a power of two. The newest recordsPerThread - 1 records
+    /// of each thread are available, as the slot of a write in progress is never read back.
+    explicit BinaryBackend(size_t recordsPerThread = kDefaultRecordsPerThread);
+    ~BinaryBackend();
+
+    BinaryBackend(const BinaryBackend &)             = delete;
+    BinaryBackend & operator=(const BinaryBackend &) = delete;
+
+    /// Write out the string tables and the records currently held by all thread rings.
+    CHIP_ERROR Dump(const char * path);
+
+    /// Called for every record currently held, oldest first within each thread.
+    using RecordVisitor = std::function<void(uint32_t threadIndex, const Record & record)>;
+    void ForEachRecord(const RecordVisitor & visitor);
+
+    /// Strings for ids found in records; nullptr for unknown ids.
+    const char * LabelName(uint16_t labelId);
+    const char * GroupName(uint8_t groupId);
+
+    void TraceBegin(const char * label, const char * group) override { Trace(EventType::kBegin, label, group, 0); }
+    void TraceEnd(const char * label, const char * group) override { Trace(EventType::kEnd, label, group, 0); }
+    void TraceInstant(const char * label, const char * group) override { Trace(EventType::kInstant, label, group, 0); }
+    void TraceCounter(const char * label) override { Trace(EventType::kCounter, label, "Counter", 0); }
+    void LogMetricEvent(const MetricEvent & event) override;
+
+private:
+    static constexpr size_t kInternCacheSize = 64; // per thread, direct mapped
+    static constexpr size_t kMaxLabels       = kOverflowLabelId;
+    static constexpr size_t kMaxGroups       = kOverflowGroupId;
+
+    struct InternCacheEntry
+    {
+        const char * string = nullptr;
+        uint16_t id         = 0;
+    };
+
+    struct ThreadRing
+    {
+        ThreadRing(size_t capacity, uint32_t index);
+
+        ThreadRing * next = nullptr;
+        const uint32_t threadIndex;
+        const void * const owner;              // per-thread marker of the writing thread
+        std::atomic<uint64_t> writeIndex{ 0 }; // total records ever written
+        std::unique_ptr<Record[]> records;
+        InternCacheEntry labelCache[kInternCacheSize];
+        InternCacheEntry groupCache[kInternCacheSize];
+    };
+
+    template <typename Id>
+    struct InternTable
+    {
+        std::unordered_map<const char *, Id> ids;
+        std::vector<const char *> strings; // indexed by id
+    };
+
+    void Trace(EventType type, const char * label, const char * group, uint32_t arg);
+
+    ThreadRing & CurrentThreadRing();
+    uint16_t InternLabel(ThreadRing & ring, const char * label);
+    uint8_t InternGroup(ThreadRing & ring, const char * group);
+
+    void SnapshotRing(const ThreadRing & ring, std::vector<Record> & records) const;
+
+    template <typename Id>
+    Id Intern(InternTable<Id> & table, size_t maxCount, Id overflowId, const char * string);
+
+    const uint64_t mInstanceId; // distinguishes backends in thread_local state
+    const size_t mRecordsPerThread;
+    std::atomic<ThreadRing *> mThreadRings{ nullptr };
+    std::atomic<uint32_t> mThreadCount{ 0 };
+
+    std::mutex mInternLock;
+    InternTable<uint16_t> mLabels;
+    InternTable<uint8_t> mGroups;
+};
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
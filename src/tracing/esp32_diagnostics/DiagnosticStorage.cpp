@@ -102,11 +102,7 @@ uint32_t CircularDiagnosticBuffer::GetDataSize()
 
 CHIP_ERROR CircularDiagnosticBuffer::ClearBuffer()
 {
-    while (!IsBufferEmpty())
-    {
-        ReturnErrorOnFailure(EvictHead());
-    }
-    return CHIP_NO_ERROR;
+    return EvictHeadUntilAvailable(GetTotalDataLength());
 }
 
 CHIP_ERROR CircularDiagnosticBuffer::ClearBuffer(uint32_t entries)
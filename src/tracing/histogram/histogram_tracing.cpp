@@ -0,0 +1,128 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/histogram/histogram_tracing.h>
+
+#include <system/SystemClock.h>
+#include <tracing/metric_event.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+namespace {
+
+bool EndedWithError(const MetricEvent & event)
+{
+    return (event.ValueType() == MetricEvent::Value::Type::kChipErrorCode) && (event.ValueErrorCode() != 0);
+}
+
+} // namespace
+
+HistogramBackend::HistogramBackend()
+{
+    SuccessOrDie(System::Mutex::Init(mLock));
+}
+
+HistogramBackend::Entry * HistogramBackend::FindOrAdd(MetricKey key)
+{
+    for (size_t i = 0; i < mMetricCount; i++)
+    {
+        // Keys are constants, but the same key may still live at different addresses.
+        if ((mMetrics[i].metric.key == key) || (strcmp(mMetrics[i].metric.key, key) == 0))
+        {
+            return &mMetrics[i];
+        }
+    }
+
+    VerifyOrReturnValue(mMetricCount < kMaxMetrics, nullptr);
+    Entry * entry       = &mMetrics[mMetricCount++];
+    entry->metric.key   = key;
+    entry->pendingCount = 0;
+    return entry;
+}
+
+void HistogramBackend::LogMetricEvent(const MetricEvent & event)
+{
+    VerifyOrReturn(event.type() != MetricEvent::Type::kInstantEvent);
+
+    uint64_t nowUs = System::SystemClock().GetMonotonicMicroseconds64().count();
+
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    Entry * entry = FindOrAdd(event.key());
+    if (entry == nullptr)
+    {
+        mDroppedEvents++;
+        return;
+    }
+
+    if (event.type() == MetricEvent::Type::kBeginEvent)
+    {
+        if (entry->pendingCount == kMaxPendingBegins)
+        {
+            // Too many operations in flight: the oldest one most likely never ended.
+            memmove(&entry->pendingBeginsUs[0], &entry->pendingBeginsUs[1], sizeof(uint64_t) * (kMaxPendingBegins - 1));
+            entry->pendingCount--;
+            entry->metric.unmatched++;
+        }
+        entry->pendingBeginsUs[entry->pendingCount++] = nowUs;
+        return;
+    }
+
+    if (entry->pendingCount == 0)
+    {
+        entry->metric.unmatched++;
+        return;
+    }
+
+    uint64_t beginUs = entry->pendingBeginsUs[0];
+    entry->pendingCount--;
+    memmove(&entry->pendingBeginsUs[0], &entry->pendingBeginsUs[1], sizeof(uint64_t) * entry->pendingCount);
+
+    if (EndedWithError(event))
+    {
+        entry->metric.errors++;
+        return;
+    }
+
+    uint64_t durationUs = nowUs - beginUs;
+    entry->metric.latencyUs.Record(static_cast<uint32_t>(durationUs > UINT32_MAX ? UINT32_MAX : durationUs));
+}
+
+void HistogramBackend::Reset()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    for (size_t i = 0; i < mMetricCount; i++)
+    {
+        mMetrics[i].metric.latencyUs.Reset();
+        mMetrics[i].metric.errors    = 0;
+        mMetrics[i].metric.unmatched = 0;
+    }
+    mDroppedEvents = 0;
+}
+
+uint32_t HistogramBackend::DroppedEvents()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    return mDroppedEvents;
+}
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,96 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemMutex.h>
+#include <tracing/backend.h>
+#include <tracing/histogram/latency_histogram.h>
+#include <tracing/metric_keys.h>
+
+#include <mutex>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+/// A Backend that aggregates the durations between Begin and End metric events (see
+/// metric_keys.h) into one latency histogram per metric key, in microseconds.
+///
+/// Metric events carry no identifier of the operation they belong to, so End events are
+/// paired with the oldest Begin event of the same key still open. Durations of overlapping
+/// operations of the same kind may therefore be exchanged, which keeps their mean exact but
+/// makes percentiles approximate. Operations ending with an error are only counted.
+///
+/// THREAD SAFETY:
+///    Events and accessors are serialized by an internal mutex.
+class HistogramBackend : public ::chip::Tracing::Backend
+{
+public:
+    static constexpr size_t kMaxMetrics       = 16;
+    static constexpr size_t kMaxPendingBegins = 4; // per metric key
+
+    struct Metric
+    {
+        MetricKey key = nullptr;
+        LatencyHistogram latencyUs;
+        uint32_t errors    = 0; ///< operations that ended with an error
+        uint32_t unmatched = 0; ///< End events without a Begin, and Begin events that were never ended
+    };
+
+    HistogramBackend();
+
+    void LogMetricEvent(const MetricEvent & event) override;
+
+    /// Calls fn(const Metric &) for every metric key seen so far, in order of first use.
+    ///
+    /// The internal lock is held while iterating, so fn must not emit metric events.
+    template <typename Fn>
+    void ForEachMetric(Fn && fn)
+    {
+        std::lock_guard<System::Mutex> lock(mLock);
+        for (size_t i = 0; i < mMetricCount; i++)
+        {
+            fn(static_cast<const Metric &>(mMetrics[i].metric));
+        }
+    }
+
+    /// Forget all recorded values. Operations in progress are still paired when they end.
+    void Reset();
+
+    /// Number of metric events dropped because kMaxMetrics keys are already tracked.
+    uint32_t DroppedEvents();
+
+private:
+    struct Entry
+    {
+        Metric metric;
+        uint64_t pendingBeginsUs[kMaxPendingBegins]; // oldest first
+        size_t pendingCount = 0;
+    };
+
+    Entry * FindOrAdd(MetricKey key);
+
+    System::Mutex mLock;
+    Entry mMetrics[kMaxMetrics];
+    size_t mMetricCount     = 0;
+    uint32_t mDroppedEvents = 0;
+};
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,92 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/histogram/latency_histogram.h>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+size_t LatencyHistogram::BucketIndex(uint32_t value)
+{
+    if (value < kSubBuckets)
+    {
+        return value;
+    }
+
+    unsigned exponent = 31;
+    while ((value & (1u << exponent)) == 0)
+    {
+        exponent--;
+    }
+
+    // The top kSubBucketBits + 1 bits of the value select the bucket within its power of two.
+    unsigned shift = exponent - kSubBucketBits;
+    return kSubBuckets * (shift + 1) + ((value >> shift) - kSubBuckets);
+}
+
+uint32_t LatencyHistogram::BucketUpperBound(size_t index)
+{
+    if (index < kSubBuckets)
+    {
+        return static_cast<uint32_t>(index);
+    }
+
+    size_t shift    = (index / kSubBuckets) - 1;
+    uint64_t lower  = static_cast<uint64_t>(kSubBuckets + (index % kSubBuckets)) << shift;
+    uint64_t result = lower + (uint64_t(1) << shift) - 1;
+    return static_cast<uint32_t>(result > UINT32_MAX ? UINT32_MAX : result);
+}
+
+void LatencyHistogram::Record(uint32_t value)
+{
+    mBuckets[BucketIndex(value)]++;
+    mCount++;
+    mSum += value;
+    mMin = (value < mMin) ? value : mMin;
+    mMax = (value > mMax) ? value : mMax;
+}
+
+uint32_t LatencyHistogram::ValueAtPercentile(uint8_t percentile) const
+{
+    if (mCount == 0)
+    {
+        return 0;
+    }
+
+    percentile = (percentile > 100) ? 100 : percentile;
+
+    // Rank of the value to report, rounded up and starting at 1.
+    uint64_t rank = (static_cast<uint64_t>(mCount) * percentile + 99) / 100;
+    rank          = (rank == 0) ? 1 : rank;
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; i++)
+    {
+        seen += mBuckets[i];
+        if (seen >= rank)
+        {
+            uint32_t bound = BucketUpperBound(i);
+            return (bound > mMax) ? mMax : ((bound < mMin) ? mMin : bound);
+        }
+    }
+    return mMax;
+}
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
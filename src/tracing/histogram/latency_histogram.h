@@ -0,0 +1,65 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+/// A histogram of latency values, bucketed in the style of HDR histograms: every power of
+/// two is split into kSubBuckets linear buckets. Values below kSubBuckets are exact, and
+/// larger values are reported with a relative error of at most 1 / kSubBuckets.
+///
+/// Storage is fixed (kBucketCount counters), independent of the range of recorded values.
+class LatencyHistogram
+{
+public:
+    static constexpr unsigned kSubBucketBits = 3;
+    static constexpr uint32_t kSubBuckets    = 1u << kSubBucketBits;
+    static constexpr size_t kBucketCount     = kSubBuckets * (32 - kSubBucketBits + 1);
+
+    void Record(uint32_t value);
+    void Reset() { *this = LatencyHistogram(); }
+
+    uint32_t Count() const { return mCount; }
+    uint32_t Min() const { return mMin; }
+    uint32_t Max() const { return mMax; }
+    uint64_t Sum() const { return mSum; }
+
+    /// Smallest value (at bucket precision) such that at least `percentile` percent of the
+    /// recorded values are below or equal to it. Returns 0 if nothing was recorded.
+    uint32_t ValueAtPercentile(uint8_t percentile) const;
+
+    static size_t BucketIndex(uint32_t value);
+
+    /// Largest value that falls into the bucket with the given index.
+    static uint32_t BucketUpperBound(size_t index);
+
+private:
+    uint32_t mBuckets[kBucketCount] = {};
+    uint32_t mCount                 = 0;
+    uint32_t mMin                   = UINT32_MAX;
+    uint32_t mMax                   = 0;
+    uint64_t mSum                   = 0;
+};
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,85 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/histogram/shell_commands.h>
+
+#include <lib/shell/Engine.h>
+#include <lib/shell/SubShellCommand.h>
+#include <lib/shell/streamer.h>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+namespace {
+
+using Shell::streamer_get;
+using Shell::streamer_printf;
+
+HistogramBackend * gBackend = nullptr;
+
+CHIP_ERROR LatencyShowHandler(int argc, char ** argv)
+{
+    VerifyOrReturnError(gBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    gBackend->ForEachMetric([](const HistogramBackend::Metric & metric) {
+        const LatencyHistogram & latency = metric.latencyUs;
+        streamer_printf(streamer_get(), "%s: count %u, errors %u, unmatched %u", metric.key,
+                        static_cast<unsigned>(latency.Count()), static_cast<unsigned>(metric.errors),
+                        static_cast<unsigned>(metric.unmatched));
+        if (latency.Count() > 0)
+        {
+            streamer_printf(streamer_get(), ", p50 %u us, p99 %u us, max %u us",
+                            static_cast<unsigned>(latency.ValueAtPercentile(50)),
+                            static_cast<unsigned>(latency.ValueAtPercentile(99)), static_cast<unsigned>(latency.Max()));
+        }
+        streamer_printf(streamer_get(), "\r\n");
+    });
+
+    uint32_t dropped = gBackend->DroppedEvents();
+    if (dropped > 0)
+    {
+        streamer_printf(streamer_get(), "Dropped events of untracked keys: %u\r\n", static_cast<unsigned>(dropped));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LatencyResetHandler(int argc, char ** argv)
+{
+    VerifyOrReturnError(gBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    gBackend->Reset();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+void RegisterLatencyShellCommands(HistogramBackend & backend)
+{
+    static constexpr Shell::Command subCommands[] = {
+        { &LatencyShowHandler, "show", "Print latency percentiles of metric events" },
+        { &LatencyResetHandler, "reset", "Reset latency histograms" },
+    };
+
+    static constexpr Shell::Command latencyCommand = { &Shell::SubShellCommand<MATTER_ARRAY_SIZE(subCommands), subCommands>,
+                                                       "latency", "Latency histogram commands" };
+
+    gBackend = &backend;
+    Shell::Engine::Root().RegisterCommands(&latencyCommand, 1);
+}
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,33 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <tracing/histogram/histogram_tracing.h>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+/**
+ * Registers the `latency` shell command, printing (`latency show`) and resetting (`latency reset`)
+ * the histograms of the given backend. The backend must outlive the shell.
+ */
+void RegisterLatencyShellCommands(HistogramBackend & backend);
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
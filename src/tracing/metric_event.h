@@ -185,5 +185,45 @@ private:
     ChipError & mError;
 };
 
+/**
+ * This utility class generates the Begin and End metric events of an operation that spans several
+ * calls (e.g. an interaction driven by message callbacks). An End event is only generated after a
+ * Begin event, and an operation still in progress on destruction ends with CHIP_ERROR_CANCELLED.
+ */
+class PendingMetricEvent
+{
+public:
+    PendingMetricEvent(const PendingMetricEvent &)             = delete;
+    PendingMetricEvent & operator=(const PendingMetricEvent &) = delete;
+
+#if MATTER_TRACING_ENABLED
+    explicit PendingMetricEvent(MetricKey key) : mKey(key) {}
+    ~PendingMetricEvent() { End(CHIP_ERROR_CANCELLED); }
+
+    void Begin()
+    {
+        VerifyOrReturn(!mPending);
+        MATTER_LOG_METRIC_BEGIN(mKey);
+        mPending = true;
+    }
+
+    void End(const ChipError & error)
+    {
+        VerifyOrReturn(mPending);
+        MATTER_LOG_METRIC_END(mKey, error);
+        mPending = false;
+    }
+
+private:
+    MetricKey mKey;
+    bool mPending = false;
+#else
+    explicit PendingMetricEvent(MetricKey key) {}
+
+    void Begin() {}
+    void End(const ChipError & error) {}
+#endif // MATTER_TRACING_ENABLED
+};
+
 } // namespace Tracing
 } // namespace chip
@@ -78,5 +78,65 @@ constexpr MetricKey kMetricDeviceRMPRetryCount = "core_dev_rmp_retry_count";
 // Subscription setup
 constexpr MetricKey kMetricDeviceSubscriptionSetup = "core_dev_subscription_setup";
 
+// Resumption of persisted subscriptions, until every resumption attempt has completed
+constexpr MetricKey kMetricDeviceSubscriptionResumption = "core_dev_subscription_resumption";
+
+// Number of persisted subscriptions being resumed
+constexpr MetricKey kMetricDeviceSubscriptionResumptionCount = "core_dev_subscription_resumption_ctr";
+
+// Invoke interaction, from sending the request until the last response is processed
+constexpr MetricKey kMetricIMInvoke = "core_im_invoke";
+
+// Read interaction, from sending the request until the last report is processed
+constexpr MetricKey kMetricIMRead = "core_im_read";
+
+// Write interaction, from sending the request until the last response is processed
+constexpr MetricKey kMetricIMWrite = "core_im_write";
+
+// Processing of a report received on an active subscription
+constexpr MetricKey kMetricIMSubscriptionReport = "core_im_subscription_report";
+
+// Dispatch of the event loop exceeding the stall detection threshold, in milliseconds
+constexpr MetricKey kMetricEventLoopStall = "core_sys_event_loop_stall";
+
+// Codegen data model cluster lookup cache hits since the last report
+constexpr MetricKey kMetricCodegenClusterLookupCacheHits = "core_dm_codegen_cluster_cache_hits";
+
+// Codegen data model cluster lookup cache misses since the last report
+constexpr MetricKey kMetricCodegenClusterLookupCacheMisses = "core_dm_codegen_cluster_cache_misses";
+
+// Maximum BLE connection interval requested for a BTP session, in units of 1.25 ms
+constexpr MetricKey kMetricBleConnectionInterval = "core_ble_conn_interval";
+
+// Whether the LE 2M PHY was selected for a BTP session
+constexpr MetricKey kMetricBlePhy2M = "core_ble_phy_2m";
+
+// ATT MTU of a BLE connection when the connection parameters of a BTP session are applied
+constexpr MetricKey kMetricBleAttMtu = "core_ble_att_mtu";
+
+// Time spent in Server::Init() loading the fabric table, in milliseconds
+constexpr MetricKey kMetricServerInitFabricTable = "core_server_init_fabric_table";
+
+// Time spent in Server::Init() loading the access control entries, in milliseconds
+constexpr MetricKey kMetricServerInitAccessControl = "core_server_init_access_control";
+
+// Time spent in Server::Init() setting up the transports, sessions and exchanges, in milliseconds
+constexpr MetricKey kMetricServerInitTransport = "core_server_init_transport";
+
+// Time spent in Server::Init() setting up event logging, in milliseconds
+constexpr MetricKey kMetricServerInitEventLogging = "core_server_init_event_logging";
+
+// Time spent in Server::Init() starting the data model provider and its clusters, in milliseconds
+constexpr MetricKey kMetricServerInitDataModel = "core_server_init_data_model";
+
+// Time spent in Server::Init() after the data model was started, in milliseconds
+constexpr MetricKey kMetricServerInitServices = "core_server_init_services";
+
+// Total time spent in Server::Init(), in milliseconds
+constexpr MetricKey kMetricServerInit = "core_server_init";
+
+// Time spent in the initialization work deferred by Server::Init() to the event loop, in milliseconds
+constexpr MetricKey kMetricServerInitDeferred = "core_server_init_deferred";
+
 } // namespace Tracing
 } // namespace chip
@@ -0,0 +1,50 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/support/ObjectPoolRegistry.h>
+#include <matter/tracing/build_config.h>
+#include <tracing/metric_event.h>
+
+#include <algorithm>
+#include <stdint.h>
+
+namespace chip {
+namespace Tracing {
+
+/**
+ * Emit the current usage of every pool registered with chip::ObjectPoolRegistry as instant metrics, under the keys
+ * of its ObjectPoolNames: objects in use, high water mark and failed allocations.
+ *
+ * Meant to be called periodically, or whenever a snapshot of memory usage is wanted.
+ */
+inline void LogObjectPoolMetrics()
+{
+#if MATTER_TRACING_ENABLED && CHIP_CONFIG_OBJECT_POOL_REGISTRY
+    ObjectPoolRegistry::ForEach([](const ObjectPoolRegistration & registration) {
+        auto toMetricValue = [](size_t value) { return static_cast<uint32_t>(std::min<size_t>(value, UINT32_MAX)); };
+
+        MATTER_LOG_METRIC(registration.GetNames().mInUseKey, toMetricValue(registration.Allocated()));
+        MATTER_LOG_METRIC(registration.GetNames().mHighWaterMarkKey, toMetricValue(registration.HighWaterMark()));
+        MATTER_LOG_METRIC(registration.GetNames().mFailedAllocationsKey, toMetricValue(registration.FailedAllocations()));
+        return Loop::Continue;
+    });
+#endif // MATTER_TRACING_ENABLED && CHIP_CONFIG_OBJECT_POOL_REGISTRY
+}
+
+} // namespace Tracing
+} // namespace chip
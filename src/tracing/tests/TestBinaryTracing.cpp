@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <tracing/binary/binary_tracing.h>
+#include <tracing/macros.h>
+#include <tracing/metric_event.h>
+#include <tracing/registry.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Binary;
+
+namespace {
+
+std::vector<std::string> Traces(BinaryBackend & backend)
+{
+    std::vector<std::string> traces;
+    backend.ForEachRecord([&](uint32_t, const BinaryBackend::Record & record) {
+        std::string trace;
+        switch (record.type)
+        {
+        case BinaryBackend::EventType::kBegin:
+            trace = "BEGIN:";
+            break;
+        case BinaryBackend::EventType::kEnd:
+            trace = "END:";
+            break;
+        case BinaryBackend::EventType::kInstant:
+            trace = "INSTANT:";
+            break;
+        case BinaryBackend::EventType::kCounter:
+            trace = "COUNTER:";
+            break;
+        }
+        trace += std::string(backend.GroupName(record.groupId)) + ":" + backend.LabelName(record.labelId);
+        if (record.arg != 0)
+        {
+            trace += ":" + std::to_string(record.arg);
+        }
+        traces.push_back(trace);
+    });
+    return traces;
+}
+
+TEST(TestBinaryTracing, TestRecordsEvents)
+{
+    BinaryBackend backend;
+    {
+        ScopedRegistration scope(backend);
+
+        MATTER_TRACE_SCOPE("A", "Group");
+        MATTER_TRACE_INSTANT("B", "Other");
+        MATTER_LOG_METRIC("Metric", uint32_t(7));
+    }
+
+    std::vector<std::string> expected = {
+        "BEGIN:Group:A",
+        "INSTANT:Other:B",
+        "INSTANT:Metric:Metric:7",
+        "END:Group:A",
+    };
+    EXPECT_EQ(Traces(backend), expected);
+}
+
+TEST(TestBinaryTracing, TestRingKeepsNewestRecords)
+{
+    BinaryBackend backend(4);
+    for (int i = 0; i < 10; i++)
+    {
+        backend.TraceInstant(i < 6 ? "Old" : "New", "Group");
+    }
+
+    std::vector<std::string> expected(3, "INSTANT:Group:New");
+    EXPECT_EQ(Traces(backend), expected);
+}
+
+TEST(TestBinaryTracing, TestThreadsUseSeparateRings)
+{
+    constexpr size_t kEventsPerThread = 100;
+    BinaryBackend backend(kEventsPerThread + 1);
+
+    auto emit = [&backend]() {
+        for (size_t i = 0; i < kEventsPerThread; i++)
+        {
+            backend.TraceInstant("Event", "Thread");
+        }
+    };
+    std::thread first(emit);
+    std::thread second(emit);
+    first.join();
+    second.join();
+
+    size_t counts[2] = { 0, 0 };
+    backend.ForEachRecord([&](uint32_t threadIndex, const BinaryBackend::Record &) {
+        ASSERT_LT(threadIndex, 2u);
+        counts[threadIndex]++;
+    });
+    EXPECT_EQ(counts[0], kEventsPerThread);
+    EXPECT_EQ(counts[1], kEventsPerThread);
+}
+
+TEST(TestBinaryTracing, TestDump)
+{
+    BinaryBackend backend;
+    backend.TraceInstant("Label", "Group");
+
+    EXPECT_EQ(backend.Dump("/nonexistent-directory/trace.bin"), CHIP_ERROR_OPEN_FAILED);
+
+    std::string path = (std::filesystem::temp_directory_path() / "TestBinaryTracing.bin").string();
+    ASSERT_EQ(backend.Dump(path.c_str()), CHIP_NO_ERROR);
+
+    std::ifstream stream(path, std::ios_base::binary);
+    std::string contents((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    std::filesystem::remove(path);
+
+    // header, 2 strings, 1 thread with 1 record
+    EXPECT_EQ(contents.size(), 8u + (4u + 2u + 5u) + (4u + 2u + 5u) + 4u + 8u + 16u);
+    EXPECT_EQ(contents.substr(0, 4), "MTRB");
+    EXPECT_NE(contents.find("Label"), std::string::npos);
+    EXPECT_NE(contents.find("Group"), std::string::npos);
+}
+
+} // namespace
@@ -0,0 +1,188 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <system/SystemClock.h>
+#include <tracing/histogram/histogram_tracing.h>
+#include <tracing/histogram/latency_histogram.h>
+#include <tracing/metric_event.h>
+
+#include <cstdio>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Histogram;
+
+namespace {
+
+class TestHistogramTracing : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        mRealClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mMockClock);
+    }
+
+    void TearDown() override { System::Clock::Internal::SetSystemClockForTesting(mRealClock); }
+
+protected:
+    void Begin(MetricKey key) { mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, key)); }
+    void End(MetricKey key, CHIP_ERROR error = CHIP_NO_ERROR)
+    {
+        mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, key, error));
+    }
+    void AdvanceMs(uint64_t ms) { mMockClock.AdvanceMonotonic(System::Clock::Milliseconds64(ms)); }
+
+    std::vector<HistogramBackend::Metric> Metrics()
+    {
+        std::vector<HistogramBackend::Metric> metrics;
+        mBackend.ForEachMetric([&](const HistogramBackend::Metric & metric) { metrics.push_back(metric); });
+        return metrics;
+    }
+
+    System::Clock::Internal::MockClock mMockClock;
+    System::Clock::ClockBase * mRealClock = nullptr;
+    HistogramBackend mBackend;
+};
+
+TEST(TestLatencyHistogram, TestBuckets)
+{
+    // Small values are exact.
+    for (uint32_t value = 0; value < LatencyHistogram::kSubBuckets; value++)
+    {
+        EXPECT_EQ(LatencyHistogram::BucketIndex(value), value);
+        EXPECT_EQ(LatencyHistogram::BucketUpperBound(value), value);
+    }
+
+    // Every bucket contains its upper bound, and the next value starts the next bucket.
+    for (size_t index = 0; index < LatencyHistogram::kBucketCount - 1; index++)
+    {
+        uint32_t bound = LatencyHistogram::BucketUpperBound(index);
+        EXPECT_EQ(LatencyHistogram::BucketIndex(bound), index);
+        EXPECT_EQ(LatencyHistogram::BucketIndex(bound + 1), index + 1);
+    }
+    EXPECT_EQ(LatencyHistogram::BucketIndex(UINT32_MAX), LatencyHistogram::kBucketCount - 1);
+    EXPECT_EQ(LatencyHistogram::BucketUpperBound(LatencyHistogram::kBucketCount - 1), UINT32_MAX);
+}
+
+TEST(TestLatencyHistogram, TestPercentiles)
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.ValueAtPercentile(50), 0u);
+
+    for (uint32_t value = 1; value <= 100; value++)
+    {
+        histogram.Record(value * 1000);
+    }
+
+    EXPECT_EQ(histogram.Count(), 100u);
+    EXPECT_EQ(histogram.Min(), 1000u);
+    EXPECT_EQ(histogram.Max(), 100000u);
+    EXPECT_EQ(histogram.Sum(), 5050000u);
+
+    // Reported values are within the bucket precision of the exact ones.
+    uint32_t p50 = histogram.ValueAtPercentile(50);
+    EXPECT_GE(p50, 50000u);
+    EXPECT_LE(p50, 50000u + 50000u / LatencyHistogram::kSubBuckets);
+
+    uint32_t p99 = histogram.ValueAtPercentile(99);
+    EXPECT_GE(p99, 99000u);
+    EXPECT_LE(p99, 100000u);
+
+    uint32_t p0 = histogram.ValueAtPercentile(0);
+    EXPECT_GE(p0, 1000u);
+    EXPECT_LE(p0, 1000u + 1000u / LatencyHistogram::kSubBuckets);
+
+    // No value is reported beyond the recorded range.
+    EXPECT_EQ(histogram.ValueAtPercentile(100), 100000u);
+
+    histogram.Reset();
+    EXPECT_EQ(histogram.Count(), 0u);
+    EXPECT_EQ(histogram.Max(), 0u);
+}
+
+TEST_F(TestHistogramTracing, TestPairing)
+{
+    Begin(kMetricIMRead);
+    AdvanceMs(10);
+    End(kMetricIMRead);
+
+    // Overlapping operations are paired in order.
+    Begin(kMetricIMInvoke);
+    AdvanceMs(5);
+    Begin(kMetricIMInvoke);
+    AdvanceMs(5);
+    End(kMetricIMInvoke);
+    AdvanceMs(20);
+    End(kMetricIMInvoke, CHIP_ERROR_TIMEOUT);
+
+    // Instant events and unmatched ends do not affect the latencies.
+    mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricIMRead));
+    End(kMetricIMRead);
+
+    std::vector<HistogramBackend::Metric> metrics = Metrics();
+    ASSERT_EQ(metrics.size(), 2u);
+
+    EXPECT_STREQ(metrics[0].key, kMetricIMRead);
+    EXPECT_EQ(metrics[0].latencyUs.Count(), 1u);
+    EXPECT_EQ(metrics[0].latencyUs.Max(), 10000u);
+    EXPECT_EQ(metrics[0].errors, 0u);
+    EXPECT_EQ(metrics[0].unmatched, 1u);
+
+    EXPECT_STREQ(metrics[1].key, kMetricIMInvoke);
+    EXPECT_EQ(metrics[1].latencyUs.Count(), 1u);
+    EXPECT_EQ(metrics[1].latencyUs.Max(), 10000u);
+    EXPECT_EQ(metrics[1].errors, 1u);
+    EXPECT_EQ(metrics[1].unmatched, 0u);
+
+    mBackend.Reset();
+    metrics = Metrics();
+    ASSERT_EQ(metrics.size(), 2u);
+    EXPECT_EQ(metrics[0].latencyUs.Count(), 0u);
+    EXPECT_EQ(metrics[1].errors, 0u);
+}
+
+TEST_F(TestHistogramTracing, TestLimits)
+{
+    // Begins that are never ended eventually make room for new ones.
+    for (size_t i = 0; i < HistogramBackend::kMaxPendingBegins + 1; i++)
+    {
+        Begin(kMetricIMWrite);
+        AdvanceMs(1);
+    }
+    End(kMetricIMWrite);
+
+    std::vector<HistogramBackend::Metric> metrics = Metrics();
+    ASSERT_EQ(metrics.size(), 1u);
+    EXPECT_EQ(metrics[0].unmatched, 1u);
+    EXPECT_EQ(metrics[0].latencyUs.Max(), HistogramBackend::kMaxPendingBegins * 1000u);
+
+    // Keys beyond kMaxMetrics are dropped.
+    static char keys[HistogramBackend::kMaxMetrics][8];
+    for (size_t i = 0; i < HistogramBackend::kMaxMetrics; i++)
+    {
+        snprintf(keys[i], sizeof(keys[i]), "key%u", static_cast<unsigned>(i));
+        Begin(keys[i]);
+    }
+    EXPECT_EQ(Metrics().size(), HistogramBackend::kMaxMetrics);
+    EXPECT_EQ(mBackend.DroppedEvents(), 1u);
+}
+
+} // namespace
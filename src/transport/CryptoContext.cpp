@@ -219,8 +219,9 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(), output, tag, taglen));
+        VerifyOrReturnError(mKeystore != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        ReturnErrorOnFailure(mKeystore->AesCcmEncrypt(mEncryptionKey, input, input_length, AAD, aadLen, nonce.data(), nonce.size(),
+                                                      output, tag, taglen));
     }
 
     mac.SetTag(tag, taglen);
@@ -254,8 +255,9 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(), nonce.size(), output));
+        VerifyOrReturnError(mKeystore != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        ReturnErrorOnFailure(mKeystore->AesCcmDecrypt(mDecryptionKey, input, input_length, AAD, aadLen, tag, taglen, nonce.data(),
+                                                      nonce.size(), output));
     }
     return CHIP_NO_ERROR;
 }
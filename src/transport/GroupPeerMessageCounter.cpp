@@ -21,13 +21,26 @@
  */
 
 #include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <transport/GroupPeerMessageCounter.h>
 
 #include <crypto/RandUtils.h>
 
+#include <cstring>
+
 namespace chip {
 namespace Transport {
 
+namespace {
+
+size_t HashNodeId(NodeId nodeId, size_t indexSize)
+{
+    uint32_t folded = static_cast<uint32_t>(nodeId ^ (nodeId >> 32));
+    return static_cast<size_t>((folded * 2654435761u) >> 16) & (indexSize - 1);
+}
+
+} // namespace
+
 CHIP_ERROR GroupPeerTable::FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl,
                                          chip::Transport::PeerMessageCounter *& counter)
 {
@@ -43,74 +56,95 @@ CHIP_ERROR GroupPeerTable::FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId,
             // Already iterated through all known fabricIndex
             // Add the new peer to save some processing time
             groupFabric.mFabricIndex = fabricIndex;
-            if (isControl)
-            {
-                groupFabric.mControlGroupSenders[0].mNodeId = nodeId;
-                counter                                     = &(groupFabric.mControlGroupSenders[0].msgCounter);
-                groupFabric.mControlPeerCount++;
-            }
-            else
-            {
-                groupFabric.mDataGroupSenders[0].mNodeId = nodeId;
-                counter                                  = &(groupFabric.mDataGroupSenders[0].msgCounter);
-                groupFabric.mDataPeerCount++;
-            }
-            return CHIP_NO_ERROR;
         }
 
         if (fabricIndex == groupFabric.mFabricIndex)
         {
             if (isControl)
             {
-                for (auto & node : groupFabric.mControlGroupSenders)
-                {
-                    if (node.mNodeId == kUndefinedNodeId)
-                    {
-                        // Already iterated through all known NodeIds
-                        // Add the new peer to save some processing time
-                        node.mNodeId = nodeId;
-                        counter      = &(node.msgCounter);
-                        groupFabric.mControlPeerCount++;
-                        return CHIP_NO_ERROR;
-                    }
-
-                    if (node.mNodeId == nodeId)
-                    {
-                        counter = &(node.msgCounter);
-                        return CHIP_NO_ERROR;
-                    }
-                }
-            }
-            else
-            {
-                for (auto & node : groupFabric.mDataGroupSenders)
-                {
-                    if (node.mNodeId == kUndefinedNodeId)
-                    {
-                        // Already iterated through all known NodeIds
-                        // Add the new peer to save some processing time
-                        node.mNodeId = nodeId;
-                        counter      = &(node.msgCounter);
-                        groupFabric.mDataPeerCount++;
-                        return CHIP_NO_ERROR;
-                    }
-
-                    if (node.mNodeId == nodeId)
-                    {
-                        counter = &(node.msgCounter);
-                        return CHIP_NO_ERROR;
-                    }
-                }
+                return FindOrAddSender(groupFabric.mControlGroupSenders, groupFabric.mControlSenderIndex,
+                                       GroupFabric::kControlSenderIndexSize, CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS,
+                                       groupFabric.mControlPeerCount, nodeId, counter);
             }
-            // Exceeded the Max number of Group peers
-            return CHIP_ERROR_TOO_MANY_PEER_NODES;
+            return FindOrAddSender(groupFabric.mDataGroupSenders, groupFabric.mDataSenderIndex, GroupFabric::kDataSenderIndexSize,
+                                   CHIP_CONFIG_MAX_GROUP_DATA_PEERS, groupFabric.mDataPeerCount, nodeId, counter);
         }
     }
 
     // Exceeded the Max number of Group peers
+    mStats.mRejections++;
     return CHIP_ERROR_TOO_MANY_PEER_NODES;
 }
 
+CHIP_ERROR GroupPeerTable::FindOrAddSender(GroupSender * list, uint8_t * index, size_t indexSize, uint32_t size, uint8_t & peerCount,
+                                           NodeId nodeId, chip::Transport::PeerMessageCounter *& counter)
+{
+    // The index has at least twice as many slots as the list has senders, so probing always ends on an empty slot.
+    size_t slot = HashNodeId(nodeId, indexSize);
+    while (index[slot] != 0)
+    {
+        GroupSender & sender = list[index[slot] - 1];
+        if (sender.mNodeId == nodeId)
+        {
+            sender.mLastUsed = ++mUseTick;
+            counter          = &(sender.msgCounter);
+            return CHIP_NO_ERROR;
+        }
+        slot = (slot + 1) & (indexSize - 1);
+    }
+
+    GroupSender * sender = nullptr;
+    if (peerCount < size)
+    {
+        // Senders are kept compacted, so the first free one follows the known ones.
+        sender      = &list[peerCount];
+        index[slot] = static_cast<uint8_t>(++peerCount);
+    }
+    else if (mEvictLeastRecentlyUsed)
+    {
+        // The use tick may wrap around, so compare ages rather than ticks.
+        sender = &list[0];
+        for (uint32_t i = 1; i < size; i++)
+        {
+            if (static_cast<uint32_t>(mUseTick - list[i].mLastUsed) > static_cast<uint32_t>(mUseTick - sender->mLastUsed))
+            {
+                sender = &list[i];
+            }
+        }
+        ChipLogProgress(Inet, "Evicting group peer " ChipLogFormatX64 " for " ChipLogFormatX64, ChipLogValueX64(sender->mNodeId),
+                        ChipLogValueX64(nodeId));
+        sender->msgCounter.Reset();
+        sender->mNodeId = nodeId;
+        RebuildIndex(list, size, index, indexSize);
+        mStats.mEvictions++;
+    }
+    else
+    {
+        // Exceeded the Max number of Group peers
+        mStats.mRejections++;
+        return CHIP_ERROR_TOO_MANY_PEER_NODES;
+    }
+
+    sender->mNodeId   = nodeId;
+    sender->mLastUsed = ++mUseTick;
+    counter           = &(sender->msgCounter);
+    return CHIP_NO_ERROR;
+}
+
+void GroupPeerTable::RebuildIndex(const GroupSender * list, uint32_t size, uint8_t * index, size_t indexSize)
+{
+    memset(index, 0, indexSize);
+    for (uint32_t i = 0; i < size && list[i].mNodeId != kUndefinedNodeId; i++)
+    {
+        size_t slot = HashNodeId(list[i].mNodeId, indexSize);
+        while (index[slot] != 0)
+        {
+            slot = (slot + 1) & (indexSize - 1);
+        }
+        index[slot] = static_cast<uint8_t>(i + 1);
+    }
+}
+
 // Used in case of MCSP failure
 CHIP_ERROR GroupPeerTable::RemovePeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl)
 {
@@ -132,6 +166,8 @@ CHIP_ERROR GroupPeerTable::RemovePeer(FabricIndex fabricIndex, NodeId nodeId, bo
                 {
                     fabricIt = it;
                     mGroupFabrics[it].mControlPeerCount--;
+                    RebuildIndex(mGroupFabrics[it].mControlGroupSenders, CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS,
+                                 mGroupFabrics[it].mControlSenderIndex, GroupFabric::kControlSenderIndexSize);
                     err = CHIP_NO_ERROR;
                 }
             }
@@ -141,6 +177,8 @@ CHIP_ERROR GroupPeerTable::RemovePeer(FabricIndex fabricIndex, NodeId nodeId, bo
                 {
                     fabricIt = it;
                     mGroupFabrics[it].mDataPeerCount--;
+                    RebuildIndex(mGroupFabrics[it].mDataGroupSenders, CHIP_CONFIG_MAX_GROUP_DATA_PEERS,
+                                 mGroupFabrics[it].mDataSenderIndex, GroupFabric::kDataSenderIndexSize);
                     err = CHIP_NO_ERROR;
                 }
             }
@@ -262,7 +300,7 @@ GroupOutgoingCounters::GroupOutgoingCounters(chip::PersistentStorageDelegate * s
     TEMPORARY_RETURN_IGNORED Init(storage_delegate);
 }
 
-CHIP_ERROR GroupOutgoingCounters::Init(chip::PersistentStorageDelegate * storage_delegate)
+CHIP_ERROR GroupOutgoingCounters::Init(chip::PersistentStorageDelegate * storage_delegate, System::Layer * systemLayer)
 {
 
     if (storage_delegate == nullptr)
@@ -271,8 +309,11 @@ CHIP_ERROR GroupOutgoingCounters::Init(chip::PersistentStorageDelegate * storage
     }
 
     // Spec 4.5.1.3
-    mStorage      = storage_delegate;
-    uint16_t size = static_cast<uint16_t>(sizeof(uint32_t));
+    mStorage                   = storage_delegate;
+    mSystemLayer               = systemLayer;
+    mDataReservationPending    = false;
+    mControlReservationPending = false;
+    uint16_t size              = static_cast<uint16_t>(sizeof(uint32_t));
     uint32_t temp;
     CHIP_ERROR err;
     err = mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::GroupControlCounter().KeyName(), &temp, size);
@@ -305,13 +346,19 @@ CHIP_ERROR GroupOutgoingCounters::Init(chip::PersistentStorageDelegate * storage
         mGroupDataCounter = temp;
     }
 
-    temp = mGroupControlCounter + GROUP_MSG_COUNTER_MIN_INCREMENT;
-    size = static_cast<uint16_t>(sizeof(temp));
-    ReturnErrorOnFailure(mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::GroupControlCounter().KeyName(), &temp, size));
-
-    temp = mGroupDataCounter + GROUP_MSG_COUNTER_MIN_INCREMENT;
+    ReturnErrorOnFailure(PersistCounterLimit(true, mGroupControlCounter + GROUP_MSG_COUNTER_MIN_INCREMENT));
+    return PersistCounterLimit(false, mGroupDataCounter + GROUP_MSG_COUNTER_MIN_INCREMENT);
+}
 
-    return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::GroupDataCounter().KeyName(), &temp, size);
+void GroupOutgoingCounters::Shutdown()
+{
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(ReserveNextWindows, this);
+        mSystemLayer = nullptr;
+    }
+    mDataReservationPending    = false;
+    mControlReservationPending = false;
 }
 
 uint32_t GroupOutgoingCounters::GetCounter(bool isControl)
@@ -321,35 +368,64 @@ uint32_t GroupOutgoingCounters::GetCounter(bool isControl)
 
 CHIP_ERROR GroupOutgoingCounters::IncrementCounter(bool isControl)
 {
-    uint32_t temp  = 0;
-    uint16_t size  = static_cast<uint16_t>(sizeof(uint32_t));
-    uint32_t value = 0;
+    uint32_t & counter = isControl ? mGroupControlCounter : mGroupDataCounter;
+    uint32_t limit     = isControl ? mGroupControlCounterLimit : mGroupDataCounterLimit;
+    bool & pending     = isControl ? mControlReservationPending : mDataReservationPending;
 
-    StorageKeyName key = StorageKeyName::Uninitialized();
+    counter++;
 
-    if (isControl)
+    if (mStorage == nullptr)
     {
-        mGroupControlCounter++;
-        key   = DefaultStorageKeyAllocator::GroupControlCounter();
-        value = mGroupControlCounter;
+        return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
     }
-    else
+
+    // Counters may roll over, so measure the distance to the limit in modular arithmetic. The limit is never
+    // reserved more than two windows ahead, so a larger distance means that the counter went past the limit
+    // after a failed write.
+    uint32_t remaining = limit - counter;
+    if (remaining == 0 || remaining > 2 * GROUP_MSG_COUNTER_MIN_INCREMENT)
     {
-        mGroupDataCounter++;
-        key   = DefaultStorageKeyAllocator::GroupDataCounter();
-        value = mGroupDataCounter;
+        // The reserved window is exhausted: the next value cannot be used before a new limit is persisted.
+        return PersistCounterLimit(isControl, counter + GROUP_MSG_COUNTER_MIN_INCREMENT);
     }
 
-    if (mStorage == nullptr)
+    if (remaining <= GROUP_MSG_COUNTER_MIN_INCREMENT / 2 && !pending && mSystemLayer != nullptr)
     {
-        return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+        pending = (mSystemLayer->ScheduleWork(ReserveNextWindows, this) == CHIP_NO_ERROR);
     }
+    return CHIP_NO_ERROR;
+}
 
-    ReturnErrorOnFailure(mStorage->SyncGetKeyValue(key.KeyName(), &temp, size));
-    if (temp == value)
+void GroupOutgoingCounters::ReserveNextWindows(System::Layer *, void * appState)
+{
+    auto * self = static_cast<GroupOutgoingCounters *>(appState);
+
+    // A failed reservation is retried when the counter next advances, or done synchronously once the window is exhausted.
+    if (self->mControlReservationPending)
+    {
+        self->mControlReservationPending = false;
+        LogErrorOnFailure(self->PersistCounterLimit(true, self->mGroupControlCounterLimit + GROUP_MSG_COUNTER_MIN_INCREMENT));
+    }
+    if (self->mDataReservationPending)
+    {
+        self->mDataReservationPending = false;
+        LogErrorOnFailure(self->PersistCounterLimit(false, self->mGroupDataCounterLimit + GROUP_MSG_COUNTER_MIN_INCREMENT));
+    }
+}
+
+CHIP_ERROR GroupOutgoingCounters::PersistCounterLimit(bool isControl, uint32_t limit)
+{
+    StorageKeyName key =
+        isControl ? DefaultStorageKeyAllocator::GroupControlCounter() : DefaultStorageKeyAllocator::GroupDataCounter();
+    ReturnErrorOnFailure(mStorage->SyncSetKeyValue(key.KeyName(), &limit, static_cast<uint16_t>(sizeof(limit))));
+
+    if (isControl)
+    {
+        mGroupControlCounterLimit = limit;
+    }
+    else
     {
-        temp = value + GROUP_MSG_COUNTER_MIN_INCREMENT;
-        return mStorage->SyncSetKeyValue(key.KeyName(), &temp, sizeof(uint32_t));
+        mGroupDataCounterLimit = limit;
     }
     return CHIP_NO_ERROR;
 }
@@ -23,12 +23,15 @@
 
 #include <array>
 #include <bitset>
+#include <cstddef>
+#include <cstdint>
 
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/core/NodeId.h>
 #include <lib/core/PeerId.h>
 #include <lib/support/Span.h>
+#include <system/SystemLayer.h>
 #include <transport/PeerMessageCounter.h>
 
 #define GROUP_MSG_COUNTER_MIN_INCREMENT 1000
@@ -41,21 +44,47 @@ class GroupSender
 public:
     NodeId mNodeId = kUndefinedNodeId;
     PeerMessageCounter msgCounter;
+    uint32_t mLastUsed = 0; ///< Value of the use tick of the peer table when the peer was last looked up.
 };
 
+/// Number of slots of the hash index of a list of group senders, a power of two at least twice the list size.
+constexpr size_t GroupSenderIndexSize(size_t peers)
+{
+    size_t size = 1;
+    while (size < 2 * peers)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
 class GroupFabric
 {
 public:
+    static constexpr size_t kDataSenderIndexSize    = GroupSenderIndexSize(CHIP_CONFIG_MAX_GROUP_DATA_PEERS);
+    static constexpr size_t kControlSenderIndexSize = GroupSenderIndexSize(CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS);
+    static_assert(CHIP_CONFIG_MAX_GROUP_DATA_PEERS < UINT8_MAX && CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS < UINT8_MAX,
+                  "Group sender index entries are stored in a uint8_t");
+
     FabricIndex mFabricIndex  = kUndefinedFabricIndex;
     uint8_t mControlPeerCount = 0;
     uint8_t mDataPeerCount    = 0;
     GroupSender mDataGroupSenders[CHIP_CONFIG_MAX_GROUP_DATA_PEERS];
     GroupSender mControlGroupSenders[CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS];
+    // Open-addressing indexes of the sender lists by node ID. Each slot holds the position of a sender plus one, or 0.
+    uint8_t mDataSenderIndex[kDataSenderIndexSize]       = {};
+    uint8_t mControlSenderIndex[kControlSenderIndexSize] = {};
 };
 
 class GroupPeerTable
 {
 public:
+    struct Stats
+    {
+        uint32_t mEvictions  = 0; ///< Peers evicted to make room for a new peer.
+        uint32_t mRejections = 0; ///< Peers that could not be added because the table was full.
+    };
+
     CHIP_ERROR FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl,
                              chip::Transport::PeerMessageCounter *& counter);
 
@@ -64,16 +93,33 @@ public:
 
     CHIP_ERROR FabricRemoved(FabricIndex fabricIndex);
 
+    /// Select whether a new peer evicts the least recently used peer of a full fabric list, rather than being rejected.
+    void SetEvictLeastRecentlyUsed(bool evict) { mEvictLeastRecentlyUsed = evict; }
+
+    const Stats & GetStats() const { return mStats; }
+
     // Protected for Unit Tests inheritance
 protected:
+    CHIP_ERROR FindOrAddSender(GroupSender * list, uint8_t * index, size_t indexSize, uint32_t size, uint8_t & peerCount,
+                               NodeId nodeId, chip::Transport::PeerMessageCounter *& counter);
+    static void RebuildIndex(const GroupSender * list, uint32_t size, uint8_t * index, size_t indexSize);
     bool RemoveSpecificPeer(GroupSender * list, NodeId nodeId, uint32_t size);
     void CompactPeers(GroupSender * list, uint32_t size);
     void RemoveAndCompactFabric(uint32_t tableIndex);
 
     GroupFabric mGroupFabrics[CHIP_CONFIG_MAX_FABRICS];
+    uint32_t mUseTick            = 0;
+    bool mEvictLeastRecentlyUsed = CHIP_CONFIG_GROUP_PEER_TABLE_EVICT_LRU;
+    Stats mStats;
 };
 
 // Might want to rename this so that it is explicitly the sending side of counters
+//
+// Each counter may be used up to a limit that has been persisted ahead of it, so that
+// no counter value is ever reused after a reboot. The limit is kept in memory, and once
+// the counter gets within half a window of it, the next window is reserved from a work
+// item of the system layer rather than on the send path. Only if the counter reaches
+// the limit before that work item ran is the next window persisted synchronously.
 class GroupOutgoingCounters
 {
 public:
@@ -81,16 +127,25 @@ public:
 
     GroupOutgoingCounters(){};
     GroupOutgoingCounters(chip::PersistentStorageDelegate * storage_delegate);
-    CHIP_ERROR Init(chip::PersistentStorageDelegate * storage_delegate);
+    CHIP_ERROR Init(chip::PersistentStorageDelegate * storage_delegate, System::Layer * systemLayer = nullptr);
+    void Shutdown();
     uint32_t GetCounter(bool isControl);
     CHIP_ERROR IncrementCounter(bool isControl);
 
     // Protected for Unit Tests inheritance
 protected:
+    static void ReserveNextWindows(System::Layer *, void * appState);
+    CHIP_ERROR PersistCounterLimit(bool isControl, uint32_t limit);
+
     // TODO Initialize those to random value
     uint32_t mGroupDataCounter                 = 0;
     uint32_t mGroupControlCounter              = 0;
+    uint32_t mGroupDataCounterLimit            = 0; ///< Persisted value the data counter must not reach.
+    uint32_t mGroupControlCounterLimit         = 0; ///< Persisted value the control counter must not reach.
+    bool mDataReservationPending               = false;
+    bool mControlReservationPending            = false;
     chip::PersistentStorageDelegate * mStorage = nullptr;
+    System::Layer * mSystemLayer               = nullptr;
 };
 
 } // namespace Transport
@@ -0,0 +1,71 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <transport/MessageStats.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace {
+
+void AddSaturating(uint32_t & counter, size_t value)
+{
+    counter = (value > UINT32_MAX - counter) ? UINT32_MAX : static_cast<uint32_t>(counter + value);
+}
+
+} // namespace
+
+MessageTypeStats * MessageTypeStatsTable::FindOrAdd(Protocols::Id protocolId, uint8_t messageType)
+{
+    for (size_t i = 0; i < mSize; i++)
+    {
+        if (mEntries[i].messageType == messageType && mEntries[i].protocolId == protocolId)
+        {
+            return &mEntries[i];
+        }
+    }
+
+    if (mSize == kCapacity)
+    {
+        mUntrackedMessages++;
+        return nullptr;
+    }
+
+    MessageTypeStats & entry = mEntries[mSize++];
+    entry.protocolId         = protocolId;
+    entry.messageType        = messageType;
+    return &entry;
+}
+
+void MessageTypeStatsTable::CountSent(Protocols::Id protocolId, uint8_t messageType, size_t bytes)
+{
+    MessageTypeStats * entry = FindOrAdd(protocolId, messageType);
+    VerifyOrReturn(entry != nullptr);
+    AddSaturating(entry->messagesSent, 1);
+    AddSaturating(entry->bytesSent, bytes);
+}
+
+void MessageTypeStatsTable::CountReceived(Protocols::Id protocolId, uint8_t messageType, size_t bytes)
+{
+    MessageTypeStats * entry = FindOrAdd(protocolId, messageType);
+    VerifyOrReturn(entry != nullptr);
+    AddSaturating(entry->messagesReceived, 1);
+    AddSaturating(entry->bytesReceived, bytes);
+}
+
+} // namespace chip
@@ -17,6 +17,11 @@
  */
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
+#include <protocols/Protocols.h>
+
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace chip {
@@ -25,6 +30,57 @@ struct MessageStats
 {
     uint32_t interactionModelMessagesReceived = 0;
     uint32_t interactionModelMessagesSent     = 0;
+
+    uint32_t retransmissions             = 0; ///< MRP retransmissions of reliable messages
+    uint32_t duplicateMessagesReceived   = 0; ///< Messages whose counter was already seen; dropped or only acknowledged
+    uint32_t decryptionFailures          = 0; ///< Encrypted messages that could not be decrypted or authenticated
+    uint32_t queuedDecryptions           = 0; ///< Messages decrypted through a SecureMessageDecryptOffload
+    uint32_t maxDecryptionQueueDelayUs   = 0; ///< Longest wait of a queued message for its decryption
+    uint64_t totalDecryptionQueueDelayUs = 0; ///< Sum of the waits of all queued messages
+};
+
+/**
+ * Message and byte counts for one message type, i.e. one opcode of one protocol.
+ */
+struct MessageTypeStats
+{
+    Protocols::Id protocolId  = Protocols::NotSpecified;
+    uint8_t messageType       = 0;
+    uint32_t messagesSent     = 0;
+    uint32_t messagesReceived = 0;
+    uint32_t bytesSent        = 0; ///< Including the packet and payload headers
+    uint32_t bytesReceived    = 0; ///< Including the packet and payload headers
+};
+
+/**
+ * A fixed-size table of MessageTypeStats, holding an entry for each of the first kCapacity
+ * message types sent or received.  Messages of further types are only counted as untracked.
+ *
+ * Copying the table takes a snapshot of its counters.
+ */
+class MessageTypeStatsTable
+{
+public:
+    static constexpr size_t kCapacity = CHIP_CONFIG_MESSAGE_TYPE_STATS_TABLE_SIZE;
+
+    void CountSent(Protocols::Id protocolId, uint8_t messageType, size_t bytes);
+    void CountReceived(Protocols::Id protocolId, uint8_t messageType, size_t bytes);
+
+    /// Number of message types tracked so far.
+    size_t Size() const { return mSize; }
+
+    /// Entries in order of first use; index must be below Size().
+    const MessageTypeStats & operator[](size_t index) const { return mEntries[index]; }
+
+    /// Messages sent or received whose type did not fit into the table.
+    uint32_t UntrackedMessages() const { return mUntrackedMessages; }
+
+private:
+    MessageTypeStats * FindOrAdd(Protocols::Id protocolId, uint8_t messageType);
+
+    std::array<MessageTypeStats, kCapacity> mEntries;
+    size_t mSize                = 0;
+    uint32_t mUntrackedMessages = 0;
 };
 
 } // namespace chip
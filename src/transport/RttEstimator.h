@@ -0,0 +1,79 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a round-trip time estimator for the messages sent to a peer.
+ *
+ */
+#pragma once
+
+#include <algorithm>
+
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Smoothed round-trip time (SRTT) and round-trip time variation (RTTVAR) of a peer, computed as in RFC 6298
+ * section 2 from the time it takes for our messages to be acknowledged.
+ *
+ * Only samples of messages that were not retransmitted should be added (Karn's algorithm), since it is not
+ * known which transmission an ack for a retransmitted message is for.
+ */
+class RttEstimator
+{
+public:
+    void AddSample(System::Clock::Milliseconds32 rtt)
+    {
+        if (!mHasEstimate)
+        {
+            mSmoothedRtt  = rtt;
+            mRttVariation = rtt / 2;
+            mHasEstimate  = true;
+            return;
+        }
+
+        // RTTVAR = 3/4 * RTTVAR + 1/4 * |SRTT - R|, then SRTT = 7/8 * SRTT + 1/8 * R
+        const System::Clock::Milliseconds32 error = (mSmoothedRtt > rtt) ? mSmoothedRtt - rtt : rtt - mSmoothedRtt;
+        mRttVariation                             = (mRttVariation * 3 + error) / 4;
+        mSmoothedRtt                              = (mSmoothedRtt * 7 + rtt) / 8;
+    }
+
+    bool HasEstimate() const { return mHasEstimate; }
+    System::Clock::Milliseconds32 GetSmoothedRtt() const { return mSmoothedRtt; }
+    System::Clock::Milliseconds32 GetRttVariation() const { return mRttVariation; }
+
+    /**
+     * The retransmission timeout the estimate calls for: SRTT + max(G, 4 * RTTVAR), with a clock granularity G of
+     * 1 ms.  Only meaningful if HasEstimate().
+     */
+    System::Clock::Milliseconds32 GetRetransmissionTimeout() const
+    {
+        return mSmoothedRtt + std::max(System::Clock::Milliseconds32(1), mRttVariation * 4);
+    }
+
+    void Reset() { *this = RttEstimator(); }
+
+private:
+    System::Clock::Milliseconds32 mSmoothedRtt  = System::Clock::kZero;
+    System::Clock::Milliseconds32 mRttVariation = System::Clock::kZero;
+    bool mHasEstimate                           = false;
+};
+
+} // namespace Transport
+} // namespace chip
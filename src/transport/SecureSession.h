@@ -26,6 +26,7 @@
 #include <lib/core/ReferenceCounted.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <transport/CryptoContext.h>
+#include <transport/RttEstimator.h>
 #include <transport/Session.h>
 #include <transport/SessionMessageCounter.h>
 #include <transport/raw/PeerAddress.h>
@@ -224,23 +225,14 @@ public:
 
     // Called when AddNOC has gone through sufficient success that we need to switch the
     // session to reflect a new fabric if it was a PASE session
-    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex)
-    {
-        // It's not legal to augment session type for non-PASE
-        if (mSecureSessionType != Type::kPASE)
-        {
-            return CHIP_ERROR_INVALID_ARGUMENT;
-        }
-        SetFabricIndex(fabricIndex);
-        return CHIP_NO_ERROR;
-    }
+    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex);
 
     System::Clock::Timestamp GetLastActivityTime() const { return mLastActivityTime; }
     System::Clock::Timestamp GetLastPeerActivityTime() const { return mLastPeerActivityTime; }
-    void MarkActive() { mLastActivityTime = System::SystemClock().GetMonotonicTimestamp(); }
+    void MarkActive() { mLastActivityTime = System::SystemClock().GetCachedMonotonicTimestamp(); }
     void MarkActiveRx()
     {
-        mLastPeerActivityTime = System::SystemClock().GetMonotonicTimestamp();
+        mLastPeerActivityTime = System::SystemClock().GetCachedMonotonicTimestamp();
         MarkActive();
 
         if (mState == State::kDefunct)
@@ -272,6 +264,10 @@ public:
 
     SessionMessageCounter & GetSessionMessageCounter() { return mSessionMessageCounter; }
 
+    // Round-trip time estimate of the peer, fed by ReliableMessageMgr from the acks of our messages.
+    RttEstimator & GetRttEstimator() { return mRttEstimator; }
+    const RttEstimator & GetRttEstimator() const { return mRttEstimator; }
+
     // This should be a private API, only meant to be called by SecureSessionTable
     // Session holders to this session may shift to the target session regarding SessionDelegate::GetNewSessionHandlingPolicy.
     // It requires that the target sessoin is also a CASE session, having the same peer and CATs as this session.
@@ -327,7 +323,19 @@ private:
     const char * StateToString(State state) const;
     void MoveToState(State targetState);
 
+    // Links of the session in the per-fabric and per-peer chains of SecureSessionTable, only used by the table.
+    struct TableLinks
+    {
+        SecureSession * mPrevOnFabric = nullptr;
+        SecureSession * mNextOnFabric = nullptr;
+        SecureSession * mPrevOnPeer   = nullptr;
+        SecureSession * mNextOnPeer   = nullptr;
+        ScopedNodeId mIndexedPeer; // the fabric index and peer the session is chained under
+        bool mIndexed = false;
+    };
+
     friend class SecureSessionDeleter;
+    friend class SecureSessionTable;
     friend class TestSecureSessionTable;
 
     SecureSessionTable & mTable;
@@ -351,6 +359,9 @@ private:
     SessionParameters mRemoteSessionParams;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+    RttEstimator mRttEstimator;
+
+    TableLinks mTableLinks;
 };
 
 } // namespace Transport
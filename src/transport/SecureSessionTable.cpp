@@ -52,8 +52,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result =
+        CreateSession(secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs, peerSessionId, fabricIndex, config);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -73,7 +73,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = CreateSession(secureSessionType, sessionId.Value());
     }
     else
     {
@@ -216,7 +216,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = CreateSession(secureSessionType, localSessionId);
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -339,68 +339,176 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
-    SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
-        if (session->GetLocalSessionId() == localSessionId)
-        {
-            result = session;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    SecureSession * result = mSessionIdIndex.Find(localSessionId);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
-    uint16_t candidate_base = 0;
-    uint64_t candidate_mask = 0;
-    for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
+    // Session IDs are handed out sequentially from mNextSessionId, so the first candidate is almost always free, and
+    // at most the number of live sessions can be in use.
+    uint16_t candidate = mNextSessionId;
+    for (uint32_t i = 0; i <= kMaxSessionID; i++, candidate++)
     {
-        // candidate_base is the base session ID we are searching from.
-        // We have a 64-bit mask anchored at this ID and iterate over the
-        // whole session table, setting bits in the mask for in-use IDs.
-        // If we can iterate through the entire session table and have
-        // any bits clear in the mask, we have available session IDs.
-        candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-        candidate_mask = 0;
+        if (candidate != kUnsecuredSessionId && mSessionIdIndex.Find(candidate) == nullptr)
         {
-            uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-            }
+            return MakeOptional<uint16_t>(candidate);
         }
-        mEntries.ForEachActiveObject([&](auto session) {
-            uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift);
-            }
-            if (candidate_mask == UINT64_MAX)
-            {
-                return Loop::Break; // No bits clear means this bucket is full.
-            }
-            return Loop::Continue;
-        });
-        if (candidate_mask != UINT64_MAX)
+    }
+
+    return NullOptional;
+}
+
+bool SecureSessionTable::LocalSessionIdIndex::Insert(SecureSession * session)
+{
+    size_t slot = Home(session->GetLocalSessionId());
+    for (size_t probes = 0; probes < kCapacity; probes++, slot = Next(slot))
+    {
+        if (mSlots[slot] == nullptr)
         {
-            break; // Any bit clear means we have an available ID in this bucket.
+            mSlots[slot] = session;
+            return true;
         }
     }
-    if (candidate_mask != UINT64_MAX)
+    return false;
+}
+
+void SecureSessionTable::LocalSessionIdIndex::Remove(SecureSession * session)
+{
+    size_t hole   = Home(session->GetLocalSessionId());
+    size_t probes = 0;
+    for (; mSlots[hole] != session; probes++, hole = Next(hole))
     {
-        uint16_t offset = 0;
-        while (candidate_mask & 1)
+        VerifyOrReturn(mSlots[hole] != nullptr && probes < kCapacity);
+    }
+    mSlots[hole] = nullptr;
+
+    // Shift later entries of the probe sequence back into the hole, so that Find can stop at the first empty slot.
+    for (size_t slot = Next(hole); mSlots[slot] != nullptr; slot = Next(slot))
+    {
+        size_t home = Home(mSlots[slot]->GetLocalSessionId());
+        // The entry can move iff its home is not cyclically in (hole, slot].
+        bool homeInRange = (hole < slot) ? (hole < home && home <= slot) : (hole < home || home <= slot);
+        if (!homeInRange)
         {
-            candidate_mask >>= 1;
-            ++offset;
+            mSlots[hole] = mSlots[slot];
+            mSlots[slot] = nullptr;
+            hole         = slot;
         }
-        uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-        return MakeOptional<uint16_t>(available);
     }
+}
 
-    return NullOptional;
+SecureSession * SecureSessionTable::LocalSessionIdIndex::Find(uint16_t localSessionId) const
+{
+    size_t slot = Home(localSessionId);
+    for (size_t probes = 0; probes < kCapacity && mSlots[slot] != nullptr; probes++, slot = Next(slot))
+    {
+        if (mSlots[slot]->GetLocalSessionId() == localSessionId)
+        {
+            return mSlots[slot];
+        }
+    }
+    return nullptr;
+}
+
+size_t SecureSessionTable::PeerIndex::PeerBucket(const ScopedNodeId & peer)
+{
+    // Operational node IDs are random, but mix the bits anyway so that test and sequential IDs spread too.
+    uint64_t key = peer.GetNodeId() ^ (static_cast<uint64_t>(peer.GetFabricIndex()) << 56);
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return static_cast<size_t>(key & (kPeerBuckets - 1));
+}
+
+SecureSession * SecureSessionTable::PeerIndex::Next(SecureSession * session, Chain chain)
+{
+    return chain == Chain::kFabric ? session->mTableLinks.mNextOnFabric : session->mTableLinks.mNextOnPeer;
+}
+
+void SecureSessionTable::PeerIndex::Update(SecureSession * session)
+{
+    Remove(session);
+
+    auto & links       = session->mTableLinks;
+    links.mIndexedPeer = session->GetPeer();
+    links.mIndexed     = true;
+
+    Bucket & fabricChain = mFabricChains[FabricBucket(links.mIndexedPeer.GetFabricIndex())];
+    links.mPrevOnFabric  = fabricChain.mLast;
+    if (fabricChain.mLast != nullptr)
+    {
+        fabricChain.mLast->mTableLinks.mNextOnFabric = session;
+    }
+    else
+    {
+        fabricChain.mFirst = session;
+    }
+    fabricChain.mLast = session;
+
+    Bucket & peerChain = mPeerChains[PeerBucket(links.mIndexedPeer)];
+    links.mPrevOnPeer  = peerChain.mLast;
+    if (peerChain.mLast != nullptr)
+    {
+        peerChain.mLast->mTableLinks.mNextOnPeer = session;
+    }
+    else
+    {
+        peerChain.mFirst = session;
+    }
+    peerChain.mLast = session;
+}
+
+void SecureSessionTable::PeerIndex::Remove(SecureSession * session)
+{
+    auto & links = session->mTableLinks;
+    VerifyOrReturn(links.mIndexed);
+
+    for (Walk * walk = mWalks; walk != nullptr; walk = walk->mOuter)
+    {
+        if (walk->mNext == session)
+        {
+            walk->mNext = Next(session, walk->mChain);
+        }
+    }
+
+    Bucket & fabricChain = mFabricChains[FabricBucket(links.mIndexedPeer.GetFabricIndex())];
+    if (links.mPrevOnFabric != nullptr)
+    {
+        links.mPrevOnFabric->mTableLinks.mNextOnFabric = links.mNextOnFabric;
+    }
+    else
+    {
+        fabricChain.mFirst = links.mNextOnFabric;
+    }
+    if (links.mNextOnFabric != nullptr)
+    {
+        links.mNextOnFabric->mTableLinks.mPrevOnFabric = links.mPrevOnFabric;
+    }
+    else
+    {
+        fabricChain.mLast = links.mPrevOnFabric;
+    }
+
+    Bucket & peerChain = mPeerChains[PeerBucket(links.mIndexedPeer)];
+    if (links.mPrevOnPeer != nullptr)
+    {
+        links.mPrevOnPeer->mTableLinks.mNextOnPeer = links.mNextOnPeer;
+    }
+    else
+    {
+        peerChain.mFirst = links.mNextOnPeer;
+    }
+    if (links.mNextOnPeer != nullptr)
+    {
+        links.mNextOnPeer->mTableLinks.mPrevOnPeer = links.mPrevOnPeer;
+    }
+    else
+    {
+        peerChain.mLast = links.mPrevOnPeer;
+    }
+
+    links = SecureSession::TableLinks();
 }
 
 } // namespace Transport
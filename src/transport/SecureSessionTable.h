@@ -18,6 +18,7 @@
 
 #include <lib/core/CHIPError.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ObjectPoolRegistry.h>
 #include <lib/support/Pool.h>
 #include <lib/support/SortUtils.h>
 #include <system/TimeSource.h>
@@ -29,6 +30,18 @@ namespace Transport {
 inline constexpr uint16_t kMaxSessionID       = UINT16_MAX;
 inline constexpr uint16_t kUnsecuredSessionId = 0;
 
+namespace detail {
+constexpr size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+} // namespace detail
+
 /**
  * Handles a set of sessions.
  *
@@ -76,7 +89,15 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+        mSessionIdIndex.Remove(session);
+        mPeerIndex.Remove(session);
+        mEntries.ReleaseObject(session);
+    }
+
+    // Called by SecureSession when its fabric index or peer node ID changed.
+    void UpdateSessionPeer(SecureSession * session) { mPeerIndex.Update(session); }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +105,32 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Call the function on the sessions with the given fabric index, without walking the sessions of the other fabrics.
+     *
+     * The function may release sessions, or change their fabric index or peer.
+     */
+    template <typename Function>
+    Loop ForEachSessionOnFabric(FabricIndex fabricIndex, Function && function)
+    {
+        return mPeerIndex.ForEach(mPeerIndex.FirstOnFabric(fabricIndex), PeerIndex::Chain::kFabric, [&](SecureSession * session) {
+            return session->GetFabricIndex() == fabricIndex ? function(session) : Loop::Continue;
+        });
+    }
+
+    /**
+     * Call the function on the sessions whose peer is the given node, without walking the sessions with other peers.
+     *
+     * The function may release sessions, or change their fabric index or peer.
+     */
+    template <typename Function>
+    Loop ForEachSessionOnPeer(const ScopedNodeId & peer, Function && function)
+    {
+        return mPeerIndex.ForEach(mPeerIndex.FirstOnPeer(peer), PeerIndex::Chain::kPeer, [&](SecureSession * session) {
+            return session->GetPeer() == peer ? function(session) : Loop::Continue;
+        });
+    }
+
     /**
      * Get a secure session given its session ID.
      *
@@ -100,7 +147,7 @@ public:
     void NewerSessionAvailable(SecureSession * session)
     {
         VerifyOrDie(session->GetSecureSessionType() == SecureSession::Type::kCASE);
-        mEntries.ForEachActiveObject([&](SecureSession * oldSession) {
+        ForEachSessionOnPeer(session->GetPeer(), [&](SecureSession * oldSession) {
             if (session == oldSession)
                 return Loop::Continue;
 
@@ -256,8 +303,124 @@ private:
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    /**
+     * Open-addressed hash index of the sessions in mEntries by local session ID, so that looking up the session of a
+     * received message and finding an unused session ID do not have to walk the whole pool.
+     *
+     * Local session IDs are allocated sequentially, so they are used directly as the hash.
+     */
+    class LocalSessionIdIndex
+    {
+    public:
+        bool Insert(SecureSession * session);
+        void Remove(SecureSession * session);
+        SecureSession * Find(uint16_t localSessionId) const;
+
+    private:
+        // Keep the load factor at or below 1/2 so probe sequences stay short.
+        static constexpr size_t kCapacity = detail::RoundUpToPowerOfTwo(2 * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+
+        static size_t Home(uint16_t localSessionId) { return localSessionId & (kCapacity - 1); }
+        static size_t Next(size_t slot) { return (slot + 1) & (kCapacity - 1); }
+
+        SecureSession * mSlots[kCapacity] = {};
+    };
+
+    /**
+     * Index of the sessions in mEntries by fabric index and by peer, so that expiring or looking up the sessions of one
+     * fabric or one node does not have to walk the whole pool.
+     *
+     * Every session is in two chains: the one of the bucket its fabric index hashes to, and the one of the bucket its
+     * peer hashes to, in the order the sessions were chained.  Sessions still being established are chained under the
+     * undefined fabric index and node ID.  Walks of a chain stay valid when sessions are removed from it meanwhile.
+     */
+    class PeerIndex
+    {
+    public:
+        enum class Chain : uint8_t
+        {
+            kFabric,
+            kPeer,
+        };
+
+        // Chain the session under its current fabric index and peer, removing it from the chains it was in.
+        void Update(SecureSession * session);
+        void Remove(SecureSession * session);
+
+        SecureSession * FirstOnFabric(FabricIndex fabricIndex) const { return mFabricChains[FabricBucket(fabricIndex)].mFirst; }
+        SecureSession * FirstOnPeer(const ScopedNodeId & peer) const { return mPeerChains[PeerBucket(peer)].mFirst; }
+
+        template <typename Function>
+        Loop ForEach(SecureSession * first, Chain chain, Function && function)
+        {
+            Walk walk{ first, chain, mWalks };
+            mWalks      = &walk;
+            Loop result = Loop::Finish;
+            while (walk.mNext != nullptr)
+            {
+                SecureSession * session = walk.mNext;
+                walk.mNext              = Next(session, chain);
+                if (function(session) == Loop::Break)
+                {
+                    result = Loop::Break;
+                    break;
+                }
+            }
+            mWalks = walk.mOuter;
+            return result;
+        }
+
+    private:
+        struct Bucket
+        {
+            SecureSession * mFirst = nullptr;
+            SecureSession * mLast  = nullptr;
+        };
+
+        // A walk in progress, whose next session is advanced if that session is removed from the chain.
+        struct Walk
+        {
+            SecureSession * mNext;
+            Chain mChain;
+            Walk * mOuter;
+        };
+
+        static constexpr size_t kFabricBuckets = detail::RoundUpToPowerOfTwo(CHIP_CONFIG_MAX_FABRICS);
+        static constexpr size_t kPeerBuckets   = detail::RoundUpToPowerOfTwo(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+
+        static size_t FabricBucket(FabricIndex fabricIndex) { return fabricIndex & (kFabricBuckets - 1); }
+        static size_t PeerBucket(const ScopedNodeId & peer);
+        static SecureSession * Next(SecureSession * session, Chain chain);
+
+        Bucket mFabricChains[kFabricBuckets];
+        Bucket mPeerChains[kPeerBuckets];
+        Walk * mWalks = nullptr;
+    };
+
+    /**
+     * Create a session in mEntries and add it to mSessionIdIndex and mPeerIndex.
+     */
+    template <typename... Args>
+    SecureSession * CreateSession(Args &&... args)
+    {
+        SecureSession * session = mEntries.CreateObject(*this, std::forward<Args>(args)...);
+        if (session != nullptr && !mSessionIdIndex.Insert(session))
+        {
+            mEntries.ReleaseObject(session);
+            session = nullptr;
+        }
+        if (session != nullptr)
+        {
+            mPeerIndex.Update(session);
+        }
+        return session;
+    }
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
+    ObjectPoolRegistration mEntriesRegistration{ CHIP_OBJECT_POOL_NAMES("core_pool_secure_sessions"), mEntries };
+    LocalSessionIdIndex mSessionIdIndex;
+    PeerIndex mPeerIndex;
 
     size_t GetMaxSessionTableSize() const
     {
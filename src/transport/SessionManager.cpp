@@ -26,6 +26,7 @@
 
 #include "SessionManager.h"
 
+#include <algorithm>
 #include <inttypes.h>
 #include <string.h>
 
@@ -37,6 +38,7 @@
 #include <lib/core/Global.h>
 #include <lib/support/AutoRelease.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/MemoryTags.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <platform/CHIPDeviceLayer.h>
@@ -119,7 +121,7 @@ CHIP_ERROR SessionManager::Init(System::Layer * systemLayer, TransportMgrBase *
 
     mGlobalUnencryptedMessageCounter.Init();
 
-    ReturnErrorOnFailure(mGroupClientCounter.Init(storageDelegate));
+    ReturnErrorOnFailure(mGroupClientCounter.Init(storageDelegate, systemLayer));
 
     mTransportMgr->SetSessionManager(this);
 
@@ -129,7 +131,8 @@ CHIP_ERROR SessionManager::Init(System::Layer * systemLayer, TransportMgrBase *
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
     // Ensure MessageStats struct is at default state on Init
-    mMessageStats = MessageStats();
+    mMessageStats     = MessageStats();
+    mMessageTypeStats = MessageTypeStatsTable();
 
     return CHIP_NO_ERROR;
 }
@@ -157,6 +160,8 @@ void SessionManager::Shutdown()
 
     mMessageCounterManager = nullptr;
 
+    mGroupClientCounter.Shutdown();
+
     mSystemLayer  = nullptr;
     mTransportMgr = nullptr;
     mCB           = nullptr;
@@ -398,9 +403,10 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
                     msgTypeName, static_cast<unsigned>(message->TotalLength()));
 #endif
 
-    preparedMessage = EncryptedPacketBufferHandle::MarkEncrypted(std::move(message));
+    size_t messageSize = message->TotalLength();
+    preparedMessage    = EncryptedPacketBufferHandle::MarkEncrypted(std::move(message));
 
-    CountMessagesSent(sessionHandle, payloadHeader);
+    CountMessagesSent(sessionHandle, payloadHeader, messageSize);
     return CHIP_NO_ERROR;
 }
 
@@ -571,9 +577,8 @@ void SessionManager::ExpireAllSecureSessions()
 
 void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Optional<Transport::SecureSession::Type> & type)
 {
-    mSecureSessions.ForEachSession([&node, &type](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == node &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+    mSecureSessions.ForEachSessionOnPeer(node, [&type](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             session->MarkAsDefunct();
         }
@@ -583,10 +588,10 @@ void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Opti
 
 void SessionManager::UpdateAllSessionsPeerAddress(const ScopedNodeId & node, const Transport::PeerAddress & addr)
 {
-    mSecureSessions.ForEachSession([&node, &addr](auto session) {
+    mSecureSessions.ForEachSessionOnPeer(node, [&addr](auto session) {
         // Arguably we should only be updating active and defunct sessions, but there is no harm
         // in updating evicted sessions.
-        if (session->GetPeer() == node && Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
+        if (Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
         {
             session->SetPeerAddress(addr);
         }
@@ -646,6 +651,7 @@ CHIP_ERROR SessionManager::InjectCaseSessionWithTestKey(SessionHolder & sessionH
 void SessionManager::OnMessageReceived(const PeerAddress & peerAddress, System::PacketBufferHandle && msg,
                                        Transport::MessageTransportContext * ctxt)
 {
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kTransport);
     PacketHeader partialPacketHeader;
 
     CHIP_ERROR err = partialPacketHeader.DecodeFixed(msg);
@@ -757,7 +763,7 @@ void SessionManager::UnauthenticatedMessageDispatch(const PacketHeader & partial
     }
 
     // Capture length before consuming headers.
-    [[maybe_unused]] size_t messageTotalSize = msg->TotalLength();
+    size_t messageTotalSize = msg->TotalLength();
 
     PacketHeader packetHeader;
     ReturnOnFailure(packetHeader.DecodeAndConsume(msg));
@@ -838,6 +844,7 @@ void SessionManager::UnauthenticatedMessageDispatch(const PacketHeader & partial
                       packetHeader.GetMessageCounter(), ChipLogValueExchangeIdFromReceivedHeader(payloadHeader));
         isDuplicate = SessionMessageDelegate::DuplicateMessage::Yes;
         err         = CHIP_NO_ERROR;
+        mMessageStats.duplicateMessagesReceived++;
     }
     else
     {
@@ -852,7 +859,7 @@ void SessionManager::UnauthenticatedMessageDispatch(const PacketHeader & partial
                                     messageTotalSize);
 
         CHIP_TRACE_MESSAGE_RECEIVED(payloadHeader, packetHeader, unsecuredSession, peerAddress, msg->Start(), msg->TotalLength());
-        CountMessagesReceived(session, payloadHeader);
+        CountMessagesReceived(session, payloadHeader, messageTotalSize);
         mCB->OnMessageReceived(packetHeader, payloadHeader, session, isDuplicate, std::move(msg));
     }
     else
@@ -867,8 +874,6 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
 {
     MATTER_TRACE_SCOPE("Secure Unicast Message Dispatch", "SessionManager");
 
-    CHIP_ERROR err = CHIP_NO_ERROR;
-
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     if (peerAddress.GetTransportType() == Transport::Type::kTcp && ctxt->conn.IsNull())
     {
@@ -913,7 +918,7 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     }
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
     // Capture length before consuming headers.
-    [[maybe_unused]] size_t messageTotalSize = msg->TotalLength();
+    size_t messageTotalSize = msg->TotalLength();
 
     PayloadHeader payloadHeader;
 
@@ -927,8 +932,6 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     PacketHeader packetHeader;
     ReturnOnFailure(packetHeader.DecodeAndConsume(msg));
 
-    SessionMessageDelegate::DuplicateMessage isDuplicate = SessionMessageDelegate::DuplicateMessage::No;
-
     if (msg.IsNull())
     {
         ChipLogError(Inet, "Secure transport received Unicast NULL packet, discarding");
@@ -955,14 +958,95 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     CHIP_ERROR nonceResult = CryptoContext::BuildNonce(
         nonce, packetHeader.GetSecurityFlags(), packetHeader.GetMessageCounter(),
         secureSession->GetSecureSessionType() == SecureSession::Type::kCASE ? secureSession->GetPeerNodeId() : kUndefinedNodeId);
-    if ((nonceResult != CHIP_NO_ERROR) ||
-        SecureMessageCodec::Decrypt(secureSession->GetCryptoContext(), nonce, payloadHeader, packetHeader, msg) != CHIP_NO_ERROR)
+    if (nonceResult != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Secure transport received message, but failed to decode/authenticate it, discarding");
+        mMessageStats.decryptionFailures++;
+        return;
+    }
+
+    if (mDecryptOffload != nullptr)
+    {
+        auto pending = Platform::MakeUnique<PendingSecureUnicastMessage>(*this, *secureSession);
+        if (pending)
+        {
+            pending->mPeerAddress      = peerAddress;
+            pending->mPacketHeader     = packetHeader;
+            pending->mNonce            = nonce;
+            pending->mMsg              = std::move(msg);
+            pending->mMessageTotalSize = messageTotalSize;
+            pending->mQueuedAt         = System::SystemClock().GetMonotonicMicroseconds64();
+            if (mDecryptOffload->Offload(std::move(pending)) != CHIP_NO_ERROR)
+            {
+                pending->Decrypt();
+                OnPendingSecureUnicastMessageDecrypted(*pending);
+            }
+            return;
+        }
+    }
+
+    if (SecureMessageCodec::Decrypt(secureSession->GetCryptoContext(), nonce, payloadHeader, packetHeader, msg) != CHIP_NO_ERROR)
     {
         ChipLogError(Inet, "Secure transport received message, but failed to decode/authenticate it, discarding");
+        mMessageStats.decryptionFailures++;
         return;
     }
 
-    err =
+    SecureUnicastMessageDecrypted(session.Value(), peerAddress, packetHeader, payloadHeader, std::move(msg), messageTotalSize);
+}
+
+void PendingSecureUnicastMessage::Decrypt()
+{
+    mDecryptResult = SecureMessageCodec::Decrypt(mSession->AsSecureSession()->GetCryptoContext(), mNonce, mPayloadHeader,
+                                                 mPacketHeader, mMsg);
+}
+
+void PendingSecureUnicastMessage::Complete(Platform::UniquePtr<PendingSecureUnicastMessage> && message)
+{
+    message->mSessionManager.OnPendingSecureUnicastMessageDecrypted(*message);
+    message.reset();
+}
+
+void SessionManager::OnPendingSecureUnicastMessageDecrypted(PendingSecureUnicastMessage & message)
+{
+    VerifyOrReturn(mState == State::kInitialized);
+
+    uint64_t queueDelayUs = (System::SystemClock().GetMonotonicMicroseconds64() - message.mQueuedAt).count();
+    mMessageStats.queuedDecryptions++;
+    mMessageStats.totalDecryptionQueueDelayUs += queueDelayUs;
+    if (queueDelayUs > mMessageStats.maxDecryptionQueueDelayUs)
+    {
+        mMessageStats.maxDecryptionQueueDelayUs = static_cast<uint32_t>(std::min<uint64_t>(queueDelayUs, UINT32_MAX));
+    }
+
+    if (message.mDecryptResult != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Secure transport received message, but failed to decode/authenticate it, discarding");
+        mMessageStats.decryptionFailures++;
+        return;
+    }
+
+    // The session may have moved on while the message was being decrypted.
+    Transport::SecureSession * secureSession = message.mSession->AsSecureSession();
+    if (!secureSession->IsDefunct() && !secureSession->IsActiveSession() && !secureSession->IsPendingEviction())
+    {
+        ChipLogError(Inet, "Secure transport received message on a session in an invalid state (state = '%s')",
+                     secureSession->GetStateStr());
+        return;
+    }
+
+    SecureUnicastMessageDecrypted(message.mSession, message.mPeerAddress, message.mPacketHeader, message.mPayloadHeader,
+                                  std::move(message.mMsg), message.mMessageTotalSize);
+}
+
+void SessionManager::SecureUnicastMessageDecrypted(const SessionHandle & session, const Transport::PeerAddress & peerAddress,
+                                                   const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                                   System::PacketBufferHandle && msg, size_t messageTotalSize)
+{
+    Transport::SecureSession * secureSession             = session->AsSecureSession();
+    SessionMessageDelegate::DuplicateMessage isDuplicate = SessionMessageDelegate::DuplicateMessage::No;
+
+    CHIP_ERROR err =
         secureSession->GetSessionMessageCounter().GetPeerMessageCounter().VerifyEncryptedUnicast(packetHeader.GetMessageCounter());
     if (err == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED)
     {
@@ -972,6 +1056,7 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
                       packetHeader.GetMessageCounter(), ChipLogValueExchangeIdFromReceivedHeader(payloadHeader));
         isDuplicate = SessionMessageDelegate::DuplicateMessage::Yes;
         err         = CHIP_NO_ERROR;
+        mMessageStats.duplicateMessagesReceived++;
     }
     if (err != CHIP_NO_ERROR)
     {
@@ -1008,8 +1093,8 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
                                                              mFabricTable->GetPendingNewFabricIndex());
         }
 
-        CountMessagesReceived(session.Value(), payloadHeader);
-        mCB->OnMessageReceived(packetHeader, payloadHeader, session.Value(), isDuplicate, std::move(msg));
+        CountMessagesReceived(session, payloadHeader, messageTotalSize);
+        mCB->OnMessageReceived(packetHeader, payloadHeader, session, isDuplicate, std::move(msg));
     }
     else
     {
@@ -1080,7 +1165,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
     MATTER_TRACE_SCOPE("Group Message Dispatch", "SessionManager");
 
     // Capture length before consuming headers.
-    [[maybe_unused]] size_t messageTotalSize = msg->TotalLength();
+    size_t messageTotalSize = msg->TotalLength();
 
     PayloadHeader payloadHeader;
     PacketHeader packetHeaderCopy; /// Packet header decoded per group key, with privacy decrypted fields
@@ -1159,6 +1244,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
     if (!decrypted)
     {
         ChipLogError(Inet, "Failed to decrypt group message. Discarding everything");
+        mMessageStats.decryptionFailures++;
         return;
     }
     msg = std::move(msgCopy);
@@ -1211,6 +1297,10 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
         {
             // Exit now, since Group Messages don't have acks or responses of any kind.
             ChipLogError(Inet, "Message counter verify failed, err = %" CHIP_ERROR_FORMAT, err.Format());
+            if (err == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED)
+            {
+                mMessageStats.duplicateMessagesReceived++;
+            }
             return;
         }
     }
@@ -1236,7 +1326,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
         CHIP_TRACE_MESSAGE_RECEIVED(payloadHeader, packetHeaderCopy, &groupSession, peerAddress, msg->Start(), msg->TotalLength());
         SessionHandle session(groupSession);
 
-        CountMessagesReceived(session, payloadHeader);
+        CountMessagesReceived(session, payloadHeader, messageTotalSize);
         mCB->OnMessageReceived(packetHeaderCopy, payloadHeader, session, SessionMessageDelegate::DuplicateMessage::No,
                                std::move(msg));
     }
@@ -1255,16 +1345,16 @@ Optional<SessionHandle> SessionManager::FindSecureSessionForNode(ScopedNodeId pe
     SecureSession * tcpSession = nullptr;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-    mSecureSessions.ForEachSession([&peerNodeId, &type, &mrpSession,
+    mSecureSessions.ForEachSessionOnPeer(peerNodeId, [&type, &mrpSession,
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &tcpSession,
+                                                      &tcpSession,
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &transportPayloadCapability](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == peerNodeId &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+                                                      &transportPayloadCapability](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             if (transportPayloadCapability == TransportPayloadCapability::kMRPOrTCPCompatiblePayload ||
-                transportPayloadCapability == TransportPayloadCapability::kLargePayload)
+                transportPayloadCapability == TransportPayloadCapability::kLargePayload ||
+                transportPayloadCapability == TransportPayloadCapability::kLargePayloadIfSupported)
             {
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
                 // Set up a TCP transport based session as standby
@@ -1286,7 +1376,10 @@ Optional<SessionHandle> SessionManager::FindSecureSessionForNode(ScopedNodeId pe
     });
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
-    if (transportPayloadCapability == TransportPayloadCapability::kLargePayload)
+    // Whether the peer supports a large payload transport is only known once its address is resolved, so a session over MRP
+    // is not returned for kLargePayloadIfSupported.
+    if (transportPayloadCapability == TransportPayloadCapability::kLargePayload ||
+        transportPayloadCapability == TransportPayloadCapability::kLargePayloadIfSupported)
     {
         return tcpSession != nullptr ? MakeOptional<SessionHandle>(*tcpSession) : Optional<SessionHandle>::Missing();
     }
@@ -1350,21 +1443,23 @@ void SessionManager::MarkSecureSessionOverTCPForEviction(Transport::ActiveTCPCon
 }
 
 // Session handle parameter included here for future counting usage.
-void SessionManager::CountMessagesReceived(const SessionHandle &, const PayloadHeader & payloadHeader)
+void SessionManager::CountMessagesReceived(const SessionHandle &, const PayloadHeader & payloadHeader, size_t messageSize)
 {
     if (payloadHeader.GetProtocolID() == Protocols::InteractionModel::Id)
     {
         mMessageStats.interactionModelMessagesReceived++;
     }
+    mMessageTypeStats.CountReceived(payloadHeader.GetProtocolID(), payloadHeader.GetMessageType(), messageSize);
 }
 
 // Session handle parameter included here for future counting usage.
-void SessionManager::CountMessagesSent(const SessionHandle &, const PayloadHeader & payloadHeader)
+void SessionManager::CountMessagesSent(const SessionHandle &, const PayloadHeader & payloadHeader, size_t messageSize)
 {
     if (payloadHeader.GetProtocolID() == Protocols::InteractionModel::Id)
     {
         mMessageStats.interactionModelMessagesSent++;
     }
+    mMessageTypeStats.CountSent(payloadHeader.GetProtocolID(), payloadHeader.GetMessageType(), messageSize);
 }
 
 } // namespace chip
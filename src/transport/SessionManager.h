@@ -33,6 +33,7 @@
 #include <inet/IPAddress.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
@@ -72,10 +73,14 @@ enum class TransportPayloadCapability : uint8_t
     kLargePayload,             // Transport needs to handle payloads larger than the single IPv6
                                // packet, as supported by MRP. The transport of choice, in this
                                // case, is TCP.
-    kMRPOrTCPCompatiblePayload // This option provides the ability to use MRP
-                               // as the preferred transport, but use a large
-                               // payload transport if that is already
-                               // available.
+    kMRPOrTCPCompatiblePayload, // This option provides the ability to use MRP
+                                // as the preferred transport, but use a large
+                                // payload transport if that is already
+                                // available.
+    kLargePayloadIfSupported    // This option prefers a large payload transport,
+                                // which is used if already available or if the
+                                // peer supports it, and falls back to MRP
+                                // otherwise.
 };
 /**
  * @brief
@@ -144,6 +149,76 @@ private:
     EncryptedPacketBufferHandle(PacketBufferHandle && aBuffer) : PacketBufferHandle(std::move(aBuffer)) {}
 };
 
+class SessionManager;
+
+/**
+ * @brief
+ *  A secure unicast message whose packet header has been decoded and whose session has been looked up, waiting
+ *  to be decrypted on behalf of a SecureMessageDecryptOffload.
+ */
+class PendingSecureUnicastMessage
+{
+public:
+    PendingSecureUnicastMessage(SessionManager & sessionManager, Transport::SecureSession & session) :
+        mSessionManager(sessionManager), mSession(session)
+    {}
+
+    /**
+     * Decrypt and authenticate the message in place.  This only touches the message itself and the keys of its
+     * session, so it can be called on any thread, as long as the session keystore is thread-safe.
+     */
+    void Decrypt();
+
+    /**
+     * Identifies the session the message was received on.  Messages with the same key must be handed back in the
+     * order they were offloaded.
+     */
+    const void * GetSessionKey() const { return mSession.operator->(); }
+
+    /**
+     * Hand a decrypted message back to the SessionManager that received it, for message counter verification and
+     * dispatch.  Must be called on the Matter thread.
+     */
+    static void Complete(Platform::UniquePtr<PendingSecureUnicastMessage> && message);
+
+private:
+    friend class SessionManager;
+
+    SessionManager & mSessionManager;
+    // Keeps the session, and so its keys, alive until the message has been dispatched.  Only ever retained and
+    // released on the Matter thread.
+    SessionHandle mSession;
+    Transport::PeerAddress mPeerAddress;
+    PacketHeader mPacketHeader;
+    PayloadHeader mPayloadHeader;
+    CryptoContext::NonceStorage mNonce;
+    System::PacketBufferHandle mMsg;
+    size_t mMessageTotalSize                = 0;
+    CHIP_ERROR mDecryptResult               = CHIP_ERROR_INCORRECT_STATE;
+    System::Clock::Microseconds64 mQueuedAt = System::Clock::kZero;
+};
+
+/**
+ * @brief
+ *  Takes the decryption of secure unicast messages off the Matter thread, e.g. to spread it over several cores on a
+ *  controller with many CASE sessions.
+ */
+class SecureMessageDecryptOffload
+{
+public:
+    virtual ~SecureMessageDecryptOffload() = default;
+
+    /**
+     * Called on the Matter thread.  Arrange for message->Decrypt() to be called, on any thread, followed by
+     * PendingSecureUnicastMessage::Complete on the Matter thread.  Messages with the same session key must be
+     * completed in the order they were offloaded.
+     *
+     * Returns an error if that is not possible, in which case `message` must be left untouched: it is then
+     * decrypted inline.
+     */
+    virtual CHIP_ERROR Offload(Platform::UniquePtr<PendingSecureUnicastMessage> && message) = 0;
+};
+
 class DLL_EXPORT SessionManager : public TransportMgrDelegate, public FabricTable::Delegate
 {
 public:
@@ -175,6 +250,14 @@ public:
     /// ExchangeManager)
     void SetMessageDelegate(SessionMessageDelegate * cb) { mCB = cb; }
 
+    /**
+     * @brief Set where secure unicast messages get decrypted; nullptr (the default) decrypts them inline.
+     *
+     * Every message handed to the offload must have been completed before this SessionManager is destroyed.
+     * Messages completed after Shutdown() are dropped.
+     */
+    void SetDecryptOffload(SecureMessageDecryptOffload * offload) { mDecryptOffload = offload; }
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     void SetConnectionDelegate(SessionConnectionDelegate * cb) { mConnDelegate = cb; }
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
@@ -217,12 +300,8 @@ public:
     template <typename Function>
     void ForEachMatchingSession(const ScopedNodeId & node, Function && function)
     {
-        mSecureSessions.ForEachSession([&](auto * session) {
-            if (session->GetPeer() == node)
-            {
-                function(session);
-            }
-
+        mSecureSessions.ForEachSessionOnPeer(node, [&](auto * session) {
+            function(session);
             return Loop::Continue;
         });
     }
@@ -234,12 +313,8 @@ public:
     template <typename Function>
     void ForEachMatchingSession(FabricIndex fabricIndex, Function && function)
     {
-        mSecureSessions.ForEachSession([&](auto * session) {
-            if (session->GetFabricIndex() == fabricIndex)
-            {
-                function(session);
-            }
-
+        mSecureSessions.ForEachSessionOnFabric(fabricIndex, [&](auto * session) {
+            function(session);
             return Loop::Continue;
         });
     }
@@ -532,7 +607,19 @@ public:
 
     MessageStats GetMessageStats() const { return mMessageStats; }
 
+    /**
+     * Copy the per-message-type counters into the given snapshot.
+     */
+    void GetMessageTypeStats(MessageTypeStatsTable & snapshot) const { snapshot = mMessageTypeStats; }
+
+    /**
+     * Record that a reliable message was retransmitted.
+     */
+    void CountRetransmission() { mMessageStats.retransmissions++; }
+
 private:
+    friend class PendingSecureUnicastMessage;
+
     /**
      *    The State of a secure transport object.
      */
@@ -556,6 +643,7 @@ private:
     State mState; // < Initialization state of the object
     chip::Transport::GroupOutgoingCounters mGroupClientCounter;
     MessageStats mMessageStats;
+    MessageTypeStatsTable mMessageTypeStats;
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     OnTCPConnectionReceivedCallback mConnReceivedCb = nullptr;
@@ -568,6 +656,7 @@ private:
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
     SessionMessageDelegate * mCB = nullptr;
+    SecureMessageDecryptOffload * mDecryptOffload = nullptr;
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     SessionConnectionDelegate * mConnDelegate = nullptr;
@@ -591,6 +680,15 @@ private:
     void SecureUnicastMessageDispatch(const PacketHeader & partialPacketHeader, const Transport::PeerAddress & peerAddress,
                                       System::PacketBufferHandle && msg, Transport::MessageTransportContext * ctxt = nullptr);
 
+    /**
+     * @brief Validate the message counter of a decrypted secure unicast message and dispatch it.
+     */
+    void SecureUnicastMessageDecrypted(const SessionHandle & session, const Transport::PeerAddress & peerAddress,
+                                       const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                       System::PacketBufferHandle && msg, size_t messageTotalSize);
+
+    void OnPendingSecureUnicastMessageDecrypted(PendingSecureUnicastMessage & message);
+
     /**
      * @brief Parse, decrypt, validate, and dispatch a secure group message.
      *
@@ -625,8 +723,8 @@ private:
             payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::MsgCounterSyncRsp);
     }
 
-    void CountMessagesReceived(const SessionHandle & sessionHandle, const PayloadHeader & payloadHeader);
-    void CountMessagesSent(const SessionHandle & sessionHandle, const PayloadHeader & payloadHeader);
+    void CountMessagesReceived(const SessionHandle & sessionHandle, const PayloadHeader & payloadHeader, size_t messageSize);
+    void CountMessagesSent(const SessionHandle & sessionHandle, const PayloadHeader & payloadHeader, size_t messageSize);
 };
 
 namespace MessagePacketBuffer {
@@ -62,10 +62,10 @@ public:
 
     System::Clock::Timestamp GetLastActivityTime() const { return mLastActivityTime; }
     System::Clock::Timestamp GetLastPeerActivityTime() const { return mLastPeerActivityTime; }
-    void MarkActive() { mLastActivityTime = System::SystemClock().GetMonotonicTimestamp(); }
+    void MarkActive() { mLastActivityTime = System::SystemClock().GetCachedMonotonicTimestamp(); }
     void MarkActiveRx()
     {
-        mLastPeerActivityTime = System::SystemClock().GetMonotonicTimestamp();
+        mLastPeerActivityTime = System::SystemClock().GetCachedMonotonicTimestamp();
         MarkActive();
     }
 
@@ -145,11 +145,19 @@ ActiveTCPConnectionState * TCPBase::AllocateConnection(const Inet::TCPEndPointHa
             if (!activeConnection->InUse() && (activeConnection->GetReferenceCount() == 0))
             {
                 // Update state for the active connection
-                activeConnection->Init(endpoint, address, [this](auto & conn) { TCPDisconnect(conn, true); });
+                activeConnection->Init(endpoint, address, [this](auto & conn) { ReleaseConnection(conn); });
+                activeConnection->mTCPKeepAliveIntervalSecs = mKeepAliveIntervalSecs;
+                activeConnection->mTCPMaxNumKeepAliveProbes = mMaxNumKeepAliveProbes;
                 return activeConnection;
             }
         }
 
+        // Out of space; make room by closing a connection kept open while idle, if any.
+        if (reclaim == 0 && CloseIdleConnection())
+        {
+            continue;
+        }
+
         // Out of space; reclaim connections that were never claimed by ProcessSingleMessage
         // (i.e. that have a ref count of 0)
         for (size_t i = 0; i < mActiveConnectionsSize; i++)
@@ -286,12 +294,9 @@ CHIP_ERROR TCPBase::StartConnect(const PeerAddress & addr, Transport::AppTCPConn
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     Inet::TCPEndPointHandle endPoint;
     outPeerConnState.Release();
-    ReturnErrorOnFailure(mListenSocket->GetEndPointManager().NewEndPoint(endPoint));
-
-    InitEndpoint(endPoint);
 
     ActiveTCPConnectionHandle activeConnection = FindInUseConnection(addr);
-    // Re-use existing connection to peer if already connected
+    // Re-use existing connection to peer if already connected, including a connection kept open while idle
     if (!activeConnection.IsNull())
     {
         if (appState != nullptr)
@@ -312,6 +317,11 @@ CHIP_ERROR TCPBase::StartConnect(const PeerAddress & addr, Transport::AppTCPConn
         return CHIP_NO_ERROR;
     }
 
+    VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize || CloseIdleConnection(), CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(mListenSocket->GetEndPointManager().NewEndPoint(endPoint));
+
+    InitEndpoint(endPoint);
+
     activeConnection = AllocateConnection(endPoint, addr);
     VerifyOrReturnError(!activeConnection.IsNull(), CHIP_ERROR_NO_MEMORY);
     activeConnection->mAppState        = appState;
@@ -426,20 +436,51 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
     // `state->mReceived->Start()` currently points to the message data.
     // On exit, `state->mReceived` will have had `messageSize` bytes consumed, no matter what.
     System::PacketBufferHandle message;
+    const size_t headLength = state.mReceived->DataLength();
 
-    if (state.mReceived->DataLength() == messageSize)
+    if (headLength == messageSize)
     {
         // In this case, the head packet buffer contains exactly the message.
         // This is common because typical messages fit in a network packet, and are delivered as such.
         // Peel off the head to pass upstream, which effectively consumes it from `state->mReceived`.
         message = state.mReceived.PopHead();
     }
-    else
+    else if (headLength > messageSize)
     {
-        // The message is either longer or shorter than the head buffer.
-        // In either case, copy the message to a fresh linear buffer to pass upstream. We always copy, rather than provide
-        // a shared reference to the current buffer, in case upper layers manipulate the buffer in ways that would affect
-        // our use, e.g. chaining it elsewhere or reusing space beyond the current message.
+        // The head buffer holds the message followed by the start of the next one. When that remainder is the smaller
+        // part, move it to a fresh buffer and pass the head buffer upstream, instead of copying the message out.
+        const size_t remainderLength = headLength - messageSize;
+        if (remainderLength < messageSize)
+        {
+            System::PacketBufferHandle remainder = System::PacketBufferHandle::New(remainderLength, 0);
+            if (!remainder.IsNull())
+            {
+                memcpy(remainder->Start(), state.mReceived->Start() + messageSize, remainderLength);
+                remainder->SetDataLength(remainderLength);
+                message = state.mReceived.PopHead();
+                message->SetDataLength(messageSize);
+                remainder.AddToEnd(std::move(state.mReceived));
+                state.mReceived = std::move(remainder);
+            }
+        }
+    }
+    else if (state.mReceived->AvailableDataLength() >= messageSize - headLength)
+    {
+        // The head buffer only holds the start of the message, but has room for the rest of it (e.g. a large receive
+        // buffer the endpoint had not filled). Only pull the missing bytes into it, rather than copying the whole message.
+        message                    = state.mReceived.PopHead();
+        const size_t missingLength = messageSize - headLength;
+        CHIP_ERROR err             = state.mReceived->Read(message->Start() + headLength, missingLength);
+        state.mReceived.Consume(missingLength);
+        ReturnErrorOnFailure(err);
+        message->SetDataLength(messageSize);
+    }
+
+    if (message.IsNull())
+    {
+        // Copy the message to a fresh linear buffer to pass upstream. We always either copy or hand over a buffer we
+        // own entirely, rather than provide a shared reference to the current buffer, in case upper layers manipulate the
+        // buffer in ways that would affect our use, e.g. chaining it elsewhere or reusing space beyond the current message.
         message = System::PacketBufferHandle::New(messageSize, 0);
         if (message.IsNull())
         {
@@ -469,6 +510,7 @@ void TCPBase::CloseConnectionInternal(ActiveTCPConnectionState & connection, CHI
     ChipLogProgress(Inet, "Closing connection with peer %s.", addrStr);
 
     Inet::TCPEndPointHandle endpoint = connection.mEndPoint;
+    endpoint->GetSystemLayer().CancelTimer(HandleIdleConnectionTimeout, &connection);
     connection.mEndPoint.Release();
     if (err == CHIP_NO_ERROR)
     {
@@ -690,8 +732,6 @@ CHIP_ERROR TCPBase::TCPConnect(const PeerAddress & address, Transport::AppTCPCon
     // Verify that PeerAddress AddressType is TCP
     VerifyOrReturnError(address.GetTransportType() == Transport::Type::kTcp, CHIP_ERROR_INVALID_ARGUMENT);
 
-    VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize, CHIP_ERROR_NO_MEMORY);
-
     char addrStr[Transport::PeerAddress::kMaxToStringSize];
     address.ToString(addrStr);
     ChipLogProgress(Inet, "Connecting to peer %s.", addrStr);
@@ -719,6 +759,48 @@ void TCPBase::TCPDisconnect(ActiveTCPConnectionState & conn, bool shouldAbort)
     }
 }
 
+void TCPBase::ReleaseConnection(ActiveTCPConnectionState & conn)
+{
+    if (conn.GetReferenceCount() == 0 && conn.IsConnected() && mIdleConnectionTimeout > System::Clock::kZero)
+    {
+        // Nothing uses the connection anymore; keep it open for a while so that a new session with the peer can reuse it.
+        CHIP_ERROR err = conn.mEndPoint->GetSystemLayer().StartTimer(mIdleConnectionTimeout, HandleIdleConnectionTimeout, &conn);
+        if (err == CHIP_NO_ERROR)
+        {
+            return;
+        }
+    }
+
+    TCPDisconnect(conn, true);
+}
+
+void TCPBase::HandleIdleConnectionTimeout(System::Layer * layer, void * context)
+{
+    auto & conn = *static_cast<ActiveTCPConnectionState *>(context);
+
+    // The connection may have been reused since the timer was started.
+    VerifyOrReturn(conn.GetReferenceCount() == 0 && conn.IsConnected());
+
+    TCPBase * tcp = reinterpret_cast<TCPBase *>(conn.mEndPoint->mAppState);
+    tcp->CloseConnectionInternal(conn, CHIP_NO_ERROR, SuppressCallback::Yes);
+}
+
+bool TCPBase::CloseIdleConnection()
+{
+    VerifyOrReturnValue(mIdleConnectionTimeout > System::Clock::kZero, false);
+
+    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    {
+        auto & conn = mActiveConnections[i];
+        if (conn.GetReferenceCount() == 0 && conn.IsConnected())
+        {
+            CloseConnectionInternal(conn, CHIP_NO_ERROR, SuppressCallback::Yes);
+            return true;
+        }
+    }
+    return false;
+}
+
 bool TCPBase::HasActiveConnections() const
 {
     for (size_t i = 0; i < mActiveConnectionsSize; i++)
@@ -149,6 +149,26 @@ public:
      */
     void SetConnectTimeout(const uint32_t connTimeoutMsecs) { mConnectTimeout = connTimeoutMsecs; }
 
+    /**
+     * Set the TCP keepalive configuration for the connections established
+     * or accepted from now on.
+     *
+     */
+    void SetKeepAlive(uint16_t intervalSecs, uint16_t maxNumProbes)
+    {
+        mKeepAliveIntervalSecs = intervalSecs;
+        mMaxNumKeepAliveProbes = maxNumProbes;
+    }
+
+    /**
+     * Set how long a connection that is not referenced anymore is kept open
+     * before being closed.  While it is open, a TCPConnect to the same peer
+     * address reuses it, without a new TCP handshake.  Zero closes such
+     * connections right away.
+     *
+     */
+    void SetIdleConnectionTimeout(System::Clock::Timeout timeout) { mIdleConnectionTimeout = timeout; }
+
     /**
      * Close the open endpoint without destroying the object
      */
@@ -275,6 +295,19 @@ private:
     // and release from the pool.
     void TCPDisconnect(ActiveTCPConnectionState & conn, bool shouldAbort = false);
 
+    // Called when the last reference to a connection is released.  Keeps
+    // the connection open for mIdleConnectionTimeout, or disconnects it.
+    void ReleaseConnection(ActiveTCPConnectionState & conn);
+
+    // Closes a connection that has not been reused before its idle timeout.
+    static void HandleIdleConnectionTimeout(System::Layer * layer, void * context);
+
+    /**
+     * Close a connected connection that is not referenced anymore, to make
+     * room for a new one.  Returns false if there is none.
+     */
+    bool CloseIdleConnection();
+
     /**
      * Gracefully Close or Abort a given connection.
      *
@@ -319,6 +352,13 @@ private:
     // giving up.
     uint32_t mConnectTimeout = CHIP_CONFIG_TCP_CONNECT_TIMEOUT_MSECS;
 
+    // Keepalive configuration applied to new connections.
+    uint16_t mKeepAliveIntervalSecs = CHIP_CONFIG_TCP_KEEPALIVE_INTERVAL_SECS;
+    uint16_t mMaxNumKeepAliveProbes = CHIP_CONFIG_MAX_TCP_KEEPALIVE_PROBES;
+
+    // How long connections that are not referenced anymore are kept open.
+    System::Clock::Timeout mIdleConnectionTimeout = System::Clock::Seconds16(CHIP_CONFIG_TCP_IDLE_CONNECTION_TIMEOUT_SECS);
+
     // Number of active and 'pending connection' endpoints
     size_t mUsedEndPointCount = 0;
 
@@ -103,6 +103,20 @@ namespace chip {
 #define CHIP_CONFIG_MAX_TCP_KEEPALIVE_PROBES (5)
 #endif // CHIP_CONFIG_MAX_TCP_KEEPALIVE_PROBES
 
+/**
+ *  @def CHIP_CONFIG_TCP_IDLE_CONNECTION_TIMEOUT_SECS
+ *
+ *  @brief
+ *    This defines the default time (in seconds) for which a TCP
+ *    connection that no session uses anymore is kept open, so that
+ *    a new session with the same peer can reuse it instead of
+ *    connecting again.  0 closes such connections right away.
+ *
+ */
+#ifndef CHIP_CONFIG_TCP_IDLE_CONNECTION_TIMEOUT_SECS
+#define CHIP_CONFIG_TCP_IDLE_CONNECTION_TIMEOUT_SECS (0)
+#endif // CHIP_CONFIG_TCP_IDLE_CONNECTION_TIMEOUT_SECS
+
 /**
  *  @def CHIP_CONFIG_MAX_UNACKED_DATA_TIMEOUT_SECS
  *
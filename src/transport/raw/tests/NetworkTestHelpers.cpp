@@ -24,6 +24,8 @@
 #include <lib/support/CodeUtils.h>
 #include <platform/CHIPDeviceLayer.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Testing {
 
@@ -75,5 +77,43 @@ void IOContext::DriveIOUntil(System::Clock::Timeout maxWait, std::function<bool(
     }
 }
 
+bool IOContext::DriveIOUntilInSimulatedTime(System::Clock::Internal::MockClock & clock, System::Clock::Timeout maxWait,
+                                            std::function<bool(void)> completionFunction)
+{
+    VerifyOrDie(&System::SystemClock() == &clock);
+
+    const System::Clock::Timestamp endTime = clock.GetMonotonicTimestamp() + maxWait;
+
+    while (true)
+    {
+        // Services the timers and work due now, without waiting.
+        ServiceEvents(0);
+
+        if (completionFunction())
+        {
+            return true;
+        }
+
+        const System::Clock::Timestamp now = clock.GetMonotonicTimestamp();
+        System::Clock::Timestamp next      = now + kSimulatedTimeStep;
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH
+        if (!gSystemLayer.GetEarliestTimerAwakenTime(next))
+        {
+            // Nothing left to happen until the end.
+            next = endTime;
+        }
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH
+
+        if (now >= endTime)
+        {
+            return false;
+        }
+        if (next > now)
+        {
+            clock.SetMonotonic(std::min(next, endTime));
+        }
+    }
+}
+
 } // namespace Testing
 } // namespace chip
@@ -22,6 +22,7 @@
 #include <inet/UDPEndPoint.h>
 #include <lib/core/CHIPError.h>
 #include <lib/support/CodeUtils.h>
+#include <system/SystemClock.h>
 #include <system/SystemLayer.h>
 #include <system/SystemPacketBuffer.h>
 #include <transport/raw/Base.h>
@@ -49,11 +50,30 @@ public:
     /// completionFunction returns true
     void DriveIOUntil(System::Clock::Timeout maxWait, std::function<bool(void)> completionFunction);
 
+    /// Drive IO in simulated time, with `clock` installed as the system clock: every iteration
+    /// services the events that are due without sleeping, then advances `clock` straight to the
+    /// next timer.  Stops once completionFunction returns true, or once `clock` advanced by maxWait,
+    /// with the events due by then serviced.  This runs the timers of minutes of MRP or reporting
+    /// activity in milliseconds of real time.
+    ///
+    /// @return true if completionFunction returned true
+    bool DriveIOUntilInSimulatedTime(System::Clock::Internal::MockClock & clock, System::Clock::Timeout maxWait,
+                                     std::function<bool(void)> completionFunction);
+
+    /// Drive IO in simulated time until `clock` advanced by `duration`, see DriveIOUntilInSimulatedTime.
+    void DriveIOInSimulatedTime(System::Clock::Internal::MockClock & clock, System::Clock::Timeout duration)
+    {
+        DriveIOUntilInSimulatedTime(clock, duration, [] { return false; });
+    }
+
     System::Layer & GetSystemLayer() { return *mSystemLayer; }
     Inet::EndPointManager<Inet::TCPEndPoint> * GetTCPEndPointManager() { return mTCPEndPointManager; }
     Inet::EndPointManager<Inet::UDPEndPoint> * GetUDPEndPointManager() { return mUDPEndPointManager; }
 
 private:
+    // How far DriveIOUntilInSimulatedTime advances the clock when the system layer does not expose its next timer.
+    static constexpr System::Clock::Milliseconds32 kSimulatedTimeStep{ 10 };
+
     System::Layer * mSystemLayer                                   = nullptr;
     Inet::EndPointManager<Inet::TCPEndPoint> * mTCPEndPointManager = nullptr;
     Inet::EndPointManager<Inet::UDPEndPoint> * mUDPEndPointManager = nullptr;
@@ -0,0 +1,155 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "SimulatedNetwork.h"
+
+#include <inet/IPAddress.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace Testing {
+
+CHIP_ERROR SimulatedNetwork::Interface::SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf)
+{
+    VerifyOrReturnError(mNetwork != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mNetwork->Send(*this, address, std::move(msgBuf));
+}
+
+void SimulatedNetwork::Interface::Close()
+{
+    if (mNetwork != nullptr)
+    {
+        mNetwork->Detach(*this);
+    }
+}
+
+void SimulatedNetwork::Init(System::Layer & systemLayer)
+{
+    mSystemLayer               = &systemLayer;
+    mMessagesToDrop            = 0;
+    mSentMessageCount          = 0;
+    mDroppedMessageCount       = 0;
+    mUndeliverableMessageCount = 0;
+}
+
+void SimulatedNetwork::Shutdown()
+{
+    if (mDeliveryScheduled)
+    {
+        mSystemLayer->CancelTimer(DeliverMessages, this);
+        mDeliveryScheduled = false;
+    }
+    mPendingMessages.clear();
+
+    for (auto & entry : mInterfaces)
+    {
+        entry.second->mNetwork = nullptr;
+    }
+    mInterfaces.clear();
+    mSystemLayer = nullptr;
+}
+
+CHIP_ERROR SimulatedNetwork::Attach(Interface & interface, uint16_t port)
+{
+    VerifyOrReturnError(mSystemLayer != nullptr && interface.mNetwork == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mInterfaces.find(port) == mInterfaces.end(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Inet::IPAddress address;
+    VerifyOrDie(Inet::IPAddress::FromString("::1", address));
+
+    interface.mNetwork = this;
+    interface.mAddress = Transport::PeerAddress::UDP(address, port);
+    mInterfaces[port]  = &interface;
+    return CHIP_NO_ERROR;
+}
+
+void SimulatedNetwork::Detach(Interface & interface)
+{
+    VerifyOrReturn(interface.mNetwork == this);
+
+    // Messages already sent by the interface are still delivered, but nothing is delivered to it anymore.
+    mInterfaces.erase(interface.mAddress.GetPort());
+    interface.mNetwork = nullptr;
+}
+
+CHIP_ERROR SimulatedNetwork::Send(const Interface & source, const Transport::PeerAddress & destination,
+                                  System::PacketBufferHandle && msgBuf)
+{
+    mSentMessageCount++;
+    if (mMessagesToDrop > 0)
+    {
+        mMessagesToDrop--;
+        mDroppedMessageCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    // The sender may still modify or reuse its buffer, as for a real transport.
+    System::PacketBufferHandle message = msgBuf.CloneData();
+    VerifyOrReturnError(!message.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    mPendingMessages.push_back({ source.GetAddress(), destination, std::move(message),
+                                 System::SystemClock().GetMonotonicTimestamp() + mLatency });
+    return ScheduleDelivery();
+}
+
+CHIP_ERROR SimulatedNetwork::ScheduleDelivery()
+{
+    VerifyOrReturnError(!mDeliveryScheduled && !mPendingMessages.empty(), CHIP_NO_ERROR);
+
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    System::Clock::Timestamp due = mPendingMessages.front().deliveryTime;
+    ReturnErrorOnFailure(mSystemLayer->StartTimer(due > now ? due - now : System::Clock::kZero, DeliverMessages, this));
+    mDeliveryScheduled = true;
+    return CHIP_NO_ERROR;
+}
+
+void SimulatedNetwork::DeliverMessages(System::Layer * systemLayer, void * appState)
+{
+    static_cast<SimulatedNetwork *>(appState)->DeliverMessages();
+}
+
+void SimulatedNetwork::DeliverMessages()
+{
+    mDeliveryScheduled = false;
+
+    // Only deliver what is due now: messages sent by the receivers are delivered in a later iteration.
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    size_t count                 = mPendingMessages.size();
+    while (count-- > 0 && mPendingMessages.front().deliveryTime <= now)
+    {
+        PendingMessage pending = std::move(mPendingMessages.front());
+        mPendingMessages.pop_front();
+
+        auto it = mInterfaces.find(pending.destination.GetPort());
+        if (it == mInterfaces.end())
+        {
+            mUndeliverableMessageCount++;
+            continue;
+        }
+        it->second->HandleMessageReceived(pending.source, std::move(pending.message));
+    }
+
+    CHIP_ERROR err = ScheduleDelivery();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Test, "Unable to schedule the delivery of simulated messages: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+} // namespace Testing
+} // namespace chip
@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/raw/Base.h>
+#include <transport/raw/PeerAddress.h>
+
+#include <deque>
+#include <map>
+
+namespace chip {
+namespace Testing {
+
+/**
+ * An in-process network connecting any number of transports, so that many nodes, each with its own
+ * SessionManager, can run in one test process on one system layer.
+ *
+ * Every attached Interface has a UDP address on ::1 with its own port.  Messages sent to an address
+ * are delivered to the interface attached with that port after the configured latency, through the
+ * system layer; messages to unknown ports are counted and dropped.
+ *
+ * Usage:
+ *
+ *      SimulatedNetwork network;
+ *      network.Init(systemLayer);
+ *      SimulatedNetwork::Interface interface;
+ *      network.Attach(interface, port);
+ *      transportMgr.Init(&interface);
+ *      ...
+ *      network.Detach(interface);
+ *      network.Shutdown();
+ */
+class SimulatedNetwork
+{
+public:
+    class Interface : public Transport::Base
+    {
+    public:
+        ~Interface() override { Close(); }
+
+        const Transport::PeerAddress & GetAddress() const { return mAddress; }
+
+        // Transport::Base overrides.
+        CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf) override;
+        bool CanSendToPeer(const Transport::PeerAddress & address) override
+        {
+            return mNetwork != nullptr && address.GetTransportType() == Transport::Type::kUdp;
+        }
+        void Close() override;
+
+    private:
+        friend class SimulatedNetwork;
+
+        SimulatedNetwork * mNetwork = nullptr;
+        Transport::PeerAddress mAddress;
+    };
+
+    SimulatedNetwork() = default;
+    ~SimulatedNetwork() { Shutdown(); }
+
+    SimulatedNetwork(const SimulatedNetwork &)             = delete;
+    SimulatedNetwork & operator=(const SimulatedNetwork &) = delete;
+
+    void Init(System::Layer & systemLayer);
+
+    /// Drop the messages in flight and detach every interface.
+    void Shutdown();
+
+    /// Attach `interface` with the address ::1 on `port`, which must be unused.
+    CHIP_ERROR Attach(Interface & interface, uint16_t port);
+    void Detach(Interface & interface);
+
+    /// Delay of every message, from its sending to its delivery.  Zero delivers on the next event loop iteration.
+    void SetLatency(System::Clock::Milliseconds32 latency) { mLatency = latency; }
+
+    /// Drop the next `count` messages sent, whatever their destination, e.g. to exercise MRP.
+    void DropNextMessages(uint32_t count) { mMessagesToDrop = count; }
+
+    bool HasPendingMessages() const { return !mPendingMessages.empty(); }
+
+    uint32_t GetSentMessageCount() const { return mSentMessageCount; }
+    uint32_t GetDroppedMessageCount() const { return mDroppedMessageCount; }
+    uint32_t GetUndeliverableMessageCount() const { return mUndeliverableMessageCount; }
+
+private:
+    struct PendingMessage
+    {
+        Transport::PeerAddress source;
+        Transport::PeerAddress destination;
+        System::PacketBufferHandle message;
+        System::Clock::Timestamp deliveryTime;
+    };
+
+    static void DeliverMessages(System::Layer * systemLayer, void * appState);
+
+    CHIP_ERROR Send(const Interface & source, const Transport::PeerAddress & destination, System::PacketBufferHandle && msgBuf);
+    void DeliverMessages();
+    CHIP_ERROR ScheduleDelivery();
+
+    System::Layer * mSystemLayer = nullptr;
+    System::Clock::Milliseconds32 mLatency{ 0 };
+    // Interfaces by port.
+    std::map<uint16_t, Interface *> mInterfaces;
+    // In order of delivery time, since all messages have the same latency.
+    std::deque<PendingMessage> mPendingMessages;
+    bool mDeliveryScheduled = false;
+
+    uint32_t mMessagesToDrop            = 0;
+    uint32_t mSentMessageCount          = 0;
+    uint32_t mDroppedMessageCount       = 0;
+    uint32_t mUndeliverableMessageCount = 0;
+};
+
+} // namespace Testing
+} // namespace chip
@@ -400,6 +400,34 @@ public:
         EXPECT_EQ(mHandleConnectionCloseCalled, nullptr);
     }
 
+    void IdleConnectionReuseTest(TCPImpl & tcp, const IPAddress & addr, uint16_t port)
+    {
+        tcp.SetIdleConnectionTimeout(chip::System::Clock::Seconds16(30));
+
+        CHIP_ERROR err = tcp.TCPConnect(Transport::PeerAddress::TCP(addr, port), nullptr, activeTCPConnState);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        ASSERT_TRUE(activeTCPConnState);
+
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5), [this]() { return mHandleConnectionCompleteCalled; });
+        ActiveTCPConnectionState * connection = &*activeTCPConnState;
+        EXPECT_EQ(mHandleConnectionCompleteCalled, connection);
+
+        // Releasing the last reference keeps the connection open, so connecting to the same peer reuses it: the
+        // connection attempt completes right away.
+        activeTCPConnState.Release();
+        mIOContext->DriveIO();
+        mHandleConnectionCompleteCalled = nullptr;
+
+        err = tcp.TCPConnect(Transport::PeerAddress::TCP(addr, port), nullptr, activeTCPConnState);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        ASSERT_TRUE(activeTCPConnState);
+        EXPECT_EQ(&*activeTCPConnState, connection);
+        EXPECT_EQ(mHandleConnectionCompleteCalled, connection);
+        EXPECT_EQ(mHandleConnectionCloseCalled, nullptr);
+
+        tcp.SetIdleConnectionTimeout(chip::System::Clock::kZero);
+    }
+
     void HandleConnLateFailureTest(TCPImpl & tcp, const IPAddress & addr, uint16_t port)
     {
         TCPBase::sForceFailureInDoHandleIncomingConnection = true;
@@ -678,6 +706,16 @@ protected:
         gMockTransportMgrDelegate.DisconnectTest(tcp);
     }
 
+    void IdleConnectionReuseTest(const IPAddress & addr)
+    {
+        TCPImpl tcp;
+        uint16_t port;
+        MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+        ASSERT_SUCCESS(gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, port));
+        gMockTransportMgrDelegate.IdleConnectionReuseTest(tcp, addr, port);
+        gMockTransportMgrDelegate.DisconnectTest(tcp);
+    }
+
     void HandleConnCloseTest(const IPAddress & addr)
     {
         TCPImpl tcp;
@@ -830,6 +868,13 @@ TEST_F(TestTCP, HandleConnCompleteCalledTest4)
     HandleConnCompleteTest(addr);
 }
 
+TEST_F(TestTCP, IdleConnectionReuseTest4)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    IdleConnectionReuseTest(addr);
+}
+
 TEST_F(TestTCP, HandleConnCloseCalledTest4)
 {
     IPAddress addr;
@@ -866,6 +911,13 @@ TEST_F(TestTCP, HandleConnCompleteCalledTest6)
     HandleConnCompleteTest(addr);
 }
 
+TEST_F(TestTCP, IdleConnectionReuseTest6)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    IdleConnectionReuseTest(addr);
+}
+
 TEST_F(TestTCP, HandleConnCloseCalledTest6)
 {
     IPAddress addr;
@@ -974,6 +1026,36 @@ TEST_F(TestTCP, CheckProcessReceivedBuffer)
     EXPECT_EQ(err, CHIP_NO_ERROR);
     EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
 
+    // Test two messages in a single packet buffer, the first one longer than the second one, so the first is passed
+    // upstream without being copied.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 151, 0 }));
+    EXPECT_TRUE(testData[1].Init((const uint32_t[]){ 40, 0 }));
+    buf = System::PacketBufferHandle::New(testData[0].mTotalLength + testData[1].mTotalLength, 0);
+    ASSERT_FALSE(buf.IsNull());
+    memcpy(buf->Start(), testData[0].mPayload, testData[0].mTotalLength);
+    memcpy(buf->Start() + testData[0].mTotalLength, testData[1].mPayload, testData[1].mTotalLength);
+    buf->SetDataLength(testData[0].mTotalLength + testData[1].mTotalLength);
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buf));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
+
+    // Test a message whose head buffer has room for the rest of the message, which is in the next buffer.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 300, 0 }));
+    constexpr size_t kHeadLength = 60;
+    buf = System::PacketBufferHandle::New(testData[0].mTotalLength, 0);
+    ASSERT_FALSE(buf.IsNull());
+    memcpy(buf->Start(), testData[0].mPayload, kHeadLength);
+    buf->SetDataLength(kHeadLength);
+    System::PacketBufferHandle tail =
+        System::PacketBufferHandle::NewWithData(testData[0].mPayload + kHeadLength, testData[0].mTotalLength - kHeadLength);
+    ASSERT_FALSE(tail.IsNull());
+    buf->AddToEnd(std::move(tail));
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buf));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
+
     // Test a single packet buffer that is larger than
     // kMaxSizeWithoutReserve but less than CHIP_CONFIG_MAX_LARGE_PAYLOAD_SIZE_BYTES.
     gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
@@ -66,6 +66,14 @@ public:
         // Always Update storage for Test purposes
         temp = value + GROUP_MSG_COUNTER_MIN_INCREMENT;
         EXPECT_SUCCESS(mStorage->SyncSetKeyValue(key.KeyName(), &temp, sizeof(uint32_t)));
+        if (isControl)
+        {
+            mGroupControlCounterLimit = temp;
+        }
+        else
+        {
+            mGroupDataCounterLimit = temp;
+        }
     }
 };
 
@@ -212,6 +220,43 @@ TEST(TestGroupMessageCounter, PeerRetrievalTest)
     EXPECT_EQ(counter2, counter);
 }
 
+TEST(TestGroupMessageCounter, PeerEvictionTest)
+{
+    NodeId peerNodeId                             = 1234;
+    FabricIndex fabricIndex                       = 1;
+    chip::Transport::PeerMessageCounter * counter = nullptr;
+    chip::Transport::PeerMessageCounter * first   = nullptr;
+    TestGroupPeerTable mGroupPeerMsgCounter;
+    mGroupPeerMsgCounter.SetEvictLeastRecentlyUsed(true);
+
+    for (uint32_t peerId = 0; peerId < CHIP_CONFIG_MAX_GROUP_DATA_PEERS; peerId++)
+    {
+        EXPECT_SUCCESS(mGroupPeerMsgCounter.FindOrAddPeer(fabricIndex, peerNodeId + peerId, false, counter));
+        EXPECT_SUCCESS(counter->VerifyOrTrustFirstGroup(100));
+        counter->CommitGroup(100);
+    }
+
+    // Looking the first peer up again makes the second one the least recently used.
+    EXPECT_SUCCESS(mGroupPeerMsgCounter.FindOrAddPeer(fabricIndex, peerNodeId, false, first));
+
+    EXPECT_SUCCESS(mGroupPeerMsgCounter.FindOrAddPeer(fabricIndex, 99, false, counter));
+    EXPECT_EQ(mGroupPeerMsgCounter.GetStats().mEvictions, 1u);
+    EXPECT_EQ(mGroupPeerMsgCounter.GetNodeIdAt(0, 1, false), 99u);
+
+    // The counter of the evicted slot starts over, while the other peers keep theirs.
+    EXPECT_SUCCESS(counter->VerifyOrTrustFirstGroup(5));
+    EXPECT_EQ(first->VerifyOrTrustFirstGroup(100), CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+
+    // Both the remaining and the new peers are still found after the eviction.
+    chip::Transport::PeerMessageCounter * found = nullptr;
+    EXPECT_SUCCESS(mGroupPeerMsgCounter.FindOrAddPeer(fabricIndex, peerNodeId, false, found));
+    EXPECT_EQ(found, first);
+    EXPECT_SUCCESS(mGroupPeerMsgCounter.FindOrAddPeer(fabricIndex, 99, false, found));
+    EXPECT_EQ(found, counter);
+    EXPECT_EQ(mGroupPeerMsgCounter.GetStats().mEvictions, 1u);
+    EXPECT_EQ(mGroupPeerMsgCounter.GetStats().mRejections, 0u);
+}
+
 TEST(TestGroupMessageCounter, CounterCommitRolloverTest)
 {
     CHIP_ERROR err                                = CHIP_NO_ERROR;
@@ -456,4 +501,28 @@ TEST(TestGroupMessageCounter, GroupMessageCounterTest)
     EXPECT_EQ(groupCientCounter5.GetCounter(false), (UINT32_MAX + GROUP_MSG_COUNTER_MIN_INCREMENT));
 }
 
+TEST(TestGroupMessageCounter, GroupMessageCounterReservationTest)
+{
+    chip::TestPersistentStorageDelegate delegate;
+    TestGroupOutgoingCounters groupClientCounter;
+    EXPECT_EQ(groupClientCounter.Init(&delegate), CHIP_NO_ERROR);
+
+    uint32_t dataCounter = groupClientCounter.GetCounter(false);
+
+    // Counter values inside the persisted window do not touch storage.
+    delegate.SetRejectWrites(true);
+    for (uint32_t i = 1; i < GROUP_MSG_COUNTER_MIN_INCREMENT; i++)
+    {
+        EXPECT_SUCCESS(groupClientCounter.IncrementCounter(false));
+    }
+
+    // Reaching the end of the window must persist the next one before the counter value is used.
+    EXPECT_NE(groupClientCounter.IncrementCounter(false), CHIP_NO_ERROR);
+    delegate.SetRejectWrites(false);
+    EXPECT_SUCCESS(groupClientCounter.IncrementCounter(false));
+
+    TestGroupOutgoingCounters groupClientCounter2(&delegate);
+    EXPECT_EQ(groupClientCounter2.GetCounter(false) - dataCounter, 2u * GROUP_MSG_COUNTER_MIN_INCREMENT + 1);
+}
+
 } // namespace
@@ -0,0 +1,77 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the RttEstimator implementation.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <system/SystemClock.h>
+#include <transport/RttEstimator.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+using chip::Transport::RttEstimator;
+
+TEST(TestRttEstimator, FirstSample)
+{
+    RttEstimator estimator;
+    EXPECT_FALSE(estimator.HasEstimate());
+
+    estimator.AddSample(200_ms32);
+    EXPECT_TRUE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetSmoothedRtt().count(), 200u);
+    EXPECT_EQ(estimator.GetRttVariation().count(), 100u);
+    // SRTT + 4 * RTTVAR
+    EXPECT_EQ(estimator.GetRetransmissionTimeout().count(), 600u);
+
+    estimator.Reset();
+    EXPECT_FALSE(estimator.HasEstimate());
+}
+
+TEST(TestRttEstimator, Smoothing)
+{
+    RttEstimator estimator;
+    estimator.AddSample(200_ms32);
+    estimator.AddSample(120_ms32);
+
+    // RTTVAR = (3 * 100 + |200 - 120|) / 4, SRTT = (7 * 200 + 120) / 8
+    EXPECT_EQ(estimator.GetRttVariation().count(), 95u);
+    EXPECT_EQ(estimator.GetSmoothedRtt().count(), 190u);
+}
+
+TEST(TestRttEstimator, ConvergesOnStableRtt)
+{
+    RttEstimator estimator;
+    estimator.AddSample(2000_ms32);
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.AddSample(30_ms32);
+    }
+
+    EXPECT_EQ(estimator.GetSmoothedRtt().count(), 30u);
+    EXPECT_EQ(estimator.GetRttVariation().count(), 0u);
+    // The variation term never goes below the clock granularity.
+    EXPECT_EQ(estimator.GetRetransmissionTimeout().count(), 31u);
+}
+
+} // namespace
@@ -461,5 +461,140 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+TEST_F(TestSecureSessionTable, LookupByLocalSessionId)
+{
+    auto table = Platform::MakeUnique<SecureSessionTable>();
+    ASSERT_NE(table.get(), nullptr);
+    table->Init();
+
+    constexpr size_t kSessionCount = CHIP_CONFIG_SECURE_SESSION_POOL_SIZE;
+    SessionHolder sessions[kSessionCount];
+
+    auto allocate = [&](SessionHolder & holder) {
+        auto session = table->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+        ASSERT_TRUE(session.HasValue());
+        EXPECT_TRUE(holder.GrabPairingSession(session.Value()));
+    };
+    auto localSessionId = [](SessionHolder & holder) { return holder.Get().Value()->AsSecureSession()->GetLocalSessionId(); };
+    auto expectFound    = [&](SessionHolder & holder) {
+        auto found = table->FindSecureSessionByLocalKey(localSessionId(holder));
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_TRUE(holder.Contains(found.Value()));
+    };
+
+    for (auto & holder : sessions)
+    {
+        allocate(holder);
+    }
+    for (auto & holder : sessions)
+    {
+        expectFound(holder);
+    }
+    EXPECT_FALSE(table->FindSecureSessionByLocalKey(kUnsecuredSessionId).HasValue());
+
+    // Release every other session; the rest must still be found, and the released IDs must not.
+    std::vector<uint16_t> releasedIds;
+    for (size_t i = 0; i < kSessionCount; i += 2)
+    {
+        releasedIds.push_back(localSessionId(sessions[i]));
+        sessions[i].Release();
+    }
+    for (uint16_t id : releasedIds)
+    {
+        EXPECT_FALSE(table->FindSecureSessionByLocalKey(id).HasValue());
+    }
+    for (size_t i = 1; i < kSessionCount; i += 2)
+    {
+        expectFound(sessions[i]);
+    }
+
+    // New sessions get IDs that are not in use.
+    for (size_t i = 0; i < kSessionCount; i += 2)
+    {
+        allocate(sessions[i]);
+        for (size_t j = 0; j < kSessionCount; j++)
+        {
+            if (j != i && sessions[j])
+            {
+                EXPECT_NE(localSessionId(sessions[i]), localSessionId(sessions[j]));
+            }
+        }
+        expectFound(sessions[i]);
+    }
+
+    for (auto & holder : sessions)
+    {
+        holder.Release();
+    }
+}
+
+TEST_F(TestSecureSessionTable, IterateByFabricAndPeer)
+{
+    auto table = Platform::MakeUnique<SecureSessionTable>();
+    ASSERT_NE(table.get(), nullptr);
+    table->Init();
+
+    const ReliableMessageProtocolConfig config = GetDefaultMRPConfig();
+    const ScopedNodeId peers[]                 = {
+        ScopedNodeId(1, kFabric1),
+        ScopedNodeId(2, kFabric1),
+        ScopedNodeId(1, kFabric2),
+    };
+    uint16_t localSessionId = 1;
+    for (const auto & peer : peers)
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            auto session = table->CreateNewSecureSessionForTest(SecureSession::Type::kCASE, localSessionId++, 100,
+                                                                peer.GetNodeId(), CATValues(), 1, peer.GetFabricIndex(), config);
+            ASSERT_TRUE(session.HasValue());
+        }
+    }
+
+    auto countOnFabric = [&](FabricIndex fabricIndex) {
+        size_t count = 0;
+        table->ForEachSessionOnFabric(fabricIndex, [&](SecureSession * session) {
+            EXPECT_EQ(session->GetFabricIndex(), fabricIndex);
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    };
+    auto countOnPeer = [&](const ScopedNodeId & peer) {
+        size_t count = 0;
+        table->ForEachSessionOnPeer(peer, [&](SecureSession * session) {
+            EXPECT_EQ(session->GetPeer(), peer);
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    };
+
+    EXPECT_EQ(countOnFabric(kFabric1), 4u);
+    EXPECT_EQ(countOnFabric(kFabric2), 2u);
+    EXPECT_EQ(countOnFabric(kFabric3), 0u);
+    EXPECT_EQ(countOnPeer(peers[0]), 2u);
+    EXPECT_EQ(countOnPeer(peers[1]), 2u);
+    EXPECT_EQ(countOnPeer(peers[2]), 2u);
+
+    // Sessions released during the walk, here by having no other reference than the one dropped by MarkForEviction,
+    // do not end it early.
+    size_t evicted = 0;
+    table->ForEachSessionOnFabric(kFabric1, [&](SecureSession * session) {
+        session->MarkForEviction();
+        evicted++;
+        return Loop::Continue;
+    });
+    EXPECT_EQ(evicted, 4u);
+    EXPECT_EQ(countOnFabric(kFabric1), 0u);
+    EXPECT_EQ(countOnPeer(peers[0]), 0u);
+    EXPECT_EQ(countOnPeer(peers[2]), 2u);
+
+    table->ForEachSession([](SecureSession * session) {
+        session->MarkForEviction();
+        return Loop::Continue;
+    });
+}
+
 } // namespace Transport
 } // namespace chip
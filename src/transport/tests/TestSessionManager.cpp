@@ -22,6 +22,7 @@
  */
 
 #include <errno.h>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -1022,6 +1023,31 @@ TEST_F(TestSessionManager, TestFindSecureSessionForNode)
     sessionManager.Shutdown();
 }
 
+TEST_F(TestSessionManager, TestMessageTypeStatsTable)
+{
+    MessageTypeStatsTable table;
+    EXPECT_EQ(table.Size(), static_cast<size_t>(0));
+
+    table.CountSent(Protocols::InteractionModel::Id, 1, 10);
+    table.CountReceived(Protocols::InteractionModel::Id, 1, 20);
+    table.CountSent(Protocols::SecureChannel::Id, 1, 30);
+    ASSERT_EQ(table.Size(), static_cast<size_t>(2));
+    EXPECT_EQ(table[0].messagesSent, static_cast<uint32_t>(1));
+    EXPECT_EQ(table[0].bytesSent, static_cast<uint32_t>(10));
+    EXPECT_EQ(table[0].messagesReceived, static_cast<uint32_t>(1));
+    EXPECT_EQ(table[0].bytesReceived, static_cast<uint32_t>(20));
+    EXPECT_EQ(table[1].protocolId, Protocols::SecureChannel::Id);
+    EXPECT_EQ(table[1].bytesSent, static_cast<uint32_t>(30));
+
+    // Message types beyond the capacity are only counted as untracked.
+    for (size_t i = 0; i < MessageTypeStatsTable::kCapacity; i++)
+    {
+        table.CountSent(Protocols::BDX::Id, static_cast<uint8_t>(i), 1);
+    }
+    EXPECT_EQ(table.Size(), MessageTypeStatsTable::kCapacity);
+    EXPECT_EQ(table.UntrackedMessages(), static_cast<uint32_t>(2));
+}
+
 TEST_F(TestSessionManager, TestMessageStats)
 {
     uint16_t payload_len = sizeof(PAYLOAD);
@@ -1103,9 +1129,135 @@ TEST_F(TestSessionManager, TestMessageStats)
     messageStatistics = sessionManager.GetMessageStats();
     EXPECT_EQ(messageStatistics.interactionModelMessagesSent, static_cast<uint32_t>(1));
     EXPECT_EQ(messageStatistics.interactionModelMessagesReceived, static_cast<uint32_t>(1));
+    EXPECT_EQ(messageStatistics.duplicateMessagesReceived, static_cast<uint32_t>(0));
+    EXPECT_EQ(messageStatistics.decryptionFailures, static_cast<uint32_t>(0));
+
+    MessageTypeStatsTable messageTypeStatistics;
+    sessionManager.GetMessageTypeStats(messageTypeStatistics);
+    ASSERT_EQ(messageTypeStatistics.Size(), static_cast<size_t>(1));
+    EXPECT_EQ(messageTypeStatistics[0].protocolId, Protocols::InteractionModel::Id);
+    EXPECT_EQ(messageTypeStatistics[0].messageType, 0);
+    EXPECT_EQ(messageTypeStatistics[0].messagesSent, static_cast<uint32_t>(1));
+    EXPECT_EQ(messageTypeStatistics[0].messagesReceived, static_cast<uint32_t>(1));
+    EXPECT_GT(messageTypeStatistics[0].bytesSent, static_cast<uint32_t>(payload_len));
+    EXPECT_EQ(messageTypeStatistics[0].bytesReceived, messageTypeStatistics[0].bytesSent);
+
+    // Sending the same prepared message again is detected as a duplicate
+    err = sessionManager.SendPreparedMessage(aliceToBobSession.Get().Value(), preparedMessage);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    mContext.DrainAndServiceIO();
+    messageStatistics = sessionManager.GetMessageStats();
+    EXPECT_EQ(messageStatistics.duplicateMessagesReceived, static_cast<uint32_t>(1));
 
     // Shutdown
     sessionManager.Shutdown();
 }
 
+class QueueingDecryptOffload : public SecureMessageDecryptOffload
+{
+public:
+    CHIP_ERROR Offload(Platform::UniquePtr<PendingSecureUnicastMessage> && message) override
+    {
+        VerifyOrReturnError(mAccept, CHIP_ERROR_NO_MEMORY);
+        mMessages.push_back(std::move(message));
+        return CHIP_NO_ERROR;
+    }
+
+    bool mAccept = true;
+    std::vector<Platform::UniquePtr<PendingSecureUnicastMessage>> mMessages;
+};
+
+TEST_F(TestSessionManager, DecryptOffloadTest)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    TestSessMgrCallback callback;
+    QueueingDecryptOffload offload;
+    FabricTableHolder fabricTableHolder;
+    SessionManager sessionManager;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+    chip::TestPersistentStorageDelegate deviceStorage;
+    chip::Crypto::DefaultSessionKeystore sessionKeystore;
+    FabricTable & fabricTable    = fabricTableHolder.GetFabricTable();
+    FabricIndex aliceFabricIndex = kUndefinedFabricIndex;
+    FabricIndex bobFabricIndex   = kUndefinedFabricIndex;
+
+    EXPECT_EQ(CHIP_NO_ERROR, fabricTableHolder.Init());
+    EXPECT_EQ(CHIP_NO_ERROR,
+              sessionManager.Init(&mContext.GetSystemLayer(), &mContext.GetTransportMgr(), &gMessageCounterManager, &deviceStorage,
+                                  &fabricTableHolder.GetFabricTable(), sessionKeystore));
+
+    sessionManager.SetMessageDelegate(&callback);
+    sessionManager.SetDecryptOffload(&offload);
+
+    Transport::PeerAddress peer(Transport::PeerAddress::UDP(addr, CHIP_PORT));
+
+    err =
+        fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                          GetNodeA1CertAsset().mCert, GetNodeA1CertAsset().mKey, &aliceFabricIndex);
+    EXPECT_EQ(CHIP_NO_ERROR, err);
+
+    err = fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                            GetNodeA2CertAsset().mCert, GetNodeA2CertAsset().mKey, &bobFabricIndex);
+    EXPECT_EQ(CHIP_NO_ERROR, err);
+
+    SessionHolder aliceToBobSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(aliceToBobSession, 2,
+                                                      fabricTable.FindFabricWithIndex(bobFabricIndex)->GetNodeId(), 1,
+                                                      aliceFabricIndex, peer, CryptoContext::SessionRole::kInitiator);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    SessionHolder bobToAliceSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(bobToAliceSession, 1,
+                                                      fabricTable.FindFabricWithIndex(aliceFabricIndex)->GetNodeId(), 2,
+                                                      bobFabricIndex, peer, CryptoContext::SessionRole::kResponder);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(0);
+    payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+    payloadHeader.SetInitiator(true);
+
+    auto sendMessage = [&]() {
+        EncryptedPacketBufferHandle preparedMessage;
+        EXPECT_EQ(sessionManager.PrepareMessage(aliceToBobSession.Get().Value(), payloadHeader,
+                                                chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD)), preparedMessage),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(sessionManager.SendPreparedMessage(aliceToBobSession.Get().Value(), preparedMessage), CHIP_NO_ERROR);
+        mContext.DrainAndServiceIO();
+    };
+
+    // Offloaded messages only get dispatched once they are completed, in order.
+    sendMessage();
+    sendMessage();
+    EXPECT_EQ(callback.ReceiveHandlerCallCount, 0);
+    ASSERT_EQ(offload.mMessages.size(), 2u);
+    EXPECT_EQ(offload.mMessages[0]->GetSessionKey(), offload.mMessages[1]->GetSessionKey());
+
+    for (auto & message : offload.mMessages)
+    {
+        message->Decrypt();
+        PendingSecureUnicastMessage::Complete(std::move(message));
+    }
+    offload.mMessages.clear();
+    EXPECT_EQ(callback.ReceiveHandlerCallCount, 2);
+
+    // A message that can't be offloaded is decrypted inline.
+    offload.mAccept = false;
+    sendMessage();
+    EXPECT_EQ(callback.ReceiveHandlerCallCount, 3);
+    EXPECT_TRUE(offload.mMessages.empty());
+
+    // Messages completed after shutdown are dropped.
+    offload.mAccept = true;
+    sendMessage();
+    ASSERT_EQ(offload.mMessages.size(), 1u);
+    sessionManager.Shutdown();
+    offload.mMessages[0]->Decrypt();
+    PendingSecureUnicastMessage::Complete(std::move(offload.mMessages[0]));
+    EXPECT_EQ(callback.ReceiveHandlerCallCount, 3);
+}
+
 } // namespace